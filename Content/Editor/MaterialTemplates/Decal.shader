@@ -31,8 +31,22 @@ struct MaterialInput
 	float4 SvPosition;
 	float3 PreSkinnedPosition;
 	float3 PreSkinnedNormal;
+#if USE_INSTANCING
+	float4x4 InstanceWorld;
+	float InstanceRandom;
+#endif
 };
 
+// Gets the decal local to world transformation matrix (supports instancing)
+float4x4 GetDecalWorld(MaterialInput input)
+{
+#if USE_INSTANCING
+	return input.InstanceWorld;
+#else
+	return WorldMatrix;
+#endif
+}
+
 // Transforms a vector from tangent space to world space
 float3 TransformTangentVectorToWorld(MaterialInput input, float3 tangentVector)
 {
@@ -60,21 +74,21 @@ float3 TransformViewVectorToWorld(MaterialInput input, float3 viewVector)
 // Transforms a vector from local space to world space
 float3 TransformLocalVectorToWorld(MaterialInput input, float3 localVector)
 {
-	float3x3 localToWorld = (float3x3)WorldMatrix;
+	float3x3 localToWorld = (float3x3)GetDecalWorld(input);
 	return mul(localVector, localToWorld);
 }
 
 // Transforms a vector from local space to world space
 float3 TransformWorldVectorToLocal(MaterialInput input, float3 worldVector)
 {
-	float3x3 localToWorld = (float3x3)WorldMatrix;
+	float3x3 localToWorld = (float3x3)GetDecalWorld(input);
 	return mul(localToWorld, worldVector);
 }
 
 // Gets the current object position (supports instancing)
 float3 GetObjectPosition(MaterialInput input)
 {
-	return WorldMatrix[3].xyz;
+	return GetDecalWorld(input)[3].xyz;
 }
 
 // Gets the current object size
@@ -86,7 +100,11 @@ float3 GetObjectSize(MaterialInput input)
 // Get the current object random value supports instancing)
 float GetPerInstanceRandom(MaterialInput input)
 {
+#if USE_INSTANCING
+	return input.InstanceRandom;
+#else
 	return 0;
+#endif
 }
 
 // Get the current object LOD transition dither factor (supports instancing)
@@ -116,22 +134,78 @@ Material GetMaterialPS(MaterialInput input)
 #define DECAL_BLEND_MODE_NORMAL      2
 #define DECAL_BLEND_MODE_EMISSIVE    3
 
+// Vertex Shader input for decals rendering
+struct DecalInput
+{
+	float3 Position           : POSITION0;
+#if USE_INSTANCING
+	float4 InstanceWorld0     : ATTRIBUTE0; // Rows of the transposed local to world matrix
+	float4 InstanceWorld1     : ATTRIBUTE1;
+	float4 InstanceWorld2     : ATTRIBUTE2;
+	float4 InstanceInvWorld0  : ATTRIBUTE3; // Rows of the transposed world to local matrix
+	float4 InstanceInvWorld1  : ATTRIBUTE4;
+	float4 InstanceInvWorld2  : ATTRIBUTE5;
+	float InstanceRandom      : ATTRIBUTE6;
+#endif
+};
+
+// Vertex Shader output for decals rendering
+struct DecalOutput
+{
+	float4 Position                           : SV_Position;
+#if USE_INSTANCING
+	nointerpolation float4 InstanceWorld0     : TEXCOORD0;
+	nointerpolation float4 InstanceWorld1     : TEXCOORD1;
+	nointerpolation float4 InstanceWorld2     : TEXCOORD2;
+	nointerpolation float4 InstanceInvWorld0  : TEXCOORD3;
+	nointerpolation float4 InstanceInvWorld1  : TEXCOORD4;
+	nointerpolation float4 InstanceInvWorld2  : TEXCOORD5;
+	nointerpolation float InstanceRandom      : TEXCOORD6;
+#endif
+};
+
 // Vertex Shader function for decals rendering
 META_VS(true, FEATURE_LEVEL_ES2)
-META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT, 0, 0, PER_VERTEX, 0, true)
-void VS_Decal(in float3 Position : POSITION0, out float4 SvPosition : SV_Position)
+META_PERMUTATION_1(USE_INSTANCING=0)
+META_PERMUTATION_1(USE_INSTANCING=1)
+META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(ATTRIBUTE,0, R32G32B32A32_FLOAT,3, 0,     PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,1, R32G32B32A32_FLOAT,3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,2, R32G32B32A32_FLOAT,3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,3, R32G32B32A32_FLOAT,3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,4, R32G32B32A32_FLOAT,3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,5, R32G32B32A32_FLOAT,3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,6, R32_FLOAT,         3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+DecalOutput VS_Decal(DecalInput input)
 {
+	DecalOutput output;
+
 	// Compute world space vertex position
-	float3 worldPosition = mul(float4(Position.xyz, 1), WorldMatrix).xyz;
+#if USE_INSTANCING
+	float4 position = float4(input.Position.xyz, 1);
+	float3 worldPosition = float3(dot(position, input.InstanceWorld0), dot(position, input.InstanceWorld1), dot(position, input.InstanceWorld2));
+	output.InstanceWorld0 = input.InstanceWorld0;
+	output.InstanceWorld1 = input.InstanceWorld1;
+	output.InstanceWorld2 = input.InstanceWorld2;
+	output.InstanceInvWorld0 = input.InstanceInvWorld0;
+	output.InstanceInvWorld1 = input.InstanceInvWorld1;
+	output.InstanceInvWorld2 = input.InstanceInvWorld2;
+	output.InstanceRandom = input.InstanceRandom;
+#else
+	float3 worldPosition = mul(float4(input.Position.xyz, 1), WorldMatrix).xyz;
+#endif
 
 	// Compute clip space position
-	SvPosition = mul(float4(worldPosition.xyz, 1), ViewProjectionMatrix);
+	output.Position = mul(float4(worldPosition.xyz, 1), ViewProjectionMatrix);
+	return output;
 }
 
 // Pixel Shader function for decals rendering
 META_PS(true, FEATURE_LEVEL_ES2)
+META_PERMUTATION_1(USE_INSTANCING=0)
+META_PERMUTATION_1(USE_INSTANCING=1)
 void PS_Decal(
-	in float4 SvPosition : SV_Position
+	in DecalOutput input
 	, out float4 Out0 : SV_Target0
 #if DECAL_BLEND_MODE == DECAL_BLEND_MODE_TRANSLUCENT
 	, out float4 Out1 : SV_Target1
@@ -144,12 +218,18 @@ void PS_Decal(
 #endif
 	)
 {
+	float4 SvPosition = input.Position;
 	float2 screenUV = SvPosition.xy * ScreenSize.zw;
 	SvPosition.z = SAMPLE_RT(DepthBuffer, screenUV).r;
 
 	float4 positionHS = mul(float4(SvPosition.xyz, 1), SVPositionToWorld);
 	float3 positionWS = positionHS.xyz / positionHS.w;
+#if USE_INSTANCING
+	float4 position = float4(positionWS, 1);
+	float3 positionOS = float3(dot(position, input.InstanceInvWorld0), dot(position, input.InstanceInvWorld1), dot(position, input.InstanceInvWorld2));
+#else
 	float3 positionOS = mul(float4(positionWS, 1), InvWorld).xyz;
+#endif
 
 	clip(0.5 - abs(positionOS.xyz));
 	float2 decalUVs = positionOS.xz + 0.5f;
@@ -160,6 +240,10 @@ void PS_Decal(
 	materialInput.TexCoord = decalUVs;
 	materialInput.TwoSidedSign = 1;
 	materialInput.SvPosition = SvPosition;
+#if USE_INSTANCING
+	materialInput.InstanceWorld = transpose(float4x4(input.InstanceWorld0, input.InstanceWorld1, input.InstanceWorld2, float4(0, 0, 0, 1)));
+	materialInput.InstanceRandom = input.InstanceRandom;
+#endif
 	
 	// Build tangent to world transformation matrix
 	float3 ddxWp = ddx(positionWS);
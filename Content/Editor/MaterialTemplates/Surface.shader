@@ -487,7 +487,7 @@ float3x3 SkinTangents(ModelInput_Skinned input, SkinningData data)
 }
 
 // Vertex Shader function for GBuffers/Depth Pass (skinned mesh rendering)
-META_VS(true, FEATURE_LEVEL_ES2)
+META_VS(CAN_USE_SKINNING, FEATURE_LEVEL_ES2)
 META_PERMUTATION_1(USE_SKINNING=1)
 META_PERMUTATION_2(USE_SKINNING=1, PER_BONE_MOTION_BLUR=1)
 META_VS_IN_ELEMENT(POSITION,     0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, true)
@@ -569,6 +569,30 @@ VertexOutput VS_Skinned(ModelInput_Skinned input)
 
 #endif
 
+// Vertex Shader function for Motion Vectors Pass (skinned mesh rendering with vertices skinned by the compute shader, previous frame positions are in the third vertex buffer)
+META_VS(CAN_USE_SKINNING, FEATURE_LEVEL_SM5)
+META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(TEXCOORD, 0, R16G16_FLOAT,      1, 0,     PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(NORMAL,   0, R10G10B10A2_UNORM, 1, ALIGN, PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(TANGENT,  0, R10G10B10A2_UNORM, 1, ALIGN, PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(TEXCOORD, 1, R16G16_FLOAT,      1, ALIGN, PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(POSITION, 1, R32G32B32_FLOAT,   2, 0,     PER_VERTEX, 0, true)
+VertexOutput VS_PreSkinned(ModelInput_PreSkinned input)
+{
+	ModelInput modelInput = (ModelInput)0;
+	modelInput.Position = input.Position;
+	modelInput.TexCoord = input.TexCoord;
+	modelInput.Normal = input.Normal;
+	modelInput.Tangent = input.Tangent;
+	modelInput.LightmapUV = input.LightmapUV;
+#if USE_VERTEX_COLOR
+	modelInput.Color = half4(0, 0, 0, 1);
+#endif
+	VertexOutput output = VS(modelInput);
+	output.Geometry.PrevWorldPosition = mul(float4(input.PrevPosition, 1), PrevWorldMatrix).xyz;
+	return output;
+}
+
 #if USE_DITHERED_LOD_TRANSITION
 
 void ClipLODTransition(PixelInput input)
@@ -27,6 +27,13 @@ float TerrainChunkSizeLOD0;
 float4 HeightmapUVScaleBias;
 float4 NeighborLOD;
 float2 OffsetUV;
+uint ChunksOffset;
+uint UseChunksBuffer;
+float4 VirtualTextureUVScaleBias;
+float3 LODViewPosition;
+float LODDistribution;
+float LODBias;
+float InvChunkEdgeSize;
 float2 Dummy0;
 @1META_CB_END
 
@@ -35,6 +42,25 @@ Texture2D Heightmap : register(t0);
 Texture2D Splatmap0 : register(t1);
 Texture2D Splatmap1 : register(t2);
 
+// Terrain virtual texture with the cached material properties (RGB: Color, A: AO; RGB: Tangent normal, A: Mask; R: Roughness, G: Metalness, B: Specular)
+Texture2D VirtualTexture0 : register(t3);
+Texture2D VirtualTexture1 : register(t4);
+Texture2D VirtualTexture2 : register(t5);
+
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+// Terrain chunk instance culled on a GPU (must match TerrainChunkInstance in TerrainCullingPass)
+struct TerrainChunkInstance
+{
+	float4 NeighborLOD;
+	float4 LightmapArea;
+	float2 ChunkCoord;
+	float2 Padding;
+};
+
+// Terrain chunks instances culled on a GPU (used if UseChunksBuffer is set)
+StructuredBuffer<TerrainChunkInstance> TerrainChunks : register(t6);
+#endif
+
 // Shader resources
 @2
 // Geometry data passed though the graphics rendering stages up to the pixel shader
@@ -258,11 +284,11 @@ Material GetMaterialPS(MaterialInput input)
 }
 
 // Calculates LOD value (with fractional part for blending)
-float CalcLOD(float2 xy, float4 morph)
+float CalcLOD(float2 xy, float4 morph, float4 neighborLOD)
 {
 #if USE_SMOOTH_LOD_TRANSITION
 	// Use LOD value based on Barycentric coordinates to morph to the lower LOD near chunk edges
-	float4 lodCalculated = morph * CurrentLOD + NeighborLOD * (float4(1, 1, 1, 1) - morph);
+	float4 lodCalculated = morph * CurrentLOD + neighborLOD * (float4(1, 1, 1, 1) - morph);
 
 	// Pick a quadrant (top, left, right or bottom)
 	float lod;
@@ -304,21 +330,49 @@ struct TerrainVertexInput
 META_VS(true, FEATURE_LEVEL_ES2)
 META_VS_IN_ELEMENT(TEXCOORD, 0, R32G32_FLOAT,   0, ALIGN, PER_VERTEX, 0, true)
 META_VS_IN_ELEMENT(TEXCOORD, 1, R8G8B8A8_UNORM, 0, ALIGN, PER_VERTEX, 0, true)
-VertexOutput VS(TerrainVertexInput input)
+VertexOutput VS(TerrainVertexInput input, uint instanceID : SV_InstanceID)
 {
 	VertexOutput output;
 
+	// Get the chunk data (chunks culled on a GPU are drawn as instances within the patch)
+	float4 neighborLOD = NeighborLOD;
+	float4 lightmapArea = LightmapArea;
+	float4 heightmapUVScaleBias = HeightmapUVScaleBias;
+	float2 chunkOffset = float2(0, 0);
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+	if (UseChunksBuffer)
+	{
+		TerrainChunkInstance chunk = TerrainChunks[ChunksOffset + instanceID];
+		neighborLOD = chunk.NeighborLOD;
+		lightmapArea = chunk.LightmapArea;
+		heightmapUVScaleBias = float4(0.25f, 0.25f, chunk.ChunkCoord * 0.25f);
+		chunkOffset = chunk.ChunkCoord;
+	}
+#endif
+
 	// Calculate terrain LOD for this chunk
-	float lodCalculated = CalcLOD(input.TexCoord, input.Morph);
+	float lodCalculated = CalcLOD(input.TexCoord, input.Morph, neighborLOD);
 	float lodValue = CurrentLOD;
 	float morphAlpha = lodCalculated - CurrentLOD;
 
 	// Sample heightmap
-	float2 heightmapUVs = input.TexCoord * HeightmapUVScaleBias.xy + HeightmapUVScaleBias.zw;
+	float2 heightmapUVs = input.TexCoord * heightmapUVScaleBias.xy + heightmapUVScaleBias.zw;
 #if USE_SMOOTH_LOD_TRANSITION
 	float4 heightmapValueThisLOD = Heightmap.SampleLevel(SamplerPointClamp, heightmapUVs, lodValue);
 	float2 nextLODPos = round(input.TexCoord * ChunkSizeNextLOD) / ChunkSizeNextLOD;
-	float2 heightmapUVsNextLOD = nextLODPos * HeightmapUVScaleBias.xy + HeightmapUVScaleBias.zw;
+	float2 heightmapUVsNextLOD = nextLODPos * heightmapUVScaleBias.xy + heightmapUVScaleBias.zw;
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+	if (UseChunksBuffer)
+	{
+		// Continuous geomorphing to the next LOD based on the vertex distance to the view (chunk edges keep the neighbors LOD to prevent cracks)
+		float heightThisLOD = (float)((int)(heightmapValueThisLOD.x * 255.0) + ((int)(heightmapValueThisLOD.y * 255) << 8)) / 65535.0;
+		float2 positionXZThisLOD = (input.TexCoord + chunkOffset) * TerrainChunkSizeLOD0;
+		float3 positionThisLOD = mul(float4(positionXZThisLOD.x, heightThisLOD, positionXZThisLOD.y, 1), WorldMatrix).xyz;
+		float distanceLOD = pow(length(positionThisLOD - LODViewPosition) * InvChunkEdgeSize, LODDistribution) + LODBias;
+		float edgeMorph = min(min(input.Morph.x, input.Morph.y), min(input.Morph.z, input.Morph.w));
+		morphAlpha = lerp(morphAlpha, max(morphAlpha, saturate(distanceLOD - CurrentLOD)), edgeMorph);
+	}
+#endif
 	float4 heightmapValueNextLOD = Heightmap.SampleLevel(SamplerPointClamp, heightmapUVsNextLOD, lodValue + 1);
 	float4 heightmapValue = lerp(heightmapValueThisLOD, heightmapValueNextLOD, morphAlpha);
 	bool isHole = max(heightmapValueThisLOD.b + heightmapValueThisLOD.a, heightmapValueNextLOD.b + heightmapValueNextLOD.a) >= 1.9f;
@@ -362,6 +416,7 @@ VertexOutput VS(TerrainVertexInput input)
 #else
 	float2 positionXZ = input.TexCoord * TerrainChunkSizeLOD0;
 #endif
+	positionXZ += chunkOffset * TerrainChunkSizeLOD0;
 	float3 position = float3(positionXZ.x, height, positionXZ.y);
 
 	// Compute world space vertex position
@@ -377,7 +432,7 @@ VertexOutput VS(TerrainVertexInput input)
 	float2 texCoord = input.TexCoord;
 #endif
 	output.Geometry.TexCoord = positionXZ * (1.0f / TerrainChunkSizeLOD0) + OffsetUV;
-	output.Geometry.LightmapUV = texCoord * LightmapArea.zw + LightmapArea.xy;
+	output.Geometry.LightmapUV = texCoord * lightmapArea.zw + lightmapArea.xy;
 
 	// Extract terrain layers weights from the splatmap
 #if USE_TERRAIN_LAYERS
@@ -443,6 +498,78 @@ void PS_Depth(PixelInput input)
 #endif
 }
 
+// Pixel Shader function for Terrain Virtual Texture tiles rendering (outputs the material properties)
+META_PS(true, FEATURE_LEVEL_ES2)
+void PS_VirtualTexture(in PixelInput input, out float4 RT0 : SV_Target0, out float4 RT1 : SV_Target1, out float4 RT2 : SV_Target2)
+{
+	MaterialInput materialInput = GetMaterialInput(input);
+	Material material = GetMaterialPS(materialInput);
+#if MATERIAL_MASKED
+	float mask = material.Mask;
+#else
+	float mask = 1;
+#endif
+	RT0 = float4(material.Color, material.AO);
+	RT1 = float4(material.TangentNormal * 0.5 + 0.5, mask);
+	RT2 = float4(material.Roughness, material.Metalness, material.Specular, 0);
+}
+
+// Pixel Shader function for GBuffer Pass that uses the material properties cached in the Terrain Virtual Texture
+META_PS(true, FEATURE_LEVEL_ES2)
+META_PERMUTATION_1(USE_LIGHTMAP=0)
+META_PERMUTATION_1(USE_LIGHTMAP=1)
+void PS_GBufferVirtual(
+		in PixelInput input
+		,out float4 Light : SV_Target0
+		,out float4 RT0   : SV_Target1
+		,out float4 RT1   : SV_Target2
+		,out float4 RT2   : SV_Target3
+#if USE_GBUFFER_CUSTOM_DATA
+		,out float4 RT3   : SV_Target4
+#endif
+	)
+{
+	Light = float4(0, 0, 0, 1);
+
+	// Sample the virtual texture (wrapped around the view)
+	MaterialInput materialInput = GetMaterialInput(input);
+	float2 uv = input.Geometry.WorldPosition.xz * VirtualTextureUVScaleBias.xy + VirtualTextureUVScaleBias.zw;
+	float4 virtualTexture0 = VirtualTexture0.Sample(SamplerLinearWrap, uv);
+	float4 virtualTexture1 = VirtualTexture1.Sample(SamplerLinearWrap, uv);
+	float4 virtualTexture2 = VirtualTexture2.Sample(SamplerLinearWrap, uv);
+
+	// Masking
+#if MATERIAL_MASKED
+	clip(virtualTexture1.a - MATERIAL_MASK_THRESHOLD);
+#endif
+
+	// Unpack material properties (normal vector uses the tangent space of the drawn geometry)
+	Material material = (Material)0;
+	material.Color = virtualTexture0.rgb;
+	material.AO = virtualTexture0.a;
+	material.TangentNormal = normalize(virtualTexture1.rgb * 2.0 - 1.0);
+	material.WorldNormal = normalize(TransformTangentVectorToWorld(materialInput, material.TangentNormal));
+	material.Roughness = virtualTexture2.r;
+	material.Metalness = virtualTexture2.g;
+	material.Specular = virtualTexture2.b;
+
+#if USE_LIGHTMAP
+	float3 diffuseColor = GetDiffuseColor(material.Color, material.Metalness);
+
+	// Apply static indirect light
+	float3 diffuseIndirectLighting = SampleLightmap(material, materialInput);
+	Light.rgb = diffuseColor * diffuseIndirectLighting * AOMultiBounce(material.AO, diffuseColor);
+#endif
+
+	// Pack material properties to GBuffer
+	RT0 = float4(material.Color, material.AO);
+	RT1 = float4(material.WorldNormal * 0.5 + 0.5, MATERIAL_SHADING_MODEL * (1.0 / 3.0));
+	RT2 = float4(material.Roughness, material.Metalness, material.Specular, 0);
+#if USE_GBUFFER_CUSTOM_DATA
+	RT3 = float4(0, 0, 0, 0);
+#endif
+}
+
 #if _PS_QuadOverdraw
 
 #include "./Flax/Editor/QuadOverdraw.hlsl"
@@ -19,6 +19,7 @@ partial struct Options
             private bool ShowSmoothingNormalsAngle => ShowGeometry && CalculateNormals;
             private bool ShowSmoothingTangentsAngle => ShowGeometry && CalculateTangents;
             private bool ShowFramesRange => ShowAnimation && Duration == ModelTool.AnimationDuration.Custom;
+            private bool ShowCompression => ShowAnimation && CompressAnimation;
         }
     }
 }
@@ -479,9 +479,17 @@ public void DrawThumbnail(ref Rectangle rectangle)
 
             // Draw thumbnail
             if (_thumbnail.IsValid)
+            {
                 Render2D.DrawSprite(_thumbnail, rectangle);
+            }
             else
+            {
                 Render2D.FillRectangle(rectangle, Color.Black);
+
+                // Generate the thumbnails of the visible items first
+                if (this is AssetItem assetItem)
+                    Editor.Instance.Thumbnails.OnItemVisible(assetItem);
+            }
         }
 
         /// <summary>
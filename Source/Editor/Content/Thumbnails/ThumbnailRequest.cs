@@ -62,6 +62,11 @@ public enum States
         /// </summary>
         public object Tag;
 
+        /// <summary>
+        /// The last engine frame when the item thumbnail was visible (eg. in Content Window). Requests for the visible items are processed first.
+        /// </summary>
+        public ulong LastVisibleFrame;
+
         /// <summary>
         /// Determines whether thumbnail can be drawn for the item.
         /// </summary>
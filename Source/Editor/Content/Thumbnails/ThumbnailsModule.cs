@@ -2,6 +2,7 @@
 
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.IO;
 using FlaxEditor.Modules;
 using FlaxEngine;
@@ -21,14 +22,25 @@ public sealed class ThumbnailsModule : EditorModule, IContentItemOwner
         /// </summary>
         public const float MinimumRequiredResourcesQuality = 0.8f;
 
+        /// <summary>
+        /// The time budget (in milliseconds) for the thumbnails rendering in a single frame. At least one thumbnail is rendered every frame when any is ready.
+        /// </summary>
+        public float RenderBudget = 4.0f;
+
         // TODO: free atlas slots for deleted assets
 
         private readonly List<PreviewsCache> _cache = new List<PreviewsCache>(4);
         private readonly string _cacheFolder;
+        private readonly string _stampsPath;
+        private readonly Dictionary<Guid, ulong> _stamps = new Dictionary<Guid, ulong>();
+        private bool _stampsDirty;
 
         private DateTime _lastFlushTime;
 
         private readonly List<ThumbnailRequest> _requests = new List<ThumbnailRequest>(128);
+        private readonly Dictionary<AssetItem, ThumbnailRequest> _requestsLookup = new Dictionary<AssetItem, ThumbnailRequest>(128);
+        private readonly List<ThumbnailRequest> _requestsHidden = new List<ThumbnailRequest>(128);
+        private bool _requestsOrderDirty;
         private readonly PreviewRoot _guiRoot = new PreviewRoot();
         private RenderTask _task;
         private GPUTexture _output;
@@ -37,6 +49,7 @@ internal ThumbnailsModule(Editor editor)
         : base(editor)
         {
             _cacheFolder = StringUtils.CombinePaths(Globals.ProjectCacheFolder, "Thumbnails");
+            _stampsPath = StringUtils.CombinePaths(_cacheFolder, "stamps.bin");
             _lastFlushTime = DateTime.UtcNow;
         }
 
@@ -77,12 +90,25 @@ public void RequestPreview(ContentItem item)
                 if (FindRequest(assetItem) == null)
                 {
                     // Check each cache atlas
+                    var stamp = GetStamp(assetItem);
                     for (int i = 0; i < _cache.Count; i++)
                     {
                         var sprite = _cache[i].FindSlot(assetItem.ID);
                         if (sprite.IsValid)
                         {
+                            if (_stamps.TryGetValue(assetItem.ID, out var cachedStamp) && cachedStamp != stamp)
+                            {
+                                // Asset file has been modified since the thumbnail was rendered (eg. externally when Editor was closed)
+                                _cache[i].ReleaseSlot(assetItem.ID);
+                                break;
+                            }
+
                             // Found!
+                            if (cachedStamp != stamp)
+                            {
+                                _stamps[assetItem.ID] = stamp;
+                                _stampsDirty = true;
+                            }
                             item.Thumbnail = sprite;
                             return;
                         }
@@ -122,6 +148,25 @@ public void DeletePreview(ContentItem item)
                         break;
                     }
                 }
+                _stampsDirty |= _stamps.Remove(assetItem.ID);
+            }
+        }
+
+        /// <summary>
+        /// Marks the item as visible (eg. in the Content Window) to generate its preview before the other items.
+        /// </summary>
+        /// <param name="item">The item.</param>
+        public void OnItemVisible(AssetItem item)
+        {
+            lock (_requests)
+            {
+                if (_requestsLookup.TryGetValue(item, out var request))
+                {
+                    var frame = Engine.FrameCount;
+                    if (request.LastVisibleFrame + 1 < frame)
+                        _requestsOrderDirty = true;
+                    request.LastVisibleFrame = frame;
+                }
             }
         }
 
@@ -196,6 +241,7 @@ public override void OnInit()
                 }
             }
             Editor.Log(string.Format("Previews cache count: {0} (capacity for {1} icons)", atlases, atlases * PreviewsCache.AssetIconsPerAtlas));
+            LoadStamps();
 
             // Prepare at least one atlas
             if (_cache.Count == 0)
@@ -217,77 +263,93 @@ private void OnRender(RenderTask task, GPUContext context)
         {
             lock (_requests)
             {
-                // Check if there is ready next asset to render thumbnail for it
-                // But don't check whole queue, only a few items
-                var request = GetReadyRequest(10);
-                if (request == null)
+                // Render many thumbnails within the time budget to process large folders faster
+                var stopwatch = Stopwatch.StartNew();
+                do
                 {
-                    // Disable task
-                    _task.Enabled = false;
-                    return;
-                }
-
-                // Find atlas with an free slot
-                var atlas = GetValidAtlas();
-                if (atlas == null)
-                {
-                    // Error
-                    _task.Enabled = false;
-                    _requests.Clear();
-                    Editor.LogError("Failed to get atlas.");
-                    return;
-                }
+                    if (!RenderRequest(context))
+                        break;
+                } while (stopwatch.Elapsed.TotalMilliseconds < RenderBudget);
+            }
+        }
 
-                // Wait for atlas being loaded
-                if (!atlas.IsReady)
-                    return;
+        private bool RenderRequest(GPUContext context)
+        {
+            // Check if there is ready next asset to render thumbnail for it
+            // But don't check whole queue, only a few items
+            var request = GetReadyRequest(10);
+            if (request == null)
+            {
+                // Disable task
+                _task.Enabled = false;
+                return false;
+            }
 
-                try
-                {
-                    // Setup
-                    _guiRoot.RemoveChildren();
-                    _guiRoot.AccentColor = request.Proxy.AccentColor;
+            // Find atlas with an free slot
+            var atlas = GetValidAtlas();
+            if (atlas == null)
+            {
+                // Error
+                _task.Enabled = false;
+                while (_requests.Count > 0)
+                    RemoveRequest(_requests[0]);
+                Editor.LogError("Failed to get atlas.");
+                return false;
+            }
 
-                    // Call proxy to prepare for thumbnail rendering
-                    request.Proxy.OnThumbnailDrawBegin(request, _guiRoot, context);
-                    _guiRoot.UnlockChildrenRecursive();
+            // Wait for atlas being loaded
+            if (!atlas.IsReady)
+                return false;
 
-                    // Draw preview
-                    context.Clear(_output.View(), Color.Black);
-                    Render2D.CallDrawing(_guiRoot, context, _output);
+            try
+            {
+                // Setup
+                _guiRoot.RemoveChildren();
+                _guiRoot.AccentColor = request.Proxy.AccentColor;
 
-                    // Call proxy and cleanup UI (delete create controls, shared controls should be unlinked during OnThumbnailDrawEnd event)
-                    request.Proxy.OnThumbnailDrawEnd(request, _guiRoot);
-                }
-                catch (Exception ex)
-                {
-                    // Handle internal errors gracefully (eg. when asset is corrupted and proxy fails)
-                    Editor.LogError("Failed to render thumbnail icon for asset: " + request.Item);
-                    Editor.LogWarning(ex);
-                    request.FinishRender(ref SpriteHandle.Invalid);
-                    RemoveRequest(request);
-                    return;
-                }
-                finally
-                {
-                    _guiRoot.DisposeChildren();
-                }
+                // Call proxy to prepare for thumbnail rendering
+                request.Proxy.OnThumbnailDrawBegin(request, _guiRoot, context);
+                _guiRoot.UnlockChildrenRecursive();
 
-                // Copy backbuffer with rendered preview into atlas
-                SpriteHandle icon = atlas.OccupySlot(_output, request.Item.ID);
-                if (!icon.IsValid)
-                {
-                    // Error
-                    _task.Enabled = false;
-                    _requests.Clear();
-                    Editor.LogError("Failed to occupy previews cache atlas slot.");
-                    return;
-                }
+                // Draw preview
+                context.Clear(_output.View(), Color.Black);
+                Render2D.CallDrawing(_guiRoot, context, _output);
 
-                // End
-                request.FinishRender(ref icon);
+                // Call proxy and cleanup UI (delete create controls, shared controls should be unlinked during OnThumbnailDrawEnd event)
+                request.Proxy.OnThumbnailDrawEnd(request, _guiRoot);
+            }
+            catch (Exception ex)
+            {
+                // Handle internal errors gracefully (eg. when asset is corrupted and proxy fails)
+                Editor.LogError("Failed to render thumbnail icon for asset: " + request.Item);
+                Editor.LogWarning(ex);
+                request.FinishRender(ref SpriteHandle.Invalid);
                 RemoveRequest(request);
+                return true;
+            }
+            finally
+            {
+                _guiRoot.DisposeChildren();
             }
+
+            // Copy backbuffer with rendered preview into atlas
+            SpriteHandle icon = atlas.OccupySlot(_output, request.Item.ID);
+            if (!icon.IsValid)
+            {
+                // Error
+                _task.Enabled = false;
+                while (_requests.Count > 0)
+                    RemoveRequest(_requests[0]);
+                Editor.LogError("Failed to occupy previews cache atlas slot.");
+                return false;
+            }
+            _stamps[request.Item.ID] = GetStamp(request.Item);
+            _stampsDirty = true;
+
+            // End
+            request.FinishRender(ref icon);
+            RemoveRequest(request);
+            return true;
         }
 
         private void StartPreviewsQueue()
@@ -303,18 +365,15 @@ private void StartPreviewsQueue()
 
         private ThumbnailRequest FindRequest(AssetItem item)
         {
-            for (int i = 0; i < _requests.Count; i++)
-            {
-                if (_requests[i].Item == item)
-                    return _requests[i];
-            }
-            return null;
+            _requestsLookup.TryGetValue(item, out var request);
+            return request;
         }
 
         private void AddRequest(AssetItem item, AssetProxy proxy)
         {
             var request = new ThumbnailRequest(item, proxy);
             _requests.Add(request);
+            _requestsLookup.Add(item, request);
             item.AddReference(this);
         }
 
@@ -322,9 +381,29 @@ private void RemoveRequest(ThumbnailRequest request)
         {
             request.Dispose();
             _requests.Remove(request);
+            _requestsLookup.Remove(request.Item);
             request.Item.RemoveReference(this);
         }
 
+        private void SortRequests()
+        {
+            // Move the requests for the visible items to the front of the queue (keep the order of the others)
+            _requestsOrderDirty = false;
+            var frame = Engine.FrameCount;
+            int visibleCount = 0;
+            for (int i = 0; i < _requests.Count; i++)
+            {
+                var request = _requests[i];
+                if (request.LastVisibleFrame + 1 >= frame)
+                    _requests[visibleCount++] = request;
+                else
+                    _requestsHidden.Add(request);
+            }
+            for (int i = 0; i < _requestsHidden.Count; i++)
+                _requests[visibleCount + i] = _requestsHidden[i];
+            _requestsHidden.Clear();
+        }
+
         private void RemoveRequest(AssetItem item)
         {
             var request = FindRequest(item);
@@ -358,6 +437,70 @@ private ThumbnailRequest GetReadyRequest(int maxChecks)
 
         #endregion
 
+        #region Stamps Management
+
+        private static ulong GetStamp(AssetItem item)
+        {
+            // Use the file size and modification time to detect the asset changes without reading the whole file
+            var file = new FileInfo(item.Path);
+            if (!file.Exists)
+                return 0;
+            unchecked
+            {
+                var hash = (ulong)file.Length * 0x9E3779B97F4A7C15ul;
+                hash ^= (ulong)file.LastWriteTimeUtc.Ticks + 0x632BE59BD9B4E019ul + (hash << 6) + (hash >> 2);
+                return hash;
+            }
+        }
+
+        private void LoadStamps()
+        {
+            if (!File.Exists(_stampsPath))
+                return;
+            try
+            {
+                using (var reader = new BinaryReader(File.OpenRead(_stampsPath)))
+                {
+                    var count = reader.ReadInt32();
+                    for (int i = 0; i < count; i++)
+                    {
+                        var id = new Guid(reader.ReadBytes(16));
+                        _stamps[id] = reader.ReadUInt64();
+                    }
+                }
+            }
+            catch (Exception ex)
+            {
+                Editor.LogWarning("Failed to load thumbnails cache stamps.");
+                Editor.LogWarning(ex);
+                _stamps.Clear();
+            }
+        }
+
+        private void SaveStamps()
+        {
+            _stampsDirty = false;
+            try
+            {
+                using (var writer = new BinaryWriter(File.Create(_stampsPath)))
+                {
+                    writer.Write(_stamps.Count);
+                    foreach (var e in _stamps)
+                    {
+                        writer.Write(e.Key.ToByteArray());
+                        writer.Write(e.Value);
+                    }
+                }
+            }
+            catch (Exception ex)
+            {
+                Editor.LogWarning("Failed to save thumbnails cache stamps.");
+                Editor.LogWarning(ex);
+            }
+        }
+
+        #endregion
+
         #region Atlas Management
 
         private PreviewsCache CreateAtlas()
@@ -394,6 +537,8 @@ private void Flush()
             {
                 _cache[i].Flush();
             }
+            if (_stampsDirty)
+                SaveStamps();
         }
 
         private bool HasAllAtlasesLoaded()
@@ -443,6 +588,9 @@ public override void OnUpdate()
                 int count = _requests.Count;
                 if (count > 0)
                 {
+                    if (_requestsOrderDirty)
+                        SortRequests();
+
                     // Prepare requests
                     bool isAnyReady = false;
                     int checks = Mathf.Min(10, _requests.Count);
@@ -497,6 +645,8 @@ public override void OnExit()
                 while (_requests.Count > 0)
                     RemoveRequest(_requests[0]);
                 _cache.Clear();
+                if (_stampsDirty)
+                    SaveStamps();
             }
 
             _guiRoot.Dispose();
@@ -321,6 +321,11 @@ DECLARE_SCRIPTING_TYPE(CookingData);
     /// </summary>
     HashSet<Guid> Assets;
 
+    /// <summary>
+    /// The direct dependencies of the assets to include in build (assets referenced by each asset, valid only after CollectAssetsStep). Saved into the cooked assets cache to prefetch the whole dependency closure when loading assets in game.
+    /// </summary>
+    Dictionary<Guid, Array<Guid>> AssetDependencies;
+
     struct BinaryModuleInfo
     {
         String Name;
@@ -29,6 +29,8 @@ bool CollectAssetsStep::Process(CookingData& data, Asset* asset)
     asset->GetReferences(_references);
     asset->Locker.Unlock();
     _assetsQueue.Add(_references);
+    if (_references.HasItems())
+        data.AssetDependencies[asset->GetID()] = _references;
 
     return false;
 }
@@ -41,6 +43,7 @@ bool CollectAssetsStep::Perform(CookingData& data)
     // Initialize assets queue
     _assetsQueue.Clear();
     _assetsQueue.EnsureCapacity(1024);
+    data.AssetDependencies.Clear();
     for (auto i = data.RootAssets.Begin(); i.IsNotEnd(); ++i)
         _assetsQueue.Add(i->Item);
 
@@ -12,14 +12,23 @@
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Content/Assets/Material.h"
+#include "Engine/Content/Assets/MaterialInstance.h"
+#include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Assets/Texture.h"
 #include "Engine/Content/Assets/CubeTexture.h"
+#include "Engine/Content/Assets/Animation.h"
 #include "Engine/Render2D/SpriteAtlas.h"
+#include "Engine/Localization/LocalizedStringTable.h"
 #include "Engine/Content/Storage/FlaxFile.h"
+#include "Engine/Content/Loading/ContentLoadingManager.h"
+#include "Engine/Level/Scene/SceneAsset.h"
+#include "Engine/Level/Prefabs/Prefab.h"
 #include "Engine/Particles/ParticleEmitter.h"
 #include "Engine/Utilities/Encryption.h"
+#include "Engine/Utilities/Crc.h"
 #include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/JsonTools.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Core/Config/PlatformSettings.h"
@@ -36,6 +45,9 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Tools/TextureTool/TextureTool.h"
 #include "Engine/Scripting/Enums.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
 #if PLATFORM_TOOLS_WINDOWS
 #include "Engine/Platform/Windows/WindowsPlatformSettings.h"
 #endif
@@ -47,8 +59,159 @@
 #endif
 #include "FlaxEngine.Gen.h"
 
+// Version of the cooking cache header file format
+#define COOK_CACHE_HEADER_VERSION 4
+
 Dictionary<String, CookAssetsStep::ProcessAssetFunc> CookAssetsStep::AssetProcessors;
 
+namespace
+{
+    // Guards the cache entries modifications when cooking assets in parallel
+    CriticalSection CacheLocker;
+
+    bool HashFile(const StringView& path, uint32& crc)
+    {
+        auto file = FileReadStream::Open(path);
+        if (file == nullptr)
+            return true;
+        DeleteMe<FileReadStream> deleteFile(file);
+        byte buffer[64 * 1024];
+        uint32 left = file->GetLength();
+        while (left != 0)
+        {
+            const uint32 size = Math::Min<uint32>(left, sizeof(buffer));
+            file->ReadBytes(buffer, size);
+            crc = Crc::MemCrc32C(buffer, size, crc);
+            left -= size;
+        }
+        return file->HasError();
+    }
+
+    uint32 GetContentHash(const StringView& assetPath, const CookAssetsStep::FileDependenciesList& fileDependencies)
+    {
+        uint32 crc = 0;
+        if (HashFile(assetPath, crc))
+            return 0;
+        for (auto& f : fileDependencies)
+        {
+            if (HashFile(f.First, crc))
+                return 0;
+        }
+        return crc == 0 ? 1 : crc;
+    }
+
+    bool CompareCookLevel(const Guid& a, const Guid& b, Dictionary<Guid, int32>* levels)
+    {
+        return levels->At(a) < levels->At(b);
+    }
+
+    void CollectSkinnedMaterials(const ISerializable::DeserializeStream& node, HashSet<Guid>& result)
+    {
+        if (node.IsArray())
+        {
+            for (rapidjson::SizeType i = 0; i < node.Size(); i++)
+                CollectSkinnedMaterials(node[i], result);
+            return;
+        }
+        if (!node.IsObject())
+            return;
+
+        // Animated model material slots (objects without type are prefab instances overrides so treat them as skinned too)
+        const auto typeName = node.FindMember("TypeName");
+        const auto buffer = node.FindMember("Buffer");
+        if (buffer != node.MemberEnd() && buffer->value.IsObject() && (typeName == node.MemberEnd() || (typeName->value.IsString() && StringAnsiView(typeName->value.GetString(), typeName->value.GetStringLength()) == "FlaxEngine.AnimatedModel")))
+        {
+            const auto entries = buffer->value.FindMember("Entries");
+            if (entries != buffer->value.MemberEnd() && entries->value.IsArray())
+            {
+                for (rapidjson::SizeType i = 0; i < entries->value.Size(); i++)
+                {
+                    const auto& entry = entries->value[i];
+                    if (entry.IsObject())
+                    {
+                        const Guid material = JsonTools::GetGuid(entry, "Material");
+                        if (material.IsValid())
+                            result.Add(material);
+                    }
+                }
+            }
+        }
+
+        for (auto i = node.MemberBegin(); i != node.MemberEnd(); ++i)
+        {
+            if (i->value.IsObject() || i->value.IsArray())
+                CollectSkinnedMaterials(i->value, result);
+        }
+    }
+
+    void CollectPrunedSkinningMaterials(CookingData& data, HashSet<Guid>& result)
+    {
+        PROFILE_CPU();
+        HashSet<Guid> skinnedMaterials;
+        AssetInfo assetInfo;
+        for (const auto& e : data.Assets)
+        {
+            if (!Content::GetAssetInfo(e.Item, assetInfo))
+                continue;
+            if (assetInfo.TypeName == SkinnedModel::TypeName)
+            {
+                // Skinned model material slots (model dependencies are the materials)
+                const auto dependencies = data.AssetDependencies.TryGet(e.Item);
+                if (dependencies)
+                {
+                    for (const Guid& dependency : *dependencies)
+                        skinnedMaterials.Add(dependency);
+                }
+            }
+            else if (assetInfo.TypeName == SceneAsset::TypeName || assetInfo.TypeName == Prefab::TypeName)
+            {
+                // Animated models placed in the levels
+                AssetReference<JsonAssetBase> asset = Content::LoadAsync<JsonAssetBase>(e.Item);
+                if (asset && !asset->WaitForLoaded() && asset->Data)
+                {
+                    CollectSkinnedMaterials(*asset->Data, skinnedMaterials);
+                }
+                else if (const auto dependencies = data.AssetDependencies.TryGet(e.Item))
+                {
+                    // Be conservative if cannot check it
+                    for (const Guid& dependency : *dependencies)
+                        skinnedMaterials.Add(dependency);
+                }
+            }
+        }
+
+        // Propagate usage from the material instances into the base materials
+        Array<Guid> queue;
+        for (const auto& e : skinnedMaterials)
+            queue.Add(e.Item);
+        while (queue.HasItems())
+        {
+            const Guid id = queue.Pop();
+            if (!Content::GetAssetInfo(id, assetInfo) || assetInfo.TypeName != MaterialInstance::TypeName)
+                continue;
+            const auto dependencies = data.AssetDependencies.TryGet(id);
+            if (!dependencies)
+                continue;
+            for (const Guid& dependency : *dependencies)
+            {
+                if (!skinnedMaterials.Contains(dependency) && Content::GetAssetInfo(dependency, assetInfo) && (assetInfo.TypeName == Material::TypeName || assetInfo.TypeName == MaterialInstance::TypeName))
+                {
+                    skinnedMaterials.Add(dependency);
+                    queue.Add(dependency);
+                }
+            }
+        }
+
+        // Prune only project materials (engine materials such as the default material are used as a fallback)
+        for (const auto& e : data.Assets)
+        {
+            if (!skinnedMaterials.Contains(e.Item) && Content::GetAssetInfo(e.Item, assetInfo) && assetInfo.TypeName == Material::TypeName && assetInfo.Path.StartsWith(Globals::ProjectContentFolder))
+                result.Add(e.Item);
+        }
+        LOG(Info, "Skipping skinning permutations for {0} materials not used with skinned meshes", result.Count());
+    }
+}
+
 bool CookAssetsStep::CacheEntry::IsValid(bool withDependencies)
 {
     AssetInfo assetInfo;
@@ -85,6 +248,7 @@ CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const JsonAss
     entry.ID = asset->GetID();
     entry.TypeName = asset->DataTypeName;
     entry.FileModified = FileSystem::GetFileLastEditTime(asset->GetPath());
+    entry.Variant = GetVariant(entry.ID);
     cachedFilePath = CacheFolder / entry.ID.ToString(Guid::FormatType::N);
     return entry;
 }
@@ -95,6 +259,7 @@ CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const Asset*
     entry.ID = asset->GetID();
     entry.TypeName = asset->GetTypeName();
     entry.FileModified = FileSystem::GetFileLastEditTime(asset->GetPath());
+    entry.Variant = GetVariant(entry.ID);
     cachedFilePath = CacheFolder / entry.ID.ToString(Guid::FormatType::N);
     return entry;
 }
@@ -137,6 +302,10 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
     file->ReadInt32(&buildNum);
     if (buildNum != FLAXENGINE_VERSION_BUILD)
         return;
+    int32 headerVersion;
+    file->ReadInt32(&headerVersion);
+    if (headerVersion != COOK_CACHE_HEADER_VERSION)
+        return;
     int32 entriesCount;
     file->ReadInt32(&entriesCount);
     if (Math::IsNotInRange(entriesCount, 0, 1000000))
@@ -167,6 +336,9 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
             file->ReadString(&f.First, 10);
             file->Read(f.Second);
         }
+        uint32 contentHash, variant;
+        file->ReadUint32(&contentHash);
+        file->ReadUint32(&variant);
 
         // Skip missing entries
         if (!FileSystem::FileExists(CacheFolder / id.ToString(Guid::FormatType::N)))
@@ -177,6 +349,8 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
         e.TypeName = typeName;
         e.FileModified = fileModified;
         e.FileDependencies = fileDependencies;
+        e.ContentHash = contentHash;
+        e.Variant = variant;
     }
 
     int32 checkChar;
@@ -287,6 +461,7 @@ void CookAssetsStep::CacheData::Save()
 
     // Serialize
     file->WriteInt32(FLAXENGINE_VERSION_BUILD);
+    file->WriteInt32(COOK_CACHE_HEADER_VERSION);
     file->WriteInt32(Entries.Count());
     file->WriteBytes(&Settings, sizeof(Settings));
     for (auto i = Entries.Begin(); i.IsNotEnd(); ++i)
@@ -301,10 +476,26 @@ void CookAssetsStep::CacheData::Save()
             file->Write(f.First, 10);
             file->Write(f.Second);
         }
+        file->WriteUint32(e.ContentHash);
+        file->WriteUint32(e.Variant);
     }
     file->WriteInt32(13);
 }
 
+// Minimum size of the compressed chunk data to split it into the independent blocks (decompressed in parallel on load)
+#define COOK_CHUNK_BLOCKS_MIN_SIZE (4 * ASSET_FILE_DATA_CHUNK_BLOCK_SIZE)
+
+FlaxChunkFlags GetChunkCompression(int32 size, bool isJson)
+{
+    // LZ4 decompression is faster than the storage reads on all platforms so pick the codec options per data type and size
+    FlaxChunkFlags flags = FlaxChunkFlags::CompressedLZ4;
+    if (isJson)
+        flags |= FlaxChunkFlags::DictionaryJson;
+    if (size >= COOK_CHUNK_BLOCKS_MIN_SIZE)
+        flags |= FlaxChunkFlags::CompressedLZ4Blocks;
+    return flags;
+}
+
 bool CookAssetsStep::ProcessDefaultAsset(AssetCookData& options)
 {
     const auto asBinaryAsset = dynamic_cast<BinaryAsset*>(options.Asset);
@@ -333,8 +524,8 @@ bool CookAssetsStep::ProcessDefaultAsset(AssetCookData& options)
 
         // Store json data in the first chunk
         auto chunk = New<FlaxChunk>();
-        chunk->Flags = FlaxChunkFlags::CompressedLZ4; // Compress json data (internal storage layer will handle it)
-        chunk->Data.Copy((byte*)buffer.GetString(), (int32)buffer.GetSize());
+        chunk->Flags = GetChunkCompression((int32)buffer.GetSize(), true); // Compress json data (internal storage layer will handle it)
+        chunk->Data.Copy((byte*)buffer.GetString(), (int32)buffer.GetSize() + 1); // Include null-terminator to parse json in-situ at runtime
         options.InitData.Header.Chunks[0] = chunk;
 
         return false;
@@ -398,6 +589,7 @@ bool ProcessShaderBase(CookAssetsStep::AssetCookData& data, ShaderAssetBase* ass
     options.TreatWarningsAsErrors = false;
     options.Output = &cacheStream;
     Array<String> includes;
+    const bool pruneSkinning = data.Cache.GetVariant(asset->GetID()) != 0;
 
 #define COMPILE_PROFILE(profile, cacheChunk) \
 	{ \
@@ -407,6 +599,8 @@ bool ProcessShaderBase(CookAssetsStep::AssetCookData& data, ShaderAssetBase* ass
 		auto& platformDefine = options.Macros.AddOne(); \
 		platformDefine.Name = platformDefineName; \
 		platformDefine.Definition = nullptr; \
+		if (pruneSkinning) \
+			options.Macros.Add({ "CAN_USE_SKINNING", "0" }); \
 		assetBase->InitCompilationOptions(options); \
 		if (ShadersCompilation::Compile(options)) \
 		{ \
@@ -619,6 +813,64 @@ bool ProcessParticleEmitter(CookAssetsStep::AssetCookData& data)
     return ProcessShaderBase(data, asset);
 }
 
+bool ProcessAnimation(CookAssetsStep::AssetCookData& data)
+{
+    if (CookAssetsStep::ProcessDefaultAsset(data))
+        return true;
+
+    // Compress animation curves data
+    const auto chunk = data.InitData.Header.Chunks[0];
+    if (chunk && chunk->IsLoaded())
+        chunk->Flags = GetChunkCompression(chunk->Size(), false);
+
+    return false;
+}
+
+bool ProcessLocalizedStringTable(CookAssetsStep::AssetCookData& data)
+{
+    const auto asset = static_cast<LocalizedStringTable*>(data.Asset);
+    ScopeLock lock(asset->Locker);
+
+    // Store json without the entries (only table properties are parsed at runtime)
+    rapidjson_flax::StringBuffer buffer;
+    CompactJsonWriter writerObj(buffer);
+    JsonWriter& writer = writerObj;
+    writer.StartObject();
+    {
+        writer.JKEY("ID");
+        writer.Guid(asset->GetID());
+        writer.JKEY("TypeName");
+        writer.String(asset->DataTypeName);
+        writer.JKEY("EngineBuild");
+        writer.Int(FLAXENGINE_VERSION_BUILD);
+        writer.JKEY("Data");
+        writer.StartObject();
+        writer.JKEY("Locale");
+        writer.String(asset->Locale);
+        if (asset->FallbackTable.GetID().IsValid())
+        {
+            writer.JKEY("FallbackTable");
+            writer.Guid(asset->FallbackTable.GetID());
+        }
+        writer.EndObject();
+    }
+    writer.EndObject();
+    auto chunk = New<FlaxChunk>();
+    chunk->Flags = GetChunkCompression((int32)buffer.GetSize(), true);
+    chunk->Data.Copy((byte*)buffer.GetString(), (int32)buffer.GetSize() + 1);
+    data.InitData.Header.Chunks[0] = chunk;
+
+    // Compile the entries into the lookup table with hashed ids
+    Array<byte> compiled;
+    asset->Compile(compiled);
+    chunk = New<FlaxChunk>();
+    chunk->Flags = GetChunkCompression(compiled.Count(), false);
+    chunk->Data.Copy(compiled);
+    data.InitData.Header.Chunks[1] = chunk;
+
+    return false;
+}
+
 bool ProcessTextureBase(CookAssetsStep::AssetCookData& data)
 {
     const auto asset = static_cast<TextureBase*>(data.Asset);
@@ -747,6 +999,35 @@ bool ProcessTextureBase(CookAssetsStep::AssetCookData& data)
     return false;
 }
 
+bool CookAssetsStep::SaveCookedAsset(CacheData& cache, Asset* asset, AssetInitData& initData, FileDependenciesList& fileDependencies)
+{
+    // Write cooked file (assets are cooked in parallel, each into a separate file in the cache)
+    String cachedFilePath;
+    cache.GetFilePath(asset->GetID(), cachedFilePath);
+    const bool result = FlaxStorage::Create(cachedFilePath, initData);
+
+    // Cleanup allocated data chunks
+    initData.Header.DeleteChunks();
+
+    if (result)
+    {
+        LOG(Warning, "Failed to save cooked file data.");
+        return true;
+    }
+
+    // Register cache entry
+    const uint32 contentHash = GetContentHash(asset->GetPath(), fileDependencies);
+    ScopeLock lock(CacheLocker);
+    CacheEntry* entry;
+    if (const auto asJsonAsset = dynamic_cast<JsonAssetBase*>(asset))
+        entry = &cache.CreateEntry(asJsonAsset, cachedFilePath);
+    else
+        entry = &cache.CreateEntry(asset, cachedFilePath);
+    entry->FileDependencies = MoveTemp(fileDependencies);
+    entry->ContentHash = contentHash;
+    return false;
+}
+
 CookAssetsStep::CookAssetsStep()
     : AssetsRegistry(1024)
     , AssetPathsMapping(256)
@@ -757,6 +1038,8 @@ CookAssetsStep::CookAssetsStep()
     AssetProcessors.Add(Texture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(CubeTexture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(SpriteAtlas::TypeName, ProcessTextureBase);
+    AssetProcessors.Add(Animation::TypeName, ProcessAnimation);
+    AssetProcessors.Add(LocalizedStringTable::TypeName, ProcessLocalizedStringTable);
 }
 
 bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* asset)
@@ -799,21 +1082,7 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* a
     if (assetProcessor(options))
         return true;
 
-    // Save cache
-    String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
-    entry.FileDependencies = MoveTemp(fileDependencies);
-    const bool result = FlaxStorage::Create(cachedFilePath, initData);
-
-    // Cleanup allocated data chunks
-    initData.Header.DeleteChunks();
-
-    if (result)
-    {
-        LOG(Warning, "Failed to save cooked file data.");
-        return true;
-    }
-    return false;
+    return SaveCookedAsset(cache, asset, initData, fileDependencies);
 }
 
 bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase* asset)
@@ -843,21 +1112,7 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase*
     if (assetProcessor(options))
         return true;
 
-    // Save cache
-    String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
-    entry.FileDependencies = MoveTemp(fileDependencies);
-    const bool result = FlaxStorage::Create(cachedFilePath, initData);
-
-    // Cleanup allocated data chunks
-    initData.Header.DeleteChunks();
-
-    if (result)
-    {
-        LOG(Warning, "Failed to save cooked file data.");
-        return true;
-    }
-    return false;
+    return SaveCookedAsset(cache, asset, initData, fileDependencies);
 }
 
 /// <summary>
@@ -1064,6 +1319,13 @@ bool CookAssetsStep::Perform(CookingData& data)
         cache.Settings.Global.ParticleGraphVersion = PARTICLE_GPU_GRAPH_VERSION;
     }
 
+    // Collect material permutations usage by the cooked content
+    if (buildSettings->ShadersPruneUnusedPermutations)
+    {
+        data.StepProgress(TEXT("Collecting materials usage"), 0);
+        CollectPrunedSkinningMaterials(data, cache.PrunedSkinningMaterials);
+    }
+
     // Note: this step converts all the assets (even the json) into the binary files (FlaxStorage format).
     // Then files cooked files are packed into the packages.
 
@@ -1073,13 +1335,12 @@ bool CookAssetsStep::Perform(CookingData& data)
     auto minDateTime = DateTime::MinValue();
 #endif
     int32 subStepIndex = 0;
-    AssetReference<Asset> assetRef;
-    assetRef.Unload.Bind([]() { LOG(Error, "Asset gets unloaded while cooking it!"); Platform::Sleep(100); });
+    Array<Guid> assetsToCook;
     for (auto i = data.Assets.Begin(); i.IsNotEnd(); ++i)
     {
         BUILD_STEP_CANCEL_CHECK;
 
-        data.StepProgress(Step1Info, Math::Lerp(Step1ProgressStart, Step1ProgressEnd, static_cast<float>(subStepIndex++) / data.Assets.Count()));
+        data.StepProgress(TEXT("Checking build cache"), Math::Lerp(0.0f, Step1ProgressStart, static_cast<float>(subStepIndex++) / data.Assets.Count()));
         const Guid assetId = i->Item;
 
         // Register asset
@@ -1099,13 +1360,13 @@ bool CookAssetsStep::Perform(CookingData& data)
             if (Content::GetAssetInfo(assetId, assetInfo))
             {
                 // Ensure that cached entry is valid
-                if (cachedEntry->TypeName == assetInfo.TypeName)
+                if (cachedEntry->TypeName == assetInfo.TypeName && cachedEntry->Variant == cache.GetVariant(assetId))
                 {
                     // Check if file hasn't been modified
-                    if (FileSystem::GetFileLastEditTime(assetInfo.Path) <= cachedEntry->FileModified)
+                    bool isValid = FileSystem::GetFileLastEditTime(assetInfo.Path) <= cachedEntry->FileModified;
+                    if (isValid)
                     {
                         // Check all dependant files
-                        bool isValid = true;
                         for (auto& f : cachedEntry->FileDependencies)
                         {
                             if (FileSystem::GetFileLastEditTime(f.First) > f.Second)
@@ -1114,13 +1375,21 @@ bool CookAssetsStep::Perform(CookingData& data)
                                 break;
                             }
                         }
+                    }
+                    if (!isValid && cachedEntry->ContentHash != 0 && GetContentHash(assetInfo.Path, cachedEntry->FileDependencies) == cachedEntry->ContentHash)
+                    {
+                        // Files got touched but the contents are the same so refresh the modification dates
+                        isValid = true;
+                        cachedEntry->FileModified = FileSystem::GetFileLastEditTime(assetInfo.Path);
+                        for (auto& f : cachedEntry->FileDependencies)
+                            f.Second = FileSystem::GetFileLastEditTime(f.First);
+                    }
 
-                        if (isValid)
-                        {
-                            // Cache hit!
-                            e.Info.TypeName = assetInfo.TypeName;
-                            continue;
-                        }
+                    if (isValid)
+                    {
+                        // Cache hit!
+                        e.Info.TypeName = assetInfo.TypeName;
+                        continue;
                     }
                 }
                 else
@@ -1131,28 +1400,98 @@ bool CookAssetsStep::Perform(CookingData& data)
             }
         }
 
-        // Load asset (and keep ref)
-        assetRef = Content::LoadAsync<Asset>(assetId);
-        if (assetRef == nullptr)
+        assetsToCook.Add(assetId);
+    }
+
+    // Assign the cooking order so assets get processed after their dependencies (within the assets to cook)
+    Dictionary<Guid, int32> assetsCookLevel;
+    assetsCookLevel.EnsureCapacity(assetsToCook.Count() * 2);
+    for (const Guid& assetId : assetsToCook)
+        assetsCookLevel[assetId] = 0;
+    for (int32 iteration = 0; iteration < 16; iteration++)
+    {
+        // Propagate levels iteratively (limited to skip cyclic references)
+        bool modified = false;
+        for (const Guid& assetId : assetsToCook)
         {
-            data.Error(TEXT("Failed to load asset included in build."));
-            return true;
+            const auto dependencies = data.AssetDependencies.TryGet(assetId);
+            if (!dependencies)
+                continue;
+            int32& level = assetsCookLevel[assetId];
+            for (const Guid& dependency : *dependencies)
+            {
+                int32 dependencyLevel;
+                if (dependency != assetId && assetsCookLevel.TryGet(dependency, dependencyLevel) && dependencyLevel >= level)
+                {
+                    level = dependencyLevel + 1;
+                    modified = true;
+                }
+            }
         }
-        e.Info.TypeName = assetRef->GetTypeName();
+        if (!modified)
+            break;
+    }
+    Sorting::SortArray(assetsToCook.Get(), assetsToCook.Count(), &CompareCookLevel, &assetsCookLevel);
+
+    // Cook assets in parallel, batches contain only the assets of the same level and are limited in size to keep the memory usage low
+    const int32 batchSizeMax = Math::Max(JobSystem::GetThreadsCount(), 1) * 2;
+    Array<AssetReference<Asset>> batch;
+    Array<bool> batchFailed;
+    for (int32 batchStart = 0; batchStart < assetsToCook.Count();)
+    {
+        BUILD_STEP_CANCEL_CHECK;
 
-        // Cook asset
-        if (Process(data, cache, assetRef.Get()))
+        data.StepProgress(Step1Info, Math::Lerp(Step1ProgressStart, Step1ProgressEnd, static_cast<float>(batchStart) / assetsToCook.Count()));
+        const int32 batchLevel = assetsCookLevel[assetsToCook[batchStart]];
+        int32 batchEnd = batchStart + 1;
+        while (batchEnd < assetsToCook.Count() && batchEnd - batchStart < batchSizeMax && assetsCookLevel[assetsToCook[batchEnd]] == batchLevel)
+            batchEnd++;
+
+        // Load assets (and keep refs)
+        batch.Resize(batchEnd - batchStart);
+        for (int32 i = 0; i < batch.Count(); i++)
         {
-            cache.Save();
-            return true;
+            const Guid& assetId = assetsToCook[batchStart + i];
+            auto& assetRef = batch[i];
+            assetRef.Unload.Bind([]() { LOG(Error, "Asset gets unloaded while cooking it!"); Platform::Sleep(100); });
+            assetRef = Content::LoadAsync<Asset>(assetId);
+            if (assetRef == nullptr)
+            {
+                data.Error(TEXT("Failed to load asset included in build."));
+                return true;
+            }
+            AssetsRegistry[assetId].Info.TypeName = assetRef->GetTypeName();
+        }
+        for (auto& assetRef : batch)
+        {
+            // Finish loading on this thread to not block job workers
+            assetRef->WaitForLoaded();
         }
-        data.Stats.CookedAssets++;
 
-        // Auto save build cache after every few cooked assets (reduces next build time if cooking fails later)
-        if (data.Stats.CookedAssets % 50 == 0)
+        // Cook assets
+        batchFailed.Resize(batch.Count());
+        Function<void(int32)> job = [&](int32 i)
+        {
+            batchFailed[i] = Process(data, cache, batch[i].Get());
+        };
+        JobSystem::Wait(JobSystem::Dispatch(job, batch.Count()));
+        for (int32 i = 0; i < batch.Count(); i++)
         {
-            cache.Save();
+            if (batchFailed[i])
+            {
+                cache.Save();
+                return true;
+            }
+            data.Stats.CookedAssets++;
+
+            // Auto save build cache after every few cooked assets (reduces next build time if cooking fails later)
+            if (data.Stats.CookedAssets % 50 == 0)
+            {
+                cache.Save();
+            }
         }
+        batch.Clear();
+        batchStart = batchEnd;
     }
 
     // Save build cache header
@@ -1200,13 +1539,54 @@ bool CookAssetsStep::Perform(CookingData& data)
     {
         PackageBuilder packageBuilder(buildSettings->MaxAssetsPerPackage, buildSettings->MaxPackageSizeMB, contentKey);
 
+        // Place assets recorded in the scenes preload manifests first (in the access order) so loading levels reads the packages sequentially
+        Array<Guid> packagingOrder;
+        {
+            HashSet<Guid> packagingOrderLookup;
+            packagingOrder.EnsureCapacity(AssetsRegistry.Count());
+            Array<ContentLoadRecord> records;
+            for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+            {
+                if (!Content::GetAssetInfo(i->Key, assetInfo) || assetInfo.TypeName != SceneAsset::TypeName)
+                    continue;
+                const String manifestPath = String(StringUtils::GetPathWithoutExtension(assetInfo.Path)) + TEXT(".preload");
+                if (ContentLoadingManager::LoadPreloadManifest(manifestPath, records))
+                    continue;
+
+                // Deploy manifest next to the scene (game uses the original scene path to find it)
+                String localPath;
+                if (manifestPath.StartsWith(Globals::ProjectFolder))
+                    localPath = manifestPath.Right(manifestPath.Length() - Globals::ProjectFolder.Length() - 1);
+                else
+                    localPath = StringUtils::GetFileName(manifestPath);
+                const String outputPath = data.DataOutputPath / localPath;
+                FileSystem::CreateDirectory(StringUtils::GetDirectoryName(outputPath));
+                if (FileSystem::CopyFile(outputPath, manifestPath))
+                    LOG(Warning, "Failed to deploy scene preload manifest '{0}'", manifestPath);
+
+                for (const ContentLoadRecord& e : records)
+                {
+                    if (AssetsRegistry.ContainsKey(e.AssetID) && !packagingOrderLookup.Contains(e.AssetID))
+                    {
+                        packagingOrderLookup.Add(e.AssetID);
+                        packagingOrder.Add(e.AssetID);
+                    }
+                }
+            }
+            for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+            {
+                if (!packagingOrderLookup.Contains(i->Key))
+                    packagingOrder.Add(i->Key);
+            }
+        }
+
         subStepIndex = 0;
-        for (auto i = AssetsRegistry.Begin(); i.IsNotEnd(); ++i)
+        for (const Guid& assetId : packagingOrder)
         {
             BUILD_STEP_CANCEL_CHECK;
 
             data.StepProgress(Step2Info, Math::Lerp(Step2ProgressStart, Step2ProgressEnd, static_cast<float>(subStepIndex++) / AssetsRegistry.Count()));
-            const auto assetId = i->Key;
+            auto& entry = AssetsRegistry[assetId];
 
             String cookedFilePath;
             cache.GetFilePath(assetId, cookedFilePath);
@@ -1217,11 +1597,11 @@ bool CookAssetsStep::Perform(CookingData& data)
                 continue;
             }
 
-            auto& assetStats = data.Stats.AssetStats[i->Value.Info.TypeName];
+            auto& assetStats = data.Stats.AssetStats[entry.Info.TypeName];
             assetStats.Count++;
             assetStats.ContentSize += FileSystem::GetFileSize(cookedFilePath);
 
-            if (packageBuilder.Add(data, i->Value, cookedFilePath))
+            if (packageBuilder.Add(data, entry, cookedFilePath))
                 return true;
         }
         if (packageBuilder.Package(data))
@@ -1256,10 +1636,27 @@ bool CookAssetsStep::Perform(CookingData& data)
         }
     }
 
+    // Create assets dependencies table (only for the assets included in build)
+    // It's used to prefetch the whole dependency closure of the asset when loading it in game.
+    AssetsCache::DependenciesMapping dependencies;
+    for (auto i = data.AssetDependencies.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (!AssetsRegistry.ContainsKey(i->Key))
+            continue;
+        Array<Guid> assetDependencies;
+        for (const Guid& dependency : i->Value)
+        {
+            if (dependency != i->Key && AssetsRegistry.ContainsKey(dependency) && !assetDependencies.Contains(dependency))
+                assetDependencies.Add(dependency);
+        }
+        if (assetDependencies.HasItems())
+            dependencies[i->Key] = MoveTemp(assetDependencies);
+    }
+
     BUILD_STEP_CANCEL_CHECK;
 
     // Save assets cache
-    if (AssetsCache::Save(data.DataOutputPath / TEXT("Content/AssetsCache.dat"), AssetsRegistry, AssetPathsMapping, AssetsCacheFlags::RelativePaths))
+    if (AssetsCache::Save(data.DataOutputPath / TEXT("Content/AssetsCache.dat"), AssetsRegistry, AssetPathsMapping, AssetsCacheFlags::RelativePaths | AssetsCacheFlags::Indexed, &dependencies))
     {
         data.Error(TEXT("Failed to create assets registry."));
         return true;
@@ -6,6 +6,7 @@
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Content/AssetInfo.h"
 #include "Engine/Content/Cache/AssetsCache.h"
 
@@ -50,6 +51,16 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// </summary>
         FileDependenciesList FileDependencies;
 
+        /// <summary>
+        /// The hash of the asset file contents and all its file dependencies contents. Used to reuse the cached entry when files modification time changes but the contents don't (eg. cache copied from the other machine or the fresh checkout of the project). Zero if unknown.
+        /// </summary>
+        uint32 ContentHash = 0;
+
+        /// <summary>
+        /// The cooking variant of the asset (eg. the pruned material shader permutations). Entry is rebuilt when the variant required by the current build is different.
+        /// </summary>
+        uint32 Variant = 0;
+
         bool IsValid(bool withDependencies = false);
     };
 
@@ -108,6 +119,11 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// </summary>
         Dictionary<Guid, CacheEntry> Entries;
 
+        /// <summary>
+        /// The materials that have skinning permutations skipped because they are not used with skinned meshes in the cooked content. Collected before cooking if pruning unused shader permutations is enabled (not serialized).
+        /// </summary>
+        HashSet<Guid> PrunedSkinningMaterials;
+
     public:
 
         /// <summary>
@@ -136,6 +152,16 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// <returns>The added entry reference.</returns>
         CacheEntry& CreateEntry(const Asset* asset, String& cachedFilePath);
 
+        /// <summary>
+        /// Gets the cooking variant of the asset for the current build.
+        /// </summary>
+        /// <param name="id">The asset id.</param>
+        /// <returns>The variant.</returns>
+        uint32 GetVariant(const Guid& id) const
+        {
+            return PrunedSkinningMaterials.Contains(id) ? 1 : 0;
+        }
+
         /// <summary>
         /// Removes all cached entries for assets that contain a shader. This forces rebuild for them.
         /// </summary>
@@ -184,6 +210,7 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
     bool Process(CookingData& data, CacheData& cache, Asset* asset);
     bool Process(CookingData& data, CacheData& cache, BinaryAsset* asset);
     bool Process(CookingData& data, CacheData& cache, JsonAssetBase* asset);
+    static bool SaveCookedAsset(CacheData& cache, Asset* asset, AssetInitData& initData, FileDependenciesList& fileDependencies);
 
 public:
 
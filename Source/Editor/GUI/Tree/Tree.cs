@@ -39,6 +39,7 @@ public class Tree : ContainerControl
         private readonly bool _supportMultiSelect;
         private Margin _margin;
         private bool _autoSize = true;
+        private float _viewTop = float.MinValue, _viewBottom = float.MaxValue;
 
         /// <summary>
         /// The TreeNode that is being dragged over. This could have a value when not dragging.
@@ -461,9 +462,32 @@ public override void Update(float deltaTime)
                 }
             }
 
+            // Cache the tree area visible in the scroll view to skip updating the nodes outside it
+            if (Parent is ScrollableControl scrollable)
+            {
+                _viewTop = -scrollable.ViewOffset.Y - Y;
+                _viewBottom = _viewTop + scrollable.Height;
+            }
+            else
+            {
+                _viewTop = float.MinValue;
+                _viewBottom = float.MaxValue;
+            }
+
             base.Update(deltaTime);
         }
 
+        /// <summary>
+        /// Checks if the given vertical range of the tree is visible in the parent scroll view.
+        /// </summary>
+        /// <param name="y">The range top (in tree space).</param>
+        /// <param name="height">The range height.</param>
+        /// <returns>True if range is in view, otherwise false.</returns>
+        internal bool IsInView(float y, float height)
+        {
+            return y + height >= _viewTop && y <= _viewBottom;
+        }
+
         /// <inheritdoc />
         public override bool OnKeyDown(KeyboardKeys key)
         {
@@ -26,7 +26,7 @@ public class TreeNode : ContainerControl
         private Tree _tree;
 
         private bool _opened, _canChangeOrder;
-        private float _animationProgress, _cachedHeight;
+        private float _animationProgress, _cachedHeight, _treeY;
         private bool _mouseOverArrow, _mouseOverHeader;
         private float _xOffset, _textWidth;
         private float _headerHeight = 16.0f;
@@ -619,7 +619,18 @@ public override void Update(float deltaTime)
             // Don't update collapsed children
             if (_opened)
             {
-                base.Update(deltaTime);
+                // Skip the visible child nodes outside the tree view area (eg. in large scene hierarchy)
+                var tree = ParentTree;
+                _treeY = Parent is TreeNode parentNode ? parentNode._treeY + Y : Y;
+                for (int i = 0; i < _children.Count; i++)
+                {
+                    var child = _children[i];
+                    if (!child.Enabled)
+                        continue;
+                    if (tree != null && child is TreeNode node && node.Visible && node._animationProgress >= 1.0f && !tree.IsInView(_treeY + node.Y, node.Height))
+                        continue;
+                    child.Update(deltaTime);
+                }
             }
         }
 
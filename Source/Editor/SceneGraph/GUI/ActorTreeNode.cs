@@ -33,6 +33,11 @@ public class ActorTreeNode : TreeNode
         private List<Rectangle> _highlights;
         private bool _hasSearchFilter;
 
+        /// <summary>
+        /// The index of the node in the scene tree search index (-1 if not indexed).
+        /// </summary>
+        internal int SearchIndex = -1;
+
         /// <summary>
         /// The actor node that owns this node.
         /// </summary>
@@ -135,29 +140,8 @@ public void UpdateFilter(string filterText)
             else
             {
                 var text = Text;
-                if (QueryFilterHelper.Match(filterText, text, out QueryFilterHelper.Range[] ranges))
-                {
-                    // Update highlights
-                    if (_highlights == null)
-                        _highlights = new List<Rectangle>(ranges.Length);
-                    else
-                        _highlights.Clear();
-                    var font = Style.Current.FontSmall;
-                    var textRect = TextRect;
-                    for (int i = 0; i < ranges.Length; i++)
-                    {
-                        var start = font.GetCharPosition(text, ranges[i].StartIndex);
-                        var end = font.GetCharPosition(text, ranges[i].EndIndex);
-                        _highlights.Add(new Rectangle(start.X + textRect.X, textRect.Y, end.X - start.X, textRect.Height));
-                    }
-                    isThisVisible = true;
-                }
-                else
-                {
-                    // Hide
-                    _highlights?.Clear();
-                    isThisVisible = false;
-                }
+                QueryFilterHelper.Match(filterText, text, out QueryFilterHelper.Range[] ranges);
+                isThisVisible = UpdateHighlights(text, ranges);
             }
 
             // Update children
@@ -192,6 +176,79 @@ public void UpdateFilter(string filterText)
             Visible = isThisVisible | isAnyChildVisible;
         }
 
+        /// <summary>
+        /// Updates the query search filter using the matches found for the search index nodes (see <see cref="SearchIndex"/>).
+        /// </summary>
+        /// <param name="filterText">The filter text.</param>
+        /// <param name="nodes">The search index nodes.</param>
+        /// <param name="names">The search index nodes names (at the time of building the index).</param>
+        /// <param name="matches">The search index nodes matches (null if node doesn't match the filter).</param>
+        internal void UpdateFilter(string filterText, ActorTreeNode[] nodes, string[] names, QueryFilterHelper.Range[][] matches)
+        {
+            // SKip hidden actors
+            var actor = Actor;
+            if (actor != null && (actor.HideFlags & HideFlags.HideInHierarchy) != 0)
+                return;
+
+            _hasSearchFilter = true;
+
+            // Update itself
+            var text = Text;
+            QueryFilterHelper.Range[] ranges;
+            if (SearchIndex >= 0 && SearchIndex < nodes.Length && nodes[SearchIndex] == this && names[SearchIndex] == text)
+                ranges = matches[SearchIndex];
+            else
+                QueryFilterHelper.Match(filterText, text, out ranges); // Node added or renamed after building the index
+            bool isThisVisible = UpdateHighlights(text, ranges);
+
+            // Update children
+            bool isAnyChildVisible = false;
+            for (int i = 0; i < _children.Count; i++)
+            {
+                if (_children[i] is ActorTreeNode child)
+                {
+                    child.UpdateFilter(filterText, nodes, names, matches);
+                    isAnyChildVisible |= child.Visible;
+                }
+            }
+
+            if (isAnyChildVisible)
+            {
+                Expand(true);
+            }
+            else
+            {
+                Collapse(true);
+            }
+
+            Visible = isThisVisible | isAnyChildVisible;
+        }
+
+        private bool UpdateHighlights(string text, QueryFilterHelper.Range[] ranges)
+        {
+            if (ranges == null)
+            {
+                // Hide
+                _highlights?.Clear();
+                return false;
+            }
+
+            // Update highlights
+            if (_highlights == null)
+                _highlights = new List<Rectangle>(ranges.Length);
+            else
+                _highlights.Clear();
+            var font = Style.Current.FontSmall;
+            var textRect = TextRect;
+            for (int i = 0; i < ranges.Length; i++)
+            {
+                var start = font.GetCharPosition(text, ranges[i].StartIndex);
+                var end = font.GetCharPosition(text, ranges[i].EndIndex);
+                _highlights.Add(new Rectangle(start.X + textRect.X, textRect.Y, end.X - start.X, textRect.Height));
+            }
+            return true;
+        }
+
         /// <inheritdoc />
         public override void Update(float deltaTime)
         {
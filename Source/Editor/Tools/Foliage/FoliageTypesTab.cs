@@ -183,6 +183,39 @@ public float DensityScalingScale
 
             //
 
+            [EditorOrder(170), EditorDisplay("Impostor"), Limit(0.0f), Tooltip("The distance from the view at which the instances are drawn as impostors (quads with the model views baked into the atlas on a GPU). Impostors don't cast shadows. Use 0 to disable impostors.")]
+            public float ImpostorDistance
+            {
+                get => _type.ImpostorDistance;
+                set => _type.ImpostorDistance = value;
+            }
+
+            [EditorOrder(175), EditorDisplay("Impostor", "Transition Range"), VisibleIf("HasImpostor"), Limit(0.0f), Tooltip("The distance range of the dithered transition between the model and the impostor (starts at the impostor distance).")]
+            public float ImpostorTransitionRange
+            {
+                get => _type.ImpostorTransitionRange;
+                set => _type.ImpostorTransitionRange = value;
+            }
+
+            [EditorOrder(180), EditorDisplay("Impostor", "Resolution"), VisibleIf("HasImpostor"), Limit(8, 1024), Tooltip("The resolution of a single impostor view (in pixels).")]
+            public int ImpostorResolution
+            {
+                get => _type.ImpostorResolution;
+                set => _type.ImpostorResolution = value;
+            }
+
+            [EditorOrder(185), EditorDisplay("Impostor", "Frames"), VisibleIf("HasImpostor"), Limit(1, 32), Tooltip("The amount of impostor views per atlas side (views cover the upper hemisphere, total count is squared).")]
+            public int ImpostorFrames
+            {
+                get => _type.ImpostorFrames;
+                set => _type.ImpostorFrames = value;
+            }
+
+            [HideInEditor]
+            public bool HasImpostor => _type.ImpostorDistance > 0.0f;
+
+            //
+
             [EditorOrder(200), EditorDisplay("Painting"), Limit(0.0f), Tooltip("The foliage instances density defined in instances count per 1000x1000 units area.")]
             public float Density
             {
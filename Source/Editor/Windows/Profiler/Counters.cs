@@ -0,0 +1,80 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+using System.Collections.Generic;
+using FlaxEngine;
+using FlaxEngine.GUI;
+
+namespace FlaxEditor.Windows.Profiler
+{
+    /// <summary>
+    /// The profiling mode with the named performance counters registered via <see cref="ProfilerCounters"/>.
+    /// </summary>
+    /// <seealso cref="FlaxEditor.Windows.Profiler.ProfilerMode" />
+    internal sealed class Counters : ProfilerMode
+    {
+        private readonly VerticalPanel _layout;
+        private readonly List<SingleChart> _charts = new List<SingleChart>();
+
+        public Counters()
+        : base("Counters")
+        {
+            // Layout
+            var panel = new Panel(ScrollBars.Vertical)
+            {
+                AnchorPreset = AnchorPresets.StretchAll,
+                Offsets = Margin.Zero,
+                Parent = this,
+            };
+            _layout = new VerticalPanel
+            {
+                AnchorPreset = AnchorPresets.HorizontalStretchTop,
+                Offsets = Margin.Zero,
+                IsScrollable = true,
+                Parent = panel,
+            };
+        }
+
+        /// <inheritdoc />
+        public override void Clear()
+        {
+            for (int i = 0; i < _charts.Count; i++)
+                _charts[i].Clear();
+        }
+
+        /// <inheritdoc />
+        public override void Update(ref SharedUpdateData sharedData)
+        {
+            // Create charts for the newly registered counters
+            var count = ProfilerCounters.Count;
+            while (_charts.Count < count)
+            {
+                var id = _charts.Count;
+                var chart = new SingleChart
+                {
+                    Title = ProfilerCounters.GetName(id),
+                    Parent = _layout,
+                };
+                chart.SelectedSampleChanged += OnSelectedSampleChanged;
+                _charts.Add(chart);
+            }
+
+            for (int i = 0; i < count; i++)
+                _charts[i].AddSample((float)ProfilerCounters.GetValue(i));
+        }
+
+        /// <inheritdoc />
+        public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents)
+        {
+            for (int i = 0; i < _charts.Count; i++)
+                _charts[i].SelectedSampleIndex = selectedFrame;
+        }
+
+        /// <inheritdoc />
+        public override void OnDestroy()
+        {
+            _charts.Clear();
+
+            base.OnDestroy();
+        }
+    }
+}
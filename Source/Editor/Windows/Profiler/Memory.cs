@@ -1,6 +1,9 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 using System;
+using System.Collections.Generic;
+using FlaxEditor.GUI;
+using FlaxEngine;
 using FlaxEngine.GUI;
 
 namespace FlaxEditor.Windows.Profiler
@@ -13,6 +16,8 @@ internal sealed class Memory : ProfilerMode
     {
         private readonly SingleChart _nativeAllocationsChart;
         private readonly SingleChart _managedAllocationsChart;
+        private readonly Table _groupsTable;
+        private List<Row> _tableRowsCache;
 
         public Memory()
         : base("Memory")
@@ -47,6 +52,57 @@ public Memory()
                 Parent = layout,
             };
             _managedAllocationsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+
+            // Groups table (allocations tracking per engine subsystem, see ProfilerMemory)
+            var headerColor = Style.Current.LightBackground;
+            _groupsTable = new Table
+            {
+                Columns = new[]
+                {
+                    new ColumnDefinition
+                    {
+                        CellAlignment = TextAlignment.Near,
+                        Title = "Group",
+                        TitleBackgroundColor = headerColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Current",
+                        TitleBackgroundColor = headerColor,
+                        FormatValue = FormatCellBytes,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Peak",
+                        TitleBackgroundColor = headerColor,
+                        FormatValue = FormatCellBytes,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Allocations",
+                        TitleBackgroundColor = headerColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Total Allocations",
+                        TitleBackgroundColor = headerColor,
+                    },
+                },
+                Parent = layout,
+            };
+            _groupsTable.Splits = new[]
+            {
+                0.32f,
+                0.17f,
+                0.17f,
+                0.17f,
+                0.17f,
+            };
+        }
+
+        private static string FormatCellBytes(object x)
+        {
+            return Utilities.Utils.FormatBytesCount((ulong)(long)x);
         }
 
         /// <inheritdoc />
@@ -88,6 +144,75 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
         {
             _nativeAllocationsChart.SelectedSampleIndex = selectedFrame;
             _managedAllocationsChart.SelectedSampleIndex = selectedFrame;
+
+            _groupsTable.Visible = ProfilerMemory.Enabled;
+            if (!ProfilerMemory.Enabled)
+                return;
+            if (_tableRowsCache == null)
+                _tableRowsCache = new List<Row>();
+            UpdateTable();
+        }
+
+        /// <inheritdoc />
+        public override void OnDestroy()
+        {
+            _tableRowsCache?.Clear();
+
+            base.OnDestroy();
+        }
+
+        private void UpdateTable()
+        {
+            _groupsTable.IsLayoutLocked = true;
+            int idx = 0;
+            while (_groupsTable.Children.Count > idx)
+            {
+                var child = _groupsTable.Children[idx];
+                if (child is Row row)
+                {
+                    _tableRowsCache.Add(row);
+                    child.Parent = null;
+                }
+                else
+                {
+                    idx++;
+                }
+            }
+
+            // Show the latest stats of the tracked groups
+            var groups = ProfilerMemory.GetGroupsStats();
+            var rowColor2 = Style.Current.Background * 1.4f;
+            for (int i = 0; i < groups.Length; i++)
+            {
+                ref var e = ref groups[i];
+                if (e.TotalCount == 0)
+                    continue;
+                Row row;
+                if (_tableRowsCache.Count != 0)
+                {
+                    var last = _tableRowsCache.Count - 1;
+                    row = _tableRowsCache[last];
+                    _tableRowsCache.RemoveAt(last);
+                }
+                else
+                {
+                    row = new Row
+                    {
+                        Values = new object[5],
+                    };
+                }
+                row.Values[0] = ((ProfilerMemory.Groups)i).ToString();
+                row.Values[1] = e.Current;
+                row.Values[2] = e.Peak;
+                row.Values[3] = e.Count;
+                row.Values[4] = e.TotalCount;
+                row.Width = _groupsTable.Width;
+                row.BackgroundColor = i % 2 == 0 ? rowColor2 : Color.Transparent;
+                row.Parent = _groupsTable;
+            }
+
+            _groupsTable.UnlockChildrenRecursive();
+            _groupsTable.PerformLayout();
         }
     }
 }
@@ -1,7 +1,10 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
+using System.Collections.Generic;
+using FlaxEditor.GUI;
 using FlaxEngine;
 using FlaxEngine.GUI;
+using FlaxEngine.Networking;
 
 namespace FlaxEditor.Windows.Profiler
 {
@@ -13,7 +16,15 @@ internal sealed class Network : ProfilerMode
     {
         private readonly SingleChart _dataSentChart;
         private readonly SingleChart _dataReceivedChart;
+        private readonly SingleChart _dirtyObjectsChart;
+        private readonly SingleChart _replicatedObjectsChart;
+        private readonly Table _objectTypesTable;
+        private readonly Table _rpcsTable;
+        private readonly Table _channelsTable;
         private FlaxEngine.Networking.NetworkDriverStats _prevStats;
+        private SamplesBuffer<NetworkProfilerStats?> _stats;
+        private List<Row> _tableRowsCache;
+        private uint _prevFrame;
 
         public Network()
         : base("Network")
@@ -48,6 +59,82 @@ public Network()
                 Parent = layout,
             };
             _dataReceivedChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _dirtyObjectsChart = new SingleChart
+            {
+                Title = "Dirty Objects",
+                Parent = layout,
+            };
+            _dirtyObjectsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _replicatedObjectsChart = new SingleChart
+            {
+                Title = "Replicated Objects",
+                Parent = layout,
+            };
+            _replicatedObjectsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+
+            // Tables
+            _objectTypesTable = CreateTable("Object Type", layout);
+            _rpcsTable = CreateTable("RPC", layout);
+            _channelsTable = CreateTable("Channel", layout);
+        }
+
+        private static Table CreateTable(string title, ContainerControl parent)
+        {
+            var headerColor = Style.Current.LightBackground;
+            var table = new Table
+            {
+                Columns = new[]
+                {
+                    new ColumnDefinition
+                    {
+                        CellAlignment = TextAlignment.Near,
+                        Title = title,
+                        TitleBackgroundColor = headerColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Count",
+                        TitleBackgroundColor = headerColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Data Sent",
+                        TitleBackgroundColor = headerColor,
+                        FormatValue = FormatCellBytes,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Messages",
+                        TitleBackgroundColor = headerColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Time ms",
+                        TitleBackgroundColor = headerColor,
+                        FormatValue = FormatCellMs,
+                    },
+                },
+                Parent = parent,
+            };
+            table.Splits = new[]
+            {
+                0.40f,
+                0.15f,
+                0.15f,
+                0.15f,
+                0.15f,
+            };
+            return table;
+        }
+
+        private static string FormatCellBytes(object x)
+        {
+            return Utilities.Utils.FormatBytesCount((uint)x);
+        }
+
+        private static string FormatCellMs(object x)
+        {
+            return ((float)x).ToString("0.00");
         }
 
         private static string FormatSampleBytes(float v)
@@ -60,11 +147,28 @@ public override void Clear()
         {
             _dataSentChart.Clear();
             _dataReceivedChart.Clear();
+            _dirtyObjectsChart.Clear();
+            _replicatedObjectsChart.Clear();
+            _stats?.Clear();
         }
 
         /// <inheritdoc />
         public override void Update(ref SharedUpdateData sharedData)
         {
+            // Profiler counters are collected once per network update
+            NetworkProfilerStats? profilerStats = null;
+            var frame = NetworkManager.Frame;
+            if (frame != _prevFrame)
+            {
+                _prevFrame = frame;
+                profilerStats = NetworkManager.ProfilerStats;
+            }
+            _dirtyObjectsChart.AddSample(profilerStats?.DirtyObjects ?? 0);
+            _replicatedObjectsChart.AddSample(profilerStats?.ReplicatedObjects ?? 0);
+            if (_stats == null)
+                _stats = new SamplesBuffer<NetworkProfilerStats?>();
+            _stats.Add(profilerStats);
+
             var peer = FlaxEngine.Networking.NetworkManager.Peer;
             if (peer == null)
             {
@@ -82,6 +186,81 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
         {
             _dataSentChart.SelectedSampleIndex = selectedFrame;
             _dataReceivedChart.SelectedSampleIndex = selectedFrame;
+            _dirtyObjectsChart.SelectedSampleIndex = selectedFrame;
+            _replicatedObjectsChart.SelectedSampleIndex = selectedFrame;
+
+            if (_stats == null)
+                return;
+            if (_tableRowsCache == null)
+                _tableRowsCache = new List<Row>();
+            var stats = _stats.Count != 0 ? _stats.Get(selectedFrame) : null;
+            UpdateTable(_objectTypesTable, stats?.ObjectTypes);
+            UpdateTable(_rpcsTable, stats?.Rpcs);
+            UpdateTable(_channelsTable, stats?.Channels);
+        }
+
+        /// <inheritdoc />
+        public override void OnDestroy()
+        {
+            _tableRowsCache?.Clear();
+
+            base.OnDestroy();
+        }
+
+        private void UpdateTable(Table table, NetworkProfilerStat[] data)
+        {
+            table.IsLayoutLocked = true;
+            int idx = 0;
+            while (table.Children.Count > idx)
+            {
+                var child = table.Children[idx];
+                if (child is Row row)
+                {
+                    _tableRowsCache.Add(row);
+                    child.Parent = null;
+                }
+                else
+                {
+                    idx++;
+                }
+            }
+
+            if (data != null)
+            {
+                // Show the most expensive items first
+                var items = (NetworkProfilerStat[])data.Clone();
+                System.Array.Sort(items, (a, b) => b.DataSent.CompareTo(a.DataSent));
+                var rowColor2 = Style.Current.Background * 1.4f;
+                for (int i = 0; i < items.Length; i++)
+                {
+                    ref var e = ref items[i];
+                    Row row;
+                    if (_tableRowsCache.Count != 0)
+                    {
+                        var last = _tableRowsCache.Count - 1;
+                        row = _tableRowsCache[last];
+                        _tableRowsCache.RemoveAt(last);
+                    }
+                    else
+                    {
+                        row = new Row
+                        {
+                            Values = new object[5],
+                        };
+                    }
+                    row.Values[0] = e.Name;
+                    row.Values[1] = e.Count;
+                    row.Values[2] = e.DataSent;
+                    row.Values[3] = e.MessagesSent;
+                    row.Values[4] = e.TimeMs;
+                    row.Width = table.Width;
+                    row.BackgroundColor = i % 2 == 0 ? rowColor2 : Color.Transparent;
+                    row.Parent = table;
+                }
+            }
+
+            table.UnlockChildrenRecursive();
+            table.PerformLayout();
         }
     }
 }
@@ -17,6 +17,10 @@ internal sealed class Physics : ProfilerMode
         private readonly SingleChart _staticBodiesChart;
         private readonly SingleChart _newPairsChart;
         private readonly SingleChart _newTouchesChart;
+        private readonly SingleChart _narrowPhasePairsChart;
+        private readonly SingleChart _ccdPairsChart;
+        private readonly SingleChart _triggerPairsChart;
+        private readonly SingleChart _solverConstraintsChart;
 
         public Physics()
         : base("Physics")
@@ -73,6 +77,30 @@ public Physics()
                 Parent = layout,
             };
             _newTouchesChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _narrowPhasePairsChart = new SingleChart
+            {
+                Title = "Narrow Phase Pairs",
+                Parent = layout,
+            };
+            _narrowPhasePairsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _ccdPairsChart = new SingleChart
+            {
+                Title = "CCD Pairs",
+                Parent = layout,
+            };
+            _ccdPairsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _triggerPairsChart = new SingleChart
+            {
+                Title = "Trigger Pairs",
+                Parent = layout,
+            };
+            _triggerPairsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _solverConstraintsChart = new SingleChart
+            {
+                Title = "Solver Constraints",
+                Parent = layout,
+            };
+            _solverConstraintsChart.SelectedSampleChanged += OnSelectedSampleChanged;
         }
 
         /// <inheritdoc />
@@ -84,6 +112,10 @@ public override void Clear()
             _staticBodiesChart.Clear();
             _newPairsChart.Clear();
             _newTouchesChart.Clear();
+            _narrowPhasePairsChart.Clear();
+            _ccdPairsChart.Clear();
+            _triggerPairsChart.Clear();
+            _solverConstraintsChart.Clear();
         }
 
         /// <inheritdoc />
@@ -97,6 +129,10 @@ public override void Update(ref SharedUpdateData sharedData)
             _staticBodiesChart.AddSample(statistics.StaticBodies);
             _newPairsChart.AddSample(statistics.NewPairs);
             _newTouchesChart.AddSample(statistics.NewTouches);
+            _narrowPhasePairsChart.AddSample(statistics.NarrowPhasePairs);
+            _ccdPairsChart.AddSample(statistics.CCDPairs);
+            _triggerPairsChart.AddSample(statistics.TriggerPairs);
+            _solverConstraintsChart.AddSample(statistics.SolverConstraints);
         }
 
         /// <inheritdoc />
@@ -108,6 +144,10 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
             _staticBodiesChart.SelectedSampleIndex = selectedFrame;
             _newPairsChart.SelectedSampleIndex = selectedFrame;
             _newTouchesChart.SelectedSampleIndex = selectedFrame;
+            _narrowPhasePairsChart.SelectedSampleIndex = selectedFrame;
+            _ccdPairsChart.SelectedSampleIndex = selectedFrame;
+            _triggerPairsChart.SelectedSampleIndex = selectedFrame;
+            _solverConstraintsChart.SelectedSampleIndex = selectedFrame;
         }
     }
 }
@@ -196,12 +196,14 @@ public override void OnInit()
             // Create default modes
             AddMode(new Overall());
             AddMode(new CPU());
+            AddMode(new Workers());
             AddMode(new GPU());
             AddMode(new MemoryGPU());
             AddMode(new Memory());
             AddMode(new Assets());
             AddMode(new Network());
             AddMode(new Physics());
+            AddMode(new Counters());
 
             // Init view
             _frameIndex = -1;
@@ -0,0 +1,283 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+using System.Collections.Generic;
+using FlaxEditor.GUI;
+using FlaxEngine;
+using FlaxEngine.GUI;
+
+namespace FlaxEditor.Windows.Profiler
+{
+    /// <summary>
+    /// The Job System and Thread Pool workers profiling mode.
+    /// </summary>
+    /// <seealso cref="FlaxEditor.Windows.Profiler.ProfilerMode" />
+    internal sealed class Workers : ProfilerMode
+    {
+        private readonly SingleChart _jobSystemBusyChart;
+        private readonly SingleChart _threadPoolBusyChart;
+        private readonly SingleChart _executedChart;
+        private readonly SingleChart _stealsChart;
+        private readonly SingleChart _queueDepthChart;
+        private readonly Table _table;
+        private SamplesBuffer<ProfilingTools.WorkerStats[]> _workers;
+        private List<Row> _tableRowsCache;
+
+        public Workers()
+        : base("Threading")
+        {
+            // Layout
+            var panel = new Panel(ScrollBars.Vertical)
+            {
+                AnchorPreset = AnchorPresets.StretchAll,
+                Offsets = Margin.Zero,
+                Parent = this,
+            };
+            var layout = new VerticalPanel
+            {
+                AnchorPreset = AnchorPresets.HorizontalStretchTop,
+                Offsets = Margin.Zero,
+                IsScrollable = true,
+                Parent = panel,
+            };
+
+            // Charts
+            _jobSystemBusyChart = new SingleChart
+            {
+                Title = "Job System Utilization",
+                FormatSample = FormatPercentage,
+                Parent = layout,
+            };
+            _jobSystemBusyChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _threadPoolBusyChart = new SingleChart
+            {
+                Title = "Thread Pool Utilization",
+                FormatSample = FormatPercentage,
+                Parent = layout,
+            };
+            _threadPoolBusyChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _executedChart = new SingleChart
+            {
+                Title = "Executed Jobs",
+                Parent = layout,
+            };
+            _executedChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _stealsChart = new SingleChart
+            {
+                Title = "Stolen Jobs",
+                Parent = layout,
+            };
+            _stealsChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _queueDepthChart = new SingleChart
+            {
+                Title = "Queue Depth (max)",
+                Parent = layout,
+            };
+            _queueDepthChart.SelectedSampleChanged += OnSelectedSampleChanged;
+
+            // Table
+            var headerColor = Style.Current.LightBackground;
+            _table = new Table
+            {
+                Columns = new[]
+                {
+                    new ColumnDefinition
+                    {
+                        CellAlignment = TextAlignment.Near,
+                        Title = "Worker",
+                        TitleBackgroundColor = headerColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Busy",
+                        TitleBackgroundColor = headerColor,
+                        FormatValue = FormatCellPercentage,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Busy ms",
+                        TitleBackgroundColor = headerColor,
+                        FormatValue = FormatCellMs,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Idle ms",
+                        TitleBackgroundColor = headerColor,
+                        FormatValue = FormatCellMs,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Executed",
+                        TitleBackgroundColor = headerColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Steals",
+                        TitleBackgroundColor = headerColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Queue Max",
+                        TitleBackgroundColor = headerColor,
+                    },
+                },
+                Parent = layout,
+            };
+            _table.Splits = new[]
+            {
+                0.34f,
+                0.11f,
+                0.11f,
+                0.11f,
+                0.11f,
+                0.11f,
+                0.11f,
+            };
+        }
+
+        private static string FormatPercentage(float v)
+        {
+            return v.ToString("0.0") + '%';
+        }
+
+        private static string FormatCellPercentage(object x)
+        {
+            return ((float)x).ToString("0.0") + '%';
+        }
+
+        private static string FormatCellMs(object x)
+        {
+            return ((float)x).ToString("0.00");
+        }
+
+        private static float GetUtilization(float busy, float idle)
+        {
+            var total = busy + idle;
+            return total > 0.0f ? busy / total * 100.0f : 0.0f;
+        }
+
+        /// <inheritdoc />
+        public override void Clear()
+        {
+            _jobSystemBusyChart.Clear();
+            _threadPoolBusyChart.Clear();
+            _executedChart.Clear();
+            _stealsChart.Clear();
+            _queueDepthChart.Clear();
+            _workers?.Clear();
+        }
+
+        /// <inheritdoc />
+        public override void Update(ref SharedUpdateData sharedData)
+        {
+            var workers = ProfilingTools.Workers;
+            float jobSystemBusy = 0, jobSystemIdle = 0, threadPoolBusy = 0, threadPoolIdle = 0;
+            int executed = 0, steals = 0, queueDepth = 0;
+            for (int i = 0; i < workers.Length; i++)
+            {
+                ref var e = ref workers[i];
+                if (e.Name != null && e.Name.StartsWith("Thread Pool"))
+                {
+                    threadPoolBusy += e.BusyTimeMs;
+                    threadPoolIdle += e.IdleTimeMs;
+                }
+                else
+                {
+                    jobSystemBusy += e.BusyTimeMs;
+                    jobSystemIdle += e.IdleTimeMs;
+                }
+                executed += e.Executed;
+                steals += e.Steals;
+                queueDepth = Mathf.Max(queueDepth, e.QueueDepthMax);
+            }
+            _jobSystemBusyChart.AddSample(GetUtilization(jobSystemBusy, jobSystemIdle));
+            _threadPoolBusyChart.AddSample(GetUtilization(threadPoolBusy, threadPoolIdle));
+            _executedChart.AddSample(executed);
+            _stealsChart.AddSample(steals);
+            _queueDepthChart.AddSample(queueDepth);
+
+            if (_workers == null)
+                _workers = new SamplesBuffer<ProfilingTools.WorkerStats[]>();
+            _workers.Add(workers);
+        }
+
+        /// <inheritdoc />
+        public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents)
+        {
+            _jobSystemBusyChart.SelectedSampleIndex = selectedFrame;
+            _threadPoolBusyChart.SelectedSampleIndex = selectedFrame;
+            _executedChart.SelectedSampleIndex = selectedFrame;
+            _stealsChart.SelectedSampleIndex = selectedFrame;
+            _queueDepthChart.SelectedSampleIndex = selectedFrame;
+
+            if (_workers == null)
+                return;
+            if (_tableRowsCache == null)
+                _tableRowsCache = new List<Row>();
+            UpdateTable(selectedFrame);
+        }
+
+        /// <inheritdoc />
+        public override void OnDestroy()
+        {
+            _tableRowsCache?.Clear();
+
+            base.OnDestroy();
+        }
+
+        private void UpdateTable(int selectedFrame)
+        {
+            _table.IsLayoutLocked = true;
+            int idx = 0;
+            while (_table.Children.Count > idx)
+            {
+                var child = _table.Children[idx];
+                if (child is Row row)
+                {
+                    _tableRowsCache.Add(row);
+                    child.Parent = null;
+                }
+                else
+                {
+                    idx++;
+                }
+            }
+
+            var data = _workers.Count != 0 ? _workers.Get(selectedFrame) : null;
+            if (data != null)
+            {
+                var rowColor2 = Style.Current.Background * 1.4f;
+                for (int i = 0; i < data.Length; i++)
+                {
+                    ref var e = ref data[i];
+                    Row row;
+                    if (_tableRowsCache.Count != 0)
+                    {
+                        var last = _tableRowsCache.Count - 1;
+                        row = _tableRowsCache[last];
+                        _tableRowsCache.RemoveAt(last);
+                    }
+                    else
+                    {
+                        row = new Row
+                        {
+                            Values = new object[7],
+                        };
+                    }
+                    row.Values[0] = e.Name;
+                    row.Values[1] = GetUtilization(e.BusyTimeMs, e.IdleTimeMs);
+                    row.Values[2] = e.BusyTimeMs;
+                    row.Values[3] = e.IdleTimeMs;
+                    row.Values[4] = e.Executed;
+                    row.Values[5] = e.Steals;
+                    row.Values[6] = e.QueueDepthMax;
+                    row.Width = _table.Width;
+                    row.BackgroundColor = i % 2 == 0 ? rowColor2 : Color.Transparent;
+                    row.Parent = _table;
+                }
+            }
+
+            _table.UnlockChildrenRecursive();
+            _table.PerformLayout();
+        }
+    }
+}
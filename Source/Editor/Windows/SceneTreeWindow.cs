@@ -2,6 +2,8 @@
 
 using System;
 using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
 using FlaxEditor.Gizmo;
 using FlaxEditor.Content;
 using FlaxEditor.GUI.Tree;
@@ -11,6 +13,7 @@
 using FlaxEditor.SceneGraph.GUI;
 using FlaxEditor.Scripting;
 using FlaxEditor.States;
+using FlaxEditor.Utilities;
 using FlaxEngine;
 using FlaxEngine.GUI;
 using static FlaxEditor.GUI.ItemsListContextMenu;
@@ -23,6 +26,15 @@ namespace FlaxEditor.Windows
     /// <seealso cref="FlaxEditor.Windows.SceneEditorWindow" />
     public partial class SceneTreeWindow : SceneEditorWindow
     {
+        private sealed class SearchResult
+        {
+            public int Version;
+            public string Query;
+            public string[] Names;
+            public QueryFilterHelper.Range[][] Matches;
+            public List<int> Indices;
+        }
+
         private TextBox _searchBox;
         private Tree _tree;
         private Panel _sceneTreePanel;
@@ -32,6 +44,11 @@ public partial class SceneTreeWindow : SceneEditorWindow
         private DragAssets _dragAssets;
         private DragActorType _dragActorType;
         private DragHandlers _dragHandlers;
+        private ActorTreeNode[] _searchNodes;
+        private string[] _searchNames;
+        private SearchResult _searchMatches;
+        private SearchResult _searchResult;
+        private int _searchVersion;
 
         /// <summary>
         /// Initializes a new instance of the <see cref="SceneTreeWindow"/> class.
@@ -123,16 +140,71 @@ private void OnSearchBoxTextChanged()
             if (IsLayoutLocked)
                 return;
 
-            _tree.LockChildrenRecursive();
-
-            // Update tree
             var query = _searchBox.Text;
-            var root = Editor.Scene.Root;
-            root.TreeNode.UpdateFilter(query);
+            var version = Interlocked.Increment(ref _searchVersion);
+            if (string.IsNullOrWhiteSpace(query))
+            {
+                // Clear filter
+                _searchNodes = null;
+                _searchNames = null;
+                _searchMatches = null;
+                _tree.LockChildrenRecursive();
+                Editor.Scene.Root.TreeNode.UpdateFilter(query);
+                _tree.UnlockChildrenRecursive();
+                PerformLayout();
+                PerformLayout();
+                return;
+            }
 
-            _tree.UnlockChildrenRecursive();
-            PerformLayout();
-            PerformLayout();
+            // Build a flat index of the tree nodes once per search (nodes added or renamed later are matched when applying the results)
+            if (_searchNodes == null)
+            {
+                var nodes = new List<ActorTreeNode>();
+                BuildSearchIndex(Editor.Scene.Root.TreeNode, nodes);
+                _searchNodes = nodes.ToArray();
+                _searchNames = new string[_searchNodes.Length];
+                for (int i = 0; i < _searchNodes.Length; i++)
+                    _searchNames[i] = _searchNodes[i].Text;
+            }
+
+            // Match the nodes names on a thread pool (if query extends the previous one then test only the previous matches)
+            var previous = _searchMatches;
+            if (previous != null && !query.StartsWith(previous.Query, StringComparison.Ordinal))
+                previous = null;
+            var result = new SearchResult
+            {
+                Version = version,
+                Query = query,
+                Names = _searchNames,
+                Matches = new QueryFilterHelper.Range[_searchNames.Length][],
+                Indices = new List<int>(),
+            };
+            Task.Run(() =>
+            {
+                var names = result.Names;
+                var count = previous?.Indices.Count ?? names.Length;
+                for (int i = 0; i < count; i++)
+                {
+                    // Cancel if query has been changed
+                    if ((i & 1023) == 0 && Volatile.Read(ref _searchVersion) != version)
+                        return;
+                    var index = previous != null ? previous.Indices[i] : i;
+                    if (QueryFilterHelper.Match(query, names[index], out result.Matches[index]))
+                        result.Indices.Add(index);
+                }
+                Volatile.Write(ref _searchResult, result);
+            });
+        }
+
+        private static void BuildSearchIndex(ActorTreeNode node, List<ActorTreeNode> nodes)
+        {
+            node.SearchIndex = nodes.Count;
+            nodes.Add(node);
+            for (int i = 0; i < node.ChildrenCount; i++)
+            {
+                if (node.Children[i] is ActorTreeNode child)
+                    BuildSearchIndex(child, nodes);
+            }
         }
 
         private void Rename()
@@ -270,6 +342,24 @@ private static bool ValidateDragActorType(ScriptType actorType)
             return true;
         }
 
+        /// <inheritdoc />
+        public override void Update(float deltaTime)
+        {
+            // Apply the search results
+            var result = Interlocked.Exchange(ref _searchResult, null);
+            if (result != null && result.Version == _searchVersion && result.Names == _searchNames)
+            {
+                _searchMatches = result;
+                _tree.LockChildrenRecursive();
+                Editor.Scene.Root.TreeNode.UpdateFilter(result.Query, _searchNodes, result.Names, result.Matches);
+                _tree.UnlockChildrenRecursive();
+                PerformLayout();
+                PerformLayout();
+            }
+
+            base.Update(deltaTime);
+        }
+
         /// <inheritdoc />
         public override void Draw()
         {
@@ -455,6 +545,11 @@ public override void OnDestroy()
             _dragHandlers = null;
             _tree = null;
             _searchBox = null;
+            Interlocked.Increment(ref _searchVersion);
+            _searchNodes = null;
+            _searchNames = null;
+            _searchMatches = null;
+            _searchResult = null;
 
             base.OnDestroy();
         }
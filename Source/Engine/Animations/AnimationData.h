@@ -4,6 +4,7 @@
 
 #include "Engine/Core/Types/String.h"
 #include "Engine/Animations/Curve.h"
+#include "Engine/Animations/CompressedAnimationData.h"
 #include "Engine/Core/Math/Transform.h"
 
 /// <summary>
@@ -124,6 +125,11 @@ struct AnimationData
     /// </summary>
     Array<NodeAnimationData> Channels;
 
+    /// <summary>
+    /// The compressed animation data (optional). If valid, it's used for sampling and the channels curves are empty (channels contain only the nodes names).
+    /// </summary>
+    CompressedAnimationData Compressed;
+
 public:
     /// <summary>
     /// Gets the length of the animation (in seconds).
@@ -136,9 +142,24 @@ struct AnimationData
         return static_cast<float>(Duration / FramesPerSecond);
     }
 
+    /// <summary>
+    /// Evaluates the animation channel transformation at the specified time (only for the tracks with non-empty data). Uses the compressed data if valid.
+    /// </summary>
+    /// <param name="channelIndex">The channel index.</param>
+    /// <param name="time">The time to evaluate the channel at (in frames).</param>
+    /// <param name="result">The evaluated transformation.</param>
+    /// <param name="loop">If true the curve will loop when it goes past the end or beginning. Otherwise the curve value will be clamped. Compressed data is always clamped.</param>
+    FORCE_INLINE void Evaluate(int32 channelIndex, float time, Transform* result, bool loop = true) const
+    {
+        if (Compressed.IsValid())
+            Compressed.Evaluate(channelIndex, time, result);
+        else
+            Channels[channelIndex].Evaluate(time, result, loop);
+    }
+
     uint64 GetMemoryUsage() const
     {
-        uint64 result = RootNodeName.Length() * sizeof(Char) + Channels.Capacity() * sizeof(NodeAnimationData);
+        uint64 result = RootNodeName.Length() * sizeof(Char) + Channels.Capacity() * sizeof(NodeAnimationData) + Compressed.GetMemoryUsage();
         for (const auto& e : Channels)
             result += e.GetMemoryUsage();
         return result;
@@ -168,6 +189,7 @@ struct AnimationData
         ::Swap(EnableRootMotion, other.EnableRootMotion);
         ::Swap(RootNodeName, other.RootNodeName);
         Channels.Swap(other.Channels);
+        Compressed.Swap(other.Compressed);
     }
 
     /// <summary>
@@ -180,5 +202,6 @@ struct AnimationData
         RootNodeName.Clear();
         EnableRootMotion = false;
         Channels.Resize(0);
+        Compressed.Dispose();
     }
 };
@@ -14,5 +14,6 @@ public override void Setup(BuildOptions options)
         base.Setup(options);
 
         options.PublicDependencies.Add("Visject");
+        options.PrivateDependencies.Add("Physics");
     }
 }
@@ -3,10 +3,13 @@
 #include "Animations.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/TaskGraph.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Physics/Physics.h"
 
 class AnimationsService : public EngineService
 {
@@ -20,15 +23,62 @@ class AnimationsService : public EngineService
     void Dispose() override;
 };
 
+struct SharedAnimationPoseKey
+{
+    AnimationGraph* Graph;
+    SkinnedModel* Model;
+    uint32 ParametersHash;
+    int32 Phase;
+
+    bool operator==(const SharedAnimationPoseKey& other) const
+    {
+        return Graph == other.Graph && Model == other.Model && ParametersHash == other.ParametersHash && Phase == other.Phase;
+    }
+
+    friend uint32 GetHash(const SharedAnimationPoseKey& key)
+    {
+        uint32 hash = GetHash(key.Graph);
+        CombineHash(hash, GetHash(key.Model));
+        CombineHash(hash, key.ParametersHash);
+        CombineHash(hash, GetHash(key.Phase));
+        return hash;
+    }
+};
+
+// The animation graph instance evaluated once per update for all the animated models that share it
+struct SharedAnimationPose
+{
+    SharedAnimationPoseKey Key;
+    AnimGraphInstanceData Instance;
+    SkinnedMeshDrawData Skinning;
+    float PhaseTime = 0.0f;
+    Array<AnimatedModel*> Users;
+    Array<AnimatedModel*> Models;
+};
+
 class AnimationsSystem : public TaskGraphSystem
 {
 public:
     float DeltaTime, UnscaledDeltaTime, Time, UnscaledTime;
     void Job(int32 index);
+    void UpdateModel(AnimatedModel* animatedModel);
+    void UpdateSharedPose(SharedAnimationPose* pose);
+    SharedAnimationPose* AcquireSharedPose(AnimatedModel* animatedModel);
     void Execute(TaskGraph* graph) override;
     void PostExecute(TaskGraph* graph) override;
 };
 
+class AnimationsPostProcessSystem : public TaskGraphSystem
+{
+public:
+    Array<RayCastCommand> Rays;
+    Array<RayCastHit> Hits;
+    Array<int32> HitsOffsets;
+
+    void Job(int32 index);
+    void Execute(TaskGraph* graph) override;
+};
+
 namespace
 {
     FORCE_INLINE bool CanUpdateModel(AnimatedModel* animatedModel)
@@ -43,11 +93,52 @@ namespace
 #endif
                 && animGraph->Graph.IsReady();
     }
+
+    bool CanSharePose(AnimatedModel* animatedModel)
+    {
+        if (!animatedModel->ShareAnimation || animatedModel->GraphInstance.LocalPoseOverride.IsBinded())
+            return false;
+        for (const auto& slot : animatedModel->GraphInstance.Slots)
+        {
+            if (slot.Animation)
+                return false;
+        }
+        return true;
+    }
+
+    uint32 GetSharedPoseParametersHash(AnimatedModel* animatedModel)
+    {
+        uint32 hash = GetHash(animatedModel->UseTimeScale);
+        CombineHash(hash, GetHash(animatedModel->UpdateSpeed));
+        for (const auto& param : animatedModel->GraphInstance.Parameters)
+            CombineHash(hash, GetHash(param.Value));
+        return hash;
+    }
+
+    float GetDeltaTime(AnimGraphInstanceData& instance, float deltaTime, float time, float updateSpeed)
+    {
+        // Animation delta time can be based on a time since last update or the current delta
+        float dt = deltaTime;
+        const float lastUpdateTime = instance.LastUpdateTime;
+        if (lastUpdateTime > 0 && time > lastUpdateTime)
+        {
+            dt = time - lastUpdateTime;
+        }
+        dt *= updateSpeed;
+        instance.LastUpdateTime = time;
+        return dt;
+    }
 }
 
 AnimationsService AnimationManagerInstance;
 Array<AnimatedModel*> UpdateList;
+Array<AnimatedModel*> SoloUpdateList;
+Array<AnimatedModel*> PostProcessList;
+Array<SharedAnimationPose*> SharedUpdateList;
+Dictionary<SharedAnimationPoseKey, SharedAnimationPose*> SharedPoses;
 TaskGraphSystem* Animations::System = nullptr;
+TaskGraphSystem* Animations::PostProcessSystem = nullptr;
+float Animations::SharedAnimationPhaseStep = 0.1f;
 #if USE_EDITOR
 Delegate<Asset*, ScriptingObject*, uint32, uint32> Animations::DebugFlow;
 #endif
@@ -56,49 +147,143 @@ bool AnimationsService::Init()
 {
     Animations::System = New<AnimationsSystem>();
     Engine::UpdateGraph->AddSystem(Animations::System);
+    Animations::PostProcessSystem = New<AnimationsPostProcessSystem>();
+    Animations::PostProcessSystem->AddDependency(Animations::System);
+    Engine::UpdateGraph->AddSystem(Animations::PostProcessSystem);
     return false;
 }
 
 void AnimationsService::Dispose()
 {
     UpdateList.Resize(0);
+    SoloUpdateList.Resize(0);
+    SharedUpdateList.Resize(0);
+    for (auto& e : SharedPoses)
+    {
+        while (e.Value->Users.HasItems())
+            Animations::ReleaseSharedPose(e.Value->Users.Last());
+    }
+    SharedPoses.ClearDelete();
+    PostProcessList.Resize(0);
+    SAFE_DELETE(Animations::PostProcessSystem);
     SAFE_DELETE(Animations::System);
 }
 
 void AnimationsSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Animations.Job");
-    auto animatedModel = UpdateList[index];
-    if (CanUpdateModel(animatedModel))
-    {
-        auto graph = animatedModel->AnimationGraph.Get();
+    PROFILE_MEM(Animations);
+    AssetReferencesBatch referencesBatch;
+    if (index < SoloUpdateList.Count())
+        UpdateModel(SoloUpdateList[index]);
+    else
+        UpdateSharedPose(SharedUpdateList[index - SoloUpdateList.Count()]);
+}
+
+void AnimationsSystem::UpdateModel(AnimatedModel* animatedModel)
+{
+    auto graph = animatedModel->AnimationGraph.Get();
 #if COMPILE_WITH_PROFILER && TRACY_ENABLE
-        const StringView graphName(graph->GetPath());
-        ZoneName(*graphName, graphName.Length());
+    const StringView graphName(graph->GetPath());
+    ZoneName(*graphName, graphName.Length());
 #endif
 
-        // Prepare skinning data
-        animatedModel->SetupSkinningData();
+    // Prepare skinning data
+    animatedModel->SetupSkinningData();
 
-        // Animation delta time can be based on a time since last update or the current delta
-        float dt = animatedModel->UseTimeScale ? DeltaTime : UnscaledDeltaTime;
-        float t = animatedModel->UseTimeScale ? Time : UnscaledTime;
-        const float lastUpdateTime = animatedModel->GraphInstance.LastUpdateTime;
-        if (lastUpdateTime > 0 && t > lastUpdateTime)
-        {
-            dt = t - lastUpdateTime;
-        }
-        dt *= animatedModel->UpdateSpeed;
-        animatedModel->GraphInstance.LastUpdateTime = t;
+    // Evaluate animated nodes pose
+    const float dt = GetDeltaTime(animatedModel->GraphInstance, animatedModel->UseTimeScale ? DeltaTime : UnscaledDeltaTime, animatedModel->UseTimeScale ? Time : UnscaledTime, animatedModel->UpdateSpeed);
+    graph->GraphExecutor.Update(animatedModel->GraphInstance, dt);
 
-        // Evaluate animated nodes pose
-        graph->GraphExecutor.Update(animatedModel->GraphInstance, dt);
+    // Update gameplay (models with Foot IK are finished after the ground raycasts in the post-process stage)
+    if (animatedModel->HasFootIK())
+        animatedModel->PrepareFootIK();
+    else
+        animatedModel->OnAnimationUpdated_Async();
+}
 
-        // Update gameplay
+void AnimationsSystem::UpdateSharedPose(SharedAnimationPose* pose)
+{
+    // The first model evaluates the graph for the whole group (used by Custom Nodes, debug flows and anim events)
+    AnimatedModel* leader = pose->Models[0];
+    auto graph = pose->Key.Graph;
+#if COMPILE_WITH_PROFILER && TRACY_ENABLE
+    const StringView graphName(graph->GetPath());
+    ZoneName(*graphName, graphName.Length());
+#endif
+
+    // Evaluate animated nodes pose (phase offset is applied once when the pose starts to play)
+    float dt = GetDeltaTime(pose->Instance, leader->UseTimeScale ? DeltaTime : UnscaledDeltaTime, leader->UseTimeScale ? Time : UnscaledTime, leader->UpdateSpeed);
+    dt += pose->PhaseTime;
+    pose->PhaseTime = 0.0f;
+    pose->Instance.Object = leader;
+    graph->GraphExecutor.Update(pose->Instance, dt);
+
+    // Calculate the final bones transformations and update the shared skinning
+    AnimatedModel::UpdateSkinningData(pose->Key.Model->Skeleton, pose->Instance.NodesPose, pose->Skinning, !leader->PerBoneMotionBlur);
+
+    // Update gameplay
+    for (AnimatedModel* animatedModel : pose->Models)
+    {
+        animatedModel->SetupSkinningData();
+        auto& instance = animatedModel->GraphInstance;
+        instance.NodesPose = pose->Instance.NodesPose;
+        instance.RootTransform = pose->Instance.RootTransform;
+        instance.RootMotion = pose->Instance.RootMotion;
+        instance.LastUpdateTime = pose->Instance.LastUpdateTime;
+        instance.CurrentFrame = pose->Instance.CurrentFrame;
         animatedModel->OnAnimationUpdated_Async();
     }
 }
 
+SharedAnimationPose* AnimationsSystem::AcquireSharedPose(AnimatedModel* animatedModel)
+{
+    // Build the evaluation key
+    const float step = Math::Max(Animations::SharedAnimationPhaseStep, ZeroTolerance);
+    SharedAnimationPoseKey key;
+    key.Graph = animatedModel->AnimationGraph.Get();
+    key.Model = animatedModel->SkinnedModel.Get();
+    key.ParametersHash = GetSharedPoseParametersHash(animatedModel);
+    key.Phase = (int32)Math::Floor(animatedModel->SharedAnimationPhase / step);
+
+    // Reuse the current pose if the state has not changed
+    SharedAnimationPose* pose = animatedModel->_sharedPose;
+    if (pose && pose->Key == key)
+        return pose;
+    if (pose)
+        Animations::ReleaseSharedPose(animatedModel);
+    if (!SharedPoses.TryGet(key, pose))
+    {
+        // Create a new pose (clone the parameters values of the first model)
+        pose = New<SharedAnimationPose>();
+        pose->Key = key;
+        auto& instance = pose->Instance;
+        instance.Object = animatedModel;
+        instance.NodesSkeleton = key.Model;
+        instance.Parameters.Resize(animatedModel->GraphInstance.Parameters.Count(), false);
+        for (int32 i = 0; i < instance.Parameters.Count(); i++)
+        {
+            const auto& src = animatedModel->GraphInstance.Parameters[i];
+            auto& dst = instance.Parameters[i];
+            dst.Type = src.Type;
+            dst.Identifier = src.Identifier;
+            dst.Name = src.Name;
+            dst.IsPublic = src.IsPublic;
+            dst.Value = src.Value;
+#if USE_EDITOR
+            dst.Meta = src.Meta;
+#endif
+        }
+        pose->PhaseTime = (float)key.Phase * step;
+        pose->Skinning.Setup(key.Model->Skeleton.Bones.Count());
+        SharedPoses.Add(key, pose);
+    }
+    pose->Users.Add(animatedModel);
+    animatedModel->_sharedPose = pose;
+    animatedModel->_sharedSkinning = &pose->Skinning;
+    return pose;
+}
+
 void AnimationsSystem::Execute(TaskGraph* graph)
 {
     if (UpdateList.Count() == 0)
@@ -117,10 +302,32 @@ void AnimationsSystem::Execute(TaskGraph* graph)
         Animations::DebugFlow(nullptr, nullptr, 0, 0);
 #endif
 
+    // Group the models that share the animation evaluation so each unique pose is evaluated only once
+    for (AnimatedModel* animatedModel : UpdateList)
+    {
+        if (!CanUpdateModel(animatedModel))
+            continue;
+        if (CanSharePose(animatedModel) && !animatedModel->HasFootIK())
+        {
+            SharedAnimationPose* pose = AcquireSharedPose(animatedModel);
+            if (pose->Models.IsEmpty())
+                SharedUpdateList.Add(pose);
+            pose->Models.Add(animatedModel);
+        }
+        else
+        {
+            if (animatedModel->_sharedPose)
+                Animations::ReleaseSharedPose(animatedModel);
+            SoloUpdateList.Add(animatedModel);
+            if (animatedModel->HasFootIK())
+                PostProcessList.Add(animatedModel);
+        }
+    }
+
     // Schedule work to update all animated models in async
     Function<void(int32)> job;
     job.Bind<AnimationsSystem, &AnimationsSystem::Job>(this);
-    graph->DispatchJob(job, UpdateList.Count());
+    graph->DispatchJob(job, SoloUpdateList.Count() + SharedUpdateList.Count());
 }
 
 void AnimationsSystem::PostExecute(TaskGraph* graph)
@@ -139,6 +346,50 @@ void AnimationsSystem::PostExecute(TaskGraph* graph)
 
     // Cleanup
     UpdateList.Clear();
+    SoloUpdateList.Clear();
+    PostProcessList.Clear();
+    for (SharedAnimationPose* pose : SharedUpdateList)
+        pose->Models.Clear();
+    SharedUpdateList.Clear();
+    for (auto it = SharedPoses.Begin(); it.IsNotEnd(); ++it)
+    {
+        if (it->Value->Users.IsEmpty())
+        {
+            Delete(it->Value);
+            SharedPoses.Remove(it);
+        }
+    }
+}
+
+void AnimationsPostProcessSystem::Job(int32 index)
+{
+    PROFILE_CPU_NAMED("Animations.PostProcess");
+    PROFILE_MEM(Animations);
+    auto animatedModel = PostProcessList[index];
+    animatedModel->ApplyFootIK(Hits.Get() + HitsOffsets[index]);
+    animatedModel->OnAnimationUpdated_Async();
+}
+
+void AnimationsPostProcessSystem::Execute(TaskGraph* graph)
+{
+    if (PostProcessList.Count() == 0)
+        return;
+    PROFILE_CPU_NAMED("Animations.PostProcess");
+
+    // Collect the ground raycasts of all animated models and run them as a single batched physics query
+    Rays.Clear();
+    HitsOffsets.Resize(PostProcessList.Count(), false);
+    for (int32 i = 0; i < PostProcessList.Count(); i++)
+    {
+        HitsOffsets[i] = Rays.Count();
+        PostProcessList[i]->GetFootIKRays(Rays);
+    }
+    Physics::RayCastBatch(Span<RayCastCommand>(Rays.Get(), Rays.Count()), Hits);
+
+    // Schedule work to solve the IK and finish the animated models update in async
+    Function<void(int32)> job;
+    job.Bind<AnimationsPostProcessSystem, &AnimationsPostProcessSystem::Job>(this);
+    graph->DispatchJob(job, PostProcessList.Count());
 }
 
 void Animations::AddToUpdate(AnimatedModel* obj)
@@ -150,3 +401,14 @@ void Animations::RemoveFromUpdate(AnimatedModel* obj)
 {
     UpdateList.Remove(obj);
 }
+
+void Animations::ReleaseSharedPose(AnimatedModel* obj)
+{
+    SharedAnimationPose* pose = obj->_sharedPose;
+    if (!pose)
+        return;
+    obj->_sharedPose = nullptr;
+    obj->_sharedSkinning = nullptr;
+    pose->Users.Remove(obj);
+    pose->Models.Remove(obj);
+}
@@ -21,6 +21,16 @@ API_CLASS(Static) class FLAXENGINE_API Animations
     /// </summary>
     API_FIELD(ReadOnly) static TaskGraphSystem* System;
 
+    /// <summary>
+    /// Animations post-process system used to update the animated models after the animations update (eg. Foot IK with batched ground raycasts). Depends on System.
+    /// </summary>
+    API_FIELD(ReadOnly) static TaskGraphSystem* PostProcessSystem;
+
+    /// <summary>
+    /// The time step (in seconds) used to quantize the animation phase of the animated models that share the animation evaluation (see AnimatedModel::ShareAnimation). Models with the phase in the same step share the pose. Larger values increase the amount of the models that share the evaluation.
+    /// </summary>
+    API_FIELD() static float SharedAnimationPhaseStep;
+
 #if USE_EDITOR
     // Custom event that is called every time the Anim Graph signal flows over the graph (including the data connections). Can be used to read and visualize the animation blending logic. Args are: anim graph asset, animated object, node id, box id
     API_EVENT() static Delegate<Asset*, ScriptingObject*, uint32, uint32> DebugFlow;
@@ -37,4 +47,10 @@ API_CLASS(Static) class FLAXENGINE_API Animations
     /// </summary>
     /// <param name="obj">The object.</param>
     static void RemoveFromUpdate(AnimatedModel* obj);
+
+    /// <summary>
+    /// Releases the shared animation evaluation used by the animated model (see AnimatedModel::ShareAnimation).
+    /// </summary>
+    /// <param name="obj">The object.</param>
+    static void ReleaseSharedPose(AnimatedModel* obj);
 };
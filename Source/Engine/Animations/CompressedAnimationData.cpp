@@ -0,0 +1,316 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "CompressedAnimationData.h"
+#include "AnimationData.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Serialization/ReadStream.h"
+#include "Engine/Serialization/WriteStream.h"
+
+#define QUANTIZE_MAX 65535.0f
+
+namespace
+{
+    FORCE_INLINE uint16 Quantize(float value, float min, float scale)
+    {
+        if (scale <= 0.0f)
+            return 0;
+        return (uint16)Math::Clamp(Math::RoundToInt((value - min) / scale), 0, (int32)QUANTIZE_MAX);
+    }
+
+    bool GetRange(const LinearCurve<Float3>::KeyFrameCollection& keyframes, Float3& min, Float3& scale)
+    {
+        // Linear curve values never leave the range of the keyframes values
+        min = keyframes[0].Value;
+        Float3 max = min;
+        for (int32 i = 1; i < keyframes.Count(); i++)
+        {
+            min = Float3::Min(min, keyframes[i].Value);
+            max = Float3::Max(max, keyframes[i].Value);
+        }
+        scale = (max - min) / QUANTIZE_MAX;
+        return !Float3::NearEqual(min, max);
+    }
+
+    bool IsAnimated(const LinearCurve<Quaternion>::KeyFrameCollection& keyframes)
+    {
+        for (int32 i = 1; i < keyframes.Count(); i++)
+        {
+            if (!Quaternion::NearEqual(keyframes[0].Value, keyframes[i].Value))
+                return true;
+        }
+        return false;
+    }
+
+    FORCE_INLINE SimdVector4 Sample(const uint16* a, const uint16* b, SimdVector4 alpha)
+    {
+        const SimdVector4 v0 = SIMD::LoadUShort4(a);
+        return SIMD::MulAdd(SIMD::Sub(SIMD::LoadUShort4(b), v0), alpha, v0);
+    }
+
+    FORCE_INLINE Float3 SampleFloat3(const uint16* a, const uint16* b, SimdVector4 alpha, const Float3& min, const Float3& scale)
+    {
+        float value[4];
+        SIMD::StoreUnaligned(value, SIMD::MulAdd(Sample(a, b, alpha), SIMD::Load(scale.X, scale.Y, scale.Z, 0.0f), SIMD::Load(min.X, min.Y, min.Z, 0.0f)));
+        return Float3(value[0], value[1], value[2]);
+    }
+
+    FORCE_INLINE Quaternion SampleQuaternion(const uint16* a, const uint16* b, SimdVector4 alpha)
+    {
+        Quaternion value;
+        SIMD::StoreUnaligned(&value, SIMD::MulAdd(Sample(a, b, alpha), SIMD::Splat(2.0f / QUANTIZE_MAX), SIMD::Splat(-1.0f)));
+        value.Normalize();
+        return value;
+    }
+
+    FORCE_INLINE Float3 DecodeFloat3(const uint16* a, const Float3& min, const Float3& scale)
+    {
+        return Float3((float)a[0] * scale.X + min.X, (float)a[1] * scale.Y + min.Y, (float)a[2] * scale.Z + min.Z);
+    }
+}
+
+void CompressedAnimationData::Compress(const AnimationData& data)
+{
+    Dispose();
+    if (data.Channels.IsEmpty())
+        return;
+    const int32 framesCount = Math::Max(Math::CeilToInt((float)data.Duration), 0) + 1;
+
+    // Setup channels and pack the animated tracks into a frame block
+    int32 stride = 0;
+    Channels.Resize(data.Channels.Count());
+    for (int32 i = 0; i < Channels.Count(); i++)
+    {
+        const NodeAnimationData& src = data.Channels[i];
+        Channel& dst = Channels[i];
+        Platform::MemoryClear(&dst, sizeof(Channel));
+        dst.PositionOffset = dst.RotationOffset = dst.ScaleOffset = -1;
+        dst.Position = src.Position.GetDefaultValue();
+        dst.Rotation = src.Rotation.GetDefaultValue();
+        dst.Scale = src.Scale.GetDefaultValue();
+
+        const auto& position = src.Position.GetKeyframes();
+        if (position.HasItems())
+        {
+            dst.Flags |= HasPosition;
+            dst.Position = position[0].Value;
+            if (GetRange(position, dst.PositionMin, dst.PositionScale))
+            {
+                dst.PositionOffset = (int16)stride;
+                stride += 3;
+            }
+        }
+        const auto& rotation = src.Rotation.GetKeyframes();
+        if (rotation.HasItems())
+        {
+            dst.Flags |= HasRotation;
+            dst.Rotation = rotation[0].Value;
+            if (IsAnimated(rotation))
+            {
+                dst.RotationOffset = (int16)stride;
+                stride += 4;
+            }
+        }
+        const auto& scale = src.Scale.GetKeyframes();
+        if (scale.HasItems())
+        {
+            dst.Flags |= HasScale;
+            dst.Scale = scale[0].Value;
+            if (GetRange(scale, dst.ScaleMin, dst.ScaleScale))
+            {
+                dst.ScaleOffset = (int16)stride;
+                stride += 3;
+            }
+        }
+
+        if (stride > MAX_int16 - 4)
+        {
+            LOG(Warning, "Animation has too many animated channels to compress it.");
+            Dispose();
+            return;
+        }
+    }
+
+    // Sample the animated tracks at every frame (with a single padding value at the end to allow reading 3-component tracks as 4-component vectors)
+    Array<Quaternion> prevRotations;
+    prevRotations.Resize(Channels.Count());
+    Frames.Resize(framesCount * stride + 1);
+    Frames.Last() = 0;
+    for (int32 frame = 0; frame < framesCount; frame++)
+    {
+        uint16* block = Frames.Get() + frame * stride;
+        const float time = (float)frame;
+        for (int32 i = 0; i < Channels.Count(); i++)
+        {
+            const NodeAnimationData& src = data.Channels[i];
+            const Channel& dst = Channels[i];
+            if (dst.PositionOffset != -1)
+            {
+                Float3 value;
+                src.Position.Evaluate(value, time, false);
+                uint16* q = block + dst.PositionOffset;
+                q[0] = Quantize(value.X, dst.PositionMin.X, dst.PositionScale.X);
+                q[1] = Quantize(value.Y, dst.PositionMin.Y, dst.PositionScale.Y);
+                q[2] = Quantize(value.Z, dst.PositionMin.Z, dst.PositionScale.Z);
+            }
+            if (dst.RotationOffset != -1)
+            {
+                Quaternion value;
+                src.Rotation.Evaluate(value, time, false);
+                value.Normalize();
+
+                // Keep the rotations in the same hemisphere so they can be interpolated linearly between frames
+                if (frame != 0 && Quaternion::Dot(prevRotations[i], value) < 0)
+                    value *= -1;
+                prevRotations[i] = value;
+                uint16* q = block + dst.RotationOffset;
+                q[0] = Quantize(value.X, -1.0f, 2.0f / QUANTIZE_MAX);
+                q[1] = Quantize(value.Y, -1.0f, 2.0f / QUANTIZE_MAX);
+                q[2] = Quantize(value.Z, -1.0f, 2.0f / QUANTIZE_MAX);
+                q[3] = Quantize(value.W, -1.0f, 2.0f / QUANTIZE_MAX);
+            }
+            if (dst.ScaleOffset != -1)
+            {
+                Float3 value;
+                src.Scale.Evaluate(value, time, false);
+                uint16* q = block + dst.ScaleOffset;
+                q[0] = Quantize(value.X, dst.ScaleMin.X, dst.ScaleScale.X);
+                q[1] = Quantize(value.Y, dst.ScaleMin.Y, dst.ScaleScale.Y);
+                q[2] = Quantize(value.Z, dst.ScaleMin.Z, dst.ScaleScale.Z);
+            }
+        }
+    }
+    FramesCount = framesCount;
+    FrameStride = stride;
+}
+
+void CompressedAnimationData::Decompress(AnimationData& data) const
+{
+    ASSERT(data.Channels.Count() == Channels.Count());
+    for (int32 i = 0; i < Channels.Count(); i++)
+    {
+        const Channel& src = Channels[i];
+        NodeAnimationData& dst = data.Channels[i];
+        dst.Position.Clear();
+        dst.Rotation.Clear();
+        dst.Scale.Clear();
+        if (src.Flags & HasPosition)
+        {
+            auto keyframes = dst.Position.Resize(src.PositionOffset != -1 ? FramesCount : 1);
+            if (src.PositionOffset != -1)
+            {
+                for (int32 frame = 0; frame < FramesCount; frame++)
+                    keyframes[frame] = LinearCurveKeyframe<Float3>((float)frame, DecodeFloat3(Frames.Get() + frame * FrameStride + src.PositionOffset, src.PositionMin, src.PositionScale));
+            }
+            else
+            {
+                keyframes[0] = LinearCurveKeyframe<Float3>(0.0f, src.Position);
+            }
+        }
+        if (src.Flags & HasRotation)
+        {
+            auto keyframes = dst.Rotation.Resize(src.RotationOffset != -1 ? FramesCount : 1);
+            if (src.RotationOffset != -1)
+            {
+                for (int32 frame = 0; frame < FramesCount; frame++)
+                {
+                    const uint16* q = Frames.Get() + frame * FrameStride + src.RotationOffset;
+                    keyframes[frame] = LinearCurveKeyframe<Quaternion>((float)frame, SampleQuaternion(q, q, SIMD::Splat(0.0f)));
+                }
+            }
+            else
+            {
+                keyframes[0] = LinearCurveKeyframe<Quaternion>(0.0f, src.Rotation);
+            }
+        }
+        if (src.Flags & HasScale)
+        {
+            auto keyframes = dst.Scale.Resize(src.ScaleOffset != -1 ? FramesCount : 1);
+            if (src.ScaleOffset != -1)
+            {
+                for (int32 frame = 0; frame < FramesCount; frame++)
+                    keyframes[frame] = LinearCurveKeyframe<Float3>((float)frame, DecodeFloat3(Frames.Get() + frame * FrameStride + src.ScaleOffset, src.ScaleMin, src.ScaleScale));
+            }
+            else
+            {
+                keyframes[0] = LinearCurveKeyframe<Float3>(0.0f, src.Scale);
+            }
+        }
+    }
+}
+
+void CompressedAnimationData::Evaluate(int32 channelIndex, float time, Transform* result) const
+{
+    const Channel& channel = Channels[channelIndex];
+    const float frame = Math::Clamp(time, 0.0f, (float)(FramesCount - 1));
+    const int32 frame0 = (int32)frame;
+    const int32 frame1 = Math::Min(frame0 + 1, FramesCount - 1);
+    const SimdVector4 alpha = SIMD::Splat(frame - (float)frame0);
+    const uint16* block0 = Frames.Get() + frame0 * FrameStride;
+    const uint16* block1 = Frames.Get() + frame1 * FrameStride;
+    if (channel.Flags & HasPosition)
+    {
+        if (channel.PositionOffset != -1)
+            result->Translation = SampleFloat3(block0 + channel.PositionOffset, block1 + channel.PositionOffset, alpha, channel.PositionMin, channel.PositionScale);
+        else
+            result->Translation = channel.Position;
+    }
+    if (channel.Flags & HasRotation)
+    {
+        if (channel.RotationOffset != -1)
+            result->Orientation = SampleQuaternion(block0 + channel.RotationOffset, block1 + channel.RotationOffset, alpha);
+        else
+            result->Orientation = channel.Rotation;
+    }
+    if (channel.Flags & HasScale)
+    {
+        if (channel.ScaleOffset != -1)
+            result->Scale = SampleFloat3(block0 + channel.ScaleOffset, block1 + channel.ScaleOffset, alpha, channel.ScaleMin, channel.ScaleScale);
+        else
+            result->Scale = channel.Scale;
+    }
+}
+
+void CompressedAnimationData::Serialize(WriteStream& stream) const
+{
+    // Version
+    stream.WriteInt32(1);
+
+    stream.WriteInt32(FramesCount);
+    stream.WriteInt32(FrameStride);
+    stream.WriteInt32(Channels.Count());
+    stream.WriteBytes(Channels.Get(), Channels.Count() * sizeof(Channel));
+    stream.WriteInt32(Frames.Count());
+    stream.WriteBytes(Frames.Get(), Frames.Count() * sizeof(uint16));
+}
+
+bool CompressedAnimationData::Deserialize(ReadStream& stream)
+{
+    Dispose();
+
+    // Version
+    int32 version;
+    stream.ReadInt32(&version);
+    if (version != 1)
+        return true;
+
+    int32 framesCount, frameStride, channelsCount, dataCount;
+    stream.ReadInt32(&framesCount);
+    stream.ReadInt32(&frameStride);
+    stream.ReadInt32(&channelsCount);
+    if (framesCount < 0 || frameStride < 0 || channelsCount < 0)
+        return true;
+    Channels.Resize(channelsCount, false);
+    stream.ReadBytes(Channels.Get(), Channels.Count() * sizeof(Channel));
+    stream.ReadInt32(&dataCount);
+    if (dataCount != framesCount * frameStride + 1)
+    {
+        Dispose();
+        return true;
+    }
+    Frames.Resize(dataCount, false);
+    stream.ReadBytes(Frames.Get(), Frames.Count() * sizeof(uint16));
+    FramesCount = framesCount;
+    FrameStride = frameStride;
+    return stream.HasError();
+}
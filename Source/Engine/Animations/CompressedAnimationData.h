@@ -0,0 +1,135 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
+
+struct Transform;
+struct AnimationData;
+class ReadStream;
+class WriteStream;
+
+/// <summary>
+/// Compressed skeleton nodes animation data container. Stores the animated tracks sampled at every animation frame with quantized values (16-bit per component) packed into the per-frame blocks so sampling of all nodes at the given time reads two continuous memory blocks.
+/// </summary>
+/// <remarks>
+/// Constant tracks are stored once per channel (not in the frame blocks). Rotations are interpolated linearly between the frames (with normalization) since they are sampled at the animation frame rate.
+/// </remarks>
+struct FLAXENGINE_API CompressedAnimationData
+{
+public:
+    enum ChannelFlags : byte
+    {
+        None = 0,
+        HasPosition = 1,
+        HasRotation = 2,
+        HasScale = 4,
+    };
+
+    /// <summary>
+    /// Single node animation channel description.
+    /// </summary>
+    struct Channel
+    {
+        // The channel tracks (see ChannelFlags).
+        byte Flags;
+        // The offset of the animated track data in the frame block (in 16-bit units) or -1 if track is constant.
+        int16 PositionOffset;
+        int16 RotationOffset;
+        int16 ScaleOffset;
+        // The quantization range of the position track (value = min + quantized * scale).
+        Float3 PositionMin;
+        Float3 PositionScale;
+        // The quantization range of the scale track (value = min + quantized * scale).
+        Float3 ScaleMin;
+        Float3 ScaleScale;
+        // The constant values of the tracks (used if track is not animated).
+        Float3 Position;
+        Quaternion Rotation;
+        Float3 Scale;
+    };
+
+public:
+    /// <summary>
+    /// The amount of the sampled frames.
+    /// </summary>
+    int32 FramesCount = 0;
+
+    /// <summary>
+    /// The size of the single frame block (in 16-bit units).
+    /// </summary>
+    int32 FrameStride = 0;
+
+    /// <summary>
+    /// The channels (the same order as animation channels).
+    /// </summary>
+    Array<Channel> Channels;
+
+    /// <summary>
+    /// The quantized frames data (frame blocks one after another).
+    /// </summary>
+    Array<uint16> Frames;
+
+public:
+    /// <summary>
+    /// Returns true if contains the compressed animation data.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return FramesCount != 0;
+    }
+
+    /// <summary>
+    /// Compresses the animation curves by sampling them at every animation frame.
+    /// </summary>
+    /// <param name="data">The source animation data.</param>
+    void Compress(const AnimationData& data);
+
+    /// <summary>
+    /// Decompresses the animation into the channels curves (one keyframe per every frame of the animated tracks).
+    /// </summary>
+    /// <param name="data">The destination animation data (channels have to match).</param>
+    void Decompress(AnimationData& data) const;
+
+    /// <summary>
+    /// Evaluates the channel transformation at the specified time (only for the tracks included in the channel). Time is clamped to the animation range.
+    /// </summary>
+    /// <param name="channelIndex">The channel index.</param>
+    /// <param name="time">The time to evaluate the channel at (in frames).</param>
+    /// <param name="result">The evaluated transformation.</param>
+    void Evaluate(int32 channelIndex, float time, Transform* result) const;
+
+    /// <summary>
+    /// Serializes the data to the stream.
+    /// </summary>
+    void Serialize(WriteStream& stream) const;
+
+    /// <summary>
+    /// Deserializes the data from the stream.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Deserialize(ReadStream& stream);
+
+    uint64 GetMemoryUsage() const
+    {
+        return Channels.Capacity() * sizeof(Channel) + Frames.Capacity() * sizeof(uint16);
+    }
+
+    void Swap(CompressedAnimationData& other)
+    {
+        ::Swap(FramesCount, other.FramesCount);
+        ::Swap(FrameStride, other.FrameStride);
+        Channels.Swap(other.Channels);
+        Frames.Swap(other.Frames);
+    }
+
+    void Dispose()
+    {
+        FramesCount = 0;
+        FrameStride = 0;
+        Channels.Resize(0);
+        Frames.Resize(0);
+    }
+};
@@ -342,6 +342,20 @@ class CurveBase
     /// <param name="time">The time to evaluate the curve at.</param>
     /// <param name="loop">If true the curve will loop when it goes past the end or beginning. Otherwise the curve value will be clamped.</param>
     void Evaluate(const KeyFrameData& data, T& result, float time, bool loop = true) const
+    {
+        int32 keyHint = -1;
+        Evaluate(data, result, time, loop, keyHint);
+    }
+
+    /// <summary>
+    /// Evaluates the animation curve value at the specified time. Uses the key found in the previous evaluation to skip the keys search when time changes by small steps (eg. in playback).
+    /// </summary>
+    /// <param name="data">The keyframes data container.</param>
+    /// <param name="result">The interpolated value from the curve at provided time.</param>
+    /// <param name="time">The time to evaluate the curve at.</param>
+    /// <param name="loop">If true the curve will loop when it goes past the end or beginning. Otherwise the curve value will be clamped.</param>
+    /// <param name="keyHint">The key index cache. Use -1 for the first evaluation, it gets updated with the found key.</param>
+    void Evaluate(const KeyFrameData& data, T& result, float time, bool loop, int32& keyHint) const
     {
         const int32 count = data.Length();
         if (count == 0)
@@ -356,7 +370,7 @@ class CurveBase
 
         int32 leftKeyIdx;
         int32 rightKeyIdx;
-        FindKeys(data, time, leftKeyIdx, rightKeyIdx);
+        FindKeys(data, time, leftKeyIdx, rightKeyIdx, keyHint);
 
         const KeyFrame& leftKey = data[leftKeyIdx];
         const KeyFrame& rightKey = data[rightKeyIdx];
@@ -492,6 +506,32 @@ class CurveBase
         leftKey = Math::Max(0, start - 1);
         rightKey = Math::Min(start, data.Length() - 1);
     }
+
+    /// <summary>
+    /// Returns a pair of keys that can be used for interpolating to field the value at the provided time. Checks the cached key and the next one before doing the full search.
+    /// </summary>
+    /// <param name="data">The keyframes data container.</param>
+    /// <param name="time">The time for which to find the relevant keys from. It is expected to be clamped to a valid range within the curve.</param>
+    /// <param name="leftKey">The index of the key to interpolate from.</param>
+    /// <param name="rightKey">The index of the key to interpolate to.</param>
+    /// <param name="keyHint">The key index cache (updated with the found left key).</param>
+    void FindKeys(const KeyFrameData& data, float time, int32& leftKey, int32& rightKey, int32& keyHint) const
+    {
+        const int32 count = data.Length();
+        for (int32 key = Math::Max(keyHint, 0); keyHint >= 0 && key < count && key <= keyHint + 1; key++)
+        {
+            if (time < data[key].Time)
+                break;
+            if (key + 1 == count || time < data[key + 1].Time)
+            {
+                leftKey = keyHint = key;
+                rightKey = Math::Min(key + 1, count - 1);
+                return;
+            }
+        }
+        FindKeys(data, time, leftKey, rightKey);
+        keyHint = leftKey;
+    }
 };
 
 /// <summary>
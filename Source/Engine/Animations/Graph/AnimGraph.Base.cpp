@@ -8,6 +8,7 @@
 #include "Engine/Content/Content.h"
 #include "Engine/Utilities/Delaunay2D.h"
 #include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 AnimSubGraph* AnimGraphBase::LoadSubGraph(const void* data, int32 dataLength, const Char* name)
 {
@@ -51,6 +52,13 @@ bool AnimGraphBase::Load(ReadStream* stream, bool loadMeta)
 
     BucketsCountTotal += BucketsCountSelf;
 
+    // Compile the pure expressions (eg. blend alpha or transition rule math) into the programs to skip the nodes recursion at runtime
+    if (!_graph->_isFunction)
+    {
+        PROFILE_CPU_NAMED("CompilePrograms");
+        CompilePrograms(*_graph);
+    }
+
     return false;
 }
 
@@ -61,7 +69,7 @@ void AnimGraphBase::Clear()
     StateTransitions.Resize(0);
 
     // Base
-    GraphType::Clear();
+    VisjectGraph::Clear();
 }
 
 #if USE_EDITOR
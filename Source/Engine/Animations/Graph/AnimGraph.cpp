@@ -373,6 +373,15 @@ VisjectExecutor::Value AnimGraphExecutor::eatBox(Node* caller, Box* box)
     }
 #endif
 
+    // Evaluate the compiled expression without the nodes recursion (debug flow needs the per-node evaluation)
+    const VisjectProgram* program = box->Program;
+#if USE_EDITOR
+    if (program && !Animations::DebugFlow.IsBinded())
+#else
+    if (program)
+#endif
+        return program->Execute(context.Data->Parameters);
+
     // Add to the calling stack
     context.CallStack.Add(caller);
 
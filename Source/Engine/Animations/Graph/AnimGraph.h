@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Visject/VisjectGraph.h"
+#include "Engine/Visject/VisjectProgram.h"
 #include "Engine/Content/Assets/Animation.h"
 #include "Engine/Core/Collections/ChunkedArray.h"
 #include "Engine/Animations/AlphaBlend.h"
@@ -739,6 +740,7 @@ struct AnimGraphContext
     uint64 CurrentFrameIndex;
     AnimGraphInstanceData* Data;
     AnimGraphImpulse EmptyNodes;
+    Array<Transform> SampledNodes;
     AnimGraphTransitionData TransitionData;
     Array<VisjectExecutor::Node*, FixedAllocation<ANIM_GRAPH_MAX_CALL_STACK>> CallStack;
     Array<VisjectExecutor::Graph*, FixedAllocation<32>> GraphStack;
@@ -0,0 +1,298 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "AnimGraphPose.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/SIMD.h"
+
+namespace
+{
+    // The rotations of 4 nodes stored as the structure of arrays
+    struct QuaternionSoA
+    {
+        SimdVector4 X, Y, Z, W;
+    };
+
+    FORCE_INLINE QuaternionSoA LoadRotations(const Transform* nodes)
+    {
+        QuaternionSoA q;
+        q.X = SIMD::LoadUnaligned(&nodes[0].Orientation);
+        q.Y = SIMD::LoadUnaligned(&nodes[1].Orientation);
+        q.Z = SIMD::LoadUnaligned(&nodes[2].Orientation);
+        q.W = SIMD::LoadUnaligned(&nodes[3].Orientation);
+        SIMD::Transpose(q.X, q.Y, q.Z, q.W);
+        return q;
+    }
+
+    FORCE_INLINE void StoreRotations(Transform* nodes, QuaternionSoA q)
+    {
+        SIMD::Transpose(q.X, q.Y, q.Z, q.W);
+        SIMD::StoreUnaligned(&nodes[0].Orientation, q.X);
+        SIMD::StoreUnaligned(&nodes[1].Orientation, q.Y);
+        SIMD::StoreUnaligned(&nodes[2].Orientation, q.Z);
+        SIMD::StoreUnaligned(&nodes[3].Orientation, q.W);
+    }
+
+    FORCE_INLINE SimdVector4 Dot(const QuaternionSoA& a, const QuaternionSoA& b)
+    {
+        return SIMD::MulAdd(a.X, b.X, SIMD::MulAdd(a.Y, b.Y, SIMD::MulAdd(a.Z, b.Z, SIMD::Mul(a.W, b.W))));
+    }
+
+    // Sine approximation for the range [-PI/2, PI/2] (Taylor series up to x^11, max error ~1e-7)
+    FORCE_INLINE SimdVector4 Sin(SimdVector4 x)
+    {
+        const SimdVector4 x2 = SIMD::Mul(x, x);
+        SimdVector4 r = SIMD::Splat(-2.5052108e-8f);
+        r = SIMD::MulAdd(r, x2, SIMD::Splat(2.7557319e-6f));
+        r = SIMD::MulAdd(r, x2, SIMD::Splat(-1.9841270e-4f));
+        r = SIMD::MulAdd(r, x2, SIMD::Splat(8.3333333e-3f));
+        r = SIMD::MulAdd(r, x2, SIMD::Splat(-1.6666667e-1f));
+        r = SIMD::MulAdd(r, x2, SIMD::Splat(1.0f));
+        return SIMD::Mul(r, x);
+    }
+
+    // Arc cosine approximation for the range [0, 1] (Abramowitz and Stegun 4.4.46, max error ~2e-8)
+    FORCE_INLINE SimdVector4 Acos(SimdVector4 x)
+    {
+        SimdVector4 r = SIMD::Splat(-0.0012624911f);
+        r = SIMD::MulAdd(r, x, SIMD::Splat(0.0066700901f));
+        r = SIMD::MulAdd(r, x, SIMD::Splat(-0.0170881256f));
+        r = SIMD::MulAdd(r, x, SIMD::Splat(0.0308918810f));
+        r = SIMD::MulAdd(r, x, SIMD::Splat(-0.0501743046f));
+        r = SIMD::MulAdd(r, x, SIMD::Splat(0.0889789874f));
+        r = SIMD::MulAdd(r, x, SIMD::Splat(-0.2145988016f));
+        r = SIMD::MulAdd(r, x, SIMD::Splat(1.5707963050f));
+        return SIMD::Mul(r, SIMD::Sqrt(SIMD::Max(SIMD::Sub(SIMD::Splat(1.0f), x), SIMD::Splat(0.0f))));
+    }
+
+    // Matches Quaternion::Slerp (amount has to be in range [0, 1])
+    FORCE_INLINE QuaternionSoA Slerp(const QuaternionSoA& a, const QuaternionSoA& b, SimdVector4 amount)
+    {
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 dot = Dot(a, b);
+        const SimdVector4 absDot = SIMD::Abs(dot);
+        const SimdVector4 angle = Acos(SIMD::Min(absDot, one));
+        const SimdVector4 invSin = SIMD::Div(one, Sin(angle));
+        const SimdVector4 inverseAmount = SIMD::Sub(one, amount);
+
+        // Use linear interpolation for the almost equal rotations (angle is close to zero so results of the spherical path are not used)
+        const SimdVector4 linear = SIMD::Less(SIMD::Splat(1.0f - ZeroTolerance), absDot);
+        const SimdVector4 inverse = SIMD::Select(linear, inverseAmount, SIMD::Mul(Sin(SIMD::Mul(inverseAmount, angle)), invSin));
+        SimdVector4 opposite = SIMD::Select(linear, amount, SIMD::Mul(Sin(SIMD::Mul(amount, angle)), invSin));
+
+        // Apply the sign of the dot product (zero for perpendicular rotations)
+        opposite = SIMD::Select(SIMD::Less(dot, zero), SIMD::Sub(zero, opposite), SIMD::And(SIMD::Less(zero, dot), opposite));
+
+        QuaternionSoA r;
+        r.X = SIMD::MulAdd(inverse, a.X, SIMD::Mul(opposite, b.X));
+        r.Y = SIMD::MulAdd(inverse, a.Y, SIMD::Mul(opposite, b.Y));
+        r.Z = SIMD::MulAdd(inverse, a.Z, SIMD::Mul(opposite, b.Z));
+        r.W = SIMD::MulAdd(inverse, a.W, SIMD::Mul(opposite, b.W));
+        return r;
+    }
+
+    // Matches Quaternion::Multiply
+    FORCE_INLINE QuaternionSoA Multiply(const QuaternionSoA& l, const QuaternionSoA& r)
+    {
+        const SimdVector4 a = SIMD::Sub(SIMD::Mul(l.Y, r.Z), SIMD::Mul(l.Z, r.Y));
+        const SimdVector4 b = SIMD::Sub(SIMD::Mul(l.Z, r.X), SIMD::Mul(l.X, r.Z));
+        const SimdVector4 c = SIMD::Sub(SIMD::Mul(l.X, r.Y), SIMD::Mul(l.Y, r.X));
+        const SimdVector4 d = SIMD::MulAdd(l.X, r.X, SIMD::MulAdd(l.Y, r.Y, SIMD::Mul(l.Z, r.Z)));
+        QuaternionSoA q;
+        q.X = SIMD::Add(SIMD::MulAdd(l.X, r.W, SIMD::Mul(r.X, l.W)), a);
+        q.Y = SIMD::Add(SIMD::MulAdd(l.Y, r.W, SIMD::Mul(r.Y, l.W)), b);
+        q.Z = SIMD::Add(SIMD::MulAdd(l.Z, r.W, SIMD::Mul(r.Z, l.W)), c);
+        q.W = SIMD::Sub(SIMD::Mul(l.W, r.W), d);
+        return q;
+    }
+
+    // Matches Quaternion::Normalize
+    FORCE_INLINE void Normalize(QuaternionSoA& q)
+    {
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 length = SIMD::Sqrt(Dot(q, q));
+        const SimdVector4 invLength = SIMD::Select(SIMD::Less(length, SIMD::Splat(ZeroTolerance)), one, SIMD::Div(one, length));
+        q.X = SIMD::Mul(q.X, invLength);
+        q.Y = SIMD::Mul(q.Y, invLength);
+        q.Z = SIMD::Mul(q.Z, invLength);
+        q.W = SIMD::Mul(q.W, invLength);
+    }
+
+    FORCE_INLINE void BlendAdditive(const Transform& a, const Transform& b, float alpha, Transform& result)
+    {
+        Transform t;
+        t.Translation = a.Translation + b.Translation;
+        t.Orientation = a.Orientation * b.Orientation;
+        t.Orientation.Normalize();
+        t.Scale = a.Scale * b.Scale;
+        Transform::Lerp(a, t, alpha, result);
+    }
+
+    FORCE_INLINE void AddShortest(Quaternion& base, Quaternion additive, float weight)
+    {
+        // Pick a shortest path between rotation to fix blending artifacts
+        additive *= weight;
+        if (Quaternion::Dot(base, additive) < 0)
+            additive *= -1;
+        base += additive;
+    }
+}
+
+void AnimGraphPose::Lerp(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count)
+{
+    int32 i = 0;
+    if (alpha >= 0.0f && alpha <= 1.0f)
+    {
+        const SimdVector4 amount = SIMD::Splat(alpha);
+        for (; i + 4 <= count; i += 4)
+        {
+            const QuaternionSoA qa = LoadRotations(a + i);
+            const QuaternionSoA qb = LoadRotations(b + i);
+            for (int32 j = i; j < i + 4; j++)
+            {
+                result[j].Translation = Vector3::Lerp(a[j].Translation, b[j].Translation, alpha);
+                result[j].Scale = Float3::Lerp(a[j].Scale, b[j].Scale, alpha);
+            }
+            StoreRotations(result + i, Slerp(qa, qb, amount));
+        }
+    }
+    for (; i < count; i++)
+        Transform::Lerp(a[i], b[i], alpha, result[i]);
+}
+
+void AnimGraphPose::LerpMasked(const Transform* a, const Transform* b, float alpha, const BitArray<>& mask, Transform* result, int32 count)
+{
+    int32 i = 0;
+    if (alpha >= 0.0f && alpha <= 1.0f)
+    {
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        for (; i + 4 <= count; i += 4)
+        {
+            // Masked out nodes use zero alpha so the rotation stays the same as in the first pose
+            const SimdVector4 m = SIMD::Less(zero, SIMD::Load(mask[i] ? 1.0f : 0.0f, mask[i + 1] ? 1.0f : 0.0f, mask[i + 2] ? 1.0f : 0.0f, mask[i + 3] ? 1.0f : 0.0f));
+            const QuaternionSoA qa = LoadRotations(a + i);
+            const QuaternionSoA qb = LoadRotations(b + i);
+            for (int32 j = i; j < i + 4; j++)
+            {
+                if (mask[j])
+                {
+                    result[j].Translation = Vector3::Lerp(a[j].Translation, b[j].Translation, alpha);
+                    result[j].Scale = Float3::Lerp(a[j].Scale, b[j].Scale, alpha);
+                }
+                else
+                {
+                    result[j].Translation = a[j].Translation;
+                    result[j].Scale = a[j].Scale;
+                }
+            }
+            QuaternionSoA q = Slerp(qa, qb, SIMD::And(m, SIMD::Splat(alpha)));
+            q.X = SIMD::Select(m, q.X, qa.X);
+            q.Y = SIMD::Select(m, q.Y, qa.Y);
+            q.Z = SIMD::Select(m, q.Z, qa.Z);
+            q.W = SIMD::Select(m, q.W, qa.W);
+            StoreRotations(result + i, q);
+        }
+    }
+    for (; i < count; i++)
+    {
+        if (mask[i])
+            Transform::Lerp(a[i], b[i], alpha, result[i]);
+        else
+            result[i] = a[i];
+    }
+}
+
+void AnimGraphPose::BlendAdditive(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count)
+{
+    int32 i = 0;
+    if (alpha >= 0.0f && alpha <= 1.0f)
+    {
+        const SimdVector4 amount = SIMD::Splat(alpha);
+        for (; i + 4 <= count; i += 4)
+        {
+            const QuaternionSoA qa = LoadRotations(a + i);
+            QuaternionSoA qt = Multiply(qa, LoadRotations(b + i));
+            Normalize(qt);
+            for (int32 j = i; j < i + 4; j++)
+            {
+                const Vector3 translation = a[j].Translation + b[j].Translation;
+                const Float3 scale = a[j].Scale * b[j].Scale;
+                result[j].Translation = Vector3::Lerp(a[j].Translation, translation, alpha);
+                result[j].Scale = Float3::Lerp(a[j].Scale, scale, alpha);
+            }
+            StoreRotations(result + i, Slerp(qa, qt, amount));
+        }
+    }
+    for (; i < count; i++)
+        ::BlendAdditive(a[i], b[i], alpha, result[i]);
+}
+
+void AnimGraphPose::Weighted(const Transform* src, float weight, Transform* result, int32 count)
+{
+    const SimdVector4 w = SIMD::Splat(weight);
+    for (int32 i = 0; i < count; i++)
+    {
+        result[i].Translation = src[i].Translation * weight;
+        result[i].Scale = src[i].Scale * weight;
+        SIMD::StoreUnaligned(&result[i].Orientation, SIMD::Mul(SIMD::LoadUnaligned(&src[i].Orientation), w));
+    }
+}
+
+void AnimGraphPose::Add(Transform* dst, const Transform* src, float weight, int32 count)
+{
+    const SimdVector4 w = SIMD::Splat(weight);
+    for (int32 i = 0; i < count; i++)
+    {
+        dst[i].Translation += src[i].Translation * weight;
+        dst[i].Scale += src[i].Scale * weight;
+        SIMD::StoreUnaligned(&dst[i].Orientation, SIMD::MulAdd(SIMD::LoadUnaligned(&src[i].Orientation), w, SIMD::LoadUnaligned(&dst[i].Orientation)));
+    }
+}
+
+void AnimGraphPose::AddShortest(Transform* dst, const Transform* src, float weight, int32 count)
+{
+    const SimdVector4 w = SIMD::Splat(weight);
+    const SimdVector4 zero = SIMD::Splat(0.0f);
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        QuaternionSoA base = LoadRotations(dst + i);
+        QuaternionSoA additive = LoadRotations(src + i);
+        additive.X = SIMD::Mul(additive.X, w);
+        additive.Y = SIMD::Mul(additive.Y, w);
+        additive.Z = SIMD::Mul(additive.Z, w);
+        additive.W = SIMD::Mul(additive.W, w);
+
+        // Pick a shortest path between rotation to fix blending artifacts (flip the sign bit of the opposite rotations)
+        const SimdVector4 flip = SIMD::And(SIMD::Less(Dot(base, additive), zero), SIMD::Splat(-0.0f));
+        base.X = SIMD::Add(base.X, SIMD::Xor(additive.X, flip));
+        base.Y = SIMD::Add(base.Y, SIMD::Xor(additive.Y, flip));
+        base.Z = SIMD::Add(base.Z, SIMD::Xor(additive.Z, flip));
+        base.W = SIMD::Add(base.W, SIMD::Xor(additive.W, flip));
+        for (int32 j = i; j < i + 4; j++)
+        {
+            dst[j].Translation += src[j].Translation * weight;
+            dst[j].Scale += src[j].Scale * weight;
+        }
+        StoreRotations(dst + i, base);
+    }
+    for (; i < count; i++)
+    {
+        dst[i].Translation += src[i].Translation * weight;
+        dst[i].Scale += src[i].Scale * weight;
+        ::AddShortest(dst[i].Orientation, src[i].Orientation, weight);
+    }
+}
+
+void AnimGraphPose::NormalizeRotations(Transform* nodes, int32 count)
+{
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        QuaternionSoA q = LoadRotations(nodes + i);
+        Normalize(q);
+        StoreRotations(nodes + i, q);
+    }
+    for (; i < count; i++)
+        nodes[i].Orientation.Normalize();
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/BitArray.h"
+
+struct Transform;
+
+/// <summary>
+/// The batched kernels that operate on the whole animation pose (array of nodes transformations). Rotations are processed in groups of 4 nodes using SIMD (the remaining nodes use a scalar path).
+/// </summary>
+/// <remarks>
+/// All kernels allow the result buffer to be the same as one of the inputs (per-node in-place operation).
+/// </remarks>
+namespace AnimGraphPose
+{
+    /// <summary>
+    /// Blends the poses (linear interpolation of translation and scale, spherical interpolation of rotation). Matches Transform::Lerp.
+    /// </summary>
+    /// <param name="a">The first pose.</param>
+    /// <param name="b">The second pose.</param>
+    /// <param name="alpha">The blend alpha (0 returns the first pose, 1 returns the second pose).</param>
+    /// <param name="result">The result pose.</param>
+    /// <param name="count">The amount of the nodes.</param>
+    void Lerp(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count);
+
+    /// <summary>
+    /// Blends the poses only for the nodes that are set in the mask. The other nodes use the first pose.
+    /// </summary>
+    /// <param name="a">The first pose.</param>
+    /// <param name="b">The second pose.</param>
+    /// <param name="alpha">The blend alpha (0 returns the first pose, 1 returns the second pose).</param>
+    /// <param name="mask">The nodes mask (must contain at least count items).</param>
+    /// <param name="result">The result pose.</param>
+    /// <param name="count">The amount of the nodes.</param>
+    void LerpMasked(const Transform* a, const Transform* b, float alpha, const BitArray<>& mask, Transform* result, int32 count);
+
+    /// <summary>
+    /// Blends the additive pose on top of the base pose (translation is added, rotation and scale are multiplied).
+    /// </summary>
+    /// <param name="a">The base pose.</param>
+    /// <param name="b">The additive pose.</param>
+    /// <param name="alpha">The blend alpha (0 returns the base pose, 1 returns the full additive pose applied).</param>
+    /// <param name="result">The result pose.</param>
+    /// <param name="count">The amount of the nodes.</param>
+    void BlendAdditive(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count);
+
+    /// <summary>
+    /// Scales all the pose components by the weight (result = src * weight).
+    /// </summary>
+    /// <param name="src">The source pose.</param>
+    /// <param name="weight">The weight.</param>
+    /// <param name="result">The result pose.</param>
+    /// <param name="count">The amount of the nodes.</param>
+    void Weighted(const Transform* src, float weight, Transform* result, int32 count);
+
+    /// <summary>
+    /// Accumulates the weighted pose (dst += src * weight).
+    /// </summary>
+    /// <param name="dst">The destination pose.</param>
+    /// <param name="src">The source pose.</param>
+    /// <param name="weight">The weight.</param>
+    /// <param name="count">The amount of the nodes.</param>
+    void Add(Transform* dst, const Transform* src, float weight, int32 count);
+
+    /// <summary>
+    /// Accumulates the weighted pose (dst += src * weight) with the rotations added along the shortest path (rotation is negated if it points to the opposite hemisphere than the destination rotation).
+    /// </summary>
+    /// <param name="dst">The destination pose.</param>
+    /// <param name="src">The source pose.</param>
+    /// <param name="weight">The weight.</param>
+    /// <param name="count">The amount of the nodes.</param>
+    void AddShortest(Transform* dst, const Transform* src, float weight, int32 count);
+
+    /// <summary>
+    /// Normalizes the rotations of all the pose nodes.
+    /// </summary>
+    /// <param name="nodes">The pose.</param>
+    /// <param name="count">The amount of the nodes.</param>
+    void NormalizeRotations(Transform* nodes, int32 count);
+}
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "AnimGraph.h"
+#include "AnimGraphPose.h"
 #include "Engine/Content/Assets/Animation.h"
 #include "Engine/Content/Assets/SkeletonMask.h"
 #include "Engine/Content/Assets/AnimationGraphFunction.h"
@@ -22,10 +23,7 @@ namespace
 
     FORCE_INLINE void NormalizeRotations(AnimGraphImpulse* nodes, RootMotionMode rootMotionMode)
     {
-        for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-        {
-            nodes->Nodes[i].Orientation.Normalize();
-        }
+        AnimGraphPose::NormalizeRotations(nodes->Nodes.Get(), nodes->Nodes.Count());
         if (rootMotionMode != RootMotionMode::NoExtraction)
         {
             nodes->RootMotion.Orientation.Normalize();
@@ -255,15 +253,22 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
     SkinnedModel::SkeletonMapping sourceMapping;
     if (retarget)
         sourceMapping = _graph.BaseModel->GetSkeletonMapping(mapping.SourceSkeleton);
-    for (int32 i = 0; i < nodes->Nodes.Count(); i++)
+    // Sample the nodes directly into the output pose when overriding it, otherwise use the temporary buffer and blend it with a batched kernel
+    const int32 nodesCount = nodes->Nodes.Count();
+    const bool blend = weighted || mode == ProcessAnimationMode::BlendAdditive || mode == ProcessAnimationMode::Add;
+    auto& sampledNodes = Context.Get().SampledNodes;
+    if (blend)
+        sampledNodes.Resize(nodesCount, false);
+    Transform* srcNodes = blend ? sampledNodes.Get() : nodes->Nodes.Get();
+    for (int32 i = 0; i < nodesCount; i++)
     {
         const int32 nodeToChannel = mapping.NodesMapping[i];
-        Transform& dstNode = nodes->Nodes[i];
-        Transform srcNode = emptyNodes->Nodes[i];
+        Transform& srcNode = srcNodes[i];
+        srcNode = emptyNodes->Nodes[i];
         if (nodeToChannel != -1)
         {
             // Calculate the animated node transformation
-            anim->Data.Channels[nodeToChannel].Evaluate(animPos, &srcNode, false);
+            anim->Data.Evaluate(nodeToChannel, animPos, &srcNode, false);
 
             // Optionally retarget animation into the skeleton used by the Anim Graph
             if (retarget)
@@ -271,32 +276,16 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
                 RetargetSkeletonNode(mapping.SourceSkeleton->Skeleton, mapping.TargetSkeleton->Skeleton, sourceMapping, srcNode, i);
             }
         }
-
-        // Blend node
-        if (mode == ProcessAnimationMode::BlendAdditive)
-        {
-            dstNode.Translation += srcNode.Translation * weight;
-            dstNode.Scale += srcNode.Scale * weight;
-            BlendAdditiveWeightedRotation(dstNode.Orientation, srcNode.Orientation, weight);
-        }
-        else if (mode == ProcessAnimationMode::Add)
-        {
-            dstNode.Translation += srcNode.Translation * weight;
-            dstNode.Scale += srcNode.Scale * weight;
-            dstNode.Orientation += srcNode.Orientation * weight;
-        }
-        else if (weighted)
-        {
-            dstNode.Translation = srcNode.Translation * weight;
-            dstNode.Scale = srcNode.Scale * weight;
-            dstNode.Orientation = srcNode.Orientation * weight;
-        }
-        else
-        {
-            dstNode = srcNode;
-        }
     }
 
+    // Blend nodes
+    if (mode == ProcessAnimationMode::BlendAdditive)
+        AnimGraphPose::AddShortest(nodes->Nodes.Get(), srcNodes, weight, nodesCount);
+    else if (mode == ProcessAnimationMode::Add)
+        AnimGraphPose::Add(nodes->Nodes.Get(), srcNodes, weight, nodesCount);
+    else if (weighted)
+        AnimGraphPose::Weighted(srcNodes, weight, nodes->Nodes.Get(), nodesCount);
+
     // Handle root motion
     if (_rootMotionMode != RootMotionMode::NoExtraction && anim->Data.EnableRootMotion)
     {
@@ -311,8 +300,7 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
         {
             // Get the root bone transformation
             Transform rootBefore = refPose;
-            const NodeAnimationData& rootChannel = anim->Data.Channels[nodeToChannel];
-            rootChannel.Evaluate(animPrevPos, &rootBefore, false);
+            anim->Data.Evaluate(nodeToChannel, animPrevPos, &rootBefore, false);
 
             // Check if animation looped
             if (animPos < animPrevPos)
@@ -321,12 +309,12 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
                 const float timeToEnd = endPos - animPrevPos;
 
                 Transform rootBegin = refPose;
-                rootChannel.Evaluate(0, &rootBegin, false);
+                anim->Data.Evaluate(nodeToChannel, 0, &rootBegin, false);
 
                 Transform rootEnd = refPose;
-                rootChannel.Evaluate(endPos, &rootEnd, false);
+                anim->Data.Evaluate(nodeToChannel, endPos, &rootEnd, false);
 
-                //rootChannel.Evaluate(animPos - timeToEnd, &rootNow, true);
+                //anim->Data.Evaluate(nodeToChannel, animPos - timeToEnd, &rootNow, true);
 
                 // Complex motion calculation to preserve the looped movement
                 // (end - before + now - begin)
@@ -466,10 +454,7 @@ Variant AnimGraphExecutor::Blend(AnimGraphNode* node, const Value& poseA, const
     if (!ANIM_GRAPH_IS_VALID_PTR(poseB))
         nodesB = GetEmptyNodes();
 
-    for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-    {
-        Transform::Lerp(nodesA->Nodes[i], nodesB->Nodes[i], alpha, nodes->Nodes[i]);
-    }
+    AnimGraphPose::Lerp(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
     Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
     nodes->Position = Math::Lerp(nodesA->Position, nodesB->Position, alpha);
     nodes->Length = Math::Lerp(nodesA->Length, nodesB->Length, alpha);
@@ -1020,10 +1005,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             if (!ANIM_GRAPH_IS_VALID_PTR(valueB))
                 nodesB = GetEmptyNodes();
 
-            for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-            {
-                Transform::Lerp(nodesA->Nodes[i], nodesB->Nodes[i], alpha, nodes->Nodes[i]);
-            }
+            AnimGraphPose::Lerp(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
             Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
             value = nodes;
         }
@@ -1059,17 +1041,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
                 const auto nodes = node->GetNodes(this);
                 const auto nodesA = static_cast<AnimGraphImpulse*>(valueA.AsPointer);
                 const auto nodesB = static_cast<AnimGraphImpulse*>(valueB.AsPointer);
-                Transform t, tA, tB;
-                for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-                {
-                    tA = nodesA->Nodes[i];
-                    tB = nodesB->Nodes[i];
-                    t.Translation = tA.Translation + tB.Translation;
-                    t.Orientation = tA.Orientation * tB.Orientation;
-                    t.Scale = tA.Scale * tB.Scale;
-                    t.Orientation.Normalize();
-                    Transform::Lerp(tA, t, alpha, nodes->Nodes[i]);
-                }
+                AnimGraphPose::BlendAdditive(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
                 Transform::Lerp(nodesA->RootMotion, nodesA->RootMotion + nodesB->RootMotion, alpha, nodes->RootMotion);
                 value = nodes;
             }
@@ -1103,21 +1075,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             const auto nodesB = static_cast<AnimGraphImpulse*>(valueB.AsPointer);
 
             // Blend all nodes masked by the user
-            Transform tA, tB;
-            auto& nodesMask = mask->GetNodesMask();
-            for (int32 nodeIndex = 0; nodeIndex < nodes->Nodes.Count(); nodeIndex++)
-            {
-                tA = nodesA->Nodes[nodeIndex];
-                if (nodesMask[nodeIndex])
-                {
-                    tB = nodesB->Nodes[nodeIndex];
-                    Transform::Lerp(tA, tB, alpha, nodes->Nodes[nodeIndex]);
-                }
-                else
-                {
-                    nodes->Nodes[nodeIndex] = tA;
-                }
-            }
+            AnimGraphPose::LerpMasked(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, mask->GetNodesMask(), nodes->Nodes.Get(), nodes->Nodes.Count());
             Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
 
             value = nodes;
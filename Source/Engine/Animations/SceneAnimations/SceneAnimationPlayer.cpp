@@ -25,6 +25,41 @@
 #define REGISTER_TICK GetScene()->Ticking.UPDATE_POINT.AddTick<SceneAnimationPlayer, &SceneAnimationPlayer::Tick>(this)
 #define UNREGISTER_TICK GetScene()->Ticking.UPDATE_POINT.RemoveTick(this)
 
+namespace
+{
+    // Finds the keyframe at time (checks the keyframe from the previous update and the next one first as the playback time moves forward by small steps)
+    int32 FindKeyframe(const byte* keyframes, int32 keyframeSize, int32 count, float time, int32& keyframeIndex)
+    {
+#define GET_KEY_TIME(idx) *(const float*)(keyframes + keyframeSize * (idx))
+        const float keyTime = Math::Clamp(time, 0.0f, GET_KEY_TIME(count - 1));
+        for (int32 key = Math::Max(keyframeIndex, 0); keyframeIndex >= 0 && key < count && key <= keyframeIndex + 1; key++)
+        {
+            if (keyTime < GET_KEY_TIME(key))
+                break;
+            if (key + 1 == count || keyTime < GET_KEY_TIME(key + 1))
+                return keyframeIndex = key;
+        }
+        int32 start = 0;
+        int32 searchLength = count;
+        while (searchLength > 0)
+        {
+            const int32 half = searchLength >> 1;
+            int32 mid = start + half;
+            if (keyTime < GET_KEY_TIME(mid))
+            {
+                searchLength = half;
+            }
+            else
+            {
+                start = mid + 1;
+                searchLength -= half + 1;
+            }
+        }
+#undef GET_KEY_TIME
+        return keyframeIndex = Math::Max(0, start - 1);
+    }
+}
+
 SceneAnimationPlayer::SceneAnimationPlayer(const SpawnParams& params)
     : Actor(params)
 {
@@ -377,26 +412,7 @@ bool SceneAnimationPlayer::TickPropertyTrack(int32 trackIndex, int32 stateIndexO
 
         // Find the keyframe at time
         int32 keyframeSize = sizeof(float) + trackDataKeyframes->ValueSize;
-#define GET_KEY_TIME(idx) *(float*)((byte*)trackDataKeyframes->Keyframes + keyframeSize * (idx))
-        const float keyTime = Math::Clamp(time, 0.0f, GET_KEY_TIME(count - 1));
-        int32 start = 0;
-        int32 searchLength = count;
-        while (searchLength > 0)
-        {
-            const int32 half = searchLength >> 1;
-            int32 mid = start + half;
-            if (keyTime < GET_KEY_TIME(mid))
-            {
-                searchLength = half;
-            }
-            else
-            {
-                start = mid + 1;
-                searchLength -= half + 1;
-            }
-        }
-        int32 leftKey = Math::Max(0, start - 1);
-#undef GET_KEY_TIME
+        const int32 leftKey = FindKeyframe((const byte*)trackDataKeyframes->Keyframes, keyframeSize, count, time, state.KeyframeIndex);
 
         // Return the value
         void* value = (void*)((byte*)trackDataKeyframes->Keyframes + keyframeSize * (leftKey) + sizeof(float));
@@ -432,7 +448,7 @@ bool SceneAnimationPlayer::TickPropertyTrack(int32 trackIndex, int32 stateIndexO
         CurveBase<valueType, BezierCurveKeyframe<valueType>> volumeCurve; \
         CurveBase<valueType, BezierCurveKeyframe<valueType>>::KeyFrameData data((BezierCurveKeyframe<valueType>*)trackDataKeyframes->Keyframes, trackDataKeyframes->KeyframesCount); \
         static_assert(sizeof(valueData) >= sizeof(valueType), "Invalid valueData size."); \
-        volumeCurve.Evaluate(data, *(valueType*)curveDst, time, false); \
+        volumeCurve.Evaluate(data, *(valueType*)curveDst, time, false, state.KeyframeIndex); \
         break; \
     }
         IMPL_CURVE(Float, float);
@@ -488,26 +504,7 @@ bool SceneAnimationPlayer::TickPropertyTrack(int32 trackIndex, int32 stateIndexO
         const auto keyframesValues = (Char**)((byte*)keyframesLengths + sizeof(int32) * trackDataKeyframes->KeyframesCount);
 
         // Find the keyframe at time
-#define GET_KEY_TIME(idx) keyframesTimes[idx]
-        const float keyTime = Math::Clamp(time, 0.0f, GET_KEY_TIME(count - 1));
-        int32 start = 0;
-        int32 searchLength = count;
-        while (searchLength > 0)
-        {
-            const int32 half = searchLength >> 1;
-            int32 mid = start + half;
-            if (keyTime < GET_KEY_TIME(mid))
-            {
-                searchLength = half;
-            }
-            else
-            {
-                start = mid + 1;
-                searchLength -= half + 1;
-            }
-        }
-        int32 leftKey = Math::Max(0, start - 1);
-#undef GET_KEY_TIME
+        const int32 leftKey = FindKeyframe((const byte*)keyframesTimes, sizeof(float), count, time, state.KeyframeIndex);
 
         // Return the value
         StringView str(keyframesValues[leftKey], keyframesLengths[leftKey]);
@@ -528,13 +525,13 @@ bool SceneAnimationPlayer::TickPropertyTrack(int32 trackIndex, int32 stateIndexO
             // Cache field
             if (!childTrackState.Field)
             {
-                MType* type = state.Property ? state.Property->GetType() : (state.Field ? state.Field->GetType() : nullptr);
-                if (!type)
+                if (!state.ValueType)
                     continue;
-                MClass* mclass = MCore::Type::GetClass(type);
+                MClass* mclass = MCore::Type::GetClass(state.ValueType);
                 childTrackState.Field = mclass->GetField(childTrackRuntimeData->PropertyName);
                 if (!childTrackState.Field)
                     continue;
+                childTrackState.ValueType = childTrackState.Field->GetType();
             }
 
             // Sample child track
@@ -870,7 +867,7 @@ void SceneAnimationPlayer::Tick(SceneAnimation* anim, float time, float dt, int3
             if (!instance)
                 break;
 
-            // Cache property or field
+            // Cache property or field (and its value type)
             if (!state.Property && !state.Field)
             {
                 MClass* mclass = MCore::Object::GetClass(instance);
@@ -883,11 +880,13 @@ void SceneAnimationPlayer::Tick(SceneAnimation* anim, float time, float dt, int3
                     if (!state.Field)
                         break;
                 }
+                state.ValueType = state.Property ? state.Property->GetType() : state.Field->GetType();
+                state.ValueSize = MCore::Type::GetSize(state.ValueType);
+                state.ValueIsPointer = MCore::Type::IsPointer(state.ValueType);
             }
 
             // Get stack memory for data value
-            MType* valueType = state.Property ? state.Property->GetType() : state.Field->GetType();
-            int32 valueSize = MCore::Type::GetSize(valueType);
+            const int32 valueSize = state.ValueSize;
             _tracksDataStack.AddDefault(valueSize);
             void* value = &_tracksDataStack[_tracksDataStack.Count() - valueSize];
 
@@ -905,7 +904,7 @@ void SceneAnimationPlayer::Tick(SceneAnimation* anim, float time, float dt, int3
                         MException ex(exception);
                         ex.Log(LogType::Error, TEXT("Property"));
                     }
-                    else if (!MCore::Type::IsPointer(valueType))
+                    else if (!state.ValueIsPointer)
                     {
                         if (boxed)
                             Platform::MemoryCopy(value, MCore::Object::Unbox(boxed), valueSize);
@@ -956,7 +955,7 @@ void SceneAnimationPlayer::Tick(SceneAnimation* anim, float time, float dt, int3
             if (TickPropertyTrack(j, stateIndexOffset, anim, time, track, state, value))
             {
                 // Set the value
-                if (MCore::Type::IsPointer(valueType))
+                if (state.ValueIsPointer)
                     value = (void*)*(intptr*)value;
                 if (state.Property)
                 {
@@ -47,7 +47,11 @@ class FLAXENGINE_API SceneAnimationPlayer : public Actor, public IPostFxSettings
         MProperty* Property = nullptr;
         MField* Field = nullptr;
         MMethod* Method = nullptr;
+        MType* ValueType = nullptr;
+        int32 ValueSize = 0;
+        bool ValueIsPointer = false;
         int32 RestoreStateIndex = -1;
+        int32 KeyframeIndex = -1;
         bool Warn = true;
 
         TrackInstance()
@@ -3,15 +3,20 @@
 #include "Audio.h"
 #include "AudioBackend.h"
 #include "AudioSettings.h"
+#include "AudioSource.h"
+#include "AudioClip.h"
 #include "FlaxEngine.Gen.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/BinaryModule.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/CommandLine.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Core/Collections/Sorting.h"
 #if AUDIO_API_NONE
 #include "None/AudioBackendNone.h"
 #endif
@@ -38,6 +43,7 @@ float AudioDataInfo::GetLength() const
 
 Array<AudioListener*> Audio::Listeners;
 Array<AudioSource*> Audio::Sources;
+float Audio::StreamingDecodeAhead = 2.0f;
 Array<AudioDevice> Audio::Devices;
 Action Audio::DevicesChanged;
 Action Audio::ActiveDeviceChanged;
@@ -50,6 +56,26 @@ namespace
     int32 ActiveDeviceIndex = -1;
     bool MuteOnFocusLoss = true;
     bool EnableHRTF = true;
+    int32 MaxRealVoices = 64;
+    float VirtualizationThreshold = 0.001f;
+
+    struct VoiceCandidate
+    {
+        AudioSource* Source;
+        int32 Priority;
+        float Audibility;
+        bool IsReal;
+
+        bool operator<(const VoiceCandidate& other) const
+        {
+            // Higher priority and louder sources first
+            if (Priority != other.Priority)
+                return Priority > other.Priority;
+            return Audibility > other.Audibility;
+        }
+    };
+
+    Array<VoiceCandidate> VoiceCandidates;
 }
 
 class AudioService : public EngineService
@@ -79,11 +105,53 @@ namespace
     {
         AudioBackend::SetVolume(Volume);
     }
+
+    void UpdateVoices()
+    {
+        if (Audio::Listeners.IsEmpty())
+            return;
+        PROFILE_CPU();
+        const float dt = Time::Update.UnscaledDeltaTime.GetTotalSeconds();
+
+        // Gather playing sources
+        VoiceCandidates.Clear();
+        for (AudioSource* source : Audio::Sources)
+        {
+            if (source->GetState() != AudioSource::States::Playing || !source->Clip || !source->Clip->IsLoaded())
+                continue;
+            source->UpdateVirtual(dt);
+            if (source->GetState() != AudioSource::States::Playing)
+                continue;
+            VoiceCandidates.Add({ source, source->GetPriority(), source->GetAudibility(), false });
+        }
+        Sorting::QuickSort(VoiceCandidates.Get(), VoiceCandidates.Count());
+
+        // Pick the sources that use the real voices (virtualize others first to release voices before restoring the audible ones)
+        const int32 maxRealVoices = MaxRealVoices > 0 ? MaxRealVoices : MAX_int32;
+        int32 realVoices = 0;
+        for (VoiceCandidate& e : VoiceCandidates)
+        {
+            e.IsReal = e.Audibility >= VirtualizationThreshold && realVoices < maxRealVoices;
+            if (e.IsReal)
+                realVoices++;
+            else
+                e.Source->Virtualize();
+        }
+        for (const VoiceCandidate& e : VoiceCandidates)
+        {
+            if (e.IsReal)
+                e.Source->Devirtualize();
+        }
+    }
 }
 
 void AudioSettings::Apply()
 {
     ::MuteOnFocusLoss = MuteOnFocusLoss;
+    ::MaxRealVoices = MaxRealVoices;
+    ::VirtualizationThreshold = VirtualizationThreshold;
+    Audio::StreamingDecodeAhead = StreamingDecodeAhead;
+    AudioMixer::SetBuses(Buses);
     if (AudioBackend::Instance != nullptr)
     {
         Audio::SetDopplerFactor(DopplerFactor);
@@ -248,6 +316,7 @@ bool AudioService::Init()
 void AudioService::Update()
 {
     PROFILE_CPU_NAMED("Audio.Update");
+    PROFILE_MEM(Audio);
 
     // Update the master volume
     float masterVolume = MasterVolume;
@@ -262,6 +331,9 @@ void AudioService::Update()
         AudioBackend::SetVolume(masterVolume);
     }
 
+    AudioMixer::Update(Time::Update.UnscaledDeltaTime.GetTotalSeconds());
+    UpdateVoices();
+
     AudioBackend::Update();
 }
 
@@ -278,4 +350,5 @@ void AudioService::Dispose()
         AudioBackend::Instance = nullptr;
     }
     ActiveDeviceIndex = -1;
+    VoiceCandidates.Resize(0);
 }
@@ -28,6 +28,11 @@ API_CLASS(Static) class FLAXENGINE_API Audio
     /// </summary>
     static Array<AudioSource*> Sources;
 
+    /// <summary>
+    /// The time (in seconds) of the audio data to decode ahead of the current playback position of the streamed audio clips (see AudioSettings).
+    /// </summary>
+    static float StreamingDecodeAhead;
+
     /// <summary>
     /// The all audio devices.
     /// </summary>
@@ -88,6 +88,7 @@ AudioClip::AudioClip(const SpawnParams& params, const AssetInfo* info)
     , _totalChunks(0)
     , _totalChunksSize(0)
     , _streamingTask(nullptr)
+    , _prefetchEndTime(0.0)
 {
     Platform::MemoryClear(&AudioHeader, sizeof(AudioHeader));
     Platform::MemoryClear(&_buffersStartTimes, sizeof(_buffersStartTimes));
@@ -143,6 +144,18 @@ int32 AudioClip::GetFirstBufferIndex(float time, float& offset) const
     return 0;
 }
 
+void AudioClip::Prefetch(float duration)
+{
+    ScopeLock lock(Locker);
+    _prefetchEndTime = Math::Max(_prefetchEndTime, Platform::GetTimeSeconds() + (double)duration);
+    RequestStreamingUpdate();
+}
+
+bool AudioClip::IsPrefetched() const
+{
+    return _prefetchEndTime > Platform::GetTimeSeconds();
+}
+
 bool AudioClip::ExtractData(Array<byte>& resultData, AudioDataInfo& resultDataInfo)
 {
     ASSERT(!IsVirtual());
@@ -71,6 +71,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
     int32 _totalChunks;
     int32 _totalChunksSize;
     StreamingTask* _streamingTask;
+    double _prefetchEndTime;
     float _buffersStartTimes[ASSET_FILE_DATA_CHUNKS + 1];
 
 public:
@@ -160,6 +161,18 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
     /// <returns>The buffer index.</returns>
     int32 GetFirstBufferIndex(float time, float& offset) const;
 
+public:
+    /// <summary>
+    /// Prefetches the beginning of the audio clip data so the audio source can start playing it without waiting for the data streaming (eg. for one-shot sounds that are likely to be played soon). Keeps the first chunk decoded and resident in memory for the given time. Clips that don't use streaming have whole data loaded at once so it does nothing for them.
+    /// </summary>
+    /// <param name="duration">The time (in seconds) to keep the first chunk resident in memory.</param>
+    API_FUNCTION() void Prefetch(float duration = 10.0f);
+
+    /// <summary>
+    /// Returns true if the first chunk of the audio clip data is requested to be kept resident in memory (via Prefetch).
+    /// </summary>
+    API_PROPERTY() bool IsPrefetched() const;
+
 public:
     /// <summary>
     /// Extracts the source audio data from the asset storage. Loads the whole asset. The result data is in an asset format.
@@ -0,0 +1,159 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "AudioMixer.h"
+#include "Audio.h"
+#include "AudioSource.h"
+#include "AudioBackend.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+namespace
+{
+    struct AudioBus
+    {
+        AudioBusSettings Settings;
+        float Volume;
+        float Ducking;
+        float ManualDuckingVolume;
+        float ManualDuckingTime;
+        float Gain;
+        int32 PlayingSources;
+        bool GainChanged;
+    };
+
+    Array<AudioBus> Buses;
+}
+
+int32 AudioMixer::GetBusesCount()
+{
+    return Buses.Count();
+}
+
+int32 AudioMixer::GetBusIndex(const StringView& name)
+{
+    for (int32 i = 0; i < Buses.Count(); i++)
+    {
+        if (Buses[i].Settings.Name == name)
+            return i;
+    }
+    return -1;
+}
+
+float AudioMixer::GetBusVolume(int32 bus)
+{
+    return bus >= 0 && bus < Buses.Count() ? Buses[bus].Volume : 1.0f;
+}
+
+void AudioMixer::SetBusVolume(int32 bus, float volume)
+{
+    if (bus >= 0 && bus < Buses.Count())
+        Buses[bus].Volume = Math::Saturate(volume);
+}
+
+float AudioMixer::GetBusGain(int32 bus)
+{
+    return bus >= 0 && bus < Buses.Count() ? Buses[bus].Gain : 1.0f;
+}
+
+void AudioMixer::DuckBus(int32 bus, float volume, float duration)
+{
+    if (bus < 0 || bus >= Buses.Count())
+        return;
+    AudioBus& e = Buses[bus];
+    e.ManualDuckingVolume = Math::Saturate(volume);
+    e.ManualDuckingTime = Math::Max(duration, 0.0f);
+}
+
+void AudioMixer::SetBuses(const Array<AudioBusSettings>& buses)
+{
+    Buses.Resize(buses.Count());
+    for (int32 i = 0; i < buses.Count(); i++)
+    {
+        AudioBus& e = Buses[i];
+        e.Settings = buses[i];
+        e.Volume = Math::Saturate(e.Settings.Volume);
+        e.Ducking = 1.0f;
+        e.ManualDuckingVolume = 1.0f;
+        e.ManualDuckingTime = 0.0f;
+        e.Gain = -1.0f;
+        e.PlayingSources = 0;
+        e.GainChanged = false;
+    }
+
+    Update(0.0f);
+
+    // Update the volume of all sources that use buses (bus might be removed)
+    if (AudioBackend::Instance)
+    {
+        for (AudioSource* source : Audio::Sources)
+        {
+            if (source->GetBus() >= 0 && source->SourceIDs.HasItems())
+                AudioBackend::Source::VolumeChanged(source);
+        }
+    }
+}
+
+void AudioMixer::Update(float dt)
+{
+    if (Buses.IsEmpty())
+        return;
+    PROFILE_CPU();
+
+    // Count the playing sources per bus (used by ducking)
+    for (AudioBus& e : Buses)
+        e.PlayingSources = 0;
+    for (const AudioSource* source : Audio::Sources)
+    {
+        const int32 bus = source->GetBus();
+        if (bus >= 0 && bus < Buses.Count() && source->GetState() == AudioSource::States::Playing)
+            Buses[bus].PlayingSources++;
+    }
+
+    // Update ducking
+    for (AudioBus& e : Buses)
+    {
+        const AudioBusSettings& settings = e.Settings;
+        float target = 1.0f;
+        if (settings.DuckedBy >= 0 && settings.DuckedBy < Buses.Count() && Buses[settings.DuckedBy].PlayingSources != 0)
+            target = settings.DuckingVolume;
+        if (e.ManualDuckingTime > 0.0f)
+        {
+            target = Math::Min(target, e.ManualDuckingVolume);
+            e.ManualDuckingTime -= dt;
+        }
+        const float fadeTime = target < e.Ducking ? settings.DuckingAttack : settings.DuckingRelease;
+        const float step = fadeTime > ZeroTolerance ? dt / fadeTime : 1.0f;
+        e.Ducking += Math::Clamp(target - e.Ducking, -step, step);
+    }
+
+    // Update gains (walk up the parent buses, limited to the buses count to prevent cycles)
+    bool anyChanged = false;
+    for (AudioBus& e : Buses)
+    {
+        float gain = e.Volume * e.Ducking;
+        int32 parent = e.Settings.Parent;
+        for (int32 depth = 0; depth < Buses.Count() && parent >= 0 && parent < Buses.Count(); depth++)
+        {
+            const AudioBus& p = Buses[parent];
+            gain *= p.Volume * p.Ducking;
+            parent = p.Settings.Parent;
+        }
+        e.GainChanged = Math::NotNearEqual(e.Gain, gain);
+        if (e.GainChanged)
+        {
+            e.Gain = gain;
+            anyChanged = true;
+        }
+    }
+
+    // Update the sources volume
+    if (anyChanged && AudioBackend::Instance)
+    {
+        for (AudioSource* source : Audio::Sources)
+        {
+            const int32 bus = source->GetBus();
+            if (bus >= 0 && bus < Buses.Count() && Buses[bus].GainChanged && source->SourceIDs.HasItems())
+                AudioBackend::Source::VolumeChanged(source);
+        }
+    }
+}
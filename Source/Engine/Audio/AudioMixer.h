@@ -0,0 +1,122 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The audio mixer bus (submix) configuration. Audio sources assigned to the bus are mixed with the bus volume (and the volume of its parent buses) applied on top of the source volume.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API AudioBusSettings : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(AudioBusSettings);
+
+    /// <summary>
+    /// The bus name.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0)")
+    String Name;
+
+    /// <summary>
+    /// The index of the parent bus that this bus outputs to. Use -1 to output directly to the master.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), DefaultValue(-1)")
+    int32 Parent = -1;
+
+    /// <summary>
+    /// The bus volume, in [0, 1] range.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), DefaultValue(1.0f), Limit(0, 1, 0.01f)")
+    float Volume = 1.0f;
+
+    /// <summary>
+    /// The index of the bus that ducks this bus (lowers its volume) while it has any playing audio source (eg. music ducked by the dialogue). Use -1 to disable ducking.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), DefaultValue(-1), EditorDisplay(\"Ducking\")")
+    int32 DuckedBy = -1;
+
+    /// <summary>
+    /// The volume scale of the bus when it's ducked, in [0, 1] range.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), DefaultValue(0.3f), Limit(0, 1, 0.01f), EditorDisplay(\"Ducking\")")
+    float DuckingVolume = 0.3f;
+
+    /// <summary>
+    /// The time (in seconds) to fade the bus volume down when ducking starts.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(50), DefaultValue(0.1f), Limit(0), EditorDisplay(\"Ducking\")")
+    float DuckingAttack = 0.1f;
+
+    /// <summary>
+    /// The time (in seconds) to fade the bus volume back up when ducking ends.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(60), DefaultValue(0.5f), Limit(0), EditorDisplay(\"Ducking\")")
+    float DuckingRelease = 0.5f;
+};
+
+/// <summary>
+/// The engine audio mixer that manages the buses (submixes) used by the audio sources for the grouped volume control and ducking.
+/// </summary>
+API_CLASS(Static) class FLAXENGINE_API AudioMixer
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(AudioMixer);
+
+public:
+    /// <summary>
+    /// Gets the amount of the mixer buses.
+    /// </summary>
+    API_PROPERTY() static int32 GetBusesCount();
+
+    /// <summary>
+    /// Finds the bus with the given name.
+    /// </summary>
+    /// <param name="name">The bus name.</param>
+    /// <returns>The bus index or -1 if missing.</returns>
+    API_FUNCTION() static int32 GetBusIndex(const StringView& name);
+
+    /// <summary>
+    /// Gets the volume of the bus, in [0, 1] range.
+    /// </summary>
+    /// <param name="bus">The bus index.</param>
+    /// <returns>The bus volume.</returns>
+    API_FUNCTION() static float GetBusVolume(int32 bus);
+
+    /// <summary>
+    /// Sets the volume of the bus, in [0, 1] range.
+    /// </summary>
+    /// <param name="bus">The bus index.</param>
+    /// <param name="volume">The bus volume.</param>
+    API_FUNCTION() static void SetBusVolume(int32 bus, float volume);
+
+    /// <summary>
+    /// Gets the final gain of the bus (volume with ducking and the gain of the parent buses applied). Returns 1 for invalid bus index.
+    /// </summary>
+    /// <param name="bus">The bus index.</param>
+    /// <returns>The bus gain.</returns>
+    API_FUNCTION() static float GetBusGain(int32 bus);
+
+    /// <summary>
+    /// Ducks the bus (lowers its volume) for the given time. Uses the bus ducking attack and release times.
+    /// </summary>
+    /// <param name="bus">The bus index.</param>
+    /// <param name="volume">The volume scale of the ducked bus, in [0, 1] range.</param>
+    /// <param name="duration">The ducking duration (in seconds).</param>
+    API_FUNCTION() static void DuckBus(int32 bus, float volume, float duration);
+
+public:
+    /// <summary>
+    /// Setups the mixer buses (from the audio settings). Resets the buses volume and ducking state.
+    /// </summary>
+    /// <param name="buses">The buses configuration.</param>
+    static void SetBuses(const Array<AudioBusSettings>& buses);
+
+    /// <summary>
+    /// Updates the buses ducking and gains. Notifies the audio sources about the gain changes. Called by the audio service.
+    /// </summary>
+    /// <param name="dt">The delta time (in seconds).</param>
+    static void Update(float dt);
+};
@@ -4,6 +4,7 @@
 
 #include "Engine/Core/Config/Settings.h"
 #include "Engine/Serialization/Serialization.h"
+#include "AudioMixer.h"
 
 /// <summary>
 /// Audio settings container.
@@ -38,6 +39,30 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(300), DefaultValue(true), EditorDisplay(\"Spatial Audio\")")
     bool EnableHRTF = true;
 
+    /// <summary>
+    /// The maximum amount of the playing audio sources that use a real voice (for mixing). Sources over the limit with the lowest priority and audibility are virtualized (keep playing in time without a voice). Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(400), DefaultValue(64), Limit(0, 4096), EditorDisplay(\"Voices\", \"Max Real Voices\")")
+    int32 MaxRealVoices = 64;
+
+    /// <summary>
+    /// The audibility (source volume after distance attenuation) below which the playing audio sources are virtualized (keep playing in time without a voice until they become audible again). Use 0 to disable it.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(410), DefaultValue(0.001f), Limit(0, 1, 0.0001f), EditorDisplay(\"Voices\")")
+    float VirtualizationThreshold = 0.001f;
+
+    /// <summary>
+    /// The time (in seconds) of the audio data to decode ahead of the current playback position of the streamed audio clips. Larger values reduce the risk of the playback stalls when streaming is busy but use more memory.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(500), DefaultValue(2.0f), Limit(0, 30, 0.1f), EditorDisplay(\"Streaming\", \"Streaming Decode Ahead\")")
+    float StreamingDecodeAhead = 2.0f;
+
+    /// <summary>
+    /// The audio mixer buses (submixes) configuration. Audio sources output to the bus by its index in this list.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(600), EditorDisplay(\"Mixer\", EditorDisplayAttribute.InlineStyle)")
+    Array<AudioBusSettings> Buses;
+
 public:
     /// <summary>
     /// Gets the instance of the settings asset (default value if missing). Object returned by this method is always loaded with valid data to use.
@@ -53,5 +78,9 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
         DESERIALIZE(DopplerFactor);
         DESERIALIZE(MuteOnFocusLoss);
         DESERIALIZE(EnableHRTF);
+        DESERIALIZE(MaxRealVoices);
+        DESERIALIZE(VirtualizationThreshold);
+        DESERIALIZE(StreamingDecodeAhead);
+        DESERIALIZE(Buses);
     }
 };
@@ -8,8 +8,11 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/Threading.h"
 #include "AudioBackend.h"
+#include "AudioListener.h"
 #include "Audio.h"
+#include "AudioMixer.h"
 
 AudioSource::AudioSource(const SpawnParams& params)
     : Actor(params)
@@ -110,6 +113,26 @@ void AudioSource::SetAllowSpatialization(bool value)
         AudioBackend::Source::SpatialSetupChanged(this);
 }
 
+void AudioSource::SetPriority(int32 value)
+{
+    _priority = value;
+}
+
+void AudioSource::SetBus(int32 value)
+{
+    value = Math::Max(value, -1);
+    if (_bus == value)
+        return;
+    _bus = value;
+    if (SourceIDs.HasItems())
+        AudioBackend::Source::VolumeChanged(this);
+}
+
+float AudioSource::GetOutputVolume() const
+{
+    return _volume * AudioMixer::GetBusGain(_bus);
+}
+
 void AudioSource::Play()
 {
     auto state = _state;
@@ -121,6 +144,13 @@ void AudioSource::Play()
         return;
     }
 
+    // Virtualized source resumes without a voice (audio manager restores it when audible)
+    if (_isVirtual)
+    {
+        _state = States::Playing;
+        return;
+    }
+
     _state = States::Playing;
     _isActuallyPlayingSth = false;
 
@@ -144,6 +174,14 @@ void AudioSource::Play()
             // If we are looping and streaming also update streaming buffers
             if (_loop || state == States::Stopped)
                 RequestStreamingBuffersUpdate();
+
+            // Start right away if the clip data is already resident (eg. prefetched one-shot sound)
+            if (_needToUpdateStreamingBuffers && SourceIDs.HasItems())
+            {
+                ScopeLock lock(Clip->Locker);
+                if (Clip->Buffers.HasItems() && Clip->Buffers[_streamingFirstChunk] != AUDIO_BUFFER_ID_INVALID)
+                    SubmitStreamingBuffers();
+            }
         }
     }
     else
@@ -161,7 +199,7 @@ void AudioSource::Pause()
 
     _state = States::Paused;
 
-    if (_isActuallyPlayingSth)
+    if (_isActuallyPlayingSth && !_isVirtual)
     {
         AudioBackend::Source::Pause(this);
         _isActuallyPlayingSth = false;
@@ -177,12 +215,23 @@ void AudioSource::Stop()
     _isActuallyPlayingSth = false;
     _streamingFirstChunk = 0;
 
-    if (SourceIDs.HasItems())
+    if (_isVirtual)
+    {
+        // Restore the voice for the stopped source
+        _virtualTime = 0.0f;
+        _isVirtual = false;
+        _savedState = States::Stopped;
+        _savedTime = 0.0f;
+        AudioBackend::Source::OnAdd(this);
+    }
+    else if (SourceIDs.HasItems())
         AudioBackend::Source::Stop(this);
 }
 
 float AudioSource::GetTime() const
 {
+    if (_isVirtual)
+        return _virtualTime;
     if (_state == States::Stopped || SourceIDs.IsEmpty())
         return 0.0f;
 
@@ -206,6 +255,11 @@ void AudioSource::SetTime(float time)
 {
     if (_state == States::Stopped)
         return;
+    if (_isVirtual)
+    {
+        _virtualTime = Math::Clamp(time, 0.0f, Clip->GetLength());
+        return;
+    }
 
     const bool isActuallyPlayingSth = _isActuallyPlayingSth;
     const auto state = _state;
@@ -249,10 +303,68 @@ void AudioSource::RequestStreamingBuffersUpdate()
     _needToUpdateStreamingBuffers = true;
 }
 
+float AudioSource::GetAudibility() const
+{
+    float audibility = GetOutputVolume();
+    if (!Is3D())
+        return audibility;
+
+    // Match the inverse distance clamped attenuation model used by the backends
+    float distanceSq = MAX_float;
+    const Vector3 position = GetPosition();
+    for (const AudioListener* listener : Audio::Listeners)
+        distanceSq = Math::Min(distanceSq, (float)Vector3::DistanceSquared(position, listener->GetPosition()));
+    const float distance = Math::Sqrt(distanceSq);
+    if (_minDistance > 0.0f && distance > _minDistance)
+        audibility *= _minDistance / (_minDistance + _attenuation * (distance - _minDistance));
+    return audibility;
+}
+
+void AudioSource::Virtualize()
+{
+    if (_isVirtual)
+        return;
+    const States state = _state;
+    const float time = GetTime();
+    Cleanup();
+    _state = state;
+    _virtualTime = time;
+    _isVirtual = true;
+}
+
+void AudioSource::Devirtualize()
+{
+    if (!_isVirtual)
+        return;
+    _isVirtual = false;
+
+    // Backend creates the voice and restores the saved playback state
+    _savedState = _state;
+    _savedTime = _virtualTime;
+    _state = States::Stopped;
+    AudioBackend::Source::OnAdd(this);
+}
+
+void AudioSource::UpdateVirtual(float dt)
+{
+    if (!_isVirtual || _state != States::Playing)
+        return;
+    _virtualTime += dt * _pitch;
+    const float length = Clip->GetLength();
+    if (_virtualTime >= length)
+    {
+        if (_loop && length > ZeroTolerance)
+            _virtualTime = Math::Mod(_virtualTime, length);
+        else
+            Stop();
+    }
+}
+
 void AudioSource::Cleanup()
 {
     _savedState = GetState();
     _savedTime = GetTime();
+    _isVirtual = false;
     Stop();
 
     if (SourceIDs.HasItems())
@@ -269,6 +381,9 @@ void AudioSource::OnClipChanged()
 
 void AudioSource::OnClipLoaded()
 {
+    // Virtualized source gets the voice from the audio manager
+    if (_isVirtual)
+        return;
     AudioBackend::Source::ClipLoaded(this);
 
     // Start playing if source was waiting for the clip to load
@@ -356,6 +471,8 @@ void AudioSource::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(Loop, _loop);
     SERIALIZE_MEMBER(PlayOnStart, _playOnStart);
     SERIALIZE_MEMBER(AllowSpatialization, _allowSpatialization);
+    SERIALIZE_MEMBER(Priority, _priority);
+    SERIALIZE_MEMBER(Bus, _bus);
 }
 
 void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -372,6 +489,8 @@ void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE_MEMBER(Loop, _loop);
     DESERIALIZE_MEMBER(PlayOnStart, _playOnStart);
     DESERIALIZE_MEMBER(AllowSpatialization, _allowSpatialization);
+    DESERIALIZE_MEMBER(Priority, _priority);
+    DESERIALIZE_MEMBER(Bus, _bus);
     DESERIALIZE(Clip);
 }
 
@@ -385,6 +504,35 @@ bool AudioSource::IntersectsItself(const Ray& ray, Real& distance, Vector3& norm
     return false;
 }
 
+void AudioSource::SubmitStreamingBuffers()
+{
+    auto clip = Clip.Get();
+
+    // Get buffers in a queue count
+    int32 numQueuedBuffers;
+    AudioBackend::Source::GetQueuedBuffersCount(this, numQueuedBuffers);
+
+    // Queue missing buffers
+    uint32 bufferId;
+    if (numQueuedBuffers < 1 && (bufferId = clip->Buffers[_streamingFirstChunk]) != AUDIO_BUFFER_ID_INVALID)
+    {
+        AudioBackend::Source::QueueBuffer(this, bufferId);
+    }
+    if (numQueuedBuffers < 2 && _streamingFirstChunk + 1 < clip->Buffers.Count() && (bufferId = clip->Buffers[_streamingFirstChunk + 1]) != AUDIO_BUFFER_ID_INVALID)
+    {
+        AudioBackend::Source::QueueBuffer(this, bufferId);
+    }
+
+    // Clear flag
+    _needToUpdateStreamingBuffers = false;
+
+    // Play it if need to
+    if (!_isActuallyPlayingSth)
+    {
+        PlayInternal();
+    }
+}
+
 void AudioSource::Update()
 {
     PROFILE_CPU();
@@ -395,7 +543,7 @@ void AudioSource::Update()
     const auto prevVelocity = _velocity;
     _velocity = (pos - _prevPos) / dt;
     _prevPos = pos;
-    if (_velocity != prevVelocity)
+    if (_velocity != prevVelocity && SourceIDs.HasItems())
     {
         AudioBackend::Source::VelocityChanged(this);
     }
@@ -409,29 +557,7 @@ void AudioSource::Update()
     // Handle streaming buffers queue submit (ensure that clip has loaded the first chunk with audio data)
     if (_needToUpdateStreamingBuffers && clip->Buffers[_streamingFirstChunk] != AUDIO_BUFFER_ID_INVALID)
     {
-        // Get buffers in a queue count
-        int32 numQueuedBuffers;
-        AudioBackend::Source::GetQueuedBuffersCount(this, numQueuedBuffers);
-
-        // Queue missing buffers
-        uint32 bufferId;
-        if (numQueuedBuffers < 1 && (bufferId = clip->Buffers[_streamingFirstChunk]) != AUDIO_BUFFER_ID_INVALID)
-        {
-            AudioBackend::Source::QueueBuffer(this, bufferId);
-        }
-        if (numQueuedBuffers < 2 && _streamingFirstChunk + 1 < clip->Buffers.Count() && (bufferId = clip->Buffers[_streamingFirstChunk + 1]) != AUDIO_BUFFER_ID_INVALID)
-        {
-            AudioBackend::Source::QueueBuffer(this, bufferId);
-        }
-
-        // Clear flag
-        _needToUpdateStreamingBuffers = false;
-
-        // Play it if need to
-        if (!_isActuallyPlayingSth)
-        {
-            PlayInternal();
-        }
+        SubmitStreamingBuffers();
     }
 
     // Track the current buffer index via processed buffers gather
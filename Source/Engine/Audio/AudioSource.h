@@ -53,8 +53,12 @@ class FLAXENGINE_API AudioSource : public Actor
     bool _loop;
     bool _playOnStart;
     bool _allowSpatialization;
+    int32 _priority = 0;
+    int32 _bus = -1;
 
     bool _isActuallyPlayingSth = false;
+    bool _isVirtual = false;
+    float _virtualTime = 0.0f;
     bool _needToUpdateStreamingBuffers = false;
     States _state = States::Stopped;
 
@@ -208,6 +212,39 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     API_PROPERTY() void SetAllowSpatialization(bool value);
 
+    /// <summary>
+    /// Gets the playback priority. Sources with higher priority get a real voice first when the amount of playing sources exceeds the voices limit (see AudioSettings.MaxRealVoices).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(90), DefaultValue(0), EditorDisplay(\"Audio Source\")")
+    FORCE_INLINE int32 GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets the playback priority. Sources with higher priority get a real voice first when the amount of playing sources exceeds the voices limit (see AudioSettings.MaxRealVoices).
+    /// </summary>
+    API_PROPERTY() void SetPriority(int32 value);
+
+    /// <summary>
+    /// Gets the index of the audio mixer bus that this source outputs to (see AudioSettings.Buses). Use -1 to output directly to the master.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(100), DefaultValue(-1), EditorDisplay(\"Audio Source\")")
+    FORCE_INLINE int32 GetBus() const
+    {
+        return _bus;
+    }
+
+    /// <summary>
+    /// Sets the index of the audio mixer bus that this source outputs to (see AudioSettings.Buses). Use -1 to output directly to the master.
+    /// </summary>
+    API_PROPERTY() void SetBus(int32 value);
+
+    /// <summary>
+    /// Gets the output volume of the source (source volume with the mixer bus gain applied). Used by the audio backends.
+    /// </summary>
+    float GetOutputVolume() const;
+
 public:
     /// <summary>
     /// Starts playing the currently assigned audio clip.
@@ -267,6 +304,35 @@ class FLAXENGINE_API AudioSource : public Actor
         return _isActuallyPlayingSth;
     }
 
+    /// <summary>
+    /// Determines whether this audio source is virtualized (playing or paused without a real voice, eg. when not audible or over the voices limit).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsVirtual() const
+    {
+        return _isVirtual;
+    }
+
+    /// <summary>
+    /// Calculates the audibility of the source (volume after the distance attenuation to the closest listener).
+    /// </summary>
+    float GetAudibility() const;
+
+    /// <summary>
+    /// Releases the voice of the playing source and continues playback virtually.
+    /// </summary>
+    void Virtualize();
+
+    /// <summary>
+    /// Restores the voice of the virtualized source and continues playback from the virtual time.
+    /// </summary>
+    void Devirtualize();
+
+    /// <summary>
+    /// Advances the playback time of the virtualized source.
+    /// </summary>
+    /// <param name="dt">The delta time (in seconds).</param>
+    void UpdateVirtual(float dt);
+
     /// <summary>
     /// Requests the audio streaming buffers update. Rises tha flag to synchronize audio backend buffers of the emitter during next game logic update.
     /// </summary>
@@ -291,6 +357,11 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     void PlayInternal();
 
+    /// <summary>
+    /// Queues the resident streaming buffers of the clip into the source and starts the playback if needed. Called with the clip locker taken.
+    /// </summary>
+    void SubmitStreamingBuffers();
+
     void Update();
 
 public:
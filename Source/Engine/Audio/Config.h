@@ -18,3 +18,6 @@
 
 // The buffer ID that is invalid (unused)
 #define AUDIO_BUFFER_ID_INVALID 0
+
+// The maximum amount of audio clip chunks decoded ahead of the current playback position of the streaming audio source
+#define AUDIO_MAX_DECODE_AHEAD_CHUNKS 2
@@ -139,7 +139,7 @@ namespace ALC
             ALC_FOR_EACH_CONTEXT()
                 const uint32 sourceID = source->SourceIDs[i];
 
-                alSourcef(sourceID, AL_GAIN, source->GetVolume());
+                alSourcef(sourceID, AL_GAIN, source->GetOutputVolume());
                 alSourcef(sourceID, AL_PITCH, source->GetPitch());
                 alSourcef(sourceID, AL_SEC_OFFSET, 0.0f);
                 alSourcei(sourceID, AL_LOOPING, loop);
@@ -385,7 +385,7 @@ void AudioBackendOAL::Source_VolumeChanged(AudioSource* source)
 {
     ALC_FOR_EACH_CONTEXT()
         const uint32 sourceID = source->SourceIDs[i];
-        alSourcef(sourceID, AL_GAIN, source->GetVolume());
+        alSourcef(sourceID, AL_GAIN, source->GetOutputVolume());
     }
 }
 
@@ -409,7 +409,7 @@ void AudioBackendXAudio2::Source_OnAdd(AudioSource* source)
     aSource->DopplerFactor = source->GetDopplerFactor();
     aSource->UpdateTransform(source);
     aSource->UpdateVelocity(source);
-    aSource->Voice->SetVolume(source->GetVolume());
+    aSource->Voice->SetVolume(source->GetOutputVolume());
 
     // 0 is invalid ID so shift them
     sourceID++;
@@ -450,7 +450,7 @@ void AudioBackendXAudio2::Source_VolumeChanged(AudioSource* source)
     auto aSource = XAudio2::GetSource(source);
     if (aSource && aSource->Voice)
     {
-        aSource->Voice->SetVolume(source->GetVolume());
+        aSource->Voice->SetVolume(source->GetOutputVolume());
     }
 }
 
@@ -18,6 +18,10 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Utilities/Crc.h"
+#include "Engine/Core/Collections/HashSet.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
@@ -33,9 +37,20 @@ struct BuildData;
 
 namespace CSGBuilderImpl
 {
+    // Built brush geometry cached between the builds to skip rebuilding unmodified brushes.
+    struct CachedBrush
+    {
+        Scene* BrushScene;
+        uint32 Hash;
+        CSG::Mesh* Mesh;
+    };
+
     Array<Scene*> ScenesToRebuild;
+    Dictionary<Guid, CachedBrush> BrushesCache;
+    Dictionary<Scene*, uint32> ScenesBuildHash;
 
     void onSceneUnloading(Scene* scene, const Guid& sceneId);
+    bool buildMeshes(Scene* scene, BuildData& data);
     bool buildInner(Scene* scene, BuildData& data);
     void build(Scene* scene);
     bool generateRawDataAsset(Scene* scene, RawData& meshData, Guid& assetId, const String& assetPath);
@@ -63,6 +78,15 @@ void CSGBuilderImpl::onSceneUnloading(Scene* scene, const Guid& sceneId)
 {
     // Ensure to remove scene (prevent crashes)
     ScenesToRebuild.Remove(scene);
+    ScenesBuildHash.Remove(scene);
+    for (auto i = BrushesCache.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Value.BrushScene == scene)
+        {
+            Delete(i->Value.Mesh);
+            BrushesCache.Remove(i);
+        }
+    }
 }
 
 bool CSGBuilderService::Init()
@@ -120,7 +144,7 @@ namespace CSG
 {
     typedef Dictionary<Actor*, Mesh*> MeshesLookup;
 
-    bool walkTree(Actor* actor, MeshesArray& meshes, MeshesLookup& cache)
+    bool walkTree(Actor* actor, MeshesArray& meshes, MeshesLookup& cache, Array<Brush*>& brushes)
     {
         // Check if actor is a brush
         auto brush = dynamic_cast<Brush*>(actor);
@@ -132,13 +156,13 @@ namespace CSG
                 // Skip subtract/common meshes from the beginning (they have no effect)
                 if (meshes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
                 {
-                    // Create new mesh and build for given brush
+                    // Create new mesh for given brush (built later in parallel)
                     auto mesh = New<CSG::Mesh>();
-                    mesh->Build(brush);
 
                     // Save results
                     meshes.Add(mesh);
                     cache.Add(actor, mesh);
+                    brushes.Add(brush);
                 }
                 else
                 {
@@ -239,6 +263,8 @@ struct BuildData
 {
     MeshesArray meshes;
     MeshesLookup cache;
+    Array<Brush*> brushes;
+    bool upToDate = false;
     Guid outputModelAssetId = Guid::Empty;
     Guid outputRawDataAssetId = Guid::Empty;
     Guid outputCollisionDataAssetId = Guid::Empty;
@@ -250,14 +276,116 @@ struct BuildData
     }
 };
 
+uint32 GetBrushHash(Brush* brush, const Array<Surface>& surfaces)
+{
+    // Include brush object pointer (built mesh references it)
+    uint32 hash = Crc::MemCrc32(&brush, sizeof(brush));
+    const Mode mode = brush->GetBrushMode();
+    hash = Crc::MemCrc32(&mode, sizeof(mode), hash);
+    for (const Surface& surface : surfaces)
+    {
+        hash = Crc::MemCrc32(&surface.Normal, sizeof(surface.Normal), hash);
+        hash = Crc::MemCrc32(&surface.D, sizeof(surface.D), hash);
+        hash = Crc::MemCrc32(&surface.Material, sizeof(surface.Material), hash);
+        hash = Crc::MemCrc32(&surface.TexCoordScale, sizeof(surface.TexCoordScale), hash);
+        hash = Crc::MemCrc32(&surface.TexCoordOffset, sizeof(surface.TexCoordOffset), hash);
+        hash = Crc::MemCrc32(&surface.TexCoordRotation, sizeof(surface.TexCoordRotation), hash);
+        hash = Crc::MemCrc32(&surface.ScaleInLightmap, sizeof(surface.ScaleInLightmap), hash);
+    }
+    return hash;
+}
+
+bool CSGBuilderImpl::buildMeshes(Scene* scene, BuildData& data)
+{
+    PROFILE_CPU();
+    const int32 count = data.brushes.Count();
+
+    // Build brushes geometry in parallel (reuse the cached meshes of the unmodified brushes)
+    Array<uint32> hashes;
+    Array<bool> built;
+    hashes.Resize(count);
+    built.Resize(count);
+    Function<void(int32)> buildJob = [&data, &hashes, &built](int32 i)
+    {
+        PROFILE_CPU_NAMED("CSG Brush Job");
+        Brush* brush = data.brushes[i];
+        Array<Surface> surfaces;
+        brush->GetSurfaces(surfaces);
+        hashes[i] = GetBrushHash(brush, surfaces);
+        const CachedBrush* cached = BrushesCache.TryGet(brush->GetBrushID());
+        built[i] = cached == nullptr || cached->Hash != hashes[i];
+        if (built[i])
+            data.meshes[i]->Build(brush);
+        else
+            *data.meshes[i] = *cached->Mesh;
+    };
+    JobSystem::Execute(buildJob, count);
+
+    // Update cache before performing CSG operations (they modify meshes) and calculate the whole build state hash
+    int32 builtCount = 0;
+    Matrix sceneTransform;
+    scene->GetLocalToWorldMatrix(sceneTransform);
+    uint32 buildHash = Crc::MemCrc32(&sceneTransform, sizeof(sceneTransform));
+    HashSet<Guid> usedBrushes(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        Brush* brush = data.brushes[i];
+        const Guid brushId = brush->GetBrushID();
+        const Actor* parent = dynamic_cast<Actor*>(brush) ? dynamic_cast<Actor*>(brush)->GetParent() : nullptr;
+        const Guid parentId = parent ? parent->GetID() : Guid::Empty;
+        buildHash = Crc::MemCrc32(&brushId, sizeof(brushId), buildHash);
+        buildHash = Crc::MemCrc32(&parentId, sizeof(parentId), buildHash);
+        buildHash = Crc::MemCrc32(&hashes[i], sizeof(uint32), buildHash);
+        usedBrushes.Add(brushId);
+        if (!built[i])
+            continue;
+        builtCount++;
+        CachedBrush* cached = BrushesCache.TryGet(brushId);
+        if (cached)
+        {
+            *cached->Mesh = *data.meshes[i];
+            cached->BrushScene = brush->GetBrushScene();
+            cached->Hash = hashes[i];
+        }
+        else
+        {
+            BrushesCache.Add(brushId, { brush->GetBrushScene(), hashes[i], New<CSG::Mesh>(*data.meshes[i]) });
+        }
+    }
+    for (auto i = BrushesCache.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Value.BrushScene == scene && !usedBrushes.Contains(i->Key))
+        {
+            Delete(i->Value.Mesh);
+            BrushesCache.Remove(i);
+        }
+    }
+    LOG(Info, "CSG brushes built: {0}, reused: {1}", builtCount, count - builtCount);
+
+    // Skip the build if nothing has changed since the last one
+    uint32 prevBuildHash;
+    if (ScenesBuildHash.TryGet(scene, prevBuildHash) && prevBuildHash == buildHash && scene->CSGData.HasData())
+    {
+        data.upToDate = true;
+        return true;
+    }
+    ScenesBuildHash[scene] = buildHash;
+    return false;
+}
+
 bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
 {
     // Setup CSG meshes list and build them
     {
-        Function<bool(Actor*, MeshesArray&, MeshesLookup&)> treeWalkFunction(walkTree);
-        SceneQuery::TreeExecute<Array<CSG::Mesh*>&, MeshesLookup&>(treeWalkFunction, data.meshes, data.cache);
+        Function<bool(Actor*, MeshesArray&, MeshesLookup&, Array<Brush*>&)> treeWalkFunction(walkTree);
+        SceneQuery::TreeExecute<Array<CSG::Mesh*>&, MeshesLookup&, Array<Brush*>&>(treeWalkFunction, data.meshes, data.cache, data.brushes);
     }
     if (data.meshes.IsEmpty())
+    {
+        ScenesBuildHash.Remove(scene);
+        return false;
+    }
+    if (buildMeshes(scene, data))
         return false;
 
     // Process all meshes (performs actual CSG opterations on geometry in tree structure)
@@ -374,6 +502,14 @@ void CSGBuilderImpl::build(Scene* scene)
     // Build
     BuildData data;
     bool failed = buildInner(scene, data);
+    if (data.upToDate)
+    {
+        data.meshes.ClearDelete();
+        LOG(Info, "CSG is up to date! {0} brush(es)", data.brushes.Count());
+        return;
+    }
+    if (failed)
+        ScenesBuildHash.Remove(scene);
 
     // Link new (or empty) CSG mesh
     scene->CSGData.Data = Content::LoadAsync<RawDataAsset>(data.outputRawDataAssetId);
@@ -161,6 +161,54 @@ void SoftAssetReferenceBase::OnUnloaded(Asset* asset)
     Changed();
 }
 
+namespace
+{
+    THREADLOCAL int32 ReferencesBatchDepth = 0;
+    THREADLOCAL int32 ReferencesBatchCount = 0;
+    THREADLOCAL Asset* ReferencesBatchAssets[ASSET_REFERENCES_BATCH_SIZE];
+    THREADLOCAL int32 ReferencesBatchDeltas[ASSET_REFERENCES_BATCH_SIZE];
+}
+
+AssetReferencesBatch::AssetReferencesBatch()
+{
+    ReferencesBatchDepth++;
+}
+
+AssetReferencesBatch::~AssetReferencesBatch()
+{
+    if (--ReferencesBatchDepth != 0)
+        return;
+
+    // Apply the net references changes (temporary references that got added and removed within the batch don't touch the shared counter)
+    for (int32 i = 0; i < ReferencesBatchCount; i++)
+    {
+        const int32 delta = ReferencesBatchDeltas[i];
+        if (delta != 0)
+            Platform::InterlockedAdd(&ReferencesBatchAssets[i]->_refCount, delta);
+    }
+    ReferencesBatchCount = 0;
+}
+
+bool AssetReferencesBatch::Add(Asset* asset, int32 delta)
+{
+    if (ReferencesBatchDepth == 0)
+        return false;
+    for (int32 i = 0; i < ReferencesBatchCount; i++)
+    {
+        if (ReferencesBatchAssets[i] == asset)
+        {
+            ReferencesBatchDeltas[i] += delta;
+            return true;
+        }
+    }
+    if (ReferencesBatchCount == ASSET_REFERENCES_BATCH_SIZE)
+        return false;
+    ReferencesBatchAssets[ReferencesBatchCount] = asset;
+    ReferencesBatchDeltas[ReferencesBatchCount] = delta;
+    ReferencesBatchCount++;
+    return true;
+}
+
 Asset::Asset(const SpawnParams& params, const AssetInfo* info)
     : ManagedScriptingObject(params)
     , _refCount(0)
@@ -360,7 +408,8 @@ void Asset::Reload()
 
 namespace ContentLoadingManagerImpl
 {
-    extern ConcurrentTaskQueue<ContentLoadTask> Tasks;
+    extern bool TryDequeue(ContentLoadTask*& task);
+    extern void Requeue(ContentLoadTask* const* tasks, int32 count);
 };
 
 bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
@@ -427,14 +476,14 @@ bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
             {
                 // Dequeue task from the loading queue
                 ContentLoadTask* tmp;
-                if (ContentLoadingManagerImpl::Tasks.try_dequeue(tmp))
+                if (ContentLoadingManagerImpl::TryDequeue(tmp))
                 {
                     if (tmp == task)
                     {
                         if (localQueue.Count() != 0)
                         {
                             // Put back queued tasks
-                            ContentLoadingManagerImpl::Tasks.enqueue_bulk(localQueue.Get(), localQueue.Count());
+                            ContentLoadingManagerImpl::Requeue(localQueue.Get(), localQueue.Count());
                             localQueue.Clear();
                         }
 
@@ -454,7 +503,7 @@ bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
             if (localQueue.Count() != 0)
             {
                 // Put back queued tasks
-                ContentLoadingManagerImpl::Tasks.enqueue_bulk(localQueue.Get(), localQueue.Count());
+                ContentLoadingManagerImpl::Requeue(localQueue.Get(), localQueue.Count());
                 localQueue.Clear();
             }
 
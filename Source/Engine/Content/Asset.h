@@ -18,6 +18,26 @@
 	public: \
 	explicit type(const SpawnParams& params, const AssetInfo* info)
 
+/// <summary>
+/// Scope that batches the asset references changes done on the current thread and applies their net delta to the assets at the end of the scope. Reduces contention on the shared reference counters of the hot assets (eg. materials or common textures) when they are temporarily referenced by many worker threads (eg. inside the render or update jobs).
+/// </summary>
+/// <remarks>
+/// Added references are applied at the end of the scope, so use it only in code that keeps the used assets alive with other references. Nested scopes are merged into the outermost one.
+/// </remarks>
+struct FLAXENGINE_API AssetReferencesBatch
+{
+    AssetReferencesBatch();
+    ~AssetReferencesBatch();
+
+    /// <summary>
+    /// Tries to add the asset references change to the batch of the current thread.
+    /// </summary>
+    /// <param name="asset">The asset.</param>
+    /// <param name="delta">The references count change.</param>
+    /// <returns>True if change has been batched, otherwise false (no active batch on this thread or batch is full).</returns>
+    static bool Add(Asset* asset, int32 delta);
+};
+
 /// <summary>
 /// Asset objects base class.
 /// </summary>
@@ -27,6 +47,7 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API Asset : public ManagedScriptin
     friend Content;
     friend LoadAssetTask;
     friend class ContentService;
+    friend AssetReferencesBatch;
 public:
     /// <summary>
     /// The asset loading result.
@@ -84,7 +105,8 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API Asset : public ManagedScriptin
     /// </summary>
     FORCE_INLINE void AddReference()
     {
-        Platform::InterlockedIncrement(&_refCount);
+        if (!AssetReferencesBatch::Add(this, 1))
+            Platform::InterlockedIncrement(&_refCount);
     }
 
     /// <summary>
@@ -92,7 +114,8 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API Asset : public ManagedScriptin
     /// </summary>
     FORCE_INLINE void RemoveReference()
     {
-        Platform::InterlockedDecrement(&_refCount);
+        if (!AssetReferencesBatch::Add(this, -1))
+            Platform::InterlockedDecrement(&_refCount);
     }
 
 public:
@@ -46,7 +46,7 @@ Animation::InfoData Animation::GetInfo() const
         info.FramesCount = (int32)Data.Duration;
         info.ChannelsCount = Data.Channels.Count();
         info.KeyframesCount = Data.GetKeyframesCount();
-        info.MemoryUsage += Data.Channels.Capacity() * sizeof(NodeAnimationData);
+        info.MemoryUsage += Data.Channels.Capacity() * sizeof(NodeAnimationData) + Data.Compressed.GetMemoryUsage();
         for (auto& e : Data.Channels)
         {
             info.MemoryUsage += (e.NodeName.Length() + 1) * sizeof(Char);
@@ -253,6 +253,7 @@ bool Animation::SaveTimeline(BytesContainer& data)
 
         // Tracks
         Data.Channels.Clear();
+        Data.Compressed.Dispose();
         Events.Clear();
         NestedAnims.Clear();
         Dictionary<int32, int32> animationChannelTrackIndexToChannelIndex;
@@ -413,23 +414,36 @@ bool Animation::Save(const StringView& path)
         MemoryWriteStream stream(4096);
 
         // Info
-        stream.WriteInt32(102);
+        stream.WriteInt32(103);
         stream.WriteDouble(Data.Duration);
         stream.WriteDouble(Data.FramesPerSecond);
         stream.WriteBool(Data.EnableRootMotion);
         stream.WriteString(Data.RootNodeName, 13);
 
-        // Animation channels
+        // Animation channels (curves are skipped if animation is compressed)
+        const bool compressed = Data.Compressed.IsValid();
         stream.WriteInt32(Data.Channels.Count());
         for (int32 i = 0; i < Data.Channels.Count(); i++)
         {
             auto& anim = Data.Channels[i];
             stream.WriteString(anim.NodeName, 172);
+            if (compressed)
+            {
+                stream.WriteInt32(0);
+                stream.WriteInt32(0);
+                stream.WriteInt32(0);
+                continue;
+            }
             Serialization::Serialize(stream, anim.Position);
             Serialization::Serialize(stream, anim.Rotation);
             Serialization::Serialize(stream, anim.Scale);
         }
 
+        // Compressed animation
+        stream.WriteBool(compressed);
+        if (compressed)
+            Data.Compressed.Serialize(stream);
+
         // Animation events
         stream.WriteInt32(Events.Count());
         for (int32 i = 0; i < Events.Count(); i++)
@@ -470,7 +484,7 @@ bool Animation::Save(const StringView& path)
         // Set data to the chunk asset
         auto chunk0 = GetOrCreateChunk(0);
         ASSERT(chunk0 != nullptr);
-        chunk0->Data.Copy(stream.GetHandle(), stream.GetPosition());
+        stream.Release(chunk0->Data);
     }
 
     // Save
@@ -535,6 +549,7 @@ Asset::LoadResult Animation::load()
     case 100:
     case 101:
     case 102:
+    case 103:
     {
         stream.ReadInt32(&headerVersion);
         stream.ReadDouble(&Data.Duration);
@@ -574,6 +589,20 @@ Asset::LoadResult Animation::load()
         }
     }
 
+    // Compressed animation
+    if (headerVersion >= 103 && stream.ReadBool())
+    {
+        if (Data.Compressed.Deserialize(stream) || Data.Compressed.Channels.Count() != Data.Channels.Count())
+        {
+            LOG(Warning, "Failed to deserialize the compressed animation data.");
+            return LoadResult::Failed;
+        }
+#if USE_EDITOR
+        // Restore curves for the animation timeline editing
+        Data.Compressed.Decompress(Data);
+#endif
+    }
+
     // Animation events
     if (headerVersion >= 101)
     {
@@ -71,6 +71,11 @@ bool Material::CanUseLightmap() const
     return _materialShader && _materialShader->CanUseLightmap();
 }
 
+bool Material::CanUseSkinning() const
+{
+    return _materialShader && _materialShader->CanUseSkinning();
+}
+
 bool Material::CanUseInstancing(InstancingHandler& handler) const
 {
     return _materialShader && _materialShader->CanUseInstancing(handler);
@@ -225,7 +230,7 @@ Asset::LoadResult Material::load()
             // Save layer to the chunk data
             MemoryWriteStream stream(512);
             layer->Graph.Save(&stream, false);
-            surfaceChunk->Data.Copy(stream.GetHandle(), stream.GetPosition());
+            stream.Release(surfaceChunk->Data);
         }
         generator.AddLayer(layer);
 
@@ -496,6 +501,11 @@ void Material::InitCompilationOptions(ShaderCompilationOptions& options)
     options.Macros.Add({ "USE_FORWARD", Numbers[useForward ? 1 : 0] });
     options.Macros.Add({ "USE_DEFERRED", Numbers[isSurfaceOrTerrainOrDeformable && info.BlendMode == MaterialBlendMode::Opaque ? 1 : 0] });
     options.Macros.Add({ "USE_DISTORTION", Numbers[useDistortion ? 1 : 0] });
+    bool hasSkinningMacro = false; // Game cooker can skip skinning permutations for materials used only with static meshes
+    for (const ShaderMacro& macro : options.Macros)
+        hasSkinningMacro |= macro.Name && StringUtils::Compare(macro.Name, "CAN_USE_SKINNING") == 0;
+    if (!hasSkinningMacro)
+        options.Macros.Add({ "CAN_USE_SKINNING", Numbers[1] });
 #endif
 }
 
@@ -46,6 +46,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Material : public ShaderAssetTypeBase<Ma
     bool IsReady() const override;
     DrawPass GetDrawModes() const override;
     bool CanUseLightmap() const override;
+    bool CanUseSkinning() const override;
     bool CanUseInstancing(InstancingHandler& handler) const override;
     void Bind(BindParameters& params) override;
 
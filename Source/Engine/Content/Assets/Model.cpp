@@ -80,10 +80,17 @@ class StreamModelLODTask : public STREAM_TASK_BASE
         }
         MemoryReadStream stream(data.Get(), data.Length());
 
+        // Get meshlets data (optional)
+        BytesContainer meshletsData;
+        const int32 meshletsChunkIndex = MODEL_LOD_TO_MESHLETS_CHUNK_INDEX(_lodIndex);
+        if (model->HasChunk(meshletsChunkIndex) && !model->LoadChunk(meshletsChunkIndex))
+            model->GetChunkData(meshletsChunkIndex, meshletsData);
+        MemoryReadStream meshletsStream(meshletsData.Get(), meshletsData.Length());
+
         // Note: this is running on thread pool task so we must be sure that updated LOD is not used at all (for rendering)
 
         // Load model LOD (initialize vertex and index buffers)
-        if (model->LODs[_lodIndex].Load(stream))
+        if (model->LODs[_lodIndex].Load(stream, meshletsData.IsValid() ? &meshletsStream : nullptr))
         {
             LOG(Warning, "Cannot load LOD{1} for model \'{0}\'", model->ToString(), _lodIndex);
             return true;
@@ -576,7 +583,22 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
                 auto lodChunk = GET_CHUNK(MODEL_LOD_TO_CHUNK_INDEX(lodIndex));
                 if (lodChunk == nullptr)
                     return true;
-                lodChunk->Data.Copy(meshesStream.GetHandle(), meshesStream.GetPosition());
+                meshesStream.Release(lodChunk->Data);
+
+                // Keep meshlets data from file only if meshes were not modified (UpdateMesh clears the meshlets)
+                const int32 meshletsChunkIndex = MODEL_LOD_TO_MESHLETS_CHUNK_INDEX(lodIndex);
+                bool hasMeshlets = !IsVirtual() && HasChunk(meshletsChunkIndex);
+                for (int32 meshIndex = 0; meshIndex < lod.Meshes.Count() && hasMeshlets; meshIndex++)
+                    hasMeshlets &= lod.Meshes[meshIndex].GetMeshletsCount() != 0;
+                if (hasMeshlets)
+                {
+                    if (LoadChunk(meshletsChunkIndex))
+                        return true;
+                }
+                else if (!IsVirtual())
+                {
+                    ReleaseChunk(meshletsChunkIndex);
+                }
             }
         }
 
@@ -600,7 +622,7 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
                 sdfStream.WriteBytes(&mipData, sizeof(mipData));
                 sdfStream.WriteBytes(mip.Data.Get(), mip.Data.Length());
             }
-            sdfChunk->Data.Copy(sdfStream.GetHandle(), sdfStream.GetPosition());
+            sdfStream.Release(sdfChunk->Data);
         }
     }
     else
@@ -610,6 +632,8 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
         {
             if (LoadChunk(MODEL_LOD_TO_CHUNK_INDEX(lodIndex)))
                 return true;
+            if (HasChunk(MODEL_LOD_TO_MESHLETS_CHUNK_INDEX(lodIndex)) && LoadChunk(MODEL_LOD_TO_MESHLETS_CHUNK_INDEX(lodIndex)))
+                return true;
         }
 
         if (SDF.Texture)
@@ -628,7 +652,7 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
     // Set mesh header data
     auto headerChunk = GET_CHUNK(0);
     ASSERT(headerChunk != nullptr);
-    headerChunk->Data.Copy(headerStream.GetHandle(), headerStream.GetPosition());
+    headerStream.Release(headerChunk->Data);
 
 #undef GET_CHUNK
 
@@ -680,7 +704,7 @@ bool Model::GenerateSDF(float resolutionScale, int32 lodIndex, bool cacheData, f
 #if USE_EDITOR
     // Set asset data
     if (cacheData)
-        GetOrCreateChunk(15)->Data.Copy(sdfStream.GetHandle(), sdfStream.GetPosition());
+        sdfStream.Release(GetOrCreateChunk(15)->Data);
 #endif
 
     return false;
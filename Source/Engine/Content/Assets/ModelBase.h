@@ -5,6 +5,7 @@
 #include "../BinaryAsset.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Graphics/Models/MaterialSlot.h"
+#include "Engine/Graphics/Models/Config.h"
 #include "Engine/Streaming/StreamableResource.h"
 
 // Note: we use the first chunk as a header, next is the highest quality lod and then lower ones
@@ -14,8 +15,12 @@
 // Chunk 1: LOD0
 // Chunk 2: LOD1
 // ..
+// Chunk 7: LOD0 meshlets (optional)
+// Chunk 8: LOD1 meshlets (optional)
+// ..
 // Chunk 15: SDF
 #define MODEL_LOD_TO_CHUNK_INDEX(lod) (lod + 1)
+#define MODEL_LOD_TO_MESHLETS_CHUNK_INDEX(lod) (lod + 1 + MODEL_MAX_LODS)
 
 class MeshBase;
 struct RenderContextBatch;
@@ -93,6 +98,10 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API ModelBase : public BinaryAsset
     /// </summary>
     API_FIELD() float MinScreenSize = 0.0f;
 
+    // The model usage cache written during rendering (on LOD selection). Used by the streaming to prioritize model data within the memory budget.
+    mutable uint64 LastRenderFrame = 0;
+    mutable float LastRenderScreenSize = 0.0f;
+
     /// <summary>
     /// The list of material slots.
     /// </summary>
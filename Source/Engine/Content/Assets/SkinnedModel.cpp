@@ -786,7 +786,7 @@ bool SkinnedModel::Save(bool withMeshDataFromGpu, const StringView& path)
                 auto lodChunk = GET_CHUNK(MODEL_LOD_TO_CHUNK_INDEX(lodIndex));
                 if (lodChunk == nullptr)
                     return true;
-                lodChunk->Data.Copy(meshesStream.GetHandle(), meshesStream.GetPosition());
+                meshesStream.Release(lodChunk->Data);
             }
         }
     }
@@ -805,7 +805,7 @@ bool SkinnedModel::Save(bool withMeshDataFromGpu, const StringView& path)
     // Set mesh header data
     auto headerChunk = GET_CHUNK(0);
     ASSERT(headerChunk != nullptr);
-    headerChunk->Data.Copy(headerStream.GetHandle(), headerStream.GetPosition());
+    headerStream.Release(headerChunk->Data);
 
 #undef GET_CHUNK
 
@@ -138,6 +138,24 @@ VisjectExecutor::Value VisualScriptExecutor::eatBox(Node* caller, Box* box)
         return Value::Zero;
     }
 #endif
+
+    // Evaluate the compiled expression without the nodes recursion (debugger needs the per-node evaluation)
+    const VisjectProgram* program = box->Program;
+#if VISUAL_SCRIPT_DEBUGGING
+    if (program && !VisualScripting::DebugFlow.IsBinded())
+#else
+    if (program)
+#endif
+    {
+        if (program->IsConstant())
+            return program->GetConstant();
+        if (stack.Stack->Instance)
+        {
+            const auto instanceParams = stack.Stack->Script->_instances.Find(stack.Stack->Instance->GetID());
+            if (instanceParams)
+                return program->Execute(instanceParams->Value.Params);
+        }
+    }
     const auto parentNode = box->GetParent<Node>();
 
     // Add to the calling stack
@@ -1334,6 +1352,9 @@ Asset::LoadResult VisualScript::load()
         return LoadResult::Failed;
     }
 
+    // Compile the pure expressions (constants, parameters and math) to skip the nodes recursion at runtime
+    Graph.CompilePrograms(Graph, 3);
+
     // Find method nodes
     for (auto& node : Graph.Nodes)
     {
@@ -242,8 +242,8 @@ ContentLoadTask* BinaryAsset::RequestChunkDataAsync(int32 index)
         return nullptr;
     }
 
-    // Spawn loading task
-    return New<LoadAssetDataTask>(this, GET_CHUNK_FLAG(index));
+    // Spawn loading task (chunk data requests come from the resources streaming so don't queue them behind the assets loading)
+    return New<LoadAssetDataTask>(this, GET_CHUNK_FLAG(index), ContentLoadTask::Priority::Visible);
 }
 
 void BinaryAsset::GetChunkData(int32 index, BytesContainer& data) const
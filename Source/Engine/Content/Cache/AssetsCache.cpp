@@ -4,6 +4,9 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/DeleteMe.h"
 #include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/FileReadStream.h"
@@ -15,12 +18,242 @@
 #include "Engine/Engine/Globals.h"
 #include "FlaxEngine.Gen.h"
 
+// Alignment of the cooked registry index data within the cache file
+#define ASSETS_CACHE_INDEX_ALIGNMENT 16
+
+namespace
+{
+    // Cooked registry index layout (see AssetsCacheFlags::Indexed):
+    // IndexHeader, IndexEntry[EntriesCount] (sorted by ID), IndexPath[PathsCount] (sorted by path), Guid[DependenciesCount], strings data (each as uint32 length + characters, 4-bytes aligned)
+    struct IndexHeader
+    {
+        uint32 EntriesCount;
+        uint32 PathsCount;
+        uint32 DependenciesCount;
+        uint32 StringsSize;
+    };
+
+    struct IndexEntry
+    {
+        Guid ID;
+        uint32 TypeName;
+        uint32 Path;
+        uint32 EditorPath;
+        uint32 DependenciesStart;
+        uint32 DependenciesCount;
+    };
+
+    struct IndexPath
+    {
+        uint32 Path;
+        Guid ID;
+    };
+
+    // Value of the string offset for the missing string
+    constexpr uint32 IndexInvalidString = MAX_uint32;
+
+    FORCE_INLINE const IndexHeader& GetIndexHeader(const byte* index)
+    {
+        return *(const IndexHeader*)index;
+    }
+
+    FORCE_INLINE const IndexEntry* GetIndexEntries(const byte* index)
+    {
+        return (const IndexEntry*)(index + sizeof(IndexHeader));
+    }
+
+    FORCE_INLINE const IndexPath* GetIndexPaths(const byte* index)
+    {
+        return (const IndexPath*)(GetIndexEntries(index) + GetIndexHeader(index).EntriesCount);
+    }
+
+    FORCE_INLINE const Guid* GetIndexDependencies(const byte* index)
+    {
+        return (const Guid*)(GetIndexPaths(index) + GetIndexHeader(index).PathsCount);
+    }
+
+    FORCE_INLINE StringView GetIndexString(const byte* index, uint32 offset)
+    {
+        if (offset == IndexInvalidString)
+            return StringView::Empty;
+        const byte* str = (const byte*)(GetIndexDependencies(index) + GetIndexHeader(index).DependenciesCount) + offset;
+        return StringView((const Char*)(str + sizeof(uint32)), (int32)*(const uint32*)str);
+    }
+
+    FORCE_INLINE int32 CompareIds(const Guid& a, const Guid& b)
+    {
+        if (a.A != b.A)
+            return a.A < b.A ? -1 : 1;
+        if (a.B != b.B)
+            return a.B < b.B ? -1 : 1;
+        if (a.C != b.C)
+            return a.C < b.C ? -1 : 1;
+        if (a.D != b.D)
+            return a.D < b.D ? -1 : 1;
+        return 0;
+    }
+
+    const IndexEntry* FindIndexEntry(const byte* index, const Guid& id)
+    {
+        if (!index)
+            return nullptr;
+        const IndexEntry* entries = GetIndexEntries(index);
+        int32 left = 0, right = (int32)GetIndexHeader(index).EntriesCount - 1;
+        while (left <= right)
+        {
+            const int32 middle = (left + right) / 2;
+            const int32 compare = CompareIds(entries[middle].ID, id);
+            if (compare == 0)
+                return &entries[middle];
+            if (compare < 0)
+                left = middle + 1;
+            else
+                right = middle - 1;
+        }
+        return nullptr;
+    }
+
+    const IndexPath* FindIndexPath(const byte* index, const StringView& path)
+    {
+        if (!index)
+            return nullptr;
+        const IndexPath* paths = GetIndexPaths(index);
+        int32 left = 0, right = (int32)GetIndexHeader(index).PathsCount - 1;
+        while (left <= right)
+        {
+            const int32 middle = (left + right) / 2;
+            const int32 compare = GetIndexString(index, paths[middle].Path).Compare(path);
+            if (compare == 0)
+                return &paths[middle];
+            if (compare < 0)
+                left = middle + 1;
+            else
+                right = middle - 1;
+        }
+        return nullptr;
+    }
+
+    struct IndexPathItem
+    {
+        StringView Path;
+        Guid ID;
+    };
+
+    bool SortIndexEntries(const AssetsCache::Entry* const& a, const AssetsCache::Entry* const& b)
+    {
+        return CompareIds(a->Info.ID, b->Info.ID) < 0;
+    }
+
+    bool SortIndexPaths(const IndexPathItem& a, const IndexPathItem& b)
+    {
+        return a.Path.Compare(b.Path) < 0;
+    }
+
+    uint32 AddIndexString(Array<byte>& data, Dictionary<StringView, uint32>& lookup, const StringView& str)
+    {
+        uint32 offset;
+        if (lookup.TryGet(str, offset))
+            return offset;
+        offset = data.Count();
+        const uint32 length = str.Length();
+        data.Add((const byte*)&length, sizeof(uint32));
+        data.Add((const byte*)str.Get(), length * sizeof(Char));
+        data.AddDefault(Math::AlignUp<int32>(data.Count(), 4) - data.Count());
+        lookup.Add(str, offset);
+        return offset;
+    }
+
+    bool SaveIndex(WriteStream* stream, const AssetsCache::Registry& entries, const AssetsCache::PathsMapping& pathsMapping, const AssetsCache::DependenciesMapping* dependencies)
+    {
+        Array<byte> strings;
+        Dictionary<StringView, uint32> stringsLookup;
+
+        // Sort entries by id
+        Array<const AssetsCache::Entry*> sortedEntries;
+        sortedEntries.EnsureCapacity(entries.Count());
+        for (auto i = entries.Begin(); i.IsNotEnd(); ++i)
+            sortedEntries.Add(&i->Value);
+        Sorting::QuickSort(sortedEntries.Get(), sortedEntries.Count(), &SortIndexEntries);
+
+        // Sort paths
+        Array<IndexPathItem> sortedPaths;
+        Dictionary<Guid, StringView> editorPaths;
+        sortedPaths.EnsureCapacity(pathsMapping.Count());
+        for (auto i = pathsMapping.Begin(); i.IsNotEnd(); ++i)
+        {
+            sortedPaths.Add({ StringView(i->Key), i->Value });
+            if (!editorPaths.ContainsKey(i->Value))
+                editorPaths.Add(i->Value, StringView(i->Key));
+        }
+        Sorting::QuickSort(sortedPaths.Get(), sortedPaths.Count(), &SortIndexPaths);
+
+        // Build index
+        Array<IndexEntry> indexEntries;
+        Array<Guid> indexDependencies;
+        indexEntries.Resize(sortedEntries.Count());
+        for (int32 i = 0; i < sortedEntries.Count(); i++)
+        {
+            const AssetsCache::Entry& e = *sortedEntries[i];
+            IndexEntry& indexEntry = indexEntries[i];
+            indexEntry.ID = e.Info.ID;
+            indexEntry.TypeName = AddIndexString(strings, stringsLookup, e.Info.TypeName);
+            indexEntry.Path = AddIndexString(strings, stringsLookup, e.Info.Path);
+            const StringView* editorPath = editorPaths.TryGet(e.Info.ID);
+            indexEntry.EditorPath = editorPath ? AddIndexString(strings, stringsLookup, *editorPath) : IndexInvalidString;
+            indexEntry.DependenciesStart = indexDependencies.Count();
+            const Array<Guid>* assetDependencies = dependencies ? dependencies->TryGet(e.Info.ID) : nullptr;
+            if (assetDependencies)
+                indexDependencies.Add(*assetDependencies);
+            indexEntry.DependenciesCount = indexDependencies.Count() - indexEntry.DependenciesStart;
+        }
+        Array<IndexPath> indexPaths;
+        indexPaths.Resize(sortedPaths.Count());
+        for (int32 i = 0; i < sortedPaths.Count(); i++)
+        {
+            indexPaths[i].Path = AddIndexString(strings, stringsLookup, sortedPaths[i].Path);
+            indexPaths[i].ID = sortedPaths[i].ID;
+        }
+
+        // Write index (aligned within the file so it can be accessed directly from the mapped memory)
+        const uint32 position = stream->GetPosition();
+        for (uint32 i = position; i < Math::AlignUp<uint32>(position, ASSETS_CACHE_INDEX_ALIGNMENT); i++)
+            stream->WriteByte(0);
+        IndexHeader header;
+        header.EntriesCount = indexEntries.Count();
+        header.PathsCount = indexPaths.Count();
+        header.DependenciesCount = indexDependencies.Count();
+        header.StringsSize = strings.Count();
+        stream->WriteBytes(&header, sizeof(header));
+        stream->WriteBytes(indexEntries.Get(), indexEntries.Count() * sizeof(IndexEntry));
+        stream->WriteBytes(indexPaths.Get(), indexPaths.Count() * sizeof(IndexPath));
+        stream->WriteBytes(indexDependencies.Get(), indexDependencies.Count() * sizeof(Guid));
+        stream->WriteBytes(strings.Get(), strings.Count());
+
+        return false;
+    }
+}
+
 AssetsCache::AssetsCache()
     : _isDirty(false)
     , _registry(4096)
 {
 }
 
+AssetsCache::~AssetsCache()
+{
+    ReleaseIndex();
+}
+
+int32 AssetsCache::Size() const
+{
+    _locker.Lock();
+    int32 result = _registry.Count();
+    if (_index)
+        result += (int32)GetIndexHeader(_index).EntriesCount;
+    _locker.Unlock();
+    return result;
+}
+
 void AssetsCache::Init()
 {
     // Cache data
@@ -77,6 +310,29 @@ void AssetsCache::Init()
     ScopeLock lock(_locker);
 
     _isDirty = false;
+    ReleaseIndex();
+
+    if (EnumHasAnyFlags(flags, AssetsCacheFlags::Indexed))
+    {
+        // Use cooked registry index directly from the file data (no need to build the dictionaries)
+        const uint32 indexOffset = Math::AlignUp<uint32>(stream->GetPosition(), ASSETS_CACHE_INDEX_ALIGNMENT);
+        deleteStream.Delete();
+        _registry.Clear();
+        _pathsMapping.Clear();
+        _dependencies.Clear();
+        _indexRelativePaths = EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths);
+        if (InitIndex(indexOffset))
+        {
+            ReleaseIndex();
+            _isDirty = true;
+            LOG(Warning, "Asset Cache file has an error.");
+            return;
+        }
+
+        const int32 loadTimeInMs = static_cast<int32>((DateTime::Now() - loadStartTime).GetTotalMilliseconds());
+        LOG(Info, "Asset Cache loaded {0} entries in {1} ms (indexed)", GetIndexHeader(_index).EntriesCount, loadTimeInMs);
+        return;
+    }
 
     // Load elements count
     stream->ReadInt32(&count);
@@ -134,6 +390,26 @@ void AssetsCache::Init()
         _pathsMapping.Add(mappedPath, id);
     }
 
+    // Dependencies
+    _dependencies.Clear();
+    if (EnumHasAnyFlags(flags, AssetsCacheFlags::Dependencies))
+    {
+        stream->ReadInt32(&count);
+        _dependencies.EnsureCapacity(count);
+        for (int32 i = 0; i < count; i++)
+        {
+            Guid id;
+            stream->Read(id);
+            int32 dependenciesCount;
+            stream->ReadInt32(&dependenciesCount);
+            if (dependenciesCount < 0 || stream->HasError())
+                break;
+            auto& dependencies = _dependencies[id];
+            dependencies.Resize(dependenciesCount);
+            stream->ReadBytes(dependencies.Get(), dependenciesCount * sizeof(Guid));
+        }
+    }
+
     // Check errors
     const bool hasError = stream->HasError();
     deleteStream.Delete();
@@ -141,6 +417,7 @@ void AssetsCache::Init()
     {
         _isDirty = true;
         _registry.Clear();
+        _dependencies.Clear();
         LOG(Warning, "Asset Cache file has an error. Removing it.");
         if (FileSystem::DeleteFile(_path))
         {
@@ -153,6 +430,58 @@ void AssetsCache::Init()
     LOG(Info, "Asset Cache loaded {0} entries in {1} ms ({2} rejected)", _registry.Count(), loadTimeInMs, rejectedCount);
 }
 
+bool AssetsCache::InitIndex(uint32 offset)
+{
+    auto file = File::Open(_path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+    if (!file)
+        return true;
+    _indexFile = file;
+    const uint32 size = file->GetSize();
+    if (size < offset + sizeof(IndexHeader))
+        return true;
+
+    // Map file or read the index data if memory mapping is not supported
+    const byte* index;
+    const byte* data = file->Map();
+    if (data)
+    {
+        index = data + offset;
+    }
+    else
+    {
+        _indexData.Resize(size - offset);
+        file->SetPosition(offset);
+        uint32 bytesRead;
+        if (file->Read(_indexData.Get(), _indexData.Count(), &bytesRead) || bytesRead != (uint32)_indexData.Count())
+            return true;
+        Delete(file);
+        _indexFile = nullptr;
+        index = _indexData.Get();
+    }
+
+    // Validate index
+    const IndexHeader& header = GetIndexHeader(index);
+    const uint64 indexSize = sizeof(IndexHeader) + (uint64)header.EntriesCount * sizeof(IndexEntry) + (uint64)header.PathsCount * sizeof(IndexPath) + (uint64)header.DependenciesCount * sizeof(Guid) + header.StringsSize;
+    if (indexSize > size - offset)
+        return true;
+    _index = index;
+    return false;
+}
+
+void AssetsCache::ReleaseIndex()
+{
+    _index = nullptr;
+    _indexPathsLookup.Clear();
+    _indexPaths.Clear();
+    _indexData.Resize(0);
+    if (_indexFile)
+    {
+        _indexFile->Unmap();
+        Delete(_indexFile);
+        _indexFile = nullptr;
+    }
+}
+
 bool AssetsCache::Save()
 {
     // Registry can be saved only in editor
@@ -174,7 +503,7 @@ bool AssetsCache::Save()
     return false;
 }
 
-bool AssetsCache::Save(const StringView& path, const Registry& entries, const PathsMapping& pathsMapping, const AssetsCacheFlags flags)
+bool AssetsCache::Save(const StringView& path, const Registry& entries, const PathsMapping& pathsMapping, const AssetsCacheFlags flags, const DependenciesMapping* dependencies)
 {
     PROFILE_CPU();
 
@@ -192,7 +521,15 @@ bool AssetsCache::Save(const StringView& path, const Registry& entries, const Pa
     stream->WriteString(Globals::StartupFolder, -410);
 
     // Flags
-    stream->WriteInt32((int32)flags);
+    if (EnumHasAnyFlags(flags, AssetsCacheFlags::Indexed))
+    {
+        stream->WriteInt32((int32)(flags & ~AssetsCacheFlags::Dependencies));
+        SaveIndex(stream, entries, pathsMapping, dependencies);
+        stream->Flush();
+        Delete(stream);
+        return false;
+    }
+    stream->WriteInt32((int32)(dependencies ? flags | AssetsCacheFlags::Dependencies : flags & ~AssetsCacheFlags::Dependencies));
 
     // Items count
     stream->WriteInt32(entries.Count());
@@ -226,6 +563,18 @@ bool AssetsCache::Save(const StringView& path, const Registry& entries, const Pa
         index++;
     }
 
+    // Dependencies
+    if (dependencies)
+    {
+        stream->WriteInt32(dependencies->Count());
+        for (auto i = dependencies->Begin(); i.IsNotEnd(); ++i)
+        {
+            stream->Write(i->Key);
+            stream->WriteInt32(i->Value.Count());
+            stream->WriteBytes(i->Value.Get(), i->Value.Count() * sizeof(Guid));
+        }
+    }
+
     // Cleanup
     stream->Flush();
     Delete(stream);
@@ -245,6 +594,19 @@ const String& AssetsCache::GetEditorAssetPath(const Guid& id) const
         if (e.Value == id)
             return e.Key;
     }
+    const IndexEntry* e = FindIndexEntry(_index, id);
+    if (e && e->EditorPath != IndexInvalidString)
+    {
+        // Cache path string so it can be returned by reference
+        const String* path;
+        if (!_indexPathsLookup.TryGet(id, path))
+        {
+            const StringView editorPath = GetIndexString(_index, e->EditorPath);
+            path = _indexPaths.Add(_indexRelativePaths ? Globals::StartupFolder / editorPath : String(editorPath));
+            _indexPathsLookup.Add(id, path);
+        }
+        return *path;
+    }
     return String::Empty;
 #endif
 }
@@ -259,7 +621,7 @@ bool AssetsCache::FindAsset(const StringView& path, AssetInfo& info)
 
     // Check if asset has direct mapping to id (used for some cooked assets)
     Guid id;
-    if (_pathsMapping.TryGet(path, id))
+    if (_pathsMapping.TryGet(path, id) || FindIndexedPath(path, id))
     {
         return FindAsset(id, info);
     }
@@ -268,7 +630,7 @@ bool AssetsCache::FindAsset(const StringView& path, AssetInfo& info)
     {
         // Additional check if user provides path relative to the project folder (eg. Content/SomeAssets/MyFile.json)
         const String absolutePath = Globals::ProjectFolder / *path;
-        if (_pathsMapping.TryGet(absolutePath, id))
+        if (_pathsMapping.TryGet(absolutePath, id) || FindIndexedPath(absolutePath, id))
         {
             return FindAsset(id, info);
         }
@@ -320,14 +682,66 @@ bool AssetsCache::FindAsset(const Guid& id, AssetInfo& info)
             info = e->Info;
         }
     }
+    else if (const IndexEntry* indexEntry = FindIndexEntry(_index, id))
+    {
+        result = true;
+        info.ID = id;
+        info.TypeName = GetIndexString(_index, indexEntry->TypeName);
+        const StringView entryPath = GetIndexString(_index, indexEntry->Path);
+        info.Path = _indexRelativePaths && entryPath.HasChars() ? Globals::StartupFolder / entryPath : String(entryPath);
+    }
     return result;
 }
 
+bool AssetsCache::FindIndexedPath(const StringView& path, Guid& id) const
+{
+    if (!_index)
+        return false;
+    StringView key = path;
+    if (_indexRelativePaths)
+    {
+        // Index stores paths relative to the startup folder
+        const int32 length = Globals::StartupFolder.Length();
+        if (key.Length() > length && key[length] == '/' && key.StartsWith(StringView(Globals::StartupFolder), StringSearchCase::CaseSensitive))
+            key = key.Substring(length + 1);
+    }
+    const IndexPath* e = FindIndexPath(_index, key);
+    if (e)
+        id = e->ID;
+    return e != nullptr;
+}
+
+bool AssetsCache::GetDependencies(const Guid& id, Array<Guid>& result) const
+{
+    ScopeLock lock(_locker);
+    const auto dependencies = _dependencies.TryGet(id);
+    if (dependencies && dependencies->HasItems())
+    {
+        result.Add(*dependencies);
+        return true;
+    }
+    const IndexEntry* e = FindIndexEntry(_index, id);
+    if (e && e->DependenciesCount != 0)
+    {
+        result.Add(GetIndexDependencies(_index) + e->DependenciesStart, (int32)e->DependenciesCount);
+        return true;
+    }
+    return false;
+}
+
 void AssetsCache::GetAll(Array<Guid>& result) const
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
     _registry.GetKeys(result);
+    if (_index)
+    {
+        const IndexEntry* entries = GetIndexEntries(_index);
+        const int32 count = (int32)GetIndexHeader(_index).EntriesCount;
+        result.EnsureCapacity(result.Count() + count);
+        for (int32 i = 0; i < count; i++)
+            result.Add(entries[i].ID);
+    }
 }
 
 void AssetsCache::GetAllByTypeName(const StringView& typeName, Array<Guid>& result) const
@@ -339,6 +753,16 @@ void AssetsCache::GetAllByTypeName(const StringView& typeName, Array<Guid>& resu
         if (i->Value.Info.TypeName == typeName)
             result.Add(i->Key);
     }
+    if (_index)
+    {
+        const IndexEntry* entries = GetIndexEntries(_index);
+        const int32 count = (int32)GetIndexHeader(_index).EntriesCount;
+        for (int32 i = 0; i < count; i++)
+        {
+            if (GetIndexString(_index, entries[i].TypeName) == typeName)
+                result.Add(entries[i].ID);
+        }
+    }
 }
 
 void AssetsCache::RegisterAssets(FlaxStorage* storage)
@@ -9,12 +9,15 @@
 #include "Engine/Core/Types/DateTime.h"
 #endif
 #include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/ChunkedArray.h"
 #include "Engine/Platform/CriticalSection.h"
 
 struct AssetHeader;
 struct FlaxStorageReference;
 class FlaxStorage;
+class FileBase;
 
 /// <summary>
 /// Assets cache flags.
@@ -30,6 +33,16 @@ enum class AssetsCacheFlags
     /// The serialized paths are relative to the startup folder (should be converted to absolute on load).
     /// </summary>
     RelativePaths = 1,
+
+    /// <summary>
+    /// The cache contains the assets dependencies table (written by the game cooker).
+    /// </summary>
+    Dependencies = 2,
+
+    /// <summary>
+    /// The registry is stored as a sorted, memory-mappable index (written by the game cooker). Lookups by id and by path use binary search directly on the mapped file data without building the dictionaries on load.
+    /// </summary>
+    Indexed = 4,
 };
 
 DECLARE_ENUM_OPERATORS(AssetsCacheFlags);
@@ -72,32 +85,45 @@ class FLAXENGINE_API AssetsCache
 
     typedef Dictionary<Guid, Entry> Registry;
     typedef Dictionary<String, Guid> PathsMapping;
+    typedef Dictionary<Guid, Array<Guid>> DependenciesMapping;
 
 private:
     bool _isDirty;
     CriticalSection _locker;
     Registry _registry;
     PathsMapping _pathsMapping;
+    DependenciesMapping _dependencies;
     String _path;
 
+    // Cooked registry index (see AssetsCacheFlags::Indexed) - read-only view into the mapped cache file (or its copy if mapping is not supported)
+    const byte* _index = nullptr;
+    bool _indexRelativePaths = false;
+    FileBase* _indexFile = nullptr;
+    Array<byte> _indexData;
+    mutable ChunkedArray<String, 256> _indexPaths;
+    mutable Dictionary<Guid, const String*> _indexPathsLookup;
+
+    bool InitIndex(uint32 offset);
+    void ReleaseIndex();
+    bool FindIndexedPath(const StringView& path, Guid& id) const;
+
 public:
     /// <summary>
     /// Initializes a new instance of the <see cref="AssetsCache"/> class.
     /// </summary>
     AssetsCache();
 
+    /// <summary>
+    /// Finalizes an instance of the <see cref="AssetsCache"/> class.
+    /// </summary>
+    ~AssetsCache();
+
 public:
     /// <summary>
     /// Gets amount of registered assets
     /// </summary>
     /// <returns>Registry size</returns>
-    int32 Size() const
-    {
-        _locker.Lock();
-        const int32 result = _registry.Count();
-        _locker.Unlock();
-        return result;
-    }
+    int32 Size() const;
 
 public:
     /// <summary>
@@ -118,8 +144,9 @@ class FLAXENGINE_API AssetsCache
     /// <param name="entries">The registry entries.</param>
     /// <param name="pathsMapping">The assets paths mapping table.</param>
     /// <param name="flags">The custom flags.</param>
+    /// <param name="dependencies">The assets dependencies table (optional).</param>
     /// <returns>True if failed, otherwise false.</returns>
-    static bool Save(const StringView& path, const Registry& entries, const PathsMapping& pathsMapping, const AssetsCacheFlags flags = AssetsCacheFlags::None);
+    static bool Save(const StringView& path, const Registry& entries, const PathsMapping& pathsMapping, const AssetsCacheFlags flags = AssetsCacheFlags::None, const DependenciesMapping* dependencies = nullptr);
 
 public:
     /// <summary>
@@ -167,6 +194,14 @@ class FLAXENGINE_API AssetsCache
         return FindAsset(id, info);
     }
 
+    /// <summary>
+    /// Gets the direct dependencies of the asset (assets referenced by it). Available only in cooked game (recorded by the game cooker).
+    /// </summary>
+    /// <param name="id">The asset id.</param>
+    /// <param name="result">The result array (dependencies get appended to it).</param>
+    /// <returns>True if asset has any dependencies, otherwise false.</returns>
+    bool GetDependencies(const Guid& id, Array<Guid, HeapAllocation>& result) const;
+
     /// <summary>
     /// Gets the asset ids.
     /// </summary>
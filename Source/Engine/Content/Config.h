@@ -13,6 +13,18 @@
 // Maximum amount of data chunks used by the single asset
 #define ASSET_FILE_DATA_CHUNKS 16
 
+// Size of the independently compressed block of the large data chunks (see FlaxChunkFlags::CompressedLZ4Blocks)
+#define ASSET_FILE_DATA_CHUNK_BLOCK_SIZE (256 * 1024)
+
+// Enables memory-mapped access to the storage files (uncompressed data chunks are read-only views into the file mapping instead of the heap copies), disabled in Editor as it modifies the files
+#define ASSET_FILE_MEMORY_MAPPING (!USE_EDITOR)
+
+// Enables prefetching of the asset dependency closure (recorded in the cooked assets cache) when loading the asset, so I/O for all dependencies gets issued at once
+#define ASSETS_LOADING_PREFETCH_DEPENDENCIES (!USE_EDITOR)
+
+// The maximum amount of assets tracked by the per-thread references batch (see AssetReferencesBatch), other assets use the shared reference counter directly
+#define ASSET_REFERENCES_BATCH_SIZE 32
+
 // Enables searching workspace for missing assets (should be disabled in the final builds where assets registry is solid)
 #define ENABLE_ASSETS_DISCOVERY (USE_EDITOR)
 
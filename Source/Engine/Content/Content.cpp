@@ -8,6 +8,8 @@
 #include "Storage/ContentStorageManager.h"
 #include "Storage/JsonStorageProxy.h"
 #include "Factories/IAssetFactory.h"
+#include "Loading/ContentLoadTask.h"
+#include "Loading/ContentLoadingManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/ObjectsRemovalService.h"
@@ -25,12 +27,13 @@
 #include "Editor/Editor.h"
 #include "Editor/ProjectInfo.h"
 #endif
-#if ENABLE_ASSETS_DISCOVERY
+#if ENABLE_ASSETS_DISCOVERY || ASSETS_LOADING_PREFETCH_DEPENDENCIES
 #include "Engine/Core/Collections/HashSet.h"
 #endif
 
 TimeSpan Content::AssetsUpdateInterval = TimeSpan::FromMilliseconds(500);
 TimeSpan Content::AssetsUnloadInterval = TimeSpan::FromSeconds(10);
+uint64 Content::AssetsUnloadBudget = 0;
 Delegate<Asset*> Content::AssetDisposing;
 Delegate<Asset*> Content::AssetReloading;
 
@@ -65,6 +68,7 @@ namespace
 
     // Unloading assets
     Dictionary<Asset*, TimeSpan> UnloadQueue;
+    Array<Asset*> PendingUnload;
     TimeSpan LastUnloadCheckTime(0);
     bool IsExiting = false;
 
@@ -116,6 +120,30 @@ void ContentService::Update()
     }
 }
 
+void UnloadPendingAssets()
+{
+    // Unload assets within the memory budget (at least one asset per frame)
+    uint64 unloadedMemory = 0;
+    while (PendingUnload.HasItems())
+    {
+        Asset* asset = PendingUnload.Last();
+        if (asset->GetReferencesCount() <= 0)
+        {
+            const uint64 memoryUsage = asset->GetMemoryUsage();
+            if (Content::AssetsUnloadBudget != 0 && unloadedMemory != 0 && unloadedMemory + memoryUsage > Content::AssetsUnloadBudget)
+                break;
+            unloadedMemory += memoryUsage;
+            PendingUnload.RemoveLast();
+            Content::UnloadAsset(asset);
+        }
+        else
+        {
+            // Asset gained a new reference
+            PendingUnload.RemoveLast();
+        }
+    }
+}
+
 void ContentService::LateUpdate()
 {
     PROFILE_CPU();
@@ -123,7 +151,14 @@ void ContentService::LateUpdate()
     // Check if need to perform an update of unloading assets
     const TimeSpan timeNow = Time::Update.UnscaledTime;
     if (timeNow - LastUnloadCheckTime < Content::AssetsUpdateInterval)
+    {
+        if (PendingUnload.HasItems())
+        {
+            ScopeLock lock(AssetsLocker);
+            UnloadPendingAssets();
+        }
         return;
+    }
     LastUnloadCheckTime = timeNow;
 
     Asset* asset;
@@ -137,7 +172,7 @@ void ContentService::LateUpdate()
         asset = i->Value;
 
         // Check if has no references and is not during unloading
-        if (asset->GetReferencesCount() <= 0 && !UnloadQueue.ContainsKey(asset))
+        if (asset->GetReferencesCount() <= 0 && !UnloadQueue.ContainsKey(asset) && !PendingUnload.Contains(asset))
         {
             // Add to removes
             UnloadQueue.Add(asset, timeNow);
@@ -155,7 +190,7 @@ void ContentService::LateUpdate()
         }
     }
 
-    // Unload marked assets
+    // Unload marked assets (spread over frames within the memory budget)
     for (int32 i = 0; i < ToUnload.Count(); i++)
     {
         asset = ToUnload[i];
@@ -163,12 +198,13 @@ void ContentService::LateUpdate()
         // Check if has no references
         if (asset->GetReferencesCount() <= 0)
         {
-            Content::UnloadAsset(asset);
+            PendingUnload.Add(asset);
         }
 
         // Remove from unload queue
         UnloadQueue.Remove(asset);
     }
+    UnloadPendingAssets();
 
     // Update cache (for longer sessions it will help to reduce cache misses)
     Cache.Save();
@@ -891,6 +927,7 @@ void Content::onAssetUnload(Asset* asset)
 
     Assets.Remove(asset->GetID());
     UnloadQueue.Remove(asset);
+    PendingUnload.RemoveKeepOrder(asset);
     LoadedAssetsToInvoke.Remove(asset);
 }
 
@@ -992,9 +1029,71 @@ Asset* Content::LoadAsync(const Guid& id, const ScriptingTypeHandle& type)
     LoadCallAssets.Remove(id);
     LoadCallAssetsLocker.Unlock();
 
+#if ASSETS_LOADING_PREFETCH_DEPENDENCIES
+    if (result)
+        prefetchDependencies(result);
+#endif
+
     return result;
 }
 
+void Content::prefetchDependencies(Asset* root)
+{
+    // Gather the whole dependency closure of the asset
+    Array<Guid> dependencies;
+    if (!Cache.GetDependencies(root->GetID(), dependencies))
+        return;
+    PROFILE_CPU();
+    HashSet<Guid> visited;
+    visited.Add(root->GetID());
+    for (int32 i = 0; i < dependencies.Count(); i++)
+    {
+        const Guid id = dependencies[i];
+        if (visited.Contains(id))
+        {
+            dependencies.RemoveAtKeepOrder(i--);
+            continue;
+        }
+        visited.Add(id);
+        Cache.GetDependencies(id, dependencies);
+    }
+
+    // Start loading all dependencies at once (using the priority of the root asset load)
+    root->Locker.Lock();
+    const ContentLoadTask::Priority priority = root->_loadingTask ? root->_loadingTask->GetPriority() : ContentLoadTask::Priority::Prefetch;
+    root->Locker.Unlock();
+    AssetInfo assetInfo;
+    for (const Guid& id : dependencies)
+    {
+        if (GetAsset(id))
+            continue;
+
+        // Skip assets that are being loaded by the other thread
+        LoadCallAssetsLocker.Lock();
+        if (LoadCallAssets.Contains(id))
+        {
+            LoadCallAssetsLocker.Unlock();
+            continue;
+        }
+        LoadCallAssets.Add(id);
+        LoadCallAssetsLocker.Unlock();
+
+        Asset* asset = load(id, Asset::TypeInitializer, assetInfo);
+        if (asset && priority != ContentLoadTask::Priority::Prefetch)
+        {
+            // Propagate priority to the loading tasks that are not yet queued
+            asset->Locker.Lock();
+            for (Task* task = asset->_loadingTask ? asset->_loadingTask->GetContinueWithTask() : nullptr; task; task = task->GetContinueWithTask())
+                ((ContentLoadTask*)task)->SetPriority(priority);
+            asset->Locker.Unlock();
+        }
+
+        LoadCallAssetsLocker.Lock();
+        LoadCallAssets.Remove(id);
+        LoadCallAssetsLocker.Unlock();
+    }
+}
+
 Asset* Content::load(const Guid& id, const ScriptingTypeHandle& type, AssetInfo& assetInfo)
 {
     // Get cached asset info (from registry)
@@ -1047,6 +1146,7 @@ Asset* Content::load(const Guid& id, const ScriptingTypeHandle& type, AssetInfo&
     AssetsLocker.Unlock();
 
     // Start asset loading
+    ContentLoadingManager::Record(id);
     result->startLoading();
 
     return result;
@@ -46,6 +46,11 @@ API_CLASS(Static) class FLAXENGINE_API Content
     /// </summary>
     static TimeSpan AssetsUnloadInterval;
 
+    /// <summary>
+    /// The maximum amount of memory (in bytes) of the assets unloaded in a single frame. Remaining unused assets are unloaded during the next frames to prevent hitches (eg. on level transition). Use 0 to unload all unused assets at once.
+    /// </summary>
+    static uint64 AssetsUnloadBudget;
+
 public:
     /// <summary>
     /// Gets the assets registry.
@@ -367,6 +372,7 @@ API_CLASS(Static) class FLAXENGINE_API Content
     static void onAssetUnload(Asset* asset);
     static void onAssetChangeId(Asset* asset, const Guid& oldId, const Guid& newId);
     static Asset* load(const Guid& id, const ScriptingTypeHandle& type, AssetInfo& assetInfo);
+    static void prefetchDependencies(Asset* root);
 
 private:
     static void deleteFileSafety(const StringView& path, const Guid& id);
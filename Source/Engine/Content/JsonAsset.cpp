@@ -102,6 +102,9 @@ uint64 JsonAssetBase::GetMemoryUsage() const
     result += sizeof(JsonAssetBase) - sizeof(Asset);
     if (Data)
         result += Document.GetAllocator().Capacity();
+#if !USE_EDITOR
+    result += _documentData.Length();
+#endif
     Locker.Unlock();
     return result;
 }
@@ -259,12 +262,31 @@ Asset::LoadResult JsonAssetBase::loadAsset()
     if (storage->LoadAssetChunk(chunk))
         return LoadResult::CannotLoadData;
     auto& data = chunk->Data;
+    if (data.Length() == 0)
+        return LoadResult::MissingDataChunk;
+
+    // Take ownership over the null-terminated json data (cooked with the trailing zero) to parse it in-situ, otherwise use a copy
+    if (data.IsAllocated() && data[data.Length() - 1] == 0)
+    {
+        _documentData.Swap(data);
+    }
+    else
+    {
+        _documentData.Allocate(data.Length() + 1);
+        Platform::MemoryCopy(_documentData.Get(), data.Get(), data.Length());
+        _documentData[data.Length()] = 0;
+    }
 #endif
 
     // Parse json document
     {
         PROFILE_CPU_NAMED("Json.Parse");
+#if USE_EDITOR
         Document.Parse(data.Get<char>(), data.Length());
+#else
+        // Parse in-situ to reference strings directly from the source data without allocating their copies
+        Document.ParseInsitu(_documentData.Get<char>());
+#endif
     }
     if (Document.HasParseError())
     {
@@ -297,6 +319,9 @@ void JsonAssetBase::unload(bool isReloading)
     ISerializable::SerializeDocument tmp;
     Document.Swap(tmp);
     Data = nullptr;
+#if !USE_EDITOR
+    _documentData.Release();
+#endif
     DataTypeName.Clear();
     DataEngineBuild = 0;
     _isVirtualDocument = false;
@@ -5,6 +5,9 @@
 #include "Asset.h"
 #include "Engine/Core/ISerializable.h"
 #include "Engine/Serialization/Json.h"
+#if !USE_EDITOR
+#include "Engine/Core/Types/DataContainer.h"
+#endif
 
 /// <summary>
 /// Base class for all Json-format assets.
@@ -16,6 +19,10 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API JsonAssetBase : public Asset
 protected:
     String _path;
     bool _isVirtualDocument = false;
+#if !USE_EDITOR
+    // The cooked json data that Document has been parsed in-situ from (document strings point into it so it has to live as long as the document)
+    BytesContainer _documentData;
+#endif
 
 protected:
     /// <summary>
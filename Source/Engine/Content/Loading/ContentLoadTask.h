@@ -25,12 +25,22 @@ class ContentLoadTask : public Task
     /// </summary>
     DECLARE_ENUM_5(Result, Ok, AssetLoadError, MissingReferences, LoadDataError, TaskFailed);
 
+    /// <summary>
+    /// Describes work priority (loading threads always pick tasks with the higher priority first). Visible is used for the data required now (eg. streaming of the on-screen resources), Prefetch for regular assets loading and Background for the low priority loads that can wait.
+    /// </summary>
+    DECLARE_ENUM_3(Priority, Visible, Prefetch, Background);
+
 private:
     /// <summary>
     /// Task type
     /// </summary>
     Type _type;
 
+    /// <summary>
+    /// Task priority
+    /// </summary>
+    Priority _priority = Priority::Prefetch;
+
 protected:
     /// <summary>
     /// Initializes a new instance of the <see cref="ContentLoadTask"/> class.
@@ -50,6 +60,23 @@ class ContentLoadTask : public Task
         return _type;
     }
 
+    /// <summary>
+    /// Gets a task priority.
+    /// </summary>
+    FORCE_INLINE Priority GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets a task priority. Has to be called before starting the task.
+    /// </summary>
+    /// <param name="priority">The task priority.</param>
+    FORCE_INLINE void SetPriority(Priority priority)
+    {
+        _priority = priority;
+    }
+
 public:
     /// <summary>
     /// Checks if async task is loading given asset resource
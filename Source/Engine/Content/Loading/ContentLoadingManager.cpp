@@ -5,9 +5,17 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/CPUTopology.h"
 #include "Engine/Platform/Thread.h"
 #include "Engine/Platform/ConditionVariable.h"
 #include "Engine/Content/Config.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/BinaryAsset.h"
+#include "Engine/Content/Loading/Tasks/LoadAssetDataTask.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/FileReadStream.h"
+#include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/ConcurrentTaskQueue.h"
@@ -21,9 +29,30 @@ namespace ContentLoadingManagerImpl
     THREADLOCAL LoadingThread* ThisThread = nullptr;
     LoadingThread* MainThread = nullptr;
     Array<LoadingThread*> Threads;
-    ConcurrentTaskQueue<ContentLoadTask> Tasks;
+    ConcurrentTaskQueue<ContentLoadTask> Tasks[(int32)ContentLoadTask::Priority::Background + 1];
     ConditionVariable TasksSignal;
     CriticalSection TasksMutex;
+    volatile int64 Recording = 0;
+    CriticalSection RecordLocker;
+    Array<ContentLoadRecord> Records;
+    Dictionary<Guid, AssetChunksFlag> RecordsLookup;
+
+    bool TryDequeue(ContentLoadTask*& task)
+    {
+        // Pick the highest priority task
+        for (auto& queue : Tasks)
+        {
+            if (queue.try_dequeue(task))
+                return true;
+        }
+        return false;
+    }
+
+    void Requeue(ContentLoadTask* const* tasks, int32 count)
+    {
+        for (int32 i = 0; i < count; i++)
+            Tasks[(int32)tasks[i]->GetPriority()].Add(tasks[i]);
+    }
 };
 
 using namespace ContentLoadingManagerImpl;
@@ -121,10 +150,11 @@ int32 LoadingThread::Run()
 
     ContentLoadTask* task;
     ThisThread = this;
+    Platform::SetThreadPlacement(ThreadPlacement::Background, 0);
 
     while (HasExitFlagClear())
     {
-        if (Tasks.try_dequeue(task))
+        if (TryDequeue(task))
         {
             Run(task);
         }
@@ -154,7 +184,126 @@ LoadingThread* ContentLoadingManager::GetCurrentLoadThread()
 
 int32 ContentLoadingManager::GetTasksCount()
 {
-    return Tasks.Count();
+    int32 result = 0;
+    for (auto& queue : Tasks)
+        result += queue.Count();
+    return result;
+}
+
+void ContentLoadingManager::BeginRecording()
+{
+    ScopeLock lock(RecordLocker);
+    Records.Clear();
+    RecordsLookup.Clear();
+    Platform::AtomicStore(&Recording, 1);
+}
+
+void ContentLoadingManager::EndRecording(Array<ContentLoadRecord>& result)
+{
+    ScopeLock lock(RecordLocker);
+    Platform::AtomicStore(&Recording, 0);
+    result = MoveTemp(Records);
+    Records.Clear();
+    RecordsLookup.Clear();
+}
+
+bool ContentLoadingManager::IsRecording()
+{
+    return Platform::AtomicRead(&Recording) != 0;
+}
+
+void ContentLoadingManager::Record(const Guid& assetId, AssetChunksFlag chunks)
+{
+    if (Platform::AtomicRead(&Recording) == 0)
+        return;
+    ScopeLock lock(RecordLocker);
+
+    // Record only the first request of the asset and the chunks that were not requested before
+    AssetChunksFlag* recorded = RecordsLookup.TryGet(assetId);
+    if (recorded)
+    {
+        chunks &= ~*recorded;
+        if (chunks == 0)
+            return;
+        *recorded |= chunks;
+    }
+    else
+    {
+        RecordsLookup.Add(assetId, chunks);
+        if (chunks != 0)
+            Records.Add({ assetId, 0 });
+    }
+    Records.Add({ assetId, chunks });
+}
+
+void ContentLoadingManager::Prefetch(const Array<ContentLoadRecord>& records)
+{
+    PROFILE_CPU();
+    for (const ContentLoadRecord& e : records)
+    {
+        Asset* asset = Content::LoadAsync<Asset>(e.AssetID);
+        if (!asset || e.Chunks == 0 || !asset->IsLoaded() || !asset->Is<BinaryAsset>())
+            continue;
+        auto binaryAsset = (BinaryAsset*)asset;
+        if (!binaryAsset->Storage)
+            continue;
+
+        // Prefetch missing chunks
+        AssetChunksFlag chunks = 0;
+        for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
+        {
+            if (GET_CHUNK_FLAG(i) & e.Chunks && !binaryAsset->HasChunkLoaded(i))
+                chunks |= GET_CHUNK_FLAG(i);
+        }
+        if (chunks != 0)
+            New<LoadAssetDataTask>(binaryAsset, chunks, ContentLoadTask::Priority::Prefetch)->Start();
+    }
+}
+
+bool ContentLoadingManager::SavePreloadManifest(const StringView& path, const Array<ContentLoadRecord>& records)
+{
+    auto stream = FileWriteStream::Open(path);
+    if (stream == nullptr)
+        return true;
+    stream->WriteInt32(1); // Version
+    stream->WriteInt32(records.Count());
+    for (const ContentLoadRecord& e : records)
+    {
+        stream->Write(e.AssetID);
+        stream->WriteUint16(e.Chunks);
+    }
+    Delete(stream);
+    return false;
+}
+
+bool ContentLoadingManager::LoadPreloadManifest(const StringView& path, Array<ContentLoadRecord>& records)
+{
+    if (!FileSystem::FileExists(path))
+        return true;
+    auto stream = FileReadStream::Open(path);
+    if (stream == nullptr)
+        return true;
+    int32 version, count;
+    stream->ReadInt32(&version);
+    stream->ReadInt32(&count);
+    bool failed = version != 1 || count < 0 || stream->HasError();
+    if (!failed)
+    {
+        records.Resize(count);
+        for (ContentLoadRecord& e : records)
+        {
+            stream->Read(e.AssetID);
+            stream->ReadUint16(&e.Chunks);
+        }
+        failed = stream->HasError();
+    }
+    Delete(stream);
+    if (failed)
+    {
+        records.Clear();
+        LOG(Warning, "Invalid preload manifest file '{0}'.", path);
+    }
+    return failed;
 }
 
 bool ContentLoadingManagerService::Init()
@@ -207,7 +356,8 @@ void ContentLoadingManagerService::Dispose()
     ThisThread = nullptr;
 
     // Cancel all remaining tasks (no chance to execute them)
-    Tasks.CancelAll();
+    for (auto& queue : Tasks)
+        queue.CancelAll();
 }
 
 String ContentLoadTask::ToString() const
@@ -217,7 +367,7 @@ String ContentLoadTask::ToString() const
 
 void ContentLoadTask::Enqueue()
 {
-    Tasks.Add(this);
+    Tasks[(int32)_priority].Add(this);
     TasksSignal.NotifyOne();
 }
 
@@ -3,11 +3,30 @@
 #pragma once
 
 #include "Engine/Threading/IRunnable.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Content/Storage/AssetHeader.h"
 
 class Asset;
 class LoadingThread;
 class ContentLoadTask;
 
+/// <summary>
+/// The recorded content loading request (see ContentLoadingManager::BeginRecording). Used by the preload manifests.
+/// </summary>
+struct ContentLoadRecord
+{
+    /// <summary>
+    /// The asset id.
+    /// </summary>
+    Guid AssetID;
+
+    /// <summary>
+    /// The requested data chunks of the asset (0 for the asset load request).
+    /// </summary>
+    AssetChunksFlag Chunks;
+};
+
 /// <summary>
 /// Resources loading thread
 /// </summary>
@@ -108,4 +127,50 @@ class ContentLoadingManager
     /// </summary>
     /// <returns>The tasks count.</returns>
     static int32 GetTasksCount();
+
+public:
+    /// <summary>
+    /// Begins recording of the assets and chunks loading requests (in order of the requests).
+    /// </summary>
+    static void BeginRecording();
+
+    /// <summary>
+    /// Ends recording of the loading requests.
+    /// </summary>
+    /// <param name="result">The recorded requests (in order, each asset and chunk is recorded only once).</param>
+    static void EndRecording(Array<ContentLoadRecord>& result);
+
+    /// <summary>
+    /// Checks if loading requests recording is active.
+    /// </summary>
+    static bool IsRecording();
+
+    /// <summary>
+    /// Records the loading request (if recording is active).
+    /// </summary>
+    /// <param name="assetId">The asset id.</param>
+    /// <param name="chunks">The requested data chunks (0 for the asset load request).</param>
+    static void Record(const Guid& assetId, AssetChunksFlag chunks = 0);
+
+    /// <summary>
+    /// Starts loading of the recorded assets and chunks as a single batch (in the order of the records). Chunks are prefetched only for the already loaded assets.
+    /// </summary>
+    /// <param name="records">The loading requests to replay.</param>
+    static void Prefetch(const Array<ContentLoadRecord>& records);
+
+    /// <summary>
+    /// Saves the preload manifest file with the recorded loading requests.
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <param name="records">The loading requests.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool SavePreloadManifest(const StringView& path, const Array<ContentLoadRecord>& records);
+
+    /// <summary>
+    /// Loads the preload manifest file with the recorded loading requests.
+    /// </summary>
+    /// <param name="path">The manifest file path.</param>
+    /// <param name="records">The loaded loading requests.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool LoadPreloadManifest(const StringView& path, Array<ContentLoadRecord>& records);
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "../ContentLoadTask.h"
+#include "../ContentLoadingManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Content/BinaryAsset.h"
@@ -27,12 +28,15 @@ class LoadAssetDataTask : public ContentLoadTask
     /// </summary>
     /// <param name="asset">The asset to load.</param>
     /// <param name="chunks">The chunks to load.</param>
-    LoadAssetDataTask(BinaryAsset* asset, AssetChunksFlag chunks)
+    /// <param name="priority">The loading priority.</param>
+    LoadAssetDataTask(BinaryAsset* asset, AssetChunksFlag chunks, Priority priority = Priority::Prefetch)
         : ContentLoadTask(Type::LoadAssetData)
         , _asset(asset)
         , _chunks(chunks)
         , _dataLock(asset->Storage->Lock())
     {
+        SetPriority(priority);
+        ContentLoadingManager::Record(asset->GetID(), chunks);
     }
 
 public:
@@ -57,29 +61,30 @@ class LoadAssetDataTask : public ContentLoadTask
         const StringView name(ref->GetPath());
 #endif
 
-        // Load chunks
+        // Gather chunks
+        FlaxChunk* chunks[ASSET_FILE_DATA_CHUNKS];
+        int32 chunksCount = 0;
         for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
         {
             if (GET_CHUNK_FLAG(i) & _chunks)
             {
                 const auto chunk = ref->GetChunk(i);
                 if (chunk != nullptr)
-                {
-                    if (IsCancelRequested())
-                        return Result::Ok;
+                    chunks[chunksCount++] = chunk;
+            }
+        }
+        if (chunksCount == 0 || IsCancelRequested())
+            return Result::Ok;
 
-                    // Load it
+        // Load them (adjacent chunks are read at once)
 #if TRACY_ENABLE
-                    ZoneScoped;
-                    ZoneName(*name, name.Length());
+        ZoneScoped;
+        ZoneName(*name, name.Length());
 #endif
-                    if (ref->Storage->LoadAssetChunk(chunk))
-                    {
-                        LOG(Warning, "Cannot load asset \'{0}\' chunk {1}.", ref->ToString(), i);
-                        return Result::LoadDataError;
-                    }
-                }
-            }
+        if (ref->Storage->LoadAssetChunks(chunks, chunksCount))
+        {
+            LOG(Warning, "Cannot load asset \'{0}\' chunks.", ref->ToString());
+            return Result::LoadDataError;
         }
 
         return Result::Ok;
@@ -8,6 +8,7 @@
 #include "Engine/Content/WeakAssetReference.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 
 /// <summary>
 /// Asset loading task object.
@@ -57,6 +58,7 @@ class LoadAssetTask : public ContentLoadTask
     Result run() override
     {
         PROFILE_CPU();
+        PROFILE_MEM(Content);
 
         // Keep valid ref to the asset
         AssetReference<::Asset> ref = Asset.Get();
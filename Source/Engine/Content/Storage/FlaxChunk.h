@@ -19,6 +19,16 @@ enum class FlaxChunkFlags
     /// Compress chunk data using LZ4 algorithm.
     /// </summary>
     CompressedLZ4 = 1,
+
+    /// <summary>
+    /// Compress chunk data as a sequence of the independent LZ4 blocks (see ASSET_FILE_DATA_CHUNK_BLOCK_SIZE) which can be decompressed in parallel. Used with CompressedLZ4 for large chunks.
+    /// </summary>
+    CompressedLZ4Blocks = 2,
+
+    /// <summary>
+    /// Compress chunk data using the built-in dictionary of the common json tokens. Used with CompressedLZ4 for json assets data.
+    /// </summary>
+    DictionaryJson = 4,
 };
 
 DECLARE_ENUM_OPERATORS(FlaxChunkFlags);
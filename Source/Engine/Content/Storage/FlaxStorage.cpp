@@ -6,12 +6,14 @@
 #include "ContentStorageManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #if USE_EDITOR
 #include "Engine/Serialization/JsonWriter.h"
 #include "Engine/Serialization/JsonWriters.h"
@@ -32,6 +34,126 @@ void FlaxChunk::RegisterUsage()
 
 const int32 FlaxStorage::MagicCode = 1180124739;
 
+namespace
+{
+    // Built-in dictionary for the json data compression (see FlaxChunkFlags::DictionaryJson). The most common tokens are placed at the end (LZ4 prefers closer matches).
+    // Warning! Don't modify it - cooked content compressed with it would not load.
+    const char JsonDictionary[] =
+            "\"EngineBuild\":\"Tags\":[\"Tag\":\"HideFlags\":\"IsActive\":false,\"ScaleInLightmap\":\"LODBias\":\"ForcedLOD\":\"SortOrder\":"
+            "\"DrawModes\":\"Color\":{\"R\":\"G\":\"B\":\"A\":1.0},\"Brightness\":\"ShadowsMode\":\"ViewDistance\":\"Radius\":"
+            "\"Control\":\"FlaxEngine.GUI.\"AnchorMin\":\"AnchorMax\":\"Offsets\":{\"Left\":\"Right\":\"Top\":\"Bottom\":\"Margin\":"
+            "\"Buffer\":{\"Entries\":[{\"Material\":\"ReceiveDecals\":true,\"Visible\":true,\"ShadowsMode\":3}\"Model\":\"StaticFlags\":\"Layer\":"
+            "\"PrefabID\":\"PrefabObjectID\":\"Scale\":{\"X\":1.0,\"Y\":1.0,\"Z\":1.0}},\"Orientation\":{\"X\":0.0,\"Y\":0.0,\"Z\":0.0,\"W\":1.0},"
+            "\"Data\":{\"TypeName\":\"FlaxEngine.\"Name\":\"Transform\":{\"Translation\":{\"X\":0.0,\"Y\":0.0,\"Z\":0.0},"
+            "00000000000000000000000000000000\"},{\"ID\":\"\",\"ParentID\":\"";
+
+    int32 CompressLZ4(const char* src, int32 srcSize, char* dst, int32 dstCapacity, FlaxChunkFlags flags)
+    {
+        if (EnumHasAnyFlags(flags, FlaxChunkFlags::DictionaryJson))
+        {
+            LZ4_stream_t stream;
+            LZ4_resetStream(&stream);
+            LZ4_loadDict(&stream, JsonDictionary, sizeof(JsonDictionary) - 1);
+            return LZ4_compress_fast_continue(&stream, src, dst, srcSize, dstCapacity, 1);
+        }
+        return LZ4_compress_default(src, dst, srcSize, dstCapacity);
+    }
+
+    int32 DecompressLZ4(const char* src, int32 srcSize, char* dst, int32 dstCapacity, FlaxChunkFlags flags)
+    {
+        if (EnumHasAnyFlags(flags, FlaxChunkFlags::DictionaryJson))
+            return LZ4_decompress_safe_usingDict(src, dst, srcSize, dstCapacity, JsonDictionary, sizeof(JsonDictionary) - 1);
+        return LZ4_decompress_safe(src, dst, srcSize, dstCapacity);
+    }
+
+    bool CompressChunk(const FlaxChunk* chunk, Array<byte>& result)
+    {
+        PROFILE_CPU_NAMED("CompressLZ4");
+        const char* src = chunk->Data.Get<char>();
+        const int32 srcSize = chunk->Data.Length();
+        if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Blocks))
+        {
+            // Blocks count, compressed blocks sizes and then blocks data
+            const int32 blocksCount = (srcSize + ASSET_FILE_DATA_CHUNK_BLOCK_SIZE - 1) / ASSET_FILE_DATA_CHUNK_BLOCK_SIZE;
+            const int32 headerSize = sizeof(int32) * (blocksCount + 1);
+            result.Resize(headerSize + blocksCount * LZ4_compressBound(ASSET_FILE_DATA_CHUNK_BLOCK_SIZE), false);
+            int32* header = (int32*)result.Get();
+            header[0] = blocksCount;
+            int32 offset = headerSize;
+            for (int32 i = 0; i < blocksCount; i++)
+            {
+                const int32 blockStart = i * ASSET_FILE_DATA_CHUNK_BLOCK_SIZE;
+                const int32 blockSize = Math::Min(ASSET_FILE_DATA_CHUNK_BLOCK_SIZE, srcSize - blockStart);
+                const int32 dstSize = CompressLZ4(src + blockStart, blockSize, (char*)result.Get() + offset, result.Count() - offset, chunk->Flags);
+                if (dstSize <= 0)
+                    return true;
+                header[i + 1] = dstSize;
+                offset += dstSize;
+            }
+            result.Resize(offset);
+        }
+        else
+        {
+            const int32 maxSize = LZ4_compressBound(srcSize);
+            result.Resize(maxSize, false);
+            const int32 dstSize = CompressLZ4(src, srcSize, (char*)result.Get(), maxSize, chunk->Flags);
+            if (dstSize <= 0)
+                return true;
+            result.Resize(dstSize);
+        }
+        return false;
+    }
+
+    bool DecompressChunk(FlaxChunk* chunk, const byte* data, uint32 size)
+    {
+        PROFILE_CPU_NAMED("DecompressLZ4");
+        if (size < sizeof(int32))
+            return true;
+        const int32 originalSize = *(const int32*)data;
+        data += sizeof(int32);
+        size -= sizeof(int32); // Don't count original size int
+        chunk->Data.Allocate(originalSize);
+        char* dst = chunk->Data.Get<char>();
+        if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Blocks))
+        {
+            // Validate blocks header
+            const int32 blocksCount = size >= sizeof(int32) ? *(const int32*)data : 0;
+            const uint32 headerSize = sizeof(int32) * (blocksCount + 1);
+            if (blocksCount != (originalSize + ASSET_FILE_DATA_CHUNK_BLOCK_SIZE - 1) / ASSET_FILE_DATA_CHUNK_BLOCK_SIZE || headerSize > size)
+                return true;
+            const int32* blocksSizes = (const int32*)data + 1;
+            Array<uint32, InlinedAllocation<64>> blocksOffsets;
+            blocksOffsets.Resize(blocksCount);
+            uint32 offset = headerSize;
+            for (int32 i = 0; i < blocksCount; i++)
+            {
+                blocksOffsets[i] = offset;
+                offset += (uint32)blocksSizes[i];
+            }
+            if (offset > size)
+                return true;
+
+            // Decompress blocks in parallel
+            int64 failed = 0;
+            Function<void(int32)> job = [&](int32 i)
+            {
+                const int32 blockStart = i * ASSET_FILE_DATA_CHUNK_BLOCK_SIZE;
+                const int32 blockSize = Math::Min(ASSET_FILE_DATA_CHUNK_BLOCK_SIZE, originalSize - blockStart);
+                const int32 res = DecompressLZ4((const char*)data + blocksOffsets[i], blocksSizes[i], dst + blockStart, blockSize, chunk->Flags);
+                if (res != blockSize)
+                    Platform::AtomicStore(&failed, 1);
+            };
+            JobSystem::Execute(job, blocksCount);
+            return failed != 0;
+        }
+        const int32 res = DecompressLZ4((const char*)data, (int32)size, dst, originalSize, chunk->Flags);
+        if (res <= 0)
+            return true;
+        chunk->Data.SetLength(res);
+        return false;
+    }
+}
+
 FlaxStorage::LockData FlaxStorage::LockData::Invalid(nullptr);
 
 struct Header
@@ -616,70 +738,49 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
 
     LockChunks();
 
-    // Open file
-    auto stream = OpenFile();
-    bool failed = stream == nullptr;
-    if (!failed)
+    // Load data
+    bool failed;
+    const auto size = chunk->LocationInFile.Size;
+    if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
     {
-        // Seek
-        stream->SetPosition(chunk->LocationInFile.Address);
-
-        if (stream->HasError())
+        // Compressed
+        Array<byte> tmpBuf; // TODO: maybe use thread local or content loading pool with sharable temp buffers for the decompression?
+        const byte* data;
+        failed = ReadChunkData(chunk, tmpBuf, data);
+        if (!failed)
         {
-            // Sometimes stream->HasError() from setposition. result in a crash or missing media in release (stream _file._handle = nullptr).
-            // When retrying, it looks like it works and we can continue. We need this to success.
-
-            for (int retry = 0; retry < 5; retry++)
+            // Decompress data
+            failed = DecompressChunk(chunk, data, size);
+            if (failed)
             {
-                Platform::Sleep(50);
-                stream = OpenFile();
-                failed = stream == nullptr;
-                if (!failed)
-                {
-                    stream->SetPosition(chunk->LocationInFile.Address);
-                }
-                if (!stream->HasError())
-                    break;
+                chunk->Data.Release();
+                LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data.", ToString());
             }
         }
-
-        if (stream->HasError())
-        {
-            failed = true;
-            UnlockChunks();
-            LOG(Warning, "SetPosition failed on chunk {0}.", ToString());
-            return failed;
-        }
-
-        // Load data
-        auto size = chunk->LocationInFile.Size;
-        if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+    }
+    else
+    {
+#if ASSET_FILE_MEMORY_MAPPING
+        // Raw data (read-only view into the mapping, valid until file handles get closed)
+        const byte* mappedData = MapFile();
+        if (mappedData && (uint64)chunk->LocationInFile.Address + size <= _mappedSize)
+            chunk->Data.Link(mappedData + chunk->LocationInFile.Address, (int32)size);
+#endif
+        if (chunk->IsMissing())
         {
-            // Compressed
-            size -= sizeof(int32); // Don't count original size int
-            int32 originalSize;
-            stream->ReadInt32(&originalSize);
-            Array<byte> tmpBuf;
-            tmpBuf.Resize(size); // TODO: maybe use thread local or content loading pool with sharable temp buffers for the decompression?
-            stream->ReadBytes(tmpBuf.Get(), size);
-
-            // Decompress data
-            PROFILE_CPU_NAMED("DecompressLZ4");
-            chunk->Data.Allocate(originalSize);
-            const int32 res = LZ4_decompress_safe((const char*)tmpBuf.Get(), chunk->Data.Get<char>(), size, originalSize);
-            if (res <= 0)
-            {
-                UnlockChunks();
-                LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data. Result: {1}.", ToString(), res);
-                return true;
-            }
-            chunk->Data.SetLength(res);
+            // Raw data
+            auto stream = OpenChunk(chunk);
+            failed = stream == nullptr;
+            if (!failed)
+                chunk->Data.Read(stream, size);
         }
         else
         {
-            // Raw data
-            chunk->Data.Read(stream, size);
+            failed = false;
         }
+    }
+    if (!failed)
+    {
         ASSERT(chunk->IsLoaded());
         chunk->RegisterUsage();
     }
@@ -689,6 +790,131 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
     return failed;
 }
 
+static bool SortChunksByLocation(FlaxChunk* const& a, FlaxChunk* const& b)
+{
+    return a->LocationInFile.Address < b->LocationInFile.Address;
+}
+
+bool FlaxStorage::LoadAssetChunks(FlaxChunk* const* chunks, int32 count)
+{
+    // Load chunks in the order of the location in file so adjacent chunks are read sequentially (merged into a single read)
+    Array<FlaxChunk*, InlinedAllocation<ASSET_FILE_DATA_CHUNKS>> sorted;
+    for (int32 i = 0; i < count; i++)
+    {
+        if (!chunks[i]->IsLoaded())
+            sorted.Add(chunks[i]);
+    }
+    if (sorted.Count() == 1)
+        return LoadAssetChunk(sorted[0]);
+    Sorting::QuickSort(sorted.Get(), sorted.Count(), &SortChunksByLocation);
+
+    // Read compressed chunks on the calling thread and decompress them in parallel (decompression of the chunk overlaps with reading the next ones)
+    struct DecompressJob
+    {
+        FlaxChunk* Chunk = nullptr;
+        Array<byte> Buffer;
+        const byte* Data = nullptr;
+        int64 Label = 0;
+    };
+    Array<DecompressJob, InlinedAllocation<ASSET_FILE_DATA_CHUNKS>> jobs;
+    jobs.Resize(sorted.Count());
+    int64 failed = 0;
+    LockChunks();
+    for (int32 i = 0; i < sorted.Count() && failed == 0; i++)
+    {
+        FlaxChunk* chunk = sorted[i];
+        if (EnumHasNoneFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4) || !chunk->ExistsInFile())
+        {
+            failed = LoadAssetChunk(chunk);
+            continue;
+        }
+        auto& job = jobs[i];
+        job.Chunk = chunk;
+        if (ReadChunkData(chunk, job.Buffer, job.Data))
+        {
+            failed = 1;
+            break;
+        }
+        Function<void(int32)> func = [this, &job, &failed](int32)
+        {
+            if (DecompressChunk(job.Chunk, job.Data, job.Chunk->LocationInFile.Size))
+            {
+                job.Chunk->Data.Release();
+                LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data.", ToString());
+                Platform::AtomicStore(&failed, 1);
+            }
+            else
+            {
+                job.Chunk->RegisterUsage();
+            }
+        };
+        job.Label = JobSystem::Dispatch(func);
+    }
+    for (auto& job : jobs)
+    {
+        if (job.Label)
+            JobSystem::Wait(job.Label);
+    }
+    UnlockChunks();
+    return failed != 0;
+}
+
+bool FlaxStorage::ReadChunkData(const FlaxChunk* chunk, Array<byte>& buffer, const byte*& data)
+{
+    const auto size = chunk->LocationInFile.Size;
+#if ASSET_FILE_MEMORY_MAPPING
+    // Access chunk data directly from the file mapping
+    const byte* mappedData = MapFile();
+    if (mappedData && (uint64)chunk->LocationInFile.Address + size <= _mappedSize)
+    {
+        data = mappedData + chunk->LocationInFile.Address;
+        return false;
+    }
+#endif
+    auto stream = OpenChunk(chunk);
+    if (stream == nullptr)
+        return true;
+    buffer.Resize(size, false);
+    stream->ReadBytes(buffer.Get(), size);
+    data = buffer.Get();
+    return stream->HasError();
+}
+
+FileReadStream* FlaxStorage::OpenChunk(const FlaxChunk* chunk)
+{
+    auto stream = OpenFile();
+    if (stream == nullptr)
+        return nullptr;
+
+    // Seek (skipped for the adjacent chunks reads to reuse the stream buffer)
+    if (stream->GetPosition() != chunk->LocationInFile.Address)
+        stream->SetPosition(chunk->LocationInFile.Address);
+
+    if (stream->HasError())
+    {
+        // Sometimes stream->HasError() from setposition. result in a crash or missing media in release (stream _file._handle = nullptr).
+        // When retrying, it looks like it works and we can continue. We need this to success.
+
+        for (int retry = 0; retry < 5; retry++)
+        {
+            Platform::Sleep(50);
+            stream = OpenFile();
+            if (stream == nullptr)
+                return nullptr;
+            stream->SetPosition(chunk->LocationInFile.Address);
+            if (!stream->HasError())
+                break;
+        }
+    }
+
+    if (stream->HasError())
+    {
+        LOG(Warning, "SetPosition failed on chunk {0}.", ToString());
+        return nullptr;
+    }
+    return stream;
+}
+
 #if USE_EDITOR
 
 bool FlaxStorage::ChangeAssetID(Entry& e, const Guid& newId)
@@ -865,19 +1091,13 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
         const FlaxChunk* chunk = chunks[i];
         if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
         {
-            PROFILE_CPU_NAMED("CompressLZ4");
-            const int32 srcSize = chunk->Data.Length();
-            const int32 maxSize = LZ4_compressBound(srcSize);
             auto& chunkCompressed = compressedChunks[i];
-            chunkCompressed.Resize(maxSize);
-            const int32 dstSize = LZ4_compress_default(chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize);
-            if (dstSize <= 0)
+            if (CompressChunk(chunk, chunkCompressed))
             {
                 chunkCompressed.Resize(0);
                 LOG(Warning, "Chunk data LZ4 compression failed.");
                 return true;
             }
-            chunkCompressed.Resize(dstSize);
         }
     }
 
@@ -1302,6 +1522,61 @@ FileReadStream* FlaxStorage::OpenFile()
     return stream;
 }
 
+#if ASSET_FILE_MEMORY_MAPPING
+
+const byte* FlaxStorage::MapFile()
+{
+    ScopeLock lock(_mappingLocker);
+    if (!_mappedData && !_mappingFailed)
+    {
+        _mappedFile = File::Open(_path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+        _mappedData = _mappedFile ? _mappedFile->Map() : nullptr;
+        if (_mappedData)
+        {
+            _mappedSize = _mappedFile->GetSize();
+        }
+        else
+        {
+            // Fallback to the file streams
+            _mappingFailed = true;
+            if (_mappedFile)
+            {
+                Delete(_mappedFile);
+                _mappedFile = nullptr;
+            }
+        }
+    }
+    return _mappedData;
+}
+
+void FlaxStorage::UnmapFile()
+{
+    ScopeLock lock(_mappingLocker);
+    if (_mappedData)
+    {
+        // Detach loaded chunks from the mapping (copy data before the view gets released)
+        for (FlaxChunk* chunk : _chunks)
+        {
+            if (chunk->IsLoaded() && chunk->Get() >= _mappedData && chunk->Get() < _mappedData + _mappedSize)
+            {
+                BytesContainer data;
+                data.Copy(chunk->Data);
+                chunk->Data.Swap(data);
+            }
+        }
+    }
+    if (_mappedFile)
+    {
+        Delete(_mappedFile);
+        _mappedFile = nullptr;
+    }
+    _mappedData = nullptr;
+    _mappedSize = 0;
+    _mappingFailed = false;
+}
+
+#endif
+
 void FlaxStorage::CloseFileHandles()
 {
     // Note: this is usually called by the content manager when this file is not used or on exit
@@ -1329,6 +1604,9 @@ void FlaxStorage::CloseFileHandles()
     ASSERT(_chunksLock == 0);
 
     _file.DeleteAll();
+#if ASSET_FILE_MEMORY_MAPPING
+    UnmapFile();
+#endif
 }
 
 void FlaxStorage::Dispose()
@@ -96,6 +96,13 @@ class FLAXENGINE_API FlaxStorage : public Object
     // Storage
     ThreadLocalObject<FileReadStream> _file;
     Array<FlaxChunk*> _chunks;
+#if ASSET_FILE_MEMORY_MAPPING
+    CriticalSection _mappingLocker;
+    File* _mappedFile = nullptr;
+    const byte* _mappedData = nullptr;
+    uint32 _mappedSize = 0;
+    bool _mappingFailed = false;
+#endif
 
     // Metadata
     uint32 _version;
@@ -384,6 +391,14 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// <returns>True if cannot load data, otherwise false</returns>
     bool LoadAssetChunk(FlaxChunk* chunk);
 
+    /// <summary>
+    /// Loads the asset chunks. Chunks are loaded in the order of their location in the file so the adjacent chunks are read with a single sequential read. Compressed chunks are decompressed in parallel via Job System.
+    /// </summary>
+    /// <param name="chunks">The chunks.</param>
+    /// <param name="count">The chunks count.</param>
+    /// <returns>True if cannot load data, otherwise false</returns>
+    bool LoadAssetChunks(FlaxChunk* const* chunks, int32 count);
+
 #if USE_EDITOR
 
     /// <summary>
@@ -487,5 +502,11 @@ class FLAXENGINE_API FlaxStorage : public Object
     void AddChunk(FlaxChunk* chunk);
     virtual void AddEntry(Entry& e) = 0;
     FileReadStream* OpenFile();
+    FileReadStream* OpenChunk(const FlaxChunk* chunk);
+    bool ReadChunkData(const FlaxChunk* chunk, Array<byte>& buffer, const byte*& data);
+#if ASSET_FILE_MEMORY_MAPPING
+    const byte* MapFile();
+    void UnmapFile();
+#endif
     virtual bool GetEntry(const Guid& id, Entry& e) = 0;
 };
@@ -228,6 +228,27 @@ CreateAssetResult ImportModelFile::ImportModel(CreateAssetContext& context, Mode
         if (context.AllocateChunk(chunkIndex))
             return CreateAssetResult::CannotAllocateChunk;
         context.Data.Header.Chunks[chunkIndex]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+
+        // Pack meshlets (optional)
+        bool hasMeshlets = meshes.HasItems();
+        for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+            hasMeshlets &= meshes[meshIndex]->Meshlets.HasItems();
+        if (hasMeshlets)
+        {
+            stream.SetPosition(0);
+            stream.WriteInt32(1); // Version
+            stream.WriteInt32(meshes.Count());
+            for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+            {
+                const auto& meshlets = meshes[meshIndex]->Meshlets;
+                stream.WriteInt32(meshlets.Count());
+                stream.WriteBytes(meshlets.Get(), meshlets.Count() * sizeof(MeshletData));
+            }
+            const int32 meshletsChunkIndex = MODEL_LOD_TO_MESHLETS_CHUNK_INDEX(lodIndex);
+            if (context.AllocateChunk(meshletsChunkIndex))
+                return CreateAssetResult::CannotAllocateChunk;
+            context.Data.Header.Chunks[meshletsChunkIndex]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+        }
     }
 
     // Generate SDF
@@ -0,0 +1,962 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+#include "Engine/Core/Collections/Config.h"
+#if PLATFORM_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// The amount of slots in a single group of the flat dictionary (probed at once).
+/// </summary>
+#define FLAT_DICTIONARY_GROUP_SIZE 16
+
+namespace FlatDictionaryImpl
+{
+    // Control byte values (occupied slots store 7 bits of the key hash as a positive value)
+    enum : int8
+    {
+        CtrlEmpty = -128,
+        CtrlDeleted = -2,
+    };
+
+    FORCE_INLINE uint32 FindFirstBit(uint32 mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    // Returns the bit mask of slots within the group that match the given control byte.
+    FORCE_INLINE uint32 Match(const int8* group, int8 value)
+    {
+#if PLATFORM_SIMD_SSE2
+        const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+        return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+        uint32 mask = 0;
+        for (int32 i = 0; i < FLAT_DICTIONARY_GROUP_SIZE; i++)
+            mask |= (uint32)(group[i] == value) << i;
+        return mask;
+#endif
+    }
+
+    // Returns the bit mask of the empty or deleted slots within the group.
+    FORCE_INLINE uint32 MatchFree(const int8* group)
+    {
+#if PLATFORM_SIMD_SSE2
+        // Empty and deleted control bytes are the only negative values
+        return (uint32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+        uint32 mask = 0;
+        for (int32 i = 0; i < FLAT_DICTIONARY_GROUP_SIZE; i++)
+            mask |= (uint32)(group[i] < 0) << i;
+        return mask;
+#endif
+    }
+}
+
+/// <summary>
+/// Template for unordered dictionary with mapped key with value pairs that uses open-addressing with a flat layout (swiss-table style).
+/// Stores a separate array of control bytes (7 bits of the key hash per slot) which is probed in groups of 16 slots at once with SIMD instructions, so lookups touch the key and value data only for likely matches.
+/// Provides the same API as Dictionary so it can be used as a drop-in replacement for large, lookup-heavy maps (eg. objects registries).
+/// </summary>
+/// <typeparam name="KeyType">The type of the keys in the dictionary.</typeparam>
+/// <typeparam name="ValueType">The type of the values in the dictionary.</typeparam>
+/// <typeparam name="AllocationType">The type of memory allocator.</typeparam>
+template<typename KeyType, typename ValueType, typename AllocationType = HeapAllocation>
+class FlatDictionary
+{
+    friend FlatDictionary;
+public:
+    /// <summary>
+    /// Describes single portion of space for the key and value pair in a hash map.
+    /// </summary>
+    struct Bucket
+    {
+        /// <summary>The key.</summary>
+        KeyType Key;
+        /// <summary>The value.</summary>
+        ValueType Value;
+    };
+
+    typedef typename AllocationType::template Data<Bucket> AllocationData;
+    typedef typename AllocationType::template Data<int8> ControlAllocationData;
+
+private:
+    int32 _elementsCount = 0;
+    int32 _deletedCount = 0;
+    int32 _size = 0;
+    AllocationData _allocation;
+    ControlAllocationData _control;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    FlatDictionary()
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="capacity">The initial capacity.</param>
+    FlatDictionary(int32 capacity)
+    {
+        SetCapacity(capacity);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    FlatDictionary(FlatDictionary&& other) noexcept
+        : _elementsCount(other._elementsCount)
+        , _deletedCount(other._deletedCount)
+        , _size(other._size)
+    {
+        other._elementsCount = 0;
+        other._deletedCount = 0;
+        other._size = 0;
+        _allocation.Swap(other._allocation);
+        _control.Swap(other._control);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="other">Other collection to copy</param>
+    FlatDictionary(const FlatDictionary& other)
+    {
+        Clone(other);
+    }
+
+    /// <summary>
+    /// Clones the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    /// <returns>The reference to this.</returns>
+    FlatDictionary& operator=(const FlatDictionary& other)
+    {
+        if (this != &other)
+            Clone(other);
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    /// <returns>The reference to this.</returns>
+    FlatDictionary& operator=(FlatDictionary&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            _allocation.Free();
+            _control.Free();
+            _elementsCount = other._elementsCount;
+            _deletedCount = other._deletedCount;
+            _size = other._size;
+            other._elementsCount = 0;
+            other._deletedCount = 0;
+            other._size = 0;
+            _allocation.Swap(other._allocation);
+            _control.Swap(other._control);
+        }
+        return *this;
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    ~FlatDictionary()
+    {
+        Clear();
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the elements in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _elementsCount;
+    }
+
+    /// <summary>
+    /// Gets the amount of the elements that can be contained by the collection.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _size;
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _elementsCount == 0;
+    }
+
+    /// <summary>
+    /// Returns true if collection has one or more elements.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _elementsCount != 0;
+    }
+
+public:
+    /// <summary>
+    /// The FlatDictionary collection iterator.
+    /// </summary>
+    struct Iterator
+    {
+        friend FlatDictionary;
+    private:
+        FlatDictionary& _collection;
+        int32 _index;
+
+    public:
+        Iterator(FlatDictionary& collection, const int32 index)
+            : _collection(collection)
+            , _index(index)
+        {
+        }
+
+        Iterator(FlatDictionary const& collection, const int32 index)
+            : _collection((FlatDictionary&)collection)
+            , _index(index)
+        {
+        }
+
+        Iterator(const Iterator& i)
+            : _collection(i._collection)
+            , _index(i._index)
+        {
+        }
+
+        Iterator(Iterator&& i)
+            : _collection(i._collection)
+            , _index(i._index)
+        {
+        }
+
+    public:
+        FORCE_INLINE int32 Index() const
+        {
+            return _index;
+        }
+
+        FORCE_INLINE bool IsEnd() const
+        {
+            return _index == _collection._size;
+        }
+
+        FORCE_INLINE bool IsNotEnd() const
+        {
+            return _index != _collection._size;
+        }
+
+        FORCE_INLINE Bucket& operator*() const
+        {
+            return _collection._allocation.Get()[_index];
+        }
+
+        FORCE_INLINE Bucket* operator->() const
+        {
+            return &_collection._allocation.Get()[_index];
+        }
+
+        FORCE_INLINE explicit operator bool() const
+        {
+            return _index >= 0 && _index < _collection._size;
+        }
+
+        FORCE_INLINE bool operator!() const
+        {
+            return !(bool)*this;
+        }
+
+        FORCE_INLINE bool operator==(const Iterator& v) const
+        {
+            return _index == v._index && &_collection == &v._collection;
+        }
+
+        FORCE_INLINE bool operator!=(const Iterator& v) const
+        {
+            return _index != v._index || &_collection != &v._collection;
+        }
+
+        Iterator& operator=(const Iterator& v)
+        {
+            _collection = v._collection;
+            _index = v._index;
+            return *this;
+        }
+
+        Iterator& operator++()
+        {
+            const int32 capacity = _collection.Capacity();
+            if (_index != capacity)
+            {
+                const int8* control = _collection._control.Get();
+                do
+                {
+                    _index++;
+                } while (_index != capacity && control[_index] < 0);
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) const
+        {
+            Iterator i = *this;
+            ++i;
+            return i;
+        }
+
+        Iterator& operator--()
+        {
+            if (_index > 0)
+            {
+                const int8* control = _collection._control.Get();
+                do
+                {
+                    _index--;
+                } while (_index > 0 && control[_index] < 0);
+            }
+            return *this;
+        }
+
+        Iterator operator--(int) const
+        {
+            Iterator i = *this;
+            --i;
+            return i;
+        }
+    };
+
+public:
+    /// <summary>
+    /// Gets element by the key (will add default ValueType element if key not found).
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    ValueType& At(const KeyComparableType& key)
+    {
+        const uint32 hash = GetSlotsHash(key);
+        if (_size != 0)
+        {
+            const int32 index = FindIndex(key, hash);
+            if (index != -1)
+                return _allocation.Get()[index].Value;
+        }
+
+        // Insert
+        const int32 index = Insert(hash);
+        Bucket* bucket = &_allocation.Get()[index];
+        Memory::ConstructItems(&bucket->Key, &key, 1);
+        Memory::ConstructItem(&bucket->Value);
+        return bucket->Value;
+    }
+
+    /// <summary>
+    /// Gets the element by the key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    const ValueType& At(const KeyComparableType& key) const
+    {
+        ASSERT(_size);
+        const int32 index = FindIndex(key, GetSlotsHash(key));
+        ASSERT(index != -1);
+        return _allocation.Get()[index].Value;
+    }
+
+    /// <summary>
+    /// Gets or sets the element by the key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE ValueType& operator[](const KeyComparableType& key)
+    {
+        return At(key);
+    }
+
+    /// <summary>
+    /// Gets or sets the element by the key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE const ValueType& operator[](const KeyComparableType& key) const
+    {
+        return At(key);
+    }
+
+    /// <summary>
+    /// Tries to get element with given key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <param name="result">The result value.</param>
+    /// <returns>True if element of given key has been found, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool TryGet(const KeyComparableType& key, ValueType& result) const
+    {
+        if (IsEmpty())
+            return false;
+        const int32 index = FindIndex(key, GetSlotsHash(key));
+        if (index == -1)
+            return false;
+        result = _allocation.Get()[index].Value;
+        return true;
+    }
+
+    /// <summary>
+    /// Tries to get pointer to the element with given key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>Pointer to the element value or null if cannot find it.</returns>
+    template<typename KeyComparableType>
+    ValueType* TryGet(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return nullptr;
+        const int32 index = FindIndex(key, GetSlotsHash(key));
+        if (index == -1)
+            return nullptr;
+        return (ValueType*)&_allocation.Get()[index].Value;
+    }
+
+public:
+    /// <summary>
+    /// Clears the collection but without changing its capacity (all inserted elements: keys and values will be removed).
+    /// </summary>
+    void Clear()
+    {
+        if (_elementsCount + _deletedCount != 0)
+        {
+            Bucket* data = _allocation.Get();
+            int8* control = _control.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (control[i] >= 0)
+                {
+                    Memory::DestructItem(&data[i].Key);
+                    Memory::DestructItem(&data[i].Value);
+                }
+                control[i] = FlatDictionaryImpl::CtrlEmpty;
+            }
+            _elementsCount = _deletedCount = 0;
+        }
+    }
+
+    /// <summary>
+    /// Clears the collection and delete value objects.
+    /// Note: collection must contain pointers to the objects that have public destructor and be allocated using New method.
+    /// </summary>
+#if defined(_MSC_VER)
+    template<typename = typename TEnableIf<TIsPointer<ValueType>::Value>::Type>
+#endif
+    void ClearDelete()
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value)
+                Delete(i->Value);
+        }
+        Clear();
+    }
+
+    /// <summary>
+    /// Changes the capacity of the collection.
+    /// </summary>
+    /// <param name="capacity">The new capacity.</param>
+    /// <param name="preserveContents">Enables preserving collection contents during resizing.</param>
+    void SetCapacity(int32 capacity, bool preserveContents = true)
+    {
+        ASSERT(capacity >= 0);
+        if (preserveContents && capacity < GetSlotsForCount(_elementsCount))
+            capacity = GetSlotsForCount(_elementsCount);
+        if (capacity != 0)
+        {
+            // Align capacity value to the next power of two (and the whole groups)
+            if (capacity < FLAT_DICTIONARY_GROUP_SIZE)
+                capacity = FLAT_DICTIONARY_GROUP_SIZE;
+            if ((capacity & (capacity - 1)) != 0)
+            {
+                // Reference: http://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2
+                capacity--;
+                capacity |= capacity >> 1;
+                capacity |= capacity >> 2;
+                capacity |= capacity >> 4;
+                capacity |= capacity >> 8;
+                capacity |= capacity >> 16;
+                capacity++;
+            }
+        }
+        if (capacity == Capacity())
+            return;
+        Rehash(capacity, preserveContents);
+    }
+
+    /// <summary>
+    /// Ensures that collection has given capacity.
+    /// </summary>
+    /// <param name="minCapacity">The minimum required capacity.</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void EnsureCapacity(int32 minCapacity, bool preserveContents = true)
+    {
+        // Include the maximum load factor of the slots
+        minCapacity = GetSlotsForCount(minCapacity);
+        if (_size >= minCapacity)
+            return;
+        if (minCapacity < DICTIONARY_DEFAULT_CAPACITY)
+            minCapacity = DICTIONARY_DEFAULT_CAPACITY;
+        const int32 capacity = _allocation.CalculateCapacityGrow(_size, minCapacity);
+        SetCapacity(capacity, preserveContents);
+    }
+
+    /// <summary>
+    /// Swaps the contents of collection with the other object without copy operation. Performs fast internal data exchange.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
+    void Swap(FlatDictionary& other)
+    {
+        ::Swap(_elementsCount, other._elementsCount);
+        ::Swap(_deletedCount, other._deletedCount);
+        ::Swap(_size, other._size);
+        _allocation.Swap(other._allocation);
+        _control.Swap(other._control);
+    }
+
+private:
+    void Rehash(int32 capacity, bool preserveContents)
+    {
+        AllocationData oldAllocation;
+        ControlAllocationData oldControl;
+        oldAllocation.Swap(_allocation);
+        oldControl.Swap(_control);
+        const int32 oldSize = _size;
+        const int32 oldElementsCount = _elementsCount;
+        _deletedCount = _elementsCount = 0;
+        if (capacity)
+        {
+            _allocation.Allocate(capacity);
+            _control.Allocate(capacity);
+            Platform::MemorySet(_control.Get(), capacity, (int32)(uint8)FlatDictionaryImpl::CtrlEmpty);
+        }
+        _size = capacity;
+        Bucket* oldData = oldAllocation.Get();
+        const int8* oldControlData = oldControl.Get();
+        if (oldElementsCount != 0)
+        {
+            for (int32 i = 0; i < oldSize; i++)
+            {
+                if (oldControlData[i] < 0)
+                    continue;
+                Bucket& oldBucket = oldData[i];
+                if (preserveContents)
+                {
+                    // Move key and value into the new slot (no need to check for duplicates)
+                    const int32 index = InsertSlot(GetSlotsHash(oldBucket.Key));
+                    Bucket* bucket = &_allocation.Get()[index];
+                    Memory::MoveItems(&bucket->Key, &oldBucket.Key, 1);
+                    Memory::MoveItems(&bucket->Value, &oldBucket.Value, 1);
+                }
+                Memory::DestructItem(&oldBucket.Key);
+                Memory::DestructItem(&oldBucket.Value);
+            }
+        }
+    }
+
+public:
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="value">The value.</param>
+    /// <returns>Weak reference to the stored bucket.</returns>
+    template<typename KeyComparableType>
+    Bucket* Add(const KeyComparableType& key, const ValueType& value)
+    {
+        const uint32 hash = GetSlotsHash(key);
+        ASSERT((_size == 0 || FindIndex(key, hash) == -1) && "That key has been already added to the dictionary.");
+        const int32 index = Insert(hash);
+        Bucket* bucket = &_allocation.Get()[index];
+        Memory::ConstructItems(&bucket->Key, &key, 1);
+        Memory::ConstructItems(&bucket->Value, &value, 1);
+        return bucket;
+    }
+
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="value">The value.</param>
+    /// <returns>Weak reference to the stored bucket.</returns>
+    template<typename KeyComparableType>
+    Bucket* Add(const KeyComparableType& key, ValueType&& value)
+    {
+        const uint32 hash = GetSlotsHash(key);
+        ASSERT((_size == 0 || FindIndex(key, hash) == -1) && "That key has been already added to the dictionary.");
+        const int32 index = Insert(hash);
+        Bucket* bucket = &_allocation.Get()[index];
+        Memory::ConstructItems(&bucket->Key, &key, 1);
+        Memory::MoveItems(&bucket->Value, &value, 1);
+        return bucket;
+    }
+
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="i">Iterator with key and value.</param>
+    void Add(const Iterator& i)
+    {
+        ASSERT(&i._collection != this && i);
+        const Bucket& bucket = *i;
+        Add(bucket.Key, bucket.Value);
+    }
+
+    /// <summary>
+    /// Removes element with a specified key.
+    /// </summary>
+    /// <param name="key">The element key to remove.</param>
+    /// <returns>True if cannot remove item from the collection because cannot find it, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool Remove(const KeyComparableType& key)
+    {
+        if (IsEmpty())
+            return false;
+        const int32 index = FindIndex(key, GetSlotsHash(key));
+        if (index != -1)
+        {
+            RemoveAt(index);
+            return true;
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Removes element at specified iterator.
+    /// </summary>
+    /// <param name="i">The element iterator to remove.</param>
+    /// <returns>True if cannot remove item from the collection because cannot find it, otherwise false.</returns>
+    bool Remove(const Iterator& i)
+    {
+        ASSERT(&i._collection == this);
+        if (i)
+        {
+            ASSERT(_control.Get()[i._index] >= 0);
+            RemoveAt(i._index);
+            return true;
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Removes elements with a specified value
+    /// </summary>
+    /// <param name="value">Element value to remove</param>
+    /// <returns>The amount of removed items. Zero if nothing changed.</returns>
+    int32 RemoveValue(const ValueType& value)
+    {
+        int32 result = 0;
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value == value)
+            {
+                Remove(i);
+                result++;
+            }
+        }
+        return result;
+    }
+
+public:
+    /// <summary>
+    /// Finds the element with given key in the collection.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <returns>The iterator for the found element or End if cannot find it.</returns>
+    template<typename KeyComparableType>
+    Iterator Find(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return End();
+        const int32 index = FindIndex(key, GetSlotsHash(key));
+        return index != -1 ? Iterator(*this, index) : End();
+    }
+
+    /// <summary>
+    /// Checks if given key is in a collection.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <returns>True if key has been found in a collection, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool ContainsKey(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return false;
+        return FindIndex(key, GetSlotsHash(key)) != -1;
+    }
+
+    /// <summary>
+    /// Checks if given value is in a collection.
+    /// </summary>
+    /// <param name="value">The value to find.</param>
+    /// <returns>True if value has been found in a collection, otherwise false.</returns>
+    bool ContainsValue(const ValueType& value) const
+    {
+        if (HasItems())
+        {
+            const Bucket* data = _allocation.Get();
+            const int8* control = _control.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (control[i] >= 0 && data[i].Value == value)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Searches for the specified object and returns the zero-based index of the first occurrence within the entire dictionary.
+    /// </summary>
+    /// <param name="value">The value of the key to find.</param>
+    /// <param name="key">The output key.</param>
+    /// <returns>True if value has been found, otherwise false.</returns>
+    bool KeyOf(const ValueType& value, KeyType* key) const
+    {
+        if (HasItems())
+        {
+            const Bucket* data = _allocation.Get();
+            const int8* control = _control.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (control[i] >= 0 && data[i].Value == value)
+                {
+                    if (key)
+                        *key = data[i].Key;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+public:
+    /// <summary>
+    /// Clones other collection into this.
+    /// </summary>
+    /// <param name="other">The other collection to clone.</param>
+    void Clone(const FlatDictionary& other)
+    {
+        Clear();
+        SetCapacity(other.Capacity(), false);
+        for (Iterator i = other.Begin(); i != other.End(); ++i)
+            Add(i);
+        ASSERT(Count() == other.Count());
+        ASSERT(Capacity() == other.Capacity());
+    }
+
+    /// <summary>
+    /// Gets the keys collection to the output array (will contain unique items).
+    /// </summary>
+    /// <param name="result">The result.</param>
+    template<typename ArrayAllocation>
+    void GetKeys(Array<KeyType, ArrayAllocation>& result) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+            result.Add(i->Key);
+    }
+
+    /// <summary>
+    /// Gets the values collection to the output array (may contain duplicates).
+    /// </summary>
+    /// <param name="result">The result.</param>
+    template<typename ArrayAllocation>
+    void GetValues(Array<ValueType, ArrayAllocation>& result) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+            result.Add(i->Value);
+    }
+
+public:
+    Iterator Begin() const
+    {
+        Iterator i(*this, -1);
+        ++i;
+        return i;
+    }
+
+    Iterator End() const
+    {
+        return Iterator(*this, _size);
+    }
+
+    Iterator begin()
+    {
+        Iterator i(*this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE Iterator end()
+    {
+        return Iterator(*this, _size);
+    }
+
+    const Iterator begin() const
+    {
+        Iterator i(*this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE const Iterator end() const
+    {
+        return Iterator(*this, _size);
+    }
+
+protected:
+    template<typename KeyComparableType>
+    FORCE_INLINE static uint32 GetSlotsHash(const KeyComparableType& key)
+    {
+        // Mix the key hash (fibonacci hashing) since many keys use identity hash which results in clustered low bits
+        return GetHash(key) * 0x9E3779B1u;
+    }
+
+    FORCE_INLINE static int32 GetSlotsForCount(int32 count)
+    {
+        return count != 0 ? count + count / 7 + 1 : 0;
+    }
+
+    FORCE_INLINE static int8 GetControl(uint32 hash)
+    {
+        // Top 7 bits of the hash are stored in the control byte, the remaining bits pick the group to probe from
+        return (int8)(hash >> 25);
+    }
+
+    /// <summary>
+    /// Finds the slot index of the given key (or -1 if it's missing). Probes whole groups of control bytes at once.
+    /// </summary>
+    template<typename KeyComparableType>
+    int32 FindIndex(const KeyComparableType& key, uint32 hash) const
+    {
+        ASSERT(_size);
+        const int32 groupsMask = _size / FLAT_DICTIONARY_GROUP_SIZE - 1;
+        const int8 ctrl = GetControl(hash);
+        const int8* control = _control.Get();
+        const Bucket* data = _allocation.Get();
+        int32 groupIndex = (int32)hash & groupsMask;
+        for (int32 probe = 1; probe <= groupsMask + 1; probe++)
+        {
+            const int32 groupStart = groupIndex * FLAT_DICTIONARY_GROUP_SIZE;
+            const int8* group = control + groupStart;
+            uint32 mask = FlatDictionaryImpl::Match(group, ctrl);
+            while (mask)
+            {
+                const int32 index = groupStart + FlatDictionaryImpl::FindFirstBit(mask);
+                if (data[index].Key == key)
+                    return index;
+                mask &= mask - 1;
+            }
+
+            // Stop on the first group with an empty slot (the key would be placed there)
+            if (FlatDictionaryImpl::Match(group, FlatDictionaryImpl::CtrlEmpty))
+                break;
+
+            // Triangular numbers probing visits all groups for power of two groups count
+            groupIndex = (groupIndex + probe) & groupsMask;
+        }
+        return -1;
+    }
+
+    /// <summary>
+    /// Finds the free slot for the key with a given hash (key has to be unique), marks it as occupied and returns its index. Grows the collection if needed.
+    /// </summary>
+    int32 Insert(uint32 hash)
+    {
+        // Grow at 7/8 load factor (deleted slots count too since they don't stop probing)
+        if (_size == 0 || (_elementsCount + _deletedCount + 1) * 8 > _size * 7)
+        {
+            if (_deletedCount > _elementsCount)
+            {
+                // Rehash in-place to drop deleted slots
+                Rehash(_size, true);
+            }
+            else
+            {
+                EnsureCapacity(_elementsCount + 1);
+                if ((_elementsCount + _deletedCount + 1) * 8 > _size * 7)
+                    Rehash(_size * 2, true);
+            }
+        }
+        return InsertSlot(hash);
+    }
+
+    /// <summary>
+    /// Finds the free slot for the key with a given hash and marks it as occupied. Doesn't grow the collection.
+    /// </summary>
+    int32 InsertSlot(uint32 hash)
+    {
+        const int32 groupsMask = _size / FLAT_DICTIONARY_GROUP_SIZE - 1;
+        int8* control = _control.Get();
+        int32 groupIndex = (int32)hash & groupsMask;
+        for (int32 probe = 1;; probe++)
+        {
+            const int32 groupStart = groupIndex * FLAT_DICTIONARY_GROUP_SIZE;
+            const uint32 mask = FlatDictionaryImpl::MatchFree(control + groupStart);
+            if (mask)
+            {
+                const int32 index = groupStart + FlatDictionaryImpl::FindFirstBit(mask);
+                if (control[index] == FlatDictionaryImpl::CtrlDeleted)
+                    _deletedCount--;
+                control[index] = GetControl(hash);
+                _elementsCount++;
+                return index;
+            }
+            groupIndex = (groupIndex + probe) & groupsMask;
+        }
+    }
+
+    void RemoveAt(int32 index)
+    {
+        Bucket& bucket = _allocation.Get()[index];
+        Memory::DestructItem(&bucket.Key);
+        Memory::DestructItem(&bucket.Value);
+        int8* control = _control.Get();
+        const int32 groupStart = index & ~(FLAT_DICTIONARY_GROUP_SIZE - 1);
+        _elementsCount--;
+        if (FlatDictionaryImpl::Match(control + groupStart, FlatDictionaryImpl::CtrlEmpty))
+        {
+            // Group has an empty slot so no probe sequence passes through it and the slot can be freed
+            control[index] = FlatDictionaryImpl::CtrlEmpty;
+        }
+        else
+        {
+            control[index] = FlatDictionaryImpl::CtrlDeleted;
+            _deletedCount++;
+        }
+    }
+};
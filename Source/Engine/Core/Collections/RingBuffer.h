@@ -74,6 +74,16 @@ class RingBuffer
         return _allocation.Get()[_front];
     }
 
+    FORCE_INLINE T& PeekBack()
+    {
+        return _allocation.Get()[(_back + _capacity - 1) % _capacity];
+    }
+
+    FORCE_INLINE const T& PeekBack() const
+    {
+        return _allocation.Get()[(_back + _capacity - 1) % _capacity];
+    }
+
     FORCE_INLINE T& operator[](int32 index)
     {
         ASSERT(index >= 0 && index < _count);
@@ -93,6 +103,13 @@ class RingBuffer
         _count--;
     }
 
+    void PopBack()
+    {
+        _back = (_back + _capacity - 1) % _capacity;
+        Memory::DestructItems(_allocation.Get() + _back, 1);
+        _count--;
+    }
+
     void Clear()
     {
         Memory::DestructItems(Get() + Math::Min(_front, _back), _count);
@@ -1,8 +1,17 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Sorting.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Memory/Memory.h"
 #include "Engine/Threading/ThreadLocal.h"
+#include "Engine/Threading/JobSystem.h"
+
+// The minimum amount of elements to sort by a single job in the parallel radix sort
+#define RADIX_SORT_PARALLEL_CHUNK_SIZE 4096
+#define RADIX_SORT_PARALLEL_MAX_JOBS 32
+#define RADIX_SORT_PARALLEL_BITS 8
+#define RADIX_SORT_PARALLEL_HISTOGRAM_SIZE (1 << RADIX_SORT_PARALLEL_BITS)
+#define RADIX_SORT_PARALLEL_BIT_MASK (RADIX_SORT_PARALLEL_HISTOGRAM_SIZE - 1)
 
 // Use a cached storage for the sorting (one per thread to reduce locking)
 ThreadLocal<Sorting::SortingStack> SortingStacks;
@@ -50,3 +59,103 @@ void Sorting::SortingStack::EnsureCapacity(int32 minCapacity)
         num = minCapacity;
     SetCapacity(num);
 }
+
+void Sorting::RadixSortParallel(uint64*& inputKeys, int32*& inputValues, uint64* tmpKeys, int32* tmpValues, int32 count)
+{
+    const int32 jobsCount = Math::Min(Math::Min(JobSystem::GetThreadsCount() + 1, RADIX_SORT_PARALLEL_MAX_JOBS), count / RADIX_SORT_PARALLEL_CHUNK_SIZE);
+    if (jobsCount < 2)
+    {
+        RadixSort(inputKeys, inputValues, tmpKeys, tmpValues, count);
+        return;
+    }
+    const int32 chunkSize = (count + jobsCount - 1) / jobsCount;
+
+    uint64* keys = inputKeys;
+    uint64* tempKeys = tmpKeys;
+    int32* values = inputValues;
+    int32* tempValues = tmpValues;
+    uint32 shift = 0;
+    uint64 diffs[RADIX_SORT_PARALLEL_MAX_JOBS];
+    bool sorted[RADIX_SORT_PARALLEL_MAX_JOBS];
+    auto histograms = (uint32(*)[RADIX_SORT_PARALLEL_HISTOGRAM_SIZE])Allocator::Allocate(jobsCount * RADIX_SORT_PARALLEL_HISTOGRAM_SIZE * sizeof(uint32));
+
+    // Find the key bits that differ between the elements (to skip passes over the same digits) and check if data is already sorted
+    Function<void(int32)> analyzeJob = [&](int32 jobIndex)
+    {
+        const int32 start = jobIndex * chunkSize;
+        const int32 end = Math::Min(start + chunkSize, count);
+        const uint64 first = keys[0];
+        uint64 diff = 0;
+        bool isSorted = start == 0 || keys[start - 1] <= keys[start];
+        for (int32 i = start; i < end; i++)
+        {
+            const uint64 key = keys[i];
+            diff |= key ^ first;
+            isSorted &= i + 1 == end || key <= keys[i + 1];
+        }
+        diffs[jobIndex] = diff;
+        sorted[jobIndex] = isSorted;
+    };
+    JobSystem::Execute(analyzeJob, jobsCount, JobPriority::Critical);
+    uint64 diff = 0;
+    bool isSorted = true;
+    for (int32 i = 0; i < jobsCount; i++)
+    {
+        diff |= diffs[i];
+        isSorted &= sorted[i];
+    }
+
+    // Per-job histogram of the current digit (converted into the scatter offsets)
+    Function<void(int32)> histogramJob = [&](int32 jobIndex)
+    {
+        uint32* histogram = histograms[jobIndex];
+        Platform::MemoryClear(histogram, sizeof(uint32) * RADIX_SORT_PARALLEL_HISTOGRAM_SIZE);
+        const int32 start = jobIndex * chunkSize;
+        const int32 end = Math::Min(start + chunkSize, count);
+        for (int32 i = start; i < end; i++)
+            ++histogram[(keys[i] >> shift) & RADIX_SORT_PARALLEL_BIT_MASK];
+    };
+
+    // Per-job scatter into the output (jobs write to the disjoint ranges and keep the elements order within a digit)
+    Function<void(int32)> scatterJob = [&](int32 jobIndex)
+    {
+        uint32* histogram = histograms[jobIndex];
+        const int32 start = jobIndex * chunkSize;
+        const int32 end = Math::Min(start + chunkSize, count);
+        for (int32 i = start; i < end; i++)
+        {
+            const uint64 key = keys[i];
+            const uint32 dest = histogram[(key >> shift) & RADIX_SORT_PARALLEL_BIT_MASK]++;
+            tempKeys[dest] = key;
+            tempValues[dest] = values[i];
+        }
+    };
+
+    for (; shift < 64 && !isSorted; shift += RADIX_SORT_PARALLEL_BITS)
+    {
+        if (((diff >> shift) & RADIX_SORT_PARALLEL_BIT_MASK) == 0)
+            continue;
+        JobSystem::Execute(histogramJob, jobsCount, JobPriority::Critical);
+
+        // Prefix sum over digits (and over jobs within a digit to perform stable sort)
+        uint32 offset = 0;
+        for (int32 digit = 0; digit < RADIX_SORT_PARALLEL_HISTOGRAM_SIZE; digit++)
+        {
+            for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+            {
+                const uint32 cnt = histograms[jobIndex][digit];
+                histograms[jobIndex][digit] = offset;
+                offset += cnt;
+            }
+        }
+
+        JobSystem::Execute(scatterJob, jobsCount, JobPriority::Critical);
+
+        Swap(keys, tempKeys);
+        Swap(values, tempValues);
+    }
+
+    Allocator::Free(histograms);
+    inputKeys = keys;
+    inputValues = values;
+}
@@ -339,4 +339,14 @@ class FLAXENGINE_API Sorting
             inputValues = tmpValues;
         }
     }
+
+    /// <summary>
+    /// Sorts the linear data array using multi-threaded Radix Sort algorithm (uses temporary keys collection). Work is dispatched over the Job System - use it for large arrays (eg. draw calls sorting). Small arrays are sorted on the calling thread.
+    /// </summary>
+    /// <param name="inputKeys">The data pointer to the input sorting keys array. When this method completes it contains a pointer to the original data or the temporary depending on the algorithm passes count. Use it as a results container.</param>
+    /// <param name="inputValues">The data pointer to the input values array. When this method completes it contains a pointer to the original data or the temporary depending on the algorithm passes count. Use it as a results container.</param>
+    /// <param name="tmpKeys">The data pointer to the temporary sorting keys array.</param>
+    /// <param name="tmpValues">The data pointer to the temporary values array.</param>
+    /// <param name="count">The elements count.</param>
+    static void RadixSortParallel(uint64*& inputKeys, int32*& inputValues, uint64* tmpKeys, int32* tmpValues, int32 count);
 };
@@ -76,6 +76,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(2010), EditorDisplay(\"Content\")")
     bool ShadersGenerateDebugData = false;
 
+    /// <summary>
+    /// If checked, material shader permutations that are not used by the content included in the build will be skipped (eg. skinning variants of materials used only with static meshes). Materials used with the skipped permutation at runtime (eg. assigned from script) fallback to the default material. Reduces the shaders cache size and the cooking time.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2020), EditorDisplay(\"Content\", \"Shaders Prune Unused Permutations\")")
+    bool ShadersPruneUnusedPermutations = false;
+
     /// <summary>
     /// If checked, .NET Runtime won't be packaged with a game and will be required by user to be installed on system upon running game build. Available only on supported platforms such as Windows, Linux and macOS.
     /// </summary>
@@ -106,6 +112,7 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
         DESERIALIZE(AdditionalAssetFolders);
         DESERIALIZE(ShadersNoOptimize);
         DESERIALIZE(ShadersGenerateDebugData);
+        DESERIALIZE(ShadersPruneUnusedPermutations);
         DESERIALIZE(SkipDotnetPackaging);
         DESERIALIZE(SkipUnusedDotnetLibsPackaging);
     }
@@ -20,6 +20,36 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(20), DefaultValue(false), EditorDisplay(\"General\", \"Use V-Sync\")")
     bool UseVSync = false;
 
+    /// <summary>
+    /// Enables recording of the shadow maps rendering commands on many threads in parallel (with deferred GPU contexts). Supported only on DirectX 12 and Vulkan.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), DefaultValue(false), EditorDisplay(\"General\", \"Enable Parallel Command Recording\")")
+    bool EnableParallelCommandRecording = false;
+
+    /// <summary>
+    /// Enables the async compute queue usage for the compute-only rendering passes (eg. Global SDF update) to overlap them with the scene rasterization. Materials and particles that sample the Global SDF before the update use the previous frame data. Supported only on DirectX 12 and Vulkan.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), DefaultValue(false), EditorDisplay(\"General\", \"Enable Async Compute\")")
+    bool EnableAsyncCompute = false;
+
+    /// <summary>
+    /// The maximum amount of frames that CPU can prepare ahead of the GPU (frames in flight). Lower values reduce the input latency, higher values improve the throughput of GPU-bound games. Supported on DirectX 11, DirectX 12 and Vulkan.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(50), DefaultValue(2), Limit(1, 4), EditorDisplay(\"General\", \"Max Frames In Flight\")")
+    int32 MaxFramesInFlight = 2;
+
+    /// <summary>
+    /// Enables the low-latency mode that waits for the swap chain to be ready for the next frame before sampling the input and updating the game (uses waitable swap chain on DirectX 12). Reduces the input latency at the cost of throughput.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(60), DefaultValue(false), EditorDisplay(\"General\", \"Low Latency Mode\")")
+    bool LowLatencyMode = false;
+
+    /// <summary>
+    /// Enables caching of the draw calls of the static models (with Transform static flag) across frames. Views only select the model LOD and submit the cached draw calls instead of setting them up every frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(70), DefaultValue(false), EditorDisplay(\"General\", \"Enable Cached Draw Calls\")")
+    bool EnableCachedDrawCalls = false;
+
     /// <summary>
     /// Anti Aliasing quality setting.
     /// </summary>
@@ -44,6 +74,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(1250), DefaultValue(Quality.High), EditorDisplay(\"Quality\")")
     Quality VolumetricFogQuality = Quality::High;
 
+    /// <summary>
+    /// The amount of frames over which the Volumetric Fog froxels lighting is updated (in an interleaved pattern). Froxels not updated in the current frame reuse the reprojected lighting from the previous frames. Values higher than 1 reduce the lights injection and fog lighting cost at the cost of slower response to the lighting changes.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1251), DefaultValue(1), Limit(1, 4), EditorDisplay(\"Quality\")")
+    int32 VolumetricFogUpdateRate = 1;
+
     /// <summary>
     /// The shadows quality.
     /// </summary>
@@ -62,6 +98,30 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(1320), DefaultValue(false), EditorDisplay(\"Quality\", \"Allow CSM Blending\")")
     bool AllowCSMBlending = false;
 
+    /// <summary>
+    /// Enables caching of the static shadow casters (objects with a static transform) in the shadow maps of the static point and spot lights. Cached shadow maps are refreshed only when the static objects within the light range change, dynamic objects are drawn on top of them each frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1330), DefaultValue(false), EditorDisplay(\"Quality\", \"Cache Static Shadows\")")
+    bool CacheStaticShadows = false;
+
+    /// <summary>
+    /// Enables virtual shadow maps for the directional light. Cascades use a much higher virtual resolution that is split into pages allocated from a shared pool, only pages visible by the camera are rendered and they are cached between frames until objects in them move. Requires occlusion culling (uses the depth read back from the previous frames to find the visible pages).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1340), DefaultValue(false), EditorDisplay(\"Quality\", \"Virtual Shadow Maps\")")
+    bool EnableVirtualShadowMaps = false;
+
+    /// <summary>
+    /// Enables clustered lighting. Point and spot lights are culled into a view frustum grid on a GPU (in compute shader) and lights without shadows are shaded in a single fullscreen pass instead of a separate draw for each light. Forward materials (eg. transparent) use the same lights grid so they receive all local lights.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1350), DefaultValue(false), EditorDisplay(\"Quality\", \"Clustered Lighting\")")
+    bool EnableClusteredLighting = false;
+
+    /// <summary>
+    /// Enables variable rate shading. The shading rate image is generated from the scene luminance contrast and motion vectors to reduce the pixel shading rate of the GBuffer, forward and fog passes in the low-detail and fast-moving screen areas. Requires a device with shading rate image support (eg. DirectX 12 tier 2).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1360), DefaultValue(false), EditorDisplay(\"Quality\", \"Variable Rate Shading\")")
+    bool EnableVariableRateShading = false;
+
     /// <summary>
     /// Default probes cubemap resolution (use for Environment Probes, can be overriden per-actor).
     /// </summary>
@@ -74,6 +134,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes = "EditorOrder(1502), EditorDisplay(\"Quality\")")
     bool UseHDRProbes = false;
 
+    /// <summary>
+    /// The GPU time budget (in milliseconds) for the Environment Probes and Sky Lights updates in a single frame. Probe update is split into steps (rendering of a single cubemap face or filtering) and the steps are executed until the budget is reached (at least one step per frame). Use 0 to execute a single step per frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1503), Limit(0, 100.0f, 0.1f), EditorDisplay(\"Quality\")")
+    float ProbesUpdateBudget = 0.0f;
+
     /// <summary>
     /// If checked, enables Global SDF rendering. This can be used in materials, shaders, and particles.
     /// </summary>
@@ -106,12 +172,72 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(2120), Limit(50, 1000), EditorDisplay(\"Global Illumination\")")
     float GIProbesSpacing = 100;
 
+    /// <summary>
+    /// The GPU time budget (in milliseconds) for the Global Illumination probes updates in a single frame. Probes are updated in order of their priority (new probes, visibility, distance to the view and lighting changes) until the budget is reached. Use it to scale GI cost on low-end GPUs (eg. 1-2ms). Use 0 to update all probes every time.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2125), Limit(0, 100.0f, 0.1f), EditorDisplay(\"Global Illumination\", \"GI Probes Update Budget\")")
+    float GIProbesUpdateBudget = 0.0f;
+
     /// <summary>
     /// The Global Surface Atlas resolution. Adjust it if atlas `flickers` due to overflow (eg. to 4096).
     /// </summary>
     API_FIELD(Attributes="EditorOrder(2130), Limit(256, 8192), EditorDisplay(\"Global Illumination\")")
     int32 GlobalSurfaceAtlasResolution = 2048;
 
+    /// <summary>
+    /// The maximum amount of Global Surface Atlas tiles to rasterize in a single frame. Dirty objects are redrawn in order of their priority (new tiles, screen coverage and staleness) and the rest waits for the next frames. Use 0 to redraw all dirty objects every time.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2135), Limit(0, 10000), EditorDisplay(\"Global Illumination\")")
+    int32 GlobalSurfaceAtlasTilesBudget = 0;
+
+    /// <summary>
+    /// Enables Hi-Z occlusion culling that skips drawing of objects hidden behind the scene depth from the previous frames. Useful in dense scenes with many occluded objects (eg. cities or interiors).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2200), DefaultValue(false), EditorDisplay(\"Occlusion Culling\", \"Enable Occlusion Culling\")")
+    bool EnableOcclusionCulling = false;
+
+    /// <summary>
+    /// Enables conservative occlusion culling mode that extends the tested bounds by the camera movement and keeps objects near the screen edges visible to reduce popping.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2210), DefaultValue(true), EditorDisplay(\"Occlusion Culling\", \"Conservative\"), VisibleIf(nameof(EnableOcclusionCulling))")
+    bool ConservativeOcclusionCulling = true;
+
+    /// <summary>
+    /// Enables GPU culling of the large instanced batches (eg. foliage) against the view frustum and Hi-Z, drawn with indirect draw calls. Requires compute shaders support.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2220), DefaultValue(false), EditorDisplay(\"Occlusion Culling\", \"Enable GPU Instance Culling\")")
+    bool EnableGPUInstanceCulling = false;
+
+    /// <summary>
+    /// Enables GPU culling of the meshlets (clusters of triangles) of the models imported with meshlets against the view frustum, backfaces and Hi-Z, drawn with indirect draw calls. Requires compute shaders support.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2230), DefaultValue(true), EditorDisplay(\"Occlusion Culling\", \"Enable Meshlet Culling\")")
+    bool EnableMeshletCulling = true;
+
+    /// <summary>
+    /// Enables caching of the terrain materials output into the virtual texture around the view. Terrain chunks within the cached area sample the virtual texture instead of evaluating the whole material (opaque Lit materials without emissive only).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2250), DefaultValue(false), EditorDisplay(\"Terrain\", \"Enable Virtual Texture\")")
+    bool EnableTerrainVirtualTexture = false;
+
+    /// <summary>
+    /// Enables GPU-driven terrain rendering. Terrain chunks LOD selection and culling (against the view frustum and Hi-Z) is done on a GPU and the visible chunks of each patch are drawn with indirect draw calls (one per used LOD) with the continuous geomorphing. Requires compute shaders support.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2260), DefaultValue(false), EditorDisplay(\"Terrain\", \"Enable GPU-Driven Terrain\")")
+    bool EnableGPUDrivenTerrain = false;
+
+    /// <summary>
+    /// Enables skinning of the animated models on a GPU with a compute shader once per frame (instead of skinning the vertices in the vertex shader of every pass). Skinned meshes with blend shapes or materials that use vertex colors are skinned in the vertex shader. Requires compute shaders support.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2300), DefaultValue(false), EditorDisplay(\"Animation\", \"Enable Compute Skinning\")")
+    bool EnableComputeSkinning = false;
+
+    /// <summary>
+    /// The time budget (in milliseconds) for the asynchronous GPU tasks (eg. textures and buffers data uploads) executed in a single frame. The remaining tasks are carried over to the next frames to reduce hitches. Use 0 to run the default amount of tasks every frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2400), Limit(0, 100.0f, 0.1f), EditorDisplay(\"Other\", \"GPU Tasks Budget\")")
+    float GPUTasksBudget = 0.0f;
+
     /// <summary>
     /// The default Post Process settings. Can be overriden by PostFxVolume on a level locally, per camera or for a whole map.
     /// </summary>
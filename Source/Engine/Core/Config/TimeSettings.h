@@ -42,6 +42,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TimeSettings);
     API_FIELD(Attributes="EditorOrder(20), Limit(0.1f, 1000.0f, 0.01f), EditorDisplay(\"General\")")
     float MaxUpdateDeltaTime = 0.1f;
 
+    /// <summary>
+    /// The time budget (in milliseconds) for the main thread tasks (eg. assets finalization or scene streaming callbacks) executed at the beginning of the frame. The remaining tasks are carried over to the next frames to reduce hitches. Use 0 to run all queued tasks every frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), Limit(0, 1000.0f, 0.1f), EditorDisplay(\"General\", \"Main Thread Tasks Budget\")")
+    float MainThreadTasksBudget = 0.0f;
+
 public:
 
     /// <summary>
@@ -8,6 +8,9 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Platform/StringUtils.h"
+#include "Engine/Threading/ThreadSpawner.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Debug/Exceptions/Exceptions.h"
@@ -20,11 +23,172 @@
 
 namespace
 {
-    bool LogAfterInit = false, IsDuringLog = false;
+    bool LogAfterInit = false, IsDuringLog = false, LogUTF8 = false;
     int LogTotalErrorsCnt = 0;
     FileWriteStream* LogFile = nullptr;
     CriticalSection LogLocker;
     DateTime LogStartTime;
+    Array<char> LogUTF8Buffer;
+
+    // Per-thread ring buffer for the asynchronous logging (written only by the owning thread, read only by the log writer under LogLocker)
+    // Each message is stored as 2 chars with the message length followed by the message text
+    struct LogThreadBuffer
+    {
+        int64 volatile WritePos;
+        int64 volatile ReadPos;
+        Char Data[LOG_ASYNC_BUFFER_SIZE];
+    };
+
+    bool LogAsync = false, LogWriterExit = false;
+    Thread* LogWriterThread = nullptr;
+    CriticalSection LogWriterLocker;
+    ConditionVariable LogWriterSignal;
+    CriticalSection LogBuffersLocker;
+    Array<LogThreadBuffer*> LogBuffers;
+    THREADLOCAL LogThreadBuffer* LogCurrentBuffer = nullptr;
+    int64 volatile LogDroppedCount = 0;
+    Array<Char> LogBatch;
+
+    void WriteToFile(const Char* ptr, int32 length)
+    {
+        if (LogUTF8)
+        {
+            LogUTF8Buffer.Resize(length * 3 + 1, false);
+            int32 utf8Length;
+            StringUtils::ConvertUTF162UTF8(ptr, LogUTF8Buffer.Get(), length, utf8Length);
+            LogFile->WriteBytes(LogUTF8Buffer.Get(), utf8Length);
+        }
+        else
+        {
+            LogFile->WriteBytes(ptr, length * sizeof(Char));
+        }
+    }
+
+    void WriteToOutput(const StringView& msg)
+    {
+        // Send message to standard process output
+        if (CommandLine::Options.Std)
+        {
+#if PLATFORM_TEXT_IS_CHAR16
+            StringAnsi ansi(msg);
+            ansi += PLATFORM_LINE_TERMINATOR;
+            printf("%s", ansi.Get());
+#else
+            std::wcout.write(msg.Get(), msg.Length());
+            std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+#endif
+        }
+
+        // Send message to platform logging
+        Platform::Log(msg);
+    }
+
+    bool WriteAsync(const StringView& msg)
+    {
+        const int32 length = msg.Length();
+        const int64 size = (int64)length + 2;
+        if (size > LOG_ASYNC_BUFFER_SIZE)
+            return false;
+
+        // Get buffer for this thread
+        LogThreadBuffer* buffer = LogCurrentBuffer;
+        if (buffer == nullptr)
+        {
+            buffer = (LogThreadBuffer*)Allocator::Allocate(sizeof(LogThreadBuffer));
+            buffer->WritePos = 0;
+            buffer->ReadPos = 0;
+            LogCurrentBuffer = buffer;
+            ScopeLock lock(LogBuffersLocker);
+            LogBuffers.Add(buffer);
+        }
+
+        // Drop the message if buffer is full (never wait for the log writer)
+        const int64 writePos = buffer->WritePos;
+        if (writePos + size - Platform::AtomicRead(&buffer->ReadPos) > LOG_ASYNC_BUFFER_SIZE)
+        {
+            Platform::InterlockedIncrement(&LogDroppedCount);
+            return true;
+        }
+
+        // Copy message (with wrap around the buffer end) and publish it to the log writer
+        constexpr int64 mask = LOG_ASYNC_BUFFER_SIZE - 1;
+        Char* data = buffer->Data;
+        data[writePos & mask] = (Char)(length & 0xffff);
+        data[(writePos + 1) & mask] = (Char)(length >> 16);
+        const int32 start = (int32)((writePos + 2) & mask);
+        const int32 first = Math::Min(length, LOG_ASYNC_BUFFER_SIZE - start);
+        Platform::MemoryCopy(data + start, msg.Get(), first * sizeof(Char));
+        Platform::MemoryCopy(data, msg.Get() + first, (length - first) * sizeof(Char));
+        Platform::AtomicStore(&buffer->WritePos, writePos + size);
+        return true;
+    }
+
+    // Writes all pending asynchronous messages (called with LogLocker).
+    bool DrainAsync()
+    {
+        constexpr int64 mask = LOG_ASYNC_BUFFER_SIZE - 1;
+        LogBatch.Clear();
+        LogBuffersLocker.Lock();
+        for (LogThreadBuffer* buffer : LogBuffers)
+        {
+            const Char* data = buffer->Data;
+            int64 readPos = buffer->ReadPos;
+            const int64 writePos = Platform::AtomicRead(&buffer->WritePos);
+            while (readPos < writePos)
+            {
+                const int32 length = (int32)(uint16)data[readPos & mask] | ((int32)(uint16)data[(readPos + 1) & mask] << 16);
+                const int32 start = (int32)((readPos + 2) & mask);
+                const int32 first = Math::Min(length, LOG_ASYNC_BUFFER_SIZE - start);
+                const int32 batchStart = LogBatch.Count();
+                LogBatch.Add(data + start, first);
+                LogBatch.Add(data, length - first);
+                WriteToOutput(StringView(LogBatch.Get() + batchStart, length));
+                LogBatch.Add(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+                readPos += (int64)length + 2;
+            }
+            Platform::AtomicStore(&buffer->ReadPos, readPos);
+        }
+        LogBuffersLocker.Unlock();
+        const int64 droppedCount = Platform::InterlockedExchange(&LogDroppedCount, 0);
+        if (droppedCount != 0)
+        {
+            const String msg = String::Format(TEXT("[ Log ]: Dropped {0} message(s) due to the full asynchronous log buffer"), droppedCount);
+            WriteToOutput(msg);
+            LogBatch.Add(msg.Get(), msg.Length());
+            LogBatch.Add(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+        }
+
+        // Write all messages to the log file at once
+        if (LogAfterInit && LogBatch.HasItems())
+        {
+            WriteToFile(LogBatch.Get(), LogBatch.Count());
+            return true;
+        }
+        return false;
+    }
+
+    int32 LogWriterMain()
+    {
+        bool exit = false;
+        while (!exit)
+        {
+            LogWriterLocker.Lock();
+            if (!LogWriterExit)
+                LogWriterSignal.Wait(LogWriterLocker, 10);
+            exit = LogWriterExit;
+            LogWriterLocker.Unlock();
+
+            LogLocker.Lock();
+            if (DrainAsync())
+            {
+#if LOG_ENABLE_AUTO_FLUSH
+                LogFile->Flush();
+#endif
+            }
+            LogLocker.Unlock();
+        }
+        return 0;
+    }
 }
 
 String Log::Logger::LogFilePath;
@@ -86,10 +250,20 @@ bool Log::Logger::Init()
     }
     LogTotalErrorsCnt = 0;
     LogAfterInit = true;
+    LogUTF8 = CommandLine::Options.LogUTF8.IsTrue();
 
-    // Write BOM (UTF-16 (LE); BOM: FF FE)
-    byte bom[] = { 0xFF, 0xFE };
-    LogFile->WriteBytes(bom, 2);
+    if (LogUTF8)
+    {
+        // Write BOM (UTF-8; BOM: EF BB BF)
+        byte bom[] = { 0xEF, 0xBB, 0xBF };
+        LogFile->WriteBytes(bom, 3);
+    }
+    else
+    {
+        // Write BOM (UTF-16 (LE); BOM: FF FE)
+        byte bom[] = { 0xFF, 0xFE };
+        LogFile->WriteBytes(bom, 2);
+    }
 
     // Write startup info
     WriteFloor();
@@ -100,6 +274,14 @@ bool Log::Logger::Init()
 #endif
     WriteFloor();
 
+    // Start the background log writer
+    if (CommandLine::Options.LogAsync.IsTrue())
+    {
+        LogWriterExit = false;
+        LogWriterThread = ThreadSpawner::Start(Function<int32()>(LogWriterMain), TEXT("Log Writer"), ThreadPriority::BelowNormal);
+        LogAsync = LogWriterThread != nullptr;
+    }
+
     return false;
 }
 
@@ -110,6 +292,10 @@ void Log::Logger::Write(const StringView& msg)
     if (length <= 0)
         return;
 
+    // Push message to the background log writer
+    if (LogAsync && WriteAsync(msg))
+        return;
+
     LogLocker.Lock();
     if (IsDuringLog)
     {
@@ -118,27 +304,17 @@ void Log::Logger::Write(const StringView& msg)
     }
     IsDuringLog = true;
 
-    // Send message to standard process output
-    if (CommandLine::Options.Std)
-    {
-#if PLATFORM_TEXT_IS_CHAR16
-        StringAnsi ansi(msg);
-        ansi += PLATFORM_LINE_TERMINATOR;
-        printf("%s", ansi.Get());
-#else
-        std::wcout.write(ptr, length);
-        std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
-#endif
-    }
+    // Keep the messages order
+    if (LogAsync)
+        DrainAsync();
 
-    // Send message to platform logging
-    Platform::Log(msg);
+    WriteToOutput(msg);
 
     // Write message to log file
     if (LogAfterInit)
     {
-        LogFile->WriteBytes(ptr, length * sizeof(Char));
-        LogFile->WriteBytes(TEXT(PLATFORM_LINE_TERMINATOR), (ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1) * sizeof(Char));
+        WriteToFile(ptr, length);
+        WriteToFile(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
 #if LOG_ENABLE_AUTO_FLUSH
         LogFile->Flush();
 #endif
@@ -155,6 +331,19 @@ void Log::Logger::Write(const Exception& exception)
 
 void Log::Logger::Dispose()
 {
+    // Stop the background log writer (it writes all pending messages before exit)
+    if (LogWriterThread)
+    {
+        LogAsync = false;
+        LogWriterLocker.Lock();
+        LogWriterExit = true;
+        LogWriterSignal.NotifyAll();
+        LogWriterLocker.Unlock();
+        LogWriterThread->Join();
+        Delete(LogWriterThread);
+        LogWriterThread = nullptr;
+    }
+
     LogLocker.Lock();
 
     // Write ending info
@@ -170,6 +359,9 @@ void Log::Logger::Dispose()
         Delete(LogFile);
         LogFile = nullptr;
     }
+    for (LogThreadBuffer* buffer : LogBuffers)
+        Allocator::Free(buffer);
+    LogBuffers.Clear();
 
     LogLocker.Unlock();
 }
@@ -183,9 +375,16 @@ bool Log::Logger::IsLogEnabled()
 #endif
 }
 
+bool Log::Logger::IsAsync()
+{
+    return LogAsync;
+}
+
 void Log::Logger::Flush()
 {
     LogLocker.Lock();
+    if (LogAsync)
+        DrainAsync();
     if (LogFile)
         LogFile->Flush();
     LogLocker.Unlock();
@@ -10,6 +10,9 @@
 // Enable/disable auto flush function
 #define LOG_ENABLE_AUTO_FLUSH 1
 
+// The size (in characters) of the per-thread ring buffer used by the asynchronous logging (must be a power of two)
+#define LOG_ASYNC_BUFFER_SIZE (64 * 1024)
+
 /// <summary>
 /// Sends a formatted message to the log file (message type - describes level of the log (see LogType enum))
 /// </summary>
@@ -111,7 +114,12 @@ namespace Log
         static bool IsLogEnabled();
 
         /// <summary>
-        /// Flushes log file with a memory buffer.
+        /// Determines whether log messages are written asynchronously on a background thread (see -logasync command line switch).
+        /// </summary>
+        static bool IsAsync();
+
+        /// <summary>
+        /// Flushes log file with a memory buffer. Writes all the pending asynchronous log messages.
         /// </summary>
         static void Flush();
 
@@ -5,6 +5,7 @@
 #include "Matrix.h"
 #include "Transform.h"
 #include "../Types/String.h"
+#include "../SIMD.h"
 
 const BoundingBox BoundingBox::Empty(Vector3(MAX_float), Vector3(MIN_float));
 const BoundingBox BoundingBox::Zero(Vector3(0.0f));
@@ -134,6 +135,36 @@ void BoundingBox::Transform(const BoundingBox& box, const Matrix& matrix, Boundi
     result = BoundingBox(min, max);
 }
 
+void BoundingBox::Transform(const BoundingBox* boxes, int32 count, const Matrix& matrix, BoundingBox* result)
+{
+#if USE_LARGE_WORLDS
+    for (int32 i = 0; i < count; i++)
+        Transform(boxes[i], matrix, result[i]);
+#else
+    // Reference: http://dev.theomader.com/transform-bounding-boxes/
+    const SimdVector4 right = SIMD::LoadUnaligned(matrix.Values[0]);
+    const SimdVector4 up = SIMD::LoadUnaligned(matrix.Values[1]);
+    const SimdVector4 backward = SIMD::LoadUnaligned(matrix.Values[2]);
+    const SimdVector4 translation = SIMD::LoadUnaligned(matrix.Values[3]);
+    for (int32 i = 0; i < count; i++)
+    {
+        const BoundingBox& box = boxes[i];
+        const SimdVector4 xa = SIMD::Mul(right, SIMD::Splat(box.Minimum.X));
+        const SimdVector4 xb = SIMD::Mul(right, SIMD::Splat(box.Maximum.X));
+        const SimdVector4 ya = SIMD::Mul(up, SIMD::Splat(box.Minimum.Y));
+        const SimdVector4 yb = SIMD::Mul(up, SIMD::Splat(box.Maximum.Y));
+        const SimdVector4 za = SIMD::Mul(backward, SIMD::Splat(box.Minimum.Z));
+        const SimdVector4 zb = SIMD::Mul(backward, SIMD::Splat(box.Maximum.Z));
+        const SimdVector4 min = SIMD::Add(SIMD::Add(SIMD::Min(xa, xb), SIMD::Min(ya, yb)), SIMD::Add(SIMD::Min(za, zb), translation));
+        const SimdVector4 max = SIMD::Add(SIMD::Add(SIMD::Max(xa, xb), SIMD::Max(ya, yb)), SIMD::Add(SIMD::Max(za, zb), translation));
+        alignas(16) Float4 tmpMin, tmpMax;
+        SIMD::Store(&tmpMin, min);
+        SIMD::Store(&tmpMax, max);
+        result[i] = BoundingBox(Vector3(tmpMin.X, tmpMin.Y, tmpMin.Z), Vector3(tmpMax.X, tmpMax.Y, tmpMax.Z));
+    }
+#endif
+}
+
 void BoundingBox::Transform(const BoundingBox& box, const ::Transform& transform, BoundingBox& result)
 {
     // Reference: http://dev.theomader.com/transform-bounding-boxes/
@@ -304,6 +304,15 @@ API_STRUCT() struct FLAXENGINE_API BoundingBox
     /// <param name="result">The result transformed box.</param>
     static void Transform(const BoundingBox& box, const ::Transform& transform, BoundingBox& result);
 
+    /// <summary>
+    /// Transforms the bounding boxes using the specified matrix. Batched version that uses SIMD instructions.
+    /// </summary>
+    /// <param name="boxes">The boxes.</param>
+    /// <param name="count">The amount of boxes.</param>
+    /// <param name="matrix">The matrix.</param>
+    /// <param name="result">The result transformed boxes (count elements). Can be the same as the input.</param>
+    static void Transform(const BoundingBox* boxes, int32 count, const Matrix& matrix, BoundingBox* result);
+
 public:
     /// <summary>
     /// Determines if there is an intersection between the current object and a Ray.
@@ -4,6 +4,7 @@
 #include "BoundingBox.h"
 #include "BoundingSphere.h"
 #include "../Types/String.h"
+#include "../SIMD.h"
 
 String BoundingFrustum::ToString() const
 {
@@ -189,3 +190,45 @@ bool BoundingFrustum::Intersects(const BoundingSphere& sphere) const
     }
     return true;
 }
+
+void BoundingFrustum::Intersects(const BoundingFrustum* frustums, int32 frustumsCount, const BoundingSphere* spheres, int32 count, bool* results)
+{
+    int32 i = 0;
+#if !USE_LARGE_WORLDS
+    // Test 4 spheres at once (structure of arrays layout for the spheres data)
+    for (; i + 4 <= count; i += 4)
+    {
+        const BoundingSphere* s = spheres + i;
+        const SimdVector4 x = SIMD::Load(s[0].Center.X, s[1].Center.X, s[2].Center.X, s[3].Center.X);
+        const SimdVector4 y = SIMD::Load(s[0].Center.Y, s[1].Center.Y, s[2].Center.Y, s[3].Center.Y);
+        const SimdVector4 z = SIMD::Load(s[0].Center.Z, s[1].Center.Z, s[2].Center.Z, s[3].Center.Z);
+        const SimdVector4 negRadius = SIMD::Load(-s[0].Radius, -s[1].Radius, -s[2].Radius, -s[3].Radius);
+        int32 visible = 0;
+        for (int32 f = 0; f < frustumsCount && visible != 0xf; f++)
+        {
+            const Plane* planes = frustums[f]._planes;
+            int32 inside = 0xf;
+            for (int32 p = 0; p < 6 && inside != 0; p++)
+            {
+                const Plane& plane = planes[p];
+                SimdVector4 distance = SIMD::MulAdd(x, SIMD::Splat(plane.Normal.X), SIMD::Splat(plane.D));
+                distance = SIMD::MulAdd(y, SIMD::Splat(plane.Normal.Y), distance);
+                distance = SIMD::MulAdd(z, SIMD::Splat(plane.Normal.Z), distance);
+                inside &= ~SIMD::MoveMask(SIMD::Less(distance, negRadius));
+            }
+            visible |= inside;
+        }
+        results[i + 0] = (visible & 1) != 0;
+        results[i + 1] = (visible & 2) != 0;
+        results[i + 2] = (visible & 4) != 0;
+        results[i + 3] = (visible & 8) != 0;
+    }
+#endif
+    for (; i < count; i++)
+    {
+        bool visible = false;
+        for (int32 f = 0; f < frustumsCount && !visible; f++)
+            visible = frustums[f].Intersects(spheres[i]);
+        results[i] = visible;
+    }
+}
@@ -246,6 +246,27 @@ API_STRUCT(InBuild) struct FLAXENGINE_API BoundingFrustum
     {
         return CollisionsHelper::FrustumContainsBox(*this, box) != ContainmentType::Disjoint;
     }
+
+    /// <summary>
+    /// Checks whether the current BoundingFrustum intersects the BoundingSpheres. Batched version that uses SIMD instructions to test 4 spheres at once.
+    /// </summary>
+    /// <param name="spheres">The spheres.</param>
+    /// <param name="count">The amount of spheres.</param>
+    /// <param name="results">The results (count elements), true if the frustum intersects the sphere, otherwise false.</param>
+    FORCE_INLINE void Intersects(const BoundingSphere* spheres, int32 count, bool* results) const
+    {
+        Intersects(this, 1, spheres, count, results);
+    }
+
+    /// <summary>
+    /// Checks whether any of the BoundingFrustums intersects the BoundingSpheres. Batched version that uses SIMD instructions to test 4 spheres at once.
+    /// </summary>
+    /// <param name="frustums">The frustums.</param>
+    /// <param name="frustumsCount">The amount of frustums.</param>
+    /// <param name="spheres">The spheres.</param>
+    /// <param name="count">The amount of spheres.</param>
+    /// <param name="results">The results (count elements), true if any of the frustums intersects the sphere, otherwise false.</param>
+    static void Intersects(const BoundingFrustum* frustums, int32 frustumsCount, const BoundingSphere* spheres, int32 count, bool* results);
 };
 
 template<>
@@ -5,6 +5,7 @@
 #include "Matrix.h"
 #include "Ray.h"
 #include "../Types/String.h"
+#include "../SIMD.h"
 
 const BoundingSphere BoundingSphere::Empty(Vector3(0, 0, 0), 0);
 
@@ -212,3 +213,31 @@ void BoundingSphere::Transform(const BoundingSphere& sphere, const Matrix& matri
     Vector3::Transform(sphere.Center, matrix, result.Center);
     result.Radius = sphere.Radius * matrix.GetScaleVector().GetAbsolute().MaxValue();
 }
+
+void BoundingSphere::Transform(const BoundingSphere* spheres, int32 count, const Matrix& matrix, BoundingSphere* result)
+{
+    const Real scale = matrix.GetScaleVector().GetAbsolute().MaxValue();
+#if USE_LARGE_WORLDS
+    for (int32 i = 0; i < count; i++)
+    {
+        Vector3::Transform(spheres[i].Center, matrix, result[i].Center);
+        result[i].Radius = spheres[i].Radius * scale;
+    }
+#else
+    const SimdVector4 r0 = SIMD::LoadUnaligned(matrix.Values[0]);
+    const SimdVector4 r1 = SIMD::LoadUnaligned(matrix.Values[1]);
+    const SimdVector4 r2 = SIMD::LoadUnaligned(matrix.Values[2]);
+    const SimdVector4 r3 = SIMD::LoadUnaligned(matrix.Values[3]);
+    for (int32 i = 0; i < count; i++)
+    {
+        const BoundingSphere& sphere = spheres[i];
+        SimdVector4 center = SIMD::MulAdd(SIMD::Splat(sphere.Center.X), r0, r3);
+        center = SIMD::MulAdd(SIMD::Splat(sphere.Center.Y), r1, center);
+        center = SIMD::MulAdd(SIMD::Splat(sphere.Center.Z), r2, center);
+        alignas(16) Float4 tmp;
+        SIMD::Store(&tmp, center);
+        result[i].Center = Vector3(tmp.X, tmp.Y, tmp.Z);
+        result[i].Radius = sphere.Radius * scale;
+    }
+#endif
+}
@@ -226,6 +226,15 @@ API_STRUCT() struct FLAXENGINE_API BoundingSphere
     /// <param name="matrix">The matrix.</param>
     /// <param name="result">The result transformed sphere.</param>
     static void Transform(const BoundingSphere& sphere, const Matrix& matrix, BoundingSphere& result);
+
+    /// <summary>
+    /// Transforms the bounding spheres using the specified matrix. Batched version that uses SIMD instructions.
+    /// </summary>
+    /// <param name="spheres">The spheres.</param>
+    /// <param name="count">The amount of spheres.</param>
+    /// <param name="matrix">The matrix.</param>
+    /// <param name="result">The result transformed spheres (count elements). Can be the same as the input.</param>
+    static void Transform(const BoundingSphere* spheres, int32 count, const Matrix& matrix, BoundingSphere* result);
 };
 
 template<>
@@ -6,6 +6,7 @@
 #include "Quaternion.h"
 #include "Transform.h"
 #include "../Types/String.h"
+#include "../SIMD.h"
 
 static_assert(sizeof(Matrix) == 4 * 4 * 4, "Invalid Matrix type size.");
 
@@ -167,6 +168,46 @@ Matrix Matrix::Transpose(const Matrix& value)
     return result;
 }
 
+namespace
+{
+    FORCE_INLINE void MultiplySimd(const Matrix& left, const SimdVector4& r0, const SimdVector4& r1, const SimdVector4& r2, const SimdVector4& r3, Matrix& result)
+    {
+        // Each row of the result is a linear combination of the right matrix rows
+        for (int32 i = 0; i < 4; i++)
+        {
+            const float* row = left.Values[i];
+            SimdVector4 value = SIMD::Mul(SIMD::Splat(row[0]), r0);
+            value = SIMD::MulAdd(SIMD::Splat(row[1]), r1, value);
+            value = SIMD::MulAdd(SIMD::Splat(row[2]), r2, value);
+            value = SIMD::MulAdd(SIMD::Splat(row[3]), r3, value);
+            SIMD::StoreUnaligned(result.Values[i], value);
+        }
+    }
+}
+
+void Matrix::Multiply(const Matrix* left, const Matrix* right, Matrix* result, int32 count)
+{
+    for (int32 i = 0; i < count; i++)
+    {
+        const Matrix& r = right[i];
+        const SimdVector4 r0 = SIMD::LoadUnaligned(r.Values[0]);
+        const SimdVector4 r1 = SIMD::LoadUnaligned(r.Values[1]);
+        const SimdVector4 r2 = SIMD::LoadUnaligned(r.Values[2]);
+        const SimdVector4 r3 = SIMD::LoadUnaligned(r.Values[3]);
+        MultiplySimd(left[i], r0, r1, r2, r3, result[i]);
+    }
+}
+
+void Matrix::Multiply(const Matrix* left, const Matrix& right, Matrix* result, int32 count)
+{
+    const SimdVector4 r0 = SIMD::LoadUnaligned(right.Values[0]);
+    const SimdVector4 r1 = SIMD::LoadUnaligned(right.Values[1]);
+    const SimdVector4 r2 = SIMD::LoadUnaligned(right.Values[2]);
+    const SimdVector4 r3 = SIMD::LoadUnaligned(right.Values[3]);
+    for (int32 i = 0; i < count; i++)
+        MultiplySimd(left[i], r0, r1, r2, r3, result[i]);
+}
+
 void Matrix::Transpose(const Matrix& value, Matrix& result)
 {
     Matrix temp;
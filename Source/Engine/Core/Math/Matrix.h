@@ -652,6 +652,20 @@ API_STRUCT() struct FLAXENGINE_API Matrix
         result.M44 = left.M41 * right.M14 + left.M42 * right.M24 + left.M43 * right.M34 + left.M44 * right.M44;
     }
 
+    // Calculates the products of the matrices (result[i] = left[i] * right[i]). Batched version that uses SIMD instructions.
+    // @param left The first matrices to multiply.
+    // @param right The second matrices to multiply.
+    // @param result The products of the matrices. Can be the same as one of the inputs.
+    // @param count The amount of matrices.
+    static void Multiply(const Matrix* left, const Matrix* right, Matrix* result, int32 count);
+
+    // Calculates the products of the matrices with a single matrix (result[i] = left[i] * right). Batched version that uses SIMD instructions.
+    // @param left The first matrices to multiply.
+    // @param right The second matrix to multiply.
+    // @param result The products of the matrices. Can be the same as the input.
+    // @param count The amount of matrices.
+    static void Multiply(const Matrix* left, const Matrix& right, Matrix* result, int32 count);
+
     // Scales a matrix by the given value.
     // @param left The matrix to scale.
     // @param right The amount by which to scale.
@@ -141,6 +141,27 @@ void Transform::LocalToWorld(const Vector3& point, Vector3& result) const
     Vector3::Add(tmp, Translation, result);
 }
 
+void Transform::LocalToWorld(const Vector3* points, int32 count, Vector3* result) const
+{
+    Matrix3x3 rotationScale;
+    Matrix3x3::RotationQuaternion(Orientation, rotationScale);
+    rotationScale.M11 *= Scale.X;
+    rotationScale.M12 *= Scale.X;
+    rotationScale.M13 *= Scale.X;
+    rotationScale.M21 *= Scale.Y;
+    rotationScale.M22 *= Scale.Y;
+    rotationScale.M23 *= Scale.Y;
+    rotationScale.M31 *= Scale.Z;
+    rotationScale.M32 *= Scale.Z;
+    rotationScale.M33 *= Scale.Z;
+    for (int32 i = 0; i < count; i++)
+    {
+        Vector3 tmp;
+        Vector3::Transform(points[i], rotationScale, tmp);
+        Vector3::Add(tmp, Translation, result[i]);
+    }
+}
+
 void Transform::WorldToLocal(const Transform& other, Transform& result) const
 {
     Vector3 invScale = Scale;
@@ -220,6 +220,14 @@ API_STRUCT() struct FLAXENGINE_API Transform
     /// <param name="result">The world space point.</param>
     void LocalToWorld(const Vector3& point, Vector3& result) const;
 
+    /// <summary>
+    /// Performs transformation of the given points in local space to the world space of this transform. Batched version that computes the rotation and scale matrix once.
+    /// </summary>
+    /// <param name="points">The local space points.</param>
+    /// <param name="count">The amount of points.</param>
+    /// <param name="result">The world space points (count elements). Can be the same as the input.</param>
+    void LocalToWorld(const Vector3* points, int32 count, Vector3* result) const;
+
     /// <summary>
     /// Performs transformation of the given transform in local space to the world space of this transform.
     /// </summary>
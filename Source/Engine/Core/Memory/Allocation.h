@@ -169,6 +169,132 @@ class HeapAllocation
     };
 };
 
+/// <summary>
+/// The memory allocation policy that uses large memory pages for big allocations (to reduce TLB misses) and the default heap for the small ones. Large pages are used only when enabled with -largepages command line switch. Use it for the long-lived bulk data.
+/// </summary>
+class LargePageAllocation
+{
+public:
+    template<typename T>
+    class Data
+    {
+    private:
+        T* _data = nullptr;
+        uint64 _largePagesSize = 0; // Size of the memory allocated with large pages (0 if allocated from heap)
+
+        FORCE_INLINE static T* AllocateData(uint64 size, uint64& largePagesSize)
+        {
+            const uint64 largePageSize = Platform::GetLargePageSize();
+            if (largePageSize != 0 && size >= largePageSize)
+            {
+                if (void* ptr = Platform::AllocateLargePages(size))
+                {
+                    largePagesSize = size;
+                    return (T*)ptr;
+                }
+            }
+            largePagesSize = 0;
+            return size != 0 ? (T*)Allocator::Allocate(size) : nullptr;
+        }
+
+        FORCE_INLINE static void FreeData(T* data, uint64 largePagesSize)
+        {
+            if (largePagesSize != 0)
+                Platform::FreeLargePages(data, largePagesSize);
+            else
+                Allocator::Free(data);
+        }
+
+    public:
+        FORCE_INLINE Data()
+        {
+        }
+
+        FORCE_INLINE ~Data()
+        {
+            FreeData(_data, _largePagesSize);
+        }
+
+        FORCE_INLINE T* Get()
+        {
+            return _data;
+        }
+
+        FORCE_INLINE const T* Get() const
+        {
+            return _data;
+        }
+
+        FORCE_INLINE int32 CalculateCapacityGrow(int32 capacity, int32 minCapacity) const
+        {
+            if (capacity < minCapacity)
+                capacity = minCapacity;
+            if (capacity < 8)
+            {
+                capacity = 8;
+            }
+            else
+            {
+                // Round up to the next power of 2 and multiply by 2 (http://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2)
+                capacity--;
+                capacity |= capacity >> 1;
+                capacity |= capacity >> 2;
+                capacity |= capacity >> 4;
+                capacity |= capacity >> 8;
+                capacity |= capacity >> 16;
+                capacity = (capacity + 1) * 2;
+            }
+            return capacity;
+        }
+
+        FORCE_INLINE void Allocate(uint64 capacity)
+        {
+#if  ENABLE_ASSERTION_LOW_LAYERS
+            ASSERT(!_data);
+#endif
+            _data = AllocateData(capacity * sizeof(T), _largePagesSize);
+#if !BUILD_RELEASE
+            if (!_data && capacity != 0)
+                OUT_OF_MEMORY;
+#endif
+        }
+
+        FORCE_INLINE void Relocate(uint64 capacity, int32 oldCount, int32 newCount)
+        {
+            uint64 newLargePagesSize;
+            T* newData = AllocateData(capacity * sizeof(T), newLargePagesSize);
+#if !BUILD_RELEASE
+            if (!newData && capacity != 0)
+                OUT_OF_MEMORY;
+#endif
+
+            if (oldCount)
+            {
+                if (newCount > 0)
+                    Memory::MoveItems(newData, _data, newCount);
+                Memory::DestructItems(_data, oldCount);
+            }
+
+            FreeData(_data, _largePagesSize);
+            _data = newData;
+            _largePagesSize = newLargePagesSize;
+        }
+
+        FORCE_INLINE void Free()
+        {
+            FreeData(_data, _largePagesSize);
+            _data = nullptr;
+            _largePagesSize = 0;
+        }
+
+        FORCE_INLINE void Swap(Data& other)
+        {
+            ::Swap(_data, other._data);
+            ::Swap(_largePagesSize, other._largePagesSize);
+        }
+    };
+};
+
 /// <summary>
 /// The memory allocation policy that uses inlined memory of the fixed size and supports using additional allocation to increase its capacity (eg. via heap allocation).
 /// </summary>
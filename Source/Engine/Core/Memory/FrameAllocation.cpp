@@ -0,0 +1,207 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "FrameAllocation.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
+
+// Size of the single arena page (larger allocations get a dedicated page)
+#define FRAME_ALLOCATION_PAGE_SIZE (256 * 1024)
+#define FRAME_ALLOCATION_GUARD_MAGIC 0xFEEDF00D
+
+namespace
+{
+    struct FramePage
+    {
+        FramePage* Next;
+        uintptr Size;
+        uintptr Offset;
+
+        FORCE_INLINE byte* GetData()
+        {
+            return (byte*)this + sizeof(FramePage);
+        }
+    };
+
+#if FRAME_ALLOCATION_DEBUG
+    struct FrameAllocationHeader
+    {
+        uint32 Magic;
+        uint32 Size;
+        uint64 Frame;
+        FrameAllocationHeader* Prev;
+        uint64 Padding;
+    };
+#endif
+
+    struct FrameArena
+    {
+        FramePage* First = nullptr;
+        FramePage* Current = nullptr;
+        uint64 Frame = 0;
+        uint64 Reserved = 0;
+#if FRAME_ALLOCATION_DEBUG
+        FrameAllocationHeader* Last = nullptr;
+#endif
+    };
+
+    volatile int64 Frame = 1;
+    CriticalSection ArenasLocker;
+    Array<FrameArena*> Arenas;
+    THREADLOCAL FrameArena* ThreadArena = nullptr;
+
+    FramePage* AllocatePage(FrameArena* arena, uintptr minSize)
+    {
+        uintptr size = Math::Max<uintptr>(FRAME_ALLOCATION_PAGE_SIZE, minSize + sizeof(FramePage));
+        FramePage* page = nullptr;
+        const uintptr largePageSize = (uintptr)Platform::GetLargePageSize();
+        if (largePageSize != 0)
+        {
+            // Arena pages live until exit so use the large pages to reduce TLB misses
+            size = Math::AlignUp(size, largePageSize);
+            page = (FramePage*)Platform::AllocateLargePages(size);
+        }
+        if (!page)
+            page = (FramePage*)Platform::Allocate(size, 16);
+        if (!page)
+            OUT_OF_MEMORY;
+        page->Next = nullptr;
+        page->Size = size - sizeof(FramePage);
+        page->Offset = 0;
+        arena->Reserved += size;
+        return page;
+    }
+
+    void ResetArena(FrameArena* arena)
+    {
+#if FRAME_ALLOCATION_DEBUG
+        // Validate guards of all allocations from the ended frame
+        for (auto header = arena->Last; header; header = header->Prev)
+        {
+            ASSERT(header->Magic == FRAME_ALLOCATION_GUARD_MAGIC);
+            const uint32 guard = *(uint32*)((byte*)header + sizeof(FrameAllocationHeader) + header->Size);
+            ASSERT_LOW_LAYER(guard == FRAME_ALLOCATION_GUARD_MAGIC);
+            if (guard != FRAME_ALLOCATION_GUARD_MAGIC)
+                CRASH;
+        }
+        arena->Last = nullptr;
+#endif
+        for (auto page = arena->First; page; page = page->Next)
+            page->Offset = 0;
+        arena->Current = arena->First;
+        arena->Frame = (uint64)Platform::AtomicRead(&Frame);
+    }
+
+    FrameArena* GetArena()
+    {
+        FrameArena* arena = ThreadArena;
+        if (!arena)
+        {
+            arena = New<FrameArena>();
+            arena->Frame = (uint64)Platform::AtomicRead(&Frame);
+            ThreadArena = arena;
+            ArenasLocker.Lock();
+            Arenas.Add(arena);
+            ArenasLocker.Unlock();
+        }
+        else if (arena->Frame != (uint64)Platform::AtomicRead(&Frame))
+        {
+            // Lazy reset on the first allocation within a new frame
+            ResetArena(arena);
+        }
+        return arena;
+    }
+
+    FORCE_INLINE uintptr AlignUp(uintptr value, uintptr alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+void* FrameAllocation::Allocate(uintptr size, uintptr alignment)
+{
+    FrameArena* arena = GetArena();
+#if FRAME_ALLOCATION_DEBUG
+    // Add space for the header and the trailing guard
+    ASSERT(alignment <= sizeof(FrameAllocationHeader));
+    alignment = sizeof(FrameAllocationHeader);
+    const uintptr totalSize = sizeof(FrameAllocationHeader) + size + sizeof(uint32);
+#else
+    const uintptr totalSize = size;
+#endif
+
+    // Find the page with enough space left (pages from the previous frames are reused)
+    FramePage* page = arena->Current;
+    uintptr offset = 0;
+    while (page)
+    {
+        offset = AlignUp((uintptr)page->GetData() + page->Offset, alignment) - (uintptr)page->GetData();
+        if (offset + totalSize <= page->Size)
+            break;
+        if (!page->Next)
+            page->Next = AllocatePage(arena, totalSize + alignment);
+        page = page->Next;
+    }
+    if (!page)
+    {
+        page = AllocatePage(arena, totalSize + alignment);
+        arena->First = page;
+        offset = AlignUp((uintptr)page->GetData(), alignment) - (uintptr)page->GetData();
+    }
+    arena->Current = page;
+    byte* result = page->GetData() + offset;
+    page->Offset = offset + totalSize;
+
+#if FRAME_ALLOCATION_DEBUG
+    auto header = (FrameAllocationHeader*)result;
+    header->Magic = FRAME_ALLOCATION_GUARD_MAGIC;
+    header->Size = (uint32)size;
+    header->Frame = arena->Frame;
+    header->Prev = arena->Last;
+    arena->Last = header;
+    result += sizeof(FrameAllocationHeader);
+    *(uint32*)(result + size) = FRAME_ALLOCATION_GUARD_MAGIC;
+#endif
+    return result;
+}
+
+void FrameAllocation::Free(void* ptr, uintptr size)
+{
+    FrameArena* arena = ThreadArena;
+#if FRAME_ALLOCATION_DEBUG
+    // Detect memory overflows and usage after the frame end
+    auto header = (FrameAllocationHeader*)((byte*)ptr - sizeof(FrameAllocationHeader));
+    ASSERT(header->Magic == FRAME_ALLOCATION_GUARD_MAGIC && header->Size == (uint32)size);
+    ASSERT(*(uint32*)((byte*)ptr + size) == FRAME_ALLOCATION_GUARD_MAGIC);
+    ASSERT(header->Frame == (uint64)Platform::AtomicRead(&Frame));
+    if (arena && arena->Last == header && (byte*)header >= arena->Current->GetData() && (byte*)header < arena->Current->GetData() + arena->Current->Offset)
+    {
+        // Rollback the most recent allocation
+        arena->Last = header->Prev;
+        arena->Current->Offset = (byte*)header - arena->Current->GetData();
+    }
+#else
+    if (arena && arena->Frame == (uint64)Platform::AtomicRead(&Frame))
+    {
+        // Rollback the most recent allocation
+        FramePage* page = arena->Current;
+        if (page && (byte*)ptr + size == page->GetData() + page->Offset)
+            page->Offset = (byte*)ptr - page->GetData();
+    }
+#endif
+}
+
+void FrameAllocation::EndFrame()
+{
+    Platform::InterlockedIncrement(&Frame);
+}
+
+uint64 FrameAllocation::GetReservedMemory()
+{
+    uint64 result = 0;
+    ArenasLocker.Lock();
+    for (const FrameArena* arena : Arenas)
+        result += arena->Reserved;
+    ArenasLocker.Unlock();
+    return result;
+}
@@ -0,0 +1,123 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Memory.h"
+#include "Engine/Core/Core.h"
+
+// Enables frame allocations overflow detection (guard bytes validation and cross-frame usage checks)
+#define FRAME_ALLOCATION_DEBUG (BUILD_DEBUG)
+
+/// <summary>
+/// The memory allocation policy that uses per-thread linear (bump) allocator with a frame lifetime. All allocations are released in bulk at the end of the engine main loop tick (see EndFrame).
+/// Can be used as a drop-in allocation policy for Array, Dictionary or HashSet to remove heap allocations for temporary data on the hot paths (eg. gameplay, physics queries or networking temporary arrays).
+/// </summary>
+/// <remarks>
+/// Memory allocated with this policy is valid only until the end of the current frame - containers using it cannot be stored across frames or used by async work that outlives a frame.
+/// Containers can be used from any thread (memory is allocated from the calling thread arena).
+/// </remarks>
+class FrameAllocation
+{
+public:
+    /// <summary>
+    /// Allocates a memory block from the calling thread frame arena.
+    /// </summary>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    /// <param name="alignment">The memory alignment (in bytes). Must be an integer power of 2.</param>
+    /// <returns>The pointer to the allocated memory, valid until the end of the current frame.</returns>
+    static FLAXENGINE_API void* Allocate(uintptr size, uintptr alignment = 16);
+
+    /// <summary>
+    /// Frees a memory block allocated from the frame arena. Memory is reused only if the block is the most recent allocation of the calling thread (otherwise it's released in bulk at the frame end).
+    /// </summary>
+    /// <param name="ptr">The pointer to the memory block.</param>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    static FLAXENGINE_API void Free(void* ptr, uintptr size);
+
+    /// <summary>
+    /// Ends the current frame and releases all frame allocations (in bulk). Each thread arena gets reset on its first allocation within the new frame.
+    /// </summary>
+    /// <remarks>Called by the engine at the end of the main loop tick.</remarks>
+    static FLAXENGINE_API void EndFrame();
+
+    /// <summary>
+    /// Gets the total amount of memory (in bytes) reserved by the frame arenas of all threads.
+    /// </summary>
+    static FLAXENGINE_API uint64 GetReservedMemory();
+
+    template<typename T>
+    class Data
+    {
+    private:
+        T* _data = nullptr;
+        uintptr _size = 0;
+
+    public:
+        FORCE_INLINE Data()
+        {
+        }
+
+        FORCE_INLINE ~Data()
+        {
+            if (_data)
+                FrameAllocation::Free(_data, _size);
+        }
+
+        FORCE_INLINE T* Get()
+        {
+            return _data;
+        }
+
+        FORCE_INLINE const T* Get() const
+        {
+            return _data;
+        }
+
+        FORCE_INLINE int32 CalculateCapacityGrow(int32 capacity, int32 minCapacity) const
+        {
+            capacity = capacity ? capacity * 2 : 16;
+            if (capacity < minCapacity)
+                capacity = minCapacity;
+            return capacity;
+        }
+
+        FORCE_INLINE void Allocate(uint64 capacity)
+        {
+#if ENABLE_ASSERTION_LOW_LAYERS
+            ASSERT(!_data);
+#endif
+            _size = capacity * sizeof(T);
+            _data = (T*)FrameAllocation::Allocate(_size, alignof(T) > 16 ? alignof(T) : 16);
+        }
+
+        FORCE_INLINE void Relocate(uint64 capacity, int32 oldCount, int32 newCount)
+        {
+            T* newData = capacity != 0 ? (T*)FrameAllocation::Allocate(capacity * sizeof(T), alignof(T) > 16 ? alignof(T) : 16) : nullptr;
+            if (oldCount)
+            {
+                if (newCount > 0)
+                    Memory::MoveItems(newData, _data, newCount);
+                Memory::DestructItems(_data, oldCount);
+            }
+            if (_data)
+                FrameAllocation::Free(_data, _size);
+            _data = newData;
+            _size = capacity * sizeof(T);
+        }
+
+        FORCE_INLINE void Free()
+        {
+            if (_data)
+            {
+                FrameAllocation::Free(_data, _size);
+                _data = nullptr;
+            }
+        }
+
+        FORCE_INLINE void Swap(Data& other)
+        {
+            ::Swap(_data, other._data);
+            ::Swap(_size, other._size);
+        }
+    };
+};
@@ -6,6 +6,7 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/ConcurrentQueue.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/ScriptingObject.h"
 
@@ -14,12 +15,102 @@ const Char* HertzSizesData[] = { TEXT("Hz"), TEXT("KHz"), TEXT("MHz"), TEXT("GHz
 Span<const Char*> Utilities::Private::BytesSizes(BytesSizesData, ARRAY_COUNT(BytesSizesData));
 Span<const Char*> Utilities::Private::HertzSizes(HertzSizesData, ARRAY_COUNT(HertzSizesData));
 
+// The amount of the timing wheel slots (each slot holds the objects that time out within the single resolution step)
+#define OBJECTS_REMOVAL_WHEEL_SLOTS 256
+
+// The time resolution of the timing wheel slot (in seconds)
+#define OBJECTS_REMOVAL_WHEEL_RESOLUTION (1.0 / 32.0)
+
 namespace ObjectsRemovalServiceImpl
 {
+    struct PendingItem
+    {
+        Object* Obj;
+        float TimeToLive;
+        bool UseGameTime;
+    };
+
+    struct PoolEntry
+    {
+        double Deadline;
+        int64 Tick;
+        bool UseGameTime;
+    };
+
+    struct WheelItem
+    {
+        Object* Obj;
+        int64 Tick;
+    };
+
+    // Timing wheel with the objects to remove bucketed by the timeout tick (flush cost scales with the amount of expiring objects)
+    struct Wheel
+    {
+        double Time = 0;
+        int64 Tick = 0;
+        Array<WheelItem> Slots[OBJECTS_REMOVAL_WHEEL_SLOTS];
+    };
+
     CriticalSection PoolLocker;
     DateTime LastUpdate;
     float LastUpdateGameTime;
-    Dictionary<Object*, float> Pool(8192);
+    Dictionary<Object*, PoolEntry> Pool(8192);
+    Wheel Wheels[2]; // 0 - absolute time, 1 - game time
+    ConcurrentQueue<PendingItem> Pending;
+
+    FORCE_INLINE int64 GetTick(double time)
+    {
+        return (int64)Math::Floor(time / OBJECTS_REMOVAL_WHEEL_RESOLUTION);
+    }
+
+    void FlushPending()
+    {
+        // Move newly added objects from the lock-free queue into the pool
+        PendingItem items[64];
+        size_t count;
+        while ((count = Pending.try_dequeue_bulk(items, ARRAY_COUNT(items))) != 0)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                const PendingItem& item = items[i];
+                Wheel& wheel = Wheels[item.UseGameTime ? 1 : 0];
+                PoolEntry& entry = Pool[item.Obj];
+                entry.Deadline = wheel.Time + item.TimeToLive;
+                entry.Tick = Math::Max(GetTick(entry.Deadline), wheel.Tick);
+                entry.UseGameTime = item.UseGameTime;
+                wheel.Slots[entry.Tick % OBJECTS_REMOVAL_WHEEL_SLOTS].Add({ item.Obj, entry.Tick });
+            }
+        }
+    }
+
+    void CollectExpired(Wheel& wheel, bool useGameTime, int64 prevTick, Array<Object*>& expired)
+    {
+        // Visit all slots passed since the last update (including the current one with objects that may be not yet expired)
+        const int64 slotsCount = Math::Min<int64>(wheel.Tick - prevTick + 1, OBJECTS_REMOVAL_WHEEL_SLOTS);
+        for (int64 tick = wheel.Tick - slotsCount + 1; tick <= wheel.Tick; tick++)
+        {
+            auto& slot = wheel.Slots[tick % OBJECTS_REMOVAL_WHEEL_SLOTS];
+            int32 kept = 0;
+            for (int32 i = 0; i < slot.Count(); i++)
+            {
+                const WheelItem item = slot[i];
+                if (item.Tick > wheel.Tick)
+                {
+                    // Object times out in one of the next wheel rounds
+                    slot[kept++] = item;
+                    continue;
+                }
+                const PoolEntry* entry = Pool.TryGet(item.Obj);
+                if (!entry || entry->Tick != item.Tick || entry->UseGameTime != useGameTime)
+                    continue; // Object was dereferenced or added again with a different timeout
+                if (entry->Deadline <= wheel.Time)
+                    expired.Add(item.Obj);
+                else
+                    slot[kept++] = item;
+            }
+            slot.Resize(kept, false);
+        }
+    }
 }
 
 using namespace ObjectsRemovalServiceImpl;
@@ -42,6 +133,7 @@ ObjectsRemoval ObjectsRemovalInstance;
 bool ObjectsRemovalService::IsInPool(Object* obj)
 {
     PoolLocker.Lock();
+    FlushPending();
     const bool result = Pool.ContainsKey(obj);
     PoolLocker.Unlock();
     return result;
@@ -50,6 +142,7 @@ bool ObjectsRemovalService::IsInPool(Object* obj)
 void ObjectsRemovalService::Dereference(Object* obj)
 {
     PoolLocker.Lock();
+    FlushPending();
     Pool.Remove(obj);
     PoolLocker.Unlock();
 }
@@ -62,9 +155,27 @@ void ObjectsRemovalService::Add(Object* obj, float timeToLive, bool useGameTime)
     else
         obj->Flags &= ~ObjectFlags::UseGameTimeForDelete;
 
-    PoolLocker.Lock();
-    Pool[obj] = timeToLive;
-    PoolLocker.Unlock();
+    Pending.enqueue({ obj, timeToLive, useGameTime });
+}
+
+void ObjectsRemovalService::Add(const Span<Object*>& objects, float timeToLive, bool useGameTime)
+{
+    PendingItem items[64];
+    for (int32 i = 0; i < objects.Length(); i += ARRAY_COUNT(items))
+    {
+        const int32 count = Math::Min(objects.Length() - i, (int32)ARRAY_COUNT(items));
+        for (int32 j = 0; j < count; j++)
+        {
+            Object* obj = objects[i + j];
+            obj->Flags |= ObjectFlags::WasMarkedToDelete;
+            if (useGameTime)
+                obj->Flags |= ObjectFlags::UseGameTimeForDelete;
+            else
+                obj->Flags &= ~ObjectFlags::UseGameTimeForDelete;
+            items[j] = { obj, timeToLive, useGameTime };
+        }
+        Pending.enqueue_bulk(items, count);
+    }
 }
 
 void ObjectsRemovalService::Flush(float dt, float gameDelta)
@@ -73,28 +184,37 @@ void ObjectsRemovalService::Flush(float dt, float gameDelta)
 
     PoolLocker.Lock();
 
-    int32 itemsLeft;
+    // Advance time
+    const int64 prevTicks[2] = { Wheels[0].Tick, Wheels[1].Tick };
+    Wheels[0].Time += dt;
+    Wheels[1].Time += gameDelta;
+    for (Wheel& wheel : Wheels)
+        wheel.Tick = GetTick(wheel.Time);
+
+    Array<Object*> expired;
     do
     {
-        // Update timeouts and delete objects that timed out
-        itemsLeft = Pool.Count();
-        for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
+        // Collect objects that timed out
+        FlushPending();
+        CollectExpired(Wheels[0], false, prevTicks[0], expired);
+        CollectExpired(Wheels[1], true, prevTicks[1], expired);
+        if (expired.IsEmpty())
+            break;
+
+        // Delete objects in a batch (skip the ones dereferenced in the meantime, eg. child object deleted by its parent)
+        for (int32 i = 0; i < expired.Count(); i++)
         {
-            Object* obj = i->Key;
-            const float ttl = i->Value - ((obj->Flags & ObjectFlags::UseGameTimeForDelete) != ObjectFlags::None ? gameDelta : dt);
-            if (ttl <= 0.0f)
+            Object* obj = expired[i];
+            const PoolEntry* entry = Pool.TryGet(obj);
+            if (entry && entry->Deadline <= Wheels[entry->UseGameTime ? 1 : 0].Time)
             {
-                Pool.Remove(i);
+                Pool.Remove(obj);
                 obj->OnDeleteObject();
-                itemsLeft--;
-            }
-            else
-            {
-                i->Value = ttl;
             }
         }
+        expired.Clear();
     }
-    while (itemsLeft != Pool.Count()); // Continue removing if any new item was added during removing (eg. sub-object delete with 0 timeout)
+    while (Pending.Count() != 0); // Continue removing if any new item was added during removing (eg. sub-object delete with 0 timeout)
 
     PoolLocker.Unlock();
 }
@@ -128,6 +248,7 @@ void ObjectsRemoval::Dispose()
     // Delete all remaining objects
     {
         ScopeLock lock(PoolLocker);
+        FlushPending();
         for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
         {
             Object* obj = i->Key;
@@ -135,6 +256,11 @@ void ObjectsRemoval::Dispose()
             obj->OnDeleteObject();
         }
         Pool.Clear();
+        for (Wheel& wheel : Wheels)
+        {
+            for (auto& slot : wheel.Slots)
+                slot.Clear();
+        }
     }
 }
 
@@ -3,10 +3,14 @@
 #pragma once
 
 #include "Object.h"
+#include "Types/Span.h"
 
 /// <summary>
 /// Removing old objects service. Your friendly garbage collector!
 /// </summary>
+/// <remarks>
+/// Objects can be added from any thread without locking (lock-free queue) and are bucketed by the timeout in a timing wheel so the flush cost depends on the amount of the expiring objects rather than the whole pool size.
+/// </remarks>
 class FLAXENGINE_API ObjectsRemovalService
 {
 public:
@@ -31,6 +35,14 @@ class FLAXENGINE_API ObjectsRemovalService
     /// <param name="useGameTime">True if unscaled game time for the object life timeout, otherwise false to use absolute time.</param>
     static void Add(Object* obj, float timeToLive = 1.0f, bool useGameTime = false);
 
+    /// <summary>
+    /// Adds the specified objects to the dead pool (in a batch).
+    /// </summary>
+    /// <param name="objects">The objects.</param>
+    /// <param name="timeToLive">The time to live (in seconds).</param>
+    /// <param name="useGameTime">True if unscaled game time for the object life timeout, otherwise false to use absolute time.</param>
+    static void Add(const Span<Object*>& objects, float timeToLive = 1.0f, bool useGameTime = false);
+
     /// <summary>
     /// Flushes the objects pool removing objects marked to remove now (with negative or zero time to live).
     /// </summary>
@@ -4,8 +4,10 @@
 
 #include "Engine/Platform/Platform.h"
 #if PLATFORM_SIMD_SSE2
-#ifdef _WIN32
 #include <xmmintrin.h>
+#include <emmintrin.h>
+#if PLATFORM_SIMD_SSE4_1
+#include <smmintrin.h>
 #endif
 #else
 #include <math.h>
@@ -33,6 +35,17 @@ namespace SIMD
         return _mm_load_ps((const float*)(src));
     }
 
+    FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+    {
+        return _mm_loadu_ps((const float*)(src));
+    }
+
+    // Loads four 16-bit unsigned integers and converts them into the floating point values.
+    FORCE_INLINE SimdVector4 LoadUShort4(const uint16* src)
+    {
+        return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)src), _mm_setzero_si128()));
+    }
+
     FORCE_INLINE SimdVector4 Splat(float value)
     {
         return _mm_set_ps1(value);
@@ -43,6 +56,11 @@ namespace SIMD
         _mm_store_ps((float*)dst, src);
     }
 
+    FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+    {
+        _mm_storeu_ps((float*)dst, src);
+    }
+
     FORCE_INLINE int MoveMask(SimdVector4 a)
     {
         return _mm_movemask_ps(a);
@@ -92,6 +110,67 @@ namespace SIMD
     {
         return _mm_max_ps(a, b);
     }
+
+    // Returns a * b + c.
+    FORCE_INLINE SimdVector4 MulAdd(SimdVector4 a, SimdVector4 b, SimdVector4 c)
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+
+    // Returns the per-component mask (all bits set if true) of a < b.
+    FORCE_INLINE SimdVector4 Less(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_cmplt_ps(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 And(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_and_ps(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Or(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_or_ps(a, b);
+    }
+
+    // Returns ~a & b.
+    FORCE_INLINE SimdVector4 AndNot(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_andnot_ps(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Xor(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_xor_ps(a, b);
+    }
+
+    // Returns the per-component a if mask is set, otherwise b.
+    FORCE_INLINE SimdVector4 Select(SimdVector4 mask, SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    FORCE_INLINE SimdVector4 Abs(SimdVector4 a)
+    {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+    }
+
+    // Returns the per-component largest integer value that is less than or equal to a (valid for values within the 32-bit integer range).
+    FORCE_INLINE SimdVector4 Floor(SimdVector4 a)
+    {
+#if PLATFORM_SIMD_SSE4_1
+        return _mm_floor_ps(a);
+#else
+        const SimdVector4 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmplt_ps(a, truncated), _mm_set1_ps(1.0f)));
+#endif
+    }
+
+    // Transposes the 4x4 matrix stored in the rows (eg. converts four XYZW vectors into the XXXX, YYYY, ZZZZ and WWWW vectors).
+    FORCE_INLINE void Transpose(SimdVector4& r0, SimdVector4& r1, SimdVector4& r2, SimdVector4& r3)
+    {
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    }
 }
 
 #else
@@ -118,6 +197,19 @@ namespace SIMD
 		return *(const SimdVector4*)src;
 	}
 
+	FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+	{
+		SimdVector4 result;
+		Platform::MemoryCopy(&result, src, sizeof(SimdVector4));
+		return result;
+	}
+
+	// Loads four 16-bit unsigned integers and converts them into the floating point values.
+	FORCE_INLINE SimdVector4 LoadUShort4(const uint16* src)
+	{
+		return { (float)src[0], (float)src[1], (float)src[2], (float)src[3] };
+	}
+
 	FORCE_INLINE SimdVector4 Splat(float value)
 	{
 		return { value, value, value, value };
@@ -128,12 +220,32 @@ namespace SIMD
 		(*(SimdVector4*)dst) = src;
 	}
 
+	FORCE_INLINE void StoreUnaligned(void* dst, SimdVector4 src)
+	{
+		Platform::MemoryCopy(dst, &src, sizeof(SimdVector4));
+	}
+
+	FORCE_INLINE uint32 AsBits(float value)
+	{
+		uint32 result;
+		Platform::MemoryCopy(&result, &value, sizeof(float));
+		return result;
+	}
+
+	FORCE_INLINE float FromBits(uint32 value)
+	{
+		float result;
+		Platform::MemoryCopy(&result, &value, sizeof(float));
+		return result;
+	}
+
 	FORCE_INLINE int MoveMask(SimdVector4 a)
 	{
-		return (a.W < 0 ? (1 << 3) : 0) |
-				(a.Z < 0 ? (1 << 2) : 0) |
-				(a.Y < 0 ? (1 << 1) : 0) |
-				(a.X < 0 ? 1 : 0);
+		// Use sign bits to match the SSE behavior (including masks from the comparisons)
+		return (AsBits(a.W) >> 31 << 3) |
+				(AsBits(a.Z) >> 31 << 2) |
+				(AsBits(a.Y) >> 31 << 1) |
+				(AsBits(a.X) >> 31);
 	}
 
 	FORCE_INLINE SimdVector4 Add(SimdVector4 a, SimdVector4 b)
@@ -234,6 +346,108 @@ namespace SIMD
 			a.W > b.W ? a.W : b.W
 		};
 	}
+
+	// Returns a * b + c.
+	FORCE_INLINE SimdVector4 MulAdd(SimdVector4 a, SimdVector4 b, SimdVector4 c)
+	{
+		return
+		{
+			a.X * b.X + c.X,
+			a.Y * b.Y + c.Y,
+			a.Z * b.Z + c.Z,
+			a.W * b.W + c.W
+		};
+	}
+
+	// Returns the per-component mask (all bits set if true) of a < b.
+	FORCE_INLINE SimdVector4 Less(SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			FromBits(a.X < b.X ? 0xffffffff : 0),
+			FromBits(a.Y < b.Y ? 0xffffffff : 0),
+			FromBits(a.Z < b.Z ? 0xffffffff : 0),
+			FromBits(a.W < b.W ? 0xffffffff : 0)
+		};
+	}
+
+	FORCE_INLINE SimdVector4 And(SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			FromBits(AsBits(a.X) & AsBits(b.X)),
+			FromBits(AsBits(a.Y) & AsBits(b.Y)),
+			FromBits(AsBits(a.Z) & AsBits(b.Z)),
+			FromBits(AsBits(a.W) & AsBits(b.W))
+		};
+	}
+
+	FORCE_INLINE SimdVector4 Or(SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			FromBits(AsBits(a.X) | AsBits(b.X)),
+			FromBits(AsBits(a.Y) | AsBits(b.Y)),
+			FromBits(AsBits(a.Z) | AsBits(b.Z)),
+			FromBits(AsBits(a.W) | AsBits(b.W))
+		};
+	}
+
+	// Returns ~a & b.
+	FORCE_INLINE SimdVector4 AndNot(SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			FromBits(~AsBits(a.X) & AsBits(b.X)),
+			FromBits(~AsBits(a.Y) & AsBits(b.Y)),
+			FromBits(~AsBits(a.Z) & AsBits(b.Z)),
+			FromBits(~AsBits(a.W) & AsBits(b.W))
+		};
+	}
+
+	FORCE_INLINE SimdVector4 Xor(SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			FromBits(AsBits(a.X) ^ AsBits(b.X)),
+			FromBits(AsBits(a.Y) ^ AsBits(b.Y)),
+			FromBits(AsBits(a.Z) ^ AsBits(b.Z)),
+			FromBits(AsBits(a.W) ^ AsBits(b.W))
+		};
+	}
+
+	// Returns the per-component a if mask is set, otherwise b.
+	FORCE_INLINE SimdVector4 Select(SimdVector4 mask, SimdVector4 a, SimdVector4 b)
+	{
+		return Or(And(mask, a), AndNot(mask, b));
+	}
+
+	FORCE_INLINE SimdVector4 Abs(SimdVector4 a)
+	{
+		return
+		{
+			a.X < 0 ? -a.X : a.X,
+			a.Y < 0 ? -a.Y : a.Y,
+			a.Z < 0 ? -a.Z : a.Z,
+			a.W < 0 ? -a.W : a.W
+		};
+	}
+
+	// Returns the per-component largest integer value that is less than or equal to a (valid for values within the 32-bit integer range).
+	FORCE_INLINE SimdVector4 Floor(SimdVector4 a)
+	{
+		return { floorf(a.X), floorf(a.Y), floorf(a.Z), floorf(a.W) };
+	}
+
+	// Transposes the 4x4 matrix stored in the rows (eg. converts four XYZW vectors into the XXXX, YYYY, ZZZZ and WWWW vectors).
+	FORCE_INLINE void Transpose(SimdVector4& r0, SimdVector4& r1, SimdVector4& r2, SimdVector4& r3)
+	{
+		const SimdVector4 t0 = r0, t1 = r1, t2 = r2, t3 = r3;
+		r0 = { t0.X, t1.X, t2.X, t3.X };
+		r1 = { t0.Y, t1.Y, t2.Y, t3.Y };
+		r2 = { t0.Z, t1.Z, t2.Z, t3.Z };
+		r3 = { t0.W, t1.W, t2.W, t3.W };
+	}
 }
 
 #endif
@@ -73,6 +73,7 @@ struct Variant;
 template<typename T>
 class Span;
 class HeapAllocation;
+class LargePageAllocation;
 template<int Capacity>
 class FixedAllocation;
 template<int Capacity, typename OtherAllocator>
@@ -195,6 +195,22 @@ class DataContainer : public Span<T>
         Base::_data = (T*)data;
     }
 
+    /// <summary>
+    /// Takes the ownership of the memory allocated with the engine Allocator (container will free it). Performs no data copy.
+    /// </summary>
+    /// <param name="data">Data pointer.</param>
+    /// <param name="length">Data length (amount of T elements).</param>
+    void Own(T* data, int32 length)
+    {
+        Release();
+        if (data)
+        {
+            _isAllocated = true;
+            Base::_length = length;
+            Base::_data = data;
+        }
+    }
+
     /// <summary>
     /// Allocate a new memory chunk.
     /// </summary>
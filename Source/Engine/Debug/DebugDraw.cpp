@@ -125,6 +125,47 @@ PACK_STRUCT(struct Vertex {
     Color32 Color;
     });
 
+// The unit-size primitives drawn with instancing (transformed by the instance world matrix)
+enum class DebugPrimitive
+{
+    WireBox,
+    WireSphereLOD0,
+    WireSphereLOD1,
+    WireSphereLOD2,
+    WireArrow,
+    Box,
+    Sphere,
+    MAX
+};
+
+#define DEBUG_DRAW_PRIMITIVES_LINES_COUNT (int32)DebugPrimitive::Box
+
+PACK_STRUCT(struct InstanceData {
+    // Transposed world matrix (4x3, without the last column)
+    Float4 Transform[3];
+    Color32 Color;
+    });
+
+struct DebugInstance
+{
+    InstanceData Data;
+    float TimeLeft;
+};
+
+struct DebugDrawCall
+{
+    int32 StartVertex;
+    int32 VertexCount;
+};
+
+struct DebugDrawCalls
+{
+    DebugDrawCall Lines;
+    DebugDrawCall Triangles;
+    DebugDrawCall WireTriangles;
+    DebugDrawCall Instances[(int32)DebugPrimitive::MAX];
+};
+
 PACK_STRUCT(struct Data {
     Matrix ViewProjection;
     Float3 Padding;
@@ -178,8 +219,9 @@ struct PsData
 };
 
 template<typename T>
-void UpdateList(float dt, Array<T>& list)
+bool UpdateList(float dt, Array<T>& list)
 {
+    bool removed = false;
     for (int32 i = 0; i < list.Count() && list.HasItems(); i++)
     {
         list[i].TimeLeft -= dt;
@@ -187,8 +229,10 @@ void UpdateList(float dt, Array<T>& list)
         {
             list.RemoveAt(i);
             i--;
+            removed = true;
         }
     }
+    return removed;
 }
 
 void TeleportList(const Float3& delta, Array<DebugLine>& list)
@@ -226,6 +270,29 @@ void TeleportList(const Float3& delta, Array<DebugText3D>& list)
     }
 }
 
+FORCE_INLINE void TeleportInstance(const Float3& delta, InstanceData& v)
+{
+    v.Transform[0].W += delta.X;
+    v.Transform[1].W += delta.Y;
+    v.Transform[2].W += delta.Z;
+}
+
+void TeleportList(const Float3& delta, Array<InstanceData>& list)
+{
+    for (auto& v : list)
+    {
+        TeleportInstance(delta, v);
+    }
+}
+
+void TeleportList(const Float3& delta, Array<DebugInstance>& list)
+{
+    for (auto& v : list)
+    {
+        TeleportInstance(delta, v.Data);
+    }
+}
+
 struct DebugDrawData
 {
     Array<DebugLine> DefaultLines;
@@ -238,10 +305,28 @@ struct DebugDrawData
     Array<DebugText2D> OneFrameText2D;
     Array<DebugText3D> DefaultText3D;
     Array<DebugText3D> OneFrameText3D;
+    Array<DebugInstance> DefaultInstances[(int32)DebugPrimitive::MAX];
+    Array<InstanceData> OneFrameInstances[(int32)DebugPrimitive::MAX];
+
+    // Long-lived shapes (with duration) are kept in the persistent buffers that are updated only when shapes get added or expire
+    DynamicVertexBuffer* PersistentVB = nullptr;
+    DynamicVertexBuffer* PersistentInstancesVB = nullptr;
+    DebugDrawCalls Persistent = {};
+    bool PersistentDirty = true;
+
+    DebugDrawData() = default;
+    DebugDrawData(const DebugDrawData&) = delete;
+    DebugDrawData& operator=(const DebugDrawData&) = delete;
+
+    ~DebugDrawData()
+    {
+        SAFE_DELETE(PersistentVB);
+        SAFE_DELETE(PersistentInstancesVB);
+    }
 
     inline int32 Count() const
     {
-        return LinesCount() + TrianglesCount() + TextCount();
+        return LinesCount() + TrianglesCount() + TextCount() + InstancesCount();
     }
 
     inline int32 LinesCount() const
@@ -259,6 +344,22 @@ struct DebugDrawData
         return DefaultText2D.Count() + OneFrameText2D.Count() + DefaultText3D.Count() + OneFrameText3D.Count();
     }
 
+    inline int32 InstancesCount() const
+    {
+        int32 result = 0;
+        for (int32 i = 0; i < (int32)DebugPrimitive::MAX; i++)
+            result += DefaultInstances[i].Count() + OneFrameInstances[i].Count();
+        return result;
+    }
+
+    FORCE_INLINE void AddInstance(DebugPrimitive primitive, const InstanceData& data, float duration)
+    {
+        if (duration > 0)
+            DefaultInstances[(int32)primitive].Add({ data, duration });
+        else
+            OneFrameInstances[(int32)primitive].Add(data);
+    }
+
     inline void Add(const DebugTriangle& t)
     {
         if (t.TimeLeft > 0)
@@ -277,11 +378,16 @@ struct DebugDrawData
 
     inline void Update(float deltaTime)
     {
-        UpdateList(deltaTime, DefaultLines);
-        UpdateList(deltaTime, DefaultTriangles);
-        UpdateList(deltaTime, DefaultWireTriangles);
+        PersistentDirty |= UpdateList(deltaTime, DefaultLines);
+        PersistentDirty |= UpdateList(deltaTime, DefaultTriangles);
+        PersistentDirty |= UpdateList(deltaTime, DefaultWireTriangles);
         UpdateList(deltaTime, DefaultText2D);
         UpdateList(deltaTime, DefaultText3D);
+        for (int32 i = 0; i < (int32)DebugPrimitive::MAX; i++)
+        {
+            PersistentDirty |= UpdateList(deltaTime, DefaultInstances[i]);
+            OneFrameInstances[i].Clear();
+        }
 
         OneFrameLines.Clear();
         OneFrameTriangles.Clear();
@@ -300,8 +406,32 @@ struct DebugDrawData
         TeleportList(delta, OneFrameWireTriangles);
         TeleportList(delta, DefaultText3D);
         TeleportList(delta, OneFrameText3D);
+        for (int32 i = 0; i < (int32)DebugPrimitive::MAX; i++)
+        {
+            TeleportList(delta, DefaultInstances[i]);
+            TeleportList(delta, OneFrameInstances[i]);
+        }
+        PersistentDirty = true;
+    }
+
+    bool IsPersistentDirty() const
+    {
+        // Persistent shapes are only appended or removed (removal marks the buffer as dirty) so counts mismatch detects the new shapes
+        if (PersistentDirty ||
+            Persistent.Lines.VertexCount != DefaultLines.Count() * 2 ||
+            Persistent.Triangles.VertexCount != DefaultTriangles.Count() * 3 ||
+            Persistent.WireTriangles.VertexCount != DefaultWireTriangles.Count() * 3)
+            return true;
+        for (int32 i = 0; i < (int32)DebugPrimitive::MAX; i++)
+        {
+            if (Persistent.Instances[i].VertexCount != DefaultInstances[i].Count())
+                return true;
+        }
+        return false;
     }
 
+    void UpdatePersistent(GPUContext* context);
+
     inline void Clear()
     {
         DefaultLines.Clear();
@@ -314,6 +444,12 @@ struct DebugDrawData
         OneFrameText2D.Clear();
         DefaultText3D.Clear();
         OneFrameText3D.Clear();
+        for (int32 i = 0; i < (int32)DebugPrimitive::MAX; i++)
+        {
+            DefaultInstances[i].Clear();
+            OneFrameInstances[i].Clear();
+        }
+        PersistentDirty = true;
     }
 
     inline void Release()
@@ -328,6 +464,15 @@ struct DebugDrawData
         OneFrameText2D.Resize(0);
         DefaultText3D.Resize(0);
         OneFrameText3D.Resize(0);
+        for (int32 i = 0; i < (int32)DebugPrimitive::MAX; i++)
+        {
+            DefaultInstances[i].Resize(0);
+            OneFrameInstances[i].Resize(0);
+        }
+        SAFE_DELETE(PersistentVB);
+        SAFE_DELETE(PersistentInstancesVB);
+        Persistent = {};
+        PersistentDirty = true;
     }
 };
 
@@ -352,7 +497,14 @@ namespace
     PsData DebugDrawPsWireTrianglesDepthTest;
     PsData DebugDrawPsTrianglesDefault;
     PsData DebugDrawPsTrianglesDepthTest;
+    PsData DebugDrawPsInstancedLinesDefault;
+    PsData DebugDrawPsInstancedLinesDepthTest;
+    PsData DebugDrawPsInstancedTrianglesDefault;
+    PsData DebugDrawPsInstancedTrianglesDepthTest;
     DynamicVertexBuffer* DebugDrawVB = nullptr;
+    DynamicVertexBuffer* DebugDrawInstancesVB = nullptr;
+    GPUBuffer* DebugDrawPrimitivesVB = nullptr;
+    DebugDrawCall DebugDrawPrimitives[(int32)DebugPrimitive::MAX];
     Float3 CircleCache[DEBUG_DRAW_CIRCLE_VERTICES];
     Array<Float3> SphereTriangleCache;
     DebugSphereCache SphereCache[3];
@@ -378,29 +530,23 @@ int32 BoxLineIndicesCache[] =
     // @formatter:on
 };
 
-struct DebugDrawCall
-{
-    int32 StartVertex;
-    int32 VertexCount;
-};
-
-DebugDrawCall WriteList(int32& vertexCounter, const Array<Vertex>& list)
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& vertexCounter, const Array<Vertex>& list)
 {
     DebugDrawCall drawCall;
     drawCall.StartVertex = vertexCounter;
     drawCall.VertexCount = list.Count();
-    DebugDrawVB->Write(list.Get(), sizeof(Vertex) * drawCall.VertexCount);
+    vb->Write(list.Get(), sizeof(Vertex) * drawCall.VertexCount);
     vertexCounter += drawCall.VertexCount;
     return drawCall;
 }
 
-DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugLine>& list)
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& vertexCounter, const Array<DebugLine>& list)
 {
     DebugDrawCall drawCall;
     drawCall.StartVertex = vertexCounter;
     drawCall.VertexCount = list.Count() * 2;
     vertexCounter += drawCall.VertexCount;
-    Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(drawCall.VertexCount);
+    Vertex* dst = vb->WriteReserve<Vertex>(drawCall.VertexCount);
     for (int32 i = 0, j = 0; i < list.Count(); i++)
     {
         const DebugLine& l = list[i];
@@ -410,13 +556,13 @@ DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugLine>& list)
     return drawCall;
 }
 
-DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& vertexCounter, const Array<DebugTriangle>& list)
 {
     DebugDrawCall drawCall;
     drawCall.StartVertex = vertexCounter;
     drawCall.VertexCount = list.Count() * 3;
     vertexCounter += drawCall.VertexCount;
-    Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(drawCall.VertexCount);
+    Vertex* dst = vb->WriteReserve<Vertex>(drawCall.VertexCount);
     for (int32 i = 0, j = 0; i < list.Count(); i++)
     {
         const DebugTriangle& l = list[i];
@@ -427,17 +573,172 @@ DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
     return drawCall;
 }
 
-template<typename T, typename U>
-DebugDrawCall WriteLists(int32& vertexCounter, const Array<T>& listA, const Array<U>& listB)
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& instanceCounter, const Array<InstanceData>& list)
 {
-    const DebugDrawCall drawCallA = WriteList(vertexCounter, listA);
-    const DebugDrawCall drawCallB = WriteList(vertexCounter, listB);
     DebugDrawCall drawCall;
-    drawCall.StartVertex = drawCallA.StartVertex;
-    drawCall.VertexCount = drawCallA.VertexCount + drawCallB.VertexCount;
+    drawCall.StartVertex = instanceCounter;
+    drawCall.VertexCount = list.Count();
+    vb->Write(list.Get(), sizeof(InstanceData) * drawCall.VertexCount);
+    instanceCounter += drawCall.VertexCount;
     return drawCall;
 }
 
+DebugDrawCall WriteList(DynamicVertexBuffer* vb, int32& instanceCounter, const Array<DebugInstance>& list)
+{
+    DebugDrawCall drawCall;
+    drawCall.StartVertex = instanceCounter;
+    drawCall.VertexCount = list.Count();
+    instanceCounter += drawCall.VertexCount;
+    InstanceData* dst = vb->WriteReserve<InstanceData>(drawCall.VertexCount);
+    for (int32 i = 0; i < list.Count(); i++)
+        dst[i] = list.Get()[i].Data;
+    return drawCall;
+}
+
+void DebugDrawData::UpdatePersistent(GPUContext* context)
+{
+    if (!IsPersistentDirty())
+        return;
+    PROFILE_CPU_NAMED("Update Persistent Buffer");
+    PersistentDirty = false;
+    if (!PersistentVB)
+    {
+        PersistentVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_VB_CAPACITY * sizeof(Vertex)), (uint32)sizeof(Vertex), TEXT("DebugDraw.PersistentVB"));
+        PersistentInstancesVB = New<DynamicVertexBuffer>((uint32)(256 * sizeof(InstanceData)), (uint32)sizeof(InstanceData), TEXT("DebugDraw.PersistentInstancesVB"));
+    }
+
+    // Vertices
+    PersistentVB->Clear();
+    int32 vertexCounter = 0;
+    Persistent.Lines = WriteList(PersistentVB, vertexCounter, DefaultLines);
+    Persistent.Triangles = WriteList(PersistentVB, vertexCounter, DefaultTriangles);
+    Persistent.WireTriangles = WriteList(PersistentVB, vertexCounter, DefaultWireTriangles);
+    if (vertexCounter)
+        PersistentVB->Flush(context);
+
+    // Instances
+    PersistentInstancesVB->Clear();
+    int32 instanceCounter = 0;
+    for (int32 i = 0; i < (int32)DebugPrimitive::MAX; i++)
+        Persistent.Instances[i] = WriteList(PersistentInstancesVB, instanceCounter, DefaultInstances[i]);
+    if (instanceCounter)
+        PersistentInstancesVB->Flush(context);
+}
+
+void WriteInstance(InstanceData& instance, const Matrix& world, const Color& color)
+{
+    instance.Transform[0] = Float4(world.M11, world.M21, world.M31, world.M41);
+    instance.Transform[1] = Float4(world.M12, world.M22, world.M32, world.M42);
+    instance.Transform[2] = Float4(world.M13, world.M23, world.M33, world.M43);
+    instance.Color = Color32(color);
+}
+
+FORCE_INLINE void AddInstance(DebugPrimitive primitive, const Matrix& world, const Color& color, float duration, bool depthTest)
+{
+    InstanceData instance;
+    WriteInstance(instance, world, color);
+    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    debugDrawData.AddInstance(primitive, instance, duration);
+}
+
+void GetWorld(const OrientedBoundingBox& box, Matrix& world)
+{
+    // Unit box corners are at -1 and 1 so scale it by the box extents before the box transformation
+    Transform transform = box.Transformation;
+    transform.Translation -= Context->Origin;
+    transform.Scale *= Float3(box.Extents);
+    transform.GetWorld(world);
+}
+
+void DrawList(GPUContext* context, GPUBuffer* vb, const DebugDrawCall& drawCall)
+{
+    if (drawCall.VertexCount)
+    {
+        context->BindVB(ToSpan(&vb, 1));
+        context->Draw(drawCall.StartVertex, drawCall.VertexCount);
+    }
+}
+
+void DrawInstances(GPUContext* context, GPUBuffer* instancesVB, const DebugDrawCall& drawCall, int32 primitive)
+{
+    if (drawCall.VertexCount)
+    {
+        const DebugDrawCall& mesh = DebugDrawPrimitives[primitive];
+        GPUBuffer* vbs[2] = { DebugDrawPrimitivesVB, instancesVB };
+        context->BindVB(ToSpan(vbs, 2));
+        context->DrawInstanced(mesh.VertexCount, drawCall.VertexCount, drawCall.StartVertex, mesh.StartVertex);
+    }
+}
+
+// Draws the persistent shapes and the one-frame shapes of the debug draw data
+void DrawData(GPUContext* context, const DebugDrawData& data, const DebugDrawCalls& oneFrame, bool depthTest, bool depthWrite, bool customDepthTest)
+{
+    GPUBuffer* vb = DebugDrawVB->GetBuffer();
+    GPUBuffer* persistentVB = data.PersistentVB ? data.PersistentVB->GetBuffer() : nullptr;
+    GPUBuffer* instancesVB = DebugDrawInstancesVB->GetBuffer();
+    GPUBuffer* persistentInstancesVB = data.PersistentInstancesVB ? data.PersistentInstancesVB->GetBuffer() : nullptr;
+    const DebugDrawCalls& persistent = data.Persistent;
+
+    // Lines
+    if (oneFrame.Lines.VertexCount + persistent.Lines.VertexCount)
+    {
+        auto state = customDepthTest ? &DebugDrawPsLinesDepthTest : &DebugDrawPsLinesDefault;
+        context->SetState(state->Get(depthWrite, depthTest));
+        DrawList(context, persistentVB, persistent.Lines);
+        DrawList(context, vb, oneFrame.Lines);
+    }
+    {
+        auto state = customDepthTest ? &DebugDrawPsInstancedLinesDepthTest : &DebugDrawPsInstancedLinesDefault;
+        bool stateSet = false;
+        for (int32 i = 0; i < DEBUG_DRAW_PRIMITIVES_LINES_COUNT; i++)
+        {
+            if (oneFrame.Instances[i].VertexCount + persistent.Instances[i].VertexCount == 0)
+                continue;
+            if (!stateSet)
+            {
+                stateSet = true;
+                context->SetState(state->Get(depthWrite, depthTest));
+            }
+            DrawInstances(context, persistentInstancesVB, persistent.Instances[i], i);
+            DrawInstances(context, instancesVB, oneFrame.Instances[i], i);
+        }
+    }
+
+    // Wire Triangles
+    if (oneFrame.WireTriangles.VertexCount + persistent.WireTriangles.VertexCount)
+    {
+        auto state = customDepthTest ? &DebugDrawPsWireTrianglesDepthTest : &DebugDrawPsWireTrianglesDefault;
+        context->SetState(state->Get(depthWrite, depthTest));
+        DrawList(context, persistentVB, persistent.WireTriangles);
+        DrawList(context, vb, oneFrame.WireTriangles);
+    }
+
+    // Triangles
+    if (oneFrame.Triangles.VertexCount + persistent.Triangles.VertexCount)
+    {
+        auto state = customDepthTest ? &DebugDrawPsTrianglesDepthTest : &DebugDrawPsTrianglesDefault;
+        context->SetState(state->Get(depthWrite, depthTest));
+        DrawList(context, persistentVB, persistent.Triangles);
+        DrawList(context, vb, oneFrame.Triangles);
+    }
+    {
+        auto state = customDepthTest ? &DebugDrawPsInstancedTrianglesDepthTest : &DebugDrawPsInstancedTrianglesDefault;
+        bool stateSet = false;
+        for (int32 i = DEBUG_DRAW_PRIMITIVES_LINES_COUNT; i < (int32)DebugPrimitive::MAX; i++)
+        {
+            if (oneFrame.Instances[i].VertexCount + persistent.Instances[i].VertexCount == 0)
+                continue;
+            if (!stateSet)
+            {
+                stateSet = true;
+                context->SetState(state->Get(depthWrite, depthTest));
+            }
+            DrawInstances(context, persistentInstancesVB, persistent.Instances[i], i);
+            DrawInstances(context, instancesVB, oneFrame.Instances[i], i);
+        }
+    }
+}
+
 FORCE_INLINE DebugTriangle* AppendTriangles(int32 count, float duration, bool depthTest)
 {
     Array<DebugTriangle>* list;
@@ -657,13 +958,81 @@ void DebugDrawService::Update()
         desc.Wireframe = true;
         failed |= DebugDrawPsWireTrianglesDepthTest.Create(desc);
 
+        // Instanced
+        desc.Wireframe = false;
+        desc.VS = shader->GetVS("VS_Instanced");
+        desc.PS = shader->GetPS("PS", 0);
+        desc.PrimitiveTopologyType = PrimitiveTopologyType::Line;
+        failed |= DebugDrawPsInstancedLinesDefault.Create(desc);
+        desc.PS = shader->GetPS("PS", 1);
+        desc.PrimitiveTopologyType = PrimitiveTopologyType::Triangle;
+        failed |= DebugDrawPsInstancedTrianglesDefault.Create(desc);
+        desc.PS = shader->GetPS("PS", 2);
+        desc.PrimitiveTopologyType = PrimitiveTopologyType::Line;
+        failed |= DebugDrawPsInstancedLinesDepthTest.Create(desc);
+        desc.PS = shader->GetPS("PS", 3);
+        desc.PrimitiveTopologyType = PrimitiveTopologyType::Triangle;
+        failed |= DebugDrawPsInstancedTrianglesDepthTest.Create(desc);
+
         if (failed)
         {
             LOG(Fatal, "Cannot setup DebugDraw service!");
         }
 
-        // Vertex buffer
+        // Vertex buffers
         DebugDrawVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_VB_CAPACITY * sizeof(Vertex)), (uint32)sizeof(Vertex), TEXT("DebugDraw.VB"));
+        DebugDrawInstancesVB = New<DynamicVertexBuffer>((uint32)(256 * sizeof(InstanceData)), (uint32)sizeof(InstanceData), TEXT("DebugDraw.InstancesVB"));
+
+        // Unit primitives geometry (static)
+        Array<Vertex> primitives;
+        const Color32 white = Color32::White;
+        auto& wireBox = DebugDrawPrimitives[(int32)DebugPrimitive::WireBox];
+        wireBox.StartVertex = primitives.Count();
+        Float3 corners[8];
+        BoundingBox(Vector3(-1.0f), Vector3(1.0f)).GetCorners(corners);
+        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache); i++)
+            primitives.Add({ corners[BoxLineIndicesCache[i]], white });
+        wireBox.VertexCount = primitives.Count() - wireBox.StartVertex;
+        for (int32 lod = 0; lod < 3; lod++)
+        {
+            auto& wireSphere = DebugDrawPrimitives[(int32)DebugPrimitive::WireSphereLOD0 + lod];
+            wireSphere.StartVertex = primitives.Count();
+            for (const Float3& v : SphereCache[lod].Vertices)
+                primitives.Add({ v, white });
+            wireSphere.VertexCount = primitives.Count() - wireSphere.StartVertex;
+        }
+        auto& wireArrow = DebugDrawPrimitives[(int32)DebugPrimitive::WireArrow];
+        wireArrow.StartVertex = primitives.Count();
+        {
+            const Float3 end = Float3::Forward * 100.0f;
+            const Float3 capEnd = Float3::Forward * 70.0f;
+            const Float3 arrowLines[] =
+            {
+                Float3::Zero, end,
+                end, capEnd + Float3::Up * 30.0f,
+                end, capEnd - Float3::Up * 30.0f,
+                end, capEnd + Float3::Right * 30.0f,
+                end, capEnd - Float3::Right * 30.0f,
+            };
+            for (const Float3& v : arrowLines)
+                primitives.Add({ v, white });
+        }
+        wireArrow.VertexCount = primitives.Count() - wireArrow.StartVertex;
+        auto& box = DebugDrawPrimitives[(int32)DebugPrimitive::Box];
+        box.StartVertex = primitives.Count();
+        for (int32 i = 0; i < 36; i++)
+            primitives.Add({ corners[BoxTrianglesIndicesCache[i]], white });
+        box.VertexCount = primitives.Count() - box.StartVertex;
+        auto& sphere = DebugDrawPrimitives[(int32)DebugPrimitive::Sphere];
+        sphere.StartVertex = primitives.Count();
+        for (const Float3& v : SphereTriangleCache)
+            primitives.Add({ v, white });
+        sphere.VertexCount = primitives.Count() - sphere.StartVertex;
+        DebugDrawPrimitivesVB = GPUDevice::Instance->CreateBuffer(TEXT("DebugDraw.PrimitivesVB"));
+        if (DebugDrawPrimitivesVB->Init(GPUBufferDescription::Vertex(sizeof(Vertex), primitives.Count(), primitives.Get())))
+        {
+            LOG(Fatal, "Cannot setup DebugDraw service!");
+        }
     }
 }
 
@@ -681,7 +1050,13 @@ void DebugDrawService::Dispose()
     DebugDrawPsWireTrianglesDepthTest.Release();
     DebugDrawPsTrianglesDefault.Release();
     DebugDrawPsTrianglesDepthTest.Release();
+    DebugDrawPsInstancedLinesDefault.Release();
+    DebugDrawPsInstancedLinesDepthTest.Release();
+    DebugDrawPsInstancedTrianglesDefault.Release();
+    DebugDrawPsInstancedTrianglesDepthTest.Release();
     SAFE_DELETE(DebugDrawVB);
+    SAFE_DELETE(DebugDrawInstancesVB);
+    SAFE_DELETE_GPU_RESOURCE(DebugDrawPrimitivesVB);
     DebugDrawShader = nullptr;
 }
 
@@ -742,20 +1117,30 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
         target = renderContext.Task->GetOutputView();
 
     // Fill vertex buffer and upload data
-    DebugDrawCall depthTestLines, defaultLines, depthTestTriangles, defaultTriangles, depthTestWireTriangles, defaultWireTriangles;
+    DebugDrawCalls depthTestCalls, defaultCalls;
     {
         PROFILE_CPU_NAMED("Update Buffer");
+        Context->DebugDrawDepthTest.UpdatePersistent(context);
+        Context->DebugDrawDefault.UpdatePersistent(context);
         DebugDrawVB->Clear();
-        int32 vertexCounter = 0;
-        depthTestLines = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultLines, Context->DebugDrawDepthTest.OneFrameLines);
-        defaultLines = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultLines, Context->DebugDrawDefault.OneFrameLines);
-        depthTestTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultTriangles, Context->DebugDrawDepthTest.OneFrameTriangles);
-        defaultTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultTriangles, Context->DebugDrawDefault.OneFrameTriangles);
-        depthTestWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultWireTriangles, Context->DebugDrawDepthTest.OneFrameWireTriangles);
-        defaultWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultWireTriangles, Context->DebugDrawDefault.OneFrameWireTriangles);
+        DebugDrawInstancesVB->Clear();
+        int32 vertexCounter = 0, instanceCounter = 0;
+        for (int32 group = 0; group < 2; group++)
+        {
+            const DebugDrawData& debugDrawData = group == 0 ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+            DebugDrawCalls& calls = group == 0 ? depthTestCalls : defaultCalls;
+            calls.Lines = WriteList(DebugDrawVB, vertexCounter, debugDrawData.OneFrameLines);
+            calls.Triangles = WriteList(DebugDrawVB, vertexCounter, debugDrawData.OneFrameTriangles);
+            calls.WireTriangles = WriteList(DebugDrawVB, vertexCounter, debugDrawData.OneFrameWireTriangles);
+            for (int32 i = 0; i < (int32)DebugPrimitive::MAX; i++)
+                calls.Instances[i] = WriteList(DebugDrawInstancesVB, instanceCounter, debugDrawData.OneFrameInstances[i]);
+        }
         {
             PROFILE_CPU_NAMED("Flush");
-            DebugDrawVB->Flush(context);
+            if (vertexCounter)
+                DebugDrawVB->Flush(context);
+            if (instanceCounter)
+                DebugDrawInstancesVB->Flush(context);
         }
     }
 
@@ -768,76 +1153,26 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     data.EnableDepthTest = enableDepthTest;
     context->UpdateCB(cb, &data);
     context->BindCB(0, cb);
-    auto vb = DebugDrawVB->GetBuffer();
 
     // Draw with depth test
-    if (depthTestLines.VertexCount + depthTestTriangles.VertexCount + depthTestWireTriangles.VertexCount > 0)
+    if (Context->DebugDrawDepthTest.LinesCount() + Context->DebugDrawDepthTest.TrianglesCount() + Context->DebugDrawDepthTest.InstancesCount() > 0)
     {
         if (data.EnableDepthTest)
             context->BindSR(0, renderContext.Buffers->DepthBuffer);
         const bool enableDepthWrite = data.EnableDepthTest;
 
         context->SetRenderTarget(depthBuffer ? depthBuffer : (data.EnableDepthTest ? nullptr : renderContext.Buffers->DepthBuffer->View()), target);
-
-        // Lines
-        if (depthTestLines.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsLinesDepthTest : &DebugDrawPsLinesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestLines.StartVertex, depthTestLines.VertexCount);
-        }
-
-        // Wire Triangles
-        if (depthTestWireTriangles.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsWireTrianglesDepthTest : &DebugDrawPsWireTrianglesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestWireTriangles.StartVertex, depthTestWireTriangles.VertexCount);
-        }
-
-        // Triangles
-        if (depthTestTriangles.VertexCount)
-        {
-            auto state = data.EnableDepthTest ? &DebugDrawPsTrianglesDepthTest : &DebugDrawPsTrianglesDefault;
-            context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestTriangles.StartVertex, depthTestTriangles.VertexCount);
-        }
+        DrawData(context, Context->DebugDrawDepthTest, depthTestCalls, true, enableDepthWrite, data.EnableDepthTest);
 
         if (data.EnableDepthTest)
             context->UnBindSR(0);
     }
 
     // Draw without depth
-    if (defaultLines.VertexCount + defaultTriangles.VertexCount + defaultWireTriangles.VertexCount > 0)
+    if (Context->DebugDrawDefault.LinesCount() + Context->DebugDrawDefault.TrianglesCount() + Context->DebugDrawDefault.InstancesCount() > 0)
     {
         context->SetRenderTarget(target);
-
-        // Lines
-        if (defaultLines.VertexCount)
-        {
-            context->SetState(DebugDrawPsLinesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultLines.StartVertex, defaultLines.VertexCount);
-        }
-
-        // Wire Triangles
-        if (defaultWireTriangles.VertexCount)
-        {
-            context->SetState(DebugDrawPsWireTrianglesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultWireTriangles.StartVertex, defaultWireTriangles.VertexCount);
-        }
-
-        // Triangles
-        if (defaultTriangles.VertexCount)
-        {
-            context->SetState(DebugDrawPsTrianglesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultTriangles.StartVertex, defaultTriangles.VertexCount);
-        }
+        DrawData(context, Context->DebugDrawDefault, defaultCalls, false, false, false);
     }
 
     // Text
@@ -1072,36 +1407,12 @@ void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3&
 
 void DebugDraw::DrawWireBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Start = corners[BoxLineIndicesCache[i++]];
-            l.End = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        // TODO: draw lines as strips to reuse vertices with a single draw call
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw unit box scaled to the bounds
+    const Float3 centerF = box.GetCenter() - Context->Origin;
+    const Float3 extentsF = box.GetSize() * 0.5f;
+    Matrix world;
+    Matrix::Transformation(extentsF, Quaternion::Identity, centerF, world);
+    AddInstance(DebugPrimitive::WireBox, world, color, duration, depthTest);
 }
 
 void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& color, float duration, bool depthTest)
@@ -1140,36 +1451,10 @@ void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& col
 
 void DebugDraw::DrawWireBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Start = corners[BoxLineIndicesCache[i++]];
-            l.End = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        // TODO: draw lines as strips to reuse vertices with a single draw call
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw unit box transformed by the oriented bounds
+    Matrix world;
+    GetWorld(box, world);
+    AddInstance(DebugPrimitive::WireBox, world, color, duration, depthTest);
 }
 
 void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
@@ -1185,55 +1470,21 @@ void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color,
         index = 1;
     else
         index = 2;
-    auto& cache = SphereCache[index];
 
-    // Draw lines of the unit sphere after linear transform
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (int32 i = 0; i < cache.Vertices.Count();)
-        {
-            l.Start = centerF + cache.Vertices.Get()[i++] * radiusF;
-            l.End = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (int32 i = 0; i < cache.Vertices.Count();)
-        {
-            l.Position = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw unit sphere LOD scaled to the bounds
+    Matrix world;
+    Matrix::Transformation(Float3(radiusF), Quaternion::Identity, centerF, world);
+    AddInstance((DebugPrimitive)((int32)DebugPrimitive::WireSphereLOD0 + index), world, color, duration, depthTest);
 }
 
 void DebugDraw::DrawSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
 {
-    DebugTriangle t;
-    t.Color = Color32(color);
-    t.TimeLeft = duration;
-
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    list->EnsureCapacity(list->Count() + SphereTriangleCache.Count());
-
+    // Draw unit sphere scaled to the bounds
     const Float3 centerF = sphere.Center - Context->Origin;
     const float radiusF = (float)sphere.Radius;
-    for (int32 i = 0; i < SphereTriangleCache.Count();)
-    {
-        t.V0 = centerF + SphereTriangleCache[i++] * radiusF;
-        t.V1 = centerF + SphereTriangleCache[i++] * radiusF;
-        t.V2 = centerF + SphereTriangleCache[i++] * radiusF;
-        list->Add(t);
-    }
+    Matrix world;
+    Matrix::Transformation(Float3(radiusF), Quaternion::Identity, centerF, world);
+    AddInstance(DebugPrimitive::Sphere, world, color, duration, depthTest);
 }
 
 void DebugDraw::DrawCircle(const Vector3& position, const Float3& normal, float radius, const Color& color, float duration, bool depthTest)
@@ -1914,75 +2165,29 @@ void DebugDraw::DrawWireArc(const Vector3& position, const Quaternion& orientati
 
 void DebugDraw::DrawWireArrow(const Vector3& position, const Quaternion& orientation, float scale, const Color& color, float duration, bool depthTest)
 {
-    Float3 direction, up, right;
-    Float3::Transform(Float3::Forward, orientation, direction);
-    Float3::Transform(Float3::Up, orientation, up);
-    Float3::Transform(Float3::Right, orientation, right);
-    const Vector3 end = position + direction * (100.0f * scale);
-    const Vector3 capEnd = position + direction * (70.0f * scale);
-    const float arrowSidesRatio = scale * 30.0f;
-
-    DrawLine(position, end, color, duration, depthTest);
-    DrawLine(end, capEnd + up * arrowSidesRatio, color, duration, depthTest);
-    DrawLine(end, capEnd - up * arrowSidesRatio, color, duration, depthTest);
-    DrawLine(end, capEnd + right * arrowSidesRatio, color, duration, depthTest);
-    DrawLine(end, capEnd - right * arrowSidesRatio, color, duration, depthTest);
+    // Draw unit arrow transformed by the orientation and scale
+    const Float3 positionF = position - Context->Origin;
+    Matrix world;
+    Matrix::Transformation(Float3(scale), orientation, positionF, world);
+    AddInstance(DebugPrimitive::WireArrow, world, color, duration, depthTest);
 }
 
 void DebugDraw::DrawBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw triangles
-    DebugTriangle t;
-    t.Color = Color32(color);
-    t.TimeLeft = duration;
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    list->EnsureCapacity(list->Count() + 36);
-    for (int i0 = 0; i0 < 36;)
-    {
-        t.V0 = corners[BoxTrianglesIndicesCache[i0++]];
-        t.V1 = corners[BoxTrianglesIndicesCache[i0++]];
-        t.V2 = corners[BoxTrianglesIndicesCache[i0++]];
-
-        list->Add(t);
-    }
+    // Draw unit box scaled to the bounds
+    const Float3 centerF = box.GetCenter() - Context->Origin;
+    const Float3 extentsF = box.GetSize() * 0.5f;
+    Matrix world;
+    Matrix::Transformation(extentsF, Quaternion::Identity, centerF, world);
+    AddInstance(DebugPrimitive::Box, world, color, duration, depthTest);
 }
 
 void DebugDraw::DrawBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw triangles
-    DebugTriangle t;
-    t.Color = Color32(color);
-    t.TimeLeft = duration;
-    Array<DebugTriangle>* list;
-    if (depthTest)
-        list = duration > 0 ? &Context->DebugDrawDepthTest.DefaultTriangles : &Context->DebugDrawDepthTest.OneFrameTriangles;
-    else
-        list = duration > 0 ? &Context->DebugDrawDefault.DefaultTriangles : &Context->DebugDrawDefault.OneFrameTriangles;
-    list->EnsureCapacity(list->Count() + 36);
-    for (int i0 = 0; i0 < 36;)
-    {
-        t.V0 = corners[BoxTrianglesIndicesCache[i0++]];
-        t.V1 = corners[BoxTrianglesIndicesCache[i0++]];
-        t.V2 = corners[BoxTrianglesIndicesCache[i0++]];
-
-        list->Add(t);
-    }
+    // Draw unit box transformed by the oriented bounds
+    Matrix world;
+    GetWorld(box, world);
+    AddInstance(DebugPrimitive::Box, world, color, duration, depthTest);
 }
 
 void DebugDraw::DrawText(const StringView& text, const Float2& position, const Color& color, int32 size, float duration)
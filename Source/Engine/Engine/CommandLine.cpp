@@ -126,12 +126,15 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-novsync ", NoVSync);
     PARSE_BOOL_SWITCH("-nolog ", NoLog);
     PARSE_BOOL_SWITCH("-std ", Std);
+    PARSE_BOOL_SWITCH("-logasync ", LogAsync);
+    PARSE_BOOL_SWITCH("-logutf8 ", LogUTF8);
 #if !BUILD_RELEASE
     PARSE_ARG_SWITCH("-debug ", DebuggerAddress);
     PARSE_BOOL_SWITCH("-debugwait ", WaitForDebugger);
 #endif
 #if PLATFORM_HAS_HEADLESS_MODE
     PARSE_BOOL_SWITCH("-headless ", Headless);
+    PARSE_BOOL_SWITCH("-server ", Server);
 #endif
     PARSE_BOOL_SWITCH("-d3d12 ", D3D12);
     PARSE_BOOL_SWITCH("-d3d11 ", D3D11);
@@ -144,6 +147,14 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-monolog ", MonoLog);
     PARSE_BOOL_SWITCH("-mute ", Mute);
     PARSE_BOOL_SWITCH("-lowdpi ", LowDPI);
+    PARSE_BOOL_SWITCH("-largepages ", LargePages);
+    PARSE_BOOL_SWITCH("-trackmemory ", TrackMemory);
+    PARSE_ARG_SWITCH("-profilecapture ", ProfileCapture);
+    PARSE_ARG_SWITCH("-profilecaptureframes ", ProfileCaptureFrames);
+    PARSE_ARG_SWITCH("-perfscene ", PerfScene);
+    PARSE_ARG_SWITCH("-perfframes ", PerfFrames);
+    PARSE_ARG_SWITCH("-perfcamera ", PerfCamera);
+    PARSE_ARG_SWITCH("-perfreport ", PerfReport);
 
 #if USE_EDITOR
 
@@ -155,6 +166,7 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_ARG_SWITCH("-build ", Build);
     PARSE_BOOL_SWITCH("-skipcompile ", SkipCompile);
     PARSE_BOOL_SWITCH("-shaderdebug ", ShaderDebug);
+    PARSE_ARG_SWITCH("-shadercache ", ShaderCache);
     PARSE_ARG_OPT_SWITCH("-play ", Play);
 
 #endif
@@ -49,6 +49,16 @@ class CommandLine
         /// </summary>
         Nullable<bool> Std;
 
+        /// <summary>
+        /// -logasync (write log messages on a background thread, logging threads never wait for the output)
+        /// </summary>
+        Nullable<bool> LogAsync;
+
+        /// <summary>
+        /// -logutf8 (write log file with UTF-8 encoding instead of UTF-16)
+        /// </summary>
+        Nullable<bool> LogUTF8;
+
 #if !BUILD_RELEASE
 
         /// <summary>
@@ -70,6 +80,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> Headless;
 
+        /// <summary>
+        /// -server (Run as a dedicated server: headless mode without rendering and audio, with precise game ticking)
+        /// </summary>
+        Nullable<bool> Server;
+
 #endif
 
         /// <summary>
@@ -127,6 +142,46 @@ class CommandLine
         /// </summary>
         Nullable<bool> LowDPI;
 
+        /// <summary>
+        /// -largepages (enables large memory pages for the bulk allocations, requires 'Lock pages in memory' privilege on Windows or reserved huge pages on Linux)
+        /// </summary>
+        Nullable<bool> LargePages;
+
+        /// <summary>
+        /// -trackmemory (enables memory allocations tracking per engine subsystem in profiler)
+        /// </summary>
+        Nullable<bool> TrackMemory;
+
+        /// <summary>
+        /// -profilecapture !path! (records the profiler events of the first frames into the Chrome trace file, eg. for dedicated servers or automated performance runs)
+        /// </summary>
+        Nullable<String> ProfileCapture;
+
+        /// <summary>
+        /// -profilecaptureframes !count! (the amount of frames recorded by -profilecapture, 300 by default)
+        /// </summary>
+        Nullable<String> ProfileCaptureFrames;
+
+        /// <summary>
+        /// -perfscene !id or path! (loads the scene and runs the headless performance capture that writes the report and exits the application)
+        /// </summary>
+        Nullable<String> PerfScene;
+
+        /// <summary>
+        /// -perfframes !count! (the amount of frames measured by -perfscene, 600 by default or the camera path duration)
+        /// </summary>
+        Nullable<String> PerfFrames;
+
+        /// <summary>
+        /// -perfcamera !path! (the camera path json file played by -perfscene)
+        /// </summary>
+        Nullable<String> PerfCamera;
+
+        /// <summary>
+        /// -perfreport !path! (the output report json file of -perfscene, PerformanceReport.json in the project folder by default)
+        /// </summary>
+        Nullable<String> PerfReport;
+
 #if USE_EDITOR
 
         /// <summary>
@@ -169,6 +224,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> ShaderDebug;
 
+        /// <summary>
+        /// -shadercache !path! (shared shaders compilation cache location: directory path or HTTP cache server URL, eg. http://host:port/shaders)
+        /// </summary>
+        Nullable<String> ShaderCache;
+
         /// <summary>
         /// -play !guid! ( Scene to play, can be empty to use default )
         /// </summary>
@@ -10,6 +10,7 @@
 #include "FlaxEngine.Gen.h"
 #include "Engine/Core/Core.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Memory/FrameAllocation.h"
 #include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Platform/Platform.h"
@@ -20,6 +21,8 @@
 #include "Engine/Threading/MainThreadTask.h"
 #include "Engine/Threading/ThreadRegistry.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUSwapChain.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Content/Content.h"
@@ -29,6 +32,7 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Profiler/Profiler.h"
 #include "Engine/Threading/TaskGraph.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #include "Editor/ProjectInfo.h"
@@ -93,6 +97,15 @@ int32 Engine::Main(const Char* cmdLine)
     CommandLine::Options.Mute = true;
     CommandLine::Options.Std = true;
 #endif
+#if PLATFORM_HAS_HEADLESS_MODE
+    if (CommandLine::Options.Server.IsTrue())
+    {
+        // Configure engine for dedicated server (no window, rendering nor audio)
+        CommandLine::Options.Headless = true;
+        CommandLine::Options.Null = true;
+        CommandLine::Options.Mute = true;
+    }
+#endif
 
     if (Platform::Init())
     {
@@ -103,7 +116,9 @@ int32 Engine::Main(const Char* cmdLine)
     Platform::SetHighDpiAwarenessEnabled(!CommandLine::Options.LowDPI.IsTrue());
     Time::StartupTime = DateTime::Now();
 #if COMPILE_WITH_PROFILER
+    ProfilerCPU::Init();
     ProfilerCPU::Enabled = true;
+    ProfilerMemory::Enabled = CommandLine::Options.TrackMemory.IsTrue();
 #endif
     Globals::StartupFolder = Globals::BinariesFolder = Platform::GetMainDirectory();
 #if USE_EDITOR
@@ -156,6 +171,11 @@ int32 Engine::Main(const Char* cmdLine)
     Time::OnBeforeRun();
     EngineImpl::IsReady = true;
 
+    // Dedicated server uses the null rendering backend so drawing is only needed to flush the GPU tasks (eg. resources loading)
+    const bool isServer = IsServer();
+    if (isServer)
+        Time::DrawFPS = 10.0f;
+
     // Main engine loop
     const bool useSleep = true; // TODO: this should probably be a platform setting
     while (!ShouldExit())
@@ -172,6 +192,20 @@ int32 Engine::Main(const Char* cmdLine)
                 PROFILE_CPU_NAMED("Idle");
                 Platform::Sleep(1);
             }
+
+            // Dedicated server ticks with a low jitter: sleep until close to the next tick and spin-wait the remaining time
+            if (isServer && Time::UpdateFPS > ZeroTolerance)
+            {
+                PROFILE_CPU_NAMED("Idle");
+                timeToTick = nextTick - Platform::GetTimeSeconds();
+                while (timeToTick > 0.002 && !ShouldExit())
+                {
+                    Platform::Sleep(1);
+                    timeToTick = nextTick - Platform::GetTimeSeconds();
+                }
+                while (timeToTick > 0.0)
+                    timeToTick = nextTick - Platform::GetTimeSeconds();
+            }
         }
 
         // App paused logic
@@ -188,6 +222,13 @@ int32 Engine::Main(const Char* cmdLine)
             OnUnpause();
         }
 
+        // Wait for the swap chain to be ready for the next frame before sampling the input in low-latency mode (input is read as close to the rendering as possible)
+        if (Graphics::LowLatencyMode && MainWindow && MainWindow->GetSwapChain())
+        {
+            PROFILE_CPU_NAMED("Wait For Frame Latency");
+            MainWindow->GetSwapChain()->WaitForFrameLatency();
+        }
+
         // Update game logic
         if (Time::OnBeginUpdate())
         {
@@ -213,7 +254,11 @@ int32 Engine::Main(const Char* cmdLine)
         }
 
         // Collect physics simulation results (does nothing if Simulate hasn't been called in the previous loop step)
-        Physics::CollectResults();
+        if (!Physics::GetPipelinedSimulation())
+            Physics::CollectResults();
+
+        // Release all frame allocations
+        FrameAllocation::EndFrame();
     }
 
     // Call on exit event
@@ -258,6 +303,9 @@ void Engine::OnFixedUpdate()
 {
     PROFILE_CPU_NAMED("Fixed Update");
 
+    // Collect pipelined physics simulation results from the previous step (does nothing if simulation was already collected)
+    Physics::CollectResults();
+
     Physics::FlushRequests();
 
     // Call event
@@ -392,6 +440,15 @@ bool Engine::IsHeadless()
 #endif
 }
 
+bool Engine::IsServer()
+{
+#if PLATFORM_HAS_HEADLESS_MODE
+    return CommandLine::Options.Server.IsTrue();
+#else
+    return false;
+#endif
+}
+
 bool Engine::IsReady()
 {
     return EngineImpl::IsReady;
@@ -497,6 +554,7 @@ void Engine::OnExit()
 
     // Cleanup
     ObjectsRemovalService::ForceFlush();
+    MemoryWriteStream::ClearPool();
 #if COMPILE_WITH_PROFILER
     ProfilerCPU::Dispose();
     ProfilerGPU::Dispose();
@@ -132,6 +132,11 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Engine);
     // Returns true if engine is running without main window (aka headless mode).
     API_PROPERTY() static bool IsHeadless();
 
+    /// <summary>
+    /// Returns true if engine is running as a dedicated server (headless mode without rendering and audio). Use -server command line switch to enable it.
+    /// </summary>
+    API_PROPERTY() static bool IsServer();
+
     // True if Engine is ready to work (init and not disposing)
     static bool IsReady();
 
@@ -4,6 +4,9 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/Pair.h"
+#include "Engine/Threading/Task.h"
+#include "Engine/Threading/ThreadPool.h"
 #include <ThirdParty/tracy/tracy/Tracy.hpp>
 
 static bool CompareEngineServices(EngineService* const& a, EngineService* const& b)
@@ -65,37 +68,75 @@ bool EngineService::Init()
     return false;
 }
 
+bool InitService(EngineService* service)
+{
+    const StringView name(service->Name);
+#if TRACY_ENABLE
+    ZoneScoped;
+    Char nameBuffer[100];
+    int32 nameBufferLength = 0;
+    for (int32 j = 0; j < name.Length(); j++)
+        if (name[j] != ' ')
+            nameBuffer[nameBufferLength++] = name[j];
+    Platform::MemoryCopy(nameBuffer + nameBufferLength, TEXT("::Init"), 7 * sizeof(Char));
+    nameBufferLength += 7;
+    ZoneName(nameBuffer, nameBufferLength);
+#endif
+    LOG(Info, "Initialize {0}{1}...", name, service->InitAsync ? TEXT(" (async)") : TEXT(""));
+    return service->Init();
+}
+
 void EngineService::OnInit()
 {
     ZoneScoped;
     Sort();
 
-    // Init services from front to back
+    // Init services from front to back (async services are initialized in the background until other service depends on them)
     auto& services = GetServices();
-#if TRACY_ENABLE
-    Char nameBuffer[100];
-#endif
+    Array<Pair<EngineService*, Task*>, InlinedAllocation<8>> asyncInits;
+    const auto waitForInit = [](const Pair<EngineService*, Task*>& e)
+    {
+        if (e.Second->Wait())
+        {
+            Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), e.First->Name));
+        }
+    };
     for (int32 i = 0; i < services.Count(); i++)
     {
         const auto service = services[i];
-        const StringView name(service->Name);
-#if TRACY_ENABLE
-        ZoneScoped;
-        int32 nameBufferLength = 0;
-        for (int32 j = 0; j < name.Length(); j++)
-            if (name[j] != ' ')
-                nameBuffer[nameBufferLength++] = name[j];
-        Platform::MemoryCopy(nameBuffer + nameBufferLength, TEXT("::Init"), 7 * sizeof(Char));
-        nameBufferLength += 7;
-        ZoneName(nameBuffer, nameBufferLength);
-#endif
-        LOG(Info, "Initialize {0}...", name);
+
+        // Wait for the dependencies that are still being initialized
+        for (const Char* dependency : service->InitDependencies)
+        {
+            if (!dependency)
+                continue;
+            for (int32 j = 0; j < asyncInits.Count(); j++)
+            {
+                if (StringUtils::Compare(asyncInits[j].First->Name, dependency) == 0)
+                {
+                    waitForInit(asyncInits[j]);
+                    asyncInits.RemoveAtKeepOrder(j);
+                    break;
+                }
+            }
+        }
+
         service->IsInitialized = true;
-        if (service->Init())
+        if (service->InitAsync && ThreadPool::GetThreadsCount() > 0)
+        {
+            Function<bool()> action = [service]
+            {
+                return InitService(service);
+            };
+            asyncInits.Add(ToPair(service, Task::StartNew(action)));
+        }
+        else if (InitService(service))
         {
-            Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), name));
+            Platform::Fatal(String::Format(TEXT("Failed to initialize {0}."), service->Name));
         }
     }
+    for (const auto& e : asyncInits)
+        waitForInit(e);
 
     LOG(Info, "Engine services are ready!");
 }
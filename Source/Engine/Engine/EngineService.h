@@ -39,6 +39,16 @@ class EngineService
     const Char* Name;
     int32 Order;
 
+    /// <summary>
+    /// If true, the service initialization can be performed on a worker thread, concurrently with the initialization of the services that don't depend on it. All services are initialized before the engine services become ready.
+    /// </summary>
+    bool InitAsync = false;
+
+    /// <summary>
+    /// The names of the services that need to be initialized before this service (eg. to wait for the service initialized asynchronously). Unused entries are null.
+    /// </summary>
+    const Char* InitDependencies[4] = {};
+
 #define DECLARE_ENGINE_SERVICE_EVENT(result, name) virtual result name(); static void On##name();
     DECLARE_ENGINE_SERVICE_EVENT(bool, Init);
     DECLARE_ENGINE_SERVICE_EVENT(void, FixedUpdate);
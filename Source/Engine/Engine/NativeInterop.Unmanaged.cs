@@ -757,6 +757,14 @@ internal static IntPtr GetThunk(ManagedHandle methodHandle)
 #endif
         }
 
+        [UnmanagedCallersOnly]
+        internal static IntPtr GetMethodFunctionPointer(ManagedHandle methodHandle)
+        {
+            // Method needs to be static and marked with UnmanagedCallersOnly to be called directly from native code
+            MethodHolder methodHolder = Unsafe.As<MethodHolder>(methodHandle.Target);
+            return methodHolder.method.MethodHandle.GetFunctionPointer();
+        }
+
         [UnmanagedCallersOnly]
         internal static void FieldSetValue(ManagedHandle fieldOwnerHandle, ManagedHandle fieldHandle, IntPtr valuePtr)
         {
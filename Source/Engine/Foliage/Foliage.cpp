@@ -13,6 +13,8 @@
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/InstanceCullingPass.h"
+#include "Engine/Renderer/ImpostorsPass.h"
 #endif
 #endif
 #include "Engine/Level/SceneQuery.h"
@@ -134,7 +136,7 @@ void Foliage::DrawInstance(RenderContext& renderContext, FoliageInstance& instan
     }
 }
 
-void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const
+void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result, ImpostorsDraw* impostors) const
 {
     // Skip clusters that around too far from view
     const Vector3 viewOrigin = renderContext.View.Origin;
@@ -155,7 +157,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         box.Minimum -= viewOrigin; \
         box.Maximum -= viewOrigin; \
 		if (renderContext.View.CullingFrustum.Intersects(box)) \
-			DrawCluster(renderContext, cluster->Children[idx], type, drawCallsLists, result)
+			DrawCluster(renderContext, cluster->Children[idx], type, drawCallsLists, result, impostors)
         DRAW_CLUSTER(0);
         DRAW_CLUSTER(1);
         DRAW_CLUSTER(2);
@@ -177,6 +179,41 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
             {
                 const auto modelFrame = instance.DrawState.PrevFrame + 1;
 
+                // Draw the impostor of the distant instance (with the dithered transition from the model)
+                if (impostors)
+                {
+                    const float impostorBlend = Math::Saturate((Float3::Distance(renderContext.View.Position, sphere.Center) - type.ImpostorDistance) / Math::Max(type.ImpostorTransitionRange, ZeroTolerance));
+                    if (impostorBlend > 0.0f)
+                    {
+                        auto& instanceData = impostors->Instances.AddOne();
+                        Matrix world;
+                        const Transform transform = _transform.LocalToWorld(instance.Transform);
+                        const Float3 translation = transform.Translation - viewOrigin;
+                        Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
+                        instanceData.InstanceOrigin = Float3(world.M41, world.M42, world.M43);
+                        instanceData.PerInstanceRandom = instance.Random;
+                        instanceData.InstanceTransform1 = Float3(world.M11, world.M12, world.M13);
+                        instanceData.LODDitherFactor = impostorBlend < 1.0f ? impostorBlend - 1.0f : 0.0f;
+                        instanceData.InstanceTransform2 = Float3(world.M21, world.M22, world.M23);
+                        instanceData.InstanceTransform3 = Float3(world.M31, world.M32, world.M33);
+                        instanceData.InstanceLightmapArea = Half4(instance.Lightmap.UVsArea);
+                        if (impostorBlend >= 1.0f)
+                            continue;
+
+                        // Draw the model with the complementary dithering (LOD transitions are skipped during the impostor transition)
+                        int32 lodIndex = RenderTools::ComputeModelLOD(model, sphere.Center, (float)sphere.Radius, renderContext);
+                        if (lodIndex != -1)
+                        {
+                            lodIndex = model->ClampLODIndex(lodIndex + renderContext.View.ModelLODBias);
+                            DrawInstance(renderContext, instance, type, model, lodIndex, impostorBlend, drawCallsLists, result);
+                        }
+                        instance.DrawState.PrevLOD = lodIndex;
+                        instance.DrawState.LODTransition = 255;
+                        instance.DrawState.PrevFrame = frame;
+                        continue;
+                    }
+                }
+
                 // Select a proper LOD index (model may be culled)
                 int32 lodIndex = RenderTools::ComputeModelLOD(model, sphere.Center, (float)sphere.Radius, renderContext);
                 if (lodIndex == -1)
@@ -261,6 +298,209 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
     }
 }
 
+// The GPU-resident instances are culled in ranges of leaf clusters (single thread group of the culling shader per cluster)
+static_assert(FOLIAGE_CLUSTER_CAPACITY == 64, "Invalid foliage cluster capacity. Update the GPU instances culling ranges.");
+
+void Foliage::UpdateResidentInstances(const FoliageType& type) const
+{
+    if (!type._resident)
+        type._resident = New<ResidentInstances>();
+    ResidentInstances& resident = *type._resident;
+    if (resident.Version == _instancesVersion)
+        return;
+    PROFILE_CPU();
+    resident.Version = _instancesVersion;
+    resident.Dirty = true;
+    resident.Origin = type.Root->TotalBoundsSphere.Center;
+    resident.Data.Clear();
+    type._residentLightmap = INVALID_INDEX;
+
+    // Write instances of the leaf clusters as continuous ranges
+    Array<FoliageCluster*, InlinedAllocation<64>> stack;
+    stack.Add(type.Root);
+    bool isFirst = true;
+    while (stack.HasItems())
+    {
+        FoliageCluster* cluster = stack.Pop();
+        if (cluster->Children[0])
+        {
+            stack.Add(cluster->Children[0]);
+            stack.Add(cluster->Children[1]);
+            stack.Add(cluster->Children[2]);
+            stack.Add(cluster->Children[3]);
+            continue;
+        }
+        cluster->ResidentOffset = resident.Data.Count();
+        for (int32 i = 0; i < cluster->Instances.Count(); i++)
+        {
+            const FoliageInstance& instance = *cluster->Instances.Get()[i];
+            auto& instanceData = resident.Data.AddOne();
+            Matrix world;
+            const Transform transform = _transform.LocalToWorld(instance.Transform);
+            const Float3 translation = transform.Translation - resident.Origin;
+            Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
+            instanceData.InstanceOrigin = Float3(world.M41, world.M42, world.M43);
+            instanceData.PerInstanceRandom = instance.Random;
+            instanceData.InstanceTransform1 = Float3(world.M11, world.M12, world.M13);
+            instanceData.LODDitherFactor = 0.0f;
+            instanceData.InstanceTransform2 = Float3(world.M21, world.M22, world.M23);
+            instanceData.InstanceTransform3 = Float3(world.M31, world.M32, world.M33);
+            instanceData.InstanceLightmapArea = Half4(instance.Lightmap.UVsArea);
+
+            // Track if all instances use the same lightmap (batch can use only a single lightmap)
+            if (isFirst)
+                type._residentLightmap = instance.Lightmap.TextureIndex;
+            else if (type._residentLightmap != instance.Lightmap.TextureIndex)
+                type._residentLightmap = -2;
+            isFirst = false;
+        }
+    }
+}
+
+bool Foliage::CanDrawResident(const RenderContext& renderContext, const FoliageType& type, DrawPass typeDrawModes, const DrawCallsList* drawCallsLists) const
+{
+    if (!InstanceCullingPass::Instance()->CanCullResident(renderContext))
+        return false;
+
+    // Transparency requires sorting by depth and motion vectors pass doesn't use instancing so draw those on a CPU
+    DrawPass supportedDrawModes = DrawPass::Depth | DrawPass::GBuffer;
+    if ((_staticFlags & StaticFlags::Transform) != StaticFlags::None)
+        supportedDrawModes |= DrawPass::MotionVectors; // Static foliage doesn't draw motion vectors
+    for (int32 lod = 0; lod < type.Model->LODs.Count(); lod++)
+    {
+        const auto& meshes = type.Model->LODs.Get()[lod].Meshes;
+        for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+        {
+            const auto material = drawCallsLists[lod][meshIndex].DrawCall.Material;
+            if (!material)
+                continue;
+            const auto& mesh = meshes.Get()[meshIndex];
+            const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
+            const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
+            const auto drawModes = typeDrawModes & renderContext.View.GetShadowsDrawPassMask(entry.ShadowsMode & slot.ShadowsMode) & material->GetDrawModes();
+            if ((drawModes & ~supportedDrawModes) != DrawPass::None)
+                return false;
+        }
+    }
+
+    // Sync instances data and check if can batch them with a single lightmap
+    UpdateResidentInstances(type);
+    return type._residentLightmap != -2 || (_staticFlags & StaticFlags::Lightmap) == StaticFlags::None;
+}
+
+void Foliage::DrawResident(RenderContext& renderContext, const FoliageType& type, DrawPass typeDrawModes, DrawCallsList* drawCallsLists) const
+{
+    const auto model = type.Model.Get();
+    ResidentInstances& resident = *type._resident;
+
+    // Cull clusters on a CPU (instances are culled with LOD selection on a GPU)
+    ResidentInstancesDraw draw;
+    DrawClusterResident(renderContext, type.Root, type, draw);
+    if (draw.Ranges.IsEmpty())
+        return;
+    const Float3 originOffset = resident.Origin - renderContext.View.Origin;
+    draw.Instances = &resident;
+    draw.OriginOffset = originOffset;
+    BoundingSphere::FromBox(model->GetBox(), draw.Bounds);
+    draw.CullDistance = type.CullDistance;
+    draw.CullDistanceRandomRange = type.CullDistanceRandomRange;
+    draw.MinScreenSize = model->MinScreenSize;
+    draw.LODsCount = model->LODs.Count();
+    draw.MinLOD = model->HighestResidentLODIndex();
+    for (int32 lod = 0; lod < draw.LODsCount; lod++)
+        draw.LODScreenSizes[lod] = model->LODs.Get()[lod].ScreenSize;
+    const int32 lodsCount = draw.LODsCount, minLOD = draw.MinLOD;
+    const int32 drawIndex = renderContext.List->ResidentInstancesDraws.Add(MoveTemp(draw));
+
+    // Add draw call batch for each mesh of the streamed-in LODs (instances count is generated on a GPU)
+    const Lightmap* lightmap = EnumHasAnyFlags(_staticFlags, StaticFlags::Lightmap) ? _scene->LightmapsData.GetReadyLightmap(type._residentLightmap) : nullptr;
+    for (int32 lod = minLOD; lod < lodsCount; lod++)
+    {
+        const auto& meshes = model->LODs.Get()[lod].Meshes;
+        for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+        {
+            const auto material = drawCallsLists[lod][meshIndex].DrawCall.Material;
+            if (!material)
+                continue;
+            const auto& mesh = meshes.Get()[meshIndex];
+            const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
+            const MaterialSlot& slot = model->MaterialSlots[mesh.GetMaterialSlotIndex()];
+            const auto drawModes = typeDrawModes & renderContext.View.GetShadowsDrawPassMask(entry.ShadowsMode & slot.ShadowsMode) & material->GetDrawModes();
+
+            // Setup draw call
+            BatchedDrawCall batch;
+            batch.DrawCall.Material = material;
+            batch.DrawCall.Surface.Lightmap = lightmap;
+            mesh.GetDrawCallGeometry(batch.DrawCall);
+            batch.DrawCall.InstanceCount = 1;
+            batch.DrawCall.ObjectPosition = originOffset;
+            batch.DrawCall.PerInstanceRandom = 0.0f;
+            batch.DrawCall.Surface.LightmapUVsArea = Rectangle::Empty;
+            batch.DrawCall.Surface.LODDitherFactor = 0.0f;
+            batch.DrawCall.World = Matrix::Identity;
+            batch.DrawCall.World.SetRow4(Float4(originOffset, 1.0f));
+            batch.DrawCall.Surface.PrevWorld = batch.DrawCall.World;
+            batch.DrawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
+            batch.DrawCall.Surface.Skinning = nullptr;
+            batch.DrawCall.WorldDeterminantSign = 1;
+            batch.Bounds = mesh.GetSphere();
+            batch.ResidentDraw = drawIndex;
+            batch.ResidentLOD = lod;
+
+            // Add draw call batch
+            const int32 batchIndex = renderContext.List->BatchedDrawCalls.Add(MoveTemp(batch));
+
+            // Add draw call to proper draw lists
+            if (EnumHasAnyFlags(drawModes, DrawPass::Depth))
+            {
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].PreBatchedDrawCalls.Add(batchIndex);
+            }
+            if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer))
+            {
+                if (entry.ReceiveDecals)
+                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].PreBatchedDrawCalls.Add(batchIndex);
+                else
+                    renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].PreBatchedDrawCalls.Add(batchIndex);
+            }
+        }
+    }
+}
+
+void Foliage::DrawClusterResident(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, ResidentInstancesDraw& draw) const
+{
+    // Skip clusters that around too far from view
+    const Vector3 viewOrigin = renderContext.View.Origin;
+    if (Float3::Distance(renderContext.View.Position, cluster->TotalBoundsSphere.Center - viewOrigin) - (float)cluster->TotalBoundsSphere.Radius > cluster->MaxCullDistance)
+        return;
+
+    if (cluster->Children[0])
+    {
+        // Draw visible children
+        BoundingBox box;
+#define DRAW_CLUSTER(idx) \
+        box = cluster->Children[idx]->TotalBounds; \
+        box.Minimum -= viewOrigin; \
+        box.Maximum -= viewOrigin; \
+		if (renderContext.View.CullingFrustum.Intersects(box)) \
+			DrawClusterResident(renderContext, cluster->Children[idx], type, draw)
+        DRAW_CLUSTER(0);
+        DRAW_CLUSTER(1);
+        DRAW_CLUSTER(2);
+        DRAW_CLUSTER(3);
+#undef 	DRAW_CLUSTER
+    }
+    else if (cluster->Instances.HasItems())
+    {
+        // Check if the cluster is not too small on screen (also tracks the model usage for the streaming, LOD of each instance is selected on a GPU)
+        BoundingSphere sphere = cluster->TotalBoundsSphere;
+        sphere.Center -= viewOrigin;
+        if (RenderTools::ComputeModelLOD(type.Model.Get(), sphere.Center, (float)sphere.Radius, renderContext) == -1)
+            return;
+
+        draw.Ranges.Add(Int2(cluster->ResidentOffset, cluster->Instances.Count()));
+    }
+}
+
 #else
 
 void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw)
@@ -313,14 +553,15 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
                 Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
 
                 // Disable motion blur
-                instance.DrawState.PrevWorld = world;
+                GeometryDrawStateData drawState;
+                instance.DrawState.Load(drawState, world);
 
                 // Draw model
                 draw.Lightmap = _scene->LightmapsData.GetReadyLightmap(instance.Lightmap.TextureIndex);
                 draw.LightmapUVs = &instance.Lightmap.UVsArea;
                 draw.Buffer = &type.Entries;
                 draw.World = &world;
-                draw.DrawState = &instance.DrawState;
+                draw.DrawState = &drawState;
                 draw.Bounds = sphere;
                 draw.PerInstanceRandom = instance.Random;
                 draw.DrawModes = type._drawModes;
@@ -328,6 +569,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
 
                 //DebugDraw::DrawSphere(instance.Bounds, Color::YellowGreen);
 
+                instance.DrawState.Store(drawState);
                 instance.DrawState.PrevFrame = frame;
             }
         }
@@ -459,9 +701,23 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
         }
     }
 
+    // Distant instances are drawn as impostors into the GBuffer (only if the impostor is already baked)
+    const ModelImpostor* impostor = EnumHasAnyFlags(typeDrawModes, DrawPass::GBuffer) ? type.GetImpostor() : nullptr;
+
+    // Draw the GPU-resident instances of the foliage type if possible (impostors transition is done on a CPU)
+    if (!impostor && CanDrawResident(renderContext, type, typeDrawModes, drawCallsLists))
+    {
+        DrawResident(renderContext, type, typeDrawModes, drawCallsLists);
+        return;
+    }
+
     // Draw instances of the foliage type
     BatchedDrawCalls result;
-    DrawCluster(renderContext, type.Root, type, drawCallsLists, result);
+    ImpostorsDraw impostors;
+    impostors.Impostor = impostor;
+    DrawCluster(renderContext, type.Root, type, drawCallsLists, result, impostor ? &impostors : nullptr);
+    if (impostors.Instances.HasItems())
+        renderContext.List->ImpostorsDraws.Add(MoveTemp(impostors));
 
     // Submit draw calls with valid instances added
     for (auto& e : result)
@@ -491,6 +747,7 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
         batch.DrawCall.Surface.PrevWorld = batch.DrawCall.World;
         batch.DrawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
         batch.DrawCall.Surface.Skinning = nullptr;
+        batch.Bounds = mesh.GetSphere();
         batch.DrawCall.WorldDeterminantSign = 1;
 
         if (EnumHasAnyFlags(drawModes, DrawPass::Forward))
@@ -694,6 +951,7 @@ void Foliage::SetInstanceTransform(int32 index, const Transform& value)
 
     // Change transform
     instance.Transform = value;
+    _instancesVersion++;
 
     // Update bounds
     instance.Bounds = BoundingSphere::Empty;
@@ -816,12 +1074,14 @@ void Foliage::OnFoliageTypeModelLoaded(int32 index)
         PROFILE_CPU_NAMED("Update Cache");
         type.Root->UpdateTotalBoundsAndCullDistance();
     }
+    _instancesVersion++;
 #endif
 }
 
 void Foliage::RebuildClusters()
 {
     PROFILE_CPU();
+    _instancesVersion++;
 
     // Faster path if foliage is empty or no types is ready
     bool anyTypeReady = false;
@@ -1169,6 +1429,8 @@ void Foliage::Draw(RenderContext& renderContext)
         Matrix world;
         const Transform transform = _transform.LocalToWorld(instance.Transform);
         renderContext.View.GetWorldMatrix(transform, world);
+        GeometryDrawStateData drawState;
+        instance.DrawState.Load(drawState, world);
         Mesh::DrawInfo draw;
         draw.Flags = GetStaticFlags();
         draw.LODBias = 0;
@@ -1179,7 +1441,7 @@ void Foliage::Draw(RenderContext& renderContext)
         draw.LightmapUVs = &instance.Lightmap.UVsArea;
         draw.Buffer = &type.Entries;
         draw.World = &world;
-        draw.DrawState = &instance.DrawState;
+        draw.DrawState = &drawState;
         draw.Bounds = instance.Bounds;
         draw.PerInstanceRandom = instance.Random;
         draw.DrawModes = type.DrawModes & view.Pass & view.GetShadowsDrawPassMask(type.ShadowsMode);
@@ -1234,7 +1496,7 @@ void Foliage::Draw(RenderContextBatch& renderContextBatch)
         _renderContextBatch = &renderContextBatch;
         Function<void(int32)> func;
         func.Bind<Foliage, &Foliage::DrawFoliageJob>(this);
-        const uint64 waitLabel = JobSystem::Dispatch(func, FoliageTypes.Count());
+        const uint64 waitLabel = JobSystem::Dispatch(func, FoliageTypes.Count(), JobPriority::Critical);
         renderContextBatch.WaitLabels.Add(waitLabel);
         return;
     }
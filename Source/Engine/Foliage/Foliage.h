@@ -18,6 +18,7 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
 private:
     bool _disableFoliageTypeEvents;
     int32 _sceneRenderingKey = -1;
+    uint32 _instancesVersion = 1;
 
 public:
     /// <summary>
@@ -129,6 +130,14 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     /// </summary>
     API_FUNCTION() void RebuildClusters();
 
+    /// <summary>
+    /// Marks the instances data cached in the GPU memory as modified (eg. after editing the instances lightmaps). Done automatically by <see cref="RebuildClusters"/>.
+    /// </summary>
+    void InvalidateResidentInstances()
+    {
+        _instancesVersion++;
+    }
+
     /// <summary>
     /// Updates the cull distance for all foliage instances and for created clusters.
     /// </summary>
@@ -171,7 +180,11 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     typedef Array<struct BatchedDrawCall, InlinedAllocation<8>> DrawCallsList;
     typedef Dictionary<DrawKey, struct BatchedDrawCall, class RendererAllocation> BatchedDrawCalls;
     void DrawInstance(RenderContext& renderContext, FoliageInstance& instance, const FoliageType& type, Model* model, int32 lod, float lodDitherFactor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
-    void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
+    void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result, struct ImpostorsDraw* impostors) const;
+    void UpdateResidentInstances(const FoliageType& type) const;
+    bool CanDrawResident(const RenderContext& renderContext, const FoliageType& type, DrawPass typeDrawModes, const DrawCallsList* drawCallsLists) const;
+    void DrawResident(RenderContext& renderContext, const FoliageType& type, DrawPass typeDrawModes, DrawCallsList* drawCallsLists) const;
+    void DrawClusterResident(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, struct ResidentInstancesDraw& draw) const;
 #else
     void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw);
 #endif
@@ -9,6 +9,7 @@ void FoliageCluster::Init(const BoundingBox& bounds)
     Bounds = bounds;
     TotalBounds = bounds;
     MaxCullDistance = 0.0f;
+    ResidentOffset = 0;
 
     Children[0] = nullptr;
     Children[1] = nullptr;
@@ -43,6 +43,11 @@ class FLAXENGINE_API FoliageCluster
     /// </summary>
     Array<FoliageInstance*, FixedAllocation<FOLIAGE_CLUSTER_CAPACITY>> Instances;
 
+    /// <summary>
+    /// The offset of the cluster instances in the foliage type instances data stored in the GPU memory (valid for leaf nodes only).
+    /// </summary>
+    int32 ResidentOffset;
+
 public:
     /// <summary>
     /// Initializes this instance.
@@ -7,6 +7,49 @@
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Level/Scene/Lightmap.h"
 
+/// <summary>
+/// The compact drawing state of the foliage instance used to handle LOD transitions. Foliage instances are static so unlike GeometryDrawStateData it doesn't cache the previous frame world matrix (derived on the fly when needed).
+/// </summary>
+struct FoliageInstanceDrawState
+{
+    /// <summary>
+    /// The previous frame index. In sync with Engine::FrameCount used to detect new frames and rendering gaps to reset state.
+    /// </summary>
+    uint64 PrevFrame = 0;
+
+    /// <summary>
+    /// The previous frame model LOD index used. It's locked during LOD transition to cache the transition start LOD.
+    /// </summary>
+    char PrevLOD = -1;
+
+    /// <summary>
+    /// The LOD transition timer. Value 255 means the end of the transition (aka no transition), value 0 means transition started.
+    /// </summary>
+    byte LODTransition = 255;
+
+public:
+    /// <summary>
+    /// Loads the state into the generic geometry draw state (with the previous world matrix set to the current one to disable motion blur).
+    /// </summary>
+    void Load(GeometryDrawStateData& state, const Matrix& world) const
+    {
+        state.PrevWorld = world;
+        state.PrevFrame = PrevFrame;
+        state.PrevLOD = PrevLOD;
+        state.LODTransition = LODTransition;
+    }
+
+    /// <summary>
+    /// Stores the state from the generic geometry draw state.
+    /// </summary>
+    void Store(const GeometryDrawStateData& state)
+    {
+        PrevFrame = state.PrevFrame;
+        PrevLOD = state.PrevLOD;
+        LODTransition = state.LODTransition;
+    }
+};
+
 /// <summary>
 /// Foliage instanced mesh instance. Packed data with very little of logic. Managed by the foliage chunks and foliage actor itself.
 /// </summary>
@@ -22,7 +65,7 @@ API_STRUCT(NoPod) struct FLAXENGINE_API FoliageInstance
     /// <summary>
     /// The model drawing state.
     /// </summary>
-    GeometryDrawStateData DrawState;
+    FoliageInstanceDrawState DrawState;
 
     /// <summary>
     /// The foliage type index. Foliage types are hold in foliage actor and shared by instances using the same model.
@@ -5,6 +5,8 @@
 #include "Engine/Core/Random.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Foliage.h"
+#include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/ImpostorsPass.h"
 
 FoliageType::FoliageType()
     : ScriptingObject(SpawnParams(Guid::New(), TypeInitializer))
@@ -22,6 +24,14 @@ FoliageType::FoliageType()
     Model.Loaded.Bind<FoliageType, &FoliageType::OnModelLoaded>(this);
 }
 
+FoliageType::~FoliageType()
+{
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    SAFE_DELETE(_resident);
+    SAFE_DELETE(_impostor);
+#endif
+}
+
 FoliageType& FoliageType::operator=(const FoliageType& other)
 {
     Foliage = other.Foliage;
@@ -44,6 +54,10 @@ FoliageType& FoliageType::operator=(const FoliageType& other)
     PlacementRandomPitchAngle = other.PlacementRandomPitchAngle;
     PlacementRandomRollAngle = other.PlacementRandomRollAngle;
     DensityScalingScale = other.DensityScalingScale;
+    ImpostorDistance = other.ImpostorDistance;
+    ImpostorTransitionRange = other.ImpostorTransitionRange;
+    ImpostorResolution = other.ImpostorResolution;
+    ImpostorFrames = other.ImpostorFrames;
     ReceiveDecals = other.ReceiveDecals;
     UseDensityScaling = other.UseDensityScaling;
     PlacementAlignToNormal = other.PlacementAlignToNormal;
@@ -65,6 +79,7 @@ void FoliageType::SetMaterials(const Array<MaterialBase*>& value)
     CHECK(value.Count() == Entries.Count());
     for (int32 i = 0; i < value.Count(); i++)
         Entries[i].Material = value[i];
+    InvalidateImpostor();
 }
 
 Float3 FoliageType::GetRandomScale() const
@@ -105,11 +120,46 @@ Float3 FoliageType::GetRandomScale() const
     return result;
 }
 
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+
+const ModelImpostor* FoliageType::GetImpostor() const
+{
+    if (ImpostorDistance <= 0.0f)
+        return nullptr;
+    if (!_impostor)
+        _impostor = New<ModelImpostor>();
+    if (_impostor->FrameResolution != ImpostorResolution || _impostor->FramesCount != ImpostorFrames)
+        _impostor->Invalidate();
+    if (_impostor->GetState() == ModelImpostor::States::None)
+    {
+        // Setup impostor to match the foliage type and bake it (in the background)
+        _impostor->Model = Model;
+        _impostor->Materials.Resize(Entries.Count());
+        for (int32 i = 0; i < Entries.Count(); i++)
+            _impostor->Materials[i] = Entries[i].Material;
+        _impostor->FrameResolution = ImpostorResolution;
+        _impostor->FramesCount = ImpostorFrames;
+        _impostor->RequestBake();
+    }
+    return _impostor->IsReady() ? _impostor : nullptr;
+}
+
+#endif
+
+void FoliageType::InvalidateImpostor()
+{
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    if (_impostor)
+        _impostor->Invalidate();
+#endif
+}
+
 void FoliageType::OnModelChanged()
 {
     // Cleanup
     _isReady = 0;
     Entries.Release();
+    InvalidateImpostor();
 }
 
 void FoliageType::OnModelLoaded()
@@ -119,6 +169,7 @@ void FoliageType::OnModelLoaded()
 
     // Prepare buffer (model may be modified so we should synchronize buffer with the actual asset)
     Entries.SetupIfInvalid(Model);
+    InvalidateImpostor();
 
     // Inform foliage that instances may need to be updated (data caching, etc.)
     Foliage->OnFoliageTypeModelLoaded(Index);
@@ -151,6 +202,10 @@ void FoliageType::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_BIT(ReceiveDecals);
     SERIALIZE_BIT(UseDensityScaling);
     SERIALIZE(DensityScalingScale);
+    SERIALIZE(ImpostorDistance);
+    SERIALIZE(ImpostorTransitionRange);
+    SERIALIZE(ImpostorResolution);
+    SERIALIZE(ImpostorFrames);
 
     SERIALIZE(PaintDensity);
     SERIALIZE(PaintRadius);
@@ -181,6 +236,7 @@ void FoliageType::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
         {
             Serialization::Deserialize(materials[i], Entries[i].Material, modifier);
         }
+        InvalidateImpostor();
     }
 
     DESERIALIZE(CullDistance);
@@ -191,6 +247,10 @@ void FoliageType::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE_BIT(ReceiveDecals);
     DESERIALIZE_BIT(UseDensityScaling);
     DESERIALIZE(DensityScalingScale);
+    DESERIALIZE(ImpostorDistance);
+    DESERIALIZE(ImpostorTransitionRange);
+    DESERIALIZE(ImpostorResolution);
+    DESERIALIZE(ImpostorFrames);
 
     DESERIALIZE(PaintDensity);
     DESERIALIZE(PaintRadius);
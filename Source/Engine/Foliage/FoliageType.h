@@ -47,6 +47,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
     friend Foliage;
 private:
     int8 _isReady : 1;
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    mutable struct ResidentInstances* _resident = nullptr;
+    mutable int32 _residentLightmap = -1;
+    mutable class ModelImpostor* _impostor = nullptr;
+#endif
 
 public:
     /// <summary>
@@ -62,6 +67,8 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
 
     FoliageType& operator=(const FoliageType& other);
 
+    ~FoliageType();
+
 public:
     /// <summary>
     /// The parent foliage actor.
@@ -187,6 +194,26 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
     /// </summary>
     API_FIELD() float DensityScalingScale = 1.0f;
 
+    /// <summary>
+    /// The distance from the view at which the instances are drawn as impostors (quads with the model views baked into the atlas on a GPU). Impostors don't cast shadows. Use 0 to disable impostors.
+    /// </summary>
+    API_FIELD() float ImpostorDistance = 0.0f;
+
+    /// <summary>
+    /// The distance range of the dithered transition between the model and the impostor (starts at the impostor distance).
+    /// </summary>
+    API_FIELD() float ImpostorTransitionRange = 1000.0f;
+
+    /// <summary>
+    /// The resolution of a single impostor view (in pixels).
+    /// </summary>
+    API_FIELD() int32 ImpostorResolution = 128;
+
+    /// <summary>
+    /// The amount of impostor views per atlas side (views cover the upper hemisphere, total count is squared).
+    /// </summary>
+    API_FIELD() int32 ImpostorFrames = 8;
+
     /// <summary>
     /// Determines whenever this meshes can receive decals.
     /// </summary>
@@ -221,7 +248,15 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
     /// </summary>
     Float3 GetRandomScale() const;
 
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    /// <summary>
+    /// Gets the impostor of the model used to draw the distant instances (requested for the baking on the first use). Returns null if impostors are disabled or not ready.
+    /// </summary>
+    const ModelImpostor* GetImpostor() const;
+#endif
+
 private:
+    void InvalidateImpostor();
     void OnModelChanged();
     void OnModelLoaded();
 
@@ -5,6 +5,7 @@
 #include "GPUTask.h"
 #include "GPUTasksManager.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/Graphics.h"
 
 DefaultGPUTasksExecutor::DefaultGPUTasksExecutor()
     : _context(nullptr)
@@ -30,11 +31,32 @@ void DefaultGPUTasksExecutor::FrameEnd()
     ASSERT(_context != nullptr);
 
     // Default implementation performs async operations on end of the frame which is synchronized with a rendering thread
-    GPUTask* buffer[32];
-    const int32 count = GPUDevice::Instance->GetTasksManager()->RequestWork(buffer, 32);
-    for (int32 i = 0; i < count; i++)
+    auto tasksManager = GPUDevice::Instance->GetTasksManager();
+    if (Graphics::GPUTasksBudget > 0.0f)
     {
-        _context->Run(buffer[i]);
+        // Run tasks one by one within the time budget (remaining tasks are carried over to the next frames)
+        const double startTime = Platform::GetTimeSeconds();
+        const double budget = Graphics::GPUTasksBudget * 0.001;
+        for (int32 i = 0; i < 32 && Platform::GetTimeSeconds() - startTime < budget; i++)
+        {
+            GPUTask* task;
+            if (tasksManager->RequestWork(&task, 1) == 0)
+            {
+                if (tasksManager->GetTaskCount() == 0)
+                    break;
+                continue;
+            }
+            _context->Run(task);
+        }
+    }
+    else
+    {
+        GPUTask* buffer[32];
+        const int32 count = tasksManager->RequestWork(buffer, 32);
+        for (int32 i = 0; i < count; i++)
+        {
+            _context->Run(buffer[i]);
+        }
     }
 
     _context->OnFrameEnd();
@@ -59,7 +59,8 @@ class GPUUploadBufferTask : public GPUTask
         if (_buffer.IsMissing())
             return Result::MissingResources;
 
-        context->GPU->UpdateBuffer(_buffer, _data.Get(), _data.Length(), _offset);
+        if (context->GPU->UpdateBufferAsync(_buffer, _data.Get(), _data.Length(), _offset))
+            context->GPU->UpdateBuffer(_buffer, _data.Get(), _data.Length(), _offset);
 
         return Result::Ok;
     }
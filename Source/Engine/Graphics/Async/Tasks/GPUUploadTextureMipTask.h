@@ -71,7 +71,8 @@ class GPUUploadTextureMipTask : public GPUTask
         ASSERT(_data.Length() >= _slicePitch * arraySize);
         for (int32 arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
         {
-            context->GPU->UpdateTexture(texture, arrayIndex, _mipIndex, dataSource, _rowPitch, _slicePitch);
+            if (context->GPU->UpdateTextureAsync(texture, arrayIndex, _mipIndex, dataSource, _rowPitch, _slicePitch))
+                context->GPU->UpdateTexture(texture, arrayIndex, _mipIndex, dataSource, _rowPitch, _slicePitch);
             dataSource += _slicePitch;
         }
 
@@ -47,6 +47,24 @@
 // True if use BGRA back buffer format
 #define GPU_USE_BGRA_BACK_BUFFER 1
 
+// The fraction of the GPU memory budget after which device releases the cached resources (render targets pool and streamed content)
+#define GPU_MEMORY_BUDGET_THRESHOLD 0.9f
+
+// The interval (in frames) of the GPU memory budget checks
+#define GPU_MEMORY_BUDGET_CHECK_INTERVAL 30
+
+// The maximum amount of frames that CPU can prepare ahead of the GPU (see Graphics::MaxFramesInFlight)
+#define GPU_MAX_FRAMES_IN_FLIGHT 4
+
+// The maximum amount of GPU buffers used by the dynamic buffer to write the data directly into the memory not used by the frames in flight (see GPULimits::HasMappedDynamicBuffers)
+#define GPU_DYNAMIC_BUFFER_RING_SIZE (GPU_MAX_FRAMES_IN_FLIGHT + 2)
+
+// The amount of frames after which the completed GPU readback requests that were not polled are released (see GPUReadbackPool)
+#define GPU_READBACK_EXPIRE_FRAMES 60
+
+// The amount of frames after which the unused pooled GPU readback staging resources are released
+#define GPU_READBACK_RELEASE_FRAMES (3 * 60)
+
 // Default back buffer pixel format
 #define GPU_DEPTH_BUFFER_PIXEL_FORMAT PixelFormat::D32_Float
 
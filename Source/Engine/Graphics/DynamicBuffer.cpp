@@ -4,9 +4,11 @@
 #include "GPUContext.h"
 #include "PixelFormatExtensions.h"
 #include "GPUDevice.h"
+#include "Graphics.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Utilities.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Threading/Threading.h"
 
 DynamicBuffer::DynamicBuffer(uint32 initialCapacity, uint32 stride, const String& name)
@@ -19,7 +21,8 @@ DynamicBuffer::DynamicBuffer(uint32 initialCapacity, uint32 stride, const String
 
 DynamicBuffer::~DynamicBuffer()
 {
-    SAFE_DELETE_GPU_RESOURCE(_buffer);
+    for (int32 i = 0; i < GPU_DYNAMIC_BUFFER_RING_SIZE; i++)
+        SAFE_DELETE_GPU_RESOURCE(_ring[i]);
 }
 
 void DynamicBuffer::Flush()
@@ -28,22 +31,13 @@ void DynamicBuffer::Flush()
     const uint32 size = Data.Count();
     if (size > 0)
     {
-        // Check if has no buffer
-        if (_buffer == nullptr)
-            _buffer = GPUDevice::Instance->CreateBuffer(_name);
+        // Try to write data directly to the GPU memory
+        if (FlushMapped(size))
+            return;
 
-        // Check if need to resize buffer
-        if (_buffer->GetSize() < size)
-        {
-            const uint32 numElements = Math::AlignUp<uint32>(static_cast<uint32>((size / _stride) * 1.3f), 32);
-            GPUBufferDescription desc;
-            InitDesc(desc, numElements);
-            if (_buffer->Init(desc))
-            {
-                LOG(Fatal, "Cannot setup dynamic buffer '{0}'! Size: {1}", _name, Utilities::BytesToText(size));
-                return;
-            }
-        }
+        // Check if need to setup buffer
+        if (InitBuffer(_buffer, size))
+            return;
 
         // Upload data to the buffer
         if (IsInMainThread() && GPUDevice::Instance->IsRendering())
@@ -63,22 +57,13 @@ void DynamicBuffer::Flush(GPUContext* context)
     const uint32 size = Data.Count();
     if (size > 0)
     {
-        // Check if has no buffer
-        if (_buffer == nullptr)
-            _buffer = GPUDevice::Instance->CreateBuffer(_name);
+        // Try to write data directly to the GPU memory
+        if (FlushMapped(size))
+            return;
 
-        // Check if need to resize buffer
-        if (_buffer->GetSize() < size)
-        {
-            const uint32 numElements = Math::AlignUp<uint32>(static_cast<uint32>((size / _stride) * 1.3f), 32);
-            GPUBufferDescription desc;
-            InitDesc(desc, numElements);
-            if (_buffer->Init(desc))
-            {
-                LOG(Fatal, "Cannot setup dynamic buffer '{0}'! Size: {1}", _name, Utilities::BytesToText(size));
-                return;
-            }
-        }
+        // Check if need to setup buffer
+        if (InitBuffer(_buffer, size))
+            return;
 
         // Upload data to the buffer
         context->UpdateBuffer(_buffer, Data.Get(), size);
@@ -87,10 +72,83 @@ void DynamicBuffer::Flush(GPUContext* context)
 
 void DynamicBuffer::Dispose()
 {
-    SAFE_DELETE_GPU_RESOURCE(_buffer);
+    for (int32 i = 0; i < GPU_DYNAMIC_BUFFER_RING_SIZE; i++)
+        SAFE_DELETE_GPU_RESOURCE(_ring[i]);
+    _buffer = nullptr;
     Data.Resize(0);
 }
 
+bool DynamicBuffer::InitBuffer(GPUBuffer*& buffer, uint32 size)
+{
+    // Check if has no buffer
+    if (buffer == nullptr)
+    {
+        if (_ring[0] == nullptr)
+            _ring[0] = GPUDevice::Instance->CreateBuffer(_name);
+        buffer = _ring[0];
+    }
+
+    // Check if need to resize buffer
+    if (buffer->GetSize() < size)
+    {
+        const uint32 numElements = Math::AlignUp<uint32>(static_cast<uint32>((size / _stride) * 1.3f), 32);
+        GPUBufferDescription desc;
+        InitDesc(desc, numElements);
+        if (buffer->Init(desc))
+        {
+            LOG(Fatal, "Cannot setup dynamic buffer '{0}'! Size: {1}", _name, Utilities::BytesToText(size));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool DynamicBuffer::FlushMapped(uint32 size)
+{
+    if (!GPUDevice::Instance->Limits.HasMappedDynamicBuffers)
+        return false;
+
+    // Pick the buffer that is not used by the frames in flight (the buffer flushed within the current frame is still pending for the GPU too)
+    const uint64 frame = Engine::FrameCount;
+    int32 index = -1;
+    for (int32 i = 0; i < GPU_DYNAMIC_BUFFER_RING_SIZE && _ring[i]; i++)
+    {
+        if (_ringFrames[i] + Graphics::MaxFramesInFlight < frame)
+        {
+            index = i;
+            break;
+        }
+    }
+    if (index == -1)
+    {
+        // Allocate a new buffer in the ring
+        for (int32 i = 0; i < GPU_DYNAMIC_BUFFER_RING_SIZE; i++)
+        {
+            if (_ring[i] == nullptr)
+            {
+                _ring[i] = GPUDevice::Instance->CreateBuffer(_name);
+                index = i;
+                break;
+            }
+        }
+        if (index == -1)
+            return false; // Ring is full so fallback to the regular upload
+    }
+    GPUBuffer* buffer = _ring[index];
+    if (InitBuffer(buffer, size))
+        return true;
+
+    // Write data into the GPU-visible memory
+    void* mapped = buffer->Map(GPUResourceMapMode::Write);
+    if (!mapped)
+        return false;
+    Platform::MemoryCopy(mapped, Data.Get(), size);
+    buffer->Unmap();
+    _ringFrames[index] = frame;
+    _buffer = buffer;
+    return true;
+}
+
 void DynamicStructuredBuffer::InitDesc(GPUBufferDescription& desc, int32 numElements)
 {
     desc = GPUBufferDescription::Structured(numElements, _stride, _isUnorderedAccess);
@@ -4,6 +4,7 @@
 
 #include "Engine/Core/Collections/Array.h"
 #include "GPUBuffer.h"
+#include "Config.h"
 
 /// <summary>
 /// Dynamic GPU buffer that allows to update and use GPU data (index/vertex/other) during single frame (supports dynamic resizing)
@@ -14,6 +15,8 @@ class FLAXENGINE_API DynamicBuffer
     GPUBuffer* _buffer;
     String _name;
     uint32 _stride;
+    GPUBuffer* _ring[GPU_DYNAMIC_BUFFER_RING_SIZE] = {};
+    uint64 _ringFrames[GPU_DYNAMIC_BUFFER_RING_SIZE] = {};
 
 public:
     NON_COPYABLE(DynamicBuffer);
@@ -38,7 +41,7 @@ class FLAXENGINE_API DynamicBuffer
     Array<byte> Data;
 
     /// <summary>
-    /// Gets buffer (may be null since it's using 'late init' feature)
+    /// Gets buffer (may be null since it's using 'late init' feature). Can change after flush when writing directly to the GPU memory (see GPULimits::HasMappedDynamicBuffers).
     /// </summary>
     FORCE_INLINE GPUBuffer* GetBuffer() const
     {
@@ -112,6 +115,10 @@ class FLAXENGINE_API DynamicBuffer
 
 protected:
     virtual void InitDesc(GPUBufferDescription& desc, int32 numElements) = 0;
+
+private:
+    bool InitBuffer(GPUBuffer*& buffer, uint32 size);
+    bool FlushMapped(uint32 size);
 };
 
 /// <summary>
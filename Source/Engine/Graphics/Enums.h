@@ -1125,3 +1125,24 @@ API_ENUM() enum class ProbeCubemapResolution
     // Cubemap with 2048x2048.
     _2048 = 2048,
 };
+
+/// <summary>
+/// The variable rate shading rate (the size of the pixels block shaded by a single pixel shader invocation). Values match the shading rate image encoding (log2 of the block width in bits 2-3 and log2 of the block height in bits 0-1).
+/// </summary>
+API_ENUM() enum class GPUShadingRate : byte
+{
+    // Full-rate shading (one pixel shader invocation per pixel).
+    Rate1x1 = 0x0,
+    // Single invocation per 1x2 pixels block.
+    Rate1x2 = 0x1,
+    // Single invocation per 2x1 pixels block.
+    Rate2x1 = 0x4,
+    // Single invocation per 2x2 pixels block.
+    Rate2x2 = 0x5,
+    // Single invocation per 2x4 pixels block.
+    Rate2x4 = 0x6,
+    // Single invocation per 4x2 pixels block.
+    Rate4x2 = 0x9,
+    // Single invocation per 4x4 pixels block.
+    Rate4x4 = 0xA,
+};
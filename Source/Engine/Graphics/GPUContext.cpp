@@ -64,10 +64,45 @@ void GPUContext::Draw(GPUTextureView* rt)
     DrawFullscreenTriangle();
 }
 
+void GPUContext::SetShadingRate(GPUShadingRate rate)
+{
+}
+
+void GPUContext::SetShadingRateImage(GPUTextureView* image)
+{
+}
+
 void GPUContext::SetResourceState(GPUResource* resource, uint64 state, int32 subresource)
 {
 }
 
+void GPUContext::UseBindless(GPUResourceView* view)
+{
+}
+
+void GPUContext::ActivateAliasedTexture(GPUTexture* texture)
+{
+}
+
+uint64 GPUContext::Signal()
+{
+    return 0;
+}
+
+void GPUContext::Wait(GPUContext* other, uint64 syncPoint)
+{
+}
+
+bool GPUContext::UpdateBufferAsync(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset)
+{
+    return true;
+}
+
+bool GPUContext::UpdateTextureAsync(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch)
+{
+    return true;
+}
+
 void GPUContext::ForceRebindDescriptors()
 {
 }
@@ -7,6 +7,7 @@
 #include "Engine/Core/Math/Rectangle.h"
 #include "Engine/Core/Math/Viewport.h"
 #include "PixelFormat.h"
+#include "Enums.h"
 #include "Config.h"
 
 class GPUConstantBuffer;
@@ -575,6 +576,18 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
     /// <param name="scissorRect">The scissor rectangle (in pixels).</param>
     API_FUNCTION() virtual void SetScissor(API_PARAM(Ref) const Rectangle& scissorRect) = 0;
 
+    /// <summary>
+    /// Sets the variable rate shading rate for the following draw calls. When shading rate image is bound, the coarser of both rates is used. Ignored if device doesn't support the variable rate shading (see GPULimits::HasVariableRateShading).
+    /// </summary>
+    /// <param name="rate">The shading rate.</param>
+    API_FUNCTION() virtual void SetShadingRate(GPUShadingRate rate);
+
+    /// <summary>
+    /// Sets the screen-space shading rate image for the following draw calls. The texture has to use R8_UInt format with a single GPUShadingRate value per screen tile (see GPULimits::VariableRateShadingTileSize). Ignored if device doesn't support the shading rate image (see GPULimits::HasVariableRateShadingImage).
+    /// </summary>
+    /// <param name="image">The shading rate image texture view, or null to disable it.</param>
+    API_FUNCTION() virtual void SetShadingRateImage(GPUTextureView* image);
+
 public:
     /// <summary>
     /// Sets the graphics pipeline state.
@@ -608,6 +621,53 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
     /// </summary>
     virtual void SetResourceState(GPUResource* resource, uint64 state, int32 subresource = -1);
 
+    /// <summary>
+    /// Prepares the resource view to be read by the shaders via bindless index (see GPUResourceView::GetBindlessIndex). Transitions the resource into shader-readable state since bindless reads are not visible to the resources state tracking.
+    /// </summary>
+    /// <param name="view">The resource view (texture view or buffer view).</param>
+    API_FUNCTION() virtual void UseBindless(GPUResourceView* view);
+
+    /// <summary>
+    /// Starts using the aliased texture (see GPUDevice::CreateAliasedTexture). Inserts the barrier that waits for the previous users of the shared memory and discards the texture contents (it's undefined until it's cleared or fully overwritten).
+    /// </summary>
+    /// <param name="texture">The aliased texture.</param>
+    virtual void ActivateAliasedTexture(GPUTexture* texture);
+
+    /// <summary>
+    /// Submits the commands recorded so far to the GPU and returns the sync point that is reached once they are executed. Used to synchronize the work of the main and the async compute contexts (see GPUDevice::GetAsyncComputeContext). Each sync point has to be waited exactly once. The bound state (shaders, resources and render targets) is reset.
+    /// </summary>
+    /// <returns>The sync point to wait for.</returns>
+    virtual uint64 Signal();
+
+    /// <summary>
+    /// Makes the GPU wait (without blocking the CPU) until the other context reaches the sync point before executing the commands recorded on this context afterwards. Commands recorded so far are submitted first so they don't wait. The bound state (shaders, resources and render targets) is reset.
+    /// </summary>
+    /// <param name="other">The context that signaled the sync point.</param>
+    /// <param name="syncPoint">The sync point (see Signal).</param>
+    virtual void Wait(GPUContext* other, uint64 syncPoint);
+
+    /// <summary>
+    /// Updates the buffer data in the background using the copy queue (if supported by the backend). The commands that use the buffer wait for the upload on a GPU. Used by the data streaming to upload data without recording copies on the graphics queue.
+    /// </summary>
+    /// <param name="buffer">The destination buffer to write to.</param>
+    /// <param name="data">The pointer to the data.</param>
+    /// <param name="size">The data size (in bytes) to write.</param>
+    /// <param name="offset">The offset (in bytes) from the buffer start to copy data to.</param>
+    /// <returns>True if async upload is not supported or failed (use UpdateBuffer instead), otherwise false.</returns>
+    virtual bool UpdateBufferAsync(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset = 0);
+
+    /// <summary>
+    /// Updates the texture data in the background using the copy queue (if supported by the backend). The commands that use the texture wait for the upload on a GPU. Used by the data streaming to upload data without recording copies on the graphics queue.
+    /// </summary>
+    /// <param name="texture">The destination texture.</param>
+    /// <param name="arrayIndex">The destination surface index in the texture array.</param>
+    /// <param name="mipIndex">The absolute index of the mip map to update.</param>
+    /// <param name="data">The pointer to the data.</param>
+    /// <param name="rowPitch">The row pitch (in bytes) of the input data.</param>
+    /// <param name="slicePitch">The slice pitch (in bytes) of the input data.</param>
+    /// <returns>True if async upload is not supported or failed (use UpdateTexture instead), otherwise false.</returns>
+    virtual bool UpdateTextureAsync(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch);
+
     /// <summary>
     /// Forces graphics backend to rebind descriptors after command list was used by external graphics library.
     /// </summary>
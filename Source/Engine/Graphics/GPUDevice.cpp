@@ -2,6 +2,7 @@
 
 #include "GPUDevice.h"
 #include "RenderTargetPool.h"
+#include "GPUReadbackPool.h"
 #include "GPUPipelineState.h"
 #include "GPUSwapChain.h"
 #include "RenderTask.h"
@@ -24,6 +25,7 @@
 #include "Engine/Profiler/Profiler.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Scripting/Enums.h"
+#include "Engine/Streaming/Streaming.h"
 
 GPUPipelineState* GPUPipelineState::Spawn(const SpawnParams& params)
 {
@@ -47,16 +49,22 @@ bool GPUPipelineState::Init(const Description& desc)
     DebugDesc = desc;
 #endif
 
-    // Cache shader stages usage flags for pipeline state
+    // Cache shader stages usage flags for pipeline state (and calculate the description hash)
     _meta.InstructionsCount = 0;
     _meta.UsedCBsMask = 0;
     _meta.UsedSRsMask = 0;
     _meta.UsedUAsMask = 0;
+    _hash = ::GetHash(desc.BlendMode);
+    CombineHash(_hash, (desc.DepthEnable ? 1 : 0) | (desc.DepthWriteEnable ? 2 : 0) | (desc.DepthClipEnable ? 4 : 0) | (desc.Wireframe ? 8 : 0));
+    CombineHash(_hash, (uint32)desc.DepthFunc);
+    CombineHash(_hash, (uint32)desc.PrimitiveTopologyType);
+    CombineHash(_hash, (uint32)desc.CullMode);
 #define CHECK_STAGE(stage) \
 	if (desc.stage) { \
 		_meta.UsedCBsMask |= desc.stage->GetBindings().UsedCBsMask; \
 		_meta.UsedSRsMask |= desc.stage->GetBindings().UsedSRsMask; \
 		_meta.UsedUAsMask |= desc.stage->GetBindings().UsedUAsMask; \
+		CombineHash(_hash, desc.stage->GetHash()); \
 	}
     CHECK_STAGE(VS);
     CHECK_STAGE(HS);
@@ -461,6 +469,7 @@ void GPUDevice::preDispose()
 {
     Locker.Lock();
     RenderTargetPool::Flush();
+    GPUReadbackPool::Dispose();
 
     // Release resources
     _res->DefaultMaterial = nullptr;
@@ -492,6 +501,9 @@ void GPUDevice::DrawBegin()
 
     // Clear stats
     RenderTask::TasksDoneLastFrame = 0;
+
+    // Complete the finished readbacks
+    GPUReadbackPool::Update();
 }
 
 void GPUDevice::DrawEnd()
@@ -558,7 +570,26 @@ void GPUDevice::DrawEnd()
     _wasVSyncUsed = anyVSync;
     _isRendering = false;
 
-    RenderTargetPool::Flush();
+    // Release cached resources when running out of the video memory
+    bool forceFlush = false;
+    if (Engine::FrameCount - _lastMemoryBudgetCheckFrame >= GPU_MEMORY_BUDGET_CHECK_INTERVAL)
+    {
+        PROFILE_CPU_NAMED("MemoryBudget");
+        _lastMemoryBudgetCheckFrame = Engine::FrameCount;
+        const MemoryBudget memory = GetMemoryBudget();
+        const uint64 threshold = (uint64)((double)memory.Budget * GPU_MEMORY_BUDGET_THRESHOLD);
+        const bool isOverBudget = memory.Budget != 0 && memory.Usage > threshold;
+        if (isOverBudget)
+        {
+            if (!_isOverMemoryBudget)
+                LOG(Warning, "GPU memory usage {0} MB is close to the budget {1} MB. Releasing the cached resources.", memory.Usage / (1024 * 1024), memory.Budget / (1024 * 1024));
+            forceFlush = true;
+            Streaming::ReleaseMemory(memory.Usage - threshold);
+        }
+        _isOverMemoryBudget = isOverBudget;
+    }
+
+    RenderTargetPool::Flush(forceFlush);
 }
 
 void GPUDevice::RenderBegin()
@@ -627,6 +658,14 @@ uint64 GPUDevice::GetMemoryUsage() const
     return result;
 }
 
+GPUDevice::MemoryBudget GPUDevice::GetMemoryBudget() const
+{
+    MemoryBudget result;
+    result.Budget = TotalGraphicsMemory;
+    result.Usage = GetMemoryUsage();
+    return result;
+}
+
 Array<GPUResource*> GPUDevice::GetResources() const
 {
     _resourcesLock.Lock();
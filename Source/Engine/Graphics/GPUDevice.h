@@ -6,6 +6,7 @@
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Core/NonCopyable.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "GPUAdapter.h"
 #include "GPULimits.h"
@@ -31,6 +32,7 @@ class Shader;
 class Model;
 class Material;
 class MaterialBase;
+struct GPUTextureDescription;
 
 /// <summary>
 /// Graphics device object for rendering on GPU.
@@ -75,6 +77,24 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
         API_FIELD() uint32 RefreshRate;
     };
 
+    /// <summary>
+    /// Describes the GPU memory budget reported by the graphics driver.
+    /// </summary>
+    API_STRUCT() struct MemoryBudget
+    {
+        DECLARE_SCRIPTING_TYPE_NO_SPAWN(MemoryBudget);
+
+        /// <summary>
+        /// The amount of the video memory that the application can use without impacting the performance (in bytes). Might change over time as OS or other applications use the GPU.
+        /// </summary>
+        API_FIELD() uint64 Budget;
+
+        /// <summary>
+        /// The amount of the video memory currently used by the application (in bytes). Includes driver-internal allocations so it can be higher than the sum of the GPU resources memory usage.
+        /// </summary>
+        API_FIELD() uint64 Usage;
+    };
+
     /// <summary>
     /// The singleton instance of the graphics device.
     /// </summary>
@@ -90,6 +110,9 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     ShaderProfile _shaderProfile;
     FeatureLevel _featureLevel;
 
+    uint64 _lastMemoryBudgetCheckFrame = 0;
+    bool _isOverMemoryBudget = false;
+
     // Private resources (hidden with declaration)
     struct PrivateData;
     PrivateData* _res;
@@ -210,6 +233,95 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     API_PROPERTY() virtual GPUContext* GetMainContext() = 0;
 
+    /// <summary>
+    /// Gets the async compute GPU context. Its commands are executed on a separate GPU queue in parallel to the main context (eg. compute-heavy passes overlapping with the scene rasterization). Supports only the compute work (dispatches, UAV clears, buffer updates and copies) and has to be used on the rendering thread. The work is synchronized with the main context using GPUContext::Signal and GPUContext::Wait (resources must not be used by both contexts at the same time and the async work has to be waited by the main context within the same frame).
+    /// </summary>
+    /// <returns>The async compute context or null if not supported (see GPULimits::HasAsyncCompute).</returns>
+    virtual GPUContext* GetAsyncComputeContext()
+    {
+        return nullptr;
+    }
+
+    /// <summary>
+    /// Creates a new deferred GPU context that can record commands on other threads (in parallel to the other deferred contexts). Recorded commands are submitted to the GPU with ExecuteDeferredContexts. The main context should not be used during the parallel recording. Resources shared by the parallel recordings should be already in the state they are used with (eg. render targets cleared on the main context) because the resource state tracking is shared.
+    /// </summary>
+    /// <returns>The created context (owned by the caller) or null if not supported (see GPULimits::HasDeferredContexts).</returns>
+    virtual GPUContext* CreateDeferredContext()
+    {
+        return nullptr;
+    }
+
+    /// <summary>
+    /// Submits the commands recorded on the deferred contexts to the GPU in the given order (after all the commands recorded so far on the main context). Must be called on the rendering thread after the recording has ended. The deferred contexts are ready for the next recording afterwards.
+    /// </summary>
+    /// <param name="contexts">The deferred contexts to execute.</param>
+    virtual void ExecuteDeferredContexts(const Span<GPUContext*>& contexts)
+    {
+    }
+
+    /// <summary>
+    /// Loads the manifest with the pipeline state objects recorded by SavePipelineStatesManifest (eg. during game testing). Each pipeline state initialized afterwards (eg. when loading the level materials behind a loading screen) compiles upfront all the render targets setups it was used with instead of compiling them on the first draw. Entries are merged with the ones recorded so far.
+    /// </summary>
+    /// <param name="path">The manifest file path.</param>
+    /// <returns>True if failed to load the manifest (eg. file is missing, was recorded with a different graphics backend or the backend doesn't compile pipeline states lazily), otherwise false.</returns>
+    API_FUNCTION() virtual bool LoadPipelineStatesManifest(const StringView& path)
+    {
+        return true;
+    }
+
+    /// <summary>
+    /// Saves the manifest with all the pipeline state objects created so far (including the loaded ones). Can be shipped with the game and loaded on startup to prewarm pipeline states (see LoadPipelineStatesManifest).
+    /// </summary>
+    /// <param name="path">The manifest file path.</param>
+    /// <returns>True if failed to save the manifest, otherwise false.</returns>
+    API_FUNCTION() virtual bool SavePipelineStatesManifest(const StringView& path) const
+    {
+        return true;
+    }
+
+    /// <summary>
+    /// Allocates the GPU memory used to place the aliased textures (see CreateAliasedTexture).
+    /// </summary>
+    /// <param name="size">The memory size (in bytes).</param>
+    /// <returns>The native handle to the memory or null if failed or not supported (see GPULimits::HasResourceAliasing).</returns>
+    virtual void* AllocateAliasingMemory(uint64 size)
+    {
+        return nullptr;
+    }
+
+    /// <summary>
+    /// Releases the GPU memory allocated with AllocateAliasingMemory (after all textures placed in it are released). Memory is freed after the GPU stops using it.
+    /// </summary>
+    /// <param name="memory">The native handle to the memory.</param>
+    virtual void ReleaseAliasingMemory(void* memory)
+    {
+    }
+
+    /// <summary>
+    /// Gets the memory requirements of the aliased texture.
+    /// </summary>
+    /// <param name="desc">The texture description.</param>
+    /// <param name="size">The result size of the texture memory (in bytes).</param>
+    /// <param name="alignment">The result alignment of the texture memory offset (in bytes).</param>
+    /// <returns>True if texture cannot be aliased, otherwise false.</returns>
+    virtual bool GetAliasedTextureSize(const GPUTextureDescription& desc, uint64& size, uint64& alignment)
+    {
+        return true;
+    }
+
+    /// <summary>
+    /// Creates the texture placed in the memory shared with other aliased textures. Textures with overlapping memory ranges cannot be used at the same time and the texture contents are undefined after the other texture used its memory (see GPUContext::ActivateAliasedTexture).
+    /// </summary>
+    /// <param name="name">The resource name.</param>
+    /// <param name="desc">The texture description.</param>
+    /// <param name="memory">The native handle to the memory (see AllocateAliasingMemory).</param>
+    /// <param name="offset">The offset of the texture in the memory (in bytes, aligned with the alignment returned by GetAliasedTextureSize).</param>
+    /// <returns>The created texture or null if failed or not supported.</returns>
+    virtual GPUTexture* CreateAliasedTexture(const StringView& name, const GPUTextureDescription& desc, void* memory, uint64 offset)
+    {
+        return nullptr;
+    }
+
     /// <summary>
     /// Gets the adapter device.
     /// </summary>
@@ -225,6 +337,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     API_PROPERTY() uint64 GetMemoryUsage() const;
 
+    /// <summary>
+    /// Gets the GPU memory budget and the current usage of the video memory. Uses the values reported by the graphics driver if supported (otherwise estimated from the total graphics memory and the GPU resources memory usage).
+    /// </summary>
+    API_PROPERTY() virtual MemoryBudget GetMemoryBudget() const;
+
     /// <summary>
     /// Gets the list with all active GPU resources.
     /// </summary>
@@ -274,6 +274,46 @@ API_STRUCT() struct GPULimits
     /// </summary>
     API_FIELD() bool HasTypedUAVLoad;
 
+    /// <summary>
+    /// True if device supports deferred GPU contexts that can record commands on multiple threads in parallel (see GPUDevice::CreateDeferredContext).
+    /// </summary>
+    API_FIELD() bool HasDeferredContexts;
+
+    /// <summary>
+    /// True if device supports bindless resources (shader resource views registered once in a global descriptors table and accessed in shaders by index, see GPUResourceView::GetBindlessIndex).
+    /// </summary>
+    API_FIELD() bool HasBindlessResources;
+
+    /// <summary>
+    /// True if device supports placing textures in the shared memory (aliasing) to reduce the memory used by render targets that are not in use at the same time (see RenderTargetPool::GetTransient).
+    /// </summary>
+    API_FIELD() bool HasResourceAliasing;
+
+    /// <summary>
+    /// True if device supports the async compute queue that executes compute work in parallel to the main GPU context (see GPUDevice::GetAsyncComputeContext).
+    /// </summary>
+    API_FIELD() bool HasAsyncCompute;
+
+    /// <summary>
+    /// True if device supports per-draw variable rate shading (see GPUContext::SetShadingRate).
+    /// </summary>
+    API_FIELD() bool HasVariableRateShading;
+
+    /// <summary>
+    /// True if device supports the screen-space shading rate image that controls the variable rate shading per screen tile (see GPUContext::SetShadingRateImage).
+    /// </summary>
+    API_FIELD() bool HasVariableRateShadingImage;
+
+    /// <summary>
+    /// The size (in pixels) of the screen tile that is covered by a single texel of the shading rate image. Zero if shading rate image is not supported.
+    /// </summary>
+    API_FIELD() int32 VariableRateShadingTileSize;
+
+    /// <summary>
+    /// True if dynamic buffers are allocated in the GPU-visible host memory and can be written directly via Map (without the staging copy on a GPU). The memory can be still in use by the frames in flight so it needs to be buffered.
+    /// </summary>
+    API_FIELD() bool HasMappedDynamicBuffers;
+
     /// <summary>
     /// The maximum amount of texture mip levels.
     /// </summary>
@@ -108,6 +108,7 @@ API_CLASS(Sealed) class FLAXENGINE_API GPUPipelineState : public GPUResource
 
 protected:
     ShaderBindings _meta;
+    uint32 _hash = 0;
 
     GPUPipelineState();
 
@@ -147,6 +148,14 @@ API_CLASS(Sealed) class FLAXENGINE_API GPUPipelineState : public GPUResource
         return _meta.UsedUAsMask;
     }
 
+    /// <summary>
+    /// Gets the hash of the pipeline state description (including the shaders bytecode). Stable between the application runs (eg. to identify pipeline states in the persistent caches).
+    /// </summary>
+    FORCE_INLINE uint32 GetHash() const
+    {
+        return _hash;
+    }
+
 public:
     /// <summary>
     /// Returns true if pipeline state is valid and ready to use
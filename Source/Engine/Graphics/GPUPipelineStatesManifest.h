@@ -0,0 +1,117 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Platform/File.h"
+#include "Enums.h"
+
+/// <summary>
+/// The recorded set of the pipeline state objects created by the graphics backend (the pipeline state description hash and the backend-specific render targets setup it was used with). Used to prewarm the pipeline state objects that are compiled lazily on the first draw.
+/// </summary>
+template<typename KeyType>
+class GPUPipelineStatesManifest
+{
+private:
+    struct Header
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint32 RendererType;
+        uint32 KeySize;
+        int32 Count;
+    };
+
+    enum
+    {
+        Magic = 0x4D535350, // PSSM
+        Version = 1,
+    };
+
+    mutable CriticalSection _locker;
+    Dictionary<uint32, Array<KeyType>> _entries;
+
+public:
+    /// <summary>
+    /// Records the pipeline state object.
+    /// </summary>
+    /// <param name="hash">The pipeline state description hash.</param>
+    /// <param name="key">The render targets setup.</param>
+    void Add(uint32 hash, const KeyType& key)
+    {
+        ScopeLock lock(_locker);
+        auto& keys = _entries[hash];
+        if (!keys.Contains(key))
+            keys.Add(key);
+    }
+
+    /// <summary>
+    /// Gets the recorded render targets setups of the pipeline state.
+    /// </summary>
+    /// <param name="hash">The pipeline state description hash.</param>
+    /// <param name="keys">The output render targets setups.</param>
+    /// <returns>True if pipeline state has any recorded objects, otherwise false.</returns>
+    bool Get(uint32 hash, Array<KeyType>& keys) const
+    {
+        ScopeLock lock(_locker);
+        return _entries.TryGet(hash, keys);
+    }
+
+    /// <summary>
+    /// Loads the recorded entries from the file (merged with the existing ones).
+    /// </summary>
+    /// <param name="path">The file path.</param>
+    /// <param name="rendererType">The graphics backend type (manifest recorded with a different backend is ignored).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Load(const StringView& path, RendererType rendererType)
+    {
+        Array<byte> data;
+        if (File::ReadAllBytes(path, data) || data.Count() < (int32)sizeof(Header))
+            return true;
+        const Header& header = *(const Header*)data.Get();
+        const int32 entrySize = sizeof(uint32) + sizeof(KeyType);
+        if (header.Magic != Magic || header.Version != Version || header.RendererType != (uint32)rendererType || header.KeySize != sizeof(KeyType) || header.Count < 0 || data.Count() != (int32)sizeof(Header) + header.Count * entrySize)
+            return true;
+        const byte* ptr = data.Get() + sizeof(Header);
+        for (int32 i = 0; i < header.Count; i++, ptr += entrySize)
+        {
+            KeyType key;
+            Platform::MemoryCopy(&key, ptr + sizeof(uint32), sizeof(KeyType));
+            Add(*(const uint32*)ptr, key);
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Saves all the recorded entries to the file.
+    /// </summary>
+    /// <param name="path">The file path.</param>
+    /// <param name="rendererType">The graphics backend type.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Save(const StringView& path, RendererType rendererType) const
+    {
+        ScopeLock lock(_locker);
+        Header header;
+        header.Magic = Magic;
+        header.Version = Version;
+        header.RendererType = (uint32)rendererType;
+        header.KeySize = sizeof(KeyType);
+        header.Count = 0;
+        for (auto i = _entries.Begin(); i.IsNotEnd(); ++i)
+            header.Count += i->Value.Count();
+        Array<byte> data;
+        data.EnsureCapacity(sizeof(Header) + header.Count * (sizeof(uint32) + sizeof(KeyType)));
+        data.Add((const byte*)&header, sizeof(Header));
+        for (auto i = _entries.Begin(); i.IsNotEnd(); ++i)
+        {
+            for (const KeyType& key : i->Value)
+            {
+                data.Add((const byte*)&i->Key, sizeof(uint32));
+                data.Add((const byte*)&key, sizeof(KeyType));
+            }
+        }
+        return File::WriteAllBytes(path, data);
+    }
+};
@@ -0,0 +1,282 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "GPUReadbackPool.h"
+#include "GPUDevice.h"
+#include "GPUContext.h"
+#include "GPUBuffer.h"
+#include "Graphics.h"
+#include "Config.h"
+#include "RenderTools.h"
+#include "Textures/GPUTexture.h"
+#include "Textures/TextureData.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+namespace
+{
+    struct StagingBuffer
+    {
+        GPUBuffer* Buffer;
+        uint64 LastFrameUsed;
+    };
+
+    struct StagingTexture
+    {
+        GPUTexture* Texture;
+        uint64 LastFrameUsed;
+    };
+
+    struct Request
+    {
+        uint64 ID;
+        uint64 Frame;
+        GPUBuffer* Buffer;
+        GPUTexture* Texture;
+        uint32 Size;
+        GPUReadbackPool::Callback Callback;
+    };
+
+    CriticalSection Locker;
+    Array<Request> Requests;
+    Array<StagingBuffer> FreeBuffers;
+    Array<StagingTexture> FreeTextures;
+    TextureMipData TextureData;
+    uint64 NextID = 1;
+
+    FORCE_INLINE bool IsRequestReady(const Request& request)
+    {
+        // Data is ready once the GPU finished the frame that recorded the copy
+        return request.Frame + Graphics::MaxFramesInFlight < Engine::FrameCount;
+    }
+
+    int32 FindRequest(uint64 id)
+    {
+        for (int32 i = 0; i < Requests.Count(); i++)
+        {
+            if (Requests[i].ID == id)
+                return i;
+        }
+        return -1;
+    }
+
+    GPUBuffer* GetBuffer(uint32 size)
+    {
+        // Use the smallest free buffer that fits
+        int32 best = -1;
+        for (int32 i = 0; i < FreeBuffers.Count(); i++)
+        {
+            const uint32 bufferSize = FreeBuffers[i].Buffer->GetSize();
+            if (bufferSize >= size && (best == -1 || bufferSize < FreeBuffers[best].Buffer->GetSize()))
+                best = i;
+        }
+        if (best != -1)
+        {
+            GPUBuffer* buffer = FreeBuffers[best].Buffer;
+            FreeBuffers.RemoveAt(best);
+            return buffer;
+        }
+
+        // Round the size up to increase the reuse for the similar requests
+        size = Math::Max(Math::RoundUpToPowerOf2(size), 256u);
+        GPUBuffer* buffer = GPUDevice::Instance->CreateBuffer(TEXT("Readback.Buffer"));
+        if (buffer->Init(GPUBufferDescription::Buffer(size, GPUBufferFlags::None, PixelFormat::Unknown, nullptr, 0, GPUResourceUsage::StagingReadback)))
+        {
+            LOG(Error, "Failed to create readback staging buffer.");
+            SAFE_DELETE_GPU_RESOURCE(buffer);
+        }
+        return buffer;
+    }
+
+    GPUTexture* GetTexture(int32 width, int32 height, PixelFormat format)
+    {
+        for (int32 i = 0; i < FreeTextures.Count(); i++)
+        {
+            GPUTexture* texture = FreeTextures[i].Texture;
+            if (texture->Width() == width && texture->Height() == height && texture->Format() == format)
+            {
+                FreeTextures.RemoveAt(i);
+                return texture;
+            }
+        }
+        GPUTexture* texture = GPUDevice::Instance->CreateTexture(TEXT("Readback.Texture"));
+        if (texture->Init(GPUTextureDescription::New2D(width, height, 1, format, GPUTextureFlags::None).ToStagingReadback()))
+        {
+            LOG(Error, "Failed to create readback staging texture.");
+            SAFE_DELETE_GPU_RESOURCE(texture);
+        }
+        return texture;
+    }
+
+    void ReleaseRequest(Request& request)
+    {
+        if (request.Buffer)
+            FreeBuffers.Add({ request.Buffer, Engine::FrameCount });
+        if (request.Texture)
+            FreeTextures.Add({ request.Texture, Engine::FrameCount });
+        request.Buffer = nullptr;
+        request.Texture = nullptr;
+    }
+
+    uint64 AddRequest(GPUBuffer* buffer, GPUTexture* texture, uint32 size, const GPUReadbackPool::Callback& callback)
+    {
+        auto& request = Requests.AddOne();
+        request.ID = NextID++;
+        request.Frame = Engine::FrameCount;
+        request.Buffer = buffer;
+        request.Texture = texture;
+        request.Size = size;
+        request.Callback = callback;
+        return request.ID;
+    }
+
+    template<typename Handler>
+    bool ReadRequest(const Request& request, Handler handler)
+    {
+        if (request.Buffer)
+        {
+            void* mapped = request.Buffer->Map(GPUResourceMapMode::Read);
+            if (!mapped)
+                return true;
+            handler(Span<byte>((byte*)mapped, (int32)request.Size), request.Size);
+            request.Buffer->Unmap();
+            return false;
+        }
+        if (request.Texture && !request.Texture->GetData(0, 0, TextureData))
+        {
+            handler(Span<byte>(TextureData.Data.Get(), TextureData.Data.Length()), TextureData.RowPitch);
+            return false;
+        }
+        return true;
+    }
+}
+
+uint64 GPUReadbackPool::ReadBuffer(GPUContext* context, GPUBuffer* buffer, uint32 size, uint32 offset, const Callback& callback)
+{
+    if (!context || !buffer || offset >= buffer->GetSize())
+        return 0;
+    if (size == 0)
+        size = buffer->GetSize() - offset;
+    size = Math::Min(size, buffer->GetSize() - offset);
+    ScopeLock lock(Locker);
+    GPUBuffer* staging = GetBuffer(size);
+    if (!staging)
+        return 0;
+    context->CopyBuffer(staging, buffer, size, 0, offset);
+    return AddRequest(staging, nullptr, size, callback);
+}
+
+uint64 GPUReadbackPool::ReadTexture(GPUContext* context, GPUTexture* texture, int32 mipIndex, int32 arrayIndex, const Callback& callback)
+{
+    if (!context || !texture || texture->IsVolume() || texture->IsMultiSample() || mipIndex < 0 || mipIndex >= texture->MipLevels() || arrayIndex < 0 || arrayIndex >= texture->ArraySize())
+        return 0;
+    const int32 width = Math::Max(texture->Width() >> mipIndex, 1);
+    const int32 height = Math::Max(texture->Height() >> mipIndex, 1);
+    ScopeLock lock(Locker);
+    GPUTexture* staging = GetTexture(width, height, texture->Format());
+    if (!staging)
+        return 0;
+    context->CopyTexture(staging, 0, 0, 0, 0, texture, RenderTools::CalcSubresourceIndex(mipIndex, arrayIndex, texture->MipLevels()));
+    return AddRequest(nullptr, staging, 0, callback);
+}
+
+bool GPUReadbackPool::IsReady(uint64 id)
+{
+    ScopeLock lock(Locker);
+    const int32 index = FindRequest(id);
+    return index != -1 && IsRequestReady(Requests[index]);
+}
+
+bool GPUReadbackPool::TryGetData(uint64 id, BytesContainer& data, uint32* rowPitch)
+{
+    ScopeLock lock(Locker);
+    const int32 index = FindRequest(id);
+    if (index == -1 || !IsRequestReady(Requests[index]))
+        return false;
+    Request& request = Requests[index];
+    const bool failed = ReadRequest(request, [&data, rowPitch](const Span<byte>& result, uint32 resultRowPitch)
+    {
+        data.Copy(result);
+        if (rowPitch)
+            *rowPitch = resultRowPitch;
+    });
+    ReleaseRequest(request);
+    Requests.RemoveAt(index);
+    return !failed;
+}
+
+void GPUReadbackPool::Cancel(uint64 id)
+{
+    ScopeLock lock(Locker);
+    const int32 index = FindRequest(id);
+    if (index != -1)
+    {
+        ReleaseRequest(Requests[index]);
+        Requests.RemoveAt(index);
+    }
+}
+
+void GPUReadbackPool::Update()
+{
+    ScopeLock lock(Locker);
+    if (Requests.IsEmpty() && FreeBuffers.IsEmpty() && FreeTextures.IsEmpty())
+        return;
+    PROFILE_CPU();
+
+    // Complete the finished requests (in order of submission)
+    for (int32 i = 0; i < Requests.Count(); i++)
+    {
+        if (!IsRequestReady(Requests[i]))
+            continue;
+        if (Requests[i].Callback.IsBinded())
+        {
+            // Use a copy of the request as callback can add new requests
+            const Request request = Requests[i];
+            if (ReadRequest(request, [&request](const Span<byte>& data, uint32 rowPitch) { request.Callback(data, rowPitch); }))
+                LOG(Warning, "Failed to read the GPU readback data.");
+        }
+        else if (Requests[i].Frame + GPU_READBACK_EXPIRE_FRAMES >= Engine::FrameCount)
+        {
+            // Wait for polling
+            continue;
+        }
+        ReleaseRequest(Requests[i]);
+        Requests.RemoveAtKeepOrder(i--);
+    }
+
+    // Release unused staging resources
+    for (int32 i = FreeBuffers.Count() - 1; i >= 0; i--)
+    {
+        if (FreeBuffers[i].LastFrameUsed + GPU_READBACK_RELEASE_FRAMES < Engine::FrameCount)
+        {
+            FreeBuffers[i].Buffer->DeleteObjectNow();
+            FreeBuffers.RemoveAt(i);
+        }
+    }
+    for (int32 i = FreeTextures.Count() - 1; i >= 0; i--)
+    {
+        if (FreeTextures[i].LastFrameUsed + GPU_READBACK_RELEASE_FRAMES < Engine::FrameCount)
+        {
+            FreeTextures[i].Texture->DeleteObjectNow();
+            FreeTextures.RemoveAt(i);
+        }
+    }
+}
+
+void GPUReadbackPool::Dispose()
+{
+    ScopeLock lock(Locker);
+    for (Request& request : Requests)
+        ReleaseRequest(request);
+    Requests.Clear();
+    for (const StagingBuffer& e : FreeBuffers)
+        e.Buffer->DeleteObjectNow();
+    FreeBuffers.Clear();
+    for (const StagingTexture& e : FreeTextures)
+        e.Texture->DeleteObjectNow();
+    FreeTextures.Clear();
+    TextureData.Data.Release();
+}
@@ -0,0 +1,80 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Types/DataContainer.h"
+
+class GPUContext;
+class GPUBuffer;
+class GPUTexture;
+
+/// <summary>
+/// Utility for reading the GPU resources data back to the CPU without blocking. Uses the pooled staging resources (reused across frames) and completes the requests once the GPU finished the frames in flight.
+/// </summary>
+/// <remarks>
+/// The readback is completed with a few frames of latency (see Graphics::MaxFramesInFlight). The request can either have a callback invoked on completion (at the beginning of the frame) or can be polled with TryGetData.
+/// </remarks>
+class FLAXENGINE_API GPUReadbackPool
+{
+public:
+    /// <summary>
+    /// The readback completion callback. Receives the data and its row pitch (for the textures). The data is valid only during the callback.
+    /// </summary>
+    typedef Function<void(const Span<byte>& data, uint32 rowPitch)> Callback;
+
+    /// <summary>
+    /// Requests the readback of the buffer data.
+    /// </summary>
+    /// <param name="context">The GPU context to record the copy command to.</param>
+    /// <param name="buffer">The source buffer.</param>
+    /// <param name="size">The size of the data to read (in bytes). Use 0 to read the whole buffer.</param>
+    /// <param name="offset">The offset of the data to read (in bytes).</param>
+    /// <param name="callback">The completion callback. If not set, the request has to be polled with TryGetData.</param>
+    /// <returns>The readback request ID or 0 if failed.</returns>
+    static uint64 ReadBuffer(GPUContext* context, GPUBuffer* buffer, uint32 size = 0, uint32 offset = 0, const Callback& callback = Callback());
+
+    /// <summary>
+    /// Requests the readback of the 2D texture data (single subresource).
+    /// </summary>
+    /// <param name="context">The GPU context to record the copy command to.</param>
+    /// <param name="texture">The source texture.</param>
+    /// <param name="mipIndex">The mip index to read.</param>
+    /// <param name="arrayIndex">The array slice index to read.</param>
+    /// <param name="callback">The completion callback. If not set, the request has to be polled with TryGetData.</param>
+    /// <returns>The readback request ID or 0 if failed.</returns>
+    static uint64 ReadTexture(GPUContext* context, GPUTexture* texture, int32 mipIndex = 0, int32 arrayIndex = 0, const Callback& callback = Callback());
+
+    /// <summary>
+    /// Checks if the readback request has been completed and its data can be polled (non-blocking).
+    /// </summary>
+    /// <param name="id">The readback request ID.</param>
+    /// <returns>True if data is ready, otherwise false (still in flight or request is invalid).</returns>
+    static bool IsReady(uint64 id);
+
+    /// <summary>
+    /// Gets the data of the completed readback request and releases it (non-blocking).
+    /// </summary>
+    /// <param name="id">The readback request ID.</param>
+    /// <param name="data">The output data (reuses the container memory if the size matches).</param>
+    /// <param name="rowPitch">The output data row pitch (for the textures).</param>
+    /// <returns>True if got the data, otherwise false (still in flight or request is invalid).</returns>
+    static bool TryGetData(uint64 id, BytesContainer& data, uint32* rowPitch = nullptr);
+
+    /// <summary>
+    /// Cancels the readback request (the callback will not be invoked).
+    /// </summary>
+    /// <param name="id">The readback request ID.</param>
+    static void Cancel(uint64 id);
+
+    /// <summary>
+    /// Completes the finished readback requests (invokes callbacks) and releases the unused staging resources. Called by the graphics device at the beginning of the frame.
+    /// </summary>
+    static void Update();
+
+    /// <summary>
+    /// Releases all the readback requests and the pooled staging resources.
+    /// </summary>
+    static void Dispose();
+};
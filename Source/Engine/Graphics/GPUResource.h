@@ -205,4 +205,13 @@ API_CLASS(Abstract, NoSpawn, Attributes="HideInEditor") class FLAXENGINE_API GPU
     /// Gets the native pointer to the underlying view. It's a platform-specific handle.
     /// </summary>
     virtual void* GetNativePtr() const = 0;
+
+    /// <summary>
+    /// Gets the index of the view in the global bindless resources table. The shader resource view is registered on the first use (and stays registered until the view gets released or recreated, eg. after texture streaming changes the resident mips so query it every frame). Shaders access it by index (passed via constant buffer) from the bindless arrays declared in BindlessResources.hlsl. Bindless reads are not tracked by the resources state tracking so use GPUContext::UseBindless before the draw/dispatch that reads it.
+    /// </summary>
+    /// <returns>The bindless resource index or -1 if not supported (see GPULimits::HasBindlessResources) or view cannot be read in shaders.</returns>
+    API_FUNCTION() virtual int32 GetBindlessIndex()
+    {
+        return -1;
+    }
 };
@@ -108,6 +108,13 @@ class FLAXENGINE_API GPUSwapChain : public GPUResource
     /// <param name="dst">The destination texture. It must match the output dimensions and format. No staging texture support.</param>
     virtual void CopyBackbuffer(GPUContext* context, GPUTexture* dst) = 0;
 
+    /// <summary>
+    /// Waits until the swap chain is ready to render the next frame (the amount of queued frames is below the frame latency limit). Waits only once per presented frame.
+    /// </summary>
+    virtual void WaitForFrameLatency()
+    {
+    }
+
     /// <summary>
     /// Checks if task is ready to render.
     /// </summary>
@@ -4,6 +4,27 @@
 
 #include "GPUResource.h"
 
+/// <summary>
+/// The GPU pipeline statistics collected by the query.
+/// </summary>
+struct GPUPipelineStatistics
+{
+    /// <summary>
+    /// The amount of primitives sent to the rasterizer.
+    /// </summary>
+    uint64 Primitives;
+
+    /// <summary>
+    /// The amount of pixel shader invocations.
+    /// </summary>
+    uint64 PixelShaderInvocations;
+
+    /// <summary>
+    /// The amount of compute shader invocations.
+    /// </summary>
+    uint64 ComputeShaderInvocations;
+};
+
 /// <summary>
 /// Represents a GPU query that measures execution time of GPU operations.
 /// The query will measure any GPU operations that take place between its Begin() and End() calls.
@@ -11,6 +32,12 @@
 /// <seealso cref="GPUResource" />
 class FLAXENGINE_API GPUTimerQuery : public GPUResource
 {
+public:
+    /// <summary>
+    /// True if query should collect the GPU pipeline statistics between Begin/End calls (if supported by the backend). Has to be set before calling Begin.
+    /// </summary>
+    bool CollectPipelineStatistics = false;
+
 public:
     /// <summary>
     /// Finalizes an instance of the <see cref="GPUTimerQuery"/> class.
@@ -42,6 +69,16 @@ class FLAXENGINE_API GPUTimerQuery : public GPUResource
     /// <returns>The time in milliseconds.</returns>
     virtual float GetResult() = 0;
 
+    /// <summary>
+    /// Gets the query result pipeline statistics of GPU commands executed between Begin/End calls. Valid only if query has result and was started with CollectPipelineStatistics enabled.
+    /// </summary>
+    /// <param name="result">The result statistics.</param>
+    /// <returns>True if failed to get the statistics (eg. not supported by the backend), otherwise false.</returns>
+    virtual bool GetPipelineStatistics(GPUPipelineStatistics& result)
+    {
+        return true;
+    }
+
 public:
     // [GPUResource]
     String ToString() const override
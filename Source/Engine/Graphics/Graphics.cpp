@@ -10,15 +10,34 @@
 #include "Engine/Engine/EngineService.h"
 
 bool Graphics::UseVSync = false;
+int32 Graphics::MaxFramesInFlight = 2;
+bool Graphics::LowLatencyMode = false;
+bool Graphics::EnableCachedDrawCalls = false;
+bool Graphics::EnableParallelCommandRecording = false;
+bool Graphics::EnableAsyncCompute = false;
 Quality Graphics::AAQuality = Quality::Medium;
 Quality Graphics::SSRQuality = Quality::Medium;
 Quality Graphics::SSAOQuality = Quality::Medium;
 Quality Graphics::VolumetricFogQuality = Quality::High;
+int32 Graphics::VolumetricFogUpdateRate = 1;
 Quality Graphics::ShadowsQuality = Quality::Medium;
 Quality Graphics::ShadowMapsQuality = Quality::Medium;
 bool Graphics::AllowCSMBlending = false;
+bool Graphics::CacheStaticShadows = false;
+bool Graphics::EnableVirtualShadowMaps = false;
+bool Graphics::EnableClusteredLighting = false;
+bool Graphics::EnableVariableRateShading = false;
 Quality Graphics::GlobalSDFQuality = Quality::High;
 Quality Graphics::GIQuality = Quality::High;
+float Graphics::GIProbesUpdateBudget = 0.0f;
+bool Graphics::EnableOcclusionCulling = false;
+bool Graphics::ConservativeOcclusionCulling = true;
+bool Graphics::EnableGPUInstanceCulling = false;
+bool Graphics::EnableMeshletCulling = true;
+bool Graphics::EnableTerrainVirtualTexture = false;
+bool Graphics::EnableGPUDrivenTerrain = false;
+bool Graphics::EnableComputeSkinning = false;
+float Graphics::GPUTasksBudget = 0.0f;
 PostProcessSettings Graphics::PostProcessSettings;
 
 #if GRAPHICS_API_NULL
@@ -46,6 +65,8 @@ class GraphicsService : public EngineService
     GraphicsService()
         : EngineService(TEXT("Graphics"), -40)
     {
+        // Shaders loading uses the shader cache
+        InitDependencies[0] = TEXT("Shader Cache Manager");
     }
 
     bool Init() override;
@@ -58,15 +79,34 @@ GraphicsService GraphicsServiceInstance;
 void GraphicsSettings::Apply()
 {
     Graphics::UseVSync = UseVSync;
+    Graphics::MaxFramesInFlight = Math::Clamp(MaxFramesInFlight, 1, GPU_MAX_FRAMES_IN_FLIGHT);
+    Graphics::LowLatencyMode = LowLatencyMode;
+    Graphics::EnableCachedDrawCalls = EnableCachedDrawCalls;
+    Graphics::EnableParallelCommandRecording = EnableParallelCommandRecording;
+    Graphics::EnableAsyncCompute = EnableAsyncCompute;
     Graphics::AAQuality = AAQuality;
     Graphics::SSRQuality = SSRQuality;
     Graphics::SSAOQuality = SSAOQuality;
     Graphics::VolumetricFogQuality = VolumetricFogQuality;
+    Graphics::VolumetricFogUpdateRate = Math::Clamp(VolumetricFogUpdateRate, 1, 4);
     Graphics::ShadowsQuality = ShadowsQuality;
     Graphics::ShadowMapsQuality = ShadowMapsQuality;
     Graphics::AllowCSMBlending = AllowCSMBlending;
+    Graphics::CacheStaticShadows = CacheStaticShadows;
+    Graphics::EnableVirtualShadowMaps = EnableVirtualShadowMaps;
+    Graphics::EnableClusteredLighting = EnableClusteredLighting;
+    Graphics::EnableVariableRateShading = EnableVariableRateShading;
     Graphics::GlobalSDFQuality = GlobalSDFQuality;
     Graphics::GIQuality = GIQuality;
+    Graphics::GIProbesUpdateBudget = GIProbesUpdateBudget;
+    Graphics::EnableOcclusionCulling = EnableOcclusionCulling;
+    Graphics::ConservativeOcclusionCulling = ConservativeOcclusionCulling;
+    Graphics::EnableGPUInstanceCulling = EnableGPUInstanceCulling;
+    Graphics::EnableMeshletCulling = EnableMeshletCulling;
+    Graphics::EnableTerrainVirtualTexture = EnableTerrainVirtualTexture;
+    Graphics::EnableGPUDrivenTerrain = EnableGPUDrivenTerrain;
+    Graphics::EnableComputeSkinning = EnableComputeSkinning;
+    Graphics::GPUTasksBudget = GPUTasksBudget;
     Graphics::PostProcessSettings = PostProcessSettings;
 }
 
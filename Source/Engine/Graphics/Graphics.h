@@ -18,6 +18,31 @@ API_CLASS(Static) class FLAXENGINE_API Graphics
     /// </summary>
     API_FIELD() static bool UseVSync;
 
+    /// <summary>
+    /// Enables recording of the shadow maps rendering commands on many threads in parallel (with deferred GPU contexts). Supported only on DirectX 12 and Vulkan.
+    /// </summary>
+    API_FIELD() static bool EnableParallelCommandRecording;
+
+    /// <summary>
+    /// Enables the async compute queue usage for the compute-only rendering passes (eg. Global SDF update) to overlap them with the scene rasterization. Materials and particles that sample the Global SDF before the update use the previous frame data. Supported only on DirectX 12 and Vulkan.
+    /// </summary>
+    API_FIELD() static bool EnableAsyncCompute;
+
+    /// <summary>
+    /// The maximum amount of frames that CPU can prepare ahead of the GPU (frames in flight). Lower values reduce the input latency, higher values improve the throughput.
+    /// </summary>
+    API_FIELD() static int32 MaxFramesInFlight;
+
+    /// <summary>
+    /// Enables the low-latency mode that waits for the swap chain to be ready for the next frame before sampling the input and updating the game.
+    /// </summary>
+    API_FIELD() static bool LowLatencyMode;
+
+    /// <summary>
+    /// Enables caching of the draw calls of the static models (with Transform static flag) across frames.
+    /// </summary>
+    API_FIELD() static bool EnableCachedDrawCalls;
+
     /// <summary>
     /// Anti Aliasing quality setting.
     /// </summary>
@@ -38,6 +63,11 @@ API_CLASS(Static) class FLAXENGINE_API Graphics
     /// </summary>
     API_FIELD() static Quality VolumetricFogQuality;
 
+    /// <summary>
+    /// The amount of frames over which the Volumetric Fog froxels lighting is updated. Froxels not updated in the current frame reuse the reprojected lighting from the previous frames.
+    /// </summary>
+    API_FIELD() static int32 VolumetricFogUpdateRate;
+
     /// <summary>
     /// The shadows quality.
     /// </summary>
@@ -53,6 +83,26 @@ API_CLASS(Static) class FLAXENGINE_API Graphics
     /// </summary>
     API_FIELD() static bool AllowCSMBlending;
 
+    /// <summary>
+    /// Enables caching of the static shadow casters (objects with a static transform) in the shadow maps of the static point and spot lights. Cached shadow maps are refreshed only when the static objects within the light range change, dynamic objects are drawn on top of them each frame.
+    /// </summary>
+    API_FIELD() static bool CacheStaticShadows;
+
+    /// <summary>
+    /// Enables virtual shadow maps for the directional light. Cascades use a much higher virtual resolution that is split into pages allocated from a shared pool, only pages visible by the camera are rendered and they are cached between frames until objects in them move. Requires occlusion culling (uses the depth read back from the previous frames to find the visible pages).
+    /// </summary>
+    API_FIELD() static bool EnableVirtualShadowMaps;
+
+    /// <summary>
+    /// Enables clustered lighting. Point and spot lights are culled into a view frustum grid on a GPU (in compute shader) and lights without shadows are shaded in a single fullscreen pass instead of a separate draw for each light. Forward materials (eg. transparent) use the same lights grid so they receive all local lights.
+    /// </summary>
+    API_FIELD() static bool EnableClusteredLighting;
+
+    /// <summary>
+    /// Enables variable rate shading. The shading rate image is generated from the scene luminance contrast and motion vectors to reduce the pixel shading rate of the GBuffer, forward and fog passes in the low-detail and fast-moving screen areas.
+    /// </summary>
+    API_FIELD() static bool EnableVariableRateShading;
+
     /// <summary>
     /// The Global SDF quality. Controls the volume texture resolution and amount of cascades to use.
     /// </summary>
@@ -63,6 +113,51 @@ API_CLASS(Static) class FLAXENGINE_API Graphics
     /// </summary>
     API_FIELD() static Quality GIQuality;
 
+    /// <summary>
+    /// The GPU time budget (in milliseconds) for the Global Illumination probes updates in a single frame. Probes are updated in order of their priority (new probes, visibility, distance to the view and lighting changes) until the budget is reached. Use 0 to update all probes every time.
+    /// </summary>
+    API_FIELD() static float GIProbesUpdateBudget;
+
+    /// <summary>
+    /// Enables Hi-Z occlusion culling that skips drawing of objects hidden behind the scene depth from the previous frames.
+    /// </summary>
+    API_FIELD() static bool EnableOcclusionCulling;
+
+    /// <summary>
+    /// Enables conservative occlusion culling mode that extends the tested bounds by the camera movement and keeps objects near the screen edges visible to reduce popping.
+    /// </summary>
+    API_FIELD() static bool ConservativeOcclusionCulling;
+
+    /// <summary>
+    /// Enables GPU culling of the large instanced batches (eg. foliage) against the view frustum and Hi-Z, drawn with indirect draw calls. Requires compute shaders support.
+    /// </summary>
+    API_FIELD() static bool EnableGPUInstanceCulling;
+
+    /// <summary>
+    /// Enables GPU culling of the meshlets (clusters of triangles) of the models imported with meshlets against the view frustum, backfaces and Hi-Z, drawn with indirect draw calls. Requires compute shaders support.
+    /// </summary>
+    API_FIELD() static bool EnableMeshletCulling;
+
+    /// <summary>
+    /// Enables caching of the terrain materials output into the virtual texture around the view. Terrain chunks within the cached area sample the virtual texture instead of evaluating the whole material (opaque Lit materials without emissive only).
+    /// </summary>
+    API_FIELD() static bool EnableTerrainVirtualTexture;
+
+    /// <summary>
+    /// Enables GPU-driven terrain rendering. Terrain chunks LOD selection and culling (against the view frustum and Hi-Z) is done on a GPU and the visible chunks of each patch are drawn with indirect draw calls (one per used LOD) with the continuous geomorphing. Requires compute shaders support.
+    /// </summary>
+    API_FIELD() static bool EnableGPUDrivenTerrain;
+
+    /// <summary>
+    /// Enables skinning of the animated models on a GPU with a compute shader once per frame (instead of skinning the vertices in the vertex shader of every pass). Skinned meshes with blend shapes or materials that use vertex colors are skinned in the vertex shader. Requires compute shaders support.
+    /// </summary>
+    API_FIELD() static bool EnableComputeSkinning;
+
+    /// <summary>
+    /// The time budget (in milliseconds) for the asynchronous GPU tasks (eg. textures and buffers data uploads) executed in a single frame. The remaining tasks are carried over to the next frames. Use 0 to run the default amount of tasks every frame.
+    /// </summary>
+    API_FIELD() static float GPUTasksBudget;
+
     /// <summary>
     /// The default Post Process settings. Can be overriden by PostFxVolume on a level locally, per camera or for a whole map.
     /// </summary>
@@ -35,6 +35,7 @@ void DecalMaterialShader::Bind(BindParameters& params)
     auto materialData = reinterpret_cast<DecalMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DecalMaterialShaderData), cb.Length() - sizeof(DecalMaterialShaderData));
     int32 srv = 0;
+    const bool useInstancing = params.DrawCallsCount > 1;
     const bool isCameraInside = OrientedBoundingBox(Vector3::Half, params.FirstDrawCall->World).Contains(view.Position) == ContainmentType::Contains;
 
     // Setup parameters
@@ -77,7 +78,7 @@ void DecalMaterialShader::Bind(BindParameters& params)
     }
 
     // Bind pipeline
-    context->SetState(isCameraInside ? _cache.Inside : _cache.Outside);
+    context->SetState(useInstancing ? _cache.OutsideInstanced : isCameraInside ? _cache.Inside : _cache.Outside);
 }
 
 void DecalMaterialShader::Unload()
@@ -141,6 +142,17 @@ bool DecalMaterialShader::Load()
         return true;
     }
 
+    psDesc0.VS = _shader->GetVS("VS_Decal", 1);
+    psDesc0.PS = _shader->GetPS("PS_Decal", 1);
+    _cache.OutsideInstanced = GPUDevice::Instance->CreatePipelineState();
+    if (_cache.OutsideInstanced->Init(psDesc0))
+    {
+        LOG(Warning, "Failed to create decal material pipeline state.");
+        return true;
+    }
+
+    psDesc0.VS = _shader->GetVS("VS_Decal");
+    psDesc0.PS = _shader->GetPS("PS_Decal");
     psDesc0.CullMode = CullMode::Inverted;
     _cache.Inside = GPUDevice::Instance->CreatePipelineState();
     if (_cache.Inside->Init(psDesc0))
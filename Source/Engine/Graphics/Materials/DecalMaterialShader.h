@@ -7,18 +7,34 @@
 /// <summary>
 /// Represents material that can be used to render decals.
 /// </summary>
+/// <remarks>
+/// Binding with many draw calls uses the instanced pipeline that reads the decals transformations from the per-instance vertex buffer (see DecalInstanceData). Instanced decals are drawn only from the outside (camera not inside the decal box).
+/// </remarks>
 class DecalMaterialShader : public MaterialShader
 {
+public:
+    /// <summary>
+    /// The per-instance data of the instanced decals rendering (matches DecalInput in the Decal material template).
+    /// </summary>
+    PACK_STRUCT(struct DecalInstanceData {
+        Float4 World[3];
+        Float4 InvWorld[3];
+        float PerInstanceRandom;
+        });
+
+
 private:
     struct Cache
     {
         GPUPipelineState* Inside = nullptr;
         GPUPipelineState* Outside = nullptr;
+        GPUPipelineState* OutsideInstanced = nullptr;
 
         FORCE_INLINE void Release()
         {
             SAFE_DELETE_GPU_RESOURCE(Inside);
             SAFE_DELETE_GPU_RESOURCE(Outside);
+            SAFE_DELETE_GPU_RESOURCE(OutsideInstanced);
         }
     };
 
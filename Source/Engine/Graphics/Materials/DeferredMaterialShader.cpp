@@ -36,6 +36,11 @@ bool DeferredMaterialShader::CanUseLightmap() const
     return true;
 }
 
+bool DeferredMaterialShader::CanUseSkinning() const
+{
+    return _canUseSkinning;
+}
+
 bool DeferredMaterialShader::CanUseInstancing(InstancingHandler& handler) const
 {
     handler = { SurfaceDrawCallHandler::GetHash, SurfaceDrawCallHandler::CanBatch, SurfaceDrawCallHandler::WriteDrawCall, };
@@ -49,7 +54,8 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    ConstantsData cbData(_cbData, context);
+    Span<byte> cb = cbData.Data;
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(DeferredMaterialShaderData));
     auto materialData = reinterpret_cast<DeferredMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DeferredMaterialShaderData), cb.Length() - sizeof(DeferredMaterialShaderData));
@@ -66,6 +72,8 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     bindMeta.Buffers = params.RenderContext.Buffers;
     bindMeta.CanSampleDepth = false;
     bindMeta.CanSampleGBuffer = false;
+    if (view.Pass == DrawPass::GBuffer)
+        bindMeta.TexturesScreenResolution = params.CalculateSurfaceScreenResolution();
     MaterialParams::Bind(params.ParamsLink, bindMeta);
 
     // Setup material constants
@@ -78,8 +86,9 @@ void DeferredMaterialShader::Bind(BindParameters& params)
         materialData->GeometrySize = drawCall.Surface.GeometrySize;
     }
 
-    // Check if is using mesh skinning
-    const bool useSkinning = drawCall.Surface.Skinning != nullptr;
+    // Check if is using mesh skinning (meshes skinned by the compute shader are drawn with the static mesh vertex buffers)
+    const bool preSkinned = drawCall.Surface.Skinning != nullptr && drawCall.Geometry.VertexBuffers[1] != nullptr;
+    const bool useSkinning = drawCall.Surface.Skinning != nullptr && !preSkinned;
     bool perBoneMotionBlur = false;
     if (useSkinning)
     {
@@ -96,7 +105,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, cbData.Data.Get());
         context->BindCB(0, _cb);
     }
 
@@ -117,7 +126,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     }
     ASSERT_LOW_LAYER(!(useSkinning && params.DrawCallsCount > 1)); // No support for instancing skinned meshes
     const auto cache = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
-    PipelineStateCache* psCache = cache->GetPS(view.Pass, useLightmap, useSkinning, perBoneMotionBlur);
+    PipelineStateCache* psCache = cache->GetPS(view.Pass, useLightmap, useSkinning, perBoneMotionBlur, preSkinned);
     ASSERT(psCache);
     GPUPipelineState* state = psCache->GetPS(cullMode, wireframe);
 
@@ -153,6 +162,10 @@ bool DeferredMaterialShader::Load()
         psDesc.DS = _shader->GetDS("DS");
     }
 
+    // Skinning permutations can be skipped when cooking materials used only with static meshes
+    _canUseSkinning = _shader->HasShader("VS_Skinned");
+    GPUShaderProgramVS* skinnedVS = _canUseSkinning ? _shader->GetVS("VS_Skinned") : nullptr;
+
     // GBuffer Pass
     psDesc.VS = _shader->GetVS("VS");
     psDesc.PS = _shader->GetPS("PS_GBuffer");
@@ -168,7 +181,7 @@ bool DeferredMaterialShader::Load()
     _cacheInstanced.DefaultLightmap.Init(psDesc);
 
     // GBuffer Pass with skinning
-    psDesc.VS = _shader->GetVS("VS_Skinned");
+    psDesc.VS = skinnedVS;
     psDesc.PS = _shader->GetPS("PS_GBuffer");
     _cache.DefaultSkinned.Init(psDesc);
 
@@ -181,7 +194,7 @@ bool DeferredMaterialShader::Load()
         _cache.QuadOverdraw.Init(psDesc);
         psDesc.VS = _shader->GetVS("VS", 1);
         _cacheInstanced.Depth.Init(psDesc);
-        psDesc.VS = _shader->GetVS("VS_Skinned");
+        psDesc.VS = skinnedVS;
         _cache.QuadOverdrawSkinned.Init(psDesc);
     }
 #endif
@@ -195,13 +208,17 @@ bool DeferredMaterialShader::Load()
     _cache.MotionVectors.Init(psDesc);
 
     // Motion Vectors pass with skinning
-    psDesc.VS = _shader->GetVS("VS_Skinned");
+    psDesc.VS = skinnedVS;
     _cache.MotionVectorsSkinned.Init(psDesc);
 
     // Motion Vectors pass with skinning (with per-bone motion blur)
-    psDesc.VS = _shader->GetVS("VS_Skinned", 1);
+    psDesc.VS = _canUseSkinning ? _shader->GetVS("VS_Skinned", 1) : nullptr;
     _cache.MotionVectorsSkinnedPerBone.Init(psDesc);
 
+    // Motion Vectors pass with skinning done by the compute shader (previous frame positions in a separate vertex buffer)
+    psDesc.VS = _shader->HasShader("VS_PreSkinned") ? _shader->GetVS("VS_PreSkinned") : _shader->GetVS("VS");
+    _cache.MotionVectorsPreSkinned.Init(psDesc);
+
     // Depth Pass
     psDesc.CullMode = CullMode::TwoSided;
     psDesc.DepthClipEnable = false;
@@ -230,7 +247,7 @@ bool DeferredMaterialShader::Load()
     _cacheInstanced.Depth.Init(psDesc);
 
     // Depth Pass with skinning
-    psDesc.VS = _shader->GetVS("VS_Skinned");
+    psDesc.VS = skinnedVS;
     _cache.DepthSkinned.Init(psDesc);
 
     return false;
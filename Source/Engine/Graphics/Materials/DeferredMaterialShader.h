@@ -20,12 +20,13 @@ class DeferredMaterialShader : public MaterialShader
         PipelineStateCache MotionVectors;
         PipelineStateCache MotionVectorsSkinned;
         PipelineStateCache MotionVectorsSkinnedPerBone;
+        PipelineStateCache MotionVectorsPreSkinned;
 #if USE_EDITOR
         PipelineStateCache QuadOverdraw;
         PipelineStateCache QuadOverdrawSkinned;
 #endif
 
-        FORCE_INLINE PipelineStateCache* GetPS(const DrawPass pass, const bool useLightmap, const bool useSkinning, const bool perBoneMotionBlur)
+        FORCE_INLINE PipelineStateCache* GetPS(const DrawPass pass, const bool useLightmap, const bool useSkinning, const bool perBoneMotionBlur, const bool preSkinned)
         {
             switch (pass)
             {
@@ -36,7 +37,7 @@ class DeferredMaterialShader : public MaterialShader
             case DrawPass::GlobalSurfaceAtlas:
                 return useLightmap ? &DefaultLightmap : (useSkinning ? &DefaultSkinned : &Default);
             case DrawPass::MotionVectors:
-                return useSkinning ? (perBoneMotionBlur ? &MotionVectorsSkinnedPerBone : &MotionVectorsSkinned) : &MotionVectors;
+                return useSkinning ? (perBoneMotionBlur ? &MotionVectorsSkinnedPerBone : &MotionVectorsSkinned) : (preSkinned ? &MotionVectorsPreSkinned : &MotionVectors);
 #if USE_EDITOR
             case DrawPass::QuadOverdraw:
                 return useSkinning ? &QuadOverdrawSkinned : &QuadOverdraw;
@@ -55,6 +56,7 @@ class DeferredMaterialShader : public MaterialShader
             DepthSkinned.Release();
             MotionVectors.Release();
             MotionVectorsSkinned.Release();
+            MotionVectorsPreSkinned.Release();
 #if USE_EDITOR
             QuadOverdraw.Release();
             QuadOverdrawSkinned.Release();
@@ -65,6 +67,7 @@ class DeferredMaterialShader : public MaterialShader
 private:
     Cache _cache;
     Cache _cacheInstanced;
+    bool _canUseSkinning = false;
 
 public:
     DeferredMaterialShader(const StringView& name)
@@ -76,6 +79,7 @@ class DeferredMaterialShader : public MaterialShader
     // [MaterialShader]
     DrawPass GetDrawModes() const override;
     bool CanUseLightmap() const override;
+    bool CanUseSkinning() const override;
     bool CanUseInstancing(InstancingHandler& handler) const override;
     void Bind(BindParameters& params) override;
     void Unload() override;
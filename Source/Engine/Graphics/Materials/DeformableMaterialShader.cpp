@@ -38,7 +38,8 @@ void DeformableMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    ConstantsData cbData(_cbData, context);
+    Span<byte> cb = cbData.Data;
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(DeformableMaterialShaderData));
     auto materialData = reinterpret_cast<DeformableMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DeformableMaterialShaderData), cb.Length() - sizeof(DeformableMaterialShaderData));
@@ -77,7 +78,7 @@ void DeformableMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, cbData.Data.Get());
         context->BindCB(0, _cb);
     }
 
@@ -32,6 +32,11 @@ DrawPass ForwardMaterialShader::GetDrawModes() const
     return _drawModes;
 }
 
+bool ForwardMaterialShader::CanUseSkinning() const
+{
+    return _canUseSkinning;
+}
+
 bool ForwardMaterialShader::CanUseInstancing(InstancingHandler& handler) const
 {
     handler = { SurfaceDrawCallHandler::GetHash, SurfaceDrawCallHandler::CanBatch, SurfaceDrawCallHandler::WriteDrawCall, };
@@ -44,7 +49,8 @@ void ForwardMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    ConstantsData cbData(_cbData, context);
+    Span<byte> cb = cbData.Data;
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(ForwardMaterialShaderData));
     auto materialData = reinterpret_cast<ForwardMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(ForwardMaterialShaderData), cb.Length() - sizeof(ForwardMaterialShaderData));
@@ -63,10 +69,12 @@ void ForwardMaterialShader::Bind(BindParameters& params)
     bindMeta.Buffers = params.RenderContext.Buffers;
     bindMeta.CanSampleDepth = GPUDevice::Instance->Limits.HasReadOnlyDepth;
     bindMeta.CanSampleGBuffer = true;
+    if (view.Pass == DrawPass::Forward)
+        bindMeta.TexturesScreenResolution = params.CalculateSurfaceScreenResolution();
     MaterialParams::Bind(params.ParamsLink, bindMeta);
 
-    // Check if is using mesh skinning
-    const bool useSkinning = drawCall.Surface.Skinning != nullptr;
+    // Check if is using mesh skinning (meshes skinned by the compute shader are drawn with the static mesh vertex buffers)
+    const bool useSkinning = drawCall.Surface.Skinning != nullptr && drawCall.Geometry.VertexBuffers[1] == nullptr;
     if (useSkinning)
     {
         // Bind skinning buffer
@@ -87,7 +95,7 @@ void ForwardMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, cbData.Data.Get());
         context->BindCB(0, _cb);
     }
 
@@ -141,6 +149,10 @@ bool ForwardMaterialShader::Load()
         psDesc.DS = _shader->GetDS("DS");
     }
 
+    // Skinning permutations can be skipped when cooking materials used only with static meshes
+    _canUseSkinning = _shader->HasShader("VS_Skinned");
+    GPUShaderProgramVS* skinnedVS = _canUseSkinning ? _shader->GetVS("VS_Skinned") : nullptr;
+
 #if USE_EDITOR
     if (_shader->HasShader("PS_QuadOverdraw"))
     {
@@ -150,7 +162,7 @@ bool ForwardMaterialShader::Load()
         _cache.QuadOverdraw.Init(psDesc);
         psDesc.VS = _shader->GetVS("VS", 1);
         _cacheInstanced.Depth.Init(psDesc);
-        psDesc.VS = _shader->GetVS("VS_Skinned");
+        psDesc.VS = skinnedVS;
         _cache.QuadOverdrawSkinned.Init(psDesc);
     }
 #endif
@@ -168,7 +180,7 @@ bool ForwardMaterialShader::Load()
         _cache.Distortion.Init(psDesc);
         //psDesc.VS = _shader->GetVS("VS", 1);
         //_cacheInstanced.Distortion.Init(psDesc);
-        psDesc.VS = _shader->GetVS("VS_Skinned");
+        psDesc.VS = skinnedVS;
         _cache.DistortionSkinned.Init(psDesc);
     }
 
@@ -192,7 +204,7 @@ bool ForwardMaterialShader::Load()
     _cache.Default.Init(psDesc);
     //psDesc.VS = _shader->GetVS("VS", 1);
     //_cacheInstanced.Default.Init(psDesc);
-    psDesc.VS = _shader->GetVS("VS_Skinned");
+    psDesc.VS = skinnedVS;
     _cache.DefaultSkinned.Init(psDesc);
 
     // Depth Pass
@@ -209,7 +221,7 @@ bool ForwardMaterialShader::Load()
     _cache.Depth.Init(psDesc);
     psDesc.VS = _shader->GetVS("VS", 1);
     _cacheInstanced.Depth.Init(psDesc);
-    psDesc.VS = _shader->GetVS("VS_Skinned");
+    psDesc.VS = skinnedVS;
     _cache.DepthSkinned.Init(psDesc);
 
     return false;
@@ -113,6 +113,15 @@ class FLAXENGINE_API IMaterial
         return false;
     }
 
+    /// <summary>
+    /// Returns true if material can be used to render skinned meshes (skinning shader permutations can be skipped when cooking materials used only with static meshes).
+    /// </summary>
+    /// <returns>True if can use skinning, otherwise false</returns>
+    virtual bool CanUseSkinning() const
+    {
+        return false;
+    }
+
     /// <summary>
     /// The instancing handling used to hash, batch and write draw calls.
     /// </summary>
@@ -164,6 +173,9 @@ class FLAXENGINE_API IMaterial
 
         // Binds the shared per-view constant buffer at slot 1 (see ViewData in MaterialCommon.hlsl)
         void BindViewData();
+
+        // Calculates the largest on-screen resolution (in pixels) of the surface geometry draw calls (used as a textures streaming sampling feedback).
+        float CalculateSurfaceScreenResolution() const;
     };
 
     /// <summary>
@@ -317,6 +317,8 @@ void MaterialParameter::Bind(BindMeta& meta) const
     {
         // If normal map texture is set but not loaded yet, use default engine normal map (reduces loading artifacts)
         auto texture = _asAsset ? ((TextureBase*)_asAsset.Get())->GetTexture() : nullptr;
+        if (texture && meta.TexturesScreenResolution > 0.0f)
+            ((TextureBase*)_asAsset.Get())->StreamingTexture()->RegisterFeedback(meta.TexturesScreenResolution);
         if (texture && texture->ResidentMipLevels() == 0)
             texture = GPUDevice::Instance->GetDefaultNormalMap();
         const auto view = GET_TEXTURE_VIEW_SAFE(texture);
@@ -327,6 +329,8 @@ void MaterialParameter::Bind(BindMeta& meta) const
     case MaterialParameterType::CubeTexture:
     {
         const auto texture = _asAsset ? ((TextureBase*)_asAsset.Get())->GetTexture() : nullptr;
+        if (texture && meta.TexturesScreenResolution > 0.0f)
+            ((TextureBase*)_asAsset.Get())->StreamingTexture()->RegisterFeedback(meta.TexturesScreenResolution);
         const auto view = GET_TEXTURE_VIEW_SAFE(texture);
         meta.Context->BindSR(_registerIndex, view);
         break;
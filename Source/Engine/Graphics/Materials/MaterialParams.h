@@ -328,6 +328,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
         /// True if parameters can sample GBuffer.
         /// </summary>
         bool CanSampleGBuffer;
+
+        /// <summary>
+        /// The on-screen resolution (in pixels) of the geometry drawn with the material. Passed to the textures streaming as a sampling feedback. Zero if unused.
+        /// </summary>
+        float TexturesScreenResolution = 0.0f;
     };
 
     /// <summary>
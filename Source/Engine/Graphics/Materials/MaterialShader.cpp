@@ -7,9 +7,12 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Streaming/Streaming.h"
+#include "Engine/Threading/Threading.h"
 #include "DecalMaterialShader.h"
 #include "PostFxMaterialShader.h"
 #include "ForwardMaterialShader.h"
@@ -64,6 +67,9 @@ IMaterial::BindParameters::BindParameters(::GPUContext* context, const ::RenderC
 
 GPUConstantBuffer* IMaterial::BindParameters::PerViewConstants = nullptr;
 
+// Protects the lazy-initialized pipeline states of the materials
+static CriticalSection PipelineStatesLocker;
+
 void IMaterial::BindParameters::BindViewData()
 {
     // Lazy-init
@@ -93,15 +99,49 @@ void IMaterial::BindParameters::BindViewData()
     GPUContext->BindCB(1, PerViewConstants);
 }
 
+float IMaterial::BindParameters::CalculateSurfaceScreenResolution() const
+{
+    const RenderView& view = RenderContext.View;
+    float screenRadiusSquared = 0.0f;
+    for (int32 i = 0; i < DrawCallsCount; i++)
+    {
+        const DrawCall& drawCall = FirstDrawCall[i];
+        const float radius = (drawCall.World.GetScaleVector() * drawCall.Surface.GeometrySize).Length() * 0.5f;
+        screenRadiusSquared = Math::Max(screenRadiusSquared, RenderTools::ComputeBoundsScreenRadiusSquared(drawCall.ObjectPosition, radius, view));
+        if (Streaming::ViewPredictionTime > 0.0f)
+            screenRadiusSquared = Math::Max(screenRadiusSquared, RenderTools::ComputeBoundsScreenRadiusSquared(drawCall.ObjectPosition, radius, view.PredictedPosition, view.Projection));
+    }
+    return Math::Sqrt(screenRadiusSquared) * 2.0f * Math::Max(view.ScreenSize.X, view.ScreenSize.Y);
+}
+
 GPUPipelineState* MaterialShader::PipelineStateCache::InitPS(CullMode mode, bool wireframe)
 {
+    // Pipeline states can be created from many threads during the parallel commands recording
+    ScopeLock lock(PipelineStatesLocker);
+    const int32 index = static_cast<int32>(mode) + (wireframe ? 3 : 0);
+    if (PS[index])
+        return PS[index];
     Desc.CullMode = mode;
     Desc.Wireframe = wireframe;
     auto ps = GPUDevice::Instance->CreatePipelineState();
     ps->Init(Desc);
+    PS[index] = ps;
     return ps;
 }
 
+MaterialShader::ConstantsData::ConstantsData(Array<byte>& cbData, GPUContext* context)
+{
+    if (context == GPUDevice::Instance->GetMainContext())
+    {
+        Data = Span<byte>(cbData.Get(), cbData.Count());
+    }
+    else
+    {
+        LocalData.Set(cbData.Get(), cbData.Count());
+        Data = Span<byte>(LocalData.Get(), LocalData.Count());
+    }
+}
+
 MaterialShader::MaterialShader(const StringView& name)
     : _isLoaded(false)
     , _shader(nullptr)
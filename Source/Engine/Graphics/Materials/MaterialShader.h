@@ -4,13 +4,14 @@
 
 #include "IMaterial.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Graphics/GPUPipelineState.h"
 #include "Engine/Renderer/Config.h"
 
 /// <summary>
 /// Current materials shader version.
 /// </summary>
-#define MATERIAL_GRAPH_VERSION 161
+#define MATERIAL_GRAPH_VERSION 167
 
 class Material;
 class GPUShader;
@@ -43,7 +44,7 @@ class MaterialShader : public IMaterial
             const int32 index = static_cast<int32>(mode) + (wireframe ? 3 : 0);
             auto ps = PS[index];
             if (!ps)
-                PS[index] = ps = InitPS(mode, wireframe);
+                ps = InitPS(mode, wireframe);
             return ps;
         }
 
@@ -55,6 +56,17 @@ class MaterialShader : public IMaterial
         }
     };
 
+    /// <summary>
+    /// The material constants data used for the binding. Draw calls recorded on a deferred context (in parallel to the other contexts) use a local copy of the shared staging data.
+    /// </summary>
+    struct ConstantsData
+    {
+        Array<byte, InlinedAllocation<1024>> LocalData;
+        Span<byte> Data;
+
+        ConstantsData(Array<byte>& cbData, GPUContext* context);
+    };
+
 protected:
     bool _isLoaded;
     GPUShader* _shader;
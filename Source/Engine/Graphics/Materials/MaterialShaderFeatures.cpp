@@ -5,6 +5,7 @@
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Renderer/ShadowsPass.h"
+#include "Engine/Renderer/LightClustersPass.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Lightmaps.h"
 #endif
@@ -22,6 +23,8 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
     const int32 envProbeShaderRegisterIndex = srv + 0;
     const int32 skyLightShaderRegisterIndex = srv + 1;
     const int32 dirLightShaderRegisterIndex = srv + 2;
+    const int32 clusteredLightsShaderRegisterIndex = srv + 3;
+    const int32 clusterLightsShaderRegisterIndex = srv + 4;
     const bool canUseShadow = view.Pass != DrawPass::Depth;
 
     // Set fog input
@@ -97,24 +100,37 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
         params.GPUContext->UnBindSR(envProbeShaderRegisterIndex);
     }
 
-    // Set local lights
+    // Set local lights (use the lights clusters if built for the view, otherwise pick the ones around the object)
     data.LocalLightsCount = 0;
-    for (int32 i = 0; i < cache->PointLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+    LightClustersPass::BindingData clusters;
+    if (!LightClustersPass::Instance()->Get(params.RenderContext.Buffers, clusters))
     {
-        const auto& light = cache->PointLights[i];
-        if (BoundingSphere(light.Position, light.Radius).Contains(drawCall.ObjectPosition) != ContainmentType::Disjoint)
-        {
-            light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
-            data.LocalLightsCount++;
-        }
+        data.LightClusters = clusters.Constants;
+        params.GPUContext->BindSR(clusteredLightsShaderRegisterIndex, clusters.Lights);
+        params.GPUContext->BindSR(clusterLightsShaderRegisterIndex, clusters.ClusterLights);
     }
-    for (int32 i = 0; i < cache->SpotLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+    else
     {
-        const auto& light = cache->SpotLights[i];
-        if (BoundingSphere(light.Position, light.Radius).Contains(drawCall.ObjectPosition) != ContainmentType::Disjoint)
+        Platform::MemoryClear(&data.LightClusters, sizeof(data.LightClusters));
+        params.GPUContext->UnBindSR(clusteredLightsShaderRegisterIndex);
+        params.GPUContext->UnBindSR(clusterLightsShaderRegisterIndex);
+        for (int32 i = 0; i < cache->PointLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+        {
+            const auto& light = cache->PointLights[i];
+            if (BoundingSphere(light.Position, light.Radius).Contains(drawCall.ObjectPosition) != ContainmentType::Disjoint)
+            {
+                light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
+                data.LocalLightsCount++;
+            }
+        }
+        for (int32 i = 0; i < cache->SpotLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
         {
-            light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
-            data.LocalLightsCount++;
+            const auto& light = cache->SpotLights[i];
+            if (BoundingSphere(light.Position, light.Radius).Contains(drawCall.ObjectPosition) != ContainmentType::Disjoint)
+            {
+                light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
+                data.LocalLightsCount++;
+            }
         }
     }
 
@@ -144,6 +160,10 @@ bool LightmapFeature::Bind(MaterialShader::BindParameters& params, Span<byte>& c
         // Set lightmap data
         auto& data = *(Data*)cb.Get();
         data.LightmapArea = drawCall.Features.LightmapUVsArea;
+
+        // Stream the lightmap mips needed by the object
+        if (params.RenderContext.View.Pass == DrawPass::GBuffer)
+            drawCall.Features.Lightmap->RegisterFeedback(params.CalculateSurfaceScreenResolution(), drawCall.Features.LightmapUVsArea);
     }
 
     cb = Span<byte>(cb.Get() + sizeof(Data), cb.Length() - sizeof(Data));
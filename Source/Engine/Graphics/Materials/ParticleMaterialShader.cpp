@@ -49,7 +49,8 @@ void ParticleMaterialShader::Bind(BindParameters& params)
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
     const uint32 sortedIndicesOffset = drawCall.Particle.Module->SortedIndicesOffset;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    ConstantsData cbData(_cbData, context);
+    Span<byte> cb = cbData.Data;
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(ParticleMaterialShaderData));
     auto materialData = reinterpret_cast<ParticleMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(ParticleMaterialShaderData), cb.Length() - sizeof(ParticleMaterialShaderData));
@@ -163,7 +164,7 @@ void ParticleMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, cbData.Data.Get());
         context->BindCB(0, _cb);
     }
 
@@ -11,8 +11,12 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
+#include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Renderer/DrawCall.h"
+#include "Engine/Renderer/TerrainVirtualTexturePass.h"
+#include "Engine/Renderer/TerrainCullingPass.h"
+#include "Engine/Terrain/Terrain.h"
 #include "Engine/Terrain/TerrainPatch.h"
 
 PACK_STRUCT(struct TerrainMaterialShaderData {
@@ -26,6 +30,13 @@ PACK_STRUCT(struct TerrainMaterialShaderData {
     Float4 HeightmapUVScaleBias; // xy-scale, zw-offset for chunk geometry UVs into heightmap UVs (as single MAD instruction)
     Float4 NeighborLOD; // Per component LOD index for chunk neighbors ordered: top, left, right, bottom
     Float2 OffsetUV; // Offset applied to the texture coordinates (used to implement seamless UVs based on chunk location relative to terrain root)
+    uint32 ChunksOffset; // Offset of the chunks instances in the chunks buffer (for the chunks culled on a GPU)
+    uint32 UseChunksBuffer; // Non-zero if draw uses the chunks instances culled on a GPU
+    Float4 VirtualTextureUVScaleBias; // xy-scale, zw-offset for world-space position XZ into the terrain virtual texture UVs
+    Float3 LODViewPosition; // Position of the view used for the LOD selection (for the chunks culled on a GPU)
+    float LODDistribution; // Terrain LOD distribution (for the chunks culled on a GPU)
+    float LODBias; // Terrain LOD bias (for the chunks culled on a GPU)
+    float InvChunkEdgeSize; // Inverse of the terrain chunk size in world units (for the chunks culled on a GPU)
     Float2 Dummy0;
     });
 
@@ -45,11 +56,12 @@ void TerrainMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    ConstantsData cbData(_cbData, context);
+    Span<byte> cb = cbData.Data;
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(TerrainMaterialShaderData));
     auto materialData = reinterpret_cast<TerrainMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(TerrainMaterialShaderData), cb.Length() - sizeof(TerrainMaterialShaderData));
-    int32 srv = 3;
+    int32 srv = 7;
 
     // Setup features
     const bool useLightmap = LightmapFeature::Bind(params, cb, srv);
@@ -82,6 +94,28 @@ void TerrainMaterialShader::Bind(BindParameters& params)
         materialData->HeightmapUVScaleBias = drawCall.Terrain.HeightmapUVScaleBias;
         materialData->NeighborLOD = drawCall.Terrain.NeighborLOD;
         materialData->OffsetUV = drawCall.Terrain.OffsetUV;
+        materialData->VirtualTextureUVScaleBias = Float4::Zero;
+        if (drawCall.Terrain.GPUChunksOffset >= 0)
+        {
+            // Chunks LOD is selected on a GPU so use the same parameters for the distance-based geomorphing
+            const Terrain* terrain = drawCall.Terrain.Patch->GetTerrain();
+            const auto lodView = params.RenderContext.LodProxyView ? params.RenderContext.LodProxyView : &view;
+            materialData->ChunksOffset = (uint32)drawCall.Terrain.GPUChunksOffset;
+            materialData->UseChunksBuffer = 1;
+            materialData->LODViewPosition = lodView->Position + Float3(lodView->Origin - view.Origin);
+            materialData->LODDistribution = terrain->GetLODDistribution();
+            materialData->LODBias = (float)terrain->GetLODBias();
+            materialData->InvChunkEdgeSize = 1.0f / drawCall.Terrain.TerrainChunkSizeLOD0;
+        }
+        else
+        {
+            materialData->ChunksOffset = 0;
+            materialData->UseChunksBuffer = 0;
+            materialData->LODViewPosition = Float3::Zero;
+            materialData->LODDistribution = 0.0f;
+            materialData->LODBias = 0.0f;
+            materialData->InvChunkEdgeSize = 0.0f;
+        }
     }
 
     // Bind terrain textures
@@ -91,11 +125,33 @@ void TerrainMaterialShader::Bind(BindParameters& params)
     context->BindSR(0, heightmap);
     context->BindSR(1, splatmap0);
     context->BindSR(2, splatmap1);
+    if (drawCall.Terrain.GPUChunksOffset >= 0)
+        context->BindSR(6, TerrainCullingPass::Instance()->GetOutputBuffer()->View());
+
+    // Use the cached material output from the terrain virtual texture if the whole chunk is in the cached area
+    const PipelineStateCache* psCache = _cache.GetPS(view.Pass, useLightmap);
+    if (IsRunningTerrainVirtualTexturePass)
+    {
+        // Render material properties into the virtual texture (or just occlude it if material cannot be cached)
+        psCache = _useVirtualTexture ? &_cache.VirtualTextureBake : &_cache.Depth;
+    }
+    else if (view.Pass == DrawPass::GBuffer && _useVirtualTexture)
+    {
+        TerrainVirtualTexturePass::BindingData bindingData;
+        if (!TerrainVirtualTexturePass::Instance()->Get(params.RenderContext, drawCall, bindingData))
+        {
+            materialData->VirtualTextureUVScaleBias = bindingData.UVScaleBias;
+            context->BindSR(3, bindingData.Textures[0]);
+            context->BindSR(4, bindingData.Textures[1]);
+            context->BindSR(5, bindingData.Textures[2]);
+            psCache = useLightmap ? &_cache.VirtualTextureLightmap : &_cache.VirtualTexture;
+        }
+    }
 
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, cbData.Data.Get());
         context->BindCB(0, _cb);
     }
 
@@ -114,7 +170,6 @@ void TerrainMaterialShader::Bind(BindParameters& params)
         else
             cullMode = CullMode::Normal;
     }
-    const PipelineStateCache* psCache = _cache.GetPS(view.Pass, useLightmap);
     ASSERT(psCache);
     GPUPipelineState* state = ((PipelineStateCache*)psCache)->GetPS(cullMode, wireframe);
 
@@ -128,6 +183,7 @@ void TerrainMaterialShader::Unload()
     MaterialShader::Unload();
 
     _cache.Release();
+    _useVirtualTexture = false;
 }
 
 bool TerrainMaterialShader::Load()
@@ -168,6 +224,21 @@ bool TerrainMaterialShader::Load()
     psDesc.PS = _shader->GetPS("PS_GBuffer", 1);
     _cache.DefaultLightmap.Init(psDesc);
 
+    // Terrain Virtual Texture (material output is cached only for the opaque Lit materials without emissive)
+    _useVirtualTexture = _info.BlendMode == MaterialBlendMode::Opaque &&
+            _info.ShadingModel == MaterialShadingModel::Lit &&
+            !EnumHasAnyFlags(_info.UsageFlags, MaterialUsageFlags::UseEmissive) &&
+            _shader->HasShader("PS_VirtualTexture");
+    if (_useVirtualTexture)
+    {
+        psDesc.PS = _shader->GetPS("PS_GBufferVirtual");
+        _cache.VirtualTexture.Init(psDesc);
+        psDesc.PS = _shader->GetPS("PS_GBufferVirtual", 1);
+        _cache.VirtualTextureLightmap.Init(psDesc);
+        psDesc.PS = _shader->GetPS("PS_VirtualTexture");
+        _cache.VirtualTextureBake.Init(psDesc);
+    }
+
 #if USE_EDITOR
     if (_shader->HasShader("PS_QuadOverdraw"))
     {
@@ -15,6 +15,9 @@ class TerrainMaterialShader : public MaterialShader
         PipelineStateCache Default;
         PipelineStateCache DefaultLightmap;
         PipelineStateCache Depth;
+        PipelineStateCache VirtualTexture;
+        PipelineStateCache VirtualTextureLightmap;
+        PipelineStateCache VirtualTextureBake;
 #if USE_EDITOR
         PipelineStateCache QuadOverdraw;
 #endif
@@ -43,6 +46,9 @@ class TerrainMaterialShader : public MaterialShader
             Default.Release();
             DefaultLightmap.Release();
             Depth.Release();
+            VirtualTexture.Release();
+            VirtualTextureLightmap.Release();
+            VirtualTextureBake.Release();
 #if USE_EDITOR
             QuadOverdraw.Release();
 #endif
@@ -51,6 +57,7 @@ class TerrainMaterialShader : public MaterialShader
 
 private:
     Cache _cache;
+    bool _useVirtualTexture = false;
 
 public:
     /// <summary>
@@ -3,6 +3,7 @@
 #include "BlendShape.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
 BlendShapesInstance::MeshInstance::MeshInstance()
@@ -16,6 +17,96 @@ BlendShapesInstance::MeshInstance::MeshInstance()
 
 BlendShapesInstance::MeshInstance::~MeshInstance()
 {
+    SAFE_DELETE_GPU_RESOURCE(GPUBlendShapes);
+    SAFE_DELETE_GPU_RESOURCE(GPUDeltas);
+}
+
+bool BlendShapesInstance::MeshInstance::UpdateVertexBuffer(const SkinnedMesh* mesh)
+{
+    if (!IsDirty)
+        return false;
+    IsDirty = false;
+    PROFILE_CPU_NAMED("Blend Shapes");
+
+    // Get skinned mesh vertex buffer data (original, cached on CPU)
+    BytesContainer vertexBuffer;
+    int32 vertexCount;
+    if (mesh->DownloadDataCPU(MeshBufferType::Vertex0, vertexBuffer, vertexCount))
+        return true;
+
+    // Estimate the range of the vertices to modify by the currently active blend shapes
+    uint32 minVertexIndex = MAX_uint32, maxVertexIndex = 0;
+    bool useNormals = false;
+    for (const auto& q : BlendShapes)
+    {
+        const BlendShape& blendShape = mesh->BlendShapes[q.First];
+        minVertexIndex = Math::Min(minVertexIndex, blendShape.MinVertexIndex);
+        maxVertexIndex = Math::Max(maxVertexIndex, blendShape.MaxVertexIndex);
+        useNormals |= blendShape.UseNormals;
+    }
+
+    // Initialize the dynamic vertex buffer data (use the dirty range from the previous update to be cleared with initial data)
+    VertexBuffer.Data.Resize(vertexBuffer.Length());
+    const uint32 dirtyVertexDataStart = DirtyMinVertexIndex * sizeof(VB0SkinnedElementType);
+    const uint32 dirtyVertexDataLength = Math::Min<uint32>(DirtyMaxVertexIndex - DirtyMinVertexIndex + 1, vertexCount) * sizeof(VB0SkinnedElementType);
+    Platform::MemoryCopy(VertexBuffer.Data.Get() + dirtyVertexDataStart, vertexBuffer.Get() + dirtyVertexDataStart, dirtyVertexDataLength);
+
+    // Blend all blend shapes
+    auto data = (VB0SkinnedElementType*)VertexBuffer.Data.Get();
+    for (const auto& q : BlendShapes)
+    {
+        const BlendShape& blendShape = mesh->BlendShapes[q.First];
+        // TODO: use SIMD
+        if (useNormals)
+        {
+            for (int32 i = 0; i < blendShape.Vertices.Count(); i++)
+            {
+                const BlendShapeVertex& blendShapeVertex = blendShape.Vertices[i];
+                ASSERT_LOW_LAYER(blendShapeVertex.VertexIndex < (uint32)vertexCount);
+                VB0SkinnedElementType& vertex = *(data + blendShapeVertex.VertexIndex);
+                vertex.Position = vertex.Position + blendShapeVertex.PositionDelta * q.Second;
+                Float3 normal = (vertex.Normal.ToFloat3() * 2.0f - 1.0f) + blendShapeVertex.NormalDelta;
+                vertex.Normal = normal * 0.5f + 0.5f;
+            }
+        }
+        else
+        {
+            for (int32 i = 0; i < blendShape.Vertices.Count(); i++)
+            {
+                const BlendShapeVertex& blendShapeVertex = blendShape.Vertices[i];
+                ASSERT_LOW_LAYER(blendShapeVertex.VertexIndex < (uint32)vertexCount);
+                VB0SkinnedElementType& vertex = *(data + blendShapeVertex.VertexIndex);
+                vertex.Position = vertex.Position + blendShapeVertex.PositionDelta * q.Second;
+            }
+        }
+    }
+
+    if (useNormals)
+    {
+        // Normalize normal vectors and rebuild tangent frames (tangent frame is in range [-1;1] but packed to [0;1] range)
+        // TODO: use SIMD
+        for (uint32 vertexIndex = minVertexIndex; vertexIndex <= maxVertexIndex; vertexIndex++)
+        {
+            VB0SkinnedElementType& vertex = *(data + vertexIndex);
+
+            Float3 normal = vertex.Normal.ToFloat3() * 2.0f - 1.0f;
+            normal.Normalize();
+            vertex.Normal = normal * 0.5f + 0.5f;
+
+            Float3 tangent = vertex.Tangent.ToFloat3() * 2.0f - 1.0f;
+            tangent = tangent - ((tangent | normal) * normal);
+            tangent.Normalize();
+            const auto tangentSign = vertex.Tangent.W;
+            vertex.Tangent = tangent * 0.5f + 0.5f;
+            vertex.Tangent.W = tangentSign;
+        }
+    }
+
+    // Send data to the GPU
+    VertexBuffer.Flush();
+    DirtyMinVertexIndex = minVertexIndex;
+    DirtyMaxVertexIndex = maxVertexIndex;
+    return false;
 }
 
 BlendShapesInstance::~BlendShapesInstance()
@@ -71,15 +162,16 @@ void BlendShapesInstance::Update(SkinnedModel* skinnedModel)
         }
     }
 
-    // Update all used meshes
+    // Collect the active blend shapes of all used meshes
     for (auto& e : Meshes)
     {
         MeshInstance& instance = *e.Value;
+        instance.BlendShapes.Clear();
         if (!instance.IsUsed)
             continue;
         const SkinnedMesh* mesh = e.Key;
 
-        // Get skinned mesh vertex buffer data (original, cached on CPU)
+        // Ensure that skinned mesh vertex buffer data is cached on CPU (used for blending on a CPU)
         BytesContainer vertexBuffer;
         int32 vertexCount;
         if (mesh->DownloadDataCPU(MeshBufferType::Vertex0, vertexBuffer, vertexCount))
@@ -89,86 +181,18 @@ void BlendShapesInstance::Update(SkinnedModel* skinnedModel)
             continue;
         }
 
-        // Estimate the range of the vertices to modify by the currently active blend shapes
-        uint32 minVertexIndex = MAX_uint32, maxVertexIndex = 0;
-        bool useNormals = false;
-        Array<Pair<const BlendShape&, const float>, InlinedAllocation<32>> blendShapes;
-        for (const BlendShape& blendShape : mesh->BlendShapes)
+        for (int32 blendShapeIndex = 0; blendShapeIndex < mesh->BlendShapes.Count(); blendShapeIndex++)
         {
+            const BlendShape& blendShape = mesh->BlendShapes[blendShapeIndex];
             for (auto& q : Weights)
             {
                 if (q.First == blendShape.Name)
                 {
-                    const float weight = q.Second * blendShape.Weight;
-                    blendShapes.Add(Pair<const BlendShape&, const float>(blendShape, weight));
-                    minVertexIndex = Math::Min(minVertexIndex, blendShape.MinVertexIndex);
-                    maxVertexIndex = Math::Max(maxVertexIndex, blendShape.MaxVertexIndex);
-                    useNormals |= blendShape.UseNormals;
+                    instance.BlendShapes.Add(Pair<int32, float>(blendShapeIndex, q.Second * blendShape.Weight));
                     break;
                 }
             }
         }
-
-        // Initialize the dynamic vertex buffer data (use the dirty range from the previous update to be cleared with initial data)
-        instance.VertexBuffer.Data.Resize(vertexBuffer.Length());
-        const uint32 dirtyVertexDataStart = instance.DirtyMinVertexIndex * sizeof(VB0SkinnedElementType);
-        const uint32 dirtyVertexDataLength = Math::Min<uint32>(instance.DirtyMaxVertexIndex - instance.DirtyMinVertexIndex + 1, vertexCount) * sizeof(VB0SkinnedElementType);
-        Platform::MemoryCopy(instance.VertexBuffer.Data.Get() + dirtyVertexDataStart, vertexBuffer.Get() + dirtyVertexDataStart, dirtyVertexDataLength);
-
-        // Blend all blend shapes
-        auto data = (VB0SkinnedElementType*)instance.VertexBuffer.Data.Get();
-        for (const auto& q : blendShapes)
-        {
-            // TODO: use SIMD
-            if (useNormals)
-            {
-                for (int32 i = 0; i < q.First.Vertices.Count(); i++)
-                {
-                    const BlendShapeVertex& blendShapeVertex = q.First.Vertices[i];
-                    ASSERT_LOW_LAYER(blendShapeVertex.VertexIndex < (uint32)vertexCount);
-                    VB0SkinnedElementType& vertex = *(data + blendShapeVertex.VertexIndex);
-                    vertex.Position = vertex.Position + blendShapeVertex.PositionDelta * q.Second;
-                    Float3 normal = (vertex.Normal.ToFloat3() * 2.0f - 1.0f) + blendShapeVertex.NormalDelta;
-                    vertex.Normal = normal * 0.5f + 0.5f;
-                }
-            }
-            else
-            {
-                for (int32 i = 0; i < q.First.Vertices.Count(); i++)
-                {
-                    const BlendShapeVertex& blendShapeVertex = q.First.Vertices[i];
-                    ASSERT_LOW_LAYER(blendShapeVertex.VertexIndex < (uint32)vertexCount);
-                    VB0SkinnedElementType& vertex = *(data + blendShapeVertex.VertexIndex);
-                    vertex.Position = vertex.Position + blendShapeVertex.PositionDelta * q.Second;
-                }
-            }
-        }
-
-        if (useNormals)
-        {
-            // Normalize normal vectors and rebuild tangent frames (tangent frame is in range [-1;1] but packed to [0;1] range)
-            // TODO: use SIMD
-            for (uint32 vertexIndex = minVertexIndex; vertexIndex <= maxVertexIndex; vertexIndex++)
-            {
-                VB0SkinnedElementType& vertex = *(data + vertexIndex);
-
-                Float3 normal = vertex.Normal.ToFloat3() * 2.0f - 1.0f;
-                normal.Normalize();
-                vertex.Normal = normal * 0.5f + 0.5f;
-
-                Float3 tangent = vertex.Tangent.ToFloat3() * 2.0f - 1.0f;
-                tangent = tangent - ((tangent | normal) * normal);
-                tangent.Normalize();
-                const auto tangentSign = vertex.Tangent.W;
-                vertex.Tangent = tangent * 0.5f + 0.5f;
-                vertex.Tangent.W = tangentSign;
-            }
-        }
-
-        // Mark as dirty to be flushed before next rendering
-        instance.IsDirty = true;
-        instance.DirtyMinVertexIndex = minVertexIndex;
-        instance.DirtyMaxVertexIndex = maxVertexIndex;
     }
 }
 
@@ -95,8 +95,30 @@ class BlendShapesInstance
         uint32 DirtyMaxVertexIndex;
         DynamicVertexBuffer VertexBuffer;
 
+        /// <summary>
+        /// The active blend shapes (pair of the blend shape index in the mesh and the weight).
+        /// </summary>
+        Array<Pair<int32, float>> BlendShapes;
+
+        /// <summary>
+        /// The GPU buffer with the active blend shapes uploaded for the compute skinning. Allocated on the first use by ComputeSkinningPass.
+        /// </summary>
+        GPUBuffer* GPUBlendShapes = nullptr;
+
+        /// <summary>
+        /// The GPU buffer with the accumulated vertices deltas of the active blend shapes used by the compute skinning. Allocated on the first use by ComputeSkinningPass.
+        /// </summary>
+        GPUBuffer* GPUDeltas = nullptr;
+
         MeshInstance();
         ~MeshInstance();
+
+        /// <summary>
+        /// Blends the active blend shapes into the vertex buffer on a CPU (only if weights were modified) and flushes it with the GPU. Not used by the meshes skinned with a compute shader that apply blend shapes on a GPU.
+        /// </summary>
+        /// <param name="mesh">The skinned mesh.</param>
+        /// <returns>True if failed, otherwise false.</returns>
+        bool UpdateVertexBuffer(const SkinnedMesh* mesh);
     };
 
 public:
@@ -122,7 +144,7 @@ class BlendShapesInstance
     ~BlendShapesInstance();
 
     /// <summary>
-    /// Updates the instanced meshes. Performs the blend shapes blending (only if weights were modified).
+    /// Updates the instanced meshes. Collects the active blend shapes of the meshes (only if weights were modified). The blending happens on a GPU within the compute skinning or on a CPU before the mesh drawing.
     /// </summary>
     /// <param name="skinnedModel">The skinned model used for blend shapes.</param>
     void Update(SkinnedModel* skinnedModel);
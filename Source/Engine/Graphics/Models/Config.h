@@ -13,6 +13,10 @@
 // Maximum amount of meshes per model LOD
 #define MODEL_MAX_MESHES 4096
 
+// The maximum amount of vertices and triangles in a single meshlet (geometry cluster used by the GPU meshlets culling)
+#define MODEL_MESHLET_MAX_VERTICES 64
+#define MODEL_MESHLET_MAX_TRIANGLES 124
+
 // Enable/disable precise mesh collision testing (with in-build vertex buffer caching, this will increase memory usage)
 #define USE_PRECISE_MESH_INTERSECTS (USE_EDITOR)
 
@@ -2,6 +2,7 @@
 
 #include "Mesh.h"
 #include "ModelInstanceEntry.h"
+#include "MeshDrawCache.h"
 #include "Engine/Content/Assets/Material.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Core/Log.h"
@@ -11,6 +12,7 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/MeshletCullingPass.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Threading/Task.h"
@@ -225,6 +227,8 @@ void Mesh::Init(Model* model, int32 lodIndex, int32 index, int32 materialSlotInd
     _vertexBuffers[1] = nullptr;
     _vertexBuffers[2] = nullptr;
     _indexBuffer = nullptr;
+    _meshletsBuffer = nullptr;
+    _meshletsCount = 0;
 }
 
 Mesh::~Mesh()
@@ -234,9 +238,10 @@ Mesh::~Mesh()
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[1]);
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[2]);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_meshletsBuffer);
 }
 
-bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* vb2, void* ib, bool use16BitIndexBuffer)
+bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* vb2, void* ib, bool use16BitIndexBuffer, const MeshletData* meshlets, int32 meshletsCount)
 {
     // Cache data
     uint32 indicesCount = triangles * 3;
@@ -246,6 +251,7 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* v
     GPUBuffer* vertexBuffer1 = nullptr;
     GPUBuffer* vertexBuffer2 = nullptr;
     GPUBuffer* indexBuffer = nullptr;
+    GPUBuffer* meshletsBuffer = nullptr;
 
     // Create GPU buffers
 #if GPU_ENABLE_RESOURCE_NAMING
@@ -265,9 +271,21 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* v
         if (vertexBuffer2->Init(GPUBufferDescription::Vertex(sizeof(VB2ElementType), vertices, vb2)))
             goto ERROR_LOAD_END;
     }
+    if (meshlets && meshletsCount > 0 && GPUDevice::Instance->Limits.HasCompute && GPUDevice::Instance->Limits.HasDrawIndirect)
+    {
+        // Meshlets culling reads the mesh indices in a compute shader
+        meshletsBuffer = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".Meshlets"));
+        if (meshletsBuffer->Init(GPUBufferDescription::Buffer(meshletsCount * sizeof(MeshletData), GPUBufferFlags::Structured | GPUBufferFlags::ShaderResource, PixelFormat::Unknown, meshlets, sizeof(MeshletData))))
+            goto ERROR_LOAD_END;
+    }
     indexBuffer = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".IB"));
-    if (indexBuffer->Init(GPUBufferDescription::Index(ibStride, indicesCount, ib)))
-        goto ERROR_LOAD_END;
+    {
+        auto ibDesc = GPUBufferDescription::Index(ibStride, indicesCount, ib);
+        if (meshletsBuffer)
+            ibDesc.Flags |= GPUBufferFlags::ShaderResource;
+        if (indexBuffer->Init(ibDesc))
+            goto ERROR_LOAD_END;
+    }
 
     // Init collision proxy
 #if USE_PRECISE_MESH_INTERSECTS
@@ -285,6 +303,8 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* v
     _vertexBuffers[1] = vertexBuffer1;
     _vertexBuffers[2] = vertexBuffer2;
     _indexBuffer = indexBuffer;
+    _meshletsBuffer = meshletsBuffer;
+    _meshletsCount = meshletsBuffer ? meshletsCount : 0;
     _triangles = triangles;
     _vertices = vertices;
     _use16BitIndexBuffer = use16BitIndexBuffer;
@@ -301,6 +321,7 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* v
     SAFE_DELETE_GPU_RESOURCE(vertexBuffer1);
     SAFE_DELETE_GPU_RESOURCE(vertexBuffer2);
     SAFE_DELETE_GPU_RESOURCE(indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(meshletsBuffer);
     return true;
 }
 
@@ -310,6 +331,8 @@ void Mesh::Unload()
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[1]);
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[2]);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_meshletsBuffer);
+    _meshletsCount = 0;
     _triangles = 0;
     _vertices = 0;
     _use16BitIndexBuffer = false;
@@ -406,6 +429,104 @@ void Mesh::Render(GPUContext* context) const
     context->DrawIndexedInstanced(_triangles * 3, 1, 0, 0, 0);
 }
 
+namespace
+{
+    // Gets the cached draw call of the mesh (sets it up if missing or outdated). Returns null if mesh is not drawn.
+    const MeshDrawCache::Entry* GetCachedDrawCall(const Mesh* mesh, const Mesh::DrawInfo& info)
+    {
+        const Model* model = mesh->GetModel();
+        const int32 materialSlotIndex = mesh->GetMaterialSlotIndex();
+        const auto& entry = info.Buffer->At(materialSlotIndex);
+        const MaterialSlot& slot = model->MaterialSlots[materialSlotIndex];
+        MaterialBase* sourceMaterial = entry.Material ? entry.Material.Get() : slot.Material.Get();
+        const ShadowsCastingMode shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
+        auto& lod = info.DrawCache->LODs[mesh->GetLODIndex()];
+        const int32 meshesCount = model->LODs[mesh->GetLODIndex()].Meshes.Count();
+        if (lod.Count() != meshesCount)
+        {
+            lod.Resize(meshesCount, false);
+            for (int32 i = 0; i < meshesCount; i++)
+                lod[i].IsValid = false;
+        }
+        MeshDrawCache::Entry& cached = lod[mesh->GetIndex()];
+
+        // Validate the cached draw call against the current instance entry and mesh geometry (eg. mesh reloaded or streamed)
+        if (cached.IsValid &&
+            cached.SourceMaterial == sourceMaterial &&
+            cached.Visible == entry.Visible &&
+            cached.ReceiveDecals == entry.ReceiveDecals &&
+            cached.ShadowsMode == shadowsMode &&
+            cached.DrawCall.Geometry.IndexBuffer == mesh->GetIndexBuffer())
+        {
+            return cached.DrawModes != DrawPass::None ? &cached : nullptr;
+        }
+        if (!mesh->IsInitialized())
+            return nullptr;
+        cached.IsValid = true;
+        cached.SourceMaterial = sourceMaterial;
+        cached.Visible = entry.Visible;
+        cached.ReceiveDecals = entry.ReceiveDecals;
+        cached.ShadowsMode = shadowsMode;
+        cached.DrawModes = DrawPass::None;
+        cached.DrawCall.Geometry.IndexBuffer = mesh->GetIndexBuffer();
+        if (!entry.Visible)
+            return nullptr;
+
+        // Select material (keep updating the cache until the source material gets loaded)
+        MaterialBase* material;
+        if (entry.Material && entry.Material->IsLoaded())
+            material = entry.Material;
+        else if (slot.Material && slot.Material->IsLoaded())
+            material = slot.Material;
+        else
+            material = GPUDevice::Instance->GetDefaultMaterial();
+        cached.IsValid = sourceMaterial == nullptr || sourceMaterial->IsLoaded();
+        if (!material || !material->IsSurface())
+            return nullptr;
+        cached.DrawModes = info.DrawModes & material->GetDrawModes();
+        if (cached.DrawModes == DrawPass::None)
+            return nullptr;
+
+        // Setup draw call
+        DrawCall& drawCall = cached.DrawCall;
+        drawCall.Geometry.VertexBuffers[0] = mesh->GetVertexBuffer(0);
+        drawCall.Geometry.VertexBuffers[1] = mesh->GetVertexBuffer(1);
+        drawCall.Geometry.VertexBuffers[2] = mesh->GetVertexBuffer(2);
+        drawCall.Geometry.VertexBuffersOffsets[0] = 0;
+        drawCall.Geometry.VertexBuffersOffsets[1] = 0;
+        drawCall.Geometry.VertexBuffersOffsets[2] = 0;
+        const int32 lodIndex = mesh->GetLODIndex();
+        if (info.VertexColors && info.VertexColors[lodIndex])
+        {
+            uint32 vertexOffset = 0;
+            for (int32 meshIndex = 0; meshIndex < mesh->GetIndex(); meshIndex++)
+                vertexOffset += model->LODs[lodIndex].Meshes[meshIndex].GetVertexCount();
+            drawCall.Geometry.VertexBuffers[2] = info.VertexColors[lodIndex];
+            drawCall.Geometry.VertexBuffersOffsets[2] = vertexOffset * sizeof(VB2ElementType);
+        }
+        drawCall.Draw.StartIndex = 0;
+        drawCall.Draw.IndicesCount = mesh->GetTriangleCount() * 3;
+        drawCall.InstanceCount = 1;
+        drawCall.Material = material;
+        drawCall.World = *info.World;
+        drawCall.ObjectPosition = drawCall.World.GetTranslation();
+        drawCall.Surface.GeometrySize = mesh->GetBox().GetSize();
+        drawCall.Surface.Skinning = nullptr;
+        drawCall.WorldDeterminantSign = Math::FloatSelect(drawCall.World.RotDeterminant(), 1, -1);
+        drawCall.PerInstanceRandom = info.PerInstanceRandom;
+        return &cached;
+    }
+
+    // Updates the per-frame data of the cached draw call.
+    FORCE_INLINE void UpdateCachedDrawCall(DrawCall& drawCall, const Mesh::DrawInfo& info, float lodDitherFactor)
+    {
+        drawCall.Surface.PrevWorld = info.DrawState->PrevWorld;
+        drawCall.Surface.Lightmap = (info.Flags & StaticFlags::Lightmap) != StaticFlags::None ? info.Lightmap : nullptr;
+        drawCall.Surface.LightmapUVsArea = info.LightmapUVs ? *info.LightmapUVs : Rectangle::Empty;
+        drawCall.Surface.LODDitherFactor = lodDitherFactor;
+    }
+}
+
 void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, const Matrix& world, StaticFlags flags, bool receiveDecals, DrawPass drawModes, float perInstanceRandom, int16 sortOrder) const
 {
     if (!material || !material->IsSurface() || !IsInitialized())
@@ -449,6 +570,28 @@ void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, cons
 
 void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float lodDitherFactor) const
 {
+    if (info.DrawCache)
+    {
+        // Submit the cached draw call
+        const MeshDrawCache::Entry* cached = GetCachedDrawCall(this, info);
+        if (!cached)
+            return;
+        const auto drawModes = cached->DrawModes & renderContext.View.Pass & renderContext.View.GetShadowsDrawPassMask(cached->ShadowsMode);
+        if (drawModes == DrawPass::None)
+            return;
+        DrawCall drawCall = cached->DrawCall;
+        UpdateCachedDrawCall(drawCall, info, lodDitherFactor);
+#if USE_EDITOR
+        const ViewMode viewMode = renderContext.View.Mode;
+        if (viewMode == ViewMode::LightmapUVsDensity || viewMode == ViewMode::LODPreview)
+            GBufferPass::AddIndexBufferToModelLOD(_indexBuffer, &((Model*)_model)->LODs[_lodIndex]);
+#endif
+        if (_meshletsCount != 0 && renderContext.List->MeshletCulling)
+            MeshletCullingPass::Instance()->SetupDrawCall(renderContext, this, drawCall);
+        renderContext.List->AddDrawCall(renderContext, drawModes, info.Flags, drawCall, cached->ReceiveDecals, info.SortOrder);
+        return;
+    }
+
     const auto& entry = info.Buffer->At(_materialSlotIndex);
     if (!entry.Visible || !IsInitialized())
         return;
@@ -509,12 +652,43 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
         GBufferPass::AddIndexBufferToModelLOD(_indexBuffer, &((Model*)_model)->LODs[_lodIndex]);
 #endif
 
+    // Cull meshlets on a GPU
+    if (_meshletsCount != 0 && renderContext.List->MeshletCulling)
+        MeshletCullingPass::Instance()->SetupDrawCall(renderContext, this, drawCall);
+
     // Push draw call to the render list
     renderContext.List->AddDrawCall(renderContext, drawModes, info.Flags, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
 
 void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& info, float lodDitherFactor) const
 {
+    if (info.DrawCache)
+    {
+        // Submit the cached draw call
+        const MeshDrawCache::Entry* cached = GetCachedDrawCall(this, info);
+        if (!cached)
+            return;
+        DrawCall drawCall = cached->DrawCall;
+        UpdateCachedDrawCall(drawCall, info, lodDitherFactor);
+        const RenderContext& mainRenderContext = renderContextBatch.GetMainContext();
+#if USE_EDITOR
+        const ViewMode viewMode = mainRenderContext.View.Mode;
+        if (viewMode == ViewMode::LightmapUVsDensity || viewMode == ViewMode::LODPreview)
+            GBufferPass::AddIndexBufferToModelLOD(_indexBuffer, &((Model*)_model)->LODs[_lodIndex]);
+#endif
+        if (_meshletsCount != 0 && mainRenderContext.List->MeshletCulling && mainRenderContext.View.CullingFrustum.Intersects(info.Bounds))
+        {
+            DrawCall mainDrawCall = drawCall;
+            MeshletCullingPass::Instance()->SetupDrawCall(mainRenderContext, this, mainDrawCall);
+            mainRenderContext.List->AddDrawCall(renderContextBatch, cached->DrawModes, info.Flags, cached->ShadowsMode, info.Bounds, drawCall, mainDrawCall, cached->ReceiveDecals, info.SortOrder);
+        }
+        else
+        {
+            mainRenderContext.List->AddDrawCall(renderContextBatch, cached->DrawModes, info.Flags, cached->ShadowsMode, info.Bounds, drawCall, cached->ReceiveDecals, info.SortOrder);
+        }
+        return;
+    }
+
     const auto& entry = info.Buffer->At(_materialSlotIndex);
     if (!entry.Visible || !IsInitialized())
         return;
@@ -572,8 +746,20 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
     // Push draw call to the render lists
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
     const auto drawModes = info.DrawModes & material->GetDrawModes();
-    if (drawModes != DrawPass::None)
-        renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, info.Flags, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
+    if (drawModes == DrawPass::None)
+        return;
+    const RenderContext& mainRenderContext = renderContextBatch.GetMainContext();
+    if (_meshletsCount != 0 && mainRenderContext.List->MeshletCulling && mainRenderContext.View.CullingFrustum.Intersects(info.Bounds))
+    {
+        // Cull meshlets on a GPU for the main view only (shadow projections draw the whole mesh)
+        DrawCall mainDrawCall = drawCall;
+        MeshletCullingPass::Instance()->SetupDrawCall(mainRenderContext, this, mainDrawCall);
+        mainRenderContext.List->AddDrawCall(renderContextBatch, drawModes, info.Flags, shadowsMode, info.Bounds, drawCall, mainDrawCall, entry.ReceiveDecals, info.SortOrder);
+    }
+    else
+    {
+        mainRenderContext.List->AddDrawCall(renderContextBatch, drawModes, info.Flags, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
+    }
 }
 
 bool Mesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
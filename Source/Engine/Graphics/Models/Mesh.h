@@ -22,6 +22,8 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     bool _hasLightmapUVs;
     GPUBuffer* _vertexBuffers[3] = {};
     GPUBuffer* _indexBuffer = nullptr;
+    GPUBuffer* _meshletsBuffer = nullptr;
+    int32 _meshletsCount = 0;
 #if USE_PRECISE_MESH_INTERSECTS
     CollisionProxy _collisionProxy;
 #endif
@@ -70,6 +72,22 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
         return _vertexBuffers[index];
     }
 
+    /// <summary>
+    /// Gets the meshlets buffer (structured buffer with MeshletData elements used by the GPU meshlets culling). Null if mesh has no meshlets.
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetMeshletsBuffer() const
+    {
+        return _meshletsBuffer;
+    }
+
+    /// <summary>
+    /// Gets the amount of meshlets (clusters of triangles in the index buffer) used by the GPU meshlets culling.
+    /// </summary>
+    FORCE_INLINE int32 GetMeshletsCount() const
+    {
+        return _meshletsCount;
+    }
+
     /// <summary>
     /// Determines whether this mesh is initialized (has vertex and index buffers initialized).
     /// </summary>
@@ -234,8 +252,10 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     /// <param name="vb2">Vertex buffer 2 data (may be null if not used)</param>
     /// <param name="ib">Index buffer data</param>
     /// <param name="use16BitIndexBuffer">True if use 16 bit indices for the index buffer (true: uint16, false: uint32).</param>
+    /// <param name="meshlets">The meshlets data (may be null if not used). Meshlets ranges must cover the whole index buffer.</param>
+    /// <param name="meshletsCount">The amount of meshlets.</param>
     /// <returns>True if cannot load data, otherwise false.</returns>
-    bool Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* vb2, void* ib, bool use16BitIndexBuffer);
+    bool Load(uint32 vertices, uint32 triangles, void* vb0, void* vb1, void* vb2, void* ib, bool use16BitIndexBuffer, const MeshletData* meshlets = nullptr, int32 meshletsCount = 0);
 
     /// <summary>
     /// Unloads the mesh data (vertex buffers and cache). The opposite to Load.
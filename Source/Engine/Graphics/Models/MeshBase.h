@@ -19,6 +19,7 @@ class Lightmap;
 class GPUBuffer;
 class SkinnedMeshDrawData;
 class BlendShapesInstance;
+struct MeshDrawCache;
 
 /// <summary>
 /// Base class for model resources meshes.
@@ -241,5 +242,10 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MeshBase : public ScriptingObj
         /// The object sorting key.
         /// </summary>
         int16 SortOrder;
+
+        /// <summary>
+        /// The persistent draw calls cache to use instead of setting up the draw calls every frame (optional, static models only).
+        /// </summary>
+        MeshDrawCache* DrawCache = nullptr;
     };
 };
@@ -0,0 +1,108 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Graphics/Enums.h"
+#include "Engine/Level/Types.h"
+#include "Engine/Renderer/DrawCall.h"
+#include "Config.h"
+
+class MaterialBase;
+
+/// <summary>
+/// The persistent cache of the model meshes draw calls used by the static objects to skip setting up the draw calls every frame for every view (see Graphics::EnableCachedDrawCalls).
+/// </summary>
+/// <remarks>
+/// The cached draw calls are validated against the mesh geometry, materials and instance entries during drawing. The owner needs to invalidate the cache when the object transformation, vertex colors or model changes.
+/// </remarks>
+struct FLAXENGINE_API MeshDrawCache
+{
+    /// <summary>
+    /// The cached mesh draw call.
+    /// </summary>
+    struct Entry
+    {
+        /// <summary>
+        /// The draw call to submit (per-frame data such as previous world matrix, lightmap or LOD dither factor is updated before drawing).
+        /// </summary>
+        DrawCall DrawCall;
+
+        /// <summary>
+        /// The source material used to create the draw call (instance entry or the model slot material). Used to detect material changes.
+        /// </summary>
+        MaterialBase* SourceMaterial;
+
+        /// <summary>
+        /// The draw passes (combined from the object draw modes and the material draw modes). None if mesh is not drawn.
+        /// </summary>
+        DrawPass DrawModes;
+
+        /// <summary>
+        /// The shadows casting mode (combined from the instance entry and the model slot).
+        /// </summary>
+        ShadowsCastingMode ShadowsMode;
+
+        /// <summary>
+        /// True if the entry is valid, otherwise needs to be setup.
+        /// </summary>
+        bool IsValid;
+
+        /// <summary>
+        /// The instance entry visibility used to create the draw call.
+        /// </summary>
+        bool Visible;
+
+        /// <summary>
+        /// The instance entry decals receiving flag used to create the draw call.
+        /// </summary>
+        bool ReceiveDecals;
+    };
+
+    /// <summary>
+    /// The cached draw calls for each model LOD (indexed by the mesh index).
+    /// </summary>
+    Array<Entry> LODs[MODEL_MAX_LODS];
+
+    /// <summary>
+    /// The rendering origin used to create the world matrices of the cached draw calls.
+    /// </summary>
+    Vector3 Origin = Vector3::Zero;
+
+    /// <summary>
+    /// The object draw modes used to create the cached draw calls.
+    /// </summary>
+    DrawPass DrawModes = DrawPass::None;
+
+    /// <summary>
+    /// The object static flags used to create the cached draw calls.
+    /// </summary>
+    StaticFlags Flags = StaticFlags::None;
+
+public:
+    /// <summary>
+    /// Invalidates the cached draw calls.
+    /// </summary>
+    void Invalidate()
+    {
+        for (int32 lodIndex = 0; lodIndex < MODEL_MAX_LODS; lodIndex++)
+            LODs[lodIndex].Clear();
+    }
+
+    /// <summary>
+    /// Checks if the cache matches the current drawing state and invalidates it if not.
+    /// </summary>
+    /// <param name="origin">The rendering origin.</param>
+    /// <param name="drawModes">The object draw modes.</param>
+    /// <param name="flags">The object static flags.</param>
+    void Validate(const Vector3& origin, DrawPass drawModes, StaticFlags flags)
+    {
+        if (Origin != origin || DrawModes != drawModes || Flags != flags)
+        {
+            Invalidate();
+            Origin = origin;
+            DrawModes = drawModes;
+            Flags = flags;
+        }
+    }
+};
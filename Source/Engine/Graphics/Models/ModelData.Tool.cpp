@@ -76,7 +76,7 @@ void RemapArrayHelper(Array<T>& target, const std::vector<uint32_t>& remap)
     }
 }
 
-bool MeshData::GenerateLightmapUVs()
+bool MeshData::GenerateLightmapUVs(ModelLightmapUVsQuality quality)
 {
 #if PLATFORM_WINDOWS
     // Prepare
@@ -108,13 +108,27 @@ bool MeshData::GenerateLightmapUVs()
     std::vector<uint32_t> vertexRemapArray;
     int32 size = 1024;
     float gutter = 1.0f;
+    float maxStretch = 0.1f;
+    DWORD options = DirectX::UVATLAS_GEODESIC_FAST;
+    switch (quality)
+    {
+    case ModelLightmapUVsQuality::Fast:
+        size = 512;
+        maxStretch = 0.3f;
+        break;
+    case ModelLightmapUVsQuality::High:
+        options = DirectX::UVATLAS_GEODESIC_QUALITY;
+        break;
+    default:
+        break;
+    }
     hr = UVAtlasCreate(
         positions, verticesCount,
         Indices.Get(), DXGI_FORMAT_R32_UINT, facesCount,
-        0, 0.1f, size, size, gutter,
+        0, maxStretch, size, size, gutter,
         adjacency.Get(), nullptr, nullptr,
         UVAtlasCallback, DirectX::UVATLAS_DEFAULT_CALLBACK_FREQUENCY,
-        DirectX::UVATLAS_GEODESIC_FAST, vb, ib,
+        options, vb, ib,
         &facePartitioning,
         &vertexRemapArray,
         &outStretch, &outCharts);
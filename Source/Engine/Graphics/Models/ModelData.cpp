@@ -23,6 +23,7 @@ void MeshData::Clear()
     BlendIndices.Clear();
     BlendWeights.Clear();
     BlendShapes.Clear();
+    Meshlets.Clear();
 }
 
 void MeshData::EnsureCapacity(int32 vertices, int32 indices, bool preserveContents, bool withColors, bool withSkin)
@@ -51,6 +52,7 @@ void MeshData::SwapBuffers(MeshData& other)
     BlendIndices.Swap(other.BlendIndices);
     BlendWeights.Swap(other.BlendWeights);
     BlendShapes.Swap(other.BlendShapes);
+    Meshlets.Swap(other.Meshlets);
 }
 
 void MeshData::Release()
@@ -67,6 +69,7 @@ void MeshData::Release()
     BlendIndices.Resize(0);
     BlendWeights.Resize(0);
     BlendShapes.Resize(0);
+    Meshlets.Resize(0);
 }
 
 void MeshData::InitFromModelVertices(ModelVertex19* vertices, uint32 verticesCount)
@@ -610,6 +613,21 @@ void MeshData::Merge(MeshData& other)
             blendShape->Vertices[i].VertexIndex += vertexIndexOffset;
         }
     }
+
+    // Merge meshlets (valid only if both meshes have them)
+    if (Meshlets.HasItems() && other.Meshlets.HasItems())
+    {
+        const int32 meshletsStart = Meshlets.Count();
+        Meshlets.Add(other.Meshlets);
+        for (int32 i = meshletsStart; i < Meshlets.Count(); i++)
+        {
+            Meshlets[i].FirstIndex += indicesStart;
+        }
+    }
+    else
+    {
+        Meshlets.Clear();
+    }
 }
 
 bool MaterialSlotEntry::UsesProperties() const
@@ -643,6 +661,17 @@ void ModelData::CalculateLODsScreenSizes()
     const float autoComputeLodPowerBase = 0.5f;
     const int32 lodCount = LODs.Count();
 
+    // The max size (in pixels) of the LOD geometric error projected on the reference screen height at the LOD transition
+    const float maxScreenError = 1.0f;
+    const float referenceScreenHeight = 1080.0f;
+    float radius = 0.0f;
+    if (lodCount != 0)
+    {
+        BoundingSphere sphere;
+        BoundingSphere::FromBox(LODs[0].GetBox(), sphere);
+        radius = (float)sphere.Radius;
+    }
+
     for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
     {
         auto& lod = LODs[lodIndex];
@@ -651,9 +680,15 @@ void ModelData::CalculateLODsScreenSizes()
         {
             lod.ScreenSize = 1.0f;
         }
+        else if (lod.GeometricError > ZeroTolerance && radius > ZeroTolerance)
+        {
+            // Screen size is the bounds diameter in the half of the screen height units so switch to the LOD when its error gets small enough in pixels
+            lod.ScreenSize = 4.0f * maxScreenError * radius / (lod.GeometricError * referenceScreenHeight);
+            lod.ScreenSize = Math::Clamp(lod.ScreenSize, 0.01f, LODs[lodIndex - 1].ScreenSize);
+        }
         else
         {
-            lod.ScreenSize = Math::Pow(autoComputeLodPowerBase, (float)lodIndex);
+            lod.ScreenSize = Math::Min(Math::Pow(autoComputeLodPowerBase, (float)lodIndex), LODs[lodIndex - 1].ScreenSize);
         }
     }
 
@@ -898,23 +933,40 @@ bool ModelData::Pack2AnimationHeader(WriteStream* stream) const
     }
 
     // Info
-    stream->WriteInt32(100); // Header version (for fast version upgrades without serialization format change)
+    stream->WriteInt32(103); // Header version (for fast version upgrades without serialization format change)
     stream->WriteDouble(Animation.Duration);
     stream->WriteDouble(Animation.FramesPerSecond);
     stream->WriteBool(Animation.EnableRootMotion);
     stream->WriteString(Animation.RootNodeName, 13);
 
-    // Animation channels
+    // Animation channels (curves are skipped if animation is compressed)
+    const bool compressed = Animation.Compressed.IsValid();
     stream->WriteInt32(Animation.Channels.Count());
     for (int32 i = 0; i < Animation.Channels.Count(); i++)
     {
         auto& anim = Animation.Channels[i];
 
         stream->WriteString(anim.NodeName, 172);
+        if (compressed)
+        {
+            stream->WriteInt32(0);
+            stream->WriteInt32(0);
+            stream->WriteInt32(0);
+            continue;
+        }
         Serialization::Serialize(*stream, anim.Position);
         Serialization::Serialize(*stream, anim.Rotation);
         Serialization::Serialize(*stream, anim.Scale);
     }
 
+    // Compressed animation
+    stream->WriteBool(compressed);
+    if (compressed)
+        Animation.Compressed.Serialize(*stream);
+
+    // Animation events and nested animations (none)
+    stream->WriteInt32(0);
+    stream->WriteInt32(0);
+
     return false;
 }
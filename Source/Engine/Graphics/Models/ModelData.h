@@ -90,6 +90,11 @@ class FLAXENGINE_API MeshData
     /// </summary>
     Array<BlendShape> BlendShapes;
 
+    /// <summary>
+    /// Meshlets (clusters of the mesh triangles) used by the GPU meshlets culling. Each meshlet covers the contiguous range of the Indices buffer. Empty if not used.
+    /// </summary>
+    Array<MeshletData> Meshlets;
+
 public:
     /// <summary>
     /// Determines whether this instance has any mesh data.
@@ -213,8 +218,9 @@ class FLAXENGINE_API MeshData
     /// <summary>
     /// Generate lightmap uvs for the mesh entry
     /// </summary>
+    /// <param name="quality">The charting quality (trades the generation speed for the lower UVs stretching).</param>
     /// <returns>True if generating lightmap uvs failed, otherwise false</returns>
-    bool GenerateLightmapUVs();
+    bool GenerateLightmapUVs(ModelLightmapUVsQuality quality = ModelLightmapUVsQuality::Normal);
 
     /// <summary>
     /// Iterates over the vertex buffers to remove the duplicated vertices and generate the optimized index buffer.
@@ -362,6 +368,11 @@ class FLAXENGINE_API ModelLodData
     /// </summary>
     float ScreenSize = 1.0f;
 
+    /// <summary>
+    /// The geometric error of the LOD surface (the max deviation from the base LOD, in model units). Used to calculate the LOD screen size. Negative if unknown (eg. LOD authored in the source file).
+    /// </summary>
+    float GeometricError = -1.0f;
+
     /// <summary>
     /// The meshes array.
     /// </summary>
@@ -454,7 +465,7 @@ class FLAXENGINE_API ModelData
 
 public:
     /// <summary>
-    /// Automatically calculates the screen size for every model LOD for a proper transitions.
+    /// Automatically calculates the screen size for every model LOD for a proper transitions. Uses the LODs geometric error if known, otherwise LODs are switched at the fixed screen size steps.
     /// </summary>
     void CalculateLODsScreenSizes();
 
@@ -6,8 +6,21 @@
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 
-bool ModelLOD::Load(MemoryReadStream& stream)
+bool ModelLOD::Load(MemoryReadStream& stream, MemoryReadStream* meshletsStream)
 {
+    // Validate meshlets data (ignored if invalid)
+    if (meshletsStream)
+    {
+        int32 version, meshesCount;
+        meshletsStream->ReadInt32(&version);
+        meshletsStream->ReadInt32(&meshesCount);
+        if (version != 1 || meshesCount != Meshes.Count())
+        {
+            LOG(Warning, "Invalid meshlets data.");
+            meshletsStream = nullptr;
+        }
+    }
+
     // Load LOD for each mesh
     _verticesCount = 0;
     for (int32 i = 0; i < Meshes.Count(); i++)
@@ -32,9 +45,16 @@ bool ModelLOD::Load(MemoryReadStream& stream)
             vb2 = stream.Move<VB2ElementType18>(vertices);
         }
         auto ib = stream.Move<byte>(indicesCount * ibStride);
+        int32 meshletsCount = 0;
+        const MeshletData* meshlets = nullptr;
+        if (meshletsStream)
+        {
+            meshletsStream->ReadInt32(&meshletsCount);
+            meshlets = meshletsStream->Move<MeshletData>((uint32)meshletsCount);
+        }
 
         // Setup GPU resources
-        if (Meshes[i].Load(vertices, triangles, vb0, vb1, vb2, ib, use16BitIndexBuffer))
+        if (Meshes[i].Load(vertices, triangles, vb0, vb1, vb2, ib, use16BitIndexBuffer, meshlets, meshletsCount))
         {
             LOG(Warning, "Cannot initialize mesh {0}. Vertices: {1}, triangles: {2}", i, vertices, triangles);
             return true;
@@ -62,8 +62,9 @@ API_CLASS(NoSpawn) class FLAXENGINE_API ModelLOD : public ScriptingObject
     /// Initializes the LOD from the data stream.
     /// </summary>
     /// <param name="stream">The stream.</param>
+    /// <param name="meshletsStream">The optional stream with the meshes meshlets data (null if not used).</param>
     /// <returns>True if fails, otherwise false.</returns>
-    bool Load(MemoryReadStream& stream);
+    bool Load(MemoryReadStream& stream, MemoryReadStream* meshletsStream = nullptr);
 
     /// <summary>
     /// Unloads the LOD meshes data (vertex buffers and cache). It won't dispose the meshes collection. The opposite to Load.
@@ -7,9 +7,11 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/ComputeSkinningPass.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
@@ -31,6 +33,7 @@ void SkinnedMesh::Init(SkinnedModel* model, int32 lodIndex, int32 index, int32 m
     _indexBuffer = nullptr;
     _cachedIndexBuffer.Clear();
     _cachedVertexBuffer.Clear();
+    SAFE_DELETE_GPU_RESOURCE(_blendShapesBuffer);
     BlendShapes.Clear();
 }
 
@@ -38,6 +41,7 @@ SkinnedMesh::~SkinnedMesh()
 {
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffer);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_blendShapesBuffer);
 }
 
 bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* ib, bool use16BitIndexBuffer)
@@ -55,8 +59,14 @@ bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, void* vb0, void* ib, b
 #else
 	vertexBuffer = GPUDevice::Instance->CreateBuffer(String::Empty);
 #endif
-    if (vertexBuffer->Init(GPUBufferDescription::Vertex(sizeof(VB0SkinnedElementType), vertices, vb0)))
-        goto ERROR_LOAD_END;
+    {
+        // Vertex buffer can be read by the compute skinning (as a raw buffer)
+        auto vbFlags = GPUBufferFlags::VertexBuffer;
+        if (GPUDevice::Instance->Limits.HasCompute)
+            vbFlags |= GPUBufferFlags::ShaderResource | GPUBufferFlags::RawBuffer;
+        if (vertexBuffer->Init(GPUBufferDescription::Buffer(vertices * sizeof(VB0SkinnedElementType), vbFlags, PixelFormat::R32_Typeless, vb0, sizeof(VB0SkinnedElementType))))
+            goto ERROR_LOAD_END;
+    }
 
     // Create index buffer
 #if GPU_ENABLE_RESOURCE_NAMING
@@ -87,6 +97,7 @@ void SkinnedMesh::Unload()
 {
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffer);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_blendShapesBuffer);
     _cachedIndexBuffer.Clear();
     _cachedVertexBuffer.Clear();
     _triangles = 0;
@@ -94,6 +105,32 @@ void SkinnedMesh::Unload()
     _use16BitIndexBuffer = false;
 }
 
+GPUBuffer* SkinnedMesh::GetBlendShapesBuffer() const
+{
+    if (!_blendShapesBuffer && BlendShapes.HasItems())
+    {
+        PROFILE_CPU();
+        int32 verticesCount = 0;
+        for (const BlendShape& blendShape : BlendShapes)
+            verticesCount += blendShape.Vertices.Count();
+        Array<BlendShapeVertex> vertices;
+        vertices.EnsureCapacity(verticesCount);
+        for (const BlendShape& blendShape : BlendShapes)
+            vertices.Add(blendShape.Vertices);
+#if GPU_ENABLE_RESOURCE_NAMING
+        _blendShapesBuffer = GPUDevice::Instance->CreateBuffer(GetSkinnedModel()->GetPath() + TEXT(".BlendShapes"));
+#else
+        _blendShapesBuffer = GPUDevice::Instance->CreateBuffer(String::Empty);
+#endif
+        if (_blendShapesBuffer->Init(GPUBufferDescription::Raw(vertices.Get(), vertices.Count() * sizeof(BlendShapeVertex), GPUBufferFlags::ShaderResource)))
+        {
+            LOG(Warning, "Failed to create blend shapes buffer.");
+            SAFE_DELETE_GPU_RESOURCE(_blendShapesBuffer);
+        }
+    }
+    return _blendShapesBuffer;
+}
+
 bool SkinnedMesh::UpdateMesh(uint32 vertexCount, uint32 triangleCount, VB0SkinnedElementType* vb, void* ib, bool use16BitIndices)
 {
     auto model = (SkinnedModel*)_model;
@@ -160,6 +197,8 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
         material = slot.Material;
     else
         material = GPUDevice::Instance->GetDefaultMaterial();
+    if (material && !material->CanUseSkinning())
+        material = GPUDevice::Instance->GetDefaultMaterial(); // Skinning permutations were skipped when cooking material used only with static meshes
     if (!material || !material->IsSurface())
         return;
 
@@ -170,22 +209,24 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
         return;
 
     // Setup draw call
+    const bool useComputeSkinning = renderContext.List->ComputeSkinning && info.Skinning && !EnumHasAnyFlags(material->GetInfo().UsageFlags, MaterialUsageFlags::UseVertexColor) && _vertexBuffer->IsShaderResource();
     DrawCall drawCall;
     drawCall.Geometry.IndexBuffer = _indexBuffer;
+    drawCall.Geometry.VertexBuffers[0] = _vertexBuffer;
+    BlendShapesInstance* blendShapes = nullptr;
     BlendShapesInstance::MeshInstance* blendShapeMeshInstance;
     if (info.BlendShapes && info.BlendShapes->Meshes.TryGet(this, blendShapeMeshInstance) && blendShapeMeshInstance->IsUsed)
     {
-        // Use modified vertex buffer from the blend shapes
-        if (blendShapeMeshInstance->IsDirty)
+        if (useComputeSkinning)
         {
-            blendShapeMeshInstance->VertexBuffer.Flush();
-            blendShapeMeshInstance->IsDirty = false;
+            // Blend shapes are applied on a GPU within the compute skinning
+            blendShapes = info.BlendShapes;
+        }
+        else if (!blendShapeMeshInstance->UpdateVertexBuffer(this))
+        {
+            // Use modified vertex buffer from the blend shapes
+            drawCall.Geometry.VertexBuffers[0] = blendShapeMeshInstance->VertexBuffer.GetBuffer();
         }
-        drawCall.Geometry.VertexBuffers[0] = blendShapeMeshInstance->VertexBuffer.GetBuffer();
-    }
-    else
-    {
-        drawCall.Geometry.VertexBuffers[0] = _vertexBuffer;
     }
     drawCall.Geometry.VertexBuffers[1] = nullptr;
     drawCall.Geometry.VertexBuffers[2] = nullptr;
@@ -206,6 +247,8 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
     drawCall.Surface.LODDitherFactor = lodDitherFactor;
     drawCall.WorldDeterminantSign = Math::FloatSelect(drawCall.World.RotDeterminant(), 1, -1);
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
+    if (useComputeSkinning)
+        ComputeSkinningPass::Instance()->SetupDrawCall(renderContext, this, info.Skinning, drawCall, blendShapes);
 
     // Push draw call to the render list
     renderContext.List->AddDrawCall(renderContext, drawModes, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
@@ -226,26 +269,30 @@ void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawI
         material = slot.Material;
     else
         material = GPUDevice::Instance->GetDefaultMaterial();
+    if (material && !material->CanUseSkinning())
+        material = GPUDevice::Instance->GetDefaultMaterial(); // Skinning permutations were skipped when cooking material used only with static meshes
     if (!material || !material->IsSurface())
         return;
 
     // Setup draw call
+    const bool useComputeSkinning = renderContextBatch.GetMainContext().List->ComputeSkinning && info.Skinning && !EnumHasAnyFlags(material->GetInfo().UsageFlags, MaterialUsageFlags::UseVertexColor) && _vertexBuffer->IsShaderResource();
     DrawCall drawCall;
     drawCall.Geometry.IndexBuffer = _indexBuffer;
+    drawCall.Geometry.VertexBuffers[0] = _vertexBuffer;
+    BlendShapesInstance* blendShapes = nullptr;
     BlendShapesInstance::MeshInstance* blendShapeMeshInstance;
     if (info.BlendShapes && info.BlendShapes->Meshes.TryGet(this, blendShapeMeshInstance) && blendShapeMeshInstance->IsUsed)
     {
-        // Use modified vertex buffer from the blend shapes
-        if (blendShapeMeshInstance->IsDirty)
+        if (useComputeSkinning)
         {
-            blendShapeMeshInstance->VertexBuffer.Flush();
-            blendShapeMeshInstance->IsDirty = false;
+            // Blend shapes are applied on a GPU within the compute skinning
+            blendShapes = info.BlendShapes;
+        }
+        else if (!blendShapeMeshInstance->UpdateVertexBuffer(this))
+        {
+            // Use modified vertex buffer from the blend shapes
+            drawCall.Geometry.VertexBuffers[0] = blendShapeMeshInstance->VertexBuffer.GetBuffer();
         }
-        drawCall.Geometry.VertexBuffers[0] = blendShapeMeshInstance->VertexBuffer.GetBuffer();
-    }
-    else
-    {
-        drawCall.Geometry.VertexBuffers[0] = _vertexBuffer;
     }
     drawCall.Geometry.VertexBuffers[1] = nullptr;
     drawCall.Geometry.VertexBuffers[2] = nullptr;
@@ -266,12 +313,15 @@ void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawI
     drawCall.Surface.LODDitherFactor = lodDitherFactor;
     drawCall.WorldDeterminantSign = Math::FloatSelect(drawCall.World.RotDeterminant(), 1, -1);
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
+    const RenderContext& mainContext = renderContextBatch.GetMainContext();
+    if (useComputeSkinning)
+        ComputeSkinningPass::Instance()->SetupDrawCall(mainContext, this, info.Skinning, drawCall, blendShapes);
 
     // Push draw call to the render lists
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
     const auto drawModes = info.DrawModes & material->GetDrawModes();
     if (drawModes != DrawPass::None)
-        renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, StaticFlags::None, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
+        mainContext.List->AddDrawCall(renderContextBatch, drawModes, StaticFlags::None, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
 
 bool SkinnedMesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
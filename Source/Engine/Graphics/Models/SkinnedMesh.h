@@ -18,6 +18,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedMesh : public MeshBase
     mutable Array<byte> _cachedIndexBuffer;
     mutable Array<byte> _cachedVertexBuffer;
     mutable int32 _cachedIndexBufferCount;
+    mutable GPUBuffer* _blendShapesBuffer = nullptr;
 
 public:
     SkinnedMesh(const SkinnedMesh& other)
@@ -55,6 +56,12 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedMesh : public MeshBase
     /// </summary>
     Array<BlendShape> BlendShapes;
 
+    /// <summary>
+    /// Gets the GPU buffer with the vertices of all blend shapes (BlendShapeVertex, blend shapes stored one after another) used to apply blend shapes within the compute skinning. Created on the first use. Not thread-safe.
+    /// </summary>
+    /// <returns>The buffer or null if mesh has no blend shapes or failed to create it.</returns>
+    GPUBuffer* GetBlendShapesBuffer() const;
+
 public:
     /// <summary>
     /// Initializes a new instance of the <see cref="SkinnedMesh"/> class.
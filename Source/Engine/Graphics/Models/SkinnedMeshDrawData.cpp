@@ -15,6 +15,7 @@ SkinnedMeshDrawData::~SkinnedMeshDrawData()
 {
     SAFE_DELETE_GPU_RESOURCE(BoneMatrices);
     SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
+    ReleaseSkinnedMeshes();
 }
 
 void SkinnedMeshDrawData::Setup(int32 bonesCount)
@@ -36,6 +37,7 @@ void SkinnedMeshDrawData::Setup(int32 bonesCount)
     _isDirty = false;
     Data.Resize(BoneMatrices->GetSize());
     SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
+    ReleaseSkinnedMeshes();
 }
 
 void SkinnedMeshDrawData::SetData(const Matrix* bones, bool dropHistory)
@@ -85,3 +87,14 @@ void SkinnedMeshDrawData::OnDataChanged(bool dropHistory)
     _isDirty = true;
     _hasValidData = true;
 }
+
+void SkinnedMeshDrawData::ReleaseSkinnedMeshes()
+{
+    for (auto& e : SkinnedMeshes)
+    {
+        SAFE_DELETE_GPU_RESOURCE(e.Value->Positions);
+        SAFE_DELETE_GPU_RESOURCE(e.Value->Attributes);
+        Delete(e.Value);
+    }
+    SkinnedMeshes.Clear();
+}
@@ -3,8 +3,24 @@
 #pragma once
 
 #include "Engine/Core/Common.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Graphics/GPUBuffer.h"
 
+class SkinnedMesh;
+
+/// <summary>
+/// The mesh vertices skinned on a GPU with a compute shader (see ComputeSkinningPass).
+/// </summary>
+struct SkinnedMeshVertices
+{
+    // The skinned vertices positions (float3) followed by the positions skinned with the previous frame bones (used by the motion vectors).
+    GPUBuffer* Positions = nullptr;
+    // The skinned vertices attributes (texcoord, normal, tangent and lightmap texcoord). Matches the layout of the static meshes second vertex buffer.
+    GPUBuffer* Attributes = nullptr;
+    // The last frame (Engine::FrameCount) when the vertices were skinned.
+    uint64 LastFrame = 0;
+};
+
 /// <summary>
 /// Data storage for the skinned meshes rendering
 /// </summary>
@@ -35,6 +51,11 @@ class FLAXENGINE_API SkinnedMeshDrawData
     /// </summary>
     Array<byte> Data;
 
+    /// <summary>
+    /// The meshes vertices skinned on a GPU with a compute shader. Allocated on the first use by ComputeSkinningPass.
+    /// </summary>
+    Dictionary<const SkinnedMesh*, SkinnedMeshVertices*> SkinnedMeshes;
+
 public:
     /// <summary>
     /// Initializes a new instance of the <see cref="SkinnedMeshDrawData"/> class.
@@ -82,6 +103,11 @@ class FLAXENGINE_API SkinnedMeshDrawData
     /// <param name="dropHistory">True if drop previous update bones used for motion blur, otherwise will keep them and do the update.</param>
     void OnDataChanged(bool dropHistory);
 
+    /// <summary>
+    /// Releases the meshes vertices skinned on a GPU.
+    /// </summary>
+    void ReleaseSkinnedMeshes();
+
     /// <summary>
     /// After bones Data has been send to the GPU buffer.
     /// </summary>
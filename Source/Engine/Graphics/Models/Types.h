@@ -38,6 +38,19 @@ API_ENUM(Attributes="HideInEditor") enum class ModelLightmapUVsSource
     Channel3,
 };
 
+/// <summary>
+/// The generated lightmap UVs quality. Lower quality uses faster charting with more stretching allowed.
+/// </summary>
+API_ENUM(Attributes="HideInEditor") enum class ModelLightmapUVsQuality
+{
+    // Fast geodesic charting with higher stretching allowed and a smaller packing resolution. Use it for large scenes or quick iteration.
+    Fast = 0,
+    // Fast geodesic charting with low stretching.
+    Normal,
+    // High quality geodesic charting with low stretching. Slowest.
+    High,
+};
+
 /// <summary>
 /// The mesh buffer types.
 /// </summary>
@@ -189,3 +202,20 @@ PACK_STRUCT(struct VB0SkinnedElementType2
 
 typedef VB0SkinnedElementType2 VB0SkinnedElementType;
 //
+
+// Meshlet (cluster of the mesh triangles) data used by the GPU meshlets culling (must match the shader data)
+PACK_STRUCT(struct MeshletData
+    {
+    // The local-space bounding sphere center.
+    Float3 Center;
+    // The local-space bounding sphere radius.
+    float Radius;
+    // The normal cone axis (average direction of the triangles normals).
+    Float3 ConeAxis;
+    // The normal cone cutoff (cosine of the half of the cone angle). Value of 1 disables the backface culling of the meshlet.
+    float ConeCutoff;
+    // The index of the first meshlet index in the mesh index buffer (meshlet triangles are stored contiguously).
+    uint32 FirstIndex;
+    // The meshlet triangles count.
+    uint32 TrianglesCount;
+    });
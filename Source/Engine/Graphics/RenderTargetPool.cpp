@@ -2,6 +2,8 @@
 
 #include "RenderTargetPool.h"
 #include "GPUDevice.h"
+#include "GPUContext.h"
+#include "GPULimits.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/Engine.h"
 
@@ -12,11 +14,38 @@ struct Entry
     uint64 LastFrameTaken;
     uint64 LastFrameReleased;
     uint32 DescriptionHash;
+    int32 Page;
+    uint64 Offset;
+    uint64 Size;
 };
 
+struct Page
+{
+    void* Memory;
+    uint64 Size;
+};
+
+// The minimum size of the memory page for the transient render targets (in bytes)
+#define TRANSIENT_PAGE_SIZE (32ull * 1024 * 1024)
+
 namespace
 {
     Array<Entry> TemporaryRTs(64);
+    Array<Page> TransientPages;
+
+    bool IsRangeOccupied(int32 page, uint64 offset, uint64 size, uint64* end = nullptr)
+    {
+        for (const Entry& e : TemporaryRTs)
+        {
+            if (e.IsOccupied && e.Page == page && offset < e.Offset + e.Size && e.Offset < offset + size)
+            {
+                if (end)
+                    *end = e.Offset + e.Size;
+                return true;
+            }
+        }
+        return false;
+    }
 }
 
 void RenderTargetPool::Flush(bool force)
@@ -40,6 +69,25 @@ void RenderTargetPool::Flush(bool force)
                 break;
         }
     }
+
+    // Release unused transient memory pages
+    for (int32 pageIndex = TransientPages.Count() - 1; pageIndex >= 0; pageIndex--)
+    {
+        auto& page = TransientPages[pageIndex];
+        if (!page.Memory)
+            continue;
+        bool isUsed = false;
+        for (const Entry& e : TemporaryRTs)
+            isUsed |= e.Page == pageIndex;
+        if (!isUsed)
+        {
+            GPUDevice::Instance->ReleaseAliasingMemory(page.Memory);
+            page.Memory = nullptr;
+            page.Size = 0;
+        }
+    }
+    while (TransientPages.HasItems() && !TransientPages.Last().Memory)
+        TransientPages.RemoveLast();
 }
 
 GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
@@ -50,7 +98,7 @@ GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
     {
         auto& tmp = TemporaryRTs[i];
 
-        if (!tmp.IsOccupied && tmp.DescriptionHash == descHash)
+        if (!tmp.IsOccupied && tmp.Page == -1 && tmp.DescriptionHash == descHash)
         {
             ASSERT(tmp.RT);
 
@@ -86,11 +134,105 @@ GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
     entry.LastFrameTaken = Engine::FrameCount;
     entry.RT = newRenderTarget;
     entry.DescriptionHash = descHash;
+    entry.Page = -1;
+    entry.Offset = 0;
+    entry.Size = 0;
     TemporaryRTs.Add(entry);
 
     return newRenderTarget;
 }
 
+GPUTexture* RenderTargetPool::GetTransient(GPUContext* context, const GPUTextureDescription& desc)
+{
+    const auto device = GPUDevice::Instance;
+    uint64 size, alignment;
+    if (!device->Limits.HasResourceAliasing || device->GetAliasedTextureSize(desc, size, alignment))
+        return Get(desc);
+
+    // Find free transient render target with the same properties that memory is not used by other render targets
+    const uint32 descHash = GetHash(desc);
+    Entry* result = nullptr;
+    for (int32 i = 0; i < TemporaryRTs.Count(); i++)
+    {
+        auto& tmp = TemporaryRTs[i];
+        if (!tmp.IsOccupied && tmp.Page != -1 && tmp.DescriptionHash == descHash && !IsRangeOccupied(tmp.Page, tmp.Offset, tmp.Size))
+        {
+            result = &tmp;
+            break;
+        }
+    }
+
+    if (!result)
+    {
+        // Find the free memory range in the existing pages (first-fit)
+        int32 pageIndex = -1;
+        uint64 offset = 0;
+        for (int32 i = 0; i < TransientPages.Count() && pageIndex == -1; i++)
+        {
+            const auto& page = TransientPages[i];
+            if (!page.Memory)
+                continue;
+            uint64 end;
+            offset = 0;
+            while (offset + size <= page.Size)
+            {
+                if (!IsRangeOccupied(i, offset, size, &end))
+                {
+                    pageIndex = i;
+                    break;
+                }
+                offset = Math::AlignUp<uint64>(end, alignment);
+            }
+        }
+
+        // Allocate a new page
+        if (pageIndex == -1)
+        {
+            Page page;
+            page.Size = Math::Max<uint64>(TRANSIENT_PAGE_SIZE, Math::AlignUp<uint64>(size, TRANSIENT_PAGE_SIZE));
+            page.Memory = device->AllocateAliasingMemory(page.Size);
+            if (!page.Memory)
+                return Get(desc);
+            for (pageIndex = 0; pageIndex < TransientPages.Count() && TransientPages[pageIndex].Memory; pageIndex++)
+            {
+            }
+            if (pageIndex == TransientPages.Count())
+                TransientPages.Add(page);
+            else
+                TransientPages[pageIndex] = page;
+            offset = 0;
+        }
+
+        // Create new rt
+        const String name = TEXT("TransientRT_") + StringUtils::ToString(TemporaryRTs.Count());
+        auto newRenderTarget = device->CreateAliasedTexture(name, desc, TransientPages[pageIndex].Memory, offset);
+        if (!newRenderTarget)
+        {
+            LOG(Error, "Cannot create transient render target. Description: {0}", desc.ToString());
+            return Get(desc);
+        }
+
+        // Create transient rt entry
+        Entry entry;
+        entry.LastFrameReleased = 0;
+        entry.RT = newRenderTarget;
+        entry.DescriptionHash = descHash;
+        entry.Page = pageIndex;
+        entry.Offset = offset;
+        entry.Size = size;
+        result = &TemporaryRTs.AddOne();
+        *result = entry;
+    }
+
+    // Mark as used
+    result->IsOccupied = true;
+    result->LastFrameTaken = Engine::FrameCount;
+
+    // Memory could be used by another render target so prepare the resource for the usage
+    context->ActivateAliasedTexture(result->RT);
+    return result->RT;
+}
+
 void RenderTargetPool::Release(GPUTexture* rt)
 {
     if (!rt)
@@ -24,6 +24,14 @@ API_CLASS(Static) class FLAXENGINE_API RenderTargetPool
     /// <returns>The allocated render target or reused one.</returns>
     API_FUNCTION() static GPUTexture* Get(API_PARAM(Ref) const GPUTextureDescription& desc);
 
+    /// <summary>
+    /// Gets a temporary render target that shares (aliases) the memory with the other transient render targets not used at the same time. Contents of the texture are undefined so it has to be fully overwritten before reading. Texture should be released within the same frame and can be used only with the given GPU context (uses regular temporary render target if the device doesn't support resources aliasing, see GPULimits::HasResourceAliasing).
+    /// </summary>
+    /// <param name="context">The GPU context that will use the texture (the main context).</param>
+    /// <param name="desc">The texture description.</param>
+    /// <returns>The allocated render target or reused one.</returns>
+    static GPUTexture* GetTransient(GPUContext* context, const GPUTextureDescription& desc);
+
     /// <summary>
     /// Releases a temporary render target.
     /// </summary>
@@ -4,10 +4,12 @@
 #include "RenderBuffers.h"
 #include "GPUDevice.h"
 #include "GPUSwapChain.h"
+#include "GPUTimerQuery.h"
 #include "PostProcessEffect.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Debug/DebugLog.h"
 #include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/SceneRendering.h"
 #include "Engine/Level/Actors/Camera.h"
 #include "Engine/Renderer/Renderer.h"
 #include "Engine/Render2D/Render2D.h"
@@ -34,6 +36,44 @@ PostProcessEffect::PostProcessEffect(const SpawnParams& params)
 {
 }
 
+namespace
+{
+    void CullSharedViews()
+    {
+        // Collect the main views of the scene rendering tasks drawn in this frame
+        Array<SceneRenderingView, InlinedAllocation<SCENE_RENDERING_MAX_SHARED_VIEWS>> views;
+        for (RenderTask* task : RenderTask::Tasks)
+        {
+            auto* sceneTask = ScriptingObject::Cast<SceneRenderTask>(task);
+            if (!sceneTask || !sceneTask->CanDraw() || sceneTask->IsCustomRendering || !sceneTask->Buffers || !EnumHasAllFlags(sceneTask->ActorsSource, ActorsSources::Scenes))
+                continue;
+            Viewport viewport = sceneTask->GetViewport();
+            if (viewport.Width <= 0 || viewport.Height <= 0)
+                continue;
+            RenderView view = sceneTask->View;
+            if (sceneTask->Camera)
+                view.CopyFrom(sceneTask->Camera, &viewport);
+            auto& e = views.AddOne();
+            e.Task = sceneTask;
+            e.View = view.View;
+            e.Projection = view.Projection;
+            e.Origin = view.Origin;
+
+            // Extend the frustum by a few pixels to cover the temporal anti-aliasing jitter applied later to the projection
+            Matrix projection = view.Projection;
+            projection.M11 *= viewport.Width / (viewport.Width + 8.0f);
+            projection.M22 *= viewport.Height / (viewport.Height + 8.0f);
+            e.Frustum.SetMatrix(view.View, projection);
+            if (views.Count() == SCENE_RENDERING_MAX_SHARED_VIEWS)
+                break;
+        }
+
+        // Cull the scenes once for all views (a single view is culled during drawing as usual)
+        if (views.Count() > 1)
+            Level::CullSharedViews(ToSpan(views.Get(), views.Count()));
+    }
+}
+
 void RenderTask::DrawAll()
 {
     ScopeLock lock(TasksLocker);
@@ -41,6 +81,9 @@ void RenderTask::DrawAll()
     // Sort tasks (by Order property)
     Sorting::QuickSortObj(Tasks.Get(), Tasks.Count());
 
+    // Cull the scene actors for the views of all the scene rendering tasks at once
+    CullSharedViews();
+
     // Render all that shit
     for (auto task : Tasks)
     {
@@ -151,6 +194,7 @@ SceneRenderTask::~SceneRenderTask()
         Buffers->DeleteObjectNow();
     if (_customActorsScene)
         Delete(_customActorsScene);
+    SAFE_DELETE_GPU_RESOURCE(_dynamicResolutionTimer);
 }
 
 void SceneRenderTask::CameraCut()
@@ -346,9 +390,32 @@ GPUTextureView* SceneRenderTask::GetOutputView() const
     return nullptr;
 }
 
+void SceneRenderTask::UpdateDynamicResolution()
+{
+    if (!DynamicResolution || !_dynamicResolutionPending || !_dynamicResolutionTimer->HasResult())
+        return;
+    _dynamicResolutionPending = false;
+    const float time = _dynamicResolutionTimer->GetResult();
+    const float targetTime = Math::Max(DynamicResolutionTargetTime, 0.1f);
+    if (time <= 0.0f || (time <= targetTime && time >= targetTime * 0.85f))
+        return; // Skip small changes to prevent frequent buffers resizing
+
+    // Rendering time scales roughly with the pixels count (use 5% steps)
+    const float step = 0.05f;
+    float percentage = RenderingPercentage * Math::Sqrt(targetTime * 0.95f / time);
+    percentage = Math::Round(Math::Lerp(RenderingPercentage, percentage, 0.5f) / step) * step;
+    if (time > targetTime)
+        percentage = Math::Min(percentage, RenderingPercentage - step);
+    else
+        percentage = Math::Max(percentage, RenderingPercentage + step);
+    const float minPercentage = Math::Clamp(DynamicResolutionMinPercentage, 0.1f, 1.0f);
+    RenderingPercentage = Math::Clamp(percentage, minPercentage, Math::Max(DynamicResolutionMaxPercentage, minPercentage));
+}
+
 void SceneRenderTask::OnBegin(GPUContext* context)
 {
     RenderTask::OnBegin(context);
+    UpdateDynamicResolution();
 
     // Copy view info if camera is specified
     if (Camera)
@@ -371,7 +438,22 @@ void SceneRenderTask::OnBegin(GPUContext* context)
 void SceneRenderTask::OnRender(GPUContext* context)
 {
     if (!IsCustomRendering && Buffers && Buffers->GetWidth() > 0)
+    {
+        // Measure scene rendering GPU time for the dynamic resolution scaling
+        const bool measureTime = DynamicResolution && !_dynamicResolutionPending;
+        if (measureTime)
+        {
+            if (!_dynamicResolutionTimer)
+                _dynamicResolutionTimer = GPUDevice::Instance->CreateTimerQuery();
+            _dynamicResolutionTimer->Begin();
+        }
         Renderer::Render(this);
+        if (measureTime)
+        {
+            _dynamicResolutionTimer->End();
+            _dynamicResolutionPending = true;
+        }
+    }
 
     RenderTask::OnRender(context);
 }
@@ -431,6 +513,7 @@ void MainRenderTask::OnBegin(GPUContext* context)
 
 #if !USE_EDITOR
     // Sync render buffers size with the backbuffer
+    UpdateDynamicResolution();
     const auto size = Screen::GetSize();
     Buffers->Init((int32)(size.X * RenderingPercentage), (int32)(size.Y * RenderingPercentage));
 #endif
@@ -16,6 +16,7 @@ class GPUContext;
 class GPUTexture;
 class GPUTextureView;
 class GPUSwapChain;
+class GPUTimerQuery;
 class RenderBuffers;
 class PostProcessEffect;
 struct RenderContext;
@@ -207,6 +208,8 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     DECLARE_SCRIPTING_TYPE(SceneRenderTask);
 protected:
     class SceneRendering* _customActorsScene = nullptr;
+    GPUTimerQuery* _dynamicResolutionTimer = nullptr;
+    bool _dynamicResolutionPending = false;
 
 public:
     /// <summary>
@@ -265,6 +268,26 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     /// </summary>
     API_FIELD() RenderingUpscaleLocation UpscaleLocation = RenderingUpscaleLocation::AfterAntiAliasingPass;
 
+    /// <summary>
+    /// Enables dynamic resolution scaling that adjusts RenderingPercentage (within DynamicResolutionMinPercentage and DynamicResolutionMaxPercentage range) to fit the GPU time of the scene rendering into DynamicResolutionTargetTime. Use it together with TAA and BeforePostProcessingPass upscale location to get temporal upscaling.
+    /// </summary>
+    API_FIELD() bool DynamicResolution = false;
+
+    /// <summary>
+    /// The target GPU time (in milliseconds) of the scene rendering used by the dynamic resolution scaling.
+    /// </summary>
+    API_FIELD() float DynamicResolutionTargetTime = 12.0f;
+
+    /// <summary>
+    /// The minimum rendering percentage used by the dynamic resolution scaling.
+    /// </summary>
+    API_FIELD() float DynamicResolutionMinPercentage = 0.5f;
+
+    /// <summary>
+    /// The maximum rendering percentage used by the dynamic resolution scaling.
+    /// </summary>
+    API_FIELD() float DynamicResolutionMaxPercentage = 1.0f;
+
 public:
     /// <summary>
     /// The custom set of actors to render.
@@ -288,6 +311,10 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     /// </summary>
     API_FUNCTION() void ClearCustomActors();
 
+protected:
+    // Updates the rendering percentage based on the measured GPU time of the scene rendering (if using dynamic resolution).
+    void UpdateDynamicResolution();
+
 public:
     /// <summary>
     /// The custom set of postfx to render.
@@ -10,7 +10,9 @@
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Streaming/Streaming.h"
 
 const Char* ToString(RendererType value)
 {
@@ -399,6 +401,25 @@ float RenderTools::ComputeBoundsScreenRadiusSquared(const Float3& origin, float
     return Math::Square(screenMultiple * radius) / Math::Max(1.0f, distSqr);
 }
 
+FORCE_INLINE void TrackModelUsage(const ModelBase* model, float screenRadiusSquared, const Float3& origin, float radius, const RenderView& lodView, const RenderContext& renderContext)
+{
+    // Include the predicted view location to stream models ahead of the view movement
+    if (Streaming::ViewPredictionTime > 0.0f)
+        screenRadiusSquared = Math::Max(screenRadiusSquared, RenderTools::ComputeBoundsScreenRadiusSquared(origin, radius, lodView.PredictedPosition, lodView.Projection) * renderContext.View.ModelLODDistanceFactorSqrt);
+
+    // Cache the largest screen size of the model in the current frame (used by the streaming)
+    const float screenSize = Math::Sqrt(screenRadiusSquared) * 2.0f;
+    if (model->LastRenderFrame != Engine::FrameCount)
+    {
+        model->LastRenderFrame = Engine::FrameCount;
+        model->LastRenderScreenSize = screenSize;
+    }
+    else if (model->LastRenderScreenSize < screenSize)
+    {
+        model->LastRenderScreenSize = screenSize;
+    }
+}
+
 int32 RenderTools::ComputeModelLOD(const Model* model, const Float3& origin, float radius, const RenderContext& renderContext)
 {
     const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
@@ -407,6 +428,7 @@ int32 RenderTools::ComputeModelLOD(const Model* model, const Float3& origin, flo
     // Check if model is being culled
     if (Math::Square(model->MinScreenSize * 0.5f) > screenRadiusSquared)
         return -1;
+    TrackModelUsage(model, screenRadiusSquared, origin, radius, *lodView, renderContext);
 
     // Skip if no need to calculate LOD
     if (model->LODs.Count() <= 1)
@@ -432,6 +454,7 @@ int32 RenderTools::ComputeSkinnedModelLOD(const SkinnedModel* model, const Float
     // Check if model is being culled
     if (Math::Square(model->MinScreenSize * 0.5f) > screenRadiusSquared)
         return -1;
+    TrackModelUsage(model, screenRadiusSquared, origin, radius, *lodView, renderContext);
 
     // Skip if no need to calculate LOD
     if (model->LODs.Count() <= 1)
@@ -7,6 +7,8 @@
 #include "Engine/Renderer/RendererPass.h"
 #include "RenderBuffers.h"
 #include "RenderTask.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Streaming/Streaming.h"
 
 void RenderView::Prepare(RenderContext& renderContext)
 {
@@ -20,8 +22,10 @@ void RenderView::Prepare(RenderContext& renderContext)
     NonJitteredProjection = Projection;
     if (renderContext.List->Setup.UseTemporalAAJitter)
     {
-        // Move to the next frame
-        const int MaxSampleCount = 8;
+        // Move to the next frame (temporal upscaling uses more samples to cover all output pixels)
+        int32 MaxSampleCount = 8;
+        if (renderContext.List->Setup.UseTemporalUpscaling)
+            MaxSampleCount = Math::Clamp((int32)(8.0f / Math::Square(renderContext.Task->RenderingPercentage)), 8, 64);
         if (++TaaFrameIndex >= MaxSampleCount)
             TaaFrameIndex = 0;
 
@@ -57,6 +61,19 @@ void RenderView::Prepare(RenderContext& renderContext)
     renderContext.List->Init(renderContext);
     renderContext.LodProxyView = nullptr;
 
+    // Predict the view movement for the content streaming
+    Velocity = Float3::Zero;
+    PredictedPosition = Position;
+    const float deltaTime = (float)Time::Draw.UnscaledDeltaTime.GetTotalSeconds();
+    if (Streaming::ViewPredictionTime > 0.0f && deltaTime > ZeroTolerance && renderContext.Task && !renderContext.Task->IsCameraCut && !IsSingleFrame)
+    {
+        Matrix prevIV;
+        Matrix::Invert(PrevView, prevIV);
+        const Float3 prevPosition = prevIV.GetTranslation() + (Float3)(PrevOrigin - Origin);
+        Velocity = (Position - prevPosition) / deltaTime;
+        PredictedPosition = Position + Velocity * Streaming::ViewPredictionTime;
+    }
+
     PrepareCache(renderContext, width, height, taaJitter);
 }
 
@@ -179,7 +196,11 @@ void RenderView::SetProjector(float nearPlane, float farPlane, const Float3& pos
 void RenderView::CopyFrom(Camera* camera, Viewport* viewport)
 {
     const Vector3 cameraPos = camera->GetPosition();
-    LargeWorlds::UpdateOrigin(Origin, cameraPos);
+    const Vector3 worldOrigin = LargeWorlds::GetOrigin();
+    if (LargeWorlds::AutoOrigin && LargeWorlds::Enable && Vector3::Abs(cameraPos - worldOrigin).MaxValue() <= LargeWorlds::ChunkSize * 2)
+        Origin = worldOrigin; // Use the shared world origin (eg. to match physics simulation space)
+    else
+        LargeWorlds::UpdateOrigin(Origin, cameraPos);
     Position = cameraPos - Origin;
     Direction = camera->GetDirection();
     Near = camera->GetNearPlane();
@@ -220,6 +220,16 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API RenderView
     /// </summary>
     API_FIELD() float ModelLODDistanceFactorSqrt;
 
+    /// <summary>
+    /// The view velocity (in world-units per second). Calculated from the view movement since the previous frame. Cached by rendering backend.
+    /// </summary>
+    API_FIELD() Float3 Velocity = Float3::Zero;
+
+    /// <summary>
+    /// The predicted view position (relative to the view origin) after the streaming prediction time (see Streaming::ViewPredictionTime). Used by the content streaming to prefetch resources ahead of the view movement. Cached by rendering backend.
+    /// </summary>
+    API_FIELD() Float3 PredictedPosition = Float3::Zero;
+
     /// <summary>
     /// Prepares view for rendering a scene. Called before rendering so other parts can reuse calculated value.
     /// </summary>
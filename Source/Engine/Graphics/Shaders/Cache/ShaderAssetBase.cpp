@@ -30,8 +30,26 @@ ShaderStorage::CachingMode ShaderStorage::GetCachingMode()
 #if COMPILE_WITH_SHADER_COMPILER
 
 #include "Engine/Utilities/Encryption.h"
+#include "Engine/Utilities/Crc.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Threading/Threading.h"
 #include "Engine/ShadersCompilation/ShadersCompilation.h"
 
+namespace
+{
+    // The last compilation result of the shader asset. Used to skip recompilation when asset gets saved without source code changes (eg. only material parameters or unused graph nodes were modified).
+    struct CompiledShader
+    {
+        uint32 SourceHash;
+        ShaderProfile Profile;
+        BytesContainer Data;
+    };
+
+    CriticalSection CompiledShadersLocker;
+    Dictionary<Guid, CompiledShader> CompiledShaders;
+    constexpr int32 CompiledShadersCapacity = 256;
+}
+
 #endif
 
 bool ShaderAssetBase::IsNullRenderer()
@@ -258,6 +276,25 @@ bool ShaderAssetBase::LoadShaderCache(ShaderCacheResult& result)
         // TODO: use cached data per thread?
         MemoryWriteStream cacheStream(32 * 1024);
 
+        // Reuse the last compilation result if source code and included files are the same
+        const uint32 sourceHash = Crc::MemCrc32(source, sourceLength);
+        bool reused = false;
+        {
+            ScopeLock lock(CompiledShadersLocker);
+            const CompiledShader* compiled = CompiledShaders.TryGet(parentID);
+            if (compiled && compiled->SourceHash == sourceHash && compiled->Profile == shaderProfile)
+            {
+                BytesContainer compiledData;
+                compiledData.Link(compiled->Data);
+                Array<String> includes;
+                if (IsValidShaderCache(compiledData, includes))
+                {
+                    cacheStream.WriteBytes(compiledData.Get(), compiledData.Length());
+                    reused = true;
+                }
+            }
+        }
+
         // Compile shader source
         ShaderCompilationOptions options;
         options.TargetName = StringUtils::GetFileNameWithoutExtension(parentPath);
@@ -288,7 +325,26 @@ bool ShaderAssetBase::LoadShaderCache(ShaderCacheResult& result)
         editorDefine.Definition = "1";
 #endif
         InitCompilationOptions(options);
-        const bool failed = ShadersCompilation::Compile(options);
+        bool failed = false;
+        if (reused)
+        {
+            LOG(Info, "Shader '{0}' source code is not modified, using the last compilation result", parent->ToString());
+        }
+        else
+        {
+            failed = ShadersCompilation::Compile(options);
+            if (!failed)
+            {
+                // Remember compilation result to skip it the next time if source code doesn't change
+                ScopeLock lock(CompiledShadersLocker);
+                if (CompiledShaders.Count() >= CompiledShadersCapacity)
+                    CompiledShaders.Clear();
+                CompiledShader& entry = CompiledShaders[parentID];
+                entry.SourceHash = sourceHash;
+                entry.Profile = shaderProfile;
+                entry.Data.Copy(cacheStream.GetHandle(), cacheStream.GetPosition());
+            }
+        }
 
         // Encrypt source code
         Encryption::EncryptBytes(reinterpret_cast<byte*>(source), sourceLength);
@@ -307,7 +363,7 @@ bool ShaderAssetBase::LoadShaderCache(ShaderCacheResult& result)
             auto cacheChunk = parent->GetOrCreateChunk(cacheChunkIndex);
             if (cacheChunk == nullptr)
                 return true;
-            cacheChunk->Data.Copy(cacheStream.GetHandle(), cacheStream.GetPosition());
+            cacheStream.Release(cacheChunk->Data);
 
 #if USE_EDITOR
             // Save chunks to the asset file
@@ -85,6 +85,8 @@ class ShaderCacheManagerService : public EngineService
     ShaderCacheManagerService()
         : EngineService(TEXT("Shader Cache Manager"), -200)
     {
+        // Scanning shader cache databases doesn't need the main thread
+        InitAsync = true;
     }
 
     bool Init() override;
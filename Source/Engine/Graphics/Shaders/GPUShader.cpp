@@ -6,6 +6,7 @@
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Utilities/Crc.h"
 
 GPUShaderProgramsContainer::GPUShaderProgramsContainer()
     : _shaders(64)
@@ -115,6 +116,7 @@ bool GPUShader::Create(MemoryReadStream& stream)
 
             // Read bindings
             stream.ReadBytes(&initializer.Bindings, sizeof(ShaderBindings));
+            initializer.Hash = Crc::MemCrc32(cache, (int32)cacheSize);
 
             // Create shader program
             GPUShaderProgram* shader = CreateGPUShaderProgram(type, initializer, cache, cacheSize, stream);
@@ -2,6 +2,7 @@
 
 #include "StreamingTexture.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Streaming/StreamingGroup.h"
 #include "Engine/Content/Loading/ContentLoadingManager.h"
@@ -148,6 +149,20 @@ uint64 StreamingTexture::GetTotalMemoryUsage() const
     return RenderTools::CalculateTextureMemoryUsage(_header.Format, _header.Width, _header.Height, _header.MipLevels) * arraySize;
 }
 
+void StreamingTexture::RegisterFeedback(float resolution) const
+{
+    // Cache the largest resolution in the current frame
+    if (FeedbackFrame != Engine::FrameCount)
+    {
+        FeedbackFrame = Engine::FrameCount;
+        FeedbackResolution = resolution;
+    }
+    else if (FeedbackResolution < resolution)
+    {
+        FeedbackResolution = resolution;
+    }
+}
+
 String StreamingTexture::ToString() const
 {
     return _texture->ToString();
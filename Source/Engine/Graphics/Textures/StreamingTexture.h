@@ -23,6 +23,17 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     bool _isBlockCompressed;
     Array<Task*, FixedAllocation<16>> _streamingTasks;
 
+public:
+    // The sampling feedback cache written during rendering. Contains the largest on-screen resolution (in pixels) of the geometry drawn with this texture in the last frame it was used. Used by the streaming to skip mips that are not sampled.
+    mutable uint64 FeedbackFrame = 0;
+    mutable float FeedbackResolution = 0.0f;
+
+    // The upper limit of the streaming quality (normalized to 0-1 range) set by the texture user. Used to stream out the mips not needed by the distant geometry (eg. terrain patches far from the streaming sources).
+    mutable float QualityLimit = 1.0f;
+
+    // True if the texture is a lightmap. Lightmaps residency is driven by the sampling feedback of the objects using them (see Streaming::LightmapsTimeToInvisible).
+    mutable bool IsLightmap = false;
+
 public:
     StreamingTexture(ITextureOwner* owner, const String& name);
     ~StreamingTexture();
@@ -156,6 +167,12 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     /// <returns>The amount of bytes.</returns>
     uint64 GetTotalMemoryUsage() const;
 
+    /// <summary>
+    /// Registers the sampling feedback from the rendering (texture used by the geometry drawn at the given on-screen resolution).
+    /// </summary>
+    /// <param name="resolution">The on-screen resolution of the geometry (in pixels).</param>
+    void RegisterFeedback(float resolution) const;
+
 public:
     FORCE_INLINE GPUTexture* operator->() const
     {
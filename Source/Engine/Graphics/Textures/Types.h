@@ -27,6 +27,19 @@ API_ENUM() enum class TextureFormatType : byte
     HdrRGB,
 };
 
+/// <summary>
+/// Describes texture block compression quality (speed vs quality trade-off of the encoder).
+/// </summary>
+API_ENUM() enum class TextureCompressionQuality : byte
+{
+    // The fastest encoding with lower quality (eg. for quick iterations on the content).
+    Fast = 0,
+    // The default balanced encoding.
+    Normal,
+    // The best quality encoding but the slowest (eg. for final builds).
+    High,
+};
+
 /// <summary>
 /// Old texture header structure (was not fully initialized to zero).
 /// </summary>
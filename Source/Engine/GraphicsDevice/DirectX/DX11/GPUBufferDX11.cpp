@@ -110,7 +110,7 @@ bool GPUBufferDX11::OnInit()
     // Set state
     DX_SET_DEBUG_NAME(_resource, GetName());
     _memoryUsage = _desc.Size;
-    int32 numElements = _desc.GetElementsCount();
+    int32 numElements = EnumHasAnyFlags(_desc.Flags, GPUBufferFlags::RawBuffer) ? _desc.Size / sizeof(uint32) : _desc.GetElementsCount(); // Raw views use 32-bit elements regardless of the buffer stride
 
     // Create views
     if (useSRV)
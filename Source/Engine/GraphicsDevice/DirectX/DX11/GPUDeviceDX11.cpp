@@ -16,6 +16,7 @@
 #include "Engine/Threading/Threading.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
 #include "Engine/Engine/CommandLine.h"
+#include "Engine/Graphics/Graphics.h"
 
 #if !USE_EDITOR && PLATFORM_WINDOWS
 #include "Engine/Core/Config/PlatformSettings.h"
@@ -362,6 +363,14 @@ bool GPUDeviceDX11::Init()
             limits.HasReadOnlyDepth = true;
             limits.HasMultisampleDepthAsSRV = true;
             limits.HasTypedUAVLoad = featureDataD3D11Options2.TypedUAVLoadAdditionalFormats != 0;
+            limits.HasDeferredContexts = false;
+            limits.HasBindlessResources = false;
+            limits.HasResourceAliasing = false;
+            limits.HasAsyncCompute = false;
+            limits.HasVariableRateShading = false;
+            limits.HasVariableRateShadingImage = false;
+            limits.VariableRateShadingTileSize = 0;
+            limits.HasMappedDynamicBuffers = false;
             limits.MaximumMipLevelsCount = D3D11_REQ_MIP_LEVELS;
             limits.MaximumTexture1DSize = D3D11_REQ_TEXTURE1D_U_DIMENSION;
             limits.MaximumTexture1DArraySize = D3D11_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -385,6 +394,14 @@ bool GPUDeviceDX11::Init()
             limits.HasReadOnlyDepth = createdFeatureLevel == D3D_FEATURE_LEVEL_10_1;
             limits.HasMultisampleDepthAsSRV = false;
             limits.HasTypedUAVLoad = false;
+            limits.HasDeferredContexts = false;
+            limits.HasBindlessResources = false;
+            limits.HasResourceAliasing = false;
+            limits.HasAsyncCompute = false;
+            limits.HasVariableRateShading = false;
+            limits.HasVariableRateShadingImage = false;
+            limits.VariableRateShadingTileSize = 0;
+            limits.HasMappedDynamicBuffers = false;
             limits.MaximumMipLevelsCount = D3D10_REQ_MIP_LEVELS;
             limits.MaximumTexture1DSize = D3D10_REQ_TEXTURE1D_U_DIMENSION;
             limits.MaximumTexture1DArraySize = D3D10_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -663,6 +680,16 @@ void GPUDeviceDX11::DrawEnd()
 {
     GPUDeviceDX::DrawEnd();
 
+    // Limit the amount of frames queued by the driver (low-latency mode queues a single frame)
+    const int32 frameLatency = Graphics::LowLatencyMode ? 1 : Math::Clamp(Graphics::MaxFramesInFlight, 1, GPU_MAX_FRAMES_IN_FLIGHT);
+    if (_frameLatency != frameLatency)
+    {
+        _frameLatency = frameLatency;
+        ComPtr<IDXGIDevice1> dxgiDevice;
+        if (SUCCEEDED(_device->QueryInterface(IID_PPV_ARGS(&dxgiDevice))))
+            dxgiDevice->SetMaximumFrameLatency(frameLatency);
+    }
+
 #if GPU_ENABLE_DIAGNOSTICS
     // Flush debug messages queue
     ComPtr<ID3D11InfoQueue> infoQueue;
@@ -29,6 +29,7 @@ class GPUDeviceDX11 : public GPUDeviceDX
 
     GPUContextDX11* _mainContext;
     bool _allowTearing = false;
+    int32 _frameLatency = 0;
 
     // Static Samplers
     ID3D11SamplerState* _samplerLinearClamp;
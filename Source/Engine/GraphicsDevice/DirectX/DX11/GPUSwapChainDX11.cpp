@@ -238,12 +238,6 @@ bool GPUSwapChainDX11::Resize(int32 width, int32 height)
         auto dxgiFactory = (IDXGIFactory2*)_device->GetDXGIFactory();
         VALIDATE_DIRECTX_RESULT(dxgiFactory->CreateSwapChainForCoreWindow(_device->GetDevice(), static_cast<IUnknown*>(_windowHandle), &swapChainDesc, nullptr, &_swapChain));
         ASSERT(_swapChain);
-
-        // Ensure that DXGI does not queue more than one frame at a time. This both reduces latency and
-        // ensures that the application will only render after each VSync, minimizing power consumption.
-        ComPtr<IDXGIDevice2> dxgiDevice;
-        VALIDATE_DIRECTX_RESULT(_device->GetDevice()->QueryInterface(IID_PPV_ARGS(&dxgiDevice)));
-        VALIDATE_DIRECTX_RESULT(dxgiDevice->SetMaximumFrameLatency(1));
 #endif
     }
     else
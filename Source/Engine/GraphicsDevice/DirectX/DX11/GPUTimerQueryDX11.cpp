@@ -43,6 +43,8 @@ GPUTimerQueryDX11::~GPUTimerQueryDX11()
         _endQuery->Release();
     if (_disjointQuery)
         _disjointQuery->Release();
+    if (_statsQuery)
+        _statsQuery->Release();
 }
 
 void GPUTimerQueryDX11::OnReleaseGPU()
@@ -50,6 +52,7 @@ void GPUTimerQueryDX11::OnReleaseGPU()
     SAFE_RELEASE(_beginQuery);
     SAFE_RELEASE(_endQuery);
     SAFE_RELEASE(_disjointQuery);
+    SAFE_RELEASE(_statsQuery);
 }
 
 ID3D11Resource* GPUTimerQueryDX11::GetResource()
@@ -63,6 +66,25 @@ void GPUTimerQueryDX11::Begin()
     context->Begin(_disjointQuery);
     context->End(_beginQuery);
 
+    // Pipeline statistics query is created on the first use
+    _hasStats = false;
+    if (CollectPipelineStatistics && !_statsQuery)
+    {
+        D3D11_QUERY_DESC queryDesc;
+        queryDesc.Query = D3D11_QUERY_PIPELINE_STATISTICS;
+        queryDesc.MiscFlags = 0;
+        if (_device->GetDevice()->CreateQuery(&queryDesc, &_statsQuery) != S_OK)
+        {
+            LOG(Warning, "Failed to create a pipeline statistics query.");
+            _statsQuery = nullptr;
+        }
+    }
+    if (CollectPipelineStatistics && _statsQuery)
+    {
+        context->Begin(_statsQuery);
+        _hasStats = true;
+    }
+
     _endCalled = false;
 }
 
@@ -72,6 +94,8 @@ void GPUTimerQueryDX11::End()
         return;
 
     auto context = _device->GetIM();
+    if (_hasStats)
+        context->End(_statsQuery);
     context->End(_endQuery);
     context->End(_disjointQuery);
 
@@ -85,7 +109,10 @@ bool GPUTimerQueryDX11::HasResult()
         return false;
 
     D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
-    return _device->GetIM()->GetData(_disjointQuery, &disjointData, sizeof(disjointData), 0) == S_OK;
+    if (_device->GetIM()->GetData(_disjointQuery, &disjointData, sizeof(disjointData), 0) != S_OK)
+        return false;
+    D3D11_QUERY_DATA_PIPELINE_STATISTICS statsData;
+    return !_hasStats || _device->GetIM()->GetData(_statsQuery, &statsData, sizeof(statsData), 0) == S_OK;
 }
 
 float GPUTimerQueryDX11::GetResult()
@@ -123,9 +150,34 @@ float GPUTimerQueryDX11::GetResult()
 #endif
         }
 
+        if (_hasStats)
+        {
+            D3D11_QUERY_DATA_PIPELINE_STATISTICS statsData;
+            if (context->GetData(_statsQuery, &statsData, sizeof(statsData), 0) == S_OK)
+            {
+                _stats.Primitives = statsData.CPrimitives;
+                _stats.PixelShaderInvocations = statsData.PSInvocations;
+                _stats.ComputeShaderInvocations = statsData.CSInvocations;
+            }
+            else
+            {
+                _hasStats = false;
+            }
+        }
+
         _finalized = true;
     }
     return _timeDelta;
 }
 
+bool GPUTimerQueryDX11::GetPipelineStatistics(GPUPipelineStatistics& result)
+{
+    if (!_finalized)
+        GetResult();
+    if (!_hasStats)
+        return true;
+    result = _stats;
+    return false;
+}
+
 #endif
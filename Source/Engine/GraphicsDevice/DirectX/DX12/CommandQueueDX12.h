@@ -12,6 +12,7 @@
 class GPUDeviceDX12;
 class GPUContextDX12;
 class CommandQueueDX12;
+class UploadQueueDX12;
 
 /// <summary>
 /// Wraps a fence object and provides functionality for common operations for GPU/CPU operations synchronization.
@@ -122,6 +123,7 @@ class CommandQueueDX12
 {
     friend GPUDeviceDX12;
     friend GPUContextDX12;
+    friend UploadQueueDX12;
 
 private:
 
@@ -5,6 +5,8 @@
 #include "DescriptorHeapDX12.h"
 #include "GPUDeviceDX12.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Engine/Engine.h"
 
 D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeapWithSlotsDX12::Slot::CPU() const
 {
@@ -184,11 +186,15 @@ DescriptorHeapRingBufferDX12::DescriptorHeapRingBufferDX12(GPUDeviceDX12* device
     , _type(type)
     , _descriptorsCount(descriptorsCount)
     , _shaderVisible(shaderVisible)
+    , _persistentCount(0)
+    , _persistentNext(0)
 {
 }
 
-bool DescriptorHeapRingBufferDX12::Init()
+bool DescriptorHeapRingBufferDX12::Init(uint32 persistentCount)
 {
+    ASSERT(persistentCount < _descriptorsCount);
+
     // Create heap
     D3D12_DESCRIPTOR_HEAP_DESC desc;
     desc.Type = _type;
@@ -199,7 +205,9 @@ bool DescriptorHeapRingBufferDX12::Init()
     LOG_DIRECTX_RESULT_WITH_RETURN(result);
 
     // Setup
-    _firstFree = 0;
+    _persistentCount = persistentCount;
+    _persistentNext = 0;
+    _firstFree = _persistentCount;
     _beginCPU = _heap->GetCPUDescriptorHandleForHeapStart();
     if (_shaderVisible)
         _beginGPU = _heap->GetGPUDescriptorHandleForHeapStart();
@@ -214,6 +222,7 @@ bool DescriptorHeapRingBufferDX12::Init()
 DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateTable(uint32 numDesc)
 {
     Allocation result;
+    ScopeLock lock(_locker);
 
     // Move the ring buffer pointer
     uint32 index = _firstFree;
@@ -222,9 +231,9 @@ DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateT
     // Check for overflow
     if (_firstFree >= _descriptorsCount)
     {
-        // Move to the begin
-        index = 0;
-        _firstFree = numDesc;
+        // Move to the begin (after the persistent descriptors)
+        index = _persistentCount;
+        _firstFree = _persistentCount + numDesc;
     }
 
     // Set pointers
@@ -234,10 +243,41 @@ DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateT
     return result;
 }
 
+bool DescriptorHeapRingBufferDX12::AllocatePersistent(uint32& index)
+{
+    ScopeLock lock(_locker);
+
+    // Reuse the released slot that is no longer used by the GPU
+    if (_persistentFree.HasItems() && _persistentFreeFrames[0] <= Engine::FrameCount)
+    {
+        index = _persistentFree[0];
+        _persistentFree.RemoveAtKeepOrder(0);
+        _persistentFreeFrames.RemoveAtKeepOrder(0);
+        return false;
+    }
+
+    if (_persistentNext >= _persistentCount)
+        return true;
+    index = _persistentNext++;
+    return false;
+}
+
+void DescriptorHeapRingBufferDX12::ReleasePersistent(uint32 index)
+{
+    ScopeLock lock(_locker);
+    if (index >= _persistentNext)
+        return; // Heap has been already released
+    _persistentFree.Add(index);
+    _persistentFreeFrames.Add(Engine::FrameCount + DX12_RESOURCE_DELETE_SAFE_FRAMES_COUNT);
+}
+
 void DescriptorHeapRingBufferDX12::OnReleaseGPU()
 {
     DX_SAFE_RELEASE_CHECK(_heap, 0);
-    _firstFree = 0;
+    _firstFree = _persistentCount;
+    _persistentNext = 0;
+    _persistentFree.Resize(0);
+    _persistentFreeFrames.Resize(0);
 }
 
 #endif
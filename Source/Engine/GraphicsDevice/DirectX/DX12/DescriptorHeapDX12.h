@@ -5,6 +5,7 @@
 #if GRAPHICS_API_DIRECTX12
 
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Graphics/GPUResource.h"
 #include "../IncludeDirectXHeaders.h"
 
@@ -119,7 +120,7 @@ class DescriptorHeapPoolDX12
 };
 
 /// <summary>
-/// Descriptors heap for DirectX 12 that uses a ring buffer concept to implement descriptor tables allocation.
+/// Descriptors heap for DirectX 12 that uses a ring buffer concept to implement descriptor tables allocation. Optionally, the beginning of the heap can be reserved for the persistent descriptors (eg. bindless resources) which are not overwritten by the ring buffer.
 /// </summary>
 class DescriptorHeapRingBufferDX12 : public GPUResource
 {
@@ -152,6 +153,11 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
     uint32 _descriptorsCount;
     uint32 _firstFree;
     bool _shaderVisible;
+    CriticalSection _locker;
+    uint32 _persistentCount;
+    uint32 _persistentNext;
+    Array<uint32> _persistentFree;
+    Array<uint64> _persistentFreeFrames;
 
 public:
 
@@ -164,9 +170,34 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
         return _heap;
     }
 
-    bool Init();
+    FORCE_INLINE uint32 GetPersistentCount() const
+    {
+        return _persistentCount;
+    }
+
+    FORCE_INLINE D3D12_CPU_DESCRIPTOR_HANDLE CPU(uint32 index) const
+    {
+        D3D12_CPU_DESCRIPTOR_HANDLE handle;
+        handle.ptr = _beginCPU.ptr + (SIZE_T)(index * _incrementSize);
+        return handle;
+    }
+
+    FORCE_INLINE D3D12_GPU_DESCRIPTOR_HANDLE GPU(uint32 index) const
+    {
+        D3D12_GPU_DESCRIPTOR_HANDLE handle;
+        handle.ptr = _beginGPU.ptr + index * _incrementSize;
+        return handle;
+    }
+
+    bool Init(uint32 persistentCount = 0);
     Allocation AllocateTable(uint32 numDesc);
 
+    // Allocates the persistent descriptor slot, returns true if failed (all slots are in use)
+    bool AllocatePersistent(uint32& index);
+
+    // Releases the persistent descriptor slot (it's reused after a few frames once GPU stops using it)
+    void ReleasePersistent(uint32 index);
+
 public:
 
     // [GPUResourceDX12]
@@ -12,6 +12,7 @@
 void GPUBufferViewDX12::SetSRV(D3D12_SHADER_RESOURCE_VIEW_DESC& srvDesc)
 {
     _srv.CreateSRV(_device, _owner->GetResource(), &srvDesc);
+    _device->ReleaseBindless(_bindlessIndex); // Register the new descriptor on the next use
 }
 
 void GPUBufferViewDX12::SetUAV(D3D12_UNORDERED_ACCESS_VIEW_DESC& uavDesc, ID3D12Resource* counterResource)
@@ -142,7 +143,7 @@ bool GPUBufferDX12::OnInit()
     initResource(resource, initialState, 1);
     DX_SET_DEBUG_NAME(_resource, GetName());
     _memoryUsage = _desc.Size;
-    int32 numElements = _desc.GetElementsCount();
+    int32 numElements = EnumHasAnyFlags(_desc.Flags, GPUBufferFlags::RawBuffer) ? _desc.Size / sizeof(uint32) : _desc.GetElementsCount(); // Raw views use 32-bit elements regardless of the buffer stride
 
     // Check if set initial data
     if (_desc.InitData)
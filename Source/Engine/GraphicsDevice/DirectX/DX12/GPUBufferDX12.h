@@ -19,6 +19,7 @@ class GPUBufferViewDX12 : public GPUBufferView, public IShaderResourceDX12
     GPUDeviceDX12* _device = nullptr;
     ResourceOwnerDX12* _owner = nullptr;
     DescriptorHeapWithSlotsDX12::Slot _srv, _uav;
+    int32 _bindlessIndex = -1;
 
 public:
 
@@ -59,6 +60,8 @@ class GPUBufferViewDX12 : public GPUBufferView, public IShaderResourceDX12
     {
         _srv.Release();
         _uav.Release();
+        if (_device)
+            _device->ReleaseBindless(_bindlessIndex);
     }
 
 public:
@@ -83,6 +86,12 @@ class GPUBufferViewDX12 : public GPUBufferView, public IShaderResourceDX12
     {
         return (void*)(IShaderResourceDX12*)this;
     }
+    int32 GetBindlessIndex() override
+    {
+        if (_bindlessIndex == -1 && _srv.IsValid())
+            _bindlessIndex = _device->AllocateBindless(_srv.CPU());
+        return _bindlessIndex;
+    }
 
     // [IShaderResourceDX12]
     bool IsDepthStencilResource() const override
@@ -9,6 +9,7 @@
 #include "GPUShaderDX12.h"
 #include "GPUPipelineStateDX12.h"
 #include "UploadBufferDX12.h"
+#include "UploadQueueDX12.h"
 #include "GPUTextureDX12.h"
 #include "GPUBufferDX12.h"
 #include "GPUSamplerDX12.h"
@@ -29,6 +30,9 @@
 #define DX12_ENABLE_RESOURCE_BARRIERS_BATCHING 1
 #define DX12_ENABLE_RESOURCE_BARRIERS_DEBUGGING 0
 
+// The resource states supported by the barriers on the compute command lists
+#define DX12_COMPUTE_QUEUE_STATES (D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER | D3D12_RESOURCE_STATE_UNORDERED_ACCESS | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT | D3D12_RESOURCE_STATE_COPY_DEST | D3D12_RESOURCE_STATE_COPY_SOURCE)
+
 inline bool operator!=(const D3D12_VERTEX_BUFFER_VIEW& l, const D3D12_VERTEX_BUFFER_VIEW& r)
 {
     return l.SizeInBytes != r.SizeInBytes || l.StrideInBytes != r.StrideInBytes || l.BufferLocation != r.BufferLocation;
@@ -58,10 +62,14 @@ static_assert(OFFSET_OF(GPUDrawIndexedIndirectArgs, StartIndex) == OFFSET_OF(D3D
 static_assert(OFFSET_OF(GPUDrawIndexedIndirectArgs, StartVertex) == OFFSET_OF(D3D12_DRAW_INDEXED_ARGUMENTS, BaseVertexLocation), "Wrong offset for GPUDrawIndexedIndirectArgs::StartVertex");
 static_assert(OFFSET_OF(GPUDrawIndexedIndirectArgs, StartInstance) == OFFSET_OF(D3D12_DRAW_INDEXED_ARGUMENTS, StartInstanceLocation), "Wrong offset for GPUDrawIndexedIndirectArgs::StartInstance");
 
-GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type)
+GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type, bool isDeferred)
     : GPUContext(device)
     , _device(device)
+    , _queue(type == D3D12_COMMAND_LIST_TYPE_COMPUTE ? device->GetComputeQueue() : device->GetCommandQueue())
     , _commandList(nullptr)
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+    , _commandList5(nullptr)
+#endif
     , _currentAllocator(nullptr)
     , _currentState(nullptr)
     , _currentCompute(nullptr)
@@ -72,25 +80,37 @@ GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE ty
     , _srMaskDirtyGraphics(0)
     , _srMaskDirtyCompute(0)
     , _isCompute(0)
+    , _isDeferred(isDeferred ? 1 : 0)
     , _rtDirtyFlag(0)
     , _psDirtyFlag(0)
     , _cbGraphicsDirtyFlag(0)
     , _cbComputeDirtyFlag(0)
     , _samplersDirtyFlag(0)
+    , _isAsyncCompute(type == D3D12_COMMAND_LIST_TYPE_COMPUTE ? 1 : 0)
+    , _needsMainSync(0)
+    , _shadingRate(GPUShadingRate::Rate1x1)
+    , _shadingRateImage(nullptr)
+    , _copyWaitValue(0)
     , _rtDepth(nullptr)
     , _ibHandle(nullptr)
 {
-    FrameFenceValues[0] = 0;
-    FrameFenceValues[1] = 0;
-    _currentAllocator = _device->GetCommandQueue()->RequestAllocator();
+    Platform::MemoryClear(FrameFenceValues, sizeof(FrameFenceValues));
+    _currentAllocator = _queue->RequestAllocator();
     VALIDATE_DIRECTX_RESULT(device->GetDevice()->CreateCommandList(0, type, _currentAllocator, nullptr, IID_PPV_ARGS(&_commandList)));
 #if GPU_ENABLE_RESOURCE_NAMING
     _commandList->SetName(TEXT("GPUContextDX12::CommandList"));
 #endif
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+    if (device->Limits.HasVariableRateShading && type == D3D12_COMMAND_LIST_TYPE_DIRECT)
+        _commandList->QueryInterface(IID_PPV_ARGS(&_commandList5));
+#endif
 }
 
 GPUContextDX12::~GPUContextDX12()
 {
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+    DX_SAFE_RELEASE_CHECK(_commandList5, 1);
+#endif
     DX_SAFE_RELEASE_CHECK(_commandList, 0);
 }
 
@@ -110,6 +130,14 @@ void GPUContextDX12::AddTransitionBarrier(ResourceOwnerDX12* resource, const D3D
     Log::Logger::Write(LogType::Info, info);
 #endif
 
+    if (_isAsyncCompute && ((before | after) & ~DX12_COMPUTE_QUEUE_STATES) != 0)
+    {
+        // Compute queue cannot transition resources from/to graphics states so record the barrier on the main context and sync with it before the execution
+        _device->GetMainContextDX12()->AddTransitionBarrier(resource, before, after, subresourceIndex);
+        _needsMainSync = true;
+        return;
+    }
+
     D3D12_RESOURCE_BARRIER barrier;
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
@@ -146,10 +174,29 @@ void GPUContextDX12::AddUAVBarrier()
 }
 
 void GPUContextDX12::SetResourceState(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after, int32 subresourceIndex)
+{
+    if (_isDeferred)
+    {
+        // Resources state tracking is shared with the other deferred contexts recording in parallel
+        ScopeLock lock(_device->DeferredContextsLocker);
+        setResourceState(resource, after, subresourceIndex);
+    }
+    else
+    {
+        setResourceState(resource, after, subresourceIndex);
+    }
+}
+
+void GPUContextDX12::setResourceState(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after, int32 subresourceIndex)
 {
     auto nativeResource = resource->GetResource();
     if (nativeResource == nullptr)
         return;
+    if (resource->CopyFenceValue != 0 && after != D3D12_RESOURCE_STATE_COMMON)
+    {
+        // Resource is uploaded on the copy queue so wait for it before the first use
+        _device->UploadQueue->OnUse(this, resource, _copyWaitValue);
+    }
     auto& state = resource->State;
     if (subresourceIndex == -1)
     {
@@ -208,7 +255,7 @@ void GPUContextDX12::Reset()
     ASSERT(_commandList != nullptr);
     if (_currentAllocator == nullptr)
     {
-        _currentAllocator = _device->GetCommandQueue()->RequestAllocator();
+        _currentAllocator = _queue->RequestAllocator();
         _commandList->Reset(_currentAllocator, nullptr);
     }
 
@@ -235,6 +282,9 @@ void GPUContextDX12::Reset()
     Platform::MemoryClear(&_cbHandles, sizeof(_cbHandles));
     Platform::MemoryClear(&_samplers, sizeof(_samplers));
     _swapChainsUsed = 0;
+    _cbAddresses.Clear();
+    _shadingRate = GPUShadingRate::Rate1x1;
+    _shadingRateImage = nullptr;
 
     ForceRebindDescriptors();
 }
@@ -242,12 +292,29 @@ void GPUContextDX12::Reset()
 uint64 GPUContextDX12::Execute(bool waitForCompletion)
 {
     ASSERT(_currentAllocator != nullptr);
-    auto queue = _device->GetCommandQueue();
+    auto queue = _queue;
 
     // Flush remaining and buffered commands
     FlushState();
     _currentState = nullptr;
 
+    // Execute the resource barriers recorded on the main context first
+    if (_needsMainSync)
+    {
+        _needsMainSync = false;
+        auto mainContext = _device->GetMainContextDX12();
+        const uint64 mainFenceValue = mainContext->Execute(false);
+        mainContext->Reset();
+        mainContext->_queue->_fence.WaitGPU(queue, mainFenceValue);
+    }
+
+    // Wait for the copy queue uploads to the resources used by the commands
+    if (_copyWaitValue != 0)
+    {
+        _device->UploadQueue->WaitGPU(queue, _copyWaitValue);
+        _copyWaitValue = 0;
+    }
+
     // Execute commands
     const uint64 fenceValue = queue->ExecuteCommandList(_commandList);
 
@@ -321,7 +388,7 @@ void GPUContextDX12::flushSRVs()
             ASSERT(handle->SrvDimension == dimensions);
             srcDescriptorRangeStarts[i] = handle->SRV();
             // TODO: for setup states based on binding mode
-            D3D12_RESOURCE_STATES states = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+            D3D12_RESOURCE_STATES states = _isAsyncCompute ? D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE : D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
             if (handle->IsDepthStencilResource())
                 states |= D3D12_RESOURCE_STATE_DEPTH_READ;
             SetResourceState(handle->GetResourceOwner(), states, handle->SubresourceIndex);
@@ -457,8 +524,11 @@ void GPUContextDX12::flushCBs()
             const auto cb = _cbHandles[i];
             if (cb)
             {
-                ASSERT(cb->GPUAddress != 0);
-                _commandList->SetGraphicsRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, cb->GPUAddress);
+                D3D12_GPU_VIRTUAL_ADDRESS address = cb->GPUAddress;
+                if (_isDeferred)
+                    _cbAddresses.TryGet(cb, address);
+                ASSERT(address != 0);
+                _commandList->SetGraphicsRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, address);
             }
         }
     }
@@ -470,8 +540,11 @@ void GPUContextDX12::flushCBs()
             const auto cb = _cbHandles[i];
             if (cb)
             {
-                ASSERT(cb->GPUAddress != 0);
-                _commandList->SetComputeRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, cb->GPUAddress);
+                D3D12_GPU_VIRTUAL_ADDRESS address = cb->GPUAddress;
+                if (_isDeferred)
+                    _cbAddresses.TryGet(cb, address);
+                ASSERT(address != 0);
+                _commandList->SetComputeRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, address);
             }
         }
     }
@@ -662,8 +735,13 @@ void GPUContextDX12::FrameEnd()
     GPUContext::FrameEnd();
 
     // Execute command (but don't wait for them)
-    FrameFenceValues[1] = FrameFenceValues[0];
+    for (int32 i = GPU_MAX_FRAMES_IN_FLIGHT - 1; i > 0; i--)
+        FrameFenceValues[i] = FrameFenceValues[i - 1];
     FrameFenceValues[0] = Execute(false);
+
+    // Submit the copy queue uploads recorded during this frame (they wait for the main context commands)
+    if (_device->UploadQueue && this == _device->GetMainContextDX12())
+        _device->UploadQueue->Submit(FrameFenceValues[0]);
 }
 
 #if GPU_ALLOW_PROFILE_EVENTS
@@ -995,7 +1073,10 @@ void GPUContextDX12::UpdateCB(GPUConstantBuffer* cb, const void* data)
     Platform::MemoryCopy(allocation.CPUAddress, data, allocation.Size);
 
     // Cache GPU address of the allocation
-    cbDX12->GPUAddress = allocation.GPUAddress;
+    if (_isDeferred)
+        _cbAddresses[cbDX12] = allocation.GPUAddress;
+    else
+        cbDX12->GPUAddress = allocation.GPUAddress;
 
     // Mark CB slot as dirty if this CB is binded to the pipeline
     for (uint32 i = 0; i < ARRAY_COUNT(_cbHandles); i++)
@@ -1134,6 +1215,45 @@ void GPUContextDX12::SetViewport(const Viewport& viewport)
     _commandList->RSSetViewports(1, (D3D12_VIEWPORT*)&viewport);
 }
 
+void GPUContextDX12::SetShadingRate(GPUShadingRate rate)
+{
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+    if (_commandList5 && _shadingRate != rate)
+    {
+        _shadingRate = rate;
+        const D3D12_SHADING_RATE_COMBINER combiners[2] = { D3D12_SHADING_RATE_COMBINER_PASSTHROUGH, _shadingRateImage ? D3D12_SHADING_RATE_COMBINER_MAX : D3D12_SHADING_RATE_COMBINER_PASSTHROUGH };
+        _commandList5->RSSetShadingRate((D3D12_SHADING_RATE)rate, combiners);
+    }
+#endif
+}
+
+void GPUContextDX12::SetShadingRateImage(GPUTextureView* image)
+{
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+    if (!_commandList5 || !_device->Limits.HasVariableRateShadingImage)
+        return;
+    const auto imageDX12 = static_cast<GPUTextureViewDX12*>(image);
+    ID3D12Resource* resource = nullptr;
+    if (imageDX12)
+    {
+        SetResourceState(imageDX12->GetResourceOwner(), D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE);
+        flushRBs();
+        resource = imageDX12->GetResourceOwner()->GetResource();
+    }
+    if (_shadingRateImage != resource)
+    {
+        const bool combinerChanged = (_shadingRateImage == nullptr) != (resource == nullptr);
+        _shadingRateImage = resource;
+        _commandList5->RSSetShadingRateImage(resource);
+        if (combinerChanged)
+        {
+            const D3D12_SHADING_RATE_COMBINER combiners[2] = { D3D12_SHADING_RATE_COMBINER_PASSTHROUGH, resource ? D3D12_SHADING_RATE_COMBINER_MAX : D3D12_SHADING_RATE_COMBINER_PASSTHROUGH };
+            _commandList5->RSSetShadingRate((D3D12_SHADING_RATE)_shadingRate, combiners);
+        }
+    }
+#endif
+}
+
 void GPUContextDX12::SetScissor(const Rectangle& scissorRect)
 {
     D3D12_RECT rect;
@@ -1234,6 +1354,27 @@ void GPUContextDX12::UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32
     _device->UploadBuffer->UploadTexture(this, textureDX12->GetResource(), data, rowPitch, slicePitch, mipIndex, arrayIndex);
 }
 
+bool GPUContextDX12::UpdateBufferAsync(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset)
+{
+    ASSERT(data);
+    ASSERT(buffer && buffer->GetSize() >= size);
+
+    // Only the main context submits the copy queue uploads
+    if (!_device->UploadQueue || this != _device->GetMainContextDX12())
+        return true;
+    return _device->UploadQueue->UploadBuffer(this, (GPUBufferDX12*)buffer, offset, data, size);
+}
+
+bool GPUContextDX12::UpdateTextureAsync(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch)
+{
+    ASSERT(texture && texture->IsAllocated() && data);
+
+    // Only the main context submits the copy queue uploads
+    if (!_device->UploadQueue || this != _device->GetMainContextDX12())
+        return true;
+    return _device->UploadQueue->UploadTexture(this, static_cast<GPUTextureDX12*>(texture), data, rowPitch, slicePitch, mipIndex, arrayIndex);
+}
+
 void GPUContextDX12::CopyTexture(GPUTexture* dstResource, uint32 dstSubresource, uint32 dstX, uint32 dstY, uint32 dstZ, GPUTexture* srcResource, uint32 srcSubresource)
 {
     auto dstTextureDX12 = (GPUTextureDX12*)dstResource;
@@ -1435,15 +1576,88 @@ void GPUContextDX12::SetResourceState(GPUResource* resource, uint64 state, int32
     SetResourceState(resourceDX12, (D3D12_RESOURCE_STATES)state, subresource);
 }
 
+void GPUContextDX12::UseBindless(GPUResourceView* view)
+{
+    auto handle = view ? (IShaderResourceDX12*)view->GetNativePtr() : nullptr;
+    if (handle)
+    {
+        D3D12_RESOURCE_STATES states = _isAsyncCompute ? D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE : D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+        if (handle->IsDepthStencilResource())
+            states |= D3D12_RESOURCE_STATE_DEPTH_READ;
+        SetResourceState(handle->GetResourceOwner(), states, handle->SubresourceIndex);
+        *view->LastRenderTime = _lastRenderTime;
+    }
+}
+
+void GPUContextDX12::ActivateAliasedTexture(GPUTexture* texture)
+{
+    auto textureDX12 = (GPUTextureDX12*)texture;
+    if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
+        flushRBs();
+
+    // Mark the texture as the active user of the shared memory
+    D3D12_RESOURCE_BARRIER barrier;
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Aliasing.pResourceBefore = nullptr;
+    barrier.Aliasing.pResourceAfter = textureDX12->GetResource();
+#if DX12_ENABLE_RESOURCE_BARRIERS_BATCHING
+    _rbBuffer[_rbBufferSize++] = barrier;
+#else
+    _commandList->ResourceBarrier(1, &barrier);
+#endif
+
+    // Aliased resource has to be initialized before the first use (discard is the fastest way to do it)
+    D3D12_RESOURCE_STATES state;
+    if (texture->IsRenderTarget())
+        state = D3D12_RESOURCE_STATE_RENDER_TARGET;
+    else if (texture->IsDepthStencil())
+        state = D3D12_RESOURCE_STATE_DEPTH_WRITE;
+    else if (texture->IsUnorderedAccess())
+        state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+    else
+        return;
+    SetResourceState(textureDX12, state);
+    flushRBs();
+    _commandList->DiscardResource(textureDX12->GetResource(), nullptr);
+}
+
+uint64 GPUContextDX12::Signal()
+{
+    const uint64 fenceValue = Execute(false);
+    Reset();
+    return fenceValue;
+}
+
+void GPUContextDX12::Wait(GPUContext* other, uint64 syncPoint)
+{
+    const auto otherQueue = ((GPUContextDX12*)other)->_queue;
+    if (otherQueue == _queue)
+        return;
+    Execute(false);
+    Reset();
+    otherQueue->_fence.WaitGPU(_queue, syncPoint);
+}
+
 void GPUContextDX12::ForceRebindDescriptors()
 {
     // Bind Root Signature
-    _commandList->SetGraphicsRootSignature(_device->GetRootSignature());
+    if (!_isAsyncCompute)
+        _commandList->SetGraphicsRootSignature(_device->GetRootSignature());
     _commandList->SetComputeRootSignature(_device->GetRootSignature());
 
     // Bind heaps
     ID3D12DescriptorHeap* ppHeaps[] = {_device->RingHeap_CBV_SRV_UAV.GetHeap(), _device->RingHeap_Sampler.GetHeap()};
     _commandList->SetDescriptorHeaps(ARRAY_COUNT(ppHeaps), ppHeaps);
+
+    // Bind bindless resources table (persistent descriptors at the beginning of the heap)
+    if (_device->Limits.HasBindlessResources)
+    {
+        const D3D12_GPU_DESCRIPTOR_HANDLE bindless = _device->RingHeap_CBV_SRV_UAV.GPU(0);
+        if (!_isAsyncCompute)
+            _commandList->SetGraphicsRootDescriptorTable(DX12_ROOT_SIGNATURE_BINDLESS, bindless);
+        _commandList->SetComputeRootDescriptorTable(DX12_ROOT_SIGNATURE_BINDLESS, bindless);
+    }
 }
 
 #endif
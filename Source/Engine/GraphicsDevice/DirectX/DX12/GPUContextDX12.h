@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "IShaderResourceDX12.h"
 #include "DescriptorHeapDX12.h"
 #include "../IncludeDirectXHeaders.h"
@@ -15,6 +16,7 @@ class GPUBufferDX12;
 class GPUSamplerDX12;
 class GPUConstantBufferDX12;
 class GPUTextureViewDX12;
+class CommandQueueDX12;
 
 /// <summary>
 /// Size of the resource barriers buffer size (will be flushed on overflow)
@@ -35,7 +37,11 @@ class GPUContextDX12 : public GPUContext
 private:
 
     GPUDeviceDX12* _device;
+    CommandQueueDX12* _queue;
     ID3D12GraphicsCommandList* _commandList;
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+    ID3D12GraphicsCommandList5* _commandList5;
+#endif
     ID3D12CommandAllocator* _currentAllocator;
     GPUPipelineStateDX12* _currentState;
     GPUShaderProgramCS* _currentCompute;
@@ -49,11 +55,18 @@ class GPUContextDX12 : public GPUContext
     uint32 _srMaskDirtyCompute;
 
     int32 _isCompute : 1;
+    int32 _isDeferred : 1;
     int32 _rtDirtyFlag : 1;
     int32 _psDirtyFlag : 1;
     int32 _cbGraphicsDirtyFlag : 1;
     int32 _cbComputeDirtyFlag : 1;
     int32 _samplersDirtyFlag : 1;
+    int32 _isAsyncCompute : 1;
+    int32 _needsMainSync : 1;
+
+    GPUShadingRate _shadingRate;
+    ID3D12Resource* _shadingRateImage;
+    uint64 _copyWaitValue;
 
     GPUTextureViewDX12* _rtDepth;
     GPUTextureViewDX12* _rtHandles[GPU_MAX_RT_BINDED];
@@ -67,9 +80,12 @@ class GPUContextDX12 : public GPUContext
     GPUConstantBufferDX12* _cbHandles[GPU_MAX_CB_BINDED];
     GPUSamplerDX12* _samplers[GPU_MAX_SAMPLER_BINDED - GPU_STATIC_SAMPLERS_COUNT];
 
+    // Constant buffers data uploaded by the deferred context (shared buffer objects can be updated by many contexts in parallel)
+    Dictionary<GPUConstantBufferDX12*, D3D12_GPU_VIRTUAL_ADDRESS> _cbAddresses;
+
 public:
 
-    GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type);
+    GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type, bool isDeferred = false);
     ~GPUContextDX12();
 
 public:
@@ -79,7 +95,24 @@ class GPUContextDX12 : public GPUContext
         return _commandList;
     }
 
-    uint64 FrameFenceValues[2];
+    /// <summary>
+    /// Returns true if it's an async compute context that records commands for the compute queue.
+    /// </summary>
+    FORCE_INLINE bool IsAsyncCompute() const
+    {
+        return _isAsyncCompute != 0;
+    }
+
+    /// <summary>
+    /// Returns true if it's a deferred context used to record commands on other threads.
+    /// </summary>
+    FORCE_INLINE bool IsDeferred() const
+    {
+        return _isDeferred != 0;
+    }
+
+    // The fence values of the recent frames (index 0 is the last frame).
+    uint64 FrameFenceValues[GPU_MAX_FRAMES_IN_FLIGHT];
 
 public:
 
@@ -136,6 +169,7 @@ class GPUContextDX12 : public GPUContext
 
 private:
 
+    void setResourceState(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after, int32 subresourceIndex);
     void flushSRVs();
     void flushRTVs();
     void flushUAVs();
@@ -185,6 +219,8 @@ class GPUContextDX12 : public GPUContext
     void DrawInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs) override;
     void DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs) override;
     void SetViewport(const Viewport& viewport) override;
+    void SetShadingRate(GPUShadingRate rate) override;
+    void SetShadingRateImage(GPUTextureView* image) override;
     void SetScissor(const Rectangle& scissorRect) override;
     GPUPipelineState* GetState() const override;
     void SetState(GPUPipelineState* state) override;
@@ -194,12 +230,18 @@ class GPUContextDX12 : public GPUContext
     void UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset) override;
     void CopyBuffer(GPUBuffer* dstBuffer, GPUBuffer* srcBuffer, uint32 size, uint32 dstOffset, uint32 srcOffset) override;
     void UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch) override;
+    bool UpdateBufferAsync(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset) override;
+    bool UpdateTextureAsync(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch) override;
     void CopyTexture(GPUTexture* dstResource, uint32 dstSubresource, uint32 dstX, uint32 dstY, uint32 dstZ, GPUTexture* srcResource, uint32 srcSubresource) override;
     void ResetCounter(GPUBuffer* buffer) override;
     void CopyCounter(GPUBuffer* dstBuffer, uint32 dstOffset, GPUBuffer* srcBuffer) override;
     void CopyResource(GPUResource* dstResource, GPUResource* srcResource) override;
     void CopySubresource(GPUResource* dstResource, uint32 dstSubresource, GPUResource* srcResource, uint32 srcSubresource) override;
     void SetResourceState(GPUResource* resource, uint64 state, int32 subresource) override;
+    void UseBindless(GPUResourceView* view) override;
+    void ActivateAliasedTexture(GPUTexture* texture) override;
+    uint64 Signal() override;
+    void Wait(GPUContext* other, uint64 syncPoint) override;
     void ForceRebindDescriptors() override;
 };
 
@@ -13,16 +13,24 @@
 #include "GPUSwapChainDX12.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/CommandLine.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Config/PlatformSettings.h"
 #include "UploadBufferDX12.h"
+#include "UploadQueueDX12.h"
 #include "CommandQueueDX12.h"
 #include "Engine/Core/Utilities.h"
 #include "Engine/Threading/Threading.h"
 #include "CommandSignatureDX12.h"
+#if DX12_PIPELINE_LIBRARY
+#include "Engine/Engine/Globals.h"
+#include "FlaxEngine.Gen.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#endif
 
 static bool CheckDX12Support(IDXGIAdapter* adapter)
 {
@@ -34,6 +42,19 @@ static bool CheckDX12Support(IDXGIAdapter* adapter)
     return false;
 }
 
+#if DX12_PIPELINE_LIBRARY
+
+static void GetPipelineLibraryPath(String& path)
+{
+#if USE_EDITOR
+    path = Globals::ProjectCacheFolder / TEXT("DX12Pipeline.cache");
+#else
+    path = Globals::ProductLocalFolder / TEXT("DX12Pipeline.cache");
+#endif
+}
+
+#endif
+
 GPUDevice* GPUDeviceDX12::Create()
 {
 #if PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE
@@ -226,7 +247,10 @@ GPUDeviceDX12::GPUDeviceDX12(IDXGIFactory4* dxgiFactory, GPUAdapterDX* adapter)
     , _rootSignature(nullptr)
     , _commandQueue(nullptr)
     , _mainContext(nullptr)
+    , _computeQueue(nullptr)
+    , _asyncComputeContext(nullptr)
     , UploadBuffer(nullptr)
+    , UploadQueue(nullptr)
     , TimestampQueryHeap(this, D3D12_QUERY_HEAP_TYPE_TIMESTAMP, DX12_BACK_BUFFER_COUNT * 1024)
     , Heap_CBV_SRV_UAV(this, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 4 * 1024, false)
     , Heap_RTV(this, D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 1 * 1024, false)
@@ -368,6 +392,12 @@ bool GPUDeviceDX12::Init()
     LOG(Info, "Resource Binding Tier: {0}", (int32)options.ResourceBindingTier);
     LOG(Info, "Conservative Rasterization Tier: {0}", (int32)options.ConservativeRasterizationTier);
     LOG(Info, "Resource Heap Tier: {0}", (int32)options.ResourceHeapTier);
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    if (FAILED(_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6))))
+        options6.VariableShadingRateTier = D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED;
+    LOG(Info, "Variable Shading Rate Tier: {0}", (int32)options6.VariableShadingRateTier);
+#endif
 
     // Init device limits
     {
@@ -384,6 +414,20 @@ bool GPUDeviceDX12::Init()
         limits.HasReadOnlyDepth = true;
         limits.HasMultisampleDepthAsSRV = true;
         limits.HasTypedUAVLoad = options.TypedUAVLoadAdditionalFormats != 0;
+        limits.HasDeferredContexts = true;
+        limits.HasBindlessResources = options.ResourceBindingTier >= D3D12_RESOURCE_BINDING_TIER_2;
+        limits.HasResourceAliasing = options.ResourceHeapTier >= D3D12_RESOURCE_HEAP_TIER_2;
+        limits.HasAsyncCompute = true;
+#ifdef __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+        limits.HasVariableRateShading = options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_1;
+        limits.HasVariableRateShadingImage = options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_2;
+        limits.VariableRateShadingTileSize = limits.HasVariableRateShadingImage ? (int32)options6.ShadingRateImageTileSize : 0;
+#else
+        limits.HasVariableRateShading = false;
+        limits.HasVariableRateShadingImage = false;
+        limits.VariableRateShadingTileSize = 0;
+#endif
+        limits.HasMappedDynamicBuffers = false;
         limits.MaximumMipLevelsCount = D3D12_REQ_MIP_LEVELS;
         limits.MaximumTexture1DSize = D3D12_REQ_TEXTURE1D_U_DIMENSION;
         limits.MaximumTexture1DArraySize = D3D12_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -419,7 +463,11 @@ bool GPUDeviceDX12::Init()
     if (_commandQueue->Init())
         return true;
     _mainContext = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_DIRECT);
-    if (RingHeap_CBV_SRV_UAV.Init())
+    _computeQueue = New<CommandQueueDX12>(this, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+    if (_computeQueue->Init())
+        return true;
+    _asyncComputeContext = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+    if (RingHeap_CBV_SRV_UAV.Init(Limits.HasBindlessResources ? DX12_BINDLESS_DESCRIPTORS_COUNT : 0))
         return true;
     if (RingHeap_Sampler.Init())
         return true;
@@ -503,6 +551,17 @@ bool GPUDeviceDX12::Init()
     {
         // Descriptor tables
         D3D12_DESCRIPTOR_RANGE r[3]; // SRV+UAV+Sampler
+        D3D12_DESCRIPTOR_RANGE rBindless[5]; // Texture2D+Texture2DArray+Texture3D+TextureCube+Buffer
+        for (int32 i = 0; i < ARRAY_COUNT(rBindless); i++)
+        {
+            // All bindless arrays alias the same descriptors (each resource type is declared in a separate register space)
+            D3D12_DESCRIPTOR_RANGE& range = rBindless[i];
+            range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+            range.NumDescriptors = DX12_BINDLESS_DESCRIPTORS_COUNT;
+            range.BaseShaderRegister = 0;
+            range.RegisterSpace = i + 1;
+            range.OffsetInDescriptorsFromTableStart = 0;
+        }
         {
             D3D12_DESCRIPTOR_RANGE& range = r[0];
             range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
@@ -529,7 +588,7 @@ bool GPUDeviceDX12::Init()
         }
 
         // Root parameters
-        D3D12_ROOT_PARAMETER rootParameters[GPU_MAX_CB_BINDED + 3];
+        D3D12_ROOT_PARAMETER rootParameters[GPU_MAX_CB_BINDED + 4];
         for (int32 i = 0; i < GPU_MAX_CB_BINDED; i++)
         {
             // CB
@@ -563,6 +622,14 @@ bool GPUDeviceDX12::Init()
             rootParam.DescriptorTable.NumDescriptorRanges = 1;
             rootParam.DescriptorTable.pDescriptorRanges = &r[2];
         }
+        {
+            // Bindless resources
+            D3D12_ROOT_PARAMETER& rootParam = rootParameters[DX12_ROOT_SIGNATURE_BINDLESS];
+            rootParam.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+            rootParam.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+            rootParam.DescriptorTable.NumDescriptorRanges = ARRAY_COUNT(rBindless);
+            rootParam.DescriptorTable.pDescriptorRanges = rBindless;
+        }
 
         // Static samplers
         D3D12_STATIC_SAMPLER_DESC staticSamplers[6];
@@ -653,7 +720,7 @@ bool GPUDeviceDX12::Init()
 
         // Init
         D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc;
-        rootSignatureDesc.NumParameters = ARRAY_COUNT(rootParameters);
+        rootSignatureDesc.NumParameters = Limits.HasBindlessResources ? ARRAY_COUNT(rootParameters) : ARRAY_COUNT(rootParameters) - 1;
         rootSignatureDesc.pParameters = rootParameters;
         rootSignatureDesc.NumStaticSamplers = ARRAY_COUNT(staticSamplers);
         rootSignatureDesc.pStaticSamplers = staticSamplers;
@@ -670,6 +737,12 @@ bool GPUDeviceDX12::Init()
 
     // Upload buffer
     UploadBuffer = New<UploadBufferDX12>(this);
+    UploadQueue = New<UploadQueueDX12>(this);
+    if (UploadQueue->Init())
+    {
+        LOG(Warning, "Failed to create the copy queue. Async data uploads will be disabled.");
+        SAFE_DELETE(UploadQueue);
+    }
 
     if (TimestampQueryHeap.Init())
         return true;
@@ -691,16 +764,185 @@ bool GPUDeviceDX12::Init()
         DispatchIndirectCommandSignature->Finalize();
     }
 
+#if DX12_PIPELINE_LIBRARY
+    // Pipeline library with the pipeline state objects compiled in the previous runs
+    {
+        ComPtr<ID3D12Device1> device1;
+        if (SUCCEEDED(_device->QueryInterface(IID_PPV_ARGS(&device1))))
+        {
+            String path;
+            GetPipelineLibraryPath(path);
+            if (FileSystem::FileExists(path))
+            {
+                LOG(Info, "Trying to load DirectX 12 pipeline library file {0}", path);
+                File::ReadAllBytes(path, _pipelineLibraryData);
+            }
+            HRESULT result = E_FAIL;
+            if (_pipelineLibraryData.Count() > sizeof(uint32) && *(uint32*)_pipelineLibraryData.Get() == FLAXENGINE_VERSION_BUILD)
+                result = device1->CreatePipelineLibrary(_pipelineLibraryData.Get() + sizeof(uint32), _pipelineLibraryData.Count() - sizeof(uint32), IID_PPV_ARGS(&_pipelineLibrary));
+            if (FAILED(result))
+            {
+                // Start with an empty library (eg. file is missing or invalidated after the driver or engine update)
+                _pipelineLibraryData.Resize(0);
+                result = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&_pipelineLibrary));
+                LOG_DIRECTX_RESULT(result);
+                if (FAILED(result))
+                    _pipelineLibrary = nullptr;
+            }
+        }
+    }
+#endif
+
     _state = DeviceState::Ready;
     return GPUDeviceDX::Init();
 }
 
+ID3D12PipelineState* GPUDeviceDX12::CreateGraphicsPipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, uint32 descHash, const GPUPipelineStateKeyDX12& key)
+{
+    ID3D12PipelineState* state = nullptr;
+#if DX12_PIPELINE_LIBRARY
+    Char name[32];
+    if (_pipelineLibrary)
+    {
+        // Try to load the object compiled in the previous runs
+        swprintf(name, ARRAY_COUNT(name), L"%08x%08x", descHash, GetHash(key));
+        ScopeLock lock(_pipelineLibraryLocker);
+        if (SUCCEEDED(_pipelineLibrary->LoadGraphicsPipeline(name, &desc, IID_PPV_ARGS(&state))))
+            return state;
+        state = nullptr;
+    }
+#endif
+
+    // Compile a new object
+    const HRESULT result = _device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&state));
+    LOG_DIRECTX_RESULT(result);
+    if (FAILED(result))
+        return nullptr;
+
+#if DX12_PIPELINE_LIBRARY
+    if (_pipelineLibrary)
+    {
+        // Store it for the next runs (fails if the name is used by a different description, eg. hash collision)
+        ScopeLock lock(_pipelineLibraryLocker);
+        _pipelineLibrary->StorePipeline(name, state);
+    }
+#endif
+    return state;
+}
+
+int32 GPUDeviceDX12::AllocateBindless(D3D12_CPU_DESCRIPTOR_HANDLE srv)
+{
+    uint32 index;
+    if (!Limits.HasBindlessResources || srv.ptr == 0 || RingHeap_CBV_SRV_UAV.AllocatePersistent(index))
+        return -1;
+    _device->CopyDescriptorsSimple(1, RingHeap_CBV_SRV_UAV.CPU(index), srv, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    return (int32)index;
+}
+
+void GPUDeviceDX12::ReleaseBindless(int32& index)
+{
+    if (index != -1)
+    {
+        if (_state != DeviceState::Disposed)
+            RingHeap_CBV_SRV_UAV.ReleasePersistent((uint32)index);
+        index = -1;
+    }
+}
+
+bool GPUDeviceDX12::LoadPipelineStatesManifest(const StringView& path)
+{
+    return PipelineStatesManifest.Load(path, GetRendererType());
+}
+
+bool GPUDeviceDX12::SavePipelineStatesManifest(const StringView& path) const
+{
+    return PipelineStatesManifest.Save(path, GetRendererType());
+}
+
+void* GPUDeviceDX12::AllocateAliasingMemory(uint64 size)
+{
+    D3D12_HEAP_DESC heapDesc;
+    heapDesc.SizeInBytes = size;
+    heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+    heapDesc.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    heapDesc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    heapDesc.Properties.CreationNodeMask = 1;
+    heapDesc.Properties.VisibleNodeMask = 1;
+    heapDesc.Alignment = D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT;
+    heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ALL_BUFFERS_AND_TEXTURES;
+    ID3D12Heap* heap = nullptr;
+    const HRESULT result = _device->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap));
+    if (FAILED(result))
+    {
+        LOG_DIRECTX_RESULT(result);
+        return nullptr;
+    }
+    return heap;
+}
+
+void GPUDeviceDX12::ReleaseAliasingMemory(void* memory)
+{
+    AddResourceToLateRelease((ID3D12Heap*)memory);
+}
+
+bool GPUDeviceDX12::GetAliasedTextureSize(const GPUTextureDescription& desc, uint64& size, uint64& alignment)
+{
+    if (desc.Usage == GPUResourceUsage::StagingUpload || desc.Usage == GPUResourceUsage::StagingReadback)
+        return true;
+    D3D12_RESOURCE_DESC resourceDesc;
+    GPUTextureDX12::GetResourceDesc(desc, resourceDesc);
+    const D3D12_RESOURCE_ALLOCATION_INFO info = _device->GetResourceAllocationInfo(0, 1, &resourceDesc);
+    if (info.SizeInBytes == MAX_uint64)
+        return true;
+    size = info.SizeInBytes;
+    alignment = info.Alignment;
+    return false;
+}
+
+GPUTexture* GPUDeviceDX12::CreateAliasedTexture(const StringView& name, const GPUTextureDescription& desc, void* memory, uint64 offset)
+{
+    auto texture = New<GPUTextureDX12>(this, name);
+    texture->SetAliasingMemory((ID3D12Heap*)memory, offset);
+    if (texture->Init(desc))
+    {
+        texture->DeleteObjectNow();
+        return nullptr;
+    }
+    return texture;
+}
+
+#if DX12_PIPELINE_LIBRARY
+
+void GPUDeviceDX12::savePipelineLibrary()
+{
+    if (!_pipelineLibrary)
+        return;
+    ScopeLock lock(_pipelineLibraryLocker);
+    const SIZE_T size = _pipelineLibrary->GetSerializedSize();
+    if (size == 0)
+        return;
+    Array<byte> data;
+    data.Resize((int32)(size + sizeof(uint32)));
+    *(uint32*)data.Get() = FLAXENGINE_VERSION_BUILD;
+    const HRESULT result = _pipelineLibrary->Serialize(data.Get() + sizeof(uint32), size);
+    LOG_DIRECTX_RESULT(result);
+    if (SUCCEEDED(result))
+    {
+        String path;
+        GetPipelineLibraryPath(path);
+        File::WriteAllBytes(path, data);
+    }
+}
+
+#endif
+
 void GPUDeviceDX12::DrawBegin()
 {
     {
         PROFILE_CPU_NAMED("Wait For GPU");
         //_commandQueue->WaitForGPU();
-        _commandQueue->WaitForFence(_mainContext->FrameFenceValues[1]);
+        const int32 framesInFlight = Math::Clamp(Graphics::MaxFramesInFlight, 1, GPU_MAX_FRAMES_IN_FLIGHT);
+        _commandQueue->WaitForFence(_mainContext->FrameFenceValues[framesInFlight - 1]);
     }
 
     // Base
@@ -759,6 +1001,11 @@ void GPUDeviceDX12::Dispose()
     // Wait for rendering end
     WaitForGPU();
 
+    // Save the compiled pipeline state objects for the next runs
+#if DX12_PIPELINE_LIBRARY
+    savePipelineLibrary();
+#endif
+
     // Pre dispose
     preDispose();
 
@@ -771,14 +1018,21 @@ void GPUDeviceDX12::Dispose()
     _nullUav.Release();
     TimestampQueryHeap.Destroy();
     DX_SAFE_RELEASE_CHECK(_rootSignature, 0);
+#if DX12_PIPELINE_LIBRARY
+    SAFE_RELEASE(_pipelineLibrary);
+    _pipelineLibraryData.Resize(0);
+#endif
     Heap_CBV_SRV_UAV.ReleaseGPU();
     Heap_RTV.ReleaseGPU();
     Heap_DSV.ReleaseGPU();
     Heap_Sampler.ReleaseGPU();
     RingHeap_CBV_SRV_UAV.ReleaseGPU();
     RingHeap_Sampler.ReleaseGPU();
+    SAFE_DELETE(UploadQueue);
     SAFE_DELETE(UploadBuffer);
     SAFE_DELETE(DrawIndirectCommandSignature);
+    SAFE_DELETE(_asyncComputeContext);
+    SAFE_DELETE(_computeQueue);
     SAFE_DELETE(_mainContext);
     SAFE_DELETE(_commandQueue);
 
@@ -796,6 +1050,10 @@ void GPUDeviceDX12::Dispose()
 
 void GPUDeviceDX12::WaitForGPU()
 {
+    if (UploadQueue)
+        UploadQueue->WaitForGPU();
+    if (_computeQueue)
+        _computeQueue->WaitForGPU();
     _commandQueue->WaitForGPU();
 }
 
@@ -839,6 +1097,31 @@ GPUConstantBuffer* GPUDeviceDX12::CreateConstantBuffer(uint32 size, const String
     return New<GPUConstantBufferDX12>(this, size, name);
 }
 
+GPUContext* GPUDeviceDX12::CreateDeferredContext()
+{
+    auto context = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_DIRECT, true);
+    context->Reset();
+    return context;
+}
+
+void GPUDeviceDX12::ExecuteDeferredContexts(const Span<GPUContext*>& contexts)
+{
+    PROFILE_CPU();
+
+    // Submit commands recorded so far by the main context to keep the order
+    _mainContext->Execute(false);
+    _mainContext->Reset();
+
+    // Submit deferred contexts (queue executes command lists in the order of submission)
+    for (GPUContext* e : contexts)
+    {
+        auto context = (GPUContextDX12*)e;
+        ASSERT(context->IsDeferred());
+        context->Execute(false);
+        context->Reset();
+    }
+}
+
 void GPUDeviceDX12::AddResourceToLateRelease(IGraphicsUnknown* resource, uint32 safeFrameCount)
 {
     if (resource == nullptr)
@@ -10,6 +10,7 @@
 #include "ResourceOwnerDX12.h"
 #include "QueryHeapDX12.h"
 #include "DescriptorHeapDX12.h"
+#include "Engine/Graphics/GPUPipelineStatesManifest.h"
 
 #if PLATFORM_WINDOWS
 #define DX12_BACK_BUFFER_COUNT 3
@@ -17,19 +18,58 @@
 #define DX12_BACK_BUFFER_COUNT 2
 #endif
 
+// Enables using the pipeline library to cache the compiled pipeline state objects between the application runs
+#define DX12_PIPELINE_LIBRARY PLATFORM_WINDOWS
+
 #define DX12_ROOT_SIGNATURE_CB 0
 #define DX12_ROOT_SIGNATURE_SR (GPU_MAX_CB_BINDED+0)
 #define DX12_ROOT_SIGNATURE_UA (GPU_MAX_CB_BINDED+1)
 #define DX12_ROOT_SIGNATURE_SAMPLER (GPU_MAX_CB_BINDED+2)
+#define DX12_ROOT_SIGNATURE_BINDLESS (GPU_MAX_CB_BINDED+3)
+
+// The amount of the descriptors reserved at the beginning of the shader-visible heap for the bindless resources
+#define DX12_BINDLESS_DESCRIPTORS_COUNT (64 * 1024)
 
 class Engine;
 class WindowsWindow;
 class GPUContextDX12;
 class GPUSwapChainDX12;
 class UploadBufferDX12;
+class UploadQueueDX12;
 class CommandQueueDX12;
 class CommandSignatureDX12;
 
+/// <summary>
+/// The render targets setup of the graphics pipeline state object.
+/// </summary>
+struct GPUPipelineStateKeyDX12
+{
+    int32 RTsCount;
+    MSAALevel MSAA;
+    PixelFormat DepthFormat;
+    PixelFormat RTVsFormats[GPU_MAX_RT_BINDED];
+
+    bool operator==(const GPUPipelineStateKeyDX12& other) const
+    {
+        return Platform::MemoryCompare((void*)this, &other, sizeof(GPUPipelineStateKeyDX12)) == 0;
+    }
+
+    friend inline uint32 GetHash(const GPUPipelineStateKeyDX12& key)
+    {
+        uint32 hash = (int32)key.MSAA * 11;
+        CombineHash(hash, (uint32)key.DepthFormat * 93473262);
+        CombineHash(hash, key.RTsCount * 136);
+        CombineHash(hash, (uint32)key.RTVsFormats[0]);
+        CombineHash(hash, (uint32)key.RTVsFormats[1]);
+        CombineHash(hash, (uint32)key.RTVsFormats[2]);
+        CombineHash(hash, (uint32)key.RTVsFormats[3]);
+        CombineHash(hash, (uint32)key.RTVsFormats[4]);
+        CombineHash(hash, (uint32)key.RTVsFormats[5]);
+        static_assert(GPU_MAX_RT_BINDED == 6, "Update hash combine code to match RT count (manually inlined loop).");
+        return hash;
+    }
+};
+
 /// <summary>
 /// Implementation of Graphics Device for DirectX 12 rendering system
 /// </summary>
@@ -58,6 +98,15 @@ class GPUDeviceDX12 : public GPUDeviceDX
     ID3D12RootSignature* _rootSignature;
     CommandQueueDX12* _commandQueue;
     GPUContextDX12* _mainContext;
+    CommandQueueDX12* _computeQueue;
+    GPUContextDX12* _asyncComputeContext;
+
+#if DX12_PIPELINE_LIBRARY
+    // Persistent pipeline state objects cache
+    ID3D12PipelineLibrary* _pipelineLibrary = nullptr;
+    Array<byte> _pipelineLibraryData;
+    CriticalSection _pipelineLibraryLocker;
+#endif
 
     // Heaps
     DescriptorHeapWithSlotsDX12::Slot _nullSrv[D3D12_SRV_DIMENSION_TEXTURECUBEARRAY + 1];
@@ -76,6 +125,11 @@ class GPUDeviceDX12 : public GPUDeviceDX
     /// </summary>
     UploadBufferDX12* UploadBuffer;
 
+    /// <summary>
+    /// Upload queue for the data uploaded in the background on a copy queue (null if not supported).
+    /// </summary>
+    UploadQueueDX12* UploadQueue;
+
     /// <summary>
     /// The timestamp queries heap.
     /// </summary>
@@ -86,6 +140,16 @@ class GPUDeviceDX12 : public GPUDeviceDX
     CommandSignatureDX12* DrawIndexedIndirectCommandSignature = nullptr;
     CommandSignatureDX12* DrawIndirectCommandSignature = nullptr;
 
+    /// <summary>
+    /// The lock for the resources state tracking used by the deferred contexts recording commands in parallel.
+    /// </summary>
+    CriticalSection DeferredContextsLocker;
+
+    /// <summary>
+    /// The pipeline state objects created so far and the ones loaded from the manifest (used to prewarm pipeline states on init).
+    /// </summary>
+    GPUPipelineStatesManifest<GPUPipelineStateKeyDX12> PipelineStatesManifest;
+
     D3D12_CPU_DESCRIPTOR_HANDLE NullSRV(D3D12_SRV_DIMENSION dimension) const;
     D3D12_CPU_DESCRIPTOR_HANDLE NullUAV() const;
 
@@ -120,6 +184,14 @@ class GPUDeviceDX12 : public GPUDeviceDX
         return _commandQueue;
     }
 
+    /// <summary>
+    /// Gets async compute command queue.
+    /// </summary>
+    FORCE_INLINE CommandQueueDX12* GetComputeQueue() const
+    {
+        return _computeQueue;
+    }
+
     /// <summary>
     /// Gets DirectX 12 command queue object.
     /// </summary>
@@ -155,6 +227,28 @@ class GPUDeviceDX12 : public GPUDeviceDX
     // Add resource to late release service (will be released after 'safeFrameCount' frames)
     void AddResourceToLateRelease(IGraphicsUnknown* resource, uint32 safeFrameCount = DX12_RESOURCE_DELETE_SAFE_FRAMES_COUNT);
 
+    /// <summary>
+    /// Creates the graphics pipeline state object. Reuses the object compiled in the previous application runs if it's in the pipeline library.
+    /// </summary>
+    /// <param name="desc">The pipeline state description.</param>
+    /// <param name="descHash">The pipeline state description hash (stable between the application runs).</param>
+    /// <param name="key">The render targets setup.</param>
+    /// <returns>The created pipeline state object or null if failed.</returns>
+    ID3D12PipelineState* CreateGraphicsPipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, uint32 descHash, const GPUPipelineStateKeyDX12& key);
+
+    /// <summary>
+    /// Registers the shader resource view descriptor in the bindless resources table.
+    /// </summary>
+    /// <param name="srv">The shader resource view descriptor (copied into the table).</param>
+    /// <returns>The bindless resource index or -1 if failed (eg. bindless resources are not supported or the table is full).</returns>
+    int32 AllocateBindless(D3D12_CPU_DESCRIPTOR_HANDLE srv);
+
+    /// <summary>
+    /// Unregisters the resource from the bindless resources table (slot is reused once GPU is done with it).
+    /// </summary>
+    /// <param name="index">The bindless resource index. Reset to -1.</param>
+    void ReleaseBindless(int32& index);
+
     static FORCE_INLINE uint32 GetMaxMSAAQuality(uint32 sampleCount)
     {
         if (sampleCount <= 8)
@@ -173,6 +267,9 @@ class GPUDeviceDX12 : public GPUDeviceDX
     void updateFrameEvents();
 #endif
     void updateRes2Dispose();
+#if DX12_PIPELINE_LIBRARY
+    void savePipelineLibrary();
+#endif
 
 public:
 
@@ -181,6 +278,18 @@ class GPUDeviceDX12 : public GPUDeviceDX
     {
         return reinterpret_cast<GPUContext*>(_mainContext);
     }
+    GPUContext* GetAsyncComputeContext() override
+    {
+        return reinterpret_cast<GPUContext*>(_asyncComputeContext);
+    }
+    GPUContext* CreateDeferredContext() override;
+    void ExecuteDeferredContexts(const Span<GPUContext*>& contexts) override;
+    bool LoadPipelineStatesManifest(const StringView& path) override;
+    bool SavePipelineStatesManifest(const StringView& path) const override;
+    void* AllocateAliasingMemory(uint64 size) override;
+    void ReleaseAliasingMemory(void* memory) override;
+    bool GetAliasedTextureSize(const GPUTextureDescription& desc, uint64& size, uint64& alignment) override;
+    GPUTexture* CreateAliasedTexture(const StringView& name, const GPUTextureDescription& desc, void* memory, uint64 offset) override;
     void* GetNativePtr() const override
     {
         return _device;
@@ -7,6 +7,7 @@
 #include "GPUTextureDX12.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
 
 GPUPipelineStateDX12::GPUPipelineStateDX12(GPUDeviceDX12* device)
@@ -35,7 +36,13 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     for (int32 i = rtCount; i < GPU_MAX_RT_BINDED; i++)
         key.RTVsFormats[i] = PixelFormat::Unknown;
 
+    return GetState(key);
+}
+
+ID3D12PipelineState* GPUPipelineStateDX12::GetState(const GPUPipelineStateKeyDX12& key)
+{
     // Try reuse cached version
+    ScopeLock lock(_statesLocker);
     ID3D12PipelineState* state = nullptr;
     if (_states.TryGet(key, state))
     {
@@ -60,9 +67,8 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     _desc.DSVFormat = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(key.DepthFormat));
 
     // Create object
-    const HRESULT result = _device->GetDevice()->CreateGraphicsPipelineState(&_desc, IID_PPV_ARGS(&state));
-    LOG_DIRECTX_RESULT(result);
-    if (FAILED(result))
+    state = _device->CreateGraphicsPipelineState(_desc, GetHash(), key);
+    if (!state)
         return nullptr;
 #if GPU_ENABLE_RESOURCE_NAMING && BUILD_DEBUG
     char name[200];
@@ -105,6 +111,7 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
 
     // Cache it
     _states.Add(key, state);
+    _device->PipelineStatesManifest.Add(GetHash(), key);
 
     return state;
 }
@@ -230,7 +237,19 @@ bool GPUPipelineStateDX12::Init(const Description& desc)
     // Set non-zero memory usage
     _memoryUsage = sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC);
 
-    return GPUPipelineState::Init(desc);
+    if (GPUPipelineState::Init(desc))
+        return true;
+
+    // Prewarm the pipeline state objects recorded for this pipeline state (eg. from the loaded manifest)
+    Array<GPUPipelineStateKeyDX12> keys;
+    if (_device->PipelineStatesManifest.Get(GetHash(), keys))
+    {
+        PROFILE_CPU_NAMED("Prewarm Pipeline States");
+        for (const GPUPipelineStateKeyDX12& key : keys)
+            GetState(key);
+    }
+
+    return false;
 }
 
 #endif
@@ -11,34 +11,6 @@
 
 class GPUTextureViewDX12;
 
-struct GPUPipelineStateKeyDX12
-{
-    int32 RTsCount;
-    MSAALevel MSAA;
-    PixelFormat DepthFormat;
-    PixelFormat RTVsFormats[GPU_MAX_RT_BINDED];
-
-    bool operator==(const GPUPipelineStateKeyDX12& other) const
-    {
-        return Platform::MemoryCompare((void*)this, &other, sizeof(GPUPipelineStateKeyDX12)) == 0;
-    }
-
-    friend inline uint32 GetHash(const GPUPipelineStateKeyDX12& key)
-    {
-        uint32 hash = (int32)key.MSAA * 11;
-        CombineHash(hash, (uint32)key.DepthFormat * 93473262);
-        CombineHash(hash, key.RTsCount * 136);
-        CombineHash(hash, (uint32)key.RTVsFormats[0]);
-        CombineHash(hash, (uint32)key.RTVsFormats[1]);
-        CombineHash(hash, (uint32)key.RTVsFormats[2]);
-        CombineHash(hash, (uint32)key.RTVsFormats[3]);
-        CombineHash(hash, (uint32)key.RTVsFormats[4]);
-        CombineHash(hash, (uint32)key.RTVsFormats[5]);
-        static_assert(GPU_MAX_RT_BINDED == 6, "Update hash combine code to match RT count (manually inlined loop).");
-        return hash;
-    }
-};
-
 /// <summary>
 /// Graphics pipeline state object for DirectX 12 backend.
 /// </summary>
@@ -47,6 +19,7 @@ class GPUPipelineStateDX12 : public GPUResourceDX12<GPUPipelineState>
 private:
 
     Dictionary<GPUPipelineStateKeyDX12, ID3D12PipelineState*> _states;
+    CriticalSection _statesLocker;
     D3D12_GRAPHICS_PIPELINE_STATE_DESC _desc;
 
 public:
@@ -67,6 +40,13 @@ class GPUPipelineStateDX12 : public GPUResourceDX12<GPUPipelineState>
     /// <returns>DirectX 12 graphics pipeline state object</returns>
     ID3D12PipelineState* GetState(GPUTextureViewDX12* depth, int32 rtCount, GPUTextureViewDX12** rtHandles);
 
+    /// <summary>
+    /// Gets DirectX 12 graphics pipeline state object for the given render targets setup. Uses caching.
+    /// </summary>
+    /// <param name="key">The render targets setup.</param>
+    /// <returns>DirectX 12 graphics pipeline state object</returns>
+    ID3D12PipelineState* GetState(const GPUPipelineStateKeyDX12& key);
+
 public:
 
     // [GPUPipelineState]
@@ -6,6 +6,8 @@
 #include "GPUContextDX12.h"
 #include "../IncludeDirectXHeaders.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 void BackBufferDX12::Setup(GPUSwapChainDX12* window, ID3D12Resource* backbuffer)
 {
@@ -53,6 +55,11 @@ GPUSwapChainDX12::GPUSwapChainDX12(GPUDeviceDX12* device, Window* window)
     , _currentFrameIndex(0)
     , _allowTearing(false)
     , _isFullscreen(false)
+#if !(PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE)
+    , _frameLatencyWaitableObject(nullptr)
+    , _frameLatency(0)
+    , _frameLatencyWaited(false)
+#endif
 {
     ASSERT(_windowHandle);
     _window = window;
@@ -73,6 +80,15 @@ void GPUSwapChainDX12::OnReleaseGPU()
     // Release data
     releaseBackBuffer();
     _backBuffers.Resize(0);
+#if !(PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE)
+    if (_frameLatencyWaitableObject)
+    {
+        CloseHandle(_frameLatencyWaitableObject);
+        _frameLatencyWaitableObject = nullptr;
+    }
+    _frameLatency = 0;
+    _frameLatencyWaited = false;
+#endif
     if (_swapChain)
     {
         _device->AddResourceToLateRelease(_swapChain);
@@ -176,6 +192,8 @@ bool GPUSwapChainDX12::Resize(int32 width, int32 height)
 
     getBackBuffer();
 #else
+    // Use more back buffers for the deeper frames pipelining
+    const int32 bufferCount = Math::Clamp(Graphics::MaxFramesInFlight + 1, DX12_BACK_BUFFER_COUNT, GPU_MAX_FRAMES_IN_FLIGHT + 1);
     DXGI_SWAP_CHAIN_DESC1 swapChainDesc;
     if (_swapChain == nullptr)
     {
@@ -189,8 +207,8 @@ bool GPUSwapChainDX12::Resize(int32 width, int32 height)
         swapChainDesc.SampleDesc.Count = 1;
         swapChainDesc.SampleDesc.Quality = 0;
         swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-        swapChainDesc.BufferCount = DX12_BACK_BUFFER_COUNT;
-        swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
+        swapChainDesc.BufferCount = bufferCount;
+        swapChainDesc.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH | DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
         swapChainDesc.Scaling = DXGI_SCALING_STRETCH;
         swapChainDesc.AlphaMode = DXGI_ALPHA_MODE_UNSPECIFIED;
         swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
@@ -227,6 +245,8 @@ bool GPUSwapChainDX12::Resize(int32 width, int32 height)
         DX_SET_DEBUG_NAME_EX(_swapChain, TEXT("RenderOutput"), TEXT("SwapChain"), TEXT(""));
         _swapChain->SetBackgroundColor((const DXGI_RGBA*)Color::Black.Raw);
         _backBuffers.Resize(swapChainDesc.BufferCount);
+        _frameLatencyWaitableObject = _swapChain->GetFrameLatencyWaitableObject();
+        updateFrameLatency();
 
         // Disable DXGI changes to the window
         VALIDATE_DIRECTX_RESULT(dxgiFactory->MakeWindowAssociation(_windowHandle, DXGI_MWA_NO_ALT_ENTER));
@@ -236,6 +256,8 @@ bool GPUSwapChainDX12::Resize(int32 width, int32 height)
         releaseBackBuffer();
 
         _swapChain->GetDesc1(&swapChainDesc);
+        swapChainDesc.BufferCount = bufferCount;
+        _backBuffers.Resize(swapChainDesc.BufferCount);
 
         VALIDATE_DIRECTX_RESULT(_swapChain->ResizeBuffers(swapChainDesc.BufferCount, width, height, swapChainDesc.Format, swapChainDesc.Flags));
     }
@@ -291,7 +313,9 @@ void GPUSwapChainDX12::CopyBackbuffer(GPUContext* context, GPUTexture* dst)
 
 void GPUSwapChainDX12::getBackBuffer()
 {
+#if PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE
     _backBuffers.Resize(DX12_BACK_BUFFER_COUNT);
+#endif
     for (int32 i = 0; i < _backBuffers.Count(); i++)
     {
         ID3D12Resource* backbuffer;
@@ -331,19 +355,46 @@ void GPUSwapChainDX12::getBackBuffer()
     }
 }
 
-#if PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE
+void GPUSwapChainDX12::updateFrameLatency()
+{
+#if !(PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE)
+    // Low-latency mode queues a single frame, otherwise allow to queue frames up to the frames in flight limit
+    const int32 frameLatency = Graphics::LowLatencyMode ? 1 : Math::Clamp(Graphics::MaxFramesInFlight, 1, GPU_MAX_FRAMES_IN_FLIGHT);
+    if (_swapChain && _frameLatency != frameLatency)
+    {
+        _frameLatency = frameLatency;
+        LOG_DIRECTX_RESULT(_swapChain->SetMaximumFrameLatency(frameLatency));
+    }
+#endif
+}
+
+void GPUSwapChainDX12::WaitForFrameLatency()
+{
+#if !(PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE)
+    if (_frameLatencyWaitableObject && !_frameLatencyWaited)
+    {
+        PROFILE_CPU_NAMED("Wait For Frame Latency");
+        _frameLatencyWaited = true;
+        updateFrameLatency();
+        WaitForSingleObjectEx(_frameLatencyWaitableObject, 1000, TRUE);
+    }
+#endif
+}
 
 void GPUSwapChainDX12::Begin(RenderTask* task)
 {
+#if PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE
     // Wait until frame start is signaled
     _framePipelineToken = D3D12XBOX_FRAME_PIPELINE_TOKEN_NULL;
     VALIDATE_DIRECTX_RESULT(_device->GetDevice()->WaitFrameEventX(D3D12XBOX_FRAME_EVENT_ORIGIN, INFINITE, nullptr, D3D12XBOX_WAIT_FRAME_EVENT_FLAG_NONE, &_framePipelineToken));
+#else
+    // Wait until swap chain can queue the next frame (no-op if already waited before the update in low-latency mode)
+    WaitForFrameLatency();
+#endif
 
     GPUSwapChain::Begin(task);
 }
 
-#endif
-
 void GPUSwapChainDX12::End(RenderTask* task)
 {
     GPUSwapChain::End(task);
@@ -382,6 +433,7 @@ void GPUSwapChainDX12::Present(bool vsync)
     }
     const HRESULT res = _swapChain->Present(vsync ? 1 : 0, presentFlags);
     LOG_DIRECTX_RESULT(res);
+    _frameLatencyWaited = false;
 
     // Base
     GPUSwapChain::Present(vsync);
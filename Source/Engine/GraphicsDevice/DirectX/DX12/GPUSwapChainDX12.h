@@ -64,8 +64,12 @@ class GPUSwapChainDX12 : public GPUResourceDX12<GPUSwapChain>
     int32 _currentFrameIndex;
 #if PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE
     D3D12XBOX_FRAME_PIPELINE_TOKEN _framePipelineToken;
+#else
+    HANDLE _frameLatencyWaitableObject;
+    int32 _frameLatency;
+    bool _frameLatencyWaited;
 #endif
-    Array<BackBufferDX12, FixedAllocation<4>> _backBuffers;
+    Array<BackBufferDX12, FixedAllocation<GPU_MAX_FRAMES_IN_FLIGHT + 1>> _backBuffers;
 
 public:
 
@@ -95,6 +99,7 @@ class GPUSwapChainDX12 : public GPUResourceDX12<GPUSwapChain>
 
     void getBackBuffer();
     void releaseBackBuffer();
+    void updateFrameLatency();
 
 public:
 
@@ -102,9 +107,8 @@ class GPUSwapChainDX12 : public GPUResourceDX12<GPUSwapChain>
     bool IsFullscreen() override;
     void SetFullscreen(bool isFullscreen) override;
     GPUTextureView* GetBackBufferView() override;
-#if PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE
+    void WaitForFrameLatency() override;
     void Begin(RenderTask* task) override;
-#endif
     void End(RenderTask* task) override;
     void Present(bool vsync) override;
     bool Resize(int32 width, int32 height) override;
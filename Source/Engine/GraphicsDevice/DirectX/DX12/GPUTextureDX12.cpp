@@ -69,14 +69,43 @@ bool GPUTextureDX12::GetData(int32 arrayOrDepthSliceIndex, int32 mipMapIndex, Te
     return false;
 }
 
+void GPUTextureDX12::GetResourceDesc(const GPUTextureDescription& desc, D3D12_RESOURCE_DESC& resourceDesc)
+{
+    resourceDesc.MipLevels = desc.MipLevels;
+    resourceDesc.Format = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::MakeTypeless(desc.Format));
+    resourceDesc.Width = desc.Width;
+    resourceDesc.Height = desc.Height;
+    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+    resourceDesc.DepthOrArraySize = desc.IsVolume() ? desc.Depth : desc.ArraySize;
+    resourceDesc.SampleDesc.Count = static_cast<UINT>(desc.MultiSampleLevel);
+    resourceDesc.SampleDesc.Quality = desc.IsMultiSample() ? GPUDeviceDX12::GetMaxMSAAQuality((int32)desc.MultiSampleLevel) : 0;
+    resourceDesc.Alignment = 0;
+    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+    resourceDesc.Dimension = desc.IsVolume() ? D3D12_RESOURCE_DIMENSION_TEXTURE3D : D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    if (desc.IsRenderTarget())
+    {
+        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+    }
+    else if (desc.IsDepthStencil())
+    {
+        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+        if (!desc.IsShaderResource())
+        {
+            resourceDesc.Flags |= D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
+        }
+    }
+    if (desc.IsUnorderedAccess())
+    {
+        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+    }
+}
+
 bool GPUTextureDX12::OnInit()
 {
     ID3D12Resource* resource;
 
     // Cache formats
     const PixelFormat format = Format();
-    const PixelFormat typelessFormat = PixelFormatExtensions::MakeTypeless(format);
-    const DXGI_FORMAT dxgiFormat = RenderToolsDX::ToDxgiFormat(typelessFormat);
     _dxgiFormatDSV = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(format));
     _dxgiFormatSRV = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindShaderResourceFormat(format, _sRGB));
     _dxgiFormatRTV = _dxgiFormatSRV;
@@ -88,7 +117,6 @@ bool GPUTextureDX12::OnInit()
     bool useDSV = IsDepthStencil();
     bool useRTV = IsRenderTarget();
     bool useUAV = IsUnorderedAccess();
-    int32 depthOrArraySize = IsVolume() ? Depth() : ArraySize();
 
     if (IsStaging())
     {
@@ -124,35 +152,11 @@ bool GPUTextureDX12::OnInit()
 
     // Create texture description
     D3D12_RESOURCE_DESC resourceDesc;
-    resourceDesc.MipLevels = _desc.MipLevels;
-    resourceDesc.Format = dxgiFormat;
-    resourceDesc.Width = _desc.Width;
-    resourceDesc.Height = _desc.Height;
-    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-    resourceDesc.DepthOrArraySize = depthOrArraySize;
-    resourceDesc.SampleDesc.Count = static_cast<UINT>(_desc.MultiSampleLevel);
-    resourceDesc.SampleDesc.Quality = IsMultiSample() ? GPUDeviceDX12::GetMaxMSAAQuality((int32)_desc.MultiSampleLevel) : 0;
-    resourceDesc.Alignment = 0;
-    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
-    resourceDesc.Dimension = IsVolume() ? D3D12_RESOURCE_DIMENSION_TEXTURE3D : D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    GetResourceDesc(_desc, resourceDesc);
     if (useRTV)
-    {
-        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
         initialState = D3D12_RESOURCE_STATE_RENDER_TARGET;
-    }
     else if (useDSV)
-    {
-        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
         initialState = D3D12_RESOURCE_STATE_DEPTH_WRITE;
-        if (!useSRV)
-        {
-            resourceDesc.Flags |= D3D12_RESOURCE_FLAG_DENY_SHADER_RESOURCE;
-        }
-    }
-    if (useUAV)
-    {
-        resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
-    }
 
     // Create heap properties
     D3D12_HEAP_PROPERTIES heapProperties;
@@ -183,7 +187,11 @@ bool GPUTextureDX12::OnInit()
         initialState = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
 
     // Create texture
-    auto result = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
+    HRESULT result;
+    if (_aliasingHeap)
+        result = device->CreatePlacedResource(_aliasingHeap, _aliasingOffset, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
+    else
+        result = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
     LOG_DIRECTX_RESULT_WITH_RETURN(result);
 
     // Set state
@@ -264,6 +272,8 @@ void GPUTextureViewDX12::Release()
     _srv.Release();
     _dsv.Release();
     _uav.Release();
+    if (_device)
+        _device->ReleaseBindless(_bindlessIndex);
 }
 
 void GPUTextureViewDX12::SetRTV(D3D12_RENDER_TARGET_VIEW_DESC& rtvDesc)
@@ -275,6 +285,7 @@ void GPUTextureViewDX12::SetSRV(D3D12_SHADER_RESOURCE_VIEW_DESC& srvDesc)
 {
     SrvDimension = srvDesc.ViewDimension;
     _srv.CreateSRV(_device, _owner->GetResource(), &srvDesc);
+    _device->ReleaseBindless(_bindlessIndex); // Register the new descriptor on the next use
 }
 
 void GPUTextureViewDX12::SetDSV(D3D12_DEPTH_STENCIL_VIEW_DESC& dsvDesc)
@@ -19,6 +19,7 @@ class GPUTextureViewDX12 : public GPUTextureView, public IShaderResourceDX12
     GPUDeviceDX12* _device = nullptr;
     ResourceOwnerDX12* _owner = nullptr;
     DescriptorHeapWithSlotsDX12::Slot _rtv, _srv, _dsv, _uav;
+    int32 _bindlessIndex = -1;
 
 public:
 
@@ -104,6 +105,12 @@ class GPUTextureViewDX12 : public GPUTextureView, public IShaderResourceDX12
     {
         return (void*)(IShaderResourceDX12*)this;
     }
+    int32 GetBindlessIndex() override
+    {
+        if (_bindlessIndex == -1 && _srv.IsValid())
+            _bindlessIndex = _device->AllocateBindless(_srv.CPU());
+        return _bindlessIndex;
+    }
 
     // [IShaderResourceDX12]
     bool IsDepthStencilResource() const override
@@ -145,6 +152,9 @@ class GPUTextureDX12 : public GPUResourceDX12<GPUTexture>, public ResourceOwnerD
     DXGI_FORMAT _dxgiFormatRTV;
     DXGI_FORMAT _dxgiFormatUAV;
 
+    ID3D12Heap* _aliasingHeap = nullptr;
+    uint64 _aliasingOffset = 0;
+
 public:
 
     GPUTextureDX12(GPUDeviceDX12* device, const StringView& name)
@@ -152,6 +162,26 @@ class GPUTextureDX12 : public GPUResourceDX12<GPUTexture>, public ResourceOwnerD
     {
     }
 
+public:
+
+    /// <summary>
+    /// Sets the memory heap to place the texture resource in (used by the aliased textures). Must be called before the texture initialization.
+    /// </summary>
+    /// <param name="heap">The memory heap.</param>
+    /// <param name="offset">The offset in the heap (in bytes).</param>
+    void SetAliasingMemory(ID3D12Heap* heap, uint64 offset)
+    {
+        _aliasingHeap = heap;
+        _aliasingOffset = offset;
+    }
+
+    /// <summary>
+    /// Gets the description of the DirectX 12 texture resource.
+    /// </summary>
+    /// <param name="desc">The texture description.</param>
+    /// <param name="resourceDesc">The output resource description.</param>
+    static void GetResourceDesc(const GPUTextureDescription& desc, D3D12_RESOURCE_DESC& resourceDesc);
+
 private:
 
     void initHandles();
@@ -29,6 +29,7 @@ void ResourceOwnerDX12::releaseResource(uint32 safeFrameCount)
         auto resource = _resource;
         _resource = nullptr;
         _subresourcesCount = 0;
+        CopyFenceValue = 0;
         State.Release();
 
         ((GPUDeviceDX12*)GPUDevice::Instance)->AddResourceToLateRelease(resource, safeFrameCount);
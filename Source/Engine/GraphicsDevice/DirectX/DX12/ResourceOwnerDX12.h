@@ -85,6 +85,11 @@ class ResourceOwnerDX12
     /// </summary>
     ResourceStateDX12 State;
 
+    /// <summary>
+    /// The copy queue fence value of the pending upload to the resource (see UploadQueueDX12). The contexts that use the resource wait for it. Zero if unused.
+    /// </summary>
+    uint64 CopyFenceValue = 0;
+
 public:
 
     /// <summary>
@@ -6,6 +6,7 @@
 #include "GPUTextureDX12.h"
 #include "GPUContextDX12.h"
 #include "../RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
 
 UploadBufferDX12::UploadBufferDX12(GPUDeviceDX12* device)
     : _device(device)
@@ -29,6 +30,7 @@ DynamicAllocation UploadBufferDX12::Allocate(uint64 size, uint64 align)
 {
     const uint64 alignmentMask = align - 1;
     ASSERT((alignmentMask & align) == 0);
+    ScopeLock lock(_locker);
 
     // Check if use default or bigger page
     const bool useDefaultSize = size <= DX12_DEFAULT_UPLOAD_PAGE_SIZE;
@@ -140,6 +142,8 @@ bool UploadBufferDX12::UploadTexture(GPUContextDX12* context, ID3D12Resource* te
 
 void UploadBufferDX12::BeginGeneration(uint64 generation)
 {
+    ScopeLock lock(_locker);
+
     // Restore ready pages to be reused
     for (int32 i = 0; _usedPages.HasItems() && i < _usedPages.Count(); i++)
     {
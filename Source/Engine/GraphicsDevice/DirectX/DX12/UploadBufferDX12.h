@@ -9,8 +9,8 @@
 
 #define DX12_DEFAULT_UPLOAD_PAGE_SIZE (4 * 1014 * 1024) // 4 MB
 
-// Upload buffer generations timeout to dispose
-#define DX12_UPLOAD_PAGE_GEN_TIMEOUT DX12_BACK_BUFFER_COUNT
+// Upload buffer generations timeout to dispose (covers the maximum amount of frames in flight)
+#define DX12_UPLOAD_PAGE_GEN_TIMEOUT GPU_MAX_FRAMES_IN_FLIGHT
 
 // Upload buffer pages that are not used for a few frames are disposed
 #define DX12_UPLOAD_PAGE_NOT_USED_FRAME_TIMEOUT 60
@@ -160,6 +160,7 @@ class UploadBufferDX12
     UploadBufferPageDX12* _currentPage;
     uint64 _currentOffset;
     uint64 _currentGeneration;
+    CriticalSection _locker;
 
     Array<UploadBufferPageDX12*, InlinedAllocation<64>> _freePages;
     Array<UploadBufferPageDX12*, InlinedAllocation<64>> _usedPages;
@@ -0,0 +1,271 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "UploadQueueDX12.h"
+#include "GPUTextureDX12.h"
+#include "GPUBufferDX12.h"
+#include "GPUContextDX12.h"
+#include "../RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
+
+UploadQueueDX12::UploadQueueDX12(GPUDeviceDX12* device)
+    : _device(device)
+    , _queue(device, D3D12_COMMAND_LIST_TYPE_COPY)
+{
+}
+
+UploadQueueDX12::~UploadQueueDX12()
+{
+    Release();
+}
+
+bool UploadQueueDX12::Init()
+{
+    if (_queue.Init())
+        return true;
+    _ringPage = New<UploadBufferPageDX12>(_device, DX12_UPLOAD_QUEUE_RING_SIZE);
+    return false;
+}
+
+void UploadQueueDX12::Release()
+{
+    if (!_queue.IsReady())
+        return;
+    WaitForGPU();
+    _pending.Clear();
+    _ringRegions.Clear();
+    _ringHead = _ringUsed = _ringPendingSize = 0;
+    if (_ringPage)
+    {
+        _ringPage->ReleaseGPU();
+        Delete(_ringPage);
+        _ringPage = nullptr;
+    }
+    DX_SAFE_RELEASE_CHECK(_commandList, 0);
+    _queue.Release();
+}
+
+bool UploadQueueDX12::UploadBuffer(GPUContextDX12* context, GPUBufferDX12* buffer, uint32 bufferOffset, const void* data, uint64 size)
+{
+    if (buffer->GetResource() == nullptr || buffer->IsStaging())
+        return true;
+
+    // Allocate data
+    ScopeLock lock(_locker);
+    const DynamicAllocation allocation = allocate(size, 4);
+    if (allocation.IsInvalid())
+        return true;
+
+    // Copy data
+    Platform::MemoryCopy(allocation.CPUAddress, data, static_cast<size_t>(size));
+
+    // Copy queue accesses the resources in the common state
+    context->SetResourceState(buffer, D3D12_RESOURCE_STATE_COMMON);
+
+    // Record copy to execute on submit
+    auto& copy = _pending.AddOne();
+    copy.Owner = buffer;
+    copy.Resource = buffer->GetResource();
+    copy.SubresourceIndex = -1;
+    copy.DstOffset = bufferOffset;
+    copy.SrcOffset = allocation.Offset;
+    copy.Size = size;
+    buffer->CopyFenceValue = _queue._fence.GetCurrentValue();
+
+    return false;
+}
+
+bool UploadQueueDX12::UploadTexture(GPUContextDX12* context, GPUTextureDX12* texture, const void* srcData, uint32 srcRowPitch, uint32 srcSlicePitch, int32 mipIndex, int32 arrayIndex)
+{
+    if (texture->GetResource() == nullptr || texture->IsDepthStencil() || texture->IsMultiSample())
+        return true;
+    D3D12_RESOURCE_DESC resourceDesc = texture->GetResource()->GetDesc();
+    const UINT subresourceIndex = RenderToolsDX::CalcSubresourceIndex(mipIndex, arrayIndex, resourceDesc.MipLevels);
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+    uint32 numRows;
+    uint64 rowPitchAligned, mipSizeAligned;
+    _device->GetDevice()->GetCopyableFootprints(&resourceDesc, subresourceIndex, 1, 0, &footprint, &numRows, &rowPitchAligned, &mipSizeAligned);
+    rowPitchAligned = footprint.Footprint.RowPitch;
+    mipSizeAligned = rowPitchAligned * footprint.Footprint.Height;
+    const uint32 numSlices = resourceDesc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? Math::Max(1, resourceDesc.DepthOrArraySize >> mipIndex) : 1;
+    const uint64 sliceSizeAligned = numSlices * mipSizeAligned;
+
+    // Allocate data
+    ScopeLock lock(_locker);
+    const DynamicAllocation allocation = allocate(sliceSizeAligned, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+    if (allocation.IsInvalid())
+        return true;
+
+    byte* ptr = (byte*)srcData;
+    ASSERT(srcSlicePitch <= sliceSizeAligned);
+    if (srcSlicePitch == sliceSizeAligned)
+    {
+        // Copy data at once
+        Platform::MemoryCopy(allocation.CPUAddress, ptr, srcSlicePitch);
+    }
+    else
+    {
+        // Copy data per-row
+        byte* dst = static_cast<byte*>(allocation.CPUAddress);
+        ASSERT(srcRowPitch <= rowPitchAligned);
+        const uint32 numCopies = numSlices * numRows;
+        for (uint32 i = 0; i < numCopies; i++)
+        {
+            Platform::MemoryCopy(dst, ptr, srcRowPitch);
+            dst += rowPitchAligned;
+            ptr += srcRowPitch;
+        }
+    }
+
+    // Copy queue accesses the resources in the common state
+    context->SetResourceState(texture, D3D12_RESOURCE_STATE_COMMON, subresourceIndex);
+
+    // Record copy to execute on submit
+    auto& copy = _pending.AddOne();
+    copy.Owner = texture;
+    copy.Resource = texture->GetResource();
+    copy.SubresourceIndex = subresourceIndex;
+    copy.DstOffset = 0;
+    copy.SrcOffset = allocation.Offset;
+    copy.Size = sliceSizeAligned;
+    copy.Footprint = footprint.Footprint;
+    texture->CopyFenceValue = _queue._fence.GetCurrentValue();
+
+    return false;
+}
+
+void UploadQueueDX12::OnUse(GPUContextDX12* context, ResourceOwnerDX12* resource, uint64& waitValue)
+{
+    ScopeLock lock(_locker);
+    const uint64 value = resource->CopyFenceValue;
+    resource->CopyFenceValue = 0;
+    if (value > _queue._fence.GetLastSignaledValue())
+    {
+        // Copies are not submitted yet and the copy queue would wait for the commands of this context so record them here
+        for (int32 i = 0; i < _pending.Count(); i++)
+        {
+            const PendingCopy& copy = _pending[i];
+            if (copy.Owner != resource)
+                continue;
+            context->SetResourceState(resource, D3D12_RESOURCE_STATE_COPY_DEST, copy.SubresourceIndex);
+            context->FlushResourceBarriers();
+            recordCopy(context->GetCommandList(), copy);
+            _pending.RemoveAtKeepOrder(i);
+            i--;
+        }
+    }
+    else if (!_queue._fence.IsFenceComplete(value))
+    {
+        waitValue = Math::Max(waitValue, value);
+    }
+}
+
+void UploadQueueDX12::Submit(uint64 graphicsFenceValue)
+{
+    ScopeLock lock(_locker);
+
+    // Release the ring buffer space used by the completed copies
+    while (_ringRegions.HasItems() && _queue._fence.IsFenceComplete(_ringRegions[0].FenceValue))
+    {
+        _ringUsed -= _ringRegions[0].Size;
+        _ringRegions.RemoveAtKeepOrder(0);
+    }
+    if (_ringPendingSize == 0)
+        return;
+
+    // Wait for the main context commands that transition the resources into the common state
+    _device->GetCommandQueue()->_fence.WaitGPU(&_queue, graphicsFenceValue);
+
+    uint64 fenceValue;
+    if (_pending.HasItems())
+    {
+        // Record copies
+        ID3D12CommandAllocator* allocator = _queue.RequestAllocator();
+        if (_commandList)
+        {
+            _commandList->Reset(allocator, nullptr);
+        }
+        else
+        {
+            VALIDATE_DIRECTX_RESULT(_device->GetDevice()->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_COPY, allocator, nullptr, IID_PPV_ARGS(&_commandList)));
+#if GPU_ENABLE_RESOURCE_NAMING
+            _commandList->SetName(TEXT("UploadQueueDX12::CommandList"));
+#endif
+        }
+        for (const PendingCopy& copy : _pending)
+            recordCopy(_commandList, copy);
+        _pending.Clear();
+
+        // Execute copies
+        fenceValue = _queue.ExecuteCommandList(_commandList);
+        _queue.DiscardAllocator(fenceValue, allocator);
+    }
+    else
+    {
+        // All copies were recorded on the contexts that used the resources so just advance the fence to release the ring buffer space
+        fenceValue = _queue._fence.Signal(&_queue);
+    }
+
+    auto& region = _ringRegions.AddOne();
+    region.FenceValue = fenceValue;
+    region.Size = _ringPendingSize;
+    _ringPendingSize = 0;
+}
+
+void UploadQueueDX12::WaitGPU(CommandQueueDX12* queue, uint64 value)
+{
+    _queue._fence.WaitGPU(queue, value);
+}
+
+void UploadQueueDX12::WaitForGPU()
+{
+    // Don't signal the fence (its next value is used by the pending copies)
+    const uint64 value = _queue._fence.GetLastSignaledValue();
+    if (value != 0)
+        _queue.WaitForFence(value);
+}
+
+DynamicAllocation UploadQueueDX12::allocate(uint64 size, uint64 align)
+{
+    if (!_ringPage || !_ringPage->GetResource())
+        return DynamicAllocation();
+    const uint64 ringSize = _ringPage->Size;
+    uint64 offset = Math::AlignUp(_ringHead, align);
+    if (offset + size > ringSize)
+        offset = 0; // Wrap around
+    const uint64 end = offset + size;
+    const uint64 allocSize = offset >= _ringHead ? end - _ringHead : ringSize - _ringHead + end;
+
+    // Check if there is enough space (regions are released in the order of allocation so free space starts at the head)
+    if (_ringUsed + allocSize > ringSize)
+        return DynamicAllocation();
+    _ringUsed += allocSize;
+    _ringPendingSize += allocSize;
+    _ringHead = end;
+
+    return DynamicAllocation(static_cast<byte*>(_ringPage->CPUAddress) + offset, offset, size, _ringPage->GPUAddress + offset, _ringPage, 0);
+}
+
+void UploadQueueDX12::recordCopy(ID3D12GraphicsCommandList* commandList, const PendingCopy& copy) const
+{
+    if (copy.SubresourceIndex == -1)
+    {
+        commandList->CopyBufferRegion(copy.Resource, copy.DstOffset, _ringPage->GetResource(), copy.SrcOffset, copy.Size);
+    }
+    else
+    {
+        D3D12_TEXTURE_COPY_LOCATION dstLocation;
+        dstLocation.pResource = copy.Resource;
+        dstLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        dstLocation.SubresourceIndex = copy.SubresourceIndex;
+        D3D12_TEXTURE_COPY_LOCATION srcLocation;
+        srcLocation.pResource = _ringPage->GetResource();
+        srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+        srcLocation.PlacedFootprint.Offset = copy.SrcOffset;
+        srcLocation.PlacedFootprint.Footprint = copy.Footprint;
+        commandList->CopyTextureRegion(&dstLocation, 0, 0, 0, &srcLocation, nullptr);
+    }
+}
+
+#endif
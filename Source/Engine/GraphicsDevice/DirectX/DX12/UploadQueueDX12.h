@@ -0,0 +1,145 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "CommandQueueDX12.h"
+#include "UploadBufferDX12.h"
+
+#if GRAPHICS_API_DIRECTX12
+
+// The size of the ring buffer used by the copy queue uploads (larger uploads are recorded on the main context)
+#define DX12_UPLOAD_QUEUE_RING_SIZE (32 * 1024 * 1024) // 32 MB
+
+class GPUBufferDX12;
+
+/// <summary>
+/// Uploads data to the GPU resources using the copy queue (runs in parallel to the graphics queue). Data is staged in the ring buffer and the copies are submitted at the frame end. The contexts that use the resource wait for the copy fence before executing their commands.
+/// </summary>
+/// <remarks>
+/// The destination resource (or subresource) is transitioned into the common state on the main context and the copy queue waits for it, the copy queue leaves the resource in the common state (state decay). If the resource gets used before the copies submission then its copies are recorded on the context that uses it.
+/// </remarks>
+class UploadQueueDX12
+{
+private:
+
+    struct PendingCopy
+    {
+        ResourceOwnerDX12* Owner;
+        ID3D12Resource* Resource;
+        int32 SubresourceIndex;
+        uint64 DstOffset;
+        uint64 SrcOffset;
+        uint64 Size;
+        D3D12_SUBRESOURCE_FOOTPRINT Footprint;
+    };
+
+    struct RingRegion
+    {
+        uint64 FenceValue;
+        uint64 Size;
+    };
+
+    GPUDeviceDX12* _device;
+    CommandQueueDX12 _queue;
+    ID3D12GraphicsCommandList* _commandList = nullptr;
+    UploadBufferPageDX12* _ringPage = nullptr;
+    uint64 _ringHead = 0;
+    uint64 _ringUsed = 0;
+    uint64 _ringPendingSize = 0;
+    Array<RingRegion> _ringRegions;
+    Array<PendingCopy> _pending;
+    CriticalSection _locker;
+
+public:
+
+    /// <summary>
+    /// Init
+    /// </summary>
+    /// <param name="device">Graphics Device</param>
+    UploadQueueDX12(GPUDeviceDX12* device);
+
+    /// <summary>
+    /// Destructor
+    /// </summary>
+    ~UploadQueueDX12();
+
+public:
+
+    /// <summary>
+    /// Gets the copy command queue.
+    /// </summary>
+    FORCE_INLINE CommandQueueDX12* GetQueue()
+    {
+        return &_queue;
+    }
+
+    /// <summary>
+    /// Init resources
+    /// </summary>
+    /// <returns>True if cannot init, otherwise false</returns>
+    bool Init();
+
+    /// <summary>
+    /// Cleanup all stuff
+    /// </summary>
+    void Release();
+
+public:
+
+    /// <summary>
+    /// Uploads data to the buffer.
+    /// </summary>
+    /// <param name="context">The main GPU context (used to transition the buffer into the common state).</param>
+    /// <param name="buffer">Destination buffer</param>
+    /// <param name="bufferOffset">Destination buffer offset in bytes.</param>
+    /// <param name="data">Data to upload</param>
+    /// <param name="size">Size of the data in bytes</param>
+    /// <returns>True if cannot upload data (eg. ring buffer is full), otherwise false.</returns>
+    bool UploadBuffer(GPUContextDX12* context, GPUBufferDX12* buffer, uint32 bufferOffset, const void* data, uint64 size);
+
+    /// <summary>
+    /// Uploads data to the texture.
+    /// </summary>
+    /// <param name="context">The main GPU context (used to transition the texture into the common state).</param>
+    /// <param name="texture">Destination texture</param>
+    /// <param name="srcData">Data to upload</param>
+    /// <param name="srcRowPitch">Source data row pitch value to upload.</param>
+    /// <param name="srcSlicePitch">Source data slice pitch value to upload.</param>
+    /// <param name="mipIndex">Mip map to stream index</param>
+    /// <param name="arrayIndex">Texture array index</param>
+    /// <returns>True if cannot upload data (eg. ring buffer is full), otherwise false.</returns>
+    bool UploadTexture(GPUContextDX12* context, GPUTextureDX12* texture, const void* srcData, uint32 srcRowPitch, uint32 srcSlicePitch, int32 mipIndex, int32 arrayIndex);
+
+    /// <summary>
+    /// Called when the resource with the copy fence value gets used by the context. Records the not yet submitted copies of the resource on the context or makes the context wait for the copy fence.
+    /// </summary>
+    /// <param name="context">The GPU context that uses the resource.</param>
+    /// <param name="resource">The resource.</param>
+    /// <param name="waitValue">The copy fence value to wait for before the context commands execution (updated).</param>
+    void OnUse(GPUContextDX12* context, ResourceOwnerDX12* resource, uint64& waitValue);
+
+    /// <summary>
+    /// Submits the pending copies to the copy queue. Called after the main context commands execution at the frame end.
+    /// </summary>
+    /// <param name="graphicsFenceValue">The fence value of the main context commands that transition the resources into the common state.</param>
+    void Submit(uint64 graphicsFenceValue);
+
+    /// <summary>
+    /// Makes the queue wait (without blocking the CPU) for the copies up to the given fence value.
+    /// </summary>
+    /// <param name="queue">The queue that waits.</param>
+    /// <param name="value">The copy fence value.</param>
+    void WaitGPU(CommandQueueDX12* queue, uint64 value);
+
+    /// <summary>
+    /// Stalls the execution on current thread to wait for the submitted copies to finish.
+    /// </summary>
+    void WaitForGPU();
+
+private:
+
+    DynamicAllocation allocate(uint64 size, uint64 align);
+    void recordCopy(ID3D12GraphicsCommandList* commandList, const PendingCopy& copy) const;
+};
+
+#endif
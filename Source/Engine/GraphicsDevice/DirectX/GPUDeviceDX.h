@@ -97,6 +97,9 @@ class GPUDeviceDX : public GPUDevice
 protected:
 
     GPUAdapterDX* _adapter;
+#if PLATFORM_WINDOWS
+    ComPtr<IDXGIAdapter3> _adapterDXGI3;
+#endif
 
 protected:
 
@@ -127,6 +130,9 @@ class GPUDeviceDX : public GPUDevice
     void UpdateOutputs(IDXGIAdapter* adapter)
     {
 #if PLATFORM_WINDOWS
+        // Get adapter interface used to query the video memory budget (Windows 10+)
+        adapter->QueryInterface(IID_PPV_ARGS(&_adapterDXGI3));
+
         // Collect output devices
         uint32 outputIdx = 0;
         ComPtr<IDXGIOutput> output;
@@ -261,6 +267,20 @@ class GPUDeviceDX : public GPUDevice
     {
         return _adapter;
     }
+    MemoryBudget GetMemoryBudget() const override
+    {
+#if PLATFORM_WINDOWS
+        DXGI_QUERY_VIDEO_MEMORY_INFO info;
+        if (_adapterDXGI3 && SUCCEEDED(_adapterDXGI3->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &info)) && info.Budget != 0)
+        {
+            MemoryBudget result;
+            result.Budget = info.Budget;
+            result.Usage = info.CurrentUsage;
+            return result;
+        }
+#endif
+        return GPUDevice::GetMemoryBudget();
+    }
 
 protected:
 
@@ -304,6 +324,9 @@ class GPUDeviceDX : public GPUDevice
     void Dispose() override
     {
         Outputs.Resize(0);
+#if PLATFORM_WINDOWS
+        _adapterDXGI3 = nullptr;
+#endif
 
         GPUDevice::Dispose();
     }
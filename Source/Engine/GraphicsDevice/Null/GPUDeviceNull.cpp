@@ -62,6 +62,14 @@ bool GPUDeviceNull::Init()
         limits.HasReadOnlyDepth = false;
         limits.HasMultisampleDepthAsSRV = false;
         limits.HasTypedUAVLoad = false;
+        limits.HasDeferredContexts = false;
+        limits.HasBindlessResources = false;
+        limits.HasResourceAliasing = false;
+        limits.HasAsyncCompute = false;
+        limits.HasVariableRateShading = false;
+        limits.HasVariableRateShadingImage = false;
+        limits.VariableRateShadingTileSize = 0;
+        limits.HasMappedDynamicBuffers = false;
         limits.MaximumMipLevelsCount = 14;
         limits.MaximumTexture1DSize = 8192;
         limits.MaximumTexture1DArraySize = 512;
@@ -25,6 +25,16 @@ void CmdBufferVulkan::Begin()
     beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     VALIDATE_VULKAN_RESULT(vkBeginCommandBuffer(_commandBuffer, &beginInfo));
 
+#if VK_KHR_fragment_shading_rate
+    // Shading rate is a dynamic state of all graphics pipelines so it has to be initialized
+    if (GPUDeviceVulkan::OptionalDeviceExtensions.HasKHRFragmentShadingRate)
+    {
+        const VkExtent2D fragmentSize = { 1, 1 };
+        const VkFragmentShadingRateCombinerOpKHR combinerOps[2] = { VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR, VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR };
+        vkCmdSetFragmentShadingRateKHR(_commandBuffer, &fragmentSize, combinerOps);
+    }
+#endif
+
     // Acquire a descriptor pool set on
     if (_descriptorPoolSetContainer == nullptr)
     {
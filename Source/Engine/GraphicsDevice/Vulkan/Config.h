@@ -28,6 +28,11 @@
 #define VULKAN_ENABLE_API_DUMP 0
 #define VULKAN_RESET_QUERY_POOLS 0
 #define VULKAN_HASH_POOLS_WITH_TYPES_USAGE_ID 1
+
+// Enables reusing already written descriptor sets for the same bindings (within the descriptor pools lifetime)
+#ifndef VULKAN_CACHE_DESCRIPTOR_SETS
+#define VULKAN_CACHE_DESCRIPTOR_SETS 1
+#endif
 #define VULKAN_USE_DEBUG_LAYER GPU_ENABLE_DIAGNOSTICS
 
 #ifndef VULKAN_USE_QUERIES
@@ -227,6 +227,54 @@ bool TypedDescriptorPoolSetVulkan::AllocateDescriptorSets(const DescriptorSetLay
     return true;
 }
 
+#if VULKAN_CACHE_DESCRIPTOR_SETS
+
+namespace
+{
+    template<typename T>
+    FORCE_INLINE bool CompareBindings(const byte*& data, const Array<T>& items)
+    {
+        const int32 size = items.Count() * sizeof(T);
+        const bool result = Platform::MemoryCompare(data, items.Get(), size) == 0;
+        data += size;
+        return result;
+    }
+}
+
+bool TypedDescriptorPoolSetVulkan::GetCachedDescriptorSets(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes, uint32& hash, VkDescriptorSet* outSets) const
+{
+    // Descriptor sets contents are defined by the layout and the written infos (dynamic uniform buffers offsets are provided on bind)
+    const uint32 layoutHash = GetHash(layout);
+    hash = Crc::MemCrc32(writes.DescriptorImageInfo.Get(), writes.DescriptorImageInfo.Count() * sizeof(VkDescriptorImageInfo), layoutHash);
+    hash = Crc::MemCrc32(writes.DescriptorBufferInfo.Get(), writes.DescriptorBufferInfo.Count() * sizeof(VkDescriptorBufferInfo), hash);
+    hash = Crc::MemCrc32(writes.DescriptorTexelBufferView.Get(), writes.DescriptorTexelBufferView.Count() * sizeof(VkBufferView), hash);
+    const CachedSets* cached = _cache.TryGet(hash);
+    if (!cached || cached->LayoutHash != layoutHash)
+        return false;
+    const int32 size = (writes.DescriptorImageInfo.Count() * sizeof(VkDescriptorImageInfo)) + (writes.DescriptorBufferInfo.Count() * sizeof(VkDescriptorBufferInfo)) + (writes.DescriptorTexelBufferView.Count() * sizeof(VkBufferView));
+    const byte* data = cached->Bindings.Get();
+    if (cached->Bindings.Count() != size ||
+        !CompareBindings(data, writes.DescriptorImageInfo) ||
+        !CompareBindings(data, writes.DescriptorBufferInfo) ||
+        !CompareBindings(data, writes.DescriptorTexelBufferView))
+        return false;
+    Platform::MemoryCopy(outSets, cached->Handles.Get(), cached->Handles.Count() * sizeof(VkDescriptorSet));
+    return true;
+}
+
+void TypedDescriptorPoolSetVulkan::CacheDescriptorSets(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes, uint32 hash, const VkDescriptorSet* sets)
+{
+    CachedSets& cached = _cache[hash];
+    cached.LayoutHash = GetHash(layout);
+    cached.Bindings.Clear();
+    cached.Bindings.Add((const byte*)writes.DescriptorImageInfo.Get(), writes.DescriptorImageInfo.Count() * sizeof(VkDescriptorImageInfo));
+    cached.Bindings.Add((const byte*)writes.DescriptorBufferInfo.Get(), writes.DescriptorBufferInfo.Count() * sizeof(VkDescriptorBufferInfo));
+    cached.Bindings.Add((const byte*)writes.DescriptorTexelBufferView.Get(), writes.DescriptorTexelBufferView.Count() * sizeof(VkBufferView));
+    cached.Handles.Set(sets, layout.GetHandles().Count());
+}
+
+#endif
+
 DescriptorPoolVulkan* TypedDescriptorPoolSetVulkan::GetFreePool(bool forceNewPool)
 {
     if (!forceNewPool)
@@ -263,6 +311,9 @@ void TypedDescriptorPoolSetVulkan::Reset()
         pool->Element->Reset();
     }
     _poolListCurrent = _poolListHead;
+#if VULKAN_CACHE_DESCRIPTOR_SETS
+    _cache.Clear();
+#endif
 }
 
 DescriptorPoolSetContainerVulkan::DescriptorPoolSetContainerVulkan(GPUDeviceVulkan* device)
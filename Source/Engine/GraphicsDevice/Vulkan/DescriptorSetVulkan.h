@@ -248,6 +248,7 @@ class DescriptorPoolVulkan
 };
 
 class DescriptorPoolSetContainerVulkan;
+struct DescriptorSetWriteContainerVulkan;
 
 class TypedDescriptorPoolSetVulkan
 {
@@ -276,6 +277,18 @@ class TypedDescriptorPoolSetVulkan
     PoolList* _poolListHead = nullptr;
     PoolList* _poolListCurrent = nullptr;
 
+#if VULKAN_CACHE_DESCRIPTOR_SETS
+    struct CachedSets
+    {
+        uint32 LayoutHash;
+        Array<byte> Bindings;
+        Array<VkDescriptorSet, FixedAllocation<DescriptorSet::Max>> Handles;
+    };
+
+    // Descriptor sets already written within this pools lifetime (the bound resources are kept alive until the pools get reset)
+    Dictionary<uint32, CachedSets> _cache;
+#endif
+
 public:
 
     TypedDescriptorPoolSetVulkan(GPUDeviceVulkan* device, const DescriptorPoolSetContainerVulkan* owner, const DescriptorSetLayoutVulkan& layout)
@@ -290,6 +303,23 @@ class TypedDescriptorPoolSetVulkan
 
     bool AllocateDescriptorSets(const DescriptorSetLayoutVulkan& layout, VkDescriptorSet* outSets);
 
+#if VULKAN_CACHE_DESCRIPTOR_SETS
+    /// <summary>
+    /// Tries to find the descriptor sets already written with the same bindings (skips allocation and descriptors update).
+    /// </summary>
+    /// <param name="layout">The descriptor sets layout.</param>
+    /// <param name="writes">The descriptor writes with the current bindings.</param>
+    /// <param name="hash">The output bindings hash (used to cache the sets after the allocation if not found).</param>
+    /// <param name="outSets">The output descriptor sets.</param>
+    /// <returns>True if found the cached sets, otherwise false.</returns>
+    bool GetCachedDescriptorSets(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes, uint32& hash, VkDescriptorSet* outSets) const;
+
+    /// <summary>
+    /// Caches the written descriptor sets for reuse with the same bindings.
+    /// </summary>
+    void CacheDescriptorSets(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes, uint32 hash, const VkDescriptorSet* sets);
+#endif
+
     const DescriptorPoolSetContainerVulkan* GetOwner() const
     {
         return _owner;
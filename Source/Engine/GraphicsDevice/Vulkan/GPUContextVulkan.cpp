@@ -123,12 +123,33 @@ void PipelineBarrierVulkan::Execute(CmdBufferVulkan* cmdBuffer)
     Reset();
 }
 
-GPUContextVulkan::GPUContextVulkan(GPUDeviceVulkan* device, QueueVulkan* queue)
+// Locks the data shared with the other deferred contexts recording in parallel (resources state tracking and pipeline descriptors writing). Main context is not used during the parallel recording.
+struct DeferredContextLock
+{
+    CriticalSection* Locker;
+
+    DeferredContextLock(GPUContextVulkan* context, GPUDeviceVulkan* device)
+        : Locker(context->IsDeferred() ? &device->DeferredContextsLocker : nullptr)
+    {
+        if (Locker)
+            Locker->Lock();
+    }
+
+    ~DeferredContextLock()
+    {
+        if (Locker)
+            Locker->Unlock();
+    }
+};
+
+GPUContextVulkan::GPUContextVulkan(GPUDeviceVulkan* device, QueueVulkan* queue, bool isDeferred)
     : GPUContext(device)
     , _device(device)
     , _queue(queue)
     , _cmdBufferManager(New<CmdBufferManagerVulkan>(device, this))
 {
+    _isDeferred = isDeferred ? 1 : 0;
+
     // Setup descriptor handles tables lookup cache
     _handles[(int32)SpirvShaderResourceBindingType::INVALID] = nullptr;
     _handles[(int32)SpirvShaderResourceBindingType::CB] = _cbHandles;
@@ -151,6 +172,7 @@ GPUContextVulkan::~GPUContextVulkan()
         _descriptorPools[i].ClearDelete();
     }
     _descriptorPools.Clear();
+    _syncSemaphores.ClearDelete();
     Delete(_cmdBufferManager);
 }
 
@@ -181,6 +203,7 @@ void GPUContextVulkan::AddImageBarrier(VkImage image, VkImageLayout srcLayout, V
 
 void GPUContextVulkan::AddImageBarrier(GPUTextureViewVulkan* handle, VkImageLayout dstLayout)
 {
+    DeferredContextLock lock(this, _device);
     auto& state = handle->Owner->State;
     const auto subresourceIndex = handle->SubresourceIndex;
     if (subresourceIndex == -1)
@@ -238,6 +261,7 @@ void GPUContextVulkan::AddImageBarrier(GPUTextureViewVulkan* handle, VkImageLayo
 
 void GPUContextVulkan::AddImageBarrier(GPUTextureVulkan* texture, int32 mipSlice, int32 arraySlice, VkImageLayout dstLayout)
 {
+    DeferredContextLock lock(this, _device);
     // Skip if no need to perform image layout transition
     const auto subresourceIndex = RenderTools::CalcSubresourceIndex(mipSlice, arraySlice, texture->MipLevels());
     auto& state = texture->State;
@@ -257,6 +281,7 @@ void GPUContextVulkan::AddImageBarrier(GPUTextureVulkan* texture, int32 mipSlice
 
 void GPUContextVulkan::AddImageBarrier(GPUTextureVulkan* texture, VkImageLayout dstLayout)
 {
+    DeferredContextLock lock(this, _device);
     // Check for fast path to transition the entire resource at once
     auto& state = texture->State;
     if (state.AreAllSubresourcesSame())
@@ -290,6 +315,7 @@ void GPUContextVulkan::AddImageBarrier(GPUTextureVulkan* texture, VkImageLayout
 
 void GPUContextVulkan::AddBufferBarrier(GPUBufferVulkan* buffer, VkAccessFlags dstAccess)
 {
+    DeferredContextLock lock(this, _device);
     // Skip if no need to perform buffer memory transition
     if ((buffer->Access & dstAccess) == dstAccess)
         return;
@@ -374,6 +400,17 @@ DescriptorPoolVulkan* GPUContextVulkan::AllocateDescriptorSets(const VkDescripto
     return pool;
 }
 
+const UniformBufferUploaderVulkan::Allocation& GPUContextVulkan::GetCBAllocation(GPUConstantBufferVulkan* cb) const
+{
+    if (_isDeferred)
+    {
+        const auto allocation = _cbAllocations.TryGet(cb);
+        if (allocation)
+            return *allocation;
+    }
+    return cb->Allocation;
+}
+
 void GPUContextVulkan::BeginRenderPass()
 {
     auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
@@ -426,6 +463,11 @@ void GPUContextVulkan::BeginRenderPass()
     framebufferKey.RenderPass = renderPass;
     auto framebuffer = _device->GetOrCreateFramebuffer(framebufferKey, layout.Extent, layout.Layers);
     _renderPass = renderPass;
+#if VK_MERGE_RENDER_PASSES
+    _renderPassKey = framebufferKey;
+    _renderPassExtent = layout.Extent;
+    _renderPassLayers = layout.Layers;
+#endif
 
     FlushBarriers();
 
@@ -589,6 +631,14 @@ void GPUContextVulkan::UpdateDescriptorSets(GPUPipelineStateVulkan* pipelineStat
         remainingHasDescriptorsPerStageMask >>= 1;
     }
 
+#if VULKAN_CACHE_DESCRIPTOR_SETS
+    // Reuse descriptor sets already written with the same bindings
+    uint32 bindingsHash;
+    const auto typedPoolSet = pipelineState->CurrentTypedDescriptorPoolSet;
+    if (typedPoolSet->GetCachedDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DSWriteContainer, bindingsHash, pipelineState->DescriptorSetHandles.Get()))
+        return;
+#endif
+
     // Allocate sets if need to
     //if (needsWrite) // TODO: write on change only?
     {
@@ -611,6 +661,9 @@ void GPUContextVulkan::UpdateDescriptorSets(GPUPipelineStateVulkan* pipelineStat
         }
 
         vkUpdateDescriptorSets(_device->Device, pipelineState->DSWriteContainer.DescriptorWrites.Count(), pipelineState->DSWriteContainer.DescriptorWrites.Get(), 0, nullptr);
+#if VULKAN_CACHE_DESCRIPTOR_SETS
+        typedPoolSet->CacheDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DSWriteContainer, bindingsHash, pipelineState->DescriptorSetHandles.Get());
+#endif
     }
 }
 
@@ -629,6 +682,14 @@ void GPUContextVulkan::UpdateDescriptorSets(ComputePipelineStateVulkan* pipeline
     // Update descriptors
     UpdateDescriptorSets(*pipelineState->DescriptorInfo, pipelineState->DSWriter, needsWrite);
 
+#if VULKAN_CACHE_DESCRIPTOR_SETS
+    // Reuse descriptor sets already written with the same bindings
+    uint32 bindingsHash;
+    const auto typedPoolSet = pipelineState->CurrentTypedDescriptorPoolSet;
+    if (typedPoolSet->GetCachedDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DSWriteContainer, bindingsHash, pipelineState->DescriptorSetHandles.Get()))
+        return;
+#endif
+
     // Allocate sets if need to
     //if (needsWrite) // TODO: write on change only?f
     {
@@ -640,6 +701,9 @@ void GPUContextVulkan::UpdateDescriptorSets(ComputePipelineStateVulkan* pipeline
         pipelineState->DSWriter.SetDescriptorSet(descriptorSet);
 
         vkUpdateDescriptorSets(_device->Device, pipelineState->DSWriteContainer.DescriptorWrites.Count(), pipelineState->DSWriteContainer.DescriptorWrites.Get(), 0, nullptr);
+#if VULKAN_CACHE_DESCRIPTOR_SETS
+        typedPoolSet->CacheDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DSWriteContainer, bindingsHash, pipelineState->DescriptorSetHandles.Get());
+#endif
     }
 }
 
@@ -659,6 +723,51 @@ void GPUContextVulkan::BindPipeline()
     }
 }
 
+#if VK_MERGE_RENDER_PASSES
+
+bool GPUContextVulkan::IsRenderPassMatching() const
+{
+    // Check if the current render targets are the same as attachments of the active render pass
+    const int32 attachmentsCount = _rtCount + (_rtDepth ? 1 : 0);
+    if (_renderPass == nullptr || _renderPassKey.AttachmentCount != attachmentsCount)
+        return false;
+    for (int32 i = 0; i < _rtCount; i++)
+    {
+        if (!_rtHandles[i] || _renderPassKey.Attachments[i] != _rtHandles[i]->GetFramebufferView())
+            return false;
+    }
+    return !_rtDepth || _renderPassKey.Attachments[_rtCount] == _rtDepth->GetFramebufferView();
+}
+
+bool GPUContextVulkan::ClearAttachment(GPUTextureViewVulkan* view, const VkClearValue& value)
+{
+    // Find the attachment of the active render pass
+    const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
+    if (!cmdBuffer->IsInsideRenderPass() || _renderPass == nullptr)
+        return false;
+    const VkImageView attachmentView = view->GetFramebufferView();
+    int32 attachmentIndex = 0;
+    while (attachmentIndex < _renderPassKey.AttachmentCount && _renderPassKey.Attachments[attachmentIndex] != attachmentView)
+        attachmentIndex++;
+    if (attachmentIndex == _renderPassKey.AttachmentCount)
+        return false;
+
+    // Clear the whole attachment without leaving the render pass
+    VkClearAttachment clear;
+    clear.aspectMask = view->Info.subresourceRange.aspectMask;
+    clear.colorAttachment = attachmentIndex;
+    clear.clearValue = value;
+    VkClearRect rect;
+    rect.rect.offset = { 0, 0 };
+    rect.rect.extent = _renderPassExtent;
+    rect.baseArrayLayer = 0;
+    rect.layerCount = _renderPassLayers;
+    vkCmdClearAttachments(cmdBuffer->GetHandle(), 1, &clear, 1, &rect);
+    return true;
+}
+
+#endif
+
 void GPUContextVulkan::OnDrawCall()
 {
     GPUPipelineStateVulkan* pipelineState = _currentState;
@@ -669,7 +778,18 @@ void GPUContextVulkan::OnDrawCall()
 
     // End previous render pass if render targets layout was modified
     if (_rtDirtyFlag && cmdBuffer->IsInsideRenderPass())
+    {
+#if VK_MERGE_RENDER_PASSES
+        // Continue the active render pass when the same targets got bound again
+        if (IsRenderPassMatching())
+            _rtDirtyFlag = false;
+        else
+#endif
         EndRenderPass();
+    }
+
+    // Descriptors are written via pipeline state so lock it until they are bound
+    DeferredContextLock lock(this, _device);
 
     if (pipelineState->HasDescriptorsPerStageMask)
     {
@@ -722,6 +842,9 @@ void GPUContextVulkan::FrameBegin()
     GPUContext::FrameBegin();
 
     // Setup
+    if (!_cmdBufferManager->HasPendingActiveCmdBuffer())
+        _syncSemaphores.ClearDelete();
+    _cbAllocations.Clear();
     _psDirtyFlag = 0;
     _rtDirtyFlag = 0;
     _cbDirtyFlag = 0;
@@ -797,8 +920,13 @@ void GPUContextVulkan::Clear(GPUTextureView* rt, const Color& color)
 
     if (rtVulkan)
     {
-        // TODO: detect if inside render pass and use ClearAttachments
         // TODO: delay clear for attachments before render pass to use render pass clear values for faster clearing
+#if VK_MERGE_RENDER_PASSES
+        VkClearValue clear;
+        Platform::MemoryCopy(clear.color.float32, color.Raw, sizeof(clear.color.float32));
+        if (ClearAttachment(rtVulkan, clear))
+            return;
+#endif
 
         const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
         if (cmdBuffer->IsInsideRenderPass())
@@ -817,8 +945,14 @@ void GPUContextVulkan::ClearDepth(GPUTextureView* depthBuffer, float depthValue)
 
     if (rtVulkan)
     {
-        // TODO: detect if inside render pass and use ClearAttachments
         // TODO: delay clear for attachments before render pass to use render pass clear values for faster clearing
+#if VK_MERGE_RENDER_PASSES
+        VkClearValue clearValue;
+        clearValue.depthStencil.depth = depthValue;
+        clearValue.depthStencil.stencil = 0;
+        if (ClearAttachment(rtVulkan, clearValue))
+            return;
+#endif
 
         const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
         if (cmdBuffer->IsInsideRenderPass())
@@ -907,9 +1041,12 @@ void GPUContextVulkan::ResetRenderTarget()
         _rtDepth = nullptr;
         Platform::MemoryClear(_rtHandles, sizeof(_rtHandles));
 
+#if !VK_MERGE_RENDER_PASSES
+        // Otherwise render pass is ended on the next draw if the targets are different or before any other operation that requires it
         const auto cmdBuffer = _cmdBufferManager->GetActiveCmdBuffer();
         if (cmdBuffer && cmdBuffer->IsInsideRenderPass())
             EndRenderPass();
+#endif
     }
 }
 
@@ -1074,7 +1211,10 @@ void GPUContextVulkan::UpdateCB(GPUConstantBuffer* cb, const void* data)
     Platform::MemoryCopy(allocation.CPUAddress, data, allocation.Size);
 
     // Cache the allocation to update the descriptor
-    cbVulkan->Allocation = allocation;
+    if (_isDeferred)
+        _cbAllocations[cbVulkan] = allocation;
+    else
+        cbVulkan->Allocation = allocation;
 
     // Mark CB slot as dirty if this CB is binded to the pipeline
     for (int32 i = 0; i < ARRAY_COUNT(_cbHandles); i++)
@@ -1099,6 +1239,9 @@ void GPUContextVulkan::Dispatch(GPUShaderProgramCS* shader, uint32 threadGroupCo
 
     auto pipelineState = shaderVulkan->GetOrCreateState();
 
+    // Descriptors are written via pipeline state so lock it until they are bound
+    DeferredContextLock lock(this, _device);
+
     UpdateDescriptorSets(pipelineState);
 
     FlushBarriers();
@@ -1136,6 +1279,9 @@ void GPUContextVulkan::DispatchIndirect(GPUShaderProgramCS* shader, GPUBuffer* b
 
     auto pipelineState = shaderVulkan->GetOrCreateState();
 
+    // Descriptors are written via pipeline state so lock it until they are bound
+    DeferredContextLock lock(this, _device);
+
     UpdateDescriptorSets(pipelineState);
     AddBufferBarrier(bufferForArgsVulkan, VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
 
@@ -1256,6 +1402,18 @@ void GPUContextVulkan::SetScissor(const Rectangle& scissorRect)
     vkCmdSetScissor(_cmdBufferManager->GetCmdBuffer()->GetHandle(), 0, 1, &rect);
 }
 
+void GPUContextVulkan::SetShadingRate(GPUShadingRate rate)
+{
+#if VK_KHR_fragment_shading_rate
+    if (GPUDeviceVulkan::OptionalDeviceExtensions.HasKHRFragmentShadingRate)
+    {
+        const VkExtent2D fragmentSize = { 1u << (((uint32)rate >> 2) & 0x3), 1u << ((uint32)rate & 0x3) };
+        const VkFragmentShadingRateCombinerOpKHR combinerOps[2] = { VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR, VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR };
+        vkCmdSetFragmentShadingRateKHR(_cmdBufferManager->GetCmdBuffer()->GetHandle(), &fragmentSize, combinerOps);
+    }
+#endif
+}
+
 GPUPipelineState* GPUContextVulkan::GetState() const
 {
     return _currentState;
@@ -1445,11 +1603,11 @@ void GPUContextVulkan::CopyTexture(GPUTexture* dstResource, uint32 dstSubresourc
     region.srcSubresource.baseArrayLayer = srcArrayIndex;
     region.srcSubresource.layerCount = 1;
     region.srcSubresource.mipLevel = srcMipIndex;
-    region.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.srcSubresource.aspectMask = srcTextureVulkan->DefaultAspectMask;
     region.dstSubresource.baseArrayLayer = dstArrayIndex;
     region.dstSubresource.layerCount = 1;
     region.dstSubresource.mipLevel = dstMipIndex;
-    region.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.dstSubresource.aspectMask = dstTextureVulkan->DefaultAspectMask;
     vkCmdCopyImage(cmdBuffer->GetHandle(), srcTextureVulkan->GetHandle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dstTextureVulkan->GetHandle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 }
 
@@ -1740,4 +1898,50 @@ void GPUContextVulkan::CopySubresource(GPUResource* dstResource, uint32 dstSubre
     }
 }
 
+void GPUContextVulkan::ActivateAliasedTexture(GPUTexture* texture)
+{
+    const auto textureVulkan = static_cast<GPUTextureVulkan*>(texture);
+    const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
+    if (cmdBuffer->IsInsideRenderPass())
+        EndRenderPass();
+    FlushBarriers();
+
+    // Wait for the previous usage of the shared memory to end (contents of the aliased image are undefined)
+    VkMemoryBarrier barrier;
+    RenderToolsVulkan::ZeroStruct(barrier, VK_STRUCTURE_TYPE_MEMORY_BARRIER);
+    barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    vkCmdPipelineBarrier(cmdBuffer->GetHandle(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+    DeferredContextLock lock(this, _device);
+    textureVulkan->State.SetResourceState(VK_IMAGE_LAYOUT_UNDEFINED);
+}
+
+uint64 GPUContextVulkan::Signal()
+{
+    FrameEnd();
+    _currentState = nullptr;
+
+    // Submit commands with a semaphore signaled on their completion (waited by the other context)
+    auto semaphore = New<SemaphoreVulkan>(_device);
+    _cmdBufferManager->GetCmdBuffer();
+    _cmdBufferManager->SubmitActiveCmdBuffer(semaphore);
+    _cmdBufferManager->PrepareForNewActiveCommandBuffer();
+    _syncSemaphores.ClearDelete();
+    FrameBegin();
+    return (uint64)semaphore;
+}
+
+void GPUContextVulkan::Wait(GPUContext* other, uint64 syncPoint)
+{
+    auto semaphore = (SemaphoreVulkan*)syncPoint;
+    if (!semaphore)
+        return;
+    FrameEnd();
+    Flush();
+    _syncSemaphores.ClearDelete();
+    FrameBegin();
+    _cmdBufferManager->GetCmdBuffer()->AddWaitSemaphore(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, semaphore);
+    _syncSemaphores.Add(semaphore);
+}
+
 #endif
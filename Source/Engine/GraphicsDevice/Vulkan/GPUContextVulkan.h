@@ -7,6 +7,7 @@
 #if GRAPHICS_API_VULKAN
 
 #include "GPUDeviceVulkan.h"
+#include "GPUShaderVulkan.h"
 #include "Types.h"
 
 class QueueVulkan;
@@ -30,6 +31,11 @@ class DescriptorSetLayoutVulkan;
 /// </summary>
 #define VK_ENABLE_BARRIERS_DEBUG (BUILD_DEBUG && 0)
 
+/// <summary>
+/// Enables keeping the active render pass when the same render targets get bound again and clearing its attachments without ending it (less render passes, better for tile-based GPUs).
+/// </summary>
+#define VK_MERGE_RENDER_PASSES 1
+
 /// <summary>
 /// Size of the pipeline barriers buffer size (will be auto-flushed on overflow).
 /// </summary>
@@ -94,11 +100,17 @@ class GPUContextVulkan : public GPUContext
     int32 _psDirtyFlag : 1;
     int32 _rtDirtyFlag : 1;
     int32 _cbDirtyFlag : 1;
+    int32 _isDeferred : 1;
 
     int32 _rtCount;
     int32 _vbCount;
 
     RenderPassVulkan* _renderPass;
+#if VK_MERGE_RENDER_PASSES
+    FramebufferVulkan::Key _renderPassKey;
+    VkExtent2D _renderPassExtent;
+    uint32 _renderPassLayers;
+#endif
     GPUPipelineStateVulkan* _currentState;
     GPUTextureViewVulkan* _rtDepth;
     GPUTextureViewVulkan* _rtHandles[GPU_MAX_RT_BINDED];
@@ -114,6 +126,12 @@ class GPUContextVulkan : public GPUContext
     typedef Array<DescriptorPoolVulkan*> DescriptorPoolArray;
     Dictionary<uint32, DescriptorPoolArray> _descriptorPools;
 
+    // Constant buffers data uploaded by the deferred context (shared buffer objects can be updated by many contexts in parallel)
+    Dictionary<GPUConstantBufferVulkan*, UniformBufferUploaderVulkan::Allocation> _cbAllocations;
+
+    // Semaphores of the other contexts sync points waited by this context (released after the waiting command buffer submission)
+    Array<SemaphoreVulkan*> _syncSemaphores;
+
 public:
 
     /// <summary>
@@ -121,7 +139,8 @@ class GPUContextVulkan : public GPUContext
     /// </summary>
     /// <param name="device">The graphics device.</param>
     /// <param name="queue">The commands submission device.</param>
-    GPUContextVulkan(GPUDeviceVulkan* device, QueueVulkan* queue);
+    /// <param name="isDeferred">True if it's a deferred context used to record commands on other threads.</param>
+    GPUContextVulkan(GPUDeviceVulkan* device, QueueVulkan* queue, bool isDeferred = false);
 
     /// <summary>
     /// Finalizes an instance of the <see cref="GPUContextVulkan"/> class.
@@ -140,6 +159,21 @@ class GPUContextVulkan : public GPUContext
         return _cmdBufferManager;
     }
 
+    /// <summary>
+    /// Returns true if it's a deferred context used to record commands on other threads.
+    /// </summary>
+    FORCE_INLINE bool IsDeferred() const
+    {
+        return _isDeferred != 0;
+    }
+
+    /// <summary>
+    /// Gets the last data of the constant buffer uploaded by this context.
+    /// </summary>
+    /// <param name="cb">The constant buffer.</param>
+    /// <returns>The uniform buffer allocation.</returns>
+    const UniformBufferUploaderVulkan::Allocation& GetCBAllocation(GPUConstantBufferVulkan* cb) const;
+
     void AddImageBarrier(VkImage image, VkImageLayout srcLayout, VkImageLayout dstLayout, VkImageSubresourceRange& subresourceRange, GPUTextureViewVulkan* handle);
     void AddImageBarrier(GPUTextureViewVulkan* handle, VkImageLayout dstLayout);
     void AddImageBarrier(GPUTextureVulkan* texture, int32 mipSlice, int32 arraySlice, VkImageLayout dstLayout);
@@ -162,6 +196,10 @@ class GPUContextVulkan : public GPUContext
     void UpdateDescriptorSets(ComputePipelineStateVulkan* pipelineState);
     void BindPipeline();
     void OnDrawCall();
+#if VK_MERGE_RENDER_PASSES
+    bool IsRenderPassMatching() const;
+    bool ClearAttachment(GPUTextureViewVulkan* view, const VkClearValue& value);
+#endif
 
 public:
 
@@ -203,6 +241,7 @@ class GPUContextVulkan : public GPUContext
     void DrawInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs) override;
     void DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs) override;
     void SetViewport(const Viewport& viewport) override;
+    void SetShadingRate(GPUShadingRate rate) override;
     void SetScissor(const Rectangle& scissorRect) override;
     GPUPipelineState* GetState() const override;
     void SetState(GPUPipelineState* state) override;
@@ -217,6 +256,9 @@ class GPUContextVulkan : public GPUContext
     void CopyCounter(GPUBuffer* dstBuffer, uint32 dstOffset, GPUBuffer* srcBuffer) override;
     void CopyResource(GPUResource* dstResource, GPUResource* srcResource) override;
     void CopySubresource(GPUResource* dstResource, uint32 dstSubresource, GPUResource* srcResource, uint32 srcSubresource) override;
+    void ActivateAliasedTexture(GPUTexture* texture) override;
+    uint64 Signal() override;
+    void Wait(GPUContext* other, uint64 syncPoint) override;
 };
 
 #endif
@@ -40,6 +40,9 @@ static const char* GInstanceExtensions[] =
 #endif
 #if defined(VK_KHR_display) && 0
     VK_KHR_DISPLAY_EXTENSION_NAME,
+#endif
+#if VK_KHR_fragment_shading_rate || VK_EXT_memory_budget
+    VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
 #endif
     nullptr
 };
@@ -55,6 +58,15 @@ static const char* GDeviceExtensions[] =
 #endif
 #if VK_KHR_sampler_mirror_clamp_to_edge
     VK_KHR_SAMPLER_MIRROR_CLAMP_TO_EDGE_EXTENSION_NAME,
+#endif
+#if VK_KHR_fragment_shading_rate
+    VK_KHR_MULTIVIEW_EXTENSION_NAME,
+    VK_KHR_MAINTENANCE2_EXTENSION_NAME,
+    VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+    VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME,
+#endif
+#if VK_EXT_memory_budget
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
 #endif
     nullptr
 };
@@ -588,6 +600,12 @@ void GPUDeviceVulkan::ParseOptionalDeviceExtensions(const Array<const char*>& de
 #if VK_EXT_validation_cache
     OptionalDeviceExtensions.HasEXTValidationCache = HasExtension(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
 #endif
+#if VK_KHR_fragment_shading_rate
+    OptionalDeviceExtensions.HasKHRFragmentShadingRate = HasExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME) && HasExtension(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME);
+#endif
+#if VK_EXT_memory_budget && VMA_MEMORY_BUDGET
+    OptionalDeviceExtensions.HasEXTMemoryBudget = HasExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) && vkGetPhysicalDeviceMemoryProperties2KHR != nullptr;
+#endif
 }
 
 #endif
@@ -31,6 +31,7 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Engine/CommandLine.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Utilities/StringConverter.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
@@ -402,6 +403,10 @@ void DeferredDeletionQueueVulkan::ReleaseResources(bool deleteImmediately)
                 {
                     vmaDestroyBuffer(_device->Allocator, (VkBuffer)e->Handle, e->AllocationHandle);
                 }
+                else if (e->StructureType == Memory)
+                {
+                    vmaFreeMemory(_device->Allocator, e->AllocationHandle);
+                }
                 else
                 {
                     CRASH;
@@ -1257,6 +1262,7 @@ GPUDeviceVulkan::~GPUDeviceVulkan()
 
 RenderPassVulkan* GPUDeviceVulkan::GetOrCreateRenderPass(RenderTargetLayoutVulkan& layout)
 {
+    ScopeLock lock(_cacheLocker);
     RenderPassVulkan* renderPass;
     if (_renderPasses.TryGet(layout, renderPass))
         return renderPass;
@@ -1269,6 +1275,7 @@ RenderPassVulkan* GPUDeviceVulkan::GetOrCreateRenderPass(RenderTargetLayoutVulka
 
 FramebufferVulkan* GPUDeviceVulkan::GetOrCreateFramebuffer(FramebufferVulkan::Key& key, VkExtent2D& extent, uint32 layers)
 {
+    ScopeLock lock(_cacheLocker);
     FramebufferVulkan* framebuffer;
     if (_framebuffers.TryGet(key, framebuffer))
         return framebuffer;
@@ -1281,6 +1288,7 @@ FramebufferVulkan* GPUDeviceVulkan::GetOrCreateFramebuffer(FramebufferVulkan::Ke
 
 PipelineLayoutVulkan* GPUDeviceVulkan::GetOrCreateLayout(DescriptorSetLayoutInfoVulkan& key)
 {
+    ScopeLock lock(_cacheLocker);
     PipelineLayoutVulkan* layout;
     if (_layouts.TryGet(key, layout))
         return layout;
@@ -1293,6 +1301,7 @@ PipelineLayoutVulkan* GPUDeviceVulkan::GetOrCreateLayout(DescriptorSetLayoutInfo
 
 void GPUDeviceVulkan::OnImageViewDestroy(VkImageView imageView)
 {
+    ScopeLock lock(_cacheLocker);
     for (auto i = _framebuffers.Begin(); i.IsNotEnd(); ++i)
     {
         if (i->Value->HasReference(imageView))
@@ -1493,6 +1502,11 @@ GPUContext* GPUDeviceVulkan::GetMainContext()
     return reinterpret_cast<GPUContext*>(MainContext);
 }
 
+GPUContext* GPUDeviceVulkan::GetAsyncComputeContext()
+{
+    return reinterpret_cast<GPUContext*>(AsyncComputeContext);
+}
+
 GPUAdapter* GPUDeviceVulkan::GetAdapter() const
 {
     return static_cast<GPUAdapter*>(Adapter);
@@ -1535,6 +1549,30 @@ static int32 GetMaxSampleCount(VkSampleCountFlags counts)
     return VK_SAMPLE_COUNT_1_BIT;
 }
 
+GPUDevice::MemoryBudget GPUDeviceVulkan::GetMemoryBudget() const
+{
+    if (Allocator == VK_NULL_HANDLE)
+        return GPUDevice::GetMemoryBudget();
+
+    // Sum the device-local heaps (budget is queried from driver with VK_EXT_memory_budget, otherwise estimated by allocator)
+    const VkPhysicalDeviceMemoryProperties* memoryProperties;
+    vmaGetMemoryProperties(Allocator, &memoryProperties);
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+    vmaGetBudget(Allocator, budgets);
+    MemoryBudget result;
+    result.Budget = 0;
+    result.Usage = 0;
+    for (uint32 i = 0; i < memoryProperties->memoryHeapCount; i++)
+    {
+        if (memoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+        {
+            result.Budget += budgets[i].budget;
+            result.Usage += budgets[i].usage;
+        }
+    }
+    return result;
+}
+
 bool GPUDeviceVulkan::Init()
 {
     TotalGraphicsMemory = 0;
@@ -1654,6 +1692,16 @@ bool GPUDeviceVulkan::Init()
     VkPhysicalDeviceFeatures enabledFeatures;
     VulkanPlatform::RestrictEnabledPhysicalDeviceFeatures(PhysicalDeviceFeatures, enabledFeatures);
     deviceInfo.pEnabledFeatures = &enabledFeatures;
+#if VK_KHR_fragment_shading_rate
+    // Per-draw shading rate is required to be supported by the extension
+    VkPhysicalDeviceFragmentShadingRateFeaturesKHR fragmentShadingRateFeatures;
+    RenderToolsVulkan::ZeroStruct(fragmentShadingRateFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR);
+    if (OptionalDeviceExtensions.HasKHRFragmentShadingRate)
+    {
+        fragmentShadingRateFeatures.pipelineFragmentShadingRate = VK_TRUE;
+        deviceInfo.pNext = &fragmentShadingRateFeatures;
+    }
+#endif
 
     // Create the device
     VALIDATE_VULKAN_RESULT(vkCreateDevice(gpu, &deviceInfo, nullptr, &Device));
@@ -1672,6 +1720,8 @@ bool GPUDeviceVulkan::Init()
     GraphicsQueue = New<QueueVulkan>(this, graphicsQueueFamilyIndex);
     ComputeQueue = computeQueueFamilyIndex != -1 ? New<QueueVulkan>(this, computeQueueFamilyIndex) : GraphicsQueue;
     TransferQueue = transferQueueFamilyIndex != -1 ? New<QueueVulkan>(this, transferQueueFamilyIndex) : GraphicsQueue;
+    if (QueueFamilyProps[graphicsQueueFamilyIndex].queueCount > 1)
+        AsyncComputeQueue = New<QueueVulkan>(this, graphicsQueueFamilyIndex, 1);
 
     // Init device limits
     {
@@ -1705,6 +1755,14 @@ bool GPUDeviceVulkan::Init()
         limits.HasReadOnlyDepth = true;
         limits.HasMultisampleDepthAsSRV = !!PhysicalDeviceFeatures.sampleRateShading;
         limits.HasTypedUAVLoad = true;
+        limits.HasDeferredContexts = true;
+        limits.HasBindlessResources = false;
+        limits.HasResourceAliasing = true;
+        limits.HasAsyncCompute = AsyncComputeQueue != nullptr;
+        limits.HasVariableRateShading = OptionalDeviceExtensions.HasKHRFragmentShadingRate;
+        limits.HasVariableRateShadingImage = false; // TODO: shading rate attachment for the render pass (requires VkRenderPassCreateInfo2)
+        limits.VariableRateShadingTileSize = 0;
+        limits.HasMappedDynamicBuffers = true;
         limits.MaximumMipLevelsCount = Math::Min(static_cast<int32>(log2(PhysicalDeviceLimits.maxImageDimension2D)), GPU_MAX_TEXTURE_MIP_LEVELS);
         limits.MaximumTexture1DSize = PhysicalDeviceLimits.maxImageDimension1D;
         limits.MaximumTexture1DArraySize = PhysicalDeviceLimits.maxImageArrayLayers;
@@ -1835,6 +1893,9 @@ bool GPUDeviceVulkan::Init()
         INIT_FUNC(vkGetBufferMemoryRequirements2KHR);
         INIT_FUNC(vkGetImageMemoryRequirements2KHR);
 #endif
+#if VMA_MEMORY_BUDGET
+        INIT_FUNC(vkGetPhysicalDeviceMemoryProperties2KHR);
+#endif
 #undef INIT_FUNC
         VmaAllocatorCreateInfo allocatorInfo = {};
         allocatorInfo.vulkanApiVersion = VK_API_VERSION_1_0;
@@ -1842,6 +1903,10 @@ bool GPUDeviceVulkan::Init()
         allocatorInfo.instance = Instance;
         allocatorInfo.device = Device;
         allocatorInfo.pVulkanFunctions = &vulkanFunctions;
+#if VK_EXT_memory_budget && VMA_MEMORY_BUDGET
+        if (OptionalDeviceExtensions.HasEXTMemoryBudget)
+            allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+#endif
         VALIDATE_VULKAN_RESULT(vmaCreateAllocator(&allocatorInfo, &Allocator));
     }
 
@@ -1877,6 +1942,11 @@ bool GPUDeviceVulkan::Init()
     UniformBufferUploader = New<UniformBufferUploaderVulkan>(this);
     DescriptorPoolsManager = New<DescriptorPoolsManagerVulkan>(this);
     MainContext = New<GPUContextVulkan>(this, GraphicsQueue);
+    if (AsyncComputeQueue)
+    {
+        AsyncComputeContext = New<GPUContextVulkan>(this, AsyncComputeQueue);
+        AsyncComputeContext->FrameBegin();
+    }
     if (vkCreatePipelineCache)
     {
         Array<uint8> data;
@@ -1942,8 +2012,36 @@ bool GPUDeviceVulkan::Init()
     return GPUDevice::Init();
 }
 
+void GPUDeviceVulkan::OnFrameSubmitted(CmdBufferVulkan* cmdBuffer)
+{
+    FrameSubmission& submission = _frameSubmissions[_frameSubmissionIndex];
+    submission.CmdBuffer = cmdBuffer;
+    submission.FenceCounter = cmdBuffer->GetSubmittedFenceCounter();
+    _frameSubmissionIndex = (_frameSubmissionIndex + 1) % GPU_MAX_FRAMES_IN_FLIGHT;
+}
+
+void GPUDeviceVulkan::WaitForFramesInFlight(int32 framesInFlight)
+{
+    // Wait for the frame submitted before the last framesInFlight-1 ones (command buffer is reused after its fence gets signaled)
+    framesInFlight = Math::Clamp(framesInFlight, 1, GPU_MAX_FRAMES_IN_FLIGHT);
+    FrameSubmission& submission = _frameSubmissions[(_frameSubmissionIndex + GPU_MAX_FRAMES_IN_FLIGHT - framesInFlight) % GPU_MAX_FRAMES_IN_FLIGHT];
+    CmdBufferVulkan* cmdBuffer = submission.CmdBuffer;
+    if (cmdBuffer == nullptr)
+        return;
+    submission.CmdBuffer = nullptr;
+    cmdBuffer->RefreshFenceStatus();
+    if (cmdBuffer->IsSubmitted() && cmdBuffer->GetSubmittedFenceCounter() == submission.FenceCounter)
+    {
+        PROFILE_CPU_NAMED("Wait For GPU");
+        MainContext->GetCmdBufferManager()->WaitForCmdBuffer(cmdBuffer);
+    }
+}
+
 void GPUDeviceVulkan::DrawBegin()
 {
+    // Limit the amount of frames that CPU can prepare ahead of the GPU
+    WaitForFramesInFlight(Graphics::MaxFramesInFlight);
+
     // Base
     GPUDevice::DrawBegin();
 
@@ -1979,7 +2077,9 @@ void GPUDeviceVulkan::Dispose()
     TimestampQueryPools.ClearDelete();
     SAFE_DELETE_GPU_RESOURCE(UniformBufferUploader);
     Delete(DescriptorPoolsManager);
+    SAFE_DELETE(AsyncComputeContext);
     SAFE_DELETE(MainContext);
+    SAFE_DELETE(AsyncComputeQueue);
     if (TransferQueue != GraphicsQueue && ComputeQueue != TransferQueue)
         SAFE_DELETE(TransferQueue);
     if (ComputeQueue != GraphicsQueue)
@@ -2033,6 +2133,82 @@ void GPUDeviceVulkan::WaitForGPU()
     }
 }
 
+GPUContext* GPUDeviceVulkan::CreateDeferredContext()
+{
+    auto context = New<GPUContextVulkan>(this, GraphicsQueue, true);
+    context->FrameBegin();
+    return context;
+}
+
+void GPUDeviceVulkan::ExecuteDeferredContexts(const Span<GPUContext*>& contexts)
+{
+    PROFILE_CPU();
+
+    // Submit the main context commands recorded before the deferred ones to keep the order
+    MainContext->Flush();
+
+    for (int32 i = 0; i < contexts.Length(); i++)
+    {
+        auto context = (GPUContextVulkan*)contexts[i];
+        ASSERT(context->IsDeferred());
+        context->FrameEnd();
+        context->Flush();
+        context->FrameBegin();
+    }
+}
+
+bool GPUDeviceVulkan::LoadPipelineStatesManifest(const StringView& path)
+{
+    return PipelineStatesManifest.Load(path, GetRendererType());
+}
+
+bool GPUDeviceVulkan::SavePipelineStatesManifest(const StringView& path) const
+{
+    return PipelineStatesManifest.Save(path, GetRendererType());
+}
+
+void* GPUDeviceVulkan::AllocateAliasingMemory(uint64 size)
+{
+    VkMemoryRequirements memoryRequirements;
+    memoryRequirements.size = size;
+    memoryRequirements.alignment = 64 * 1024;
+    memoryRequirements.memoryTypeBits = MAX_uint32;
+    VmaAllocationCreateInfo allocInfo = {};
+    allocInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+    VmaAllocation allocation = VK_NULL_HANDLE;
+    const VkResult result = vmaAllocateMemory(Allocator, &memoryRequirements, &allocInfo, &allocation, nullptr);
+    LOG_VULKAN_RESULT(result);
+    return result == VK_SUCCESS ? allocation : nullptr;
+}
+
+void GPUDeviceVulkan::ReleaseAliasingMemory(void* memory)
+{
+    if (memory)
+        DeferredDeletionQueue.EnqueueResource(DeferredDeletionQueueVulkan::Memory, memory, (VmaAllocation)memory);
+}
+
+bool GPUDeviceVulkan::GetAliasedTextureSize(const GPUTextureDescription& desc, uint64& size, uint64& alignment)
+{
+    VkMemoryRequirements memoryRequirements;
+    if (GPUTextureVulkan::GetMemoryRequirements(this, desc, memoryRequirements))
+        return true;
+    size = memoryRequirements.size;
+    alignment = memoryRequirements.alignment;
+    return false;
+}
+
+GPUTexture* GPUDeviceVulkan::CreateAliasedTexture(const StringView& name, const GPUTextureDescription& desc, void* memory, uint64 offset)
+{
+    auto texture = New<GPUTextureVulkan>(this, name);
+    texture->SetAliasingMemory((VmaAllocation)memory, offset);
+    if (texture->Init(desc))
+    {
+        texture->DeleteObjectNow();
+        return nullptr;
+    }
+    return texture;
+}
+
 GPUTexture* GPUDeviceVulkan::CreateTexture(const StringView& name)
 {
     return New<GPUTextureVulkan>(this, name);
@@ -6,6 +6,7 @@
 
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPUResource.h"
+#include "Engine/Graphics/GPUPipelineStatesManifest.h"
 #include "DescriptorSetVulkan.h"
 #include "IncludeVulkanHeaders.h"
 #include "Config.h"
@@ -173,6 +174,7 @@ class DeferredDeletionQueueVulkan
         ShaderModule,
         Event,
         QueryPool,
+        Memory,
     };
 
 private:
@@ -464,7 +466,8 @@ class GPUDeviceVulkan : public GPUDevice
     Dictionary<RenderTargetLayoutVulkan, RenderPassVulkan*> _renderPasses;
     Dictionary<FramebufferVulkan::Key, FramebufferVulkan*> _framebuffers;
     Dictionary<DescriptorSetLayoutInfoVulkan, PipelineLayoutVulkan*> _layouts;
-    // TODO: use mutex to protect those collections BUT use 2 pools per cache: one lock-free with lookup only and second protected with mutex synced on frame end!
+    CriticalSection _cacheLocker;
+    // TODO: use 2 pools per cache: one lock-free with lookup only and second protected with mutex synced on frame end!
 
 public:
 
@@ -492,6 +495,8 @@ class GPUDeviceVulkan : public GPUDevice
         uint32 HasKHRExternalMemoryCapabilities : 1;
         uint32 HasKHRGetPhysicalDeviceProperties2 : 1;
         uint32 HasEXTValidationCache : 1;
+        uint32 HasKHRFragmentShadingRate : 1;
+        uint32 HasEXTMemoryBudget : 1;
     };
 
     static void GetInstanceLayersAndExtensions(Array<const char*>& outInstanceExtensions, Array<const char*>& outInstanceLayers, bool& outDebugUtils);
@@ -524,6 +529,11 @@ class GPUDeviceVulkan : public GPUDevice
     /// </summary>
     GPUContextVulkan* MainContext = nullptr;
 
+    /// <summary>
+    /// The locker for the data shared between the deferred contexts recording commands in parallel (resources state tracking and descriptors writing).
+    /// </summary>
+    CriticalSection DeferredContextsLocker;
+
     /// <summary>
     /// The Vulkan adapter.
     /// </summary>
@@ -569,6 +579,16 @@ class GPUDeviceVulkan : public GPUDevice
     /// </summary>
     QueueVulkan* ComputeQueue = nullptr;
 
+    /// <summary>
+    /// The async compute queue (the second queue of the graphics queue family so resources don't need the queue family ownership transfers). Null if not supported.
+    /// </summary>
+    QueueVulkan* AsyncComputeQueue = nullptr;
+
+    /// <summary>
+    /// The async compute commands context. Null if not supported.
+    /// </summary>
+    GPUContextVulkan* AsyncComputeContext = nullptr;
+
     /// <summary>
     /// The transfer queue.
     /// </summary>
@@ -589,6 +609,11 @@ class GPUDeviceVulkan : public GPUDevice
     /// </summary>
     VkPipelineCache PipelineCache = VK_NULL_HANDLE;
 
+    /// <summary>
+    /// The recorded pipeline state objects created by the device (used to prewarm them on the pipeline state initialization).
+    /// </summary>
+    GPUPipelineStatesManifest<RenderTargetLayoutVulkan> PipelineStatesManifest;
+
 #if VK_EXT_validation_cache
 
     /// <summary>
@@ -657,6 +682,31 @@ class GPUDeviceVulkan : public GPUDevice
     PipelineLayoutVulkan* GetOrCreateLayout(DescriptorSetLayoutInfoVulkan& key);
     void OnImageViewDestroy(VkImageView imageView);
 
+private:
+
+    struct FrameSubmission
+    {
+        CmdBufferVulkan* CmdBuffer;
+        uint64 FenceCounter;
+    };
+
+    FrameSubmission _frameSubmissions[GPU_MAX_FRAMES_IN_FLIGHT] = {};
+    int32 _frameSubmissionIndex = 0;
+
+public:
+
+    /// <summary>
+    /// Registers the command buffer that ends the frame rendering (submitted on present). Used to limit the amount of frames in flight.
+    /// </summary>
+    /// <param name="cmdBuffer">The submitted command buffer.</param>
+    void OnFrameSubmitted(CmdBufferVulkan* cmdBuffer);
+
+    /// <summary>
+    /// Waits for the GPU to complete the recent frames so only the given amount of frames is in flight.
+    /// </summary>
+    /// <param name="framesInFlight">The maximum amount of frames that can be still executed by the GPU.</param>
+    void WaitForFramesInFlight(int32 framesInFlight);
+
 public:
 
     /// <summary>
@@ -696,12 +746,22 @@ class GPUDeviceVulkan : public GPUDevice
 
     // [GPUDevice]
     GPUContext* GetMainContext() override;
+    GPUContext* GetAsyncComputeContext() override;
     GPUAdapter* GetAdapter() const override;
     void* GetNativePtr() const override;
+    MemoryBudget GetMemoryBudget() const override;
     bool Init() override;
     void DrawBegin() override;
     void Dispose() override;
     void WaitForGPU() override;
+    GPUContext* CreateDeferredContext() override;
+    void ExecuteDeferredContexts(const Span<GPUContext*>& contexts) override;
+    bool LoadPipelineStatesManifest(const StringView& path) override;
+    bool SavePipelineStatesManifest(const StringView& path) const override;
+    void* AllocateAliasingMemory(uint64 size) override;
+    void ReleaseAliasingMemory(void* memory) override;
+    bool GetAliasedTextureSize(const GPUTextureDescription& desc, uint64& size, uint64& alignment) override;
+    GPUTexture* CreateAliasedTexture(const StringView& name, const GPUTextureDescription& desc, void* memory, uint64 offset) override;
     GPUTexture* CreateTexture(const StringView& name) override;
     GPUShader* CreateShader(const StringView& name) override;
     GPUPipelineState* CreatePipelineState() override;
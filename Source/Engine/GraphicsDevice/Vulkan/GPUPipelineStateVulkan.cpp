@@ -174,6 +174,7 @@ VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
 
     // Cache it
     _pipelines.Add(renderPass, pipeline);
+    _device->PipelineStatesManifest.Add(GetHash(), renderPass->Layout);
 
     return pipeline;
 }
@@ -275,6 +276,10 @@ bool GPUPipelineStateVulkan::Init(const Description& desc)
     _dynamicStates[_descDynamic.dynamicStateCount++] = VK_DYNAMIC_STATE_VIEWPORT;
     _dynamicStates[_descDynamic.dynamicStateCount++] = VK_DYNAMIC_STATE_SCISSOR;
     //_dynamicStates[_descDynamic.dynamicStateCount++] = VK_DYNAMIC_STATE_STENCIL_REFERENCE;
+#if VK_KHR_fragment_shading_rate
+    if (GPUDeviceVulkan::OptionalDeviceExtensions.HasKHRFragmentShadingRate)
+        _dynamicStates[_descDynamic.dynamicStateCount++] = VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR;
+#endif
     static_assert(ARRAY_COUNT(_dynamicStates) <= 3, "Invalid dynamic states array.");
     _desc.pDynamicState = &_descDynamic;
 
@@ -386,7 +391,19 @@ bool GPUPipelineStateVulkan::Init(const Description& desc)
     // Set non-zero memory usage
     _memoryUsage = sizeof(VkGraphicsPipelineCreateInfo);
 
-    return GPUPipelineState::Init(desc);
+    if (GPUPipelineState::Init(desc))
+        return true;
+
+    // Prewarm pipelines recorded in the previous runs to reduce hitches on the first draw
+    Array<RenderTargetLayoutVulkan> layouts;
+    if (_device->PipelineStatesManifest.Get(GetHash(), layouts))
+    {
+        PROFILE_CPU_NAMED("Prewarm Pipeline States");
+        for (RenderTargetLayoutVulkan& layout : layouts)
+            GetState(_device->GetOrCreateRenderPass(layout));
+    }
+
+    return false;
 }
 
 #endif
@@ -12,6 +12,7 @@
 #include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Threading/Threading.h"
 
 #if PLATFORM_DESKTOP
 #define VULKAN_UNIFORM_RING_BUFFER_SIZE 24 * 1024 * 1024
@@ -50,6 +51,7 @@ UniformBufferUploaderVulkan::UniformBufferUploaderVulkan(GPUDeviceVulkan* device
 UniformBufferUploaderVulkan::Allocation UniformBufferUploaderVulkan::Allocate(uint64 size, uint32 alignment, GPUContextVulkan* context)
 {
     alignment = Math::Max(_minAlignment, alignment);
+    ScopeLock lock(_locker);
     uint64 offset = Math::AlignUp<uint64>(_offset, alignment);
 
     // Check if wrap around ring buffer
@@ -83,6 +85,15 @@ UniformBufferUploaderVulkan::Allocation UniformBufferUploaderVulkan::Allocate(ui
     return result;
 }
 
+void GPUConstantBufferVulkan::DescriptorAsDynamicUniformBuffer(GPUContextVulkan* context, VkBuffer& buffer, VkDeviceSize& offset, VkDeviceSize& range, uint32& dynamicOffset)
+{
+    const auto& allocation = context->GetCBAllocation(this);
+    buffer = allocation.Buffer;
+    offset = 0;
+    range = allocation.Size;
+    dynamicOffset = (uint32)allocation.Offset;
+}
+
 void UniformBufferUploaderVulkan::OnReleaseGPU()
 {
     if (_allocation != VK_NULL_HANDLE)
@@ -51,6 +51,7 @@ class UniformBufferUploaderVulkan : public GPUResourceVulkan<GPUResource>, publi
     byte* _mapped;
     CmdBufferVulkan* _fenceCmdBuffer;
     uint64 _fenceCounter;
+    CriticalSection _locker;
 
 public:
 
@@ -112,13 +113,7 @@ class GPUConstantBufferVulkan : public GPUResourceVulkan<GPUConstantBuffer>, pub
 public:
 
     // [DescriptorOwnerResourceVulkan]
-    void DescriptorAsDynamicUniformBuffer(GPUContextVulkan* context, VkBuffer& buffer, VkDeviceSize& offset, VkDeviceSize& range, uint32& dynamicOffset) override
-    {
-        buffer = Allocation.Buffer;
-        offset = 0;
-        range = Allocation.Size;
-        dynamicOffset = (uint32)Allocation.Offset;
-    }
+    void DescriptorAsDynamicUniformBuffer(GPUContextVulkan* context, VkBuffer& buffer, VkDeviceSize& offset, VkDeviceSize& range, uint32& dynamicOffset) override;
 };
 
 /// <summary>
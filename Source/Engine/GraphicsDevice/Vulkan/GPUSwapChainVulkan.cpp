@@ -10,6 +10,7 @@
 #include "CmdBufferVulkan.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Scripting/Enums.h"
 
 void BackBufferVulkan::Setup(GPUSwapChainVulkan* window, VkImage backbuffer, PixelFormat format, VkExtent3D extent)
@@ -99,6 +100,13 @@ void GPUSwapChainVulkan::SetFullscreen(bool isFullscreen)
 #endif
 }
 
+void GPUSwapChainVulkan::WaitForFrameLatency()
+{
+    // Wait for the GPU to finish the last presented frame
+    GPUDeviceLock lock(_device);
+    _device->WaitForFramesInFlight(1);
+}
+
 GPUTextureView* GPUSwapChainVulkan::GetBackBufferView()
 {
     if (_acquiredImageIndex == -1)
@@ -373,7 +381,8 @@ bool GPUSwapChainVulkan::CreateSwapChain(int32 width, int32 height)
     VkSwapchainCreateInfoKHR swapChainInfo;
     RenderToolsVulkan::ZeroStruct(swapChainInfo, VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR);
     swapChainInfo.surface = _surface;
-    swapChainInfo.minImageCount = Math::Clamp<uint32_t>(VULKAN_BACK_BUFFERS_COUNT, surfProperties.minImageCount, Math::Min<uint32_t>(surfProperties.maxImageCount, VULKAN_BACK_BUFFERS_COUNT_MAX));
+    const uint32 backBuffersCount = Math::Max<uint32>(VULKAN_BACK_BUFFERS_COUNT, Graphics::MaxFramesInFlight + 1); // Use more back buffers for the deeper frames pipelining
+    swapChainInfo.minImageCount = Math::Clamp<uint32_t>(backBuffersCount, surfProperties.minImageCount, Math::Min<uint32_t>(surfProperties.maxImageCount, VULKAN_BACK_BUFFERS_COUNT_MAX));
     swapChainInfo.imageFormat = result.format;
     swapChainInfo.imageColorSpace = result.colorSpace;
     swapChainInfo.imageExtent.width = width;
@@ -578,7 +587,10 @@ void GPUSwapChainVulkan::Present(bool vsync)
     context->AddImageBarrier(backBuffer, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
     context->FlushBarriers();
 
+    const auto cmdBuffer = context->GetCmdBufferManager()->GetActiveCmdBuffer();
     context->GetCmdBufferManager()->SubmitActiveCmdBuffer(_backBuffers[_acquiredImageIndex].RenderingDoneSemaphore);
+    if (cmdBuffer && cmdBuffer->IsSubmitted())
+        _device->OnFrameSubmitted(cmdBuffer);
 
     // Present the back buffer to the viewport window
     const auto result = TryPresent(DoPresent, _device->PresentQueue, true);
@@ -118,6 +118,7 @@ class GPUSwapChainVulkan : public GPUResourceVulkan<GPUSwapChain>, public Resour
     bool IsFullscreen() override;
     void SetFullscreen(bool isFullscreen) override;
     GPUTextureView* GetBackBufferView() override;
+    void WaitForFrameLatency() override;
     void Present(bool vsync) override;
     bool Resize(int32 width, int32 height) override;
     void CopyBackbuffer(GPUContext* context, GPUTexture* dst) override;
@@ -213,54 +213,39 @@ void GPUTextureVulkan::DescriptorAsStorageImage(GPUContextVulkan* context, VkIma
     context->AddImageBarrier(this, VK_IMAGE_LAYOUT_GENERAL);
 }
 
-bool GPUTextureVulkan::OnInit()
+static bool GetImageInfo(GPUDeviceVulkan* device, GPUTextureDescription& desc, VkImageCreateInfo& imageInfo)
 {
-    // Check if texture should have optimal CPU read/write access
-    if (IsStaging())
-    {
-        // TODO: rowAlign/sliceAlign on Vulkan texture ???
-        const int32 totalSize = ComputeBufferTotalSize(1, 1);
-        StagingBuffer = (GPUBufferVulkan*)_device->CreateBuffer(TEXT("Texture.StagingBuffer"));
-        if (StagingBuffer->Init(GPUBufferDescription::Buffer(totalSize, GPUBufferFlags::None, PixelFormat::Unknown, nullptr, 0, _desc.Usage)))
-        {
-            Delete(StagingBuffer);
-            return true;
-        }
-        _memoryUsage = 1;
-        return false;
-    }
-
-    const bool useSRV = IsShaderResource();
-    const bool useDSV = IsDepthStencil();
-    const bool useRTV = IsRenderTarget();
-    const bool useUAV = IsUnorderedAccess();
+    const bool useSRV = desc.IsShaderResource();
+    const bool useDSV = desc.IsDepthStencil();
+    const bool useRTV = desc.IsRenderTarget();
+    const bool useUAV = desc.IsUnorderedAccess();
+    const bool isSRGB = PixelFormatExtensions::IsSRGB(desc.Format);
 
     const bool optimalTiling = true;
-    PixelFormat format = _desc.Format;
+    PixelFormat format = desc.Format;
     if (useDSV)
         format = PixelFormatExtensions::FindDepthStencilFormat(format);
-    _desc.Format = _device->GetClosestSupportedPixelFormat(format, _desc.Flags, optimalTiling);
-    if (_desc.Format == PixelFormat::Unknown)
+    desc.Format = device->GetClosestSupportedPixelFormat(format, desc.Flags, optimalTiling);
+    if (desc.Format == PixelFormat::Unknown)
     {
         LOG(Error, "Unsupported texture format {0}.", ScriptingEnum::ToString(format));
         return true;
     }
 
     // Setup texture description
-    VkImageCreateInfo imageInfo;
     RenderToolsVulkan::ZeroStruct(imageInfo, VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO);
-    imageInfo.imageType = IsVolume() ? VK_IMAGE_TYPE_3D : VK_IMAGE_TYPE_2D;
-    imageInfo.format = RenderToolsVulkan::ToVulkanFormat(Format());
-    imageInfo.mipLevels = MipLevels();
-    imageInfo.arrayLayers = ArraySize();
-    imageInfo.extent.width = Width();
-    imageInfo.extent.height = Height();
-    imageInfo.extent.depth = Depth();
-    imageInfo.flags = IsCubeMap() ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
-    if (IsSRGB())
+    imageInfo.imageType = desc.IsVolume() ? VK_IMAGE_TYPE_3D : VK_IMAGE_TYPE_2D;
+    imageInfo.format = RenderToolsVulkan::ToVulkanFormat(desc.Format);
+    imageInfo.mipLevels = desc.MipLevels;
+    imageInfo.arrayLayers = desc.ArraySize;
+    imageInfo.extent.width = desc.Width;
+    imageInfo.extent.height = desc.Height;
+    imageInfo.extent.depth = desc.Depth;
+    imageInfo.flags = desc.IsCubeMap() ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0;
+    if (isSRGB)
         imageInfo.flags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
 #if VK_KHR_maintenance1
-    if (_device->OptionalDeviceExtensions.HasKHRMaintenance1 && imageInfo.imageType == VK_IMAGE_TYPE_3D)
+    if (device->OptionalDeviceExtensions.HasKHRMaintenance1 && imageInfo.imageType == VK_IMAGE_TYPE_3D)
         imageInfo.flags |= VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT_KHR;
 #endif
     imageInfo.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
@@ -274,18 +259,78 @@ bool GPUTextureVulkan::OnInit()
         imageInfo.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
 #if PLATFORM_MAC || PLATFORM_IOS
     // MoltenVK: VK_ERROR_FEATURE_NOT_PRESENT: vkCreateImageView(): 2D views on 3D images can only be used as color attachments.
-    if (IsVolume() && _desc.HasPerSliceViews())
+    if (desc.IsVolume() && desc.HasPerSliceViews())
         imageInfo.usage &= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
 #endif
     imageInfo.tiling = optimalTiling ? VK_IMAGE_TILING_OPTIMAL : VK_IMAGE_TILING_LINEAR;
-    imageInfo.samples = (VkSampleCountFlagBits)MultiSampleLevel();
+    imageInfo.samples = (VkSampleCountFlagBits)desc.MultiSampleLevel;
     // TODO: set initialLayout to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL for IsRegularTexture() ???
+    return false;
+}
 
-    // Create texture
-    VmaAllocationCreateInfo allocInfo = {};
-    allocInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
-    const VkResult result = vmaCreateImage(_device->Allocator, &imageInfo, &allocInfo, &_image, &_allocation, nullptr);
+bool GPUTextureVulkan::GetMemoryRequirements(GPUDeviceVulkan* device, const GPUTextureDescription& desc, VkMemoryRequirements& requirements)
+{
+    GPUTextureDescription imageDesc = desc;
+    VkImageCreateInfo imageInfo;
+    if (imageDesc.Usage == GPUResourceUsage::StagingUpload || imageDesc.Usage == GPUResourceUsage::StagingReadback || GetImageInfo(device, imageDesc, imageInfo))
+        return true;
+    VkImage image;
+    const VkResult result = vkCreateImage(device->Device, &imageInfo, nullptr, &image);
     LOG_VULKAN_RESULT_WITH_RETURN(result);
+    vkGetImageMemoryRequirements(device->Device, image, &requirements);
+    vkDestroyImage(device->Device, image, nullptr);
+    return false;
+}
+
+bool GPUTextureVulkan::OnInit()
+{
+    // Check if texture should have optimal CPU read/write access
+    if (IsStaging())
+    {
+        // TODO: rowAlign/sliceAlign on Vulkan texture ???
+        const int32 totalSize = ComputeBufferTotalSize(1, 1);
+        StagingBuffer = (GPUBufferVulkan*)_device->CreateBuffer(TEXT("Texture.StagingBuffer"));
+        if (StagingBuffer->Init(GPUBufferDescription::Buffer(totalSize, GPUBufferFlags::None, PixelFormat::Unknown, nullptr, 0, _desc.Usage)))
+        {
+            Delete(StagingBuffer);
+            return true;
+        }
+        _memoryUsage = 1;
+        return false;
+    }
+
+    VkImageCreateInfo imageInfo;
+    if (GetImageInfo(_device, _desc, imageInfo))
+        return true;
+    const PixelFormat format = _desc.Format;
+
+    // Create texture
+    if (_aliasingMemory)
+    {
+        // Place texture in the memory shared with other aliased textures
+        VkResult result = vkCreateImage(_device->Device, &imageInfo, nullptr, &_image);
+        LOG_VULKAN_RESULT_WITH_RETURN(result);
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(_device->Device, _image, &requirements);
+        VmaAllocationInfo memoryInfo;
+        vmaGetAllocationInfo(_device->Allocator, _aliasingMemory, &memoryInfo);
+        result = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+        if ((requirements.memoryTypeBits & (1u << memoryInfo.memoryType)) != 0 && _aliasingOffset % requirements.alignment == 0 && _aliasingOffset + requirements.size <= memoryInfo.size)
+            result = vmaBindImageMemory2(_device->Allocator, _aliasingMemory, _aliasingOffset, _image, nullptr);
+        if (result != VK_SUCCESS)
+        {
+            vkDestroyImage(_device->Device, _image, nullptr);
+            _image = VK_NULL_HANDLE;
+            LOG_VULKAN_RESULT_WITH_RETURN(result);
+        }
+    }
+    else
+    {
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.usage = VMA_MEMORY_USAGE_GPU_ONLY;
+        const VkResult result = vmaCreateImage(_device->Allocator, &imageInfo, &allocInfo, &_image, &_allocation, nullptr);
+        LOG_VULKAN_RESULT_WITH_RETURN(result);
+    }
 #if GPU_ENABLE_RESOURCE_NAMING
     VK_SET_DEBUG_NAME(_device, _image, VK_OBJECT_TYPE_IMAGE, GetName());
 #endif
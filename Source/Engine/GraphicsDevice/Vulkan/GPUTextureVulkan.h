@@ -87,6 +87,8 @@ class GPUTextureVulkan : public GPUResourceVulkan<GPUTexture>, public ResourceOw
 
     VkImage _image = VK_NULL_HANDLE;
     VmaAllocation _allocation = VK_NULL_HANDLE;
+    VmaAllocation _aliasingMemory = VK_NULL_HANDLE;
+    VkDeviceSize _aliasingOffset = 0;
     GPUTextureViewVulkan _handleArray;
     GPUTextureViewVulkan _handleVolume;
     GPUTextureViewVulkan _handleUAV;
@@ -116,6 +118,26 @@ class GPUTextureVulkan : public GPUResourceVulkan<GPUTexture>, public ResourceOw
         return _image;
     }
 
+    /// <summary>
+    /// Sets the memory to place the texture in (shared with other aliased textures). Must be called before the texture initialization.
+    /// </summary>
+    /// <param name="memory">The memory allocation.</param>
+    /// <param name="offset">The offset in the memory (in bytes).</param>
+    FORCE_INLINE void SetAliasingMemory(VmaAllocation memory, VkDeviceSize offset)
+    {
+        _aliasingMemory = memory;
+        _aliasingOffset = offset;
+    }
+
+    /// <summary>
+    /// Gets the memory requirements of the texture image.
+    /// </summary>
+    /// <param name="device">The graphics device.</param>
+    /// <param name="desc">The texture description.</param>
+    /// <param name="requirements">The result memory requirements.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool GetMemoryRequirements(GPUDeviceVulkan* device, const GPUTextureDescription& desc, VkMemoryRequirements& requirements);
+
     /// <summary>
     /// The Vulkan staging buffer (used by the staging textures for memory transfers).
     /// </summary>
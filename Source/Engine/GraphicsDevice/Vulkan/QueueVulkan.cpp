@@ -7,16 +7,16 @@
 #include "CmdBufferVulkan.h"
 #include "RenderToolsVulkan.h"
 
-QueueVulkan::QueueVulkan(GPUDeviceVulkan* device, uint32 familyIndex)
+QueueVulkan::QueueVulkan(GPUDeviceVulkan* device, uint32 familyIndex, uint32 queueIndex)
     : _queue(VK_NULL_HANDLE)
     , _familyIndex(familyIndex)
-    , _queueIndex(0)
+    , _queueIndex(queueIndex)
     , _device(device)
     , _lastSubmittedCmdBuffer(nullptr)
     , _lastSubmittedCmdBufferFenceCounter(0)
     , _submitCounter(0)
 {
-    vkGetDeviceQueue(device->Device, familyIndex, 0, &_queue);
+    vkGetDeviceQueue(device->Device, familyIndex, queueIndex, &_queue);
 }
 
 void QueueVulkan::Submit(CmdBufferVulkan* cmdBuffer, uint32 numSignalSemaphores, VkSemaphore* signalSemaphores)
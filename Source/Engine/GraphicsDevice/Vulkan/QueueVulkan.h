@@ -29,7 +29,7 @@ class QueueVulkan
 
 public:
 
-    QueueVulkan(GPUDeviceVulkan* device, uint32 familyIndex);
+    QueueVulkan(GPUDeviceVulkan* device, uint32 familyIndex, uint32 queueIndex = 0);
 
     inline uint32 GetFamilyIndex() const
     {
@@ -37,6 +37,13 @@
 
 namespace
 {
+    FORCE_INLINE void SyncTransform(Scene* scene)
+    {
+        // Apply the deferred transformations before computing the local transformation from the parent
+        if (scene && scene->Transforms.HasDirty())
+            scene->Transforms.Flush();
+    }
+
     Actor* GetChildByPrefabObjectId(Actor* a, const Guid& prefabObjectId)
     {
         Actor* result = nullptr;
@@ -72,6 +79,8 @@ Actor::Actor(const SpawnParams& params)
     , _isActiveInHierarchy(true)
     , _isPrefabRoot(false)
     , _isEnabled(false)
+    , _isTransformDirty(false)
+    , _isIndexDirty(false)
     , _layer(0)
     , _staticFlags(StaticFlags::FullyStatic)
     , _localTransform(Transform::Identity)
@@ -93,6 +102,8 @@ SceneRendering* Actor::GetSceneRendering() const
 
 void Actor::SetSceneInHierarchy(Scene* scene)
 {
+    if (_isTransformDirty && _scene != scene)
+        _scene->Transforms.RemoveDirty(this);
     _scene = scene;
 
     for (int32 i = 0; i < Children.Count(); i++)
@@ -145,6 +156,9 @@ String Actor::ToString() const
 
 void Actor::OnDeleteObject()
 {
+    if (_isTransformDirty)
+        _scene->Transforms.RemoveDirty(this);
+
     // Check if actor is still in game (eg. user deletes actor object via Object.Delete)
     if (IsDuringPlay())
     {
@@ -309,6 +323,7 @@ void Actor::SetParent(Actor* value, bool worldPositionsStays, bool canBreakPrefa
     // Update the transform
     if (worldPositionsStays)
     {
+        SyncTransform(newScene);
         if (_parent)
         {
             _parent->GetTransform().WorldToLocal(prevTransform, _localTransform);
@@ -474,6 +489,19 @@ bool Actor::HasTag(const StringView& tag) const
 void Actor::AddTag(const Tag& tag)
 {
     Tags.AddUnique(tag);
+    OnTagsChanged();
+}
+
+void Actor::RemoveTag(const Tag& tag)
+{
+    Tags.Remove(tag);
+    OnTagsChanged();
+}
+
+void Actor::OnTagsChanged()
+{
+    if (_isEnabled && _parent)
+        _scene->ActorsIndex.UpdateTags(this);
 }
 
 PRAGMA_DISABLE_DEPRECATION_WARNINGS
@@ -487,6 +515,7 @@ void Actor::SetTag(const StringView& value)
 {
     const Tag tag = Tags::Get(value);
     Tags.Set(&tag, 1);
+    OnTagsChanged();
 }
 
 PRAGMA_ENABLE_DEPRECATION_WARNINGS
@@ -572,6 +601,7 @@ void Actor::SetStaticFlags(StaticFlags value)
 void Actor::SetTransform(const Transform& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    SyncTransform(_scene);
     if (!(Vector3::NearEqual(_transform.Translation, value.Translation) && Quaternion::NearEqual(_transform.Orientation, value.Orientation, ACTOR_ORIENTATION_EPSILON) && Float3::NearEqual(_transform.Scale, value.Scale)))
     {
         if (_parent)
@@ -585,6 +615,7 @@ void Actor::SetTransform(const Transform& value)
 void Actor::SetPosition(const Vector3& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    SyncTransform(_scene);
     if (!Vector3::NearEqual(_transform.Translation, value))
     {
         if (_parent)
@@ -598,6 +629,7 @@ void Actor::SetPosition(const Vector3& value)
 void Actor::SetOrientation(const Quaternion& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    SyncTransform(_scene);
     if (!Quaternion::NearEqual(_transform.Orientation, value, ACTOR_ORIENTATION_EPSILON))
     {
         if (_parent)
@@ -618,6 +650,7 @@ void Actor::SetOrientation(const Quaternion& value)
 void Actor::SetScale(const Float3& value)
 {
     CHECK(!value.IsNanOrInfinity());
+    SyncTransform(_scene);
     if (!Float3::NearEqual(_transform.Scale, value))
     {
         if (_parent)
@@ -1022,6 +1055,7 @@ void Actor::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
             }
         }
     }
+    OnTagsChanged();
 
     {
         const auto member = stream.FindMember("PrefabID");
@@ -1061,6 +1095,8 @@ void Actor::OnEnable()
 {
     ASSERT(!_isEnabled);
     _isEnabled = true;
+    if (_parent)
+        _scene->ActorsIndex.Add(this);
 
     for (int32 i = 0; i < Scripts.Count(); i++)
     {
@@ -1081,6 +1117,8 @@ void Actor::OnDisable()
 {
     ASSERT(_isEnabled);
     _isEnabled = false;
+    if (_parent)
+        _scene->ActorsIndex.Remove(this);
 
     for (int32 i = Scripts.Count() - 1; i >= 0; i--)
     {
@@ -1098,6 +1136,17 @@ void Actor::OnTransformChanged()
 {
     ASSERT_LOW_LAYER(!_localTransform.IsNanOrInfinity());
 
+    // Mark actor bounds as modified to update the spatial index
+    if (_isEnabled && _parent)
+        _scene->ActorsIndex.MarkDirty(this);
+
+    // Skip when notified by the deferred transformations flush (world transformation is already computed and children are updated by the flush)
+    if (SceneTransforms::_notified == this)
+    {
+        SceneTransforms::_notified = nullptr;
+        return;
+    }
+
     if (_parent)
     {
         _parent->_transform.LocalToWorld(_localTransform, _transform);
@@ -1107,6 +1156,13 @@ void Actor::OnTransformChanged()
         _transform = _localTransform;
     }
 
+    // Defer the children update
+    if (_scene && _scene->Transforms.IsDeferred() && Children.HasItems())
+    {
+        _scene->Transforms.MarkDirty(this);
+        return;
+    }
+
     for (auto child : Children)
     {
         child->OnTransformChanged();
@@ -19,6 +19,8 @@ class MemoryWriteStream;
 class PhysicsScene;
 class SceneRendering;
 class SceneRenderTask;
+class SceneTransforms;
+class SceneActorsIndex;
 
 /// <summary>
 /// Base class for all actor objects on the scene.
@@ -32,6 +34,8 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     friend SceneRendering;
     friend Prefab;
     friend PrefabInstanceData;
+    friend SceneTransforms;
+    friend SceneActorsIndex;
 protected:
     int16 _isActive : 1;
     int16 _isActiveInHierarchy : 1;
@@ -39,6 +43,8 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     int16 _isEnabled : 1;
     int16 _drawNoCulling : 1;
     int16 _drawCategory : 4;
+    int16 _isTransformDirty : 1;
+    int16 _isIndexDirty : 1;
     byte _layer;
     StaticFlags _staticFlags;
     Transform _localTransform;
@@ -76,6 +82,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Actor tags collection.
     /// </summary>
+    /// <remarks>When modifying the collection directly at runtime call OnTagsChanged to update the scene actors lookup by tag (AddTag and RemoveTag do it automatically).</remarks>
     API_FIELD(Attributes="NoAnimate, EditorDisplay(\"General\"), EditorOrder(-68)") Array<Tag> Tags;
 
 public:
@@ -136,6 +143,17 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <param name="tag">The tag to add.</param>
     API_FUNCTION() void AddTag(const Tag& tag);
 
+    /// <summary>
+    /// Removes a tag from the actor
+    /// </summary>
+    /// <param name="tag">The tag to remove.</param>
+    API_FUNCTION() void RemoveTag(const Tag& tag);
+
+    /// <summary>
+    /// Called when actor tags collection gets modified. Updates the scene actors lookup by tag.
+    /// </summary>
+    API_FUNCTION() void OnTagsChanged();
+
     /// <summary>
     /// Gets the name of the tag.
     /// [Deprecated in v1.5]
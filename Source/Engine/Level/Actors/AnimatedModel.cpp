@@ -5,6 +5,7 @@
 #include "Engine/Core/Math/Matrix3x4.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Animations/Animations.h"
+#include "Engine/Animations/InverseKinematics.h"
 #include "Engine/Engine/Engine.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
@@ -14,6 +15,7 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/SceneObjectsFactory.h"
+#include "Engine/Physics/Types.h"
 #include "Engine/Serialization/Serialization.h"
 
 AnimatedModel::AnimatedModel(const SpawnParams& params)
@@ -481,6 +483,7 @@ void AnimatedModel::BeginPlay(SceneBeginData* data)
 void AnimatedModel::EndPlay()
 {
     Animations::RemoveFromUpdate(this);
+    Animations::ReleaseSharedPose(this);
     SetMasterPoseModel(nullptr);
 
     // Base
@@ -561,6 +564,120 @@ void AnimatedModel::UpdateSockets()
     }
 }
 
+void AnimatedModel::UpdateSkinningData(const SkeletonData& skeleton, const Array<Matrix>& nodesPose, SkinnedMeshDrawData& skinningData, bool dropHistory)
+{
+    const int32 bonesCount = skeleton.Bones.Count();
+    Matrix3x4* output = (Matrix3x4*)skinningData.Data.Get();
+    ASSERT(nodesPose.Count() == skeleton.Nodes.Count());
+    ASSERT(skinningData.Data.Count() == bonesCount * sizeof(Matrix3x4));
+    for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
+    {
+        const SkeletonBone& bone = skeleton.Bones[boneIndex];
+        Matrix matrix;
+        Matrix::Multiply(bone.OffsetMatrix, nodesPose.Get()[bone.NodeIndex], matrix);
+        output[boneIndex].SetMatrixTranspose(matrix);
+    }
+    skinningData.OnDataChanged(dropHistory);
+}
+
+void AnimatedModel::PrepareFootIK()
+{
+    // Resolve the IK chains (root, joint and node) for the current skeleton, invalid chains use index -1
+    const auto& skeleton = SkinnedModel->Skeleton;
+    const bool hasPose = GraphInstance.NodesPose.Count() == skeleton.Nodes.Count();
+    _footIKChains.Resize(FootIK.Count(), false);
+    for (int32 i = 0; i < FootIK.Count(); i++)
+    {
+        const AnimatedModelFootIK& ik = FootIK[i];
+        Int3& chain = _footIKChains[i];
+        chain = Int3(-1);
+        const int32 nodeIndex = hasPose && ik.Weight > ANIM_GRAPH_BLEND_THRESHOLD ? skeleton.FindNode(ik.Node) : -1;
+        const int32 jointIndex = nodeIndex != -1 ? skeleton.Nodes[nodeIndex].ParentIndex : -1;
+        const int32 rootIndex = jointIndex != -1 ? skeleton.Nodes[jointIndex].ParentIndex : -1;
+        if (rootIndex != -1)
+            chain = Int3(rootIndex, jointIndex, nodeIndex);
+    }
+}
+
+void AnimatedModel::GetFootIKRays(Array<RayCastCommand>& rays) const
+{
+    const Vector3 up = _transform.GetUp();
+    for (int32 i = 0; i < _footIKChains.Count(); i++)
+    {
+        const Int3& chain = _footIKChains[i];
+        if (chain.X == -1)
+            continue;
+        const AnimatedModelFootIK& ik = FootIK[i];
+        RayCastCommand& ray = rays.AddOne();
+        ray.Origin = _transform.LocalToWorld(GraphInstance.NodesPose[chain.Z].GetTranslation()) + up * ik.RayHeight;
+        ray.Direction = -up;
+        ray.MaxDistance = ik.RayHeight + ik.RayDistance;
+        ray.LayerMask = ik.LayerMask;
+        ray.HitTriggers = false;
+    }
+}
+
+void AnimatedModel::ApplyFootIK(const RayCastHit* hits)
+{
+    ANIM_GRAPH_PROFILE_EVENT("Foot IK");
+    auto& skeleton = SkinnedModel->Skeleton;
+    Matrix* pose = GraphInstance.NodesPose.Get();
+    const int32 nodesCount = GraphInstance.NodesPose.Count();
+    Array<int32, InlinedAllocation<256>> deltaIndices;
+    for (int32 i = 0; i < _footIKChains.Count(); i++)
+    {
+        const Int3& chain = _footIKChains[i];
+        if (chain.X == -1)
+            continue;
+        const RayCastHit& hit = *hits++;
+        if (!hit.Collider)
+            continue;
+        const AnimatedModelFootIK& ik = FootIK[i];
+
+        // Offset the node by the ground height (animated pose assumes the ground at the model origin)
+        Transform root, joint, node;
+        pose[chain.X].Decompose(root);
+        pose[chain.Y].Decompose(joint);
+        pose[chain.Z].Decompose(node);
+        const Vector3 ground = _transform.WorldToLocal(hit.Point);
+        const Vector3 target = node.Translation + Vector3(0, ground.Y * ik.Weight, 0);
+        const Vector3 jointTarget = joint.Translation * 2.0f - (root.Translation + node.Translation) * 0.5f;
+        InverseKinematics::SolveTwoBoneIK(root, joint, node, target, jointTarget);
+        if (ik.AlignToGround)
+        {
+            const Float3 normal = Float3(_transform.WorldToLocalVector(hit.Normal)).GetNormalized();
+            Quaternion alignment;
+            Quaternion::Slerp(Quaternion::Identity, Quaternion::FindBetween(Float3::Up, normal), ik.Weight, alignment);
+            node.Orientation = alignment * node.Orientation;
+        }
+
+        // Update the chain nodes and propagate the correction to the child nodes (nodes are sorted parents first)
+        Matrix deltas[3], inverse, world;
+        const Transform* solved[3] = { &root, &joint, &node };
+        deltaIndices.Clear();
+        deltaIndices.Resize(nodesCount - chain.X);
+        for (int32 j = 0; j < 3; j++)
+        {
+            const int32 nodeIndex = chain.Raw[j];
+            Matrix::Invert(pose[nodeIndex], inverse);
+            solved[j]->GetWorld(world);
+            Matrix::Multiply(inverse, world, deltas[j]);
+            pose[nodeIndex] = world;
+            deltaIndices[nodeIndex - chain.X] = j;
+        }
+        for (int32 nodeIndex = chain.X + 1; nodeIndex < nodesCount; nodeIndex++)
+        {
+            int32& deltaIndex = deltaIndices[nodeIndex - chain.X];
+            if (nodeIndex == chain.Y || nodeIndex == chain.Z)
+                continue;
+            const int32 parentIndex = skeleton.Nodes[nodeIndex].ParentIndex;
+            deltaIndex = parentIndex >= chain.X ? deltaIndices[parentIndex - chain.X] : -1;
+            if (deltaIndex != -1)
+                pose[nodeIndex] = pose[nodeIndex] * deltas[deltaIndex];
+        }
+    }
+}
+
 void AnimatedModel::OnAnimationUpdated_Async()
 {
     // Update asynchronous stuff
@@ -577,21 +694,11 @@ void AnimatedModel::OnAnimationUpdated_Async()
         GraphInstance.RootMotion = masterInstance.RootMotion;
     }
 
-    // Calculate the final bones transformations and update skinning
+    // Calculate the final bones transformations and update skinning (shared pose skinning is updated once for all models that use it)
+    if (!_sharedPose)
     {
         ANIM_GRAPH_PROFILE_EVENT("Final Pose");
-        const int32 bonesCount = skeleton.Bones.Count();
-        Matrix3x4* output = (Matrix3x4*)_skinningData.Data.Get();
-        ASSERT(GraphInstance.NodesPose.Count() == skeleton.Nodes.Count());
-        ASSERT(_skinningData.Data.Count() == bonesCount * sizeof(Matrix3x4));
-        for (int32 boneIndex = 0; boneIndex < bonesCount; boneIndex++)
-        {
-            const SkeletonBone& bone = skeleton.Bones[boneIndex];
-            Matrix matrix;
-            Matrix::Multiply(bone.OffsetMatrix, GraphInstance.NodesPose.Get()[bone.NodeIndex], matrix);
-            output[boneIndex].SetMatrixTranspose(matrix);
-        }
-        _skinningData.OnDataChanged(!PerBoneMotionBlur);
+        UpdateSkinningData(skeleton, GraphInstance.NodesPose, _skinningData, !PerBoneMotionBlur);
     }
 
     UpdateBounds();
@@ -708,19 +815,24 @@ void AnimatedModel::Draw(RenderContext& renderContext)
     GEOMETRY_DRAW_STATE_EVENT_BEGIN(_drawState, world);
 
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, renderContext.View.Position + renderContext.View.Origin));
-    if (_skinningData.IsReady())
+    SkinnedMeshDrawData& skinningData = _sharedSkinning ? *_sharedSkinning : _skinningData;
+    if (skinningData.IsReady())
     {
-        // Flush skinning data with GPU
-        if (_skinningData.IsDirty())
+        // Flush skinning data with GPU (once after the update, shared pose skinning can be drawn by many models)
+        if (skinningData.IsDirty())
         {
             RenderContext::GPULocker.Lock();
-            GPUDevice::Instance->GetMainContext()->UpdateBuffer(_skinningData.BoneMatrices, _skinningData.Data.Get(), _skinningData.Data.Count());
+            if (skinningData.IsDirty())
+            {
+                GPUDevice::Instance->GetMainContext()->UpdateBuffer(skinningData.BoneMatrices, skinningData.Data.Get(), skinningData.Data.Count());
+                skinningData.OnFlush();
+            }
             RenderContext::GPULocker.Unlock();
         }
 
         SkinnedMesh::DrawInfo draw;
         draw.Buffer = &Entries;
-        draw.Skinning = &_skinningData;
+        draw.Skinning = &skinningData;
         draw.BlendShapes = &_blendShapes;
         draw.World = &world;
         draw.DrawState = &_drawState;
@@ -751,19 +863,24 @@ void AnimatedModel::Draw(RenderContextBatch& renderContextBatch)
     GEOMETRY_DRAW_STATE_EVENT_BEGIN(_drawState, world);
 
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, renderContext.View.Position + renderContext.View.Origin));
-    if (_skinningData.IsReady())
+    SkinnedMeshDrawData& skinningData = _sharedSkinning ? *_sharedSkinning : _skinningData;
+    if (skinningData.IsReady())
     {
-        // Flush skinning data with GPU
-        if (_skinningData.IsDirty())
+        // Flush skinning data with GPU (once after the update, shared pose skinning can be drawn by many models)
+        if (skinningData.IsDirty())
         {
             RenderContext::GPULocker.Lock();
-            GPUDevice::Instance->GetMainContext()->UpdateBuffer(_skinningData.BoneMatrices, _skinningData.Data.Get(), _skinningData.Data.Count());
+            if (skinningData.IsDirty())
+            {
+                GPUDevice::Instance->GetMainContext()->UpdateBuffer(skinningData.BoneMatrices, skinningData.Data.Get(), skinningData.Data.Count());
+                skinningData.OnFlush();
+            }
             RenderContext::GPULocker.Unlock();
         }
 
         SkinnedMesh::DrawInfo draw;
         draw.Buffer = &Entries;
-        draw.Skinning = &_skinningData;
+        draw.Skinning = &skinningData;
         draw.BlendShapes = &_blendShapes;
         draw.World = &world;
         draw.DrawState = &_drawState;
@@ -844,6 +961,8 @@ void AnimatedModel::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(UpdateWhenOffscreen);
     SERIALIZE(UpdateSpeed);
     SERIALIZE(UpdateMode);
+    SERIALIZE(ShareAnimation);
+    SERIALIZE(SharedAnimationPhase);
     SERIALIZE(BoundsScale);
     SERIALIZE(CustomBounds);
     SERIALIZE(LODBias);
@@ -854,6 +973,7 @@ void AnimatedModel::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(ShadowsMode);
     PRAGMA_ENABLE_DEPRECATION_WARNINGS
     SERIALIZE(RootMotionTarget);
+    SERIALIZE(FootIK);
 
     stream.JKEY("Buffer");
     stream.Object(&Entries, other ? &other->Entries : nullptr);
@@ -871,6 +991,8 @@ void AnimatedModel::Deserialize(DeserializeStream& stream, ISerializeModifier* m
     DESERIALIZE(UpdateWhenOffscreen);
     DESERIALIZE(UpdateSpeed);
     DESERIALIZE(UpdateMode);
+    DESERIALIZE(ShareAnimation);
+    DESERIALIZE(SharedAnimationPhase);
     DESERIALIZE(BoundsScale);
     DESERIALIZE(CustomBounds);
     DESERIALIZE(LODBias);
@@ -881,6 +1003,7 @@ void AnimatedModel::Deserialize(DeserializeStream& stream, ISerializeModifier* m
     DESERIALIZE(ShadowsMode);
     PRAGMA_ENABLE_DEPRECATION_WARNINGS
     DESERIALIZE(RootMotionTarget);
+    DESERIALIZE(FootIK);
 
     Entries.DeserializeIfExists(stream, "Buffer", modifier);
 
@@ -949,6 +1072,7 @@ void AnimatedModel::OnDeleteObject()
 {
     // Ensure this object is no longer referenced for anim update
     Animations::RemoveFromUpdate(this);
+    Animations::ReleaseSharedPose(this);
 
     ModelInstanceActor::OnDeleteObject();
 }
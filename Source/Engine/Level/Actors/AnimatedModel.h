@@ -9,6 +9,55 @@
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Core/Delegate.h"
 
+struct SharedAnimationPose;
+struct RayCastCommand;
+struct RayCastHit;
+
+/// <summary>
+/// The foot placement setup for the animated model. Adjusts the two-bone chain that ends with the node (eg. leg with a foot) to the ground detected with a raycast below the node.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API AnimatedModelFootIK : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(AnimatedModelFootIK);
+
+    /// <summary>
+    /// The name of the skeleton node to place on the ground (eg. foot). Its parent and grandparent nodes are used as the IK chain joint and root (eg. knee and thigh).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0)")
+    String Node;
+
+    /// <summary>
+    /// The IK weight (normalized to range 0-1).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(0, 1, 0.01f)")
+    float Weight = 1.0f;
+
+    /// <summary>
+    /// The distance above the animated node at which the ground raycast starts. Limits the height the node can be lifted.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), Limit(0)")
+    float RayHeight = 50.0f;
+
+    /// <summary>
+    /// The distance below the animated node at which the ground raycast ends. Limits the depth the node can be lowered.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), Limit(0)")
+    float RayDistance = 50.0f;
+
+    /// <summary>
+    /// The layer mask used to filter the ground colliders (eg. to skip the character own colliders).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40)")
+    uint32 LayerMask = MAX_uint32;
+
+    /// <summary>
+    /// If checked, the node will be rotated to match the ground surface normal.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(50)")
+    bool AlignToGround = true;
+};
+
 /// <summary>
 /// Performs an animation and renders a skinned model.
 /// </summary>
@@ -17,6 +66,8 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
 {
     DECLARE_SCENE_OBJECT(AnimatedModel);
     friend class AnimationsSystem;
+    friend class AnimationsPostProcessSystem;
+    friend class Animations;
 public:
     /// <summary>
     /// Describes the animation graph updates frequency for the animated model.
@@ -63,6 +114,9 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     uint64 _lastUpdateFrame;
     BlendShapesInstance _blendShapes;
     ScriptingObjectReference<AnimatedModel> _masterPose;
+    SharedAnimationPose* _sharedPose = nullptr;
+    SkinnedMeshDrawData* _sharedSkinning = nullptr;
+    Array<Int3> _footIKChains;
 
 public:
     /// <summary>
@@ -107,6 +161,18 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     API_FIELD(Attributes="EditorOrder(50), DefaultValue(AnimationUpdateMode.Auto), EditorDisplay(\"Skinned Model\")")
     AnimationUpdateMode UpdateMode = AnimationUpdateMode::Auto;
 
+    /// <summary>
+    /// If true, the animation evaluation can be shared with the other animated models that use the same skinned model, animation graph, parameter values and animation phase (eg. crowds of identical characters). The graph is evaluated once per unique state and the models share the GPU bones buffer. Models that play slot animations or override the local pose are evaluated separately. Anim events and custom nodes are executed only for one of the models.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(55), DefaultValue(false), EditorDisplay(\"Skinned Model\")")
+    bool ShareAnimation = false;
+
+    /// <summary>
+    /// The animation time offset (in seconds) of the shared animation evaluation. Models with the phase within the same Animations.SharedAnimationPhaseStep share the pose. Can be used to desynchronize the crowd characters.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(56), DefaultValue(0.0f), Limit(0), EditorDisplay(\"Skinned Model\"), VisibleIf(nameof(ShareAnimation))")
+    float SharedAnimationPhase = 0.0f;
+
     /// <summary>
     /// The master scale parameter for the actor bounding box. Helps reducing mesh flickering effect on screen edges.
     /// </summary>
@@ -156,6 +222,12 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     API_FIELD(Attributes="EditorOrder(120), DefaultValue(null), EditorDisplay(\"Skinned Model\")")
     ScriptingObjectReference<Actor> RootMotionTarget;
 
+    /// <summary>
+    /// The foot placement IK chains adjusted to the ground after the animation update. Ground raycasts of all animated models are batched into a single physics query in the animations post-process stage. Not used when the model copies the master pose.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(130), EditorDisplay(\"Foot IK\")")
+    Array<AnimatedModelFootIK> FootIK;
+
 public:
     /// <summary>
     /// The graph instance data container. For dynamic usage only at runtime, not serialized.
@@ -350,6 +422,14 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     void Update();
     void UpdateBounds();
     void UpdateSockets();
+    static void UpdateSkinningData(const SkeletonData& skeleton, const Array<Matrix>& nodesPose, SkinnedMeshDrawData& skinningData, bool dropHistory);
+    FORCE_INLINE bool HasFootIK() const
+    {
+        return FootIK.HasItems() && !_masterPose;
+    }
+    void PrepareFootIK();
+    void GetFootIKRays(Array<RayCastCommand>& rays) const;
+    void ApplyFootIK(const RayCastHit* hits);
     void OnAnimationUpdated_Async();
     void OnAnimationUpdated_Sync();
     void OnAnimationUpdated();
@@ -204,8 +204,38 @@ void SplineModel::OnSplineUpdated()
         instance.Sphere.Radius *= maxScale * _boundsScale;
     }
 
+    // Detect the range of segments with modified control points (each keyframe affects both neighbouring segments)
+    int32 dirtyStart = 0, dirtyEnd = segments;
+    if (_deformationKeyframes.Count() == keyframes.Count())
+    {
+        dirtyStart = segments;
+        dirtyEnd = 0;
+        for (int32 i = 0; i < keyframes.Count(); i++)
+        {
+            if (Platform::MemoryCompare(&keyframes[i], &_deformationKeyframes[i], sizeof(BezierCurveKeyframe<Transform>)) != 0)
+            {
+                dirtyStart = Math::Min(dirtyStart, Math::Max(i - 1, 0));
+                dirtyEnd = Math::Max(dirtyEnd, Math::Min(i + 1, segments));
+            }
+        }
+    }
+    _deformationKeyframes = keyframes;
+
     // Update deformation buffer during next drawing
-    _deformationDirty = true;
+    if (dirtyStart < dirtyEnd)
+    {
+        if (_deformationDirty)
+        {
+            _deformationDirtyStart = Math::Min(_deformationDirtyStart, dirtyStart);
+            _deformationDirtyEnd = Math::Max(_deformationDirtyEnd, dirtyEnd);
+        }
+        else
+        {
+            _deformationDirtyStart = dirtyStart;
+            _deformationDirtyEnd = dirtyEnd;
+        }
+        _deformationDirty = true;
+    }
 
     // Update bounds
     _sphere = _instances.First().Sphere;
@@ -229,8 +259,12 @@ void SplineModel::UpdateDeformationBuffer()
     const int32 chunksPerSegment = Math::Clamp(Math::CeilToInt(SPLINE_RESOLUTION * _quality), 2, 1024);
     const int32 count = (chunksPerSegment * segments + 1) * 3;
     const uint32 size = count * sizeof(Float4);
+    int32 dirtyStart = Math::Clamp(_deformationDirtyStart, 0, segments);
+    int32 dirtyEnd = Math::Clamp(_deformationDirtyEnd, dirtyStart, segments);
     if (_deformationBuffer->GetSize() != size)
     {
+        dirtyStart = 0;
+        dirtyEnd = segments;
         if (_deformationBufferData)
         {
             Allocator::Free(_deformationBufferData);
@@ -243,15 +277,24 @@ void SplineModel::UpdateDeformationBuffer()
         }
     }
     if (!_deformationBufferData)
+    {
         _deformationBufferData = Allocator::Allocate(size);
+
+        // Dynamic buffer is discarded on update so the whole contents has to be valid
+        if (_deformationBuffer->IsDynamic())
+        {
+            dirtyStart = 0;
+            dirtyEnd = segments;
+        }
+    }
     _chunksPerSegment = (float)chunksPerSegment;
 
-    // Update pre-calculated matrices for spline chunks
-    auto ptr = (Matrix3x4*)_deformationBufferData;
+    // Update pre-calculated matrices for spline chunks (only within the modified segments)
+    auto ptr = (Matrix3x4*)_deformationBufferData + dirtyStart * chunksPerSegment;
     const float chunksPerSegmentInv = 1.0f / (float)chunksPerSegment;
     Matrix m;
     Transform transform, leftTangent, rightTangent;
-    for (int32 segment = 0; segment < segments; segment++)
+    for (int32 segment = dirtyStart; segment < dirtyEnd; segment++)
     {
         auto& instance = _instances[segment];
         const auto& start = keyframes[segment];
@@ -288,6 +331,7 @@ void SplineModel::UpdateDeformationBuffer()
     }
 
     // Add last transformation to prevent issues when sampling spline deformation buffer with alpha=1
+    if (dirtyEnd == segments)
     {
         const auto& start = keyframes[segments - 1];
         const auto& end = keyframes[segments];
@@ -312,7 +356,17 @@ void SplineModel::UpdateDeformationBuffer()
     }
 
     // Flush data with GPU
-    GPUDevice::Instance->GetMainContext()->UpdateBuffer(_deformationBuffer, _deformationBufferData, size);
+    if (_deformationBuffer->IsDynamic())
+    {
+        GPUDevice::Instance->GetMainContext()->UpdateBuffer(_deformationBuffer, _deformationBufferData, size);
+    }
+    else
+    {
+        // Upload only the modified range of the buffer
+        const uint32 offset = dirtyStart * chunksPerSegment * sizeof(Matrix3x4);
+        const uint32 end = (dirtyEnd * chunksPerSegment + (dirtyEnd == segments ? 1 : 0)) * sizeof(Matrix3x4);
+        GPUDevice::Instance->GetMainContext()->UpdateBuffer(_deformationBuffer, (byte*)_deformationBufferData + offset, end - offset, offset);
+    }
 
     // Static splines are rarely updated so release scratch memory
     if (IsTransformStatic())
@@ -4,6 +4,7 @@
 
 #include "ModelInstanceActor.h"
 #include "Engine/Content/Assets/Model.h"
+#include "Engine/Animations/Curve.h"
 
 class Spline;
 
@@ -30,6 +31,8 @@ API_CLASS() class FLAXENGINE_API SplineModel : public ModelInstanceActor
     GPUBuffer* _deformationBuffer = nullptr;
     void* _deformationBufferData = nullptr;
     float _chunksPerSegment, _meshMinZ, _meshMaxZ;
+    int32 _deformationDirtyStart = 0, _deformationDirtyEnd = 0;
+    Array<BezierCurveKeyframe<Transform>> _deformationKeyframes;
 
 public:
     ~SplineModel();
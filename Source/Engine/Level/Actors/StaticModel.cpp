@@ -7,6 +7,8 @@
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/Models/MeshDrawCache.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Level/Scene/Scene.h"
@@ -36,6 +38,7 @@ StaticModel::~StaticModel()
 {
     for (int32 lodIndex = 0; lodIndex < _vertexColorsCount; lodIndex++)
         SAFE_DELETE_GPU_RESOURCE(_vertexColorsBuffer[lodIndex]);
+    SAFE_DELETE(_drawCache);
 }
 
 float StaticModel::GetScaleInLightmap() const
@@ -217,6 +220,7 @@ void StaticModel::RemoveVertexColors()
         SAFE_DELETE_GPU_RESOURCE(_vertexColorsBuffer[lodIndex]);
     _vertexColorsCount = 0;
     _vertexColorsDirty = false;
+    InvalidateDrawCache();
 }
 
 void StaticModel::OnModelChanged()
@@ -228,6 +232,7 @@ void StaticModel::OnModelChanged()
     }
     RemoveVertexColors();
     Entries.Release();
+    InvalidateDrawCache();
     if (Model && !Model->IsLoaded())
         UpdateBounds();
     else if (!Model && _sceneRenderingKey != -1)
@@ -237,6 +242,7 @@ void StaticModel::OnModelChanged()
 void StaticModel::OnModelLoaded()
 {
     Entries.SetupIfInvalid(Model);
+    InvalidateDrawCache();
     UpdateBounds();
     if (_sceneRenderingKey == -1 && _scene && _isActiveInHierarchy && _isEnabled && !_residencyChangedModel)
     {
@@ -282,6 +288,7 @@ void StaticModel::UpdateBounds()
 
 void StaticModel::FlushVertexColors()
 {
+    InvalidateDrawCache();
     RenderContext::GPULocker.Lock();
     for (int32 lodIndex = 0; lodIndex < _vertexColorsCount; lodIndex++)
     {
@@ -307,6 +314,24 @@ void StaticModel::FlushVertexColors()
     RenderContext::GPULocker.Unlock();
 }
 
+void StaticModel::SetupDrawCache(Mesh::DrawInfo& draw, const Vector3& origin)
+{
+    // Use the persistent draw calls for the static objects
+    if (Graphics::EnableCachedDrawCalls && EnumHasAnyFlags(_staticFlags, StaticFlags::Transform))
+    {
+        if (!_drawCache)
+            _drawCache = New<MeshDrawCache>();
+        _drawCache->Validate(origin, DrawModes, _staticFlags);
+        draw.DrawCache = _drawCache;
+    }
+}
+
+void StaticModel::InvalidateDrawCache()
+{
+    if (_drawCache)
+        _drawCache->Invalidate();
+}
+
 bool StaticModel::HasContentLoaded() const
 {
     return (Model == nullptr || Model->IsLoaded()) && Entries.HasContentLoaded();
@@ -350,6 +375,7 @@ void StaticModel::Draw(RenderContext& renderContext)
     draw.ForcedLOD = _forcedLod;
     draw.SortOrder = _sortOrder;
     draw.VertexColors = _vertexColorsCount ? _vertexColorsBuffer : nullptr;
+    SetupDrawCache(draw, renderContext.View.Origin);
 
     Model->Draw(renderContext, draw);
 
@@ -383,6 +409,7 @@ void StaticModel::Draw(RenderContextBatch& renderContextBatch)
     draw.ForcedLOD = _forcedLod;
     draw.SortOrder = _sortOrder;
     draw.VertexColors = _vertexColorsCount ? _vertexColorsBuffer : nullptr;
+    SetupDrawCache(draw, renderContext.View.Origin);
 
     Model->Draw(renderContextBatch, draw);
 
@@ -593,6 +620,7 @@ void StaticModel::OnTransformChanged()
     // Base
     ModelInstanceActor::OnTransformChanged();
 
+    InvalidateDrawCache();
     UpdateBounds();
 }
 
@@ -7,6 +7,8 @@
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Renderer/Lightmaps.h"
 
+struct MeshDrawCache;
+
 /// <summary>
 /// Renders model on the screen.
 /// </summary>
@@ -25,6 +27,7 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API Sta
     Array<Color32> _vertexColorsData[MODEL_MAX_LODS];
     GPUBuffer* _vertexColorsBuffer[MODEL_MAX_LODS];
     Model* _residencyChangedModel = nullptr;
+    MeshDrawCache* _drawCache = nullptr;
 
 public:
     /// <summary>
@@ -157,6 +160,8 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Model\")") class FLAXENGINE_API Sta
     void OnModelResidencyChanged();
     void UpdateBounds();
     void FlushVertexColors();
+    void SetupDrawCache(Mesh::DrawInfo& draw, const Vector3& origin);
+    void InvalidateDrawCache();
 
 public:
     // [ModelInstanceActor]
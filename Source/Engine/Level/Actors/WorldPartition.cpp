@@ -0,0 +1,190 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "WorldPartition.h"
+#include "Camera.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/Serialization.h"
+
+WorldPartition::WorldPartition(const SpawnParams& params)
+    : Actor(params)
+{
+}
+
+Int2 WorldPartition::GetCellCoordinate(const Vector3& position) const
+{
+    const Vector3 local = position - _transform.Translation;
+    return Int2((int32)Math::Floor(local.X / CellSize), (int32)Math::Floor(local.Z / CellSize));
+}
+
+BoundingBox WorldPartition::GetCellBounds(const Int2& coordinate) const
+{
+    const Vector3 min(_transform.Translation.X + coordinate.X * CellSize, _transform.Translation.Y - CellSize * 0.5f, _transform.Translation.Z + coordinate.Y * CellSize);
+    return BoundingBox(min, min + Vector3(CellSize));
+}
+
+bool WorldPartition::IsCellLoaded(int32 index) const
+{
+    return index >= 0 && index < _cellsData.Count() && _cellsData[index].State == CellState::Loaded;
+}
+
+void WorldPartition::OnUpdate()
+{
+    PROFILE_CPU();
+    if (_cellsData.Count() != Cells.Count())
+    {
+        // Cells were modified so reload them
+        UnloadCells();
+        _cellsData.Resize(Cells.Count());
+    }
+
+    // Gather streaming sources
+    Array<Vector3, InlinedAllocation<8>> sources;
+    if (UseMainCamera)
+    {
+        const Camera* camera = Camera::GetMainCamera();
+        if (camera)
+            sources.Add(camera->GetPosition());
+    }
+    sources.Add(StreamingSources.Get(), StreamingSources.Count());
+
+    // Update cells
+    int32 spawnBudget = MaxCellsSpawnPerFrame;
+    for (int32 i = 0; i < Cells.Count(); i++)
+    {
+        const WorldPartitionCell& cell = Cells[i];
+        CellData& data = _cellsData[i];
+        const Guid& sceneId = cell.Scene.ID;
+        if (!sceneId.IsValid())
+            continue;
+
+        // Find the distance to the closest streaming source (on XZ plane)
+        const BoundingBox bounds = GetCellBounds(cell.Coordinate);
+        Real distanceSqr = MAX_Real;
+        for (int32 j = 0; j < sources.Count(); j++)
+        {
+            const Vector3& source = sources[j];
+            const Real dx = Math::Max(bounds.Minimum.X - source.X, (Real)0, source.X - bounds.Maximum.X);
+            const Real dz = Math::Max(bounds.Minimum.Z - source.Z, (Real)0, source.Z - bounds.Maximum.Z);
+            distanceSqr = Math::Min(distanceSqr, dx * dx + dz * dz);
+        }
+        const bool canLoad = distanceSqr <= (Real)LoadDistance * LoadDistance;
+        const bool canUnload = distanceSqr > (Real)Math::Max(UnloadDistance, LoadDistance) * Math::Max(UnloadDistance, LoadDistance);
+
+        switch (data.State)
+        {
+        case CellState::Unloaded:
+            if (canLoad)
+            {
+                // Start loading the scene asset asynchronously
+                data.Asset = Content::LoadAsync<JsonAsset>(sceneId);
+                if (data.Asset)
+                    data.State = CellState::Loading;
+            }
+            break;
+        case CellState::Loading:
+            if (canUnload || data.Asset->LastLoadFailed())
+            {
+                data.Asset = nullptr;
+                data.State = CellState::Unloaded;
+            }
+            else if (Level::FindScene(sceneId))
+            {
+                data.State = CellState::Loaded;
+            }
+            else if (data.Asset->IsLoaded() && spawnBudget > 0)
+            {
+                // Spawn the scene (asset is already loaded so this will be done on the next scene actions flush)
+                spawnBudget--;
+                if (!Level::LoadSceneAsync(sceneId))
+                    data.State = CellState::Spawning;
+            }
+            break;
+        case CellState::Spawning:
+            if (Level::FindScene(sceneId))
+            {
+                data.State = CellState::Loaded;
+                data.Asset = nullptr;
+            }
+            else if (canUnload)
+            {
+                // Scene failed to load
+                data.Asset = nullptr;
+                data.State = CellState::Unloaded;
+            }
+            break;
+        case CellState::Loaded:
+            if (canUnload)
+            {
+                Scene* scene = Level::FindScene(sceneId);
+                if (scene)
+                    Level::UnloadSceneAsync(scene);
+                data.State = CellState::Unloaded;
+            }
+            break;
+        }
+    }
+}
+
+void WorldPartition::UnloadCells()
+{
+    for (int32 i = 0; i < _cellsData.Count(); i++)
+    {
+        CellData& data = _cellsData[i];
+        if (data.State == CellState::Loaded || data.State == CellState::Spawning)
+        {
+            Scene* scene = i < Cells.Count() ? Level::FindScene(Cells[i].Scene.ID) : nullptr;
+            if (scene)
+                Level::UnloadSceneAsync(scene);
+        }
+        data.Asset = nullptr;
+        data.State = CellState::Unloaded;
+    }
+    _cellsData.Clear();
+}
+
+#if USE_EDITOR
+
+#include "Engine/Debug/DebugDraw.h"
+
+void WorldPartition::OnDebugDrawSelected()
+{
+    for (int32 i = 0; i < Cells.Count(); i++)
+    {
+        const Color color = IsCellLoaded(i) ? Color::Green : Color::Gray;
+        DEBUG_DRAW_WIRE_BOX(GetCellBounds(Cells[i].Coordinate), color, 0, true);
+    }
+
+    // Base
+    Actor::OnDebugDrawSelected();
+}
+
+#endif
+
+void WorldPartition::OnEnable()
+{
+    GetScene()->Ticking.Update.AddTick<WorldPartition, &WorldPartition::OnUpdate>(this);
+
+    // Base
+    Actor::OnEnable();
+}
+
+void WorldPartition::OnDisable()
+{
+    GetScene()->Ticking.Update.RemoveTick(this);
+    UnloadCells();
+
+    // Base
+    Actor::OnDisable();
+}
+
+void WorldPartition::OnTransformChanged()
+{
+    // Base
+    Actor::OnTransformChanged();
+
+    _box = BoundingBox(_transform.Translation);
+    _sphere = BoundingSphere(_transform.Translation, 0.0f);
+}
@@ -0,0 +1,138 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../Actor.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/SceneReference.h"
+#include "Engine/Content/JsonAsset.h"
+
+/// <summary>
+/// The world partition grid cell that references the scene with the actors located in the cell area.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API WorldPartitionCell : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(WorldPartitionCell);
+
+    /// <summary>
+    /// The cell coordinates on a grid (X and Z axis of the world in cell size units, relative to the world partition actor).
+    /// </summary>
+    API_FIELD() Int2 Coordinate = Int2::Zero;
+
+    /// <summary>
+    /// The scene with the cell contents. Loaded when cell is streamed in.
+    /// </summary>
+    API_FIELD() SceneReference Scene;
+};
+
+/// <summary>
+/// Actor that splits the world into the grid of cells (each stored as a separate scene) and streams them in and out around the streaming sources (main camera and custom locations).
+/// </summary>
+/// <remarks>
+/// Cells are loaded when any streaming source gets closer than the load distance and unloaded when all sources are farther than the unload distance (hysteresis prevents loading and unloading cell over and over when moving around the cell border). Cell scenes are loaded asynchronously and only a limited amount of them is spawned per frame on a main thread.
+/// </remarks>
+API_CLASS(Attributes="ActorContextMenu(\"New/Other/World Partition\"), ActorToolbox(\"Other\")")
+class FLAXENGINE_API WorldPartition : public Actor
+{
+    DECLARE_SCENE_OBJECT(WorldPartition);
+    API_AUTO_SERIALIZATION();
+private:
+    enum class CellState : byte
+    {
+        Unloaded,
+        Loading,
+        Spawning,
+        Loaded,
+    };
+
+    struct CellData
+    {
+        CellState State = CellState::Unloaded;
+        AssetReference<JsonAsset> Asset;
+    };
+
+    Array<CellData> _cellsData;
+
+public:
+    /// <summary>
+    /// The size of the single cell (in world units).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), EditorDisplay(\"World Partition\"), Limit(1)")
+    float CellSize = 20000.0f;
+
+    /// <summary>
+    /// The distance from the streaming source to the cell area at which the cell is loaded.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), EditorDisplay(\"World Partition\"), Limit(0)")
+    float LoadDistance = 20000.0f;
+
+    /// <summary>
+    /// The distance from the streaming source to the cell area at which the cell is unloaded. Should be larger than load distance to prevent loading and unloading the cell over and over.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), EditorDisplay(\"World Partition\"), Limit(0)")
+    float UnloadDistance = 30000.0f;
+
+    /// <summary>
+    /// The maximum amount of cell scenes spawned in a single frame. Used to time-slice the cells loading on a main thread.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), EditorDisplay(\"World Partition\"), Limit(1, 100)")
+    int32 MaxCellsSpawnPerFrame = 1;
+
+    /// <summary>
+    /// If checked, the main camera is used as a streaming source.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(50), EditorDisplay(\"World Partition\")")
+    bool UseMainCamera = true;
+
+    /// <summary>
+    /// The grid cells with the scenes to stream.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(100), EditorDisplay(\"World Partition\")")
+    Array<WorldPartitionCell> Cells;
+
+    /// <summary>
+    /// The custom streaming sources locations (eg. players positions). Cells are streamed around them.
+    /// </summary>
+    API_FIELD(Attributes="HideInEditor, NoSerialize")
+    Array<Vector3> StreamingSources;
+
+public:
+    /// <summary>
+    /// Gets the coordinates of the grid cell that contains the given location.
+    /// </summary>
+    /// <param name="position">The world-space location.</param>
+    /// <returns>The cell coordinates.</returns>
+    API_FUNCTION() Int2 GetCellCoordinate(const Vector3& position) const;
+
+    /// <summary>
+    /// Gets the world-space bounds of the grid cell (infinite along Y axis).
+    /// </summary>
+    /// <param name="coordinate">The cell coordinates.</param>
+    /// <returns>The cell bounds.</returns>
+    API_FUNCTION() BoundingBox GetCellBounds(const Int2& coordinate) const;
+
+    /// <summary>
+    /// Checks if the cell with the given index is loaded.
+    /// </summary>
+    /// <param name="index">The cell index (in Cells array).</param>
+    /// <returns>True if cell scene is loaded, otherwise false.</returns>
+    API_FUNCTION() bool IsCellLoaded(int32 index) const;
+
+private:
+    void OnUpdate();
+    void UnloadCells();
+
+public:
+    // [Actor]
+#if USE_EDITOR
+    void OnDebugDrawSelected() override;
+#endif
+
+protected:
+    // [Actor]
+    void OnEnable() override;
+    void OnDisable() override;
+    void OnTransformChanged() override;
+};
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Math/Vector3.h"
 
 /// <summary>
 /// The engine utility for large worlds support. Contains constants and tools for using 64-bit precision coordinates in various game systems (eg. scene rendering).
@@ -28,4 +30,34 @@ API_CLASS(Static) class FLAXENGINE_API LargeWorlds
     /// <param name="position">The current input position (eg. render view location or auto listener position).</param>
     /// <remarks>Used only if LargeWorlds::Enabled is true.</remarks>
     API_FUNCTION() static void UpdateOrigin(API_PARAM(Ref) Vector3& origin, const Vector3& position);
+
+public:
+    /// <summary>
+    /// Enables automatic rebasing of the world origin around the main camera. Physics scenes and render views are shifted together so the simulation and rendering work in 32-bit precision relative to the origin.
+    /// </summary>
+    /// <remarks>Used only if LargeWorlds::Enabled is true.</remarks>
+    API_FIELD() static bool AutoOrigin;
+
+    /// <summary>
+    /// Event called when the world origin gets changed. Args: previous origin, new origin.
+    /// </summary>
+    API_EVENT() static Delegate<const Vector3&, const Vector3&> OriginChanged;
+
+    /// <summary>
+    /// Gets the current world origin (shared by the physics scenes and the render views).
+    /// </summary>
+    API_PROPERTY() static Vector3 GetOrigin();
+
+    /// <summary>
+    /// Sets the current world origin. Shifts the origin of all physics scenes in a single step.
+    /// </summary>
+    /// <param name="value">The new origin.</param>
+    API_PROPERTY() static void SetOrigin(const Vector3& value);
+
+    /// <summary>
+    /// Rebases the world origin around the given position (snapped to the chunk) when the position gets farther than the chunk size from the current origin. Called for the main camera if AutoOrigin is enabled, but can be used manually for a custom location (eg. player position).
+    /// </summary>
+    /// <param name="position">The current input position (eg. camera location).</param>
+    /// <remarks>Used only if LargeWorlds::Enabled is true.</remarks>
+    API_FUNCTION() static void RebaseOrigin(const Vector3& position);
 };
@@ -6,7 +6,9 @@
 #include "SceneQuery.h"
 #include "SceneObjectsFactory.h"
 #include "Scene/Scene.h"
+#include "Actors/Camera.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Content/Loading/ContentLoadingManager.h"
 #include "Engine/Core/Cache.h"
 #include "Engine/Core/Collections/CollectionPoolCache.h"
 #include "Engine/Core/ObjectsRemovalService.h"
@@ -18,6 +20,10 @@
 #include "Engine/Debug/Exceptions/JsonParseException.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/Task.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Physics/Physics.h"
+#include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -57,6 +63,49 @@ void LargeWorlds::UpdateOrigin(Vector3& origin, const Vector3& position)
     }
 }
 
+bool LargeWorlds::AutoOrigin = false;
+Delegate<const Vector3&, const Vector3&> LargeWorlds::OriginChanged;
+
+namespace
+{
+    Vector3 WorldOrigin = Vector3::Zero;
+}
+
+Vector3 LargeWorlds::GetOrigin()
+{
+    return WorldOrigin;
+}
+
+void LargeWorlds::SetOrigin(const Vector3& value)
+{
+    if (WorldOrigin == value)
+        return;
+    PROFILE_CPU();
+    const Vector3 prevOrigin = WorldOrigin;
+    WorldOrigin = value;
+    for (PhysicsScene* scene : Physics::Scenes)
+        scene->SetOrigin(value);
+    OriginChanged(prevOrigin, value);
+}
+
+void LargeWorlds::RebaseOrigin(const Vector3& position)
+{
+    if (!Enable)
+        return;
+
+    // Rebase only when the position gets far from the origin (prevents shifting back and forth around the chunk border)
+    const Vector3 offset = Vector3::Abs(position - WorldOrigin);
+    if (offset.MaxValue() > ChunkSize)
+    {
+        constexpr Real chunkSizeInv = 1.0 / ChunkSize;
+        SetOrigin(Vector3(Math::Round(position.X * chunkSizeInv), Math::Round(position.Y * chunkSizeInv), Math::Round(position.Z * chunkSizeInv)) * ChunkSize);
+    }
+
+    // Sync newly created physics scenes
+    for (PhysicsScene* scene : Physics::Scenes)
+        scene->SetOrigin(WorldOrigin);
+}
+
 bool LayersMask::HasLayer(const StringView& layerName) const
 {
     return HasLayer(Level::GetLayerIndex(layerName));
@@ -90,6 +139,11 @@ class SceneAction
     {
         return true;
     }
+
+    virtual bool IsPending() const
+    {
+        return false;
+    }
 };
 
 #if USE_EDITOR
@@ -108,6 +162,8 @@ namespace LevelImpl
     Array<SceneAction*> _sceneActions;
     CriticalSection _sceneActionsLocker;
     DateTime _lastSceneLoadTime(0);
+    double _preloadRecordingEndTime = 0;
+    String _preloadRecordingPath;
 #if USE_EDITOR
     Array<ScriptsReloadObject> ScriptsReloadObjects;
 #endif
@@ -121,8 +177,13 @@ namespace LevelImpl
     bool saveScene(Scene* scene, const String& path);
     bool saveScene(Scene* scene, rapidjson_flax::StringBuffer& outBuffer, bool prettyJson);
     bool saveScene(Scene* scene, rapidjson_flax::StringBuffer& outBuffer, JsonWriter& writer);
+    bool getScenePath(Scene* scene, String& path);
+    bool writeSceneFile(const String& path, const rapidjson_flax::StringBuffer& data, bool prettyJson);
+    void onSceneFileSaved(const Guid& sceneId, const String& path, const DateTime& startTime);
     bool spawnActor(Actor* actor, Actor* parent);
     bool deleteActor(Actor* actor);
+    void updatePreloadRecording();
+    void preloadScene(JsonAsset* sceneAsset);
 }
 
 using namespace LevelImpl;
@@ -147,6 +208,8 @@ LevelService LevelServiceInstanceService;
 CriticalSection Level::ScenesLock;
 Array<Scene*> Level::Scenes;
 bool Level::TickEnabled = true;
+float Level::PreloadManifestRecordingTime = 0.0f;
+float Level::SceneLoadTimeBudget = 0.0f;
 Delegate<Actor*> Level::ActorSpawned;
 Delegate<Actor*> Level::ActorDeleted;
 Delegate<Actor*, Actor*> Level::ActorParentChanged;
@@ -169,6 +232,19 @@ Action Level::ScriptsReloadEnd;
 #endif
 String Level::Layers[32];
 
+void LevelImpl::updatePreloadRecording()
+{
+    if (_preloadRecordingPath.IsEmpty() || Platform::GetTimeSeconds() < _preloadRecordingEndTime)
+        return;
+    Array<ContentLoadRecord> records;
+    ContentLoadingManager::EndRecording(records);
+    if (ContentLoadingManager::SavePreloadManifest(_preloadRecordingPath, records))
+        LOG(Warning, "Failed to save scene preload manifest to '{0}'", _preloadRecordingPath);
+    else
+        LOG(Info, "Saved scene preload manifest to '{0}' ({1} requests)", _preloadRecordingPath, records.Count());
+    _preloadRecordingPath.Clear();
+}
+
 bool LevelImpl::spawnActor(Actor* actor, Actor* parent)
 {
     if (actor == nullptr)
@@ -255,6 +331,9 @@ void LayersAndTagsSettings::Apply()
                 scenes[i]->Ticking.tickingStage.Tick(); \
         } \
     }
+#define FLUSH_TRANSFORMS() \
+    for (int32 i = 0; i < scenes.Count(); i++) \
+        scenes[i]->Transforms.Flush();
 #if USE_EDITOR
 #define TICK_LEVEL_EDITOR(tickingStage) \
     else if (!Editor::IsPlayMode) \
@@ -271,14 +350,24 @@ void LayersAndTagsSettings::Apply()
 
 void LevelService::Update()
 {
+    if (LargeWorlds::AutoOrigin)
+    {
+        const Camera* camera = Camera::GetMainCamera();
+        if (camera)
+            LargeWorlds::RebaseOrigin(camera->GetPosition());
+    }
+    SceneTicking::GatherViewers();
     TICK_LEVEL(Update, "Level::Update")
     TICK_LEVEL_EDITOR(Update)
+    FLUSH_TRANSFORMS()
+    updatePreloadRecording();
 }
 
 void LevelService::LateUpdate()
 {
     TICK_LEVEL(LateUpdate, "Level::LateUpdate")
     TICK_LEVEL_EDITOR(LateUpdate)
+    FLUSH_TRANSFORMS()
     flushActions();
 }
 
@@ -286,16 +375,19 @@ void LevelService::FixedUpdate()
 {
     TICK_LEVEL(FixedUpdate, "Level::FixedUpdate")
     TICK_LEVEL_EDITOR(FixedUpdate)
+    FLUSH_TRANSFORMS()
 }
 
 void LevelService::LateFixedUpdate()
 {
     TICK_LEVEL(LateFixedUpdate, "Level::LateFixedUpdate")
     TICK_LEVEL_EDITOR(LateFixedUpdate)
+    FLUSH_TRANSFORMS()
 }
 
 #undef TICK_LEVEL
 #undef TICK_LEVEL_EDITOR
+#undef FLUSH_TRANSFORMS
 
 void LevelService::Dispose()
 {
@@ -371,6 +463,17 @@ void Level::DrawActors(RenderContextBatch& renderContextBatch, byte category)
     }
 }
 
+void Level::CullSharedViews(const Span<SceneRenderingView>& views)
+{
+    PROFILE_CPU();
+
+    for (Scene* scene : Scenes)
+    {
+        if (scene->IsActiveInHierarchy())
+            scene->Rendering.CullSharedViews(views);
+    }
+}
+
 void Level::CollectPostFxVolumes(RenderContext& renderContext)
 {
     PROFILE_CPU();
@@ -384,11 +487,61 @@ void Level::CollectPostFxVolumes(RenderContext& renderContext)
     }
 }
 
+class Level::SceneLoader
+{
+public:
+    enum class Stages
+    {
+        Begin,
+        Spawn,
+        SetupPrefabs,
+        Deserialize,
+        SyncPrefabs,
+        Initialize,
+        BeginPlay,
+        End,
+    };
+
+    rapidjson_flax::Value& Data;
+    int32 EngineBuild;
+    Stages Stage = Stages::Begin;
+    int32 StageStep = 0;
+    int32 ObjectsCount = 0;
+    DateTime StartTime;
+    Guid SceneId;
+    Scene* LoadedScene = nullptr;
+    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache Modifier;
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache SceneObjects;
+    SceneObjectsFactory::Context Context;
+    SceneObjectsFactory::PrefabSyncData* PrefabSyncData = nullptr;
+    SceneBeginData BeginData;
+
+    SceneLoader(rapidjson_flax::Value& data, int32 engineBuild)
+        : Data(data)
+        , EngineBuild(engineBuild)
+        , Modifier(Cache::ISerializeModifier.Get())
+        , SceneObjects(ActorsCache::SceneObjectsListCache.Get())
+        , Context(Modifier.Value)
+    {
+    }
+
+    ~SceneLoader();
+
+    FORCE_INLINE bool IsDone() const
+    {
+        return Stage == Stages::End;
+    }
+
+    // Performs the scene loading until the given time (in seconds, see Platform::GetTimeSeconds) and returns true if failed. Loading is completed when IsDone returns true.
+    bool Tick(double timeLimit);
+};
+
 class LoadSceneAction : public SceneAction
 {
 public:
     Guid SceneId;
     AssetReference<JsonAsset> SceneAsset;
+    mutable Level::SceneLoader* Loader = nullptr;
 
     LoadSceneAction(const Guid& sceneId, JsonAsset* sceneAsset)
     {
@@ -396,26 +549,63 @@ class LoadSceneAction : public SceneAction
         SceneAsset = sceneAsset;
     }
 
+    ~LoadSceneAction()
+    {
+        if (Loader)
+            Delete(Loader);
+    }
+
     bool CanDo() const override
     {
         return SceneAsset == nullptr || SceneAsset->IsLoaded();
     }
 
+    bool IsPending() const override
+    {
+        return Loader != nullptr;
+    }
+
     bool Do() const override
     {
-        // Now to deserialize scene in a proper way we need to load scripting
-        if (!Scripting::IsEveryAssemblyLoaded())
+        if (!Loader)
         {
-            LOG(Error, "Scripts must be compiled without any errors in order to load a scene.");
+            // Now to deserialize scene in a proper way we need to load scripting
+            if (!Scripting::IsEveryAssemblyLoaded())
+            {
+                LOG(Error, "Scripts must be compiled without any errors in order to load a scene.");
 #if USE_EDITOR
-            Platform::Error(TEXT("Scripts must be compiled without any errors in order to load a scene. Please fix it."));
+                Platform::Error(TEXT("Scripts must be compiled without any errors in order to load a scene. Please fix it."));
 #endif
-            CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
-            return true;
+                CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
+                return true;
+            }
+
+            if (Level::SceneLoadTimeBudget <= 0.0f || !SceneAsset || !SceneAsset->IsLoaded())
+            {
+                // Load scene
+                if (Level::loadScene(SceneAsset.Get()))
+                {
+                    LOG(Error, "Failed to deserialize scene {0}", SceneId);
+                    CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
+                    return true;
+                }
+                return false;
+            }
+
+            // Start loading scene over multiple frames
+            preloadScene(SceneAsset.Get());
+            Loader = New<Level::SceneLoader>(*SceneAsset->Data, SceneAsset->DataEngineBuild);
         }
 
-        // Load scene
-        if (Level::loadScene(SceneAsset.Get()))
+        // Continue loading scene within the time budget
+        const double timeLimit = Platform::GetTimeSeconds() + Level::SceneLoadTimeBudget * 0.001;
+        const bool failed = Loader->Tick(timeLimit);
+        if (failed || Loader->IsDone())
+        {
+            Delete(Loader);
+            Loader = nullptr;
+        }
+        if (failed)
         {
             LOG(Error, "Failed to deserialize scene {0}", SceneId);
             CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
@@ -481,6 +671,83 @@ class SaveSceneAction : public SceneAction
     }
 };
 
+class SaveSceneAsyncAction : public SceneAction
+{
+public:
+    Scene* TargetScene;
+    Guid SceneId;
+    bool PrettyJson;
+    mutable String Path;
+    mutable DateTime StartTime;
+    mutable rapidjson_flax::StringBuffer Data;
+    mutable Task* WriteTask = nullptr;
+    mutable bool WriteFailed = false;
+    mutable bool Done = false;
+
+    SaveSceneAsyncAction(Scene* scene, bool prettyJson = true)
+    {
+        TargetScene = scene;
+        SceneId = scene ? scene->GetID() : Guid::Empty;
+        PrettyJson = prettyJson;
+    }
+
+    ~SaveSceneAsyncAction()
+    {
+        if (WriteTask)
+            WriteTask->Wait();
+    }
+
+    bool Do() const override
+    {
+        if (!WriteTask)
+        {
+            // Capture the scene state on a main thread (compact json is the cheapest to generate)
+            Done = true;
+            if (!TargetScene || getScenePath(TargetScene, Path))
+                return true;
+            LOG(Info, "Saving scene {0} to \'{1}\'", TargetScene->GetName(), Path);
+            StartTime = DateTime::NowUTC();
+            TargetScene->SaveTime = StartTime;
+            if (saveScene(TargetScene, Data, false) && Data.GetSize() > 0)
+            {
+                CallSceneEvent(SceneEventType::OnSceneSaveError, TargetScene, SceneId);
+                return true;
+            }
+
+            // Format and write the file on a worker thread
+            Function<void()> action = [this]
+            {
+                WriteFailed = writeSceneFile(Path, Data, PrettyJson);
+            };
+            WriteTask = Task::StartNew(action);
+            if (!WriteTask)
+                action();
+            Done = WriteTask == nullptr;
+        }
+        else if (WriteTask->IsEnded())
+        {
+            WriteTask = nullptr;
+            Done = true;
+        }
+        if (!Done)
+            return false;
+
+        // Finalize on a main thread
+        if (WriteFailed)
+        {
+            CallSceneEvent(SceneEventType::OnSceneSaveError, Level::FindScene(SceneId), SceneId);
+            return true;
+        }
+        onSceneFileSaved(SceneId, Path, StartTime);
+        return false;
+    }
+
+    bool IsPending() const override
+    {
+        return !Done;
+    }
+};
+
 #if USE_EDITOR
 
 class ReloadScriptsAction : public SceneAction
@@ -493,11 +760,11 @@ class ReloadScriptsAction : public SceneAction
     bool Do() const override
     {
         // Reloading scripts workflow:
-        // - save scenes (to temporary files)
-        // - unload scenes
+        // - save scenes that use game scripting types (to memory)
+        // - unload those scenes (scenes with engine types only stay loaded)
         // - unload user assemblies
-        // - load user assemblies
-        // - load scenes (from temporary files)
+        // - load user assemblies (in parallel with parsing the saved scenes)
+        // - load scenes (from memory)
         // Note: we don't want to override original scene files
 
         PROFILE_CPU_NAMED("Level.ReloadScripts");
@@ -509,7 +776,9 @@ class ReloadScriptsAction : public SceneAction
         {
             Guid ID;
             String Name;
+            bool Reload;
             rapidjson_flax::StringBuffer Data;
+            ISerializable::SerializeDocument Document;
 
             SceneData() = default;
 
@@ -528,35 +797,87 @@ class ReloadScriptsAction : public SceneAction
             {
                 ID = scene->GetID();
                 Name = scene->GetName();
+                Reload = HasGameTypes(scene);
+            }
+
+            static bool HasGameTypes(const Actor* actor)
+            {
+                // Objects from the engine module are not affected by the game assemblies reload
+                const BinaryModule* engineModule = Actor::TypeInitializer.Module;
+                if (actor->GetTypeHandle().Module != engineModule)
+                    return true;
+                for (const Script* script : actor->Scripts)
+                {
+                    if (script->GetTypeHandle().Module != engineModule)
+                        return true;
+                }
+                for (const Actor* child : actor->Children)
+                {
+                    if (HasGameTypes(child))
+                        return true;
+                }
+                return false;
             }
         };
         const int32 scenesCount = Level::Scenes.Count();
+        Array<Guid> scenesOrder;
+        scenesOrder.Resize(scenesCount);
         Array<SceneData> scenes;
         scenes.Resize(scenesCount);
         for (int32 i = 0; i < scenesCount; i++)
+        {
+            scenesOrder[i] = Level::Scenes[i]->GetID();
             scenes[i].Init(Level::Scenes[i]);
+        }
 
         // Fire event
         Level::ScriptsReloadStart();
 
         // Save scenes (to memory)
+        bool anySceneKept = false;
         for (int32 i = 0; i < scenesCount; i++)
         {
-            const auto scene = Level::Scenes[i];
-            LOG(Info, "Caching scene {0}", scenes[i].Name);
+            auto& sceneData = scenes[i];
+            const auto scene = Level::FindScene(sceneData.ID);
+            if (!sceneData.Reload || !scene)
+            {
+                // Scenes without objects from game assemblies can stay loaded
+                LOG(Info, "Keeping scene {0}", sceneData.Name);
+                sceneData.Reload = false;
+                anySceneKept = true;
+                continue;
+            }
+            LOG(Info, "Caching scene {0}", sceneData.Name);
 
             // Serialize to json
-            if (saveScene(scene, scenes[i].Data, false))
+            if (saveScene(scene, sceneData.Data, false))
             {
-                LOG(Error, "Failed to save scene '{0}' for scripts reload.", scenes[i].Name);
+                LOG(Error, "Failed to save scene '{0}' for scripts reload.", sceneData.Name);
                 CallSceneEvent(SceneEventType::OnSceneSaveError, scene, scene->GetID());
                 return true;
             }
             CallSceneEvent(SceneEventType::OnSceneSaved, scene, scene->GetID());
         }
 
+        // Parse scenes json on job system in parallel with the scenes unloading and assemblies reloading (doesn't depend on the scripting types)
+        const int64 parseJobs = scenesCount != 0 ? JobSystem::Dispatch([&scenes](int32 i)
+        {
+            auto& sceneData = scenes[i];
+            if (!sceneData.Reload)
+                return;
+            PROFILE_CPU_NAMED("Json.Parse");
+            sceneData.Document.Parse(sceneData.Data.GetString(), sceneData.Data.GetSize());
+        }, scenesCount) : 0;
+
         // Unload scenes
-        unloadScenes();
+        for (int32 i = scenesCount - 1; i >= 0; i--)
+        {
+            if (scenes[i].Reload && unloadScene(Level::FindScene(scenes[i].ID)))
+            {
+                JobSystem::Wait(parseJobs);
+                return true;
+            }
+        }
 
         // Reload scripting
         Level::ScriptsReload();
@@ -582,17 +903,15 @@ class ReloadScriptsAction : public SceneAction
         ScriptsReloadObjects.Clear();
 
         // Restore scenes (from memory)
+        JobSystem::Wait(parseJobs);
         for (int32 i = 0; i < scenesCount; i++)
         {
+            if (!scenes[i].Reload)
+                continue;
             LOG(Info, "Restoring scene {0}", scenes[i].Name);
 
-            // Parse json
-            const auto& sceneData = scenes[i].Data;
-            ISerializable::SerializeDocument document;
-            {
-                PROFILE_CPU_NAMED("Json.Parse");
-                document.Parse(sceneData.GetString(), sceneData.GetSize());
-            }
+            // Validate json
+            auto& document = scenes[i].Document;
             if (document.HasParseError())
             {
                 LOG(Error, "Failed to deserialize scene {0}. Result: {1}", scenes[i].Name, GetParseError_En(document.GetParseError()));
@@ -609,6 +928,23 @@ class ReloadScriptsAction : public SceneAction
         }
         scenes.Resize(0);
 
+        // Restore the original scenes order (kept scenes stay in the list while the others are added when loaded)
+        if (anySceneKept)
+        {
+            Array<Scene*> scenesSorted;
+            for (const Guid& id : scenesOrder)
+            {
+                if (Scene* scene = Level::FindScene(id))
+                    scenesSorted.Add(scene);
+            }
+            for (Scene* scene : Level::Scenes)
+            {
+                if (!scenesSorted.Contains(scene))
+                    scenesSorted.Add(scene);
+            }
+            Level::Scenes = MoveTemp(scenesSorted);
+        }
+
         // Fire event
         LOG(Info, "Scripts reloading end. Total time: {0}ms", static_cast<int32>((DateTime::NowUTC() - startTime).GetTotalMilliseconds()));
         Level::ScriptsReloadEnd();
@@ -773,6 +1109,13 @@ Actor* Level::FindActor(const Tag& tag, Actor* root)
         return FindActorRecursive(root, tag);
     Actor* result = nullptr;
     for (Scene* scene : Scenes)
+    {
+        // Check the enabled actors registry first
+        result = scene->ActorsIndex.GetActor(tag);
+        if (result)
+            return result;
+    }
+    for (Scene* scene : Scenes)
     {
         result = FindActorRecursive(scene, tag);
         if (result)
@@ -797,6 +1140,11 @@ Array<Actor*> Level::FindActors(const Tag& tag, const bool activeOnly, Actor* ro
     {
         FindActorsRecursive(root, tag, activeOnly, result);
     }
+    else if (activeOnly)
+    {
+        // Active actors are registered in the scenes lookup
+        SceneQuery::GetActorsWithTag(tag, result);
+    }
     else
     {
         ScopeLock lock(ScenesLock);
@@ -836,6 +1184,27 @@ Array<Actor*> Level::FindActorsByParentTag(const Tag& parentTag, const bool acti
     return result;
 }
 
+Array<Actor*> Level::OverlapActors(const BoundingBox& box, const MClass* type)
+{
+    Array<Actor*> result;
+    SceneQuery::OverlapActors(box, result, type);
+    return result;
+}
+
+Array<Actor*> Level::OverlapActors(const BoundingSphere& sphere, const MClass* type)
+{
+    Array<Actor*> result;
+    SceneQuery::OverlapActors(sphere, result, type);
+    return result;
+}
+
+Array<Actor*> Level::OverlapActors(const BoundingFrustum& frustum, const MClass* type)
+{
+    Array<Actor*> result;
+    SceneQuery::OverlapActors(frustum, result, type);
+    return result;
+}
+
 void Level::callActorEvent(ActorEventType eventType, Actor* a, Actor* b)
 {
     PROFILE_CPU();
@@ -875,8 +1244,11 @@ void LevelImpl::flushActions()
 
     while (_sceneActions.HasItems() && _sceneActions.First()->CanDo())
     {
-        const auto action = _sceneActions.Dequeue();
+        const auto action = _sceneActions.First();
         action->Do();
+        if (action->IsPending())
+            break; // Continue in the next frame
+        _sceneActions.Dequeue();
         Delete(action);
     }
 }
@@ -925,6 +1297,31 @@ bool LevelImpl::unloadScenes()
     return false;
 }
 
+void LevelImpl::preloadScene(JsonAsset* sceneAsset)
+{
+    // Prefetch content used by the scene (recorded during the previous loads) or record it
+    if (sceneAsset && !sceneAsset->IsVirtual())
+    {
+        const String manifestPath = String(StringUtils::GetPathWithoutExtension(sceneAsset->GetPath())) + TEXT(".preload");
+        if (Level::PreloadManifestRecordingTime > 0.0f)
+        {
+            if (!ContentLoadingManager::IsRecording())
+            {
+                LOG(Info, "Recording scene preload manifest for {0}s", Level::PreloadManifestRecordingTime);
+                ContentLoadingManager::BeginRecording();
+                _preloadRecordingEndTime = Platform::GetTimeSeconds() + Level::PreloadManifestRecordingTime;
+                _preloadRecordingPath = manifestPath;
+            }
+        }
+        else
+        {
+            Array<ContentLoadRecord> records;
+            if (!ContentLoadingManager::LoadPreloadManifest(manifestPath, records))
+                ContentLoadingManager::Prefetch(records);
+        }
+    }
+}
+
 bool Level::loadScene(const Guid& sceneId)
 {
     const auto sceneAsset = Content::LoadAsync<JsonAsset>(sceneId);
@@ -958,6 +1355,8 @@ bool Level::loadScene(JsonAsset* sceneAsset)
     // Keep reference to the asset (prevent unloading during action)
     AssetReference<JsonAsset> ref = sceneAsset;
 
+    preloadScene(sceneAsset);
+
     // Wait for loaded
     if (sceneAsset == nullptr || sceneAsset->WaitForLoaded())
     {
@@ -1003,138 +1402,178 @@ bool Level::loadScene(rapidjson_flax::Document& document, Scene** outScene)
     return loadScene(data->value, saveEngineBuild, outScene);
 }
 
-bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** outScene)
+Level::SceneLoader::~SceneLoader()
 {
-    PROFILE_CPU_NAMED("Level.LoadScene");
-
-    if (outScene)
-        *outScene = nullptr;
+    if (PrefabSyncData)
+        Delete(PrefabSyncData);
 
-    LOG(Info, "Loading scene...");
-    const DateTime startTime = DateTime::NowUTC();
-    _lastSceneLoadTime = startTime;
-
-    // Here whole scripting backend should be loaded for current project
-    // Later scripts will setup attached scripts and restore initial vars
-    if (!Scripting::HasGameModulesLoaded())
+    // Cleanup partially loaded scene
+    if (LoadedScene && Stage != Stages::End)
     {
-        LOG(Error, "Cannot load scene without game modules loaded.");
-#if USE_EDITOR
-        if (!CommandLine::Options.Headless.IsTrue())
+        if (Stage == Stages::BeginPlay)
         {
-            if (ScriptsBuilder::LastCompilationFailed())
-                MessageBox::Show(TEXT("Scripts compilation failed. Cannot load scene without game script modules. Please fix the compilation issues. See logs for more info."), TEXT("Failed to compile scripts"), MessageBoxButtons::OK, MessageBoxIcon::Error);
-            else
-                MessageBox::Show(TEXT("Failed to load scripts. Cannot load scene without game script modules. See logs for more info."), TEXT("Missing game modules"), MessageBoxButtons::OK, MessageBoxIcon::Error);
+            unloadScene(LoadedScene);
+            return;
         }
-#endif
-        return true;
+        for (int32 i = 1; i < SceneObjects->Count(); i++)
+        {
+            SceneObject* obj = SceneObjects->At(i);
+            if (obj && obj->GetParent() == nullptr)
+                obj->DeleteObject();
+        }
+        LoadedScene->DeleteObject();
     }
+}
 
-    // Peek meta
-    if (engineBuild < 6000)
+bool Level::SceneLoader::Tick(double timeLimit)
+{
+    PROFILE_CPU_NAMED("Level.LoadScene");
+#define CHECK_TIME_LIMIT(mask) if ((StageStep & mask) == 0 && Platform::GetTimeSeconds() >= timeLimit) return false
+    switch (Stage)
     {
-        LOG(Error, "Invalid serialized engine build.");
-        return true;
-    }
-    if (!data.IsArray())
+    case Stages::Begin:
     {
-        LOG(Error, "Invalid Data member.");
-        return true;
-    }
-    int32 objectsCount = data.Size();
+        LOG(Info, "Loading scene...");
+        StartTime = DateTime::NowUTC();
+        _lastSceneLoadTime = StartTime;
 
-    // Peek scene node value (it's the first actor serialized)
-    auto& sceneValue = data[0];
-    auto sceneId = JsonTools::GetGuid(sceneValue, "ID");
-    if (!sceneId.IsValid())
-    {
-        LOG(Error, "Invalid scene id.");
-        return true;
-    }
-    auto modifier = Cache::ISerializeModifier.Get();
-    modifier->EngineBuild = engineBuild;
+        // Here whole scripting backend should be loaded for current project
+        // Later scripts will setup attached scripts and restore initial vars
+        if (!Scripting::HasGameModulesLoaded())
+        {
+            LOG(Error, "Cannot load scene without game modules loaded.");
+#if USE_EDITOR
+            if (!CommandLine::Options.Headless.IsTrue())
+            {
+                if (ScriptsBuilder::LastCompilationFailed())
+                    MessageBox::Show(TEXT("Scripts compilation failed. Cannot load scene without game script modules. Please fix the compilation issues. See logs for more info."), TEXT("Failed to compile scripts"), MessageBoxButtons::OK, MessageBoxIcon::Error);
+                else
+                    MessageBox::Show(TEXT("Failed to load scripts. Cannot load scene without game script modules. See logs for more info."), TEXT("Missing game modules"), MessageBoxButtons::OK, MessageBoxIcon::Error);
+            }
+#endif
+            return true;
+        }
 
-    // Skip is that scene is already loaded
-    if (FindScene(sceneId) != nullptr)
-    {
-        LOG(Info, "Scene {0} is already loaded.", sceneId);
-        return false;
-    }
+        // Peek meta
+        if (EngineBuild < 6000)
+        {
+            LOG(Error, "Invalid serialized engine build.");
+            return true;
+        }
+        if (!Data.IsArray())
+        {
+            LOG(Error, "Invalid Data member.");
+            return true;
+        }
+        ObjectsCount = Data.Size();
 
-    // Create scene actor
-    // Note: the first object in the scene file data is a Scene Actor
-    auto scene = New<Scene>(ScriptingObjectSpawnParams(sceneId, Scene::TypeInitializer));
-    scene->LoadTime = startTime;
-    scene->RegisterObject();
-    scene->Deserialize(sceneValue, modifier.Value);
+        // Peek scene node value (it's the first actor serialized)
+        auto& sceneValue = Data[0];
+        SceneId = JsonTools::GetGuid(sceneValue, "ID");
+        if (!SceneId.IsValid())
+        {
+            LOG(Error, "Invalid scene id.");
+            return true;
+        }
+        Modifier->EngineBuild = EngineBuild;
 
-    // Fire event
-    CallSceneEvent(SceneEventType::OnSceneLoading, scene, sceneId);
+        // Skip is that scene is already loaded
+        if (FindScene(SceneId) != nullptr)
+        {
+            LOG(Info, "Scene {0} is already loaded.", SceneId);
+            Stage = Stages::End;
+            return false;
+        }
+
+        // Create scene actor
+        // Note: the first object in the scene file data is a Scene Actor
+        LoadedScene = New<Scene>(ScriptingObjectSpawnParams(SceneId, Scene::TypeInitializer));
+        LoadedScene->LoadTime = StartTime;
+        LoadedScene->RegisterObject();
+        LoadedScene->Deserialize(sceneValue, Modifier.Value);
 
-    // Loaded scene objects list
-    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
-    sceneObjects->Resize(objectsCount);
-    sceneObjects->At(0) = scene;
+        // Fire event
+        CallSceneEvent(SceneEventType::OnSceneLoading, LoadedScene, SceneId);
 
-    SceneObjectsFactory::Context context(modifier.Value);
+        // Loaded scene objects list
+        SceneObjects->Resize(ObjectsCount);
+        SceneObjects->At(0) = LoadedScene;
+
+        Stage = Stages::Spawn;
+        StageStep = 1; // start from 1. at index [0] was scene
+    }
+    case Stages::Spawn:
     {
         PROFILE_CPU_NAMED("Spawn");
 
         // Spawn all scene objects
-        for (int32 i = 1; i < objectsCount; i++) // start from 1. at index [0] was scene
+        while (StageStep < ObjectsCount)
         {
-            auto& stream = data[i];
-            auto obj = SceneObjectsFactory::Spawn(context, stream);
-            sceneObjects->At(i) = obj;
+            auto& stream = Data[StageStep];
+            auto obj = SceneObjectsFactory::Spawn(Context, stream);
+            SceneObjects->At(StageStep) = obj;
             if (obj)
                 obj->RegisterObject();
             else
                 SceneObjectsFactory::HandleObjectDeserializationError(stream);
+            StageStep++;
+            CHECK_TIME_LIMIT(63);
         }
+        Stage = Stages::SetupPrefabs;
     }
+    case Stages::SetupPrefabs:
+    {
+        PrefabSyncData = New<SceneObjectsFactory::PrefabSyncData>(*SceneObjects.Value, Data, Modifier.Value);
 
-    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
-
-    SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
-
-    // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
-    SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
+        SceneObjectsFactory::SetupPrefabInstances(Context, *PrefabSyncData);
 
-    // /\ all above this has to be done on an any thread
-    // \/ all below this has to be done on multiple threads at once
+        // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
+        SceneObjectsFactory::SynchronizeNewPrefabInstances(Context, *PrefabSyncData);
 
+        Stage = Stages::Deserialize;
+        StageStep = 1;
+    }
+    case Stages::Deserialize:
     {
         PROFILE_CPU_NAMED("Deserialize");
 
-        // TODO: at this point we would probably spawn a few thread pool tasks which will load deserialize scene object but only if scene is big enough
-
         // Load all scene objects
-        Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
-        for (int32 i = 1; i < objectsCount; i++) // start from 1. at index [0] was scene
+        // Note: deserialization uses the shared ids mapping and prefab instance context (and managed scripts data) so it's done on a main thread
+        Scripting::ObjectsLookupIdMapping.Set(&Modifier->IdsMapping);
+        while (StageStep < ObjectsCount)
         {
-            auto& objData = data[i];
-            auto obj = sceneObjects->At(i);
+            auto& objData = Data[StageStep];
+            auto obj = SceneObjects->At(StageStep);
             if (obj)
-                SceneObjectsFactory::Deserialize(context, obj, objData);
+                SceneObjectsFactory::Deserialize(Context, obj, objData);
+            StageStep++;
+            if ((StageStep & 15) == 0 && Platform::GetTimeSeconds() >= timeLimit)
+            {
+                Scripting::ObjectsLookupIdMapping.Set(nullptr);
+                return false;
+            }
         }
         Scripting::ObjectsLookupIdMapping.Set(nullptr);
+        Stage = Stages::SyncPrefabs;
     }
+    case Stages::SyncPrefabs:
+    {
+        // Synchronize prefab instances (prefab may have objects removed or reordered so deserialized instances need to synchronize with it)
+        // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
+        SceneObjectsFactory::SynchronizePrefabInstances(Context, *PrefabSyncData);
 
-    // /\ all above this has to be done on multiple threads at once
-    // \/ all below this has to be done on an any thread
-
-    // Synchronize prefab instances (prefab may have objects removed or reordered so deserialized instances need to synchronize with it)
-    // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
-    SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
-
-    // Initialize scene objects
+        Stage = Stages::Initialize;
+        StageStep = 0;
+    }
+    case Stages::Initialize:
     {
         PROFILE_CPU_NAMED("Initialize");
 
-        for (int32 i = 0; i < sceneObjects->Count(); i++)
+        // Initialize scene objects
+        while (StageStep < SceneObjects->Count())
         {
-            SceneObject* obj = sceneObjects->At(i);
+            const int32 i = StageStep++;
+            SceneObject* obj = SceneObjects->At(i);
             if (obj)
             {
                 obj->Initialize();
@@ -1144,56 +1583,152 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
                 {
                     LOG(Warning, "Scene object {0} {1} has missing parent object after load. Removing it.", obj->GetID(), obj->ToString());
                     obj->DeleteObject();
+                    SceneObjects->At(i) = nullptr;
                 }
             }
+            CHECK_TIME_LIMIT(63);
         }
-    }
 
-    // Cache transformations
-    {
-        PROFILE_CPU_NAMED("Cache Transform");
+        // Cache transformations
+        {
+            PROFILE_CPU_NAMED("Cache Transform");
 
-        scene->OnTransformChanged();
-    }
+            LoadedScene->OnTransformChanged();
+        }
 
-    // /\ all above this has to be done on an any thread
-    // \/ all below this has to be done on a main thread
+        // Link scene
+        {
+            ScopeLock lock(ScenesLock);
+            Scenes.Add(LoadedScene);
+        }
 
-    // Link scene and call init
+        Stage = Stages::BeginPlay;
+        StageStep = 0;
+    }
+    case Stages::BeginPlay:
     {
         PROFILE_CPU_NAMED("BeginPlay");
 
-        ScopeLock lock(ScenesLock);
-        Scenes.Add(scene);
-        SceneBeginData beginData;
-        scene->BeginPlay(&beginData);
-        beginData.OnDone();
+        if (timeLimit < MAX_double)
+        {
+            // Begin play the scene root actors one by one (scene skips them later)
+            while (StageStep < LoadedScene->Children.Count())
+            {
+                Actor* child = LoadedScene->Children[StageStep++];
+                if (!child->IsDuringPlay())
+                {
+                    ScopeLock lock(ScenesLock);
+                    child->BeginPlay(&BeginData);
+                }
+                CHECK_TIME_LIMIT(0);
+            }
+        }
+
+        // Call init
+        {
+            ScopeLock lock(ScenesLock);
+            LoadedScene->BeginPlay(&BeginData);
+            BeginData.OnDone();
+        }
+
+        Stage = Stages::End;
+
+        // Fire event
+        CallSceneEvent(SceneEventType::OnSceneLoaded, LoadedScene, SceneId);
+
+        LOG(Info, "Scene loaded in {0} ms", (int32)(DateTime::NowUTC() - StartTime).GetTotalMilliseconds());
     }
+    case Stages::End:
+        break;
+    }
+#undef CHECK_TIME_LIMIT
+    return false;
+}
 
-    // Fire event
-    CallSceneEvent(SceneEventType::OnSceneLoaded, scene, sceneId);
+bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** outScene)
+{
+    if (outScene)
+        *outScene = nullptr;
 
-    LOG(Info, "Scene loaded in {0} ms", (int32)(DateTime::NowUTC() - startTime).GetTotalMilliseconds());
+    SceneLoader loader(data, engineBuild);
+    if (loader.Tick(MAX_double))
+        return true;
+    ASSERT(loader.IsDone());
     if (outScene)
-        *outScene = scene;
+        *outScene = loader.LoadedScene;
     return false;
 }
 
 bool LevelImpl::saveScene(Scene* scene)
 {
 #if USE_EDITOR
-    const auto path = scene->GetPath();
+    String path;
+    if (getScenePath(scene, path))
+        return true;
+    return saveScene(scene, path);
+#else
+    LOG(Error, "Cannot save data to the cooked content.");
+    return false;
+#endif
+}
+
+bool LevelImpl::getScenePath(Scene* scene, String& path)
+{
+#if USE_EDITOR
+    path = scene->GetPath();
     if (path.IsEmpty())
     {
         LOG(Error, "Missing scene path.");
         return true;
     }
-
-    return saveScene(scene, path);
+    return false;
 #else
     LOG(Error, "Cannot save data to the cooked content.");
+    return true;
+#endif
+}
+
+bool LevelImpl::writeSceneFile(const String& path, const rapidjson_flax::StringBuffer& data, bool prettyJson)
+{
+    PROFILE_CPU_NAMED("Level.WriteSceneFile");
+    const rapidjson_flax::StringBuffer* output = &data;
+    rapidjson_flax::StringBuffer prettyData;
+    if (prettyJson)
+    {
+        // Reformat compact json (numbers are copied as-is to keep the exact values)
+        PrettyJsonWriterImpl writer(prettyData);
+        rapidjson::GenericReader<rapidjson::UTF8<>, rapidjson::UTF8<>, rapidjson_flax::FlaxAllocator> reader;
+        rapidjson::StringStream stream(data.GetString());
+        if (reader.Parse<rapidjson::kParseNumbersAsStringsFlag>(stream, writer).IsError())
+        {
+            LOG(Error, "Cannot format scene data");
+            return true;
+        }
+        output = &prettyData;
+    }
+    if (File::WriteAllBytes(path, (const byte*)output->GetString(), (int32)output->GetSize()))
+    {
+        LOG(Error, "Cannot save scene file");
+        return true;
+    }
     return false;
+}
+
+void LevelImpl::onSceneFileSaved(const Guid& sceneId, const String& path, const DateTime& startTime)
+{
+    LOG(Info, "Scene saved! Time {0} ms", Math::CeilToInt((float)(DateTime::NowUTC() - startTime).GetTotalMilliseconds()));
+
+#if USE_EDITOR
+    // Reload asset at the target location if is loaded
+    Asset* asset = Content::GetAsset(sceneId);
+    if (!asset)
+        asset = Content::GetAsset(path);
+    if (asset)
+        asset->Reload();
 #endif
+
+    // Fire event
+    CallSceneEvent(SceneEventType::OnSceneSaved, Level::FindScene(sceneId), sceneId);
 }
 
 bool LevelImpl::saveScene(Scene* scene, const String& path)
@@ -1214,27 +1749,13 @@ bool LevelImpl::saveScene(Scene* scene, const String& path)
     }
 
     // Save json to file
-    if (File::WriteAllBytes(path, (byte*)buffer.GetString(), (int32)buffer.GetSize()))
+    if (writeSceneFile(path, buffer, false))
     {
-        LOG(Error, "Cannot save scene file");
         CallSceneEvent(SceneEventType::OnSceneSaveError, scene, sceneId);
         return true;
     }
 
-    LOG(Info, "Scene saved! Time {0} ms", Math::CeilToInt((float)(DateTime::NowUTC() - startTime).GetTotalMilliseconds()));
-
-#if USE_EDITOR
-    // Reload asset at the target location if is loaded
-    Asset* asset = Content::GetAsset(sceneId);
-    if (!asset)
-        asset = Content::GetAsset(path);
-    if (asset)
-        asset->Reload();
-#endif
-
-    // Fire event
-    CallSceneEvent(SceneEventType::OnSceneSaved, scene, sceneId);
-
+    onSceneFileSaved(sceneId, path, startTime);
     return false;
 }
 
@@ -1337,7 +1858,7 @@ Array<byte> Level::SaveSceneToBytes(Scene* scene, bool prettyJson)
 void Level::SaveSceneAsync(Scene* scene)
 {
     ScopeLock lock(_sceneActionsLocker);
-    _sceneActions.Enqueue(New<SaveSceneAction>(scene));
+    _sceneActions.Enqueue(New<SaveSceneAsyncAction>(scene));
 }
 
 bool Level::SaveAllScenes()
@@ -1355,7 +1876,7 @@ void Level::SaveAllScenesAsync()
 {
     ScopeLock lock(_sceneActionsLocker);
     for (int32 i = 0; i < Scenes.Count(); i++)
-        _sceneActions.Enqueue(New<SaveSceneAction>(Scenes[i]));
+        _sceneActions.Enqueue(New<SaveSceneAsyncAction>(Scenes[i]));
 }
 
 bool Level::LoadScene(const Guid& id)
@@ -16,6 +16,7 @@ class Engine;
 struct RenderView;
 struct RenderContext;
 struct RenderContextBatch;
+struct SceneRenderingView;
 struct Tag;
 
 /// <summary>
@@ -50,6 +51,16 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// </summary>
     API_FIELD() static bool TickEnabled;
 
+    /// <summary>
+    /// The time (in seconds) of recording the content loading requests after loading a scene. Recorded assets and chunks are saved (in order of the requests) into the preload manifest next to the scene file and get prefetched as a single batch when loading that scene later on (the game cooker also places the recorded assets in the packages in the same order). Use 0 to disable recording.
+    /// </summary>
+    API_FIELD() static float PreloadManifestRecordingTime;
+
+    /// <summary>
+    /// The time budget (in milliseconds) per frame for the asynchronous scene loading on a main thread (objects spawning, deserialization, initialization and BeginPlay). Loading that exceeds the budget continues in the next frame (scene is added to the loaded scenes before its actors begin play). Use 0 to load the whole scene within a single frame.
+    /// </summary>
+    API_FIELD() static float SceneLoadTimeBudget;
+
 public:
     /// <summary>
     /// Occurs when new actor gets spawned to the game.
@@ -169,6 +180,12 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <param name="category">The actors category to draw (see SceneRendering::DrawCategory).</param>
     static void DrawActors(RenderContextBatch& renderContextBatch, byte category = 0);
 
+    /// <summary>
+    /// Culls the actors of all scenes against the main views of many scene rendering tasks at once (see SceneRendering::CullSharedViews).
+    /// </summary>
+    /// <param name="views">The views to cull.</param>
+    static void CullSharedViews(const Span<SceneRenderingView>& views);
+
     /// <summary>
     /// Collects all the post fx volumes.
     /// </summary>
@@ -275,6 +292,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <summary>
     /// Saves scene to the asset. Done in the background.
     /// </summary>
+    /// <remarks>Scene objects state is captured on a main thread during the next scene actions flush, while the json formatting and the file writing are done on a worker thread.</remarks>
     /// <param name="scene">Scene to serialize.</param>
     API_FUNCTION() static void SaveSceneAsync(Scene* scene);
 
@@ -287,6 +305,7 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <summary>
     /// Saves all scenes to the assets. Done in the background.
     /// </summary>
+    /// <remarks>Scene objects state is captured on a main thread during the next scene actions flush, while the json formatting and the file writing are done on a worker thread.</remarks>
     API_FUNCTION() static void SaveAllScenesAsync();
 
     /// <summary>
@@ -508,6 +527,31 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// <returns>Returns all actors that have subtags belonging to the given parent parentTag</returns>
     API_FUNCTION() static Array<Actor*> FindActorsByParentTag(const Tag& parentTag, const bool activeOnly = false, Actor* root = nullptr);
 
+public:
+    /// <summary>
+    /// Finds the enabled actors which bounds intersect with the given box. Uses the scenes spatial index (doesn't use physics).
+    /// </summary>
+    /// <param name="box">The bounding box to test.</param>
+    /// <param name="type">The type of the actors to find (including the derived types).</param>
+    /// <returns>Found actors or empty if none.</returns>
+    API_FUNCTION() static Array<Actor*> OverlapActors(const BoundingBox& box, API_PARAM(Attributes="TypeReference(typeof(Actor))") const MClass* type);
+
+    /// <summary>
+    /// Finds the enabled actors which bounds intersect with the given sphere (eg. actors within a radius). Uses the scenes spatial index (doesn't use physics).
+    /// </summary>
+    /// <param name="sphere">The bounding sphere to test.</param>
+    /// <param name="type">The type of the actors to find (including the derived types).</param>
+    /// <returns>Found actors or empty if none.</returns>
+    API_FUNCTION() static Array<Actor*> OverlapActors(const BoundingSphere& sphere, API_PARAM(Attributes="TypeReference(typeof(Actor))") const MClass* type);
+
+    /// <summary>
+    /// Finds the enabled actors which bounds intersect with the given frustum. Uses the scenes spatial index (doesn't use physics).
+    /// </summary>
+    /// <param name="frustum">The frustum to test.</param>
+    /// <param name="type">The type of the actors to find (including the derived types).</param>
+    /// <returns>Found actors or empty if none.</returns>
+    API_FUNCTION() static Array<Actor*> OverlapActors(const BoundingFrustum& frustum, API_PARAM(Attributes="TypeReference(typeof(Actor))") const MClass* type);
+
 private:
     // Actor API
     enum class ActorEventType
@@ -520,6 +564,8 @@ API_CLASS(Static) class FLAXENGINE_API Level
         OnActorActiveChanged = 5,
     };
 
+    class SceneLoader;
+
     static void callActorEvent(ActorEventType eventType, Actor* a, Actor* b);
     static bool loadScene(const Guid& sceneId);
     static bool loadScene(const String& scenePath);
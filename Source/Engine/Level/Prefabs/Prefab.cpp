@@ -8,9 +8,7 @@
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Threading/Threading.h"
-#if USE_EDITOR
 #include "Engine/Scripting/Scripting.h"
-#endif
 
 REGISTER_JSON_ASSET(Prefab, "FlaxEngine.Prefab", true);
 
@@ -101,10 +99,42 @@ SceneObject* Prefab::GetDefaultInstance(const Guid& objectId)
     return result;
 }
 
+const Prefab::SpawnCache& Prefab::GetSpawnCache()
+{
+    ASSERT(IsLoaded());
+    ScopeLock lock(Locker);
+    if (_spawnCache.Types.Count() == ObjectsCount)
+        return _spawnCache;
+
+    // Find the root object
+    _spawnCache.RootIndex = ObjectsIds.Find(GetRootObjectId());
+
+    // Resolve objects types to skip types lookup during spawning
+    const auto& data = *Data;
+    _spawnCache.Types.Resize(ObjectsCount);
+    for (int32 i = 0; i < ObjectsCount; i++)
+    {
+        ScriptingTypeHandle& type = _spawnCache.Types[i];
+        type = ScriptingTypeHandle();
+        auto& objData = data[i];
+        if (JsonTools::GetGuid(objData, "PrefabObjectID").IsValid())
+            continue;
+        const auto typeNameMember = objData.FindMember("TypeName");
+        if (typeNameMember == objData.MemberEnd() || !typeNameMember->value.IsString())
+            continue;
+        const ScriptingTypeHandle objType = Scripting::FindScriptingType(typeNameMember->value.GetStringAnsiView());
+        if (objType && SceneObject::TypeInitializer.IsAssignableFrom(objType))
+            type = objType;
+    }
+
+    return _spawnCache;
+}
+
 void Prefab::DeleteDefaultInstance()
 {
     ScopeLock lock(Locker);
     ObjectsCache.Clear();
+    _spawnCache.Types.Resize(0);
     if (_defaultInstance)
     {
         _defaultInstance->DeleteObject();
@@ -195,6 +225,8 @@ void Prefab::unload(bool isReloading)
     ObjectsDataCache.SetCapacity(0);
     ObjectsCache.Clear();
     ObjectsCache.SetCapacity(0);
+    _spawnCache.RootIndex = -1;
+    _spawnCache.Types.Resize(0);
     if (_defaultInstance)
     {
         _defaultInstance->DeleteObject();
@@ -5,6 +5,7 @@
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Scripting/ScriptingType.h"
 
 class Actor;
 class SceneObject;
@@ -16,9 +17,27 @@ class SceneObject;
 API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
 {
     DECLARE_ASSET_HEADER(Prefab);
+public:
+    /// <summary>
+    /// The cached prefab data used to spawn the prefab instances.
+    /// </summary>
+    struct SpawnCache
+    {
+        /// <summary>
+        /// The index of the prefab root object in the prefab data (-1 if missing).
+        /// </summary>
+        int32 RootIndex = -1;
+
+        /// <summary>
+        /// The scripting types of the prefab objects (per object in prefab data). Objects with empty type handle (eg. nested prefab instances) are spawned via the full data lookup.
+        /// </summary>
+        Array<ScriptingTypeHandle> Types;
+    };
+
 private:
     bool _isCreatingDefaultInstance;
     Actor* _defaultInstance;
+    SpawnCache _spawnCache;
 
 public:
     /// <summary>
@@ -65,6 +84,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     /// <returns>The object of the prefab loaded from the prefab. Contains the default values. It's not added to gameplay but deserialized with postLoad and init event fired.</returns>
     API_FUNCTION() SceneObject* GetDefaultInstance(API_PARAM(Ref) const Guid& objectId);
 
+    /// <summary>
+    /// Gets the cached prefab data used to spawn the prefab instances (built on the first use). Asset must be loaded.
+    /// </summary>
+    const SpawnCache& GetSpawnCache();
+
 #if USE_EDITOR
     /// <summary>
     /// Applies the difference from the prefab object instance, saves the changes and synchronizes them with the active instances of the prefab asset.
@@ -18,6 +18,8 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Scripting/Script.h"
 #include "Engine/Scripting/Scripting.h"
+#include "Engine/Scripting/ScriptingObjectReference.h"
+#include "Engine/Threading/Threading.h"
 
 #if USE_EDITOR
 bool PrefabManager::IsCreatingPrefab = false;
@@ -25,6 +27,14 @@ Dictionary<Guid, Array<Actor*>> PrefabManager::PrefabsReferences;
 CriticalSection PrefabManager::PrefabsReferencesLocker;
 #endif
 
+int32 PrefabManager::MaxPoolSize = 256;
+
+namespace
+{
+    CriticalSection PoolsLocker;
+    Dictionary<Guid, Array<ScriptingObjectReference<Actor>>> Pools;
+}
+
 class PrefabManagerService : public EngineService
 {
 public:
@@ -32,6 +42,12 @@ class PrefabManagerService : public EngineService
         : EngineService(TEXT("Prefab Manager"), 110)
     {
     }
+
+    void Dispose() override
+    {
+        ScopeLock lock(PoolsLocker);
+        Pools.Clear();
+    }
 };
 
 PrefabManagerService PrefabManagerServiceInstance;
@@ -68,41 +84,187 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Vector3& position, const
 
 Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform)
 {
-    auto instance = SpawnPrefab(prefab);
-    if (instance)
-        instance->SetTransform(transform);
-    return instance;
+    PROFILE_CPU_NAMED("Prefab.Spawn");
+    if (CheckPrefabToSpawn(prefab))
+        return nullptr;
+    Actor* parent = Level::Scenes.Count() != 0 ? Level::Scenes.Get()[0] : nullptr;
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
+    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+    return SpawnPrefabInstance(prefab, parent, nullptr, false, &transform, modifier.Value, *sceneObjects.Value);
+}
+
+Array<Actor*> PrefabManager::SpawnPrefabs(Prefab* prefab, const Span<Transform>& transforms)
+{
+    Actor* parent = Level::Scenes.Count() != 0 ? Level::Scenes.Get()[0] : nullptr;
+    return SpawnPrefabs(prefab, transforms, parent);
+}
+
+Array<Actor*> PrefabManager::SpawnPrefabs(Prefab* prefab, const Span<Transform>& transforms, Actor* parent)
+{
+    PROFILE_CPU_NAMED("Prefab.SpawnBatch");
+    Array<Actor*> result;
+    if (CheckPrefabToSpawn(prefab))
+        return result;
+
+    // Reuse the same objects list and the ids mapping for all instances
+    result.EnsureCapacity(transforms.Length());
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
+    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+    for (int32 i = 0; i < transforms.Length(); i++)
+    {
+        Actor* root = SpawnPrefabInstance(prefab, parent, nullptr, false, &transforms[i], modifier.Value, *sceneObjects.Value);
+        if (root)
+            result.Add(root);
+    }
+    return result;
 }
 
 Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid, const void*>* objectsCache, bool withSynchronization)
 {
     PROFILE_CPU_NAMED("Prefab.Spawn");
+    if (CheckPrefabToSpawn(prefab))
+        return nullptr;
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
+    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+    return SpawnPrefabInstance(prefab, parent, objectsCache, withSynchronization, nullptr, modifier.Value, *sceneObjects.Value);
+}
+
+Actor* PrefabManager::SpawnPrefabPooled(Prefab* prefab, const Transform& transform, Actor* parent)
+{
+    PROFILE_CPU_NAMED("Prefab.SpawnPooled");
+    if (!parent)
+        parent = Level::Scenes.Count() != 0 ? Level::Scenes.Get()[0] : nullptr;
+    if (prefab)
+    {
+        // Reuse the inactive instance from the pool
+        ScopeLock lock(PoolsLocker);
+        auto pool = Pools.TryGet(prefab->GetID());
+        while (pool && pool->HasItems())
+        {
+            Actor* instance = pool->Last().Get();
+            pool->RemoveLast();
+            if (!instance)
+                continue; // Instance has been deleted while in pool (eg. scene unload)
+            if (instance->GetParent() != parent)
+                instance->SetParent(parent, false, false);
+            instance->SetTransform(transform);
+            instance->SetIsActive(true);
+            return instance;
+        }
+    }
+
+    // Spawn a new instance
+    if (CheckPrefabToSpawn(prefab))
+        return nullptr;
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
+    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+    return SpawnPrefabInstance(prefab, parent, nullptr, false, &transform, modifier.Value, *sceneObjects.Value);
+}
+
+void PrefabManager::ReleasePrefabPooled(Actor* instance)
+{
+    if (!instance)
+        return;
+    const Guid prefabId = instance->GetPrefabID();
+    if (prefabId.IsValid() && instance->IsPrefabRoot())
+    {
+        ScopeLock lock(PoolsLocker);
+        auto& pool = Pools[prefabId];
+        if (pool.Contains(instance))
+            return;
+        if (pool.Count() < MaxPoolSize)
+        {
+            // Park the instance (disabled actors and scripts are removed from rendering, physics and ticking but stay allocated and registered)
+            instance->SetIsActive(false);
+            pool.Add(instance);
+            return;
+        }
+    }
+    instance->DeleteObject();
+}
+
+void PrefabManager::WarmPrefabPool(Prefab* prefab, int32 count, Actor* parent)
+{
+    PROFILE_CPU_NAMED("Prefab.WarmPool");
+    if (!parent)
+        parent = Level::Scenes.Count() != 0 ? Level::Scenes.Get()[0] : nullptr;
+    if (CheckPrefabToSpawn(prefab))
+        return;
+    ScopeLock lock(PoolsLocker);
+    auto& pool = Pools[prefab->GetID()];
+    count = Math::Min(count, MaxPoolSize - pool.Count());
+    if (count <= 0)
+        return;
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
+    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+    for (int32 i = 0; i < count; i++)
+    {
+        Actor* instance = SpawnPrefabInstance(prefab, parent, nullptr, false, &Transform::Identity, modifier.Value, *sceneObjects.Value);
+        if (!instance)
+            break;
+        instance->SetIsActive(false);
+        pool.Add(instance);
+    }
+}
+
+int32 PrefabManager::GetPrefabPoolSize(Prefab* prefab)
+{
+    ScopeLock lock(PoolsLocker);
+    const auto pool = prefab ? Pools.TryGet(prefab->GetID()) : nullptr;
+    return pool ? pool->Count() : 0;
+}
+
+void PrefabManager::ClearPrefabPool(Prefab* prefab)
+{
+    ScopeLock lock(PoolsLocker);
+    for (auto& e : Pools)
+    {
+        if (prefab && e.Key != prefab->GetID())
+            continue;
+        for (int32 i = 0; i < e.Value.Count(); i++)
+        {
+            Actor* instance = e.Value[i].Get();
+            if (instance)
+                instance->DeleteObject();
+        }
+        e.Value.Clear();
+    }
+}
+
+bool PrefabManager::CheckPrefabToSpawn(Prefab* prefab)
+{
     if (prefab == nullptr)
     {
         Log::ArgumentNullException();
-        return nullptr;
+        return true;
     }
     if (prefab->WaitForLoaded())
     {
         LOG(Warning, "Waiting for prefab asset be loaded failed. {0}", prefab->ToString());
-        return nullptr;
+        return true;
     }
-    const int32 objectsCount = prefab->ObjectsCount;
-    if (objectsCount == 0)
+    if (prefab->ObjectsCount == 0)
     {
         LOG(Warning, "Prefab has no objects. {0}", prefab->ToString());
-        return nullptr;
+        return true;
     }
+    return false;
+}
+
+Actor* PrefabManager::SpawnPrefabInstance(Prefab* prefab, Actor* parent, Dictionary<Guid, const void*>* objectsCache, bool withSynchronization, const Transform* transform, ISerializeModifier* modifier, Array<SceneObject*>& sceneObjects)
+{
+    const int32 objectsCount = prefab->ObjectsCount;
     const Guid prefabId = prefab->GetID();
+    const Prefab::SpawnCache& spawnCache = prefab->GetSpawnCache();
 
     // Note: we need to generate unique Ids for the deserialized objects (actors and scripts) to prevent Ids collisions
     // Prefab asset during loading caches the object Ids stored inside the file
 
     // Prepare
-    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
-    sceneObjects->Resize(objectsCount);
-    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache modifier = Cache::ISerializeModifier.Get();
+    sceneObjects.Clear();
+    sceneObjects.Resize(objectsCount);
     modifier->EngineBuild = prefab->DataEngineBuild;
+    modifier->IdsMapping.Clear();
     modifier->IdsMapping.EnsureCapacity(prefab->ObjectsIds.Count() * 4);
     for (int32 i = 0; i < prefab->ObjectsIds.Count(); i++)
     {
@@ -114,55 +276,57 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
         objectsCache->SetCapacity(prefab->ObjectsDataCache.Capacity());
     }
     auto& data = *prefab->Data;
-    SceneObjectsFactory::Context context(modifier.Value);
+    SceneObjectsFactory::Context context(modifier);
 
     // Deserialize prefab objects
     auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
-    Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+    Scripting::ObjectsLookupIdMapping.Set(&modifier->IdsMapping);
     for (int32 i = 0; i < objectsCount; i++)
     {
         auto& stream = data[i];
-        SceneObject* obj = SceneObjectsFactory::Spawn(context, stream);
-        sceneObjects->At(i) = obj;
+        SceneObject* obj;
+        const ScriptingTypeHandle& type = spawnCache.Types[i];
+        if (type)
+        {
+            // Spawn object of the cached type directly (skips type lookup)
+            const ScriptingObjectSpawnParams params(modifier->IdsMapping[prefab->ObjectsIds[i]], type);
+            obj = (SceneObject*)type.GetType().Script.Spawn(params);
+        }
+        else
+        {
+            obj = SceneObjectsFactory::Spawn(context, stream);
+        }
+        sceneObjects[i] = obj;
         if (obj)
             obj->RegisterObject();
         else
             SceneObjectsFactory::HandleObjectDeserializationError(stream);
     }
-    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
+    SceneObjectsFactory::PrefabSyncData prefabSyncData(sceneObjects, data, modifier);
     if (withSynchronization)
     {
         // Synchronize new prefab instances (prefab may have new objects added so deserialized instances need to synchronize with it)
         // TODO: resave and force sync prefabs during game cooking so this step could be skipped in game
         SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
         SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
-        Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
+        Scripting::ObjectsLookupIdMapping.Set(&modifier->IdsMapping);
     }
     for (int32 i = 0; i < objectsCount; i++)
     {
         auto& stream = data[i];
-        SceneObject* obj = sceneObjects->At(i);
+        SceneObject* obj = sceneObjects.At(i);
         if (obj)
             SceneObjectsFactory::Deserialize(context, obj, stream);
     }
     Scripting::ObjectsLookupIdMapping.Set(prevIdMapping);
 
     // Pick prefab root object
-    if (sceneObjects->IsEmpty())
+    if (sceneObjects.IsEmpty())
     {
         LOG(Warning, "No valid objects in prefab.");
         return nullptr;
     }
-    Actor* root = nullptr;
-    const Guid prefabRootObjectId = prefab->GetRootObjectId();
-    for (int32 i = 0; i < objectsCount; i++)
-    {
-        if (JsonTools::GetGuid(data[i], "ID") == prefabRootObjectId)
-        {
-            root = dynamic_cast<Actor*>(sceneObjects->At(i));
-            break;
-        }
-    }
+    Actor* root = spawnCache.RootIndex != -1 ? dynamic_cast<Actor*>(sceneObjects.At(spawnCache.RootIndex)) : nullptr;
     if (!root)
     {
         LOG(Warning, "Missing prefab root object.");
@@ -184,17 +348,17 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
         parent->Children.Add(root);
 
     // Link actors hierarchy
-    for (int32 i = 0; i < sceneObjects->Count(); i++)
+    for (int32 i = 0; i < sceneObjects.Count(); i++)
     {
-        SceneObject* obj = sceneObjects->At(i);
+        SceneObject* obj = sceneObjects.At(i);
         if (obj)
             obj->Initialize();
     }
 
     // Delete objects without parent or with invalid linkage to the prefab
-    for (int32 i = 0; i < sceneObjects->Count(); i++)
+    for (int32 i = 0; i < sceneObjects.Count(); i++)
     {
-        SceneObject* obj = sceneObjects->At(i);
+        SceneObject* obj = sceneObjects.At(i);
         if (!obj || obj == root)
             continue;
 
@@ -202,7 +366,7 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
         if (obj->GetParent() == nullptr)
         {
             LOG(Warning, "Scene object {0} {1} has missing parent object after load. Removing it.", obj->GetID(), obj->ToString());
-            sceneObjects->At(i) = nullptr;
+            sceneObjects.At(i) = nullptr;
             obj->DeleteObject();
             continue;
         }
@@ -214,7 +378,7 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
         if (obj->GetParent() == obj || (actor && !actor->GetParent()->Children.Contains(actor)) || (script && !script->GetParent()->Scripts.Contains(script)))
         {
             LOG(Warning, "Scene object {0} {1} has invalid parent object linkage after load. Removing it.", obj->GetID(), obj->ToString());
-            sceneObjects->At(i) = nullptr;
+            sceneObjects.At(i) = nullptr;
             obj->DeleteObject();
             continue;
         }
@@ -223,9 +387,9 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
 #if (USE_EDITOR && BUILD_DEBUG) || FLAX_TESTS
         // Check for being added to parent not from spawned prefab (eg. invalid parentId linkage fault)
         bool hasParentInInstance = false;
-        for (int32 j = 0; j < sceneObjects->Count(); j++)
+        for (int32 j = 0; j < sceneObjects.Count(); j++)
         {
-            if (sceneObjects->At(j) == obj->GetParent())
+            if (sceneObjects.At(j) == obj->GetParent())
             {
                 hasParentInInstance = true;
                 break;
@@ -234,7 +398,7 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
         if (!hasParentInInstance)
         {
             LOG(Warning, "Scene object {0} {1} has invalid parent object after load. Removing it.", obj->GetID(), obj->ToString());
-            sceneObjects->At(i) = nullptr;
+            sceneObjects.At(i) = nullptr;
             obj->DeleteObject();
             continue;
         }
@@ -244,7 +408,7 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
         if (actor && actor->HasActorInHierarchy(actor))
         {
             LOG(Warning, "Scene object {0} {1} has invalid hierarchy after load. Removing it.", obj->GetID(), obj->ToString());
-            sceneObjects->At(i) = nullptr;
+            sceneObjects.At(i) = nullptr;
             obj->DeleteObject();
             continue;
         }
@@ -255,18 +419,24 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid
     // Link objects to prefab (only deserialized from prefab data)
     for (int32 i = 0; i < objectsCount; i++)
     {
-        auto& stream = data[i];
-        SceneObject* obj = sceneObjects->At(i);
+        SceneObject* obj = sceneObjects.At(i);
         if (!obj)
             continue;
 
-        const Guid prefabObjectId = JsonTools::GetGuid(stream, "ID");
+        const Guid& prefabObjectId = prefab->ObjectsIds[i];
         if (objectsCache)
             objectsCache->Add(prefabObjectId, obj);
         obj->LinkPrefab(prefabId, prefabObjectId);
     }
 
     // Update transformations
+    if (transform)
+    {
+        if (parent)
+            parent->GetTransform().WorldToLocal(*transform, root->_localTransform);
+        else
+            root->_localTransform = *transform;
+    }
     root->OnTransformChanged();
 
     // Spawn if need to
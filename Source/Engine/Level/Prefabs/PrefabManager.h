@@ -3,10 +3,12 @@
 #pragma once
 
 #include "Engine/Scripting/ScriptingType.h"
+#include "Engine/Core/Types/Span.h"
 
 class Prefab;
 class Actor;
 class SceneObject;
+class ISerializeModifier;
 struct Transform;
 
 // Short documentation for the prefabs system:
@@ -85,6 +87,65 @@ API_CLASS(Static) class FLAXENGINE_API PrefabManager
     /// <returns>The created actor (root) or null if failed.</returns>
     static Actor* SpawnPrefab(Prefab* prefab, Actor* parent, Dictionary<Guid, const void*, HeapAllocation>* objectsCache, bool withSynchronization = false);
 
+    /// <summary>
+    /// Spawns the multiple instances of the prefab objects in a single batch (prefab data is prepared once for all instances). Prefab will be spawned to the first loaded scene.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="transforms">The spawn transformations (in world space) of the instances to create.</param>
+    /// <returns>The created actors (roots of the prefab instances). Instances that failed to spawn are skipped.</returns>
+    API_FUNCTION() static Array<Actor*, HeapAllocation> SpawnPrefabs(Prefab* prefab, const Span<Transform>& transforms);
+
+    /// <summary>
+    /// Spawns the multiple instances of the prefab objects in a single batch (prefab data is prepared once for all instances). If parent actor is specified then created actors are fully initialized (OnLoad event and BeginPlay is called if parent actor is already during gameplay).
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="transforms">The spawn transformations (in world space) of the instances to create.</param>
+    /// <param name="parent">The parent actor to add spawned objects instances. Can be null to just deserialize contents of the prefab.</param>
+    /// <returns>The created actors (roots of the prefab instances). Instances that failed to spawn are skipped.</returns>
+    API_FUNCTION() static Array<Actor*, HeapAllocation> SpawnPrefabs(Prefab* prefab, const Span<Transform>& transforms, Actor* parent);
+
+public:
+    /// <summary>
+    /// The maximum amount of the inactive instances kept in the pool per prefab. Instances released to the full pool are deleted.
+    /// </summary>
+    API_FIELD() static int32 MaxPoolSize;
+
+    /// <summary>
+    /// Spawns the instance of the prefab objects by reusing the inactive instance from the pool (or spawns a new one if pool is empty). Reused instances get activated (scripts receive OnEnable but not OnAwake/OnStart) so their state should be reset by the gameplay code.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="transform">The spawn transformation in the world space.</param>
+    /// <param name="parent">The parent actor to add spawned object instance. Can be null to use the first loaded scene.</param>
+    /// <returns>The created actor (root) or null if failed.</returns>
+    API_FUNCTION() static Actor* SpawnPrefabPooled(Prefab* prefab, const Transform& transform, Actor* parent = nullptr);
+
+    /// <summary>
+    /// Releases the prefab instance to the pool to be reused by SpawnPrefabPooled. Instance gets deactivated (removed from rendering, physics and ticking) but its objects stay allocated and registered. Actors that are not prefab instance roots (or don't fit into the pool) are deleted.
+    /// </summary>
+    /// <param name="instance">The prefab instance root actor.</param>
+    API_FUNCTION() static void ReleasePrefabPooled(Actor* instance);
+
+    /// <summary>
+    /// Spawns the inactive prefab instances into the pool to be reused later (eg. during level loading to prevent spawning during gameplay).
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="count">The amount of instances to spawn (limited by the MaxPoolSize).</param>
+    /// <param name="parent">The parent actor to add spawned objects instances. Can be null to use the first loaded scene.</param>
+    API_FUNCTION() static void WarmPrefabPool(Prefab* prefab, int32 count, Actor* parent = nullptr);
+
+    /// <summary>
+    /// Gets the amount of the inactive instances in the prefab pool.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <returns>The pooled instances count.</returns>
+    API_FUNCTION() static int32 GetPrefabPoolSize(Prefab* prefab);
+
+    /// <summary>
+    /// Deletes the pooled instances of the prefab.
+    /// </summary>
+    /// <param name="prefab">The prefab asset. Can be null to clear pools of all prefabs.</param>
+    API_FUNCTION() static void ClearPrefabPool(Prefab* prefab = nullptr);
+
 #if USE_EDITOR
 
     /// <summary>
@@ -131,4 +192,8 @@ API_CLASS(Static) class FLAXENGINE_API PrefabManager
     API_FUNCTION() static bool ApplyAll(Actor* instance);
 
 #endif
+
+private:
+    static bool CheckPrefabToSpawn(Prefab* prefab);
+    static Actor* SpawnPrefabInstance(Prefab* prefab, Actor* parent, Dictionary<Guid, const void*, HeapAllocation>* objectsCache, bool withSynchronization, const Transform* transform, ISerializeModifier* modifier, Array<SceneObject*, HeapAllocation>& sceneObjects);
 };
@@ -8,6 +8,7 @@
 #include "Engine/Level/Level.h"
 #include "Engine/Level/Scene/SceneLightmapsData.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Textures/StreamingTexture.h"
 #if USE_EDITOR
 #include "Engine/ContentImporters/ImportTexture.h"
 #include "Engine/ContentImporters/AssetsImportingManager.h"
@@ -27,6 +28,9 @@ void LightmapSettings::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(CompressLightmaps);
     SERIALIZE(UseGeometryWithNoMaterials);
     SERIALIZE(Quality);
+    SERIALIZE(BakeMode);
+    SERIALIZE(SamplesPerTexel);
+    SERIALIZE(IncrementalBake);
 }
 
 void LightmapSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -39,6 +43,9 @@ void LightmapSettings::Deserialize(DeserializeStream& stream, ISerializeModifier
     DESERIALIZE(CompressLightmaps);
     DESERIALIZE(UseGeometryWithNoMaterials);
     DESERIALIZE(Quality);
+    DESERIALIZE(BakeMode);
+    DESERIALIZE(SamplesPerTexel);
+    DESERIALIZE(IncrementalBake);
 }
 
 Lightmap::Lightmap(SceneLightmapsData* manager, int32 index, const SavedLightmapInfo& info)
@@ -49,6 +56,8 @@ Lightmap::Lightmap(SceneLightmapsData* manager, int32 index, const SavedLightmap
     _textures[0] = Content::LoadAsync<Texture>(info.Lightmap0);
     _textures[1] = Content::LoadAsync<Texture>(info.Lightmap1);
     _textures[2] = Content::LoadAsync<Texture>(info.Lightmap2);
+    for (int32 textureIndex = 0; textureIndex < ARRAY_COUNT(_textures); textureIndex++)
+        OnTextureChanged(textureIndex);
 }
 
 void Lightmap::UpdateTexture(Texture* texture, int32 index)
@@ -58,6 +67,7 @@ void Lightmap::UpdateTexture(Texture* texture, int32 index)
     {
         LOG(Info, "Changing lightmap {0} texture {1} from '{2}' to '{3}'", _index, index, prev ? prev->ToString() : String::Empty, texture ? texture->ToString() : String::Empty);
         prev = texture;
+        OnTextureChanged(index);
     }
 }
 
@@ -135,6 +145,7 @@ void Lightmap::EnsureSize(int32 size)
 
             // Update asset
             texture = result;
+            OnTextureChanged(textureIndex);
 #else
 			LOG(Warning, "Cannot create empty lightmap. Saving data to the cooked content is disabled.");
 #endif
@@ -150,6 +161,26 @@ bool Lightmap::IsReady() const
             && _textures[2] && _textures[2]->GetTexture()->ResidentMipLevels() > 0;
 }
 
+void Lightmap::RegisterFeedback(float screenResolution, const Rectangle& uvsArea) const
+{
+    // Convert the object resolution into the whole lightmap resolution (object covers only a part of the atlas)
+    const float uvsSize = Math::Max(uvsArea.Size.X, uvsArea.Size.Y);
+    if (uvsSize <= ZeroTolerance)
+        return;
+    const float resolution = screenResolution / uvsSize;
+    for (int32 textureIndex = 0; textureIndex < ARRAY_COUNT(_textures); textureIndex++)
+    {
+        if (_textures[textureIndex])
+            _textures[textureIndex]->StreamingTexture()->RegisterFeedback(resolution);
+    }
+}
+
+void Lightmap::OnTextureChanged(int32 index)
+{
+    if (_textures[index])
+        _textures[index]->StreamingTexture()->IsLightmap = true;
+}
+
 #if USE_EDITOR
 
 bool Lightmap::OnInitLightmap(TextureData& image)
@@ -95,7 +95,15 @@ class Lightmap
     /// </summary>
     bool IsReady() const;
 
+    /// <summary>
+    /// Registers the lightmap usage by the drawn object to stream the textures mips needed by the object.
+    /// </summary>
+    /// <param name="screenResolution">The on-screen resolution of the object (in pixels).</param>
+    /// <param name="uvsArea">The object lightmap UVs area.</param>
+    void RegisterFeedback(float screenResolution, const Rectangle& uvsArea) const;
+
 private:
+    void OnTextureChanged(int32 index);
 #if USE_EDITOR
     bool OnInitLightmap(class TextureData& image);
 #endif
@@ -88,6 +88,21 @@ void Scene::SetLightmapSettings(const LightmapSettings& value)
     Info.LightmapSettings = value;
 }
 
+bool Scene::GetDeferredTransforms() const
+{
+    return Transforms.IsDeferred();
+}
+
+void Scene::SetDeferredTransforms(bool value)
+{
+    Transforms.SetDeferred(value);
+}
+
+void Scene::FlushTransforms()
+{
+    Transforms.Flush();
+}
+
 void Scene::ClearLightmaps()
 {
     LightmapsData.ClearLightmaps();
@@ -8,6 +8,8 @@
 #include "SceneCSGData.h"
 #include "SceneRendering.h"
 #include "SceneTicking.h"
+#include "SceneTransforms.h"
+#include "SceneActorsIndex.h"
 #include "SceneNavigation.h"
 
 class MeshCollider;
@@ -52,6 +54,16 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// </summary>
     SceneTicking Ticking;
 
+    /// <summary>
+    /// The scene transformations manager.
+    /// </summary>
+    SceneTransforms Transforms;
+
+    /// <summary>
+    /// The scene actors spatial index and lookup registries.
+    /// </summary>
+    SceneActorsIndex ActorsIndex;
+
     /// <summary>
     /// The navigation data.
     /// </summary>
@@ -78,7 +90,22 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// </summary>
     API_PROPERTY() void SetLightmapSettings(const LightmapSettings& value);
 
+    /// <summary>
+    /// Gets a value indicating whether the transformation changes are propagated to the child actors in a batch once per update stage (instead of immediately). Improves performance of moving large hierarchies but world transformation and bounds of the child actors are outdated until the flush.
+    /// </summary>
+    API_PROPERTY(Attributes="HideInEditor, NoSerialize") bool GetDeferredTransforms() const;
+
+    /// <summary>
+    /// Sets a value indicating whether the transformation changes are propagated to the child actors in a batch once per update stage (instead of immediately). Improves performance of moving large hierarchies but world transformation and bounds of the child actors are outdated until the flush.
+    /// </summary>
+    API_PROPERTY() void SetDeferredTransforms(bool value);
+
 public:
+    /// <summary>
+    /// Propagates the deferred transformation changes to the child actors (see DeferredTransforms).
+    /// </summary>
+    API_FUNCTION() void FlushTransforms();
+
     /// <summary>
     /// Removes all baked lightmap textures from the scene.
     /// </summary>
@@ -0,0 +1,285 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "SceneActorsIndex.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// The cell key used by the actors placed in the large actors list
+#define LARGE_CELL MAX_int64
+
+namespace
+{
+    template<typename Lookup>
+    void RemoveSwap(Array<Actor*>& list, int32 index, Lookup lookup)
+    {
+        // Move the last actor into the removed slot to keep the removal O(1)
+        const int32 last = list.Count() - 1;
+        if (index != last)
+        {
+            Actor* moved = list[last];
+            list[index] = moved;
+            lookup(moved) = index;
+        }
+        list.RemoveLast();
+    }
+}
+
+void SceneActorsIndex::GetActors(const Tag& tag, Array<Actor*>& result)
+{
+    ScopeLock lock(_locker);
+    const Array<Actor*>* list = _tags.TryGet(tag);
+    if (list)
+        result.Add(*list);
+}
+
+Actor* SceneActorsIndex::GetActor(const Tag& tag)
+{
+    ScopeLock lock(_locker);
+    const Array<Actor*>* list = _tags.TryGet(tag);
+    return list && list->HasItems() ? list->At(0) : nullptr;
+}
+
+void SceneActorsIndex::GetActors(const MClass* type, Array<Actor*>& result)
+{
+    ScopeLock lock(_locker);
+    for (auto& e : _types)
+    {
+        // All actors in a bucket share the same type so check the first one
+        const Array<Actor*>& list = e.Value;
+        if (list.HasItems() && Actor::IsSubClassOf(list[0], type))
+            result.Add(list);
+    }
+}
+
+void SceneActorsIndex::Query(const BoundingBox& box, Array<Actor*>& result, const MClass* type)
+{
+    QueryBounds(box, result, type, [&box](const Actor* actor)
+    {
+        return actor->GetBox().Intersects(box);
+    });
+}
+
+void SceneActorsIndex::Query(const BoundingSphere& sphere, Array<Actor*>& result, const MClass* type)
+{
+    QueryBounds(BoundingBox::FromSphere(sphere), result, type, [&sphere](const Actor* actor)
+    {
+        return sphere.Intersects(actor->GetBox());
+    });
+}
+
+void SceneActorsIndex::Query(const BoundingFrustum& frustum, Array<Actor*>& result, const MClass* type)
+{
+    BoundingBox bounds;
+    frustum.GetBox(bounds);
+    QueryBounds(bounds, result, type, [&frustum](const Actor* actor)
+    {
+        return frustum.Intersects(actor->GetBox());
+    });
+}
+
+void SceneActorsIndex::Add(Actor* actor)
+{
+    ScopeLock lock(_locker);
+    Entry& entry = _entries[actor];
+
+    // Type
+    auto& typeList = _types[actor->GetTypeHandle()];
+    entry.TypeIndex = typeList.Count();
+    typeList.Add(actor);
+
+    // Tags
+    entry.Tags.Clear();
+    for (const Tag& tag : actor->Tags)
+    {
+        bool isDuplicate = false;
+        for (const TagSlot& slot : entry.Tags)
+            isDuplicate |= slot.Value == tag;
+        if (isDuplicate)
+            continue;
+        auto& tagList = _tags[tag];
+        auto& slot = entry.Tags.AddOne();
+        slot.Value = tag;
+        slot.Index = tagList.Count();
+        tagList.Add(actor);
+    }
+
+    // Grid
+    AddToGrid(actor, entry);
+    actor->_isIndexDirty = 0;
+}
+
+void SceneActorsIndex::Remove(Actor* actor)
+{
+    ScopeLock lock(_locker);
+    Entry* entry = _entries.TryGet(actor);
+    if (!entry)
+        return;
+
+    // Skip removing from the dirty list (stale actors are ignored on flush)
+    actor->_isIndexDirty = 0;
+
+    // Type
+    auto& typeList = _types[actor->GetTypeHandle()];
+    RemoveSwap(typeList, entry->TypeIndex, [this](Actor* moved) -> int32&
+    {
+        return _entries[moved].TypeIndex;
+    });
+
+    // Tags
+    for (const TagSlot& slot : entry->Tags)
+    {
+        const Tag tag = slot.Value;
+        RemoveSwap(_tags[tag], slot.Index, [this, tag](Actor* moved) -> int32&
+        {
+            Entry& e = _entries[moved];
+            int32 i = 0;
+            while (e.Tags[i].Value != tag)
+                i++;
+            return e.Tags[i].Index;
+        });
+    }
+
+    // Grid
+    RemoveFromGrid(actor, *entry);
+
+    _entries.Remove(actor);
+}
+
+void SceneActorsIndex::MarkDirty(Actor* actor)
+{
+    if (actor->_isIndexDirty)
+        return;
+    ScopeLock lock(_locker);
+    if (_dirty.Count() >= _entries.Count() * 2 + 64)
+    {
+        // Prevent the stale actors from piling up when the index is not used
+        Flush();
+    }
+    actor->_isIndexDirty = 1;
+    _dirty.Add(actor);
+}
+
+void SceneActorsIndex::UpdateTags(Actor* actor)
+{
+    ScopeLock lock(_locker);
+    if (!_entries.ContainsKey(actor))
+        return;
+    const bool isDirty = actor->_isIndexDirty;
+    Remove(actor);
+    Add(actor);
+    if (isDirty)
+        MarkDirty(actor);
+}
+
+void SceneActorsIndex::Flush()
+{
+    if (_dirty.IsEmpty())
+        return;
+    PROFILE_CPU();
+    for (int32 i = 0; i < _dirty.Count(); i++)
+    {
+        Actor* actor = _dirty[i];
+        Entry* entry = _entries.TryGet(actor);
+        if (!entry || !actor->_isIndexDirty)
+            continue;
+        actor->_isIndexDirty = 0;
+        RemoveFromGrid(actor, *entry);
+        AddToGrid(actor, *entry);
+    }
+    _dirty.Clear();
+}
+
+void SceneActorsIndex::AddToGrid(Actor* actor, Entry& entry)
+{
+    const BoundingBox& box = actor->GetBox();
+    const Vector3 size = box.GetSize();
+    Array<Actor*>* list;
+    if (size.MaxValue() > SCENE_ACTORS_INDEX_CELL_SIZE)
+    {
+        entry.Cell = LARGE_CELL;
+        list = &_large;
+    }
+    else
+    {
+        entry.Cell = GetCell(box.GetCenter());
+        list = &_cells[entry.Cell];
+    }
+    entry.CellIndex = list->Count();
+    list->Add(actor);
+}
+
+void SceneActorsIndex::RemoveFromGrid(Actor* actor, Entry& entry)
+{
+    Array<Actor*>* list = entry.Cell == LARGE_CELL ? &_large : _cells.TryGet(entry.Cell);
+    ASSERT_LOW_LAYER(list && list->At(entry.CellIndex) == actor);
+    RemoveSwap(*list, entry.CellIndex, [this](Actor* moved) -> int32&
+    {
+        return _entries[moved].CellIndex;
+    });
+    if (list->IsEmpty() && entry.Cell != LARGE_CELL)
+        _cells.Remove(entry.Cell);
+}
+
+template<typename Filter>
+void SceneActorsIndex::QueryBounds(const BoundingBox& bounds, Array<Actor*>& result, const MClass* type, Filter filter)
+{
+    PROFILE_CPU();
+    ScopeLock lock(_locker);
+    Flush();
+    const auto test = [&](Actor* actor)
+    {
+        if (filter(actor) && (!type || Actor::IsSubClassOf(actor, type)))
+            result.Add(actor);
+    };
+
+    // Large actors
+    for (int32 i = 0; i < _large.Count(); i++)
+        test(_large[i]);
+
+    // Grid cells (expanded by the half of the cell since actors are placed in a cell by their center)
+    const Real extent = SCENE_ACTORS_INDEX_CELL_SIZE * 0.5f;
+    const Vector3 min = (bounds.Minimum - extent) / SCENE_ACTORS_INDEX_CELL_SIZE;
+    const Vector3 max = (bounds.Maximum + extent) / SCENE_ACTORS_INDEX_CELL_SIZE;
+    const auto toCell = [](Real value)
+    {
+        return (int32)Math::Clamp(Math::Floor(value), (Real)-0x100000, (Real)0xFFFFF);
+    };
+    const Int3 minCell(toCell(min.X), toCell(min.Y), toCell(min.Z));
+    const Int3 maxCell(toCell(max.X), toCell(max.Y), toCell(max.Z));
+    const int64 cellsCount = (int64)(maxCell.X - minCell.X + 1) * (maxCell.Y - minCell.Y + 1) * (maxCell.Z - minCell.Z + 1);
+    if (cellsCount > _cells.Count())
+    {
+        // Query covers more cells than used so iterate over all of them
+        for (auto& e : _cells)
+        {
+            const Array<Actor*>& list = e.Value;
+            for (int32 i = 0; i < list.Count(); i++)
+                test(list[i]);
+        }
+        return;
+    }
+    for (int32 z = minCell.Z; z <= maxCell.Z; z++)
+    {
+        for (int32 y = minCell.Y; y <= maxCell.Y; y++)
+        {
+            for (int32 x = minCell.X; x <= maxCell.X; x++)
+            {
+                const Array<Actor*>* list = _cells.TryGet(GetCell(Vector3(x, y, z) * SCENE_ACTORS_INDEX_CELL_SIZE + extent));
+                if (!list)
+                    continue;
+                for (int32 i = 0; i < list->Count(); i++)
+                    test(list->At(i));
+            }
+        }
+    }
+}
+
+int64 SceneActorsIndex::GetCell(const Vector3& position)
+{
+    const Vector3 cell = position / SCENE_ACTORS_INDEX_CELL_SIZE;
+    const int64 x = (int64)Math::Floor(cell.X) & 0x1FFFFF;
+    const int64 y = (int64)Math::Floor(cell.Y) & 0x1FFFFF;
+    const int64 z = (int64)Math::Floor(cell.Z) & 0x1FFFFF;
+    return (x << 42) | (y << 21) | z;
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Level/Types.h"
+#include "Engine/Level/Tags.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+// The size of the single cell of the actors spatial index grid (in world units). Actors larger than the cell are stored in a separate list and tested against every query.
+#define SCENE_ACTORS_INDEX_CELL_SIZE 2000.0f
+
+class MClass;
+class SceneRendering;
+
+/// <summary>
+/// Scene actors lookup helper subsystem that maintains the spatial index of the enabled actors bounds (loose grid) and the registries of the actors per type and per tag.
+/// </summary>
+/// <remarks>
+/// Actors are registered when enabled and unregistered when disabled. Transformation and bounds changes only mark the actor as dirty and the grid is updated lazily on the next query. Each actor is placed in the single grid cell that contains its bounds center (actors up to the cell size fit into the neighbour cells so queries are expanded by the half of the cell size).
+/// </remarks>
+class FLAXENGINE_API SceneActorsIndex
+{
+    friend Actor;
+    friend SceneRendering;
+
+private:
+    struct TagSlot
+    {
+        Tag Value;
+        int32 Index;
+    };
+
+    struct Entry
+    {
+        int64 Cell;
+        int32 CellIndex;
+        int32 TypeIndex;
+        Array<TagSlot, InlinedAllocation<2>> Tags;
+    };
+
+    CriticalSection _locker;
+    Dictionary<Actor*, Entry> _entries;
+    Dictionary<int64, Array<Actor*>> _cells;
+    Array<Actor*> _large;
+    Array<Actor*> _dirty;
+    Dictionary<ScriptingTypeHandle, Array<Actor*>> _types;
+    Dictionary<Tag, Array<Actor*>> _tags;
+
+public:
+    /// <summary>
+    /// Gets the amount of the registered actors.
+    /// </summary>
+    FORCE_INLINE int32 GetActorsCount() const
+    {
+        return _entries.Count();
+    }
+
+    /// <summary>
+    /// Gets the registered actors with the given tag (exact match). Appends them to the output.
+    /// </summary>
+    /// <param name="tag">The tag.</param>
+    /// <param name="result">The output actors.</param>
+    void GetActors(const Tag& tag, Array<Actor*>& result);
+
+    /// <summary>
+    /// Gets the first registered actor with the given tag (exact match).
+    /// </summary>
+    /// <param name="tag">The tag.</param>
+    /// <returns>The found actor or null.</returns>
+    Actor* GetActor(const Tag& tag);
+
+    /// <summary>
+    /// Gets the registered actors of the given type (including the derived types). Appends them to the output.
+    /// </summary>
+    /// <param name="type">The actors type.</param>
+    /// <param name="result">The output actors.</param>
+    void GetActors(const MClass* type, Array<Actor*>& result);
+
+    /// <summary>
+    /// Finds the registered actors which bounds intersect with the given box. Appends them to the output.
+    /// </summary>
+    /// <param name="box">The bounding box to test.</param>
+    /// <param name="result">The output actors.</param>
+    /// <param name="type">The actors type filter (including the derived types). Optional.</param>
+    void Query(const BoundingBox& box, Array<Actor*>& result, const MClass* type = nullptr);
+
+    /// <summary>
+    /// Finds the registered actors which bounds intersect with the given sphere. Appends them to the output.
+    /// </summary>
+    /// <param name="sphere">The bounding sphere to test.</param>
+    /// <param name="result">The output actors.</param>
+    /// <param name="type">The actors type filter (including the derived types). Optional.</param>
+    void Query(const BoundingSphere& sphere, Array<Actor*>& result, const MClass* type = nullptr);
+
+    /// <summary>
+    /// Finds the registered actors which bounds intersect with the given frustum. Appends them to the output.
+    /// </summary>
+    /// <param name="frustum">The frustum to test.</param>
+    /// <param name="result">The output actors.</param>
+    /// <param name="type">The actors type filter (including the derived types). Optional.</param>
+    void Query(const BoundingFrustum& frustum, Array<Actor*>& result, const MClass* type = nullptr);
+
+private:
+    void Add(Actor* actor);
+    void Remove(Actor* actor);
+    void MarkDirty(Actor* actor);
+    void UpdateTags(Actor* actor);
+    void Flush();
+    void AddToGrid(Actor* actor, Entry& entry);
+    void RemoveFromGrid(Actor* actor, Entry& entry);
+    template<typename Filter>
+    void QueryBounds(const BoundingBox& bounds, Array<Actor*>& result, const MClass* type, Filter filter);
+    static int64 GetCell(const Vector3& position);
+};
@@ -2,10 +2,20 @@
 
 #define SCENE_RENDERING_USE_PROFILER_PER_ACTOR 0
 
+// The amount of actors picked at once by the draw job (culled together with a batched frustum test)
+#define SCENE_RENDERING_BATCH_SIZE 64
+
+// The minimum amount of actors in the draw list to use the octree for culling (smaller lists are culled linearly)
+#define SCENE_RENDERING_OCTREE_MIN_ACTORS 1024
+
 #include "SceneRendering.h"
+#include "Scene.h"
+#include "Engine/Content/Asset.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/OcclusionCullingPass.h"
 #include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -27,18 +37,6 @@ void ISceneRenderingListener::ListenSceneRendering(SceneRendering* scene)
     }
 }
 
-FORCE_INLINE bool FrustumsListCull(const BoundingSphere& bounds, const Array<BoundingFrustum>& frustums)
-{
-    const int32 count = frustums.Count();
-    const BoundingFrustum* data = frustums.Get();
-    for (int32 i = 0; i < count; i++)
-    {
-        if (data[i].Intersects(bounds))
-            return true;
-    }
-    return false;
-}
-
 void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory category)
 {
     ScopeLock lock(Locker);
@@ -60,6 +58,7 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
     auto& list = Actors[(int32)category];
     _drawListData = list.Get();
     _drawListSize = list.Count();
+    _drawListKeysData = nullptr;
     _drawBatch = &renderContextBatch;
 
     // Setup frustum data
@@ -68,14 +67,36 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
     for (int32 i = 0; i < frustumsCount; i++)
         _drawFrustumsData.Get()[i] = renderContextBatch.Contexts.Get()[i].View.CullingFrustum;
 
+    // Use the main view visibility from the shared culling pass
+    const int32 sharedView = FindSharedView(renderContextBatch, category);
+    _drawSharedVisibility = nullptr;
+    if (sharedView != -1)
+    {
+        _drawSharedVisibility = _sharedVisibility[(int32)category].Get();
+        _drawSharedVisibilityCount = _sharedVisibility[(int32)category].Count();
+        _drawSharedViewMask = 1u << sharedView;
+    }
+
+#if SCENE_RENDERING_USE_OCTREE
+    if (_drawListSize >= SCENE_RENDERING_OCTREE_MIN_ACTORS && !(_drawSharedVisibility && frustumsCount == 1))
+    {
+        // Skip the whole octree nodes outside all frustums
+        PROFILE_CPU_NAMED("Octree");
+        _drawListKeys.Clear();
+        _octrees[(int32)category].Query(_drawFrustumsData.Get(), frustumsCount, view.Origin, _drawListKeys);
+        _drawListKeysData = _drawListKeys.Get();
+        _drawListSize = _drawListKeys.Count();
+    }
+#endif
+
     // Draw all visual components
-    _drawListIndex = -1;
+    _drawListIndex = 0;
     if (_drawListSize >= 64 && category == SceneDrawAsync && renderContextBatch.EnableAsync)
     {
         // Run in async via Job System
         Function<void(int32)> func;
         func.Bind<SceneRendering, &SceneRendering::DrawActorsJob>(this);
-        const uint64 waitLabel = JobSystem::Dispatch(func, JobSystem::GetThreadsCount());
+        const uint64 waitLabel = JobSystem::Dispatch(func, JobSystem::GetThreadsCount(), JobPriority::Critical);
         renderContextBatch.WaitLabels.Add(waitLabel);
     }
     else
@@ -100,6 +121,46 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
 #endif
 }
 
+void SceneRendering::CullSharedViews(const Span<SceneRenderingView>& views)
+{
+    PROFILE_CPU();
+    ScopeLock lock(Locker);
+    const int32 viewsCount = Math::Min(views.Length(), SCENE_RENDERING_MAX_SHARED_VIEWS);
+    _sharedViews.Set(views.Get(), viewsCount);
+    _sharedViewsFrame = Engine::FrameCount;
+    BoundingSphere bounds[SCENE_RENDERING_BATCH_SIZE];
+    bool visible[SCENE_RENDERING_BATCH_SIZE];
+    for (int32 category = SceneDraw; category <= SceneDrawAsync; category++)
+    {
+        const auto& list = Actors[category];
+        auto& visibility = _sharedVisibility[category];
+        visibility.Resize(list.Count(), false);
+        uint32* visibilityData = visibility.Get();
+        for (int32 start = 0; start < list.Count(); start += SCENE_RENDERING_BATCH_SIZE)
+        {
+            // Cull the batch of actors against each view and build the per-view visibility masks
+            const int32 batchSize = Math::Min(list.Count() - start, SCENE_RENDERING_BATCH_SIZE);
+            Platform::MemoryClear(visibilityData + start, batchSize * sizeof(uint32));
+            for (int32 viewIndex = 0; viewIndex < viewsCount; viewIndex++)
+            {
+                const SceneRenderingView& view = views[viewIndex];
+                for (int32 i = 0; i < batchSize; i++)
+                {
+                    bounds[i] = list.Get()[start + i].Bounds;
+                    bounds[i].Center -= view.Origin;
+                }
+                BoundingFrustum::Intersects(&view.Frustum, 1, bounds, batchSize, visible);
+                const uint32 viewMask = 1u << viewIndex;
+                for (int32 i = 0; i < batchSize; i++)
+                {
+                    if (visible[i])
+                        visibilityData[start + i] |= viewMask;
+                }
+            }
+        }
+    }
+}
+
 void SceneRendering::CollectPostFxVolumes(RenderContext& renderContext)
 {
 #if SCENE_RENDERING_USE_PROFILER
@@ -122,6 +183,13 @@ void SceneRendering::Clear()
     _listeners.Clear();
     for (auto& e : Actors)
         e.Clear();
+#if SCENE_RENDERING_USE_OCTREE
+    for (auto& e : _octrees)
+        e.Clear();
+#endif
+    for (auto& e : _sharedVisibility)
+        e.Clear();
+    _sharedViewsFrame = 0;
 #if USE_EDITOR
     PhysicsDebug.Clear();
 #endif
@@ -148,6 +216,10 @@ void SceneRendering::AddActor(Actor* a, int32& key)
     e.LayerMask = a->GetLayerMask();
     e.Bounds = a->GetSphere();
     e.NoCulling = a->_drawNoCulling;
+#if SCENE_RENDERING_USE_OCTREE
+    _octrees[category].Add(key, e.Bounds, e.NoCulling);
+#endif
+    InvalidateSharedVisibility(category, key);
     for (auto* listener : _listeners)
         listener->OnSceneRenderingAddActor(a);
 }
@@ -165,6 +237,12 @@ void SceneRendering::UpdateActor(Actor* a, int32& key)
         listener->OnSceneRenderingUpdateActor(a, e.Bounds);
     e.LayerMask = a->GetLayerMask();
     e.Bounds = a->GetSphere();
+#if SCENE_RENDERING_USE_OCTREE
+    _octrees[category].Update(key, e.Bounds);
+#endif
+    InvalidateSharedVisibility(category, key);
+    if (a->_isEnabled && a->_parent)
+        a->_scene->ActorsIndex.MarkDirty(a);
 }
 
 void SceneRendering::RemoveActor(Actor* a, int32& key)
@@ -180,13 +258,48 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
             listener->OnSceneRenderingRemoveActor(a);
         e.Actor = nullptr;
         e.LayerMask = 0;
+#if SCENE_RENDERING_USE_OCTREE
+        _octrees[category].Remove(key);
+#endif
     }
     key = -1;
 }
 
-#define FOR_EACH_BATCH_ACTOR const int64 count = _drawListSize; while (true) { const int64 index = Platform::InterlockedIncrement(&_drawListIndex); if (index >= count) break; auto e = _drawListData[index];
-#define CHECK_ACTOR ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || FrustumsListCull(e.Bounds, _drawFrustumsData)))
-#define CHECK_ACTOR_SINGLE_FRUSTUM ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || view.CullingFrustum.Intersects(e.Bounds)))
+int32 SceneRendering::FindSharedView(const RenderContextBatch& renderContextBatch, DrawCategory category) const
+{
+    if (_sharedViewsFrame != Engine::FrameCount || (category != SceneDraw && category != SceneDrawAsync))
+        return -1;
+    const RenderContext& mainContext = renderContextBatch.GetMainContext();
+    const RenderView& view = mainContext.View;
+    if (view.IsOfflinePass || !(view.CullingFrustum == view.Frustum))
+        return -1;
+    for (int32 i = 0; i < _sharedViews.Count(); i++)
+    {
+        const SceneRenderingView& e = _sharedViews.Get()[i];
+        if (e.Task == mainContext.Task && e.View == view.View && e.Projection == view.NonJitteredProjection && e.Origin == view.Origin)
+            return i;
+    }
+    return -1;
+}
+
+void SceneRendering::InvalidateSharedVisibility(int32 category, int32 key)
+{
+    // Actors changed after the shared culling pass are treated as visible in all views
+    if (_sharedViewsFrame == Engine::FrameCount && key < _sharedVisibility[category].Count())
+        _sharedVisibility[category].Get()[key] = MAX_uint32;
+}
+
+bool SceneRendering::IntersectsShadowFrustums(const BoundingSphere& bounds) const
+{
+    // Actors hidden in the main view can still cast visible shadows
+    for (int32 i = 1; i < _drawFrustumsData.Count(); i++)
+    {
+        if (_drawFrustumsData.Get()[i].Intersects(bounds))
+            return true;
+    }
+    return false;
+}
+
 #if SCENE_RENDERING_USE_PROFILER_PER_ACTOR
 #define DRAW_ACTOR(mode) PROFILE_CPU_ACTOR(e.Actor); e.Actor->Draw(mode)
 #else
@@ -196,45 +309,81 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
 void SceneRendering::DrawActorsJob(int32)
 {
     PROFILE_CPU();
+    AssetReferencesBatch referencesBatch;
     auto& mainContext = _drawBatch->GetMainContext();
     const auto& view = mainContext.View;
-    if (view.IsOfflinePass)
+    const bool useOrigin = view.IsOfflinePass || !view.Origin.IsZero();
+    const bool singleContext = !useOrigin && _drawFrustumsData.Count() == 1;
+    const OcclusionCullingData* occlusionCulling = EnumHasAnyFlags(view.Pass, DrawPass::GBuffer) ? mainContext.List->OcclusionCulling : nullptr;
+    BoundingSphere bounds[SCENE_RENDERING_BATCH_SIZE];
+    bool visible[SCENE_RENDERING_BATCH_SIZE];
+    const DrawActor* batch[SCENE_RENDERING_BATCH_SIZE];
+    const int64 count = _drawListSize;
+    while (true)
     {
-        // Offline pass with additional static flags culling
-        FOR_EACH_BATCH_ACTOR
-            e.Bounds.Center -= view.Origin;
-            if (CHECK_ACTOR && (e.Actor->GetStaticFlags() & view.StaticFlagsMask) != StaticFlags::None)
+        // Pick the next batch of actors
+        const int64 start = Platform::InterlockedAdd(&_drawListIndex, SCENE_RENDERING_BATCH_SIZE);
+        if (start >= count)
+            break;
+        const int32 batchSize = (int32)Math::Min<int64>(count - start, SCENE_RENDERING_BATCH_SIZE);
+        if (_drawListKeysData)
+        {
+            // Actors picked by the octree
+            for (int32 i = 0; i < batchSize; i++)
+                batch[i] = _drawListData + _drawListKeysData[start + i];
+        }
+        else
+        {
+            for (int32 i = 0; i < batchSize; i++)
+                batch[i] = _drawListData + start + i;
+        }
+
+        // Cull the whole batch against all frustums at once
+        for (int32 i = 0; i < batchSize; i++)
+        {
+            bounds[i] = batch[i]->Bounds;
+            if (useOrigin)
+                bounds[i].Center -= view.Origin;
+        }
+        if (_drawSharedVisibility)
+        {
+            // Main view visibility comes from the shared culling pass so test only the shadow frustums
+            if (_drawFrustumsData.Count() > 1)
+                BoundingFrustum::Intersects(_drawFrustumsData.Get() + 1, _drawFrustumsData.Count() - 1, bounds, batchSize, visible);
+            else
+                Platform::MemoryClear(visible, batchSize * sizeof(bool));
+            for (int32 i = 0; i < batchSize; i++)
             {
-                DRAW_ACTOR(*_drawBatch);
+                const int32 key = (int32)(batch[i] - _drawListData);
+                visible[i] |= key >= _drawSharedVisibilityCount || (_drawSharedVisibility[key] & _drawSharedViewMask) != 0;
             }
         }
-    }
-    else if (view.Origin.IsZero() && _drawFrustumsData.Count() == 1)
-    {
-        // Fast path for no origin shifting with a single context
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR_SINGLE_FRUSTUM)
+        else
+        {
+            BoundingFrustum::Intersects(_drawFrustumsData.Get(), _drawFrustumsData.Count(), bounds, batchSize, visible);
+        }
+
+        for (int32 i = 0; i < batchSize; i++)
+        {
+            const DrawActor& e = *batch[i];
+            if (!(view.RenderLayersMask.Mask & e.LayerMask) || !(e.NoCulling || visible[i]))
+                continue;
+            if (occlusionCulling && !e.NoCulling && occlusionCulling->IsOccluded(bounds[i]) && !IntersectsShadowFrustums(bounds[i]))
+                continue;
+            if (view.IsOfflinePass)
             {
-                DRAW_ACTOR(mainContext);
+                // Offline pass with additional static flags culling
+                if ((e.Actor->GetStaticFlags() & view.StaticFlagsMask) != StaticFlags::None)
+                {
+                    DRAW_ACTOR(*_drawBatch);
+                }
             }
-        }
-    }
-    else if (view.Origin.IsZero())
-    {
-        // Fast path for no origin shifting
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR)
+            else if (singleContext)
             {
-                DRAW_ACTOR(*_drawBatch);
+                // Fast path for no origin shifting with a single context
+                DRAW_ACTOR(mainContext);
             }
-        }
-    }
-    else
-    {
-        // Generic case
-        FOR_EACH_BATCH_ACTOR
-            e.Bounds.Center -= view.Origin;
-            if (CHECK_ACTOR)
+            else
             {
                 DRAW_ACTOR(*_drawBatch);
             }
@@ -242,6 +391,4 @@ void SceneRendering::DrawActorsJob(int32)
     }
 }
 
-#undef FOR_EACH_BATCH_ACTOR
-#undef CHECK_ACTOR
 #undef DRAW_ACTOR
@@ -4,10 +4,18 @@
 
 #include "Engine/Core/Delegate.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Core/Math/BoundingSphere.h"
 #include "Engine/Core/Math/BoundingFrustum.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "SceneRenderingOctree.h"
+
+// Enables using the loose octree over the scene actors to cull whole groups of actors at once (for large scenes)
+#define SCENE_RENDERING_USE_OCTREE 1
+
+// The maximum amount of views culled at once by the shared culling pass (see SceneRendering::CullSharedViews)
+#define SCENE_RENDERING_MAX_SHARED_VIEWS 32
 
 class SceneRenderTask;
 class SceneRendering;
@@ -16,6 +24,20 @@ struct RenderContext;
 struct RenderContextBatch;
 struct RenderView;
 
+/// <summary>
+/// The main view of the scene rendering task culled by the shared culling pass (see SceneRendering::CullSharedViews).
+/// </summary>
+struct SceneRenderingView
+{
+    SceneRenderTask* Task;
+    Matrix View;
+    Matrix Projection;
+    Vector3 Origin;
+
+    // The conservative culling frustum (extended to cover the temporal anti-aliasing jitter).
+    BoundingFrustum Frustum;
+};
+
 /// <summary>
 /// Interface for actors that can override the default rendering settings (eg. PostFxVolume actor).
 /// </summary>
@@ -110,6 +132,12 @@ class FLAXENGINE_API SceneRendering
     /// <param name="category">The actors category to draw.</param>
     void Draw(RenderContextBatch& renderContextBatch, DrawCategory category = SceneDraw);
 
+    /// <summary>
+    /// Culls the scene actors against the main views of many scene rendering tasks at once and caches the per-view visibility masks. The scene drawing for those views in the current frame uses the cached visibility instead of culling the actors against the view again.
+    /// </summary>
+    /// <param name="views">The views to cull (up to SCENE_RENDERING_MAX_SHARED_VIEWS).</param>
+    void CullSharedViews(const Span<SceneRenderingView>& views);
+
     /// <summary>
     /// Collects the post fx volumes for the given rendering view.
     /// </summary>
@@ -166,10 +194,25 @@ class FLAXENGINE_API SceneRendering
 
 private:
     Array<BoundingFrustum> _drawFrustumsData;
+#if SCENE_RENDERING_USE_OCTREE
+    SceneRenderingOctree _octrees[MAX];
+    Array<int32> _drawListKeys;
+#endif
+    const int32* _drawListKeysData;
     DrawActor* _drawListData;
     int64 _drawListSize;
     volatile int64 _drawListIndex;
     RenderContextBatch* _drawBatch;
+    Array<SceneRenderingView> _sharedViews;
+    Array<uint32> _sharedVisibility[MAX];
+    uint64 _sharedViewsFrame = 0;
+    const uint32* _drawSharedVisibility;
+    int32 _drawSharedVisibilityCount;
+    uint32 _drawSharedViewMask;
+
+    int32 FindSharedView(const RenderContextBatch& renderContextBatch, DrawCategory category) const;
+    void InvalidateSharedVisibility(int32 category, int32 key);
 
+    bool IntersectsShadowFrustums(const BoundingSphere& bounds) const;
     void DrawActorsJob(int32);
 };
@@ -0,0 +1,203 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "SceneRenderingOctree.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+
+// The half-size of the octree root node (in world units). Actors outside it are not culled hierarchically.
+#define SCENE_RENDERING_OCTREE_SIZE 1048576.0
+
+// The maximum depth of the octree
+#define SCENE_RENDERING_OCTREE_MAX_DEPTH 12
+
+// The amount of nodes culled together with a batched frustum test
+#define SCENE_RENDERING_OCTREE_BATCH_SIZE 64
+
+namespace
+{
+    constexpr int32 NoNode = -1;
+    constexpr int32 UnboundedNode = -2;
+    constexpr int32 NoCullingNode = -3;
+
+    FORCE_INLINE bool FitsNode(const Vector3& nodeCenter, Real nodeHalfSize, int32 nodeDepth, const BoundingSphere& bounds)
+    {
+        // Loose octree node holds objects with center inside the node cell and radius that doesn't fit into the child node
+        if (bounds.Radius > nodeHalfSize || (nodeDepth < SCENE_RENDERING_OCTREE_MAX_DEPTH && bounds.Radius <= nodeHalfSize * 0.5f))
+            return false;
+        const Vector3 offset = Vector3::Abs(bounds.Center - nodeCenter);
+        return offset.X <= nodeHalfSize && offset.Y <= nodeHalfSize && offset.Z <= nodeHalfSize;
+    }
+}
+
+void SceneRenderingOctree::Add(int32 key, const BoundingSphere& bounds, bool noCulling)
+{
+    if (key >= _actorNodes.Count())
+    {
+        const int32 start = _actorNodes.Count();
+        _actorNodes.Resize(key + 1);
+        for (int32 i = start; i < _actorNodes.Count(); i++)
+            _actorNodes.Get()[i] = NoNode;
+    }
+    ASSERT_LOW_LAYER(_actorNodes[key] == NoNode);
+    if (noCulling)
+    {
+        _actorNodes[key] = NoCullingNode;
+        _unbounded.Add(key);
+        return;
+    }
+    Insert(key, bounds);
+}
+
+void SceneRenderingOctree::Update(int32 key, const BoundingSphere& bounds)
+{
+    const int32 nodeIndex = key < _actorNodes.Count() ? _actorNodes.Get()[key] : NoNode;
+    if (nodeIndex == NoNode || nodeIndex == NoCullingNode)
+        return;
+    if (nodeIndex != UnboundedNode)
+    {
+        const Node& node = _nodes.Get()[nodeIndex];
+        if (FitsNode(node.Center, node.HalfSize, node.Depth, bounds))
+            return;
+    }
+    Remove(key);
+    Insert(key, bounds);
+}
+
+void SceneRenderingOctree::Remove(int32 key)
+{
+    if (key >= _actorNodes.Count())
+        return;
+    int32 nodeIndex = _actorNodes.Get()[key];
+    _actorNodes.Get()[key] = NoNode;
+    if (nodeIndex == UnboundedNode || nodeIndex == NoCullingNode)
+    {
+        _unbounded.Remove(key);
+        return;
+    }
+    if (nodeIndex == NoNode)
+        return;
+    _nodes.Get()[nodeIndex].Keys.Remove(key);
+    while (nodeIndex != NoNode)
+    {
+        Node& node = _nodes.Get()[nodeIndex];
+        node.Count--;
+        nodeIndex = node.Parent;
+    }
+}
+
+void SceneRenderingOctree::Clear()
+{
+    _nodes.Clear();
+    _actorNodes.Clear();
+    _unbounded.Clear();
+}
+
+void SceneRenderingOctree::Query(const BoundingFrustum* frustums, int32 frustumsCount, const Vector3& origin, Array<int32>& keys) const
+{
+    keys.Add(_unbounded);
+    if (_nodes.IsEmpty() || _nodes[0].Count == 0)
+        return;
+    int32 stack[SCENE_RENDERING_OCTREE_BATCH_SIZE * 8 + 8];
+    int32 stackSize = 0;
+    stack[stackSize++] = 0;
+    int32 batch[SCENE_RENDERING_OCTREE_BATCH_SIZE];
+    BoundingSphere bounds[SCENE_RENDERING_OCTREE_BATCH_SIZE];
+    bool visible[SCENE_RENDERING_OCTREE_BATCH_SIZE];
+    Array<int32> pending;
+    const Node* nodes = _nodes.Get();
+    while (stackSize != 0 || pending.HasItems())
+    {
+        // Refill the stack from the pending nodes
+        while (stackSize < SCENE_RENDERING_OCTREE_BATCH_SIZE && pending.HasItems())
+        {
+            stack[stackSize++] = pending.Last();
+            pending.RemoveLast();
+        }
+
+        // Pick the next batch of nodes
+        const int32 batchSize = Math::Min(stackSize, SCENE_RENDERING_OCTREE_BATCH_SIZE);
+        for (int32 i = 0; i < batchSize; i++)
+        {
+            const int32 nodeIndex = stack[--stackSize];
+            const Node& node = nodes[nodeIndex];
+            batch[i] = nodeIndex;
+            bounds[i] = BoundingSphere(node.Center - origin, node.HalfSize * 2.0f * Math::Sqrt(3.0f));
+        }
+
+        // Cull the whole batch against all frustums at once
+        BoundingFrustum::Intersects(frustums, frustumsCount, bounds, batchSize, visible);
+
+        for (int32 i = 0; i < batchSize; i++)
+        {
+            if (!visible[i])
+                continue;
+            const Node& node = nodes[batch[i]];
+            keys.Add(node.Keys);
+            for (int32 childIndex : node.Children)
+            {
+                if (childIndex != NoNode && nodes[childIndex].Count != 0)
+                {
+                    if (stackSize < ARRAY_COUNT(stack))
+                        stack[stackSize++] = childIndex;
+                    else
+                        pending.Add(childIndex);
+                }
+            }
+        }
+    }
+}
+
+void SceneRenderingOctree::Insert(int32 key, const BoundingSphere& bounds)
+{
+    // Objects outside the root node are always tested individually
+    const Vector3 offset = Vector3::Abs(bounds.Center);
+    if (bounds.Radius > SCENE_RENDERING_OCTREE_SIZE || Math::Max(offset.X, offset.Y, offset.Z) > SCENE_RENDERING_OCTREE_SIZE)
+    {
+        _actorNodes[key] = UnboundedNode;
+        _unbounded.Add(key);
+        return;
+    }
+
+    // Create the root node
+    if (_nodes.IsEmpty())
+    {
+        Node& root = _nodes.AddOne();
+        root.Center = Vector3::Zero;
+        root.HalfSize = SCENE_RENDERING_OCTREE_SIZE;
+        root.Parent = NoNode;
+        root.Depth = 0;
+        root.Count = 0;
+        for (int32& childIndex : root.Children)
+            childIndex = NoNode;
+    }
+
+    // Go down the tree to the smallest node that fits the object
+    int32 nodeIndex = 0;
+    while (true)
+    {
+        Node* node = &_nodes.Get()[nodeIndex];
+        node->Count++;
+        const Real childHalfSize = node->HalfSize * 0.5f;
+        if (node->Depth >= SCENE_RENDERING_OCTREE_MAX_DEPTH || bounds.Radius > childHalfSize)
+            break;
+        const int32 childSlot = (bounds.Center.X >= node->Center.X ? 1 : 0) | (bounds.Center.Y >= node->Center.Y ? 2 : 0) | (bounds.Center.Z >= node->Center.Z ? 4 : 0);
+        int32 childIndex = node->Children[childSlot];
+        if (childIndex == NoNode)
+        {
+            childIndex = _nodes.Count();
+            node->Children[childSlot] = childIndex;
+            const Vector3 childCenter = node->Center + Vector3(childSlot & 1 ? childHalfSize : -childHalfSize, childSlot & 2 ? childHalfSize : -childHalfSize, childSlot & 4 ? childHalfSize : -childHalfSize);
+            const int32 childDepth = node->Depth + 1;
+            Node& child = _nodes.AddOne(); // Note: invalidates the node pointer
+            child.Center = childCenter;
+            child.HalfSize = childHalfSize;
+            child.Parent = nodeIndex;
+            child.Depth = childDepth;
+            child.Count = 0;
+            for (int32& e : child.Children)
+                e = NoNode;
+        }
+        nodeIndex = childIndex;
+    }
+    _nodes.Get()[nodeIndex].Keys.Add(key);
+    _actorNodes[key] = nodeIndex;
+}
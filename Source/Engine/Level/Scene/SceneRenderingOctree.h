@@ -0,0 +1,69 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+
+struct BoundingFrustum;
+
+/// <summary>
+/// Loose octree over the scene rendering actors (indexed by the actor key in the draw list). Used to cull the whole subtrees of the actors against all frustums of the render batch at once.
+/// </summary>
+class FLAXENGINE_API SceneRenderingOctree
+{
+private:
+    struct Node
+    {
+        Vector3 Center;
+        Real HalfSize;
+        int32 Parent;
+        int32 Depth;
+        int32 Count;
+        int32 Children[8];
+        Array<int32> Keys;
+    };
+
+    Array<Node> _nodes;
+    Array<int32> _actorNodes;
+    Array<int32> _unbounded;
+
+public:
+    /// <summary>
+    /// Adds the actor to the tree.
+    /// </summary>
+    /// <param name="key">The actor key (index in the draw list).</param>
+    /// <param name="bounds">The actor bounds.</param>
+    /// <param name="noCulling">True if actor is not culled (always included in the query results).</param>
+    void Add(int32 key, const BoundingSphere& bounds, bool noCulling);
+
+    /// <summary>
+    /// Updates the actor bounds in the tree (moves it to a different node only if it doesn't fit the current one).
+    /// </summary>
+    /// <param name="key">The actor key (index in the draw list).</param>
+    /// <param name="bounds">The actor bounds.</param>
+    void Update(int32 key, const BoundingSphere& bounds);
+
+    /// <summary>
+    /// Removes the actor from the tree.
+    /// </summary>
+    /// <param name="key">The actor key (index in the draw list).</param>
+    void Remove(int32 key);
+
+    /// <summary>
+    /// Clears the tree.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Collects the keys of the actors from the tree nodes that intersect with any of the frustums. Actors still need to be culled individually, but the whole subtrees outside all frustums are skipped.
+    /// </summary>
+    /// <param name="frustums">The frustums (relative to the origin).</param>
+    /// <param name="frustumsCount">The frustums count.</param>
+    /// <param name="origin">The origin of the frustums (in world-space).</param>
+    /// <param name="keys">The output keys of the potentially visible actors.</param>
+    void Query(const BoundingFrustum* frustums, int32 frustumsCount, const Vector3& origin, Array<int32>& keys) const;
+
+private:
+    void Insert(int32 key, const BoundingSphere& bounds);
+};
@@ -2,7 +2,106 @@
 
 #include "SceneTicking.h"
 #include "Scene.h"
+#include "Engine/Core/Delegate.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Level/Actors/Camera.h"
 #include "Engine/Scripting/Script.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#if USE_CSHARP
+#include "Engine/Scripting/ManagedCLR/MClass.h"
+#include "Engine/Scripting/ManagedCLR/MMethod.h"
+#include "Engine/Debug/DebugLog.h"
+#endif
+
+namespace
+{
+    CriticalSection DeferredLocker;
+    Array<Function<void()>> DeferredActions;
+    Array<Vector3> Viewers;
+
+    // Script tick functions (must match Script.Internal_TickScripts in C#)
+    enum class ManagedTick
+    {
+        Update = 0,
+        LateUpdate = 1,
+        FixedUpdate = 2,
+        LateFixedUpdate = 3,
+    };
+
+    // Collects the C# scripts to tick them by a single managed call
+    struct ManagedScriptsBatch
+    {
+#if USE_NETCORE
+        typedef void (*Thunk)(MObject** scripts, int32 count, int32 tick);
+
+        Thunk TickThunk;
+        ManagedTick Tick;
+        int32 Count = 0;
+        MObject* Scripts[SCENE_TICKING_PARALLEL_BATCH_SIZE];
+
+        ManagedScriptsBatch(ManagedTick tick)
+            : Tick(tick)
+        {
+            // C# Script class is never hot-reloaded so the method pointer can be cached
+            static Thunk CachedTickThunk = nullptr;
+            if (!CachedTickThunk && SceneTicking::BatchManagedScripts)
+            {
+                const MClass* mclass = Script::GetStaticClass();
+                MMethod* method = mclass ? mclass->GetMethod("Internal_TickScripts", 3) : nullptr;
+                if (method)
+                    CachedTickThunk = (Thunk)method->GetFunctionPointer();
+            }
+            TickThunk = SceneTicking::BatchManagedScripts ? CachedTickThunk : nullptr;
+        }
+
+        ~ManagedScriptsBatch()
+        {
+            Flush();
+        }
+
+        bool Add(Script* script)
+        {
+            if (!TickThunk)
+                return false;
+            MObject* instance = script->GetOrCreateManagedInstance();
+            if (!instance)
+                return false;
+            Scripts[Count++] = instance;
+            if (Count == SCENE_TICKING_PARALLEL_BATCH_SIZE)
+                Flush();
+            return true;
+        }
+
+        void Flush()
+        {
+            if (Count == 0)
+                return;
+            PROFILE_CPU_NAMED("Managed Scripts");
+            TickThunk(Scripts, Count, (int32)Tick);
+            Count = 0;
+        }
+#else
+        ManagedScriptsBatch(ManagedTick tick)
+        {
+        }
+
+        FORCE_INLINE bool Add(Script* script)
+        {
+            return false;
+        }
+
+        FORCE_INLINE void Flush()
+        {
+        }
+#endif
+    };
+}
+
+Array<Vector3> SceneTicking::ViewerLocations;
+float SceneTicking::RelevanceTickInterval = 0.25f;
+bool SceneTicking::BatchManagedScripts = true;
 
 SceneTicking::TickData::TickData(int32 capacity)
     : Scripts(capacity)
@@ -12,22 +111,49 @@ SceneTicking::TickData::TickData(int32 capacity)
 
 void SceneTicking::TickData::AddScript(Script* script)
 {
-    Scripts.Add(script);
+    const bool parallel = script->_tickParallel;
+    (parallel ? ScriptsParallel : Scripts).Add(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
-        ScriptsExecuteInEditor.Add(script);
+        (parallel ? ScriptsParallelExecuteInEditor : ScriptsExecuteInEditor).Add(script);
 #endif
 }
 
 void SceneTicking::TickData::RemoveScript(Script* script)
 {
-    Scripts.Remove(script);
+    const bool parallel = script->_tickParallel;
+    (parallel ? ScriptsParallel : Scripts).Remove(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
-        ScriptsExecuteInEditor.Remove(script);
+        (parallel ? ScriptsParallelExecuteInEditor : ScriptsExecuteInEditor).Remove(script);
 #endif
 }
 
+void SceneTicking::TickData::TickScriptsParallel(const Array<Script*>& scripts)
+{
+    const int32 count = scripts.Count();
+    if (count == 0)
+        return;
+    if (count <= SCENE_TICKING_PARALLEL_BATCH_SIZE)
+    {
+        // Too few scripts to split the work
+        TickScripts(ToSpan(scripts.Get(), count));
+    }
+    else
+    {
+        PROFILE_CPU_NAMED("Parallel Scripts");
+        Function<void(int32)> job = [this, &scripts, count](int32 i)
+        {
+            const int32 start = i * SCENE_TICKING_PARALLEL_BATCH_SIZE;
+            TickScripts(ToSpan(scripts.Get() + start, Math::Min(count - start, SCENE_TICKING_PARALLEL_BATCH_SIZE)));
+        };
+        JobSystem::Execute(job, Math::DivideAndRoundUp(count, SCENE_TICKING_PARALLEL_BATCH_SIZE));
+    }
+
+    // Apply the changes queued by the parallel scripts
+    FlushDeferred();
+}
+
 void SceneTicking::TickData::RemoveTick(void* callee)
 {
     for (int32 i = 0; i < Ticks.Count(); i++)
@@ -42,7 +168,8 @@ void SceneTicking::TickData::RemoveTick(void* callee)
 
 void SceneTicking::TickData::Tick()
 {
-    TickScripts(Scripts);
+    TickScripts(ToSpan(Scripts.Get(), Scripts.Count()));
+    TickScriptsParallel(ScriptsParallel);
 
     for (int32 i = 0; i < Ticks.Count(); i++)
         Ticks[i].Call();
@@ -64,7 +191,8 @@ void SceneTicking::TickData::RemoveTickExecuteInEditor(void* callee)
 
 void SceneTicking::TickData::TickExecuteInEditor()
 {
-    TickScripts(ScriptsExecuteInEditor);
+    TickScripts(ToSpan(ScriptsExecuteInEditor.Get(), ScriptsExecuteInEditor.Count()));
+    TickScriptsParallel(ScriptsParallelExecuteInEditor);
 
     for (int32 i = 0; i < TicksExecuteInEditor.Count(); i++)
         TicksExecuteInEditor[i].Call();
@@ -75,9 +203,11 @@ void SceneTicking::TickData::TickExecuteInEditor()
 void SceneTicking::TickData::Clear()
 {
     Scripts.Clear();
+    ScriptsParallel.Clear();
     Ticks.Clear();
 #if USE_EDITOR
     ScriptsExecuteInEditor.Clear();
+    ScriptsParallelExecuteInEditor.Clear();
     TicksExecuteInEditor.Clear();
 #endif
 }
@@ -87,10 +217,15 @@ SceneTicking::FixedUpdateTickData::FixedUpdateTickData()
 {
 }
 
-void SceneTicking::FixedUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::FixedUpdateTickData::TickScripts(const Span<Script*>& scripts)
 {
-    for (auto* script : scripts)
+    ManagedScriptsBatch batch(ManagedTick::FixedUpdate);
+    for (int32 i = 0; i < scripts.Length(); i++)
     {
+        Script* script = scripts[i];
+        if (script->_tickManaged && batch.Add(script))
+            continue;
+        batch.Flush();
         script->OnFixedUpdate();
     }
 }
@@ -100,23 +235,65 @@ SceneTicking::UpdateTickData::UpdateTickData()
 {
 }
 
-void SceneTicking::UpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::UpdateTickData::TickScripts(const Span<Script*>& scripts)
 {
-    for (auto* script : scripts)
+    const float deltaTime = Time::GetDeltaTime();
+    ManagedScriptsBatch batch(ManagedTick::Update);
+    for (int32 i = 0; i < scripts.Length(); i++)
     {
+        Script* script = scripts[i];
+        if ((script->TickInterval > 0.0f || script->TickRelevanceDistance > 0.0f) && Throttle(script, deltaTime))
+            continue;
+        if (script->_tickManaged && batch.Add(script))
+            continue;
+        batch.Flush();
         script->OnUpdate();
     }
 }
 
+bool SceneTicking::UpdateTickData::Throttle(Script* script, float deltaTime)
+{
+    // Calculate the update interval based on the distance to the nearest viewer
+    float interval = script->TickInterval;
+    if (script->TickRelevanceDistance > 0.0f && Viewers.HasItems() && script->GetParent())
+    {
+        const Vector3 position = script->GetParent()->GetPosition();
+        Real minDistanceSq = MAX_Real;
+        for (const Vector3& viewer : Viewers)
+            minDistanceSq = Math::Min(minDistanceSq, Vector3::DistanceSquared(position, viewer));
+        const float distance = (float)Math::Sqrt(minDistanceSq);
+        if (distance > script->TickRelevanceDistance)
+            interval = Math::Max(interval, RelevanceTickInterval * Math::Min(distance / script->TickRelevanceDistance, 4.0f));
+    }
+
+    // Accumulate time until the next update (the first update is staggered to spread the scripts with the same interval across frames)
+    if (script->_tickDeltaTime < 0.0f)
+    {
+        script->_tickAccumulatedTime = interval * (float)(script->GetID().D & 0xff) / 255.0f;
+        script->_tickDeltaTime = 0.0f;
+    }
+    script->_tickAccumulatedTime += deltaTime;
+    if (script->_tickAccumulatedTime < interval)
+        return true;
+    script->_tickDeltaTime = script->_tickAccumulatedTime;
+    script->_tickAccumulatedTime = 0.0f;
+    return false;
+}
+
 SceneTicking::LateUpdateTickData::LateUpdateTickData()
     : TickData(64)
 {
 }
 
-void SceneTicking::LateUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::LateUpdateTickData::TickScripts(const Span<Script*>& scripts)
 {
-    for (auto* script : scripts)
+    ManagedScriptsBatch batch(ManagedTick::LateUpdate);
+    for (int32 i = 0; i < scripts.Length(); i++)
     {
+        Script* script = scripts[i];
+        if (script->_tickManaged && batch.Add(script))
+            continue;
+        batch.Flush();
         script->OnLateUpdate();
     }
 }
@@ -126,10 +303,15 @@ SceneTicking::LateFixedUpdateTickData::LateFixedUpdateTickData()
 {
 }
 
-void SceneTicking::LateFixedUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::LateFixedUpdateTickData::TickScripts(const Span<Script*>& scripts)
 {
-    for (auto* script : scripts)
+    ManagedScriptsBatch batch(ManagedTick::LateFixedUpdate);
+    for (int32 i = 0; i < scripts.Length(); i++)
     {
+        Script* script = scripts[i];
+        if (script->_tickManaged && batch.Add(script))
+            continue;
+        batch.Flush();
         script->OnLateFixedUpdate();
     }
 }
@@ -160,6 +342,54 @@ void SceneTicking::RemoveScript(Script* obj)
         LateFixedUpdate.RemoveScript(obj);
 }
 
+void SceneTicking::GatherViewers()
+{
+    Viewers.Clear();
+    for (const Camera* camera : Camera::Cameras)
+    {
+        if (camera->IsActiveInHierarchy())
+            Viewers.Add(camera->GetPosition());
+    }
+    Viewers.Add(ViewerLocations);
+}
+
+void SceneTicking::InvokeDeferred(const Function<void()>& action)
+{
+    ScopeLock lock(DeferredLocker);
+    DeferredActions.Add(action);
+}
+
+void SceneTicking::FlushDeferred()
+{
+    // Actions can queue other actions
+    Array<Function<void()>> actions;
+    while (true)
+    {
+        {
+            ScopeLock lock(DeferredLocker);
+            if (DeferredActions.IsEmpty())
+                break;
+            actions.Swap(DeferredActions);
+        }
+        for (const auto& action : actions)
+            action();
+        actions.Clear();
+    }
+
+#if USE_CSHARP
+    // Invoke the actions queued by C# scripts
+    const MClass* mclass = Script::GetStaticClass();
+    const MMethod* method = mclass ? mclass->GetMethod("Internal_FlushDeferred", 0) : nullptr;
+    if (method)
+    {
+        MObject* exception = nullptr;
+        method->Invoke(nullptr, nullptr, &exception);
+        if (exception)
+            DebugLog::LogException(exception);
+    }
+#endif
+}
+
 void SceneTicking::Clear()
 {
     FixedUpdate.Clear();
@@ -3,8 +3,13 @@
 #pragma once
 
 #include "Engine/Level/Types.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Collections/Array.h"
 
+// The amount of scripts ticked by a single job when ticking scripts in parallel (smaller amount of scripts is ticked on a main thread)
+#define SCENE_TICKING_PARALLEL_BATCH_SIZE 64
+
 /// <summary>
 /// Scene gameplay updating helper subsystem that boosts the level ticking by providing efficient objects cache.
 /// </summary>
@@ -48,15 +53,18 @@ class FLAXENGINE_API SceneTicking
     {
     public:
         Array<Script*> Scripts;
+        Array<Script*> ScriptsParallel;
         Array<Tick> Ticks;
 #if USE_EDITOR
         Array<Script*> ScriptsExecuteInEditor;
+        Array<Script*> ScriptsParallelExecuteInEditor;
         Array<Tick> TicksExecuteInEditor;
 #endif
 
         TickData(int32 capacity);
 
-        virtual void TickScripts(const Array<Script*>& scripts) = 0;
+        virtual void TickScripts(const Span<Script*>& scripts) = 0;
+        void TickScriptsParallel(const Array<Script*>& scripts);
 
         void AddScript(Script* script);
         void RemoveScript(Script* script);
@@ -92,28 +100,31 @@ class FLAXENGINE_API SceneTicking
     {
     public:
         FixedUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(const Span<Script*>& scripts) override;
     };
 
     class FLAXENGINE_API UpdateTickData : public TickData
     {
     public:
         UpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(const Span<Script*>& scripts) override;
+
+    private:
+        static bool Throttle(Script* script, float deltaTime);
     };
 
     class FLAXENGINE_API LateUpdateTickData : public TickData
     {
     public:
         LateUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(const Span<Script*>& scripts) override;
     };
 
     class FLAXENGINE_API LateFixedUpdateTickData : public TickData
     {
     public:
         LateFixedUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(const Span<Script*>& scripts) override;
     };
 
 public:
@@ -134,6 +145,37 @@ class FLAXENGINE_API SceneTicking
     /// </summary>
     void Clear();
 
+    /// <summary>
+    /// The locations of the viewers used by the scripts update throttling (see Script::TickRelevanceDistance) in addition to the active cameras. Network replication on a server sets it to the clients locations (see NetworkReplicationHierarchyUpdateResult::SetClientLocation). Can be modified only on a main thread.
+    /// </summary>
+    static Array<Vector3> ViewerLocations;
+
+    /// <summary>
+    /// The update interval (in seconds) of the scripts at their relevance distance from the nearest viewer (see Script::TickRelevanceDistance). Grows linearly with the distance (up to 4 times).
+    /// </summary>
+    static float RelevanceTickInterval;
+
+    /// <summary>
+    /// True if C# scripts are ticked in batches by a single managed call per update phase (instead of a separate native-to-managed call for each script). Order of the scripts is preserved. Supported only on .NET runtime.
+    /// </summary>
+    static bool BatchManagedScripts;
+
+    /// <summary>
+    /// Gathers the viewers locations (active cameras and ViewerLocations) used by the scripts update throttling. Called on a main thread before the update.
+    /// </summary>
+    static void GatherViewers();
+
+    /// <summary>
+    /// Queues the action to be invoked on a main thread after the scripts ticked in parallel end their update (see ParallelTickAttribute). Used by the parallel scripts to modify the scene (eg. spawn, destroy or reparent objects) and to access the state that is not thread-safe. Thread-safe.
+    /// </summary>
+    /// <param name="action">The action to invoke.</param>
+    static void InvokeDeferred(const Function<void()>& action);
+
+    /// <summary>
+    /// Invokes the queued deferred actions. Called on a main thread after ticking scripts in parallel.
+    /// </summary>
+    static void FlushDeferred();
+
 public:
     /// <summary>
     /// The fixed update tick function.
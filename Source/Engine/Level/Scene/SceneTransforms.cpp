@@ -0,0 +1,113 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "SceneTransforms.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+Actor* SceneTransforms::_notified = nullptr;
+
+SceneTransforms::~SceneTransforms()
+{
+    for (int32 i = 0; i < _dirty.Count(); i++)
+        _dirty[i]->_isTransformDirty = 0;
+}
+
+void SceneTransforms::SetDeferred(bool value)
+{
+    if (_deferred == value)
+        return;
+    if (!value)
+        Flush();
+    _deferred = value;
+}
+
+void SceneTransforms::Flush()
+{
+    if (_dirty.IsEmpty())
+        return;
+    PROFILE_CPU();
+
+    // Flatten the dirty hierarchies (skip actors with a dirty parent since they get updated with it)
+    for (int32 i = 0; i < _dirty.Count(); i++)
+    {
+        Actor* actor = _dirty[i];
+        bool isParentDirty = false;
+        for (const Actor* parent = actor->_parent; parent && !isParentDirty; parent = parent->_parent)
+            isParentDirty = parent->_isTransformDirty;
+        if (isParentDirty)
+            continue;
+        _ranges.Add(_actors.Count());
+        Gather(actor, -1);
+    }
+    _ranges.Add(_actors.Count());
+    for (int32 i = 0; i < _dirty.Count(); i++)
+        _dirty[i]->_isTransformDirty = 0;
+    _dirty.Clear();
+
+    // Compute the world transformations (the root of each hierarchy is already up to date)
+    const int32 hierarchiesCount = _ranges.Count() - 1;
+    Function<void(int32)> job = [this](int32 i)
+    {
+        const int32 end = _ranges[i + 1];
+        const int32* parents = _parents.Get();
+        const Transform* local = _local.Get();
+        Transform* world = _world.Get();
+        for (int32 j = _ranges[i] + 1; j < end; j++)
+            world[parents[j]].LocalToWorld(local[j], world[j]);
+    };
+    if (hierarchiesCount > 1 && _actors.Count() >= SCENE_TRANSFORMS_PARALLEL_MIN_COUNT)
+    {
+        JobSystem::Execute(job, hierarchiesCount);
+    }
+    else
+    {
+        for (int32 i = 0; i < hierarchiesCount; i++)
+            job(i);
+    }
+
+    // Notify the actors in the hierarchy order (parent before the children)
+    for (int32 i = 0; i < _actors.Count(); i++)
+    {
+        if (_parents[i] == -1)
+            continue;
+        Actor* actor = _actors[i];
+        actor->_transform = _world[i];
+        _notified = actor;
+        actor->OnTransformChanged();
+        _notified = nullptr;
+    }
+
+    _actors.Clear();
+    _parents.Clear();
+    _local.Clear();
+    _world.Clear();
+    _ranges.Clear();
+}
+
+void SceneTransforms::MarkDirty(Actor* actor)
+{
+    if (actor->_isTransformDirty)
+        return;
+    actor->_isTransformDirty = 1;
+    _dirty.Add(actor);
+}
+
+void SceneTransforms::RemoveDirty(Actor* actor)
+{
+    if (!actor->_isTransformDirty)
+        return;
+    actor->_isTransformDirty = 0;
+    _dirty.Remove(actor);
+}
+
+void SceneTransforms::Gather(Actor* actor, int32 parentIndex)
+{
+    const int32 index = _actors.Count();
+    _actors.Add(actor);
+    _parents.Add(parentIndex);
+    _local.Add(actor->_localTransform);
+    _world.Add(actor->_transform);
+    for (int32 i = 0; i < actor->Children.Count(); i++)
+        Gather(actor->Children[i], index);
+}
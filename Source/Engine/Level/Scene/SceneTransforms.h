@@ -0,0 +1,73 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Level/Types.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Collections/Array.h"
+
+// The minimum amount of actors in the dirty hierarchies to propagate their world transformations in parallel (smaller amount is processed on a main thread)
+#define SCENE_TRANSFORMS_PARALLEL_MIN_COUNT 256
+
+/// <summary>
+/// Scene transformations updating helper subsystem that defers the propagation of the world transformation to the child actors and performs it in a batch once per tick stage.
+/// </summary>
+/// <remarks>
+/// When enabled, changing the actor transformation updates the actor itself immediately but its children are only marked as dirty (child actors world transformation and bounds are outdated until the flush). The dirty hierarchies are flattened into a structure of arrays (local/world transformations with parent indices) so world transformations are computed in parallel (per hierarchy) and then the actors are notified about the change in the hierarchy order on a main thread.
+/// </remarks>
+class FLAXENGINE_API SceneTransforms
+{
+    friend Actor;
+
+private:
+    bool _deferred = false;
+    Array<Actor*> _dirty;
+
+    // Flattened dirty hierarchies (structure of arrays, parent is always placed before the children)
+    Array<Actor*> _actors;
+    Array<int32> _parents;
+    Array<Transform> _local;
+    Array<Transform> _world;
+    Array<int32> _ranges;
+
+    static Actor* _notified;
+
+public:
+    /// <summary>
+    /// Finalizes an instance of the <see cref="SceneTransforms"/> class.
+    /// </summary>
+    ~SceneTransforms();
+
+public:
+    /// <summary>
+    /// Gets a value indicating whether the child actors transformations propagation is deferred until the flush.
+    /// </summary>
+    FORCE_INLINE bool IsDeferred() const
+    {
+        return _deferred;
+    }
+
+    /// <summary>
+    /// Sets a value indicating whether the child actors transformations propagation is deferred until the flush. Disabling flushes all pending changes.
+    /// </summary>
+    /// <param name="value">True if defer transformations propagation, otherwise false.</param>
+    void SetDeferred(bool value);
+
+    /// <summary>
+    /// Gets a value indicating whether any hierarchy has pending transformation changes.
+    /// </summary>
+    FORCE_INLINE bool HasDirty() const
+    {
+        return _dirty.HasItems();
+    }
+
+    /// <summary>
+    /// Propagates the pending transformation changes to the child actors of all dirty hierarchies.
+    /// </summary>
+    void Flush();
+
+private:
+    void MarkDirty(Actor* actor);
+    void RemoveDirty(Actor* actor);
+    void Gather(Actor* actor, int32 parentIndex);
+};
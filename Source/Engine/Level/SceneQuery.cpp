@@ -30,6 +30,51 @@ Actor* SceneQuery::RaycastScene(const Ray& ray)
     return minTarget;
 }
 
+template<typename T>
+void OverlapActorsImpl(const T& bounds, Array<Actor*>& actors, const MClass* type)
+{
+    PROFILE_CPU();
+#if SCENE_QUERIES_WITH_LOCK
+    ScopeLock lock(Level::ScenesLock);
+#endif
+    for (int32 i = 0; i < Level::Scenes.Count(); i++)
+        Level::Scenes[i]->ActorsIndex.Query(bounds, actors, type);
+}
+
+void SceneQuery::OverlapActors(const BoundingBox& box, Array<Actor*>& actors, const MClass* type)
+{
+    OverlapActorsImpl(box, actors, type);
+}
+
+void SceneQuery::OverlapActors(const BoundingSphere& sphere, Array<Actor*>& actors, const MClass* type)
+{
+    OverlapActorsImpl(sphere, actors, type);
+}
+
+void SceneQuery::OverlapActors(const BoundingFrustum& frustum, Array<Actor*>& actors, const MClass* type)
+{
+    OverlapActorsImpl(frustum, actors, type);
+}
+
+void SceneQuery::GetActorsWithTag(const Tag& tag, Array<Actor*>& actors)
+{
+#if SCENE_QUERIES_WITH_LOCK
+    ScopeLock lock(Level::ScenesLock);
+#endif
+    for (int32 i = 0; i < Level::Scenes.Count(); i++)
+        Level::Scenes[i]->ActorsIndex.GetActors(tag, actors);
+}
+
+void SceneQuery::GetActorsOfType(const MClass* type, Array<Actor*>& actors)
+{
+    PROFILE_CPU();
+#if SCENE_QUERIES_WITH_LOCK
+    ScopeLock lock(Level::ScenesLock);
+#endif
+    for (int32 i = 0; i < Level::Scenes.Count(); i++)
+        Level::Scenes[i]->ActorsIndex.GetActors(type, actors);
+}
+
 bool GetAllSceneObjectsQuery(Actor* actor, Array<SceneObject*>& objects)
 {
     objects.Add(actor);
@@ -24,6 +24,44 @@ class FLAXENGINE_API SceneQuery
     /// <returns>Hit actor or nothing</returns>
     static Actor* RaycastScene(const Ray& ray);
 
+    /// <summary>
+    /// Finds the enabled actors which bounds intersect with the given box (uses the scenes spatial index). Appends them to the output.
+    /// </summary>
+    /// <param name="box">The bounding box to test.</param>
+    /// <param name="actors">The actors output.</param>
+    /// <param name="type">The actors type filter (including the derived types). Optional.</param>
+    static void OverlapActors(const BoundingBox& box, Array<Actor*>& actors, const MClass* type = nullptr);
+
+    /// <summary>
+    /// Finds the enabled actors which bounds intersect with the given sphere (uses the scenes spatial index). Appends them to the output.
+    /// </summary>
+    /// <param name="sphere">The bounding sphere to test.</param>
+    /// <param name="actors">The actors output.</param>
+    /// <param name="type">The actors type filter (including the derived types). Optional.</param>
+    static void OverlapActors(const BoundingSphere& sphere, Array<Actor*>& actors, const MClass* type = nullptr);
+
+    /// <summary>
+    /// Finds the enabled actors which bounds intersect with the given frustum (uses the scenes spatial index). Appends them to the output.
+    /// </summary>
+    /// <param name="frustum">The frustum to test.</param>
+    /// <param name="actors">The actors output.</param>
+    /// <param name="type">The actors type filter (including the derived types). Optional.</param>
+    static void OverlapActors(const BoundingFrustum& frustum, Array<Actor*>& actors, const MClass* type = nullptr);
+
+    /// <summary>
+    /// Gets the enabled actors with the given tag (exact match) from the registry of the loaded scenes. Appends them to the output.
+    /// </summary>
+    /// <param name="tag">The tag.</param>
+    /// <param name="actors">The actors output.</param>
+    static void GetActorsWithTag(const Tag& tag, Array<Actor*>& actors);
+
+    /// <summary>
+    /// Gets the enabled actors of the given type (including the derived types) from the registry of the loaded scenes. Appends them to the output.
+    /// </summary>
+    /// <param name="type">The actors type.</param>
+    /// <param name="actors">The actors output.</param>
+    static void GetActorsOfType(const MClass* type, Array<Actor*>& actors);
+
 public:
     /// <summary>
     /// Gets all scene objects from the actor into linear list. Appends them (without the given actor).
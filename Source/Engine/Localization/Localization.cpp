@@ -29,18 +29,18 @@ class LocalizationService : public EngineService
 
     void OnLocalizationChanged();
 
-    const String& Get(const String& id, int32 index, const String& fallback) const
+    StringView Get(const String& id, int32 index, const String& fallback) const
     {
         if (id.IsEmpty())
             return fallback;
+        StringView result;
 
         // Try current tables
         for (auto& e : LocalizedStringTables)
         {
             const auto table = e.Get();
-            const auto messages = table ? table->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            if (table && table->TryGetString(id, index, result))
+                return result;
         }
 
         // Try fallback tables for current tables
@@ -48,18 +48,16 @@ class LocalizationService : public EngineService
         {
             const auto table = e.Get();
             const auto fallbackTable = table ? table->FallbackTable.Get() : nullptr;
-            const auto messages = fallbackTable ? fallbackTable->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            if (fallbackTable && fallbackTable->TryGetString(id, index, result))
+                return result;
         }
 
         // Try fallback language tables
         for (auto& e : FallbackStringTables)
         {
             const auto table = e.Get();
-            const auto messages = table ? table->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            if (table && table->TryGetString(id, index, result))
+                return result;
         }
 
         return fallback;
@@ -323,6 +321,6 @@ String Localization::GetString(const String& id, const String& fallback)
 String Localization::GetPluralString(const String& id, int32 n, const String& fallback)
 {
     CHECK_RETURN(n >= 1, String::Format(fallback.GetText(), n));
-    const String& format = Instance.Get(id, n - 1, fallback);
+    const StringView format = Instance.Get(id, n - 1, fallback);
     return String::Format(format.GetText(), n);
 }
@@ -5,13 +5,53 @@
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Serialization/SerializationFwd.h"
 #include "Engine/Content/Factories/JsonAssetFactory.h"
+#include "Engine/Utilities/Crc.h"
 #if USE_EDITOR
 #include "Engine/Threading/Threading.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
+#else
+#include "Engine/Content/Storage/ContentStorageManager.h"
 #endif
 
 REGISTER_JSON_ASSET(LocalizedStringTable, "FlaxEngine.LocalizedStringTable", true);
 
+// Compiled string table layout: header, buckets (BucketsCount + 1 entry ranges), entries (sorted by bucket and hash), values and the null-terminated strings data.
+// Uses only offsets so it can be used directly from the loaded asset chunk memory.
+#define LOCALIZED_STRING_TABLE_MAGIC 0x4C535442
+
+namespace
+{
+    struct CompiledHeader
+    {
+        uint32 Magic;
+        int32 EntriesCount;
+        int32 BucketsCount;
+        int32 ValuesCount;
+        int32 CharsCount;
+    };
+
+    struct CompiledEntry
+    {
+        uint32 Hash;
+        int32 IdStart;
+        int32 IdLength;
+        int32 ValuesStart;
+        int32 ValuesCount;
+    };
+
+    struct CompiledValue
+    {
+        int32 Start;
+        int32 Length;
+    };
+
+    FORCE_INLINE uint32 GetIdHash(const StringView& id)
+    {
+        return Crc::MemCrc32(id.Get(), id.Length() * sizeof(Char));
+    }
+}
+
 LocalizedStringTable::LocalizedStringTable(const SpawnParams& params, const AssetInfo* info)
     : JsonAssetBase(params, info)
 {
@@ -36,9 +76,7 @@ void LocalizedStringTable::AddPluralString(const StringView& id, const StringVie
 String LocalizedStringTable::GetString(const String& id) const
 {
     StringView result;
-    const auto messages = Entries.TryGet(id);
-    if (messages && messages->Count() != 0)
-        result = messages->At(0);
+    TryGetString(id, 0, result);
     if (result.IsEmpty() && FallbackTable)
         result = FallbackTable->GetString(id);
     return result;
@@ -47,14 +85,140 @@ String LocalizedStringTable::GetString(const String& id) const
 String LocalizedStringTable::GetPluralString(const String& id, int32 n) const
 {
     StringView result;
-    const auto messages = Entries.TryGet(id);
-    if (messages && messages->Count() > n)
-        result = messages->At(n);
+    TryGetString(id, n, result);
     if (result.IsEmpty() && FallbackTable)
         result = FallbackTable->GetPluralString(id, n);
     return String::Format(result.GetText(), n);
 }
 
+bool LocalizedStringTable::TryGetString(const StringView& id, int32 index, StringView& result) const
+{
+    // Runtime-added or editor entries
+    if (Entries.HasItems())
+    {
+        const auto messages = Entries.TryGet(id);
+        if (messages && messages->Count() > index)
+        {
+            result = messages->At(index);
+            return true;
+        }
+    }
+
+    // Compiled lookup table
+    if (_compiled.IsInvalid() || index < 0)
+        return false;
+    const byte* data = _compiled.Get();
+    const auto header = (const CompiledHeader*)data;
+    const auto buckets = (const int32*)(header + 1);
+    const auto entries = (const CompiledEntry*)(buckets + header->BucketsCount + 1);
+    const auto values = (const CompiledValue*)(entries + header->EntriesCount);
+    const auto chars = (const Char*)(values + header->ValuesCount);
+    const uint32 hash = GetIdHash(id);
+    const int32 bucket = (int32)(hash & (uint32)(header->BucketsCount - 1));
+    for (int32 i = buckets[bucket]; i < buckets[bucket + 1]; i++)
+    {
+        const CompiledEntry& e = entries[i];
+        if (e.Hash == hash && StringView(chars + e.IdStart, e.IdLength) == id)
+        {
+            if (index >= e.ValuesCount)
+                return false;
+            const CompiledValue& value = values[e.ValuesStart + index];
+            result = StringView(chars + value.Start, value.Length);
+            return true;
+        }
+    }
+    return false;
+}
+
+#if USE_EDITOR
+
+void LocalizedStringTable::Compile(Array<byte>& output) const
+{
+    struct SortEntry
+    {
+        int32 Bucket;
+        uint32 Hash;
+        const String* Id;
+        const Array<String>* Values;
+
+        bool operator<(const SortEntry& other) const
+        {
+            return Bucket < other.Bucket || (Bucket == other.Bucket && Hash < other.Hash);
+        }
+    };
+
+    // Sort entries by hashed ids into the buckets
+    const int32 bucketsCount = Math::RoundUpToPowerOf2(Math::Max(Entries.Count(), 1));
+    Array<SortEntry> sorted;
+    sorted.EnsureCapacity(Entries.Count());
+    int32 valuesCount = 0, charsCount = 0;
+    for (const auto& e : Entries)
+    {
+        auto& entry = sorted.AddOne();
+        entry.Hash = GetIdHash(e.Key);
+        entry.Bucket = (int32)(entry.Hash & (uint32)(bucketsCount - 1));
+        entry.Id = &e.Key;
+        entry.Values = &e.Value;
+        valuesCount += e.Value.Count();
+        charsCount += e.Key.Length() + 1;
+        for (const String& value : e.Value)
+            charsCount += value.Length() + 1;
+    }
+    Sorting::QuickSort(sorted.Get(), sorted.Count());
+
+    // Allocate the output
+    const int32 size = sizeof(CompiledHeader) + (bucketsCount + 1) * sizeof(int32) + sorted.Count() * sizeof(CompiledEntry) + valuesCount * sizeof(CompiledValue) + charsCount * sizeof(Char);
+    output.Resize(size, false);
+    Platform::MemoryClear(output.Get(), size);
+    const auto header = (CompiledHeader*)output.Get();
+    header->Magic = LOCALIZED_STRING_TABLE_MAGIC;
+    header->EntriesCount = sorted.Count();
+    header->BucketsCount = bucketsCount;
+    header->ValuesCount = valuesCount;
+    header->CharsCount = charsCount;
+    const auto buckets = (int32*)(header + 1);
+    const auto entries = (CompiledEntry*)(buckets + bucketsCount + 1);
+    const auto values = (CompiledValue*)(entries + sorted.Count());
+    const auto chars = (Char*)(values + valuesCount);
+
+    // Write entries and strings (null-terminated)
+    int32 valuesPos = 0, charsPos = 0;
+    const auto writeString = [chars, &charsPos](const String& str)
+    {
+        const int32 start = charsPos;
+        Platform::MemoryCopy(chars + charsPos, str.Get(), str.Length() * sizeof(Char));
+        charsPos += str.Length() + 1;
+        return start;
+    };
+    for (int32 i = 0; i < sorted.Count(); i++)
+    {
+        const SortEntry& src = sorted[i];
+        CompiledEntry& dst = entries[i];
+        dst.Hash = src.Hash;
+        dst.IdStart = writeString(*src.Id);
+        dst.IdLength = src.Id->Length();
+        dst.ValuesStart = valuesPos;
+        dst.ValuesCount = src.Values->Count();
+        for (const String& value : *src.Values)
+        {
+            CompiledValue& v = values[valuesPos++];
+            v.Length = value.Length();
+            v.Start = writeString(value);
+        }
+    }
+
+    // Write buckets ranges
+    int32 entryIndex = 0;
+    for (int32 bucket = 0; bucket <= bucketsCount; bucket++)
+    {
+        while (entryIndex < sorted.Count() && sorted[entryIndex].Bucket < bucket)
+            entryIndex++;
+        buckets[bucket] = entryIndex;
+    }
+}
+
+#endif
+
 Asset::LoadResult LocalizedStringTable::loadAsset()
 {
     // Base
@@ -86,6 +250,24 @@ Asset::LoadResult LocalizedStringTable::loadAsset()
             }
         }
     }
+#if !USE_EDITOR
+    else
+    {
+        // Use the compiled lookup table from the cooked asset
+        const auto storage = ContentStorageManager::GetStorage(GetPath(), true);
+        AssetInitData initData;
+        auto chunk = storage && !storage->LoadAssetHeader(GetID(), initData) ? initData.Header.Chunks[1] : nullptr;
+        if (chunk && !storage->LoadAssetChunk(chunk) && chunk->Data.Length() >= (int32)sizeof(CompiledHeader))
+        {
+            _compiled.Swap(chunk->Data);
+            if (((const CompiledHeader*)_compiled.Get())->Magic != LOCALIZED_STRING_TABLE_MAGIC)
+            {
+                _compiled.Release();
+                return LoadResult::InvalidData;
+            }
+        }
+    }
+#endif
 
     return result;
 }
@@ -98,6 +280,7 @@ void LocalizedStringTable::unload(bool isReloading)
     Locale.Clear();
     FallbackTable = nullptr;
     Entries.Clear();
+    _compiled.Release();
 }
 
 void LocalizedStringTable::OnGetData(rapidjson_flax::StringBuffer& buffer) const
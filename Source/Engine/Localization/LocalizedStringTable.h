@@ -5,6 +5,7 @@
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Scripting/SoftObjectReference.h"
 
 /// <summary>
@@ -14,6 +15,10 @@
 API_CLASS(NoSpawn) class FLAXENGINE_API LocalizedStringTable : public JsonAssetBase
 {
     DECLARE_ASSET_HEADER(LocalizedStringTable);
+private:
+    // The compiled lookup table (cooked game only, see Compile)
+    BytesContainer _compiled;
+
 public:
     /// <summary>
     /// The locale of the localized string table (eg. pl-PL).
@@ -28,6 +33,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API LocalizedStringTable : public JsonAssetB
     /// <summary>
     /// The string table. Maps the message id into the localized text. For plural messages the list contains separate items for value numbers.
     /// </summary>
+    /// <remarks>In cooked game the table is compiled into the binary lookup table and this dictionary is empty (use GetString or GetPluralString to access the text).</remarks>
     API_FIELD() Dictionary<String, Array<String>> Entries;
 
 public:
@@ -61,6 +67,23 @@ API_CLASS(NoSpawn) class FLAXENGINE_API LocalizedStringTable : public JsonAssetB
     /// <returns>The localized text.</returns>
     API_FUNCTION() String GetPluralString(const String& id, int32 n) const;
 
+    /// <summary>
+    /// Tries to find the localized string in this table (excluding fallback table). Uses compiled lookup table in cooked game.
+    /// </summary>
+    /// <param name="id">The message identifier.</param>
+    /// <param name="index">The message index (0 for singular message, for plural messages it's the value number).</param>
+    /// <param name="result">The localized text (null-terminated).</param>
+    /// <returns>True if found the message, otherwise false.</returns>
+    bool TryGetString(const StringView& id, int32 index, StringView& result) const;
+
+#if USE_EDITOR
+    /// <summary>
+    /// Compiles the string table entries into the binary lookup table (sorted by hashed message ids) used by the cooked game to find strings without parsing them and allocating memory.
+    /// </summary>
+    /// <param name="output">The output data.</param>
+    void Compile(Array<byte>& output) const;
+#endif
+
 protected:
     // [JsonAssetBase]
     LoadResult loadAsset() override;
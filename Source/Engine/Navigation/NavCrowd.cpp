@@ -4,8 +4,32 @@
 #include "NavMesh.h"
 #include "NavMeshRuntime.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/recastnavigation/DetourCrowd.h>
 
+// The minimum amount of agents to process by a single job (smaller crowds are updated on a single thread)
+#define NAV_CROWD_MIN_AGENTS_PER_JOB 32
+
+namespace
+{
+    void CrowdParallelFor(void* userData, int count, int maxJobs, dtCrowdParallelJob job, void* data)
+    {
+        // Split agents into the contiguous ranges (agents are sorted spatially by crowd so each job processes a partition of the crowd)
+        const int32 jobsCount = Math::Min(maxJobs, Math::DivideAndRoundUp(count, NAV_CROWD_MIN_AGENTS_PER_JOB));
+        if (jobsCount <= 1)
+        {
+            job(data, 0, count, 0);
+            return;
+        }
+        Function<void(int32)> func;
+        func.Bind([job, data, count, jobsCount](int32 jobIndex)
+        {
+            job(data, count * jobIndex / jobsCount, count * (jobIndex + 1) / jobsCount, jobIndex);
+        });
+        JobSystem::Wait(JobSystem::Dispatch(func, jobsCount));
+    }
+}
+
 NavCrowd::NavCrowd(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -14,6 +38,7 @@ NavCrowd::NavCrowd(const SpawnParams& params)
 
 NavCrowd::~NavCrowd()
 {
+    WaitForUpdate();
     dtFreeCrowd(_crowd);
 }
 
@@ -33,11 +58,20 @@ bool NavCrowd::Init(float maxAgentRadius, int32 maxAgents, NavMeshRuntime* navMe
 {
     if (!_crowd || !navMesh)
         return true;
-    return !_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh());
+    WaitForUpdate();
+    if (!_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh()))
+        return true;
+    if (!_crowd->setParallelFor(CrowdParallelFor, nullptr, JobSystem::GetThreadsCount()))
+    {
+        // Fallback to the single-threaded update
+        _crowd->setParallelFor(nullptr, nullptr, 0);
+    }
+    return false;
 }
 
 int32 NavCrowd::AddAgent(const Vector3& position, const NavAgentProperties& properties)
 {
+    WaitForUpdate();
     const Float3 pos = position;
     dtCrowdAgentParams agentParams;
     InitCrowdAgentParams(agentParams, properties);
@@ -46,6 +80,7 @@ int32 NavCrowd::AddAgent(const Vector3& position, const NavAgentProperties& prop
 
 Vector3 NavCrowd::GetAgentPosition(int32 id) const
 {
+    WaitForUpdate();
     Vector3 result = Vector3::Zero;
     const dtCrowdAgent* agent = _crowd->getAgent(id);
     if (agent && agent->state != DT_CROWDAGENT_STATE_INVALID)
@@ -57,6 +92,7 @@ Vector3 NavCrowd::GetAgentPosition(int32 id) const
 
 Vector3 NavCrowd::GetAgentVelocity(int32 id) const
 {
+    WaitForUpdate();
     Vector3 result = Vector3::Zero;
     const dtCrowdAgent* agent = _crowd->getAgent(id);
     if (agent && agent->state != DT_CROWDAGENT_STATE_INVALID)
@@ -68,6 +104,7 @@ Vector3 NavCrowd::GetAgentVelocity(int32 id) const
 
 void NavCrowd::SetAgentProperties(int32 id, const NavAgentProperties& properties)
 {
+    WaitForUpdate();
     dtCrowdAgentParams agentParams;
     InitCrowdAgentParams(agentParams, properties);
     _crowd->updateAgentParameters(id, &agentParams);
@@ -75,6 +112,7 @@ void NavCrowd::SetAgentProperties(int32 id, const NavAgentProperties& properties
 
 void NavCrowd::SetAgentMoveTarget(int32 id, const Vector3& position)
 {
+    WaitForUpdate();
     const float* extent = _crowd->getQueryExtents();
     const dtQueryFilter* filter = _crowd->getFilter(0);
     const Float3 pointNavMesh = position;
@@ -86,26 +124,54 @@ void NavCrowd::SetAgentMoveTarget(int32 id, const Vector3& position)
 
 void NavCrowd::SetAgentMoveVelocity(int32 id, const Vector3& velocity)
 {
+    WaitForUpdate();
     const Float3 v = velocity;
     _crowd->requestMoveVelocity(id, v.Raw);
 }
 
 void NavCrowd::ResetAgentMove(int32 id)
 {
+    WaitForUpdate();
     _crowd->resetMoveTarget(id);
 }
 
 void NavCrowd::RemoveAgent(int32 id)
 {
+    WaitForUpdate();
     _crowd->removeAgent(id);
 }
 
 void NavCrowd::Update(float dt)
 {
     PROFILE_CPU();
+    WaitForUpdate();
     _crowd->update(Math::Max(dt, ZeroTolerance), nullptr);
 }
 
+void NavCrowd::UpdateAsync(float dt)
+{
+    WaitForUpdate();
+    _updateDt = Math::Max(dt, ZeroTolerance);
+    Function<void(int32)> func;
+    func.Bind<NavCrowd, &NavCrowd::UpdateJob>(this);
+    _updateLabel = JobSystem::Dispatch(func);
+}
+
+void NavCrowd::WaitForUpdate() const
+{
+    if (_updateLabel)
+    {
+        JobSystem::Wait(_updateLabel);
+        _updateLabel = 0;
+    }
+}
+
+void NavCrowd::UpdateJob(int32 i)
+{
+    PROFILE_CPU_NAMED("NavCrowd.Update");
+    _crowd->update(_updateDt, nullptr);
+}
+
 void NavCrowd::InitCrowdAgentParams(dtCrowdAgentParams& agentParams, const NavAgentProperties& properties)
 {
     agentParams.radius = properties.Radius;
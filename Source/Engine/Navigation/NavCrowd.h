@@ -18,6 +18,8 @@ API_CLASS() class FLAXENGINE_API NavCrowd : public ScriptingObject
     DECLARE_SCRIPTING_TYPE(NavCrowd);
 private:
     dtCrowd* _crowd;
+    mutable int64 _updateLabel = 0;
+    float _updateDt = 0.0f;
 
 public:
     ~NavCrowd();
@@ -108,6 +110,18 @@ API_CLASS() class FLAXENGINE_API NavCrowd : public ScriptingObject
     /// <param name="dt">The simulation update delta time (in seconds).</param>
     API_FUNCTION() void Update(float dt);
 
+    /// <summary>
+    /// Starts the update of the steering and positions of all agents on a job system (eg. to overlap with the animations update). Use WaitForUpdate to sync before using the results. Other crowd methods call it automatically.
+    /// </summary>
+    /// <param name="dt">The simulation update delta time (in seconds).</param>
+    API_FUNCTION() void UpdateAsync(float dt);
+
+    /// <summary>
+    /// Waits for the asynchronous crowd update to end (started with UpdateAsync). Does nothing if crowd is not being updated.
+    /// </summary>
+    API_FUNCTION() void WaitForUpdate() const;
+
 private:
+    void UpdateJob(int32 i);
     void InitCrowdAgentParams(dtCrowdAgentParams& agentParams, const NavAgentProperties& properties);
 };
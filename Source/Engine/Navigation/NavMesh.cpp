@@ -2,16 +2,17 @@
 
 #include "NavMesh.h"
 #include "NavMeshRuntime.h"
+#include "NavigationSettings.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Serialization/Serialization.h"
 #if COMPILE_WITH_ASSETS_IMPORTER
 #include "Engine/Core/Log.h"
 #include "Engine/ContentImporters/AssetsImportingManager.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
+#endif
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
-#endif
 
 NavMesh::NavMesh(const SpawnParams& params)
     : Actor(params)
@@ -86,9 +87,23 @@ NavMeshRuntime* NavMesh::GetRuntime(bool createIfMissing) const
     return NavMeshRuntime::Get(Properties, createIfMissing);
 }
 
+bool NavMesh::IsTilesStreamingEnabled()
+{
+#if USE_EDITOR
+    // Keep all tiles in edit mode (eg. for navmesh debug drawing and building)
+    if (!Editor::IsPlayMode)
+        return false;
+#endif
+    return NavigationSettings::Get()->EnableTilesStreaming;
+}
+
 void NavMesh::AddTiles()
 {
     auto navMesh = NavMeshRuntime::Get(Properties, true);
+
+    // Streaming adds the tiles later (only the nearby ones)
+    if (IsTilesStreamingEnabled())
+        return;
     navMesh->AddTiles(this);
 }
 
@@ -63,6 +63,11 @@ API_CLASS() class FLAXENGINE_API NavMesh : public Actor
     /// </summary>
     NavMeshRuntime* GetRuntime(bool createIfMissing = true) const;
 
+    /// <summary>
+    /// Checks if navmesh tiles streaming is enabled. If so, tiles are added to the runtime navmesh only near the streaming sources (see Navigation::AddStreamingSource).
+    /// </summary>
+    static bool IsTilesStreamingEnabled();
+
 private:
     void AddTiles();
     void RemoveTiles();
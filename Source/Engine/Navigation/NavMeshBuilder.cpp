@@ -49,6 +49,9 @@ int32 BoxTrianglesIndicesCache[] =
 #define NAV_MESH_TILE_MAX_EXTENT 100000000
 #define NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY 0
 
+// Time budget (in milliseconds) for adding the built tiles into the navmesh runtime on a main thread (per update)
+#define NAV_MESH_BUILD_ADD_TILES_TIME_BUDGET 1.0
+
 #if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
 #include "Engine/Debug/DebugDraw.h"
 #endif
@@ -68,80 +71,172 @@ struct Modifier
     NavAreaProperties* NavArea;
 };
 
-struct NavigationSceneRasterization
+struct NavGeometry
 {
-    NavMesh* NavMesh;
-    BoundingBox TileBoundsNavMesh;
-    Matrix WorldToNavMesh;
-    rcContext* Context;
-    rcConfig* Config;
-    rcHeightfield* Heightfield;
-    float WalkableThreshold;
+    enum class Types : byte
+    {
+        // Triangles extracted during the scene gathering (eg. primitive colliders).
+        Triangles,
+        // Mesh collider geometry extracted on demand.
+        MeshCollider,
+        // Spline collider geometry extracted on demand.
+        SplineCollider,
+        // Terrain patch collision geometry extracted on demand.
+        TerrainPatch,
+    };
+
+    enum States : int64
+    {
+        Pending = 0,
+        Extracting = 1,
+        Ready = 2,
+    };
+
+    Types Type;
+    int32 PatchIndex;
+    Actor* Source;
+    BoundingBox BoundsNavMesh;
+    int64 State;
     Array<Float3> VertexBuffer;
     Array<int32> IndexBuffer;
-    Array<OffMeshLink>* OffMeshLinks;
-    Array<Modifier>* Modifiers;
-    const bool IsWorldToNavMeshIdentity;
+};
+
+struct NavGeometryLink
+{
+    BoundingBox BoundsNavMesh;
+    OffMeshLink Link;
+};
 
-    NavigationSceneRasterization(::NavMesh* navMesh, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, rcContext* context, rcConfig* config, rcHeightfield* heightfield, Array<OffMeshLink>* offMeshLinks, Array<Modifier>* modifiers)
-        : TileBoundsNavMesh(tileBoundsNavMesh)
+struct NavGeometryModifier
+{
+    BoundingBox BoundsNavMesh;
+    Modifier Modifier;
+};
+
+// The scene geometry gathered once for all tiles built during a single navmesh build. Geometry of the colliders is extracted (in navmesh space) only once by the first tile that uses it and then shared by all tiles rasterization.
+class NavSceneGeometry
+{
+public:
+    NavMesh* NavMesh;
+    BoundingBox BoundsNavMesh;
+    Matrix WorldToNavMesh;
+    bool IsWorldToNavMeshIdentity;
+    Array<NavGeometry> Geometry;
+    Array<NavGeometryLink> OffMeshLinks;
+    Array<NavGeometryModifier> Modifiers;
+    int64 RefCount = 1;
+
+    NavSceneGeometry(::NavMesh* navMesh, const BoundingBox& boundsNavMesh, const Matrix& worldToNavMesh)
+        : NavMesh(navMesh)
+        , BoundsNavMesh(boundsNavMesh)
         , WorldToNavMesh(worldToNavMesh)
         , IsWorldToNavMeshIdentity(worldToNavMesh.IsIdentity())
     {
-        NavMesh = navMesh;
-        Context = context;
-        Config = config;
-        Heightfield = heightfield;
-        WalkableThreshold = Math::Cos(config->walkableSlopeAngle * DegreesToRadians);
-        OffMeshLinks = offMeshLinks;
-        Modifiers = modifiers;
     }
 
-    void RasterizeTriangles()
+    void AddRef()
     {
-        auto& vb = VertexBuffer;
-        auto& ib = IndexBuffer;
-        if (vb.IsEmpty() || ib.IsEmpty())
-            return;
+        Platform::InterlockedIncrement(&RefCount);
+    }
 
-        // Rasterize triangles
-        if (IsWorldToNavMeshIdentity)
+    void Release()
+    {
+        if (Platform::InterlockedDecrement(&RefCount) == 0)
+            Delete(this);
+    }
+
+    void Gather()
+    {
+        PROFILE_CPU_NAMED("GatherGeometry");
+        Function<bool(Actor*, NavSceneGeometry&)> treeWalkFunction(Walk);
+        SceneQuery::TreeExecute<NavSceneGeometry&>(treeWalkFunction, *this);
+    }
+
+    void Extract(NavGeometry& geometry)
+    {
+        auto state = (int64 volatile*)&geometry.State;
+        if (Platform::AtomicRead(state) == NavGeometry::Ready)
+            return;
+        if (Platform::InterlockedCompareExchange(state, NavGeometry::Extracting, NavGeometry::Pending) != NavGeometry::Pending)
         {
-            // Faster path
-            for (int32 i0 = 0; i0 < ib.Count();)
-            {
-                auto v0 = vb[ib[i0++]];
-                auto v1 = vb[ib[i0++]];
-                auto v2 = vb[ib[i0++]];
-#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
-                DEBUG_DRAW_TRIANGLE(v0, v1, v2, Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
-#endif
+            // Other tile is extracting this geometry
+            while (Platform::AtomicRead(state) != NavGeometry::Ready)
+                Platform::Sleep(0);
+            return;
+        }
 
-                auto n = Float3::Cross(v0 - v1, v0 - v2);
-                n.Normalize();
-                const char area = n.Y > WalkableThreshold ? RC_WALKABLE_AREA : 0;
-                rcRasterizeTriangle(Context, &v0.X, &v1.X, &v2.X, area, *Heightfield);
-            }
+        auto& vb = geometry.VertexBuffer;
+        auto& ib = geometry.IndexBuffer;
+        switch (geometry.Type)
+        {
+        case NavGeometry::Types::MeshCollider:
+        {
+            PROFILE_CPU_NAMED("MeshCollider");
+            const auto* meshCollider = (MeshCollider*)geometry.Source;
+            auto collisionData = meshCollider->CollisionData.Get();
+            if (!collisionData || collisionData->WaitForLoaded())
+                break;
+            collisionData->ExtractGeometry(vb, ib);
+            Matrix meshColliderToWorld;
+            meshCollider->GetLocalToWorldMatrix(meshColliderToWorld);
+            Matrix meshColliderToNavMesh;
+            Matrix::Multiply(meshColliderToWorld, WorldToNavMesh, meshColliderToNavMesh);
+            for (auto& v : vb)
+                Float3::Transform(v, meshColliderToNavMesh, v);
+            break;
         }
-        else
+        case NavGeometry::Types::SplineCollider:
         {
-            // Transform vertices from world space into the navmesh space
-            const Matrix worldToNavMesh = WorldToNavMesh;
-            for (int32 i0 = 0; i0 < ib.Count();)
-            {
-                auto v0 = Float3::Transform(vb[ib[i0++]], worldToNavMesh);
-                auto v1 = Float3::Transform(vb[ib[i0++]], worldToNavMesh);
-                auto v2 = Float3::Transform(vb[ib[i0++]], worldToNavMesh);
-#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
-                DEBUG_DRAW_TRIANGLE(v0, v1, v2, Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
-#endif
-
-                auto n = Float3::Cross(v0 - v1, v0 - v2);
-                n.Normalize();
-                const char area = n.Y > WalkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
-                rcRasterizeTriangle(Context, &v0.X, &v1.X, &v2.X, area, *Heightfield);
-            }
+            PROFILE_CPU_NAMED("SplineCollider");
+            const auto* splineCollider = (SplineCollider*)geometry.Source;
+            auto collisionData = splineCollider->CollisionData.Get();
+            if (!collisionData || collisionData->WaitForLoaded())
+                break;
+            splineCollider->ExtractGeometry(vb, ib);
+            TransformToNavMesh(vb);
+            break;
         }
+        case NavGeometry::Types::TerrainPatch:
+        {
+            PROFILE_CPU_NAMED("Terrain");
+            auto* terrain = (Terrain*)geometry.Source;
+            terrain->GetPatch(geometry.PatchIndex)->ExtractCollisionGeometry(vb, ib);
+            TransformToNavMesh(vb);
+            break;
+        }
+        default:
+            break;
+        }
+        Platform::AtomicStore(state, NavGeometry::Ready);
+    }
+
+    void TransformToNavMesh(Array<Float3>& vb) const
+    {
+        if (IsWorldToNavMeshIdentity)
+            return;
+        for (auto& v : vb)
+            Float3::Transform(v, WorldToNavMesh, v);
+    }
+
+    NavGeometry& AddTriangles(const BoundingBox& boundsNavMesh)
+    {
+        auto& geometry = Geometry.AddOne();
+        geometry.Type = NavGeometry::Types::Triangles;
+        geometry.PatchIndex = -1;
+        geometry.Source = nullptr;
+        geometry.BoundsNavMesh = boundsNavMesh;
+        geometry.State = NavGeometry::Ready;
+        return geometry;
+    }
+
+    void AddSource(NavGeometry::Types type, Actor* source, const BoundingBox& boundsNavMesh, int32 patchIndex = -1)
+    {
+        auto& geometry = Geometry.AddOne();
+        geometry.Type = type;
+        geometry.PatchIndex = patchIndex;
+        geometry.Source = source;
+        geometry.BoundsNavMesh = boundsNavMesh;
+        geometry.State = NavGeometry::Pending;
     }
 
     static void TriangulateBox(Array<Float3>& vb, Array<int32>& ib, const OrientedBoundingBox& box)
@@ -215,134 +310,86 @@ struct NavigationSceneRasterization
         }
     }
 
-    static bool Walk(Actor* actor, NavigationSceneRasterization& e)
+    static bool Walk(Actor* actor, NavSceneGeometry& e)
     {
-        // Early out if object is not intersecting with the tile bounds or is not using navigation
+        // Early out if object is not intersecting with the built tiles bounds or is not using navigation
         if (!actor->GetIsActive() || !(actor->GetStaticFlags() & StaticFlags::Navigation))
             return true;
         BoundingBox actorBoxNavMesh;
         BoundingBox::Transform(actor->GetBox(), e.WorldToNavMesh, actorBoxNavMesh);
-        if (!actorBoxNavMesh.Intersects(e.TileBoundsNavMesh))
+        if (!actorBoxNavMesh.Intersects(e.BoundsNavMesh))
             return true;
 
-        // Prepare buffers (for triangles)
-        auto& vb = e.VertexBuffer;
-        auto& ib = e.IndexBuffer;
-        vb.Clear();
-        ib.Clear();
-
-        // Extract data from the actor
+        // Extract data from the actor (primitive shapes are cheap to triangulate, other geometry is extracted by the tiles building)
         if (const auto* boxCollider = dynamic_cast<BoxCollider*>(actor))
         {
             if (boxCollider->GetIsTrigger())
                 return true;
-            PROFILE_CPU_NAMED("BoxCollider");
-
-            const OrientedBoundingBox box = boxCollider->GetOrientedBox();
-            TriangulateBox(vb, ib, box);
-
-            e.RasterizeTriangles();
+            auto& geometry = e.AddTriangles(actorBoxNavMesh);
+            TriangulateBox(geometry.VertexBuffer, geometry.IndexBuffer, boxCollider->GetOrientedBox());
+            e.TransformToNavMesh(geometry.VertexBuffer);
         }
         else if (const auto* sphereCollider = dynamic_cast<SphereCollider*>(actor))
         {
             if (sphereCollider->GetIsTrigger())
                 return true;
-            PROFILE_CPU_NAMED("SphereCollider");
-
-            const BoundingSphere sphere = sphereCollider->GetSphere();
-            TriangulateSphere(vb, ib, sphere);
-
-            e.RasterizeTriangles();
+            auto& geometry = e.AddTriangles(actorBoxNavMesh);
+            TriangulateSphere(geometry.VertexBuffer, geometry.IndexBuffer, sphereCollider->GetSphere());
+            e.TransformToNavMesh(geometry.VertexBuffer);
         }
         else if (const auto* capsuleCollider = dynamic_cast<CapsuleCollider*>(actor))
         {
             if (capsuleCollider->GetIsTrigger())
                 return true;
-            PROFILE_CPU_NAMED("CapsuleCollider");
-
-            const BoundingBox box = capsuleCollider->GetBox();
-            TriangulateBox(vb, ib, box);
-
-            e.RasterizeTriangles();
+            auto& geometry = e.AddTriangles(actorBoxNavMesh);
+            TriangulateBox(geometry.VertexBuffer, geometry.IndexBuffer, capsuleCollider->GetBox());
+            e.TransformToNavMesh(geometry.VertexBuffer);
         }
-        else if (const auto* meshCollider = dynamic_cast<MeshCollider*>(actor))
+        else if (auto* meshCollider = dynamic_cast<MeshCollider*>(actor))
         {
             if (meshCollider->GetIsTrigger())
                 return true;
-            PROFILE_CPU_NAMED("MeshCollider");
-
-            auto collisionData = meshCollider->CollisionData.Get();
-            if (!collisionData || collisionData->WaitForLoaded())
-                return true;
-
-            collisionData->ExtractGeometry(vb, ib);
-
-            Matrix meshColliderToWorld;
-            meshCollider->GetLocalToWorldMatrix(meshColliderToWorld);
-            for (auto& v : vb)
-                Float3::Transform(v, meshColliderToWorld, v);
-
-            e.RasterizeTriangles();
+            e.AddSource(NavGeometry::Types::MeshCollider, actor, actorBoxNavMesh);
         }
-        else if (const auto* splineCollider = dynamic_cast<SplineCollider*>(actor))
+        else if (auto* splineCollider = dynamic_cast<SplineCollider*>(actor))
         {
             if (splineCollider->GetIsTrigger())
                 return true;
-            PROFILE_CPU_NAMED("SplineCollider");
-
-            auto collisionData = splineCollider->CollisionData.Get();
-            if (!collisionData || collisionData->WaitForLoaded())
-                return true;
-
-            splineCollider->ExtractGeometry(vb, ib);
-
-            e.RasterizeTriangles();
+            e.AddSource(NavGeometry::Types::SplineCollider, actor, actorBoxNavMesh);
         }
-        else if (const auto* terrain = dynamic_cast<Terrain*>(actor))
+        else if (auto* terrain = dynamic_cast<Terrain*>(actor))
         {
-            PROFILE_CPU_NAMED("Terrain");
-
             for (int32 patchIndex = 0; patchIndex < terrain->GetPatchesCount(); patchIndex++)
             {
                 const auto patch = terrain->GetPatch(patchIndex);
                 BoundingBox patchBoundsNavMesh;
                 BoundingBox::Transform(patch->GetBounds(), e.WorldToNavMesh, patchBoundsNavMesh);
-                if (!patchBoundsNavMesh.Intersects(e.TileBoundsNavMesh))
-                    continue;
-
-                patch->ExtractCollisionGeometry(vb, ib);
-
-                e.RasterizeTriangles();
+                if (patchBoundsNavMesh.Intersects(e.BoundsNavMesh))
+                    e.AddSource(NavGeometry::Types::TerrainPatch, actor, patchBoundsNavMesh, patchIndex);
             }
         }
         else if (const auto* navLink = dynamic_cast<NavLink*>(actor))
         {
-            PROFILE_CPU_NAMED("NavLink");
-
-            OffMeshLink link;
-            link.Start = navLink->GetTransform().LocalToWorld(navLink->Start);
-            Float3::Transform(link.Start, e.WorldToNavMesh, link.Start);
-            link.End = navLink->GetTransform().LocalToWorld(navLink->End);
-            Float3::Transform(link.End, e.WorldToNavMesh, link.End);
-            link.Radius = navLink->Radius;
-            link.BiDir = navLink->BiDirectional;
-            link.Id = GetHash(navLink->GetID());
-
-            e.OffMeshLinks->Add(link);
+            auto& link = e.OffMeshLinks.AddOne();
+            link.BoundsNavMesh = actorBoxNavMesh;
+            link.Link.Start = navLink->GetTransform().LocalToWorld(navLink->Start);
+            Float3::Transform(link.Link.Start, e.WorldToNavMesh, link.Link.Start);
+            link.Link.End = navLink->GetTransform().LocalToWorld(navLink->End);
+            Float3::Transform(link.Link.End, e.WorldToNavMesh, link.Link.End);
+            link.Link.Radius = navLink->Radius;
+            link.Link.BiDir = navLink->BiDirectional;
+            link.Link.Id = GetHash(navLink->GetID());
         }
         else if (const auto* navModifierVolume = dynamic_cast<NavModifierVolume*>(actor))
         {
             if (navModifierVolume->AgentsMask.IsNavMeshSupported(e.NavMesh->Properties))
             {
-                PROFILE_CPU_NAMED("NavModifierVolume");
-
-                Modifier modifier;
+                auto& modifier = e.Modifiers.AddOne();
+                modifier.BoundsNavMesh = actorBoxNavMesh;
                 OrientedBoundingBox bounds = navModifierVolume->GetOrientedBox();
                 bounds.Transform(e.WorldToNavMesh);
-                bounds.GetBoundingBox(modifier.Bounds);
-                modifier.NavArea = navModifierVolume->GetNavArea();
-
-                e.Modifiers->Add(modifier);
+                bounds.GetBoundingBox(modifier.Modifier.Bounds);
+                modifier.Modifier.NavArea = navModifierVolume->GetNavArea();
             }
         }
 
@@ -350,13 +397,46 @@ struct NavigationSceneRasterization
     }
 };
 
-void RasterizeGeometry(NavMesh* navMesh, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, rcContext* context, rcConfig* config, rcHeightfield* heightfield, Array<OffMeshLink>* offMeshLinks, Array<Modifier>* modifiers)
+void RasterizeTriangles(rcContext* context, rcHeightfield* heightfield, float walkableThreshold, const Array<Float3>& vb, const Array<int32>& ib)
+{
+    for (int32 i0 = 0; i0 < ib.Count();)
+    {
+        auto v0 = vb[ib[i0++]];
+        auto v1 = vb[ib[i0++]];
+        auto v2 = vb[ib[i0++]];
+#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
+        DEBUG_DRAW_TRIANGLE(v0, v1, v2, Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
+#endif
+
+        auto n = Float3::Cross(v0 - v1, v0 - v2);
+        n.Normalize();
+        const char area = n.Y > walkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
+        rcRasterizeTriangle(context, &v0.X, &v1.X, &v2.X, area, *heightfield);
+    }
+}
+
+void RasterizeGeometry(NavSceneGeometry* scene, const BoundingBox& tileBoundsNavMesh, rcContext* context, rcConfig* config, rcHeightfield* heightfield, Array<OffMeshLink>* offMeshLinks, Array<Modifier>* modifiers)
 {
     PROFILE_CPU_NAMED("RasterizeGeometry");
 
-    NavigationSceneRasterization rasterization(navMesh, tileBoundsNavMesh, worldToNavMesh, context, config, heightfield, offMeshLinks, modifiers);
-    Function<bool(Actor*, NavigationSceneRasterization&)> treeWalkFunction(NavigationSceneRasterization::Walk);
-    SceneQuery::TreeExecute<NavigationSceneRasterization&>(treeWalkFunction, rasterization);
+    const float walkableThreshold = Math::Cos(config->walkableSlopeAngle * DegreesToRadians);
+    for (auto& geometry : scene->Geometry)
+    {
+        if (!geometry.BoundsNavMesh.Intersects(tileBoundsNavMesh))
+            continue;
+        scene->Extract(geometry);
+        RasterizeTriangles(context, heightfield, walkableThreshold, geometry.VertexBuffer, geometry.IndexBuffer);
+    }
+    for (auto& link : scene->OffMeshLinks)
+    {
+        if (link.BoundsNavMesh.Intersects(tileBoundsNavMesh))
+            offMeshLinks->Add(link.Link);
+    }
+    for (auto& modifier : scene->Modifiers)
+    {
+        if (modifier.BoundsNavMesh.Intersects(tileBoundsNavMesh))
+            modifiers->Add(modifier.Modifier);
+    }
 }
 
 // Builds navmesh tile bounds and check if there are any valid navmesh volumes at that tile location
@@ -428,10 +508,27 @@ void RemoveTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, int
     runtime->RemoveTile(x, y, layer);
 }
 
-bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize, rcConfig& config)
+struct NavTileBuildResult
+{
+    ScriptingObjectReference<NavMesh> NavMesh;
+    Scene* Scene;
+    int32 X;
+    int32 Y;
+    int32 Layer;
+    // The built tile data (allocated by Detour) or null if tile is empty and should be removed.
+    unsigned char* Data;
+    int32 DataSize;
+};
+
+bool GenerateTile(NavSceneGeometry* scene, int32 x, int32 y, BoundingBox& tileBoundsNavMesh, rcConfig& config, NavTileBuildResult& result)
 {
     rcContext context;
     int32 layer = 0;
+    result.X = x;
+    result.Y = y;
+    result.Layer = layer;
+    result.Data = nullptr;
+    result.DataSize = 0;
 
     // Expand tile bounds by a certain margin
     const float tileBorderSize = (1.0f + (float)config.borderSize) * config.cs;
@@ -455,7 +552,7 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
 
     Array<OffMeshLink> offMeshLinks;
     Array<Modifier> modifiers;
-    RasterizeGeometry(navMesh, tileBoundsNavMesh, worldToNavMesh, &context, &config, heightfield, &offMeshLinks, &modifiers);
+    RasterizeGeometry(scene, tileBoundsNavMesh, &context, &config, heightfield, &offMeshLinks, &modifiers);
 
     rcFilterLowHangingWalkableObstacles(&context, config.walkableClimb, *heightfield);
     rcFilterLedgeSpans(&context, config.walkableHeight, config.walkableClimb, *heightfield);
@@ -549,7 +646,6 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
     if (polyMesh->nverts == 0)
     {
         // Empty tile
-        RemoveTile(navMesh, runtime, x, y, layer);
         return false;
     }
 
@@ -629,41 +725,43 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
         return true;
     }
 
-    {
-        PROFILE_CPU_NAMED("Navigation.CreateTile");
+    // Tile is added to the navmesh on a main thread
+    result.Data = navData;
+    result.DataSize = navDataSize;
+    return false;
+}
 
-        ScopeLock lock(runtime->Locker);
+void AddTile(NavMesh* navMesh, NavMeshRuntime* runtime, const NavTileBuildResult& result)
+{
+    PROFILE_CPU_NAMED("Navigation.CreateTile");
 
-        navMesh->IsDataDirty = true;
-        NavMeshTileData* tile = nullptr;
-        for (int32 i = 0; i < navMesh->Data.Tiles.Count(); i++)
-        {
-            auto& e = navMesh->Data.Tiles[i];
-            if (e.PosX == x && e.PosY == y && e.Layer == layer)
-            {
-                tile = &e;
-                break;
-            }
-        }
-        if (!tile)
+    ScopeLock lock(runtime->Locker);
+
+    navMesh->IsDataDirty = true;
+    NavMeshTileData* tile = nullptr;
+    for (int32 i = 0; i < navMesh->Data.Tiles.Count(); i++)
+    {
+        auto& e = navMesh->Data.Tiles[i];
+        if (e.PosX == result.X && e.PosY == result.Y && e.Layer == result.Layer)
         {
-            // Add new tile
-            tile = &navMesh->Data.Tiles.AddOne();
-            tile->PosX = x;
-            tile->PosY = y;
-            tile->Layer = layer;
+            tile = &e;
+            break;
         }
-
-        // Copy data to the tile
-        tile->Data.Copy(navData, navDataSize);
-
-        // Add tile to navmesh
-        runtime->AddTile(navMesh, *tile);
+    }
+    if (!tile)
+    {
+        // Add new tile
+        tile = &navMesh->Data.Tiles.AddOne();
+        tile->PosX = result.X;
+        tile->PosY = result.Y;
+        tile->Layer = result.Layer;
     }
 
-    dtFree(navData);
+    // Copy data to the tile
+    tile->Data.Copy(result.Data, result.DataSize);
 
-    return false;
+    // Add tile to navmesh
+    runtime->AddTile(navMesh, *tile);
 }
 
 float GetTileSize()
@@ -709,6 +807,7 @@ Array<BuildRequest> NavBuildQueue;
 CriticalSection NavBuildTasksLocker;
 int32 NavBuildTasksMaxCount = 0;
 Array<class NavMeshTileBuildTask*> NavBuildTasks;
+Array<NavTileBuildResult> NavBuildResults;
 
 class NavMeshTileBuildTask : public ThreadPoolTask
 {
@@ -716,11 +815,10 @@ class NavMeshTileBuildTask : public ThreadPoolTask
     Scene* Scene;
     ScriptingObjectReference<NavMesh> NavMesh;
     NavMeshRuntime* Runtime;
+    NavSceneGeometry* Geometry;
     BoundingBox TileBoundsNavMesh;
-    Matrix WorldToNavMesh;
     int32 X;
     int32 Y;
-    float TileSize;
     rcConfig Config;
 
 public:
@@ -734,20 +832,29 @@ class NavMeshTileBuildTask : public ThreadPoolTask
         {
             return false;
         }
-        if (GenerateTile(NavMesh, Runtime, X, Y, TileBoundsNavMesh, WorldToNavMesh, TileSize, Config))
+        NavTileBuildResult result;
+        result.NavMesh = navMesh;
+        result.Scene = Scene;
+        if (GenerateTile(Geometry, X, Y, TileBoundsNavMesh, Config, result))
         {
             LOG(Warning, "Failed to generate navmesh tile at {0}x{1}.", X, Y);
+            return false;
         }
 
+        // Queue tile for adding to the navmesh
+        ScopeLock lock(NavBuildTasksLocker);
+        NavBuildResults.Add(result);
         return false;
     }
 
     void OnEnd() override
     {
+        Geometry->Release();
+
         // Remove from tasks list
         ScopeLock lock(NavBuildTasksLocker);
         NavBuildTasks.Remove(this);
-        if (NavBuildTasks.IsEmpty())
+        if (NavBuildTasks.IsEmpty() && NavBuildResults.IsEmpty())
             NavBuildTasksMaxCount = 0;
     }
 };
@@ -784,6 +891,19 @@ void OnSceneUnloading(Scene* scene, const Guid& sceneId)
                 break;
         }
     }
+
+    // Discard built tiles
+    for (int32 i = NavBuildResults.Count() - 1; i >= 0; i--)
+    {
+        auto& result = NavBuildResults[i];
+        if (result.Scene == scene)
+        {
+            dtFree(result.Data);
+            NavBuildResults.RemoveAtKeepOrder(i);
+        }
+    }
+    if (NavBuildTasks.IsEmpty() && NavBuildResults.IsEmpty())
+        NavBuildTasksMaxCount = 0;
     NavBuildTasksLocker.Unlock();
 }
 
@@ -795,7 +915,7 @@ void NavMeshBuilder::Init()
 bool NavMeshBuilder::IsBuildingNavMesh()
 {
     NavBuildTasksLocker.Lock();
-    const bool hasAnyTask = NavBuildTasks.HasItems();
+    const bool hasAnyTask = NavBuildTasks.HasItems() || NavBuildResults.HasItems();
     NavBuildTasksLocker.Unlock();
 
     return hasAnyTask;
@@ -807,14 +927,14 @@ float NavMeshBuilder::GetNavMeshBuildingProgress()
     float result = 1.0f;
     if (NavBuildTasksMaxCount != 0)
     {
-        result = (float)(NavBuildTasksMaxCount - NavBuildTasks.Count()) / NavBuildTasksMaxCount;
+        result = (float)(NavBuildTasksMaxCount - NavBuildTasks.Count() - NavBuildResults.Count()) / NavBuildTasksMaxCount;
     }
     NavBuildTasksLocker.Unlock();
 
     return result;
 }
 
-void BuildTileAsync(NavMesh* navMesh, int32 x, int32 y, rcConfig& config, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize)
+void BuildTileAsync(NavMesh* navMesh, NavSceneGeometry* geometry, int32 x, int32 y, rcConfig& config, const BoundingBox& tileBoundsNavMesh)
 {
     NavMeshRuntime* runtime = navMesh->GetRuntime();
     NavBuildTasksLocker.Lock();
@@ -835,12 +955,12 @@ void BuildTileAsync(NavMesh* navMesh, int32 x, int32 y, rcConfig& config, const
     task->Scene = navMesh->GetScene();
     task->NavMesh = navMesh;
     task->Runtime = runtime;
+    task->Geometry = geometry;
     task->X = x;
     task->Y = y;
     task->TileBoundsNavMesh = tileBoundsNavMesh;
-    task->WorldToNavMesh = worldToNavMesh;
-    task->TileSize = tileSize;
     task->Config = config;
+    geometry->AddRef();
     NavBuildTasks.Add(task);
     NavBuildTasksMaxCount++;
 
@@ -877,6 +997,19 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
         rebuild |= Math::NotNearEqual(navMesh->Data.TileSize, tileSize);
         if (rebuild)
         {
+            // Discard tiles built before (not yet added)
+            NavBuildTasksLocker.Lock();
+            for (int32 i = NavBuildResults.Count() - 1; i >= 0; i--)
+            {
+                auto& result = NavBuildResults[i];
+                if (result.NavMesh == navMesh)
+                {
+                    dtFree(result.Data);
+                    NavBuildResults.RemoveAtKeepOrder(i);
+                }
+            }
+            NavBuildTasksLocker.Unlock();
+
             // Remove all tiles from navmesh runtime
             runtime->RemoveTiles(navMesh);
             runtime->SetTileSize(tileSize);
@@ -900,6 +1033,16 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
     rcConfig config;
     InitConfig(config, navMesh);
 
+    // Gather the scene geometry for the tiles (including the tiles borders)
+    BoundingBox geometryBoundsNavMesh = dirtyBoundsAligned;
+    const float tileBorderSize = (1.0f + (float)config.borderSize) * config.cs;
+    geometryBoundsNavMesh.Minimum -= tileBorderSize;
+    geometryBoundsNavMesh.Maximum += tileBorderSize;
+    geometryBoundsNavMesh.Minimum.Y = -NAV_MESH_TILE_MAX_EXTENT;
+    geometryBoundsNavMesh.Maximum.Y = NAV_MESH_TILE_MAX_EXTENT;
+    auto geometry = New<NavSceneGeometry>(navMesh, geometryBoundsNavMesh, worldToNavMesh);
+    geometry->Gather();
+
     // Generate all tiles that intersect with the navigation volume bounds
     {
         PROFILE_CPU_NAMED("StartBuildingTiles");
@@ -911,7 +1054,7 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
                 BoundingBox tileBoundsNavMesh;
                 if (GetNavMeshTileBounds(scene, navMesh, x, y, tileSize, tileBoundsNavMesh, worldToNavMesh))
                 {
-                    BuildTileAsync(navMesh, x, y, config, tileBoundsNavMesh, worldToNavMesh, tileSize);
+                    BuildTileAsync(navMesh, geometry, x, y, config, tileBoundsNavMesh);
                 }
                 else
                 {
@@ -920,6 +1063,7 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
             }
         }
     }
+    geometry->Release();
 }
 
 void BuildDirtyBounds(Scene* scene, const BoundingBox& dirtyBounds, bool rebuild)
@@ -1029,8 +1173,42 @@ void ClearNavigation(Scene* scene)
     }
 }
 
+void AddBuiltTiles()
+{
+    // Add the tiles built on a thread pool into the navmesh runtime (time-sliced to reduce stalls when building many tiles)
+    const double startTime = Platform::GetTimeSeconds();
+    NavBuildTasksLocker.Lock();
+    if (NavBuildResults.HasItems())
+    {
+        PROFILE_CPU_NAMED("AddBuiltTiles");
+        do
+        {
+            const NavTileBuildResult result = NavBuildResults[0];
+            NavBuildResults.RemoveAtKeepOrder(0);
+            NavBuildTasksLocker.Unlock();
+
+            if (auto* navMesh = result.NavMesh.Get())
+            {
+                NavMeshRuntime* runtime = navMesh->GetRuntime();
+                if (result.Data)
+                    AddTile(navMesh, runtime, result);
+                else
+                    RemoveTile(navMesh, runtime, result.X, result.Y, result.Layer);
+            }
+            dtFree(result.Data);
+
+            NavBuildTasksLocker.Lock();
+        } while (NavBuildResults.HasItems() && (Platform::GetTimeSeconds() - startTime) * 1000.0 < NAV_MESH_BUILD_ADD_TILES_TIME_BUDGET);
+        if (NavBuildTasks.IsEmpty() && NavBuildResults.IsEmpty())
+            NavBuildTasksMaxCount = 0;
+    }
+    NavBuildTasksLocker.Unlock();
+}
+
 void NavMeshBuilder::Update()
 {
+    AddBuiltTiles();
+
     ScopeLock lock(NavBuildQueueLocker);
 
     // Process nav mesh building requests and kick the tasks
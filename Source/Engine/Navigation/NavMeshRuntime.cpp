@@ -5,8 +5,10 @@
 #include "NavMesh.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Random.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshQuery.h>
 #include <ThirdParty/recastnavigation/RecastAlloc.h>
@@ -14,6 +16,8 @@
 #define MAX_NODES 2048
 #define USE_DATA_LINK 0
 #define USE_NAV_MESH_ALLOC 1
+#define PATH_REQUESTS_MAX_ACTIVE 32
+#define PATH_REQUESTS_ITERATIONS 256
 // TODO: try not using USE_NAV_MESH_ALLOC
 
 namespace
@@ -22,6 +26,152 @@ namespace
     {
         Platform::MemoryCopy(filter.m_areaCost, NavMeshRuntime::NavAreasCosts, sizeof(NavMeshRuntime::NavAreasCosts));
     }
+
+    // Converts the found path polygons into the path points (in world-space)
+    bool GetPathPoints(const dtNavMeshQuery* query, const NavMeshProperties& properties, const Vector3& startPosition, const Float3& startPositionNavMesh, Float3 endPositionNavMesh, const dtPolyRef* path, int32 pathSize, dtStatus findPathStatus, Array<Vector3, HeapAllocation>& resultPath)
+    {
+        Quaternion invRotation;
+        Quaternion::Invert(properties.Rotation, invRotation);
+
+        if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
+        {
+            // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
+            resultPath.Resize(2);
+            resultPath[0] = startPosition;
+            query->closestPointOnPolyBoundary(path[0], &endPositionNavMesh.X, &endPositionNavMesh.X);
+            resultPath[1] = endPositionNavMesh;
+            Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
+        }
+        else
+        {
+            int pathPointsCount = 0;
+            Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
+            const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
+            if (dtStatusFailed(findStraightPathStatus))
+            {
+                return false;
+            }
+            resultPath.Resize(pathPointsCount);
+            for (int32 i = 0; i < pathPointsCount; i++)
+            {
+                Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
+            }
+        }
+
+        return true;
+    }
+
+    struct NavPathRequest
+    {
+        uint32 ID;
+        int32 Priority;
+        NavPathRequestState State;
+        bool Canceled;
+        NavMeshRuntime* Runtime;
+        Vector3 StartPosition;
+        Vector3 EndPosition;
+        NavMeshRuntime::PathRequestCallback Callback;
+        Array<Vector3, HeapAllocation> Path;
+
+        // Search state (used only by the processing job)
+        NavPathRequestState Result;
+        uint32 NavMeshVersion;
+        dtNavMeshQuery* Query;
+        dtQueryFilter Filter;
+        Float3 StartPositionNavMesh;
+        Float3 EndPositionNavMesh;
+    };
+
+    CriticalSection PathRequestsLocker;
+    uint32 PathRequestsCounter = 0;
+    int64 PathRequestsLabel = 0;
+    int32 PathRequestsJobsCount = 0;
+    Dictionary<uint32, NavPathRequest*> PathRequests;
+    Array<NavPathRequest*> PathRequestsQueue; // Sorted by priority (descending)
+    Array<NavPathRequest*> PathRequestsActive;
+    Array<dtNavMeshQuery*> PathQueriesPool;
+
+    void ProcessPathRequest(NavPathRequest* request)
+    {
+        NavMeshRuntime* runtime = request->Runtime;
+        if (request->Result != NavPathRequestState::Pending)
+            return;
+        if (!runtime)
+        {
+            request->Result = NavPathRequestState::Failed;
+            return;
+        }
+        ScopeLock lock(runtime->Locker);
+        dtNavMesh* navMesh = runtime->GetNavMesh();
+        if (!navMesh)
+        {
+            request->Result = NavPathRequestState::Failed;
+            return;
+        }
+        dtNavMeshQuery* query = request->Query;
+
+        // Start the search (or restart it if navmesh has been recreated in the meantime)
+        if (request->NavMeshVersion != runtime->GetNavMeshVersion())
+        {
+            request->NavMeshVersion = runtime->GetNavMeshVersion();
+            if (dtStatusFailed(query->init(navMesh, MAX_NODES)))
+            {
+                request->Result = NavPathRequestState::Failed;
+                return;
+            }
+            InitFilter(request->Filter);
+            Float3 extent = runtime->Properties.DefaultQueryExtent;
+            Float3::Transform(request->StartPosition, runtime->Properties.Rotation, request->StartPositionNavMesh);
+            Float3::Transform(request->EndPosition, runtime->Properties.Rotation, request->EndPositionNavMesh);
+            dtPolyRef startPoly = 0;
+            query->findNearestPoly(&request->StartPositionNavMesh.X, &extent.X, &request->Filter, &startPoly, nullptr);
+            dtPolyRef endPoly = 0;
+            query->findNearestPoly(&request->EndPositionNavMesh.X, &extent.X, &request->Filter, &endPoly, nullptr);
+            if (!startPoly || !endPoly || dtStatusFailed(query->initSlicedFindPath(startPoly, endPoly, &request->StartPositionNavMesh.X, &request->EndPositionNavMesh.X, &request->Filter)))
+            {
+                request->Result = NavPathRequestState::Failed;
+                return;
+            }
+        }
+
+        // Continue the search within the iterations budget (long paths are spread over multiple updates)
+        int32 iterations = 0;
+        const dtStatus status = query->updateSlicedFindPath(PATH_REQUESTS_ITERATIONS, &iterations);
+        if (dtStatusInProgress(status))
+            return;
+        dtPolyRef path[NAV_MESH_PATH_MAX_SIZE];
+        int32 pathSize = 0;
+        const dtStatus findPathStatus = query->finalizeSlicedFindPath(path, &pathSize, NAV_MESH_PATH_MAX_SIZE);
+        if (dtStatusFailed(findPathStatus) || pathSize == 0)
+        {
+            request->Result = NavPathRequestState::Failed;
+            return;
+        }
+        const bool result = GetPathPoints(query, runtime->Properties, request->StartPosition, request->StartPositionNavMesh, request->EndPositionNavMesh, path, pathSize, findPathStatus, request->Path);
+        request->Result = result ? NavPathRequestState::Succeed : NavPathRequestState::Failed;
+    }
+
+    void ProcessPathRequestsJob(int32 jobIndex)
+    {
+        PROFILE_CPU_NAMED("NavPathRequests");
+        for (int32 i = jobIndex; i < PathRequestsActive.Count(); i += PathRequestsJobsCount)
+            ProcessPathRequest(PathRequestsActive[i]);
+    }
+
+    void WaitPathRequests()
+    {
+        if (PathRequestsLabel)
+        {
+            JobSystem::Wait(PathRequestsLabel);
+            PathRequestsLabel = 0;
+        }
+    }
+
+    void FreePathRequest(NavPathRequest* request)
+    {
+        PathRequests.Remove(request->ID);
+        Delete(request);
+    }
 }
 
 NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
@@ -30,10 +180,22 @@ NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
     _navMesh = nullptr;
     _navMeshQuery = dtAllocNavMeshQuery();
     _tileSize = 0;
+    _navMeshVersion = 1;
 }
 
 NavMeshRuntime::~NavMeshRuntime()
 {
+    // Fail the path requests that use this navmesh
+    PathRequestsLocker.Lock();
+    WaitPathRequests();
+    for (auto& e : PathRequests)
+    {
+        NavPathRequest* request = e.Value;
+        if (request->Runtime == this)
+            request->Runtime = nullptr;
+    }
+    PathRequestsLocker.Unlock();
+
     dtFreeNavMesh(_navMesh);
     dtFreeNavMeshQuery(_navMeshQuery);
 }
@@ -115,35 +277,7 @@ bool NavMeshRuntime::FindPath(const Vector3& startPosition, const Vector3& endPo
         return false;
     }
 
-    Quaternion invRotation;
-    Quaternion::Invert(Properties.Rotation, invRotation);
-
-    if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
-    {
-        // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
-        resultPath.Resize(2);
-        resultPath[0] = startPosition;
-        query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
-        resultPath[1] = endPositionNavMesh;
-        Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
-    }
-    else
-    {
-        int pathPointsCount = 0;
-        Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
-        const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
-        if (dtStatusFailed(findStraightPathStatus))
-        {
-            return false;
-        }
-        resultPath.Resize(pathPointsCount);
-        for (int32 i = 0; i < pathPointsCount; i++)
-        {
-            Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
-        }
-    }
-
-    return true;
+    return GetPathPoints(query, Properties, startPosition, startPositionNavMesh, endPositionNavMesh, path, pathSize, findPathStatus, resultPath);
 }
 
 bool NavMeshRuntime::TestPath(const Vector3& startPosition, const Vector3& endPosition) const
@@ -321,6 +455,145 @@ bool NavMeshRuntime::RayCast(const Vector3& startPosition, const Vector3& endPos
     return result;
 }
 
+uint32 NavMeshRuntime::FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, int32 priority, const PathRequestCallback& callback)
+{
+    auto request = New<NavPathRequest>();
+    request->Priority = priority;
+    request->State = NavPathRequestState::Pending;
+    request->Canceled = false;
+    request->Runtime = this;
+    request->StartPosition = startPosition;
+    request->EndPosition = endPosition;
+    request->Callback = callback;
+    request->Result = NavPathRequestState::Pending;
+    request->NavMeshVersion = 0;
+    request->Query = nullptr;
+
+    ScopeLock lock(PathRequestsLocker);
+    if (++PathRequestsCounter == 0)
+        PathRequestsCounter = 1;
+    request->ID = PathRequestsCounter;
+    PathRequests.Add(request->ID, request);
+
+    // Insert after the requests with the same or higher priority to keep the order of requests
+    int32 index = PathRequestsQueue.Count();
+    while (index > 0 && PathRequestsQueue[index - 1]->Priority < priority)
+        index--;
+    PathRequestsQueue.Insert(index, request);
+    return request->ID;
+}
+
+NavPathRequestState NavMeshRuntime::GetPathRequest(uint32 requestId, Array<Vector3, HeapAllocation>& resultPath)
+{
+    ScopeLock lock(PathRequestsLocker);
+    NavPathRequest* request;
+    if (!PathRequests.TryGet(requestId, request) || request->Canceled)
+        return NavPathRequestState::Invalid;
+    const NavPathRequestState state = request->State;
+    if (state != NavPathRequestState::Pending)
+    {
+        if (state == NavPathRequestState::Succeed)
+            resultPath.Swap(request->Path);
+        FreePathRequest(request);
+    }
+    return state;
+}
+
+void NavMeshRuntime::CancelPathRequest(uint32 requestId)
+{
+    ScopeLock lock(PathRequestsLocker);
+    NavPathRequest* request;
+    if (!PathRequests.TryGet(requestId, request))
+        return;
+    if (request->Query)
+    {
+        // Request is being processed so release it on sync
+        request->Canceled = true;
+        request->Callback.Unbind();
+        return;
+    }
+    PathRequestsQueue.Remove(request);
+    FreePathRequest(request);
+}
+
+void NavMeshRuntime::UpdatePathRequests()
+{
+    ScopeLock lock(PathRequestsLocker);
+    ASSERT(PathRequestsLabel == 0);
+
+    // Activate the queued requests with the highest priority (active requests keep searching until completed)
+    while (PathRequestsActive.Count() < PATH_REQUESTS_MAX_ACTIVE && PathRequestsQueue.HasItems())
+    {
+        NavPathRequest* request = PathRequestsQueue[0];
+        PathRequestsQueue.RemoveAtKeepOrder(0);
+        if (PathQueriesPool.HasItems())
+            request->Query = PathQueriesPool.Pop();
+        else
+            request->Query = dtAllocNavMeshQuery();
+        PathRequestsActive.Add(request);
+    }
+    if (PathRequestsActive.IsEmpty())
+        return;
+
+    // Process the requests in batches on a job system
+    PathRequestsJobsCount = Math::Min(PathRequestsActive.Count(), JobSystem::GetThreadsCount());
+    Function<void(int32)> job;
+    job.Bind<ProcessPathRequestsJob>();
+    PathRequestsLabel = JobSystem::Dispatch(job, PathRequestsJobsCount);
+}
+
+void NavMeshRuntime::SyncPathRequests()
+{
+    PathRequestsLocker.Lock();
+    WaitPathRequests();
+    if (PathRequestsActive.IsEmpty())
+    {
+        PathRequestsLocker.Unlock();
+        return;
+    }
+    PROFILE_CPU();
+
+    // Publish the completed requests
+    Array<NavPathRequest*, InlinedAllocation<PATH_REQUESTS_MAX_ACTIVE>> completed;
+    for (int32 i = PathRequestsActive.Count() - 1; i >= 0; i--)
+    {
+        NavPathRequest* request = PathRequestsActive[i];
+        if (request->Result == NavPathRequestState::Pending)
+            continue;
+        PathRequestsActive.RemoveAtKeepOrder(i);
+        PathQueriesPool.Add(request->Query);
+        request->Query = nullptr;
+        request->State = request->Result;
+        if (request->Canceled)
+            FreePathRequest(request);
+        else if (request->Callback.IsBinded())
+            completed.Add(request);
+    }
+    for (NavPathRequest* request : completed)
+        PathRequests.Remove(request->ID);
+    PathRequestsLocker.Unlock();
+
+    // Invoke the callbacks outside the lock (callback can issue a new request)
+    for (int32 i = completed.Count() - 1; i >= 0; i--)
+    {
+        NavPathRequest* request = completed[i];
+        request->Callback(request->ID, request->State, request->Path);
+        Delete(request);
+    }
+}
+
+void NavMeshRuntime::DisposePathRequests()
+{
+    ScopeLock lock(PathRequestsLocker);
+    WaitPathRequests();
+    PathRequests.ClearDelete();
+    PathRequestsQueue.Clear();
+    PathRequestsActive.Clear();
+    for (dtNavMeshQuery* query : PathQueriesPool)
+        dtFreeNavMeshQuery(query);
+    PathQueriesPool.Clear();
+}
+
 void NavMeshRuntime::SetTileSize(float tileSize)
 {
     ScopeLock lock(Locker);
@@ -334,6 +607,7 @@ void NavMeshRuntime::SetTileSize(float tileSize)
     {
         dtFreeNavMesh(_navMesh);
         _navMesh = nullptr;
+        _navMeshVersion++;
         _tiles.Clear();
     }
 
@@ -367,6 +641,7 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
 
     // Allocate new navmesh
     _navMesh = dtAllocNavMesh();
+    _navMeshVersion++;
     if (dtStatusFailed(_navMeshQuery->init(_navMesh, MAX_NODES)))
     {
         LOG(Error, "Failed to initialize navmesh {0}.", Properties.Name);
@@ -479,6 +754,12 @@ bool IsTileFromScene(const NavMeshRuntime* navMesh, const NavMeshTile& tile, voi
     return tile.NavMesh == (NavMesh*)customData;
 }
 
+bool NavMeshRuntime::HasTile(int32 x, int32 y, int32 layer) const
+{
+    ScopeLock lock(Locker);
+    return _navMesh && _navMesh->getTileAt(x, y, layer) != nullptr;
+}
+
 void NavMeshRuntime::RemoveTiles(NavMesh* navMesh)
 {
     RemoveTiles(IsTileFromScene, navMesh);
@@ -657,6 +938,7 @@ void NavMeshRuntime::Dispose()
     {
         dtFreeNavMesh(_navMesh);
         _navMesh = nullptr;
+        _navMeshVersion++;
     }
     _tiles.Resize(0);
 }
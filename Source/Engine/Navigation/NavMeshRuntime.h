@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Delegate.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "NavMeshData.h"
 #include "NavigationTypes.h"
@@ -30,6 +31,11 @@ class FLAXENGINE_API NavMeshTile
 class FLAXENGINE_API NavMeshRuntime
 {
 public:
+    /// <summary>
+    /// The callback for the asynchronous path request completion (called on a main thread). Receives the request id, the result state and the found path.
+    /// </summary>
+    typedef Function<void(uint32, NavPathRequestState, const Array<Vector3, HeapAllocation>&)> PathRequestCallback;
+
     // Gets the first valid navigation mesh runtime. Return null if none created.
     static NavMeshRuntime* Get();
 
@@ -52,6 +58,7 @@ class FLAXENGINE_API NavMeshRuntime
     dtNavMesh* _navMesh;
     dtNavMeshQuery* _navMeshQuery;
     float _tileSize;
+    uint32 _navMeshVersion;
     Array<NavMeshTile> _tiles;
 
 public:
@@ -87,6 +94,12 @@ class FLAXENGINE_API NavMeshRuntime
         return _navMeshQuery;
     }
 
+    // Gets the counter incremented every time the navmesh gets recreated or released (used to invalidate the queries using the previous navmesh).
+    FORCE_INLINE uint32 GetNavMeshVersion() const
+    {
+        return _navMeshVersion;
+    }
+
     int32 GetTilesCapacity() const;
 
 public:
@@ -149,6 +162,40 @@ class FLAXENGINE_API NavMeshRuntime
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     bool RayCast(const Vector3& startPosition, const Vector3& endPosition, NavMeshHit& hitInfo) const;
 
+public:
+    /// <summary>
+    /// Queues the asynchronous path search between the two positions. Requests are processed in batches on a job system (in order of the priority) with the sliced path search so the long paths are spread over multiple frames.
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <param name="priority">The request priority. Requests with higher priority are processed first.</param>
+    /// <param name="callback">The optional callback invoked on a main thread when path search ends. If not provided, then the result has to be taken with GetPathRequest.</param>
+    /// <returns>The request identifier (non-zero).</returns>
+    uint32 FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, int32 priority = 0, const PathRequestCallback& callback = PathRequestCallback());
+
+    /// <summary>
+    /// Gets the state of the asynchronous path request. Once the request is completed, its result is returned and the request gets released.
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    /// <param name="resultPath">The result path (valid only if method returns Succeed state).</param>
+    /// <returns>The request state.</returns>
+    static NavPathRequestState GetPathRequest(uint32 requestId, Array<Vector3, HeapAllocation>& resultPath);
+
+    /// <summary>
+    /// Cancels the asynchronous path request. The callback of the request won't be called.
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    static void CancelPathRequest(uint32 requestId);
+
+    // Starts the processing of the queued path requests (called by the navigation service on update).
+    static void UpdatePathRequests();
+
+    // Waits for the path requests processing and publishes the completed requests results (called by the navigation service on late update).
+    static void SyncPathRequests();
+
+    // Releases all the path requests.
+    static void DisposePathRequests();
+
 public:
     /// <summary>
     /// Sets the size of the tile (if not assigned). Disposes the mesh if added tiles have different size.
@@ -175,6 +222,15 @@ class FLAXENGINE_API NavMeshRuntime
     /// <param name="tileData">The tile data.</param>
     void AddTile(NavMesh* navMesh, NavMeshTileData& tileData);
 
+    /// <summary>
+    /// Checks if the navmesh contains the tile at the given location.
+    /// </summary>
+    /// <param name="x">The tile X coordinate.</param>
+    /// <param name="y">The tile Y coordinate.</param>
+    /// <param name="layer">The tile layer.</param>
+    /// <returns>True if tile has been added, otherwise false.</returns>
+    bool HasTile(int32 x, int32 y, int32 layer) const;
+
     /// <summary>
     /// Removes all the tiles from the navmesh that has been added from the given navigation scene.
     /// </summary>
@@ -8,10 +8,10 @@
 #include "Engine/Content/Content.h"
 #include "Engine/Content/JsonAsset.h"
 #include "Engine/Threading/Threading.h"
-#if USE_EDITOR
 #include "Engine/Level/Level.h"
 #include "Engine/Level/Scene/Scene.h"
-#endif
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Scripting/ScriptingObjectReference.h"
 #include "NavMesh.h"
 
 #include "Engine/Engine/EngineService.h"
@@ -20,9 +20,97 @@
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
 #include <ThirdParty/recastnavigation/RecastAlloc.h>
 
+// The interval (in seconds) between the navmesh tiles streaming updates
+#define NAV_MESH_STREAMING_UPDATE_INTERVAL 0.1
+// The maximum amount of tiles added to the navmesh during a single streaming update
+#define NAV_MESH_STREAMING_MAX_TILES_PER_UPDATE 16
+
 namespace
 {
     Array<NavMeshRuntime*, InlinedAllocation<16>> NavMeshes;
+    Array<ScriptingObjectReference<Actor>> StreamingSources;
+    double StreamingLastUpdate = 0.0;
+
+    void UpdateTilesStreaming()
+    {
+        if (!NavMesh::IsTilesStreamingEnabled())
+            return;
+        const NavigationSettings* settings = NavigationSettings::Get();
+        const double time = Platform::GetTimeSeconds();
+        if (time - StreamingLastUpdate < NAV_MESH_STREAMING_UPDATE_INTERVAL)
+            return;
+        StreamingLastUpdate = time;
+        PROFILE_CPU_NAMED("NavMeshStreaming");
+
+        // Gather streaming sources
+        Array<Vector3, InlinedAllocation<16>> sources;
+        for (int32 i = StreamingSources.Count() - 1; i >= 0; i--)
+        {
+            if (StreamingSources[i])
+                sources.Add(StreamingSources[i]->GetPosition());
+            else
+                StreamingSources.RemoveAt(i);
+        }
+        if (sources.IsEmpty())
+        {
+            Camera* camera = Camera::GetMainCamera();
+            if (!camera)
+                return;
+            sources.Add(camera->GetPosition());
+        }
+
+        // Add nearby tiles and remove the distant ones
+        int32 addBudget = NAV_MESH_STREAMING_MAX_TILES_PER_UPDATE;
+        Array<Float2, InlinedAllocation<16>> sourcesNavMesh;
+        for (Scene* scene : Level::Scenes)
+        {
+            for (NavMesh* navMesh : scene->Navigation.Meshes)
+            {
+                auto& data = navMesh->Data;
+                const float tileSize = data.TileSize;
+                if (data.Tiles.IsEmpty() || tileSize <= 0.0f)
+                    continue;
+                NavMeshRuntime* runtime = navMesh->GetRuntime();
+                const float loadDistanceSq = Math::Square(settings->TilesStreamingDistance);
+                const float unloadDistanceSq = Math::Square(settings->TilesStreamingDistance + tileSize);
+
+                // Convert sources into the navmesh space (tiles are laid on XZ plane)
+                sourcesNavMesh.Clear();
+                for (const Vector3& source : sources)
+                {
+                    Float3 sourceNavMesh;
+                    Float3::Transform(source, navMesh->Properties.Rotation, sourceNavMesh);
+                    sourcesNavMesh.Add(Float2(sourceNavMesh.X, sourceNavMesh.Z));
+                }
+
+                for (auto& tile : data.Tiles)
+                {
+                    const Float2 tileMin(tile.PosX * tileSize, tile.PosY * tileSize);
+                    const Float2 tileMax = tileMin + tileSize;
+                    float distanceSq = MAX_float;
+                    for (const Float2& source : sourcesNavMesh)
+                    {
+                        const Float2 closest = Float2::Clamp(source, tileMin, tileMax);
+                        distanceSq = Math::Min(distanceSq, Float2::DistanceSquared(source, closest));
+                    }
+                    const bool isLoaded = runtime->HasTile(tile.PosX, tile.PosY, tile.Layer);
+                    if (!isLoaded && distanceSq <= loadDistanceSq && addBudget > 0)
+                    {
+                        runtime->AddTile(navMesh, tile);
+                        addBudget--;
+                    }
+                    else if (isLoaded && distanceSq > unloadDistanceSq)
+                    {
+                        runtime->RemoveTile(tile.PosX, tile.PosY, tile.Layer);
+                    }
+                }
+            }
+        }
+
+        // Continue on the next update if the budget has been used
+        if (addBudget == 0)
+            StreamingLastUpdate = 0.0;
+    }
 }
 
 NavMeshRuntime* NavMeshRuntime::Get()
@@ -166,9 +254,8 @@ class NavigationService : public EngineService
     }
 
     bool Init() override;
-#if COMPILE_WITH_NAV_MESH_BUILDER
     void Update() override;
-#endif
+    void LateUpdate() override;
     void Dispose() override;
 };
 
@@ -226,6 +313,8 @@ void NavigationSettings::Deserialize(DeserializeStream& stream, ISerializeModifi
 {
     DESERIALIZE(AutoAddMissingNavMeshes);
     DESERIALIZE(AutoRemoveMissingNavMeshes);
+    DESERIALIZE(EnableTilesStreaming);
+    DESERIALIZE(TilesStreamingDistance);
     DESERIALIZE(CellHeight);
     DESERIALIZE(CellSize);
     DESERIALIZE(TileSize);
@@ -270,17 +359,28 @@ bool NavigationService::Init()
     return false;
 }
 
-#if COMPILE_WITH_NAV_MESH_BUILDER
-
 void NavigationService::Update()
 {
+#if COMPILE_WITH_NAV_MESH_BUILDER
     NavMeshBuilder::Update();
+#endif
+
+    UpdateTilesStreaming();
+
+    // Kick the async path requests processing (overlaps with the rest of the game update)
+    NavMeshRuntime::UpdatePathRequests();
 }
 
-#endif
+void NavigationService::LateUpdate()
+{
+    NavMeshRuntime::SyncPathRequests();
+}
 
 void NavigationService::Dispose()
 {
+    StreamingSources.Clear();
+    NavMeshRuntime::DisposePathRequests();
+
     // Release nav meshes
     for (auto navMesh : NavMeshes)
     {
@@ -305,6 +405,34 @@ bool Navigation::FindPath(const Vector3& startPosition, const Vector3& endPositi
     return NavMeshes.First()->FindPath(startPosition, endPosition, resultPath);
 }
 
+uint32 Navigation::FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, int32 priority)
+{
+    if (NavMeshes.IsEmpty())
+        return 0;
+    return NavMeshes.First()->FindPathAsync(startPosition, endPosition, priority);
+}
+
+NavPathRequestState Navigation::GetPathResult(uint32 requestId, Array<Vector3, HeapAllocation>& resultPath)
+{
+    return NavMeshRuntime::GetPathRequest(requestId, resultPath);
+}
+
+void Navigation::CancelPath(uint32 requestId)
+{
+    NavMeshRuntime::CancelPathRequest(requestId);
+}
+
+void Navigation::AddStreamingSource(Actor* actor)
+{
+    if (actor && !StreamingSources.Contains(actor))
+        StreamingSources.Add(actor);
+}
+
+void Navigation::RemoveStreamingSource(Actor* actor)
+{
+    StreamingSources.Remove(actor);
+}
+
 bool Navigation::TestPath(const Vector3& startPosition, const Vector3& endPosition)
 {
     if (NavMeshes.IsEmpty())
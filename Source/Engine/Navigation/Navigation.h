@@ -5,6 +5,7 @@
 #include "NavigationTypes.h"
 
 class Scene;
+class Actor;
 
 /// <summary>
 /// The navigation service used for path finding and agents navigation system.
@@ -31,6 +32,29 @@ API_CLASS(Static) class FLAXENGINE_API Navigation
     /// <returns>True if found valid path between given two points (it may be partial), otherwise false if failed.</returns>
     API_FUNCTION() static bool FindPath(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath);
 
+    /// <summary>
+    /// Queues the asynchronous path search between the two positions. Requests are processed in batches on a job system (in order of the priority) and the long paths are searched over multiple frames. Use GetPathResult to poll the result.
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <param name="priority">The request priority. Requests with higher priority are processed first.</param>
+    /// <returns>The request identifier, or 0 if failed (eg. no navmesh).</returns>
+    API_FUNCTION() static uint32 FindPathAsync(const Vector3& startPosition, const Vector3& endPosition, int32 priority = 0);
+
+    /// <summary>
+    /// Gets the result of the asynchronous path request. Once the request is completed, its result is returned and the request gets released (next calls return Invalid state).
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    /// <param name="resultPath">The result path (valid only if method returns Succeed state).</param>
+    /// <returns>The request state.</returns>
+    API_FUNCTION() static NavPathRequestState GetPathResult(uint32 requestId, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath);
+
+    /// <summary>
+    /// Cancels the asynchronous path request.
+    /// </summary>
+    /// <param name="requestId">The request identifier.</param>
+    API_FUNCTION() static void CancelPath(uint32 requestId);
+
     /// <summary>
     /// Tests the path between the two positions (non-partial).
     /// </summary>
@@ -72,6 +96,19 @@ API_CLASS(Static) class FLAXENGINE_API Navigation
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool RayCast(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) NavMeshHit& hitInfo);
 
+public:
+    /// <summary>
+    /// Adds the actor (eg. player or agent) used as a source for the navmesh tiles streaming. Used only when tiles streaming is enabled in Navigation Settings. If no sources are added, then the main camera is used.
+    /// </summary>
+    /// <param name="actor">The streaming source actor.</param>
+    API_FUNCTION() static void AddStreamingSource(Actor* actor);
+
+    /// <summary>
+    /// Removes the actor used as a source for the navmesh tiles streaming.
+    /// </summary>
+    /// <param name="actor">The streaming source actor.</param>
+    API_FUNCTION() static void RemoveStreamingSource(Actor* actor);
+
 public:
 #if COMPILE_WITH_NAV_MESH_BUILDER
 
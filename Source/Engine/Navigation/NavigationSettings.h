@@ -25,6 +25,18 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(110), EditorDisplay(\"Navigation\")")
     bool AutoRemoveMissingNavMeshes = true;
 
+    /// <summary>
+    /// If checked, enables the navmesh tiles streaming. Only the tiles within the streaming distance from the streaming sources (or the main camera if none added) are added to the runtime navmesh which bounds the navmesh memory usage on large worlds.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(120), EditorDisplay(\"Navigation\")")
+    bool EnableTilesStreaming = false;
+
+    /// <summary>
+    /// The distance (in world units) from the streaming sources within which the navmesh tiles are loaded. Tiles get unloaded once they are further than this distance by more than the tile size.
+    /// </summary>
+    API_FIELD(Attributes="Limit(0), EditorOrder(130), EditorDisplay(\"Navigation\"), VisibleIf(nameof(EnableTilesStreaming))")
+    float TilesStreamingDistance = 20000.0f;
+
 public:
     /// <summary>
     /// The height of a grid cell in the navigation mesh building steps using heightfields. A lower number means higher precision on the vertical axis but longer build times.
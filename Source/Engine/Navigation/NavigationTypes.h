@@ -11,6 +11,32 @@
 
 #define NAV_MESH_PATH_MAX_SIZE 200
 
+/// <summary>
+/// The state of the asynchronous navigation path request.
+/// </summary>
+API_ENUM() enum class NavPathRequestState
+{
+    /// <summary>
+    /// The request is invalid (unknown, canceled or its result has been already taken).
+    /// </summary>
+    Invalid,
+
+    /// <summary>
+    /// The request is queued or the path search is in progress.
+    /// </summary>
+    Pending,
+
+    /// <summary>
+    /// The path has been found (it may be partial).
+    /// </summary>
+    Succeed,
+
+    /// <summary>
+    /// The path search failed.
+    /// </summary>
+    Failed,
+};
+
 /// <summary>
 /// The navigation system agent properties container for navmesh building and querying.
 /// </summary>
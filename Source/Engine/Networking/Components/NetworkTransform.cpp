@@ -18,6 +18,7 @@ PACK_STRUCT(struct Data
     {
     uint8 LocalSpace : 1;
     uint8 HasSequenceIndex : 1;
+    uint8 HasTimestamp : 1;
     NetworkTransform::ReplicationComponents Components : 9;
     });
 
@@ -28,6 +29,9 @@ namespace
     // Percentage of local error that is acceptable (eg. 4 frames error)
     constexpr float Precision = 8.0f;
 
+    // Maximum amount of the buffered snapshots used for the interpolation
+    constexpr int32 MaxSnapshots = 32;
+
     template<typename T>
     FORCE_INLINE bool IsWithinPrecision(const Vector3Base<T>& currentDelta, const Vector3Base<T>& targetDelta)
     {
@@ -54,6 +58,9 @@ void NetworkTransform::OnEnable()
     // Initialize state
     _bufferHasDeltas = false;
     _currentSequenceIndex = 0;
+    _timeOffset = MAX_float;
+    _timeJitter = 0.0f;
+    _snapshotInterval = 0.0f;
     _lastFrameTransform = GetActor() ? GetActor()->GetTransform() : Transform::Identity;
     _buffer.Clear();
 
@@ -106,42 +113,46 @@ void NetworkTransform::OnUpdate()
     }
     else
     {
-        float lag = 0.0f;
-        // TODO: use lag from last used NetworkStream context
-        if (NetworkManager::Peer && NetworkManager::Peer->NetworkDriver)
-        {
-            // Use lag from the RTT between server and the client
-            const auto stats = NetworkManager::Peer->NetworkDriver->GetStats();
-            lag = stats.RTT / 2000.0f;
-        }
-        else
-        {
-            // Default lag is based on the network manager update rate
-            const float fps = NetworkManager::NetworkFPS;
-            lag = 1.0f / fps;
-        }
+        if (_buffer.Count() == 0 || _bufferHasDeltas)
+            return;
 
-        // Find the two authoritative positions surrounding the rendering timestamp
+        // Render snapshots in the past (sender time) by the adaptive delay based on the snapshots rate and the arrival jitter
         const float now = Time::Update.UnscaledTime.GetTotalSeconds();
-        const float gameTime = now - lag;
+        const float tickInterval = NetworkManager::NetworkFPS > 0.0f ? 1.0f / NetworkManager::NetworkFPS : 0.0f;
+        const float delay = Math::Max(_snapshotInterval, tickInterval) * InterpolationDelay + _timeJitter * 2.0f;
+        const float renderTime = now - _timeOffset - delay;
 
-        // Drop older positions
-        while (_buffer.Count() >= 2 && _buffer[1].Timestamp <= gameTime)
+        // Drop older snapshots (keep the last two for extrapolation)
+        while (_buffer.Count() > 2 && _buffer[1].Timestamp <= renderTime)
             _buffer.RemoveAtKeepOrder(0);
 
-        // Interpolate between the two surrounding authoritative positions
-        if (_buffer.Count() >= 2 && _buffer[0].Timestamp <= gameTime && gameTime <= _buffer[1].Timestamp)
+        if (_buffer.Count() == 1)
         {
-            const auto& b0 = _buffer[0];
-            const auto& b1 = _buffer[1];
+            if (_buffer[0].Timestamp <= renderTime)
+                Set(_buffer[0].Value);
+            return;
+        }
+        const auto& b0 = _buffer[0];
+        const auto& b1 = _buffer[1];
+        if (renderTime < b0.Timestamp)
+        {
+            // Wait for the snapshots
+        }
+        else if (renderTime <= b1.Timestamp)
+        {
+            // Interpolate between the two surrounding snapshots
             Transform transform;
-            const float alpha = (gameTime - b0.Timestamp) / (b1.Timestamp - b0.Timestamp);
+            const float alpha = (renderTime - b0.Timestamp) / Math::Max(b1.Timestamp - b0.Timestamp, ZeroTolerance);
             Transform::Lerp(b0.Value, b1.Value, alpha, transform);
             Set(transform);
         }
-        else if (_buffer.Count() == 1 && _buffer[0].Timestamp <= gameTime)
+        else
         {
-            Set(_buffer[0].Value);
+            // Extrapolate the movement from the last two snapshots (limited to prevent overshooting when snapshots are lost)
+            const float extrapolation = Math::Min(renderTime - b1.Timestamp, MaxExtrapolation);
+            Transform transform = b1.Value;
+            transform.Translation += (b1.Value.Translation - b0.Value.Translation) * (extrapolation / Math::Max(b1.Timestamp - b0.Timestamp, ZeroTolerance));
+            Set(transform);
         }
     }
 }
@@ -159,8 +170,11 @@ void NetworkTransform::Serialize(NetworkStream* stream)
     Data data;
     data.LocalSpace = LocalSpace;
     data.HasSequenceIndex = Mode == ReplicationModes::Prediction;
+    data.HasTimestamp = Mode == ReplicationModes::Interpolation;
     data.Components = Components;
     stream->Write(data);
+    if (data.HasTimestamp)
+        stream->Write(Time::Update.UnscaledTime.GetTotalSeconds());
     if (EnumHasAllFlags(data.Components, ReplicationComponents::All))
     {
         stream->Write(transform);
@@ -226,6 +240,10 @@ void NetworkTransform::Deserialize(NetworkStream* stream)
     // Decode data
     Data data;
     stream->Read(data);
+    const float now = Time::Update.UnscaledTime.GetTotalSeconds();
+    float timestamp = now;
+    if (data.HasTimestamp)
+        stream->Read(timestamp);
     if (EnumHasAllFlags(data.Components, ReplicationComponents::All))
     {
         stream->Read(transform);
@@ -331,14 +349,34 @@ void NetworkTransform::Deserialize(NetworkStream* stream)
     }
     else
     {
-        // Add to the interpolation buffer
-        const float now = Time::Update.UnscaledTime.GetTotalSeconds();
-        _buffer.Add({ now, 0, transform });
         if (_bufferHasDeltas)
         {
             _buffer.Clear();
             _bufferHasDeltas = false;
         }
+
+        // Skip duplicated or out-of-order snapshots
+        if (_buffer.HasItems() && timestamp <= _buffer.Last().Timestamp)
+            return;
+
+        // Estimate the time offset between the sender and the local clock (quickly adapt to the lower latency) and the arrival jitter
+        const float offset = now - timestamp;
+        if (_timeOffset >= MAX_float)
+            _timeOffset = offset;
+        _timeJitter = Math::Lerp(_timeJitter, Math::Abs(offset - _timeOffset), 0.1f);
+        _timeOffset = Math::Lerp(_timeOffset, offset, offset < _timeOffset ? 0.5f : 0.05f);
+
+        // Track the snapshots rate (replication rate of this object)
+        if (_buffer.HasItems())
+        {
+            const float interval = timestamp - _buffer.Last().Timestamp;
+            _snapshotInterval = _snapshotInterval > 0.0f ? Math::Lerp(_snapshotInterval, interval, 0.1f) : interval;
+        }
+
+        // Add to the interpolation buffer
+        if (_buffer.Count() == MaxSnapshots)
+            _buffer.RemoveAtKeepOrder(0);
+        _buffer.Add({ timestamp, 0, transform });
     }
 }
 
@@ -77,6 +77,9 @@ API_CLASS(Namespace="FlaxEngine.Networking") class FLAXENGINE_API NetworkTransfo
 
     bool _bufferHasDeltas;
     uint16 _currentSequenceIndex = 0;
+    float _timeOffset;
+    float _timeJitter;
+    float _snapshotInterval;
     Transform _lastFrameTransform;
     Array<BufferedItem> _buffer;
 
@@ -99,6 +102,18 @@ API_CLASS(Namespace="FlaxEngine.Networking") class FLAXENGINE_API NetworkTransfo
     API_FIELD(Attributes="EditorOrder(30)")
     ReplicationModes Mode = ReplicationModes::Default;
 
+    /// <summary>
+    /// The delay of the interpolated transform (in the amount of the received snapshots intervals). Higher values are more resistant to the packet loss and jitter but increase the latency. Used only by Interpolation mode.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(40), Limit(0, 10, 0.1f)")
+    float InterpolationDelay = 2.0f;
+
+    /// <summary>
+    /// The maximum time (in seconds) to extrapolate the transform movement when no new snapshots were received (eg. due to packet loss). Used only by Interpolation mode.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(50), Limit(0, 1, 0.01f)")
+    float MaxExtrapolation = 0.25f;
+
 private:
     API_FUNCTION(Hidden, NetworkRpc=Server) void SetSequenceIndex(uint16 value);
     
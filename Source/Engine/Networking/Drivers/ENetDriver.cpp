@@ -10,6 +10,7 @@
 #include "Engine/Networking/NetworkStats.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Threading/ThreadSpawner.h"
 #define ENET_IMPLEMENTATION
 #define _WINSOCK_DEPRECATED_NO_WARNINGS
 #include <enet/enet.h>
@@ -50,6 +51,23 @@ void SendPacketToPeer(ENetPeer* peer, const NetworkChannelType channelType, cons
     // TODO: To reduce latency, we can use `enet_host_flush` to flush all packets. Maybe some API, like NetworkManager::FlushQueues()?
 }
 
+NetworkEventType ToNetworkEventType(ENetEventType type)
+{
+    switch (type)
+    {
+    case ENET_EVENT_TYPE_CONNECT:
+        return NetworkEventType::Connected;
+    case ENET_EVENT_TYPE_DISCONNECT:
+        return NetworkEventType::Disconnected;
+    case ENET_EVENT_TYPE_DISCONNECT_TIMEOUT:
+        return NetworkEventType::Timeout;
+    case ENET_EVENT_TYPE_RECEIVE:
+        return NetworkEventType::Message;
+    default:
+        return NetworkEventType::Undefined;
+    }
+}
+
 ENetDriver::ENetDriver(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -73,6 +91,8 @@ bool ENetDriver::Initialize(NetworkPeer* host, const NetworkConfig& config)
 
 void ENetDriver::Dispose()
 {
+    StopThread();
+
     if (_peer)
         enet_peer_disconnect_now(_peer, 0);
     enet_host_destroy(_host);
@@ -106,6 +126,8 @@ bool ENetDriver::Listen()
     }
 
     LOG(Info, "Created ENet server!");
+    if (UseThread)
+        StartThread();
     return true;
 }
 
@@ -131,9 +153,12 @@ bool ENetDriver::Connect()
     {
         LOG(Error, "Failed to create ENet host!");
         enet_host_destroy(_host);
+        _host = nullptr;
         return false;
     }
 
+    if (UseThread)
+        StartThread();
     return true;
 }
 
@@ -141,6 +166,7 @@ void ENetDriver::Disconnect()
 {
     if (_peer)
     {
+        ScopeLock lock(_locker);
         enet_peer_disconnect_now(_peer, 0);
         _peer = nullptr;
         LOG(Info, "Disconnected");
@@ -153,6 +179,7 @@ void ENetDriver::Disconnect(const NetworkConnection& connection)
     ENetPeer* peer;
     if (_peerMap.TryGet(connectionId, peer))
     {
+        ScopeLock lock(_locker);
         enet_peer_disconnect_now(peer, 0);
         _peerMap.Remove(connectionId);
     }
@@ -165,70 +192,146 @@ void ENetDriver::Disconnect(const NetworkConnection& connection)
 bool ENetDriver::PopEvent(NetworkEvent* eventPtr)
 {
     ASSERT(_host);
+    if (_thread)
+    {
+        // Events are received by the network thread
+        QueuedEvent e;
+        while (_events.try_dequeue(e))
+        {
+            if (ProcessEvent(e.EventType, e.Peer, e.Packet, eventPtr))
+                return true;
+        }
+        return false;
+    }
+
     ENetEvent event;
     const int result = enet_host_service(_host, &event, 0);
     if (result < 0)
         LOG(Error, "Failed to check ENet events!");
     if (result > 0)
+        return ProcessEvent(ToNetworkEventType(event.type), event.peer, event.packet, eventPtr);
+
+    // No events
+    return false;
+}
+
+bool ENetDriver::ProcessEvent(NetworkEventType eventType, ENetPeer* peer, ENetPacket* packet, NetworkEvent* eventPtr)
+{
+    // Copy sender data
+    const uint32 connectionId = enet_peer_get_id(peer);
+    eventPtr->Sender.ConnectionId = connectionId;
+    eventPtr->EventType = eventType;
+
+    switch (eventType)
     {
-        // Copy sender data
-        const uint32 connectionId = enet_peer_get_id(event.peer);
-        eventPtr->Sender.ConnectionId = connectionId;
+    case NetworkEventType::Connected:
+        if (IsServer())
+            _peerMap.Add(connectionId, peer);
+        break;
+    case NetworkEventType::Disconnected:
+    case NetworkEventType::Timeout:
+        if (IsServer())
+            _peerMap.Remove(connectionId);
+        break;
+    case NetworkEventType::Message:
+        eventPtr->Message = _networkHost->CreateMessage();
+        eventPtr->Message.Length = packet->dataLength;
+        Platform::MemoryCopy(eventPtr->Message.Buffer, packet->data, packet->dataLength);
+        enet_packet_destroy(packet);
+        break;
+    default:
+        return false;
+    }
 
-        switch (event.type)
+    // Got event
+    return true;
+}
+
+void ENetDriver::StartThread()
+{
+    ASSERT(_thread == nullptr);
+    Platform::AtomicStore(&_threadExit, 0);
+    Function<int32()> run;
+    run.Bind<ENetDriver, &ENetDriver::ThreadRun>(this);
+    _thread = ThreadSpawner::Start(run, TEXT("ENet"), ThreadPriority::AboveNormal);
+}
+
+void ENetDriver::StopThread()
+{
+    if (!_thread)
+        return;
+    Platform::AtomicStore(&_threadExit, 1);
+    _thread->Join();
+    Delete(_thread);
+    _thread = nullptr;
+
+    // Release events that were not processed
+    QueuedEvent e;
+    while (_events.try_dequeue(e))
+    {
+        if (e.Packet)
+            enet_packet_destroy(e.Packet);
+    }
+}
+
+int32 ENetDriver::ThreadRun()
+{
+    ENetEvent event;
+    while (Platform::AtomicRead(&_threadExit) == 0)
+    {
+        {
+            // Receive all pending packets (also handles acknowledgements, resends and timeouts)
+            ScopeLock lock(_locker);
+            int result;
+            while ((result = enet_host_service(_host, &event, 0)) > 0)
+            {
+                QueuedEvent& e = _queuedEventsBuffer.AddOne();
+                e.EventType = ToNetworkEventType(event.type);
+                e.Peer = event.peer;
+                e.Packet = event.type == ENET_EVENT_TYPE_RECEIVE ? event.packet : nullptr;
+            }
+            if (result < 0)
+                LOG(Error, "Failed to check ENet events!");
+        }
+        if (_queuedEventsBuffer.HasItems())
         {
-        case ENET_EVENT_TYPE_CONNECT:
-            eventPtr->EventType = NetworkEventType::Connected;
-            if (IsServer())
-                _peerMap.Add(connectionId, event.peer);
-            break;
-        case ENET_EVENT_TYPE_DISCONNECT:
-            eventPtr->EventType = NetworkEventType::Disconnected;
-            if (IsServer())
-                _peerMap.Remove(connectionId);
-            break;
-        case ENET_EVENT_TYPE_DISCONNECT_TIMEOUT:
-            eventPtr->EventType = NetworkEventType::Timeout;
-            if (IsServer())
-                _peerMap.Remove(connectionId);
-            break;
-        case ENET_EVENT_TYPE_RECEIVE:
-            eventPtr->EventType = NetworkEventType::Message;
-            eventPtr->Message = _networkHost->CreateMessage();
-            eventPtr->Message.Length = event.packet->dataLength;
-            Platform::MemoryCopy(eventPtr->Message.Buffer, event.packet->data, event.packet->dataLength);
-            break;
-        default:
-            break;
+            _events.enqueue_bulk(_queuedEventsBuffer.Get(), _queuedEventsBuffer.Count());
+            _queuedEventsBuffer.Clear();
         }
 
-        // Got event
-        return true;
+        // Wait for the incoming data without blocking the senders on the main thread
+        enet_uint32 waitCondition = ENET_SOCKET_WAIT_RECEIVE;
+        enet_socket_wait(_host->socket, &waitCondition, 1);
     }
-
-    // No events
-    return false;
+    return 0;
 }
 
 void ENetDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message)
 {
     ASSERT(!IsServer());
+    ScopeLock lock(_locker);
     SendPacketToPeer(_peer, channelType, message);
+    if (_thread)
+        enet_host_flush(_host);
 }
 
 void ENetDriver::SendMessage(NetworkChannelType channelType, const NetworkMessage& message, NetworkConnection target)
 {
     ASSERT(IsServer());
+    ScopeLock lock(_locker);
     ENetPeer* peer;
     if (_peerMap.TryGet(target.ConnectionId, peer) && peer && peer->state == ENET_PEER_STATE_CONNECTED)
     {
         SendPacketToPeer(peer, channelType, message);
+        if (_thread)
+            enet_host_flush(_host);
     }
 }
 
 void ENetDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets)
 {
     ASSERT(IsServer());
+    ScopeLock lock(_locker);
     ENetPeer* peer;
     for (NetworkConnection target : targets)
     {
@@ -237,6 +340,8 @@ void ENetDriver::SendMessage(const NetworkChannelType channelType, const Network
             SendPacketToPeer(peer, channelType, message);
         }
     }
+    if (_thread)
+        enet_host_flush(_host);
 }
 
 NetworkDriverStats ENetDriver::GetStats()
@@ -247,6 +352,7 @@ NetworkDriverStats ENetDriver::GetStats()
 NetworkDriverStats ENetDriver::GetStats(NetworkConnection target)
 {
     NetworkDriverStats stats;
+    ScopeLock lock(_locker);
     ENetPeer* peer = _peer;
     if (!peer)
         _peerMap.TryGet(target.ConnectionId, peer);
@@ -6,7 +6,10 @@
 #include "Engine/Networking/INetworkDriver.h"
 #include "Engine/Networking/NetworkConnection.h"
 #include "Engine/Networking/NetworkConfig.h"
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Threading/ConcurrentQueue.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Scripting/ScriptingType.h"
 
@@ -16,6 +19,12 @@
 API_CLASS(Namespace="FlaxEngine.Networking", Sealed) class FLAXENGINE_API ENetDriver : public ScriptingObject, public INetworkDriver
 {
     DECLARE_SCRIPTING_TYPE(ENetDriver);
+public:
+    /// <summary>
+    /// If checked, the driver will run the ENet service loop on a dedicated network thread so packets receiving, acknowledgements and resends don't depend on the game frame rate. Incoming events are queued for the main thread and outgoing messages are flushed right away. Has to be set before starting the peer.
+    /// </summary>
+    API_FIELD() bool UseThread = false;
+
 public:
     // [INetworkDriver]
     String DriverName() override
@@ -42,10 +51,27 @@ API_CLASS(Namespace="FlaxEngine.Networking", Sealed) class FLAXENGINE_API ENetDr
         return _host != nullptr && _peer == nullptr;
     }
 
+    struct QueuedEvent
+    {
+        NetworkEventType EventType;
+        struct _ENetPeer* Peer;
+        struct _ENetPacket* Packet;
+    };
+
+    void StartThread();
+    void StopThread();
+    int32 ThreadRun();
+    bool ProcessEvent(NetworkEventType eventType, struct _ENetPeer* peer, struct _ENetPacket* packet, NetworkEvent* eventPtr);
+
 private:
     NetworkConfig _config;
     NetworkPeer* _networkHost;
     struct _ENetHost* _host = nullptr;
     struct _ENetPeer* _peer = nullptr;
     Dictionary<uint32, struct _ENetPeer*> _peerMap;
+    CriticalSection _locker;
+    class ThreadBase* _thread = nullptr;
+    volatile int64 _threadExit = 0;
+    ConcurrentQueue<QueuedEvent> _events;
+    Array<QueuedEvent> _queuedEventsBuffer;
 };
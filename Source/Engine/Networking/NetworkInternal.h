@@ -4,6 +4,9 @@
 
 #include "Types.h"
 
+struct ScriptingTypeHandle;
+struct NetworkProfilerStat;
+
 enum class NetworkMessageIDs : uint8
 {
     None = 0,
@@ -15,6 +18,7 @@ enum class NetworkMessageIDs : uint8
     ObjectDespawn,
     ObjectRole,
     ObjectRpc,
+    ObjectReplicateAck,
 
     MAX,
 };
@@ -29,8 +33,21 @@ class NetworkInternal
     static void NetworkReplicatorUpdate();
     static void OnNetworkMessageObjectReplicate(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectReplicatePart(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+    static void OnNetworkMessageObjectReplicateAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectDespawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectRole(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+
+#if COMPILE_WITH_PROFILER
+    // True if network profiler counters are collected during the current update
+    static bool ProfilerEnabled;
+    // Total amount of data bytes and messages sent during the current update
+    static uint32 ProfilerDataSent;
+    static uint32 ProfilerMessagesSent;
+    static void ProfilerBeginUpdate();
+    static void ProfileMessage(NetworkChannelType channel, uint32 size, int32 targets);
+    static NetworkProfilerStat& ProfileObjectType(const ScriptingTypeHandle& type);
+    static NetworkProfilerStat& ProfileRpc(const ScriptingTypeHandle& type, const StringAnsiView& name);
+#endif
 };
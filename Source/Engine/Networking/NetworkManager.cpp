@@ -10,6 +10,8 @@
 #include "FlaxEngine.Gen.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/Pair.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -29,6 +31,12 @@ Action NetworkManager::StateChanged;
 Delegate<NetworkClientConnectionData&> NetworkManager::ClientConnecting;
 Delegate<NetworkClient*> NetworkManager::ClientConnected;
 Delegate<NetworkClient*> NetworkManager::ClientDisconnected;
+#if COMPILE_WITH_PROFILER
+NetworkProfilerStats NetworkManager::ProfilerStats;
+bool NetworkInternal::ProfilerEnabled = false;
+uint32 NetworkInternal::ProfilerDataSent = 0;
+uint32 NetworkInternal::ProfilerMessagesSent = 0;
+#endif
 
 namespace
 {
@@ -134,9 +142,91 @@ namespace
         NetworkInternal::OnNetworkMessageObjectDespawn,
         NetworkInternal::OnNetworkMessageObjectRole,
         NetworkInternal::OnNetworkMessageObjectRpc,
+        NetworkInternal::OnNetworkMessageObjectReplicateAck,
     };
+
+#if COMPILE_WITH_PROFILER
+    Dictionary<ScriptingTypeHandle, int32> ProfilerObjectTypes;
+    Dictionary<Pair<ScriptingTypeHandle, StringAnsiView>, int32> ProfilerRpcs;
+#endif
+}
+
+#if COMPILE_WITH_PROFILER
+
+void NetworkInternal::ProfilerBeginUpdate()
+{
+    auto& stats = NetworkManager::ProfilerStats;
+    ProfilerEnabled = ProfilerCPU::Enabled;
+    ProfilerDataSent = 0;
+    ProfilerMessagesSent = 0;
+    ProfilerObjectTypes.Clear();
+    ProfilerRpcs.Clear();
+    stats.Frame = NetworkManager::Frame;
+    stats.DirtyObjects = 0;
+    stats.ReplicatedObjects = 0;
+    stats.ObjectTypes.Clear();
+    stats.Rpcs.Clear();
+    if (stats.Channels.IsEmpty())
+    {
+        stats.Channels.Resize(4);
+        stats.Channels[(int32)NetworkChannelType::Unreliable].Name = TEXT("Unreliable");
+        stats.Channels[(int32)NetworkChannelType::UnreliableOrdered].Name = TEXT("Unreliable Ordered");
+        stats.Channels[(int32)NetworkChannelType::Reliable].Name = TEXT("Reliable");
+        stats.Channels[(int32)NetworkChannelType::ReliableOrdered].Name = TEXT("Reliable Ordered");
+    }
+    for (auto& e : stats.Channels)
+    {
+        e.Count = 0;
+        e.DataSent = 0;
+        e.MessagesSent = 0;
+    }
+}
+
+void NetworkInternal::ProfileMessage(NetworkChannelType channel, uint32 size, int32 targets)
+{
+    if (!ProfilerEnabled)
+        return;
+    ProfilerDataSent += size * targets;
+    ProfilerMessagesSent += targets;
+    auto& channels = NetworkManager::ProfilerStats.Channels;
+    if ((int32)channel < channels.Count())
+    {
+        auto& e = channels[(int32)channel];
+        e.Count++;
+        e.DataSent += size * targets;
+        e.MessagesSent += targets;
+    }
+}
+
+NetworkProfilerStat& NetworkInternal::ProfileObjectType(const ScriptingTypeHandle& type)
+{
+    auto& items = NetworkManager::ProfilerStats.ObjectTypes;
+    int32 index;
+    if (!ProfilerObjectTypes.TryGet(type, index))
+    {
+        index = items.Count();
+        ProfilerObjectTypes.Add(type, index);
+        items.AddOne().Name = String(type.GetType().Fullname);
+    }
+    return items[index];
 }
 
+NetworkProfilerStat& NetworkInternal::ProfileRpc(const ScriptingTypeHandle& type, const StringAnsiView& name)
+{
+    auto& items = NetworkManager::ProfilerStats.Rpcs;
+    const Pair<ScriptingTypeHandle, StringAnsiView> key(type, name);
+    int32 index;
+    if (!ProfilerRpcs.TryGet(key, index))
+    {
+        index = items.Count();
+        ProfilerRpcs.Add(key, index);
+        items.AddOne().Name = String(type.GetType().Fullname) + TEXT("::") + String(name);
+    }
+    return items[index];
+}
+
+#endif
+
 class NetworkManagerService : public EngineService
 {
 public:
@@ -376,6 +466,9 @@ void NetworkManagerService::Update()
     PROFILE_CPU();
     LastUpdateTime = currentTime;
     NetworkManager::Frame++;
+#if COMPILE_WITH_PROFILER
+    NetworkInternal::ProfilerBeginUpdate();
+#endif
     NetworkInternal::NetworkReplicatorPreUpdate();
     // TODO: convert into TaskGraphSystems and use async jobs
 
@@ -5,6 +5,7 @@
 #include "NetworkConnection.h"
 #include "Types.h"
 #include "NetworkConnectionState.h"
+#include "NetworkStats.h"
 #include "Engine/Core/Delegate.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Scripting/ScriptingType.h"
@@ -74,6 +75,13 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     /// </summary>
     API_FIELD(ReadOnly) static uint32 Frame;
 
+#if COMPILE_WITH_PROFILER
+    /// <summary>
+    /// The network profiler counters collected during the last network update (in profiler builds when profiling is enabled).
+    /// </summary>
+    API_FIELD(ReadOnly) static NetworkProfilerStats ProfilerStats;
+#endif
+
     /// <summary>
     /// Server client identifier. Constant value of 0.
     /// </summary>
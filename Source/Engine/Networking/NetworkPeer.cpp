@@ -2,6 +2,7 @@
 
 #include "NetworkPeer.h"
 #include "NetworkEvent.h"
+#include "NetworkInternal.h"
 #include "Drivers/ENetDriver.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
@@ -169,6 +170,9 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
+#if COMPILE_WITH_PROFILER
+    NetworkInternal::ProfileMessage(channelType, message.Length, 1);
+#endif
     NetworkDriver->SendMessage(channelType, message);
 
     RecycleMessage(message);
@@ -179,6 +183,9 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
+#if COMPILE_WITH_PROFILER
+    NetworkInternal::ProfileMessage(channelType, message.Length, 1);
+#endif
     NetworkDriver->SendMessage(channelType, message, target);
 
     RecycleMessage(message);
@@ -189,6 +196,9 @@ bool NetworkPeer::EndSendMessage(const NetworkChannelType channelType, const Net
 {
     ASSERT(message.IsValid());
 
+#if COMPILE_WITH_PROFILER
+    NetworkInternal::ProfileMessage(channelType, message.Length, targets.Count());
+#endif
     NetworkDriver->SendMessage(channelType, message, targets);
 
     RecycleMessage(message);
@@ -87,7 +87,7 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
         else if (obj.ReplicationFPS < ZeroTolerance) // == 0
         {
             // Always relevant
-            result->AddObject(obj.Object);
+            result->AddObject(obj.Object, NetworkClientsMask::All, obj.Importance);
         }
         else if (obj.ReplicationUpdatesLeft > 0)
         {
@@ -107,7 +107,7 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
                     for (int32 clientIndex = 0; clientIndex < result->_clients.Count(); clientIndex++)
                     {
                         const auto& client = result->_clients[clientIndex];
-                        if (client.HasLocation)
+                        if (client.HasLocation && targetClients.HasBit(clientIndex))
                         {
                             const Real distanceSq = Vector3::DistanceSquared(objPosition, client.Location);
                             // TODO: scale down replication FPS when object is far away from all clients (eg. by 10-50%)
@@ -123,7 +123,7 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
             if (targetClients && obj.Object)
             {
                 // Replicate this frame
-                result->AddObject(obj.Object, targetClients);
+                result->AddObject(obj.Object, targetClients, obj.Importance);
             }
 
             // Calculate frames until next replication
@@ -138,6 +138,57 @@ NetworkReplicationGridNode::~NetworkReplicationGridNode()
         Delete(e.Value.Node);
 }
 
+Int3 NetworkReplicationGridNode::GetCellCoord(const Vector3& location) const
+{
+    return location / CellSize;
+}
+
+Real NetworkReplicationGridNode::GetCellDistanceSq(const Int3& coord, const Vector3& location) const
+{
+    // Cell coordinates are truncated towards zero (see GetCellCoord)
+    Real distanceSq = 0;
+    for (int32 i = 0; i < 3; i++)
+    {
+        const int32 k = coord.Raw[i];
+        const Real min = (Real)(k > 0 ? k : k - 1) * CellSize;
+        const Real max = (Real)(k < 0 ? k : k + 1) * CellSize;
+        const Real p = location.Raw[i];
+        const Real d = p < min ? min - p : (p > max ? p - max : 0);
+        distanceSq += d * d;
+    }
+    return distanceSq;
+}
+
+float NetworkReplicationGridNode::GetReplicationScale(Real distanceSq) const
+{
+    float scale = 1.0f, tierDistance = -1.0f;
+    for (const NetworkReplicationDistanceTier& tier : DistanceTiers)
+    {
+        if (tier.Distance > tierDistance && distanceSq >= Math::Square((Real)tier.Distance))
+        {
+            scale = tier.ReplicationScale;
+            tierDistance = tier.Distance;
+        }
+    }
+    return scale;
+}
+
+void NetworkReplicationGridNode::VisitCell(Cell& cell, const Int3& coord, const Vector3& location, int32 clientIndex)
+{
+    const Real distanceSq = GetCellDistanceSq(coord, location);
+    if (!cell.Unculled && distanceSq >= Math::Square((Real)cell.MaxCullDistance))
+        return;
+    if (!cell.Visible)
+    {
+        cell.Visible = true;
+        cell.MinDistanceSq = MAX_Real;
+        cell.ClientsMask = NetworkClientsMask();
+        _visibleCells.Add(&cell);
+    }
+    cell.ClientsMask.SetBit(clientIndex);
+    cell.MinDistanceSq = Math::Min(cell.MinDistanceSq, distanceSq);
+}
+
 void NetworkReplicationGridNode::AddObject(NetworkReplicationHierarchyObject obj)
 {
     // Chunk actors locations into a grid coordinates
@@ -153,12 +204,23 @@ void NetworkReplicationGridNode::AddObject(NetworkReplicationHierarchyObject obj
         // Allocate new cell
         cell = &_children[coord];
         cell->Node = New<NetworkReplicationNode>();
-        cell->MinCullDistance = obj.CullDistance;
+        cell->MaxCullDistance = 0.0f;
+        cell->Unculled = false;
+        cell->Visible = false;
     }
     cell->Node->AddObject(obj);
 
-    // Cache minimum culling distance for a whole cell to skip it at once
-    cell->MinCullDistance = Math::Min(cell->MinCullDistance, obj.CullDistance);
+    // Cache maximum culling distance for a whole cell to skip it at once (objects without culling make the cell always relevant)
+    if (obj.CullDistance > 0.0f)
+    {
+        cell->MaxCullDistance = Math::Max(cell->MaxCullDistance, obj.CullDistance);
+        _maxCullDistance = Math::Max(_maxCullDistance, obj.CullDistance);
+    }
+    else if (!cell->Unculled)
+    {
+        cell->Unculled = true;
+        _unculledCells++;
+    }
 }
 
 bool NetworkReplicationGridNode::RemoveObject(ScriptingObject* obj)
@@ -178,32 +240,86 @@ bool NetworkReplicationGridNode::RemoveObject(ScriptingObject* obj)
 void NetworkReplicationGridNode::Update(NetworkReplicationHierarchyUpdateResult* result)
 {
     CHECK(result);
-    if (result->_clientsHaveLocation)
+    if (!result->_clientsHaveLocation)
     {
-        // Update only cells within a range
-        const Real cellRadiusSq = Math::Square(CellSize * 1.414f);
+        // Brute-force over all cells
         for (const auto& e : _children)
         {
-            const Vector3 cellPosition = (e.Key * CellSize) + (CellSize * 0.5f);
-            Real distanceSq = MAX_Real;
-            for (auto& client : result->_clients)
+            e.Value.Node->Update(result);
+        }
+        return;
+    }
+
+    // Find cells relevant to each client
+    NetworkClientsMask clientsWithoutLocation;
+    _visibleCells.Clear();
+    for (int32 clientIndex = 0; clientIndex < result->_clients.Count(); clientIndex++)
+    {
+        const auto& client = result->_clients[clientIndex];
+        if (!client.HasLocation)
+        {
+            clientsWithoutLocation.SetBit(clientIndex);
+            continue;
+        }
+        const Int3 min = GetCellCoord(client.Location - _maxCullDistance);
+        const Int3 max = GetCellCoord(client.Location + _maxCullDistance);
+        const int64 neighborsCount = (int64)(max.X - min.X + 1) * (max.Y - min.Y + 1) * (max.Z - min.Z + 1);
+        if (_unculledCells != 0 || neighborsCount >= _children.Count())
+        {
+            // Check all cells if there are less of them than neighbors
+            for (auto& e : _children)
+                VisitCell(e.Value, e.Key, client.Location, clientIndex);
+        }
+        else
+        {
+            // Lookup neighbor cells within the cull distance
+            Int3 coord;
+            for (coord.Z = min.Z; coord.Z <= max.Z; coord.Z++)
             {
-                if (client.HasLocation)
-                    distanceSq = Math::Min(distanceSq, Vector3::DistanceSquared(cellPosition, client.Location));
+                for (coord.Y = min.Y; coord.Y <= max.Y; coord.Y++)
+                {
+                    for (coord.X = min.X; coord.X <= max.X; coord.X++)
+                    {
+                        if (Cell* cell = _children.TryGet(coord))
+                            VisitCell(*cell, coord, client.Location, clientIndex);
+                    }
+                }
             }
-            const Real minCullDistanceSq = Math::Square(e.Value.MinCullDistance);
-            if (distanceSq < minCullDistanceSq + cellRadiusSq)
+        }
+    }
+
+    // Update cells for the relevant clients only (with replication rate based on the distance to the nearest client)
+    const NetworkClientsMask clientsMask = result->_clientsMask;
+    const float replicationScale = result->ReplicationScale;
+    if (clientsWithoutLocation)
+    {
+        // Clients without location receive all objects
+        for (auto& e : _children)
+        {
+            Cell& cell = e.Value;
+            result->_clientsMask = clientsWithoutLocation;
+            result->ReplicationScale = replicationScale;
+            if (cell.Visible)
             {
-                e.Value.Node->Update(result);
+                result->_clientsMask.Word0 |= cell.ClientsMask.Word0;
+                result->_clientsMask.Word1 |= cell.ClientsMask.Word1;
+                result->ReplicationScale *= GetReplicationScale(cell.MinDistanceSq);
             }
+            cell.Node->Update(result);
         }
     }
     else
     {
-        // Brute-force over all cells
-        for (const auto& e : _children)
+        for (Cell* cell : _visibleCells)
         {
-            e.Value.Node->Update(result);
+            result->_clientsMask = cell->ClientsMask;
+            result->ReplicationScale = replicationScale * GetReplicationScale(cell->MinDistanceSq);
+            cell->Node->Update(result);
         }
     }
+    for (Cell* cell : _visibleCells)
+        cell->Visible = false;
+    _visibleCells.Clear();
+    result->_clientsMask = clientsMask;
+    result->ReplicationScale = replicationScale;
 }
@@ -24,6 +24,8 @@ API_STRUCT(NoDefault, Namespace = "FlaxEngine.Networking") struct FLAXENGINE_API
     API_FIELD() float ReplicationFPS = 60;
     // The minimum distance from the player to the object at which it can process replication. For example, players further away won't receive object data. Use 0 if unused.
     API_FIELD() float CullDistance = 15000;
+    // The importance of the object replication. Used to prioritize objects when client bandwidth budget is limited (see NetworkReplicator::ClientBandwidthBudget). Higher values make object replicated sooner.
+    API_FIELD() float Importance = 1.0f;
     // Runtime value for update frames left for the next replication of this object. Matches NetworkManager::NetworkFPS calculated from ReplicationFPS.
     API_FIELD(Attributes="HideInEditor") uint16 ReplicationUpdatesLeft = 0;
 
@@ -127,6 +129,7 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     {
         ScriptingObject* Object;
         NetworkClientsMask TargetClients;
+        float Importance;
     };
 
     bool _clientsHaveLocation;
@@ -146,14 +149,16 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
         Entry& e = _entries.AddOne();
         e.Object = obj;
         e.TargetClients = NetworkClientsMask::All;
+        e.Importance = 1.0f;
     }
 
-    // Adds object to the update results. Defines specific clients to receive the update (server-only, unused on client). Mask matches NetworkManager::Clients.
-    API_FUNCTION() void AddObject(ScriptingObject* obj, NetworkClientsMask targetClients)
+    // Adds object to the update results. Defines specific clients to receive the update (server-only, unused on client). Mask matches NetworkManager::Clients. Importance is used to prioritize objects when client bandwidth is limited.
+    API_FUNCTION() void AddObject(ScriptingObject* obj, NetworkClientsMask targetClients, float importance = 1.0f)
     {
         Entry& e = _entries.AddOne();
         e.Object = obj;
         e.TargetClients = targetClients;
+        e.Importance = importance;
     }
 
     // Gets amount of the clients to use. Matches NetworkManager::Clients.
@@ -222,9 +227,25 @@ inline uint32 GetHash(const Int3& key)
     return hash;
 }
 
+/// <summary>
+/// Network replication hierarchy distance-based replication rate tier.
+/// </summary>
+API_STRUCT(NoDefault, Namespace = "FlaxEngine.Networking") struct FLAXENGINE_API NetworkReplicationDistanceTier
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkReplicationDistanceTier);
+
+    // The minimum distance from the nearest client at which this tier is used.
+    API_FIELD() float Distance = 0;
+    // Scales the ReplicationFPS of the objects within this tier. For example, use 0.5 to replicate far away objects twice less often.
+    API_FIELD() float ReplicationScale = 1.0f;
+};
+
 /// <summary>
 /// Network replication hierarchy node with 3D grid spatialization. Organizes static objects into chunks to improve performance in large worlds.
 /// </summary>
+/// <remarks>
+/// Cells relevant for each client are found via lookup of the neighbor cells within the objects cull distance around the client location, so update cost scales with the amount of objects visible to the clients rather than with the total amount of objects.
+/// </remarks>
 API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkReplicationGridNode : public NetworkReplicationNode
 {
     DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(NetworkReplicationGridNode, NetworkReplicationNode);
@@ -234,10 +255,22 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     struct Cell
     {
         NetworkReplicationNode* Node;
-        float MinCullDistance;
+        float MaxCullDistance;
+        bool Unculled;
+        bool Visible;
+        Real MinDistanceSq;
+        NetworkClientsMask ClientsMask;
     };
 
     Dictionary<Int3, Cell> _children;
+    Array<Cell*> _visibleCells;
+    float _maxCullDistance = 0.0f;
+    int32 _unculledCells = 0;
+
+    Int3 GetCellCoord(const Vector3& location) const;
+    Real GetCellDistanceSq(const Int3& coord, const Vector3& location) const;
+    float GetReplicationScale(Real distanceSq) const;
+    void VisitCell(Cell& cell, const Int3& coord, const Vector3& location, int32 clientIndex);
 
 public:
     /// <summary>
@@ -245,6 +278,11 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     /// </summary>
     API_FIELD() float CellSize = 10000.0f;
 
+    /// <summary>
+    /// The replication rate tiers based on the distance from the nearest client to the cell. Cells closer than the first tier use the default replication rate.
+    /// </summary>
+    API_FIELD() Array<NetworkReplicationDistanceTier> DistanceTiers;
+
     void AddObject(NetworkReplicationHierarchyObject obj) override;
     bool RemoveObject(ScriptingObject* obj) override;
     void Update(NetworkReplicationHierarchyUpdateResult* result) override;
@@ -16,19 +16,26 @@
 #include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Collections/ChunkedArray.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Memory/FrameAllocation.h"
 #include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Time.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Level/SceneObject.h"
 #include "Engine/Level/Prefabs/Prefab.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
+#include "Engine/Level/Scene/SceneTicking.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Scripting/Script.h"
 #include "Engine/Scripting/Scripting.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/ThreadLocal.h"
+#include "Engine/Utilities/Crc.h"
 
 #if !BUILD_RELEASE
 bool NetworkReplicator::EnableLog = false;
@@ -39,6 +46,16 @@ bool NetworkReplicator::EnableLog = false;
 #else
 #define NETWORK_REPLICATOR_LOG(messageType, format, ...)
 #endif
+bool NetworkReplicator::EnableDeltaReplication = true;
+bool NetworkReplicator::EnableParallelSerialization = true;
+int32 NetworkReplicator::ClientBandwidthBudget = 0;
+
+// The amount of the recent object states kept for the delta replication (per object, indexed by the owner frame)
+#define NETWORK_REPLICATOR_BASELINES 16
+// The minimum amount of objects serialized by a single job when serializing objects in parallel
+#define NETWORK_REPLICATOR_PARALLEL_BATCH_SIZE 16
+// The distance from the client at which object replication priority is halved (when using bandwidth budget)
+#define NETWORK_REPLICATOR_PRIORITY_DISTANCE 5000.0f
 
 PACK_STRUCT(struct NetworkMessageObjectReplicate
     {
@@ -47,6 +64,8 @@ PACK_STRUCT(struct NetworkMessageObjectReplicate
     Guid ObjectId; // TODO: introduce networked-ids to synchronize unique ids as ushort (less data over network)
     Guid ParentId;
     char ObjectTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
+    uint32 BaselineFrame; // Owner frame of the state that data is delta-encoded against, or 0 for the full state
+    uint16 StateSize;
     uint16 DataSize;
     uint16 PartsCount;
     });
@@ -55,6 +74,8 @@ PACK_STRUCT(struct NetworkMessageObjectReplicatePart
     {
     NetworkMessageIDs ID = NetworkMessageIDs::ObjectReplicatePart;
     uint32 OwnerFrame;
+    uint32 BaselineFrame;
+    uint16 StateSize;
     uint16 DataSize;
     uint16 PartsCount;
     uint16 PartStart;
@@ -62,6 +83,18 @@ PACK_STRUCT(struct NetworkMessageObjectReplicatePart
     Guid ObjectId; // TODO: introduce networked-ids to synchronize unique ids as ushort (less data over network)
     });
 
+PACK_STRUCT(struct NetworkMessageObjectReplicateAck
+    {
+    NetworkMessageIDs ID = NetworkMessageIDs::ObjectReplicateAck;
+    uint16 ItemsCount;
+    });
+
+PACK_STRUCT(struct NetworkMessageObjectReplicateAckItem
+    {
+    Guid ObjectId;
+    uint32 OwnerFrame; // Received state frame, or 0 to request the full state (eg. missing baseline)
+    });
+
 PACK_STRUCT(struct NetworkMessageObjectSpawn
     {
     NetworkMessageIDs ID = NetworkMessageIDs::ObjectSpawn;
@@ -94,12 +127,16 @@ PACK_STRUCT(struct NetworkMessageObjectRole
 PACK_STRUCT(struct NetworkMessageObjectRpc
     {
     NetworkMessageIDs ID = NetworkMessageIDs::ObjectRpc;
+    uint16 ItemsCount;
+    });
+
+PACK_STRUCT(struct NetworkMessageObjectRpcItem
+    {
     Guid ObjectId;
     Guid ParentId;
-    char ObjectTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
-    char RpcTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
-    char RpcName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
+    uint32 RpcId; // Hash of the RPC type and name (see GetRpcId)
     uint16 ArgsSize;
+    uint8 ObjectTypeNameLength; // Followed by the object type name characters and then by the RPC arguments data
     });
 
 struct NetworkReplicatedObject
@@ -151,6 +188,36 @@ struct Serializer
 {
     NetworkReplicator::SerializeFunc Methods[2];
     void* Tags[2];
+    // True if serializer is implemented in native code and can be used from any thread, otherwise it runs scripting code on a main thread only.
+    bool Native;
+};
+
+struct SerializeJob
+{
+    ScriptingObject* Object;
+    NetworkReplicatedObject* Item;
+    NetworkClientsMask TargetClients;
+    NetworkClientsMask SendClients;
+    float Importance;
+    bool Deferred;
+    Serializer Method;
+    Array<byte> Data;
+#if COMPILE_WITH_PROFILER
+    double SerializeTime;
+#endif
+};
+
+struct BandwidthCandidate
+{
+    int32 JobIndex;
+    int32 ClientIndex;
+    float Priority;
+
+    bool operator<(const BandwidthCandidate& other) const
+    {
+        // Sort by client and then by priority (descending)
+        return ClientIndex < other.ClientIndex || (ClientIndex == other.ClientIndex && Priority > other.Priority);
+    }
 };
 
 struct ReplicateItem
@@ -158,11 +225,43 @@ struct ReplicateItem
     ScriptingObjectReference<ScriptingObject> Object;
     Guid ObjectId;
     uint16 PartsLeft;
+    uint16 StateSize;
     uint32 OwnerFrame;
+    uint32 BaselineFrame;
     uint32 OwnerClientId;
     Array<byte> Data;
 };
 
+struct ReplicationBaseline
+{
+    uint32 Frame = 0;
+    Array<byte> Data;
+};
+
+struct ReplicationBaselines
+{
+    // Recent states sent by the local owner
+    ReplicationBaseline Sent[NETWORK_REPLICATOR_BASELINES];
+    // Recent states received from the remote owner
+    ReplicationBaseline Received[NETWORK_REPLICATOR_BASELINES];
+    // The last acknowledged frame of the sent states per receiver client id
+    Dictionary<uint32, uint32> Acked;
+    // The last frame the state was sent at per receiver client id (used by bandwidth budget prioritization)
+    Dictionary<uint32, uint32> LastSent;
+};
+
+struct ReplicateAckItem
+{
+    Guid ObjectId;
+    uint32 OwnerFrame;
+    uint32 ClientId;
+
+    bool operator<(const ReplicateAckItem& other) const
+    {
+        return ClientId < other.ClientId;
+    }
+};
+
 struct SpawnItem
 {
     ScriptingObjectReference<ScriptingObject> Object;
@@ -175,7 +274,7 @@ struct SpawnItem
 
 struct SpawnGroup
 {
-    Array<SpawnItem*, InlinedAllocation<8>> Items;
+    Array<SpawnItem*, InlinedAllocation<8, FrameAllocation>> Items;
 };
 
 struct DespawnItem
@@ -193,6 +292,32 @@ struct RpcItem
     DataContainer<uint32> Targets;
 };
 
+struct RpcBatch
+{
+    NetworkConnection Target;
+    NetworkChannelType Channel;
+    uint16 Count;
+    Array<byte> Data;
+};
+
+struct RpcMergeKey
+{
+    ScriptingObject* Object;
+    NetworkRpcName Name;
+
+    bool operator==(const RpcMergeKey& other) const
+    {
+        return Object == other.Object && Name == other.Name;
+    }
+};
+
+inline uint32 GetHash(const RpcMergeKey& key)
+{
+    uint32 hash = GetHash(key.Object);
+    CombineHash(hash, GetHash(key.Name));
+    return hash;
+}
+
 namespace
 {
     CriticalSection ObjectsLock;
@@ -201,7 +326,19 @@ namespace
     Array<SpawnItem> SpawnQueue;
     Array<DespawnItem> DespawnQueue;
     Array<RpcItem> RpcQueue;
+    Array<RpcBatch> RpcBatches;
+    Dictionary<RpcMergeKey, int32> RpcMergeTable;
+    Dictionary<uint32, NetworkRpcName> RpcIdsTable;
+    int32 RpcIdsTableSize = -1;
     Dictionary<Guid, Guid> IdsRemappingTable;
+    Dictionary<Guid, ReplicationBaselines*> Baselines;
+    Array<ReplicateAckItem> PendingAcks;
+    Array<byte> CachedDelta;
+    Array<SerializeJob> SerializeJobs;
+    Array<int32> SerializeJobsParallel;
+    Array<NetworkStream*> SerializeStreams;
+    Array<BandwidthCandidate> BandwidthCandidates;
+    Dictionary<uint32, float> BandwidthCredits;
     NetworkStream* CachedWriteStream = nullptr;
     NetworkStream* CachedReadStream = nullptr;
     NetworkReplicationHierarchyUpdateResult* CachedReplicationResult = nullptr;
@@ -502,7 +639,7 @@ SceneObject* FindPrefabObject(Actor* a, const Guid& prefabObjectId)
     return result;
 }
 
-void SetupObjectSpawnGroupItem(ScriptingObject* obj, Array<SpawnGroup, InlinedAllocation<8>>& spawnGroups, SpawnItem& spawnItem)
+void SetupObjectSpawnGroupItem(ScriptingObject* obj, Array<SpawnGroup, InlinedAllocation<8, FrameAllocation>>& spawnGroups, SpawnItem& spawnItem)
 {
     // Check if can fit this object into any of the existing groups (eg. script which can be spawned with parent actor)
     SpawnGroup* group = nullptr;
@@ -576,6 +713,167 @@ FORCE_INLINE void DirtyObjectImpl(NetworkReplicatedObject& item, ScriptingObject
         Hierarchy->DirtyObject(obj);
 }
 
+ReplicationBaselines& GetBaselines(const Guid& objectId)
+{
+    ReplicationBaselines* baselines;
+    if (!Baselines.TryGet(objectId, baselines))
+    {
+        baselines = New<ReplicationBaselines>();
+        Baselines.Add(objectId, baselines);
+    }
+    return *baselines;
+}
+
+void RemoveBaselines(const Guid& objectId)
+{
+    ReplicationBaselines* baselines;
+    if (Baselines.TryGet(objectId, baselines))
+    {
+        Baselines.Remove(objectId);
+        Delete(baselines);
+    }
+}
+
+// Gets the frame of the baseline acknowledged by the client that can be used for the delta-encoding, or 0 if the full state has to be sent
+uint32 GetAckedBaseline(const ReplicationBaselines& baselines, uint32 clientId)
+{
+    uint32 frame;
+    if (!baselines.Acked.TryGet(clientId, frame) || frame == 0)
+        return 0;
+    return baselines.Sent[frame % NETWORK_REPLICATOR_BASELINES].Frame == frame ? frame : 0;
+}
+
+FORCE_INLINE byte GetBaselineByte(const Array<byte>& baseline, uint32 index)
+{
+    return index < (uint32)baseline.Count() ? baseline.Get()[index] : 0;
+}
+
+// Encodes the state as the XOR against the baseline (zero-padded) stored as the runs of [unchanged bytes count, changed bytes count, changed bytes], trailing unchanged bytes are skipped. Returns true if delta is not smaller than the state.
+bool EncodeDelta(const byte* state, uint32 stateSize, const Array<byte>& baseline, Array<byte>& result)
+{
+    result.Clear();
+    uint32 i = 0;
+    while (i < stateSize)
+    {
+        uint32 unchanged = 0;
+        while (i < stateSize && unchanged < MAX_uint8 && state[i] == GetBaselineByte(baseline, i))
+        {
+            unchanged++;
+            i++;
+        }
+        const uint32 start = i;
+        while (i < stateSize && i - start < MAX_uint8 && state[i] != GetBaselineByte(baseline, i))
+            i++;
+        if (i == stateSize && i == start)
+            break;
+        result.Add((byte)unchanged);
+        result.Add((byte)(i - start));
+        for (uint32 j = start; j < i; j++)
+            result.Add(state[j] ^ GetBaselineByte(baseline, j));
+        if ((uint32)result.Count() >= stateSize)
+            return true;
+    }
+    return false;
+}
+
+// Decodes the state from the delta-encoded data against the baseline. Returns true if data is invalid.
+bool DecodeDelta(const byte* data, uint32 dataSize, const Array<byte>& baseline, uint32 stateSize, Array<byte>& result)
+{
+    result.Resize(stateSize, false);
+    const uint32 baselineSize = Math::Min(stateSize, (uint32)baseline.Count());
+    Platform::MemoryCopy(result.Get(), baseline.Get(), baselineSize);
+    Platform::MemoryClear(result.Get() + baselineSize, stateSize - baselineSize);
+    uint32 pos = 0, i = 0;
+    while (pos + 2 <= dataSize)
+    {
+        const uint32 unchanged = data[pos++];
+        const uint32 changed = data[pos++];
+        i += unchanged;
+        if (i + changed > stateSize || pos + changed > dataSize)
+            return true;
+        for (uint32 j = 0; j < changed; j++)
+            result[i + j] ^= data[pos + j];
+        i += changed;
+        pos += changed;
+    }
+    return pos != dataSize;
+}
+
+FORCE_INLINE void AddReplicateAck(const Guid& objectId, uint32 ownerFrame, uint32 clientId)
+{
+    auto& ack = PendingAcks.AddOne();
+    ack.ObjectId = objectId;
+    ack.OwnerFrame = ownerFrame;
+    ack.ClientId = clientId;
+}
+
+void SendObjectReplicateMessage(NetworkPeer* peer, NetworkMessageObjectReplicate& msgData, byte* data, uint32 size, bool isClient)
+{
+    msgData.DataSize = size;
+    const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
+    const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
+    uint32 partsCount = 1;
+    uint32 dataStart = 0;
+    uint32 msgDataSize = size;
+    if (size > msgMaxData)
+    {
+        // Send msgMaxData within first message
+        msgDataSize = msgMaxData;
+        dataStart += msgMaxData;
+
+        // Send rest of the data in separate parts
+        partsCount += Math::DivideAndRoundUp(size - dataStart, partMaxData);
+    }
+    else
+        dataStart += size;
+    ASSERT(partsCount <= MAX_uint8)
+    msgData.PartsCount = partsCount;
+    NetworkMessage msg = peer->BeginSendMessage();
+    msg.WriteStructure(msgData);
+    msg.WriteBytes(data, msgDataSize);
+    if (isClient)
+        peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+    else
+        peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+
+    // Send all other parts
+    for (uint32 partIndex = 1; partIndex < partsCount; partIndex++)
+    {
+        NetworkMessageObjectReplicatePart msgDataPart;
+        msgDataPart.OwnerFrame = msgData.OwnerFrame;
+        msgDataPart.BaselineFrame = msgData.BaselineFrame;
+        msgDataPart.StateSize = msgData.StateSize;
+        msgDataPart.ObjectId = msgData.ObjectId;
+        msgDataPart.DataSize = msgData.DataSize;
+        msgDataPart.PartsCount = msgData.PartsCount;
+        msgDataPart.PartStart = dataStart;
+        msgDataPart.PartSize = Math::Min(size - dataStart, partMaxData);
+        msg = peer->BeginSendMessage();
+        msg.WriteStructure(msgDataPart);
+        msg.WriteBytes(data + msgDataPart.PartStart, msgDataPart.PartSize);
+        dataStart += msgDataPart.PartSize;
+        if (isClient)
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+        else
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+    }
+    ASSERT_LOW_LAYER(dataStart == size);
+}
+
+void SendObjectReplicateState(NetworkPeer* peer, NetworkMessageObjectReplicate& msgData, const ReplicationBaselines* baselines, uint32 baselineFrame, byte* data, uint32 size, bool isClient)
+{
+    msgData.StateSize = size;
+    msgData.BaselineFrame = 0;
+    if (baselineFrame != 0 && !EncodeDelta(data, size, baselines->Sent[baselineFrame % NETWORK_REPLICATOR_BASELINES].Data, CachedDelta))
+    {
+        // Send only the changes against the state that receiver already has
+        msgData.BaselineFrame = baselineFrame;
+        data = CachedDelta.Get();
+        size = CachedDelta.Count();
+    }
+    SendObjectReplicateMessage(peer, msgData, data, size, isClient);
+}
+
 template<typename MessageType>
 ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& msgData, uint16 partStart, uint16 partSize, uint32 senderClientId)
 {
@@ -597,6 +895,8 @@ ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& ms
         replicateItem->ObjectId = msgData.ObjectId;
         replicateItem->PartsLeft = msgData.PartsCount;
         replicateItem->OwnerFrame = msgData.OwnerFrame;
+        replicateItem->BaselineFrame = msgData.BaselineFrame;
+        replicateItem->StateSize = msgData.StateSize;
         replicateItem->OwnerClientId = senderClientId;
         replicateItem->Data.Resize(msgData.DataSize);
     }
@@ -611,7 +911,7 @@ ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& ms
     return replicateItem;
 }
 
-void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, byte* data, uint32 dataSize, uint32 senderClientId)
+void InvokeObjectReplication(NetworkReplicatedObject& item, const Guid& networkId, uint32 ownerFrame, uint32 baselineFrame, byte* data, uint32 dataSize, uint32 stateSize, uint32 senderClientId)
 {
     ScriptingObject* obj = item.Object.Get();
     if (!obj)
@@ -624,7 +924,32 @@ void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, b
     // Drop object replication if it has old data (eg. newer message was already processed due to unordered channel usage)
     if (item.LastOwnerFrame >= ownerFrame)
         return;
+
+    if (baselineFrame != 0)
+    {
+        // Reconstruct the state from the delta against the previously received state
+        ReplicationBaselines* baselines = nullptr;
+        Baselines.TryGet(item.ObjectId, baselines);
+        const ReplicationBaseline* baseline = baselines ? &baselines->Received[baselineFrame % NETWORK_REPLICATOR_BASELINES] : nullptr;
+        if (!baseline || baseline->Frame != baselineFrame || DecodeDelta(data, dataSize, baseline->Data, stateSize, CachedDelta))
+        {
+            // Missing baseline so request the full state
+            NETWORK_REPLICATOR_LOG(Warning, "[NetworkReplicator] Missing baseline {} for object {}", baselineFrame, item.ToString());
+            AddReplicateAck(networkId, 0, senderClientId);
+            return;
+        }
+        data = CachedDelta.Get();
+        dataSize = stateSize;
+    }
     item.LastOwnerFrame = ownerFrame;
+    if (NetworkReplicator::EnableDeltaReplication)
+    {
+        // Store the state as a baseline for the future deltas and let the owner know about it
+        auto& baseline = GetBaselines(item.ObjectId).Received[ownerFrame % NETWORK_REPLICATOR_BASELINES];
+        baseline.Frame = ownerFrame;
+        baseline.Data.Set(data, dataSize);
+        AddReplicateAck(networkId, ownerFrame, senderClientId);
+    }
 
     // Setup message reading stream
     if (CachedReadStream == nullptr)
@@ -674,6 +999,8 @@ void NetworkReplicator::AddSerializer(const ScriptingTypeHandle& typeHandle, con
 {
     // This assumes that C# glue code passed static method pointer (via Marshal.GetFunctionPointerForDelegate)
     AddSerializer(typeHandle, INetworkSerializable_Managed, INetworkSerializable_Managed, (void*)*(SerializeFunc*)&serialize, (void*)*(SerializeFunc*)&deserialize);
+    if (typeHandle)
+        SerializersTable[typeHandle].Native = false;
 }
 
 void RPC_Execute_Managed(ScriptingObject* obj, NetworkStream* stream, void* tag)
@@ -751,17 +1078,16 @@ void NetworkReplicator::AddSerializer(const ScriptingTypeHandle& typeHandle, Ser
 {
     if (!typeHandle)
         return;
-    const Serializer serializer{ { serialize, deserialize }, { serializeTag, deserializeTag } };
+    const Serializer serializer{ { serialize, deserialize }, { serializeTag, deserializeTag }, true };
     SerializersTable[typeHandle] = serializer;
 }
 
-bool NetworkReplicator::InvokeSerializer(const ScriptingTypeHandle& typeHandle, void* instance, NetworkStream* stream, bool serialize)
+bool GetSerializer(const ScriptingTypeHandle& typeHandle, Serializer& serializer)
 {
-    if (!typeHandle || !instance || !stream)
+    if (!typeHandle)
         return true;
 
     // Get serializers pair from table
-    Serializer serializer;
     if (!SerializersTable.TryGet(typeHandle, serializer))
     {
         // Fallback to INetworkSerializable interface (if type implements it)
@@ -772,16 +1098,27 @@ bool NetworkReplicator::InvokeSerializer(const ScriptingTypeHandle& typeHandle,
             serializer.Methods[0] = INetworkSerializable_Serialize;
             serializer.Methods[1] = INetworkSerializable_Deserialize;
             serializer.Tags[0] = serializer.Tags[1] = (void*)(intptr)interface->VTableOffset; // Pass VTableOffset to the callback
+            serializer.Native = interface->IsNative;
             SerializersTable.Add(typeHandle, serializer);
         }
         else if (const ScriptingTypeHandle baseTypeHandle = typeHandle.GetType().GetBaseType())
         {
             // Fallback to base type
-            return InvokeSerializer(baseTypeHandle, instance, stream, serialize);
+            return GetSerializer(baseTypeHandle, serializer);
         }
         else
             return true;
     }
+    return false;
+}
+
+bool NetworkReplicator::InvokeSerializer(const ScriptingTypeHandle& typeHandle, void* instance, NetworkStream* stream, bool serialize)
+{
+    if (!instance || !stream)
+        return true;
+    Serializer serializer;
+    if (GetSerializer(typeHandle, serializer))
+        return true;
 
     // Invoke serializer
     const byte idx = serialize ? 0 : 1;
@@ -849,6 +1186,7 @@ void NetworkReplicator::RemoveObject(ScriptingObject* obj)
     NETWORK_REPLICATOR_LOG(Info, "[NetworkReplicator] Remove object {}, owned by {}", obj->GetID().ToString(), it->Item.ParentId.ToString());
     if (Hierarchy && it->Item.Role == NetworkObjectRole::OwnedAuthoritative)
         Hierarchy->RemoveObject(obj);
+    RemoveBaselines(it->Item.ObjectId);
     Objects.Remove(it);
 }
 
@@ -920,6 +1258,7 @@ void NetworkReplicator::DespawnObject(ScriptingObject* obj)
         item.AsNetworkObject->OnNetworkDespawn();
     if (Hierarchy && item.Role == NetworkObjectRole::OwnedAuthoritative)
         Hierarchy->RemoveObject(obj);
+    RemoveBaselines(item.ObjectId);
     Objects.Remove(it);
     DeleteNetworkObject(obj);
 }
@@ -1150,6 +1489,12 @@ void NetworkInternal::NetworkReplicatorClientDisconnected(NetworkClient* client)
 
     // Remove any objects owned by that client
     const uint32 clientId = client->ClientId;
+    for (auto& e : Baselines)
+    {
+        e.Value->Acked.Remove(clientId);
+        e.Value->LastSent.Remove(clientId);
+    }
+    BandwidthCredits.Remove(clientId);
     for (auto it = Objects.Begin(); it.IsNotEnd(); ++it)
     {
         auto& item = it->Item;
@@ -1168,6 +1513,7 @@ void NetworkInternal::NetworkReplicatorClientDisconnected(NetworkClient* client)
             if (item.AsNetworkObject)
                 item.AsNetworkObject->OnNetworkDespawn();
             DeleteNetworkObject(obj);
+            RemoveBaselines(item.ObjectId);
             Objects.Remove(it);
         }
     }
@@ -1194,9 +1540,22 @@ void NetworkInternal::NetworkReplicatorClear()
         }
     }
     RpcQueue.Clear();
+    RpcBatches.Clear();
+    RpcIdsTable.Clear();
+    RpcIdsTableSize = -1;
     SpawnQueue.Clear();
     DespawnQueue.Clear();
     IdsRemappingTable.Clear();
+    Baselines.ClearDelete();
+    PendingAcks.Clear();
+    SerializeJobs.Clear();
+    SerializeJobsParallel.Clear();
+    for (NetworkStream* stream : SerializeStreams)
+        Delete(stream);
+    SerializeStreams.Clear();
+    BandwidthCandidates.Clear();
+    BandwidthCredits.Clear();
+    CachedDelta.SetCapacity(0, false);
     SAFE_DELETE(CachedWriteStream);
     SAFE_DELETE(CachedReadStream);
     SAFE_DELETE(CachedReplicationResult);
@@ -1211,9 +1570,192 @@ void NetworkInternal::NetworkReplicatorPreUpdate()
     Scripting::ObjectsLookupIdMapping.Set(&IdsRemappingTable);
 }
 
+// Gets the RPC identifier used over the network (stable across the peers that registered the same RPCs)
+uint32 GetRpcId(const NetworkRpcName& name)
+{
+    const StringAnsiView& typeName = name.First.GetType().Fullname;
+    const char separator = ':';
+    uint32 id = Crc::MemCrc32(typeName.Get(), typeName.Length());
+    id = Crc::MemCrc32(&separator, 1, id);
+    return Crc::MemCrc32(name.Second.Get(), name.Second.Length(), id);
+}
+
+const NetworkRpcName* FindRpc(uint32 id)
+{
+    const NetworkRpcName* name = RpcIdsTable.TryGet(id);
+    if (RpcIdsTableSize != NetworkRpcInfo::RPCsTable.Count() || (name && !NetworkRpcInfo::RPCsTable.ContainsKey(*name)))
+    {
+        // Rebuild the lookup after RPCs registration changes (eg. scripts reload)
+        RpcIdsTableSize = NetworkRpcInfo::RPCsTable.Count();
+        RpcIdsTable.Clear();
+        for (const auto& e : NetworkRpcInfo::RPCsTable)
+        {
+            const uint32 rpcId = GetRpcId(e.Key);
+#if USE_NETWORK_REPLICATOR_LOG
+            if (const NetworkRpcName* other = RpcIdsTable.TryGet(rpcId))
+                LOG(Error, "[NetworkReplicator] RPC {}::{} has the same network id as RPC {}::{}", e.Key.First.ToString(), String(e.Key.Second), other->First.ToString(), String(other->Second));
+#endif
+            RpcIdsTable[rpcId] = e.Key;
+        }
+        name = RpcIdsTable.TryGet(id);
+    }
+    return name;
+}
+
+void SendRpcBatch(NetworkPeer* peer, RpcBatch& batch, bool isClient)
+{
+    if (batch.Count == 0)
+        return;
+    NetworkMessageObjectRpc msgData;
+    msgData.ItemsCount = batch.Count;
+    NetworkMessage msg = peer->BeginSendMessage();
+    msg.WriteStructure(msgData);
+    msg.WriteBytes(batch.Data.Get(), batch.Data.Count());
+    if (isClient)
+        peer->EndSendMessage(batch.Channel, msg);
+    else
+        peer->EndSendMessage(batch.Channel, msg, batch.Target);
+    batch.Count = 0;
+    batch.Data.Clear();
+}
+
+void AddRpcToBatch(NetworkPeer* peer, const NetworkConnection& target, NetworkChannelType channel, const NetworkMessageObjectRpcItem& msgDataItem, const char* objectTypeName, const BytesContainer& args, bool isClient)
+{
+    // Find batch for that target and channel
+    RpcBatch* batch = nullptr;
+    for (RpcBatch& e : RpcBatches)
+    {
+        if (e.Channel == channel && (isClient || e.Target == target))
+        {
+            batch = &e;
+            break;
+        }
+    }
+    if (!batch)
+    {
+        batch = &RpcBatches.AddOne();
+        batch->Target = target;
+        batch->Channel = channel;
+        batch->Count = 0;
+    }
+
+    // Send the batch if it's full
+    const uint32 size = sizeof(msgDataItem) + msgDataItem.ObjectTypeNameLength + msgDataItem.ArgsSize;
+    if (batch->Count != 0 && (batch->Count == MAX_uint16 || sizeof(NetworkMessageObjectRpc) + batch->Data.Count() + size > peer->Config.MessageSize))
+        SendRpcBatch(peer, *batch, isClient);
+
+    batch->Data.Add((const byte*)&msgDataItem, sizeof(msgDataItem));
+    batch->Data.Add((const byte*)objectTypeName, msgDataItem.ObjectTypeNameLength);
+    batch->Data.Add(args.Get(), args.Length());
+    batch->Count++;
+}
+
+bool IsObjectTarget(const NetworkReplicatedObject& item, const NetworkClient* client)
+{
+    if (client->State != NetworkConnectionState::Connected || client->ClientId == item.OwnerClientId)
+        return false;
+    if (!item.TargetClientIds.IsValid())
+        return true;
+    for (int32 i = 0; i < item.TargetClientIds.Length(); i++)
+    {
+        if (item.TargetClientIds[i] == client->ClientId)
+            return true;
+    }
+    return false;
+}
+
+void ApplyBandwidthBudget(int32 jobsCount)
+{
+    PROFILE_CPU();
+    const auto& clients = NetworkManager::Clients;
+    const int32 clientsLocationsCount = CachedReplicationResult->GetClientsCount();
+    const float deltaTime = NetworkManager::NetworkFPS > 0 ? 1.0f / NetworkManager::NetworkFPS : (float)Time::Update.UnscaledDeltaTime.GetTotalSeconds();
+    const float frameBudget = (float)NetworkReplicator::ClientBandwidthBudget * deltaTime;
+
+    // Calculate objects priority for each client (grows with the time since the last send, higher for important and nearby objects)
+    BandwidthCandidates.Clear();
+    for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+    {
+        SerializeJob& job = SerializeJobs[jobIndex];
+        job.SendClients = NetworkClientsMask();
+        job.Deferred = false;
+        const NetworkReplicatedObject& item = *job.Item;
+        const ReplicationBaselines& state = GetBaselines(item.ObjectId);
+        const Actor* actor = NetworkReplicationHierarchyObject(job.Object).GetActor();
+        for (int32 clientIndex = 0; clientIndex < clients.Count(); clientIndex++)
+        {
+            const NetworkClient* client = clients.Get()[clientIndex];
+            if (!job.TargetClients.HasBit(clientIndex) || !IsObjectTarget(item, client))
+                continue;
+            uint32 lastSent = 0;
+            state.LastSent.TryGet(client->ClientId, lastSent);
+            float priority = job.Importance * (float)(NetworkManager::Frame - lastSent);
+            Vector3 clientLocation;
+            if (actor && clientIndex < clientsLocationsCount && CachedReplicationResult->GetClientLocation(clientIndex, clientLocation))
+            {
+                const float distance = (float)Vector3::Distance(actor->GetPosition(), clientLocation);
+                priority /= 1.0f + distance / NETWORK_REPLICATOR_PRIORITY_DISTANCE;
+            }
+            auto& candidate = BandwidthCandidates.AddOne();
+            candidate.JobIndex = jobIndex;
+            candidate.ClientIndex = clientIndex;
+            candidate.Priority = priority;
+        }
+    }
+    Sorting::QuickSort(BandwidthCandidates.Get(), BandwidthCandidates.Count());
+
+    // Pick the highest priority objects for each client up to its budget
+    int32 clientIndex = -1;
+    float* credit = nullptr;
+    for (const BandwidthCandidate& candidate : BandwidthCandidates)
+    {
+        const NetworkClient* client = clients.Get()[candidate.ClientIndex];
+        if (candidate.ClientIndex != clientIndex)
+        {
+            // Accumulate budget over updates (limited to prevent bursts)
+            clientIndex = candidate.ClientIndex;
+            credit = &BandwidthCredits[client->ClientId];
+            *credit = Math::Min(*credit + frameBudget, frameBudget * 2.0f);
+        }
+        SerializeJob& job = SerializeJobs[candidate.JobIndex];
+        if (*credit <= 0.0f)
+        {
+            // Out of budget so send it later
+            job.Deferred = true;
+            continue;
+        }
+
+        // Use the full state size (delta-encoded data can be smaller) and allow to exceed the budget with the last object (paid back in the next updates)
+        *credit -= (float)job.Data.Count();
+        job.SendClients.SetBit(candidate.ClientIndex);
+        GetBaselines(job.Item->ObjectId).LastSent[client->ClientId] = NetworkManager::Frame;
+    }
+    for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+    {
+        SerializeJob& job = SerializeJobs[jobIndex];
+        job.TargetClients = job.SendClients;
+        if (job.Deferred)
+            DirtyObjectImpl(*job.Item, job.Object);
+    }
+}
+
+void SerializeObject(SerializeJob& job, NetworkStream* stream)
+{
+#if COMPILE_WITH_PROFILER
+    const double startTime = NetworkInternal::ProfilerEnabled ? Platform::GetTimeSeconds() : 0.0;
+#endif
+    stream->Initialize();
+    job.Method.Methods[0](job.Object, stream, job.Method.Tags[0]);
+    job.Data.Set(stream->GetBuffer(), (int32)stream->GetPosition());
+#if COMPILE_WITH_PROFILER
+    job.SerializeTime = NetworkInternal::ProfilerEnabled ? Platform::GetTimeSeconds() - startTime : 0.0;
+#endif
+}
+
 void NetworkInternal::NetworkReplicatorUpdate()
 {
     PROFILE_CPU();
+    PROFILE_MEM(Networking);
     ScopeLock lock(ObjectsLock);
     if (Objects.Count() == 0)
         return;
@@ -1228,7 +1770,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
         PROFILE_CPU_NAMED("NewClients");
         // TODO: try iterative loop over several frames to reduce both server and client perf-spikes in case of large amount of spawned objects
         ChunkedArray<SpawnItem, 256> spawnItems;
-        Array<SpawnGroup, InlinedAllocation<8>> spawnGroups;
+        Array<SpawnGroup, InlinedAllocation<8, FrameAllocation>> spawnGroups;
         for (auto it = Objects.Begin(); it.IsNotEnd(); ++it)
         {
             auto& item = it->Item;
@@ -1307,7 +1849,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
 
         // Batch spawned objects into groups (eg. player actor with scripts and child actors merged as a single spawn message)
         // That's because NetworkReplicator::SpawnObject can be called in separate for different actors/scripts of a single prefab instance but we want to spawn it at once over the network
-        Array<SpawnGroup, InlinedAllocation<8>> spawnGroups;
+        Array<SpawnGroup, InlinedAllocation<8, FrameAllocation>> spawnGroups;
         for (SpawnItem& e : SpawnQueue)
         {
             ScriptingObject* obj = e.Object.Get();
@@ -1388,7 +1930,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     auto& item = it->Item;
 
                     // Replicate from all collected parts data
-                    InvokeObjectReplication(item, e.OwnerFrame, e.Data.Get(), e.Data.Count(), e.OwnerClientId);
+                    InvokeObjectReplication(item, e.ObjectId, e.OwnerFrame, e.BaselineFrame, e.Data.Get(), e.Data.Count(), e.StateSize, e.OwnerClientId);
                 }
             }
 
@@ -1396,6 +1938,42 @@ void NetworkInternal::NetworkReplicatorUpdate()
         }
     }
 
+    // Acknowledge received objects states to their owners (used as baselines for the delta replication)
+    if (PendingAcks.Count() != 0)
+    {
+        PROFILE_CPU_NAMED("ReplicationAcks");
+        Sorting::QuickSort(PendingAcks.Get(), PendingAcks.Count());
+        const int32 maxItems = (int32)((peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicateAck)) / sizeof(NetworkMessageObjectReplicateAckItem));
+        for (int32 start = 0; start < PendingAcks.Count();)
+        {
+            const uint32 clientId = PendingAcks[start].ClientId;
+            int32 end = start + 1;
+            while (end < PendingAcks.Count() && PendingAcks[end].ClientId == clientId && end - start < maxItems)
+                end++;
+            NetworkClient* target = isClient ? nullptr : NetworkManager::GetClient(clientId);
+            if (isClient || target)
+            {
+                NetworkMessageObjectReplicateAck msgData;
+                msgData.ItemsCount = (uint16)(end - start);
+                NetworkMessage msg = peer->BeginSendMessage();
+                msg.WriteStructure(msgData);
+                for (int32 i = start; i < end; i++)
+                {
+                    NetworkMessageObjectReplicateAckItem msgDataItem;
+                    msgDataItem.ObjectId = PendingAcks[i].ObjectId;
+                    msgDataItem.OwnerFrame = PendingAcks[i].OwnerFrame;
+                    msg.WriteStructure(msgDataItem);
+                }
+                if (isClient)
+                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+                else
+                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg, target->Connection);
+            }
+            start = end;
+        }
+        PendingAcks.Clear();
+    }
+
     // Replicate all owned networked objects with other clients or server
     if (!CachedReplicationResult)
         CachedReplicationResult = New<NetworkReplicationHierarchyUpdateResult>();
@@ -1409,6 +1987,17 @@ void NetworkInternal::NetworkReplicatorUpdate()
         // Tick using hierarchy
         PROFILE_CPU_NAMED("ReplicationHierarchyUpdate");
         Hierarchy->Update(CachedReplicationResult);
+
+        // Use the clients locations as viewers for the scripts update throttling
+        if (!isClient && CachedReplicationResult->_clientsHaveLocation)
+        {
+            SceneTicking::ViewerLocations.Clear();
+            for (const auto& client : CachedReplicationResult->_clients)
+            {
+                if (client.HasLocation)
+                    SceneTicking::ViewerLocations.Add(client.Location);
+            }
+        }
     }
     else
     {
@@ -1422,6 +2011,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
             {
                 // Object got deleted
                 NETWORK_REPLICATOR_LOG(Info, "[NetworkReplicator] Remove object {}, owned by {}", item.ToString(), item.ParentId.ToString());
+                RemoveBaselines(item.ObjectId);
                 Objects.Remove(it);
                 continue;
             }
@@ -1433,11 +2023,13 @@ void NetworkInternal::NetworkReplicatorUpdate()
     if (CachedReplicationResult->_entries.HasItems())
     {
         PROFILE_CPU_NAMED("Replication");
-        if (CachedWriteStream == nullptr)
-            CachedWriteStream = New<NetworkStream>();
-        NetworkStream* stream = CachedWriteStream;
-        stream->SenderId = NetworkManager::LocalClientId;
-        // TODO: use Job System when replicated objects count is large
+#if COMPILE_WITH_PROFILER
+        NetworkManager::ProfilerStats.DirtyObjects += CachedReplicationResult->_entries.Count();
+#endif
+
+        // Collect objects to serialize
+        int32 jobsCount = 0;
+        SerializeJobsParallel.Clear();
         for (auto& e : CachedReplicationResult->_entries)
         {
             ScriptingObject* obj = e.Object;
@@ -1454,20 +2046,87 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     continue;
             }
 
+            Serializer serializer;
+            if (GetSerializer(obj->GetTypeHandle(), serializer))
+            {
+                //NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot serialize object {} of type {} (missing serialization logic)", item.ToString(), obj->GetType().ToString());
+                continue;
+            }
+
             if (item.AsNetworkObject)
                 item.AsNetworkObject->OnNetworkSerialize();
 
-            // Serialize object
-            stream->Initialize();
-            const bool failed = NetworkReplicator::InvokeSerializer(obj->GetTypeHandle(), obj, stream, true);
-            if (failed)
+            if (jobsCount == SerializeJobs.Count())
+                SerializeJobs.AddOne();
+            SerializeJob& job = SerializeJobs[jobsCount++];
+            job.Object = obj;
+            job.Item = &item;
+            job.TargetClients = e.TargetClients;
+            job.Importance = e.Importance;
+            job.Method = serializer;
+            if (serializer.Native)
+                SerializeJobsParallel.Add(jobsCount - 1);
+        }
+
+        // Serialize objects (native serializers can run on Job System, scripting serializers run on a main thread)
+        const int32 parallelCount = SerializeJobsParallel.Count();
+        const int32 parallelChunks = NetworkReplicator::EnableParallelSerialization ? Math::Min(JobSystem::GetThreadsCount(), parallelCount / NETWORK_REPLICATOR_PARALLEL_BATCH_SIZE) : 0;
+        int64 parallelLabel = 0;
+        if (parallelChunks > 1)
+        {
+            PROFILE_CPU_NAMED("Parallel");
+            while (SerializeStreams.Count() < parallelChunks)
+                SerializeStreams.Add(New<NetworkStream>());
+            Function<void(int32)> serializeJob = [parallelCount, parallelChunks](int32 chunkIndex)
             {
-                //NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot serialize object {} of type {} (missing serialization logic)", item.ToString(), obj->GetType().ToString());
+                PROFILE_CPU_NAMED("NetworkSerialize");
+                NetworkStream* stream = SerializeStreams[chunkIndex];
+                stream->SenderId = NetworkManager::LocalClientId;
+                Scripting::ObjectsLookupIdMapping.Set(&IdsRemappingTable);
+                for (int32 i = chunkIndex; i < parallelCount; i += parallelChunks)
+                {
+                    SerializeObject(SerializeJobs.Get()[SerializeJobsParallel.Get()[i]], stream);
+                }
+                Scripting::ObjectsLookupIdMapping.Set(nullptr);
+            };
+            parallelLabel = JobSystem::Dispatch(serializeJob, parallelChunks);
+        }
+        if (CachedWriteStream == nullptr)
+            CachedWriteStream = New<NetworkStream>();
+        NetworkStream* stream = CachedWriteStream;
+        stream->SenderId = NetworkManager::LocalClientId;
+        for (int32 i = 0; i < jobsCount; i++)
+        {
+            SerializeJob& job = SerializeJobs[i];
+            if (parallelLabel != 0 && job.Method.Native)
                 continue;
-            }
+            SerializeObject(job, stream);
+        }
+        if (parallelLabel != 0)
+            JobSystem::Wait(parallelLabel);
+
+        // Limit the replication data sent to each client to the bandwidth budget
+        if (!isClient && NetworkReplicator::ClientBandwidthBudget > 0)
+            ApplyBandwidthBudget(jobsCount);
 
-            // Send object to clients
-            const uint32 size = stream->GetPosition();
+        // Send objects to clients
+        for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+        {
+            SerializeJob& job = SerializeJobs[jobIndex];
+            ScriptingObject* obj = job.Object;
+            auto& item = *job.Item;
+            if (!isClient)
+            {
+                BuildCachedTargets(item, job.TargetClients);
+                if (CachedTargets.Count() == 0)
+                    continue;
+            }
+#if COMPILE_WITH_PROFILER
+            const uint32 profilerDataSent = ProfilerDataSent;
+            const uint32 profilerMessagesSent = ProfilerMessagesSent;
+#endif
+            byte* data = job.Data.Get();
+            const uint32 size = job.Data.Count();
             ASSERT(size <= MAX_uint16)
             NetworkMessageObjectReplicate msgData;
             msgData.OwnerFrame = NetworkManager::Frame;
@@ -1480,63 +2139,99 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
             }
             GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
-            msgData.DataSize = size;
-            const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
-            const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
-            uint32 partsCount = 1;
-            uint32 dataStart = 0;
-            uint32 msgDataSize = size;
-            if (size > msgMaxData)
+            if (!NetworkReplicator::EnableDeltaReplication)
             {
-                // Send msgMaxData within first message
-                msgDataSize = msgMaxData;
-                dataStart += msgMaxData;
-
-                // Send rest of the data in separate parts
-                partsCount += Math::DivideAndRoundUp(size - dataStart, partMaxData);
+                SendObjectReplicateState(peer, msgData, nullptr, 0, data, size, isClient);
             }
             else
-                dataStart += size;
-            ASSERT(partsCount <= MAX_uint8)
-            msgData.PartsCount = partsCount;
-            NetworkMessage msg = peer->BeginSendMessage();
-            msg.WriteStructure(msgData);
-            msg.WriteBytes(stream->GetBuffer(), msgDataSize);
-            if (isClient)
-                peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
-            else
-                peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
-
-            // Send all other parts
-            for (uint32 partIndex = 1; partIndex < partsCount; partIndex++)
             {
-                NetworkMessageObjectReplicatePart msgDataPart;
-                msgDataPart.OwnerFrame = msgData.OwnerFrame;
-                msgDataPart.ObjectId = msgData.ObjectId;
-                msgDataPart.DataSize = msgData.DataSize;
-                msgDataPart.PartsCount = msgData.PartsCount;
-                msgDataPart.PartStart = dataStart;
-                msgDataPart.PartSize = Math::Min(size - dataStart, partMaxData);
-                msg = peer->BeginSendMessage();
-                msg.WriteStructure(msgDataPart);
-                msg.WriteBytes(stream->GetBuffer() + msgDataPart.PartStart, msgDataPart.PartSize);
-                dataStart += msgDataPart.PartSize;
+                ReplicationBaselines& baselines = GetBaselines(item.ObjectId);
                 if (isClient)
-                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+                {
+                    SendObjectReplicateState(peer, msgData, &baselines, GetAckedBaseline(baselines, NetworkManager::ServerClientId), data, size, isClient);
+                }
                 else
-                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+                {
+                    // Group clients by the acknowledged baseline to encode state only once per baseline
+                    Array<NetworkConnection, InlinedAllocation<16, FrameAllocation>> targets;
+                    Array<uint32, InlinedAllocation<16, FrameAllocation>> targetsBaselines;
+                    targets.Add(CachedTargets.Get(), CachedTargets.Count());
+                    for (const NetworkConnection& target : targets)
+                    {
+                        const NetworkClient* client = NetworkManager::GetClient(target);
+                        targetsBaselines.Add(client ? GetAckedBaseline(baselines, client->ClientId) : 0);
+                    }
+                    for (int32 i = 0; i < targets.Count(); i++)
+                    {
+                        const uint32 baselineFrame = targetsBaselines[i];
+                        if (baselineFrame == MAX_uint32)
+                            continue; // Already sent
+                        CachedTargets.Clear();
+                        for (int32 j = i; j < targets.Count(); j++)
+                        {
+                            if (targetsBaselines[j] == baselineFrame)
+                            {
+                                CachedTargets.Add(targets[j]);
+                                targetsBaselines[j] = MAX_uint32;
+                            }
+                        }
+                        SendObjectReplicateState(peer, msgData, &baselines, baselineFrame, data, size, isClient);
+                    }
+                }
+
+                // Store the sent state for the future deltas
+                auto& baseline = baselines.Sent[msgData.OwnerFrame % NETWORK_REPLICATOR_BASELINES];
+                baseline.Frame = msgData.OwnerFrame;
+                baseline.Data.Set(data, size);
             }
-            ASSERT_LOW_LAYER(dataStart == size);
 
-            // TODO: stats for bytes send per object type
+#if COMPILE_WITH_PROFILER
+            if (ProfilerEnabled)
+            {
+                NetworkProfilerStat& stat = ProfileObjectType(obj->GetTypeHandle());
+                stat.Count++;
+                stat.DataSent += ProfilerDataSent - profilerDataSent;
+                stat.MessagesSent += ProfilerMessagesSent - profilerMessagesSent;
+                stat.TimeMs += (float)(job.SerializeTime * 1000.0);
+                NetworkManager::ProfilerStats.ReplicatedObjects++;
+            }
+#endif
         }
     }
 
     // Invoke RPCs
+    if (RpcQueue.Count() != 0)
     {
         PROFILE_CPU_NAMED("Rpc");
-        for (auto& e : RpcQueue)
+
+        // Merge repeated unreliable RPCs to the same targets (only the latest call is sent)
+        Array<bool, InlinedAllocation<64, FrameAllocation>> rpcSkip;
+        rpcSkip.Resize(RpcQueue.Count());
+        for (int32 i = RpcQueue.Count() - 1; i >= 0; i--)
+        {
+            auto& e = RpcQueue[i];
+            rpcSkip[i] = false;
+            const NetworkChannelType channel = (NetworkChannelType)e.Info.Channel;
+            if (channel != NetworkChannelType::Unreliable && channel != NetworkChannelType::UnreliableOrdered)
+                continue;
+            const RpcMergeKey key = { e.Object.Get(), e.Name };
+            int32 latest;
+            if (!RpcMergeTable.TryGet(key, latest))
+                RpcMergeTable.Add(key, i);
+            else
+            {
+                const auto& latestTargets = RpcQueue[latest].Targets;
+                rpcSkip[i] = latestTargets.Length() == e.Targets.Length() && Platform::MemoryCompare(latestTargets.Get(), e.Targets.Get(), e.Targets.Length() * sizeof(uint32)) == 0;
+            }
+        }
+        RpcMergeTable.Clear();
+
+        // Batch RPCs per target and channel
+        for (int32 i = 0; i < RpcQueue.Count(); i++)
         {
+            auto& e = RpcQueue[i];
+            if (rpcSkip[i])
+                continue;
             ScriptingObject* obj = e.Object.Get();
             if (!obj)
                 continue;
@@ -1545,25 +2240,24 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 continue;
             auto& item = it->Item;
 
-            // Send RPC message
             //NETWORK_REPLICATOR_LOG(Info, "[NetworkReplicator] Rpc {}::{} object ID={}", e.Name.First.ToString(), String(e.Name.Second), item.ToString());
-            NetworkMessageObjectRpc msgData;
-            msgData.ObjectId = item.ObjectId;
-            msgData.ParentId = item.ParentId;
+            NetworkMessageObjectRpcItem msgDataItem;
+            msgDataItem.ObjectId = item.ObjectId;
+            msgDataItem.ParentId = item.ParentId;
             if (isClient)
             {
                 // Remap local client object ids into server ids
-                IdsRemappingTable.KeyOf(msgData.ObjectId, &msgData.ObjectId);
-                IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
+                IdsRemappingTable.KeyOf(msgDataItem.ObjectId, &msgDataItem.ObjectId);
+                IdsRemappingTable.KeyOf(msgDataItem.ParentId, &msgDataItem.ParentId);
             }
-            GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
-            GetNetworkName(msgData.RpcTypeName, e.Name.First.GetType().Fullname);
-            GetNetworkName(msgData.RpcName, e.Name.Second);
-            msgData.ArgsSize = (uint16)e.ArgsData.Length();
-            NetworkMessage msg = peer->BeginSendMessage();
-            msg.WriteStructure(msgData);
-            msg.WriteBytes(e.ArgsData.Get(), e.ArgsData.Length());
+            msgDataItem.RpcId = GetRpcId(e.Name);
+            msgDataItem.ArgsSize = (uint16)e.ArgsData.Length();
+            const StringAnsiView& objectTypeName = obj->GetType().Fullname;
+            msgDataItem.ObjectTypeNameLength = (uint8)Math::Min(objectTypeName.Length(), 127);
             NetworkChannelType channel = (NetworkChannelType)e.Info.Channel;
+#if COMPILE_WITH_PROFILER
+            int32 sentCount = 0;
+#endif
             if (e.Info.Server && isClient)
             {
                 // Client -> Server
@@ -1571,16 +2265,36 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 if (e.Targets.Length() != 0)
                     NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Server RPC '{}::{}' called with non-empty list of targets is not supported (only server will receive it)", e.Name.First.ToString(), e.Name.Second.ToString());
 #endif
-                peer->EndSendMessage(channel, msg);
+                AddRpcToBatch(peer, NetworkConnection(), channel, msgDataItem, objectTypeName.Get(), e.ArgsData, isClient);
+#if COMPILE_WITH_PROFILER
+                sentCount = 1;
+#endif
             }
             else if (e.Info.Client && (isServer || isHost))
             {
                 // Server -> Client(s)
                 BuildCachedTargets(NetworkManager::Clients, item.TargetClientIds, e.Targets, NetworkManager::LocalClientId);
-                peer->EndSendMessage(channel, msg, CachedTargets);
+                for (const NetworkConnection& target : CachedTargets)
+                    AddRpcToBatch(peer, target, channel, msgDataItem, objectTypeName.Get(), e.ArgsData, isClient);
+#if COMPILE_WITH_PROFILER
+                sentCount = CachedTargets.Count();
+#endif
+            }
+#if COMPILE_WITH_PROFILER
+            if (ProfilerEnabled && sentCount != 0)
+            {
+                NetworkProfilerStat& stat = ProfileRpc(e.Name.First, e.Name.Second);
+                stat.Count += sentCount;
+                stat.DataSent += sentCount * (sizeof(msgDataItem) + msgDataItem.ObjectTypeNameLength + msgDataItem.ArgsSize);
             }
+#endif
         }
         RpcQueue.Clear();
+
+        // Send batched RPCs
+        for (RpcBatch& batch : RpcBatches)
+            SendRpcBatch(peer, batch, isClient);
+        RpcBatches.Clear();
     }
 
     // Clear networked objects mapping table
@@ -1608,7 +2322,7 @@ void NetworkInternal::OnNetworkMessageObjectReplicate(NetworkEvent& event, Netwo
     if (msgData.PartsCount == 1)
     {
         // Replicate
-        InvokeObjectReplication(item, msgData.OwnerFrame, event.Message.Buffer + event.Message.Position, msgData.DataSize, senderClientId);
+        InvokeObjectReplication(item, msgData.ObjectId, msgData.OwnerFrame, msgData.BaselineFrame, event.Message.Buffer + event.Message.Position, msgData.DataSize, msgData.StateSize, senderClientId);
     }
     else
     {
@@ -1632,6 +2346,35 @@ void NetworkInternal::OnNetworkMessageObjectReplicatePart(NetworkEvent& event, N
     AddObjectReplicateItem(event, msgData, msgData.PartStart, msgData.PartSize, senderClientId);
 }
 
+void NetworkInternal::OnNetworkMessageObjectReplicateAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    PROFILE_CPU();
+    NetworkMessageObjectReplicateAck msgData;
+    event.Message.ReadStructure(msgData);
+    auto* msgDataItems = (NetworkMessageObjectReplicateAckItem*)event.Message.SkipBytes(msgData.ItemsCount * sizeof(NetworkMessageObjectReplicateAckItem));
+    const uint32 senderClientId = client ? client->ClientId : NetworkManager::ServerClientId;
+    ScopeLock lock(ObjectsLock);
+    for (int32 i = 0; i < msgData.ItemsCount; i++)
+    {
+        const NetworkMessageObjectReplicateAckItem& msgDataItem = msgDataItems[i];
+        ReplicationBaselines* baselines = nullptr;
+        if (!Baselines.TryGet(msgDataItem.ObjectId, baselines))
+        {
+            // Remap server object ids into local client ids
+            Guid objectId;
+            if (IdsRemappingTable.TryGet(msgDataItem.ObjectId, objectId))
+                Baselines.TryGet(objectId, baselines);
+        }
+        if (!baselines)
+            continue;
+
+        // Move forward (unreliable channel can reorder messages) or reset to send the full state
+        uint32& acked = baselines->Acked[senderClientId];
+        if (msgDataItem.OwnerFrame == 0 || msgDataItem.OwnerFrame > acked)
+            acked = msgDataItem.OwnerFrame;
+    }
+}
+
 void NetworkInternal::OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
@@ -1892,6 +2635,7 @@ void NetworkInternal::OnNetworkMessageObjectDespawn(NetworkEvent& event, Network
         DespawnedObjects.Add(msgData.ObjectId);
         if (item.AsNetworkObject)
             item.AsNetworkObject->OnNetworkDespawn();
+        RemoveBaselines(item.ObjectId);
         Objects.Remove(obj);
         DeleteNetworkObject(obj);
     }
@@ -1949,55 +2693,66 @@ void NetworkInternal::OnNetworkMessageObjectRole(NetworkEvent& event, NetworkCli
     }
 }
 
-void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+void InvokeObjectRpc(const NetworkMessageObjectRpcItem& msgDataItem, char objectTypeName[128], byte* args, NetworkClient* client)
 {
-    PROFILE_CPU();
-    NetworkMessageObjectRpc msgData;
-    event.Message.ReadStructure(msgData);
-    ScopeLock lock(ObjectsLock);
-    NetworkReplicatedObject* e = ResolveObject(msgData.ObjectId, msgData.ParentId, msgData.ObjectTypeName);
-    if (e)
+    NetworkReplicatedObject* e = ResolveObject(msgDataItem.ObjectId, msgDataItem.ParentId, objectTypeName);
+    if (!e)
     {
-        auto& item = *e;
-        ScriptingObject* obj = item.Object.Get();
-        if (!obj)
-            return;
+        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown object {} RPC {}", msgDataItem.ObjectId, msgDataItem.RpcId);
+        return;
+    }
+    auto& item = *e;
+    ScriptingObject* obj = item.Object.Get();
+    if (!obj)
+        return;
 
-        // Find RPC info
-        NetworkRpcName name;
-        name.First = Scripting::FindScriptingType(msgData.RpcTypeName);
-        name.Second = msgData.RpcName;
-        const NetworkRpcInfo* info = NetworkRpcInfo::RPCsTable.TryGet(name);
-        if (!info)
-        {
-            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown RPC {}::{} for object {}", String(msgData.RpcTypeName), String(msgData.RpcName), msgData.ObjectId);
-            return;
-        }
+    // Find RPC info
+    const NetworkRpcName* name = FindRpc(msgDataItem.RpcId);
+    const NetworkRpcInfo* info = name ? NetworkRpcInfo::RPCsTable.TryGet(*name) : nullptr;
+    if (!info)
+    {
+        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown RPC {} for object {}", msgDataItem.RpcId, msgDataItem.ObjectId);
+        return;
+    }
 
-        // Validate RPC
-        if (info->Server && NetworkManager::IsClient())
-        {
-            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke server RPC {}::{} on client", String(msgData.RpcTypeName), String(msgData.RpcName));
-            return;
-        }
-        if (info->Client && NetworkManager::IsServer())
-        {
-            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke client RPC {}::{} on server", String(msgData.RpcTypeName), String(msgData.RpcName));
-            return;
-        }
+    // Validate RPC
+    if (info->Server && NetworkManager::IsClient())
+    {
+        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke server RPC {}::{} on client", name->First.ToString(), String(name->Second));
+        return;
+    }
+    if (info->Client && NetworkManager::IsServer())
+    {
+        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke client RPC {}::{} on server", name->First.ToString(), String(name->Second));
+        return;
+    }
+
+    // Setup message reading stream
+    if (CachedReadStream == nullptr)
+        CachedReadStream = New<NetworkStream>();
+    NetworkStream* stream = CachedReadStream;
+    stream->SenderId = client ? client->ClientId : NetworkManager::ServerClientId;
+    stream->Initialize(args, msgDataItem.ArgsSize);
 
-        // Setup message reading stream
-        if (CachedReadStream == nullptr)
-            CachedReadStream = New<NetworkStream>();
-        NetworkStream* stream = CachedReadStream;
-        stream->SenderId = client ? client->ClientId : NetworkManager::ServerClientId;
-        stream->Initialize(event.Message.Buffer + event.Message.Position, msgData.ArgsSize);
+    // Execute RPC
+    info->Execute(obj, stream, info->Tag);
+}
 
-        // Execute RPC
-        info->Execute(obj, stream, info->Tag);
-    }
-    else
+void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    PROFILE_CPU();
+    NetworkMessageObjectRpc msgData;
+    event.Message.ReadStructure(msgData);
+    ScopeLock lock(ObjectsLock);
+    for (int32 i = 0; i < msgData.ItemsCount; i++)
     {
-        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown object {} RPC {}::{}", msgData.ObjectId, String(msgData.RpcTypeName), String(msgData.RpcName));
+        NetworkMessageObjectRpcItem msgDataItem;
+        event.Message.ReadStructure(msgDataItem);
+        char objectTypeName[128];
+        const int32 objectTypeNameLength = Math::Min<int32>(msgDataItem.ObjectTypeNameLength, 127);
+        event.Message.ReadBytes((uint8*)objectTypeName, objectTypeNameLength);
+        objectTypeName[objectTypeNameLength] = 0;
+        byte* args = (byte*)event.Message.SkipBytes(msgDataItem.ArgsSize);
+        InvokeObjectRpc(msgDataItem, objectTypeName, args, client);
     }
 }
@@ -42,6 +42,21 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     API_FIELD() static bool EnableLog;
 #endif
 
+    /// <summary>
+    /// Enables the delta replication of the objects state. Receivers acknowledge the received states and the owner sends only the changes against the last acknowledged state (or the full state if receiver has missed it). Should match on both server and clients.
+    /// </summary>
+    API_FIELD() static bool EnableDeltaReplication;
+
+    /// <summary>
+    /// Enables serialization of the replicated objects on Job System when there are many of them. Serializers implemented in scripting (eg. C#) still run on a main thread. Native serializers should not modify any shared state when this is enabled.
+    /// </summary>
+    API_FIELD() static bool EnableParallelSerialization;
+
+    /// <summary>
+    /// The maximum amount of objects replication data (in bytes per second) sent to a single client. Objects that don't fit into the budget are sent within the next updates based on their priority that grows with the time since the last send and the object importance (and is higher for objects closer to the client). Server-only. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static int32 ClientBandwidthBudget;
+
     /// <summary>
     /// Gets the network replication hierarchy.
     /// </summary>
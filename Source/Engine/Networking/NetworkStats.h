@@ -4,6 +4,8 @@
 
 #include "Engine/Core/Compiler.h"
 #include "Engine/Core/Config.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
 
 /// <summary>
 /// The network transport driver statistics container. Contains information about INetworkDriver usage and performance.
@@ -33,3 +35,74 @@ struct TIsPODType<NetworkDriverStats>
 {
     enum { Value = true };
 };
+
+/// <summary>
+/// The network profiler counters of a single category item (eg. object type, RPC or channel) collected during a single network update.
+/// </summary>
+API_STRUCT(Namespace="FlaxEngine.Networking", NoDefault) struct FLAXENGINE_API NetworkProfilerStat
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkProfilerStat);
+
+    /// <summary>
+    /// The item name (eg. object type name, RPC name or channel name).
+    /// </summary>
+    API_FIELD() String Name;
+
+    /// <summary>
+    /// The amount of the item usages (eg. replicated objects of that type or sent RPC calls).
+    /// </summary>
+    API_FIELD() uint32 Count = 0;
+
+    /// <summary>
+    /// The amount of data bytes sent (for all target connections).
+    /// </summary>
+    API_FIELD() uint32 DataSent = 0;
+
+    /// <summary>
+    /// The amount of the network messages sent (for all target connections).
+    /// </summary>
+    API_FIELD() uint32 MessagesSent = 0;
+
+    /// <summary>
+    /// The time spent on the serialization (in milliseconds). Summed from all threads.
+    /// </summary>
+    API_FIELD() float TimeMs = 0.0f;
+};
+
+/// <summary>
+/// The network profiler counters collected during a single network update.
+/// </summary>
+API_STRUCT(Namespace="FlaxEngine.Networking", NoDefault) struct FLAXENGINE_API NetworkProfilerStats
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkProfilerStats);
+
+    /// <summary>
+    /// The network frame number which the stats were collected.
+    /// </summary>
+    API_FIELD() uint32 Frame = 0;
+
+    /// <summary>
+    /// The amount of the objects that were dirty and selected for the replication (by the replication hierarchy).
+    /// </summary>
+    API_FIELD() int32 DirtyObjects = 0;
+
+    /// <summary>
+    /// The amount of the objects serialized and sent.
+    /// </summary>
+    API_FIELD() int32 ReplicatedObjects = 0;
+
+    /// <summary>
+    /// The counters per replicated object type.
+    /// </summary>
+    API_FIELD() Array<NetworkProfilerStat> ObjectTypes;
+
+    /// <summary>
+    /// The counters per sent RPC.
+    /// </summary>
+    API_FIELD() Array<NetworkProfilerStat> Rpcs;
+
+    /// <summary>
+    /// The counters per network channel.
+    /// </summary>
+    API_FIELD() Array<NetworkProfilerStat> Channels;
+};
@@ -37,6 +37,7 @@ void NetworkStream::Initialize(uint32 minCapacity)
 
     // Reset pointer to the start
     _position = _buffer;
+    _bitPosition = 0;
 }
 
 void NetworkStream::Initialize(byte* buffer, uint32 length)
@@ -46,8 +47,150 @@ void NetworkStream::Initialize(byte* buffer, uint32 length)
     _position = _buffer = buffer;
     _length = length;
     _allocated = false;
+    _bitPosition = 0;
 }
 
+void NetworkStream::WriteBits(uint32 value, int32 bits)
+{
+    ASSERT(bits > 0 && bits <= 32);
+    while (bits > 0)
+    {
+        if (_bitPosition == 0)
+        {
+            // Start a new byte
+            const byte zero = 0;
+            WriteBytes(&zero, 1);
+        }
+        const int32 count = Math::Min(8 - _bitPosition, bits);
+        _position[-1] |= (byte)((value & ((1u << count) - 1)) << _bitPosition);
+        value >>= count;
+        bits -= count;
+        _bitPosition = (_bitPosition + count) & 7;
+    }
+}
+
+uint32 NetworkStream::ReadBits(int32 bits)
+{
+    ASSERT(bits > 0 && bits <= 32);
+    uint32 result = 0;
+    int32 shift = 0;
+    while (bits > 0)
+    {
+        if (_bitPosition == 0)
+        {
+            // Start a new byte
+            ASSERT(GetLength() - GetPosition() >= 1);
+            _position++;
+        }
+        const int32 count = Math::Min(8 - _bitPosition, bits);
+        result |= (uint32)((_position[-1] >> _bitPosition) & ((1u << count) - 1)) << shift;
+        shift += count;
+        bits -= count;
+        _bitPosition = (_bitPosition + count) & 7;
+    }
+    return result;
+}
+
+void NetworkStream::WriteVarUInt32(uint32 value)
+{
+    while (value >= 0x80)
+    {
+        WriteBits((value & 0x7f) | 0x80, 8);
+        value >>= 7;
+    }
+    WriteBits(value, 8);
+}
+
+uint32 NetworkStream::ReadVarUInt32()
+{
+    uint32 result = 0;
+    for (int32 shift = 0; shift < 35; shift += 7)
+    {
+        const uint32 value = ReadBits(8);
+        result |= (value & 0x7f) << shift;
+        if ((value & 0x80) == 0)
+            break;
+    }
+    return result;
+}
+
+void NetworkStream::WriteQuantizedFloat(float value, float min, float max, int32 bits)
+{
+    const double maxValue = (double)(bits >= 32 ? MAX_uint32 : (1u << bits) - 1);
+    const double alpha = max > min ? Math::Saturate(((double)value - min) / ((double)max - min)) : 0.0;
+    WriteBits((uint32)(alpha * maxValue + 0.5), bits);
+}
+
+float NetworkStream::ReadQuantizedFloat(float min, float max, int32 bits)
+{
+    const double maxValue = (double)(bits >= 32 ? MAX_uint32 : (1u << bits) - 1);
+    const double alpha = (double)ReadBits(bits) / maxValue;
+    return (float)(min + ((double)max - min) * alpha);
+}
+
+void NetworkStream::WriteQuantizedVector3(const Vector3& value, const Vector3& min, const Vector3& max, int32 bits)
+{
+    WriteQuantizedFloat((float)value.X, (float)min.X, (float)max.X, bits);
+    WriteQuantizedFloat((float)value.Y, (float)min.Y, (float)max.Y, bits);
+    WriteQuantizedFloat((float)value.Z, (float)min.Z, (float)max.Z, bits);
+}
+
+Vector3 NetworkStream::ReadQuantizedVector3(const Vector3& min, const Vector3& max, int32 bits)
+{
+    Vector3 result;
+    result.X = ReadQuantizedFloat((float)min.X, (float)max.X, bits);
+    result.Y = ReadQuantizedFloat((float)min.Y, (float)max.Y, bits);
+    result.Z = ReadQuantizedFloat((float)min.Z, (float)max.Z, bits);
+    return result;
+}
+
+// The range of the smallest three components of the normalized quaternion (1 / sqrt(2))
+#define QUATERNION_COMPONENT_RANGE 0.707106781f
+
+void NetworkStream::WriteQuantizedQuaternion(const Quaternion& value, int32 bits)
+{
+    Quaternion q = value;
+    q.Normalize();
+
+    // Find the largest component (it's reconstructed from the other ones)
+    int32 largest = 0;
+    for (int32 i = 1; i < 4; i++)
+    {
+        if (Math::Abs(q.Raw[i]) > Math::Abs(q.Raw[largest]))
+            largest = i;
+    }
+
+    // Quaternion and its negation represent the same rotation so ensure the largest component is positive
+    const float sign = q.Raw[largest] < 0.0f ? -1.0f : 1.0f;
+    WriteBits(largest, 2);
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i != largest)
+            WriteQuantizedFloat(q.Raw[i] * sign, -QUATERNION_COMPONENT_RANGE, QUATERNION_COMPONENT_RANGE, bits);
+    }
+}
+
+Quaternion NetworkStream::ReadQuantizedQuaternion(int32 bits)
+{
+    Quaternion q;
+    const int32 largest = (int32)ReadBits(2);
+    float sum = 0.0f;
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i != largest)
+        {
+            const float component = ReadQuantizedFloat(-QUATERNION_COMPONENT_RANGE, QUATERNION_COMPONENT_RANGE, bits);
+            q.Raw[i] = component;
+            sum += component * component;
+        }
+    }
+    q.Raw[largest] = Math::Sqrt(Math::Max(1.0f - sum, 0.0f));
+    q.Normalize();
+    return q;
+}
+
+#undef QUATERNION_COMPONENT_RANGE
+
 void NetworkStream::Read(INetworkSerializable& obj)
 {
     obj.Deserialize(this);
@@ -96,6 +239,7 @@ void NetworkStream::SetPosition(uint32 seek)
 {
     ASSERT(_length > 0);
     _position = _buffer + seek;
+    _bitPosition = 0;
 }
 
 void NetworkStream::ReadBytes(void* data, uint32 bytes)
@@ -106,6 +250,7 @@ void NetworkStream::ReadBytes(void* data, uint32 bytes)
         Platform::MemoryCopy(data, _position, bytes);
         _position += bytes;
     }
+    _bitPosition = 0;
 }
 
 void NetworkStream::WriteBytes(const void* data, uint32 bytes)
@@ -140,4 +285,5 @@ void NetworkStream::WriteBytes(const void* data, uint32 bytes)
     // Copy data
     Platform::MemoryCopy(_position, data, bytes);
     _position += bytes;
+    _bitPosition = 0;
 }
@@ -5,12 +5,17 @@
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Serialization/ReadStream.h"
 #include "Engine/Serialization/WriteStream.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
 
 class INetworkSerializable;
 
 /// <summary>
 /// Objects and values serialization stream for sending data over network. Uses memory buffer for both read and write operations.
 /// </summary>
+/// <remarks>
+/// Supports bit-packing of the values (eg. bools, quantized floats, compressed rotations) via WriteBits/ReadBits and the related methods. Subsequent bit writes share the same bytes, while any byte-level write or read (eg. WriteInt32) starts from the next whole byte. Data has to be read in the same order and with the same bits counts as written.
+/// </remarks>
 API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkStream final : public ScriptingObject, public ReadStream, public WriteStream
 {
     DECLARE_SCRIPTING_TYPE(NetworkStream);
@@ -19,6 +24,7 @@ API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     byte* _position = nullptr;
     uint32 _length = 0;
     bool _allocated = false;
+    int32 _bitPosition = 0;
 
 public:
     ~NetworkStream();
@@ -69,6 +75,119 @@ API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
         ReadBytes(data, bytes);
     }
 
+    /// <summary>
+    /// Writes the bits of the value to the stream (bit-packed with the other bits written before).
+    /// </summary>
+    /// <param name="value">The value to write (only the lowest bits are used).</param>
+    /// <param name="bits">The amount of bits to write (in range 1-32).</param>
+    API_FUNCTION() void WriteBits(uint32 value, int32 bits);
+
+    /// <summary>
+    /// Reads the bits of the value from the stream (bit-packed with the other bits read before).
+    /// </summary>
+    /// <param name="bits">The amount of bits to read (in range 1-32).</param>
+    /// <returns>The value.</returns>
+    API_FUNCTION() uint32 ReadBits(int32 bits);
+
+    /// <summary>
+    /// Writes the boolean value as a single bit.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    API_FUNCTION() FORCE_INLINE void WriteBit(bool value)
+    {
+        WriteBits(value ? 1 : 0, 1);
+    }
+
+    /// <summary>
+    /// Reads the boolean value from a single bit.
+    /// </summary>
+    /// <returns>The value.</returns>
+    API_FUNCTION() FORCE_INLINE bool ReadBit()
+    {
+        return ReadBits(1) != 0;
+    }
+
+    /// <summary>
+    /// Writes the unsigned integer with variable-length encoding (7 bits per byte, small values use less space).
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    API_FUNCTION() void WriteVarUInt32(uint32 value);
+
+    /// <summary>
+    /// Reads the unsigned integer with variable-length encoding.
+    /// </summary>
+    /// <returns>The value.</returns>
+    API_FUNCTION() uint32 ReadVarUInt32();
+
+    /// <summary>
+    /// Writes the signed integer with variable-length encoding (zig-zag encoded so small negative values use less space too).
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    API_FUNCTION() FORCE_INLINE void WriteVarInt32(int32 value)
+    {
+        WriteVarUInt32(((uint32)value << 1) ^ (uint32)(value >> 31));
+    }
+
+    /// <summary>
+    /// Reads the signed integer with variable-length encoding.
+    /// </summary>
+    /// <returns>The value.</returns>
+    API_FUNCTION() FORCE_INLINE int32 ReadVarInt32()
+    {
+        const uint32 value = ReadVarUInt32();
+        return (int32)(value >> 1) ^ -(int32)(value & 1);
+    }
+
+    /// <summary>
+    /// Writes the float value quantized within the range using the given amount of bits. Values outside the range are clamped.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="min">The minimum value of the range.</param>
+    /// <param name="max">The maximum value of the range.</param>
+    /// <param name="bits">The amount of bits to use (in range 1-32). Precision is (max - min) / (2^bits - 1).</param>
+    API_FUNCTION() void WriteQuantizedFloat(float value, float min, float max, int32 bits);
+
+    /// <summary>
+    /// Reads the float value quantized within the range using the given amount of bits.
+    /// </summary>
+    /// <param name="min">The minimum value of the range.</param>
+    /// <param name="max">The maximum value of the range.</param>
+    /// <param name="bits">The amount of bits to use (in range 1-32).</param>
+    /// <returns>The value.</returns>
+    API_FUNCTION() float ReadQuantizedFloat(float min, float max, int32 bits);
+
+    /// <summary>
+    /// Writes the vector quantized within the bounds using the given amount of bits per component (eg. position within the level bounds). Values outside the bounds are clamped.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="min">The minimum value of the bounds.</param>
+    /// <param name="max">The maximum value of the bounds.</param>
+    /// <param name="bits">The amount of bits to use per component (in range 1-32).</param>
+    API_FUNCTION() void WriteQuantizedVector3(const Vector3& value, const Vector3& min, const Vector3& max, int32 bits);
+
+    /// <summary>
+    /// Reads the vector quantized within the bounds using the given amount of bits per component.
+    /// </summary>
+    /// <param name="min">The minimum value of the bounds.</param>
+    /// <param name="max">The maximum value of the bounds.</param>
+    /// <param name="bits">The amount of bits to use per component (in range 1-32).</param>
+    /// <returns>The value.</returns>
+    API_FUNCTION() Vector3 ReadQuantizedVector3(const Vector3& min, const Vector3& max, int32 bits);
+
+    /// <summary>
+    /// Writes the rotation compressed with smallest-three encoding: index of the largest component (2 bits) and the other three components quantized using the given amount of bits.
+    /// </summary>
+    /// <param name="value">The value to write (normalized).</param>
+    /// <param name="bits">The amount of bits to use per component (in range 1-32). For example, 10 bits results in 32 bits per rotation.</param>
+    API_FUNCTION() void WriteQuantizedQuaternion(const Quaternion& value, int32 bits = 10);
+
+    /// <summary>
+    /// Reads the rotation compressed with smallest-three encoding.
+    /// </summary>
+    /// <param name="bits">The amount of bits to use per component (in range 1-32).</param>
+    /// <returns>The value.</returns>
+    API_FUNCTION() Quaternion ReadQuantizedQuaternion(int32 bits = 10);
+
     using ReadStream::Read;
     void Read(INetworkSerializable& obj);
     void Read(INetworkSerializable* obj);
@@ -0,0 +1,194 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Core/Math/Vector3.h"
+
+// ReSharper disable CppCStyleCast
+
+/// <summary>
+/// The vectorized kernels used by the CPU particles simulation for the common modules. Kernels run over the particle attribute streams (interleaved with the particle buffer stride) and process the batch of particles at once by gathering the attributes into the SoA registers (XXXX, YYYY, ZZZZ), then scatter the results back. The remaining particles (when count is not a multiple of the batch size) use the scalar code path.
+/// </summary>
+namespace ParticleKernels
+{
+    /// <summary>
+    /// The amount of particles processed by the kernels at once.
+    /// </summary>
+    constexpr int32 BatchSize = 4;
+
+    FORCE_INLINE SimdVector4 GatherFloat(const byte* ptr, int32 stride)
+    {
+        return SIMD::Load(*(const float*)ptr, *(const float*)(ptr + stride), *(const float*)(ptr + stride * 2), *(const float*)(ptr + stride * 3));
+    }
+
+    FORCE_INLINE void ScatterFloat(byte* ptr, int32 stride, SimdVector4 value)
+    {
+        float v[4];
+        SIMD::StoreUnaligned(v, value);
+        *(float*)ptr = v[0];
+        *(float*)(ptr + stride) = v[1];
+        *(float*)(ptr + stride * 2) = v[2];
+        *(float*)(ptr + stride * 3) = v[3];
+    }
+
+    FORCE_INLINE void GatherFloat3(const byte* ptr, int32 stride, SimdVector4& x, SimdVector4& y, SimdVector4& z)
+    {
+        x = GatherFloat(ptr, stride);
+        y = GatherFloat(ptr + sizeof(float), stride);
+        z = GatherFloat(ptr + sizeof(float) * 2, stride);
+    }
+
+    FORCE_INLINE void ScatterFloat3(byte* ptr, int32 stride, SimdVector4 x, SimdVector4 y, SimdVector4 z)
+    {
+        ScatterFloat(ptr, stride, x);
+        ScatterFloat(ptr + sizeof(float), stride, y);
+        ScatterFloat(ptr + sizeof(float) * 2, stride, z);
+    }
+
+    /// <summary>
+    /// Adds the constant value to the float attribute of the particles (eg. age update).
+    /// </summary>
+    inline void AddFloat(byte* ptr, int32 stride, int32 count, float value)
+    {
+        const SimdVector4 v = SIMD::Splat(value);
+        const int32 batchStride = stride * BatchSize;
+        int32 i = 0;
+        for (; i + BatchSize <= count; i += BatchSize)
+        {
+            ScatterFloat(ptr, stride, SIMD::Add(GatherFloat(ptr, stride), v));
+            ptr += batchStride;
+        }
+        for (; i < count; i++)
+        {
+            *(float*)ptr += value;
+            ptr += stride;
+        }
+    }
+
+    /// <summary>
+    /// Adds the constant value to the vector attribute of the particles (eg. constant force applied to the velocity).
+    /// </summary>
+    inline void AddFloat3(byte* ptr, int32 stride, int32 count, const Float3& value)
+    {
+        const SimdVector4 vx = SIMD::Splat(value.X), vy = SIMD::Splat(value.Y), vz = SIMD::Splat(value.Z);
+        const int32 batchStride = stride * BatchSize;
+        int32 i = 0;
+        for (; i + BatchSize <= count; i += BatchSize)
+        {
+            SimdVector4 x, y, z;
+            GatherFloat3(ptr, stride, x, y, z);
+            ScatterFloat3(ptr, stride, SIMD::Add(x, vx), SIMD::Add(y, vy), SIMD::Add(z, vz));
+            ptr += batchStride;
+        }
+        for (; i < count; i++)
+        {
+            *(Float3*)ptr += value;
+            ptr += stride;
+        }
+    }
+
+    /// <summary>
+    /// Adds the scaled vector attribute to the other vector attribute of the particles (eg. Euler integration of the velocity into the position).
+    /// </summary>
+    inline void MulAddFloat3(byte* dstPtr, const byte* srcPtr, int32 stride, int32 count, float scale)
+    {
+        const SimdVector4 s = SIMD::Splat(scale);
+        const int32 batchStride = stride * BatchSize;
+        int32 i = 0;
+        for (; i + BatchSize <= count; i += BatchSize)
+        {
+            SimdVector4 x, y, z, sx, sy, sz;
+            GatherFloat3(dstPtr, stride, x, y, z);
+            GatherFloat3(srcPtr, stride, sx, sy, sz);
+            ScatterFloat3(dstPtr, stride, SIMD::MulAdd(sx, s, x), SIMD::MulAdd(sy, s, y), SIMD::MulAdd(sz, s, z));
+            dstPtr += batchStride;
+            srcPtr += batchStride;
+        }
+        for (; i < count; i++)
+        {
+            *(Float3*)dstPtr += *(const Float3*)srcPtr * scale;
+            dstPtr += stride;
+            srcPtr += stride;
+        }
+    }
+
+    /// <summary>
+    /// Applies the linear drag to the velocity of the particles: velocity *= max(0, 1 - drag * spriteSize.X * spriteSize.Y * dt / max(mass, epsilon)). Sprite size pointer is optional.
+    /// </summary>
+    inline void LinearDrag(byte* velocityPtr, const byte* massPtr, const byte* spriteSizePtr, int32 stride, int32 count, float drag, float dt)
+    {
+        const SimdVector4 dragDt = SIMD::Splat(drag * dt);
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        const SimdVector4 minMass = SIMD::Splat(ZeroTolerance);
+        const int32 batchStride = stride * BatchSize;
+        int32 i = 0;
+        for (; i + BatchSize <= count; i += BatchSize)
+        {
+            SimdVector4 particleDrag = dragDt;
+            if (spriteSizePtr)
+            {
+                particleDrag = SIMD::Mul(particleDrag, SIMD::Mul(GatherFloat(spriteSizePtr, stride), GatherFloat(spriteSizePtr + sizeof(float), stride)));
+                spriteSizePtr += batchStride;
+            }
+            const SimdVector4 mass = SIMD::Max(GatherFloat(massPtr, stride), minMass);
+            const SimdVector4 factor = SIMD::Max(zero, SIMD::Sub(one, SIMD::Div(particleDrag, mass)));
+            SimdVector4 x, y, z;
+            GatherFloat3(velocityPtr, stride, x, y, z);
+            ScatterFloat3(velocityPtr, stride, SIMD::Mul(x, factor), SIMD::Mul(y, factor), SIMD::Mul(z, factor));
+            velocityPtr += batchStride;
+            massPtr += batchStride;
+        }
+        for (; i < count; i++)
+        {
+            float particleDrag = drag;
+            if (spriteSizePtr)
+            {
+                particleDrag *= ((const Float2*)spriteSizePtr)->MulValues();
+                spriteSizePtr += stride;
+            }
+            *(Float3*)velocityPtr *= Math::Max(0.0f, 1.0f - (particleDrag * dt) / Math::Max(*(const float*)massPtr, ZeroTolerance));
+            velocityPtr += stride;
+            massPtr += stride;
+        }
+    }
+
+    /// <summary>
+    /// Linearly interpolates the float vector attribute of the particles (with the given components count, up to 4) between two constant values based on the particles normalized age (age / lifetime). Used to animate the attributes over the particle life (eg. color or size over life).
+    /// </summary>
+    inline void LerpOverLife(byte* dstPtr, int32 components, const byte* agePtr, const byte* lifetimePtr, int32 stride, int32 count, const float* start, const float* end)
+    {
+        SimdVector4 a[4], d[4];
+        for (int32 c = 0; c < components; c++)
+        {
+            a[c] = SIMD::Splat(start[c]);
+            d[c] = SIMD::Splat(end[c] - start[c]);
+        }
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 minLifetime = SIMD::Splat(ZeroTolerance);
+        const int32 batchStride = stride * BatchSize;
+        int32 i = 0;
+        for (; i + BatchSize <= count; i += BatchSize)
+        {
+            const SimdVector4 lifetime = SIMD::Max(GatherFloat(lifetimePtr, stride), minLifetime);
+            const SimdVector4 t = SIMD::Min(SIMD::Max(SIMD::Div(GatherFloat(agePtr, stride), lifetime), zero), one);
+            for (int32 c = 0; c < components; c++)
+                ScatterFloat(dstPtr + c * sizeof(float), stride, SIMD::MulAdd(d[c], t, a[c]));
+            dstPtr += batchStride;
+            agePtr += batchStride;
+            lifetimePtr += batchStride;
+        }
+        for (; i < count; i++)
+        {
+            const float t = Math::Saturate(*(const float*)agePtr / Math::Max(*(const float*)lifetimePtr, ZeroTolerance));
+            for (int32 c = 0; c < components; c++)
+                ((float*)dstPtr)[c] = start[c] + (end[c] - start[c]) * t;
+            dstPtr += stride;
+            agePtr += stride;
+            lifetimePtr += stride;
+        }
+    }
+}
@@ -1,6 +1,8 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "ParticleEmitterGraph.CPU.h"
+#include "ParticleEmitterGraph.CPU.Kernels.h"
+#include "Engine/Particles/ParticleEffect.h"
 #include "Engine/Core/Random.h"
 #include "Engine/Utilities/Noise.h"
 
@@ -46,6 +48,32 @@ namespace
             return VariantType::Pointer;
         }
     }
+
+    // Sets the attribute with the vectorized kernel if the value is the linear interpolation between the constant values by the particle normalized age (eg. color or size over life)
+    bool TrySetOverLife(VisjectGraphBox* box, const ParticleAttribute& attribute, ParticleBuffer* buffer, int32 particlesStart, int32 particlesEnd)
+    {
+        if (!box->HasConnection() || attribute.ValueType > ParticleAttribute::ValueTypes::Float4)
+            return false;
+        const VisjectGraphBox* lerpBox = box->FirstConnection();
+        const auto lerpNode = lerpBox->GetParent<ParticleEmitterGraphCPUNode>();
+        if (lerpNode->GroupID != 3 || lerpNode->TypeID != 25 || lerpBox->ID != 3 || lerpNode->Values.Count() < 2)
+            return false;
+        const auto alphaBox = lerpNode->GetBox(2);
+        if (lerpNode->GetBox(0)->HasConnection() || lerpNode->GetBox(1)->HasConnection() || !alphaBox->HasConnection())
+            return false;
+        const auto ageNode = alphaBox->FirstConnection()->GetParent<ParticleEmitterGraphCPUNode>();
+        if (ageNode->GroupID != 14 || ageNode->TypeID != 110)
+            return false;
+        const VariantType type(GetVariantType(attribute.ValueType));
+        const Variant startValue = lerpNode->Values[0].Cast(type);
+        const Variant endValue = lerpNode->Values[1].Cast(type);
+        byte* start = buffer->GetParticleCPU(particlesStart);
+        const byte* agePtr = start + buffer->Layout->Attributes[ageNode->Attributes[0]].Offset;
+        const byte* lifetimePtr = start + buffer->Layout->Attributes[ageNode->Attributes[1]].Offset;
+        const int32 components = attribute.GetSize() / sizeof(float);
+        ParticleKernels::LerpOverLife(start + attribute.Offset, components, agePtr, lifetimePtr, buffer->Stride, particlesEnd - particlesStart, (const float*)&startValue.AsPointer, (const float*)&endValue.AsPointer);
+        return true;
+    }
 }
 
 int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
@@ -54,8 +82,7 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     auto& context = Context.Get();
     auto& data = context.Data->SpawnModulesData[index];
 
-    // Accumulate the previous frame fraction
-    float spawnCount = data.SpawnCounter;
+    float spawnCount = 0.0f;
 
     // Calculate particles to spawn during this frame
     switch (node->TypeID)
@@ -108,6 +135,9 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     }
     }
 
+    // Accumulate the previous frame fraction (spawn rate can be scaled down by the effect LOD or particles budget)
+    spawnCount = data.SpawnCounter + spawnCount * context.Effect->Instance.SpawnRateScale;
+
     // Calculate actual spawn amount
     spawnCount = Math::Max(spawnCount, 0.0f);
     const int32 result = Math::FloorToInt(spawnCount);
@@ -190,12 +220,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
     {
         PARTICLE_EMITTER_MODULE("Update Age");
         auto& attribute = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
-        byte* agePtr = start + attribute.Offset;
-        for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-        {
-            *((float*)agePtr) += context.DeltaTime;
-            agePtr += stride;
-        }
+        ParticleKernels::AddFloat(start + attribute.Offset, stride, particlesEnd - particlesStart, context.DeltaTime);
         break;
     }
     // Gravity/Force
@@ -219,11 +244,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             const Float3 force = (Float3)GetValue(box, 2);
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                *((Float3*)velocityPtr) += force * context.DeltaTime;
-                velocityPtr += stride;
-            }
+            ParticleKernels::AddFloat3(velocityPtr, stride, particlesEnd - particlesStart, force * context.DeltaTime);
         }
         break;
     }
@@ -468,10 +489,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             INPUTS_FETCH();
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                LOGIC();
-            }
+            ParticleKernels::LinearDrag(velocityPtr, massPtr, spriteSizePtr, stride, particlesEnd - particlesStart, drag, context.DeltaTime);
         }
 #undef INPUTS_FETCH
 #undef LOGIC
@@ -549,6 +567,8 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         ValueType type(GetVariantType(attribute.ValueType));
         if (node->UsePerParticleDataResolve())
         {
+            if (TrySetOverLife(box, attribute, context.Data->Buffer, particlesStart, particlesEnd))
+                break;
             Value value;
             for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
             {
@@ -607,6 +627,8 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         ValueType type(GetVariantType(attribute.ValueType));
         if (node->UsePerParticleDataResolve())
         {
+            if (TrySetOverLife(box, attribute, context.Data->Buffer, particlesStart, particlesEnd))
+                break;
             Value value;
             for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
             {
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "ParticleEmitterGraph.CPU.h"
+#include "ParticleEmitterGraph.CPU.Kernels.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Renderer/RenderList.h"
@@ -481,12 +482,7 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
         PROFILE_CPU_NAMED("Euler Integration");
         byte* positionPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrPosition].Offset;
         byte* velocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
-        {
-            *((Float3*)positionPtr) += *((Float3*)velocityPtr) * dt;
-            positionPtr += data.Buffer->Stride;
-            velocityPtr += data.Buffer->Stride;
-        }
+        ParticleKernels::MulAddFloat3(positionPtr, velocityPtr, data.Buffer->Stride, cpu.Count, dt);
     }
 
     // Angular Euler Integration
@@ -495,12 +491,7 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
         PROFILE_CPU_NAMED("Angular Euler Integration");
         byte* rotationPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrRotation].Offset;
         byte* angularVelocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAngularVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
-        {
-            *((Float3*)rotationPtr) += *((Float3*)angularVelocityPtr) * dt;
-            rotationPtr += data.Buffer->Stride;
-            angularVelocityPtr += data.Buffer->Stride;
-        }
+        ParticleKernels::MulAddFloat3(rotationPtr, angularVelocityPtr, data.Buffer->Stride, cpu.Count, dt);
     }
 
     // Spawn particles
@@ -599,6 +590,11 @@ VisjectExecutor::Value ParticleEmitterGraphCPUExecutor::eatBox(Node* caller, Box
     }
 #endif
 
+    // Evaluate the compiled expression without the nodes recursion
+    const VisjectProgram* program = box->Program;
+    if (program)
+        return program->Execute(context.Data->Parameters);
+
     // Add to the calling stack
     context.CallStack[context.CallStackSize++] = caller;
 
@@ -258,6 +258,18 @@ bool ParticleEffect::GetIsPlaying() const
     return _isPlaying;
 }
 
+int32 ParticleEffect::GetCurrentLOD() const
+{
+    return _currentLOD;
+}
+
+float ParticleEffect::GetCurrentSignificance() const
+{
+    if (_viewDistanceSqr >= MAX_Real)
+        return 0.0f;
+    return Significance / Math::Max((float)Math::Sqrt(_viewDistanceSqr), 1.0f);
+}
+
 void ParticleEffect::ResetSimulation()
 {
     Instance.ClearState();
@@ -274,6 +286,7 @@ void ParticleEffect::UpdateSimulation(bool singleFrame)
 
     // Request update
     _lastUpdateFrame = Engine::FrameCount;
+    _viewDistanceSqr = _lastMinDstSqr;
     _lastMinDstSqr = MAX_Real;
     if (singleFrame)
         Instance.LastUpdateTime = (UseTimeScale ? Time::Update.Time : Time::Update.UnscaledTime).GetTotalSeconds();
@@ -429,11 +442,30 @@ void ParticleEffect::Update()
     if (!UpdateWhenOffscreen && _lastMinDstSqr >= MAX_Real)
         return;
 
-    if (UpdateMode == SimulationUpdateMode::FixedTimestep)
+    // Pick the level of detail based on the distance to the closest view
+    float updateInterval = UpdateMode == SimulationUpdateMode::FixedTimestep ? FixedTimestep : 0.0f;
+    Instance.SpawnRateScale = 1.0f;
+    _currentLOD = -1;
+    const Real lodDistanceScale = (Real)Particles::LODDistanceScale;
+    for (int32 i = 0; i < LODs.Count(); i++)
+    {
+        const Real lodDistance = (Real)LODs[i].Distance * lodDistanceScale;
+        if (_lastMinDstSqr < lodDistance * lodDistance)
+            break;
+        _currentLOD = i;
+    }
+    if (_currentLOD != -1)
+    {
+        const ParticleEffectLOD& lod = LODs[_currentLOD];
+        updateInterval = Math::Max(updateInterval, lod.UpdateInterval);
+        Instance.SpawnRateScale = Math::Saturate(lod.SpawnRateScale);
+    }
+
+    if (updateInterval > 0.0f)
     {
         // Check if last simulation update was past enough to kick a new on
-        const float time = Time::Update.Time.GetTotalSeconds();
-        if (time - Instance.LastUpdateTime < FixedTimestep)
+        const float time = (UseTimeScale ? Time::Update.Time : Time::Update.UnscaledTime).GetTotalSeconds();
+        if (time - Instance.LastUpdateTime < updateInterval)
             return;
     }
 
@@ -614,6 +646,8 @@ void ParticleEffect::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(UpdateWhenOffscreen);
     SERIALIZE(DrawModes);
     SERIALIZE(SortOrder);
+    SERIALIZE(LODs);
+    SERIALIZE(Significance);
 }
 
 void ParticleEffect::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -715,6 +749,8 @@ void ParticleEffect::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(UpdateWhenOffscreen);
     DESERIALIZE(DrawModes);
     DESERIALIZE(SortOrder);
+    DESERIALIZE(LODs);
+    DESERIALIZE(Significance);
 
     if (_parameters.HasItems())
     {
@@ -130,6 +130,33 @@ API_CLASS(NoSpawn) class ParticleEffectParameter : public ScriptingObject
     API_PROPERTY() GraphParameter* GetEmitterParameter() const;
 };
 
+/// <summary>
+/// The particle effect level of detail settings. Used to reduce the simulation cost of the effects far from the view.
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API ParticleEffectLOD : ISerializable
+{
+    API_AUTO_SERIALIZATION();
+    DECLARE_SCRIPTING_TYPE_MINIMAL(ParticleEffectLOD);
+
+    /// <summary>
+    /// The minimum distance from the view (in units) at which the level of detail is used.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0), Limit(0)")
+    float Distance = 0.0f;
+
+    /// <summary>
+    /// The minimum time (in seconds) between the simulation updates. Use 0 to update every frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(0)")
+    float UpdateInterval = 0.0f;
+
+    /// <summary>
+    /// The scale of the particles spawn rate (normalized to range 0-1).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), Limit(0, 1, 0.01f)")
+    float SpawnRateScale = 1.0f;
+};
+
 /// <summary>
 /// The particle system instance that plays the particles simulation in the game.
 /// </summary>
@@ -180,6 +207,8 @@ class FLAXENGINE_API ParticleEffect : public Actor
 private:
     uint64 _lastUpdateFrame;
     Real _lastMinDstSqr;
+    Real _viewDistanceSqr = MAX_Real;
+    int32 _currentLOD = -1;
     int32 _sceneRenderingKey = -1;
     uint32 _parametersVersion = 0; // Version number for _parameters to be in sync with Instance.ParametersVersion
     Array<ParticleEffectParameter> _parameters; // Cached for scripting API
@@ -259,6 +288,18 @@ class FLAXENGINE_API ParticleEffect : public Actor
     API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), EditorOrder(80), DefaultValue(0)")
     int16 SortOrder = 0;
 
+    /// <summary>
+    /// The levels of detail used to reduce the simulation cost based on the distance from the view (sorted by the increasing distance).
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\", \"LODs\"), EditorOrder(90)")
+    Array<ParticleEffectLOD> LODs;
+
+    /// <summary>
+    /// The effect significance scale used by the global particles budget. Effects with higher significance (at the same view distance) are throttled later.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), EditorOrder(100), DefaultValue(1.0f), Limit(0)")
+    float Significance = 1.0f;
+
 public:
     /// <summary>
     /// Gets the effect parameters collection. Those parameters are instanced from the <see cref="ParticleSystem"/> that contains a linear list of emitters and every emitter has a list of own parameters.
@@ -338,6 +379,16 @@ class FLAXENGINE_API ParticleEffect : public Actor
     /// </summary>
     API_PROPERTY(Attributes="NoSerialize, HideInEditor") bool GetIsPlaying() const;
 
+    /// <summary>
+    /// Gets the index of the level of detail used by the last simulation update (-1 if not using any).
+    /// </summary>
+    API_PROPERTY(Attributes="NoSerialize, HideInEditor") int32 GetCurrentLOD() const;
+
+    /// <summary>
+    /// Gets the effect significance used by the particles budget (based on the distance to the closest view that rendered it and the significance scale). Zero if effect was not visible.
+    /// </summary>
+    API_PROPERTY(Attributes="NoSerialize, HideInEditor") float GetCurrentSignificance() const;
+
     /// <summary>
     /// Resets the particles simulation state (clears the instance state data but preserves the instance parameters values).
     /// </summary>
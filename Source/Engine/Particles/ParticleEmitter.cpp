@@ -91,6 +91,9 @@ Asset::LoadResult ParticleEmitter::load()
         return LoadResult::CannotLoadData;
     }
 
+    // Compile the pure expressions (eg. modules inputs math on parameters) to skip the nodes recursion during CPU simulation
+    Graph.CompilePrograms(Graph, 2);
+
     // Cache data
     {
         auto root = Graph.Root;
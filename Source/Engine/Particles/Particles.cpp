@@ -23,6 +23,7 @@
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Profiler/ProfilerGPU.h"
 #include "Engine/Renderer/Utils/BitonicSort.h"
+#include "Engine/Renderer/Utils/RadixSort.h"
 #endif
 #if USE_EDITOR
 #include "Editor/Editor.h"
@@ -96,11 +97,73 @@ struct EmitterCache
     ParticleBuffer* Buffer;
 };
 
+// The particle buffers pool key. Buffers with the same storage layout can be reused by any emitter.
+struct ParticleBufferKey
+{
+    ParticlesSimulationMode Mode;
+    int32 Capacity;
+    int32 Stride;
+    int32 CustomDataSize;
+    int32 SortModules;
+
+    ParticleBufferKey(ParticleEmitter* emitter)
+    {
+        Mode = emitter->SimulationMode;
+        Capacity = emitter->Capacity;
+        Stride = emitter->Graph.Layout.Size;
+#if COMPILE_WITH_GPU_PARTICLES
+        CustomDataSize = Mode == ParticlesSimulationMode::GPU ? emitter->GPU.CustomDataSize : 0;
+#else
+        CustomDataSize = 0;
+#endif
+        SortModules = emitter->Graph.SortModules.Count();
+    }
+
+    ParticleBufferKey(ParticleBuffer* buffer)
+    {
+        Mode = buffer->Mode;
+        Capacity = buffer->Capacity;
+        Stride = buffer->Stride;
+        CustomDataSize = Mode == ParticlesSimulationMode::GPU ? (int32)buffer->GPU.Buffer->GetSize() - Capacity * Stride - (int32)sizeof(uint32) : 0;
+        SortModules = buffer->GPU.SortedIndices ? (int32)(buffer->GPU.SortedIndices->GetSize() / (Capacity * sizeof(uint32))) : 0;
+    }
+
+    bool operator==(const ParticleBufferKey& other) const
+    {
+        return Mode == other.Mode && Capacity == other.Capacity && Stride == other.Stride && CustomDataSize == other.CustomDataSize && SortModules == other.SortModules;
+    }
+};
+
+uint32 GetHash(const ParticleBufferKey& key)
+{
+    uint32 hash = (uint32)key.Mode;
+    CombineHash(hash, (uint32)key.Capacity);
+    CombineHash(hash, (uint32)key.Stride);
+    CombineHash(hash, (uint32)key.CustomDataSize);
+    CombineHash(hash, (uint32)key.SortModules);
+    return hash;
+}
+
+struct EmitterUpdate
+{
+    ParticleEffect* Effect;
+    ParticleEmitter* Emitter;
+    ParticleEmitterInstance* Data;
+    float DeltaTime;
+    bool CanSpawn;
+    // Index of the effect counter of the pending emitters to update bounds after the last one (-1 if unused)
+    int32 BoundsCounter;
+};
+
 namespace ParticleManagerImpl
 {
     CriticalSection PoolLocker;
-    Dictionary<ParticleEmitter*, Array<EmitterCache>> Pool;
+    Dictionary<ParticleBufferKey, Array<EmitterCache>> Pool;
     Array<ParticleEffect*> UpdateList;
+    CriticalSection EmittersUpdateListLocker;
+    Array<EmitterUpdate> EmittersUpdateList;
+    Array<int64> EmittersBoundsCounters;
+    float UpdateTimeThrottle = 0.0f;
 #if COMPILE_WITH_GPU_PARTICLES
     CriticalSection GpuUpdateListLocker;
     Array<ParticleEffect*> GpuUpdateList;
@@ -110,7 +173,68 @@ namespace ParticleManagerImpl
 
 using namespace ParticleManagerImpl;
 
+namespace
+{
+    bool SortEffectsBySignificance(ParticleEffect* const& a, ParticleEffect* const& b)
+    {
+        return a->GetCurrentSignificance() > b->GetCurrentSignificance();
+    }
+
+    int32 GetParticlesCountEstimate(const ParticleSystemInstance& instance)
+    {
+        // GPU particles count is not known on a CPU without the readback so use the last known upper limit
+        int32 result = 0;
+        for (const auto& emitter : instance.Emitters)
+        {
+            if (emitter.Buffer)
+                result += emitter.Buffer->Mode == ParticlesSimulationMode::CPU ? emitter.Buffer->CPU.Count : emitter.Buffer->GPU.ParticlesCountMax;
+        }
+        return result;
+    }
+
+    void ApplyParticlesBudget()
+    {
+        PROFILE_CPU_NAMED("Particles.Budget");
+
+        // The most significant effects go first
+        Sorting::QuickSort(UpdateList.Get(), UpdateList.Count(), &SortEffectsBySignificance);
+
+        // Throttle the least significant effects when the last update took too long (with hysteresis to prevent flickering)
+        if (Particles::UpdateTimeBudget > 0.0f)
+        {
+            const float lastUpdateTime = Particles::System->LastDuration + Particles::EmittersSystem->LastDuration;
+            if (lastUpdateTime > Particles::UpdateTimeBudget)
+                UpdateTimeThrottle = Math::Min(UpdateTimeThrottle + 0.1f, 0.9f);
+            else if (lastUpdateTime < Particles::UpdateTimeBudget * 0.75f)
+                UpdateTimeThrottle = Math::Max(UpdateTimeThrottle - 0.05f, 0.0f);
+            const int32 skipCount = (int32)((float)UpdateList.Count() * UpdateTimeThrottle);
+            if (skipCount > 0)
+                UpdateList.Resize(UpdateList.Count() - skipCount);
+        }
+        else
+        {
+            UpdateTimeThrottle = 0.0f;
+        }
+
+        // Stop spawning new particles in the least significant effects that don't fit into the budget
+        if (Particles::ParticlesBudget > 0)
+        {
+            int32 particlesCount = 0;
+            for (ParticleEffect* effect : UpdateList)
+            {
+                if (particlesCount >= Particles::ParticlesBudget)
+                    effect->Instance.SpawnRateScale = 0.0f;
+                particlesCount += GetParticlesCountEstimate(effect->Instance);
+            }
+        }
+    }
+}
+
 TaskGraphSystem* Particles::System = nullptr;
+TaskGraphSystem* Particles::EmittersSystem = nullptr;
+float Particles::LODDistanceScale = 1.0f;
+int32 Particles::ParticlesBudget = 0;
+float Particles::UpdateTimeBudget = 0.0f;
 bool Particles::EnableParticleBufferPooling = true;
 float Particles::ParticleBufferRecycleTimeout = 10.0f;
 
@@ -144,6 +268,14 @@ class ParticlesSystem : public TaskGraphSystem
     void PostExecute(TaskGraph* graph) override;
 };
 
+class ParticlesEmittersSystem : public TaskGraphSystem
+{
+public:
+    void Job(int32 index);
+    void Execute(TaskGraph* graph) override;
+    void PostExecute(TaskGraph* graph) override;
+};
+
 ParticleManagerService ParticleManagerServiceInstance;
 
 void Particles::UpdateEffect(ParticleEffect* effect)
@@ -709,8 +841,9 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             const int32 threadGroupSize = 1024;
             context->Dispatch(GPUParticlesSortingCS[permutationIndex], Math::DivideAndRoundUp(buffer->GPU.ParticlesCountMax, threadGroupSize), 1, 1);
 
-            // Perform sorting
-            BitonicSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.Buffer, data.ParticleCounterOffset, sortAscending, buffer->GPU.SortedIndices);
+            // Perform sorting (radix sort scales better for large emitters, bitonic sort is used for small ones or as a fallback)
+            if (buffer->Capacity < (int32)RadixSort::MinItemsCount || RadixSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.Buffer, data.ParticleCounterOffset, sortAscending, buffer->GPU.SortedIndices))
+                BitonicSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.Buffer, data.ParticleCounterOffset, sortAscending, buffer->GPU.SortedIndices);
         }
     }
 
@@ -1093,28 +1226,16 @@ ParticleBuffer* Particles::AcquireParticleBuffer(ParticleEmitter* emitter)
 
     if (emitter->EnablePooling && EnableParticleBufferPooling)
     {
+        // Reuse buffer with the matching storage (can be created for other emitter)
         PoolLocker.Lock();
-        const auto entries = Pool.TryGet(emitter);
-        if (entries)
+        const ParticleBufferKey key(emitter);
+        const auto entries = Pool.TryGet(key);
+        if (entries && entries->HasItems())
         {
-            while (entries->HasItems())
-            {
-                // Reuse buffer
-                result = entries->Last().Buffer;
-                entries->RemoveLast();
-
-                // Remove old buffers
-                if (result->Version != emitter->Graph.Version)
-                {
-                    Delete(result);
-                    result = nullptr;
-                    if (entries->IsEmpty())
-                    {
-                        Pool.Remove(emitter);
-                        break;
-                    }
-                }
-            }
+            result = entries->Last().Buffer;
+            entries->RemoveLast();
+            if (entries->IsEmpty())
+                Pool.Remove(key);
         }
         PoolLocker.Unlock();
     }
@@ -1133,6 +1254,9 @@ ParticleBuffer* Particles::AcquireParticleBuffer(ParticleEmitter* emitter)
     else
     {
         // Prepare buffer
+        result->Version = emitter->Graph.Version;
+        result->Emitter = emitter;
+        result->Layout = &emitter->Graph.Layout;
         result->Clear();
     }
 
@@ -1149,7 +1273,7 @@ void Particles::RecycleParticleBuffer(ParticleBuffer* buffer)
         c.Buffer = buffer;
 
         PoolLocker.Lock();
-        Pool[buffer->Emitter].Add(c);
+        Pool[ParticleBufferKey(buffer)].Add(c);
         PoolLocker.Unlock();
     }
     else
@@ -1159,18 +1283,58 @@ void Particles::RecycleParticleBuffer(ParticleBuffer* buffer)
     }
 }
 
+bool Particles::PrewarmParticleBuffers(ParticleSystem* system, int32 instancesCount)
+{
+    if (!system || system->WaitForLoaded())
+        return true;
+    PROFILE_CPU();
+    for (const auto& track : system->Tracks)
+    {
+        if (track.Type != ParticleSystem::Track::Types::Emitter || track.Disabled)
+            continue;
+        ParticleEmitter* emitter = system->Emitters[track.AsEmitter.Index].Get();
+        if (!emitter || emitter->WaitForLoaded())
+            return true;
+        if (!emitter->EnablePooling || !EnableParticleBufferPooling || emitter->Capacity == 0 || emitter->Graph.Layout.Size == 0)
+            continue;
+
+        // Count the buffers that are already in the pool
+        const ParticleBufferKey key(emitter);
+        PoolLocker.Lock();
+        const auto entries = Pool.TryGet(key);
+        int32 count = entries ? entries->Count() : 0;
+        PoolLocker.Unlock();
+
+        // Allocate the missing buffers (including the sorting data that is created on the first draw)
+        for (; count < instancesCount; count++)
+        {
+            auto buffer = New<ParticleBuffer>();
+            if (buffer->Init(emitter) || buffer->AllocateSortBuffer())
+            {
+                LOG(Error, "Failed to create particle buffer for emitter {0}", emitter->ToString());
+                Delete(buffer);
+                return true;
+            }
+            RecycleParticleBuffer(buffer);
+        }
+    }
+    return false;
+}
+
 void Particles::OnEmitterUnload(ParticleEmitter* emitter)
 {
+    // Pooled buffers can be reused by other emitters so just unlink them
     PoolLocker.Lock();
-    const auto entries = Pool.TryGet(emitter);
-    if (entries)
+    for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
     {
-        for (int32 i = 0; i < entries->Count(); i++)
+        for (auto& e : i->Value)
         {
-            Delete(entries->At(i).Buffer);
+            if (e.Buffer->Emitter == emitter)
+            {
+                e.Buffer->Emitter = nullptr;
+                e.Buffer->Layout = nullptr;
+            }
         }
-        entries->Clear();
-        Pool.Remove(emitter);
     }
     PoolLocker.Unlock();
 
@@ -1190,12 +1354,18 @@ bool ParticleManagerService::Init()
     Particles::System = New<ParticlesSystem>();
     Particles::System->Order = 10000;
     Engine::UpdateGraph->AddSystem(Particles::System);
+    Particles::EmittersSystem = New<ParticlesEmittersSystem>();
+    Particles::EmittersSystem->Order = 10000;
+    Particles::EmittersSystem->AddDependency(Particles::System);
+    Engine::UpdateGraph->AddSystem(Particles::EmittersSystem);
     return false;
 }
 
 void ParticleManagerService::Dispose()
 {
     UpdateList.Clear();
+    EmittersUpdateList.Clear();
+    EmittersBoundsCounters.Clear();
 #if COMPILE_WITH_GPU_PARTICLES
     GpuUpdateList.Clear();
     if (GpuRenderTask)
@@ -1226,12 +1396,14 @@ void ParticleManagerService::Dispose()
     PoolLocker.Unlock();
 
     SpriteRenderer.Dispose();
+    SAFE_DELETE(Particles::EmittersSystem);
     SAFE_DELETE(Particles::System);
 }
 
 void ParticlesSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Particles.Job");
+    AssetReferencesBatch referencesBatch;
     auto effect = UpdateList[index];
     auto& instance = effect->Instance;
     const auto particleSystem = effect->ParticleSystem.Get();
@@ -1322,7 +1494,8 @@ void ParticlesSystem::Job(int32 index)
     }
     instance.LastUpdateTime = t;
 
-    // Update all emitter tracks
+    // Update all emitter tracks (CPU emitters simulation is deferred to run each emitter as a separate job)
+    Array<EmitterUpdate, InlinedAllocation<8>> cpuUpdates;
     for (int32 j = 0; j < particleSystem->Tracks.Count(); j++)
     {
         const auto& track = particleSystem->Tracks[j];
@@ -1351,9 +1524,17 @@ void ParticlesSystem::Job(int32 index)
         switch (emitter->SimulationMode)
         {
         case ParticlesSimulationMode::CPU:
-            emitter->GraphExecutorCPU.Update(emitter, effect, data, dt, canSpawn);
+        {
+            auto& e = cpuUpdates.AddOne();
+            e.Effect = effect;
+            e.Emitter = emitter;
+            e.Data = &data;
+            e.DeltaTime = dt;
+            e.CanSpawn = canSpawn;
+            e.BoundsCounter = -1;
             updateBounds |= emitter->UseAutoBounds;
             break;
+        }
 #if COMPILE_WITH_GPU_PARTICLES
         case ParticlesSimulationMode::GPU:
             emitter->GPU.Update(emitter, effect, data, dt, canSpawn);
@@ -1365,6 +1546,21 @@ void ParticlesSystem::Job(int32 index)
         }
     }
 
+    if (cpuUpdates.HasItems())
+    {
+        // Bounds are updated by the last finished CPU emitter job
+        ScopeLock lock(EmittersUpdateListLocker);
+        if (updateBounds)
+        {
+            const int32 boundsCounter = EmittersBoundsCounters.Count();
+            EmittersBoundsCounters.Add(cpuUpdates.Count());
+            for (auto& e : cpuUpdates)
+                e.BoundsCounter = boundsCounter;
+            updateBounds = false;
+        }
+        EmittersUpdateList.Add(cpuUpdates.Get(), cpuUpdates.Count());
+    }
+
     // Update bounds if any of the emitters uses auto-bounds
     if (updateBounds)
     {
@@ -1393,12 +1589,52 @@ void ParticlesSystem::Execute(TaskGraph* graph)
     Time = tickData.Time.GetTotalSeconds();
     UnscaledTime = tickData.UnscaledTime.GetTotalSeconds();
 
+    // Fit into the particles budget
+    if (Particles::ParticlesBudget > 0 || Particles::UpdateTimeBudget > 0.0f)
+    {
+        ApplyParticlesBudget();
+        if (UpdateList.Count() == 0)
+            return;
+    }
+
     // Schedule work to update all particles in async
     Function<void(int32)> job;
     job.Bind<ParticlesSystem, &ParticlesSystem::Job>(this);
     graph->DispatchJob(job, UpdateList.Count());
 }
 
+void ParticlesEmittersSystem::Job(int32 index)
+{
+    PROFILE_CPU_NAMED("Particles.EmitterJob");
+    AssetReferencesBatch referencesBatch;
+    const EmitterUpdate& e = EmittersUpdateList[index];
+    PROFILE_CPU_ASSET(e.Emitter);
+    e.Emitter->GraphExecutorCPU.Update(e.Emitter, e.Effect, *e.Data, e.DeltaTime, e.CanSpawn);
+
+    // Update effect bounds after all of its emitters
+    if (e.BoundsCounter != -1 && Platform::InterlockedDecrement(&EmittersBoundsCounters[e.BoundsCounter]) == 0)
+    {
+        e.Effect->UpdateBounds();
+    }
+}
+
+void ParticlesEmittersSystem::Execute(TaskGraph* graph)
+{
+    if (EmittersUpdateList.Count() == 0)
+        return;
+
+    // Schedule work to update all CPU emitters in async
+    Function<void(int32)> job;
+    job.Bind<ParticlesEmittersSystem, &ParticlesEmittersSystem::Job>(this);
+    graph->DispatchJob(job, EmittersUpdateList.Count());
+}
+
+void ParticlesEmittersSystem::PostExecute(TaskGraph* graph)
+{
+    EmittersUpdateList.Clear();
+    EmittersBoundsCounters.Clear();
+}
+
 void ParticlesSystem::PostExecute(TaskGraph* graph)
 {
     PROFILE_CPU_NAMED("Particles.PostExecute");
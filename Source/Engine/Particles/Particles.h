@@ -27,6 +27,11 @@ API_CLASS(Static) class FLAXENGINE_API Particles
     /// </summary>
     API_FIELD(ReadOnly) static TaskGraphSystem* System;
 
+    /// <summary>
+    /// The system for CPU particle emitters simulation (executed after <see cref="System"/>, each emitter instance is updated as a separate job).
+    /// </summary>
+    API_FIELD(ReadOnly) static TaskGraphSystem* EmittersSystem;
+
 public:
     /// <summary>
     /// Updates the effect during next particles simulation tick.
@@ -48,6 +53,22 @@ API_CLASS(Static) class FLAXENGINE_API Particles
     /// <param name="effect">The owning actor.</param>
     static void DrawParticles(RenderContext& renderContext, ParticleEffect* effect);
 
+public:
+    /// <summary>
+    /// The global scale of the particle effects LOD distances. Use lower values to switch effects to the lower quality levels closer to the view (eg. on low-end platforms).
+    /// </summary>
+    API_FIELD() static float LODDistanceScale;
+
+    /// <summary>
+    /// The maximum amount of particles to simulate by all effects (0 means unlimited). Once exceeded, the least significant effects stop spawning new particles.
+    /// </summary>
+    API_FIELD() static int32 ParticlesBudget;
+
+    /// <summary>
+    /// The maximum CPU time (in milliseconds) for the particles simulation update (0 means unlimited). Once exceeded, the least significant effects are skipped during the update (they catch up with the larger time step once the budget allows it).
+    /// </summary>
+    API_FIELD() static float UpdateTimeBudget;
+
 public:
     /// <summary>
     /// Enables or disables particle buffer pooling.
@@ -72,6 +93,14 @@ API_CLASS(Static) class FLAXENGINE_API Particles
     /// <param name="buffer">The particle buffer.</param>
     static void RecycleParticleBuffer(ParticleBuffer* buffer);
 
+    /// <summary>
+    /// Pre-allocates the particle buffers for the effect emitters and puts them into the pool. Can be used during the level loading to prevent allocating GPU memory when effects get spawned during the gameplay (eg. explosions).
+    /// </summary>
+    /// <param name="system">The particle system to prewarm.</param>
+    /// <param name="instancesCount">The amount of the effect instances to allocate buffers for (eg. maximum amount of effects playing at once).</param>
+    /// <returns>True if failed to prewarm the buffers (eg. asset failed to load), otherwise false.</returns>
+    API_FUNCTION() static bool PrewarmParticleBuffers(ParticleSystem* system, int32 instancesCount = 1);
+
     /// <summary>
     /// Called when emitter gets unloaded. Particle buffers using this emitter has to be cleared.
     /// </summary>
@@ -217,7 +217,7 @@ class FLAXENGINE_API ParticleBuffer
 {
 public:
     /// <summary>
-    /// The emitter graph version (cached on Init). Used to discard pooled buffers that has been created for older emitter graph.
+    /// The emitter graph version (cached on Init or when reused from the pool).
     /// </summary>
     uint32 Version;
 
@@ -254,9 +254,9 @@ class FLAXENGINE_API ParticleBuffer
         int32 Count;
 
         /// <summary>
-        /// The particles data buffer (CPU side).
+        /// The particles data buffer (CPU side). Uses large memory pages for big emitters if enabled.
         /// </summary>
-        Array<byte> Buffer;
+        Array<byte, LargePageAllocation> Buffer;
 
         /// <summary>
         /// The sorted ribbon particles indices (CPU side). Cached after system update and reused during rendering (batched for all ribbon modules).
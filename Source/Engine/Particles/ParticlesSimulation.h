@@ -154,6 +154,11 @@ class FLAXENGINE_API ParticleSystemInstance
     /// </summary>
     float LastUpdateTime = -1;
 
+    /// <summary>
+    /// The scale of the particles spawn rate applied to all emitters spawn modules (eg. reduced by the effect LOD or the particles budget).
+    /// </summary>
+    float SpawnRateScale = 1.0f;
+
     /// <summary>
     /// The particle system emitters data (one per emitter instance).
     /// </summary>
@@ -3,6 +3,7 @@
 #include "RigidBody.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Physics/Colliders/Collider.h"
+#include "Engine/Physics/Physics.h"
 #include "Engine/Physics/PhysicsBackend.h"
 #include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Serialization/Serialization.h"
@@ -26,6 +27,8 @@ RigidBody::RigidBody(const SpawnParams& params)
     , _updateMassWhenScaleChanges(false)
     , _overrideMass(false)
     , _isUpdatingTransform(false)
+    , _isInterpolating(false)
+    , _isInterpolationQueued(false)
 {
 }
 
@@ -402,12 +405,27 @@ void* RigidBody::GetPhysicsActor() const
 
 void RigidBody::OnActiveTransformChanged()
 {
-    // Change actor transform (but with locking)
-    ASSERT(!_isUpdatingTransform);
-    _isUpdatingTransform = true;
     Transform transform;
     PhysicsBackend::GetRigidActorPose(_actor, transform.Translation, transform.Orientation);
     transform.Scale = _transform.Scale;
+    if (Physics::GetPipelinedSimulation() && !_isKinematic)
+    {
+        // Blend into the simulated pose over the next step to hide the fixed timestep from the rendering
+        _interpolationStart = _transform;
+        _interpolationEnd = transform;
+        _isInterpolating = true;
+        GetPhysicsScene()->AddInterpolatedBody(this);
+        return;
+    }
+    _isInterpolating = false;
+    SetTransformFromPhysics(transform);
+}
+
+void RigidBody::SetTransformFromPhysics(const Transform& transform)
+{
+    // Change actor transform (but with locking)
+    ASSERT(!_isUpdatingTransform);
+    _isUpdatingTransform = true;
     if (_parent)
     {
         _parent->GetTransform().WorldToLocal(transform, _localTransform);
@@ -420,10 +438,26 @@ void RigidBody::OnActiveTransformChanged()
     _isUpdatingTransform = false;
 }
 
+bool RigidBody::UpdateInterpolation(float alpha)
+{
+    if (!_isInterpolating)
+        return true;
+    Transform transform;
+    Transform::Lerp(_interpolationStart, _interpolationEnd, alpha, transform);
+    SetTransformFromPhysics(transform);
+    if (alpha >= 1.0f)
+    {
+        _isInterpolating = false;
+        return true;
+    }
+    return false;
+}
+
 void RigidBody::BeginPlay(SceneBeginData* data)
 {
     // Create rigid body
     ASSERT(_actor == nullptr);
+    Physics::AddRegionActor(this);
     void* scene = GetPhysicsScene()->GetPhysicsScene();
     _actor = PhysicsBackend::CreateRigidDynamicActor(this, _transform.Translation, _transform.Orientation, scene);
 
@@ -480,6 +514,8 @@ void RigidBody::EndPlay()
     // Base
     Actor::EndPlay();
 
+    GetPhysicsScene()->RemoveInterpolatedBody(this);
+    Physics::RemoveRegionActor(this);
     if (_actor)
     {
         // Remove actor
@@ -517,6 +553,7 @@ void RigidBody::OnTransformChanged()
     // Update physics is not during physics state synchronization
     if (!_isUpdatingTransform && _actor)
     {
+        _isInterpolating = false;
         const bool kinematic = GetIsKinematic() && GetEnableSimulation();
         PhysicsBackend::SetRigidActorPose(_actor, _transform.Translation, _transform.Orientation, kinematic, true);
         UpdateScale();
@@ -527,6 +564,10 @@ void RigidBody::OnTransformChanged()
 
 void RigidBody::OnPhysicsSceneChanged(PhysicsScene* previous)
 {
+    previous->RemoveInterpolatedBody(this);
+    _isInterpolating = false;
+    if (!_actor)
+        return;
     PhysicsBackend::RemoveSceneActor(previous->GetPhysicsScene(), _actor);
     void* scene = GetPhysicsScene()->GetPhysicsScene();
     PhysicsBackend::AddSceneActor(scene, _actor);
@@ -18,6 +18,7 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Physics/Rigid Body\"), ActorToolbox
 class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
 {
     DECLARE_SCENE_OBJECT(RigidBody);
+    friend PhysicsScene;
 protected:
     void* _actor;
     Float3 _cachedScale;
@@ -38,6 +39,10 @@ class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
     int32 _updateMassWhenScaleChanges : 1;
     int32 _overrideMass : 1;
     int32 _isUpdatingTransform : 1;
+    int32 _isInterpolating : 1;
+    int32 _isInterpolationQueued : 1;
+    Transform _interpolationStart;
+    Transform _interpolationEnd;
 
 public:
     /// <summary>
@@ -535,4 +540,8 @@ class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
     void OnActiveInTreeChanged() override;
     void OnTransformChanged() override;
     void OnPhysicsSceneChanged(PhysicsScene* previous) override;
+
+private:
+    void SetTransformFromPhysics(const Transform& transform);
+    bool UpdateInterpolation(float alpha);
 };
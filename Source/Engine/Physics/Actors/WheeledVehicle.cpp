@@ -332,6 +332,8 @@ void WheeledVehicle::OnPhysicsSceneChanged(PhysicsScene* previous)
     RigidBody::OnPhysicsSceneChanged(previous);
 
 #if WITH_VEHICLE
+    if (!_vehicle)
+        return;
     PhysicsBackend::RemoveVehicle(previous->GetPhysicsScene(), this);
     PhysicsBackend::AddVehicle(GetPhysicsScene()->GetPhysicsScene(), this);
 #endif
@@ -315,6 +315,7 @@ void CharacterController::GetGeometry(CollisionShape& collision)
 
 void CharacterController::BeginPlay(SceneBeginData* data)
 {
+    Physics::AddRegionActor(this);
     if (IsActiveInHierarchy())
         CreateController();
 
@@ -328,6 +329,7 @@ void CharacterController::EndPlay()
     Actor::EndPlay();
 
     // Remove controller
+    Physics::RemoveRegionActor(this);
     DeleteController();
 }
 
@@ -384,8 +386,11 @@ void CharacterController::OnPhysicsSceneChanged(PhysicsScene* previous)
 {
     Collider::OnPhysicsSceneChanged(previous);
 
-    DeleteController();
-    CreateController();
+    if (_controller)
+    {
+        DeleteController();
+        CreateController();
+    }
 }
 
 void CharacterController::Serialize(SerializeStream& stream, const void* otherObj)
@@ -332,7 +332,9 @@ void Collider::BeginPlay(SceneBeginData* data)
         }
         else
         {
-            // Be a static collider
+            // Be a static collider (placed in the physics region at its location)
+            if (Physics::GetRegionsEnabled() && GetPhysicsScene() == Physics::DefaultScene)
+                SetPhysicsScene(Physics::GetRegionScene(_transform.LocalToWorld(_center)));
             CreateStaticActor();
         }
     }
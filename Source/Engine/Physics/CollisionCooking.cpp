@@ -8,6 +8,33 @@
 #include "Engine/Graphics/Models/MeshBase.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Utilities/Crc.h"
+
+// Increment to invalidate the cooked collision data cache (eg. on cooking options or physics backend change)
+#define COLLISION_CACHE_VERSION 1
+
+namespace
+{
+    String GetCachePath(const CollisionCooking::CookingInput& input, CollisionDataType type)
+    {
+        const uint32 vertexHash = Crc::MemCrc32(input.VertexData, input.VertexCount * sizeof(Float3));
+        const uint32 indexHash = Crc::MemCrc32(input.IndexData, input.IndexCount * (input.Is16bitIndexData ? sizeof(uint16) : sizeof(uint32)));
+        const String name = String::Format(TEXT("{0}_{1}_{2}_{3:x}_{4:x}_{5}_{6}.bin"), (int32)type, input.VertexCount, input.IndexCount, vertexHash, indexHash, (uint32)input.ConvexFlags, input.ConvexVertexLimit);
+        return CollisionCooking::GetCacheFolder() / name;
+    }
+}
+
+String CollisionCooking::GetCacheFolder()
+{
+#if USE_EDITOR
+    return Globals::ProjectCacheFolder / String::Format(TEXT("Collision/{0}"), COLLISION_CACHE_VERSION);
+#else
+    return Globals::ProductLocalFolder / String::Format(TEXT("Collision/{0}"), COLLISION_CACHE_VERSION);
+#endif
+}
 
 bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::SerializedOptions& outputOptions, BytesContainer& outputData)
 {
@@ -249,21 +276,45 @@ bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::Seriali
     cookingInput.ConvexFlags = arg.ConvexFlags;
     cookingInput.ConvexVertexLimit = convexVertexLimit;
 
-    // Cook!
-    if (arg.Type == CollisionDataType::ConvexMesh)
+    // Try to reuse the data cooked from the same geometry before
+    String cachePath;
+    bool isCached = false;
+    if (arg.UseCache && (arg.Type == CollisionDataType::ConvexMesh || arg.Type == CollisionDataType::TriangleMesh))
     {
-        if (CookConvexMesh(cookingInput, outputData))
-            return true;
+        cachePath = GetCachePath(cookingInput, arg.Type);
+        isCached = FileSystem::FileExists(cachePath) && !File::ReadAllBytes(cachePath, outputData) && outputData.Length() != 0;
     }
-    else if (arg.Type == CollisionDataType::TriangleMesh)
+
+    // Cook!
+    if (!isCached)
     {
-        if (CookTriangleMesh(cookingInput, outputData))
+        if (arg.Type == CollisionDataType::ConvexMesh)
+        {
+            if (CookConvexMesh(cookingInput, outputData))
+                return true;
+        }
+        else if (arg.Type == CollisionDataType::TriangleMesh)
+        {
+            if (CookTriangleMesh(cookingInput, outputData))
+                return true;
+        }
+        else
+        {
+            LOG(Warning, "Invalid collision data type.");
             return true;
-    }
-    else
-    {
-        LOG(Warning, "Invalid collision data type.");
-        return true;
+        }
+
+        if (cachePath.HasChars())
+        {
+            // Write to a temporary file first so other threads (or processes) never read the partially written data
+            const String tmpPath = cachePath + String::Format(TEXT(".{0}.tmp"), Platform::GetCurrentThreadID());
+            FileSystem::CreateDirectory(GetCacheFolder());
+            if (File::WriteAllBytes(tmpPath, outputData.Get(), outputData.Length()) || FileSystem::MoveFile(cachePath, tmpPath, true))
+            {
+                LOG(Warning, "Failed to save cooked collision data cache to {0}", cachePath);
+                FileSystem::DeleteFile(tmpPath);
+            }
+        }
     }
 
     // Setup options
@@ -42,8 +42,14 @@ class CollisionCooking
         uint32 MaterialSlotsMask = MAX_uint32;
         ConvexMeshGenerationFlags ConvexFlags = ConvexMeshGenerationFlags::None;
         int32 ConvexVertexLimit = 255;
+        bool UseCache = true;
     };
 
+    /// <summary>
+    /// Gets the directory with the cooked collision data cache. Cooking results are stored there under the hash of the input geometry and options so the same mesh is not cooked twice (also across the sessions).
+    /// </summary>
+    static String GetCacheFolder();
+
     /// <summary>
     /// Attempts to cook a convex mesh from the provided mesh data. Assumes the input data is valid and contains vertex
     /// positions. If the method returns false the resulting convex mesh will be in the output parameter.
@@ -3,12 +3,14 @@
 #include "CollisionData.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Content/AssetReference.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Factories/BinaryAssetFactory.h"
 #include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Physics/PhysicsBackend.h"
 #include "Engine/Physics/CollisionCooking.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/Task.h"
 
 REGISTER_BINARY_ASSET(CollisionData, "FlaxEngine.CollisionData", true);
 
@@ -46,19 +48,7 @@ bool CollisionData::CookCollision(CollisionDataType type, ModelBase* modelObj, i
     {
         return true;
     }
-
-    // Clear state
-    unload(true);
-
-    // Load data
-    if (load(&options, outputData.Get(), outputData.Length()) != LoadResult::Ok)
-    {
-        return true;
-    }
-
-    // Mark as loaded (eg. Mesh Colliders using this asset will update shape for physics simulation)
-    onLoaded();
-    return false;
+    return applyCooked(options, outputData);
 }
 
 bool CollisionData::CookCollision(CollisionDataType type, const Span<Float3>& vertices, const Span<uint32>& triangles, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit)
@@ -112,12 +102,67 @@ bool CollisionData::CookCollision(CollisionDataType type, ModelData* modelData,
     {
         return true;
     }
+    return applyCooked(options, outputData);
+}
+
+Task* CollisionData::CookCollisionAsync(CollisionDataType type, ModelBase* model, int32 modelLodIndex, uint32 materialSlotsMask, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit, const Function<void(bool)>& completed)
+{
+    if (!IsVirtual())
+    {
+        LOG(Warning, "Only virtual assets can be modified at runtime.");
+        return nullptr;
+    }
+
+    // Keep both assets referenced until cooking ends
+    AssetReference<CollisionData> asset = this;
+    AssetReference<ModelBase> modelRef = model;
+    Function<void()> action = [asset, modelRef, type, modelLodIndex, materialSlotsMask, convexFlags, convexVertexLimit, completed]
+    {
+        const bool failed = asset->CookCollision(type, modelRef.Get(), modelLodIndex, materialSlotsMask, convexFlags, convexVertexLimit);
+        if (completed.IsBinded())
+            completed(failed);
+    };
+    return Task::StartNew(action);
+}
+
+Task* CollisionData::CookCollisionAsync(CollisionDataType type, const Span<Float3>& vertices, const Span<uint32>& triangles, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit, const Function<void(bool)>& completed)
+{
+    CHECK_RETURN(vertices.Length() != 0, nullptr);
+    CHECK_RETURN(triangles.Length() != 0 && triangles.Length() % 3 == 0, nullptr);
+    if (!IsVirtual())
+    {
+        LOG(Warning, "Only virtual assets can be modified at runtime.");
+        return nullptr;
+    }
+
+    // Copy the geometry since the input memory can be released before cooking starts
+    auto modelData = New<ModelData>();
+    modelData->LODs.Resize(1);
+    auto meshData = New<MeshData>();
+    modelData->LODs[0].Meshes.Add(meshData);
+    meshData->Positions.Set(vertices.Get(), vertices.Length());
+    meshData->Indices.Set(triangles.Get(), triangles.Length());
+    AssetReference<CollisionData> asset = this;
+    Function<void()> action = [asset, modelData, type, convexFlags, convexVertexLimit, completed]
+    {
+        const bool failed = asset->CookCollision(type, modelData, convexFlags, convexVertexLimit);
+        Delete(modelData);
+        if (completed.IsBinded())
+            completed(failed);
+    };
+    return Task::StartNew(action);
+}
+
+bool CollisionData::applyCooked(const SerializedOptions& options, BytesContainer& data)
+{
+    // Prevent from reloading the asset by the other cooking tasks at once
+    ScopeLock lock(Locker);
 
     // Clear state
     unload(true);
 
     // Load data
-    if (load(&options, outputData.Get(), outputData.Length()) != LoadResult::Ok)
+    if (load(&options, data.Get(), data.Length()) != LoadResult::Ok)
     {
         return true;
     }
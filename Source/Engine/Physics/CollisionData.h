@@ -9,6 +9,7 @@ class Model;
 class ModelBase;
 class ModelData;
 class MeshBase;
+class Task;
 
 /// <summary>
 /// A <see cref="CollisionData"/> storage data type.
@@ -244,6 +245,37 @@ API_CLASS(NoSpawn) class FLAXENGINE_API CollisionData : public BinaryAsset
     /// <returns>True if failed, otherwise false.</returns>
     bool CookCollision(CollisionDataType type, ModelData* modelData, ConvexMeshGenerationFlags convexFlags, int32 convexVertexLimit);
 
+    /// <summary>
+    /// Cooks the mesh collision data and updates the virtual asset asynchronously on a thread pool. Multiple assets can be cooked in parallel.
+    /// </summary>
+    /// <remarks>
+    /// Can be used only for virtual assets (see <see cref="Asset.IsVirtual"/> and <see cref="Content.CreateVirtualAsset{T}"/>).
+    /// </remarks>
+    /// <param name="type">The collision data type.</param>
+    /// <param name="model">The source model.</param>
+    /// <param name="modelLodIndex">The source model LOD index.</param>
+    /// <param name="materialSlotsMask">The source model material slots mask. One bit per-slot. Can be used to exclude particular material slots from collision cooking.</param>
+    /// <param name="convexFlags">The convex mesh generation flags.</param>
+    /// <param name="convexVertexLimit">The convex mesh vertex limit. Use values in range [8;255]</param>
+    /// <param name="completed">The optional callback invoked when cooking ends (called from the thread pool thread). Gets true if cooking failed, otherwise false.</param>
+    /// <returns>The started cooking task or null if failed to start it.</returns>
+    Task* CookCollisionAsync(CollisionDataType type, ModelBase* model, int32 modelLodIndex = 0, uint32 materialSlotsMask = MAX_uint32, ConvexMeshGenerationFlags convexFlags = ConvexMeshGenerationFlags::None, int32 convexVertexLimit = 255, const Function<void(bool)>& completed = Function<void(bool)>());
+
+    /// <summary>
+    /// Cooks the mesh collision data and updates the virtual asset asynchronously on a thread pool. Multiple assets can be cooked in parallel.
+    /// </summary>
+    /// <remarks>
+    /// Can be used only for virtual assets (see <see cref="Asset.IsVirtual"/> and <see cref="Content.CreateVirtualAsset{T}"/>).
+    /// </remarks>
+    /// <param name="type">The collision data type.</param>
+    /// <param name="vertices">The source geometry vertex buffer with vertices positions (copied internally). Cannot be empty.</param>
+    /// <param name="triangles">The source data index buffer (triangles list, copied internally). Uses 32-bit stride buffer. Cannot be empty. Length must be multiple of 3 (as 3 vertices build a triangle).</param>
+    /// <param name="convexFlags">The convex mesh generation flags.</param>
+    /// <param name="convexVertexLimit">The convex mesh vertex limit. Use values in range [8;255]</param>
+    /// <param name="completed">The optional callback invoked when cooking ends (called from the thread pool thread). Gets true if cooking failed, otherwise false.</param>
+    /// <returns>The started cooking task or null if failed to start it.</returns>
+    Task* CookCollisionAsync(CollisionDataType type, const Span<Float3>& vertices, const Span<uint32>& triangles, ConvexMeshGenerationFlags convexFlags = ConvexMeshGenerationFlags::None, int32 convexVertexLimit = 255, const Function<void(bool)>& completed = Function<void(bool)>());
+
 #endif
 
     /// <summary>
@@ -278,6 +310,9 @@ API_CLASS(NoSpawn) class FLAXENGINE_API CollisionData : public BinaryAsset
 
 private:
     LoadResult load(const SerializedOptions* options, byte* dataPtr, int32 dataSize);
+#if COMPILE_WITH_PHYSICS_COOKING
+    bool applyCooked(const SerializedOptions& options, BytesContainer& data);
+#endif
 
 protected:
     // [BinaryAsset]
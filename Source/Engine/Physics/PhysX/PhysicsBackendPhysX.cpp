@@ -13,6 +13,7 @@
 #include "Engine/Physics/PhysicsStatistics.h"
 #include "Engine/Physics/CollisionCooking.h"
 #include "Engine/Physics/Actors/IPhysicsActor.h"
+#include "Engine/Physics/Actors/RigidBody.h"
 #include "Engine/Physics/Joints/Limits.h"
 #include "Engine/Physics/Joints/DistanceJoint.h"
 #include "Engine/Physics/Joints/HingeJoint.h"
@@ -21,9 +22,11 @@
 #include "Engine/Physics/Joints/D6Joint.h"
 #include "Engine/Physics/Colliders/Collider.h"
 #include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/CPUTopology.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/WriteStream.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/PhysX/PxPhysicsAPI.h>
 #include <ThirdParty/PhysX/PxQueryFiltering.h>
 #include <ThirdParty/PhysX/extensions/PxFixedJoint.h>
@@ -103,6 +106,27 @@ class ErrorPhysX : public PxErrorCallback
     }
 };
 
+#if COMPILE_WITH_PROFILER
+
+class ProfilerPhysX : public PxProfilerCallback
+{
+    void* zoneStart(const char* eventName, bool detached, uint64_t contextId) override
+    {
+        // Detached zones can end on a different thread so skip them
+        if (detached)
+            return nullptr;
+        return (void*)(intptr)(ProfilerCPU::BeginEvent(eventName) + 1);
+    }
+
+    void zoneEnd(void* profilerData, const char* eventName, bool detached, uint64_t contextId) override
+    {
+        if (profilerData)
+            ProfilerCPU::EndEvent((int32)(intptr)profilerData - 1);
+    }
+};
+
+#endif
+
 class QueryFilterPhysX : public PxQueryFilterCallback
 {
     PxQueryHitType::Enum preFilter(const PxFilterData& filterData, const PxShape* shape, const PxRigidActor* actor, PxHitFlags& queryFlags) override
@@ -433,6 +457,9 @@ namespace
     PxMaterial* DefaultMaterial = nullptr;
     AllocatorPhysX AllocatorCallback;
     ErrorPhysX ErrorCallback;
+#if COMPILE_WITH_PROFILER
+    ProfilerPhysX ProfilerCallback;
+#endif
     PxTolerancesScale ToleranceScale;
     QueryFilterPhysX QueryFilter;
     CharacterQueryFilterPhysX CharacterQueryFilter;
@@ -646,14 +673,14 @@ bool CollisionCooking::CookConvexMesh(CookingInput& input, BytesContainer& outpu
         desc.flags |= PxConvexFlag::Enum::eFAST_INERTIA_COMPUTATION;
     if (EnumHasAnyFlags(input.ConvexFlags, ConvexMeshGenerationFlags::ShiftVertices))
         desc.flags |= PxConvexFlag::Enum::eSHIFT_VERTICES;
+    // Note: cooking params are not modified on the shared cooking object so meshes can be cooked from multiple threads at once
     PxCookingParams cookingParams = cooking->getParams();
     cookingParams.suppressTriangleMeshRemapTable = EnumHasAnyFlags(input.ConvexFlags, ConvexMeshGenerationFlags::SuppressFaceRemapTable);
-    cooking->setParams(cookingParams);
 
     // Perform cooking
     PxDefaultMemoryOutputStream outputStream;
     PxConvexMeshCookingResult::Enum result;
-    if (!cooking->cookConvexMesh(desc, outputStream, &result))
+    if (!PxCookConvexMesh(cookingParams, desc, outputStream, &result))
     {
         LOG(Warning, "Convex Mesh cooking failed. Error code: {0}, Input vertices count: {1}", (int32)result, input.VertexCount);
         return true;
@@ -680,14 +707,14 @@ bool CollisionCooking::CookTriangleMesh(CookingInput& input, BytesContainer& out
     desc.triangles.stride = 3 * (input.Is16bitIndexData ? sizeof(uint16) : sizeof(uint32));
     desc.triangles.data = input.IndexData;
     desc.flags = input.Is16bitIndexData ? PxMeshFlag::e16_BIT_INDICES : (PxMeshFlag::Enum)0;
+    // Note: cooking params are not modified on the shared cooking object so meshes can be cooked from multiple threads at once
     PxCookingParams cookingParams = cooking->getParams();
     cookingParams.suppressTriangleMeshRemapTable = EnumHasAnyFlags(input.ConvexFlags, ConvexMeshGenerationFlags::SuppressFaceRemapTable);
-    cooking->setParams(cookingParams);
 
     // Perform cooking
     PxDefaultMemoryOutputStream outputStream;
     PxTriangleMeshCookingResult::Enum result;
-    if (!cooking->cookTriangleMesh(desc, outputStream, &result))
+    if (!PxCookTriangleMesh(cookingParams, desc, outputStream, &result))
     {
         LOG(Warning, "Triangle Mesh cooking failed. Error code: {0}, Input vertices count: {1}, indices count: {2}", (int32)result, input.VertexCount, input.IndexCount);
         return true;
@@ -751,6 +778,9 @@ bool PhysicsBackend::Init()
     LOG(Info, "Setup NVIDIA PhysX {0}.{1}.{2}", PX_PHYSICS_VERSION_MAJOR, PX_PHYSICS_VERSION_MINOR, PX_PHYSICS_VERSION_BUGFIX);
     Foundation = PxCreateFoundation(PX_PHYSICS_VERSION, AllocatorCallback, ErrorCallback);
     CHECK_INIT(Foundation, "PxCreateFoundation failed!");
+#if COMPILE_WITH_PROFILER
+    PxSetProfilerCallback(&ProfilerCallback);
+#endif
 
     // Init debugger
     PxPvd* pvd = nullptr;
@@ -850,6 +880,9 @@ void PhysicsBackend::Shutdown()
     }
 #if WITH_PVD
     RELEASE_PHYSX(PVD);
+#endif
+#if COMPILE_WITH_PROFILER
+    PxSetProfilerCallback(nullptr);
 #endif
     RELEASE_PHYSX(Foundation);
     SceneOrigins.Clear();
@@ -896,7 +929,12 @@ void* PhysicsBackend::CreateScene(const PhysicsSettings& settings)
     sceneDesc.solverType = PxSolverType::ePGS;
     if (sceneDesc.cpuDispatcher == nullptr)
     {
-        scenePhysX->CpuDispatcher = PxDefaultCpuDispatcherCreate(Math::Clamp<uint32>(Platform::GetCPUInfo().ProcessorCoreCount - 1, 1, 4));
+        // Keep simulation threads on the performance cores that share the L3 cache (PhysX supports only the first 32 processors)
+        const uint32 threadsCount = Math::Clamp<uint32>(Platform::GetCPUInfo().ProcessorCoreCount - 1, 1, 4);
+        PxU32 affinityMasks[4];
+        for (uint32 i = 0; i < threadsCount; i++)
+            affinityMasks[i] = (PxU32)Platform::GetCPUTopology().GetThreadAffinity(ThreadPlacement::Simulation, 0);
+        scenePhysX->CpuDispatcher = PxDefaultCpuDispatcherCreate(threadsCount, affinityMasks);
         CHECK_INIT(scenePhysX->CpuDispatcher, "PxDefaultCpuDispatcherCreate failed!");
         sceneDesc.cpuDispatcher = scenePhysX->CpuDispatcher;
     }
@@ -1416,6 +1454,65 @@ void PhysicsBackend::GetSceneStatistics(void* scene, PhysicsStatistics& result)
     result.LostPairs = px.nbLostPairs;
     result.NewTouches = px.nbNewTouches;
     result.LostTouches = px.nbLostTouches;
+    result.BroadPhaseAdds = px.getNbBroadPhaseAdds();
+    result.BroadPhaseRemoves = px.getNbBroadPhaseRemoves();
+    result.NarrowPhasePairs = px.nbDiscreteContactPairsTotal;
+    result.ContactPairs = px.nbDiscreteContactPairsWithContacts;
+    result.CachedContactPairs = px.nbDiscreteContactPairsWithCacheHits;
+    result.SolverPartitions = px.nbPartitions;
+    result.SolverConstraints = px.nbAxisSolverConstraints;
+    for (int32 i = 0; i < PxGeometryType::eGEOMETRY_COUNT; i++)
+    {
+        for (int32 j = 0; j < PxGeometryType::eGEOMETRY_COUNT; j++)
+        {
+            result.CCDPairs += px.getRbPairStats(PxSimulationStatistics::eCCD_PAIRS, (PxGeometryType::Enum)i, (PxGeometryType::Enum)j);
+            result.TriggerPairs += px.getRbPairStats(PxSimulationStatistics::eTRIGGER_PAIRS, (PxGeometryType::Enum)i, (PxGeometryType::Enum)j);
+        }
+    }
+}
+
+void PhysicsBackend::GetSceneActorsStatistics(void* scene, Array<PhysicsActorStatistics>& result)
+{
+    PROFILE_CPU_NAMED("Physics.ActorsStatistics");
+    auto scenePhysX = (ScenePhysX*)scene;
+
+    // Gather dynamic bodies
+    Array<PxActor*> actors;
+    actors.Resize(scenePhysX->Scene->getNbActors(PxActorTypeFlag::eRIGID_DYNAMIC));
+    scenePhysX->Scene->getActors(PxActorTypeFlag::eRIGID_DYNAMIC, actors.Get(), actors.Count());
+    Dictionary<RigidBody*, int32> bodies;
+    bodies.EnsureCapacity(actors.Count());
+    result.EnsureCapacity(actors.Count());
+    for (PxActor* actor : actors)
+    {
+        RigidBody* body = dynamic_cast<RigidBody*>(static_cast<IPhysicsActor*>(actor->userData));
+        if (!body)
+            continue;
+        bodies.Add(body, result.Count());
+        auto& e = result.AddOne();
+        e.Body = body;
+        e.ContactPairs = 0;
+        e.Contacts = 0;
+        e.IsSleeping = ((PxRigidDynamic*)actor)->isSleeping();
+    }
+
+    // Accumulate contacts reported by the last simulation step
+    for (auto& e : scenePhysX->EventsCallback.Collisions)
+    {
+        const Collision& c = e.Value;
+        PhysicsColliderActor* colliders[2] = { c.ThisActor, c.OtherActor };
+        for (PhysicsColliderActor* collider : colliders)
+        {
+            RigidBody* body = collider ? collider->GetAttachedRigidBody() : nullptr;
+            const int32* index = body ? bodies.TryGet(body) : nullptr;
+            if (index)
+            {
+                auto& stats = result[*index];
+                stats.ContactPairs++;
+                stats.Contacts += c.ContactsCount;
+            }
+        }
+    }
 }
 
 #endif
@@ -1693,6 +1790,104 @@ bool PhysicsBackend::OverlapConvex(void* scene, const Vector3& center, const Col
     return true;
 }
 
+// The amount of the batched scene queries executed by a single job
+#define SCENE_QUERY_BATCH_JOB_SIZE 64
+
+namespace
+{
+    template<typename QueryFunc>
+    int32 ExecuteQueryBatch(int32 count, QueryFunc query)
+    {
+        // Split the queries into jobs (scene queries are read-only so they can run concurrently)
+        int64 hits = 0;
+        const int32 jobsCount = Math::DivideAndRoundUp(count, SCENE_QUERY_BATCH_JOB_SIZE);
+        Function<void(int32)> job = [&](int32 jobIndex)
+        {
+            const int32 start = jobIndex * SCENE_QUERY_BATCH_JOB_SIZE;
+            const int32 end = Math::Min(start + SCENE_QUERY_BATCH_JOB_SIZE, count);
+            int64 jobHits = 0;
+            for (int32 i = start; i < end; i++)
+                jobHits += query(i) ? 1 : 0;
+            Platform::InterlockedAdd(&hits, jobHits);
+        };
+        if (jobsCount > 1)
+        {
+            JobSystem::Execute(job, jobsCount);
+        }
+        else if (jobsCount == 1)
+        {
+            job(0);
+        }
+        return (int32)hits;
+    }
+}
+
+int32 PhysicsBackend::RayCastBatch(void* scene, const Span<RayCastCommand>& commands, Span<RayCastHit> results)
+{
+    if (scene == nullptr)
+        return 0;
+    return ExecuteQueryBatch(commands.Length(), [&](int32 i)
+    {
+        const RayCastCommand& command = commands[i];
+        RayCastHit& hitInfo = results[i];
+        const uint32 layerMask = command.LayerMask;
+        const bool hitTriggers = command.HitTriggers;
+        SCENE_QUERY_SETUP(true);
+        PxRaycastBuffer buffer;
+        if (!scenePhysX->Scene->raycast(C2P(command.Origin - scenePhysX->Origin), C2P(command.Direction), command.MaxDistance, buffer, hitFlags, filterData, &QueryFilter))
+        {
+            hitInfo = RayCastHit();
+            return false;
+        }
+        SCENE_QUERY_COLLECT_SINGLE();
+        return true;
+    });
+}
+
+int32 PhysicsBackend::SphereCastBatch(void* scene, const Span<SphereCastCommand>& commands, Span<RayCastHit> results)
+{
+    if (scene == nullptr)
+        return 0;
+    return ExecuteQueryBatch(commands.Length(), [&](int32 i)
+    {
+        const SphereCastCommand& command = commands[i];
+        RayCastHit& hitInfo = results[i];
+        const uint32 layerMask = command.LayerMask;
+        const bool hitTriggers = command.HitTriggers;
+        SCENE_QUERY_SETUP_SWEEP_1();
+        const PxTransform pose(C2P(command.Center - scenePhysX->Origin));
+        const PxSphereGeometry geometry(command.Radius);
+        if (!scenePhysX->Scene->sweep(geometry, pose, C2P(command.Direction), command.MaxDistance, buffer, hitFlags, filterData, &QueryFilter))
+        {
+            hitInfo = RayCastHit();
+            return false;
+        }
+        SCENE_QUERY_COLLECT_SINGLE();
+        return true;
+    });
+}
+
+int32 PhysicsBackend::OverlapSphereBatch(void* scene, const Span<OverlapSphereCommand>& commands, Span<PhysicsColliderActor*> results)
+{
+    if (scene == nullptr)
+        return 0;
+    return ExecuteQueryBatch(commands.Length(), [&](int32 i)
+    {
+        const OverlapSphereCommand& command = commands[i];
+        const uint32 layerMask = command.LayerMask;
+        const bool hitTriggers = command.HitTriggers;
+        SCENE_QUERY_SETUP_OVERLAP_1();
+        const PxTransform pose(C2P(command.Center - scenePhysX->Origin));
+        const PxSphereGeometry geometry(command.Radius);
+        results[i] = nullptr;
+        if (!scenePhysX->Scene->overlap(geometry, pose, buffer, filterData, &QueryFilter) || buffer.getNbTouches() == 0)
+            return false;
+        const auto& hit = buffer.getTouch(0);
+        results[i] = hit.shape ? static_cast<PhysicsColliderActor*>(hit.shape->userData) : nullptr;
+        return results[i] != nullptr;
+    });
+}
+
 PhysicsBackend::ActorFlags PhysicsBackend::GetActorFlags(void* actor)
 {
     auto actorPhysX = (PxActor*)actor;
@@ -3150,6 +3345,9 @@ void PhysicsBackend::FlushRequests(void* scene)
         case ActionType::Sleep:
             static_cast<PxRigidDynamic*>(action.Actor)->putToSleep();
             break;
+        case ActionType::WakeUp:
+            static_cast<PxRigidDynamic*>(action.Actor)->wakeUp();
+            break;
         }
     }
     scenePhysX->Actions.Clear();
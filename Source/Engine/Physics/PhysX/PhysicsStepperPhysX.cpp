@@ -59,6 +59,7 @@ void MultiThreadStepper::substepDone(StepperTask* ownerTask)
     // -> OnSubstepPreFetchResult
 
     {
+        PROFILE_CPU_NAMED("Physics.FetchResults");
 #ifndef PX_PROFILE
 		PxSceneWriteLock writeLock(*mScene);
 #endif
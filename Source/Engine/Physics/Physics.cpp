@@ -6,11 +6,236 @@
 #include "PhysicalMaterial.h"
 #include "PhysicsSettings.h"
 #include "PhysicsStatistics.h"
+#include "CollisionData.h"
+#include "Actors/RigidBody.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Collections/Dictionary.h"
+
+namespace
+{
+    struct RegionData
+    {
+        Int2 Coordinate;
+        PhysicsScene* Scene;
+    };
+
+    bool PipelinedSimulation = false;
+    bool RegionsEnabled = false;
+    float RegionsSize = 100000.0f;
+    float RegionsMigrationDistance = 1000.0f;
+    Dictionary<int64, RegionData> Regions;
+    Dictionary<Actor*, Int2> RegionActors;
+
+    int64 GetRegionKey(const Int2& coordinate)
+    {
+        return ((int64)coordinate.X << 32) | (uint32)coordinate.Y;
+    }
+
+    PhysicsScene* GetRegion(const Int2& coordinate)
+    {
+        const int64 key = GetRegionKey(coordinate);
+        const RegionData* region = Regions.TryGet(key);
+        if (region)
+            return region->Scene;
+        PhysicsScene* scene = Physics::FindOrCreateScene(String::Format(TEXT("Region {0}x{1}"), coordinate.X, coordinate.Y));
+        if (!scene)
+            return Physics::DefaultScene;
+
+        // Match the default scene state
+        scene->SetOrigin(Physics::DefaultScene->GetOrigin());
+        scene->SetGravity(Physics::DefaultScene->GetGravity());
+        scene->SetEnableCCD(Physics::DefaultScene->GetEnableCCD());
+        scene->SetBounceThresholdVelocity(Physics::DefaultScene->GetBounceThresholdVelocity());
+
+        Regions.Add(key, { coordinate, scene });
+        return scene;
+    }
+
+    void UpdateRegions()
+    {
+        if (!RegionsEnabled || RegionActors.IsEmpty())
+            return;
+        PROFILE_CPU_NAMED("Physics.Regions");
+        const Real margin = RegionsMigrationDistance;
+        for (auto& e : RegionActors)
+        {
+            // Migrate only when the actor moves past the region border by the margin (prevents migrating back and forth around the border)
+            Actor* actor = e.Key;
+            const Vector3 position = actor->GetPosition();
+            const Real minX = e.Value.X * (Real)RegionsSize - margin;
+            const Real minZ = e.Value.Y * (Real)RegionsSize - margin;
+            const Real maxX = minX + RegionsSize + margin * 2;
+            const Real maxZ = minZ + RegionsSize + margin * 2;
+            if (position.X >= minX && position.X <= maxX && position.Z >= minZ && position.Z <= maxZ)
+                continue;
+
+            // Skip actors moved to the other physics scene by the user
+            const RegionData* region = Regions.TryGet(GetRegionKey(e.Value));
+            if (!region || actor->GetPhysicsScene() != region->Scene)
+                continue;
+
+            const Int2 coordinate = Physics::GetRegionCoordinate(position);
+            PhysicsScene* scene = GetRegion(coordinate);
+            if (scene == region->Scene)
+                continue;
+            e.Value = coordinate;
+            RigidBody* rigidBody = dynamic_cast<RigidBody*>(actor);
+            const bool wakeUp = rigidBody && rigidBody->GetPhysicsActor() && !rigidBody->IsSleeping();
+            actor->SetPhysicsScene(scene);
+            if (wakeUp)
+            {
+                // Keep simulating the body in the new scene
+                PhysicsBackend::AddSceneActorAction(scene->GetPhysicsScene(), rigidBody->GetPhysicsActor(), PhysicsBackend::ActionType::WakeUp);
+            }
+        }
+    }
+
+    template<typename ScenesArray>
+    void GetQueryScenes(const BoundingBox& bounds, ScenesArray& scenes)
+    {
+        scenes.Add(Physics::DefaultScene);
+
+        // Actors are assigned to the regions by their location so expand the regions by the half of their size
+        const Real extent = RegionsSize * 0.5f + RegionsMigrationDistance;
+        for (auto& e : Regions)
+        {
+            const Real minX = e.Value.Coordinate.X * (Real)RegionsSize - extent;
+            const Real minZ = e.Value.Coordinate.Y * (Real)RegionsSize - extent;
+            const Real maxX = minX + RegionsSize + extent * 2;
+            const Real maxZ = minZ + RegionsSize + extent * 2;
+            if (bounds.Maximum.X >= minX && bounds.Minimum.X <= maxX && bounds.Maximum.Z >= minZ && bounds.Minimum.Z <= maxZ)
+                scenes.Add(e.Value.Scene);
+        }
+    }
+
+    BoundingBox GetQueryBounds(const Vector3& center, float extent)
+    {
+        return BoundingBox(center - extent, center + extent);
+    }
+
+    BoundingBox GetQueryBounds(const Vector3& origin, const Vector3& direction, float maxDistance, float extent)
+    {
+        if (maxDistance >= MAX_float)
+            return BoundingBox(Vector3(MIN_Real), Vector3(MAX_Real));
+        const Vector3 end = origin + direction * maxDistance;
+        return BoundingBox(Vector3::Min(origin, end) - extent, Vector3::Max(origin, end) + extent);
+    }
+
+    float GetQueryExtent(const CollisionData* convexMesh, const Vector3& scale)
+    {
+        if (!convexMesh)
+            return 0.0f;
+        const BoundingBox& box = convexMesh->GetOptions().Box;
+        return (float)(Vector3::Max(Vector3::Abs(box.Minimum), Vector3::Abs(box.Maximum)) * Vector3::Abs(scale)).Length();
+    }
+
+    template<typename Query>
+    bool QueryAny(const BoundingBox& bounds, Query query)
+    {
+        if (Regions.IsEmpty())
+            return query(Physics::DefaultScene);
+        Array<PhysicsScene*, InlinedAllocation<16>> scenes;
+        GetQueryScenes(bounds, scenes);
+        for (PhysicsScene* scene : scenes)
+        {
+            if (query(scene))
+                return true;
+        }
+        return false;
+    }
+
+    template<typename Query>
+    bool QueryClosest(const BoundingBox& bounds, RayCastHit& hitInfo, Query query)
+    {
+        if (Regions.IsEmpty())
+            return query(Physics::DefaultScene, hitInfo);
+        Array<PhysicsScene*, InlinedAllocation<16>> scenes;
+        GetQueryScenes(bounds, scenes);
+        bool result = false;
+        RayCastHit hit;
+        for (PhysicsScene* scene : scenes)
+        {
+            if (query(scene, hit) && (!result || hit.Distance < hitInfo.Distance))
+            {
+                hitInfo = hit;
+                result = true;
+            }
+        }
+        return result;
+    }
+
+    template<typename T, typename Query>
+    bool QueryAll(const BoundingBox& bounds, Array<T>& results, Query query)
+    {
+        if (Regions.IsEmpty())
+            return query(Physics::DefaultScene, results);
+        Array<PhysicsScene*, InlinedAllocation<16>> scenes;
+        GetQueryScenes(bounds, scenes);
+        results.Clear();
+        Array<T> sceneResults;
+        for (PhysicsScene* scene : scenes)
+        {
+            if (query(scene, sceneResults))
+                results.Add(sceneResults);
+        }
+        return results.HasItems();
+    }
+
+    bool IsBatchHit(const RayCastHit& hit)
+    {
+        return hit.Collider != nullptr;
+    }
+
+    bool IsBatchHit(const PhysicsColliderActor* hit)
+    {
+        return hit != nullptr;
+    }
+
+    bool IsBatchHitCloser(const RayCastHit& hit, const RayCastHit& other)
+    {
+        return hit.Collider && (!other.Collider || hit.Distance < other.Distance);
+    }
+
+    bool IsBatchHitCloser(const PhysicsColliderActor* hit, const PhysicsColliderActor* other)
+    {
+        return hit && !other;
+    }
+
+    template<typename Command, typename T, typename Query>
+    int32 QueryBatch(const Span<Command>& commands, Span<T> results, Query query)
+    {
+        if (Regions.IsEmpty())
+            return query(Physics::DefaultScene, commands, results);
+        CHECK_RETURN(results.Length() >= commands.Length(), 0);
+
+        // Run the batch on all scenes and pick the closest hit for each query
+        Array<PhysicsScene*, InlinedAllocation<16>> scenes;
+        GetQueryScenes(BoundingBox(Vector3(MIN_Real), Vector3(MAX_Real)), scenes);
+        query(scenes[0], commands, results);
+        Array<T> sceneResults;
+        sceneResults.Resize(commands.Length(), false);
+        for (int32 i = 1; i < scenes.Count(); i++)
+        {
+            if (query(scenes[i], commands, Span<T>(sceneResults.Get(), sceneResults.Count())) == 0)
+                continue;
+            for (int32 j = 0; j < commands.Length(); j++)
+            {
+                if (IsBatchHitCloser(sceneResults[j], results[j]))
+                    results[j] = sceneResults[j];
+            }
+        }
+        int32 hits = 0;
+        for (int32 j = 0; j < commands.Length(); j++)
+            hits += IsBatchHit(results[j]) ? 1 : 0;
+        return hits;
+    }
+}
 
 PhysicsScene* Physics::DefaultScene = nullptr;
 Array<PhysicsScene*> Physics::Scenes;
@@ -28,6 +253,7 @@ class PhysicsService : public EngineService
 
     bool Init() override;
     void LateUpdate() override;
+    void Draw() override;
     void Dispose() override;
 };
 
@@ -40,6 +266,10 @@ void PhysicsSettings::Apply()
     Physics::SetGravity(DefaultGravity);
     Physics::SetBounceThresholdVelocity(BounceThresholdVelocity);
     Physics::SetEnableCCD(!DisableCCD);
+    Physics::SetPipelinedSimulation(PipelinedSimulation);
+    RegionsEnabled = EnableRegions;
+    RegionsSize = Math::Max(RegionSize, 1.0f);
+    RegionsMigrationDistance = Math::Max(RegionMigrationDistance, 0.0f);
     PhysicsBackend::ApplySettings(*this);
 }
 
@@ -61,6 +291,10 @@ void PhysicsSettings::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(EnableSubstepping);
     DESERIALIZE(SubstepDeltaTime);
     DESERIALIZE(MaxSubsteps);
+    DESERIALIZE(PipelinedSimulation);
+    DESERIALIZE(EnableRegions);
+    DESERIALIZE(RegionSize);
+    DESERIALIZE(RegionMigrationDistance);
     DESERIALIZE(QueriesHitTriggers);
     DESERIALIZE(SupportCookingAtRuntime);
 
@@ -103,6 +337,12 @@ void PhysicsService::LateUpdate()
     Physics::FlushRequests();
 }
 
+void PhysicsService::Draw()
+{
+    for (PhysicsScene* scene : Physics::Scenes)
+        scene->UpdateInterpolation();
+}
+
 void PhysicsService::Dispose()
 {
     // Ensure to finish (wait for simulation end)
@@ -118,6 +358,8 @@ void PhysicsService::Dispose()
     }
     Physics::Scenes.Resize(0);
     Physics::DefaultScene = nullptr;
+    Regions.Clear();
+    RegionActors.Clear();
 
     // Dispose backend
     PhysicsBackend::Shutdown();
@@ -157,6 +399,49 @@ bool Physics::GetAutoSimulation()
     return !DefaultScene || DefaultScene->GetAutoSimulation();
 }
 
+bool Physics::GetPipelinedSimulation()
+{
+    return PipelinedSimulation;
+}
+
+void Physics::SetPipelinedSimulation(bool value)
+{
+    PipelinedSimulation = value;
+}
+
+bool Physics::GetRegionsEnabled()
+{
+    return RegionsEnabled;
+}
+
+Int2 Physics::GetRegionCoordinate(const Vector3& position)
+{
+    return Int2((int32)Math::Floor(position.X / RegionsSize), (int32)Math::Floor(position.Z / RegionsSize));
+}
+
+PhysicsScene* Physics::GetRegionScene(const Vector3& position)
+{
+    if (!RegionsEnabled || !DefaultScene)
+        return DefaultScene;
+    return GetRegion(GetRegionCoordinate(position));
+}
+
+void Physics::AddRegionActor(Actor* actor)
+{
+    if (!RegionsEnabled || !DefaultScene || actor->GetPhysicsScene() != DefaultScene)
+        return;
+    const Int2 coordinate = GetRegionCoordinate(actor->GetPosition());
+    PhysicsScene* scene = GetRegion(coordinate);
+    actor->SetPhysicsScene(scene);
+    if (scene != DefaultScene)
+        RegionActors[actor] = coordinate;
+}
+
+void Physics::RemoveRegionActor(Actor* actor)
+{
+    RegionActors.Remove(actor);
+}
+
 Vector3 Physics::GetGravity()
 {
     return DefaultScene ? DefaultScene->GetGravity() : Vector3::Zero;
@@ -166,6 +451,8 @@ void Physics::SetGravity(const Vector3& value)
 {
     if (DefaultScene)
         DefaultScene->SetGravity(value);
+    for (auto& e : Regions)
+        e.Value.Scene->SetGravity(value);
 }
 
 bool Physics::GetEnableCCD()
@@ -177,6 +464,8 @@ void Physics::SetEnableCCD(const bool value)
 {
     if (DefaultScene)
         DefaultScene->SetEnableCCD(value);
+    for (auto& e : Regions)
+        e.Value.Scene->SetEnableCCD(value);
 }
 
 float Physics::GetBounceThresholdVelocity()
@@ -188,10 +477,16 @@ void Physics::SetBounceThresholdVelocity(const float value)
 {
     if (DefaultScene)
         DefaultScene->SetBounceThresholdVelocity(value);
+    for (auto& e : Regions)
+        e.Value.Scene->SetBounceThresholdVelocity(value);
 }
 
 void Physics::Simulate(float dt)
 {
+    PROFILE_MEM(Physics);
+    UpdateRegions();
+
+    // Start all scenes before collecting any results so they are simulated in parallel
     for (PhysicsScene* scene : Scenes)
     {
         if (scene->GetAutoSimulation())
@@ -201,18 +496,28 @@ void Physics::Simulate(float dt)
 
 void Physics::CollectResults()
 {
-    if (DefaultScene)
-        DefaultScene->CollectResults();
+    PROFILE_MEM(Physics);
+    for (PhysicsScene* scene : Scenes)
+    {
+        if (scene->GetAutoSimulation())
+            scene->CollectResults();
+    }
 }
 
 bool Physics::IsDuringSimulation()
 {
-    return DefaultScene && DefaultScene->IsDuringSimulation();
+    for (PhysicsScene* scene : Scenes)
+    {
+        if (scene->GetAutoSimulation() && scene->IsDuringSimulation())
+            return true;
+    }
+    return false;
 }
 
 void Physics::FlushRequests()
 {
     PROFILE_CPU_NAMED("Physics.FlushRequests");
+    PROFILE_MEM(Physics);
     for (PhysicsScene* scene : Scenes)
         PhysicsBackend::FlushRequests(scene->GetPhysicsScene());
     PhysicsBackend::FlushRequests();
@@ -220,152 +525,284 @@ void Physics::FlushRequests()
 
 bool Physics::LineCast(const Vector3& start, const Vector3& end, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->LineCast(start, end, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(start, end - start, 1.0f, 0.0f), [&](PhysicsScene* scene)
+    {
+        return scene->LineCast(start, end, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::LineCast(const Vector3& start, const Vector3& end, RayCastHit& hitInfo, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->LineCast(start, end, hitInfo, layerMask, hitTriggers);
+    return QueryClosest(GetQueryBounds(start, end - start, 1.0f, 0.0f), hitInfo, [&](PhysicsScene* scene, RayCastHit& hit)
+    {
+        return scene->LineCast(start, end, hit, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::LineCastAll(const Vector3& start, const Vector3& end, Array<RayCastHit>& results, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->LineCastAll(start, end, results, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(start, end - start, 1.0f, 0.0f), results, [&](PhysicsScene* scene, Array<RayCastHit>& sceneResults)
+    {
+        return scene->LineCastAll(start, end, sceneResults, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::RayCast(const Vector3& origin, const Vector3& direction, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->RayCast(origin, direction, maxDistance, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(origin, direction, maxDistance, 0.0f), [&](PhysicsScene* scene)
+    {
+        return scene->RayCast(origin, direction, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::RayCast(const Vector3& origin, const Vector3& direction, RayCastHit& hitInfo, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->RayCast(origin, direction, hitInfo, maxDistance, layerMask, hitTriggers);
+    return QueryClosest(GetQueryBounds(origin, direction, maxDistance, 0.0f), hitInfo, [&](PhysicsScene* scene, RayCastHit& hit)
+    {
+        return scene->RayCast(origin, direction, hit, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::RayCastAll(const Vector3& origin, const Vector3& direction, Array<RayCastHit>& results, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->RayCastAll(origin, direction, results, maxDistance, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(origin, direction, maxDistance, 0.0f), results, [&](PhysicsScene* scene, Array<RayCastHit>& sceneResults)
+    {
+        return scene->RayCastAll(origin, direction, sceneResults, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::BoxCast(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->BoxCast(center, halfExtents, direction, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(center, direction, maxDistance, halfExtents.Length()), [&](PhysicsScene* scene)
+    {
+        return scene->BoxCast(center, halfExtents, direction, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::BoxCast(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, RayCastHit& hitInfo, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->BoxCast(center, halfExtents, direction, hitInfo, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryClosest(GetQueryBounds(center, direction, maxDistance, halfExtents.Length()), hitInfo, [&](PhysicsScene* scene, RayCastHit& hit)
+    {
+        return scene->BoxCast(center, halfExtents, direction, hit, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::BoxCastAll(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, Array<RayCastHit>& results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->BoxCastAll(center, halfExtents, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, direction, maxDistance, halfExtents.Length()), results, [&](PhysicsScene* scene, Array<RayCastHit>& sceneResults)
+    {
+        return scene->BoxCastAll(center, halfExtents, direction, sceneResults, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::SphereCast(const Vector3& center, const float radius, const Vector3& direction, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->SphereCast(center, radius, direction, maxDistance, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(center, direction, maxDistance, radius), [&](PhysicsScene* scene)
+    {
+        return scene->SphereCast(center, radius, direction, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::SphereCast(const Vector3& center, const float radius, const Vector3& direction, RayCastHit& hitInfo, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->SphereCast(center, radius, direction, hitInfo, maxDistance, layerMask, hitTriggers);
+    return QueryClosest(GetQueryBounds(center, direction, maxDistance, radius), hitInfo, [&](PhysicsScene* scene, RayCastHit& hit)
+    {
+        return scene->SphereCast(center, radius, direction, hit, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::SphereCastAll(const Vector3& center, const float radius, const Vector3& direction, Array<RayCastHit>& results, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->SphereCastAll(center, radius, direction, results, maxDistance, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, direction, maxDistance, radius), results, [&](PhysicsScene* scene, Array<RayCastHit>& sceneResults)
+    {
+        return scene->SphereCastAll(center, radius, direction, sceneResults, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::CapsuleCast(const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->CapsuleCast(center, radius, height, direction, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(center, direction, maxDistance, radius + height * 0.5f), [&](PhysicsScene* scene)
+    {
+        return scene->CapsuleCast(center, radius, height, direction, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::CapsuleCast(const Vector3& center, const float radius, const float height, const Vector3& direction, RayCastHit& hitInfo, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->CapsuleCast(center, radius, height, direction, hitInfo, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryClosest(GetQueryBounds(center, direction, maxDistance, radius + height * 0.5f), hitInfo, [&](PhysicsScene* scene, RayCastHit& hit)
+    {
+        return scene->CapsuleCast(center, radius, height, direction, hit, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::CapsuleCastAll(const Vector3& center, const float radius, const float height, const Vector3& direction, Array<RayCastHit>& results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->CapsuleCastAll(center, radius, height, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, direction, maxDistance, radius + height * 0.5f), results, [&](PhysicsScene* scene, Array<RayCastHit>& sceneResults)
+    {
+        return scene->CapsuleCastAll(center, radius, height, direction, sceneResults, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::ConvexCast(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->ConvexCast(center, convexMesh, scale, direction, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(center, direction, maxDistance, GetQueryExtent(convexMesh, scale)), [&](PhysicsScene* scene)
+    {
+        return scene->ConvexCast(center, convexMesh, scale, direction, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::ConvexCast(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, RayCastHit& hitInfo, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->ConvexCast(center, convexMesh, scale, direction, hitInfo, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryClosest(GetQueryBounds(center, direction, maxDistance, GetQueryExtent(convexMesh, scale)), hitInfo, [&](PhysicsScene* scene, RayCastHit& hit)
+    {
+        return scene->ConvexCast(center, convexMesh, scale, direction, hit, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::ConvexCastAll(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, Array<RayCastHit>& results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->ConvexCastAll(center, convexMesh, scale, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, direction, maxDistance, GetQueryExtent(convexMesh, scale)), results, [&](PhysicsScene* scene, Array<RayCastHit>& sceneResults)
+    {
+        return scene->ConvexCastAll(center, convexMesh, scale, direction, sceneResults, rotation, maxDistance, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::CheckBox(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->CheckBox(center, halfExtents, rotation, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(center, halfExtents.Length()), [&](PhysicsScene* scene)
+    {
+        return scene->CheckBox(center, halfExtents, rotation, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::CheckSphere(const Vector3& center, const float radius, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->CheckSphere(center, radius, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(center, radius), [&](PhysicsScene* scene)
+    {
+        return scene->CheckSphere(center, radius, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::CheckCapsule(const Vector3& center, const float radius, const float height, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->CheckCapsule(center, radius, height, rotation, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(center, radius + height * 0.5f), [&](PhysicsScene* scene)
+    {
+        return scene->CheckCapsule(center, radius, height, rotation, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::CheckConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->CheckConvex(center, convexMesh, scale, rotation, layerMask, hitTriggers);
+    return QueryAny(GetQueryBounds(center, GetQueryExtent(convexMesh, scale)), [&](PhysicsScene* scene)
+    {
+        return scene->CheckConvex(center, convexMesh, scale, rotation, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::OverlapBox(const Vector3& center, const Vector3& halfExtents, Array<Collider*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->OverlapBox(center, halfExtents, results, rotation, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, halfExtents.Length()), results, [&](PhysicsScene* scene, Array<Collider*>& sceneResults)
+    {
+        return scene->OverlapBox(center, halfExtents, sceneResults, rotation, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::OverlapSphere(const Vector3& center, const float radius, Array<Collider*>& results, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->OverlapSphere(center, radius, results, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, radius), results, [&](PhysicsScene* scene, Array<Collider*>& sceneResults)
+    {
+        return scene->OverlapSphere(center, radius, sceneResults, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::OverlapCapsule(const Vector3& center, const float radius, const float height, Array<Collider*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->OverlapCapsule(center, radius, height, results, rotation, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, radius + height * 0.5f), results, [&](PhysicsScene* scene, Array<Collider*>& sceneResults)
+    {
+        return scene->OverlapCapsule(center, radius, height, sceneResults, rotation, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Array<Collider*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->OverlapConvex(center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, GetQueryExtent(convexMesh, scale)), results, [&](PhysicsScene* scene, Array<Collider*>& sceneResults)
+    {
+        return scene->OverlapConvex(center, convexMesh, scale, sceneResults, rotation, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::OverlapBox(const Vector3& center, const Vector3& halfExtents, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->OverlapBox(center, halfExtents, results, rotation, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, halfExtents.Length()), results, [&](PhysicsScene* scene, Array<PhysicsColliderActor*>& sceneResults)
+    {
+        return scene->OverlapBox(center, halfExtents, sceneResults, rotation, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::OverlapSphere(const Vector3& center, const float radius, Array<PhysicsColliderActor*>& results, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->OverlapSphere(center, radius, results, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, radius), results, [&](PhysicsScene* scene, Array<PhysicsColliderActor*>& sceneResults)
+    {
+        return scene->OverlapSphere(center, radius, sceneResults, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::OverlapCapsule(const Vector3& center, const float radius, const float height, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->OverlapCapsule(center, radius, height, results, rotation, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, radius + height * 0.5f), results, [&](PhysicsScene* scene, Array<PhysicsColliderActor*>& sceneResults)
+    {
+        return scene->OverlapCapsule(center, radius, height, sceneResults, rotation, layerMask, hitTriggers);
+    });
 }
 
 bool Physics::OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
-    return DefaultScene->OverlapConvex(center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
+    return QueryAll(GetQueryBounds(center, GetQueryExtent(convexMesh, scale)), results, [&](PhysicsScene* scene, Array<PhysicsColliderActor*>& sceneResults)
+    {
+        return scene->OverlapConvex(center, convexMesh, scale, sceneResults, rotation, layerMask, hitTriggers);
+    });
+}
+
+int32 Physics::RayCastBatch(const Span<RayCastCommand>& commands, Array<RayCastHit>& results)
+{
+    results.Resize(commands.Length(), false);
+    return RayCastBatch(commands, Span<RayCastHit>(results.Get(), results.Count()));
+}
+
+int32 Physics::RayCastBatch(const Span<RayCastCommand>& commands, Span<RayCastHit> results)
+{
+    return QueryBatch(commands, results, [](PhysicsScene* scene, const Span<RayCastCommand>& sceneCommands, Span<RayCastHit> sceneResults)
+    {
+        return scene->RayCastBatch(sceneCommands, sceneResults);
+    });
+}
+
+int32 Physics::SphereCastBatch(const Span<SphereCastCommand>& commands, Array<RayCastHit>& results)
+{
+    results.Resize(commands.Length(), false);
+    return SphereCastBatch(commands, Span<RayCastHit>(results.Get(), results.Count()));
+}
+
+int32 Physics::SphereCastBatch(const Span<SphereCastCommand>& commands, Span<RayCastHit> results)
+{
+    return QueryBatch(commands, results, [](PhysicsScene* scene, const Span<SphereCastCommand>& sceneCommands, Span<RayCastHit> sceneResults)
+    {
+        return scene->SphereCastBatch(sceneCommands, sceneResults);
+    });
+}
+
+int32 Physics::OverlapSphereBatch(const Span<OverlapSphereCommand>& commands, Array<PhysicsColliderActor*>& results)
+{
+    results.Resize(commands.Length(), false);
+    return OverlapSphereBatch(commands, Span<PhysicsColliderActor*>(results.Get(), results.Count()));
+}
+
+int32 Physics::OverlapSphereBatch(const Span<OverlapSphereCommand>& commands, Span<PhysicsColliderActor*> results)
+{
+    return QueryBatch(commands, results, [](PhysicsScene* scene, const Span<OverlapSphereCommand>& sceneCommands, Span<PhysicsColliderActor*> sceneResults)
+    {
+        return scene->OverlapSphereBatch(sceneCommands, sceneResults);
+    });
 }
 
 PhysicsScene::PhysicsScene(const SpawnParams& params)
@@ -442,6 +879,20 @@ PhysicsStatistics PhysicsScene::GetStatistics() const
     return result;
 }
 
+static bool SortActorStatistics(const PhysicsActorStatistics& a, const PhysicsActorStatistics& b)
+{
+    return a.Contacts > b.Contacts;
+}
+
+void PhysicsScene::GetActorsStatistics(Array<PhysicsActorStatistics>& result) const
+{
+    result.Clear();
+    if (_isDuringSimulation)
+        return;
+    PhysicsBackend::GetSceneActorsStatistics(_scene, result);
+    Sorting::QuickSort(result.Get(), result.Count(), &SortActorStatistics);
+}
+
 #endif
 
 bool PhysicsScene::Init(const StringView& name, const PhysicsSettings& settings)
@@ -459,6 +910,7 @@ void PhysicsScene::Simulate(float dt)
 {
     ASSERT(IsInMainThread() && !_isDuringSimulation);
     _isDuringSimulation = true;
+    _lastDeltaTime = dt;
     PhysicsBackend::StartSimulateScene(_scene, dt);
 }
 
@@ -474,6 +926,44 @@ void PhysicsScene::CollectResults()
     ASSERT(IsInMainThread());
     PhysicsBackend::EndSimulateScene(_scene);
     _isDuringSimulation = false;
+    _lastCollectTime = Platform::GetTimeSeconds();
+}
+
+void PhysicsScene::UpdateInterpolation()
+{
+    if (_interpolatedBodies.IsEmpty())
+        return;
+    PROFILE_CPU();
+
+    // Blend from the pose at the moment of the results collection into the simulated pose over the duration of the step
+    float alpha = 1.0f;
+    if (_lastDeltaTime > ZeroTolerance)
+        alpha = Math::Saturate((float)((Platform::GetTimeSeconds() - _lastCollectTime) / _lastDeltaTime));
+    for (int32 i = _interpolatedBodies.Count() - 1; i >= 0 && i < _interpolatedBodies.Count(); i--)
+    {
+        RigidBody* body = _interpolatedBodies[i];
+        if (body->UpdateInterpolation(alpha))
+        {
+            body->_isInterpolationQueued = 0;
+            _interpolatedBodies.RemoveAt(i);
+        }
+    }
+}
+
+void PhysicsScene::AddInterpolatedBody(RigidBody* body)
+{
+    if (body->_isInterpolationQueued)
+        return;
+    body->_isInterpolationQueued = 1;
+    _interpolatedBodies.Add(body);
+}
+
+void PhysicsScene::RemoveInterpolatedBody(RigidBody* body)
+{
+    if (!body->_isInterpolationQueued)
+        return;
+    body->_isInterpolationQueued = 0;
+    _interpolatedBodies.Remove(body);
 }
 
 bool PhysicsScene::LineCast(const Vector3& start, const Vector3& end, uint32 layerMask, bool hitTriggers)
@@ -637,3 +1127,42 @@ bool PhysicsScene::OverlapConvex(const Vector3& center, const CollisionData* con
 {
     return PhysicsBackend::OverlapConvex(_scene, center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
 }
+
+int32 PhysicsScene::RayCastBatch(const Span<RayCastCommand>& commands, Array<RayCastHit>& results)
+{
+    results.Resize(commands.Length(), false);
+    return RayCastBatch(commands, Span<RayCastHit>(results.Get(), results.Count()));
+}
+
+int32 PhysicsScene::RayCastBatch(const Span<RayCastCommand>& commands, Span<RayCastHit> results)
+{
+    CHECK_RETURN(results.Length() >= commands.Length(), 0);
+    PROFILE_CPU();
+    return PhysicsBackend::RayCastBatch(_scene, commands, results);
+}
+
+int32 PhysicsScene::SphereCastBatch(const Span<SphereCastCommand>& commands, Array<RayCastHit>& results)
+{
+    results.Resize(commands.Length(), false);
+    return SphereCastBatch(commands, Span<RayCastHit>(results.Get(), results.Count()));
+}
+
+int32 PhysicsScene::SphereCastBatch(const Span<SphereCastCommand>& commands, Span<RayCastHit> results)
+{
+    CHECK_RETURN(results.Length() >= commands.Length(), 0);
+    PROFILE_CPU();
+    return PhysicsBackend::SphereCastBatch(_scene, commands, results);
+}
+
+int32 PhysicsScene::OverlapSphereBatch(const Span<OverlapSphereCommand>& commands, Array<PhysicsColliderActor*>& results)
+{
+    results.Resize(commands.Length(), false);
+    return OverlapSphereBatch(commands, Span<PhysicsColliderActor*>(results.Get(), results.Count()));
+}
+
+int32 PhysicsScene::OverlapSphereBatch(const Span<OverlapSphereCommand>& commands, Span<PhysicsColliderActor*> results)
+{
+    CHECK_RETURN(results.Length() >= commands.Length(), 0);
+    PROFILE_CPU();
+    return PhysicsBackend::OverlapSphereBatch(_scene, commands, results);
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Types/Span.h"
 #include "Types.h"
 
 /// <summary>
@@ -38,6 +39,47 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// </summary>
     API_PROPERTY() static bool GetAutoSimulation();
 
+    /// <summary>
+    /// Gets the pipelined simulation mode. When enabled, the physics step started after the fixed update runs on the worker threads in the background of the update, late update and rendering, and its results are collected right before the next fixed update. Rigidbodies transformations are interpolated for rendering between the simulation results.
+    /// </summary>
+    API_PROPERTY() static bool GetPipelinedSimulation();
+
+    /// <summary>
+    /// Sets the pipelined simulation mode. When enabled, the physics step started after the fixed update runs on the worker threads in the background of the update, late update and rendering, and its results are collected right before the next fixed update. Rigidbodies transformations are interpolated for rendering between the simulation results.
+    /// </summary>
+    API_PROPERTY() static void SetPipelinedSimulation(bool value);
+
+    /// <summary>
+    /// Checks if the physics regions are enabled. When enabled, the world is split into the grid of regions (on XZ plane) and each region is simulated as a separate physics scene (in parallel). Rigidbodies and character controllers migrate between the regions as they move and the scene queries are routed to the regions they overlap.
+    /// </summary>
+    API_PROPERTY() static bool GetRegionsEnabled();
+
+    /// <summary>
+    /// Gets the coordinates of the physics region that contains the given location.
+    /// </summary>
+    /// <param name="position">The world-space location.</param>
+    /// <returns>The region coordinates (on X and Z axis of the world).</returns>
+    API_FUNCTION() static Int2 GetRegionCoordinate(const Vector3& position);
+
+    /// <summary>
+    /// Gets the physics scene of the region that contains the given location (created on demand). Returns the default scene if regions are disabled.
+    /// </summary>
+    /// <param name="position">The world-space location.</param>
+    /// <returns>The region physics scene.</returns>
+    API_FUNCTION() static PhysicsScene* GetRegionScene(const Vector3& position);
+
+    /// <summary>
+    /// Moves the actor from the default scene into the physics region at its location and keeps migrating it between the regions as it moves. Does nothing if regions are disabled or actor uses a custom physics scene.
+    /// </summary>
+    /// <param name="actor">The actor (rigidbody or character controller).</param>
+    static void AddRegionActor(Actor* actor);
+
+    /// <summary>
+    /// Stops migrating the actor between the physics regions.
+    /// </summary>
+    /// <param name="actor">The actor.</param>
+    static void RemoveRegionActor(Actor* actor);
+
     /// <summary>
     /// Gets the current gravity force.
     /// </summary>
@@ -471,4 +513,53 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
     /// <returns>True if convex mesh overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() static bool OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+public:
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene (executed in parallel using job system). Writes a single result per query (with null collider if nothing was hit).
+    /// </summary>
+    /// <param name="commands">The raycast queries.</param>
+    /// <param name="results">The result hits (resized to match the amount of queries).</param>
+    /// <returns>The amount of queries that hit anything.</returns>
+    API_FUNCTION() static int32 RayCastBatch(const Span<RayCastCommand>& commands, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results);
+
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene (executed in parallel using job system). Writes a single result per query (with null collider if nothing was hit).
+    /// </summary>
+    /// <param name="commands">The raycast queries.</param>
+    /// <param name="results">The result hits buffer (has to be at least as big as the amount of queries).</param>
+    /// <returns>The amount of queries that hit anything.</returns>
+    static int32 RayCastBatch(const Span<RayCastCommand>& commands, Span<RayCastHit> results);
+
+    /// <summary>
+    /// Performs a batch of sphere sweeps against objects in the scene (executed in parallel using job system). Writes a single result per query (with null collider if nothing was hit).
+    /// </summary>
+    /// <param name="commands">The sphere cast queries.</param>
+    /// <param name="results">The result hits (resized to match the amount of queries).</param>
+    /// <returns>The amount of queries that hit anything.</returns>
+    API_FUNCTION() static int32 SphereCastBatch(const Span<SphereCastCommand>& commands, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results);
+
+    /// <summary>
+    /// Performs a batch of sphere sweeps against objects in the scene (executed in parallel using job system). Writes a single result per query (with null collider if nothing was hit).
+    /// </summary>
+    /// <param name="commands">The sphere cast queries.</param>
+    /// <param name="results">The result hits buffer (has to be at least as big as the amount of queries).</param>
+    /// <returns>The amount of queries that hit anything.</returns>
+    static int32 SphereCastBatch(const Span<SphereCastCommand>& commands, Span<RayCastHit> results);
+
+    /// <summary>
+    /// Performs a batch of sphere overlap tests against objects in the scene (executed in parallel using job system). Writes a single overlapping collider per query (or null if nothing overlaps).
+    /// </summary>
+    /// <param name="commands">The sphere overlap queries.</param>
+    /// <param name="results">The result colliders (resized to match the amount of queries).</param>
+    /// <returns>The amount of queries that overlap anything.</returns>
+    API_FUNCTION() static int32 OverlapSphereBatch(const Span<OverlapSphereCommand>& commands, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results);
+
+    /// <summary>
+    /// Performs a batch of sphere overlap tests against objects in the scene (executed in parallel using job system). Writes a single overlapping collider per query (or null if nothing overlaps).
+    /// </summary>
+    /// <param name="commands">The sphere overlap queries.</param>
+    /// <param name="results">The result colliders buffer (has to be at least as big as the amount of queries).</param>
+    /// <returns>The amount of queries that overlap anything.</returns>
+    static int32 OverlapSphereBatch(const Span<OverlapSphereCommand>& commands, Span<PhysicsColliderActor*> results);
 };
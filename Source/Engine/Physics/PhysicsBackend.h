@@ -63,6 +63,7 @@ class FLAXENGINE_API PhysicsBackend
     enum class ActionType
     {
         Sleep,
+        WakeUp,
     };
 
     struct HeightFieldSample
@@ -100,6 +101,7 @@ class FLAXENGINE_API PhysicsBackend
     static void AddSceneActorAction(void* scene, void* actor, ActionType action);
 #if COMPILE_WITH_PROFILER
     static void GetSceneStatistics(void* scene, PhysicsStatistics& result);
+    static void GetSceneActorsStatistics(void* scene, Array<PhysicsActorStatistics, HeapAllocation>& result);
 #endif
 
     // Scene Queries
@@ -130,6 +132,9 @@ class FLAXENGINE_API PhysicsBackend
     static bool OverlapSphere(void* scene, const Vector3& center, float radius, Array<PhysicsColliderActor*, HeapAllocation>& results, uint32 layerMask, bool hitTriggers);
     static bool OverlapCapsule(void* scene, const Vector3& center, float radius, float height, Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers);
     static bool OverlapConvex(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers);
+    static int32 RayCastBatch(void* scene, const Span<RayCastCommand>& commands, Span<RayCastHit> results);
+    static int32 SphereCastBatch(void* scene, const Span<SphereCastCommand>& commands, Span<RayCastHit> results);
+    static int32 OverlapSphereBatch(void* scene, const Span<OverlapSphereCommand>& commands, Span<PhysicsColliderActor*> results);
 
     // Actors
     static ActorFlags GetActorFlags(void* actor);
@@ -129,6 +129,10 @@ void PhysicsBackend::GetSceneStatistics(void* scene, PhysicsStatistics& result)
 {
 }
 
+void PhysicsBackend::GetSceneActorsStatistics(void* scene, Array<PhysicsActorStatistics>& result)
+{
+}
+
 #endif
 
 bool PhysicsBackend::RayCast(void* scene, const Vector3& origin, const Vector3& direction, const float maxDistance, uint32 layerMask, bool hitTriggers)
@@ -266,6 +270,27 @@ bool PhysicsBackend::OverlapConvex(void* scene, const Vector3& center, const Col
     return false;
 }
 
+int32 PhysicsBackend::RayCastBatch(void* scene, const Span<RayCastCommand>& commands, Span<RayCastHit> results)
+{
+    for (int32 i = 0; i < commands.Length(); i++)
+        results[i] = RayCastHit();
+    return 0;
+}
+
+int32 PhysicsBackend::SphereCastBatch(void* scene, const Span<SphereCastCommand>& commands, Span<RayCastHit> results)
+{
+    for (int32 i = 0; i < commands.Length(); i++)
+        results[i] = RayCastHit();
+    return 0;
+}
+
+int32 PhysicsBackend::OverlapSphereBatch(void* scene, const Span<OverlapSphereCommand>& commands, Span<PhysicsColliderActor*> results)
+{
+    for (int32 i = 0; i < commands.Length(); i++)
+        results[i] = nullptr;
+    return 0;
+}
+
 PhysicsBackend::ActorFlags PhysicsBackend::GetActorFlags(void* actor)
 {
     return ActorFlags::None;
@@ -5,6 +5,8 @@
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Scripting/ScriptingObject.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Collections/Array.h"
 #include "Types.h"
 
 struct ActionData;
@@ -14,6 +16,7 @@ class PhysicsColliderActor;
 class Joint;
 class Collider;
 class CollisionData;
+class RigidBody;
 #if WITH_VEHICLE
 class WheeledVehicle;
 #endif
@@ -30,6 +33,9 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     bool _isDuringSimulation = false;
     Vector3 _origin = Vector3::Zero;
     void* _scene = nullptr;
+    float _lastDeltaTime = 0.0f;
+    double _lastCollectTime = 0.0;
+    Array<RigidBody*> _interpolatedBodies;
 
 public:
     ~PhysicsScene();
@@ -105,6 +111,12 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// Gets the physics simulation statistics for the scene.
     /// </summary>
     API_PROPERTY() PhysicsStatistics GetStatistics() const;
+
+    /// <summary>
+    /// Samples the statistics of the rigidbodies (contacts from the last simulation step and sleep state) for the scene. Results are sorted by the amount of contacts (the most expensive bodies first). This operation iterates over all bodies so it should not be used every frame.
+    /// </summary>
+    /// <param name="result">The output statistics of the bodies.</param>
+    API_FUNCTION() void GetActorsStatistics(API_PARAM(Out) Array<PhysicsActorStatistics, HeapAllocation>& result) const;
 #endif
 
 public:
@@ -132,6 +144,23 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// </summary>
     API_FUNCTION() void CollectResults();
 
+    /// <summary>
+    /// Updates the transformations of the interpolated rigidbodies (used by the pipelined simulation). Called before rendering.
+    /// </summary>
+    void UpdateInterpolation();
+
+    /// <summary>
+    /// Registers the rigidbody for the transformation interpolation.
+    /// </summary>
+    /// <param name="body">The rigidbody.</param>
+    void AddInterpolatedBody(RigidBody* body);
+
+    /// <summary>
+    /// Unregisters the rigidbody from the transformation interpolation.
+    /// </summary>
+    /// <param name="body">The rigidbody.</param>
+    void RemoveInterpolatedBody(RigidBody* body);
+
 public:
     /// <summary>
     /// Performs a line between two points in the scene.
@@ -509,4 +538,53 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
     /// <returns>True if convex mesh overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() bool OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+public:
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene (executed in parallel using job system). Writes a single result per query (with null collider if nothing was hit).
+    /// </summary>
+    /// <param name="commands">The raycast queries.</param>
+    /// <param name="results">The result hits (resized to match the amount of queries).</param>
+    /// <returns>The amount of queries that hit anything.</returns>
+    API_FUNCTION() int32 RayCastBatch(const Span<RayCastCommand>& commands, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results);
+
+    /// <summary>
+    /// Performs a batch of raycasts against objects in the scene (executed in parallel using job system). Writes a single result per query (with null collider if nothing was hit).
+    /// </summary>
+    /// <param name="commands">The raycast queries.</param>
+    /// <param name="results">The result hits buffer (has to be at least as big as the amount of queries).</param>
+    /// <returns>The amount of queries that hit anything.</returns>
+    int32 RayCastBatch(const Span<RayCastCommand>& commands, Span<RayCastHit> results);
+
+    /// <summary>
+    /// Performs a batch of sphere sweeps against objects in the scene (executed in parallel using job system). Writes a single result per query (with null collider if nothing was hit).
+    /// </summary>
+    /// <param name="commands">The sphere cast queries.</param>
+    /// <param name="results">The result hits (resized to match the amount of queries).</param>
+    /// <returns>The amount of queries that hit anything.</returns>
+    API_FUNCTION() int32 SphereCastBatch(const Span<SphereCastCommand>& commands, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results);
+
+    /// <summary>
+    /// Performs a batch of sphere sweeps against objects in the scene (executed in parallel using job system). Writes a single result per query (with null collider if nothing was hit).
+    /// </summary>
+    /// <param name="commands">The sphere cast queries.</param>
+    /// <param name="results">The result hits buffer (has to be at least as big as the amount of queries).</param>
+    /// <returns>The amount of queries that hit anything.</returns>
+    int32 SphereCastBatch(const Span<SphereCastCommand>& commands, Span<RayCastHit> results);
+
+    /// <summary>
+    /// Performs a batch of sphere overlap tests against objects in the scene (executed in parallel using job system). Writes a single overlapping collider per query (or null if nothing overlaps).
+    /// </summary>
+    /// <param name="commands">The sphere overlap queries.</param>
+    /// <param name="results">The result colliders (resized to match the amount of queries).</param>
+    /// <returns>The amount of queries that overlap anything.</returns>
+    API_FUNCTION() int32 OverlapSphereBatch(const Span<OverlapSphereCommand>& commands, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results);
+
+    /// <summary>
+    /// Performs a batch of sphere overlap tests against objects in the scene (executed in parallel using job system). Writes a single overlapping collider per query (or null if nothing overlaps).
+    /// </summary>
+    /// <param name="commands">The sphere overlap queries.</param>
+    /// <param name="results">The result colliders buffer (has to be at least as big as the amount of queries).</param>
+    /// <returns>The amount of queries that overlap anything.</returns>
+    int32 OverlapSphereBatch(const Span<OverlapSphereCommand>& commands, Span<PhysicsColliderActor*> results);
 };
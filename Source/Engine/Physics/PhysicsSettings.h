@@ -67,6 +67,30 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(1020), EditorDisplay(\"Framerate\")")
     int32 MaxSubsteps = 5;
 
+    /// <summary>
+    /// If enabled, the physics simulation step runs in the background (overlapped with the update and rendering) and its results are collected before the next fixed update. Rigidbodies transformations are interpolated for rendering. Reduces the time main thread waits for the physics but delays the simulation results by one step.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1030), EditorDisplay(\"Framerate\")")
+    bool PipelinedSimulation = false;
+
+    /// <summary>
+    /// If enabled, the world is split into the grid of regions (on XZ plane) simulated as separate physics scenes in parallel. Rigidbodies and character controllers migrate between the regions as they move and static colliders are placed in the region of their location. Objects from different regions don't collide so use it for large worlds with independent areas.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1050), EditorDisplay(\"Regions\")")
+    bool EnableRegions = false;
+
+    /// <summary>
+    /// The size of the single physics region (in world units).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1060), EditorDisplay(\"Regions\"), Limit(1000)")
+    float RegionSize = 100000.0f;
+
+    /// <summary>
+    /// The distance the object has to move past the region border to migrate into the neighbour region. Prevents migrating objects back and forth when they move along the border.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1070), EditorDisplay(\"Regions\"), Limit(0)")
+    float RegionMigrationDistance = 1000.0f;
+
     /// <summary>
     /// Enables support for cooking physical collision shapes geometry at runtime. Use it to enable generating runtime terrain collision or convex mesh colliders.
     /// </summary>
@@ -32,9 +32,49 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API PhysicsStatistics
     API_FIELD() uint32 NewTouches;
     // Number of lost touches during this frame.
     API_FIELD() uint32 LostTouches;
+    // Number of objects added to the broad phase during this frame.
+    API_FIELD() uint32 BroadPhaseAdds;
+    // Number of objects removed from the broad phase during this frame.
+    API_FIELD() uint32 BroadPhaseRemoves;
+    // Number of shape pairs processed by the narrow phase during this frame (excluding CCD pairs).
+    API_FIELD() uint32 NarrowPhasePairs;
+    // Number of narrow phase pairs that generated contacts during this frame.
+    API_FIELD() uint32 ContactPairs;
+    // Number of narrow phase pairs that reused the contacts cached from the previous frame.
+    API_FIELD() uint32 CachedContactPairs;
+    // Number of shape pairs processed by the CCD passes during this frame.
+    API_FIELD() uint32 CCDPairs;
+    // Number of trigger pairs processed during this frame.
+    API_FIELD() uint32 TriggerPairs;
+    // Number of constraints partitions (groups of independent constraints solved together) used by the solver during this frame.
+    API_FIELD() uint32 SolverPartitions;
+    // Number of 1D axis constraints (joints and contacts) processed by the solver during this frame.
+    API_FIELD() uint32 SolverConstraints;
 
     PhysicsStatistics()
     {
         Platform::MemoryClear(this, sizeof(PhysicsStatistics));
     }
 };
+
+/// <summary>
+/// Physics simulation statistics of the single rigidbody for profiler. Can be used to find bodies that cost the most during simulation.
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API PhysicsActorStatistics
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(PhysicsActorStatistics);
+
+    // The rigidbody.
+    API_FIELD() RigidBody* Body;
+    // Number of colliders pairs touching the body colliders during the last simulation step.
+    API_FIELD() uint32 ContactPairs;
+    // Number of contact points generated for the body colliders during the last simulation step.
+    API_FIELD() uint32 Contacts;
+    // True if body is sleeping (not simulated).
+    API_FIELD() bool IsSleeping;
+
+    PhysicsActorStatistics()
+    {
+        Platform::MemoryClear(this, sizeof(PhysicsActorStatistics));
+    }
+};
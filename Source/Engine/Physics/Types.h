@@ -8,6 +8,8 @@
 #include "Engine/Scripting/ScriptingType.h"
 
 struct PhysicsStatistics;
+struct PhysicsActorStatistics;
+class Actor;
 class PhysicsColliderActor;
 class PhysicsScene;
 class Joint;
@@ -168,6 +170,105 @@ API_STRUCT() struct RayCastHit
     API_FIELD() Float2 UV;
 };
 
+/// <summary>
+/// Raycast query descriptor used by the batched scene queries.
+/// </summary>
+API_STRUCT() struct RayCastCommand
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(RayCastCommand);
+
+    /// <summary>
+    /// The origin of the ray.
+    /// </summary>
+    API_FIELD() Vector3 Origin;
+
+    /// <summary>
+    /// The normalized direction of the ray.
+    /// </summary>
+    API_FIELD() Vector3 Direction;
+
+    /// <summary>
+    /// The maximum distance the ray should check for collisions.
+    /// </summary>
+    API_FIELD() float MaxDistance = MAX_float;
+
+    /// <summary>
+    /// The layer mask used to filter the results.
+    /// </summary>
+    API_FIELD() uint32 LayerMask = MAX_uint32;
+
+    /// <summary>
+    /// If set to true triggers will be hit, otherwise will skip them.
+    /// </summary>
+    API_FIELD() bool HitTriggers = true;
+};
+
+/// <summary>
+/// Sphere sweep query descriptor used by the batched scene queries.
+/// </summary>
+API_STRUCT() struct SphereCastCommand
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(SphereCastCommand);
+
+    /// <summary>
+    /// The sphere center.
+    /// </summary>
+    API_FIELD() Vector3 Center;
+
+    /// <summary>
+    /// The radius of the sphere.
+    /// </summary>
+    API_FIELD() float Radius;
+
+    /// <summary>
+    /// The normalized direction in which cast a sphere.
+    /// </summary>
+    API_FIELD() Vector3 Direction;
+
+    /// <summary>
+    /// The maximum distance the sphere should check for collisions.
+    /// </summary>
+    API_FIELD() float MaxDistance = MAX_float;
+
+    /// <summary>
+    /// The layer mask used to filter the results.
+    /// </summary>
+    API_FIELD() uint32 LayerMask = MAX_uint32;
+
+    /// <summary>
+    /// If set to true triggers will be hit, otherwise will skip them.
+    /// </summary>
+    API_FIELD() bool HitTriggers = true;
+};
+
+/// <summary>
+/// Sphere overlap query descriptor used by the batched scene queries.
+/// </summary>
+API_STRUCT() struct OverlapSphereCommand
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(OverlapSphereCommand);
+
+    /// <summary>
+    /// The sphere center.
+    /// </summary>
+    API_FIELD() Vector3 Center;
+
+    /// <summary>
+    /// The radius of the sphere.
+    /// </summary>
+    API_FIELD() float Radius;
+
+    /// <summary>
+    /// The layer mask used to filter the results.
+    /// </summary>
+    API_FIELD() uint32 LayerMask = MAX_uint32;
+
+    /// <summary>
+    /// If set to true triggers will be hit, otherwise will skip them.
+    /// </summary>
+    API_FIELD() bool HitTriggers = true;
+};
+
 /// <summary>
 /// Physics collision shape variant for different shapes such as box, sphere, capsule.
 /// </summary>
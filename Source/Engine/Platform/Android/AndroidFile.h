@@ -67,6 +67,8 @@ class AndroidAssetFile : public AndroidFile
     bool Read(void* buffer, uint32 bytesToRead, uint32* bytesRead = nullptr) override;
     bool Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten = nullptr) override;
     void Close() override;
+    const byte* Map() override;
+    void Unmap() override;
     uint32 GetSize() const override;
     DateTime GetLastWriteTime() const override;
     uint32 GetPosition() const override;
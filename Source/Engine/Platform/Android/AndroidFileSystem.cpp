@@ -586,6 +586,16 @@ void AndroidAssetFile::Close()
     }
 }
 
+const byte* AndroidAssetFile::Map()
+{
+    // Uncompressed assets are memory-mapped by the asset manager (buffer is released on close)
+    return _asset ? (const byte*)AAsset_getBuffer(_asset) : nullptr;
+}
+
+void AndroidAssetFile::Unmap()
+{
+}
+
 uint32 AndroidAssetFile::GetSize() const
 {
     return AAsset_getLength(_asset);
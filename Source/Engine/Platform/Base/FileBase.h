@@ -67,6 +67,23 @@ class FLAXENGINE_API FileBase : public NonCopyable
     /// </summary>
     virtual void Close() = 0;
 
+    /// <summary>
+    /// Maps the whole file contents into the process address space as a read-only view. The view stays valid until Unmap is called or the file gets closed.
+    /// </summary>
+    /// <remarks>The file has to be opened with read access. Mapped memory must not be modified.</remarks>
+    /// <returns>The pointer to the mapped file data or null if file cannot be mapped (eg. not supported by the platform).</returns>
+    virtual const byte* Map()
+    {
+        return nullptr;
+    }
+
+    /// <summary>
+    /// Unmaps the file contents view created with Map.
+    /// </summary>
+    virtual void Unmap()
+    {
+    }
+
 public:
 
     /// <summary>
@@ -2,6 +2,7 @@
 
 #include "Engine/Platform/Platform.h"
 #include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/CPUTopology.h"
 #include "Engine/Platform/MemoryStats.h"
 #include "Engine/Platform/MessageBox.h"
 #include "Engine/Platform/FileSystem.h"
@@ -17,6 +18,7 @@
 #include "Engine/Core/Utilities.h"
 #if COMPILE_WITH_PROFILER
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #endif
 #include "Engine/Threading/Threading.h"
 #include "Engine/Engine/CommandLine.h"
@@ -107,6 +109,69 @@ const Char* ToString(ThreadPriority value)
     }
 }
 
+void CPUTopology::AddL3Group(uint64 mask)
+{
+    if (mask == 0 || L3GroupsCount == ARRAY_COUNT(L3Groups))
+        return;
+    for (int32 i = 0; i < L3GroupsCount; i++)
+    {
+        if (L3Groups[i] == mask)
+            return;
+    }
+    L3Groups[L3GroupsCount++] = mask;
+}
+
+void CPUTopology::Init(uint32 logicalProcessorCount)
+{
+    // Treat all processors as performance cores if platform didn't detect the hybrid architecture
+    const uint64 allMask = logicalProcessorCount >= 64 ? MAX_uint64 : (1ull << logicalProcessorCount) - 1;
+    if (PerformanceCoresMask == 0)
+        PerformanceCoresMask = allMask & ~EfficiencyCoresMask;
+    if (L3GroupsCount == 0)
+        AddL3Group(PerformanceCoresMask | EfficiencyCoresMask);
+
+    // Order processors so the neighbouring workers share the L3 cache and performance cores go first
+    OrderCount = 0;
+    uint64 used = 0;
+    const auto addProcessors = [this, &used](uint64 mask)
+    {
+        for (int32 i = 0; i < 64; i++)
+        {
+            const uint64 bit = 1ull << i;
+            if (mask & bit && !(used & bit))
+            {
+                used |= bit;
+                Order[OrderCount++] = (byte)i;
+            }
+        }
+    };
+    for (int32 i = 0; i < L3GroupsCount; i++)
+        addProcessors(L3Groups[i] & PerformanceCoresMask);
+    addProcessors(PerformanceCoresMask);
+    for (int32 i = 0; i < L3GroupsCount; i++)
+        addProcessors(L3Groups[i] & EfficiencyCoresMask);
+    addProcessors(EfficiencyCoresMask);
+}
+
+uint64 CPUTopology::GetThreadAffinity(ThreadPlacement placement, int32 index) const
+{
+    switch (placement)
+    {
+    case ThreadPlacement::FrameCritical:
+        return OrderCount != 0 ? 1ull << Order[index % OrderCount] : 0;
+    case ThreadPlacement::Simulation:
+    {
+        const uint64 mask = L3GroupsCount != 0 ? L3Groups[index % L3GroupsCount] & PerformanceCoresMask : 0;
+        return mask != 0 ? mask : PerformanceCoresMask;
+    }
+    case ThreadPlacement::Background:
+        // Hybrid CPUs only, otherwise let the OS scheduler balance the background work
+        return EfficiencyCoresMask;
+    default:
+        return 0;
+    }
+}
+
 UserBase::UserBase(const String& name)
     : UserBase(SpawnParams(Guid::New(), TypeInitializer), name)
 {
@@ -149,6 +214,24 @@ bool PlatformBase::Init()
     return false;
 }
 
+const CPUTopology& PlatformBase::GetCPUTopology()
+{
+    static CPUTopology topology = []
+    {
+        CPUTopology result;
+        result.Init(Platform::GetCPUInfo().LogicalProcessorCount);
+        return result;
+    }();
+    return topology;
+}
+
+void PlatformBase::SetThreadPlacement(ThreadPlacement placement, int32 index)
+{
+    const uint64 affinityMask = Platform::GetCPUTopology().GetThreadAffinity(placement, index);
+    if (affinityMask != 0)
+        Platform::SetThreadAffinityMask(affinityMask);
+}
+
 void PlatformBase::LogInfo()
 {
     // LOG(Info, "Computer name: {0}", Platform::GetComputerName());
@@ -159,6 +242,16 @@ void PlatformBase::LogInfo()
     LOG(Info, "CPU Page size: {0}, cache line size: {1} bytes", Utilities::BytesToText(cpuInfo.PageSize), cpuInfo.CacheLineSize);
     LOG(Info, "L1 cache: {0}, L2 cache: {1}, L3 cache: {2}", Utilities::BytesToText(cpuInfo.L1CacheSize), Utilities::BytesToText(cpuInfo.L2CacheSize), Utilities::BytesToText(cpuInfo.L3CacheSize));
     LOG(Info, "Clock speed: {0}", Utilities::HertzToText(cpuInfo.ClockSpeed));
+    if (CommandLine::Options.LargePages.IsTrue())
+    {
+        const uint64 largePageSize = Platform::GetLargePageSize();
+        if (largePageSize != 0)
+            LOG(Info, "Large pages: {0}", Utilities::BytesToText(largePageSize));
+        else
+            LOG(Warning, "Large pages are not available on this system. Using regular memory pages.");
+    }
+    const CPUTopology& cpuTopology = Platform::GetCPUTopology();
+    LOG(Info, "CPU topology: performance cores mask: 0x{0:x}, efficiency cores mask: 0x{1:x}, L3 cache groups: {2}", cpuTopology.PerformanceCoresMask, cpuTopology.EfficiencyCoresMask, cpuTopology.L3GroupsCount);
 
     const MemoryStats memStats = Platform::GetMemoryStats();
     LOG(Info, "Physical Memory: {0} total, {1} used ({2}%)", Utilities::BytesToText(memStats.TotalPhysicalMemory), Utilities::BytesToText(memStats.UsedPhysicalMemory), Utilities::RoundTo2DecimalPlaces((float)memStats.UsedPhysicalMemory * 100.0f / (float)memStats.TotalPhysicalMemory));
@@ -195,6 +288,9 @@ void PlatformBase::OnMemoryAlloc(void* ptr, uint64 size)
     if (!ptr)
         return;
 
+    // Track memory allocation per engine subsystem
+    ProfilerMemory::OnAllocation(ptr, size);
+
 #if TRACY_ENABLE_MEMORY
     // Track memory allocation in Tracy
     //tracy::Profiler::MemAlloc(ptr, (size_t)size, false);
@@ -218,6 +314,9 @@ void PlatformBase::OnMemoryFree(void* ptr)
     if (!ptr)
         return;
 
+    // Track memory allocation per engine subsystem
+    ProfilerMemory::OnFree(ptr);
+
 #if TRACY_ENABLE_MEMORY
     // Track memory allocation in Tracy
     tracy::Profiler::MemFree(ptr, false);
@@ -239,6 +338,20 @@ void PlatformBase::FreePages(void* ptr)
     Platform::Free(ptr);
 }
 
+uint64 PlatformBase::GetLargePageSize()
+{
+    return 0;
+}
+
+void* PlatformBase::AllocateLargePages(uint64 size)
+{
+    return nullptr;
+}
+
+void PlatformBase::FreeLargePages(void* ptr, uint64 size)
+{
+}
+
 PlatformType PlatformBase::GetPlatformType()
 {
     return PLATFORM_TYPE;
@@ -8,6 +8,8 @@
 
 struct Guid;
 struct CPUInfo;
+struct CPUTopology;
+enum class ThreadPlacement;
 struct MemoryStats;
 struct ProcessMemoryStats;
 struct CreateProcessSettings;
@@ -332,6 +334,26 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(PlatformBase);
     /// <param name="ptr">The pointer to the pages to deallocate.</param>
     static void FreePages(void* ptr);
 
+    /// <summary>
+    /// Gets the size of the large memory page (eg. 2MB). Returns 0 if large pages are not supported or not enabled (use -largepages command line switch).
+    /// </summary>
+    /// <returns>The large page size (in bytes).</returns>
+    static uint64 GetLargePageSize();
+
+    /// <summary>
+    /// Allocates memory block backed by the large pages to reduce TLB misses. Use it for the long-lived bulk allocations only.
+    /// </summary>
+    /// <param name="size">The size of the memory block (rounded up to the large page size).</param>
+    /// <returns>The pointer to the allocated memory or null if large pages are not available (caller should fallback to regular allocation).</returns>
+    static void* AllocateLargePages(uint64 size);
+
+    /// <summary>
+    /// Frees memory block allocated with AllocateLargePages.
+    /// </summary>
+    /// <param name="ptr">The pointer to the memory to deallocate.</param>
+    /// <param name="size">The size of the memory block (the same as used for allocation).</param>
+    static void FreeLargePages(void* ptr, uint64 size);
+
 public:
     /// <summary>
     /// Returns the current runtime platform type. It's compile-time constant.
@@ -361,6 +383,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(PlatformBase);
     /// <returns>The cache line size.</returns>
     API_PROPERTY() static int32 GetCacheLineSize() = delete;
 
+    /// <summary>
+    /// Gets the CPU topology (cores type and L3 cache groups) used to place the threads on the logical processors.
+    /// </summary>
+    /// <returns>The CPU topology.</returns>
+    static const CPUTopology& GetCPUTopology();
+
     /// <summary>
     /// Gets the current memory stats.
     /// </summary>
@@ -400,6 +428,13 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(PlatformBase);
     /// <param name="affinityMask">The affinity mask for the thread.</param>
     static void SetThreadAffinityMask(uint64 affinityMask) = delete;
 
+    /// <summary>
+    /// Sets the processor affinity mask for the current thread based on its role (see CPUTopology).
+    /// </summary>
+    /// <param name="placement">The thread placement policy.</param>
+    /// <param name="index">The thread index within its pool.</param>
+    static void SetThreadPlacement(ThreadPlacement placement, int32 index);
+
     /// <summary>
     /// Suspends the execution of the current thread until the time-out interval elapses
     /// </summary>
@@ -0,0 +1,88 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+/// <summary>
+/// The placement policy for the threads pinning to the logical processors based on the thread role.
+/// </summary>
+enum class ThreadPlacement
+{
+    /// <summary>
+    /// The thread can run on any processor (no affinity).
+    /// </summary>
+    Any,
+
+    /// <summary>
+    /// The frame-critical worker pinned to a single processor. Performance cores go first and the neighbouring workers share the L3 cache.
+    /// </summary>
+    FrameCritical,
+
+    /// <summary>
+    /// The frame-critical worker that can run on any performance core within a single L3 cache group (eg. physics simulation).
+    /// </summary>
+    Simulation,
+
+    /// <summary>
+    /// The background worker that prefers the efficiency cores (eg. thread pool or content loading).
+    /// </summary>
+    Background,
+};
+
+/// <summary>
+/// Contains information about CPU topology (cores type and L3 cache sharing) used to place the threads. Covers the first 64 logical processors.
+/// </summary>
+struct FLAXENGINE_API CPUTopology
+{
+    /// <summary>
+    /// The mask of logical processors on the performance cores (all processors on CPUs without hybrid architecture).
+    /// </summary>
+    uint64 PerformanceCoresMask = 0;
+
+    /// <summary>
+    /// The mask of logical processors on the efficiency cores (zero on CPUs without hybrid architecture).
+    /// </summary>
+    uint64 EfficiencyCoresMask = 0;
+
+    /// <summary>
+    /// The amount of groups of logical processors that share the same L3 cache (eg. CCX on AMD CPUs).
+    /// </summary>
+    int32 L3GroupsCount = 0;
+
+    /// <summary>
+    /// The masks of logical processors for each L3 cache group.
+    /// </summary>
+    uint64 L3Groups[16];
+
+    /// <summary>
+    /// The logical processors ordered for the frame-critical workers placement (performance cores grouped by L3 cache, then efficiency cores).
+    /// </summary>
+    byte Order[64];
+
+    /// <summary>
+    /// The amount of the logical processors in the order.
+    /// </summary>
+    int32 OrderCount = 0;
+
+public:
+    /// <summary>
+    /// Adds the L3 cache group of logical processors (skips duplicates).
+    /// </summary>
+    /// <param name="mask">The logical processors mask.</param>
+    void AddL3Group(uint64 mask);
+
+    /// <summary>
+    /// Finalizes the topology after detection (fills the missing info and builds the processors order).
+    /// </summary>
+    /// <param name="logicalProcessorCount">The amount of logical processors.</param>
+    void Init(uint32 logicalProcessorCount);
+
+    /// <summary>
+    /// Gets the thread affinity mask for the given thread placement policy.
+    /// </summary>
+    /// <param name="placement">The thread placement policy.</param>
+    /// <param name="index">The thread index within its pool.</param>
+    /// <returns>The affinity mask or zero if thread should not be pinned.</returns>
+    uint64 GetThreadAffinity(ThreadPlacement placement, int32 index) const;
+};
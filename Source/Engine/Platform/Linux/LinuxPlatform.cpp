@@ -16,6 +16,7 @@
 #include "Engine/Core/Math/Rectangle.h"
 #include "Engine/Core/Math/Color32.h"
 #include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/CPUTopology.h"
 #include "Engine/Platform/MemoryStats.h"
 #include "Engine/Platform/StringUtils.h"
 #include "Engine/Platform/MessageBox.h"
@@ -38,6 +39,7 @@
 #include <sys/types.h>
 #include <sys/ioctl.h>
 #include <sys/wait.h>
+#include <sys/mman.h>
 #include <pthread.h>
 #include <unistd.h>
 #include <sched.h>
@@ -52,6 +54,8 @@
 #include <dlfcn.h>
 
 CPUInfo UnixCpu;
+CPUTopology UnixCpuTopology;
+uint64 UnixLargePageSize = 0;
 int ClockSource;
 Guid DeviceId;
 String UserLocale, ComputerName, HomeDir;
@@ -1003,6 +1007,48 @@ const char* ButtonCodeToKeyName(KeyboardKeys code)
 	return nullptr;
 }
 
+// Reads the logical processors mask from the sysfs file (either list such as "0-3,8" or hexadecimal map such as "00000000,0000ffff")
+uint64 UnixReadCpuMask(const char* path, bool isList)
+{
+    char buffer[256];
+    FILE* file = fopen(path, "r");
+    if (!file)
+        return 0;
+    const int32 count = (int32)fread(buffer, 1, sizeof(buffer) - 1, file);
+    fclose(file);
+    buffer[Math::Max(count, 0)] = 0;
+    uint64 mask = 0;
+    if (isList)
+    {
+        const char* str = buffer;
+        while (*str >= '0' && *str <= '9')
+        {
+            char* end;
+            const int32 first = (int32)strtol(str, &end, 10);
+            int32 last = first;
+            if (*end == '-')
+                last = (int32)strtol(end + 1, &end, 10);
+            for (int32 i = first; i <= last && i < 64; i++)
+                mask |= 1ull << i;
+            str = *end == ',' ? end + 1 : end;
+        }
+    }
+    else
+    {
+        for (const char* str = buffer; *str; str++)
+        {
+            const char c = *str;
+            if (c >= '0' && c <= '9')
+                mask = (mask << 4) | (uint64)(c - '0');
+            else if (c >= 'a' && c <= 'f')
+                mask = (mask << 4) | (uint64)(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F')
+                mask = (mask << 4) | (uint64)(c - 'A' + 10);
+        }
+    }
+    return mask;
+}
+
 void UnixGetMacAddress(byte result[6])
 {
     struct ifreq ifr;
@@ -1756,6 +1802,36 @@ bool LinuxPlatform::Is64BitPlatform()
 #endif
 }
 
+uint64 LinuxPlatform::GetLargePageSize()
+{
+    return UnixLargePageSize;
+}
+
+void* LinuxPlatform::AllocateLargePages(uint64 size)
+{
+    if (UnixLargePageSize == 0 || size == 0)
+        return nullptr;
+    const uint64 numBytes = Math::AlignUp(size, UnixLargePageSize);
+
+    // Use the reserved huge pages pool
+    void* ptr = mmap(nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (ptr != MAP_FAILED)
+        return ptr;
+
+    // Fallback to Transparent Huge Pages
+    ptr = mmap(nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+    madvise(ptr, numBytes, MADV_HUGEPAGE);
+    return ptr;
+}
+
+void LinuxPlatform::FreeLargePages(void* ptr, uint64 size)
+{
+    if (ptr)
+        munmap(ptr, Math::AlignUp(size, UnixLargePageSize));
+}
+
 CPUInfo LinuxPlatform::GetCPUInfo()
 {
     return UnixCpu;
@@ -1766,6 +1842,11 @@ int32 LinuxPlatform::GetCacheLineSize()
     return UnixCpu.CacheLineSize;
 }
 
+const CPUTopology& LinuxPlatform::GetCPUTopology()
+{
+    return UnixCpuTopology;
+}
+
 MemoryStats LinuxPlatform::GetMemoryStats()
 {
     // Get memory usage
@@ -1804,7 +1885,14 @@ void LinuxPlatform::SetThreadPriority(ThreadPriority priority)
 
 void LinuxPlatform::SetThreadAffinityMask(uint64 affinityMask)
 {
-    // TODO: impl this
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int32 cpuIdx = 0; cpuIdx < 64; cpuIdx++)
+    {
+        if (affinityMask & (1ull << cpuIdx))
+            CPU_SET(cpuIdx, &cpus);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
 }
 
 void LinuxPlatform::Sleep(int32 milliseconds)
@@ -2017,6 +2105,72 @@ bool LinuxPlatform::Init()
     UnixCpu.CacheLineSize = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
     ASSERT(UnixCpu.CacheLineSize && Math::IsPowerOfTwo(UnixCpu.CacheLineSize));
 
+    // Detect CPU topology (cores type on hybrid CPUs and groups of processors sharing L3 cache)
+    {
+        // Intel hybrid CPUs expose the efficiency cores as a separate PMU device, other CPUs (eg. ARM big.LITTLE) report the relative cores capacity
+        UnixCpuTopology.EfficiencyCoresMask = UnixReadCpuMask("/sys/devices/cpu_atom/cpus", true);
+        uint32 capacities[64] = {};
+        uint32 maxCapacity = 0;
+        for (int32 cpuIdx = 0; cpuIdx < 64; cpuIdx++)
+        {
+            if (!CPU_ISSET(cpuIdx, &cpus))
+                continue;
+            sprintf(fileNameBuffer, "/sys/devices/system/cpu/cpu%d/cpu_capacity", cpuIdx);
+            if (FILE* file = fopen(fileNameBuffer, "r"))
+            {
+                if (fscanf(file, "%u", &capacities[cpuIdx]) != 1)
+                    capacities[cpuIdx] = 0;
+                maxCapacity = Math::Max(maxCapacity, capacities[cpuIdx]);
+                fclose(file);
+            }
+            for (int32 cacheIndex = 0; cacheIndex < 8; cacheIndex++)
+            {
+                int32 cacheLevel = 0;
+                sprintf(fileNameBuffer, "/sys/devices/system/cpu/cpu%d/cache/index%d/level", cpuIdx, cacheIndex);
+                FILE* file = fopen(fileNameBuffer, "r");
+                if (!file)
+                    break;
+                if (fscanf(file, "%d", &cacheLevel) != 1)
+                    cacheLevel = 0;
+                fclose(file);
+                if (cacheLevel == 3)
+                {
+                    sprintf(fileNameBuffer, "/sys/devices/system/cpu/cpu%d/cache/index%d/shared_cpu_map", cpuIdx, cacheIndex);
+                    UnixCpuTopology.AddL3Group(UnixReadCpuMask(fileNameBuffer, false));
+                    break;
+                }
+            }
+        }
+        if (UnixCpuTopology.EfficiencyCoresMask == 0)
+        {
+            for (int32 cpuIdx = 0; cpuIdx < 64; cpuIdx++)
+            {
+                if (capacities[cpuIdx] != 0 && capacities[cpuIdx] < maxCapacity)
+                    UnixCpuTopology.EfficiencyCoresMask |= 1ull << cpuIdx;
+            }
+        }
+        UnixCpuTopology.Init(UnixCpu.LogicalProcessorCount);
+    }
+
+    // Get huge pages size if requested
+    if (CommandLine::Options.LargePages.IsTrue())
+    {
+        if (FILE* file = fopen("/proc/meminfo", "r"))
+        {
+            char line[256];
+            uint64 sizeKB;
+            while (fgets(line, sizeof(line), file))
+            {
+                if (sscanf(line, "Hugepagesize: %" SCNu64 " kB", &sizeKB) == 1)
+                {
+                    UnixLargePageSize = sizeKB * 1024;
+                    break;
+                }
+            }
+            fclose(file);
+        }
+    }
+
     // Get user name string
     char buffer[UNIX_APP_BUFF_SIZE];
     getlogin_r(buffer, UNIX_APP_BUFF_SIZE);
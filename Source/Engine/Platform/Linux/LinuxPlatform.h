@@ -94,8 +94,12 @@ class FLAXENGINE_API LinuxPlatform : public UnixPlatform
         __builtin_prefetch(static_cast<char const*>(ptr));
     }
     static bool Is64BitPlatform();
+    static uint64 GetLargePageSize();
+    static void* AllocateLargePages(uint64 size);
+    static void FreeLargePages(void* ptr, uint64 size);
     static CPUInfo GetCPUInfo();
     static int32 GetCacheLineSize();
+    static const CPUTopology& GetCPUTopology();
     static MemoryStats GetMemoryStats();
     static ProcessMemoryStats GetProcessMemoryStats();
     static uint64 GetCurrentThreadID()
@@ -15,6 +15,7 @@
 #endif
 #include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <cerrno>
@@ -116,6 +117,7 @@ bool UnixFile::Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritt
 
 void UnixFile::Close()
 {
+    Unmap();
     if (_handle != -1)
     {
         close(_handle);
@@ -123,6 +125,36 @@ void UnixFile::Close()
     }
 }
 
+const byte* UnixFile::Map()
+{
+    if (_mapping)
+        return (const byte*)_mapping;
+    if (_handle == -1)
+        return nullptr;
+    const uint32 size = GetSize();
+    if (size == 0)
+        return nullptr;
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, _handle, 0);
+    if (mapping == MAP_FAILED)
+    {
+        LOG_UNIX_LAST_ERROR;
+        return nullptr;
+    }
+    _mapping = mapping;
+    _mappingSize = size;
+    return (const byte*)mapping;
+}
+
+void UnixFile::Unmap()
+{
+    if (_mapping)
+    {
+        munmap(_mapping, _mappingSize);
+        _mapping = nullptr;
+        _mappingSize = 0;
+    }
+}
+
 uint32 UnixFile::GetSize() const
 {
     struct stat fileInfo;
@@ -14,6 +14,8 @@ class FLAXENGINE_API UnixFile : public FileBase
 protected:
 
     int32 _handle;
+    void* _mapping = nullptr;
+    uint32 _mappingSize = 0;
 
 public:
 
@@ -46,6 +48,8 @@ class FLAXENGINE_API UnixFile : public FileBase
     bool Read(void* buffer, uint32 bytesToRead, uint32* bytesRead = nullptr) override;
     bool Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten = nullptr) override;
     void Close() override;
+    const byte* Map() override;
+    void Unmap() override;
     uint32 GetSize() const override;
     DateTime GetLastWriteTime() const override;
     uint32 GetPosition() const override;
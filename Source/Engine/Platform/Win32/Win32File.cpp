@@ -68,6 +68,7 @@ bool Win32File::Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWrit
 
 void Win32File::Close()
 {
+    Unmap();
     if (_handle)
     {
         CloseHandle(_handle);
@@ -75,6 +76,50 @@ void Win32File::Close()
     }
 }
 
+const byte* Win32File::Map()
+{
+#if PLATFORM_WINDOWS
+    if (_mappingView)
+        return (const byte*)_mappingView;
+    if (!_handle || GetSize() == 0)
+        return nullptr;
+    const HANDLE mapping = CreateFileMappingW(_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        LOG_WIN32_LAST_ERROR;
+        return nullptr;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        LOG_WIN32_LAST_ERROR;
+        CloseHandle(mapping);
+        return nullptr;
+    }
+    _mapping = mapping;
+    _mappingView = view;
+    return (const byte*)view;
+#else
+    return nullptr;
+#endif
+}
+
+void Win32File::Unmap()
+{
+#if PLATFORM_WINDOWS
+    if (_mappingView)
+    {
+        UnmapViewOfFile(_mappingView);
+        _mappingView = nullptr;
+    }
+    if (_mapping)
+    {
+        CloseHandle(_mapping);
+        _mapping = nullptr;
+    }
+#endif
+}
+
 uint32 Win32File::GetSize() const
 {
     LARGE_INTEGER result;
@@ -14,6 +14,8 @@ class FLAXENGINE_API Win32File : public FileBase
 private:
 
     void* _handle;
+    void* _mapping = nullptr;
+    void* _mappingView = nullptr;
 
 public:
 
@@ -49,6 +51,8 @@ class FLAXENGINE_API Win32File : public FileBase
     bool Read(void* buffer, uint32 bytesToRead, uint32* bytesRead = nullptr) override;
     bool Write(const void* buffer, uint32 bytesToWrite, uint32* bytesWritten = nullptr) override;
     void Close() final override;
+    const byte* Map() override;
+    void Unmap() override;
     uint32 GetSize() const override;
     DateTime GetLastWriteTime() const override;
     uint32 GetPosition() const override;
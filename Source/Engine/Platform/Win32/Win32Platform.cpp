@@ -5,11 +5,13 @@
 #include "Engine/Platform/Platform.h"
 #include "Engine/Platform/MemoryStats.h"
 #include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/CPUTopology.h"
 #include "Engine/Core/Types/Guid.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Collections/HashFunctions.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Engine/CommandLine.h"
 #include "IncludeWindowsHeaders.h"
 #include <Psapi.h>
 #include <WinSock2.h>
@@ -26,8 +28,10 @@ namespace
 {
     Guid DeviceId;
     CPUInfo CpuInfo;
+    CPUTopology CpuTopology;
     uint64 ClockFrequency;
     double CyclesToSeconds;
+    uint64 LargePageSize = 0;
     WSAData WsaData;
 }
 
@@ -163,6 +167,61 @@ bool Win32Platform::Init()
         ASSERT(CpuInfo.CacheLineSize && Math::IsPowerOfTwo(CpuInfo.CacheLineSize));
     }
 
+    // Detect CPU topology (cores efficiency class on hybrid CPUs and groups of processors sharing L3 cache)
+    returnLength = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &returnLength);
+    if (GetLastError() == ERROR_INSUFFICIENT_BUFFER && returnLength != 0)
+    {
+        byte* topologyBuffer = (byte*)malloc(returnLength);
+        if (topologyBuffer && GetLogicalProcessorInformationEx(RelationAll, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)topologyBuffer, &returnLength))
+        {
+            BYTE maxEfficiencyClass = 0;
+            for (DWORD offset = 0; offset < returnLength;)
+            {
+                const auto info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(topologyBuffer + offset);
+                if (info->Relationship == RelationProcessorCore)
+                    maxEfficiencyClass = Math::Max(maxEfficiencyClass, info->Processor.EfficiencyClass);
+                offset += info->Size;
+            }
+            for (DWORD offset = 0; offset < returnLength;)
+            {
+                const auto info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(topologyBuffer + offset);
+                if (info->Relationship == RelationProcessorCore && info->Processor.GroupMask[0].Group == 0)
+                {
+                    // Higher efficiency class means more performant core
+                    if (info->Processor.EfficiencyClass == maxEfficiencyClass)
+                        CpuTopology.PerformanceCoresMask |= (uint64)info->Processor.GroupMask[0].Mask;
+                    else
+                        CpuTopology.EfficiencyCoresMask |= (uint64)info->Processor.GroupMask[0].Mask;
+                }
+                else if (info->Relationship == RelationCache && info->Cache.Level == 3 && info->Cache.GroupMask.Group == 0)
+                {
+                    CpuTopology.AddL3Group((uint64)info->Cache.GroupMask.Mask);
+                }
+                offset += info->Size;
+            }
+        }
+        free(topologyBuffer);
+    }
+    CpuTopology.Init(logicalProcessorCount);
+
+#if !PLATFORM_UWP
+    // Enable large pages if requested (requires 'Lock pages in memory' privilege for the user)
+    if (CommandLine::Options.LargePages.IsTrue())
+    {
+        HANDLE token;
+        if (OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+        {
+            TOKEN_PRIVILEGES privileges;
+            privileges.PrivilegeCount = 1;
+            privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+            if (LookupPrivilegeValueW(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) && AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) && GetLastError() == ERROR_SUCCESS)
+                LargePageSize = GetLargePageMinimum();
+            CloseHandle(token);
+        }
+    }
+#endif
+
     // Setup unique device ID
     {
         DeviceId = Guid::Empty;
@@ -278,6 +337,28 @@ void Win32Platform::FreePages(void* ptr)
     VirtualFree(ptr, 0, MEM_RELEASE);
 }
 
+uint64 Win32Platform::GetLargePageSize()
+{
+    return LargePageSize;
+}
+
+void* Win32Platform::AllocateLargePages(uint64 size)
+{
+#if !PLATFORM_UWP
+    if (LargePageSize != 0 && size != 0)
+    {
+        const uint64 numBytes = Math::AlignUp(size, LargePageSize);
+        return VirtualAlloc(nullptr, (SIZE_T)numBytes, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+    }
+#endif
+    return nullptr;
+}
+
+void Win32Platform::FreeLargePages(void* ptr, uint64 size)
+{
+    VirtualFree(ptr, 0, MEM_RELEASE);
+}
+
 bool Win32Platform::Is64BitPlatform()
 {
 #ifdef PLATFORM_64BITS
@@ -299,6 +380,11 @@ int32 Win32Platform::GetCacheLineSize()
     return CpuInfo.CacheLineSize;
 }
 
+const CPUTopology& Win32Platform::GetCPUTopology()
+{
+    return CpuTopology;
+}
+
 MemoryStats Win32Platform::GetMemoryStats()
 {
     // Get memory stats
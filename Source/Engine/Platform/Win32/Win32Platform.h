@@ -88,9 +88,13 @@ class FLAXENGINE_API Win32Platform : public PlatformBase
     static void Free(void* ptr);
     static void* AllocatePages(uint64 numPages, uint64 pageSize);
     static void FreePages(void* ptr);
+    static uint64 GetLargePageSize();
+    static void* AllocateLargePages(uint64 size);
+    static void FreeLargePages(void* ptr, uint64 size);
     static bool Is64BitPlatform();
     static CPUInfo GetCPUInfo();
     static int32 GetCacheLineSize();
+    static const CPUTopology& GetCPUTopology();
     static MemoryStats GetMemoryStats();
     static ProcessMemoryStats GetProcessMemoryStats();
     static uint64 GetCurrentProcessId();
@@ -0,0 +1,443 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilingTools.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Serialization/Json.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Streaming/Streaming.h"
+
+// The amount of frames skipped after the scene load before measuring (shaders compilation, initial streaming, etc.).
+#define PERFORMANCE_CAPTURE_WARMUP_FRAMES 60
+
+// The minimum frame time (in milliseconds) considered as a hitch.
+#define PERFORMANCE_CAPTURE_HITCH_MIN_MS (1000.0f / 30.0f)
+
+namespace
+{
+    struct CameraPathPoint
+    {
+        float Time;
+        Vector3 Position;
+        Quaternion Orientation;
+    };
+
+    struct PassStats
+    {
+        double Total = 0.0;
+        float Max = 0.0f;
+        int32 Count = 0;
+    };
+
+    struct PerformanceCaptureData
+    {
+        enum class States
+        {
+            LoadScene,
+            Warmup,
+            Measure,
+        };
+
+        States State = States::LoadScene;
+        int32 Frame = 0;
+        int32 FramesCount = 600;
+        float CameraTime = 0.0f;
+        double LastFrameTime = 0.0;
+        uint64 LastFrameGPU = 0;
+        String SceneName;
+        String ReportPath;
+        Array<CameraPathPoint> CameraPath;
+        Camera* CameraActor = nullptr;
+
+        Array<float> FrameTimes;
+        Array<float> UpdateTimes;
+        Array<float> DrawTimesCPU;
+        Array<float> DrawTimesGPU;
+        Dictionary<String, PassStats> Passes;
+        uint64 ProcessMemoryPeak = 0;
+        uint64 GPUMemoryPeak = 0;
+        StreamingStats StreamingPeak;
+        int32 StreamingDoneFrame = -1;
+    };
+
+    PerformanceCaptureData* Data = nullptr;
+
+    bool LoadCameraPath(const StringView& path, Array<CameraPathPoint>& result)
+    {
+        Array<byte> fileData;
+        if (File::ReadAllBytes(path, fileData))
+            return true;
+        rapidjson_flax::Document document;
+        document.Parse((const char*)fileData.Get(), fileData.Count());
+        if (document.HasParseError() || !document.IsObject())
+            return true;
+        const auto pointsMember = document.FindMember("Points");
+        if (pointsMember == document.MemberEnd() || !pointsMember->value.IsArray())
+            return true;
+        for (const auto& value : pointsMember->value.GetArray())
+        {
+            auto& point = result.AddOne();
+            point.Time = JsonTools::GetFloat(value, "Time", 0.0f);
+            point.Position = JsonTools::GetVector3(value, "Position", Vector3::Zero);
+            point.Orientation = JsonTools::GetQuaternion(value, "Orientation", Quaternion::Identity);
+        }
+        return result.IsEmpty();
+    }
+
+    void UpdateCamera(float time)
+    {
+        const auto& path = Data->CameraPath;
+        int32 index = 0;
+        while (index + 1 < path.Count() && path[index + 1].Time <= time)
+            index++;
+        const CameraPathPoint& a = path[index];
+        const CameraPathPoint& b = path[Math::Min(index + 1, path.Count() - 1)];
+        const float alpha = b.Time > a.Time ? Math::Saturate((time - a.Time) / (b.Time - a.Time)) : 0.0f;
+        Vector3 position;
+        Vector3::Lerp(a.Position, b.Position, alpha, position);
+        Quaternion orientation;
+        Quaternion::Slerp(a.Orientation, b.Orientation, alpha, orientation);
+        Data->CameraActor->SetPosition(position);
+        Data->CameraActor->SetOrientation(orientation);
+    }
+
+    bool LoadScene()
+    {
+        const String& scene = CommandLine::Options.PerfScene.GetValue();
+        Guid id;
+        if (Guid::Parse(scene, id))
+        {
+            AssetInfo info;
+            if (!Content::GetAssetInfo(scene, info))
+            {
+                LOG(Error, "Missing scene {0}", scene);
+                return true;
+            }
+            id = info.ID;
+        }
+        if (Level::LoadScene(id))
+            return true;
+        Scene* loaded = Level::FindScene(id);
+        if (!loaded)
+            return true;
+        Data->SceneName = loaded->GetName();
+
+        // Prepare camera to play the camera path
+        if (Data->CameraPath.HasItems())
+        {
+            Data->CameraActor = Camera::GetMainCamera();
+            if (!Data->CameraActor)
+            {
+                Data->CameraActor = New<Camera>();
+                Data->CameraActor->SetParent(loaded, false);
+            }
+            UpdateCamera(0.0f);
+        }
+        return false;
+    }
+
+    uint64 GetLastFrameGPU()
+    {
+        uint64 result = 0;
+        for (const auto& frame : ProfilerGPU::Buffers)
+        {
+            if (frame.HasData() && frame.FrameIndex > result)
+                result = frame.FrameIndex;
+        }
+        return result;
+    }
+
+    void MeasureFrame(float frameTimeMs)
+    {
+        auto& data = *Data;
+        const auto& stats = ProfilingTools::Stats;
+        data.FrameTimes.Add(frameTimeMs);
+        data.UpdateTimes.Add(stats.UpdateTimeMs);
+        data.DrawTimesCPU.Add(stats.DrawCPUTimeMs);
+
+        // GPU timings are resolved with a latency so gather only the new frames
+        const uint64 frameGPU = GetLastFrameGPU();
+        if (frameGPU != data.LastFrameGPU)
+        {
+            data.LastFrameGPU = frameGPU;
+            data.DrawTimesGPU.Add(stats.DrawGPUTimeMs);
+            for (const auto& e : ProfilingTools::EventsGPU)
+            {
+                if (e.Depth > 1)
+                    continue;
+                PassStats& pass = data.Passes[String(e.Name)];
+                pass.Total += e.Time;
+                pass.Max = Math::Max(pass.Max, e.Time);
+                pass.Count++;
+            }
+        }
+
+        // Memory
+        data.ProcessMemoryPeak = Math::Max(data.ProcessMemoryPeak, stats.ProcessMemory.UsedPhysicalMemory);
+        data.GPUMemoryPeak = Math::Max(data.GPUMemoryPeak, stats.MemoryGPU.Used);
+
+        // Streaming
+        const StreamingStats streaming = Streaming::GetStats();
+        auto& peak = data.StreamingPeak;
+        peak.ResourcesCount = Math::Max(peak.ResourcesCount, streaming.ResourcesCount);
+        peak.StreamingResourcesCount = Math::Max(peak.StreamingResourcesCount, streaming.StreamingResourcesCount);
+        peak.TexturesMemoryUsage = Math::Max(peak.TexturesMemoryUsage, streaming.TexturesMemoryUsage);
+        peak.ModelsMemoryUsage = Math::Max(peak.ModelsMemoryUsage, streaming.ModelsMemoryUsage);
+        peak.AudioMemoryUsage = Math::Max(peak.AudioMemoryUsage, streaming.AudioMemoryUsage);
+        peak.BudgetLimitedResourcesCount = Math::Max(peak.BudgetLimitedResourcesCount, streaming.BudgetLimitedResourcesCount);
+        if (streaming.StreamingResourcesCount == 0 && data.StreamingDoneFrame == -1)
+            data.StreamingDoneFrame = data.Frame;
+        else if (streaming.StreamingResourcesCount != 0)
+            data.StreamingDoneFrame = -1;
+    }
+
+    float GetPercentile(const Array<float>& sorted, float percentile)
+    {
+        if (sorted.IsEmpty())
+            return 0.0f;
+        const int32 index = Math::Clamp((int32)(percentile * (float)(sorted.Count() - 1) + 0.5f), 0, sorted.Count() - 1);
+        return sorted[index];
+    }
+
+    void WriteTimings(JsonWriter& writer, const char* name, const Array<float>& times)
+    {
+        Array<float> sorted(times);
+        Sorting::QuickSort(sorted.Get(), sorted.Count());
+        double total = 0.0;
+        for (const float e : sorted)
+            total += e;
+        writer.Key(name, StringUtils::Length(name));
+        writer.StartObject();
+        writer.JKEY("Min");
+        writer.Float(sorted.HasItems() ? sorted.First() : 0.0f);
+        writer.JKEY("Avg");
+        writer.Float(sorted.HasItems() ? (float)(total / sorted.Count()) : 0.0f);
+        writer.JKEY("P50");
+        writer.Float(GetPercentile(sorted, 0.5f));
+        writer.JKEY("P90");
+        writer.Float(GetPercentile(sorted, 0.9f));
+        writer.JKEY("P95");
+        writer.Float(GetPercentile(sorted, 0.95f));
+        writer.JKEY("P99");
+        writer.Float(GetPercentile(sorted, 0.99f));
+        writer.JKEY("Max");
+        writer.Float(sorted.HasItems() ? sorted.Last() : 0.0f);
+        writer.EndObject();
+    }
+
+    bool WriteReport()
+    {
+        const auto& data = *Data;
+        rapidjson_flax::StringBuffer buffer;
+        PrettyJsonWriter writerObj(buffer);
+        JsonWriter& writer = writerObj;
+        writer.StartObject();
+
+        writer.JKEY("Scene");
+        writer.String(data.SceneName);
+        writer.JKEY("EngineVersion");
+        writer.String(Globals::EngineVersion);
+        writer.JKEY("Frames");
+        writer.Int(data.FrameTimes.Count());
+
+        writer.JKEY("CPU");
+        writer.StartObject();
+        WriteTimings(writer, "Frame", data.FrameTimes);
+        WriteTimings(writer, "Update", data.UpdateTimes);
+        WriteTimings(writer, "Draw", data.DrawTimesCPU);
+        writer.EndObject();
+
+        writer.JKEY("GPU");
+        writer.StartObject();
+        WriteTimings(writer, "Frame", data.DrawTimesGPU);
+        writer.JKEY("Passes");
+        writer.StartArray();
+        for (const auto& e : data.Passes)
+        {
+            writer.StartObject();
+            writer.JKEY("Name");
+            writer.String(e.Key);
+            writer.JKEY("Avg");
+            writer.Float((float)(e.Value.Total / Math::Max(e.Value.Count, 1)));
+            writer.JKEY("Max");
+            writer.Float(e.Value.Max);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+
+        writer.JKEY("Memory");
+        writer.StartObject();
+        writer.JKEY("ProcessPeak");
+        writer.Uint64(data.ProcessMemoryPeak);
+        writer.JKEY("GPUPeak");
+        writer.Uint64(data.GPUMemoryPeak);
+        writer.EndObject();
+
+        writer.JKEY("Streaming");
+        writer.StartObject();
+        writer.JKEY("ResourcesPeak");
+        writer.Int(data.StreamingPeak.ResourcesCount);
+        writer.JKEY("StreamingResourcesPeak");
+        writer.Int(data.StreamingPeak.StreamingResourcesCount);
+        writer.JKEY("BudgetLimitedResourcesPeak");
+        writer.Int(data.StreamingPeak.BudgetLimitedResourcesCount);
+        writer.JKEY("TexturesMemoryPeak");
+        writer.Uint64(data.StreamingPeak.TexturesMemoryUsage);
+        writer.JKEY("ModelsMemoryPeak");
+        writer.Uint64(data.StreamingPeak.ModelsMemoryUsage);
+        writer.JKEY("AudioMemoryPeak");
+        writer.Uint64(data.StreamingPeak.AudioMemoryUsage);
+        writer.JKEY("StreamedInFrame");
+        writer.Int(data.StreamingDoneFrame);
+        writer.EndObject();
+
+        // Frames that took much longer than the typical frame
+        Array<float> sorted(data.FrameTimes);
+        Sorting::QuickSort(sorted.Get(), sorted.Count());
+        const float hitchThreshold = Math::Max(GetPercentile(sorted, 0.5f) * 2.0f, PERFORMANCE_CAPTURE_HITCH_MIN_MS);
+        writer.JKEY("HitchThreshold");
+        writer.Float(hitchThreshold);
+        writer.JKEY("Hitches");
+        writer.StartArray();
+        for (int32 i = 0; i < data.FrameTimes.Count(); i++)
+        {
+            if (data.FrameTimes[i] < hitchThreshold)
+                continue;
+            writer.StartObject();
+            writer.JKEY("Frame");
+            writer.Int(i);
+            writer.JKEY("Time");
+            writer.Float(data.FrameTimes[i]);
+            writer.EndObject();
+        }
+        writer.EndArray();
+
+        writer.EndObject();
+        if (File::WriteAllBytes(data.ReportPath, (const byte*)buffer.GetString(), (int32)buffer.GetSize()))
+        {
+            LOG(Error, "Failed to save performance report to {0}", data.ReportPath);
+            return true;
+        }
+        LOG(Info, "Saved performance report to {0}", data.ReportPath);
+        return false;
+    }
+
+    void EndCapture(int32 exitCode)
+    {
+        Delete(Data);
+        Data = nullptr;
+        Engine::RequestExit(exitCode);
+    }
+}
+
+class PerformanceCaptureService : public EngineService
+{
+public:
+    PerformanceCaptureService()
+        : EngineService(TEXT("Performance Capture"), 1000)
+    {
+    }
+
+    bool Init() override;
+    void Update() override;
+    void Dispose() override;
+};
+
+PerformanceCaptureService PerformanceCaptureServiceInstance;
+
+bool PerformanceCaptureService::Init()
+{
+    if (!CommandLine::Options.PerfScene.HasValue())
+        return false;
+    Data = New<PerformanceCaptureData>();
+    auto& data = *Data;
+    data.ReportPath = CommandLine::Options.PerfReport.HasValue() ? CommandLine::Options.PerfReport.GetValue() : Globals::ProjectFolder / TEXT("PerformanceReport.json");
+    if (CommandLine::Options.PerfCamera.HasValue())
+    {
+        if (LoadCameraPath(CommandLine::Options.PerfCamera.GetValue(), data.CameraPath))
+        {
+            LOG(Error, "Failed to load camera path {0}", CommandLine::Options.PerfCamera.GetValue());
+            return true;
+        }
+        data.FramesCount = -1;
+    }
+    if (CommandLine::Options.PerfFrames.HasValue())
+        StringUtils::Parse(CommandLine::Options.PerfFrames.GetValue().Get(), &data.FramesCount);
+    LOG(Info, "Starting performance capture of scene {0}", CommandLine::Options.PerfScene.GetValue());
+    return false;
+}
+
+void PerformanceCaptureService::Update()
+{
+    if (!Data || Engine::ShouldExit())
+        return;
+    auto& data = *Data;
+    const double time = Platform::GetTimeSeconds();
+    const float frameTimeMs = (float)((time - data.LastFrameTime) * 1000.0);
+    data.LastFrameTime = time;
+    switch (data.State)
+    {
+    case PerformanceCaptureData::States::LoadScene:
+        if (LoadScene())
+        {
+            LOG(Error, "Failed to load scene {0} for performance capture", CommandLine::Options.PerfScene.GetValue());
+            EndCapture(-1);
+            return;
+        }
+        data.State = PerformanceCaptureData::States::Warmup;
+        break;
+    case PerformanceCaptureData::States::Warmup:
+        if (++data.Frame >= PERFORMANCE_CAPTURE_WARMUP_FRAMES)
+        {
+            data.Frame = 0;
+            data.LastFrameGPU = GetLastFrameGPU();
+            data.State = PerformanceCaptureData::States::Measure;
+        }
+        break;
+    case PerformanceCaptureData::States::Measure:
+    {
+        MeasureFrame(frameTimeMs);
+        data.Frame++;
+        bool finished = data.FramesCount >= 0 && data.Frame >= data.FramesCount;
+        if (data.CameraActor)
+        {
+            // Camera path is played in real time
+            data.CameraTime += frameTimeMs * 0.001f;
+            finished |= data.FramesCount < 0 && data.CameraTime >= data.CameraPath.Last().Time;
+            UpdateCamera(data.CameraTime);
+        }
+        if (finished)
+        {
+            const bool failed = WriteReport();
+            EndCapture(failed ? -1 : 0);
+        }
+        break;
+    }
+    }
+}
+
+void PerformanceCaptureService::Dispose()
+{
+    if (Data)
+    {
+        Delete(Data);
+        Data = nullptr;
+    }
+}
+
+#endif
@@ -4,6 +4,8 @@
 
 #include "ProfilerCPU.h"
 #include "ProfilerGPU.h"
+#include "ProfilerMemory.h"
+#include "ProfilerCounters.h"
 
 #if COMPILE_WITH_PROFILER
 
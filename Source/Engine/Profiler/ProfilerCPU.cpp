@@ -5,18 +5,100 @@
 #include "ProfilerCPU.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Threading/ThreadRegistry.h"
+#if (PLATFORM_ARCH_X64 || PLATFORM_ARCH_X86) || (PLATFORM_ARCH_ARM64 && defined(_MSC_VER))
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#include <cpuid.h>
+#endif
+#endif
 
 THREADLOCAL ProfilerCPU::Thread* ProfilerCPU::Thread::Current = nullptr;
 Array<ProfilerCPU::Thread*, InlinedAllocation<64>> ProfilerCPU::Threads;
 bool ProfilerCPU::Enabled = false;
 
+namespace
+{
+    // Events timer state (cycle counter ticks are converted relative to the calibration point)
+    bool UseCycleCounter = false;
+    uint64 CycleCounterStart;
+    double CycleCounterStartTime;
+    double CycleCounterToMilliseconds;
+
+    FORCE_INLINE uint64 ReadCycleCounter()
+    {
+#if (PLATFORM_ARCH_X64 || PLATFORM_ARCH_X86)
+        return __rdtsc();
+#elif PLATFORM_ARCH_ARM64 && defined(_MSC_VER)
+        return _ReadStatusReg(ARM64_CNTVCT);
+#elif PLATFORM_ARCH_ARM64
+        uint64 value;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return 0;
+#endif
+    }
+
+    bool IsCycleCounterSupported()
+    {
+#if (PLATFORM_ARCH_X64 || PLATFORM_ARCH_X86)
+        // Time Stamp Counter has to be invariant (constant rate in all power states and synchronized between cores)
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0x80000000);
+        if ((uint32)info[0] < 0x80000007)
+            return false;
+        __cpuid(info, 0x80000007);
+        return (info[3] & (1 << 8)) != 0;
+#else
+        uint32 eax, ebx, ecx, edx;
+        if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+            return false;
+        return (edx & (1 << 8)) != 0;
+#endif
+#elif PLATFORM_ARCH_ARM64
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void CopyName(ProfilerCPU::Event& e, const Char* name)
+    {
+        auto dst = e.Name;
+        auto src = name;
+        if (src)
+        {
+            const auto end = dst + ARRAY_COUNT(e.Name) - 1;
+            while (*src && dst != end)
+                *dst++ = *src++;
+        }
+        *dst = 0;
+    }
+
+    void CopyName(ProfilerCPU::Event& e, const char* name)
+    {
+        auto dst = e.Name;
+        auto src = name;
+        if (src)
+        {
+            const auto end = dst + ARRAY_COUNT(e.Name) - 1;
+            while (*src && dst != end)
+                *dst++ = *src++;
+        }
+        *dst = 0;
+    }
+}
+
 ProfilerCPU::EventBuffer::EventBuffer()
 {
     _capacity = 8192;
     _capacityMask = _capacity - 1;
     _data = NewArray<Event>(_capacity);
     _head = 0;
-    _count = 0;
+    _tail = 0;
 }
 
 ProfilerCPU::EventBuffer::~EventBuffer()
@@ -28,98 +110,120 @@ void ProfilerCPU::EventBuffer::Extract(Array<Event>& data, bool withRemoval)
 {
     data.Clear();
 
-    // Peek ring buffer state
-    int32 count = _count;
-    const int32 capacity = _capacity;
-
-    // Skip if empty
-    if (count == 0)
+    // Snapshot the events range added since the last extraction (writer can overwrite the slot at head before publishing it, so skip it too)
+    const int64 head = Platform::AtomicRead(&_head);
+    int64 start = Math::Max(_tail, head + 1 - _capacity);
+    if (start >= head)
         return;
+    int32 count = (int32)(head - start);
+    data.Resize(count, false);
+    const int32 tail = (int32)(start & _capacityMask);
+    const int32 spaceLeftCount = Math::Min(_capacity - tail, count);
+    Platform::MemoryCopy(data.Get(), &_data[tail], spaceLeftCount * sizeof(Event));
+    if (count > spaceLeftCount)
+        Platform::MemoryCopy(data.Get() + spaceLeftCount, &_data[0], (count - spaceLeftCount) * sizeof(Event));
 
-    // Fix iterators when buffer is full (begin == end)
-    if (count == capacity)
-    {
-        _count--;
-        count--;
-    }
+    // Discard events that could be overwritten by the writer during copy
+    const int64 overwritten = Platform::AtomicRead(&_head) + 1 - _capacity - start;
+    int32 first = (int32)Math::Max<int64>(overwritten, 0);
 
     // Find the first item (skip non-root events)
-    Iterator firstEvent = Begin();
-    for (auto i = firstEvent; i.IsNotEnd(); ++i)
-    {
-        if (i.Event().Depth == 0)
-        {
-            firstEvent = i;
-            break;
-        }
-    }
-
-    // Skip if no root event found inside the buffer
-    if (firstEvent.IsEnd())
-        return;
+    while (first < count && data[first].Depth != 0)
+        first++;
 
     // Find the last item (last event in ended root event)
-    Iterator lastEndedRoot = End();
-    for (auto i = Last(); i != firstEvent; --i)
+    int32 lastEndedRoot = -1;
+    for (int32 i = count - 1; i >= first; i--)
     {
-        if (i.Event().Depth == 0 && i.Event().End > 0)
+        if (data[i].Depth == 0 && data[i].End > 0)
         {
             lastEndedRoot = i;
             break;
         }
     }
-
-    // Skip if no finished root event found inside the buffer
-    if (lastEndedRoot.IsEnd())
+    if (lastEndedRoot == -1)
+    {
+        // Skip if no finished root event found inside the buffer
+        if (withRemoval)
+            _tail = start + first;
+        data.Clear();
         return;
+    }
 
     // Find the last non-root event in last root event
-    Iterator lastEvent = lastEndedRoot;
-    const double lastRootEventEndTime = lastEndedRoot.Event().End;
-    for (auto i = --End(); i != lastEndedRoot; --i)
+    int32 last = lastEndedRoot;
+    const double lastRootEventEndTime = data[lastEndedRoot].End;
+    for (int32 i = count - 1; i > lastEndedRoot; i--)
     {
-        if (i.Event().End > 0 && i.Event().End <= lastRootEventEndTime)
+        if (data[i].End > 0 && data[i].End <= lastRootEventEndTime)
         {
-            lastEvent = i;
+            last = i;
             break;
         }
     }
 
+    // Remove all the events up to the last extracted one
     if (withRemoval)
+        _tail = start + last + 1;
+
+    // Extract all the events between [first, last]
+    count = last - first + 1;
+    if (first != 0)
     {
-        // Remove all the events between [Begin(), lastEvent]
-        _count -= (lastEvent.Index() - Begin().Index()) & _capacityMask;
+        for (int32 i = 0; i < count; i++)
+            data[i] = data[first + i];
     }
-
-    // Extract all the events between [firstEvent, lastEvent]
-    const int32 head = (lastEvent.Index() + 1) & _capacityMask;
-    count = (lastEvent.Index() - firstEvent.Index() + 1) & _capacityMask;
     data.Resize(count, false);
-    const int32 tail = (head - count) & _capacityMask;
-    const int32 spaceLeft = capacity - tail;
-    const int32 spaceLeftCount = Math::Min(spaceLeft, count);
-    const int32 overflow = count - spaceLeft;
-    Platform::MemoryCopy(data.Get(), &_data[tail], spaceLeftCount * sizeof(Event));
-    if (overflow > 0)
-        Platform::MemoryCopy(data.Get() + spaceLeftCount, &_data[0], overflow * sizeof(Event));
 }
 
 int32 ProfilerCPU::Thread::BeginEvent()
 {
-    const double time = Platform::GetTimeSeconds() * 1000.0;
-    const auto index = Buffer.Add();
+    const double time = GetTime();
+    const int32 index = Buffer.GetNext();
+    Event& e = Buffer.Get(index);
+    e.Start = time;
+    e.End = 0;
+    e.Depth = _depth++;
+    e.NativeMemoryAllocation = 0;
+    e.ManagedMemoryAllocation = 0;
+    e.Name[0] = 0;
+    Buffer.Add();
+    return index;
+}
+
+int32 ProfilerCPU::Thread::BeginEvent(const Char* name)
+{
+    const double time = GetTime();
+    const int32 index = Buffer.GetNext();
     Event& e = Buffer.Get(index);
     e.Start = time;
     e.End = 0;
     e.Depth = _depth++;
     e.NativeMemoryAllocation = 0;
     e.ManagedMemoryAllocation = 0;
+    CopyName(e, name);
+    Buffer.Add();
+    return index;
+}
+
+int32 ProfilerCPU::Thread::BeginEvent(const char* name)
+{
+    const double time = GetTime();
+    const int32 index = Buffer.GetNext();
+    Event& e = Buffer.Get(index);
+    e.Start = time;
+    e.End = 0;
+    e.Depth = _depth++;
+    e.NativeMemoryAllocation = 0;
+    e.ManagedMemoryAllocation = 0;
+    CopyName(e, name);
+    Buffer.Add();
     return index;
 }
 
 void ProfilerCPU::Thread::EndEvent(int32 index)
 {
-    const double time = Platform::GetTimeSeconds() * 1000.0;
+    const double time = GetTime();
     _depth--;
     Event& e = Buffer.Get(index);
     e.End = time;
@@ -127,9 +231,9 @@ void ProfilerCPU::Thread::EndEvent(int32 index)
 
 void ProfilerCPU::Thread::EndEvent()
 {
-    const double time = Platform::GetTimeSeconds() * 1000.0;
+    const double time = GetTime();
     _depth--;
-    Event& e = (Buffer.Last()--).Event();
+    Event& e = Buffer.Get(Buffer.GetLast());
     e.End = time;
 }
 
@@ -143,64 +247,48 @@ ProfilerCPU::Thread* ProfilerCPU::GetCurrentThread()
     return Enabled ? Thread::Current : nullptr;
 }
 
+namespace
+{
+    ProfilerCPU::Thread* GetOrCreateThread()
+    {
+        auto thread = ProfilerCPU::Thread::Current;
+        if (thread == nullptr)
+        {
+            const auto id = Platform::GetCurrentThreadID();
+            const auto t = ThreadRegistry::GetThread(id);
+            if (t)
+                thread = New<ProfilerCPU::Thread>(t->GetName());
+            else if (id == Globals::MainThreadID)
+                thread = New<ProfilerCPU::Thread>(TEXT("Main"));
+            else
+                thread = New<ProfilerCPU::Thread>(TEXT("Thread"));
+
+            ProfilerCPU::Thread::Current = thread;
+            ProfilerCPU::Threads.Add(thread);
+        }
+        return thread;
+    }
+}
+
 int32 ProfilerCPU::BeginEvent()
 {
     if (!Enabled)
         return -1;
-    auto thread = Thread::Current;
-    if (thread == nullptr)
-    {
-        const auto id = Platform::GetCurrentThreadID();
-        const auto t = ThreadRegistry::GetThread(id);
-        if (t)
-            thread = New<Thread>(t->GetName());
-        else if (id == Globals::MainThreadID)
-            thread = New<Thread>(TEXT("Main"));
-        else
-            thread = New<Thread>(TEXT("Thread"));
-
-        Thread::Current = thread;
-        Threads.Add(thread);
-    }
-    return thread->BeginEvent();
+    return GetOrCreateThread()->BeginEvent();
 }
 
 int32 ProfilerCPU::BeginEvent(const Char* name)
 {
     if (!Enabled)
         return -1;
-    const auto index = BeginEvent();
-    const auto thread = Thread::Current;
-    auto& e = thread->Buffer.Get(index);
-    auto dst = e.Name;
-    auto src = name;
-    if (src)
-    {
-        const auto end = dst + ARRAY_COUNT(e.Name) - 1;
-        while (*src && dst != end)
-            *dst++ = *src++;
-    }
-    *dst = 0;
-    return index;
+    return GetOrCreateThread()->BeginEvent(name);
 }
 
 int32 ProfilerCPU::BeginEvent(const char* name)
 {
     if (!Enabled)
         return -1;
-    const auto index = BeginEvent();
-    const auto thread = Thread::Current;
-    auto& e = thread->Buffer.Get(index);
-    auto dst = e.Name;
-    auto src = name;
-    if (src)
-    {
-        const auto end = dst + ARRAY_COUNT(e.Name) - 1;
-        while (*src && dst != end)
-            *dst++ = *src++;
-    }
-    *dst = 0;
-    return index;
+    return GetOrCreateThread()->BeginEvent(name);
 }
 
 void ProfilerCPU::EndEvent(int32 index)
@@ -215,6 +303,46 @@ void ProfilerCPU::EndEvent()
         Thread::Current->EndEvent();
 }
 
+void ProfilerCPU::Init()
+{
+    if (UseCycleCounter || !IsCycleCounterSupported())
+        return;
+
+    // Calibrate the cycle counter frequency against the platform clock
+#if PLATFORM_ARCH_ARM64 && defined(_MSC_VER)
+    const uint64 frequency = _ReadStatusReg(ARM64_CNTFRQ);
+#elif PLATFORM_ARCH_ARM64
+    uint64 frequency;
+    asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+#endif
+    const uint64 startCycles = ReadCycleCounter();
+    const double startTime = Platform::GetTimeSeconds();
+    uint64 endCycles;
+    double endTime;
+    do
+    {
+        endCycles = ReadCycleCounter();
+        endTime = Platform::GetTimeSeconds();
+    } while (endTime - startTime < 0.005);
+    if (endCycles <= startCycles)
+        return;
+    CycleCounterStart = endCycles;
+    CycleCounterStartTime = endTime * 1000.0;
+#if PLATFORM_ARCH_ARM64
+    CycleCounterToMilliseconds = 1000.0 / (double)frequency;
+#else
+    CycleCounterToMilliseconds = (endTime - startTime) * 1000.0 / (double)(endCycles - startCycles);
+#endif
+    UseCycleCounter = true;
+}
+
+double ProfilerCPU::GetTime()
+{
+    if (UseCycleCounter)
+        return CycleCounterStartTime + (double)(int64)(ReadCycleCounter() - CycleCounterStart) * CycleCounterToMilliseconds;
+    return Platform::GetTimeSeconds() * 1000.0;
+}
+
 void ProfilerCPU::Dispose()
 {
     Enabled = false;
@@ -55,7 +55,7 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
     };
 
     /// <summary>
-    /// Implements simple profiling events ring-buffer.
+    /// Implements lock-free profiling events ring-buffer. Events are written only by the owning thread and extracted by the single collector thread without blocking the writer (the oldest events get overwritten when buffer is full).
     /// </summary>
     class EventBuffer : public NonCopyable
     {
@@ -63,8 +63,8 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         Event* _data;
         int32 _capacity;
         int32 _capacityMask;
-        int32 _head;
-        int32 _count;
+        int64 volatile _head;
+        int64 _tail;
 
     public:
         EventBuffer();
@@ -72,11 +72,11 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
 
     public:
         /// <summary>
-        /// Gets the amount of the events in the buffer.
+        /// Gets the amount of the events in the buffer (not extracted yet).
         /// </summary>
-        FORCE_INLINE int32 GetCount() const
+        int32 GetCount() const
         {
-            return _count;
+            return (int32)Math::Min<int64>(_head - _tail, _capacity);
         }
 
         /// <summary>
@@ -91,126 +91,36 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         }
 
         /// <summary>
-        /// Adds new event to the buffer.
+        /// Gets the next event to write (call Add after the event data is filled). Can be called only by the owning thread.
         /// </summary>
         /// <returns>The event index.</returns>
-        int32 Add()
+        FORCE_INLINE int32 GetNext() const
         {
-            const int32 index = _head;
-            _head = (_head + 1) & _capacityMask;
-            _count = Math::Min(_count + 1, _capacity);
-            return index;
+            return (int32)(_head & _capacityMask);
         }
 
         /// <summary>
-        /// Extracts the buffer data (only ended events starting from the root level with depth=0).
+        /// Adds the next event to the buffer (makes it visible to the collector). Can be called only by the owning thread.
         /// </summary>
-        /// <param name="data">The output data.</param>
-        /// <param name="withRemoval">True if also remove extracted events to prevent double-gather, false if don't modify the buffer data.</param>
-        void Extract(Array<Event, HeapAllocation>& data, bool withRemoval);
-
-    public:
-        /// <summary>
-        /// Ring buffer iterator
-        /// </summary>
-        struct Iterator
-        {
-            friend EventBuffer;
-
-        private:
-            EventBuffer* _buffer;
-            int32 _index;
-
-            Iterator(EventBuffer* buffer, const int32 index)
-                : _buffer(buffer)
-                , _index(index)
-            {
-            }
-
-            Iterator(const Iterator& i) = default;
-
-        public:
-            FORCE_INLINE int32 Index() const
-            {
-                return _index;
-            }
-
-            FORCE_INLINE Event& Event() const
-            {
-                ASSERT_LOW_LAYER(_buffer && _index >= 0 && _index < _buffer->_capacity);
-                return _buffer->Get(_index);
-            }
-
-            bool IsEnd() const
-            {
-                ASSERT_LOW_LAYER(_buffer);
-                return _index == _buffer->_head;
-            }
-
-            bool IsNotEnd() const
-            {
-                ASSERT_LOW_LAYER(_buffer);
-                return _index != _buffer->_head;
-            }
-
-            FORCE_INLINE bool operator==(const Iterator& v) const
-            {
-                return _buffer == v._buffer && _index == v._index;
-            }
-
-            FORCE_INLINE bool operator!=(const Iterator& v) const
-            {
-                return _buffer != v._buffer || _index != v._index;
-            }
-
-        public:
-            Iterator& operator++()
-            {
-                ASSERT(_buffer);
-                _index = (_index + 1) & _buffer->_capacityMask;
-                return *this;
-            }
-
-            Iterator operator++(int)
-            {
-                ASSERT(_buffer);
-                Iterator temp = *this;
-                _index = (_index + 1) & _buffer->_capacityMask;
-                return temp;
-            }
-
-            Iterator& operator--()
-            {
-                ASSERT(_buffer);
-                _index = (_index - 1) & _buffer->_capacityMask;
-                return *this;
-            }
-
-            Iterator operator--(int)
-            {
-                ASSERT(_buffer);
-                Iterator temp = *this;
-                _index = (_index - 1) & _buffer->_capacityMask;
-                return temp;
-            }
-        };
-
-    public:
-        FORCE_INLINE Iterator Begin()
+        FORCE_INLINE void Add()
         {
-            return Iterator(this, (_head - _count) & _capacityMask);
+            Platform::AtomicStore(&_head, _head + 1);
         }
 
-        FORCE_INLINE Iterator Last()
+        /// <summary>
+        /// Gets the index of the last added event. Can be called only by the owning thread.
+        /// </summary>
+        FORCE_INLINE int32 GetLast() const
         {
-            ASSERT(_count > 0);
-            return Iterator(this, (_head - 1) & _capacityMask);
+            return (int32)((_head - 1) & _capacityMask);
         }
 
-        FORCE_INLINE Iterator End()
-        {
-            return Iterator(this, _head);
-        }
+        /// <summary>
+        /// Extracts the buffer data (only ended events starting from the root level with depth=0). Doesn't block the writer thread.
+        /// </summary>
+        /// <param name="data">The output data.</param>
+        /// <param name="withRemoval">True if also remove extracted events to prevent double-gather, false if don't modify the buffer data.</param>
+        void Extract(Array<Event, HeapAllocation>& data, bool withRemoval);
     };
 
     /// <summary>
@@ -260,6 +170,20 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         /// <returns>The event token.</returns>
         int32 BeginEvent();
 
+        /// <summary>
+        /// Begins the event running on a this thread. Call EndEvent with index parameter equal to the returned value by BeginEvent function.
+        /// </summary>
+        /// <param name="name">The event name.</param>
+        /// <returns>The event token.</returns>
+        int32 BeginEvent(const Char* name);
+
+        /// <summary>
+        /// Begins the event running on a this thread. Call EndEvent with index parameter equal to the returned value by BeginEvent function.
+        /// </summary>
+        /// <param name="name">The event name.</param>
+        /// <returns>The event token.</returns>
+        int32 BeginEvent(const char* name);
+
         /// <summary>
         /// Ends the event running on a this thread.
         /// </summary>
@@ -325,6 +249,16 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
     /// </summary>
     static void EndEvent();
 
+    /// <summary>
+    /// Initializes the events timer (calibrates the CPU cycle counter against the platform clock). Called by the engine on startup, before that profiler uses the platform clock.
+    /// </summary>
+    static void Init();
+
+    /// <summary>
+    /// Gets the profiler events time (in milliseconds). Uses CPU cycle counter (rdtsc or cntvct) if available.
+    /// </summary>
+    static double GetTime();
+
     /// <summary>
     /// Releases resources. Calls to the profiling API after Dispose are not valid.
     /// </summary>
@@ -0,0 +1,319 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerCounters.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Platform/Network.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Threading/Threading.h"
+
+namespace
+{
+    struct CounterData
+    {
+        String Name;
+        StringAnsi NameAnsi;
+        ProfilerCounterType Type;
+        double Value;
+        float History[PROFILER_COUNTERS_HISTORY];
+    };
+
+    // Counter values accumulated by a single thread (written only by the owning thread, read by snapshot)
+    struct ThreadCounters
+    {
+        double volatile Values[PROFILER_COUNTERS_MAX];
+        double Last[PROFILER_COUNTERS_MAX];
+    };
+
+    CriticalSection Locker;
+    CounterData* Counters[PROFILER_COUNTERS_MAX] = {};
+    int32 volatile CountersCount = 0;
+    int64 volatile Gauges[PROFILER_COUNTERS_MAX] = {};
+    Array<ThreadCounters*> Threads;
+    THREADLOCAL ThreadCounters* CurrentThread = nullptr;
+    uint64 HistoryFrames = 0;
+
+    // Exporters
+    FileWriteStream* ExportCSV = nullptr;
+    bool ExportStatsD = false;
+    NetworkSocket StatsDSocket;
+    NetworkEndPoint StatsDEndPoint;
+    StringAnsi StatsDPrefix;
+
+    FORCE_INLINE double ReadDouble(int64 volatile* value)
+    {
+        const int64 bits = Platform::AtomicRead(value);
+        return *(const double*)&bits;
+    }
+
+    ThreadCounters* GetThreadCounters()
+    {
+        auto thread = CurrentThread;
+        if (thread == nullptr)
+        {
+            thread = (ThreadCounters*)Allocator::Allocate(sizeof(ThreadCounters));
+            Platform::MemoryClear(thread, sizeof(ThreadCounters));
+            CurrentThread = thread;
+            ScopeLock lock(Locker);
+            Threads.Add(thread);
+        }
+        return thread;
+    }
+
+    void SendStatsD(StringAnsi& packet)
+    {
+        if (packet.HasChars())
+            Network::WriteSocket(StatsDSocket, (byte*)packet.Get(), packet.Length(), &StatsDEndPoint);
+        packet.Clear();
+    }
+}
+
+class ProfilerCountersService : public EngineService
+{
+public:
+    ProfilerCountersService()
+        : EngineService(TEXT("Profiler Counters"))
+    {
+    }
+
+    void Update() override
+    {
+        ProfilerCounters::Snapshot();
+    }
+
+    void Dispose() override
+    {
+        ProfilerCounters::StopExport();
+        ScopeLock lock(Locker);
+        for (int32 i = 0; i < PROFILER_COUNTERS_MAX; i++)
+            SAFE_DELETE(Counters[i]);
+        CountersCount = 0;
+        for (ThreadCounters* thread : Threads)
+            Allocator::Free(thread);
+        Threads.Clear();
+        CurrentThread = nullptr;
+    }
+};
+
+ProfilerCountersService ProfilerCountersServiceInstance;
+
+int32 ProfilerCounters::Register(const StringView& name, ProfilerCounterType type)
+{
+    ScopeLock lock(Locker);
+    const int32 id = Find(name);
+    if (id != -1)
+        return id;
+    const int32 count = CountersCount;
+    if (count >= PROFILER_COUNTERS_MAX)
+    {
+        LOG(Warning, "Cannot register profiler counter '{0}'. Limit of {1} counters has been reached.", name, PROFILER_COUNTERS_MAX);
+        return -1;
+    }
+    auto counter = New<CounterData>();
+    counter->Name = name;
+    counter->NameAnsi = name.ToStringAnsi();
+    counter->Type = type;
+    counter->Value = 0.0;
+    Platform::MemoryClear(counter->History, sizeof(counter->History));
+    Counters[count] = counter;
+    Platform::AtomicStore(&CountersCount, count + 1);
+    return count;
+}
+
+int32 ProfilerCounters::Find(const StringView& name)
+{
+    ScopeLock lock(Locker);
+    const int32 count = CountersCount;
+    for (int32 i = 0; i < count; i++)
+    {
+        if (Counters[i]->Name == name)
+            return i;
+    }
+    return -1;
+}
+
+int32 ProfilerCounters::GetCount()
+{
+    return Platform::AtomicRead(&CountersCount);
+}
+
+String ProfilerCounters::GetName(int32 id)
+{
+    if (id < 0 || id >= GetCount())
+        return String::Empty;
+    return Counters[id]->Name;
+}
+
+ProfilerCounterType ProfilerCounters::GetType(int32 id)
+{
+    if (id < 0 || id >= GetCount())
+        return ProfilerCounterType::Counter;
+    return Counters[id]->Type;
+}
+
+void ProfilerCounters::Add(int32 id, double value)
+{
+    if (id < 0 || id >= GetCount())
+        return;
+    if (Counters[id]->Type == ProfilerCounterType::Gauge)
+    {
+        // Gauges are global
+        int64 prevBits, newBits;
+        do
+        {
+            prevBits = Platform::AtomicRead(&Gauges[id]);
+            const double newValue = *(const double*)&prevBits + value;
+            newBits = *(const int64*)&newValue;
+        } while (Platform::InterlockedCompareExchange(&Gauges[id], newBits, prevBits) != prevBits);
+    }
+    else
+    {
+        ThreadCounters* thread = GetThreadCounters();
+        thread->Values[id] += value;
+    }
+}
+
+void ProfilerCounters::Set(int32 id, double value)
+{
+    if (id < 0 || id >= GetCount())
+        return;
+    Platform::AtomicStore(&Gauges[id], *(const int64*)&value);
+}
+
+double ProfilerCounters::GetValue(int32 id)
+{
+    if (id < 0 || id >= GetCount())
+        return 0.0;
+    return Counters[id]->Value;
+}
+
+Array<float> ProfilerCounters::GetHistory(int32 id)
+{
+    Array<float> result;
+    if (id < 0 || id >= GetCount())
+        return result;
+    ScopeLock lock(Locker);
+    const CounterData* counter = Counters[id];
+    const int32 count = (int32)Math::Min<uint64>(HistoryFrames, PROFILER_COUNTERS_HISTORY);
+    result.Resize(count);
+    for (int32 i = 0; i < count; i++)
+        result[i] = counter->History[(HistoryFrames - count + i) % PROFILER_COUNTERS_HISTORY];
+    return result;
+}
+
+bool ProfilerCounters::StartExportCSV(const StringView& path)
+{
+    ScopeLock lock(Locker);
+    if (ExportCSV)
+        Delete(ExportCSV);
+    ExportCSV = FileWriteStream::Open(path);
+    if (!ExportCSV)
+    {
+        LOG(Error, "Failed to open profiler counters export file {0}", path);
+        return true;
+    }
+    const char header[] = "Frame,Time,Counter,Value\n";
+    ExportCSV->WriteBytes(header, ARRAY_COUNT(header) - 1);
+    return false;
+}
+
+bool ProfilerCounters::StartExportStatsD(const StringView& address, const StringView& port, const StringView& prefix)
+{
+    ScopeLock lock(Locker);
+    if (ExportStatsD)
+    {
+        Network::DestroySocket(StatsDSocket);
+        ExportStatsD = false;
+    }
+    if (Network::CreateEndPoint(address, port, NetworkIPVersion::IPv4, StatsDEndPoint, false))
+    {
+        LOG(Error, "Failed to resolve statsd server address {0}:{1}", address, port);
+        return true;
+    }
+    if (Network::CreateSocket(StatsDSocket, NetworkProtocol::Udp, NetworkIPVersion::IPv4))
+    {
+        LOG(Error, "Failed to create statsd socket");
+        return true;
+    }
+    StatsDPrefix = prefix.ToStringAnsi();
+    if (StatsDPrefix.HasChars() && !StatsDPrefix.EndsWith('.'))
+        StatsDPrefix += '.';
+    ExportStatsD = true;
+    return false;
+}
+
+void ProfilerCounters::StopExport()
+{
+    ScopeLock lock(Locker);
+    if (ExportCSV)
+    {
+        ExportCSV->Flush();
+        Delete(ExportCSV);
+        ExportCSV = nullptr;
+    }
+    if (ExportStatsD)
+    {
+        Network::DestroySocket(StatsDSocket);
+        ExportStatsD = false;
+    }
+}
+
+void ProfilerCounters::Snapshot()
+{
+    ScopeLock lock(Locker);
+    const int32 count = CountersCount;
+    if (count == 0)
+        return;
+    const uint32 historyIndex = (uint32)(HistoryFrames % PROFILER_COUNTERS_HISTORY);
+    const float time = (float)Platform::GetTimeSeconds();
+    StringAnsi statsDPacket;
+    for (int32 id = 0; id < count; id++)
+    {
+        CounterData* counter = Counters[id];
+        double value;
+        if (counter->Type == ProfilerCounterType::Gauge)
+        {
+            value = ReadDouble(&Gauges[id]);
+        }
+        else
+        {
+            // Sum the per-thread increments since the last snapshot
+            value = 0.0;
+            for (ThreadCounters* thread : Threads)
+            {
+                const double total = thread->Values[id];
+                value += total - thread->Last[id];
+                thread->Last[id] = total;
+            }
+        }
+        counter->Value = value;
+        counter->History[historyIndex] = (float)value;
+
+        if (ExportCSV)
+        {
+            const StringAnsi line = StringAnsi::Format("{0},{1},{2},{3}\n", Engine::FrameCount, time, counter->NameAnsi, value);
+            ExportCSV->WriteBytes(line.Get(), line.Length());
+        }
+        if (ExportStatsD)
+        {
+            // Batch metrics into datagrams that fit the typical network MTU
+            StringAnsi metric = StringAnsi::Format("{0}{1}:{2}|{3}\n", StatsDPrefix, counter->NameAnsi, value, counter->Type == ProfilerCounterType::Gauge ? "g" : "c");
+            metric.Replace(' ', '_');
+            if (statsDPacket.Length() + metric.Length() > 1400)
+                SendStatsD(statsDPacket);
+            statsDPacket += metric;
+        }
+    }
+    if (ExportStatsD)
+        SendStatsD(statsDPacket);
+    HistoryFrames++;
+}
+
+#endif
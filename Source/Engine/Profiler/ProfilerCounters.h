@@ -0,0 +1,148 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+#if COMPILE_WITH_PROFILER
+
+// The maximum amount of the registered counters.
+#define PROFILER_COUNTERS_MAX 256
+
+// The amount of frames stored in the counters history.
+#define PROFILER_COUNTERS_HISTORY 300
+
+/// <summary>
+/// The type of the profiler counter.
+/// </summary>
+API_ENUM() enum class ProfilerCounterType
+{
+    /// <summary>
+    /// The value accumulated during the frame (eg. amount of draw calls or spawned objects). Resets every frame.
+    /// </summary>
+    Counter,
+
+    /// <summary>
+    /// The value that represents the current state (eg. amount of active particles or queue depth). Keeps the last set value.
+    /// </summary>
+    Gauge,
+};
+
+/// <summary>
+/// Named performance counters registry. Counters are accumulated per-thread without locking and snapshotted every frame into the values history. Can be exported to CSV file or statsd server for telemetry.
+/// </summary>
+API_CLASS(Static) class FLAXENGINE_API ProfilerCounters
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ProfilerCounters);
+public:
+    /// <summary>
+    /// Registers the counter (or returns the existing one with the same name).
+    /// </summary>
+    /// <param name="name">The counter name.</param>
+    /// <param name="type">The counter type.</param>
+    /// <returns>The counter identifier, or -1 if the counters limit has been reached.</returns>
+    API_FUNCTION() static int32 Register(const StringView& name, ProfilerCounterType type = ProfilerCounterType::Counter);
+
+    /// <summary>
+    /// Finds the registered counter.
+    /// </summary>
+    /// <param name="name">The counter name.</param>
+    /// <returns>The counter identifier, or -1 if not registered.</returns>
+    API_FUNCTION() static int32 Find(const StringView& name);
+
+    /// <summary>
+    /// Gets the amount of the registered counters (valid identifiers are in range [0; count-1]).
+    /// </summary>
+    API_PROPERTY() static int32 GetCount();
+
+    /// <summary>
+    /// Gets the counter name.
+    /// </summary>
+    /// <param name="id">The counter identifier.</param>
+    /// <returns>The name.</returns>
+    API_FUNCTION() static String GetName(int32 id);
+
+    /// <summary>
+    /// Gets the counter type.
+    /// </summary>
+    /// <param name="id">The counter identifier.</param>
+    /// <returns>The type.</returns>
+    API_FUNCTION() static ProfilerCounterType GetType(int32 id);
+
+    /// <summary>
+    /// Adds the value to the counter (or gauge). Lock-free, accumulated per-thread.
+    /// </summary>
+    /// <param name="id">The counter identifier.</param>
+    /// <param name="value">The value to add.</param>
+    API_FUNCTION() static void Add(int32 id, double value = 1.0);
+
+    /// <summary>
+    /// Sets the gauge value.
+    /// </summary>
+    /// <param name="id">The counter identifier.</param>
+    /// <param name="value">The value to set.</param>
+    API_FUNCTION() static void Set(int32 id, double value);
+
+    /// <summary>
+    /// Gets the counter value from the last frame snapshot.
+    /// </summary>
+    /// <param name="id">The counter identifier.</param>
+    /// <returns>The value.</returns>
+    API_FUNCTION() static double GetValue(int32 id);
+
+    /// <summary>
+    /// Gets the counter values from the last frames (ordered from the oldest to the newest, up to PROFILER_COUNTERS_HISTORY frames).
+    /// </summary>
+    /// <param name="id">The counter identifier.</param>
+    /// <returns>The values.</returns>
+    API_FUNCTION() static Array<float> GetHistory(int32 id);
+
+    /// <summary>
+    /// Starts exporting counter values every frame to a CSV file. Each row contains the frame index, the time in seconds, the counter name and the value.
+    /// </summary>
+    /// <param name="path">The output file path.</param>
+    /// <returns>True if failed to open the file, otherwise false.</returns>
+    API_FUNCTION() static bool StartExportCSV(const StringView& path);
+
+    /// <summary>
+    /// Starts exporting counter values every frame to a statsd server over UDP. Counters are sent as the count metrics and gauges as the gauge metrics.
+    /// </summary>
+    /// <param name="address">The server address.</param>
+    /// <param name="port">The server port.</param>
+    /// <param name="prefix">The metrics name prefix (eg. 'game.server1').</param>
+    /// <returns>True if failed to create the socket or resolve the address, otherwise false.</returns>
+    API_FUNCTION() static bool StartExportStatsD(const StringView& address, const StringView& port, const StringView& prefix);
+
+    /// <summary>
+    /// Stops the counters exporting (both CSV and statsd).
+    /// </summary>
+    API_FUNCTION() static void StopExport();
+
+    /// <summary>
+    /// Captures the counter values for the last frame (called by the engine every frame during the update).
+    /// </summary>
+    static void Snapshot();
+};
+
+// Shortcut macros for the counters with the constant name (eg. PROFILE_COUNTER_ADD("Draw Calls", 1))
+#define PROFILE_COUNTER_ADD(name, value) \
+    { \
+        static const int32 ProfileCounterId = ProfilerCounters::Register(TEXT(name), ProfilerCounterType::Counter); \
+        ProfilerCounters::Add(ProfileCounterId, (double)(value)); \
+    }
+#define PROFILE_GAUGE_SET(name, value) \
+    { \
+        static const int32 ProfileCounterId = ProfilerCounters::Register(TEXT(name), ProfilerCounterType::Gauge); \
+        ProfilerCounters::Set(ProfileCounterId, (double)(value)); \
+    }
+
+#else
+
+// Empty macros for disabled profiler
+#define PROFILE_COUNTER_ADD(name, value)
+#define PROFILE_GAUGE_SET(name, value)
+
+#endif
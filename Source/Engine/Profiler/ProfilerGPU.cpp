@@ -14,7 +14,11 @@ RenderStatsData RenderStatsData::Counter;
 int32 ProfilerGPU::_depth = 0;
 Array<GPUTimerQuery*> ProfilerGPU::_timerQueriesPool;
 Array<GPUTimerQuery*> ProfilerGPU::_timerQueriesFree;
+Array<ProfilerGPU::PassStats> ProfilerGPU::_passes;
+uint64 ProfilerGPU::_passesFrame = 0;
 bool ProfilerGPU::Enabled = true;
+bool ProfilerGPU::EnablePipelineStatistics = false;
+int32 ProfilerGPU::PassesMaxDepth = 3;
 int32 ProfilerGPU::CurrentBuffer = 0;
 ProfilerGPU::EventBuffer ProfilerGPU::Buffers[PROFILER_GPU_EVENTS_FRAMES];
 
@@ -48,6 +52,12 @@ void ProfilerGPU::EventBuffer::TryResolve()
     {
         auto& e = _data[i];
         e.Time = e.Timer->GetResult();
+        GPUPipelineStatistics stats;
+        if (e.Timer->CollectPipelineStatistics && !e.Timer->GetPipelineStatistics(stats))
+        {
+            e.Primitives = stats.Primitives;
+            e.PixelShaderInvocations = stats.PixelShaderInvocations;
+        }
         _timerQueriesFree.Add(e.Timer);
         e.Timer = nullptr;
     }
@@ -104,7 +114,10 @@ int32 ProfilerGPU::BeginEvent(const Char* name)
     e.Name = name;
     e.Stats = RenderStatsData::Counter;
     e.Timer = GetTimerQuery();
+    e.Timer->CollectPipelineStatistics = EnablePipelineStatistics;
     e.Timer->Begin();
+    e.Primitives = 0;
+    e.PixelShaderInvocations = 0;
     e.Depth = _depth++;
 
     auto& buffer = Buffers[CurrentBuffer];
@@ -140,6 +153,87 @@ void ProfilerGPU::BeginFrame()
     {
         Buffers[i].TryResolve();
     }
+
+    UpdatePasses();
+}
+
+void ProfilerGPU::UpdatePasses()
+{
+    // Find the latest resolved frame
+    int32 frameIndex = -1;
+    for (int32 i = 0; i < PROFILER_GPU_EVENTS_FRAMES; i++)
+    {
+        if (Buffers[i].HasData() && Buffers[i].FrameIndex > _passesFrame)
+        {
+            _passesFrame = Buffers[i].FrameIndex;
+            frameIndex = i;
+        }
+    }
+    if (frameIndex == -1)
+        return;
+    auto& buffer = Buffers[frameIndex];
+
+    // Accumulate the events of the same name (passes are usually named with the static strings so compare pointers first)
+    for (auto& pass : _passes)
+    {
+        pass.Time = 0.0f;
+        pass.Count = 0;
+        pass.Primitives = 0;
+        pass.PixelShaderInvocations = 0;
+    }
+    for (int32 i = 0; i < buffer.Count(); i++)
+    {
+        const Event& e = *buffer.Get(i);
+        if (e.Depth > PassesMaxDepth)
+            continue;
+        PassStats* pass = nullptr;
+        for (auto& p : _passes)
+        {
+            if (p.Name == e.Name || StringUtils::Compare(p.Name, e.Name) == 0)
+            {
+                pass = &p;
+                break;
+            }
+        }
+        if (!pass)
+        {
+            pass = &_passes.AddOne();
+            pass->Name = e.Name;
+            pass->Time = 0.0f;
+            pass->AverageTime = e.Time;
+            pass->Count = 0;
+            pass->Primitives = 0;
+            pass->PixelShaderInvocations = 0;
+        }
+        pass->Time += e.Time;
+        pass->Count++;
+        pass->Primitives += e.Primitives;
+        pass->PixelShaderInvocations += e.PixelShaderInvocations;
+    }
+
+    // Smooth the timings over frames to reduce the noise
+    for (auto& pass : _passes)
+        pass.AverageTime = Math::Lerp(pass.AverageTime, pass.Time, 0.1f);
+}
+
+bool ProfilerGPU::GetPass(const StringView& name, PassStats& result)
+{
+    for (const auto& pass : _passes)
+    {
+        if (name == pass.Name)
+        {
+            result = pass;
+            return pass.Count != 0;
+        }
+    }
+    Platform::MemoryClear(&result, sizeof(result));
+    return false;
+}
+
+float ProfilerGPU::GetPassTime(const StringView& name)
+{
+    PassStats pass;
+    return GetPass(name, pass) ? pass.AverageTime : 0.0f;
 }
 
 void ProfilerGPU::OnPresent()
@@ -196,6 +290,7 @@ void ProfilerGPU::Dispose()
 {
     _timerQueriesPool.ClearDelete();
     _timerQueriesFree.Clear();
+    _passes.Resize(0);
 }
 
 #endif
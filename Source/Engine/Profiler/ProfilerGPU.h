@@ -4,6 +4,7 @@
 
 #include "Engine/Core/NonCopyable.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/StringView.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "RenderStats.h"
 
@@ -52,6 +53,54 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
         /// The event depth. Value 0 is used for the root events.
         /// </summary>
         API_FIELD() int32 Depth;
+
+        /// <summary>
+        /// The amount of primitives sent to the rasterizer during the event (from the GPU pipeline statistics query). Valid only if EnablePipelineStatistics was enabled and backend supports it.
+        /// </summary>
+        API_FIELD() uint64 Primitives;
+
+        /// <summary>
+        /// The amount of pixel shader invocations during the event (from the GPU pipeline statistics query). Valid only if EnablePipelineStatistics was enabled and backend supports it.
+        /// </summary>
+        API_FIELD() uint64 PixelShaderInvocations;
+    };
+
+    /// <summary>
+    /// Represents the GPU timing of the rendering pass (accumulated from all events with the same name in a frame, such as shadows of all lights). The time of the nested passes is included in the parent pass time.
+    /// </summary>
+    API_STRUCT(NoDefault) struct PassStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(PassStats);
+
+        /// <summary>
+        /// The name of the pass (event name).
+        /// </summary>
+        API_FIELD() const Char* Name;
+
+        /// <summary>
+        /// The pass execution time on a GPU in the last resolved frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float Time;
+
+        /// <summary>
+        /// The pass execution time on a GPU smoothed over the last frames (in milliseconds). Stable value for the dynamic quality scaling.
+        /// </summary>
+        API_FIELD() float AverageTime;
+
+        /// <summary>
+        /// The amount of events of this pass in the last resolved frame (eg. amount of shadow-casting lights).
+        /// </summary>
+        API_FIELD() int32 Count;
+
+        /// <summary>
+        /// The amount of primitives sent to the rasterizer by the pass (valid only if EnablePipelineStatistics was enabled and backend supports it).
+        /// </summary>
+        API_FIELD() uint64 Primitives;
+
+        /// <summary>
+        /// The amount of pixel shader invocations of the pass (valid only if EnablePipelineStatistics was enabled and backend supports it).
+        /// </summary>
+        API_FIELD() uint64 PixelShaderInvocations;
     };
 
     /// <summary>
@@ -84,6 +133,14 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
         /// </summary>
         void TryResolve();
 
+        /// <summary>
+        /// Gets the amount of events in the buffer.
+        /// </summary>
+        int32 Count() const
+        {
+            return _data.Count();
+        }
+
         /// <summary>
         /// Gets the event at the specified index.
         /// </summary>
@@ -118,8 +175,11 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
 
     static Array<GPUTimerQuery*> _timerQueriesPool;
     static Array<GPUTimerQuery*> _timerQueriesFree;
+    static Array<PassStats> _passes;
+    static uint64 _passesFrame;
 
     static GPUTimerQuery* GetTimerQuery();
+    static void UpdatePasses();
 
 public:
     /// <summary>
@@ -127,6 +187,16 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
     /// </summary>
     static bool Enabled;
 
+    /// <summary>
+    /// True if GPU profiling events should collect the pipeline statistics (primitives and pixel shader invocations). Adds the overhead of the additional GPU queries. Supported only on DirectX 11.
+    /// </summary>
+    API_FIELD() static bool EnablePipelineStatistics;
+
+    /// <summary>
+    /// The maximum depth of the GPU profiling events collected into the passes stats (root event is the frame rendering, its children are the render passes, eg. shadows are rendered within the lights pass).
+    /// </summary>
+    API_FIELD() static int32 PassesMaxDepth;
+
     /// <summary>
     /// The current frame buffer to collect events.
     /// </summary>
@@ -174,6 +244,30 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
     /// <returns>True if got the data, otherwise false.</returns>
     static bool GetLastFrameData(float& drawTimeMs, RenderStatsData& statsData);
 
+    /// <summary>
+    /// Gets the GPU timings of the rendering passes (such as GBuffer, Shadow, Lights, Post Processing, Global Surface Atlas or GUI) from the last resolved frame. GPU results come with a few frames delay but values are kept between the frames so they can be queried every frame (eg. by the dynamic resolution or quality scaling).
+    /// </summary>
+    /// <returns>The passes stats.</returns>
+    API_FUNCTION() static const Array<PassStats>& GetPasses()
+    {
+        return _passes;
+    }
+
+    /// <summary>
+    /// Gets the GPU timing of the rendering pass from the last resolved frame.
+    /// </summary>
+    /// <param name="name">The pass (GPU profiling event) name, such as GBuffer, Shadow, Lights, Post Processing, Global Surface Atlas or GUI.</param>
+    /// <param name="result">The pass stats.</param>
+    /// <returns>True if got the data, otherwise false.</returns>
+    API_FUNCTION() static bool GetPass(const StringView& name, API_PARAM(Out) PassStats& result);
+
+    /// <summary>
+    /// Gets the GPU time of the rendering pass smoothed over the last frames (in milliseconds). Returns 0 if pass was not rendered.
+    /// </summary>
+    /// <param name="name">The pass (GPU profiling event) name, such as GBuffer, Shadow, Lights, Post Processing, Global Surface Atlas or GUI.</param>
+    /// <returns>The pass time (in milliseconds).</returns>
+    API_FUNCTION() static float GetPassTime(const StringView& name);
+
     /// <summary>
     /// Releases resources. Calls to the profiling API after Dispose are not valid
     /// </summary>
@@ -204,6 +298,12 @@ struct TIsPODType<ProfilerGPU::Event>
     enum { Value = true };
 };
 
+template<>
+struct TIsPODType<ProfilerGPU::PassStats>
+{
+    enum { Value = true };
+};
+
 // Shortcut macro for profiling rendering on GPU
 #define PROFILE_GPU(name) ScopeProfileBlockGPU ProfileBlockGPU(TEXT(name))
 
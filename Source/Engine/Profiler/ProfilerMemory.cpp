@@ -0,0 +1,176 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerMemory.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Platform/CriticalSection.h"
+
+bool ProfilerMemory::Enabled = false;
+int32 ProfilerMemory::CallstacksSampling = 0;
+
+namespace
+{
+    struct AllocationInfo
+    {
+        uint64 Size;
+        ProfilerMemory::Groups Group;
+    };
+
+    struct GroupCounters
+    {
+        volatile int64 Current;
+        volatile int64 Peak;
+        volatile int64 Count;
+        volatile int64 TotalCount;
+    };
+
+    // Note: tracking data uses the same allocator so reentrancy is prevented via thread-local flag
+    THREADLOCAL ProfilerMemory::Groups CurrentGroup = ProfilerMemory::Groups::Untracked;
+    THREADLOCAL bool IsTracking = false;
+    CriticalSection Locker;
+    Dictionary<void*, AllocationInfo>* Allocations = nullptr;
+    Dictionary<String, ProfilerMemory::CallstackSample>* Callstacks = nullptr;
+    GroupCounters Counters[(int32)ProfilerMemory::Groups::MAX] = {};
+    volatile int64 SamplingCounter = 0;
+
+    bool SortCallstacks(const ProfilerMemory::CallstackSample& a, const ProfilerMemory::CallstackSample& b)
+    {
+        return a.Size > b.Size;
+    }
+}
+
+ProfilerMemory::GroupStats ProfilerMemory::GetGroupStats(Groups group)
+{
+    GroupStats result;
+    GroupCounters& counters = Counters[(int32)group];
+    result.Current = Platform::AtomicRead(&counters.Current);
+    result.Peak = Platform::AtomicRead(&counters.Peak);
+    result.Count = Platform::AtomicRead(&counters.Count);
+    result.TotalCount = Platform::AtomicRead(&counters.TotalCount);
+    return result;
+}
+
+Array<ProfilerMemory::GroupStats> ProfilerMemory::GetGroupsStats()
+{
+    Array<GroupStats> result;
+    result.Resize((int32)Groups::MAX);
+    for (int32 i = 0; i < result.Count(); i++)
+        result[i] = GetGroupStats((Groups)i);
+    return result;
+}
+
+Array<ProfilerMemory::CallstackSample> ProfilerMemory::GetTopCallstacks(int32 count)
+{
+    Array<CallstackSample> result;
+    Locker.Lock();
+    IsTracking = true;
+    if (Callstacks)
+    {
+        result.EnsureCapacity(Callstacks->Count());
+        for (auto& e : *Callstacks)
+            result.Add(e.Value);
+    }
+    IsTracking = false;
+    Locker.Unlock();
+    Sorting::QuickSort(result.Get(), result.Count(), &SortCallstacks);
+    if (result.Count() > count)
+        result.Resize(count);
+    return result;
+}
+
+void ProfilerMemory::Reset()
+{
+    for (auto& e : Counters)
+        Platform::AtomicStore(&e.Peak, Platform::AtomicRead(&e.Current));
+    Locker.Lock();
+    IsTracking = true;
+    if (Callstacks)
+        Callstacks->Clear();
+    IsTracking = false;
+    Locker.Unlock();
+}
+
+ProfilerMemory::Groups ProfilerMemory::BeginGroup(Groups group)
+{
+    const Groups prev = CurrentGroup;
+    CurrentGroup = group;
+    return prev;
+}
+
+void ProfilerMemory::EndGroup(Groups prev)
+{
+    CurrentGroup = prev;
+}
+
+void ProfilerMemory::OnAllocation(void* ptr, uint64 size)
+{
+    if (!Enabled || IsTracking)
+        return;
+    IsTracking = true;
+    const Groups group = CurrentGroup;
+
+    // Update group counters
+    GroupCounters& counters = Counters[(int32)group];
+    const int64 current = Platform::InterlockedAdd(&counters.Current, (int64)size) + (int64)size;
+    int64 peak = Platform::AtomicRead(&counters.Peak);
+    while (current > peak && Platform::InterlockedCompareExchange(&counters.Peak, current, peak) != peak)
+        peak = Platform::AtomicRead(&counters.Peak);
+    Platform::InterlockedIncrement(&counters.Count);
+    Platform::InterlockedIncrement(&counters.TotalCount);
+
+    // Sample callstack
+    String callstack;
+    const int32 sampling = CallstacksSampling;
+    if (sampling > 0 && Platform::InterlockedIncrement(&SamplingCounter) % sampling == 0)
+        callstack = Platform::GetStackTrace(3, 12);
+
+    // Register allocation (to know it's size and group on free)
+    Locker.Lock();
+    if (!Allocations)
+        Allocations = New<Dictionary<void*, AllocationInfo>>(4096);
+    Allocations->Add(ptr, { size, group });
+    if (callstack.HasChars())
+    {
+        if (!Callstacks)
+            Callstacks = New<Dictionary<String, CallstackSample>>();
+        CallstackSample* sample = Callstacks->TryGet(callstack);
+        if (!sample)
+        {
+            sample = &(*Callstacks)[callstack];
+            sample->Callstack = callstack;
+            sample->Group = group;
+            sample->Size = 0;
+            sample->Count = 0;
+        }
+        sample->Size += (int64)size;
+        sample->Count++;
+    }
+    Locker.Unlock();
+
+    IsTracking = false;
+}
+
+void ProfilerMemory::OnFree(void* ptr)
+{
+    if (!Allocations || IsTracking)
+        return;
+    IsTracking = true;
+    Locker.Lock();
+    AllocationInfo info;
+    const bool found = Allocations->TryGet(ptr, info);
+    if (found)
+        Allocations->Remove(ptr);
+    Locker.Unlock();
+    if (found)
+    {
+        GroupCounters& counters = Counters[(int32)info.Group];
+        Platform::InterlockedAdd(&counters.Current, -(int64)info.Size);
+        Platform::InterlockedDecrement(&counters.Count);
+    }
+    IsTracking = false;
+}
+
+#endif
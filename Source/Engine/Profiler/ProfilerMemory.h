@@ -0,0 +1,239 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+#if COMPILE_WITH_PROFILER
+
+/// <summary>
+/// Provides memory allocations tracking per engine subsystem (tagged allocation scopes).
+/// </summary>
+API_CLASS(Static) class FLAXENGINE_API ProfilerMemory
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ProfilerMemory);
+public:
+    /// <summary>
+    /// The memory allocations groups (tags) used to attribute allocations to the engine subsystems.
+    /// </summary>
+    API_ENUM() enum class Groups : uint8
+    {
+        /// <summary>
+        /// Allocations made outside any tagged scope.
+        /// </summary>
+        Untracked,
+
+        /// <summary>
+        /// Core engine data (collections, strings, etc.).
+        /// </summary>
+        Core,
+
+        /// <summary>
+        /// Content assets and loading.
+        /// </summary>
+        Content,
+
+        /// <summary>
+        /// Rendering and graphics resources.
+        /// </summary>
+        Rendering,
+
+        /// <summary>
+        /// Physics simulation and collision data.
+        /// </summary>
+        Physics,
+
+        /// <summary>
+        /// Scripting runtime and objects.
+        /// </summary>
+        Scripting,
+
+        /// <summary>
+        /// Networking and replication.
+        /// </summary>
+        Networking,
+
+        /// <summary>
+        /// Audio playback and data.
+        /// </summary>
+        Audio,
+
+        /// <summary>
+        /// Animations and skeletal meshes update.
+        /// </summary>
+        Animations,
+
+        /// <summary>
+        /// Scene objects and level.
+        /// </summary>
+        Level,
+
+        /// <summary>
+        /// Particles simulation.
+        /// </summary>
+        Particles,
+
+        /// <summary>
+        /// Navigation meshes and path-finding.
+        /// </summary>
+        Navigation,
+
+        /// <summary>
+        /// Terrain and foliage.
+        /// </summary>
+        Terrain,
+
+        /// <summary>
+        /// User interface.
+        /// </summary>
+        UI,
+
+        /// <summary>
+        /// Profiler data.
+        /// </summary>
+        Profiler,
+
+        API_ENUM(Attributes="HideInEditor")
+        MAX
+    };
+
+    /// <summary>
+    /// The memory allocations stats of a single group.
+    /// </summary>
+    API_STRUCT(NoDefault) struct GroupStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(GroupStats);
+
+        /// <summary>
+        /// The currently allocated memory (in bytes).
+        /// </summary>
+        API_FIELD() int64 Current;
+
+        /// <summary>
+        /// The peak of the allocated memory (in bytes).
+        /// </summary>
+        API_FIELD() int64 Peak;
+
+        /// <summary>
+        /// The amount of the current (not freed) allocations.
+        /// </summary>
+        API_FIELD() int64 Count;
+
+        /// <summary>
+        /// The total amount of allocations made (since tracking start).
+        /// </summary>
+        API_FIELD() int64 TotalCount;
+    };
+
+    /// <summary>
+    /// The sampled allocation callstack data.
+    /// </summary>
+    API_STRUCT(NoDefault) struct CallstackSample
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(CallstackSample);
+
+        /// <summary>
+        /// The callstack of the allocation (printed stack trace).
+        /// </summary>
+        API_FIELD() String Callstack;
+
+        /// <summary>
+        /// The allocation group.
+        /// </summary>
+        API_FIELD() Groups Group;
+
+        /// <summary>
+        /// The total amount of sampled allocated memory from this callstack (in bytes).
+        /// </summary>
+        API_FIELD() int64 Size;
+
+        /// <summary>
+        /// The amount of sampled allocations from this callstack.
+        /// </summary>
+        API_FIELD() int32 Count;
+    };
+
+    /// <summary>
+    /// Helper scope that tags all allocations made within it (on the current thread) with a given group.
+    /// </summary>
+    struct GroupScope
+    {
+        Groups Prev;
+
+        FORCE_INLINE GroupScope(Groups group)
+        {
+            Prev = BeginGroup(group);
+        }
+
+        FORCE_INLINE ~GroupScope()
+        {
+            EndGroup(Prev);
+        }
+    };
+
+public:
+    /// <summary>
+    /// Enables memory allocations tracking (per-allocation bookkeeping has additional performance cost). Can be enabled via command line using `-trackmemory`.
+    /// </summary>
+    API_FIELD() static bool Enabled;
+
+    /// <summary>
+    /// The interval (in allocations count) between the callstack samples of the allocations. Use 0 to disable callstacks sampling.
+    /// </summary>
+    API_FIELD() static int32 CallstacksSampling;
+
+public:
+    /// <summary>
+    /// Gets the memory allocations stats for a given group.
+    /// </summary>
+    /// <param name="group">The allocations group.</param>
+    /// <returns>The stats.</returns>
+    API_FUNCTION() static GroupStats GetGroupStats(Groups group);
+
+    /// <summary>
+    /// Gets the memory allocations stats for all groups (indexed by group).
+    /// </summary>
+    /// <returns>The stats.</returns>
+    API_FUNCTION() static Array<GroupStats> GetGroupsStats();
+
+    /// <summary>
+    /// Gets the top allocators callstacks (sorted by the sampled allocations size, see CallstacksSampling).
+    /// </summary>
+    /// <param name="count">The maximum amount of callstacks to return.</param>
+    /// <returns>The sampled callstacks.</returns>
+    API_FUNCTION() static Array<CallstackSample> GetTopCallstacks(int32 count = 10);
+
+    /// <summary>
+    /// Resets the peak values and the sampled callstacks.
+    /// </summary>
+    API_FUNCTION() static void Reset();
+
+    /// <summary>
+    /// Begins the allocations group on the current thread (use PROFILE_MEM macro for scoped version).
+    /// </summary>
+    /// <param name="group">The allocations group.</param>
+    /// <returns>The previous allocations group (to be restored with EndGroup).</returns>
+    static Groups BeginGroup(Groups group);
+
+    /// <summary>
+    /// Ends the allocations group on the current thread.
+    /// </summary>
+    /// <param name="prev">The previous allocations group (returned by BeginGroup).</param>
+    static void EndGroup(Groups prev);
+
+    static void OnAllocation(void* ptr, uint64 size);
+    static void OnFree(void* ptr);
+};
+
+// Shortcut macro for tagging memory allocations within the scope with a given group (eg. PROFILE_MEM(Physics))
+#define PROFILE_MEM(group) ProfilerMemory::GroupScope ProfileMemScope(ProfilerMemory::Groups::group)
+
+#else
+
+// Empty macros for disabled profiler
+#define PROFILE_MEM(group)
+
+#endif
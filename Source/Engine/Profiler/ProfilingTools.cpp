@@ -6,11 +6,164 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/ThreadPool.h"
+#include "Engine/Threading/WorkerThreadCounters.h"
 
 ProfilingTools::MainStats ProfilingTools::Stats;
 Array<ProfilingTools::ThreadStats, InlinedAllocation<64>> ProfilingTools::EventsCPU;
 Array<ProfilerGPU::Event> ProfilingTools::EventsGPU;
+Array<ProfilingTools::WorkerStats, InlinedAllocation<64>> ProfilingTools::Workers;
+
+namespace
+{
+    WorkerThreadCounters WorkersLastCounters[PLATFORM_THREADS_LIMIT * 2];
+
+    // Headless capture state (events are written into Chrome Trace Event Format json)
+    struct CaptureData
+    {
+        String Path;
+        int32 FramesLeft = 0;
+        int32 ThreadsNamed = 0;
+        uint64 FrameGPU = 0;
+        rapidjson_flax::StringBuffer Buffer;
+        CompactJsonWriter* Writer = nullptr;
+    };
+
+    CaptureData* Capture = nullptr;
+    constexpr int32 CaptureProcessId = 1;
+    constexpr int32 CaptureThreadIdGPU = 10000;
+
+    void CaptureThreadName(JsonWriter& writer, int32 threadId, const StringView& name)
+    {
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String("thread_name");
+        writer.JKEY("ph");
+        writer.String("M");
+        writer.JKEY("pid");
+        writer.Int(CaptureProcessId);
+        writer.JKEY("tid");
+        writer.Int(threadId);
+        writer.JKEY("args");
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String(name);
+        writer.EndObject();
+        writer.EndObject();
+    }
+
+    void CaptureEvent(JsonWriter& writer, int32 threadId, const Char* name, double startMs, double durationMs)
+    {
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String(name);
+        writer.JKEY("ph");
+        writer.String("X");
+        writer.JKEY("pid");
+        writer.Int(CaptureProcessId);
+        writer.JKEY("tid");
+        writer.Int(threadId);
+        writer.JKEY("ts");
+        writer.Double(startMs * 1000.0);
+        writer.JKEY("dur");
+        writer.Double(durationMs * 1000.0);
+        writer.EndObject();
+    }
+
+    void CaptureCounter(JsonWriter& writer, const char* name, double timeMs, const char* key, double value)
+    {
+        writer.StartObject();
+        writer.JKEY("name");
+        writer.String(name);
+        writer.JKEY("ph");
+        writer.String("C");
+        writer.JKEY("pid");
+        writer.Int(CaptureProcessId);
+        writer.JKEY("ts");
+        writer.Double(timeMs * 1000.0);
+        writer.JKEY("args");
+        writer.StartObject();
+        writer.Key(key, StringUtils::Length(key));
+        writer.Double(value);
+        writer.EndObject();
+        writer.EndObject();
+    }
+
+    void CaptureFrame(bool withGPU)
+    {
+        PROFILE_CPU();
+        JsonWriter& writer = *Capture->Writer;
+        const double time = ProfilerCPU::GetTime();
+
+        // CPU events of all threads
+        for (int32 threadIndex = 0; threadIndex < ProfilingTools::EventsCPU.Count(); threadIndex++)
+        {
+            const auto& thread = ProfilingTools::EventsCPU[threadIndex];
+            if (threadIndex >= Capture->ThreadsNamed)
+            {
+                CaptureThreadName(writer, threadIndex, thread.Name);
+                Capture->ThreadsNamed = threadIndex + 1;
+            }
+            for (const auto& e : thread.Events)
+                CaptureEvent(writer, threadIndex, e.Name, e.Start, e.End - e.Start);
+        }
+
+        // GPU events (only durations are measured so events are placed one after another, starting at the frame capture time)
+        double depthTime[32];
+        depthTime[0] = time;
+        for (const auto& e : ProfilingTools::EventsGPU)
+        {
+            if (!withGPU)
+                break;
+            if (e.Depth < 0 || e.Depth >= ARRAY_COUNT(depthTime) - 1)
+                continue;
+            const double start = depthTime[e.Depth];
+            CaptureEvent(writer, CaptureThreadIdGPU, e.Name, start, e.Time);
+            depthTime[e.Depth] = start + e.Time;
+            depthTime[e.Depth + 1] = start;
+        }
+
+        // Memory counters
+        const auto& stats = ProfilingTools::Stats;
+        CaptureCounter(writer, "Process Memory", time, "MB", (double)stats.ProcessMemory.UsedPhysicalMemory / (1024.0 * 1024.0));
+        CaptureCounter(writer, "GPU Memory", time, "MB", (double)stats.MemoryGPU.Used / (1024.0 * 1024.0));
+        CaptureCounter(writer, "FPS", time, "FPS", stats.FPS);
+
+        if (Capture->FramesLeft > 0 && --Capture->FramesLeft == 0)
+            ProfilingTools::StopCapture();
+    }
+
+    void UpdateWorkerStats(int32 index, const Char* name, int32 threadIndex, const WorkerThreadCounters& counters, double cyclesToMs)
+    {
+        if (ProfilingTools::Workers.Count() <= index)
+            ProfilingTools::Workers.Resize(index + 1);
+        auto& stats = ProfilingTools::Workers[index];
+        auto& last = WorkersLastCounters[index];
+        if (stats.Name.IsEmpty())
+            stats.Name = String::Format(TEXT("{0} {1}"), name, threadIndex);
+        const int64 executed = Platform::AtomicRead((int64 volatile*)&counters.Executed);
+        const int64 steals = Platform::AtomicRead((int64 volatile*)&counters.Steals);
+        const int64 busy = Platform::AtomicRead((int64 volatile*)&counters.BusyCycles);
+        const int64 idle = Platform::AtomicRead((int64 volatile*)&counters.IdleCycles);
+        stats.Executed = (int32)(executed - last.Executed);
+        stats.Steals = (int32)(steals - last.Steals);
+        stats.BusyTimeMs = (float)((double)(busy - last.BusyCycles) * cyclesToMs);
+        stats.IdleTimeMs = (float)((double)(idle - last.IdleCycles) * cyclesToMs);
+        stats.QueueDepthMax = (int32)Platform::AtomicRead((int64 volatile*)&counters.QueueDepthMax);
+        Platform::AtomicStore((int64 volatile*)&counters.QueueDepthMax, 0);
+        last.Executed = executed;
+        last.Steals = steals;
+        last.BusyCycles = busy;
+        last.IdleCycles = idle;
+    }
+}
 
 class ProfilingToolsService : public EngineService
 {
@@ -21,12 +174,25 @@ class ProfilingToolsService : public EngineService
         Platform::MemoryClear(&ProfilingTools::Stats, sizeof(ProfilingTools::MainStats));
     }
 
+    bool Init() override;
     void Update() override;
     void Dispose() override;
 };
 
 ProfilingToolsService ProfilingToolsServiceInstance;
 
+bool ProfilingToolsService::Init()
+{
+    if (CommandLine::Options.ProfileCapture.HasValue())
+    {
+        int32 frames = 300;
+        if (CommandLine::Options.ProfileCaptureFrames.HasValue())
+            StringUtils::Parse(CommandLine::Options.ProfileCaptureFrames.GetValue().Get(), &frames);
+        ProfilingTools::StartCapture(CommandLine::Options.ProfileCapture.GetValue(), frames);
+    }
+    return false;
+}
+
 void ProfilingToolsService::Update()
 {
     ZoneScoped;
@@ -48,6 +214,16 @@ void ProfilingToolsService::Update()
         ProfilerGPU::GetLastFrameData(stats.DrawGPUTimeMs, stats.DrawStats);
     }
 
+    // Capture workers stats
+    {
+        const double cyclesToMs = 1000.0 / (double)Platform::GetClockFrequency();
+        int32 index = 0;
+        for (int32 i = 0; i < JobSystem::GetThreadsCount(); i++)
+            UpdateWorkerStats(index++, TEXT("Job System"), i, JobSystem::GetThreadCounters(i), cyclesToMs);
+        for (int32 i = 0; i < ThreadPool::GetThreadsCount(); i++)
+            UpdateWorkerStats(index++, TEXT("Thread Pool"), i, ThreadPool::GetThreadCounters(i), cyclesToMs);
+    }
+
     // Extract CPU profiler events
     Platform::MemoryBarrier();
     const auto& threads = ProfilerCPU::Threads;
@@ -120,6 +296,14 @@ void ProfilingToolsService::Update()
         frame.Extract(ProfilingTools::EventsGPU);
     }
 
+    // Record the frame to the headless capture (GPU data only once per resolved frame)
+    if (Capture)
+    {
+        const bool withGPU = maxFrame != Capture->FrameGPU;
+        Capture->FrameGPU = maxFrame;
+        CaptureFrame(withGPU);
+    }
+
 #if 0
     // Print CPU events to the log
     {
@@ -170,9 +354,55 @@ void ProfilingToolsService::Update()
 
 void ProfilingToolsService::Dispose()
 {
+    if (Capture)
+        ProfilingTools::StopCapture();
     ProfilingTools::EventsCPU.Clear();
     ProfilingTools::EventsCPU.SetCapacity(0);
     ProfilingTools::EventsGPU.SetCapacity(0);
+    ProfilingTools::Workers.Clear();
+    ProfilingTools::Workers.SetCapacity(0);
+}
+
+bool ProfilingTools::StartCapture(const StringView& path, int32 frames)
+{
+    if (Capture || path.IsEmpty())
+        return true;
+    LOG(Info, "Starting profiler capture to {0}", path);
+    Capture = New<CaptureData>();
+    Capture->Path = path;
+    Capture->FramesLeft = Math::Max(frames, 0);
+    Capture->Writer = New<CompactJsonWriter>(Capture->Buffer);
+    JsonWriter& writer = *Capture->Writer;
+    writer.StartObject();
+    writer.JKEY("displayTimeUnit");
+    writer.String("ms");
+    writer.JKEY("traceEvents");
+    writer.StartArray();
+    CaptureThreadName(writer, CaptureThreadIdGPU, TEXT("GPU"));
+    return false;
+}
+
+bool ProfilingTools::StopCapture()
+{
+    if (!Capture)
+        return true;
+    JsonWriter& writer = *Capture->Writer;
+    writer.EndArray();
+    writer.EndObject();
+    const bool failed = File::WriteAllBytes(Capture->Path, (const byte*)Capture->Buffer.GetString(), (int32)Capture->Buffer.GetSize());
+    if (failed)
+        LOG(Error, "Failed to save profiler capture to {0}", Capture->Path);
+    else
+        LOG(Info, "Saved profiler capture to {0}", Capture->Path);
+    Delete(Capture->Writer);
+    Delete(Capture);
+    Capture = nullptr;
+    return failed;
+}
+
+bool ProfilingTools::IsCapturing()
+{
+    return Capture != nullptr;
 }
 
 #endif
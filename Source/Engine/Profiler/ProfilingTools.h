@@ -105,6 +105,44 @@ API_CLASS(Static) class FLAXENGINE_API ProfilingTools
         API_FIELD() Array<ProfilerCPU::Event> Events;
     };
 
+    /// <summary>
+    /// The worker thread stats (Job System or Thread Pool) from the last frame.
+    /// </summary>
+    API_STRUCT(NoDefault) struct WorkerStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(WorkerStats);
+
+        /// <summary>
+        /// The thread name.
+        /// </summary>
+        API_FIELD() String Name;
+
+        /// <summary>
+        /// The amount of jobs/tasks executed during the last frame.
+        /// </summary>
+        API_FIELD() int32 Executed;
+
+        /// <summary>
+        /// The amount of jobs stolen from the other workers during the last frame.
+        /// </summary>
+        API_FIELD() int32 Steals;
+
+        /// <summary>
+        /// The time spent on work during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float BusyTimeMs;
+
+        /// <summary>
+        /// The time spent on waiting for work during the last frame (in milliseconds).
+        /// </summary>
+        API_FIELD() float IdleTimeMs;
+
+        /// <summary>
+        /// The maximum amount of pending jobs/tasks in the queue during the last frame (high-watermark).
+        /// </summary>
+        API_FIELD() int32 QueueDepthMax;
+    };
+
 public:
     /// <summary>
     /// The current collected main stats by the profiler from the local session. Updated every frame.
@@ -120,6 +158,31 @@ API_CLASS(Static) class FLAXENGINE_API ProfilingTools
     /// The GPU rendering profiler events.
     /// </summary>
     API_FIELD(ReadOnly) static Array<ProfilerGPU::Event> EventsGPU;
+
+    /// <summary>
+    /// The Job System and Thread Pool workers stats. Updated every frame.
+    /// </summary>
+    API_FIELD(ReadOnly) static Array<WorkerStats, InlinedAllocation<64>> Workers;
+
+public:
+    /// <summary>
+    /// Starts the headless profiling capture that records CPU events, GPU events and memory counters of the next frames into the Chrome Trace Event Format file (can be opened in Perfetto UI or chrome://tracing). Doesn't require the editor connection (eg. for dedicated servers or automated performance runs).
+    /// </summary>
+    /// <param name="path">The output file path (.json).</param>
+    /// <param name="frames">The amount of frames to record (capture gets saved after that). Use 0 to record until StopCapture is called.</param>
+    /// <returns>True if failed to start the capture (eg. other capture is in progress), otherwise false.</returns>
+    API_FUNCTION() static bool StartCapture(const StringView& path, int32 frames = 300);
+
+    /// <summary>
+    /// Stops the profiling capture and saves the recorded data to the file.
+    /// </summary>
+    /// <returns>True if failed to save the capture (or no capture is in progress), otherwise false.</returns>
+    API_FUNCTION() static bool StopCapture();
+
+    /// <summary>
+    /// Returns true if the profiling capture is in progress.
+    /// </summary>
+    API_PROPERTY() static bool IsCapturing();
 };
 
 #endif
@@ -4,13 +4,16 @@
 #include "FontAsset.h"
 #include "FontManager.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/HashFunctions.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Utilities/Crc.h"
 #include "IncludeFreeType.h"
 
 Font::Font(FontAsset* parentAsset, float size)
     : ManagedScriptingObject(SpawnParams(Guid::New(), Font::TypeInitializer))
     , _asset(parentAsset)
     , _size(size)
+    , _glyphScale(1.0f)
     , _characters(512)
 {
     _asset->_fonts.Add(this);
@@ -24,6 +27,8 @@ Font::Font(FontAsset* parentAsset, float size)
     _ascender = Convert26Dot6ToRoundedPixel<int16>(face->size->metrics.ascender);
     _descender = Convert26Dot6ToRoundedPixel<int16>(face->size->metrics.descender);
     _lineGap = _height - _ascender + _descender;
+    if (IsSDF())
+        _glyphScale = _size / FONT_SDF_SIZE;
 }
 
 Font::~Font()
@@ -32,11 +37,33 @@ Font::~Font()
         _asset->_fonts.Remove(this);
 }
 
+bool Font::IsSDF() const
+{
+    return _asset && EnumHasAnyFlags(_asset->GetOptions().Flags, FontFlags::SDF);
+}
+
 void Font::GetCharacter(Char c, FontCharacterEntry& result)
 {
     // Try to get the character or cache it if cannot be found
     if (!_characters.TryGet(c, result))
     {
+        // Signed distance field characters are rasterized once by the shared font and scaled to match this font size
+        Font* sdfFont = IsSDF() ? _asset->GetSDFFont() : nullptr;
+        if (sdfFont && sdfFont != this)
+        {
+            FontCharacterEntry sdfEntry;
+            sdfFont->GetCharacter(c, sdfEntry);
+            result = sdfEntry;
+            result.OffsetX = (int16)Math::RoundToInt(sdfEntry.OffsetX * _glyphScale);
+            result.OffsetY = (int16)Math::RoundToInt(sdfEntry.OffsetY * _glyphScale);
+            result.AdvanceX = (int16)Math::RoundToInt(sdfEntry.AdvanceX * _glyphScale);
+            result.BearingY = (int16)Math::RoundToInt(sdfEntry.BearingY * _glyphScale);
+            result.Height = (int16)Math::RoundToInt(sdfEntry.Height * _glyphScale);
+            ScopeLock lock(_asset->Locker);
+            _characters[c] = result;
+            return;
+        }
+
         // This thread race condition may happen in editor but in game we usually do all stuff with fonts on main thread (chars caching)
         ScopeLock lock(_asset->Locker);
 
@@ -95,14 +122,89 @@ void Font::Invalidate()
 {
     ScopeLock lock(_asset->Locker);
 
+    // Signed distance field characters atlas slots are owned by the shared font
+    const bool ownsAtlasSlots = !IsSDF() || _asset->_sdfFont == this;
     for (auto i = _characters.Begin(); i.IsNotEnd(); ++i)
     {
-        FontManager::Invalidate(i->Value);
+        if (ownsAtlasSlots)
+            FontManager::Invalidate(i->Value);
     }
     _characters.Clear();
+    _layoutCache.Clear();
+    _layoutCacheMap.Clear();
+    _glyphScale = IsSDF() ? _size / FONT_SDF_SIZE : 1.0f;
 }
 
 void Font::ProcessText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
+{
+    // Skip caching for very long texts (eg. code editor)
+    if (text.Length() > FONT_LAYOUT_CACHE_MAX_TEXT)
+    {
+        ProcessTextLayout(text, outputLines, layout);
+        return;
+    }
+
+    // Try to reuse the cached layout
+    const float fontScale = FontManager::FontScale;
+    uint32 hash = Crc::MemCrc32(text.Get(), text.Length() * sizeof(Char));
+    hash = Crc::MemCrc32(&layout.Bounds, sizeof(layout.Bounds), hash);
+    CombineHash(hash, (uint32)layout.HorizontalAlignment);
+    CombineHash(hash, (uint32)layout.VerticalAlignment);
+    CombineHash(hash, (uint32)layout.TextWrapping);
+    CombineHash(hash, GetHash(layout.Scale));
+    CombineHash(hash, GetHash(layout.BaseLinesGapScale));
+    CombineHash(hash, GetHash(fontScale));
+    {
+        ScopeLock lock(_asset->Locker);
+        int32 index;
+        if (_layoutCacheMap.TryGet(hash, index))
+        {
+            LayoutCacheEntry& e = _layoutCache[index];
+            if (e.FontScale == fontScale && e.Layout == layout && StringView(e.Text) == text)
+            {
+                e.LastUsed = ++_layoutCacheCounter;
+                outputLines.Add(e.Lines);
+                return;
+            }
+        }
+    }
+
+    // Process text
+    const int32 start = outputLines.Count();
+    ProcessTextLayout(text, outputLines, layout);
+
+    // Cache the layout (replace the entry with the same hash or the least recently used one)
+    ScopeLock lock(_asset->Locker);
+    int32 index;
+    if (!_layoutCacheMap.TryGet(hash, index))
+    {
+        if (_layoutCache.Count() < FONT_LAYOUT_CACHE_SIZE)
+        {
+            index = _layoutCache.Count();
+            _layoutCache.AddDefault();
+        }
+        else
+        {
+            index = 0;
+            for (int32 i = 1; i < _layoutCache.Count(); i++)
+            {
+                if (_layoutCache[i].LastUsed < _layoutCache[index].LastUsed)
+                    index = i;
+            }
+            _layoutCacheMap.Remove(_layoutCache[index].Hash);
+        }
+        _layoutCacheMap.Add(hash, index);
+    }
+    LayoutCacheEntry& e = _layoutCache[index];
+    e.Hash = hash;
+    e.LastUsed = ++_layoutCacheCounter;
+    e.FontScale = fontScale;
+    e.Text = text;
+    e.Layout = layout;
+    e.Lines.Set(outputLines.Get() + start, outputLines.Count() - start);
+}
+
+void Font::ProcessTextLayout(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
 {
     float cursorX = 0;
     int32 kerning;
@@ -15,6 +15,18 @@ struct FontTextureAtlasSlot;
 // The default DPI that engine is using
 #define DefaultDPI 96
 
+// The size of the signed distance field characters shared by all font sizes (see FontFlags::SDF)
+#define FONT_SDF_SIZE 32
+
+// The distance range (in pixels of FONT_SDF_SIZE) encoded around the signed distance field characters
+#define FONT_SDF_SPREAD 4
+
+// The maximum amount of text layouts cached per font (least recently used layouts are evicted)
+#define FONT_LAYOUT_CACHE_SIZE 256
+
+// The maximum length of the text to cache its layout (longer texts are processed every time)
+#define FONT_LAYOUT_CACHE_MAX_TEXT 1024
+
 /// <summary>
 /// The text range.
 /// </summary>
@@ -234,9 +246,24 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Font);
     int32 _descender;
     int32 _lineGap;
     bool _hasKerning;
+    float _glyphScale;
     Dictionary<Char, FontCharacterEntry> _characters;
     mutable Dictionary<uint32, int32> _kerningTable;
 
+    struct LayoutCacheEntry
+    {
+        uint32 Hash;
+        uint64 LastUsed;
+        float FontScale;
+        String Text;
+        TextLayoutOptions Layout;
+        Array<FontLineCache> Lines;
+    };
+
+    uint64 _layoutCacheCounter = 0;
+    Array<LayoutCacheEntry> _layoutCache;
+    Dictionary<uint32, int32> _layoutCacheMap;
+
 public:
 
     /// <summary>
@@ -301,6 +328,19 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Font);
         return _lineGap;
     }
 
+    /// <summary>
+    /// Gets the scale of the characters glyphs stored in the font atlas to match the font size. It's 1 unless font uses signed distance field characters shared by all sizes.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE float GetGlyphScale() const
+    {
+        return _glyphScale;
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether font characters are stored as signed distance field (see <see cref="FontFlags.SDF"/>).
+    /// </summary>
+    API_PROPERTY() bool IsSDF() const;
+
 public:
 
     /// <summary>
@@ -332,7 +372,7 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Font);
 public:
 
     /// <summary>
-    /// Processes text to get cached lines for rendering.
+    /// Processes text to get cached lines for rendering. Results are cached so processing the same text again with the same layout is fast.
     /// </summary>
     /// <param name="text">The input text.</param>
     /// <param name="layout">The layout properties.</param>
@@ -523,6 +563,9 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Font);
     /// </summary>
     void FlushFaceSize() const;
 
+private:
+    void ProcessTextLayout(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout);
+
 public:
 
     // [Object]
@@ -47,6 +47,13 @@ Asset::LoadResult FontAsset::load()
 void FontAsset::unload(bool isReloading)
 {
     // Ensure to cleanup child font objects
+    if (_sdfFont)
+    {
+        _fonts.Remove(_sdfFont);
+        _sdfFont->_asset = nullptr;
+        _sdfFont->DeleteObject();
+        _sdfFont = nullptr;
+    }
     if (_fonts.HasItems())
     {
         LOG(Warning, "Font asset {0} is unloading but has {1} remaining font objects created", ToString(), _fonts.Count());
@@ -106,13 +113,21 @@ Font* FontAsset::CreateFont(float size)
     // Check if font with that size has already been created
     for (auto font : _fonts)
     {
-        if (font->GetAsset() == this && font->GetSize() == size)
+        if (font->GetAsset() == this && font->GetSize() == size && font != _sdfFont)
             return font;
     }
 
     return New<Font>(this, size);
 }
 
+Font* FontAsset::GetSDFFont()
+{
+    ScopeLock lock(Locker);
+    if (_sdfFont == nullptr && _face)
+        _sdfFont = New<Font>(this, FONT_SDF_SIZE);
+    return _sdfFont;
+}
+
 FontAsset* FontAsset::GetBold()
 {
     ScopeLock lock(Locker);
@@ -64,6 +64,11 @@ API_ENUM(Attributes="Flags") enum class FontFlags : byte
     /// Enables slant effect, emulating italic style.
     /// </summary>
     Italic = 4,
+
+    /// <summary>
+    /// Enables signed distance field characters. Glyphs are rasterized once at a fixed size and shared by all font sizes (sharp text when scaled, less atlas memory for many sizes).
+    /// </summary>
+    SDF = 8,
 };
 
 DECLARE_ENUM_OPERATORS(FontFlags);
@@ -100,6 +105,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API FontAsset : public BinaryAsset
     Array<Font*, InlinedAllocation<32>> _fonts;
     AssetReference<FontAsset> _virtualBold;
     AssetReference<FontAsset> _virtualItalic;
+    Font* _sdfFont = nullptr;
 
 public:
     /// <summary>
@@ -141,6 +147,12 @@ API_CLASS(NoSpawn) class FLAXENGINE_API FontAsset : public BinaryAsset
     /// <returns>The created font object.</returns>
     API_FUNCTION() Font* CreateFont(float size);
 
+    /// <summary>
+    /// Gets the internal font object used to rasterize signed distance field characters shared by all font sizes (when using <see cref="FontFlags.SDF"/>).
+    /// </summary>
+    /// <returns>The font object or null if failed.</returns>
+    Font* GetSDFFont();
+
     /// <summary>
     /// Gets the font with bold style. Returns itself or creates a new virtual font asset using this font but with bold option enabled.
     /// </summary>
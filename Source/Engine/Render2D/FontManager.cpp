@@ -20,6 +20,44 @@ namespace FontManagerImpl
     CriticalSection Locker;
     Array<AssetReference<FontTextureAtlas>> Atlases;
     Array<byte> GlyphImageData;
+    Array<byte> GlyphSDFData;
+
+    // Converts the glyph coverage bitmap into the signed distance field (adds FONT_SDF_SPREAD pixels border around the glyph)
+    void GenerateSDF(const Array<byte>& src, int32 width, int32 height, Array<byte>& dst)
+    {
+        const int32 spread = FONT_SDF_SPREAD;
+        const int32 dstWidth = width + spread * 2;
+        const int32 dstHeight = height + spread * 2;
+        dst.Resize(dstWidth * dstHeight, false);
+        const auto isInside = [&src, width, height](int32 x, int32 y)
+        {
+            return x >= 0 && y >= 0 && x < width && y < height && src[y * width + x] >= 128;
+        };
+        for (int32 y = 0; y < dstHeight; y++)
+        {
+            for (int32 x = 0; x < dstWidth; x++)
+            {
+                // Find the closest pixel with the opposite state within the spread range
+                const int32 srcX = x - spread, srcY = y - spread;
+                const bool inside = isInside(srcX, srcY);
+                int32 minDistanceSqr = (spread + 1) * (spread + 1);
+                for (int32 offsetY = -spread; offsetY <= spread; offsetY++)
+                {
+                    for (int32 offsetX = -spread; offsetX <= spread; offsetX++)
+                    {
+                        const int32 distanceSqr = offsetX * offsetX + offsetY * offsetY;
+                        if (distanceSqr < minDistanceSqr && isInside(srcX + offsetX, srcY + offsetY) != inside)
+                            minDistanceSqr = distanceSqr;
+                    }
+                }
+
+                // Encode distance to the glyph edge (0.5 is the edge, inside is above)
+                const float distance = Math::Sqrt((float)minDistanceSqr) - 0.5f;
+                const float value = 0.5f + (inside ? distance : -distance) / (2.0f * spread);
+                dst[y * dstWidth + x] = (byte)Math::Clamp(Math::RoundToInt(value * 255.0f), 0, 255);
+            }
+        }
+    }
 }
 
 using namespace FontManagerImpl;
@@ -125,7 +163,8 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
 
     // Set load flags
     uint32 glyphFlags = FT_LOAD_NO_BITMAP;
-    const bool useAA = EnumHasAnyFlags(options.Flags, FontFlags::AntiAliasing);
+    const bool useSDF = EnumHasAnyFlags(options.Flags, FontFlags::SDF);
+    const bool useAA = EnumHasAnyFlags(options.Flags, FontFlags::AntiAliasing) || useSDF;
     if (useAA)
     {
         switch (options.Hinting)
@@ -200,8 +239,8 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     entry.Height = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.height);
 
     // Allocate memory
-    const int32 glyphWidth = bitmap->width;
-    const int32 glyphHeight = bitmap->rows;
+    int32 glyphWidth = bitmap->width;
+    int32 glyphHeight = bitmap->rows;
     GlyphImageData.Clear();
     GlyphImageData.Resize(glyphWidth * glyphHeight);
 
@@ -240,6 +279,17 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
         bitmap = nullptr;
     }
 
+    // Convert glyph into the signed distance field
+    if (useSDF)
+    {
+        GenerateSDF(GlyphImageData, glyphWidth, glyphHeight, GlyphSDFData);
+        GlyphImageData.Swap(GlyphSDFData);
+        glyphWidth += FONT_SDF_SPREAD * 2;
+        glyphHeight += FONT_SDF_SPREAD * 2;
+        entry.OffsetX -= FONT_SDF_SPREAD;
+        entry.OffsetY += FONT_SDF_SPREAD;
+    }
+
     // Find atlas for the character texture
     int32 atlasIndex = 0;
     const FontTextureAtlasSlot* slot = nullptr;
@@ -4,6 +4,7 @@
 #include "Font.h"
 #include "FontManager.h"
 #include "FontTextureAtlas.h"
+#include "Render2DCache.h"
 #include "RotatedRectangle.h"
 #include "SpriteAtlas.h"
 #include "Engine/Core/Math/Matrix3x3.h"
@@ -46,6 +47,12 @@
 
 #define RENDER2D_BLUR_MAX_SAMPLES 64
 
+// The maximum amount of textures bound at once to batch the textured draw calls (must match the shader)
+#define RENDER2D_TEXTURE_SLOTS 8
+
+// The vertex features mask bit used to mark signed distance field font characters (must match the shader, not used by Render2D::RenderingFeatures)
+#define RENDER2D_FEATURE_SDF 2
+
 // The format for the blur effect temporary buffer
 #define PS_Blur_Format PixelFormat::R8G8B8A8_UNorm
 
@@ -180,6 +187,15 @@ struct ClipMask
     Rectangle Bounds;
 };
 
+// Range of the draw calls drawn at once
+struct Render2DBatch
+{
+    int32 StartIndex;
+    int32 Count;
+    int32 TexturesStart;
+    int32 TexturesCount;
+};
+
 Render2D::RenderingFeatures Render2D::Features = RenderingFeatures::VertexSnapping;
 
 namespace
@@ -193,6 +209,8 @@ namespace
 
     // Drawing
     Array<Render2DDrawCall> DrawCalls;
+    Array<Render2DBatch> Batches;
+    Array<GPUTextureView*> BatchTextures;
     Array<FontLineCache> Lines;
     Array<Float2> Lines2;
     bool IsScissorsRectEmpty;
@@ -346,6 +364,18 @@ void WriteRect(const Rectangle& rect, const Color& color, const Float2& uvUpperL
     IBIndex += 6;
 }
 
+void WriteCharRect(const Rectangle& rect, const Color& color, const Float2& uvUpperLeft, const Float2& uvBottomRight, bool sdf)
+{
+    WriteRect(rect, color, uvUpperLeft, uvBottomRight);
+    if (sdf)
+    {
+        // Mark vertices to decode the signed distance field in the shader
+        auto vertices = (Render2DVertex*)(VB.Data.Get() + VB.Data.Count()) - 4;
+        for (int32 i = 0; i < 4; i++)
+            vertices[i].CustomData.Y = (float)((int32)vertices[i].CustomData.Y | RENDER2D_FEATURE_SDF);
+    }
+}
+
 FORCE_INLINE void WriteRect(const Rectangle& rect, const Color& color)
 {
     WriteRect(rect, color, Float2::Zero, Float2::One);
@@ -468,7 +498,55 @@ bool CanBatchDrawCalls(const Render2DDrawCall& d1, const Render2DDrawCall& d2)
     return d1.Type == d2.Type && CanDrawCallBatch[(int32)d1.Type](d1, d2);
 }
 
-void DrawBatch(int32 startIndex, int32 count);
+FORCE_INLINE bool UseTextureSlots(DrawCallType type)
+{
+    // Draw calls that use the default shader sampling a single texture (texture slot index is stored in the vertex custom data)
+    return type == DrawCallType::FillRT || type == DrawCallType::FillTexture || type == DrawCallType::FillTexturePoint || type == DrawCallType::DrawChar;
+}
+
+GPUTextureView* GetDrawCallTexture(const Render2DDrawCall& d)
+{
+    switch (d.Type)
+    {
+    case DrawCallType::FillRT:
+        return d.AsRT.Ptr;
+    case DrawCallType::FillTexture:
+    case DrawCallType::FillTexturePoint:
+        return d.AsTexture.Ptr ? d.AsTexture.Ptr->View() : nullptr;
+    case DrawCallType::DrawChar:
+        return d.AsChar.Tex ? d.AsChar.Tex->View() : nullptr;
+    default:
+        return nullptr;
+    }
+}
+
+bool AddBatchTexture(Render2DBatch& batch, const Render2DDrawCall& drawCall)
+{
+    // Find or allocate the texture slot
+    GPUTextureView* texture = GetDrawCallTexture(drawCall);
+    int32 slot = 0;
+    while (slot < batch.TexturesCount && BatchTextures[batch.TexturesStart + slot] != texture)
+        slot++;
+    if (slot == batch.TexturesCount)
+    {
+        if (slot == RENDER2D_TEXTURE_SLOTS)
+            return false;
+        BatchTextures.Add(texture);
+        batch.TexturesCount++;
+    }
+
+    // Write the slot index to the draw call vertices (default is 0)
+    if (slot != 0)
+    {
+        auto vertices = (Render2DVertex*)VB.Data.Get();
+        auto indices = (const uint32*)IB.Data.Get() + drawCall.StartIB;
+        for (uint32 i = 0; i < drawCall.CountIB; i++)
+            vertices[indices[i]].CustomData.X = (float)slot;
+    }
+    return true;
+}
+
+void DrawBatch(const Render2DBatch& batch);
 
 bool CachedPSO::Init(GPUShader* shader, bool useDepth)
 {
@@ -614,6 +692,8 @@ void Render2DService::Dispose()
     TintLayersStack.Resize(0);
     ClipLayersStack.Resize(0);
     DrawCalls.Resize(0);
+    Batches.Resize(0);
+    BatchTextures.Resize(0);
     Lines.Resize(0);
     Lines2.Resize(0);
 
@@ -729,6 +809,32 @@ void Render2D::End()
         shader = GUIShader->GetShader();
     }
 
+    // Batch draw calls (textured draw calls of the same type can use different textures bound to the separate slots)
+    Batches.Clear();
+    BatchTextures.Clear();
+    for (int32 i = 0; i < DrawCalls.Count(); i++)
+    {
+        const Render2DDrawCall& drawCall = DrawCalls[i];
+        const bool useTextureSlots = UseTextureSlots(drawCall.Type);
+        if (Batches.HasItems())
+        {
+            Render2DBatch& batch = Batches.Last();
+            const Render2DDrawCall& batchDrawCall = DrawCalls[batch.StartIndex];
+            if (useTextureSlots ? batchDrawCall.Type == drawCall.Type && AddBatchTexture(batch, drawCall) : CanBatchDrawCalls(batchDrawCall, drawCall))
+            {
+                batch.Count++;
+                continue;
+            }
+        }
+        Render2DBatch& batch = Batches.AddOne();
+        batch.StartIndex = i;
+        batch.Count = 1;
+        batch.TexturesStart = BatchTextures.Count();
+        batch.TexturesCount = 0;
+        if (useTextureSlots)
+            AddBatchTexture(batch, drawCall);
+    }
+
     // Flush geometry buffers
     VB.Flush(Context);
     IB.Flush(Context);
@@ -755,34 +861,15 @@ void Render2D::End()
     CurrentPso = DepthBuffer ? &PsoDepth : &PsoNoDepth;
 
     // Flush draw calls
-    int32 batchStart = 0, batchSize = 0;
     IsScissorsRectEmpty = false;
-    for (int32 i = 0; i < DrawCalls.Count(); i++)
+    for (const Render2DBatch& batch : Batches)
     {
-        // Peek draw call
-        const auto& drawCall = DrawCalls[i];
-
-        // Check if cannot add element to the batching
-        if (batchSize != 0 && !CanBatchDrawCalls(DrawCalls[batchStart], drawCall))
-        {
-            // Flush batched elements
-            DrawBatch(batchStart, batchSize);
-            batchStart += batchSize;
-            batchSize = 0;
-        }
-
-        // Add element to batching
-        batchSize++;
-    }
-
-    // Flush end of batched elements
-    if (batchSize != 0)
-    {
-        DrawBatch(batchStart, batchSize);
+        DrawBatch(batch);
     }
 
     // End
     DrawCalls.Clear();
+    Batches.Clear();
     Context = nullptr;
     Output = nullptr;
 }
@@ -831,6 +918,8 @@ void OnClipScissors()
 
     Render2DDrawCall& drawCall = DrawCalls.AddOne();
     drawCall.Type = DrawCallType::ClipScissors;
+    drawCall.StartIB = IBIndex;
+    drawCall.CountIB = 0;
     drawCall.AsClipScissors.X = mask.Bounds.GetX();
     drawCall.AsClipScissors.Y = mask.Bounds.GetY();
     drawCall.AsClipScissors.Width = mask.Bounds.GetWidth();
@@ -882,6 +971,99 @@ void Render2D::PopTint()
     TintLayersStack.Pop();
 }
 
+Render2DCache::Render2DCache(const SpawnParams& params)
+    : ScriptingObject(params)
+{
+}
+
+void Render2DCache::Clear()
+{
+    _vertices.Clear();
+    _indices.Clear();
+    _drawCalls.Clear();
+}
+
+bool Render2DCache::IsSameState(const Matrix3x3& transform, const RotatedRectangle& clipMask, const Color& tint, int32 features) const
+{
+    return Platform::MemoryCompare(&transform, &_transform, sizeof(Matrix3x3)) == 0 &&
+            Platform::MemoryCompare(&clipMask, &_clipMask, sizeof(RotatedRectangle)) == 0 &&
+            tint == _tint &&
+            features == _features;
+}
+
+void Render2D::BeginCache(Render2DCache* cache)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    CHECK(cache && !cache->_isRecording);
+
+    cache->Clear();
+    cache->_isRecording = true;
+    cache->_recordVB = VBIndex;
+    cache->_recordIB = IBIndex;
+    cache->_recordDrawCall = DrawCalls.Count();
+    cache->_transform = TransformCached;
+    cache->_clipMask = ClipLayersStack.Peek().Mask;
+    cache->_tint = TintLayersStack.Peek();
+    cache->_features = (int32)Features;
+}
+
+void Render2D::EndCache(Render2DCache* cache)
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+    CHECK(cache && cache->_isRecording);
+    cache->_isRecording = false;
+
+    // Skip if state got changed during recording (eg. unbalanced clipping)
+    if (!cache->IsSameState(TransformCached, ClipLayersStack.Peek().Mask, TintLayersStack.Peek(), (int32)Features))
+        return;
+
+    // Copy the recorded geometry (indices and draw calls are relative to the cache start)
+    const uint32 vertexCount = VBIndex - cache->_recordVB;
+    const uint32 indexCount = IBIndex - cache->_recordIB;
+    const int32 drawCallCount = DrawCalls.Count() - cache->_recordDrawCall;
+    cache->_vertices.Set(VB.Data.Get() + cache->_recordVB * sizeof(Render2DVertex), vertexCount * sizeof(Render2DVertex));
+    cache->_indices.Resize(indexCount);
+    const uint32* indices = (const uint32*)IB.Data.Get() + cache->_recordIB;
+    for (uint32 i = 0; i < indexCount; i++)
+        cache->_indices.Get()[i] = indices[i] - cache->_recordVB;
+    cache->_drawCalls.Resize(drawCallCount * sizeof(Render2DDrawCall));
+    auto drawCalls = (Render2DDrawCall*)cache->_drawCalls.Get();
+    for (int32 i = 0; i < drawCallCount; i++)
+    {
+        drawCalls[i] = DrawCalls[cache->_recordDrawCall + i];
+        drawCalls[i].StartIB -= cache->_recordIB;
+    }
+}
+
+bool Render2D::DrawCache(Render2DCache* cache)
+{
+    if (!IsRendering() || !cache || cache->_isRecording || !cache->HasGeometry())
+        return true;
+    if (!cache->IsSameState(TransformCached, ClipLayersStack.Peek().Mask, TintLayersStack.Peek(), (int32)Features))
+        return true;
+
+    // Append the cached geometry
+    const uint32 vertexCount = cache->_vertices.Count() / sizeof(Render2DVertex);
+    const uint32 indexCount = cache->_indices.Count();
+    VB.Write(cache->_vertices.Get(), cache->_vertices.Count());
+    const int32 indicesStart = IB.Data.Count();
+    IB.Data.AddUninitialized(indexCount * sizeof(uint32));
+    auto indices = (uint32*)(IB.Data.Get() + indicesStart);
+    for (uint32 i = 0; i < indexCount; i++)
+        indices[i] = cache->_indices.Get()[i] + VBIndex;
+    const int32 drawCallCount = cache->_drawCalls.Count() / sizeof(Render2DDrawCall);
+    const auto drawCalls = (const Render2DDrawCall*)cache->_drawCalls.Get();
+    for (int32 i = 0; i < drawCallCount; i++)
+    {
+        Render2DDrawCall& drawCall = DrawCalls.AddOne();
+        drawCall = drawCalls[i];
+        drawCall.StartIB += IBIndex;
+    }
+    VBIndex += vertexCount;
+    IBIndex += indexCount;
+    return false;
+}
+
 void CalculateKernelSize(float strength, int32& kernelSize, int32& downSample)
 {
     kernelSize = Math::RoundToInt(strength * 3.0f);
@@ -938,14 +1120,14 @@ static uint32 ComputeBlurWeights(int32 kernelSize, float sigma, Float4* outWeigh
     return numSamples;
 }
 
-void DrawBatch(int32 startIndex, int32 count)
+void DrawBatch(const Render2DBatch& batch)
 {
-    const Render2DDrawCall& d = DrawCalls[startIndex];
+    const Render2DDrawCall& d = DrawCalls[batch.StartIndex];
     GPUBuffer* vb = VB.GetBuffer();
     GPUBuffer* ib = IB.GetBuffer();
     uint32 countIb = 0;
-    for (int32 i = 0; i < count; i++)
-        countIb += DrawCalls[startIndex + i].CountIB;
+    for (int32 i = 0; i < batch.Count; i++)
+        countIb += DrawCalls[batch.StartIndex + i].CountIB;
 
     if (d.Type == DrawCallType::ClipScissors)
     {
@@ -966,19 +1148,19 @@ void DrawBatch(int32 startIndex, int32 count)
         Context->SetState(CurrentPso->PS_Color_NoAlpha);
         break;
     case DrawCallType::FillRT:
-        Context->BindSR(0, d.AsRT.Ptr);
-        Context->SetState(CurrentPso->PS_Image);
-        break;
     case DrawCallType::FillTexture:
-        Context->BindSR(0, d.AsTexture.Ptr);
+        for (int32 i = 0; i < batch.TexturesCount; i++)
+            Context->BindSR(i, BatchTextures[batch.TexturesStart + i]);
         Context->SetState(CurrentPso->PS_Image);
         break;
     case DrawCallType::FillTexturePoint:
-        Context->BindSR(0, d.AsTexture.Ptr);
+        for (int32 i = 0; i < batch.TexturesCount; i++)
+            Context->BindSR(i, BatchTextures[batch.TexturesStart + i]);
         Context->SetState(CurrentPso->PS_ImagePoint);
         break;
     case DrawCallType::DrawChar:
-        Context->BindSR(0, d.AsChar.Tex);
+        for (int32 i = 0; i < batch.TexturesCount; i++)
+            Context->BindSR(i, BatchTextures[batch.TexturesStart + i]);
         Context->SetState(CurrentPso->PS_Font);
         break;
     case DrawCallType::DrawCharMaterial:
@@ -1159,6 +1341,8 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
     FontCharacterEntry previous;
     int32 kerning;
     float scale = 1.0f / FontManager::FontScale;
+    const float glyphScale = scale * font->GetGlyphScale();
+    const bool sdf = font->IsSDF();
 
     // Render all characters
     FontCharacterEntry entry;
@@ -1226,7 +1410,7 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                 const float x = pointer.X + entry.OffsetX * scale;
                 const float y = pointer.Y + (font->GetHeight() + font->GetDescender() - entry.OffsetY) * scale;
 
-                Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                Rectangle charRect(x, y, entry.UVSize.X * glyphScale, entry.UVSize.Y * glyphScale);
 
                 Float2 upperLeftUV = entry.UV * invAtlasSize;
                 Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
@@ -1235,7 +1419,7 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                 drawCall.StartIB = IBIndex;
                 drawCall.CountIB = 6;
                 DrawCalls.Add(drawCall);
-                WriteRect(charRect, color, upperLeftUV, rightBottomUV);
+                WriteCharRect(charRect, color, upperLeftUV, rightBottomUV, sdf);
             }
 
             // Move
@@ -1273,6 +1457,8 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
     FontCharacterEntry previous;
     int32 kerning;
     float scale = layout.Scale / FontManager::FontScale;
+    const float glyphScale = scale * font->GetGlyphScale();
+    const bool sdf = font->IsSDF();
 
     // Process text to get lines
     Lines.Clear();
@@ -1343,7 +1529,7 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                     const float x = pointer.X + entry.OffsetX * scale;
                     const float y = pointer.Y - entry.OffsetY * scale + Math::Ceil((font->GetHeight() + font->GetDescender()) * scale);
 
-                    Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                    Rectangle charRect(x, y, entry.UVSize.X * glyphScale, entry.UVSize.Y * glyphScale);
                     charRect.Offset(layout.Bounds.Location);
 
                     Float2 upperLeftUV = entry.UV * invAtlasSize;
@@ -1353,7 +1539,7 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                     drawCall.StartIB = IBIndex;
                     drawCall.CountIB = 6;
                     DrawCalls.Add(drawCall);
-                    WriteRect(charRect, color, upperLeftUV, rightBottomUV);
+                    WriteCharRect(charRect, color, upperLeftUV, rightBottomUV, sdf);
                 }
 
                 // Move
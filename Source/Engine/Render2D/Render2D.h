@@ -22,6 +22,7 @@ class GPUContext;
 class RenderTask;
 class MaterialBase;
 class TextureBase;
+class Render2DCache;
 
 /// <summary>
 /// Rendering 2D shapes and text using Graphics Device.
@@ -172,6 +173,26 @@ API_CLASS(Static) class FLAXENGINE_API Render2D
     /// </summary>
     API_FUNCTION() static void PopTint();
 
+public:
+    /// <summary>
+    /// Begins recording the geometry to the cache. All the following drawing (until EndCache) is performed as usual and stored in the cache to be drawn again later with DrawCache. Recording can be nested.
+    /// </summary>
+    /// <param name="cache">The cache to record (existing geometry is cleared).</param>
+    API_FUNCTION() static void BeginCache(Render2DCache* cache);
+
+    /// <summary>
+    /// Ends recording the geometry to the cache.
+    /// </summary>
+    /// <param name="cache">The cache to record (the same as passed to BeginCache).</param>
+    API_FUNCTION() static void EndCache(Render2DCache* cache);
+
+    /// <summary>
+    /// Draws the geometry stored in the cache (skips the tessellation of the source elements).
+    /// </summary>
+    /// <param name="cache">The cache to draw.</param>
+    /// <returns>True if cannot draw cache (it's empty or it was recorded with a different transformation, clipping mask or tint and needs to be recorded again), otherwise false.</returns>
+    API_FUNCTION() static bool DrawCache(Render2DCache* cache);
+
 public:
     /// <summary>
     /// Draws a text.
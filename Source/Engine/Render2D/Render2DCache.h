@@ -0,0 +1,56 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RotatedRectangle.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Color.h"
+#include "Engine/Core/Math/Matrix3x3.h"
+#include "Engine/Scripting/ScriptingObject.h"
+
+/// <summary>
+/// The retained 2D geometry (tessellated vertices and draw calls) recorded with Render2D that can be drawn again without redrawing the source elements. Used to cache the static UI which is re-tessellated only when it gets invalidated.
+/// </summary>
+/// <remarks>The geometry is baked with the transformation, clipping mask and tint used during recording so it can be drawn only with the same state. Cache references the textures and materials used for drawing so it needs to be cleared when they get modified or unloaded.</remarks>
+API_CLASS(Sealed) class FLAXENGINE_API Render2DCache : public ScriptingObject
+{
+    DECLARE_SCRIPTING_TYPE(Render2DCache);
+    friend class Render2D;
+
+private:
+    bool _isRecording = false;
+    int32 _features;
+    uint32 _recordVB;
+    uint32 _recordIB;
+    int32 _recordDrawCall;
+    Matrix3x3 _transform;
+    RotatedRectangle _clipMask;
+    Color _tint;
+    Array<byte> _vertices;
+    Array<uint32> _indices;
+    Array<byte> _drawCalls;
+
+    bool IsSameState(const Matrix3x3& transform, const RotatedRectangle& clipMask, const Color& tint, int32 features) const;
+
+public:
+    /// <summary>
+    /// Gets a value indicating whether cache contains any recorded geometry.
+    /// </summary>
+    API_PROPERTY() bool HasGeometry() const
+    {
+        return _drawCalls.HasItems();
+    }
+
+    /// <summary>
+    /// Gets a value indicating whether cache is during recording (between Render2D.BeginCache and Render2D.EndCache).
+    /// </summary>
+    API_PROPERTY() bool IsRecording() const
+    {
+        return _isRecording;
+    }
+
+    /// <summary>
+    /// Clears the recorded geometry.
+    /// </summary>
+    API_FUNCTION() void Clear();
+};
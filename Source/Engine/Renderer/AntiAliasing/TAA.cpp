@@ -18,6 +18,10 @@ PACK_STRUCT(struct Data
     float StationaryBlending;
     float MotionBlending;
     float Dummy0;
+    Float2 InputSize;
+    Float2 InputSizeInv;
+    Float2 JitterUV;
+    Float2 Dummy1;
     });
 
 bool TAA::Init()
@@ -51,6 +55,15 @@ bool TAA::setupResources()
         if (_psTAA->Init(psDesc))
             return true;
     }
+    if (!_psTAAUpscale)
+        _psTAAUpscale = GPUDevice::Instance->CreatePipelineState();
+    if (!_psTAAUpscale->IsValid())
+    {
+        psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.PS = shader->GetPS("PS_Upscale");
+        if (_psTAAUpscale->Init(psDesc))
+            return true;
+    }
     return false;
 }
 
@@ -60,10 +73,23 @@ void TAA::Dispose()
     RendererPass::Dispose();
 
     SAFE_DELETE_GPU_RESOURCE(_psTAA);
+    SAFE_DELETE_GPU_RESOURCE(_psTAAUpscale);
     _shader = nullptr;
 }
 
 void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextureView* output)
+{
+    PROFILE_GPU_CPU("Temporal Antialiasing");
+    RenderInner(renderContext, input, output, input->Width(), input->Height());
+}
+
+void TAA::Upscale(const RenderContext& renderContext, GPUTexture* input, GPUTexture* output)
+{
+    PROFILE_GPU_CPU("Temporal Upscaling");
+    RenderInner(renderContext, input, output->View(), output->Width(), output->Height());
+}
+
+void TAA::RenderInner(const RenderContext& renderContext, GPUTexture* input, GPUTextureView* output, int32 outputWidth, int32 outputHeight)
 {
     auto context = GPUDevice::Instance->GetMainContext();
 
@@ -72,17 +98,18 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
     {
         // Resources are missing. Do not perform rendering, just copy source frame.
         context->SetRenderTarget(output);
+        if (outputWidth != input->Width() || outputHeight != input->Height())
+            context->SetViewportAndScissors((float)outputWidth, (float)outputHeight);
         context->Draw(input);
         return;
     }
     const auto& settings = renderContext.List->Settings.AntiAliasing;
-
-    PROFILE_GPU_CPU("Temporal Antialiasing");
+    const bool upscale = outputWidth != input->Width() || outputHeight != input->Height();
 
     // Get history buffers
     bool resetHistory = renderContext.Task->IsCameraCut;
     renderContext.Buffers->LastFrameTemporalAA = Engine::FrameCount;
-    const auto tempDesc = GPUTextureDescription::New2D(input->Width(), input->Height(), input->Format());
+    const auto tempDesc = GPUTextureDescription::New2D(outputWidth, outputHeight, input->Format());
     if (renderContext.Buffers->TemporalAA == nullptr)
     {
         // Missing temporal buffer
@@ -110,6 +137,8 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
         context->CopyTexture(inputHistory, 0, 0, 0, 0, input, 0);
 #else
         context->SetRenderTarget(inputHistory->View());
+        if (upscale)
+            context->SetViewportAndScissors((float)tempDesc.Width, (float)tempDesc.Height);
         context->Draw(input);
         context->ResetRenderTarget();
 #endif
@@ -125,6 +154,9 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
     data.Sharpness = settings.TAA_Sharpness;
     data.StationaryBlending = settings.TAA_StationaryBlending * blendStrength;
     data.MotionBlending = settings.TAA_MotionBlending * blendStrength;
+    data.InputSize = Float2((float)input->Width(), (float)input->Height());
+    data.InputSizeInv = Float2::One / data.InputSize;
+    data.JitterUV = Float2(renderContext.View.TemporalAAJitter.X * -0.5f, renderContext.View.TemporalAAJitter.Y * 0.5f); // Offset of the rendered scene sample within a pixel (in UV)
     const auto cb = _shader->GetShader()->GetCB(0);
     context->UpdateCB(cb, &data);
     context->BindCB(0, cb);
@@ -135,7 +167,9 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
 
     // Render
     context->SetRenderTarget(output);
-    context->SetState(_psTAA);
+    if (upscale)
+        context->SetViewportAndScissors((float)outputWidth, (float)outputHeight);
+    context->SetState(upscale ? _psTAAUpscale : _psTAA);
     context->DrawFullscreenTriangle();
 
     // Update the history
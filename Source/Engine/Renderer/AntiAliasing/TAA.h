@@ -14,6 +14,7 @@ class TAA : public RendererPass<TAA>
 
     AssetReference<Shader> _shader;
     GPUPipelineState* _psTAA;
+    GPUPipelineState* _psTAAUpscale = nullptr;
 
 public:
     /// <summary>
@@ -24,13 +25,25 @@ class TAA : public RendererPass<TAA>
     /// <param name="output">The output render target.</param>
     void Render(const RenderContext& renderContext, GPUTexture* input, GPUTextureView* output);
 
+    /// <summary>
+    /// Performs temporal upscaling for the input task. Reconstructs the output resolution image from the jittered lower resolution frames (temporal history is stored at the output resolution).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="input">The input render target (at rendering resolution).</param>
+    /// <param name="output">The output render target (at output resolution).</param>
+    void Upscale(const RenderContext& renderContext, GPUTexture* input, GPUTexture* output);
+
 private:
+    void RenderInner(const RenderContext& renderContext, GPUTexture* input, GPUTextureView* output, int32 outputWidth, int32 outputHeight);
+
 
 #if COMPILE_WITH_DEV_ENV
     void OnShaderReloading(Asset* obj)
     {
         if (_psTAA)
             _psTAA->ReleaseGPU();
+        if (_psTAAUpscale)
+            _psTAAUpscale->ReleaseGPU();
         invalidateResources();
     }
 #endif
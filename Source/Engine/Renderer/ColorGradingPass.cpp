@@ -3,8 +3,10 @@
 #include "ColorGradingPass.h"
 #include "RenderList.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderTask.h"
 
@@ -36,9 +38,26 @@ PACK_STRUCT(struct Data {
     float LutWeight;
     });
 
+class ColorGradingCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    GPUTexture* LUT = nullptr;
+    Data Params;
+    ToneMappingMode Mode;
+    GPUTexture* LutTexture = nullptr;
+    int32 LutTextureMips = 0;
+    int32 Version = 0;
+
+    ~ColorGradingCustomBuffer()
+    {
+        RenderTargetPool::Release(LUT);
+    }
+};
+
 ColorGradingPass::ColorGradingPass()
     : _useVolumeTexture(false)
     , _lutFormat()
+    , _lutVersion(0)
     , _shader(nullptr)
 {
 }
@@ -134,22 +153,6 @@ GPUTexture* ColorGradingPass::RenderLUT(RenderContext& renderContext)
     if (checkIfSkipPass())
         return nullptr;
 
-    PROFILE_GPU_CPU("Color Grading LUT");
-
-    // For a 3D texture, the viewport is 16x16 (per slice), for a 2D texture, it's unwrapped to 256x16
-    const int32 LutSize = 32; // this must match value in shader (see ColorGrading.shader and PostProcessing.shader)
-    GPUTextureDescription lutDesc;
-    if (_useVolumeTexture)
-    {
-        lutDesc = GPUTextureDescription::New3D(LutSize, LutSize, LutSize, 1, _lutFormat);
-    }
-    else
-    {
-        lutDesc = GPUTextureDescription::New2D(LutSize * LutSize, LutSize, 1, _lutFormat);
-    }
-    const auto lut = RenderTargetPool::Get(lutDesc);
-    RENDER_TARGET_POOL_SET_NAME(lut, "ColorGrading.LUT");
-
     // Prepare the parameters
     Data data;
     auto& toneMapping = renderContext.List->Settings.ToneMapping;
@@ -180,6 +183,47 @@ GPUTexture* ColorGradingPass::RenderLUT(RenderContext& renderContext)
     //
     const bool useLut = colorGrading.LutTexture && colorGrading.LutTexture->IsLoaded() && colorGrading.LutTexture->GetResidentMipLevels() > 0 && colorGrading.LutWeight > ZeroTolerance;
     data.LutWeight = useLut ? colorGrading.LutWeight : 0.0f;
+    data.Dummy = Float3::Zero;
+
+    // Reuse the LUT from the previous frames if the settings didn't change
+    auto& cache = *renderContext.Buffers->GetCustomBuffer<ColorGradingCustomBuffer>(TEXT("ColorGrading"));
+    cache.LastFrameUsed = Engine::FrameCount;
+    GPUTexture* lutTexture = useLut ? colorGrading.LutTexture->GetTexture() : nullptr;
+    const int32 lutTextureMips = lutTexture ? lutTexture->ResidentMipLevels() : 0;
+    if (cache.LUT &&
+        cache.Version == _lutVersion &&
+        cache.Mode == toneMapping.Mode &&
+        cache.LutTexture == lutTexture &&
+        cache.LutTextureMips == lutTextureMips &&
+        Platform::MemoryCompare(&cache.Params, &data, sizeof(Data)) == 0)
+    {
+        return cache.LUT;
+    }
+    cache.Params = data;
+    cache.Mode = toneMapping.Mode;
+    cache.LutTexture = lutTexture;
+    cache.LutTextureMips = lutTextureMips;
+    cache.Version = _lutVersion;
+
+    PROFILE_GPU_CPU("Color Grading LUT");
+
+    // For a 3D texture, the viewport is 16x16 (per slice), for a 2D texture, it's unwrapped to 256x16
+    const int32 LutSize = 32; // this must match value in shader (see ColorGrading.shader and PostProcessing.shader)
+    GPUTextureDescription lutDesc;
+    if (_useVolumeTexture)
+    {
+        lutDesc = GPUTextureDescription::New3D(LutSize, LutSize, LutSize, 1, _lutFormat);
+    }
+    else
+    {
+        lutDesc = GPUTextureDescription::New2D(LutSize * LutSize, LutSize, 1, _lutFormat);
+    }
+    if (!cache.LUT)
+    {
+        cache.LUT = RenderTargetPool::Get(lutDesc);
+        RENDER_TARGET_POOL_SET_NAME(cache.LUT, "ColorGrading.LUT");
+    }
+    const auto lut = cache.LUT;
 
     // Prepare
     auto device = GPUDevice::Instance;
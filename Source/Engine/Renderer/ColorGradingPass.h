@@ -14,6 +14,7 @@ class ColorGradingPass : public RendererPass<ColorGradingPass>
 
     bool _useVolumeTexture;
     PixelFormat _lutFormat;
+    int32 _lutVersion;
     AssetReference<Shader> _shader;
     GPUPipelineStatePermutationsPs<3> _psLut;
 
@@ -30,7 +31,8 @@ class ColorGradingPass : public RendererPass<ColorGradingPass>
     /// Performs Look Up Table rendering for the input task.
     /// </summary>
     /// <param name="renderContext">The rendering context.</param>
-    /// <returns>Allocated temp render target with a rendered LUT. Can be 2d or 3d based on current graphics hardware caps. Release after usage.</returns>
+    /// <remarks>The LUT is cached within the render buffers and regenerated only when the tone mapping or color grading settings change.</remarks>
+    /// <returns>The LUT texture (owned by the render buffers, don't release it). Can be 2d or 3d based on current graphics hardware caps.</returns>
     GPUTexture* RenderLUT(RenderContext& renderContext);
 
 private:
@@ -39,6 +41,7 @@ class ColorGradingPass : public RendererPass<ColorGradingPass>
     void OnShaderReloading(Asset* obj)
     {
         _psLut.Release();
+        _lutVersion++;
         invalidateResources();
     }
 #endif
@@ -0,0 +1,254 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "ComputeSkinningPass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Models/SkinnedMesh.h"
+#include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
+#include "Engine/Graphics/Models/BlendShape.h"
+
+// Those defines must match the HLSL
+#define COMPUTE_SKINNING_GROUP_SIZE 64
+#define COMPUTE_SKINNING_BLEND_SHAPES_DELTA_STRIDE 24
+
+PACK_STRUCT(struct Data {
+    uint32 VerticesCount;
+    uint32 PrevPositionsOffset;
+    uint32 GroupsX;
+    uint32 Dummy0;
+    });
+
+PACK_STRUCT(struct BlendShapeData {
+    uint32 VerticesOffset;
+    uint32 VerticesCount;
+    float Weight;
+    uint32 UseNormals;
+    });
+
+static_assert(sizeof(VB0SkinnedElementType) == 36, "Invalid skinned vertex size. Update the compute skinning shader.");
+static_assert(sizeof(VB1ElementType) == 16, "Invalid vertex attributes size. Update the compute skinning shader.");
+static_assert(sizeof(BlendShapeVertex) == 28, "Invalid blend shape vertex size. Update the compute skinning shader.");
+
+String ComputeSkinningPass::ToString() const
+{
+    return TEXT("ComputeSkinningPass");
+}
+
+void ComputeSkinningPass::Prepare(RenderContext& renderContext)
+{
+    renderContext.List->ComputeSkinning = false;
+    if (!Graphics::EnableComputeSkinning || !_supported)
+        return;
+#if USE_EDITOR
+    const ViewMode viewMode = renderContext.View.Mode;
+    if (viewMode == ViewMode::LightmapUVsDensity || viewMode == ViewMode::VertexColors || viewMode == ViewMode::LODPreview || viewMode == ViewMode::MaterialComplexity)
+        return; // Those debug views override the materials with the shaders that skin the meshes in the vertex shader
+#endif
+
+    // Load shader on the first use
+    if (!_shader)
+    {
+        _shader = GPUDevice::Instance->Limits.HasCompute ? Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ComputeSkinning")) : nullptr;
+        if (!_shader)
+        {
+            _supported = false;
+            return;
+        }
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<ComputeSkinningPass, &ComputeSkinningPass::OnShaderReloading>(this);
+#endif
+        invalidateResources();
+    }
+    if (checkIfSkipPass() || !_csSkinning)
+        return;
+    renderContext.List->ComputeSkinning = true;
+}
+
+void ComputeSkinningPass::SetupDrawCall(const RenderContext& renderContext, const SkinnedMesh* mesh, SkinnedMeshDrawData* skinning, DrawCall& drawCall, BlendShapesInstance* blendShapes)
+{
+    ASSERT_LOW_LAYER(renderContext.List->ComputeSkinning && skinning && skinning->IsReady());
+    GPUBuffer* vertexBuffer = drawCall.Geometry.VertexBuffers[0];
+    if (!vertexBuffer || !vertexBuffer->IsShaderResource())
+        return; // Vertex buffer cannot be read by the compute shader (eg. blend shapes vertex buffer)
+    const uint32 verticesCount = mesh->GetVertexCount();
+
+    _locker.Lock();
+    SkinnedMeshVertices* output;
+    if (!skinning->SkinnedMeshes.TryGet(mesh, output))
+    {
+        // Output buffers get allocated before skinning
+        output = New<SkinnedMeshVertices>();
+        output->Positions = GPUDevice::Instance->CreateBuffer(TEXT("ComputeSkinning.Positions"));
+        output->Attributes = GPUDevice::Instance->CreateBuffer(TEXT("ComputeSkinning.Attributes"));
+        skinning->SkinnedMeshes.Add(mesh, output);
+    }
+    if (output->LastFrame != Engine::FrameCount)
+    {
+        // Skin mesh once per frame (other views and render tasks reuse the skinned vertices)
+        output->LastFrame = Engine::FrameCount;
+        SkinnedMeshDraw draw;
+        draw.VertexBuffer = vertexBuffer;
+        draw.VerticesCount = verticesCount;
+        draw.Skinning = skinning;
+        draw.Output = output;
+        draw.Mesh = mesh;
+        draw.BlendShapes = blendShapes && mesh->GetBlendShapesBuffer() ? blendShapes : nullptr;
+        renderContext.List->SkinnedMeshDraws.Add(draw);
+    }
+    _locker.Unlock();
+
+    // Draw skinned vertices like a static mesh (positions stream is followed by the previous frame positions)
+    drawCall.Geometry.VertexBuffers[0] = output->Positions;
+    drawCall.Geometry.VertexBuffers[1] = output->Attributes;
+    drawCall.Geometry.VertexBuffers[2] = output->Positions;
+    drawCall.Geometry.VertexBuffersOffsets[0] = 0;
+    drawCall.Geometry.VertexBuffersOffsets[1] = 0;
+    drawCall.Geometry.VertexBuffersOffsets[2] = verticesCount * sizeof(Float3);
+}
+
+bool ComputeSkinningPass::setupResources()
+{
+    if (!_shader)
+        return false; // Shader is loaded on the first use so don't block the renderer readiness
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+    _cb0 = shader->GetCB(0);
+    if (!_cb0 || _cb0->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+    _csSkinning = shader->GetCS("CS_Skinning", 0);
+    _csSkinningBlendShapes = shader->GetCS("CS_Skinning", 1);
+    _csBlendShapes = shader->GetCS("CS_BlendShapes");
+    return false;
+}
+
+void ComputeSkinningPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _csSkinning = nullptr;
+    _csSkinningBlendShapes = nullptr;
+    _csBlendShapes = nullptr;
+    _cb0 = nullptr;
+    _shader = nullptr;
+}
+
+void ComputeSkinningPass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    const auto& draws = renderContext.List->SkinnedMeshDraws;
+    if (draws.Count() == 0 || checkIfSkipPass() || !_csSkinning)
+        return;
+    PROFILE_GPU_CPU("Compute Skinning");
+
+    for (int32 i = 0; i < draws.Count(); i++)
+    {
+        const SkinnedMeshDraw& draw = draws.Get()[i];
+        SkinnedMeshVertices* output = draw.Output;
+        SkinnedMeshDrawData* skinning = draw.Skinning;
+
+        // Ensure to have enough space for the output
+        const uint32 positionsSize = draw.VerticesCount * sizeof(Float3) * 2;
+        if (output->Positions->GetSize() != positionsSize)
+        {
+            if (output->Positions->Init(GPUBufferDescription::Buffer(positionsSize, GPUBufferFlags::VertexBuffer | GPUBufferFlags::UnorderedAccess | GPUBufferFlags::RawBuffer, PixelFormat::R32_Typeless, nullptr, sizeof(Float3))))
+                continue;
+        }
+        const uint32 attributesSize = draw.VerticesCount * sizeof(VB1ElementType);
+        if (output->Attributes->GetSize() != attributesSize)
+        {
+            if (output->Attributes->Init(GPUBufferDescription::Buffer(attributesSize, GPUBufferFlags::VertexBuffer | GPUBufferFlags::UnorderedAccess | GPUBufferFlags::RawBuffer, PixelFormat::R32_Typeless, nullptr, sizeof(VB1ElementType))))
+                continue;
+        }
+
+        // Apply blend shapes
+        Data data;
+        GPUBuffer* blendShapesDeltas = nullptr;
+        BlendShapesInstance::MeshInstance* blendShapesInstance;
+        if (draw.BlendShapes && draw.BlendShapes->Meshes.TryGet(draw.Mesh, blendShapesInstance) && blendShapesInstance->IsUsed)
+        {
+            // Collect the active blend shapes (sparse vertices of all mesh blend shapes are resident on a GPU, only the weights are uploaded)
+            Array<BlendShapeData, InlinedAllocation<64>> blendShapes;
+            uint32 maxVerticesCount = 0;
+            for (const auto& e : blendShapesInstance->BlendShapes)
+            {
+                if (Math::IsZero(e.Second))
+                    continue;
+                uint32 verticesOffset = 0;
+                for (int32 i = 0; i < e.First; i++)
+                    verticesOffset += draw.Mesh->BlendShapes[i].Vertices.Count();
+                const BlendShape& blendShape = draw.Mesh->BlendShapes[e.First];
+                if (blendShape.Vertices.IsEmpty())
+                    continue;
+                auto& blendShapeData = blendShapes.AddOne();
+                blendShapeData.VerticesOffset = verticesOffset;
+                blendShapeData.VerticesCount = blendShape.Vertices.Count();
+                blendShapeData.Weight = e.Second;
+                blendShapeData.UseNormals = blendShape.UseNormals ? 1 : 0;
+                maxVerticesCount = Math::Max(maxVerticesCount, blendShapeData.VerticesCount);
+            }
+
+            // Ensure to have the buffers for the active blend shapes and the accumulated deltas
+            auto& instance = *blendShapesInstance;
+            const uint32 blendShapesSize = blendShapes.Count() * sizeof(BlendShapeData);
+            const uint32 deltasSize = draw.VerticesCount * COMPUTE_SKINNING_BLEND_SHAPES_DELTA_STRIDE;
+            if (!instance.GPUBlendShapes)
+            {
+                instance.GPUBlendShapes = GPUDevice::Instance->CreateBuffer(TEXT("ComputeSkinning.BlendShapes"));
+                instance.GPUDeltas = GPUDevice::Instance->CreateBuffer(TEXT("ComputeSkinning.BlendShapesDeltas"));
+            }
+            if (blendShapes.HasItems() &&
+                (instance.GPUBlendShapes->GetSize() >= blendShapesSize || !instance.GPUBlendShapes->Init(GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(blendShapesSize), GPUBufferFlags::ShaderResource))) &&
+                (instance.GPUDeltas->GetSize() == deltasSize || !instance.GPUDeltas->Init(GPUBufferDescription::Raw(deltasSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess))))
+            {
+                // Accumulate the deltas of all blend shapes (thread per blend shape vertex, group row per blend shape)
+                PROFILE_GPU("Blend Shapes");
+                context->UpdateBuffer(instance.GPUBlendShapes, blendShapes.Get(), blendShapesSize);
+                const uint32 clearValue[4] = { 0, 0, 0, 0 };
+                context->ClearUA(instance.GPUDeltas, clearValue);
+                data.VerticesCount = draw.VerticesCount;
+                data.PrevPositionsOffset = 0;
+                data.GroupsX = Math::DivideAndRoundUp<uint32>(maxVerticesCount, COMPUTE_SKINNING_GROUP_SIZE);
+                data.Dummy0 = 0;
+                context->UpdateCB(_cb0, &data);
+                context->BindCB(0, _cb0);
+                context->BindSR(0, draw.Mesh->GetBlendShapesBuffer()->View());
+                context->BindSR(1, instance.GPUBlendShapes->View());
+                context->BindUA(0, instance.GPUDeltas->View());
+                context->Dispatch(_csBlendShapes, data.GroupsX, blendShapes.Count(), 1);
+                context->ResetUA();
+                blendShapesDeltas = instance.GPUDeltas;
+            }
+        }
+
+        // Skin vertices (thread per vertex, previous frame positions use the current bones if there is no history)
+        const uint32 groupsCount = Math::DivideAndRoundUp<uint32>(draw.VerticesCount, COMPUTE_SKINNING_GROUP_SIZE);
+        data.VerticesCount = draw.VerticesCount;
+        data.PrevPositionsOffset = draw.VerticesCount * sizeof(Float3);
+        data.GroupsX = Math::Min<uint32>(groupsCount, GPU_MAX_CS_DISPATCH_THREAD_GROUPS);
+        data.Dummy0 = 0;
+        context->UpdateCB(_cb0, &data);
+        context->BindCB(0, _cb0);
+        GPUBuffer* prevBoneMatrices = skinning->PrevBoneMatrices && skinning->PrevBoneMatrices->IsAllocated() ? skinning->PrevBoneMatrices : skinning->BoneMatrices;
+        context->BindSR(0, draw.VertexBuffer->View());
+        context->BindSR(1, skinning->BoneMatrices->View());
+        context->BindSR(2, prevBoneMatrices->View());
+        context->BindSR(3, blendShapesDeltas ? blendShapesDeltas->View() : nullptr);
+        context->BindUA(0, output->Positions->View());
+        context->BindUA(1, output->Attributes->View());
+        context->Dispatch(blendShapesDeltas ? _csSkinningBlendShapes : _csSkinning, data.GroupsX, Math::DivideAndRoundUp(groupsCount, data.GroupsX), 1);
+    }
+    context->ResetUA();
+    context->ResetSR();
+}
@@ -0,0 +1,70 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Platform/CriticalSection.h"
+
+class SkinnedMesh;
+class SkinnedMeshDrawData;
+class BlendShapesInstance;
+struct DrawCall;
+
+/// <summary>
+/// GPU skinning pass. Skins the vertices of the skinned meshes with a compute shader once per frame into the transient vertex buffers (with the previous frame positions for the motion vectors) so all the rendering passes draw them like the static geometry. Blend shapes are applied before skinning from the sparse deltas resident on a GPU (only the active weights are uploaded each frame). Uses compute shaders.
+/// </summary>
+class FLAXENGINE_API ComputeSkinningPass : public RendererPass<ComputeSkinningPass>
+{
+private:
+    bool _supported = true;
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csSkinning = nullptr;
+    GPUShaderProgramCS* _csSkinningBlendShapes = nullptr;
+    GPUShaderProgramCS* _csBlendShapes = nullptr;
+    GPUConstantBuffer* _cb0 = nullptr;
+    CriticalSection _locker;
+
+public:
+    /// <summary>
+    /// Prepares the compute skinning for the scene rendering (enables it for the render list draw calls). Called before collecting the draw calls.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    void Prepare(RenderContext& renderContext);
+
+    /// <summary>
+    /// Setups the skinned mesh draw call to use the vertices skinned with a compute shader. Can be called only if the render list has ComputeSkinning enabled. Thread-safe.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="mesh">The skinned mesh.</param>
+    /// <param name="skinning">The skinning data with the bone matrices.</param>
+    /// <param name="drawCall">The mesh draw call to modify (uses the skinned mesh vertex buffer as an input).</param>
+    /// <param name="blendShapes">The blend shapes to apply to the mesh vertices before skinning. Optional.</param>
+    void SetupDrawCall(const RenderContext& renderContext, const SkinnedMesh* mesh, SkinnedMeshDrawData* skinning, DrawCall& drawCall, BlendShapesInstance* blendShapes = nullptr);
+
+    /// <summary>
+    /// Skins the vertices of the render list skinned meshes. Called before executing any of the draw calls.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csSkinning = nullptr;
+        _csSkinningBlendShapes = nullptr;
+        _csBlendShapes = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
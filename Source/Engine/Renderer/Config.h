@@ -101,6 +101,18 @@ PACK_STRUCT(struct LightShadowData {
     Matrix ShadowVP[6];
     });
 
+/// <summary>
+/// Structure that contains information about the clustered lights grid for shaders.
+/// </summary>
+PACK_STRUCT(struct LightClustersData {
+    uint32 GridSize[3];
+    uint32 LightsCount;
+    Float2 UVToCluster;
+    Float2 DepthScaleBias;
+    uint32 DeferredLightsCount;
+    Float3 Dummy0;
+    });
+
 /// <summary>
 /// Packed env probe data
 /// </summary>
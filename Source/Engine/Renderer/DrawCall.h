@@ -116,6 +116,9 @@ class IAtmosphericFogRenderer
 /// <summary>
 /// Renderer draw call used for dynamic batching process.
 /// </summary>
+/// <remarks>
+/// The data used by the draw calls sorting and batching is placed at the beginning of the structure (material, sort key, geometry and instances count fit into the first cache line). The rest of the per-object data is read only when executing the draw call.
+/// </remarks>
 struct DrawCall
 {
     /// <summary>
@@ -123,6 +126,11 @@ struct DrawCall
     /// </summary>
     IMaterial* Material;
 
+    /// <summary>
+    /// The sorting key for the draw call calculate by RenderList.
+    /// </summary>
+    uint64 SortKey;
+
     struct
     {
         /// <summary>
@@ -146,6 +154,11 @@ struct DrawCall
     /// </summary>
     int32 InstanceCount;
 
+    /// <summary>
+    /// The world matrix determinant sign (used for geometry that is two sided or has inverse scale - needs to flip normal vectors and change triangles culling).
+    /// </summary>
+    float WorldDeterminantSign;
+
     union
     {
         struct
@@ -204,6 +217,7 @@ struct DrawCall
             float CurrentLOD;
             float ChunkSizeNextLOD;
             float TerrainChunkSizeLOD0;
+            int32 GPUChunksOffset; // The offset of the chunks instances culled on a GPU (in TerrainCullingPass output buffer) that are drawn by the indirect draw call. -1 for a single chunk drawn by the CPU.
             const class TerrainPatch* Patch;
         } Terrain;
 
@@ -258,21 +272,11 @@ struct DrawCall
     /// </summary>
     Float3 ObjectPosition;
 
-    /// <summary>
-    /// The world matrix determinant sign (used for geometry that is two sided or has inverse scale - needs to flip normal vectors and change triangles culling).
-    /// </summary>
-    float WorldDeterminantSign;
-
     /// <summary>
     /// The random per-instance value (normalized to range 0-1).
     /// </summary>
     float PerInstanceRandom;
 
-    /// <summary>
-    /// The sorting key for the draw call calculate by RenderList.
-    /// </summary>
-    uint64 SortKey;
-
     /// <summary>
     /// Does nothing.
     /// </summary>
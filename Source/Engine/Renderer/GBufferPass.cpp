@@ -2,6 +2,8 @@
 
 #include "GBufferPass.h"
 #include "RenderList.h"
+#include "VariableRateShadingPass.h"
+#include "ImpostorsPass.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Editor/VertexColors.h"
 #include "Engine/Renderer/Editor/LightmapUVsDensity.h"
@@ -9,12 +11,15 @@
 #include "Engine/Renderer/Editor/MaterialComplexity.h"
 #endif
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/OrientedBoundingBox.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/Materials/DecalMaterialShader.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Assets/Model.h"
@@ -97,6 +102,7 @@ void GBufferPass::Dispose()
     _gBufferShader = nullptr;
     _skyModel = nullptr;
     _boxModel = nullptr;
+    SAFE_DELETE(_decalsInstanceBuffer);
 #if USE_EDITOR
     SAFE_DELETE(_lightmapUVsDensity);
     SAFE_DELETE(_vertexColors);
@@ -203,6 +209,9 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     }
 #endif
 
+    // Reduce the shading rate of the low-detail screen areas
+    context->SetShadingRateImage(VariableRateShadingPass::Instance()->GetShadingRateImage(renderContext));
+
     // Draw objects that can get decals
     context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
     renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBuffer);
@@ -213,6 +222,8 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     // Draw objects that cannot get decals
     context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
     renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBufferNoDecals);
+    ImpostorsPass::Instance()->Render(renderContext, context);
+    context->SetShadingRateImage(nullptr);
 
     GPUTexture* nullTexture = nullptr;
     renderContext.List->RunCustomPostFxPass(context, renderContext, PostProcessEffectLocation::AfterGBufferPass, lightBuffer, nullTexture);
@@ -230,9 +241,26 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
 
 bool SortDecal(Decal* const& a, Decal* const& b)
 {
-    return a->SortOrder < b->SortOrder;
+    // Sort by the order, then group by the blending mode (output targets) and material (to batch decals)
+    if (a->SortOrder != b->SortOrder)
+        return a->SortOrder < b->SortOrder;
+    const MaterialInfo& aInfo = a->Material->GetInfo();
+    const MaterialInfo& bInfo = b->Material->GetInfo();
+    if (aInfo.DecalBlendingMode != bInfo.DecalBlendingMode)
+        return aInfo.DecalBlendingMode < bInfo.DecalBlendingMode;
+    if (aInfo.UsageFlags != bInfo.UsageFlags)
+        return aInfo.UsageFlags < bInfo.UsageFlags;
+    return a->Material.Get() < b->Material.Get();
 }
 
+struct DecalsBatch
+{
+    MaterialBase* Material;
+    int32 First;
+    int32 Count;
+    int32 InstanceOffset;
+};
+
 void GBufferPass::RenderDebug(RenderContext& renderContext)
 {
     // Check if has resources loaded
@@ -438,15 +466,71 @@ void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* light
     // Cache data
     auto device = GPUDevice::Instance;
     auto context = device->GetMainContext();
-    auto model = _boxModel.Get();
+    auto& view = renderContext.View;
+    const Mesh& mesh = _boxModel->LODs[0].Meshes[0];
     auto buffers = renderContext.Buffers;
 
     // Sort decals from the lowest order to the highest order
     Sorting::QuickSort(decals.Get(), (int32)decals.Count(), &SortDecal);
 
-    // TODO: batch decals using the same material
+    // Prepare decals transformations
+    Array<Matrix, RendererAllocation> worlds;
+    worlds.Resize(decals.Count());
+    for (int32 i = 0; i < decals.Count(); i++)
+    {
+        const auto decal = decals[i];
+        ASSERT(decal && decal->Material);
+        Transform transform = decal->GetTransform();
+        transform.Scale *= decal->GetSize();
+        view.GetWorldMatrix(transform, worlds[i]);
+    }
+
+    // Batch consecutive decals that use the same material and are viewed from the outside into instanced draws
+    Array<DecalsBatch, RendererAllocation> batches;
+    if (!_decalsInstanceBuffer)
+        _decalsInstanceBuffer = New<DynamicVertexBuffer>(0u, (uint32)sizeof(DecalMaterialShader::DecalInstanceData), TEXT("Decals.InstanceBuffer"));
+    _decalsInstanceBuffer->Clear();
+    for (int32 i = 0; i < decals.Count();)
+    {
+        auto& batch = batches.AddOne();
+        batch.Material = decals[i]->Material.Get();
+        batch.First = i;
+        batch.Count = 1;
+        batch.InstanceOffset = 0;
+        i++;
+        if (OrientedBoundingBox(Vector3::Half, worlds[batch.First]).Contains(view.Position) == ContainmentType::Contains)
+            continue;
+        while (i < decals.Count() && decals[i]->Material.Get() == batch.Material && OrientedBoundingBox(Vector3::Half, worlds[i]).Contains(view.Position) != ContainmentType::Contains)
+        {
+            batch.Count++;
+            i++;
+        }
+        if (batch.Count == 1)
+            continue;
 
-    // TODO: sort decals by the blending mode within the same order
+        // Write instances data
+        batch.InstanceOffset = _decalsInstanceBuffer->Data.Count() / sizeof(DecalMaterialShader::DecalInstanceData);
+        auto instances = _decalsInstanceBuffer->WriteReserve<DecalMaterialShader::DecalInstanceData>(batch.Count);
+        for (int32 j = 0; j < batch.Count; j++)
+        {
+            auto& instance = instances[j];
+            const Matrix& world = worlds[batch.First + j];
+            Matrix invWorld;
+            Matrix::Invert(world, invWorld);
+            for (int32 k = 0; k < 3; k++)
+            {
+                instance.World[k] = Float4(world.Values[0][k], world.Values[1][k], world.Values[2][k], world.Values[3][k]);
+                instance.InvWorld[k] = Float4(invWorld.Values[0][k], invWorld.Values[1][k], invWorld.Values[2][k], invWorld.Values[3][k]);
+            }
+            instance.PerInstanceRandom = decals[batch.First + j]->GetPerInstanceRandom();
+        }
+    }
+    GPUBuffer* instanceBuffer = nullptr;
+    if (_decalsInstanceBuffer->Data.HasItems())
+    {
+        _decalsInstanceBuffer->Flush(context);
+        instanceBuffer = _decalsInstanceBuffer->GetBuffer();
+    }
 
     // Prepare
     DrawCall drawCall;
@@ -454,69 +538,85 @@ void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* light
     bindParams.BindViewData();
     drawCall.Material = nullptr;
     drawCall.WorldDeterminantSign = 1.0f;
+    GPUBuffer* vb[4] = { mesh.GetVertexBuffer(0), mesh.GetVertexBuffer(1), mesh.GetVertexBuffer(2), instanceBuffer };
+    context->BindIB(mesh.GetIndexBuffer());
+    const uint32 indicesCount = mesh.GetTriangleCount() * 3;
+    MaterialDecalBlendingMode prevBlendingMode = (MaterialDecalBlendingMode)-1;
+    MaterialUsageFlags prevUsageFlags = MaterialUsageFlags::None;
 
     // Draw all decals
-    for (int32 i = 0; i < decals.Count(); i++)
+    for (const DecalsBatch& batch : batches)
     {
-        const auto decal = decals[i];
-        ASSERT(decal && decal->Material);
-        Transform transform = decal->GetTransform();
-        transform.Scale *= decal->GetSize();
-        renderContext.View.GetWorldMatrix(transform, drawCall.World);
+        const auto decal = decals[batch.First];
+        drawCall.World = worlds[batch.First];
         drawCall.ObjectPosition = drawCall.World.GetTranslation();
 
-        context->ResetRenderTarget();
-
-        // Bind output
-        const MaterialInfo& info = decal->Material->GetInfo();
-        switch (info.DecalBlendingMode)
-        {
-        case MaterialDecalBlendingMode::Translucent:
+        // Bind output (decals are sorted by the blending mode so change output only when needed)
+        const MaterialInfo& info = batch.Material->GetInfo();
+        if (info.DecalBlendingMode != prevBlendingMode || info.UsageFlags != prevUsageFlags)
         {
-            GPUTextureView* targetBuffers[4];
-            int32 count = 2;
-            targetBuffers[0] = buffers->GBuffer0->View();
-            targetBuffers[1] = buffers->GBuffer2->View();
-            if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseEmissive))
+            prevBlendingMode = info.DecalBlendingMode;
+            prevUsageFlags = info.UsageFlags;
+            context->ResetRenderTarget();
+            switch (info.DecalBlendingMode)
+            {
+            case MaterialDecalBlendingMode::Translucent:
             {
-                count++;
-                targetBuffers[2] = lightBuffer;
+                GPUTextureView* targetBuffers[4];
+                int32 count = 2;
+                targetBuffers[0] = buffers->GBuffer0->View();
+                targetBuffers[1] = buffers->GBuffer2->View();
+                if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseEmissive))
+                {
+                    count++;
+                    targetBuffers[2] = lightBuffer;
 
-                if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseNormal))
+                    if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseNormal))
+                    {
+                        count++;
+                        targetBuffers[3] = buffers->GBuffer1->View();
+                    }
+                }
+                else if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseNormal))
                 {
                     count++;
-                    targetBuffers[3] = buffers->GBuffer1->View();
+                    targetBuffers[2] = buffers->GBuffer1->View();
                 }
+                context->SetRenderTarget(nullptr, ToSpan(targetBuffers, count));
+                break;
             }
-            else if (EnumHasAnyFlags(info.UsageFlags, MaterialUsageFlags::UseNormal))
+            case MaterialDecalBlendingMode::Stain:
             {
-                count++;
-                targetBuffers[2] = buffers->GBuffer1->View();
+                context->SetRenderTarget(buffers->GBuffer0->View());
+                break;
+            }
+            case MaterialDecalBlendingMode::Normal:
+            {
+                context->SetRenderTarget(buffers->GBuffer1->View());
+                break;
+            }
+            case MaterialDecalBlendingMode::Emissive:
+            {
+                context->SetRenderTarget(lightBuffer);
+                break;
+            }
             }
-            context->SetRenderTarget(nullptr, ToSpan(targetBuffers, count));
-            break;
-        }
-        case MaterialDecalBlendingMode::Stain:
-        {
-            context->SetRenderTarget(buffers->GBuffer0->View());
-            break;
         }
-        case MaterialDecalBlendingMode::Normal:
+
+        // Draw decal (or many decals with instancing)
+        drawCall.PerInstanceRandom = decal->GetPerInstanceRandom();
+        bindParams.DrawCallsCount = batch.Count;
+        batch.Material->Bind(bindParams);
+        if (batch.Count > 1)
         {
-            context->SetRenderTarget(buffers->GBuffer1->View());
-            break;
+            context->BindVB(ToSpan(vb, 4));
+            context->DrawIndexedInstanced(indicesCount, batch.Count, batch.InstanceOffset, 0, 0);
         }
-        case MaterialDecalBlendingMode::Emissive:
+        else
         {
-            context->SetRenderTarget(lightBuffer);
-            break;
-        }
+            context->BindVB(ToSpan(vb, 3));
+            context->DrawIndexedInstanced(indicesCount, 1, 0, 0, 0);
         }
-
-        // Draw decal
-        drawCall.PerInstanceRandom = decal->GetPerInstanceRandom();
-        decal->Material->Bind(bindParams);
-        model->Render(context);
     }
 
     context->ResetSR();
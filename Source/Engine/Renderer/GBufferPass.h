@@ -18,6 +18,7 @@ class GBufferPass : public RendererPass<GBufferPass>
     GPUPipelineState* _psDebug = nullptr;
     AssetReference<Model> _skyModel;
     AssetReference<Model> _boxModel;
+    class DynamicVertexBuffer* _decalsInstanceBuffer = nullptr;
 #if USE_EDITOR
     class LightmapUVsDensityMaterialShader* _lightmapUVsDensity = nullptr;
     class VertexColorsMaterialShader* _vertexColors = nullptr;
@@ -16,6 +16,7 @@
 #include "Engine/Engine/Time.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUTimerQuery.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderBuffers.h"
@@ -40,6 +41,11 @@
 #define DDGI_PROBE_RESOLUTION_DISTANCE 14 // Resolution (in texels) for probe distance data (excluding 1px padding on each side)
 #define DDGI_PROBE_UPDATE_BORDERS_GROUP_SIZE 8
 #define DDGI_PROBE_CLASSIFY_GROUP_SIZE 32
+#define DDGI_PROBE_UPDATE_PRIORITY_BUCKETS 16
+#define DDGI_PROBE_UPDATE_HEADER_SIZE (DDGI_PROBE_UPDATE_PRIORITY_BUCKETS + 4)
+
+// The minimum amount of probes to update per cascade when using the probes updates budget
+#define DDGI_PROBE_UPDATE_MIN_BUDGET 64
 
 PACK_STRUCT(struct Data0
     {
@@ -52,12 +58,17 @@ PACK_STRUCT(struct Data0
     float ResetBlend;
     float TemporalTime;
     Int4 ProbeScrollClears[4];
+    Float3 ProbesViewDir;
+    float ProbesViewFovCos;
+    uint32 ProbesUpdateBudget;
+    Float3 Padding2;
     });
 
 PACK_STRUCT(struct Data1
     {
     // TODO: use push constants on Vulkan or root signature data on DX12 to reduce overhead of changing single DWORD
-    Float2 Padding1;
+    uint32 ProbesUpdateFrame;
+    float Padding1;
     uint32 CascadeIndex;
     uint32 ProbeIndexOffset;
     });
@@ -92,6 +103,11 @@ class DDGICustomBuffer : public RenderBuffers::CustomBuffer
     GPUTexture* ProbesDistance = nullptr; // Probes distance (R: mean distance, G: mean distance^2)
     GPUBuffer* ActiveProbes = nullptr; // List with indices of the active probes (built during probes classification to use indirect dispatches for probes updating), counter at 0
     GPUBuffer* UpdateProbesInitArgs = nullptr; // Indirect dispatch buffer for active-only probes updating (trace+blend)
+    GPUBuffer* ProbesUpdate = nullptr; // Probes update priority histogram and the per-probe data (irradiance change during last update and update priority)
+    GPUTimerQuery* UpdateTimer = nullptr; // Measures the probes update time to estimate the probes count that fits into the updates budget
+    bool UpdateTimerPending = false;
+    uint32 UpdateTimerProbes = 0;
+    float ProbeUpdateCost = 0.0f; // Estimated probe update time (in milliseconds)
     DynamicDiffuseGlobalIlluminationPass::BindingData Result;
 
     FORCE_INLINE void Release()
@@ -102,11 +118,14 @@ class DDGICustomBuffer : public RenderBuffers::CustomBuffer
         RenderTargetPool::Release(ProbesDistance);
         SAFE_DELETE_GPU_RESOURCE(ActiveProbes);
         SAFE_DELETE_GPU_RESOURCE(UpdateProbesInitArgs);
+        SAFE_DELETE_GPU_RESOURCE(ProbesUpdate);
+        ProbeUpdateCost = 0.0f;
     }
 
     ~DDGICustomBuffer()
     {
         Release();
+        SAFE_DELETE_GPU_RESOURCE(UpdateTimer);
     }
 };
 
@@ -180,6 +199,7 @@ bool DynamicDiffuseGlobalIlluminationPass::setupResources()
     if (!_cb0 || !_cb1)
         return true;
     _csClassify = shader->GetCS("CS_Classify");
+    _csCollectProbes = shader->GetCS("CS_CollectProbes");
     _csUpdateProbesInitArgs = shader->GetCS("CS_UpdateProbesInitArgs");
     _csTraceRays[0] = shader->GetCS("CS_TraceRays", 0);
     _csTraceRays[1] = shader->GetCS("CS_TraceRays", 1);
@@ -211,6 +231,7 @@ void DynamicDiffuseGlobalIlluminationPass::OnShaderReloading(Asset* obj)
 {
     LastFrameShaderReload = Engine::FrameCount;
     _csClassify = nullptr;
+    _csCollectProbes = nullptr;
     _csUpdateProbesInitArgs = nullptr;
     _csTraceRays[0] = nullptr;
     _csTraceRays[1] = nullptr;
@@ -382,6 +403,8 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
         INIT_BUFFER(ActiveProbes, "DDGI.ActiveProbes");
         desc2 = GPUBufferDescription::Buffer(sizeof(GPUDispatchIndirectArgs) * Math::DivideAndRoundUp(probesCountCascade, DDGI_TRACE_RAYS_PROBES_COUNT_LIMIT), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_UInt, nullptr, sizeof(uint32));
         INIT_BUFFER(UpdateProbesInitArgs, "DDGI.UpdateProbesInitArgs");
+        desc2 = GPUBufferDescription::Raw((DDGI_PROBE_UPDATE_HEADER_SIZE + probesCountTotal * 2) * sizeof(uint32), GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess);
+        INIT_BUFFER(ProbesUpdate, "DDGI.ProbesUpdate");
 #undef INIT_BUFFER
         LOG(Info, "Dynamic Diffuse Global Illumination memory usage: {0} MB, probes: {1}", memUsage / 1024 / 1024, probesCountTotal);
         clear = true;
@@ -396,6 +419,7 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
         context->ClearUA(ddgiData.ProbesData, Float4::Zero);
         context->ClearUA(ddgiData.ProbesIrradiance, Float4::Zero);
         context->ClearUA(ddgiData.ProbesDistance, Float4::Zero);
+        context->ClearUA(ddgiData.ProbesUpdate, Float4::Zero);
     }
     ddgiData.LastFrameUsed = Engine::FrameCount;
 
@@ -404,11 +428,34 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
     //const uint64 cascadeFrequencies[] = { 1, 2, 3, 5 };
     //const uint64 cascadeFrequencies[] = { 1, 1, 1, 1 };
     bool cascadeSkipUpdate[4];
+    int32 cascadesUpdateCount = 0;
     for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
     {
         cascadeSkipUpdate[cascadeIndex] = !clear && (ddgiData.LastFrameUsed % cascadeFrequencies[cascadeIndex]) != 0;
+        if (!cascadeSkipUpdate[cascadeIndex])
+            cascadesUpdateCount++;
     }
 
+    // Calculate the amount of probes to update per-cascade within the GPU time budget (based on the measured time of the previous updates)
+    if (ddgiData.UpdateTimerPending && ddgiData.UpdateTimer->HasResult())
+    {
+        ddgiData.UpdateTimerPending = false;
+        const float updateTime = ddgiData.UpdateTimer->GetResult();
+        if (updateTime > 0.0f && ddgiData.UpdateTimerProbes != 0)
+        {
+            const float probeUpdateCost = updateTime / (float)ddgiData.UpdateTimerProbes;
+            ddgiData.ProbeUpdateCost = ddgiData.ProbeUpdateCost > 0.0f ? Math::Lerp(ddgiData.ProbeUpdateCost, probeUpdateCost, 0.2f) : probeUpdateCost;
+        }
+    }
+    const float updateBudget = Graphics::GIProbesUpdateBudget;
+    uint32 probesUpdateBudget = probesCountCascade;
+    if (updateBudget > 0.0f && ddgiData.ProbeUpdateCost > 0.0f && !clear && cascadesUpdateCount != 0)
+    {
+        const int32 cascadeProbesBudget = (int32)(updateBudget / (ddgiData.ProbeUpdateCost * (float)cascadesUpdateCount));
+        probesUpdateBudget = Math::Clamp(cascadeProbesBudget, Math::Min(DDGI_PROBE_UPDATE_MIN_BUDGET, probesCountCascade), probesCountCascade);
+    }
+    const bool measureUpdate = updateBudget > 0.0f && !ddgiData.UpdateTimerPending && cascadesUpdateCount != 0;
+
     // Compute scrolling (probes are placed around camera but are scrolling to increase stability during movement)
     for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
     {
@@ -480,6 +527,21 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
             auto& cascade = ddgiData.Cascades[cascadeIndex];
             data.ProbeScrollClears[cascadeIndex] = Int4(cascade.ProbeScrollClears, 0);
         }
+        data.ProbesViewDir = renderContext.View.Direction;
+        if (renderContext.View.IsOrthographicProjection())
+        {
+            data.ProbesViewFovCos = -1.0f;
+        }
+        else
+        {
+            // Cosine of the angle between view direction and the view frustum corner (extended a bit to include probes that affect the nearby surfaces)
+            const Matrix& projection = renderContext.View.Projection;
+            const float tanHalfFovX = 1.0f / projection.M11;
+            const float tanHalfFovY = 1.0f / projection.M22;
+            data.ProbesViewFovCos = Math::Cos(Math::Min(Math::Atan(Math::Sqrt(tanHalfFovX * tanHalfFovX + tanHalfFovY * tanHalfFovY)) * 1.1f, PI));
+        }
+        data.ProbesUpdateBudget = probesUpdateBudget;
+        data.Padding2 = Float3::Zero;
         if (renderContext.List->Setup.UseTemporalAAJitter)
         {
             // Use temporal offset in the dithering factor (gets cleaned out by TAA)
@@ -502,23 +564,32 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
         PROFILE_GPU_CPU_NAMED("Probes Update");
         bool anyDirty = false;
         uint32 threadGroupsX, threadGroupsY;
+        if (measureUpdate)
+        {
+            if (!ddgiData.UpdateTimer)
+                ddgiData.UpdateTimer = GPUDevice::Instance->CreateTimerQuery();
+            ddgiData.UpdateTimer->Begin();
+            ddgiData.UpdateTimerPending = true;
+            ddgiData.UpdateTimerProbes = probesUpdateBudget * cascadesUpdateCount;
+        }
         for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
         {
             if (cascadeSkipUpdate[cascadeIndex])
                 continue;
             anyDirty = true;
 
-            // Classify probes (activation/deactivation and relocation)
+            // Classify probes (activation/deactivation, relocation, sleeping and update priority)
             {
                 PROFILE_GPU_CPU_NAMED("Classify Probes");
-                uint32 activeProbesCount = 0;
-                context->UpdateBuffer(ddgiData.ActiveProbes, &activeProbesCount, sizeof(uint32), 0);
+                uint32 probesUpdateHeader[DDGI_PROBE_UPDATE_HEADER_SIZE] = {};
+                context->UpdateBuffer(ddgiData.ProbesUpdate, probesUpdateHeader, sizeof(probesUpdateHeader), 0);
                 threadGroupsX = Math::DivideAndRoundUp(probesCountCascade, DDGI_PROBE_CLASSIFY_GROUP_SIZE);
                 context->BindSR(0, bindingDataSDF.Texture ? bindingDataSDF.Texture->ViewVolume() : nullptr);
                 context->BindSR(1, bindingDataSDF.TextureMip ? bindingDataSDF.TextureMip->ViewVolume() : nullptr);
                 context->BindUA(0, ddgiData.Result.ProbesData);
-                context->BindUA(1, ddgiData.ActiveProbes->View());
+                context->BindUA(1, ddgiData.ProbesUpdate->View());
                 Data1 data;
+                data.ProbesUpdateFrame = (uint32)(ddgiData.LastFrameUsed / cascadeFrequencies[cascadeIndex]);
                 data.CascadeIndex = cascadeIndex;
                 context->UpdateCB(_cb1, &data);
                 context->BindCB(1, _cb1);
@@ -527,18 +598,28 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
                 context->ResetSR();
             }
 
-            // Build indirect args for probes updating (loop over active-only probes)
+            // Select probes to update within the budget and build indirect args for probes updating (loop over selected probes only)
             {
                 PROFILE_GPU_CPU_NAMED("Init Args");
-                context->BindSR(0, ddgiData.ActiveProbes->View());
                 context->BindUA(0, ddgiData.UpdateProbesInitArgs->View());
+                context->BindUA(1, ddgiData.ActiveProbes->View());
+                context->BindUA(2, ddgiData.ProbesUpdate->View());
                 context->Dispatch(_csUpdateProbesInitArgs, 1, 1, 1);
                 context->ResetUA();
             }
 
+            // Build list of probes to update (sorted by the update priority)
+            {
+                PROFILE_GPU_CPU_NAMED("Collect Probes");
+                context->BindUA(0, ddgiData.ActiveProbes->View());
+                context->BindUA(1, ddgiData.ProbesUpdate->View());
+                context->Dispatch(_csCollectProbes, threadGroupsX, 1, 1);
+                context->ResetUA();
+            }
+
             // Update probes in batches so ProbesTrace texture can be smaller
             uint32 arg = 0;
-            for (int32 probesOffset = 0; probesOffset < probesCountCascade; probesOffset += DDGI_TRACE_RAYS_PROBES_COUNT_LIMIT)
+            for (int32 probesOffset = 0; probesOffset < (int32)probesUpdateBudget; probesOffset += DDGI_TRACE_RAYS_PROBES_COUNT_LIMIT)
             {
                 Data1 data;
                 data.CascadeIndex = cascadeIndex;
@@ -574,8 +655,11 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
                     context->BindSR(1, ddgiData.ProbesTrace->View());
                     context->BindSR(2, ddgiData.ActiveProbes->View());
                     context->BindUA(0, ddgiData.Result.ProbesIrradiance);
+                    context->BindUA(1, ddgiData.ProbesUpdate->View());
                     context->DispatchIndirect(_csUpdateProbesIrradiance, ddgiData.UpdateProbesInitArgs, arg);
+                    context->UnBindSR(0);
                     context->BindUA(0, ddgiData.Result.ProbesDistance);
+                    context->BindUA(1, ddgiData.Result.ProbesData);
                     context->DispatchIndirect(_csUpdateProbesDistance, ddgiData.UpdateProbesInitArgs, arg);
                     context->ResetUA();
                     context->ResetSR();
@@ -584,6 +668,8 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
                 arg += sizeof(GPUDispatchIndirectArgs);
             }
         }
+        if (measureUpdate)
+            ddgiData.UpdateTimer->End();
 
         // Update probes border pixels
         if (anyDirty)
@@ -6,6 +6,7 @@
 #include "../GBufferPass.h"
 #include "../RenderList.h"
 #include "../ShadowsPass.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/Math/Matrix3x3.h"
 #include "Engine/Core/Math/OrientedBoundingBox.h"
 #include "Engine/Engine/Engine.h"
@@ -91,6 +92,7 @@ struct GlobalSurfaceAtlasObject
     uint64 LastFrameUpdated;
     uint64 LightingUpdateFrame; // Index of the frame to update lighting for this object (calculated when object gets dirty or overriden by dynamic lights)
     Actor* Actor;
+    uint32 PendingTiles; // Mask of the tiles inserted into atlas but not yet rasterized (skipped by the tiles update budget)
     GlobalSurfaceAtlasTile* Tiles[6];
     float Radius;
     OrientedBoundingBox Bounds;
@@ -470,6 +472,7 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
     {
         PROFILE_CPU_NAMED("Draw");
         surfaceAtlasData.ObjectsBuffer.Clear();
+        _dirtyObjectsCandidates.Clear();
         _dirtyObjectsBuffer.Clear();
         _surfaceAtlasData = &surfaceAtlasData;
         renderContext.View.Pass = DrawPass::GlobalSurfaceAtlas;
@@ -523,6 +526,39 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
         }
     }
 
+    // Pick dirty objects to redraw within the tiles budget (by priority)
+    if (_dirtyObjectsCandidates.Count() != 0)
+    {
+        PROFILE_CPU_NAMED("Pick Dirty Objects");
+        const int32 tilesBudget = graphicsSettings->GlobalSurfaceAtlasTilesBudget > 0 && !GLOBAL_SURFACE_ATLAS_DEBUG_FORCE_REDRAW_TILES ? graphicsSettings->GlobalSurfaceAtlasTilesBudget : MAX_int32;
+        Sorting::QuickSort(_dirtyObjectsCandidates.Get(), _dirtyObjectsCandidates.Count());
+        int32 tilesCount = 0;
+        for (const DirtyObject& e : _dirtyObjectsCandidates)
+        {
+            GlobalSurfaceAtlasObject& object = surfaceAtlasData.Objects[e.ActorObject];
+            if (tilesCount == 0 || tilesCount + e.TilesCount <= tilesBudget)
+            {
+                // Redraw object
+                tilesCount += e.TilesCount;
+                object.LastFrameUpdated = currentFrame;
+                object.LightingUpdateFrame = currentFrame;
+                object.PendingTiles = 0;
+                _dirtyObjectsBuffer.Add(e.ActorObject);
+            }
+            else if (object.PendingTiles)
+            {
+                // Hide tiles without any content yet (object keeps waiting with its staleness increasing)
+                auto tileOffsets = reinterpret_cast<uint16*>(surfaceAtlasData.ObjectsBuffer.Data.Get() + (e.ObjectAddress + 1) * sizeof(Float4));
+                for (int32 tileIndex = 0; tileIndex < 6; tileIndex++)
+                {
+                    if (object.PendingTiles & (1 << tileIndex))
+                        tileOffsets[tileIndex] = 0;
+                }
+            }
+        }
+        ZoneValue(tilesCount);
+    }
+
     // Rasterize world geometry material properties into Global Surface Atlas
     if (_dirtyObjectsBuffer.Count() != 0)
     {
@@ -579,7 +615,6 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
                 VB_DRAW();
             }
         }
-        // TODO: limit dirty objects count on a first frame (eg. collect overflown objects to be redirty next frame)
         auto& drawCallsListGBuffer = renderContextTiles.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer];
         auto& drawCallsListGBufferNoDecals = renderContextTiles.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals];
         drawCallsListGBuffer.CanUseInstancing = false;
@@ -1235,6 +1270,7 @@ void GlobalSurfaceAtlasPass::RasterizeActor(Actor* actor, void* actorObject, con
                 continue;
             }
             object->Tiles[tileIndex]->Free();
+            object->Tiles[tileIndex] = nullptr;
         }
 
         // Insert tile into atlas
@@ -1244,6 +1280,7 @@ void GlobalSurfaceAtlasPass::RasterizeActor(Actor* actor, void* actorObject, con
             if (!object)
                 object = &surfaceAtlasData.Objects[actorObject];
             object->Tiles[tileIndex] = tile;
+            object->PendingTiles |= 1 << tileIndex;
             anyTile = true;
             dirty = true;
         }
@@ -1259,7 +1296,7 @@ void GlobalSurfaceAtlasPass::RasterizeActor(Actor* actor, void* actorObject, con
 
     // Redraw objects from time-to-time (dynamic objects can be animated, static objects can have textures streamed)
     uint32 redrawFramesCount = actor->HasStaticFlag(StaticFlags::Lightmap) ? 120 : 4;
-    if (surfaceAtlasData.CurrentFrame - object->LastFrameUpdated >= (redrawFramesCount + (actor->GetID().D & redrawFramesCount)))
+    if (surfaceAtlasData.CurrentFrame - object->LastFrameUpdated >= (redrawFramesCount + (actor->GetID().D & redrawFramesCount)) || object->PendingTiles)
         dirty = true;
 
     // Mark object as used
@@ -1268,11 +1305,23 @@ void GlobalSurfaceAtlasPass::RasterizeActor(Actor* actor, void* actorObject, con
     object->Bounds = OrientedBoundingBox(localBounds);
     object->Bounds.Transform(localToWorld);
     object->Radius = (float)actorObjectBounds.Radius;
+    const uint32 objectAddress = surfaceAtlasData.ObjectsBuffer.Data.Count() / sizeof(Float4);
     if (dirty || GLOBAL_SURFACE_ATLAS_DEBUG_FORCE_REDRAW_TILES)
     {
-        object->LastFrameUpdated = surfaceAtlasData.CurrentFrame;
-        object->LightingUpdateFrame = surfaceAtlasData.CurrentFrame;
-        _dirtyObjectsBuffer.Add(actorObject);
+        // Add to candidates for the redraw (prioritize tiles without content, then by the screen coverage and staleness)
+        auto& e = _dirtyObjectsCandidates.AddOne();
+        e.ActorObject = actorObject;
+        e.ObjectAddress = objectAddress;
+        e.TilesCount = 0;
+        for (int32 tileIndex = 0; tileIndex < 6; tileIndex++)
+        {
+            if (object->Tiles[tileIndex])
+                e.TilesCount++;
+        }
+        const float viewDistance = Math::Max((float)CollisionsHelper::DistanceSpherePoint(actorObjectBounds, surfaceAtlasData.ViewPosition), 1.0f);
+        const float coverage = (float)actorObjectBounds.Radius / viewDistance;
+        const float staleness = (float)(surfaceAtlasData.CurrentFrame - object->LastFrameUpdated) / (float)redrawFramesCount;
+        e.Priority = coverage * (object->PendingTiles ? staleness + 1000.0f : staleness);
     }
 
     Matrix3x3 worldToLocalRotation;
@@ -1281,7 +1330,6 @@ void GlobalSurfaceAtlasPass::RasterizeActor(Actor* actor, void* actorObject, con
     Float3 worldExtents = object->Bounds.Extents * object->Bounds.Transformation.Scale;
 
     // Write to objects buffer (this must match unpacking logic in HLSL)
-    uint32 objectAddress = surfaceAtlasData.ObjectsBuffer.Data.Count() / sizeof(Float4);
     auto* objectData = surfaceAtlasData.ObjectsBuffer.WriteReserve<Float4>(GLOBAL_SURFACE_ATLAS_OBJECT_DATA_STRIDE);
     objectData[0] = *(Float4*)&actorObjectBounds;
     objectData[1] = Float4::Zero;
@@ -59,6 +59,20 @@ class FLAXENGINE_API GlobalSurfaceAtlasPass : public RendererPass<GlobalSurfaceA
     class GPUBuffer* _culledObjectsSizeBuffer = nullptr;
     class DynamicVertexBuffer* _vertexBuffer = nullptr;
     class GlobalSurfaceAtlasCustomBuffer* _surfaceAtlasData;
+    struct DirtyObject
+    {
+        void* ActorObject;
+        uint32 ObjectAddress;
+        int32 TilesCount;
+        float Priority;
+
+        bool operator<(const DirtyObject& other) const
+        {
+            // Higher priority goes first
+            return Priority > other.Priority;
+        }
+    };
+    Array<DirtyObject> _dirtyObjectsCandidates;
     Array<void*> _dirtyObjectsBuffer;
     uint64 _culledObjectsSizeFrames[8];
     Vector4 _cullingPosDistance;
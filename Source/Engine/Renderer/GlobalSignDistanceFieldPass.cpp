@@ -76,6 +76,12 @@ PACK_STRUCT(struct ModelsRasterizeData
     uint32 GenerateMipCoordScale;
     uint32 GenerateMipTexOffsetX;
     uint32 GenerateMipMipOffsetX;
+    Int3 CascadeTexOffset;
+    uint32 Padding10;
+    Int3 GenerateMipTexWrapOffset;
+    uint32 Padding11;
+    Int3 GenerateMipMipWrapOffset;
+    uint32 Padding12;
     });
 
 struct RasterizeChunk
@@ -129,13 +135,54 @@ uint32 GetHash(const RasterizeChunkKey& key)
     return key.Hash;
 }
 
+FORCE_INLINE Int3 WrapChunkCoord(const Int3& coord, int32 chunks)
+{
+    return Int3((coord.X % chunks + chunks) % chunks, (coord.Y % chunks + chunks) % chunks, (coord.Z % chunks + chunks) % chunks);
+}
+
+// Converts the chunk key between the cascade-local coordinates and the texture coordinates (cascade voxels use toroidal addressing).
+FORCE_INLINE RasterizeChunkKey WrapChunkKey(const RasterizeChunkKey& key, const Int3& offset, int32 chunks)
+{
+    RasterizeChunkKey result;
+    result.Layer = 0;
+    result.Coord = WrapChunkCoord(key.Coord + offset, chunks);
+    result.Hash = result.Coord.Z * (RasterizeChunkKeyHashResolution * RasterizeChunkKeyHashResolution) + result.Coord.Y * RasterizeChunkKeyHashResolution + result.Coord.X;
+    return result;
+}
+
 struct CascadeData
 {
     Float3 Position;
     float VoxelSize;
     BoundingBox Bounds;
-    HashSet<RasterizeChunkKey> NonEmptyChunks;
-    HashSet<RasterizeChunkKey> StaticChunks;
+    Int3 ChunkCoord; // Cascade bounds minimum in chunks (world-space).
+    HashSet<RasterizeChunkKey> NonEmptyChunks; // Texture coordinates of chunks that contain rasterized objects.
+    HashSet<RasterizeChunkKey> StaticChunks; // Cascade-local coordinates of chunks that are cached (only static objects).
+
+    // Moves the cached static chunks to the new cascade location (data in texture is reused due to toroidal addressing).
+    void MoveStaticChunks(const Int3& chunkCoord, int32 chunks)
+    {
+        const Int3 delta = chunkCoord - ChunkCoord;
+        ChunkCoord = chunkCoord;
+        if (StaticChunks.IsEmpty())
+            return;
+        HashSet<RasterizeChunkKey> movedChunks;
+        for (const auto& e : StaticChunks)
+        {
+            // Skip chunks at the old cascade border (objects outside the cascade were not rasterized into them)
+            const Int3& coord = e.Item.Coord;
+            if (coord.MinValue() == 0 || coord.MaxValue() == chunks - 1)
+                continue;
+            RasterizeChunkKey key;
+            key.Layer = 0;
+            key.Coord = coord - delta;
+            if (key.Coord.MinValue() < 0 || key.Coord.MaxValue() >= chunks)
+                continue;
+            key.Hash = key.Coord.Z * (RasterizeChunkKeyHashResolution * RasterizeChunkKeyHashResolution) + key.Coord.Y * RasterizeChunkKeyHashResolution + key.Coord.X;
+            movedChunks.Add(key);
+        }
+        StaticChunks = MoveTemp(movedChunks);
+    }
 
     FORCE_INLINE void OnSceneRenderingDirty(const BoundingBox& objectBounds)
     {
@@ -530,11 +577,19 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         }
 
         // Check if cascade center has been moved
-        if (!(useCache && Float3::NearEqual(cascade.Position, center, cascadeVoxelSize)))
+        const Int3 cascadeChunkCoord(Float3::Floor(cascadeBounds.Minimum / cascadeChunkSize + 0.5f));
+        if (!useCache || !Math::NearEqual(cascade.VoxelSize, cascadeVoxelSize))
         {
-            // TODO: optimize for moving camera (copy sdf for cached chunks)
             cascade.StaticChunks.Clear();
+            cascade.ChunkCoord = cascadeChunkCoord;
+        }
+        else if (cascade.ChunkCoord != cascadeChunkCoord)
+        {
+            // Reuse cached chunks that are still inside the cascade
+            cascade.MoveStaticChunks(cascadeChunkCoord, rasterizeChunks);
         }
+        const Int3 cascadeTexChunkOffset = WrapChunkCoord(cascadeChunkCoord, rasterizeChunks);
+        const Int3 cascadeTexChunkOffsetInv = Int3(rasterizeChunks) - cascadeTexChunkOffset;
         cascade.Position = center;
         cascade.VoxelSize = cascadeVoxelSize;
         cascade.Bounds = cascadeBounds;
@@ -588,6 +643,9 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         data.CascadeIndex = cascadeIndex;
         data.CascadeMipFactor = GLOBAL_SDF_RASTERIZE_MIP_FACTOR;
         data.CascadeVoxelSize = cascadeVoxelSize;
+        data.CascadeTexOffset = cascadeTexChunkOffset * GLOBAL_SDF_RASTERIZE_CHUNK_SIZE;
+        data.GenerateMipTexWrapOffset = Int3::Zero;
+        data.GenerateMipMipWrapOffset = Int3::Zero;
         context->BindUA(0, textureView);
         context->BindCB(1, _cb1);
         const int32 chunkDispatchGroups = GLOBAL_SDF_RASTERIZE_CHUNK_SIZE / GLOBAL_SDF_RASTERIZE_GROUP_SIZE;
@@ -596,7 +654,7 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
             PROFILE_GPU_CPU_NAMED("Clear Chunks");
             for (auto it = cascade.NonEmptyChunks.Begin(); it.IsNotEnd(); ++it)
             {
-                auto& key = it->Item;
+                const auto key = WrapChunkKey(it->Item, cascadeTexChunkOffsetInv, rasterizeChunks);
                 if (chunks.ContainsKey(key))
                     continue;
 
@@ -730,7 +788,7 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
                 if (e.Key.Layer != 0)
                     continue;
                 auto& chunk = e.Value;
-                cascade.NonEmptyChunks.Add(e.Key);
+                cascade.NonEmptyChunks.Add(WrapChunkKey(e.Key, cascadeTexChunkOffset, rasterizeChunks));
 
                 for (int32 i = 0; i < chunk.ModelsCount; i++)
                 {
@@ -852,6 +910,8 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
             data.GenerateMipCoordScale = data.CascadeMipFactor;
             data.GenerateMipTexOffsetX = data.CascadeIndex * data.CascadeResolution;
             data.GenerateMipMipOffsetX = data.CascadeIndex * data.CascadeMipResolution;
+            data.GenerateMipTexWrapOffset = data.CascadeTexOffset;
+            data.GenerateMipMipWrapOffset = data.CascadeTexOffset / GLOBAL_SDF_RASTERIZE_MIP_FACTOR;
             context->UpdateCB(_cb1, &data);
             context->BindSR(0, textureView);
             context->BindUA(0, textureMipView);
@@ -869,6 +929,8 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
                     context->BindUA(0, tmpMipView);
                     data.GenerateMipTexOffsetX = data.CascadeIndex * data.CascadeMipResolution;
                     data.GenerateMipMipOffsetX = 0;
+                    data.GenerateMipTexWrapOffset = data.CascadeTexOffset / GLOBAL_SDF_RASTERIZE_MIP_FACTOR;
+                    data.GenerateMipMipWrapOffset = Int3::Zero;
                 }
                 else
                 {
@@ -877,6 +939,8 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
                     context->BindUA(0, textureMipView);
                     data.GenerateMipTexOffsetX = 0;
                     data.GenerateMipMipOffsetX = data.CascadeIndex * data.CascadeMipResolution;
+                    data.GenerateMipTexWrapOffset = Int3::Zero;
+                    data.GenerateMipMipWrapOffset = data.CascadeTexOffset / GLOBAL_SDF_RASTERIZE_MIP_FACTOR;
                 }
                 context->UpdateCB(_cb1, &data);
                 context->Dispatch(_csGenerateMip, mipDispatchGroups, mipDispatchGroups, mipDispatchGroups);
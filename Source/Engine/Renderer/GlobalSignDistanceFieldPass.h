@@ -99,6 +99,10 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
     String ToString() const override;
     bool Init() override;
     void Dispose() override;
+    bool CanUseAsyncCompute() const override
+    {
+        return true;
+    }
 
 protected:
     // [RendererPass]
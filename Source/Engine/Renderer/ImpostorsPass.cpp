@@ -0,0 +1,329 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "ImpostorsPass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Models/Mesh.h"
+#include "Engine/Threading/Threading.h"
+
+PACK_STRUCT(struct Data {
+    Matrix ViewProjection;
+    Float3 ViewPosition;
+    float FramesCount;
+    Float3 BoundsCenter;
+    float BoundsRadius;
+    float FrameHalfTexel;
+    uint32 InstanceOffset;
+    Float2 Dummy0;
+    });
+
+namespace
+{
+    // Matches GetHemiOctahedralDirection from the Octahedral.hlsl
+    Float3 GetHemiOctahedralDirection(const Float2& coords)
+    {
+        const Float2 uv = Float2(coords.X + coords.Y, coords.X - coords.Y) * 0.5f;
+        return Float3::Normalize(Float3(uv.X, 1.0f - Math::Abs(uv.X) - Math::Abs(uv.Y), uv.Y));
+    }
+
+    MaterialBase* GetImpostorMaterial(const ModelImpostor* impostor, const Model* model, int32 slotIndex)
+    {
+        MaterialBase* material = slotIndex < impostor->Materials.Count() ? impostor->Materials[slotIndex].Get() : nullptr;
+        if (!material)
+            material = model->MaterialSlots[slotIndex].Material.Get();
+        return material;
+    }
+}
+
+ModelImpostor::~ModelImpostor()
+{
+    ImpostorsPass::Instance()->Dequeue(this);
+    for (auto& texture : GBuffer)
+        SAFE_DELETE_GPU_RESOURCE(texture);
+    SAFE_DELETE_GPU_RESOURCE(Depth);
+}
+
+void ModelImpostor::RequestBake()
+{
+    if (Platform::InterlockedCompareExchange(&_state, (int64)States::Queued, (int64)States::None) == (int64)States::None)
+        ImpostorsPass::Instance()->Enqueue(this);
+}
+
+void ModelImpostor::Invalidate()
+{
+    Platform::AtomicStore(&_state, (int64)States::None);
+}
+
+String ImpostorsPass::ToString() const
+{
+    return TEXT("ImpostorsPass");
+}
+
+bool ImpostorsPass::Init()
+{
+    _psDraw = GPUDevice::Instance->CreatePipelineState();
+    _instances = New<DynamicStructuredBuffer>(0, (uint32)sizeof(InstanceData), false, TEXT("Impostors.Instances"));
+    return false;
+}
+
+bool ImpostorsPass::setupResources()
+{
+    if (!_shader)
+        return false; // Shader is loaded on the first use so don't block the renderer readiness
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+    if (shader->GetCB(0)->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+    if (!_psDraw->IsValid())
+    {
+        GPUPipelineState::Description psDesc = GPUPipelineState::Description::Default;
+        psDesc.VS = shader->GetVS("VS");
+        psDesc.PS = shader->GetPS("PS");
+        psDesc.CullMode = CullMode::TwoSided;
+        if (_psDraw->Init(psDesc))
+            return true;
+    }
+    return false;
+}
+
+void ImpostorsPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE_GPU_RESOURCE(_psDraw);
+    SAFE_DELETE(_instances);
+    _shader = nullptr;
+    _locker.Lock();
+    _queue.Resize(0);
+    _locker.Unlock();
+}
+
+void ImpostorsPass::Enqueue(ModelImpostor* impostor)
+{
+    ScopeLock lock(_locker);
+    _queue.Add(impostor);
+}
+
+void ImpostorsPass::Dequeue(ModelImpostor* impostor)
+{
+    ScopeLock lock(_locker);
+    _queue.RemoveAllKeepOrder(impostor);
+}
+
+void ImpostorsPass::Prepare(GPUContext* context)
+{
+    ScopeLock lock(_locker);
+    if (_queue.IsEmpty())
+        return;
+
+    // Load shader on the first use
+    if (!_shader)
+    {
+        _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/Impostors"));
+        if (!_shader)
+        {
+            // Impostors cannot be drawn without the shader so skip baking
+            for (ModelImpostor* impostor : _queue)
+                impostor->Invalidate();
+            _queue.Resize(0);
+            return;
+        }
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<ImpostorsPass, &ImpostorsPass::OnShaderReloading>(this);
+#endif
+        invalidateResources();
+    }
+
+    // Bake a single impostor per frame (models and materials can be still loading so keep them in a queue)
+    for (int32 i = 0; i < _queue.Count(); i++)
+    {
+        ModelImpostor* impostor = _queue[i];
+        if (impostor->GetState() != ModelImpostor::States::Queued)
+        {
+            // Invalidated or already baked
+            _queue.RemoveAtKeepOrder(i--);
+            continue;
+        }
+        if (Bake(context, impostor))
+            continue;
+        Platform::AtomicStore(&impostor->_state, (int64)ModelImpostor::States::Ready);
+        _queue.RemoveAtKeepOrder(i);
+        break;
+    }
+}
+
+bool ImpostorsPass::Bake(GPUContext* context, ModelImpostor* impostor)
+{
+    // Wait for the model and materials to be loaded
+    const Model* model = impostor->Model.Get();
+    if (!model || !model->CanBeRendered())
+        return true;
+    const int32 lodIndex = model->HighestResidentLODIndex();
+    const auto& meshes = model->LODs[lodIndex].Meshes;
+    for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+    {
+        const MaterialBase* material = GetImpostorMaterial(impostor, model, meshes[meshIndex].GetMaterialSlotIndex());
+        if (material && !material->IsLoaded())
+            return true;
+    }
+    PROFILE_GPU_CPU("Bake Impostor");
+
+    // Prepare atlases
+    const int32 framesCount = Math::Clamp(impostor->FramesCount, 1, 32);
+    const int32 frameResolution = Math::Clamp(impostor->FrameResolution, 8, GPUDevice::Instance->Limits.MaximumTexture2DSize / framesCount);
+    const int32 size = frameResolution * framesCount;
+    static const PixelFormat formats[4] = { GBUFFER0_FORMAT, GBUFFER1_FORMAT, GBUFFER2_FORMAT, GBUFFER3_FORMAT };
+    auto desc = GPUTextureDescription::New2D(size, size, GPU_DEPTH_BUFFER_PIXEL_FORMAT, GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil);
+    if (!impostor->Depth)
+        impostor->Depth = GPUDevice::Instance->CreateTexture(TEXT("Impostor.Depth"));
+    if (impostor->Depth->Width() != size && impostor->Depth->Init(desc))
+        return true;
+    desc.Flags = GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget;
+    for (int32 i = 0; i < 4; i++)
+    {
+        GPUTexture*& texture = impostor->GBuffer[i];
+        if (!texture)
+            texture = GPUDevice::Instance->CreateTexture(TEXT("Impostor.GBuffer"));
+        desc.Format = formats[i];
+        if (texture->Width() != size && texture->Init(desc))
+            return true;
+    }
+    context->ClearDepth(impostor->Depth->View());
+    context->Clear(impostor->GBuffer[0]->View(), Color::Transparent);
+    context->Clear(impostor->GBuffer[1]->View(), Color::Transparent);
+    context->Clear(impostor->GBuffer[2]->View(), Color(1, 0, 0, 0));
+    context->Clear(impostor->GBuffer[3]->View(), Color::Transparent);
+    desc.Format = PixelFormat::R11G11B10_Float;
+    GPUTexture* lightBuffer = RenderTargetPool::Get(desc);
+    RENDER_TARGET_POOL_SET_NAME(lightBuffer, "Impostor.Light");
+
+    // Collect the model draw calls (in the model local-space)
+    BoundingSphere bounds;
+    BoundingSphere::FromBox(model->LODs[lodIndex].GetBox(), bounds);
+    bounds.Radius = Math::Max(bounds.Radius, (Real)ZeroTolerance);
+    impostor->Bounds = bounds;
+    RenderContext renderContext;
+    renderContext.List = RenderList::GetFromPool();
+    RenderView& view = renderContext.View;
+    view.Pass = DrawPass::GBuffer;
+    view.IsOfflinePass = true;
+    view.IsSingleFrame = true;
+    view.Origin = Vector3::Zero;
+    for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+    {
+        const Mesh& mesh = meshes[meshIndex];
+        MaterialBase* material = GetImpostorMaterial(impostor, model, mesh.GetMaterialSlotIndex());
+        if (!material)
+            material = GPUDevice::Instance->GetDefaultMaterial();
+        mesh.Draw(renderContext, material, Matrix::Identity, StaticFlags::None, false, DrawPass::GBuffer, 0.0f, 0);
+    }
+    renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBuffer);
+    renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBufferNoDecals);
+
+    // Render frames with orthographic views from the upper hemisphere
+    const Float3 center = bounds.Center;
+    const float radius = (float)bounds.Radius;
+    view.Near = radius;
+    view.Far = radius * 3.0f;
+    Matrix projection, viewMatrix;
+    Matrix::Ortho(radius * 2.0f, radius * 2.0f, view.Near, view.Far, projection);
+    GPUTextureView* targetBuffers[5] =
+    {
+        lightBuffer->View(),
+        impostor->GBuffer[0]->View(),
+        impostor->GBuffer[1]->View(),
+        impostor->GBuffer[2]->View(),
+        impostor->GBuffer[3]->View(),
+    };
+    for (int32 y = 0; y < framesCount; y++)
+    {
+        for (int32 x = 0; x < framesCount; x++)
+        {
+            // Setup view (must match GetFrameAxes in the shader)
+            const Float2 coords((x + 0.5f) / framesCount * 2.0f - 1.0f, (y + 0.5f) / framesCount * 2.0f - 1.0f);
+            const Float3 direction = GetHemiOctahedralDirection(coords);
+            const Float3 eye = center + direction * (radius * 2.0f);
+            Matrix::LookAt(eye, center, Math::Abs(direction.Y) > 0.999f ? Float3::Forward : Float3::Up, viewMatrix);
+            view.SetUp(viewMatrix, projection);
+            view.Position = eye;
+            view.Direction = -direction;
+            view.PrepareCache(renderContext, (float)frameResolution, (float)frameResolution, Float2::Zero);
+
+            // Draw model into the atlas frame
+            context->SetViewportAndScissors(Viewport((float)(x * frameResolution), (float)(y * frameResolution), (float)frameResolution, (float)frameResolution));
+            context->SetRenderTarget(impostor->Depth->View(), ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+            renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBuffer);
+            renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBufferNoDecals);
+        }
+    }
+
+    // Cleanup
+    context->ResetRenderTarget();
+    RenderList::ReturnToPool(renderContext.List);
+    RenderTargetPool::Release(lightBuffer);
+    return false;
+}
+
+void ImpostorsPass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    const auto& draws = renderContext.List->ImpostorsDraws;
+    if (draws.Count() == 0 || checkIfSkipPass() || !_psDraw->IsValid())
+        return;
+    PROFILE_GPU_CPU("Impostors");
+
+    // Upload all instances at once
+    _instances->Clear();
+    for (const ImpostorsDraw& draw : draws)
+    {
+        if (draw.Impostor->IsReady())
+            _instances->Write(draw.Instances.Get(), draw.Instances.Count() * sizeof(InstanceData));
+    }
+    if (_instances->Data.IsEmpty())
+        return;
+    _instances->Flush(context);
+
+    // Draw instances (quads are generated in the vertex shader)
+    const auto cb = _shader->GetShader()->GetCB(0);
+    Data data;
+    Matrix::Transpose(renderContext.View.Frustum.GetMatrix(), data.ViewProjection);
+    data.ViewPosition = renderContext.View.Position;
+    data.Dummy0 = Float2::Zero;
+    context->BindSR(0, _instances->GetBuffer()->View());
+    context->SetState(_psDraw);
+    uint32 instanceOffset = 0;
+    for (const ImpostorsDraw& draw : draws)
+    {
+        const ModelImpostor* impostor = draw.Impostor;
+        if (!impostor->IsReady())
+            continue;
+        data.FramesCount = (float)Math::Clamp(impostor->FramesCount, 1, 32);
+        data.BoundsCenter = impostor->Bounds.Center;
+        data.BoundsRadius = (float)impostor->Bounds.Radius;
+        data.FrameHalfTexel = 0.5f * data.FramesCount / (float)impostor->Depth->Width();
+        data.InstanceOffset = instanceOffset;
+        context->UpdateCB(cb, &data);
+        context->BindCB(0, cb);
+        context->BindSR(1, impostor->GBuffer[0]);
+        context->BindSR(2, impostor->GBuffer[1]);
+        context->BindSR(3, impostor->GBuffer[2]);
+        context->BindSR(4, impostor->GBuffer[3]);
+        context->BindSR(5, impostor->Depth);
+        context->DrawInstanced(draw.Instances.Count() * 6, 1);
+        instanceOffset += draw.Instances.Count();
+    }
+    context->ResetSR();
+}
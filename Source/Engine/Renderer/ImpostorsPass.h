@@ -0,0 +1,154 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+
+class GPUTexture;
+class DynamicStructuredBuffer;
+
+/// <summary>
+/// The impostor of the model. Contains the atlas of the model views from the upper hemisphere (hemi-octahedral layout of frames) with the baked GBuffer data and the depth. Used to draw the distant model instances (eg. foliage) as quads facing the view. Baked on a GPU by the ImpostorsPass on the first use.
+/// </summary>
+class FLAXENGINE_API ModelImpostor
+{
+    friend class ImpostorsPass;
+public:
+    /// <summary>
+    /// The impostor states.
+    /// </summary>
+    enum class States
+    {
+        // Not baked yet.
+        None,
+        // Queued for the baking.
+        Queued,
+        // Baked and ready to draw.
+        Ready,
+    };
+
+private:
+    mutable volatile int64 _state = (int64)States::None;
+
+public:
+    /// <summary>
+    /// The model to bake.
+    /// </summary>
+    AssetReference<Model> Model;
+
+    /// <summary>
+    /// The materials overrides per model material slot (null slots use the model materials).
+    /// </summary>
+    Array<AssetReference<MaterialBase>> Materials;
+
+    /// <summary>
+    /// The resolution of the single frame (view) in the atlas (in pixels).
+    /// </summary>
+    int32 FrameResolution = 128;
+
+    /// <summary>
+    /// The amount of frames per atlas side (total frames count is squared).
+    /// </summary>
+    int32 FramesCount = 8;
+
+    /// <summary>
+    /// The local-space bounds of the baked model.
+    /// </summary>
+    BoundingSphere Bounds = BoundingSphere::Empty;
+
+    /// <summary>
+    /// The atlas textures with the baked GBuffer (layout matches the GBuffer render targets).
+    /// </summary>
+    GPUTexture* GBuffer[4] = {};
+
+    /// <summary>
+    /// The atlas texture with the baked depth (normalized within the frame bounds).
+    /// </summary>
+    GPUTexture* Depth = nullptr;
+
+public:
+    ModelImpostor() = default;
+    ModelImpostor(const ModelImpostor&) = delete;
+    ModelImpostor& operator=(const ModelImpostor&) = delete;
+    ~ModelImpostor();
+
+public:
+    /// <summary>
+    /// Gets the impostor state.
+    /// </summary>
+    FORCE_INLINE States GetState() const
+    {
+        return (States)Platform::AtomicRead(&_state);
+    }
+
+    /// <summary>
+    /// Determines whether the impostor has been baked and can be drawn.
+    /// </summary>
+    FORCE_INLINE bool IsReady() const
+    {
+        return GetState() == States::Ready;
+    }
+
+    /// <summary>
+    /// Queues the impostor for the baking if it's not baked yet. Thread-safe.
+    /// </summary>
+    void RequestBake();
+
+    /// <summary>
+    /// Invalidates the baked impostor (eg. after the model or materials change). Impostor needs to be requested for the baking again.
+    /// </summary>
+    void Invalidate();
+};
+
+/// <summary>
+/// The model impostors rendering service. Bakes the models impostors on a GPU (rendered into the GBuffer atlas of views) and draws the impostors instances into the GBuffer.
+/// </summary>
+class ImpostorsPass : public RendererPass<ImpostorsPass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUPipelineState* _psDraw = nullptr;
+    DynamicStructuredBuffer* _instances = nullptr;
+    CriticalSection _locker;
+    Array<ModelImpostor*> _queue;
+
+public:
+    /// <summary>
+    /// Bakes the queued impostors (one per frame). Called by the renderer before collecting the draw calls.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    void Prepare(GPUContext* context);
+
+    /// <summary>
+    /// Draws the impostors instances of the render list into the GBuffer (render targets need to be bound).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+private:
+    void Enqueue(ModelImpostor* impostor);
+    void Dequeue(ModelImpostor* impostor);
+    bool Bake(GPUContext* context, ModelImpostor* impostor);
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _psDraw->ReleaseGPU();
+        invalidateResources();
+    }
+#endif
+
+    friend ModelImpostor;
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
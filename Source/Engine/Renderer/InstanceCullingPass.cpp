@@ -0,0 +1,415 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "InstanceCullingPass.h"
+#include "RenderList.h"
+#include "OcclusionCullingPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// Those defines must match the HLSL
+#define INSTANCE_CULLING_GROUP_SIZE 64
+
+// The minimum amount of instances in a batch to be culled on a GPU (smaller batches are drawn directly)
+#define INSTANCE_CULLING_MIN_INSTANCES 64
+
+PACK_STRUCT(struct Data {
+    Float4 FrustumPlanes[6];
+    Matrix HiZViewProjection;
+    Float2 HiZSize;
+    float BoundsInflate;
+    uint32 HasHiZ;
+    Float3 ViewPosition;
+    float ScreenMultiple;
+    Float3 LODViewPosition;
+    float ProjectionDistanceScale;
+    float LODDistanceFactorSqrt;
+    int32 LODBias;
+    Float2 Dummy0;
+    });
+
+PACK_STRUCT(struct ResidentData {
+    Float4 Bounds;
+    Float3 OriginOffset;
+    float CullDistance;
+    float CullDistanceRandomRange;
+    float MinScreenRadiusSq;
+    uint32 LODsCount;
+    uint32 MinLOD;
+    Float4 LODScreenRadiusSq[2];
+    uint32 RangesOffset;
+    uint32 OutputOffset;
+    uint32 OutputCapacity;
+    uint32 CountersOffset;
+    });
+
+// Culled instances batch. Matches the shader type.
+PACK_STRUCT(struct InstanceCullingBatch {
+    Float4 Bounds;
+    uint32 InstanceOffset;
+    uint32 InstanceCount;
+    uint32 ArgsOffset;
+    uint32 Padding;
+    });
+
+// Culled range of the GPU-resident instances (up to the group size). Matches the shader type.
+PACK_STRUCT(struct InstanceCullingRange {
+    uint32 InstanceOffset;
+    uint32 InstanceCount;
+    });
+
+static_assert(sizeof(InstanceData) == 64, "Invalid instance data size. Update the instances culling shader.");
+static_assert(MODEL_MAX_LODS <= 8, "Invalid model LODs limit. Update the instances culling shader.");
+
+String InstanceCullingPass::ToString() const
+{
+    return TEXT("InstanceCullingPass");
+}
+
+bool InstanceCullingPass::Prepare()
+{
+    if (!Graphics::EnableGPUInstanceCulling || !_supported)
+        return false;
+
+    // Load shader on the first use
+    if (!_shader)
+    {
+        const auto& limits = GPUDevice::Instance->Limits;
+        _shader = limits.HasCompute && limits.HasDrawIndirect ? Content::LoadAsyncInternal<Shader>(TEXT("Shaders/InstanceCulling")) : nullptr;
+        if (!_shader)
+        {
+            _supported = false;
+            return false;
+        }
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<InstanceCullingPass, &InstanceCullingPass::OnShaderReloading>(this);
+#endif
+        invalidateResources();
+    }
+    return !checkIfSkipPass();
+}
+
+bool InstanceCullingPass::CanCull(const RenderContext& renderContext, int32 instancesCount)
+{
+    if (instancesCount < INSTANCE_CULLING_MIN_INSTANCES)
+        return false;
+    return Prepare();
+}
+
+bool InstanceCullingPass::CanCullResident(const RenderContext& renderContext) const
+{
+    if (!Graphics::EnableGPUInstanceCulling || !_supported || !_csCullResidentInstances || !GPUDevice::Instance->Limits.HasInstancing)
+        return false;
+
+    // Shadow maps can be recorded on the deferred contexts that don't run the culling
+    if (renderContext.View.Pass == DrawPass::Depth && Graphics::EnableParallelCommandRecording && GPUDevice::Instance->Limits.HasDeferredContexts)
+        return false;
+    return true;
+}
+
+bool InstanceCullingPass::setupResources()
+{
+    if (!_shader)
+        return false; // Shader is loaded on the first use so don't block the renderer readiness
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+    _cb0 = shader->GetCB(0);
+    if (!_cb0 || _cb0->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+    _cb1 = shader->GetCB(1);
+    if (!_cb1 || _cb1->GetSize() != sizeof(ResidentData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 1, ResidentData);
+        return true;
+    }
+    _csCullInstances = shader->GetCS("CS_CullInstances");
+    _csCullResidentInstances = shader->GetCS("CS_CullResidentInstances");
+    if (!_instancesBuffer)
+        _instancesBuffer = New<DynamicStructuredBuffer>(64 * sizeof(InstanceData), sizeof(InstanceData), false, TEXT("InstanceCulling.Instances"));
+    if (!_batchesBuffer)
+        _batchesBuffer = New<DynamicStructuredBuffer>(64 * sizeof(InstanceCullingBatch), sizeof(InstanceCullingBatch), false, TEXT("InstanceCulling.Batches"));
+    if (!_rangesBuffer)
+        _rangesBuffer = New<DynamicStructuredBuffer>(256 * sizeof(InstanceCullingRange), sizeof(InstanceCullingRange), false, TEXT("InstanceCulling.Ranges"));
+    return false;
+}
+
+void InstanceCullingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE(_instancesBuffer);
+    SAFE_DELETE(_batchesBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_outputInstancesBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_argsBuffer);
+    _argsData.Resize(0);
+    SAFE_DELETE(_rangesBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_residentInstancesBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_residentArgsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_residentCountersBuffer);
+    _residentArgsData.Resize(0);
+    _residentCountersData.Resize(0);
+    _csCullInstances = nullptr;
+    _csCullResidentInstances = nullptr;
+    _cb0 = nullptr;
+    _cb1 = nullptr;
+    _shader = nullptr;
+}
+
+bool InstanceCullingPass::Cull(const RenderContext& renderContext, GPUContext* context, const Array<Batch, RendererAllocation>& batches, GPUBuffer*& instancesBuffer, GPUBuffer*& argsBuffer)
+{
+    if (batches.IsEmpty() || checkIfSkipPass())
+        return true;
+    PROFILE_GPU_CPU("Instance Culling");
+
+    // Prepare input data and the initial indirect draw arguments (with zero instances)
+    _instancesBuffer->Clear();
+    _batchesBuffer->Clear();
+    _argsData.Resize(batches.Count() * sizeof(GPUDrawIndexedIndirectArgs));
+    auto args = (GPUDrawIndexedIndirectArgs*)_argsData.Get();
+    uint32 instancesCount = 0, maxBatchInstances = 0;
+    for (int32 i = 0; i < batches.Count(); i++)
+    {
+        const Batch& batch = batches.Get()[i];
+        _instancesBuffer->Write(batch.Instances, batch.InstancesCount * sizeof(InstanceData));
+        InstanceCullingBatch data;
+        data.Bounds = Float4(Float3(batch.Bounds.Center), (float)batch.Bounds.Radius);
+        data.InstanceOffset = instancesCount;
+        data.InstanceCount = batch.InstancesCount;
+        data.ArgsOffset = i * sizeof(GPUDrawIndexedIndirectArgs);
+        data.Padding = 0;
+        _batchesBuffer->Write(data);
+        args[i].IndicesCount = batch.IndicesCount;
+        args[i].InstanceCount = 0;
+        args[i].StartIndex = batch.StartIndex;
+        args[i].StartVertex = 0;
+        args[i].StartInstance = instancesCount;
+        instancesCount += batch.InstancesCount;
+        maxBatchInstances = Math::Max<uint32>(maxBatchInstances, batch.InstancesCount);
+    }
+    _instancesBuffer->Flush(context);
+    _batchesBuffer->Flush(context);
+
+    // Ensure to have enough space for the output
+    if (!_outputInstancesBuffer)
+        _outputInstancesBuffer = GPUDevice::Instance->CreateBuffer(TEXT("InstanceCulling.OutputInstances"));
+    const uint32 outputInstancesSize = instancesCount * sizeof(InstanceData);
+    if (_outputInstancesBuffer->GetSize() < outputInstancesSize)
+    {
+        if (_outputInstancesBuffer->Init(GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(outputInstancesSize), GPUBufferFlags::VertexBuffer | GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess)))
+            return true;
+    }
+    if (!_argsBuffer)
+        _argsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("InstanceCulling.Args"));
+    if (_argsBuffer->GetSize() < (uint32)_argsData.Count())
+    {
+        if (_argsBuffer->Init(GPUBufferDescription::Raw(Math::RoundUpToPowerOf2((uint32)_argsData.Count()), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+            return true;
+    }
+    context->UpdateBuffer(_argsBuffer, _argsData.Get(), _argsData.Count());
+
+    // Setup constants
+    GPUTexture* hiZ = SetupViewData(renderContext, context);
+
+    // Cull instances (one group row per batch)
+    context->BindSR(0, _instancesBuffer->GetBuffer()->View());
+    context->BindSR(1, _batchesBuffer->GetBuffer()->View());
+    context->BindSR(2, hiZ);
+    context->BindUA(0, _outputInstancesBuffer->View());
+    context->BindUA(1, _argsBuffer->View());
+    context->Dispatch(_csCullInstances, Math::DivideAndRoundUp<uint32>(maxBatchInstances, INSTANCE_CULLING_GROUP_SIZE), batches.Count(), 1);
+    context->ResetUA();
+    context->ResetSR();
+
+    instancesBuffer = _outputInstancesBuffer;
+    argsBuffer = _argsBuffer;
+    return false;
+}
+
+bool InstanceCullingPass::CullResident(const RenderContext& renderContext, GPUContext* context, const Array<const ResidentInstancesDraw*, RendererAllocation>& draws, const Array<ResidentArgs, RendererAllocation>& args, GPUBuffer*& instancesBuffer, GPUBuffer*& argsBuffer)
+{
+    if (draws.IsEmpty() || args.IsEmpty() || !_csCullResidentInstances || checkIfSkipPass())
+        return true;
+    PROFILE_GPU_CPU("Resident Instance Culling");
+
+    // Prepare the ranges to cull and the layout of the output (each draw has a separate region for each drawn LOD)
+    Array<ResidentData, RendererAllocation> drawsData;
+    drawsData.Resize(draws.Count());
+    Array<GPUBuffer*, RendererAllocation> drawsBuffers;
+    drawsBuffers.Resize(draws.Count());
+    _rangesBuffer->Clear();
+    uint32 outputCount = 0, countersCount = 0;
+    for (int32 i = 0; i < draws.Count(); i++)
+    {
+        const ResidentInstancesDraw& draw = *draws.Get()[i];
+        ResidentData& data = drawsData.Get()[i];
+        drawsBuffers.Get()[i] = draw.Instances ? draw.Instances->Upload(context) : nullptr;
+        uint32 capacity = 0;
+        data.RangesOffset = _rangesBuffer->Data.Count() / sizeof(InstanceCullingRange);
+        for (const Int2& range : draw.Ranges)
+        {
+            InstanceCullingRange rangeData;
+            rangeData.InstanceOffset = range.X;
+            rangeData.InstanceCount = range.Y;
+            _rangesBuffer->Write(rangeData);
+            capacity += range.Y;
+        }
+        const int32 lodsCount = Math::Clamp(draw.LODsCount, 1, MODEL_MAX_LODS);
+        const int32 minLOD = Math::Clamp(draw.MinLOD, 0, lodsCount - 1);
+        data.Bounds = Float4(Float3(draw.Bounds.Center), (float)draw.Bounds.Radius);
+        data.OriginOffset = draw.OriginOffset;
+        data.CullDistance = draw.CullDistance;
+        data.CullDistanceRandomRange = draw.CullDistanceRandomRange;
+        data.MinScreenRadiusSq = Math::Square(draw.MinScreenSize * 0.5f);
+        data.LODsCount = lodsCount;
+        data.MinLOD = minLOD;
+        float* lodScreenRadiusSq = (float*)data.LODScreenRadiusSq;
+        for (int32 lod = 0; lod < 8; lod++)
+            lodScreenRadiusSq[lod] = lod < lodsCount ? Math::Square(draw.LODScreenSizes[lod] * 0.5f) : 0.0f;
+        data.OutputOffset = outputCount;
+        data.OutputCapacity = capacity;
+        data.CountersOffset = countersCount;
+        outputCount += capacity * (lodsCount - minLOD);
+        countersCount += lodsCount - minLOD;
+    }
+    if (outputCount == 0)
+        return true;
+    _rangesBuffer->Flush(context);
+
+    // Prepare the initial indirect draw arguments (with zero instances)
+    _residentArgsData.Resize(args.Count() * sizeof(GPUDrawIndexedIndirectArgs));
+    auto argsData = (GPUDrawIndexedIndirectArgs*)_residentArgsData.Get();
+    for (int32 i = 0; i < args.Count(); i++)
+    {
+        const ResidentArgs& e = args.Get()[i];
+        const ResidentData& data = drawsData[e.Draw];
+        const uint32 lod = Math::Clamp<uint32>((uint32)e.LOD, data.MinLOD, data.LODsCount - 1);
+        argsData[i].IndicesCount = e.IndicesCount;
+        argsData[i].InstanceCount = 0;
+        argsData[i].StartIndex = e.StartIndex;
+        argsData[i].StartVertex = 0;
+        argsData[i].StartInstance = data.OutputOffset + (lod - data.MinLOD) * data.OutputCapacity;
+    }
+    _residentCountersData.Resize(countersCount);
+    _residentCountersData.SetAll(0);
+
+    // Ensure to have enough space for the output
+    if (!_residentInstancesBuffer)
+        _residentInstancesBuffer = GPUDevice::Instance->CreateBuffer(TEXT("InstanceCulling.ResidentInstances"));
+    const uint32 outputInstancesSize = outputCount * sizeof(InstanceData);
+    if (_residentInstancesBuffer->GetSize() < outputInstancesSize)
+    {
+        if (_residentInstancesBuffer->Init(GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(outputInstancesSize), GPUBufferFlags::VertexBuffer | GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess)))
+            return true;
+    }
+    if (!_residentArgsBuffer)
+        _residentArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("InstanceCulling.ResidentArgs"));
+    if (_residentArgsBuffer->GetSize() < (uint32)_residentArgsData.Count())
+    {
+        if (_residentArgsBuffer->Init(GPUBufferDescription::Raw(Math::RoundUpToPowerOf2((uint32)_residentArgsData.Count()), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+            return true;
+    }
+    if (!_residentCountersBuffer)
+        _residentCountersBuffer = GPUDevice::Instance->CreateBuffer(TEXT("InstanceCulling.ResidentCounters"));
+    const uint32 countersSize = countersCount * sizeof(uint32);
+    if (_residentCountersBuffer->GetSize() < countersSize)
+    {
+        if (_residentCountersBuffer->Init(GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(countersSize), GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess)))
+            return true;
+    }
+    context->UpdateBuffer(_residentArgsBuffer, _residentArgsData.Get(), _residentArgsData.Count());
+    context->UpdateBuffer(_residentCountersBuffer, _residentCountersData.Get(), countersSize);
+
+    // Setup constants
+    GPUTexture* hiZ = SetupViewData(renderContext, context);
+
+    // Cull instances (one group per range, separate dispatch for each draw to bind its resident instances)
+    context->BindSR(1, _rangesBuffer->GetBuffer()->View());
+    context->BindSR(2, hiZ);
+    context->BindUA(0, _residentInstancesBuffer->View());
+    context->BindUA(1, _residentCountersBuffer->View());
+    for (int32 i = 0; i < draws.Count(); i++)
+    {
+        GPUBuffer* buffer = drawsBuffers.Get()[i];
+        ResidentData& data = drawsData.Get()[i];
+        int32 rangesCount = draws.Get()[i]->Ranges.Count();
+        if (!buffer || rangesCount == 0)
+            continue;
+        context->BindSR(0, buffer->View());
+        context->BindCB(1, _cb1);
+        while (rangesCount > 0)
+        {
+            // Split into multiple dispatches to don't exceed the groups count limit
+            const int32 groupsCount = Math::Min(rangesCount, GPU_MAX_CS_DISPATCH_THREAD_GROUPS);
+            context->UpdateCB(_cb1, &data);
+            context->Dispatch(_csCullResidentInstances, groupsCount, 1, 1);
+            data.RangesOffset += groupsCount;
+            rangesCount -= groupsCount;
+        }
+    }
+    context->ResetUA();
+    context->ResetSR();
+
+    // Copy the visible instances counters into the indirect draw arguments (instance count is the second argument)
+    for (int32 i = 0; i < args.Count(); i++)
+    {
+        const ResidentArgs& e = args.Get()[i];
+        const ResidentData& data = drawsData[e.Draw];
+        const uint32 lod = Math::Clamp<uint32>((uint32)e.LOD, data.MinLOD, data.LODsCount - 1);
+        context->CopyBuffer(_residentArgsBuffer, _residentCountersBuffer, sizeof(uint32), i * sizeof(GPUDrawIndexedIndirectArgs) + 4, (data.CountersOffset + lod - data.MinLOD) * sizeof(uint32));
+    }
+
+    instancesBuffer = _residentInstancesBuffer;
+    argsBuffer = _residentArgsBuffer;
+    return false;
+}
+
+GPUTexture* InstanceCullingPass::SetupViewData(const RenderContext& renderContext, GPUContext* context)
+{
+    const auto& view = renderContext.View;
+    const auto& lodView = renderContext.LodProxyView ? *renderContext.LodProxyView : view;
+    Data data;
+    for (int32 i = 0; i < 6; i++)
+    {
+        const Plane plane = view.CullingFrustum.GetPlane(i);
+        data.FrustumPlanes[i] = Float4(Float3(plane.Normal), (float)plane.D);
+    }
+    Matrix hiZViewProjection;
+    float boundsInflate;
+    GPUTexture* hiZ = OcclusionCullingPass::Instance()->GetHiZ(renderContext, hiZViewProjection, boundsInflate);
+    if (hiZ)
+    {
+        Matrix::Transpose(hiZViewProjection, data.HiZViewProjection);
+        data.HiZSize = Float2((float)hiZ->Width(), (float)hiZ->Height());
+        data.BoundsInflate = boundsInflate;
+        data.HasHiZ = 1;
+    }
+    else
+    {
+        data.HiZViewProjection = Matrix::Identity;
+        data.HiZSize = Float2::Zero;
+        data.BoundsInflate = 0.0f;
+        data.HasHiZ = 0;
+    }
+    data.ViewPosition = view.Position;
+    data.ScreenMultiple = 0.5f * Math::Max(lodView.Projection.Values[0][0], lodView.Projection.Values[1][1]);
+    data.LODViewPosition = lodView.Position;
+    data.ProjectionDistanceScale = lodView.Projection.Values[2][3];
+    data.LODDistanceFactorSqrt = view.ModelLODDistanceFactorSqrt;
+    data.LODBias = view.ModelLODBias;
+    data.Dummy0 = Float2::Zero;
+    context->UpdateCB(_cb0, &data);
+    context->BindCB(0, _cb0);
+    return hiZ;
+}
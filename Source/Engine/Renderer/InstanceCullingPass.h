@@ -0,0 +1,134 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "RendererAllocation.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+
+struct InstanceData;
+struct ResidentInstancesDraw;
+
+/// <summary>
+/// GPU-driven instances culling pass. Culls the instanced draw call batches on a GPU (against view frustum and Hi-Z) and compacts the visible instances into the indirect draw arguments. Uses compute shaders.
+/// </summary>
+class FLAXENGINE_API InstanceCullingPass : public RendererPass<InstanceCullingPass>
+{
+public:
+    /// <summary>
+    /// The instanced draw call batch to cull.
+    /// </summary>
+    struct Batch
+    {
+        // The instances data.
+        const InstanceData* Instances;
+        // The instances count.
+        int32 InstancesCount;
+        // The local-space bounds of the geometry.
+        BoundingSphere Bounds;
+        // The indices count of the geometry.
+        uint32 IndicesCount;
+        // The start index of the geometry.
+        uint32 StartIndex;
+    };
+
+    /// <summary>
+    /// The indirect draw of the model LOD geometry with the GPU-resident instances (instances count is generated by the culling).
+    /// </summary>
+    struct ResidentArgs
+    {
+        // The index of the GPU-resident instances draw (in the draws list).
+        int32 Draw;
+        // The model LOD index.
+        int32 LOD;
+        // The indices count of the geometry.
+        uint32 IndicesCount;
+        // The start index of the geometry.
+        uint32 StartIndex;
+    };
+
+private:
+    bool _supported = true;
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csCullInstances = nullptr;
+    GPUShaderProgramCS* _csCullResidentInstances = nullptr;
+    GPUConstantBuffer* _cb0 = nullptr;
+    GPUConstantBuffer* _cb1 = nullptr;
+    class DynamicStructuredBuffer* _instancesBuffer = nullptr;
+    class DynamicStructuredBuffer* _batchesBuffer = nullptr;
+    GPUBuffer* _outputInstancesBuffer = nullptr;
+    GPUBuffer* _argsBuffer = nullptr;
+    Array<byte> _argsData;
+    class DynamicStructuredBuffer* _rangesBuffer = nullptr;
+    GPUBuffer* _residentInstancesBuffer = nullptr;
+    GPUBuffer* _residentArgsBuffer = nullptr;
+    GPUBuffer* _residentCountersBuffer = nullptr;
+    Array<byte> _residentArgsData;
+    Array<uint32> _residentCountersData;
+
+public:
+    /// <summary>
+    /// Prepares the pass for the GPU culling (loads the shader on the first use). Must be called from the rendering thread.
+    /// </summary>
+    /// <returns>True if GPU culling is supported and ready, otherwise false.</returns>
+    bool Prepare();
+
+    /// <summary>
+    /// Checks if the instanced draw call batch can be culled on a GPU.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="instancesCount">The batch instances count.</param>
+    /// <returns>True if can use GPU culling for the batch, otherwise false.</returns>
+    bool CanCull(const RenderContext& renderContext, int32 instancesCount);
+
+    /// <summary>
+    /// Culls the instanced draw call batches on a GPU.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="batches">The batches to cull.</param>
+    /// <param name="instancesBuffer">The output vertex buffer with culled instances data (compacted).</param>
+    /// <param name="argsBuffer">The output buffer with indirect draw arguments (GPUDrawIndexedIndirectArgs for each batch).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Cull(const RenderContext& renderContext, GPUContext* context, const Array<Batch, RendererAllocation>& batches, GPUBuffer*& instancesBuffer, GPUBuffer*& argsBuffer);
+
+    /// <summary>
+    /// Checks if the GPU-resident instances can be culled on a GPU for the given view. Can be called from the draw calls collecting jobs (doesn't load the shader, see Prepare).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>True if can use GPU-resident instances for the view, otherwise false.</returns>
+    bool CanCullResident(const RenderContext& renderContext) const;
+
+    /// <summary>
+    /// Culls the GPU-resident instances on a GPU (against view frustum, Hi-Z and cull distance) and selects the model LOD for each visible instance.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="draws">The GPU-resident instances draws to cull.</param>
+    /// <param name="args">The indirect draws of the model LODs geometry.</param>
+    /// <param name="instancesBuffer">The output vertex buffer with culled instances data (compacted per LOD).</param>
+    /// <param name="argsBuffer">The output buffer with indirect draw arguments (GPUDrawIndexedIndirectArgs for each args entry).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool CullResident(const RenderContext& renderContext, GPUContext* context, const Array<const ResidentInstancesDraw*, RendererAllocation>& draws, const Array<ResidentArgs, RendererAllocation>& args, GPUBuffer*& instancesBuffer, GPUBuffer*& argsBuffer);
+
+private:
+    GPUTexture* SetupViewData(const RenderContext& renderContext, GPUContext* context);
+
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csCullInstances = nullptr;
+        _csCullResidentInstances = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,188 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "LightClustersPass.h"
+#include "RenderList.h"
+#include "Engine/Core/Math/Int3.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// Those defines must match the HLSL
+#define LIGHT_CLUSTERS_GROUP_SIZE 64
+#define LIGHT_CLUSTERS_MAX_LIGHTS 32
+
+// The size of the clusters grid tile (in pixels)
+#define LIGHT_CLUSTERS_TILE_SIZE 64
+
+// The amount of the clusters grid depth slices (distributed exponentially from the view near to the far plane)
+#define LIGHT_CLUSTERS_DEPTH_SLICES 32
+
+PACK_STRUCT(struct Data {
+    Matrix ViewMatrix;
+    Matrix InvProjectionMatrix;
+    LightClustersData LightClusters;
+    });
+
+class LightClustersCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    DynamicStructuredBuffer Lights;
+    GPUBuffer* ClusterLights = nullptr;
+    LightClustersPass::BindingData Result;
+
+    LightClustersCustomBuffer()
+        : Lights(64 * sizeof(LightData), sizeof(LightData), false, TEXT("LightClusters.Lights"))
+    {
+    }
+
+    ~LightClustersCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(ClusterLights);
+    }
+};
+
+template<typename T>
+void WriteClusterLights(DynamicStructuredBuffer& buffer, const Array<T>& lights, bool useShadows, bool deferred, uint32& count)
+{
+    LightData data;
+    for (const T& light : lights)
+    {
+        if (LightClustersPass::IsDeferredLight(light, useShadows) == deferred)
+        {
+            light.SetupLightData(&data, false);
+            buffer.Write(data);
+            count++;
+        }
+    }
+}
+
+String LightClustersPass::ToString() const
+{
+    return TEXT("LightClustersPass");
+}
+
+bool LightClustersPass::setupResources()
+{
+    if (!_shader)
+        return false; // Shader is loaded on the first use so don't block the renderer readiness
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+    _cb0 = shader->GetCB(0);
+    if (!_cb0 || _cb0->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+    _csBuildClusters = shader->GetCS("CS_BuildClusters");
+    return false;
+}
+
+void LightClustersPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _csBuildClusters = nullptr;
+    _cb0 = nullptr;
+    _shader = nullptr;
+}
+
+bool LightClustersPass::Render(RenderContext& renderContext, GPUContext* context, bool useShadows)
+{
+    const auto& view = renderContext.View;
+    auto& list = *renderContext.List;
+    if (!Graphics::EnableClusteredLighting || !_supported || !renderContext.Buffers || view.IsOrthographicProjection() || list.PointLights.Count() + list.SpotLights.Count() == 0)
+        return true;
+
+    // Load shader on the first use
+    if (!_shader)
+    {
+        const auto device = GPUDevice::Instance;
+        _shader = device->Limits.HasCompute && device->GetFeatureLevel() >= FeatureLevel::SM5 ? Content::LoadAsyncInternal<Shader>(TEXT("Shaders/LightClusters")) : nullptr;
+        if (!_shader)
+        {
+            _supported = false;
+            return true;
+        }
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<LightClustersPass, &LightClustersPass::OnShaderReloading>(this);
+#endif
+        invalidateResources();
+    }
+    if (checkIfSkipPass() || !_csBuildClusters)
+        return true;
+    PROFILE_GPU_CPU("Light Clusters");
+    auto& clusters = *renderContext.Buffers->GetCustomBuffer<LightClustersCustomBuffer>(TEXT("LightClusters"));
+
+    // Upload lights (the ones that can be shaded in a single deferred pass go first)
+    clusters.Lights.Clear();
+    uint32 lightsCount = 0;
+    WriteClusterLights(clusters.Lights, list.PointLights, useShadows, true, lightsCount);
+    WriteClusterLights(clusters.Lights, list.SpotLights, useShadows, true, lightsCount);
+    const uint32 deferredLightsCount = lightsCount;
+    WriteClusterLights(clusters.Lights, list.PointLights, useShadows, false, lightsCount);
+    WriteClusterLights(clusters.Lights, list.SpotLights, useShadows, false, lightsCount);
+    clusters.Lights.Flush(context);
+
+    // Ensure to have enough space for the clusters lights lists
+    const Int3 gridSize(Math::DivideAndRoundUp(renderContext.Buffers->GetWidth(), LIGHT_CLUSTERS_TILE_SIZE), Math::DivideAndRoundUp(renderContext.Buffers->GetHeight(), LIGHT_CLUSTERS_TILE_SIZE), LIGHT_CLUSTERS_DEPTH_SLICES);
+    const uint32 clustersCount = gridSize.X * gridSize.Y * gridSize.Z;
+    const uint32 clusterLightsCount = clustersCount * (LIGHT_CLUSTERS_MAX_LIGHTS + 1);
+    if (!clusters.ClusterLights)
+        clusters.ClusterLights = GPUDevice::Instance->CreateBuffer(TEXT("LightClusters.ClusterLights"));
+    if (clusters.ClusterLights->GetElementsCount() < clusterLightsCount)
+    {
+        if (clusters.ClusterLights->Init(GPUBufferDescription::Typed(clusterLightsCount, PixelFormat::R32_UInt, true)))
+            return true;
+    }
+
+    // Setup constants (depth slice = log(depth) * scale + bias)
+    Data data;
+    auto& constants = data.LightClusters;
+    constants.GridSize[0] = gridSize.X;
+    constants.GridSize[1] = gridSize.Y;
+    constants.GridSize[2] = gridSize.Z;
+    constants.LightsCount = lightsCount;
+    constants.UVToCluster = Float2((float)renderContext.Buffers->GetWidth(), (float)renderContext.Buffers->GetHeight()) / (float)LIGHT_CLUSTERS_TILE_SIZE;
+    const float depthScale = (float)LIGHT_CLUSTERS_DEPTH_SLICES / Math::Log(view.Far / view.Near);
+    constants.DepthScaleBias = Float2(depthScale, -Math::Log(view.Near) * depthScale);
+    constants.DeferredLightsCount = deferredLightsCount;
+    constants.Dummy0 = Float3::Zero;
+    Matrix::Transpose(view.View, data.ViewMatrix);
+    Matrix::Transpose(view.IP, data.InvProjectionMatrix);
+    context->UpdateCB(_cb0, &data);
+    context->BindCB(0, _cb0);
+
+    // Build clusters
+    context->BindSR(0, clusters.Lights.GetBuffer()->View());
+    context->BindUA(0, clusters.ClusterLights->View());
+    context->Dispatch(_csBuildClusters, Math::DivideAndRoundUp<uint32>(clustersCount, LIGHT_CLUSTERS_GROUP_SIZE), 1, 1);
+    context->ResetUA();
+    context->ResetSR();
+
+    clusters.LastFrameUsed = Engine::FrameCount;
+    clusters.Result.Constants = constants;
+    clusters.Result.Lights = clusters.Lights.GetBuffer()->View();
+    clusters.Result.ClusterLights = clusters.ClusterLights->View();
+    return false;
+}
+
+bool LightClustersPass::Get(const RenderBuffers* buffers, BindingData& result)
+{
+    auto* clusters = buffers ? buffers->FindCustomBuffer<LightClustersCustomBuffer>(TEXT("LightClusters")) : nullptr;
+    if (clusters && clusters->LastFrameUsed == Engine::FrameCount)
+    {
+        result = clusters->Result;
+        return false;
+    }
+    return true;
+}
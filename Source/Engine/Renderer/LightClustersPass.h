@@ -0,0 +1,79 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Config.h"
+
+class GPUBufferView;
+
+/// <summary>
+/// Clustered lights culling pass. Splits the view frustum into a grid of clusters (screen tiles and exponential depth slices) and builds the list of the local lights affecting each cluster on a GPU (uses compute shader). Used by the deferred lighting and the forward shading materials.
+/// </summary>
+class FLAXENGINE_API LightClustersPass : public RendererPass<LightClustersPass>
+{
+public:
+    /// <summary>
+    /// The clustered lights data for the shaders.
+    /// </summary>
+    struct BindingData
+    {
+        LightClustersData Constants;
+        GPUBufferView* Lights;
+        GPUBufferView* ClusterLights;
+    };
+
+private:
+    bool _supported = true;
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csBuildClusters = nullptr;
+    GPUConstantBuffer* _cb0 = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if the local light can be shaded by the clustered deferred lighting (lights with shadows or IES profile are rendered separately).
+    /// </summary>
+    /// <param name="light">The point or spot light.</param>
+    /// <param name="useShadows">True if the lights shadows are rendered.</param>
+    /// <returns>True if light is included in the deferred lights range of the clusters, otherwise false.</returns>
+    template<typename T>
+    FORCE_INLINE static bool IsDeferredLight(const T& light, bool useShadows)
+    {
+        return !(useShadows && light.ShadowDataIndex != -1) && light.IESTexture == nullptr;
+    }
+
+    /// <summary>
+    /// Builds the lights clusters for the view from the point and spot lights of the render list. Lights that pass IsDeferredLight are placed at the beginning of the lights list (see LightClustersData.DeferredLightsCount).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="useShadows">True if the lights shadows are rendered.</param>
+    /// <returns>True if failed to build clusters (eg. clustered lighting is disabled, not supported or there are no local lights), otherwise false.</returns>
+    bool Render(RenderContext& renderContext, GPUContext* context, bool useShadows);
+
+    /// <summary>
+    /// Gets the lights clusters built for the given rendering buffers in the current frame.
+    /// </summary>
+    /// <param name="buffers">The rendering buffers.</param>
+    /// <param name="result">The result clusters data for binding to the shaders.</param>
+    /// <returns>True if there are no clusters built for the view in this frame, otherwise false.</returns>
+    bool Get(const RenderBuffers* buffers, BindingData& result);
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csBuildClusters = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -3,6 +3,7 @@
 #include "LightPass.h"
 #include "ShadowsPass.h"
 #include "GBufferPass.h"
+#include "LightClustersPass.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/GPULimits.h"
@@ -19,6 +20,7 @@ PACK_STRUCT(struct PerLight{
 
 PACK_STRUCT(struct PerFrame{
     GBufferData GBuffer;
+    LightClustersData LightClusters;
     });
 
 String LightPass::ToString() const
@@ -34,6 +36,7 @@ bool LightPass::Init()
     _psLightPointInverted.CreatePipelineStates();
     _psLightSpotNormal.CreatePipelineStates();
     _psLightSpotInverted.CreatePipelineStates();
+    _psLightClustered.CreatePipelineStates();
     _psLightSkyNormal = GPUDevice::Instance->CreatePipelineState();
     _psLightSkyInverted = GPUDevice::Instance->CreatePipelineState();
 
@@ -116,6 +119,14 @@ bool LightPass::setupResources()
         if (_psLightSpotNormal.Create(psDesc, shader, "PS_Spot"))
             return true;
     }
+    if (!_psLightClustered.IsValid() && GPUDevice::Instance->GetFeatureLevel() >= FeatureLevel::SM5)
+    {
+        psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.BlendMode = BlendingMode::Add;
+        psDesc.BlendMode.RenderTargetWriteMask = BlendingMode::ColorWrite::RGB;
+        if (_psLightClustered.Create(psDesc, shader, "PS_Clustered"))
+            return true;
+    }
     if (!_psLightSkyNormal->IsValid() || !_psLightSkyInverted->IsValid())
     {
         psDesc = GPUPipelineState::Description::DefaultNoDepth;
@@ -145,6 +156,7 @@ void LightPass::Dispose()
     _psLightPointInverted.Delete();
     _psLightSpotNormal.Delete();
     _psLightSpotInverted.Delete();
+    _psLightClustered.Delete();
     SAFE_DELETE_GPU_RESOURCE(_psLightSkyNormal);
     SAFE_DELETE_GPU_RESOURCE(_psLightSkyInverted);
     SAFE_DELETE_GPU_RESOURCE(_psClearDiffuse);
@@ -174,6 +186,10 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
     const bool useShadows = ShadowsPass::Instance()->IsReady() && EnumHasAnyFlags(view.Flags, ViewFlags::Shadows);
     const bool disableSpecular = (view.Flags & ViewFlags::SpecularLight) == ViewFlags::None;
 
+    // Cull local lights into clusters (lights without shadows are shaded in a single pass)
+    LightClustersPass::BindingData clusters;
+    const bool useClusters = _psLightClustered.IsValid() && !LightClustersPass::Instance()->Render(renderContext, context, useShadows) && !LightClustersPass::Instance()->Get(renderContext.Buffers, clusters);
+
     // Check if debug lights
     if (renderContext.View.Mode == ViewMode::LightBuffer)
     {
@@ -217,6 +233,10 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
 
     // Set per frame data
     GBufferPass::SetInputs(renderContext.View, perFrame.GBuffer);
+    if (useClusters)
+        perFrame.LightClusters = clusters.Constants;
+    else
+        Platform::MemoryClear(&perFrame.LightClusters, sizeof(perFrame.LightClusters));
     auto cb0 = lightShader->GetCB(0);
     auto cb1 = lightShader->GetCB(1);
     context->UpdateCB(cb1, &perFrame);
@@ -238,6 +258,19 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
     } \
     auto shadowMaskView = shadowMask->View()
 
+    // Render all clustered lights
+    if (useClusters && clusters.Constants.DeferredLightsCount != 0)
+    {
+        PROFILE_GPU_CPU_NAMED("Clustered Lights");
+        context->BindSR(8, clusters.Lights);
+        context->BindSR(9, clusters.ClusterLights);
+        context->BindCB(1, cb1);
+        context->SetState(_psLightClustered.Get(disableSpecular));
+        context->DrawFullscreenTriangle();
+        context->UnBindSR(8);
+        context->UnBindSR(9);
+    }
+
     // Render all point lights
     for (int32 lightIndex = 0; lightIndex < mainCache->PointLights.Count(); lightIndex++)
     {
@@ -245,6 +278,8 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
 
         // Cache data
         auto& light = mainCache->PointLights[lightIndex];
+        if (useClusters && LightClustersPass::IsDeferredLight(light, useShadows))
+            continue;
         float lightRadius = light.Radius;
         Float3 lightPosition = light.Position;
         const bool renderShadow = useShadows && light.ShadowDataIndex != -1;
@@ -302,6 +337,8 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
 
         // Cache data
         auto& light = mainCache->SpotLights[lightIndex];
+        if (useClusters && LightClustersPass::IsDeferredLight(light, useShadows))
+            continue;
         float lightRadius = light.Radius;
         Float3 lightPosition = light.Position;
         const bool renderShadow = useShadows && light.ShadowDataIndex != -1;
@@ -20,6 +20,7 @@ class LightPass : public RendererPass<LightPass>
     GPUPipelineStatePermutationsPs<4> _psLightPointInverted;
     GPUPipelineStatePermutationsPs<4> _psLightSpotNormal;
     GPUPipelineStatePermutationsPs<4> _psLightSpotInverted;
+    GPUPipelineStatePermutationsPs<2> _psLightClustered;
     GPUPipelineState* _psLightSkyNormal = nullptr;
     GPUPipelineState* _psLightSkyInverted = nullptr;
     GPUPipelineState* _psClearDiffuse = nullptr;
@@ -44,6 +45,7 @@ class LightPass : public RendererPass<LightPass>
         _psLightPointInverted.Release();
         _psLightSpotNormal.Release();
         _psLightSpotInverted.Release();
+        _psLightClustered.Release();
         _psLightSkyNormal->ReleaseGPU();
         _psLightSkyInverted->ReleaseGPU();
         invalidateResources();
@@ -107,6 +107,22 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(LightmapSettings);
         _4096 = 4096,
     };
 
+    /// <summary>
+    /// Lightmaps baking methods.
+    /// </summary>
+    API_ENUM() enum class BakeModes
+    {
+        /// <summary>
+        /// Renders the scene hemisphere for every lightmap texel. Precise but slow.
+        /// </summary>
+        Hemispheres = 0,
+
+        /// <summary>
+        /// Traces rays on a GPU against the Global SDF and Global Surface Atlas and accumulates the lighting progressively. Much faster than rendering hemispheres but less precise for small-scale geometry details. Requires Global SDF enabled and models SDF generated.
+        /// </summary>
+        PathTracing = 1,
+    };
+
     /// <summary>
     /// Controls how much all lights will contribute indirect lighting.
     /// </summary>
@@ -155,6 +171,24 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(LightmapSettings);
     API_FIELD(Attributes="EditorOrder(60), Limit(0, 100, 0.1f)")
     int32 Quality = 10;
 
+    /// <summary>
+    /// Lightmaps baking method.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(70)")
+    BakeModes BakeMode = BakeModes::Hemispheres;
+
+    /// <summary>
+    /// Amount of rays traced per lightmap texel when using Path Tracing bake mode. Higher values reduce the noise but increase the baking time.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(80), Limit(16, 65536)")
+    int32 SamplesPerTexel = 512;
+
+    /// <summary>
+    /// Enables rebaking only the lightmap charts affected by static objects and lights changed since the last bake (done in the current Editor session). Performs the full bake if the lightmaps layout has changed.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(90)")
+    bool IncrementalBake = false;
+
 public:
 
     // [ISerializable]
@@ -0,0 +1,227 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "MeshletCullingPass.h"
+#include "RenderList.h"
+#include "OcclusionCullingPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Models/Mesh.h"
+#include "Engine/Graphics/Materials/IMaterial.h"
+
+// Those defines must match the HLSL
+#define MESHLET_CULLING_GROUP_SIZE 128
+
+PACK_STRUCT(struct Data {
+    Float4 FrustumPlanes[6];
+    Matrix HiZViewProjection;
+    Matrix World;
+    Float3 ViewPositionLocal;
+    float WorldScale;
+    Float2 HiZSize;
+    float BoundsInflate;
+    uint32 HasHiZ;
+    uint32 MeshletsCount;
+    uint32 GroupsX;
+    uint32 ArgsOffset;
+    uint32 OutputOffset;
+    uint32 CullBackfaces;
+    Float3 Dummy0;
+    });
+
+static_assert(sizeof(MeshletData) == 40, "Invalid meshlet data size. Update the meshlets culling shader.");
+static_assert(MODEL_MESHLET_MAX_TRIANGLES <= MESHLET_CULLING_GROUP_SIZE, "Meshlets culling uses a single thread per meshlet triangle.");
+
+String MeshletCullingPass::ToString() const
+{
+    return TEXT("MeshletCullingPass");
+}
+
+void MeshletCullingPass::Prepare(RenderContext& renderContext)
+{
+    renderContext.List->MeshletCulling = false;
+    if (!Graphics::EnableMeshletCulling || !_supported)
+        return;
+#if USE_EDITOR
+    const ViewMode viewMode = renderContext.View.Mode;
+    if (viewMode == ViewMode::LightmapUVsDensity || viewMode == ViewMode::LODPreview)
+        return; // Those debug views identify the model LOD by the mesh index buffer
+#endif
+
+    // Load shader on the first use
+    if (!_shader)
+    {
+        const auto& limits = GPUDevice::Instance->Limits;
+        _shader = limits.HasCompute && limits.HasDrawIndirect ? Content::LoadAsyncInternal<Shader>(TEXT("Shaders/MeshletCulling")) : nullptr;
+        if (!_shader)
+        {
+            _supported = false;
+            return;
+        }
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<MeshletCullingPass, &MeshletCullingPass::OnShaderReloading>(this);
+#endif
+        invalidateResources();
+    }
+    if (checkIfSkipPass() || !_csCullMeshlets)
+        return;
+
+    // Draw calls reference the output buffers before they get allocated for the culled meshes
+    if (!_outputIndexBuffer)
+        _outputIndexBuffer = GPUDevice::Instance->CreateBuffer(TEXT("MeshletCulling.OutputIndices"));
+    if (!_argsBuffer)
+        _argsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("MeshletCulling.Args"));
+    renderContext.List->MeshletCulling = true;
+}
+
+void MeshletCullingPass::SetupDrawCall(const RenderContext& renderContext, const Mesh* mesh, DrawCall& drawCall)
+{
+    ASSERT_LOW_LAYER(renderContext.List->MeshletCulling && mesh->GetMeshletsCount() != 0);
+
+    // Backfaces culling of meshlets is done in the object local-space so it supports only uniform scale
+    const Matrix& world = drawCall.World;
+    const Float3 scale(world.GetRight().Length(), world.GetUp().Length(), world.GetBackward().Length());
+    MeshletsDraw draw;
+    draw.Mesh = mesh;
+    draw.World = world;
+    draw.CullBackfaces = drawCall.Material->GetInfo().CullMode != CullMode::TwoSided && scale.MinValue() >= scale.MaxValue() * 0.99f;
+    const int32 index = renderContext.List->MeshletsDraws.Add(draw);
+
+    // Draw the culled indices (draw calls with indirect args are not batched)
+    drawCall.Geometry.IndexBuffer = _outputIndexBuffer;
+    drawCall.InstanceCount = 0;
+    drawCall.Draw.IndirectArgsBuffer = _argsBuffer;
+    drawCall.Draw.IndirectArgsOffset = index * sizeof(GPUDrawIndexedIndirectArgs);
+}
+
+bool MeshletCullingPass::setupResources()
+{
+    if (!_shader)
+        return false; // Shader is loaded on the first use so don't block the renderer readiness
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+    _cb0 = shader->GetCB(0);
+    if (!_cb0 || _cb0->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+    _csCullMeshlets = shader->GetCS("CS_CullMeshlets");
+    return false;
+}
+
+void MeshletCullingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE_GPU_RESOURCE(_outputIndexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_argsBuffer);
+    _argsData.Resize(0);
+    _csCullMeshlets = nullptr;
+    _cb0 = nullptr;
+    _shader = nullptr;
+}
+
+void MeshletCullingPass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    const auto& draws = renderContext.List->MeshletsDraws;
+    if (draws.Count() == 0)
+        return;
+    PROFILE_GPU_CPU("Meshlet Culling");
+
+    // Prepare the initial indirect draw arguments (with zero indices, each draw has a separate range of the output indices)
+    _argsData.Resize(draws.Count() * sizeof(GPUDrawIndexedIndirectArgs));
+    auto args = (GPUDrawIndexedIndirectArgs*)_argsData.Get();
+    uint32 indicesCount = 0;
+    for (int32 i = 0; i < draws.Count(); i++)
+    {
+        args[i].IndicesCount = 0;
+        args[i].InstanceCount = 1;
+        args[i].StartIndex = indicesCount;
+        args[i].StartVertex = 0;
+        args[i].StartInstance = 0;
+        indicesCount += draws.Get()[i].Mesh->GetTriangleCount() * 3;
+    }
+    if (_argsBuffer->GetSize() < (uint32)_argsData.Count())
+    {
+        if (_argsBuffer->Init(GPUBufferDescription::Raw(Math::RoundUpToPowerOf2((uint32)_argsData.Count()), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+            return;
+    }
+    context->UpdateBuffer(_argsBuffer, _argsData.Get(), _argsData.Count());
+
+    // Ensure to have enough space for the output (draw calls that fail to be culled are skipped)
+    const uint32 outputIndicesSize = indicesCount * sizeof(uint32);
+    if (_outputIndexBuffer->GetSize() < outputIndicesSize)
+    {
+        if (_outputIndexBuffer->Init(GPUBufferDescription::Buffer(Math::RoundUpToPowerOf2(outputIndicesSize), GPUBufferFlags::IndexBuffer | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_UInt, nullptr, sizeof(uint32))))
+            return;
+    }
+    if (checkIfSkipPass() || !_csCullMeshlets)
+        return;
+
+    // Setup constants shared by all draws
+    const auto& view = renderContext.View;
+    Data data;
+    for (int32 i = 0; i < 6; i++)
+    {
+        const Plane plane = view.CullingFrustum.GetPlane(i);
+        data.FrustumPlanes[i] = Float4(Float3(plane.Normal), (float)plane.D);
+    }
+    Matrix hiZViewProjection;
+    float boundsInflate;
+    GPUTexture* hiZ = OcclusionCullingPass::Instance()->GetHiZ(renderContext, hiZViewProjection, boundsInflate);
+    if (hiZ)
+    {
+        Matrix::Transpose(hiZViewProjection, data.HiZViewProjection);
+        data.HiZSize = Float2((float)hiZ->Width(), (float)hiZ->Height());
+        data.BoundsInflate = boundsInflate;
+        data.HasHiZ = 1;
+    }
+    else
+    {
+        data.HiZViewProjection = Matrix::Identity;
+        data.HiZSize = Float2::Zero;
+        data.BoundsInflate = 0.0f;
+        data.HasHiZ = 0;
+    }
+    data.Dummy0 = Float3::Zero;
+    context->BindSR(2, hiZ);
+    context->BindUA(0, _outputIndexBuffer->View());
+    context->BindUA(1, _argsBuffer->View());
+
+    // Cull meshlets (thread group per meshlet)
+    const bool cullBackfaces = view.IsPerspectiveProjection();
+    for (int32 i = 0; i < draws.Count(); i++)
+    {
+        const MeshletsDraw& draw = draws.Get()[i];
+        const Mesh* mesh = draw.Mesh;
+        const uint32 meshletsCount = mesh->GetMeshletsCount();
+        if (meshletsCount == 0)
+            continue;
+        Matrix invWorld;
+        Matrix::Invert(draw.World, invWorld);
+        Matrix::Transpose(draw.World, data.World);
+        data.ViewPositionLocal = Float3::Transform(view.Position, invWorld);
+        data.WorldScale = Float3(draw.World.GetRight().Length(), draw.World.GetUp().Length(), draw.World.GetBackward().Length()).MaxValue();
+        data.MeshletsCount = meshletsCount;
+        data.GroupsX = Math::Min<uint32>(meshletsCount, GPU_MAX_CS_DISPATCH_THREAD_GROUPS);
+        data.ArgsOffset = i * sizeof(GPUDrawIndexedIndirectArgs);
+        data.OutputOffset = args[i].StartIndex;
+        data.CullBackfaces = draw.CullBackfaces && cullBackfaces ? 1 : 0;
+        context->UpdateCB(_cb0, &data);
+        context->BindCB(0, _cb0);
+        context->BindSR(0, mesh->GetMeshletsBuffer()->View());
+        context->BindSR(1, mesh->GetIndexBuffer()->View());
+        context->Dispatch(_csCullMeshlets, data.GroupsX, Math::DivideAndRoundUp(meshletsCount, data.GroupsX), 1);
+    }
+    context->ResetUA();
+    context->ResetSR();
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+class Mesh;
+struct DrawCall;
+
+/// <summary>
+/// GPU-driven meshlets culling pass. Culls the clusters of triangles of the meshes imported with meshlets on a GPU (against view frustum, backfaces and Hi-Z) and compacts the visible triangles into the index buffer drawn with the indirect draw call. Used only by the main view (shadow projections draw the whole meshes). Uses compute shaders.
+/// </summary>
+class FLAXENGINE_API MeshletCullingPass : public RendererPass<MeshletCullingPass>
+{
+private:
+    bool _supported = true;
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csCullMeshlets = nullptr;
+    GPUConstantBuffer* _cb0 = nullptr;
+    GPUBuffer* _outputIndexBuffer = nullptr;
+    GPUBuffer* _argsBuffer = nullptr;
+    Array<byte> _argsData;
+
+public:
+    /// <summary>
+    /// Prepares the meshlets culling for the scene rendering (enables it for the render list draw calls). Called before collecting the draw calls.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    void Prepare(RenderContext& renderContext);
+
+    /// <summary>
+    /// Setups the mesh draw call to use the meshlets culled on a GPU (indirect draw of the compacted indices). Can be called only if the render list has MeshletCulling enabled. Thread-safe.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="mesh">The mesh (with meshlets).</param>
+    /// <param name="drawCall">The mesh draw call to modify.</param>
+    void SetupDrawCall(const RenderContext& renderContext, const Mesh* mesh, DrawCall& drawCall);
+
+    /// <summary>
+    /// Culls the meshlets of the render list draw calls on a GPU. Called before executing any of the draw calls.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csCullMeshlets = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -303,7 +303,7 @@ void MotionBlurPass::Render(RenderContext& renderContext, GPUTexture*& frame, GP
 
     // Downscale motion vectors texture down to 1/2 (with max velocity calculation 2x2 kernel)
     auto rtDesc = GPUTextureDescription::New2D(motionVectorsWidth / 2, motionVectorsHeight / 2, _motionVectorsFormat);
-    const auto vMaxBuffer2 = RenderTargetPool::Get(rtDesc);
+    const auto vMaxBuffer2 = RenderTargetPool::GetTransient(context, rtDesc);
     RENDER_TARGET_POOL_SET_NAME(vMaxBuffer2, "MotionBlur.VMax2");
     context->SetRenderTarget(vMaxBuffer2->View());
     context->SetViewportAndScissors((float)rtDesc.Width, (float)rtDesc.Height);
@@ -314,7 +314,7 @@ void MotionBlurPass::Render(RenderContext& renderContext, GPUTexture*& frame, GP
     // Downscale motion vectors texture down to 1/4 (with max velocity calculation 2x2 kernel)
     rtDesc.Width /= 2;
     rtDesc.Height /= 2;
-    const auto vMaxBuffer4 = RenderTargetPool::Get(rtDesc);
+    const auto vMaxBuffer4 = RenderTargetPool::GetTransient(context, rtDesc);
     RENDER_TARGET_POOL_SET_NAME(vMaxBuffer4, "MotionBlur.VMax4");
     context->ResetRenderTarget();
     context->SetRenderTarget(vMaxBuffer4->View());
@@ -329,7 +329,7 @@ void MotionBlurPass::Render(RenderContext& renderContext, GPUTexture*& frame, GP
     // Downscale motion vectors texture down to 1/8 (with max velocity calculation 2x2 kernel)
     rtDesc.Width /= 2;
     rtDesc.Height /= 2;
-    const auto vMaxBuffer8 = RenderTargetPool::Get(rtDesc);
+    const auto vMaxBuffer8 = RenderTargetPool::GetTransient(context, rtDesc);
     RENDER_TARGET_POOL_SET_NAME(vMaxBuffer8, "MotionBlur.VMax8");
     context->ResetRenderTarget();
     context->SetRenderTarget(vMaxBuffer8->View());
@@ -344,7 +344,7 @@ void MotionBlurPass::Render(RenderContext& renderContext, GPUTexture*& frame, GP
     // Downscale motion vectors texture down to tileSize/tileSize (with max velocity calculation NxN kernel)
     rtDesc.Width = Math::Max(motionVectorsWidth / tileSize, 1);
     rtDesc.Height = Math::Max(motionVectorsHeight / tileSize, 1);
-    auto vMaxBuffer = RenderTargetPool::Get(rtDesc);
+    auto vMaxBuffer = RenderTargetPool::GetTransient(context, rtDesc);
     RENDER_TARGET_POOL_SET_NAME(vMaxBuffer, "MotionBlur.VMax");
     context->ResetRenderTarget();
     context->SetRenderTarget(vMaxBuffer->View());
@@ -358,7 +358,7 @@ void MotionBlurPass::Render(RenderContext& renderContext, GPUTexture*& frame, GP
 
     // Extract maximum velocities for the tiles based on their neighbors
     context->ResetRenderTarget();
-    auto vMaxNeighborBuffer = RenderTargetPool::Get(rtDesc);
+    auto vMaxNeighborBuffer = RenderTargetPool::GetTransient(context, rtDesc);
     RENDER_TARGET_POOL_SET_NAME(vMaxBuffer, "MotionBlur.VMaxNeighbor");
     context->SetRenderTarget(vMaxNeighborBuffer->View());
     context->BindSR(0, vMaxBuffer->View());
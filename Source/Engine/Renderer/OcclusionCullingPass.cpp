@@ -0,0 +1,307 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "OcclusionCullingPass.h"
+#include "RenderList.h"
+#include "Engine/Renderer/Utils/MultiScaler.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/Async/GPUSyncPoint.h"
+#include "Engine/Graphics/Textures/TextureData.h"
+#include "Engine/Engine/Engine.h"
+
+// The maximum width of the Hi-Z read back to the CPU (in texels)
+#define OCCLUSION_CULLING_HIZ_SIZE 256
+
+// The amount of frames to wait before reading the Hi-Z on the CPU (to not stall the GPU)
+#define OCCLUSION_CULLING_LATENCY (GPU_ASYNC_LATENCY + 1)
+
+// The amount of readback textures used in a ring (one more than latency so there is always a free one to write)
+#define OCCLUSION_CULLING_READBACK_COUNT (OCCLUSION_CULLING_LATENCY + 1)
+
+// The maximum age of the Hi-Z (in frames) that can be used for culling (eg. when view is not rendered every frame)
+#define OCCLUSION_CULLING_MAX_AGE 10
+
+// The maximum camera movement since the Hi-Z capture (in world units) that still allows for culling
+#define OCCLUSION_CULLING_MAX_MOVEMENT 500.0f
+
+// The maximum amount of Hi-Z texels (per axis) sampled when testing a single object
+#define OCCLUSION_CULLING_MAX_TEXELS 4
+
+// Custom render buffer for the Hi-Z occlusion culling state.
+class OcclusionCullingCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    struct Readback
+    {
+        GPUTexture* Texture = nullptr;
+        uint64 Frame = 0;
+        Matrix ViewProjection;
+        Vector3 Origin;
+        Vector3 Position;
+    };
+
+    Readback Readbacks[OCCLUSION_CULLING_READBACK_COUNT];
+    OcclusionCullingData Data;
+
+    // The Hi-Z from the last rendered frame (for the GPU culling)
+    GPUTexture* HiZ = nullptr;
+    Readback HiZInfo;
+
+    ~OcclusionCullingCustomBuffer()
+    {
+        for (Readback& e : Readbacks)
+            SAFE_DELETE_GPU_RESOURCE(e.Texture);
+        RenderTargetPool::Release(HiZ);
+    }
+};
+
+void OcclusionCullingData::Build(const byte* data, int32 width, int32 height, uint32 rowPitch)
+{
+    PROFILE_CPU();
+
+    // Calculate mips layout
+    Mips.Clear();
+    int32 size = 0;
+    while (Mips.Count() < OCCLUSION_CULLING_MAX_MIPS)
+    {
+        Mips.Add({ width, height, size });
+        size += width * height;
+        if (width == 1 && height == 1)
+            break;
+        width = Math::Max((width + 1) / 2, 1);
+        height = Math::Max((height + 1) / 2, 1);
+    }
+    Depth.Resize(size, false);
+
+    // Copy the top mip
+    const Mip& mip0 = Mips[0];
+    for (int32 y = 0; y < mip0.Height; y++)
+        Platform::MemoryCopy(Depth.Get() + y * mip0.Width, data + y * rowPitch, mip0.Width * sizeof(float));
+
+    // Downscale the lower mips (keep the farthest depth)
+    for (int32 i = 1; i < Mips.Count(); i++)
+    {
+        const Mip& src = Mips[i - 1];
+        const Mip& dst = Mips[i];
+        const float* srcData = Depth.Get() + src.Offset;
+        float* dstData = Depth.Get() + dst.Offset;
+        for (int32 y = 0; y < dst.Height; y++)
+        {
+            const float* srcRow0 = srcData + Math::Min(y * 2, src.Height - 1) * src.Width;
+            const float* srcRow1 = srcData + Math::Min(y * 2 + 1, src.Height - 1) * src.Width;
+            for (int32 x = 0; x < dst.Width; x++)
+            {
+                const int32 x0 = Math::Min(x * 2, src.Width - 1);
+                const int32 x1 = Math::Min(x * 2 + 1, src.Width - 1);
+                dstData[y * dst.Width + x] = Math::Max(srcRow0[x0], srcRow0[x1], srcRow1[x0], srcRow1[x1]);
+            }
+        }
+    }
+}
+
+bool OcclusionCullingData::IsOccluded(const BoundingSphere& bounds) const
+{
+    if (Mips.IsEmpty())
+        return false;
+
+    // Project the bounds box corners into the captured view
+    const Matrix& m = ViewProjection;
+    const Float3 center = bounds.Center;
+    const float radius = (float)bounds.Radius + BoundsInflate;
+    Float2 min(MAX_float), max(-MAX_float);
+    float minDepth = MAX_float;
+    for (int32 i = 0; i < 8; i++)
+    {
+        const Float3 corner(center.X + (i & 1 ? radius : -radius), center.Y + (i & 2 ? radius : -radius), center.Z + (i & 4 ? radius : -radius));
+        const float w = corner.X * m.M14 + corner.Y * m.M24 + corner.Z * m.M34 + m.M44;
+        if (w <= ZeroTolerance)
+            return false; // Crosses the near plane
+        const float invW = 1.0f / w;
+        const Float2 position((corner.X * m.M11 + corner.Y * m.M21 + corner.Z * m.M31 + m.M41) * invW, (corner.X * m.M12 + corner.Y * m.M22 + corner.Z * m.M32 + m.M42) * invW);
+        min = Float2::Min(min, position);
+        max = Float2::Max(max, position);
+        minDepth = Math::Min(minDepth, (corner.X * m.M13 + corner.Y * m.M23 + corner.Z * m.M33 + m.M43) * invW);
+    }
+    if (minDepth <= 0.0f)
+        return false;
+
+    // Convert into the texture space
+    float u0 = min.X * 0.5f + 0.5f, u1 = max.X * 0.5f + 0.5f;
+    float v0 = 0.5f - max.Y * 0.5f, v1 = 0.5f - min.Y * 0.5f;
+    if (u1 < 0.0f || v1 < 0.0f || u0 > 1.0f || v0 > 1.0f)
+        return false; // Outside the captured view
+    if (Conservative && (u0 < 0.0f || v0 < 0.0f || u1 > 1.0f || v1 > 1.0f))
+        return false; // Partially outside the captured view (might be visible after camera rotation)
+
+    // Pick the mip level where the object covers only a few texels
+    const Mip* mips = Mips.Get();
+    int32 x0 = Math::Clamp((int32)(u0 * (float)mips[0].Width), 0, mips[0].Width - 1);
+    int32 x1 = Math::Clamp((int32)(u1 * (float)mips[0].Width), 0, mips[0].Width - 1);
+    int32 y0 = Math::Clamp((int32)(v0 * (float)mips[0].Height), 0, mips[0].Height - 1);
+    int32 y1 = Math::Clamp((int32)(v1 * (float)mips[0].Height), 0, mips[0].Height - 1);
+    int32 level = 0;
+    while (level + 1 < Mips.Count() && (x1 - x0 >= OCCLUSION_CULLING_MAX_TEXELS || y1 - y0 >= OCCLUSION_CULLING_MAX_TEXELS))
+    {
+        level++;
+        x0 >>= 1;
+        x1 >>= 1;
+        y0 >>= 1;
+        y1 >>= 1;
+    }
+
+    // Object is occluded if its nearest point is behind the farthest depth of the whole area
+    const Mip& mip = mips[level];
+    const float* depth = Depth.Get() + mip.Offset;
+    for (int32 y = y0; y <= y1; y++)
+    {
+        for (int32 x = x0; x <= x1; x++)
+        {
+            if (depth[y * mip.Width + x] >= minDepth)
+                return false;
+        }
+    }
+    return true;
+}
+
+void OcclusionCullingPass::Prepare(RenderContext& renderContext)
+{
+    renderContext.List->OcclusionCulling = nullptr;
+    const auto& view = renderContext.View;
+    if (!Graphics::EnableOcclusionCulling || view.IsOfflinePass || view.Mode == ViewMode::Wireframe || !renderContext.Buffers || (renderContext.Task && renderContext.Task->IsCameraCut))
+        return;
+    auto& occlusionData = *renderContext.Buffers->GetCustomBuffer<OcclusionCullingCustomBuffer>(TEXT("OcclusionCulling"));
+    occlusionData.LastFrameUsed = Engine::FrameCount;
+    OcclusionCullingData& data = occlusionData.Data;
+
+    // Pick the latest Hi-Z that has been already rendered by the GPU
+    OcclusionCullingCustomBuffer::Readback* readback = nullptr;
+    for (auto& e : occlusionData.Readbacks)
+    {
+        if (e.Texture && e.Frame != 0 && e.Frame + OCCLUSION_CULLING_LATENCY <= Engine::FrameCount && (!readback || e.Frame > readback->Frame))
+            readback = &e;
+    }
+    if (readback && readback->Frame != data.Frame)
+    {
+        PROFILE_CPU_NAMED("Read Hi-Z");
+        TextureMipData mip;
+        if (readback->Texture->GetData(0, 0, mip, 0))
+        {
+            readback->Frame = 0;
+            data.Mips.Clear();
+        }
+        else
+        {
+            data.Build(mip.Data.Get(), readback->Texture->Width(), readback->Texture->Height(), mip.RowPitch);
+            data.Frame = readback->Frame;
+            data.ViewProjection = readback->ViewProjection;
+            data.Origin = readback->Origin;
+            data.Position = readback->Position;
+        }
+    }
+
+    // Skip culling if the Hi-Z is too old or view changed too much since its capture
+    if (data.Mips.IsEmpty() || Engine::FrameCount - data.Frame > OCCLUSION_CULLING_MAX_AGE || data.Origin != view.Origin)
+        return;
+    const float movement = (float)Vector3::Distance(data.Position, view.Origin + view.Position);
+    if (movement > OCCLUSION_CULLING_MAX_MOVEMENT)
+        return;
+
+    // Reproject the objects into the previous view (conservative mode additionally extends bounds by the camera movement to reduce popping)
+    data.Conservative = Graphics::ConservativeOcclusionCulling;
+    data.BoundsInflate = data.Conservative ? movement : 0.0f;
+    renderContext.List->OcclusionCulling = &data;
+}
+
+void OcclusionCullingPass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    const auto& view = renderContext.View;
+    if (!Graphics::EnableOcclusionCulling || view.IsOfflinePass || view.Mode == ViewMode::Wireframe)
+        return;
+    PROFILE_GPU_CPU("Occlusion Culling");
+    auto& occlusionData = *renderContext.Buffers->GetCustomBuffer<OcclusionCullingCustomBuffer>(TEXT("OcclusionCulling"));
+    occlusionData.LastFrameUsed = Engine::FrameCount;
+
+    // Downscale depth buffer into a small Hi-Z (each level keeps the farthest depth of the area)
+    GPUTexture* halfResDepth = renderContext.Buffers->RequestHalfResDepth(context);
+    GPUTexture* depth = halfResDepth;
+    int32 width = depth->Width();
+    int32 height = depth->Height();
+    while (width > OCCLUSION_CULLING_HIZ_SIZE && height > 1)
+    {
+        width = Math::Max(width / 2, 1);
+        height = Math::Max(height / 2, 1);
+        auto desc = GPUTextureDescription::New2D(width, height, GPU_DEPTH_BUFFER_PIXEL_FORMAT);
+        desc.Flags = GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil;
+        GPUTexture* dst = RenderTargetPool::Get(desc);
+        RENDER_TARGET_POOL_SET_NAME(dst, "OcclusionCulling.Depth");
+        MultiScaler::Instance()->DownscaleDepth(context, width, height, depth, dst->View());
+        if (depth != halfResDepth)
+            RenderTargetPool::Release(depth);
+        depth = dst;
+    }
+    auto desc = GPUTextureDescription::New2D(width, height, PixelFormat::R32_Float);
+    GPUTexture* hiZ = RenderTargetPool::Get(desc);
+    RENDER_TARGET_POOL_SET_NAME(hiZ, "OcclusionCulling.HiZ");
+    context->SetRenderTarget(hiZ->View());
+    context->SetViewportAndScissors((float)width, (float)height);
+    context->Draw(depth);
+    context->ResetRenderTarget();
+    if (depth != halfResDepth)
+        RenderTargetPool::Release(depth);
+
+    // Copy Hi-Z into the oldest readback texture
+    auto* readback = &occlusionData.Readbacks[0];
+    for (auto& e : occlusionData.Readbacks)
+    {
+        if (e.Frame < readback->Frame)
+            readback = &e;
+    }
+    if (!readback->Texture)
+        readback->Texture = GPUDevice::Instance->CreateTexture(TEXT("OcclusionCulling.Readback"));
+    if (readback->Texture->Width() != width || readback->Texture->Height() != height)
+    {
+        if (readback->Texture->Init(desc.ToStagingReadback()))
+        {
+            LOG(Error, "Failed to create occlusion culling readback texture.");
+            readback->Frame = 0;
+            RenderTargetPool::Release(hiZ);
+            return;
+        }
+    }
+    context->CopyTexture(readback->Texture, 0, 0, 0, 0, hiZ, 0);
+    readback->Frame = Engine::FrameCount;
+    Matrix::Multiply(view.View, view.NonJitteredProjection, readback->ViewProjection);
+    readback->Origin = view.Origin;
+    readback->Position = view.Origin + view.Position;
+
+    // Keep Hi-Z for the GPU culling in the next frame
+    RenderTargetPool::Release(occlusionData.HiZ);
+    occlusionData.HiZ = hiZ;
+    occlusionData.HiZInfo = *readback;
+    occlusionData.HiZInfo.Texture = nullptr;
+}
+
+GPUTexture* OcclusionCullingPass::GetHiZ(const RenderContext& renderContext, Matrix& viewProjection, float& boundsInflate) const
+{
+    const auto& view = renderContext.View;
+    if (!Graphics::EnableOcclusionCulling || view.IsOfflinePass || view.Mode == ViewMode::Wireframe || !EnumHasAnyFlags(view.Pass, DrawPass::GBuffer) || !renderContext.Buffers || (renderContext.Task && renderContext.Task->IsCameraCut))
+        return nullptr;
+    const auto occlusionData = renderContext.Buffers->FindCustomBuffer<OcclusionCullingCustomBuffer>(TEXT("OcclusionCulling"));
+    if (!occlusionData || !occlusionData->HiZ || occlusionData->HiZInfo.Frame + 1 < Engine::FrameCount || occlusionData->HiZInfo.Origin != view.Origin)
+        return nullptr;
+    const float movement = (float)Vector3::Distance(occlusionData->HiZInfo.Position, view.Origin + view.Position);
+    if (movement > OCCLUSION_CULLING_MAX_MOVEMENT)
+        return nullptr;
+    viewProjection = occlusionData->HiZInfo.ViewProjection;
+    boundsInflate = Graphics::ConservativeOcclusionCulling ? movement : 0.0f;
+    return occlusionData->HiZ;
+}
+
+String OcclusionCullingPass::ToString() const
+{
+    return TEXT("OcclusionCullingPass");
+}
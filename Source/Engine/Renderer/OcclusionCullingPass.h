@@ -0,0 +1,109 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+
+// The maximum amount of the Hi-Z mip levels on the CPU
+#define OCCLUSION_CULLING_MAX_MIPS 16
+
+/// <summary>
+/// The CPU copy of the hierarchical depth (Hi-Z) pyramid from one of the previous frames used to test objects visibility before adding draw calls.
+/// </summary>
+struct FLAXENGINE_API OcclusionCullingData
+{
+    /// <summary>
+    /// The frame index when the depth was captured.
+    /// </summary>
+    uint64 Frame = 0;
+
+    /// <summary>
+    /// The view-projection matrix of the frame when the depth was captured (relative to the view origin).
+    /// </summary>
+    Matrix ViewProjection;
+
+    /// <summary>
+    /// The world-space rendering origin of the frame when the depth was captured.
+    /// </summary>
+    Vector3 Origin;
+
+    /// <summary>
+    /// The world-space view position of the frame when the depth was captured.
+    /// </summary>
+    Vector3 Position;
+
+    /// <summary>
+    /// The extra radius added to the tested bounds (eg. to cover the camera movement since the depth was captured).
+    /// </summary>
+    float BoundsInflate = 0.0f;
+
+    /// <summary>
+    /// True if tested objects that are partially outside the captured view are considered visible (avoids popping when camera rotates), otherwise screen edges are clamped.
+    /// </summary>
+    bool Conservative = true;
+
+    /// <summary>
+    /// The Hi-Z mip levels (each texel contains the farthest depth of the area it covers).
+    /// </summary>
+    struct Mip
+    {
+        int32 Width;
+        int32 Height;
+        int32 Offset;
+    };
+
+    Array<Mip, FixedAllocation<OCCLUSION_CULLING_MAX_MIPS>> Mips;
+    Array<float> Depth;
+
+public:
+    /// <summary>
+    /// Builds the Hi-Z pyramid from the depth buffer data (device depth values, 1 is the far plane).
+    /// </summary>
+    /// <param name="data">The depth data (32-bit floats).</param>
+    /// <param name="width">The depth data width (in texels).</param>
+    /// <param name="height">The depth data height (in texels).</param>
+    /// <param name="rowPitch">The depth data row pitch (in bytes).</param>
+    void Build(const byte* data, int32 width, int32 height, uint32 rowPitch);
+
+    /// <summary>
+    /// Checks if the object is fully hidden behind the captured depth.
+    /// </summary>
+    /// <param name="bounds">The object bounds (relative to the view origin).</param>
+    /// <returns>True if object is occluded and can be skipped from drawing, otherwise false.</returns>
+    bool IsOccluded(const BoundingSphere& bounds) const;
+};
+
+/// <summary>
+/// Hi-Z occlusion culling pass. Downscales the scene depth into a small depth pyramid which is read back to the CPU with a few frames of latency and used to skip drawing of the hidden objects.
+/// </summary>
+class FLAXENGINE_API OcclusionCullingPass : public RendererPass<OcclusionCullingPass>
+{
+public:
+    /// <summary>
+    /// Prepares the occlusion culling data for the scene rendering (picks the latest Hi-Z that has been read back from the GPU and assigns it to the render list).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    void Prepare(RenderContext& renderContext);
+
+    /// <summary>
+    /// Renders the Hi-Z from the scene depth buffer and requests its readback to the CPU. Called after rendering the scene depth buffer.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+    /// <summary>
+    /// Gets the Hi-Z texture rendered in the last frame of the view (for the GPU culling). Contains the farthest device depth of the area covered by each texel.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="viewProjection">The output view-projection matrix of the frame when the depth was captured (relative to the view origin).</param>
+    /// <param name="boundsInflate">The output extra radius to add to the tested bounds (eg. to cover the camera movement since the depth was captured).</param>
+    /// <returns>The Hi-Z texture or null if not available.</returns>
+    GPUTexture* GetHiZ(const RenderContext& renderContext, Matrix& viewProjection, float& boundsInflate) const;
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+};
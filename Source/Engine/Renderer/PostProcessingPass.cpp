@@ -191,7 +191,7 @@ void PostProcessingPass::Render(RenderContext& renderContext, GPUTexture* input,
     PostProcessSettings& settings = renderContext.List->Settings;
     bool useBloom = EnumHasAnyFlags(view.Flags, ViewFlags::Bloom) && settings.Bloom.Enabled && settings.Bloom.Intensity > 0.0f;
     bool useToneMapping = EnumHasAnyFlags(view.Flags, ViewFlags::ToneMapping);
-    bool useCameraArtifacts = EnumHasAnyFlags(view.Flags, ViewFlags::CameraArtifacts);
+    bool useCameraArtifacts = EnumHasAnyFlags(view.Flags, ViewFlags::CameraArtifacts) && (settings.CameraArtifacts.VignetteIntensity > 0.0f || settings.CameraArtifacts.GrainAmount > 0.0f || settings.CameraArtifacts.ChromaticDistortion > 0.0f || settings.CameraArtifacts.ScreenFadeColor.A > 0.0f);
     bool useLensFlares = EnumHasAnyFlags(view.Flags, ViewFlags::LensFlares) && settings.LensFlares.Intensity > 0.0f && useBloom;
 
     // Ensure to have valid data and if at least one effect should be applied
@@ -298,16 +298,19 @@ void PostProcessingPass::Render(RenderContext& renderContext, GPUTexture* input,
     ////////////////////////////////////////////////////////////////////////////////////
     // Bloom
 
-    auto tempDesc = GPUTextureDescription::New2D(w2, h2, 0, output->Format(), GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget | GPUTextureFlags::PerMipViews);
-    auto bloomTmp1 = RenderTargetPool::Get(tempDesc);
-    RENDER_TARGET_POOL_SET_NAME(bloomTmp1, "PostProcessing.Bloom");
-    // TODO: bloomTmp2 could be quarter res because we don't use it's first mip
-    auto bloomTmp2 = RenderTargetPool::Get(tempDesc);
-    RENDER_TARGET_POOL_SET_NAME(bloomTmp2, "PostProcessing.Bloom");
+    GPUTexture* bloomTmp1 = nullptr;
+    GPUTexture* bloomTmp2 = nullptr;
 
-    // Check if use bloom
+    // Check if use bloom (lens flares reuse the bloom buffers)
     if (useBloom)
     {
+        auto tempDesc = GPUTextureDescription::New2D(w2, h2, 0, output->Format(), GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget | GPUTextureFlags::PerMipViews);
+        bloomTmp1 = RenderTargetPool::Get(tempDesc);
+        RENDER_TARGET_POOL_SET_NAME(bloomTmp1, "PostProcessing.Bloom");
+        // TODO: bloomTmp2 could be quarter res because we don't use it's first mip
+        bloomTmp2 = RenderTargetPool::Get(tempDesc);
+        RENDER_TARGET_POOL_SET_NAME(bloomTmp2, "PostProcessing.Bloom");
+
         // Bloom Threshold and downscale to 1/2
         context->SetRenderTarget(bloomTmp1->View(0, 0));
         context->SetViewportAndScissors((float)w2, (float)h2);
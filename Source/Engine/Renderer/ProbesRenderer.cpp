@@ -19,6 +19,7 @@
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUTimerQuery.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Graphics/RenderTask.h"
@@ -92,6 +93,12 @@ namespace ProbesRendererImpl
     GPUTexture* _tmpFace = nullptr;
     GPUTexture* _skySHIrradianceMap = nullptr;
     uint64 _updateFrameNumber = 0;
+    int32 _updateStep = 0;
+    float _customCullingNear = -1;
+    GPUTimerQuery* _updateTimer = nullptr; // Measures the probe update steps time to estimate the steps count that fits into the updates budget
+    bool _updateTimerPending = false;
+    int32 _updateTimerSteps = 0;
+    float _updateStepCost = 0.0f; // Estimated probe update step time (in milliseconds)
 
     FORCE_INLINE bool isUpdateSynced()
     {
@@ -310,6 +317,9 @@ void ProbesRenderer::Release()
     SAFE_DELETE_GPU_RESOURCE(_probe);
     SAFE_DELETE_GPU_RESOURCE(_tmpFace);
     SAFE_DELETE_GPU_RESOURCE(_skySHIrradianceMap);
+    SAFE_DELETE_GPU_RESOURCE(_updateTimer);
+    _updateTimerPending = false;
+    _updateStepCost = 0.0f;
 
     _isReady = false;
 }
@@ -348,15 +358,23 @@ void ProbesRendererService::Update()
     }
     else if (_current.Type == ProbesRenderer::EntryType::Invalid)
     {
+        // Pick the probe closest to the view (from the ones that are ready to update)
         int32 firstValidEntryIndex = -1;
+        Real closestDistance = MAX_Real;
+        const Vector3 viewPosition = MainRenderTask::Instance ? MainRenderTask::Instance->View.WorldPosition : Vector3::Zero;
         auto dt = (float)Time::Update.UnscaledDeltaTime.GetTotalSeconds();
         for (int32 i = 0; i < _probesToBake.Count(); i++)
         {
-            _probesToBake[i].Timeout -= dt;
-            if (_probesToBake[i].Timeout <= 0)
+            auto& e = _probesToBake[i];
+            e.Timeout -= dt;
+            if (e.Timeout <= 0)
             {
-                firstValidEntryIndex = i;
-                break;
+                const Real distance = e.Actor ? Vector3::DistanceSquared(e.Actor->GetPosition(), viewPosition) : 0;
+                if (distance < closestDistance)
+                {
+                    firstValidEntryIndex = i;
+                    closestDistance = distance;
+                }
             }
         }
 
@@ -376,6 +394,7 @@ void ProbesRendererService::Update()
             _probesToBake.RemoveAtKeepOrder(firstValidEntryIndex);
             _task->Enabled = true;
             _updateFrameNumber = 0;
+            _updateStep = 0;
 
             // Store time of the last probe update
             _lastProbeUpdate = timeNow;
@@ -418,6 +437,9 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
         if (_current.Actor == nullptr)
         {
             // Probe has been unlinked (or deleted)
+            _task->Enabled = false;
+            _current.Type = EntryType::Invalid;
+            _updateStep = 0;
             return;
         }
         break;
@@ -431,83 +453,117 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
     PROFILE_GPU("Render Probe");
 
     // Init
-    float customCullingNear = -1;
     const int32 probeResolution = _current.GetResolution();
     const PixelFormat probeFormat = _current.GetFormat();
-    if (_current.Type == EntryType::EnvProbe)
+    if (_updateStep == 0)
     {
-        auto envProbe = (EnvironmentProbe*)_current.Actor.Get();
-        Vector3 position = envProbe->GetPosition();
-        float radius = envProbe->GetScaledRadius();
-        float nearPlane = Math::Max(0.1f, envProbe->CaptureNearPlane);
-
-        // Adjust far plane distance
-        float farPlane = Math::Max(radius, nearPlane + 100.0f);
-        farPlane *= farPlane < 10000 ? 10 : 4;
-        Function<bool(Actor*, const Vector3&, float&)> f(&fixFarPlaneTreeExecute);
-        SceneQuery::TreeExecute<const Vector3&, float&>(f, position, farPlane);
-
-        // Setup view
-        LargeWorlds::UpdateOrigin(_task->View.Origin, position);
-        _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
+        _customCullingNear = -1;
+        if (_current.Type == EntryType::EnvProbe)
+        {
+            auto envProbe = (EnvironmentProbe*)_current.Actor.Get();
+            Vector3 position = envProbe->GetPosition();
+            float radius = envProbe->GetScaledRadius();
+            float nearPlane = Math::Max(0.1f, envProbe->CaptureNearPlane);
+
+            // Adjust far plane distance
+            float farPlane = Math::Max(radius, nearPlane + 100.0f);
+            farPlane *= farPlane < 10000 ? 10 : 4;
+            Function<bool(Actor*, const Vector3&, float&)> f(&fixFarPlaneTreeExecute);
+            SceneQuery::TreeExecute<const Vector3&, float&>(f, position, farPlane);
+
+            // Setup view
+            LargeWorlds::UpdateOrigin(_task->View.Origin, position);
+            _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
+        }
+        else if (_current.Type == EntryType::SkyLight)
+        {
+            auto skyLight = (SkyLight*)_current.Actor.Get();
+            Vector3 position = skyLight->GetPosition();
+            float nearPlane = 10.0f;
+            float farPlane = Math::Max(nearPlane + 1000.0f, skyLight->SkyDistanceThreshold * 2.0f);
+            _customCullingNear = skyLight->SkyDistanceThreshold;
+
+            // Setup view
+            LargeWorlds::UpdateOrigin(_task->View.Origin, position);
+            _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
+        }
+        _task->CameraCut();
+
+        // Resize buffers
+        bool resizeFailed = _output->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _probe->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _tmpFace->Resize(probeResolution, probeResolution, probeFormat);
+        resizeFailed |= _task->Resize(probeResolution, probeResolution);
+        if (resizeFailed)
+            LOG(Error, "Failed to resize probe");
     }
-    else if (_current.Type == EntryType::SkyLight)
+
+    // Estimate the amount of update steps that fit into the GPU time budget (probe update is split over many frames to prevent spikes)
+    if (_updateTimerPending && _updateTimer->HasResult())
     {
-        auto skyLight = (SkyLight*)_current.Actor.Get();
-        Vector3 position = skyLight->GetPosition();
-        float nearPlane = 10.0f;
-        float farPlane = Math::Max(nearPlane + 1000.0f, skyLight->SkyDistanceThreshold * 2.0f);
-        customCullingNear = skyLight->SkyDistanceThreshold;
-
-        // Setup view
-        LargeWorlds::UpdateOrigin(_task->View.Origin, position);
-        _task->View.SetUpCube(nearPlane, farPlane, position - _task->View.Origin);
+        _updateTimerPending = false;
+        const float updateTime = _updateTimer->GetResult();
+        if (updateTime > 0.0f && _updateTimerSteps != 0)
+        {
+            const float stepCost = updateTime / (float)_updateTimerSteps;
+            _updateStepCost = _updateStepCost > 0.0f ? Math::Lerp(_updateStepCost, stepCost, 0.2f) : stepCost;
+        }
     }
-    _task->CameraCut();
-
-    // Resize buffers
-    bool resizeFailed = _output->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _probe->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _tmpFace->Resize(probeResolution, probeResolution, probeFormat);
-    resizeFailed |= _task->Resize(probeResolution, probeResolution);
-    if (resizeFailed)
-        LOG(Error, "Failed to resize probe");
-
-    // Disable actor during baking (it cannot influence own results)
-    const bool isActorActive = _current.Actor->GetIsActive();
-    _current.Actor->SetIsActive(false);
-
-    // Render scene for all faces
-    for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+    const float updateBudget = GraphicsSettings::Get()->ProbesUpdateBudget;
+    int32 stepsCount = 1;
+    if (updateBudget > 0.0f && _updateStepCost > 0.0f)
+        stepsCount = Math::Max((int32)(updateBudget / _updateStepCost), 1);
+    const int32 stepsEnd = Math::Min(_updateStep + stepsCount, PROBES_RENDERER_UPDATE_STEPS);
+    const bool measureUpdate = updateBudget > 0.0f && !_updateTimerPending;
+    if (measureUpdate)
     {
-        _task->View.SetFace(faceIndex);
+        if (!_updateTimer)
+            _updateTimer = GPUDevice::Instance->CreateTimerQuery();
+        _updateTimer->Begin();
+        _updateTimerPending = true;
+        _updateTimerSteps = stepsEnd - _updateStep;
+    }
 
-        // Handle custom frustum for the culling (used to skip objects near the camera)
-        if (customCullingNear > 0)
+    // Render scene for the cube faces
+    if (_updateStep < 6)
+    {
+        // Disable actor during baking (it cannot influence own results)
+        const bool isActorActive = _current.Actor->GetIsActive();
+        _current.Actor->SetIsActive(false);
+
+        for (; _updateStep < Math::Min(stepsEnd, 6); _updateStep++)
         {
-            Matrix p;
-            Matrix::PerspectiveFov(PI_OVER_2, 1.0f, customCullingNear, _task->View.Far, p);
-            _task->View.CullingFrustum.SetMatrix(_task->View.View, p);
-        }
+            const int32 faceIndex = _updateStep;
+            _task->View.SetFace(faceIndex);
 
-        // Render frame
-        Renderer::Render(_task);
-        context->ClearState();
+            // Handle custom frustum for the culling (used to skip objects near the camera)
+            if (_customCullingNear > 0)
+            {
+                Matrix p;
+                Matrix::PerspectiveFov(PI_OVER_2, 1.0f, _customCullingNear, _task->View.Far, p);
+                _task->View.CullingFrustum.SetMatrix(_task->View.View, p);
+            }
 
-        // Copy frame to cube face
-        {
-            PROFILE_GPU("Copy Face");
-            context->SetRenderTarget(_probe->View(faceIndex));
-            context->SetViewportAndScissors((float)probeResolution, (float)probeResolution);
-            context->Draw(_output->View());
-            context->ResetRenderTarget();
+            // Render frame
+            Renderer::Render(_task);
+            context->ClearState();
+
+            // Copy frame to cube face
+            {
+                PROFILE_GPU("Copy Face");
+                context->SetRenderTarget(_probe->View(faceIndex));
+                context->SetViewportAndScissors((float)probeResolution, (float)probeResolution);
+                context->Draw(_output->View());
+                context->ResetRenderTarget();
+            }
         }
-    }
 
-    // Enable actor back
-    _current.Actor->SetIsActive(isActorActive);
+        // Enable actor back
+        _current.Actor->SetIsActive(isActorActive);
+    }
 
     // Filter all lower mip levels
+    if (_updateStep == 6 && stepsEnd == PROBES_RENDERER_UPDATE_STEPS)
     {
         PROFILE_GPU("Filtering");
         Data data;
@@ -539,12 +595,20 @@ void ProbesRenderer::OnRender(RenderTask* task, GPUContext* context)
                 context->Draw(_tmpFace->View(0, mipIndex));
             }
         }
+        _updateStep++;
     }
+    if (measureUpdate)
+        _updateTimer->End();
 
     // Cleanup
     context->ClearState();
 
+    // Continue update in the next frame
+    if (_updateStep < PROBES_RENDERER_UPDATE_STEPS)
+        return;
+
     // Mark as rendered
+    _updateStep = 0;
     _updateFrameNumber = Engine::FrameCount;
     _task->Enabled = false;
 
@@ -9,6 +9,9 @@
 // Amount of frames to wait for data from probe update job
 #define PROBES_RENDERER_LATENCY_FRAMES 1
 
+// Amount of steps of a single probe update (rendering of each cubemap face and filtering) that are split over many frames
+#define PROBES_RENDERER_UPDATE_STEPS 7
+
 class EnvironmentProbe;
 class SkyLight;
 class RenderTask;
@@ -1,9 +1,12 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "RenderList.h"
+#include "OcclusionCullingPass.h"
+#include "InstanceCullingPass.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Graphics/Materials/IMaterial.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPULimits.h"
@@ -12,11 +15,22 @@
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/PostProcessEffect.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Content/Assets/CubeTexture.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Level/Actors/PostFxVolume.h"
 
+// The minimum amount of draw calls in the list to use multi-threaded sorting
+#define RENDER_LIST_PARALLEL_SORT_THRESHOLD 16384
+
+// Enables caching the instance buffers of the main view draw calls lists across frames to upload only the modified ranges
+#define RENDER_LIST_PERSISTENT_INSTANCE_BUFFERS 1
+
+// The size of the instance data page (in bytes) that is compared with the previous frame and uploaded as a whole
+#define RENDER_LIST_INSTANCE_BUFFER_PAGE_SIZE (64 * sizeof(InstanceData))
+
 static_assert(sizeof(DrawCall) <= 288, "Too big draw call data size.");
+static_assert(OFFSET_OF(DrawCall, InstanceCount) + sizeof(int32) <= 64, "Draw call data used for sorting and batching should fit into a single cache line.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Terrain), "Wrong draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Particle), "Wrong draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Custom), "Wrong draw call data size.");
@@ -38,6 +52,67 @@ namespace
     CriticalSection MemPoolLocker;
 }
 
+#if RENDER_LIST_PERSISTENT_INSTANCE_BUFFERS
+
+class InstanceBuffersCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    struct Entry
+    {
+        // The copy of the data uploaded to the GPU buffer.
+        Array<byte> Data;
+        GPUBuffer* Buffer = nullptr;
+    };
+
+    Entry Entries[(int32)DrawCallsListType::MAX];
+
+    ~InstanceBuffersCustomBuffer()
+    {
+        for (auto& e : Entries)
+            SAFE_DELETE_GPU_RESOURCE(e.Buffer);
+    }
+
+    GPUBuffer* Upload(GPUContext* context, Entry& e, const Array<byte>& data)
+    {
+        PROFILE_CPU();
+        const int32 size = data.Count();
+        if (!e.Buffer)
+            e.Buffer = GPUDevice::Instance->CreateBuffer(TEXT("Persistent Instance Buffer"));
+        if ((int32)e.Buffer->GetSize() < size)
+        {
+            const int32 numElements = Math::AlignUp<int32>((int32)((size / sizeof(InstanceData)) * 1.3f), 32);
+            if (e.Buffer->Init(GPUBufferDescription::Vertex(sizeof(InstanceData), numElements)))
+                return nullptr;
+            e.Data.Clear();
+        }
+
+        // Upload only the pages that changed since the last frame (merge consecutive pages into a single update)
+        const byte* src = data.Get();
+        const int32 prevSize = e.Data.Count();
+        int32 rangeStart = -1;
+        for (int32 offset = 0; offset < size; offset += RENDER_LIST_INSTANCE_BUFFER_PAGE_SIZE)
+        {
+            const int32 pageSize = Math::Min<int32>(RENDER_LIST_INSTANCE_BUFFER_PAGE_SIZE, size - offset);
+            const bool dirty = offset + pageSize > prevSize || Platform::MemoryCompare(src + offset, e.Data.Get() + offset, pageSize) != 0;
+            if (dirty && rangeStart == -1)
+            {
+                rangeStart = offset;
+            }
+            else if (!dirty && rangeStart != -1)
+            {
+                context->UpdateBuffer(e.Buffer, src + rangeStart, offset - rangeStart, rangeStart);
+                rangeStart = -1;
+            }
+        }
+        if (rangeStart != -1)
+            context->UpdateBuffer(e.Buffer, src + rangeStart, size - rangeStart, rangeStart);
+        e.Data.Set(src, size);
+        return e.Buffer;
+    }
+};
+
+#endif
+
 void RendererDirectionalLightData::SetupLightData(LightData* data, bool useShadow) const
 {
     data->SpotAngles.X = -2.0f;
@@ -393,9 +468,16 @@ void RenderList::Clear()
     Scenes.Clear();
     DrawCalls.Clear();
     BatchedDrawCalls.Clear();
+    ResidentInstancesDraws.Clear();
+    ImpostorsDraws.Clear();
+    Terrains.Clear();
     for (auto& list : DrawCallsLists)
         list.Clear();
     ShadowDepthDrawCallsList.Clear();
+    StaticShadowCasters = StaticShadowCastersMode::Default;
+    CubeFaces = false;
+    StaticDepthDrawCallsList.Clear();
+    StaticShadowDepthDrawCallsList.Clear();
     PointLights.Clear();
     SpotLights.Clear();
     SkyLights.Clear();
@@ -406,6 +488,13 @@ void RenderList::Clear()
     Sky = nullptr;
     AtmosphericFog = nullptr;
     Fog = nullptr;
+    OcclusionCulling = nullptr;
+    MeshletCulling = false;
+    MeshletsDraws.Clear();
+    TerrainCulling = false;
+    TerrainChunksDraws.Clear();
+    ComputeSkinning = false;
+    SkinnedMeshDraws.Clear();
     PostFx.Clear();
     Settings = PostProcessSettings();
     Blendable.Clear();
@@ -463,7 +552,10 @@ void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawMo
     // Add draw call to proper draw lists
     if ((drawModes & DrawPass::Depth) != DrawPass::None)
     {
-        DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.Add(index);
+        if (StaticShadowCasters == StaticShadowCastersMode::Default || !EnumHasAnyFlags(staticFlags, StaticFlags::Transform))
+            DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.Add(index);
+        else if (StaticShadowCasters == StaticShadowCastersMode::Separate)
+            StaticDepthDrawCallsList.Indices.Add(index);
     }
     if ((drawModes & (DrawPass::GBuffer | DrawPass::GlobalSurfaceAtlas)) != DrawPass::None)
     {
@@ -486,7 +578,58 @@ void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawMo
     }
 }
 
+namespace
+{
+    /// <summary>
+    /// Gets the mask of the point light shadow cube faces (in order of RenderView::SetFace) that intersect with the given bounds.
+    /// </summary>
+    /// <param name="view">The first cube face view (cube center and range).</param>
+    /// <param name="bounds">The object bounds.</param>
+    /// <returns>The faces mask (bit per face).</returns>
+    uint32 GetCubeFacesMask(const RenderView& view, const BoundingSphere& bounds)
+    {
+        const Float3 p = Float3(bounds.Center) - view.Position;
+        const float r = (float)bounds.Radius;
+        const float range = view.Far + r;
+        if (p.LengthSquared() > range * range)
+            return 0;
+
+        // Each face is a pyramid bounded by the diagonal planes that split the cube (eg. +X face is where x >= |y| and x >= |z|)
+        const float d = r * 1.41421356f;
+        const float xy0 = p.X - p.Y, xy1 = p.X + p.Y;
+        const float xz0 = p.X - p.Z, xz1 = p.X + p.Z;
+        const float yz0 = p.Y - p.Z, yz1 = p.Y + p.Z;
+        uint32 mask = 0;
+        if (xy0 >= -d && xy1 >= -d && xz0 >= -d && xz1 >= -d)
+            mask |= 1 << 0;
+        if (xy0 <= d && xy1 <= d && xz0 <= d && xz1 <= d)
+            mask |= 1 << 1;
+        if (xy0 <= d && xy1 >= -d && yz0 >= -d && yz1 >= -d)
+            mask |= 1 << 2;
+        if (xy0 >= -d && xy1 <= d && yz0 <= d && yz1 <= d)
+            mask |= 1 << 3;
+        if (xz0 <= d && xz1 >= -d && yz0 <= d && yz1 >= -d)
+            mask |= 1 << 4;
+        if (xz0 >= -d && xz1 <= d && yz0 >= -d && yz1 <= d)
+            mask |= 1 << 5;
+        return mask;
+    }
+
+    FORCE_INLINE void AddShadowDrawCall(RenderList* list, StaticFlags staticFlags, int32 index)
+    {
+        if (list->StaticShadowCasters == StaticShadowCastersMode::Default || !EnumHasAnyFlags(staticFlags, StaticFlags::Transform))
+            list->ShadowDepthDrawCallsList.Indices.Add(index);
+        else if (list->StaticShadowCasters == StaticShadowCastersMode::Separate)
+            list->StaticShadowDepthDrawCallsList.Indices.Add(index);
+    }
+}
+
 void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals, int16 sortOrder)
+{
+    AddDrawCall(renderContextBatch, drawModes, staticFlags, shadowsMode, bounds, drawCall, drawCall, receivesDecals, sortOrder);
+}
+
+void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, DrawCall& mainDrawCall, bool receivesDecals, int16 sortOrder)
 {
 #if ENABLE_ASSERTION_LOW_LAYERS
     // Ensure that draw modes are non-empty and in conjunction with material draw modes
@@ -498,34 +641,40 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
     // Append draw call data
     CalculateSortKey(mainRenderContext, drawCall, sortOrder);
     const int32 index = DrawCalls.Add(drawCall);
+    int32 mainIndex = index;
+    if (&mainDrawCall != &drawCall)
+    {
+        CalculateSortKey(mainRenderContext, mainDrawCall, sortOrder);
+        mainIndex = DrawCalls.Add(mainDrawCall);
+    }
 
     // Add draw call to proper draw lists
     DrawPass modes = drawModes & mainRenderContext.View.GetShadowsDrawPassMask(shadowsMode);
     drawModes = modes & mainRenderContext.View.Pass;
-    if (drawModes != DrawPass::None && mainRenderContext.View.CullingFrustum.Intersects(bounds))
+    if (drawModes != DrawPass::None && mainRenderContext.View.CullingFrustum.Intersects(bounds) && !(OcclusionCulling && OcclusionCulling->IsOccluded(bounds)))
     {
         if ((drawModes & DrawPass::Depth) != DrawPass::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.Add(mainIndex);
         }
         if ((drawModes & (DrawPass::GBuffer | DrawPass::GlobalSurfaceAtlas)) != DrawPass::None)
         {
             if (receivesDecals)
-                DrawCallsLists[(int32)DrawCallsListType::GBuffer].Indices.Add(index);
+                DrawCallsLists[(int32)DrawCallsListType::GBuffer].Indices.Add(mainIndex);
             else
-                DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].Indices.Add(index);
+                DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].Indices.Add(mainIndex);
         }
         if ((drawModes & DrawPass::Forward) != DrawPass::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(mainIndex);
         }
         if ((drawModes & DrawPass::Distortion) != DrawPass::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::Distortion].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::Distortion].Indices.Add(mainIndex);
         }
         if ((drawModes & DrawPass::MotionVectors) != DrawPass::None && (staticFlags & StaticFlags::Transform) == StaticFlags::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::MotionVectors].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::MotionVectors].Indices.Add(mainIndex);
         }
     }
     for (int32 i = 1; i < renderContextBatch.Contexts.Count(); i++)
@@ -533,31 +682,40 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
         const RenderContext& renderContext = renderContextBatch.Contexts.Get()[i];
         ASSERT_LOW_LAYER(renderContext.View.Pass == DrawPass::Depth);
         drawModes = modes & renderContext.View.Pass;
-        if (drawModes != DrawPass::None && renderContext.View.CullingFrustum.Intersects(bounds))
+        if (renderContext.List->CubeFaces)
         {
-            renderContext.List->ShadowDepthDrawCallsList.Indices.Add(index);
+            // Cull all 6 faces of the point light shadow cube at once
+            const uint32 facesMask = drawModes != DrawPass::None ? GetCubeFacesMask(renderContext.View, bounds) : 0;
+            for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
+            {
+                if (facesMask & (1 << faceIndex))
+                    AddShadowDrawCall(renderContextBatch.Contexts.Get()[i + faceIndex].List, staticFlags, index);
+            }
+            i += 5;
+            continue;
         }
+        if (drawModes != DrawPass::None && renderContext.View.CullingFrustum.Intersects(bounds))
+            AddShadowDrawCall(renderContext.List, staticFlags, index);
     }
 }
 
 namespace
 {
     /// <summary>
-    /// Checks if this draw call be batched together with the other one.
+    /// Checks if this draw call be batched together with the other one. Assumes that the first draw call material supports instancing.
     /// </summary>
     /// <param name="a">The first draw call.</param>
     /// <param name="b">The second draw call.</param>
+    /// <param name="handler">The first draw call material instancing handler.</param>
     /// <returns>True if can merge them, otherwise false.</returns>
-    FORCE_INLINE bool CanBatchWith(const DrawCall& a, const DrawCall& b)
+    FORCE_INLINE bool CanBatchWith(const DrawCall& a, const DrawCall& b, const IMaterial::InstancingHandler& handler)
     {
-        IMaterial::InstancingHandler handler;
+        // Compare the data from the beginning of the draw call structure first to skip reading the rest of it for the different geometry
         return a.Material == b.Material &&
-                a.Material->CanUseInstancing(handler) &&
-                Platform::MemoryCompare(&a.Geometry, &b.Geometry, sizeof(a.Geometry)) == 0 &&
-                a.InstanceCount != 0 &&
                 b.InstanceCount != 0 &&
-                handler.CanBatch(a, b) &&
-                a.WorldDeterminantSign == b.WorldDeterminantSign;
+                Platform::MemoryCompare(&a.Geometry, &b.Geometry, sizeof(a.Geometry)) == 0 &&
+                a.WorldDeterminantSign == b.WorldDeterminantSign &&
+                handler.CanBatch(a, b);
     }
 }
 
@@ -600,7 +758,10 @@ void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseD
 
     // Sort draw calls indices
     int32* resultIndices = list.Indices.Get();
-    Sorting::RadixSort(sortedKeys, resultIndices, SortingKeys[1].Get(), SortingIndices.Get(), listSize);
+    if (listSize >= RENDER_LIST_PARALLEL_SORT_THRESHOLD)
+        Sorting::RadixSortParallel(sortedKeys, resultIndices, SortingKeys[1].Get(), SortingIndices.Get(), listSize);
+    else
+        Sorting::RadixSort(sortedKeys, resultIndices, SortingKeys[1].Get(), SortingIndices.Get(), listSize);
     if (resultIndices != list.Indices.Get())
         Platform::MemoryCopy(list.Indices.Get(), resultIndices, sizeof(int32) * listSize);
 
@@ -613,14 +774,18 @@ void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseD
         int32 instanceCount = drawCall.InstanceCount;
 
         // Check the following draw calls to merge them (using instancing)
-        for (int32 j = i + 1; j < listSize; j++)
+        IMaterial::InstancingHandler handler;
+        if (drawCall.InstanceCount != 0 && drawCall.Material->CanUseInstancing(handler))
         {
-            const DrawCall& other = drawCallsData[listData[j]];
-            if (!CanBatchWith(drawCall, other))
-                break;
+            for (int32 j = i + 1; j < listSize; j++)
+            {
+                const DrawCall& other = drawCallsData[listData[j]];
+                if (!CanBatchWith(drawCall, other, handler))
+                    break;
 
-            batchSize++;
-            instanceCount += other.InstanceCount;
+                batchSize++;
+                instanceCount += other.InstanceCount;
+            }
         }
 
         DrawBatch batch;
@@ -642,23 +807,101 @@ FORCE_INLINE bool CanUseInstancing(DrawPass pass)
     return pass == DrawPass::GBuffer || pass == DrawPass::Depth;
 }
 
-void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input)
+void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input, GPUContext* context)
 {
     if (list.IsEmpty())
         return;
-    PROFILE_GPU_CPU("Drawing");
+    PROFILE_CPU();
     const auto* drawCallsData = drawCalls.Get();
     const auto* listData = list.Indices.Get();
     const auto* batchesData = list.Batches.Get();
-    const auto context = GPUDevice::Instance->GetMainContext();
+    if (!context)
+        context = GPUDevice::Instance->GetMainContext();
+    const bool isMainContext = context == GPUDevice::Instance->GetMainContext();
+#if COMPILE_WITH_PROFILER
+    // GPU profiler events can be recorded only on the main context
+    const int32 profileEventGPU = isMainContext ? ProfilerGPU::BeginEvent(TEXT("Drawing")) : -1;
+#endif
     bool useInstancing = list.CanUseInstancing && CanUseInstancing(renderContext.View.Pass) && GPUDevice::Instance->Limits.HasInstancing;
 
     // Clear SR slots to prevent any resources binding issues (leftovers from the previous passes)
     context->ResetSR();
 
     // Prepare instance buffer
+    Array<int32, RendererAllocation> culledBatches;
+    Array<int32, RendererAllocation> residentBatches;
+    GPUBuffer* culledInstancesBuffer = nullptr;
+    GPUBuffer* instanceBuffer = nullptr;
+    GPUBuffer* culledArgsBuffer = nullptr;
+    GPUBuffer* residentInstancesBuffer = nullptr;
+    GPUBuffer* residentArgsBuffer = nullptr;
     if (useInstancing)
     {
+        // Cull the GPU-resident instances with LOD selection on a GPU (indirect draw of each LOD with the visible instances only)
+        auto instanceCullingPass = InstanceCullingPass::Instance();
+        if (isMainContext && ResidentInstancesDraws.Count() != 0)
+        {
+            Array<const ResidentInstancesDraw*, RendererAllocation> residentDraws;
+            Array<int32, RendererAllocation> residentDrawsMapping;
+            Array<InstanceCullingPass::ResidentArgs, RendererAllocation> residentArgs;
+            for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
+            {
+                auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+                if (batch.ResidentDraw == -1)
+                    continue;
+                if (residentBatches.IsEmpty())
+                {
+                    residentBatches.Resize(list.PreBatchedDrawCalls.Count());
+                    residentBatches.SetAll(-1);
+                    residentDrawsMapping.Resize(ResidentInstancesDraws.Count());
+                    residentDrawsMapping.SetAll(-1);
+                }
+                int32& drawIndex = residentDrawsMapping.Get()[batch.ResidentDraw];
+                if (drawIndex == -1)
+                {
+                    drawIndex = residentDraws.Count();
+                    residentDraws.Add(&ResidentInstancesDraws.Get()[batch.ResidentDraw]);
+                }
+                residentBatches.Get()[i] = residentArgs.Count();
+                auto& args = residentArgs.AddOne();
+                args.Draw = drawIndex;
+                args.LOD = batch.ResidentLOD;
+                args.IndicesCount = batch.DrawCall.Draw.IndicesCount;
+                args.StartIndex = batch.DrawCall.Draw.StartIndex;
+            }
+            if (residentArgs.HasItems() && instanceCullingPass->CullResident(renderContext, context, residentDraws, residentArgs, residentInstancesBuffer, residentArgsBuffer))
+            {
+                // Resident instances are not available on a CPU so skip them
+                residentBatches.SetAll(-1);
+            }
+        }
+
+        // Cull large pre-batched draw calls on a GPU (indirect draw with the visible instances only)
+        Array<InstanceCullingPass::Batch, RendererAllocation> cullingBatches;
+        for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
+        {
+            auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+            if (!isMainContext || batch.ResidentDraw != -1 || batch.DrawCall.InstanceCount == 0 || batch.Bounds.Radius <= 0 || !instanceCullingPass->CanCull(renderContext, batch.Instances.Count()))
+                continue;
+            if (culledBatches.IsEmpty())
+            {
+                culledBatches.Resize(list.PreBatchedDrawCalls.Count());
+                culledBatches.SetAll(-1);
+            }
+            culledBatches.Get()[i] = cullingBatches.Count();
+            auto& cullingBatch = cullingBatches.AddOne();
+            cullingBatch.Instances = batch.Instances.Get();
+            cullingBatch.InstancesCount = batch.Instances.Count();
+            cullingBatch.Bounds = batch.Bounds;
+            cullingBatch.IndicesCount = batch.DrawCall.Draw.IndicesCount;
+            cullingBatch.StartIndex = batch.DrawCall.Draw.StartIndex;
+        }
+        if (cullingBatches.HasItems() && instanceCullingPass->Cull(renderContext, context, cullingBatches, culledInstancesBuffer, culledArgsBuffer))
+        {
+            // Fallback to the CPU instances upload
+            culledBatches.Clear();
+        }
+
         // Prepare buffer memory
         int32 instancedBatchesCount = 0;
         for (int32 i = 0; i < list.Batches.Count(); i++)
@@ -670,10 +913,10 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
-            if (batch.Instances.Count() > 1)
+            if (batch.Instances.Count() > 1 && (culledBatches.IsEmpty() || culledBatches.Get()[i] == -1))
                 instancedBatchesCount += batch.Instances.Count();
         }
-        if (instancedBatchesCount == 0)
+        if (instancedBatchesCount == 0 && culledBatches.IsEmpty() && residentBatches.IsEmpty())
         {
             // Faster path if none of the draw batches requires instancing
             useInstancing = false;
@@ -702,7 +945,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
-            if (batch.Instances.Count() > 1)
+            if (batch.Instances.Count() > 1 && (culledBatches.IsEmpty() || culledBatches.Get()[i] == -1))
             {
                 Platform::MemoryCopy(instanceData, batch.Instances.Get(), batch.Instances.Count() * sizeof(InstanceData));
                 instanceData += batch.Instances.Count();
@@ -710,7 +953,21 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
         }
 
         // Upload data
-        _instanceBuffer.Flush(context);
+#if RENDER_LIST_PERSISTENT_INSTANCE_BUFFERS
+        const int32 listIndex = (int32)(&list - DrawCallsLists);
+        if (isMainContext && renderContext.Buffers && listIndex >= 0 && listIndex < (int32)DrawCallsListType::MAX && EnumHasAnyFlags(renderContext.View.Pass, DrawPass::GBuffer))
+        {
+            // Main view draw calls are mostly the same between frames so reuse the instance buffer contents from the previous frame
+            auto& instanceBuffers = *renderContext.Buffers->GetCustomBuffer<InstanceBuffersCustomBuffer>(TEXT("InstanceBuffers"));
+            instanceBuffers.LastFrameUsed = Engine::FrameCount;
+            instanceBuffer = instanceBuffers.Upload(context, instanceBuffers.Entries[listIndex], _instanceBuffer.Data);
+        }
+#endif
+        if (!instanceBuffer)
+        {
+            _instanceBuffer.Flush(context);
+            instanceBuffer = _instanceBuffer.GetBuffer();
+        }
     }
 
 DRAW:
@@ -766,7 +1023,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 else
                 {
                     vbCount = 3;
-                    vb[vbCount] = _instanceBuffer.GetBuffer();
+                    vb[vbCount] = instanceBuffer;
                     vbOffsets[vbCount] = 0;
                     vbCount++;
                     context->BindVB(ToSpan(vb, vbCount), vbOffsets);
@@ -793,8 +1050,11 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 vbOffsets[vbCount] = 0;
             }
 
+            if (batch.ResidentDraw != -1 && (residentBatches.IsEmpty() || residentBatches.Get()[i] == -1))
+                continue;
+
             bindParams.FirstDrawCall = &drawCall;
-            bindParams.DrawCallsCount = batch.Instances.Count();
+            bindParams.DrawCallsCount = batch.ResidentDraw != -1 ? 1 : batch.Instances.Count();
             drawCall.Material->Bind(bindParams);
 
             context->BindIB(drawCall.Geometry.IndexBuffer);
@@ -805,6 +1065,26 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 context->BindVB(ToSpan(vb, vbCount), vbOffsets);
                 context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
             }
+            else if (batch.ResidentDraw != -1)
+            {
+                // Draw the GPU-resident instances that passed the GPU culling with this LOD selected
+                vbCount = 3;
+                vb[vbCount] = residentInstancesBuffer;
+                vbOffsets[vbCount] = 0;
+                vbCount++;
+                context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                context->DrawIndexedInstancedIndirect(residentArgsBuffer, residentBatches.Get()[i] * sizeof(GPUDrawIndexedIndirectArgs));
+            }
+            else if (culledBatches.HasItems() && culledBatches.Get()[i] != -1)
+            {
+                // Draw instances that passed the GPU culling
+                vbCount = 3;
+                vb[vbCount] = culledInstancesBuffer;
+                vbOffsets[vbCount] = 0;
+                vbCount++;
+                context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                context->DrawIndexedInstancedIndirect(culledArgsBuffer, culledBatches.Get()[i] * sizeof(GPUDrawIndexedIndirectArgs));
+            }
             else
             {
                 if (batch.Instances.Count() == 1)
@@ -815,7 +1095,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 else
                 {
                     vbCount = 3;
-                    vb[vbCount] = _instanceBuffer.GetBuffer();
+                    vb[vbCount] = instanceBuffer;
                     vbOffsets[vbCount] = 0;
                     vbCount++;
                     context->BindVB(ToSpan(vb, vbCount), vbOffsets);
@@ -900,6 +1180,10 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             }
         }
     }
+
+#if COMPILE_WITH_PROFILER
+    ProfilerGPU::EndEvent(profileEventGPU);
+#endif
 }
 
 void SurfaceDrawCallHandler::GetHash(const DrawCall& drawCall, uint32& batchKey)
@@ -926,3 +1210,38 @@ void SurfaceDrawCallHandler::WriteDrawCall(InstanceData* instanceData, const Dra
     instanceData->InstanceTransform3 = Float3(drawCall.World.M31, drawCall.World.M32, drawCall.World.M33);
     instanceData->InstanceLightmapArea = Half4(drawCall.Surface.LightmapUVsArea);
 }
+
+ResidentInstances::~ResidentInstances()
+{
+    SAFE_DELETE_GPU_RESOURCE(Buffer);
+}
+
+GPUBuffer* ResidentInstances::Upload(GPUContext* context)
+{
+    if (!Dirty)
+        return Buffer;
+    Dirty = false;
+    if (Data.IsEmpty())
+    {
+        SAFE_DELETE_GPU_RESOURCE(Buffer);
+        return nullptr;
+    }
+    PROFILE_CPU();
+    if (!Buffer)
+        Buffer = GPUDevice::Instance->CreateBuffer(TEXT("ResidentInstances"));
+    const uint32 size = Data.Count() * sizeof(InstanceData);
+    if (Buffer->GetSize() < size || Buffer->GetSize() > size * 2)
+    {
+        if (Buffer->Init(GPUBufferDescription::Structured(Data.Count(), sizeof(InstanceData))))
+        {
+            SAFE_DELETE_GPU_RESOURCE(Buffer);
+            return nullptr;
+        }
+    }
+    context->UpdateBuffer(Buffer, Data.Get(), size);
+
+    // Instances are kept in the GPU memory only
+    Data.Resize(0);
+    Data.SetCapacity(0);
+    return Buffer;
+}
@@ -4,6 +4,9 @@
 
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Math/Half.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Graphics/Models/Config.h"
 #include "Engine/Graphics/PostProcessSettings.h"
 #include "Engine/Graphics/DynamicBuffer.h"
 #include "Engine/Scripting/ScriptingObject.h"
@@ -21,6 +24,12 @@ class IPostFxSettingsProvider;
 class CubeTexture;
 struct RenderContext;
 struct RenderContextBatch;
+struct OcclusionCullingData;
+struct SkinnedMeshVertices;
+class Mesh;
+class SkinnedMeshDrawData;
+class SkinnedMesh;
+class BlendShapesInstance;
 
 struct RendererDirectionalLightData
 {
@@ -193,6 +202,19 @@ API_ENUM() enum class DrawCallsListType
     MAX,
 };
 
+/// <summary>
+/// The static shadow casters collecting modes for the shadow projection render lists (used by the cached shadow maps).
+/// </summary>
+enum class StaticShadowCastersMode
+{
+    // Static shadow casters are collected with the other draw calls.
+    Default,
+    // Static shadow casters are skipped (they are already in the cached shadow map).
+    Skip,
+    // Static shadow casters are collected into the separate draw calls lists (to refresh the cached shadow map).
+    Separate,
+};
+
 /// <summary>
 /// Represents a patch of draw calls that can be submitted to rendering.
 /// </summary>
@@ -228,6 +250,124 @@ struct BatchedDrawCall
 {
     DrawCall DrawCall;
     Array<struct InstanceData, RendererAllocation> Instances;
+
+    // The local-space bounds of the geometry (used by the GPU instances culling). Zero radius if unknown.
+    BoundingSphere Bounds = BoundingSphere(Vector3::Zero, 0);
+
+    // The index of the GPU-resident instances draw (in RenderList::ResidentInstancesDraws) that provides the instances of this batch (culled with LOD selection on a GPU). Instances array is empty then. -1 if unused.
+    int32 ResidentDraw = -1;
+
+    // The model LOD index drawn by this batch (used with the GPU-resident instances draw).
+    int32 ResidentLOD = 0;
+};
+
+struct ResidentInstancesDraw
+{
+    // The GPU-resident instances (eg. all instances of the foliage type).
+    struct ResidentInstances* Instances;
+
+    // The ranges (offset and count) of the instances to cull (eg. visible foliage clusters). Up to 64 instances per range.
+    Array<Int2, RendererAllocation> Ranges;
+
+    // The offset to add to the instances origin to get the location relative to the view origin.
+    Float3 OriginOffset;
+
+    // The local-space bounds of the model.
+    BoundingSphere Bounds;
+
+    // The instances cull distance (the random range is scaled by the per-instance random value).
+    float CullDistance;
+    float CullDistanceRandomRange;
+
+    // The minimum screen size of the model (smaller instances are culled).
+    float MinScreenSize;
+
+    // The model LODs count and the first LOD that can be drawn (eg. with streamed-in data).
+    int32 LODsCount;
+    int32 MinLOD;
+
+    // The model LODs screen sizes.
+    float LODScreenSizes[MODEL_MAX_LODS];
+};
+
+struct MeshletsDraw
+{
+    // The drawn mesh (with meshlets).
+    const Mesh* Mesh;
+
+    // The object world matrix (relative to the view origin).
+    Matrix World;
+
+    // True if meshlets can be culled against backfaces (single-sided material and uniformly scaled object).
+    bool CullBackfaces;
+};
+
+struct TerrainChunksDraw
+{
+    // The terrain chunk to cull (layout must match the TerrainCulling shader).
+    struct Chunk
+    {
+        // The world-space bounds of the chunk (relative to the view origin).
+        Float3 BoundsMin;
+        // The index of the first indirect draw arguments of the patch (one per patch LOD in range MinLOD-MaxLOD).
+        uint32 ArgsOffset;
+        Float3 BoundsMax;
+        // The index of the first chunk instance in the output buffer for the patch (16 chunks per patch LOD in range MinLOD-MaxLOD).
+        uint32 OutputOffset;
+        // The neighbor chunks indices (within the draw) ordered: bottom, left, right, top. Index of this chunk if there is no neighbor.
+        int32 Neighbors[4];
+        // The lightmap UVs area of the chunk.
+        Rectangle LightmapArea;
+        // The chunk coordinates within the patch.
+        Float2 ChunkCoord;
+        // The LODs range of the patch.
+        uint32 MinLOD;
+        uint32 MaxLOD;
+    };
+
+    // The culled chunks (16 per drawn patch).
+    Array<Chunk, RendererAllocation> Chunks;
+
+    // The position of the view used for the LOD selection (relative to the view origin).
+    Float3 LODViewPosition;
+
+    // The terrain LOD selection parameters (matches TerrainChunk::PrepareDraw).
+    float InvChunkEdgeSize;
+    float LODDistribution;
+    int32 LODBias;
+
+    // The terrain chunk size (amount of quads per chunk edge at LOD0).
+    int32 ChunkSize;
+};
+
+struct ImpostorsDraw
+{
+    // The drawn model impostor.
+    const class ModelImpostor* Impostor;
+
+    // The impostor instances (world transformation relative to the view origin and the dither factor of the transition from the model).
+    Array<struct InstanceData, RendererAllocation> Instances;
+};
+
+struct SkinnedMeshDraw
+{
+    // The skinned mesh vertex buffer (in the skinned vertex layout).
+    GPUBuffer* VertexBuffer;
+
+    // The amount of vertices to skin.
+    uint32 VerticesCount;
+
+    // The skinning data with the bone matrices.
+    SkinnedMeshDrawData* Skinning;
+
+    // The output vertices.
+    SkinnedMeshVertices* Output;
+
+    // The skinned mesh.
+    const SkinnedMesh* Mesh;
+
+    // The blend shapes to apply to the mesh vertices before skinning. Null if unused.
+    BlendShapesInstance* BlendShapes;
 };
 
 /// <summary>
@@ -299,6 +439,21 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     RenderListBuffer<BatchedDrawCall> BatchedDrawCalls;
 
+    /// <summary>
+    /// Draws of the GPU-resident instances used by the pre-batched draw calls (culled with LOD selection on a GPU).
+    /// </summary>
+    RenderListBuffer<ResidentInstancesDraw> ResidentInstancesDraws;
+
+    /// <summary>
+    /// Draws of the model impostors instances (see ImpostorsPass). Drawn into the GBuffer after the objects that cannot get decals.
+    /// </summary>
+    RenderListBuffer<ImpostorsDraw> ImpostorsDraws;
+
+    /// <summary>
+    /// The terrains drawn into the GBuffer of the view (see TerrainVirtualTexturePass). Used to render the terrain virtual texture tiles.
+    /// </summary>
+    RenderListBuffer<class Terrain*> Terrains;
+
     /// <summary>
     /// The draw calls lists. Each for the separate draw pass.
     /// </summary>
@@ -309,6 +464,26 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     DrawCallsList ShadowDepthDrawCallsList;
 
+    /// <summary>
+    /// The static shadow casters collecting mode for the shadow projection render list. Static casters are the objects with a static transform.
+    /// </summary>
+    StaticShadowCastersMode StaticShadowCasters = StaticShadowCastersMode::Default;
+
+    /// <summary>
+    /// True if the shadow projection render list is the first of the 6 cube faces of the point light shadow (followed by the other faces lists in order of RenderView::SetFace). Draw calls are culled against the light range once and added to the faces with a per-face mask instead of testing each face frustum.
+    /// </summary>
+    bool CubeFaces = false;
+
+    /// <summary>
+    /// The draw calls list for Depth drawing of the static shadow casters (when using StaticShadowCastersMode::Separate).
+    /// </summary>
+    DrawCallsList StaticDepthDrawCallsList;
+
+    /// <summary>
+    /// The draw calls list for Depth drawing of the static shadow casters into Shadow Projections that use DrawCalls from main render context (when using StaticShadowCastersMode::Separate).
+    /// </summary>
+    DrawCallsList StaticShadowDepthDrawCallsList;
+
     /// <summary>
     /// Light pass members - directional lights
     /// </summary>
@@ -369,6 +544,41 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     RenderSetup Setup;
 
+    /// <summary>
+    /// The Hi-Z occlusion culling data used to skip hidden draw calls (from one of the previous frames). Null if occlusion culling is not used.
+    /// </summary>
+    const OcclusionCullingData* OcclusionCulling = nullptr;
+
+    /// <summary>
+    /// True if the meshes with meshlets can be drawn with the meshlets culled on a GPU (see MeshletCullingPass), otherwise false.
+    /// </summary>
+    bool MeshletCulling = false;
+
+    /// <summary>
+    /// The meshes draws with the meshlets culled on a GPU (see MeshletCullingPass). Index of the draw matches the indirect draw arguments of its draw call.
+    /// </summary>
+    RenderListBuffer<MeshletsDraw> MeshletsDraws;
+
+    /// <summary>
+    /// True if the terrain can be drawn with the chunks LOD selection and culling done on a GPU (see TerrainCullingPass), otherwise false.
+    /// </summary>
+    bool TerrainCulling = false;
+
+    /// <summary>
+    /// The terrains draws with the chunks culled on a GPU (see TerrainCullingPass).
+    /// </summary>
+    RenderListBuffer<TerrainChunksDraw> TerrainChunksDraws;
+
+    /// <summary>
+    /// True if the skinned meshes can be drawn with the vertices skinned on a GPU with a compute shader (see ComputeSkinningPass), otherwise false.
+    /// </summary>
+    bool ComputeSkinning = false;
+
+    /// <summary>
+    /// The skinned meshes to skin with a compute shader before rendering (see ComputeSkinningPass). Each mesh is skinned once per frame.
+    /// </summary>
+    RenderListBuffer<SkinnedMeshDraw> SkinnedMeshDraws;
+
     /// <summary>
     /// The post process settings.
     /// </summary>
@@ -505,6 +715,20 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="sortOrder">Object sorting key.</param>
     void AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals = true, int16 sortOrder = 0);
 
+    /// <summary>
+    /// Adds the draw call to the draw lists and references it in other render contexts. Uses a separate draw call for the main render context (eg. with a geometry culled for the main view only). Performs additional per-context frustum culling.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch. This assumes that RenderContextBatch contains main context and shadow projections only.</param>
+    /// <param name="drawModes">The object draw modes.</param>
+    /// <param name="staticFlags">The object static flags.</param>
+    /// <param name="shadowsMode">The object shadows casting mode.</param>
+    /// <param name="bounds">The object bounds.</param>
+    /// <param name="drawCall">The draw call data (for the shadow projections).</param>
+    /// <param name="mainDrawCall">The draw call data for the main render context.</param>
+    /// <param name="receivesDecals">True if the rendered mesh can receive decals.</param>
+    /// <param name="sortOrder">Object sorting key.</param>
+    void AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, DrawCall& mainDrawCall, bool receivesDecals = true, int16 sortOrder = 0);
+
     /// <summary>
     /// Sorts the collected draw calls list.
     /// </summary>
@@ -554,7 +778,8 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="list">The collected draw calls indices list.</param>
     /// <param name="drawCalls">The collected draw calls list.</param>
     /// <param name="input">The input scene color. It's optional and used in forward/postFx rendering.</param>
-    void ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input);
+    /// <param name="context">The GPU context to record the draw calls. Null uses the main context. Deferred contexts can execute draw calls of the different render lists in parallel (GPU culling and persistent instance buffers are not used then).</param>
+    void ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input, GPUContext* context = nullptr);
 };
 
 /// <summary>
@@ -571,6 +796,49 @@ PACK_STRUCT(struct FLAXENGINE_API InstanceData
     Half4 InstanceLightmapArea;
     });
 
+/// <summary>
+/// The instances data kept resident in the GPU memory (eg. all instances of the foliage type) to be culled with LOD selection on a GPU. The data is uploaded on the first use after the change and then released from the CPU memory.
+/// </summary>
+struct FLAXENGINE_API ResidentInstances
+{
+    /// <summary>
+    /// The instances data to upload (origin is relative to the Origin). Released after the upload.
+    /// </summary>
+    Array<InstanceData> Data;
+
+    /// <summary>
+    /// The world-space origin of the instances.
+    /// </summary>
+    Vector3 Origin = Vector3::Zero;
+
+    /// <summary>
+    /// The version of the data (used by the owner to detect the changes).
+    /// </summary>
+    uint32 Version = 0;
+
+    /// <summary>
+    /// True if data needs to be uploaded to the GPU buffer.
+    /// </summary>
+    bool Dirty = false;
+
+    /// <summary>
+    /// The GPU buffer with the instances data.
+    /// </summary>
+    GPUBuffer* Buffer = nullptr;
+
+    ResidentInstances() = default;
+    ResidentInstances(const ResidentInstances&) = delete;
+    ResidentInstances& operator=(const ResidentInstances&) = delete;
+    ~ResidentInstances();
+
+    /// <summary>
+    /// Uploads the instances data to the GPU buffer if it has been modified.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    /// <returns>The GPU buffer (raw, with InstanceData elements) or null if failed or empty.</returns>
+    GPUBuffer* Upload(GPUContext* context);
+};
+
 struct SurfaceDrawCallHandler
 {
     static void GetHash(const DrawCall& drawCall, uint32& batchKey);
@@ -12,4 +12,7 @@ struct FLAXENGINE_API RenderSetup
     RenderingUpscaleLocation UpscaleLocation = RenderingUpscaleLocation::AfterAntiAliasingPass;
     bool UseMotionVectors = false;
     bool UseTemporalAAJitter = false;
+
+    // True if the temporal upscaling is used to reconstruct the output resolution image from the jittered frames rendered at the lower resolution (before post processing). Done by TAA, unless CustomUpscale post effect is used. Temporal upscalers implemented as CustomUpscale post effects (eg. vendor upscalers) can enable it (together with TemporalAA jitter and motion vectors) in PreRender to replace TAA.
+    bool UseTemporalUpscaling = false;
 };
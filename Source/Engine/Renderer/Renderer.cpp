@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Renderer.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderBuffers.h"
@@ -20,13 +21,23 @@
 #include "ColorGradingPass.h"
 #include "MotionBlurPass.h"
 #include "VolumetricFogPass.h"
+#include "VariableRateShadingPass.h"
 #include "HistogramPass.h"
+#include "OcclusionCullingPass.h"
+#include "InstanceCullingPass.h"
+#include "MeshletCullingPass.h"
+#include "TerrainCullingPass.h"
+#include "ImpostorsPass.h"
+#include "TerrainVirtualTexturePass.h"
+#include "ComputeSkinningPass.h"
+#include "LightClustersPass.h"
 #include "AtmospherePreCompute.h"
 #include "GlobalSignDistanceFieldPass.h"
 #include "GI/GlobalSurfaceAtlasPass.h"
 #include "GI/DynamicDiffuseGlobalIllumination.h"
 #include "Utils/MultiScaler.h"
 #include "Utils/BitonicSort.h"
+#include "Utils/RadixSort.h"
 #include "AntiAliasing/FXAA.h"
 #include "AntiAliasing/TAA.h"
 #include "AntiAliasing/SMAA.h"
@@ -83,13 +94,23 @@ bool RendererService::Init()
     PassList.Add(MotionBlurPass::Instance());
     PassList.Add(MultiScaler::Instance());
     PassList.Add(BitonicSort::Instance());
+    PassList.Add(RadixSort::Instance());
     PassList.Add(FXAA::Instance());
     PassList.Add(TAA::Instance());
     PassList.Add(SMAA::Instance());
     PassList.Add(HistogramPass::Instance());
+    PassList.Add(OcclusionCullingPass::Instance());
+    PassList.Add(InstanceCullingPass::Instance());
+    PassList.Add(MeshletCullingPass::Instance());
+    PassList.Add(TerrainCullingPass::Instance());
+    PassList.Add(ImpostorsPass::Instance());
+    PassList.Add(TerrainVirtualTexturePass::Instance());
+    PassList.Add(ComputeSkinningPass::Instance());
+    PassList.Add(LightClustersPass::Instance());
     PassList.Add(GlobalSignDistanceFieldPass::Instance());
     PassList.Add(GlobalSurfaceAtlasPass::Instance());
     PassList.Add(DynamicDiffuseGlobalIlluminationPass::Instance());
+    PassList.Add(VariableRateShadingPass::Instance());
 #if USE_EDITOR
     PassList.Add(QuadOverdrawPass::Instance());
 #endif
@@ -166,6 +187,7 @@ bool Renderer::IsReady()
 void Renderer::Render(SceneRenderTask* task)
 {
     PROFILE_GPU_CPU_NAMED("Render Frame");
+    PROFILE_MEM(Rendering);
 
     // Prepare GPU context
     auto context = GPUDevice::Instance->GetMainContext();
@@ -295,6 +317,54 @@ void Renderer::DrawActors(RenderContext& renderContext, const Array<Actor*>& cus
     }
 }
 
+/// <summary>
+/// Helper structure used to join the work dispatched on the async compute context back with the main context.
+/// </summary>
+struct AsyncComputeSync
+{
+    GPUContext* Context;
+    GPUContext* AsyncContext = nullptr;
+    uint64 SyncPoint = 0;
+
+    AsyncComputeSync(GPUContext* context)
+        : Context(context)
+    {
+    }
+
+    ~AsyncComputeSync()
+    {
+        Join();
+    }
+
+    static bool CanUse(const RendererPassBase* pass)
+    {
+        return Graphics::EnableAsyncCompute && pass->CanUseAsyncCompute() && GPUDevice::Instance->GetAsyncComputeContext();
+    }
+
+    GPUContext* Begin()
+    {
+        // Start the async work after the commands recorded so far on the main context
+        AsyncContext = GPUDevice::Instance->GetAsyncComputeContext();
+        AsyncContext->Wait(Context, Context->Signal());
+        return AsyncContext;
+    }
+
+    void End()
+    {
+        if (AsyncContext)
+            SyncPoint = AsyncContext->Signal();
+    }
+
+    void Join()
+    {
+        if (AsyncContext)
+        {
+            Context->Wait(AsyncContext, SyncPoint);
+            AsyncContext = nullptr;
+        }
+    }
+};
+
 void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderContextBatch& renderContextBatch)
 {
     auto context = GPUDevice::Instance->GetMainContext();
@@ -333,6 +403,7 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
                     renderContext.List->Settings.AntiAliasing.Mode == AntialiasingMode::TemporalAntialiasing;
         }
         setup.UseTemporalAAJitter = aaMode == AntialiasingMode::TemporalAntialiasing;
+        setup.UseTemporalUpscaling = setup.UseTemporalAAJitter && setup.UseMotionVectors && renderContext.Task->RenderingPercentage < 1.0f && setup.UpscaleLocation == RenderingUpscaleLocation::BeforePostProcessingPass && !renderContext.List->HasAnyPostFx(renderContext, PostProcessEffectLocation::CustomUpscale);
 
         // Customize setup (by postfx or custom gameplay effects)
         renderContext.Task->SetupRender(renderContext);
@@ -343,6 +414,11 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     // Prepare
     renderContext.View.Prepare(renderContext);
     renderContext.Buffers->Prepare();
+    OcclusionCullingPass::Instance()->Prepare(renderContext);
+    MeshletCullingPass::Instance()->Prepare(renderContext);
+    InstanceCullingPass::Instance()->Prepare();
+    ImpostorsPass::Instance()->Prepare(context);
+    ComputeSkinningPass::Instance()->Prepare(renderContext);
 
     // Build batch of render contexts (main view and shadow projections)
     {
@@ -367,6 +443,7 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         }
         if (drawShadows)
             ShadowsPass::Instance()->SetupShadows(renderContext, renderContextBatch);
+        TerrainCullingPass::Instance()->Prepare(renderContextBatch);
 #if USE_EDITOR
         GBufferPass::Instance()->PreOverrideDrawCalls(renderContext);
 #endif
@@ -401,9 +478,26 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
             auto& shadowContext = renderContextBatch.Contexts[i];
             shadowContext.List->SortDrawCalls(shadowContext, false, DrawCallsListType::Depth);
             shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls);
+            if (shadowContext.List->StaticShadowCasters == StaticShadowCastersMode::Separate)
+            {
+                shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->StaticDepthDrawCallsList, shadowContext.List->DrawCalls);
+                shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->StaticShadowDepthDrawCallsList, renderContext.List->DrawCalls);
+            }
         }
     }
 
+    // Skin the skinned meshes drawn with compute skinning
+    ComputeSkinningPass::Instance()->Render(renderContext, context);
+
+    // Cull meshlets of the main view draw calls
+    MeshletCullingPass::Instance()->Render(renderContext, context);
+
+    // Select LOD and cull terrain chunks of all views in the batch
+    TerrainCullingPass::Instance()->Render(renderContextBatch, context);
+
+    // Update terrain virtual texture tiles around the view
+    TerrainVirtualTexturePass::Instance()->Render(renderContext, context);
+
     // Get the light accumulation buffer
     auto outputFormat = renderContext.Buffers->GetOutputFormat();
     auto tempFlags = GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget;
@@ -427,7 +521,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
 #endif
 
     // Global SDF rendering (can be used by materials later on)
-    if (graphicsSettings->EnableGlobalSDF && EnumHasAnyFlags(view.Flags, ViewFlags::GlobalSDF))
+    const bool useGlobalSDF = graphicsSettings->EnableGlobalSDF && EnumHasAnyFlags(view.Flags, ViewFlags::GlobalSDF);
+    const bool useAsyncGlobalSDF = useGlobalSDF && AsyncComputeSync::CanUse(GlobalSignDistanceFieldPass::Instance());
+    if (useGlobalSDF && !useAsyncGlobalSDF)
     {
         GlobalSignDistanceFieldPass::BindingData bindingData;
         GlobalSignDistanceFieldPass::Instance()->Render(renderContext, context, bindingData);
@@ -436,7 +532,22 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     // Fill GBuffer
     GBufferPass::Instance()->Fill(renderContext, lightBuffer);
 
+    // Update Global SDF on async compute to overlap it with the motion vectors, ambient occlusion and shadow maps rendering (GBuffer materials use the previous frame data)
+    AsyncComputeSync asyncCompute(context);
+    if (useAsyncGlobalSDF)
+    {
+        GPUContext* asyncContext = asyncCompute.Begin();
+        GlobalSignDistanceFieldPass::BindingData bindingData;
+        GlobalSignDistanceFieldPass::Instance()->Render(renderContext, asyncContext, bindingData);
+        asyncCompute.End();
+    }
+
+    // Build Hi-Z for the occlusion culling in the next frames
+    OcclusionCullingPass::Instance()->Render(renderContext, context);
+
     // Debug drawing
+    if (renderContext.View.Mode == ViewMode::GlobalSDF || renderContext.View.Mode == ViewMode::GlobalSurfaceAtlas)
+        asyncCompute.Join();
     if (renderContext.View.Mode == ViewMode::GlobalSDF)
         GlobalSignDistanceFieldPass::Instance()->RenderDebug(renderContext, context, lightBuffer);
     else if (renderContext.View.Mode == ViewMode::GlobalSurfaceAtlas)
@@ -482,6 +593,7 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     // Render lighting
     renderContextBatch.GetMainContext() = renderContext; // Sync render context in batch with the current value
     LightPass::Instance()->RenderLight(renderContextBatch, *lightBuffer);
+    asyncCompute.Join();
     if (EnumHasAnyFlags(renderContext.View.Flags, ViewFlags::GI))
     {
         switch (renderContext.List->Settings.GlobalIllumination.Mode)
@@ -498,7 +610,6 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         RENDER_TARGET_POOL_SET_NAME(tempBuffer, "TempBuffer");
         EyeAdaptationPass::Instance()->Render(renderContext, lightBuffer);
         PostProcessingPass::Instance()->Render(renderContext, lightBuffer, tempBuffer, colorGradingLUT);
-        RenderTargetPool::Release(colorGradingLUT);
         RenderTargetPool::Release(lightBuffer);
         context->ResetRenderTarget();
         context->SetRenderTarget(task->GetOutputView());
@@ -539,7 +650,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         VolumetricFogPass::Instance()->Render(renderContext);
 
         PROFILE_GPU_CPU("Fog");
+        context->SetShadingRateImage(VariableRateShadingPass::Instance()->GetShadingRateImage(renderContext));
         renderContext.List->Fog->DrawFog(context, renderContext, *lightBuffer);
+        context->SetShadingRateImage(nullptr);
         context->ResetSR();
     }
 
@@ -558,6 +671,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     context->FlushState();
     RenderTargetPool::Release(lightBuffer);
 
+    // Generate the shading rate image for the next frame from the scene color and motion vectors
+    VariableRateShadingPass::Instance()->Generate(renderContext, context, frameBuffer);
+
     // Check if skip post-processing
     if (renderContext.View.Mode == ViewMode::NoPostFx || renderContext.View.Mode == ViewMode::Wireframe)
     {
@@ -574,8 +690,8 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     renderContext.List->RunMaterialPostFxPass(context, renderContext, MaterialPostFxLocation::BeforePostProcessingPass, frameBuffer, tempBuffer);
     renderContext.List->RunCustomPostFxPass(context, renderContext, PostProcessEffectLocation::BeforePostProcessingPass, frameBuffer, tempBuffer);
 
-    // Temporal Anti-Aliasing (goes before post processing)
-    if (aaMode == AntialiasingMode::TemporalAntialiasing)
+    // Temporal Anti-Aliasing (goes before post processing, skipped if temporal upscaling does it)
+    if (aaMode == AntialiasingMode::TemporalAntialiasing && !setup.UseTemporalUpscaling)
     {
         TAA::Instance()->Render(renderContext, frameBuffer, tempBuffer->View());
         Swap(frameBuffer, tempBuffer);
@@ -594,6 +710,8 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         context->ResetSR();
         if (renderContext.List->HasAnyPostFx(renderContext, PostProcessEffectLocation::CustomUpscale))
             renderContext.List->RunCustomPostFxPass(context, renderContext, PostProcessEffectLocation::CustomUpscale, frameBuffer, tempBuffer);
+        else if (setup.UseTemporalUpscaling)
+            TAA::Instance()->Upscale(renderContext, frameBuffer, tempBuffer);
         else
             MultiScaler::Instance()->Upscale(context, outputViewport, frameBuffer, tempBuffer->View());
         if (tempBuffer->Width() == tempDesc.Width)
@@ -614,7 +732,6 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     // Post processing
     EyeAdaptationPass::Instance()->Render(renderContext, frameBuffer);
     PostProcessingPass::Instance()->Render(renderContext, frameBuffer, tempBuffer, colorGradingLUT);
-    RenderTargetPool::Release(colorGradingLUT);
     Swap(frameBuffer, tempBuffer);
 
     // Cleanup
@@ -79,6 +79,14 @@ class FLAXENGINE_API RendererPassBase : public Object
         return !checkIfSkipPass();
     }
 
+    /// <summary>
+    /// Determines whether the pass can be rendered with the async compute context (see GPUDevice::GetAsyncComputeContext). Such pass records only the compute work (dispatches, UAV clears, buffer updates and copies) on the given context.
+    /// </summary>
+    virtual bool CanUseAsyncCompute() const
+    {
+        return false;
+    }
+
 protected:
 
     bool checkIfSkipPass()
@@ -3,12 +3,20 @@
 #include "ShadowsPass.h"
 #include "GBufferPass.h"
 #include "VolumetricFogPass.h"
+#include "OcclusionCullingPass.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Level/Scene/SceneRendering.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Lightmaps.h"
 #endif
@@ -17,6 +25,24 @@
 #define SpotLight_NearPlane 10.0f
 #define PointLight_NearPlane 10.0f
 
+// The maximum amount of the cached static shadow maps per view
+#define SHADOWS_CACHE_MAX_LIGHTS 32
+// The amount of frames after which the unused cached static shadow maps get released
+#define SHADOWS_CACHE_RELEASE_FRAMES 60
+
+#define SHADOWS_CACHE_ACTOR_IS_STATIC(actor) EnumHasAnyFlags(actor->GetStaticFlags(), StaticFlags::Transform)
+
+// The size of the virtual shadow map page (in texels)
+#define VIRTUAL_SHADOW_MAP_PAGE_SIZE 128
+// The amount of pages per side of the virtual shadow map cascade (must match the HLSL)
+#define VIRTUAL_SHADOW_MAP_PAGES 64
+// The maximum amount of pages rendered in a single frame (each page is drawn as a separate render view)
+#define VIRTUAL_SHADOW_MAP_MAX_PAGE_UPDATES 32
+// The maximum width of the Hi-Z used to find the visible pages (in texels)
+#define VIRTUAL_SHADOW_MAP_MARKING_SIZE 128
+// The margin around the visible points used when marking visible pages (in pages)
+#define VIRTUAL_SHADOW_MAP_MARKING_MARGIN 0.25f
+
 PACK_STRUCT(struct Data{
     GBufferData GBuffer;
     LightData Light;
@@ -28,6 +54,244 @@ PACK_STRUCT(struct Data{
     float ContactShadowsLength;
     });
 
+class ShadowsCacheCustomBuffer : public RenderBuffers::CustomBuffer, public ISceneRenderingListener
+{
+public:
+    struct LightCache
+    {
+        GPUTexture* ShadowMap = nullptr;
+        BoundingSphere Bounds;
+        Matrix ViewProjection;
+        uint64 LastFrameUsed = 0;
+        bool Dirty = true;
+    };
+
+    Dictionary<Guid, LightCache> Lights;
+
+    ~ShadowsCacheCustomBuffer()
+    {
+        for (auto& e : Lights)
+            SAFE_DELETE_GPU_RESOURCE(e.Value.ShadowMap);
+    }
+
+    void ReleaseUnused()
+    {
+        for (auto it = Lights.Begin(); it.IsNotEnd(); ++it)
+        {
+            if (it->Value.LastFrameUsed + SHADOWS_CACHE_RELEASE_FRAMES < Engine::FrameCount)
+            {
+                SAFE_DELETE_GPU_RESOURCE(it->Value.ShadowMap);
+                Lights.Remove(it);
+            }
+        }
+    }
+
+    FORCE_INLINE void OnSceneRenderingDirty(const BoundingSphere& objectBounds)
+    {
+        for (auto& e : Lights)
+        {
+            if (e.Value.Bounds.Intersects(objectBounds))
+                e.Value.Dirty = true;
+        }
+    }
+
+    // [ISceneRenderingListener]
+    void OnSceneRenderingAddActor(Actor* a) override
+    {
+        if (SHADOWS_CACHE_ACTOR_IS_STATIC(a))
+            OnSceneRenderingDirty(a->GetSphere());
+    }
+
+    void OnSceneRenderingUpdateActor(Actor* a, const BoundingSphere& prevBounds) override
+    {
+        if (SHADOWS_CACHE_ACTOR_IS_STATIC(a))
+        {
+            OnSceneRenderingDirty(prevBounds);
+            OnSceneRenderingDirty(a->GetSphere());
+        }
+    }
+
+    void OnSceneRenderingRemoveActor(Actor* a) override
+    {
+        if (SHADOWS_CACHE_ACTOR_IS_STATIC(a))
+            OnSceneRenderingDirty(a->GetSphere());
+    }
+
+    void OnSceneRenderingClear(SceneRendering* scene) override
+    {
+        for (auto& e : Lights)
+            e.Value.Dirty = true;
+    }
+};
+
+class VirtualShadowMapCustomBuffer : public RenderBuffers::CustomBuffer, public ISceneRenderingListener
+{
+public:
+    struct Page
+    {
+        int32 Slice;
+        int32 Cascade;
+        int32 X, Y;
+        uint64 LastFrameUsed;
+        bool Dirty;
+    };
+
+    struct Cascade
+    {
+        // The cascade placement (cached pages are valid only for the same placement).
+        Float3 Direction = Float3::Zero;
+        float Radius = 0.0f;
+        int32 DepthSnap = 0;
+        Vector3 Origin = Vector3::Zero;
+
+        // The cascade projection for the current frame (pages grid is snapped to the light-space world grid).
+        Float3 Side;
+        Float3 Up;
+        float PageSize;
+        int32 PageX;
+        int32 PageY;
+        float FarClip;
+        Matrix View;
+        Matrix TextureViewProjection;
+    };
+
+    // The pending page to draw.
+    struct PageUpdate
+    {
+        int32 Cascade;
+        int32 X, Y;
+        int32 Slice;
+    };
+
+    GPUTexture* Pages = nullptr;
+    GPUBuffer* PageTable = nullptr;
+    Array<uint32> PageTableData;
+    Array<byte> VisiblePages;
+    Array<int32> FreeSlices;
+    Array<PageUpdate> PageUpdates;
+    Array<int32> PageUpdatesSlices;
+    Dictionary<uint64, Page> ResidentPages;
+    Cascade Cascades[MAX_CSM_CASCADES];
+
+    ~VirtualShadowMapCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(Pages);
+        SAFE_DELETE_GPU_RESOURCE(PageTable);
+    }
+
+    FORCE_INLINE static uint64 GetPageKey(int32 cascade, int32 x, int32 y)
+    {
+        return ((uint64)cascade << 60) | ((uint64)((uint32)x & 0x3fffffff) << 30) | (uint64)((uint32)y & 0x3fffffff);
+    }
+
+    void Reset()
+    {
+        ResidentPages.Clear();
+        FreeSlices.Clear();
+        for (int32 slice = Pages ? Pages->ArraySize() - 1 : -1; slice >= 0; slice--)
+            FreeSlices.Add(slice);
+        for (auto& cascade : Cascades)
+            cascade.Radius = 0.0f;
+    }
+
+    void Reset(int32 cascade)
+    {
+        for (auto it = ResidentPages.Begin(); it.IsNotEnd(); ++it)
+        {
+            if (it->Value.Cascade == cascade)
+            {
+                FreeSlices.Add(it->Value.Slice);
+                ResidentPages.Remove(it);
+            }
+        }
+    }
+
+    int32 AllocateSlice()
+    {
+        if (FreeSlices.HasItems())
+            return FreeSlices.Pop();
+
+        // Evict the least recently used page (pages used in this frame stay resident)
+        uint64 minFrameUsed = Engine::FrameCount;
+        auto lru = ResidentPages.End();
+        for (auto it = ResidentPages.Begin(); it.IsNotEnd(); ++it)
+        {
+            if (it->Value.LastFrameUsed < minFrameUsed)
+            {
+                minFrameUsed = it->Value.LastFrameUsed;
+                lru = it;
+            }
+        }
+        if (lru.IsEnd())
+            return -1;
+        const int32 slice = lru->Value.Slice;
+        ResidentPages.Remove(lru);
+        return slice;
+    }
+
+    void OnSceneRenderingDirty(const BoundingSphere& objectBounds)
+    {
+        for (int32 cascadeIndex = 0; cascadeIndex < MAX_CSM_CASCADES; cascadeIndex++)
+        {
+            const Cascade& cascade = Cascades[cascadeIndex];
+            if (cascade.Radius <= 0.0f)
+                continue;
+
+            // Find the pages covered by the object in the light space (object casts shadow only within its projected bounds)
+            const Float3 center = objectBounds.Center - cascade.Origin;
+            const float halfPages = VIRTUAL_SHADOW_MAP_PAGES * 0.5f;
+            const float s = Float3::Dot(center, cascade.Side) / cascade.PageSize;
+            const float t = Float3::Dot(center, cascade.Up) / cascade.PageSize;
+            const float r = (float)objectBounds.Radius / cascade.PageSize;
+            const int32 x0 = (int32)Math::Floor(halfPages + s - r), x1 = (int32)Math::Floor(halfPages + s + r);
+            const int32 y0 = (int32)Math::Floor(halfPages - t - r), y1 = (int32)Math::Floor(halfPages - t + r);
+            if ((int64)(x1 - x0 + 1) * (int64)(y1 - y0 + 1) > ResidentPages.Count())
+            {
+                // Large object so check all resident pages
+                for (auto& e : ResidentPages)
+                {
+                    Page& page = e.Value;
+                    if (page.Cascade == cascadeIndex && page.X >= x0 && page.X <= x1 && page.Y >= y0 && page.Y <= y1)
+                        page.Dirty = true;
+                }
+                continue;
+            }
+            for (int32 y = y0; y <= y1; y++)
+            {
+                for (int32 x = x0; x <= x1; x++)
+                {
+                    Page* page = ResidentPages.TryGet(GetPageKey(cascadeIndex, x, y));
+                    if (page)
+                        page->Dirty = true;
+                }
+            }
+        }
+    }
+
+    // [ISceneRenderingListener]
+    void OnSceneRenderingAddActor(Actor* a) override
+    {
+        OnSceneRenderingDirty(a->GetSphere());
+    }
+
+    void OnSceneRenderingUpdateActor(Actor* a, const BoundingSphere& prevBounds) override
+    {
+        OnSceneRenderingDirty(prevBounds);
+        OnSceneRenderingDirty(a->GetSphere());
+    }
+
+    void OnSceneRenderingRemoveActor(Actor* a) override
+    {
+        OnSceneRenderingDirty(a->GetSphere());
+    }
+
+    void OnSceneRenderingClear(SceneRendering* scene) override
+    {
+        for (auto& e : ResidentPages)
+            e.Value.Dirty = true;
+    }
+};
+
 ShadowsPass::ShadowsPass()
     : _shader(nullptr)
     , _shadowMapsSizeCSM(0)
@@ -61,6 +325,7 @@ bool ShadowsPass::Init()
 {
     // Create pipeline states
     _psShadowDir.CreatePipelineStates();
+    _psShadowDirVirtual.CreatePipelineStates();
     _psShadowPoint.CreatePipelineStates();
     _psShadowSpot.CreatePipelineStates();
 
@@ -126,6 +391,12 @@ bool ShadowsPass::setupResources()
         if (_psShadowDir.Create(psDesc, shader, "PS_DirLight"))
             return true;
     }
+    if (!_psShadowDirVirtual.IsValid() && GPUDevice::Instance->GetFeatureLevel() >= FeatureLevel::SM5)
+    {
+        psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        if (_psShadowDirVirtual.Create(psDesc, shader, "PS_DirLightVirtual"))
+            return true;
+    }
     if (!_psShadowSpot.IsValid())
     {
         psDesc = GPUPipelineState::Description::DefaultNoDepth;
@@ -323,13 +594,20 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
     Float3 frustumCorners[8];
     Matrix shadowView, shadowProjection, shadowVP;
 
+    // Use the virtual shadow map if possible (render contexts are created later only for the pages to update)
+    VirtualShadowMapCustomBuffer* virtualShadowMap = csmCount > 0 ? GetVirtualShadowMap(renderContext) : nullptr;
+
     // Init shadow data
     light.ShadowDataIndex = _shadowData.Count();
     auto& shadowData = _shadowData.AddOne();
     shadowData.ContextIndex = renderContextBatch.Contexts.Count();
     shadowData.ContextCount = csmCount;
     shadowData.BlendCSM = blendCSM;
-    renderContextBatch.Contexts.AddDefault(shadowData.ContextCount);
+    shadowData.StaticShadowMap = nullptr;
+    shadowData.RefreshStaticShadowMap = false;
+    shadowData.VirtualShadowMap = virtualShadowMap;
+    if (!virtualShadowMap)
+        renderContextBatch.Contexts.AddDefault(shadowData.ContextCount);
 
     // Create the different view and projection matrices for each split
     float splitMinRatio = 0;
@@ -374,7 +652,32 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
             cascadeMaxBoundLS = Float3(boundingVSRadius);
             cascadeMinBoundLS = -cascadeMaxBoundLS;
 
-            if (stabilization == ViewSnapping)
+            if (virtualShadowMap)
+            {
+                // Snap the target to the virtual shadow map pages (with one page margin on each side) so the cached pages can be reused when view moves, depth range uses a larger snapping step
+                auto& cascade = virtualShadowMap->Cascades[cascadeIndex];
+                const float radius = boundingVSRadius * VIRTUAL_SHADOW_MAP_PAGES / (VIRTUAL_SHADOW_MAP_PAGES - 2);
+                const float pageSize = radius * 2.0f / VIRTUAL_SHADOW_MAP_PAGES;
+                const float depthStep = radius * 0.5f;
+                const int32 depthSnap = (int32)Math::Floor(Float3::Dot(target, lightDirection) / depthStep);
+                if (cascade.Radius != radius || cascade.Direction != lightDirection || cascade.DepthSnap != depthSnap || cascade.Origin != view.Origin)
+                {
+                    virtualShadowMap->Reset(cascadeIndex);
+                    cascade.Radius = radius;
+                    cascade.Direction = lightDirection;
+                    cascade.DepthSnap = depthSnap;
+                    cascade.Origin = view.Origin;
+                }
+                cascade.Side = side;
+                cascade.Up = upDirection;
+                cascade.PageSize = pageSize;
+                cascade.PageX = (int32)Math::Ceil(Float3::Dot(target, side) / pageSize);
+                cascade.PageY = (int32)Math::Ceil(Float3::Dot(target, upDirection) / pageSize);
+                target = side * ((float)cascade.PageX * pageSize) + upDirection * ((float)cascade.PageY * pageSize) + lightDirection * ((float)depthSnap * depthStep);
+                cascadeMaxBoundLS = Float3(radius, radius, radius + depthStep);
+                cascadeMinBoundLS = -cascadeMaxBoundLS;
+            }
+            else if (stabilization == ViewSnapping)
             {
                 // Snap the target to the texel units (reference: ShaderX7 - Practical Cascaded Shadows Maps)
                 float shadowMapHalfSize = shadowMapsSizeCSM * 0.5f;
@@ -426,6 +729,14 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
             Matrix m;
             Matrix::Multiply(shadowVP, T, m);
             Matrix::Transpose(m, shadowData.Constants.ShadowVP[cascadeIndex]);
+            if (virtualShadowMap)
+            {
+                auto& cascade = virtualShadowMap->Cascades[cascadeIndex];
+                cascade.FarClip = farClip;
+                cascade.View = shadowView;
+                cascade.TextureViewProjection = m;
+                continue;
+            }
         }
 
         // Setup context for cascade
@@ -448,6 +759,293 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
     shadowData.Constants.FadeDistance = Math::Max(light.ShadowsFadeDistance, 0.1f);
     shadowData.Constants.NumCascades = csmCount;
     shadowData.Constants.CascadeSplits = view.Near + Float4(cascadeSplits) * cameraRange;
+    if (virtualShadowMap)
+        SetupVirtualShadowMap(renderContext, renderContextBatch, shadowData, *virtualShadowMap, -lightDirection * shadowsDistance + view.Position);
+}
+
+VirtualShadowMapCustomBuffer* ShadowsPass::GetVirtualShadowMap(RenderContext& renderContext)
+{
+    const OcclusionCullingData* occlusionCulling = renderContext.List->OcclusionCulling;
+    if (!Graphics::EnableVirtualShadowMaps || !_psShadowDirVirtual.IsValid() || !renderContext.Buffers || renderContext.View.IsOfflinePass || !occlusionCulling || occlusionCulling->Mips.IsEmpty())
+        return nullptr;
+    auto& virtualShadowMap = *renderContext.Buffers->GetCustomBuffer<VirtualShadowMapCustomBuffer>(TEXT("VirtualShadowMap"));
+    for (const ShadowData& e : _shadowData)
+    {
+        if (e.VirtualShadowMap == &virtualShadowMap)
+            return nullptr; // Virtual shadow map is used only by a single directional light
+    }
+
+    // Ensure to have the pages pool (each page is a separate texture array slice) and the page table
+    int32 pagesCount;
+    switch (Graphics::ShadowMapsQuality)
+    {
+    case Quality::Ultra:
+        pagesCount = 2048;
+        break;
+    case Quality::High:
+        pagesCount = 1024;
+        break;
+    case Quality::Medium:
+        pagesCount = 512;
+        break;
+    default:
+        pagesCount = 256;
+        break;
+    }
+    pagesCount = Math::Min(pagesCount, GPUDevice::Instance->Limits.MaximumTexture2DArraySize);
+    if (!virtualShadowMap.Pages || virtualShadowMap.Pages->ArraySize() != pagesCount)
+    {
+        if (!virtualShadowMap.Pages)
+            virtualShadowMap.Pages = GPUDevice::Instance->CreateTexture(TEXT("Virtual Shadow Map Pages"));
+        if (virtualShadowMap.Pages->Init(GPUTextureDescription::New2D(VIRTUAL_SHADOW_MAP_PAGE_SIZE, VIRTUAL_SHADOW_MAP_PAGE_SIZE, SHADOW_MAPS_FORMAT, GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil, 1, pagesCount)))
+        {
+            SAFE_DELETE_GPU_RESOURCE(virtualShadowMap.Pages);
+            return nullptr;
+        }
+        virtualShadowMap.Reset();
+    }
+    if (!virtualShadowMap.PageTable)
+    {
+        virtualShadowMap.PageTable = GPUDevice::Instance->CreateBuffer(TEXT("Virtual Shadow Map Page Table"));
+        if (virtualShadowMap.PageTable->Init(GPUBufferDescription::Typed(MAX_CSM_CASCADES * VIRTUAL_SHADOW_MAP_PAGES * VIRTUAL_SHADOW_MAP_PAGES, PixelFormat::R32_UInt)))
+        {
+            SAFE_DELETE_GPU_RESOURCE(virtualShadowMap.PageTable);
+            return nullptr;
+        }
+    }
+
+    // Invalidate the cached pages when scene objects move
+    if (virtualShadowMap.LastFrameUsed != Engine::FrameCount)
+    {
+        virtualShadowMap.LastFrameUsed = Engine::FrameCount;
+        for (SceneRendering* scene : renderContext.List->Scenes)
+            virtualShadowMap.ListenSceneRendering(scene);
+    }
+    return &virtualShadowMap;
+}
+
+void ShadowsPass::SetupVirtualShadowMap(RenderContext& renderContext, RenderContextBatch& renderContextBatch, ShadowData& shadowData, VirtualShadowMapCustomBuffer& virtualShadowMap, const Float3& position)
+{
+    PROFILE_CPU();
+    const RenderView& view = renderContext.View;
+    const OcclusionCullingData& occlusionCulling = *renderContext.List->OcclusionCulling;
+    const int32 cascadesCount = (int32)shadowData.Constants.NumCascades;
+    constexpr int32 pagesPerCascade = VIRTUAL_SHADOW_MAP_PAGES * VIRTUAL_SHADOW_MAP_PAGES;
+    for (int32 cascadeIndex = cascadesCount; cascadeIndex < MAX_CSM_CASCADES; cascadeIndex++)
+    {
+        auto& cascade = virtualShadowMap.Cascades[cascadeIndex];
+        if (cascade.Radius > 0.0f)
+        {
+            virtualShadowMap.Reset(cascadeIndex);
+            cascade.Radius = 0.0f;
+        }
+    }
+
+    // Find the visible pages by projecting the Hi-Z from the previous frames into the cascades
+    virtualShadowMap.VisiblePages.Resize(MAX_CSM_CASCADES * pagesPerCascade);
+    virtualShadowMap.VisiblePages.SetAll(0);
+    {
+        PROFILE_CPU_NAMED("Mark Pages");
+        int32 mipIndex = 0;
+        while (mipIndex + 1 < occlusionCulling.Mips.Count() && occlusionCulling.Mips[mipIndex].Width > VIRTUAL_SHADOW_MAP_MARKING_SIZE)
+            mipIndex++;
+        const auto& mip = occlusionCulling.Mips[mipIndex];
+        const float* depth = occlusionCulling.Depth.Get() + mip.Offset;
+        Matrix invViewProjection;
+        Matrix::Invert(occlusionCulling.ViewProjection, invViewProjection);
+        const Float3 originOffset = occlusionCulling.Origin - view.Origin;
+        const float maxViewDepth = shadowData.Constants.CascadeSplits.Raw[cascadesCount - 1];
+        const float margin = VIRTUAL_SHADOW_MAP_MARKING_MARGIN;
+        byte* visiblePages = virtualShadowMap.VisiblePages.Get();
+        for (int32 y = 0; y < mip.Height; y++)
+        {
+            for (int32 x = 0; x < mip.Width; x++)
+            {
+                const float deviceDepth = depth[y * mip.Width + x];
+                if (deviceDepth >= 1.0f)
+                    continue; // Sky
+                const Float3 ndc(((float)x + 0.5f) / (float)mip.Width * 2.0f - 1.0f, 1.0f - ((float)y + 0.5f) / (float)mip.Height * 2.0f, deviceDepth);
+                Float3 worldPosition;
+                Float3::TransformCoordinate(ndc, invViewProjection, worldPosition);
+                worldPosition += originOffset;
+                const float viewDepth = Float3::Dot(worldPosition - view.Position, view.Direction);
+                if (viewDepth >= maxViewDepth)
+                    continue;
+                int32 cascadeIndex = 0;
+                for (int32 i = 0; i < cascadesCount - 1; i++)
+                {
+                    if (viewDepth > shadowData.Constants.CascadeSplits.Raw[i])
+                        cascadeIndex = i + 1;
+                }
+                Float3 uv;
+                Float3::TransformCoordinate(worldPosition, virtualShadowMap.Cascades[cascadeIndex].TextureViewProjection, uv);
+                const int32 x0 = Math::Clamp((int32)Math::Floor(uv.X * VIRTUAL_SHADOW_MAP_PAGES - margin), 0, VIRTUAL_SHADOW_MAP_PAGES - 1);
+                const int32 x1 = Math::Clamp((int32)Math::Floor(uv.X * VIRTUAL_SHADOW_MAP_PAGES + margin), 0, VIRTUAL_SHADOW_MAP_PAGES - 1);
+                const int32 y0 = Math::Clamp((int32)Math::Floor(uv.Y * VIRTUAL_SHADOW_MAP_PAGES - margin), 0, VIRTUAL_SHADOW_MAP_PAGES - 1);
+                const int32 y1 = Math::Clamp((int32)Math::Floor(uv.Y * VIRTUAL_SHADOW_MAP_PAGES + margin), 0, VIRTUAL_SHADOW_MAP_PAGES - 1);
+                byte* cascadePages = visiblePages + cascadeIndex * pagesPerCascade;
+                for (int32 pageY = y0; pageY <= y1; pageY++)
+                {
+                    for (int32 pageX = x0; pageX <= x1; pageX++)
+                        cascadePages[pageY * VIRTUAL_SHADOW_MAP_PAGES + pageX] = 1;
+                }
+            }
+        }
+    }
+
+    // Keep the visible pages resident
+    const uint64 currentFrame = Engine::FrameCount;
+    virtualShadowMap.PageTableData.Resize(MAX_CSM_CASCADES * pagesPerCascade);
+    virtualShadowMap.PageTableData.SetAll(0);
+    virtualShadowMap.PageUpdates.Clear();
+    for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
+    {
+        const auto& cascade = virtualShadowMap.Cascades[cascadeIndex];
+        const byte* cascadePages = virtualShadowMap.VisiblePages.Get() + cascadeIndex * pagesPerCascade;
+        for (int32 i = 0; i < pagesPerCascade; i++)
+        {
+            if (!cascadePages[i])
+                continue;
+            const int32 x = i % VIRTUAL_SHADOW_MAP_PAGES, y = i / VIRTUAL_SHADOW_MAP_PAGES;
+            auto* page = virtualShadowMap.ResidentPages.TryGet(VirtualShadowMapCustomBuffer::GetPageKey(cascadeIndex, x + cascade.PageX, y - cascade.PageY));
+            if (page)
+                page->LastFrameUsed = currentFrame;
+        }
+    }
+
+    // Allocate the missing pages and pick the pages to draw (coarser cascades go first since they cover the larger area)
+    for (int32 cascadeIndex = cascadesCount - 1; cascadeIndex >= 0; cascadeIndex--)
+    {
+        const auto& cascade = virtualShadowMap.Cascades[cascadeIndex];
+        const byte* cascadePages = virtualShadowMap.VisiblePages.Get() + cascadeIndex * pagesPerCascade;
+        uint32* cascadePageTable = virtualShadowMap.PageTableData.Get() + cascadeIndex * pagesPerCascade;
+        for (int32 i = 0; i < pagesPerCascade; i++)
+        {
+            if (!cascadePages[i])
+                continue;
+            const int32 x = i % VIRTUAL_SHADOW_MAP_PAGES, y = i / VIRTUAL_SHADOW_MAP_PAGES;
+            const uint64 key = VirtualShadowMapCustomBuffer::GetPageKey(cascadeIndex, x + cascade.PageX, y - cascade.PageY);
+            auto* page = virtualShadowMap.ResidentPages.TryGet(key);
+            const bool canUpdate = virtualShadowMap.PageUpdates.Count() < VIRTUAL_SHADOW_MAP_MAX_PAGE_UPDATES;
+            if (!page)
+            {
+                const int32 slice = canUpdate ? virtualShadowMap.AllocateSlice() : -1;
+                if (slice == -1)
+                    continue;
+                page = &virtualShadowMap.ResidentPages[key];
+                page->Slice = slice;
+                page->Cascade = cascadeIndex;
+                page->X = x + cascade.PageX;
+                page->Y = y - cascade.PageY;
+                page->LastFrameUsed = currentFrame;
+                page->Dirty = true;
+            }
+            if (page->Dirty && canUpdate)
+            {
+                page->Dirty = false;
+                virtualShadowMap.PageUpdates.Add({ cascadeIndex, x, y, page->Slice });
+            }
+            cascadePageTable[i] = page->Slice + 1;
+        }
+    }
+
+    // Setup contexts for the pages to draw
+    const int32 pageUpdatesCount = virtualShadowMap.PageUpdates.Count();
+    shadowData.ContextIndex = renderContextBatch.Contexts.Count();
+    shadowData.ContextCount = pageUpdatesCount;
+    renderContextBatch.Contexts.AddDefault(pageUpdatesCount);
+    virtualShadowMap.PageUpdatesSlices.Resize(pageUpdatesCount);
+    for (int32 i = 0; i < pageUpdatesCount; i++)
+    {
+        const auto& pageUpdate = virtualShadowMap.PageUpdates[i];
+        const auto& cascade = virtualShadowMap.Cascades[pageUpdate.Cascade];
+        virtualShadowMap.PageUpdatesSlices[i] = pageUpdate.Slice;
+
+        // Create the page projection (sub-rectangle of the cascade projection)
+        const float left = -cascade.Radius + (float)pageUpdate.X * cascade.PageSize;
+        const float top = cascade.Radius - (float)pageUpdate.Y * cascade.PageSize;
+        Matrix shadowProjection, cullingVP;
+        {
+            const float cullRangeExtent = 100000.0f;
+            Matrix::OrthoOffCenter(left, left + cascade.PageSize, top - cascade.PageSize, top, -cullRangeExtent, cascade.FarClip + cullRangeExtent, shadowProjection);
+            Matrix::Multiply(cascade.View, shadowProjection, cullingVP);
+        }
+        Matrix::OrthoOffCenter(left, left + cascade.PageSize, top - cascade.PageSize, top, 0.0f, cascade.FarClip, shadowProjection);
+
+        // Setup context for page
+        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + i];
+        SetupRenderContext(renderContext, shadowContext);
+        shadowContext.List->Clear();
+        shadowContext.View.Position = position;
+        shadowContext.View.Direction = cascade.Direction;
+        shadowContext.View.SetUp(cascade.View, shadowProjection);
+        shadowContext.View.CullingFrustum.SetMatrix(cullingVP);
+        shadowContext.View.PrepareCache(shadowContext, VIRTUAL_SHADOW_MAP_PAGE_SIZE, VIRTUAL_SHADOW_MAP_PAGE_SIZE, Float2::Zero, &view);
+    }
+
+    // Sample shadows from pages
+    shadowData.BlendCSM = false;
+    shadowData.Constants.ShadowMapSize = Float2(VIRTUAL_SHADOW_MAP_PAGE_SIZE);
+    shadowData.Constants.NormalOffsetScale *= (float)_shadowMapsSizeCSM / (VIRTUAL_SHADOW_MAP_PAGE_SIZE * VIRTUAL_SHADOW_MAP_PAGES);
+}
+
+void ShadowsPass::SetupStaticShadowMap(RenderContext& renderContext, RenderContextBatch& renderContextBatch, ShadowData& shadowData, const Guid& lightId, StaticFlags lightStaticFlags, const BoundingSphere& lightBounds)
+{
+    shadowData.StaticShadowMap = nullptr;
+    shadowData.RefreshStaticShadowMap = false;
+    if (!Graphics::CacheStaticShadows || !renderContext.Buffers || renderContext.View.IsOfflinePass || !EnumHasAnyFlags(lightStaticFlags, StaticFlags::Transform))
+        return;
+    auto& cache = *renderContext.Buffers->GetCustomBuffer<ShadowsCacheCustomBuffer>(TEXT("ShadowsCache"));
+    if (cache.LastFrameUsed != Engine::FrameCount)
+    {
+        cache.LastFrameUsed = Engine::FrameCount;
+        cache.ReleaseUnused();
+        for (SceneRendering* scene : renderContext.List->Scenes)
+            cache.ListenSceneRendering(scene);
+    }
+
+    // Get the light cache
+    auto* e = cache.Lights.TryGet(lightId);
+    if (!e)
+    {
+        if (cache.Lights.Count() >= SHADOWS_CACHE_MAX_LIGHTS)
+            return;
+        e = &cache.Lights[lightId];
+    }
+    e->LastFrameUsed = Engine::FrameCount;
+    const bool isCube = shadowData.ContextCount == 6;
+    if (!e->ShadowMap || e->ShadowMap->Width() != _shadowMapsSizeCube || e->ShadowMap->IsCubeMap() != isCube)
+    {
+        if (!e->ShadowMap)
+            e->ShadowMap = GPUDevice::Instance->CreateTexture(TEXT("Static Shadow Map"));
+        const auto desc = isCube
+                              ? GPUTextureDescription::NewCube(_shadowMapsSizeCube, SHADOW_MAPS_FORMAT, GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil)
+                              : GPUTextureDescription::New2D(_shadowMapsSizeCube, _shadowMapsSizeCube, SHADOW_MAPS_FORMAT, GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil);
+        if (e->ShadowMap->Init(desc))
+        {
+            SAFE_DELETE_GPU_RESOURCE(e->ShadowMap);
+            cache.Lights.Remove(lightId);
+            return;
+        }
+        e->Dirty = true;
+    }
+
+    // Refresh the cached shadow map if light has been modified
+    const BoundingSphere bounds(renderContext.View.Origin + lightBounds.Center, lightBounds.Radius);
+    if (e->Bounds != bounds || e->ViewProjection != shadowData.Constants.ShadowVP[0])
+    {
+        e->Bounds = bounds;
+        e->ViewProjection = shadowData.Constants.ShadowVP[0];
+        e->Dirty = true;
+    }
+    shadowData.StaticShadowMap = e->ShadowMap;
+    shadowData.RefreshStaticShadowMap = e->Dirty;
+    e->Dirty = false;
+
+    // Collect the static shadow casters only if need to refresh the cached shadow map
+    const StaticShadowCastersMode mode = shadowData.RefreshStaticShadowMap ? StaticShadowCastersMode::Separate : StaticShadowCastersMode::Skip;
+    for (int32 i = 0; i < shadowData.ContextCount; i++)
+        renderContextBatch.Contexts[shadowData.ContextIndex + i].List->StaticShadowCasters = mode;
 }
 
 void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererPointLightData& light)
@@ -479,6 +1077,11 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
         Matrix::Transpose(shadowContext.View.ViewProjection(), shadowData.Constants.ShadowVP[faceIndex]);
     }
 
+    // Cull the shadow casters once for all faces (see RenderList::CubeFaces)
+    renderContextBatch.Contexts[shadowData.ContextIndex].List->CubeFaces = true;
+
+    SetupStaticShadowMap(renderContext, renderContextBatch, shadowData, light.ID, light.StaticFlags, BoundingSphere(light.Position, light.Radius));
+
     // Setup constant buffer data
     shadowData.Constants.ShadowMapSize = shadowMapsSizeCube;
     shadowData.Constants.Sharpness = light.ShadowsSharpness;
@@ -518,6 +1121,8 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
         Matrix::Transpose(shadowContext.View.ViewProjection(), shadowData.Constants.ShadowVP[faceIndex]);
     }
 
+    SetupStaticShadowMap(renderContext, renderContextBatch, shadowData, light.ID, light.StaticFlags, BoundingSphere(light.Position, light.Radius));
+
     // Setup constant buffer data
     shadowData.Constants.ShadowMapSize = shadowMapsSizeCube;
     shadowData.Constants.Sharpness = light.ShadowsSharpness;
@@ -536,12 +1141,14 @@ void ShadowsPass::Dispose()
 
     // Cleanup
     _psShadowDir.Delete();
+    _psShadowDirVirtual.Delete();
     _psShadowPoint.Delete();
     _psShadowSpot.Delete();
     _shader = nullptr;
     _sphereModel = nullptr;
     SAFE_DELETE_GPU_RESOURCE(_shadowMapCSM);
     SAFE_DELETE_GPU_RESOURCE(_shadowMapCube);
+    _deferredContexts.ClearDelete();
 }
 
 void ShadowsPass::SetupShadows(RenderContext& renderContext, RenderContextBatch& renderContextBatch)
@@ -604,6 +1211,100 @@ bool ShadowsPass::CanRenderShadow(const RenderContext& renderContext, const Rend
     return _supportsShadows;
 }
 
+void ShadowsPass::RenderShadowMaps(RenderContextBatch& renderContextBatch, const ShadowData& shadowData, GPUTexture* shadowMap, int32 count, float size, const int32* slices)
+{
+    GPUContext* context = GPUDevice::Instance->GetMainContext();
+    RenderContext& renderContext = renderContextBatch.GetMainContext();
+    context->SetViewportAndScissors(size, size);
+
+    // Draw the static shadow casters from the cached shadow map
+    if (shadowData.StaticShadowMap)
+    {
+        GPUTexture* staticShadowMap = shadowData.StaticShadowMap;
+        if (shadowData.RefreshStaticShadowMap)
+        {
+            PROFILE_GPU_CPU_NAMED("Static Shadow Map");
+            for (int32 i = 0; i < count; i++)
+            {
+                const auto rt = staticShadowMap->View(i);
+                context->ResetSR();
+                context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+                context->ClearDepth(rt);
+                auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + i];
+                shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->StaticDepthDrawCallsList);
+                shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->StaticShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+            }
+        }
+        context->ResetSR();
+        context->ResetRenderTarget();
+        for (int32 i = 0; i < count; i++)
+            context->CopyTexture(shadowMap, i, 0, 0, 0, staticShadowMap, i);
+
+        // Draw dynamic shadow casters on top
+        for (int32 i = 0; i < count; i++)
+        {
+            const auto rt = shadowMap->View(i);
+            context->ResetSR();
+            context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+            auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + i];
+            shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
+            shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        }
+        return;
+    }
+
+    // Record shadow map faces in parallel on deferred contexts
+    if (count > 1 && Graphics::EnableParallelCommandRecording && GPUDevice::Instance->Limits.HasDeferredContexts)
+    {
+        while (_deferredContexts.Count() < count)
+        {
+            GPUContext* deferredContext = GPUDevice::Instance->CreateDeferredContext();
+            if (!deferredContext)
+                break;
+            _deferredContexts.Add(deferredContext);
+        }
+        if (_deferredContexts.Count() >= count)
+        {
+            PROFILE_CPU_NAMED("Parallel Recording");
+
+            // Clear shadow maps on the main context so recorded faces use them without the resource state transitions
+            context->ResetSR();
+            context->ResetRenderTarget();
+            for (int32 i = 0; i < count; i++)
+                context->ClearDepth(shadowMap->View(slices ? slices[i] : i));
+
+            Function<void(int32)> job = [&](int32 i)
+            {
+                GPUContext* deferredContext = _deferredContexts.Get()[i];
+                const auto rt = shadowMap->View(slices ? slices[i] : i);
+                deferredContext->SetViewportAndScissors(size, size);
+                deferredContext->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+                auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + i];
+                shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth], shadowContext.List->DrawCalls, nullptr, deferredContext);
+                shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr, deferredContext);
+                deferredContext->ResetSR();
+                deferredContext->ResetRenderTarget();
+            };
+            JobSystem::Execute(job, count, JobPriority::Critical);
+
+            // Submit recorded commands in order
+            GPUDevice::Instance->ExecuteDeferredContexts(ToSpan(_deferredContexts.Get(), count));
+            return;
+        }
+    }
+
+    for (int32 i = 0; i < count; i++)
+    {
+        const auto rt = shadowMap->View(slices ? slices[i] : i);
+        context->ResetSR();
+        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+        context->ClearDepth(rt);
+        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + i];
+        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
+        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+    }
+}
+
 void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererPointLightData& light, GPUTextureView* shadowMask)
 {
     if (light.ShadowDataIndex == -1)
@@ -619,21 +1320,8 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
     // TODO: here we can use lower shadows quality based on light distance to view (LOD switching) and per light setting for max quality
     int32 shadowQuality = maxShadowsQuality;
 
-    // Set up GPU context and render view
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-    context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
-
     // Render depth to all 6 faces of the cube map
-    for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
-    {
-        auto rt = _shadowMapCube->View(faceIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
-    }
+    RenderShadowMaps(renderContextBatch, shadowData, _shadowMapCube, 6, (float)_shadowMapsSizeCube);
 
     // Restore GPU context
     context->ResetSR();
@@ -697,21 +1385,9 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
     // TODO: here we can use lower shadows quality based on light distance to view (LOD switching) and per light setting for max quality
     int32 shadowQuality = maxShadowsQuality;
 
-    // Set up GPU context and render view
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-    context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
-
     // Render depth to all 1 face of the cube map
     constexpr int32 faceIndex = 0;
-    {
-        auto rt = _shadowMapCube->View(faceIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
-    }
+    RenderShadowMaps(renderContextBatch, shadowData, _shadowMapCube, 1, (float)_shadowMapsSizeCube);
 
     // Restore GPU context
     context->ResetSR();
@@ -768,19 +1444,20 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererD
     GPUContext* context = GPUDevice::Instance->GetMainContext();
     RenderContext& renderContext = renderContextBatch.GetMainContext();
     ShadowData& shadowData = _shadowData[light.ShadowDataIndex];
-    const float shadowMapsSizeCSM = (float)_shadowMapsSizeCSM;
-    context->SetViewportAndScissors(shadowMapsSizeCSM, shadowMapsSizeCSM);
 
     // Render shadow map for each projection
-    for (int32 cascadeIndex = 0; cascadeIndex < shadowData.ContextCount; cascadeIndex++)
+    VirtualShadowMapCustomBuffer* virtualShadowMap = shadowData.VirtualShadowMap;
+    if (virtualShadowMap)
     {
-        const auto rt = _shadowMapCSM->View(cascadeIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + cascadeIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        // Render only the pages to update and upload the page table
+        PROFILE_GPU_CPU_NAMED("Virtual Shadow Map");
+        if (shadowData.ContextCount != 0)
+            RenderShadowMaps(renderContextBatch, shadowData, virtualShadowMap->Pages, shadowData.ContextCount, VIRTUAL_SHADOW_MAP_PAGE_SIZE, virtualShadowMap->PageUpdatesSlices.Get());
+        context->UpdateBuffer(virtualShadowMap->PageTable, virtualShadowMap->PageTableData.Get(), virtualShadowMap->PageTableData.Count() * sizeof(uint32));
+    }
+    else
+    {
+        RenderShadowMaps(renderContextBatch, shadowData, _shadowMapCSM, shadowData.ContextCount, (float)_shadowMapsSizeCSM);
     }
 
     // Restore GPU context
@@ -810,16 +1487,32 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererD
     context->UpdateCB(shader->GetCB(0), &sperLight);
     context->BindCB(0, shader->GetCB(0));
     context->BindCB(1, shader->GetCB(1));
-    context->BindSR(5, _shadowMapCSM->ViewArray());
     context->SetRenderTarget(shadowMask);
-    context->SetState(_psShadowDir.Get(maxShadowsQuality + static_cast<int32>(Quality::MAX) * shadowData.BlendCSM + (sperLight.ContactShadowsLength > ZeroTolerance ? 8 : 0)));
+    if (virtualShadowMap)
+    {
+        context->BindSR(5, virtualShadowMap->Pages->ViewArray());
+        context->BindSR(6, virtualShadowMap->PageTable->View());
+        context->SetState(_psShadowDirVirtual.Get(maxShadowsQuality + (sperLight.ContactShadowsLength > ZeroTolerance ? 4 : 0)));
+    }
+    else
+    {
+        context->BindSR(5, _shadowMapCSM->ViewArray());
+        context->SetState(_psShadowDir.Get(maxShadowsQuality + static_cast<int32>(Quality::MAX) * shadowData.BlendCSM + (sperLight.ContactShadowsLength > ZeroTolerance ? 8 : 0)));
+    }
     context->DrawFullscreenTriangle();
 
     // Cleanup
     context->ResetRenderTarget();
     context->UnBindSR(5);
+    context->UnBindSR(6);
 
-    // Cache params for the volumetric fog or other effects that use dir light shadow sampling
+    // Cache params for the volumetric fog or other effects that use dir light shadow sampling (virtual shadow map is not supported there)
+    if (virtualShadowMap)
+    {
+        LastDirLightIndex = -1;
+        LastDirLightShadowMap = nullptr;
+        return;
+    }
     LastDirLightIndex = index;
     LastDirLightShadowMap = _shadowMapCSM->ViewArray();
     LastDirLight = sperLight.LightShadow;
@@ -48,11 +48,19 @@ class ShadowsPass : public RendererPass<ShadowsPass>
         int32 ContextCount;
         bool BlendCSM;
         LightShadowData Constants;
+
+        // The cached shadow map with static shadow casters (null if not used).
+        GPUTexture* StaticShadowMap;
+        bool RefreshStaticShadowMap;
+
+        // The virtual shadow map used by the directional light (null if not used). Render contexts are used for the pages to update.
+        class VirtualShadowMapCustomBuffer* VirtualShadowMap;
     };
 
     // Shader stuff
     AssetReference<Shader> _shader;
     GPUPipelineStatePermutationsPs<static_cast<int32>(Quality::MAX) * 2 * 2> _psShadowDir;
+    GPUPipelineStatePermutationsPs<static_cast<int32>(Quality::MAX) * 2> _psShadowDirVirtual;
     GPUPipelineStatePermutationsPs<static_cast<int32>(Quality::MAX) * 2> _psShadowPoint;
     GPUPipelineStatePermutationsPs<static_cast<int32>(Quality::MAX) * 2> _psShadowSpot;
     bool _supportsShadows;
@@ -71,6 +79,9 @@ class ShadowsPass : public RendererPass<ShadowsPass>
     // Cached state for the current frame rendering (setup via Prepare)
     int32 maxShadowsQuality;
 
+    // Deferred GPU contexts used to record shadow maps rendering in parallel
+    Array<GPUContext*> _deferredContexts;
+
 public:
 
     /// <summary>
@@ -155,11 +166,16 @@ class ShadowsPass : public RendererPass<ShadowsPass>
     void SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererDirectionalLightData& light);
     void SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererPointLightData& light);
     void SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererSpotLightData& light);
+    void SetupStaticShadowMap(RenderContext& renderContext, RenderContextBatch& renderContextBatch, ShadowData& shadowData, const Guid& lightId, StaticFlags lightStaticFlags, const BoundingSphere& lightBounds);
+    VirtualShadowMapCustomBuffer* GetVirtualShadowMap(RenderContext& renderContext);
+    void SetupVirtualShadowMap(RenderContext& renderContext, RenderContextBatch& renderContextBatch, ShadowData& shadowData, VirtualShadowMapCustomBuffer& virtualShadowMap, const Float3& position);
+    void RenderShadowMaps(RenderContextBatch& renderContextBatch, const ShadowData& shadowData, GPUTexture* shadowMap, int32 count, float size, const int32* slices = nullptr);
 
 #if COMPILE_WITH_DEV_ENV
     void OnShaderReloading(Asset* obj)
     {
         _psShadowDir.Release();
+        _psShadowDirVirtual.Release();
         _psShadowPoint.Release();
         _psShadowSpot.Release();
         invalidateResources();
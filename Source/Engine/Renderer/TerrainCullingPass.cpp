@@ -0,0 +1,248 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "TerrainCullingPass.h"
+#include "RenderList.h"
+#include "OcclusionCullingPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// Those defines must match the HLSL
+#define TERRAIN_CULLING_GROUP_SIZE 64
+
+PACK_STRUCT(struct Data {
+    Float4 FrustumPlanes[6];
+    Matrix HiZViewProjection;
+    Float2 HiZSize;
+    float BoundsInflate;
+    uint32 HasHiZ;
+    Float3 LODViewPosition;
+    float InvChunkEdgeSize;
+    float LODDistribution;
+    int32 LODBias;
+    uint32 ChunksOffset;
+    uint32 ChunksCount;
+    });
+
+// Culled terrain chunk instance. Matches the shader type (in TerrainCulling shader and the terrain material template).
+PACK_STRUCT(struct TerrainChunkInstance {
+    Float4 NeighborLOD;
+    Float4 LightmapArea;
+    Float2 ChunkCoord;
+    Float2 Padding;
+    });
+
+static_assert(sizeof(TerrainChunksDraw::Chunk) == 80, "Invalid terrain chunk data size. Update the terrain culling shader.");
+
+String TerrainCullingPass::ToString() const
+{
+    return TEXT("TerrainCullingPass");
+}
+
+void TerrainCullingPass::Prepare(RenderContextBatch& renderContextBatch)
+{
+    for (const RenderContext& renderContext : renderContextBatch.Contexts)
+        renderContext.List->TerrainCulling = false;
+    if (!Graphics::EnableGPUDrivenTerrain || !_supported)
+        return;
+#if USE_EDITOR
+    const ViewMode viewMode = renderContextBatch.GetMainContext().View.Mode;
+    if (viewMode == ViewMode::LightmapUVsDensity || viewMode == ViewMode::LODPreview)
+        return; // Those debug views use per-chunk draw calls
+#endif
+
+    // Load shader on the first use
+    if (!_shader)
+    {
+        const auto& limits = GPUDevice::Instance->Limits;
+        _shader = limits.HasCompute && limits.HasDrawIndirect ? Content::LoadAsyncInternal<Shader>(TEXT("Shaders/TerrainCulling")) : nullptr;
+        if (!_shader)
+        {
+            _supported = false;
+            return;
+        }
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<TerrainCullingPass, &TerrainCullingPass::OnShaderReloading>(this);
+#endif
+        invalidateResources();
+    }
+    if (checkIfSkipPass() || !_csCullChunks)
+        return;
+
+    // Draw calls reference the output buffers before they get allocated for the culled chunks
+    if (!_outputBuffer)
+        _outputBuffer = GPUDevice::Instance->CreateBuffer(TEXT("TerrainCulling.Output"));
+    if (!_argsBuffer)
+        _argsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("TerrainCulling.Args"));
+    Platform::AtomicStore(&_argsCount, 0);
+    Platform::AtomicStore(&_outputCount, 0);
+    const bool deferredShadows = Graphics::EnableParallelCommandRecording && GPUDevice::Instance->Limits.HasDeferredContexts;
+    for (const RenderContext& renderContext : renderContextBatch.Contexts)
+    {
+        // Shadow maps can be recorded on the deferred contexts that don't run the culling
+        if (renderContext.View.Pass == DrawPass::Depth && deferredShadows)
+            continue;
+        renderContext.List->TerrainCulling = true;
+    }
+}
+
+void TerrainCullingPass::Reserve(int32 lodsCount, uint32& argsOffset, uint32& outputOffset)
+{
+    argsOffset = (uint32)(Platform::InterlockedAdd(&_argsCount, lodsCount));
+    outputOffset = (uint32)(Platform::InterlockedAdd(&_outputCount, lodsCount * ChunksPerLOD));
+}
+
+bool TerrainCullingPass::setupResources()
+{
+    if (!_shader)
+        return false; // Shader is loaded on the first use so don't block the renderer readiness
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+    _cb0 = shader->GetCB(0);
+    if (!_cb0 || _cb0->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+    _csCullChunks = shader->GetCS("CS_CullChunks");
+    if (!_chunksBuffer)
+        _chunksBuffer = New<DynamicStructuredBuffer>(256 * sizeof(TerrainChunksDraw::Chunk), sizeof(TerrainChunksDraw::Chunk), false, TEXT("TerrainCulling.Chunks"));
+    return false;
+}
+
+void TerrainCullingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE(_chunksBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_outputBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_argsBuffer);
+    _argsData.Resize(0);
+    _csCullChunks = nullptr;
+    _cb0 = nullptr;
+    _shader = nullptr;
+}
+
+void TerrainCullingPass::Render(RenderContextBatch& renderContextBatch, GPUContext* context)
+{
+    const int32 argsCount = (int32)Platform::AtomicRead(&_argsCount);
+    const int32 outputCount = (int32)Platform::AtomicRead(&_outputCount);
+    if (argsCount == 0 || outputCount == 0 || checkIfSkipPass() || !_csCullChunks)
+        return;
+    PROFILE_GPU_CPU("Terrain Culling");
+
+    // Prepare the chunks and the initial indirect draw arguments (with zero instances, each patch LOD has a separate range of the output instances)
+    _chunksBuffer->Clear();
+    _argsData.Resize(argsCount * sizeof(GPUDrawIndexedIndirectArgs));
+    auto args = (GPUDrawIndexedIndirectArgs*)_argsData.Get();
+    Platform::MemoryClear(args, _argsData.Count());
+    for (const RenderContext& renderContext : renderContextBatch.Contexts)
+    {
+        const RenderList* list = renderContext.List;
+        if (!list->TerrainCulling)
+            continue;
+        for (int32 drawIndex = 0; drawIndex < list->TerrainChunksDraws.Count(); drawIndex++)
+        {
+            const TerrainChunksDraw& draw = list->TerrainChunksDraws.Get()[drawIndex];
+            for (const TerrainChunksDraw::Chunk& chunk : draw.Chunks)
+            {
+                // Chunks of the patch share the arguments so it's fine to write them multiple times
+                for (uint32 lod = chunk.MinLOD; lod <= chunk.MaxLOD; lod++)
+                {
+                    auto& e = args[chunk.ArgsOffset + lod - chunk.MinLOD];
+                    const int32 chunkSize = ((draw.ChunkSize + 1) >> lod) - 1;
+                    e.IndicesCount = chunkSize * chunkSize * 6;
+                    e.InstanceCount = 0;
+                    e.StartIndex = 0;
+                    e.StartVertex = 0;
+                    e.StartInstance = 0;
+                }
+            }
+            _chunksBuffer->Write(draw.Chunks.Get(), draw.Chunks.Count() * sizeof(TerrainChunksDraw::Chunk));
+        }
+    }
+    if (_chunksBuffer->Data.IsEmpty())
+        return;
+    _chunksBuffer->Flush(context);
+    if (_argsBuffer->GetSize() < (uint32)_argsData.Count())
+    {
+        if (_argsBuffer->Init(GPUBufferDescription::Raw(Math::RoundUpToPowerOf2((uint32)_argsData.Count()), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+            return;
+    }
+    context->UpdateBuffer(_argsBuffer, _argsData.Get(), _argsData.Count());
+
+    // Ensure to have enough space for the output (draw calls that fail to be culled are skipped)
+    if (_outputBuffer->GetSize() < outputCount * sizeof(TerrainChunkInstance))
+    {
+        if (_outputBuffer->Init(GPUBufferDescription::Structured((int32)Math::RoundUpToPowerOf2((uint32)outputCount), sizeof(TerrainChunkInstance), true)))
+            return;
+    }
+
+    // Cull chunks of each terrain draw (thread per chunk)
+    context->BindSR(0, _chunksBuffer->GetBuffer()->View());
+    context->BindUA(0, _outputBuffer->View());
+    context->BindUA(1, _argsBuffer->View());
+    uint32 chunksOffset = 0;
+    Data data;
+    for (const RenderContext& renderContext : renderContextBatch.Contexts)
+    {
+        const RenderList* list = renderContext.List;
+        if (!list->TerrainCulling || list->TerrainChunksDraws.Count() == 0)
+            continue;
+
+        // Setup constants shared by all draws of the view
+        const auto& view = renderContext.View;
+        for (int32 i = 0; i < 6; i++)
+        {
+            const Plane plane = view.CullingFrustum.GetPlane(i);
+            data.FrustumPlanes[i] = Float4(Float3(plane.Normal), (float)plane.D);
+        }
+        Matrix hiZViewProjection;
+        float boundsInflate;
+        GPUTexture* hiZ = OcclusionCullingPass::Instance()->GetHiZ(renderContext, hiZViewProjection, boundsInflate);
+        if (hiZ)
+        {
+            Matrix::Transpose(hiZViewProjection, data.HiZViewProjection);
+            data.HiZSize = Float2((float)hiZ->Width(), (float)hiZ->Height());
+            data.BoundsInflate = boundsInflate;
+            data.HasHiZ = 1;
+        }
+        else
+        {
+            data.HiZViewProjection = Matrix::Identity;
+            data.HiZSize = Float2::Zero;
+            data.BoundsInflate = 0.0f;
+            data.HasHiZ = 0;
+        }
+        context->BindSR(1, hiZ);
+
+        for (int32 drawIndex = 0; drawIndex < list->TerrainChunksDraws.Count(); drawIndex++)
+        {
+            const TerrainChunksDraw& draw = list->TerrainChunksDraws.Get()[drawIndex];
+            const uint32 chunksCount = draw.Chunks.Count();
+            if (chunksCount == 0)
+                continue;
+            data.LODViewPosition = draw.LODViewPosition;
+            data.InvChunkEdgeSize = draw.InvChunkEdgeSize;
+            data.LODDistribution = draw.LODDistribution;
+            data.LODBias = draw.LODBias;
+            data.ChunksOffset = chunksOffset;
+            data.ChunksCount = chunksCount;
+            context->UpdateCB(_cb0, &data);
+            context->BindCB(0, _cb0);
+            context->Dispatch(_csCullChunks, Math::DivideAndRoundUp<uint32>(chunksCount, TERRAIN_CULLING_GROUP_SIZE), 1, 1);
+            chunksOffset += chunksCount;
+        }
+    }
+    context->ResetUA();
+    context->ResetSR();
+}
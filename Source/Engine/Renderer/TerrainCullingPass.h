@@ -0,0 +1,86 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+class GPUBuffer;
+struct RenderContextBatch;
+
+/// <summary>
+/// GPU-driven terrain rendering pass. Selects the LOD of the terrain chunks and culls them on a GPU (against view frustum and Hi-Z). The visible chunks of each patch are compacted into the instances drawn with the indirect draw call per each patch LOD. Used by all views in the render batch (main view and shadow projections). Uses compute shaders.
+/// </summary>
+class FLAXENGINE_API TerrainCullingPass : public RendererPass<TerrainCullingPass>
+{
+public:
+    // Size of the chunks instances range per patch LOD (in the output buffer).
+    static constexpr int32 ChunksPerLOD = 16;
+
+private:
+    bool _supported = true;
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csCullChunks = nullptr;
+    GPUConstantBuffer* _cb0 = nullptr;
+    class DynamicStructuredBuffer* _chunksBuffer = nullptr;
+    GPUBuffer* _outputBuffer = nullptr;
+    GPUBuffer* _argsBuffer = nullptr;
+    Array<byte> _argsData;
+    volatile int64 _argsCount = 0;
+    volatile int64 _outputCount = 0;
+
+public:
+    /// <summary>
+    /// Prepares the GPU-driven terrain for the scene rendering (enables it for the render lists of the batch). Called before collecting the draw calls.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    void Prepare(RenderContextBatch& renderContextBatch);
+
+    /// <summary>
+    /// Reserves the ranges of the indirect draw arguments and the output chunks instances for the terrain patch drawing. Can be called only if the render list has TerrainCulling enabled. Thread-safe.
+    /// </summary>
+    /// <param name="lodsCount">The amount of the patch LODs (indirect draw calls) to reserve.</param>
+    /// <param name="argsOffset">The index of the first indirect draw arguments.</param>
+    /// <param name="outputOffset">The index of the first chunk instance in the output buffer.</param>
+    void Reserve(int32 lodsCount, uint32& argsOffset, uint32& outputOffset);
+
+    /// <summary>
+    /// Gets the buffer with the indirect draw arguments (GPUDrawIndexedIndirectArgs for each patch LOD).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetArgsBuffer() const
+    {
+        return _argsBuffer;
+    }
+
+    /// <summary>
+    /// Gets the buffer with the culled chunks instances (structured buffer read by the terrain materials vertex shader).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetOutputBuffer() const
+    {
+        return _outputBuffer;
+    }
+
+    /// <summary>
+    /// Selects the LOD and culls the terrain chunks of all render lists in the batch on a GPU. Called before executing any of the draw calls.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContextBatch& renderContextBatch, GPUContext* context);
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csCullChunks = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,320 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "TerrainVirtualTexturePass.h"
+#include "RenderList.h"
+#include "Engine/Core/Math/Int2.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Terrain/Terrain.h"
+#include "Engine/Terrain/TerrainPatch.h"
+#include "Engine/Threading/Threading.h"
+
+// The resolution of the single tile (in texels)
+#define TILE_RESOLUTION 128
+// The amount of tiles per virtual texture side (must be power of two)
+#define TILES_COUNT 16
+// The size of the virtual texture texel (in world units)
+#define TEXEL_SIZE 10.0f
+// The size of the single tile (in world units)
+#define TILE_SIZE (TILE_RESOLUTION * TEXEL_SIZE)
+// The maximum amount of tiles rendered per frame
+#define TILES_UPDATE_BUDGET 4
+
+bool IsRunningTerrainVirtualTexturePass = false;
+
+namespace
+{
+    FORCE_INLINE Int2 GetTile(Real x, Real z)
+    {
+        return Int2((int32)Math::Floor(x / TILE_SIZE), (int32)Math::Floor(z / TILE_SIZE));
+    }
+
+    FORCE_INLINE int32 GetSlotIndex(const Int2& tile)
+    {
+        // Virtual texture V coordinate goes along the negative Z axis (tiles are rendered with a top-down view that has up set to the forward direction)
+        const int32 x = tile.X & (TILES_COUNT - 1);
+        const int32 y = (-tile.Y - 1) & (TILES_COUNT - 1);
+        return y * TILES_COUNT + x;
+    }
+}
+
+class TerrainVirtualTextureCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    // The virtual texture textures (layout matches the PS_VirtualTexture outputs of the terrain material).
+    GPUTexture* Textures[3] = {};
+
+    // The world-space coordinates of the tiles rendered into the virtual texture slots.
+    Int2 Tiles[TILES_COUNT * TILES_COUNT];
+
+#if USE_EDITOR
+    // The index of the tile to refresh (editor refreshes the cached tiles over time to reflect materials changes).
+    int32 RefreshIndex = 0;
+#endif
+
+    TerrainVirtualTextureCustomBuffer()
+    {
+        Reset();
+        TerrainVirtualTexturePass::Instance()->Register(this);
+    }
+
+    ~TerrainVirtualTextureCustomBuffer()
+    {
+        TerrainVirtualTexturePass::Instance()->Unregister(this);
+        for (auto& texture : Textures)
+            SAFE_DELETE_GPU_RESOURCE(texture);
+    }
+
+    void Reset()
+    {
+        for (auto& tile : Tiles)
+            tile = Int2(MAX_int32);
+    }
+};
+
+String TerrainVirtualTexturePass::ToString() const
+{
+    return TEXT("TerrainVirtualTexturePass");
+}
+
+void TerrainVirtualTexturePass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _locker.Lock();
+    _buffers.Resize(0);
+    _locker.Unlock();
+}
+
+bool TerrainVirtualTexturePass::setupResources()
+{
+    // Tiles are rendered with the terrain materials shaders
+    return false;
+}
+
+void TerrainVirtualTexturePass::Register(TerrainVirtualTextureCustomBuffer* buffer)
+{
+    ScopeLock lock(_locker);
+    _buffers.Add(buffer);
+}
+
+void TerrainVirtualTexturePass::Unregister(TerrainVirtualTextureCustomBuffer* buffer)
+{
+    ScopeLock lock(_locker);
+    _buffers.Remove(buffer);
+}
+
+void TerrainVirtualTexturePass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    const auto& terrains = renderContext.List->Terrains;
+    if (!Graphics::EnableTerrainVirtualTexture || terrains.Count() == 0 || renderContext.View.IsOfflinePass || checkIfSkipPass())
+        return;
+    auto& data = *renderContext.Buffers->GetCustomBuffer<TerrainVirtualTextureCustomBuffer>(TEXT("TerrainVirtualTexture"));
+
+    // Find the missing tiles around the view (nearest first)
+    const Vector3 origin = renderContext.View.Origin;
+    const Vector3 viewPosition = origin + renderContext.View.Position;
+    const Int2 center = GetTile(viewPosition.X, viewPosition.Z);
+    Int2 tiles[TILES_UPDATE_BUDGET];
+    int32 tilesCount = 0;
+    _locker.Lock();
+    for (int32 ring = 0; ring <= TILES_COUNT / 2 && tilesCount < TILES_UPDATE_BUDGET; ring++)
+    {
+        for (int32 y = -ring; y <= ring && tilesCount < TILES_UPDATE_BUDGET; y++)
+        {
+            for (int32 x = -ring; x <= ring && tilesCount < TILES_UPDATE_BUDGET; x++)
+            {
+                if (Math::Max(Math::Abs(x), Math::Abs(y)) != ring || x >= TILES_COUNT / 2 || y >= TILES_COUNT / 2)
+                    continue;
+                const Int2 tile(center.X + x, center.Y + y);
+                if (data.Tiles[GetSlotIndex(tile)] != tile)
+                    tiles[tilesCount++] = tile;
+            }
+        }
+    }
+#if USE_EDITOR
+    if (tilesCount == 0)
+    {
+        // Refresh a single cached tile per frame
+        const int32 index = data.RefreshIndex++ % (TILES_COUNT * TILES_COUNT);
+        tiles[tilesCount++] = Int2(center.X + index % TILES_COUNT - TILES_COUNT / 2, center.Y + index / TILES_COUNT - TILES_COUNT / 2);
+    }
+#endif
+    _locker.Unlock();
+    if (tilesCount == 0)
+        return;
+    PROFILE_GPU_CPU("Terrain Virtual Texture");
+
+    // Allocate the virtual texture
+    auto desc = GPUTextureDescription::New2D(TILE_RESOLUTION * TILES_COUNT, TILE_RESOLUTION * TILES_COUNT, PixelFormat::R8G8B8A8_UNorm);
+    for (GPUTexture*& texture : data.Textures)
+    {
+        if (!texture)
+            texture = GPUDevice::Instance->CreateTexture(TEXT("TerrainVirtualTexture"));
+        if (!texture->IsAllocated() && texture->Init(desc))
+            return;
+    }
+
+    // Get the temporary render targets for a single tile
+    desc = GPUTextureDescription::New2D(TILE_RESOLUTION, TILE_RESOLUTION, GPU_DEPTH_BUFFER_PIXEL_FORMAT, GPUTextureFlags::DepthStencil);
+    GPUTexture* tileDepth = RenderTargetPool::Get(desc);
+    RENDER_TARGET_POOL_SET_NAME(tileDepth, "TerrainVirtualTexture.Depth");
+    desc.Format = PixelFormat::R8G8B8A8_UNorm;
+    desc.Flags = GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget;
+    GPUTexture* tileTextures[3];
+    GPUTextureView* tileViews[3];
+    for (int32 i = 0; i < 3; i++)
+    {
+        tileTextures[i] = RenderTargetPool::Get(desc);
+        RENDER_TARGET_POOL_SET_NAME(tileTextures[i], "TerrainVirtualTexture.Tile");
+        tileViews[i] = tileTextures[i]->View();
+    }
+
+    // Setup the top-down orthographic view over the terrains heights range
+    BoundingBox bounds = terrains[0]->GetBox();
+    for (int32 i = 1; i < terrains.Count(); i++)
+        BoundingBox::Merge(bounds, terrains[i]->GetBox(), bounds);
+    RenderContext tileContext;
+    tileContext.List = RenderList::GetFromPool();
+    tileContext.LodProxyView = &renderContext.View; // Use the same terrain LODs as the main view
+    RenderView& view = tileContext.View;
+    view.Flags = renderContext.View.Flags;
+    view.Pass = DrawPass::GBuffer;
+    view.IsSingleFrame = true;
+    view.Origin = origin;
+    view.Near = 1.0f;
+    view.Far = (float)(bounds.Maximum.Y - bounds.Minimum.Y) + 2.0f;
+    Matrix projection, viewMatrix;
+    Matrix::Ortho(TILE_SIZE, TILE_SIZE, view.Near, view.Far, projection);
+
+    // Render tiles
+    for (int32 tileIndex = 0; tileIndex < tilesCount; tileIndex++)
+    {
+        const Int2 tile = tiles[tileIndex];
+        const Float3 eye((float)((tile.X + 0.5f) * TILE_SIZE - origin.X), (float)(bounds.Maximum.Y + 1.0f - origin.Y), (float)((tile.Y + 0.5f) * TILE_SIZE - origin.Z));
+        Matrix::LookAt(eye, eye + Float3::Down, Float3::Forward, viewMatrix);
+        view.SetUp(viewMatrix, projection);
+        view.Position = eye;
+        view.Direction = Float3::Down;
+        view.PrepareCache(tileContext, (float)TILE_RESOLUTION, (float)TILE_RESOLUTION, Float2::Zero);
+
+        // Collect the terrain chunks within the tile
+        tileContext.List->Clear();
+        for (Terrain* terrain : terrains)
+            terrain->Draw(tileContext);
+        tileContext.List->SortDrawCalls(tileContext, false, DrawCallsListType::GBuffer);
+        tileContext.List->SortDrawCalls(tileContext, false, DrawCallsListType::GBufferNoDecals);
+
+        // Draw terrain materials properties into the tile
+        context->ClearDepth(tileDepth->View());
+        for (GPUTextureView* tileView : tileViews)
+            context->Clear(tileView, Color::Transparent);
+        context->SetViewportAndScissors((float)TILE_RESOLUTION, (float)TILE_RESOLUTION);
+        context->SetRenderTarget(tileDepth->View(), ToSpan(tileViews, ARRAY_COUNT(tileViews)));
+        IsRunningTerrainVirtualTexturePass = true;
+        tileContext.List->ExecuteDrawCalls(tileContext, DrawCallsListType::GBuffer);
+        tileContext.List->ExecuteDrawCalls(tileContext, DrawCallsListType::GBufferNoDecals);
+        IsRunningTerrainVirtualTexturePass = false;
+        context->ResetRenderTarget();
+
+        // Copy tile into the virtual texture slot
+        const int32 slotIndex = GetSlotIndex(tile);
+        const uint32 slotX = (slotIndex % TILES_COUNT) * TILE_RESOLUTION;
+        const uint32 slotY = (slotIndex / TILES_COUNT) * TILE_RESOLUTION;
+        for (int32 i = 0; i < 3; i++)
+            context->CopyTexture(data.Textures[i], 0, slotX, slotY, 0, tileTextures[i], 0);
+        _locker.Lock();
+        data.Tiles[slotIndex] = tile;
+        _locker.Unlock();
+    }
+
+    // Cleanup
+    RenderList::ReturnToPool(tileContext.List);
+    RenderTargetPool::Release(tileDepth);
+    for (GPUTexture* tileTexture : tileTextures)
+        RenderTargetPool::Release(tileTexture);
+}
+
+bool TerrainVirtualTexturePass::Get(const RenderContext& renderContext, const DrawCall& drawCall, BindingData& result)
+{
+    if (!Graphics::EnableTerrainVirtualTexture || !renderContext.Buffers)
+        return true;
+    const auto data = renderContext.Buffers->FindCustomBuffer<TerrainVirtualTextureCustomBuffer>(TEXT("TerrainVirtualTexture"));
+    if (!data || !data->Textures[0] || !data->Textures[0]->IsAllocated())
+        return true;
+
+    // Get the chunk area (chunk geometry spans over the local XZ plane) extended by a texel for the filtering (chunks culled on a GPU use the whole patch area)
+    const float chunkSize = drawCall.Terrain.TerrainChunkSizeLOD0 * (drawCall.Terrain.GPUChunksOffset >= 0 ? (float)TerrainPatch::CHUNKS_COUNT_EDGE : 1.0f);
+    const Float3 corners[4] =
+    {
+        drawCall.World.GetTranslation(),
+        Float3::Transform(Float3(chunkSize, 0, 0), drawCall.World),
+        Float3::Transform(Float3(0, 0, chunkSize), drawCall.World),
+        Float3::Transform(Float3(chunkSize, 0, chunkSize), drawCall.World),
+    };
+    Float3 min = corners[0], max = corners[0];
+    for (int32 i = 1; i < 4; i++)
+    {
+        min = Float3::Min(min, corners[i]);
+        max = Float3::Max(max, corners[i]);
+    }
+    const Vector3 origin = renderContext.View.Origin;
+    const Int2 minTile = GetTile(origin.X + min.X - TEXEL_SIZE, origin.Z + min.Z - TEXEL_SIZE);
+    const Int2 maxTile = GetTile(origin.X + max.X + TEXEL_SIZE, origin.Z + max.Z + TEXEL_SIZE);
+    if (maxTile.X - minTile.X >= TILES_COUNT || maxTile.Y - minTile.Y >= TILES_COUNT)
+        return true;
+
+    // Check if all tiles are cached
+    {
+        ScopeLock lock(_locker);
+        for (int32 y = minTile.Y; y <= maxTile.Y; y++)
+        {
+            for (int32 x = minTile.X; x <= maxTile.X; x++)
+            {
+                const Int2 tile(x, y);
+                if (data->Tiles[GetSlotIndex(tile)] != tile)
+                    return true;
+            }
+        }
+    }
+
+    // Virtual texture is sampled with wrapping so use the fractional part of the origin to keep the precision
+    const double uvScale = 1.0 / (TILE_SIZE * TILES_COUNT);
+    const double uvOffsetX = origin.X * uvScale;
+    const double uvOffsetY = -origin.Z * uvScale;
+    for (int32 i = 0; i < 3; i++)
+        result.Textures[i] = data->Textures[i];
+    result.UVScaleBias = Float4((float)uvScale, (float)-uvScale, (float)(uvOffsetX - Math::Floor(uvOffsetX)), (float)(uvOffsetY - Math::Floor(uvOffsetY)));
+    return false;
+}
+
+void TerrainVirtualTexturePass::Invalidate(const BoundingBox& bounds)
+{
+    const Int2 minTile = GetTile(bounds.Minimum.X - TEXEL_SIZE, bounds.Minimum.Z - TEXEL_SIZE);
+    const Int2 maxTile = GetTile(bounds.Maximum.X + TEXEL_SIZE, bounds.Maximum.Z + TEXEL_SIZE);
+    ScopeLock lock(_locker);
+    for (TerrainVirtualTextureCustomBuffer* buffer : _buffers)
+    {
+        if (maxTile.X - minTile.X >= TILES_COUNT || maxTile.Y - minTile.Y >= TILES_COUNT)
+        {
+            buffer->Reset();
+            continue;
+        }
+        for (int32 y = minTile.Y; y <= maxTile.Y; y++)
+        {
+            for (int32 x = minTile.X; x <= maxTile.X; x++)
+            {
+                const Int2 tile(x, y);
+                Int2& slot = buffer->Tiles[GetSlotIndex(tile)];
+                if (slot == tile)
+                    slot = Int2(MAX_int32);
+            }
+        }
+    }
+}
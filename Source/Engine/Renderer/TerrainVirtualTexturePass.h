@@ -0,0 +1,68 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+struct DrawCall;
+
+// True if the terrain virtual texture tiles are being rendered (terrain materials output the material properties instead of the GBuffer).
+extern bool IsRunningTerrainVirtualTexturePass;
+
+/// <summary>
+/// Terrain Virtual Texture rendering pass. Caches the terrain materials output (color, AO, normal, roughness, metalness, specular and the mask) into the texture tiles around the view so the terrain chunks drawn within the cached area can sample a single texture instead of evaluating the whole material with the splatmaps layers blending.
+/// </summary>
+class FLAXENGINE_API TerrainVirtualTexturePass : public RendererPass<TerrainVirtualTexturePass>
+{
+public:
+    // Binding data for the terrain materials.
+    struct BindingData
+    {
+        GPUTexture* Textures[3];
+
+        // World-space position (relative to the view origin) XZ to the virtual texture UVs (xy-scale, zw-offset).
+        Float4 UVScaleBias;
+    };
+
+private:
+    CriticalSection _locker;
+    Array<class TerrainVirtualTextureCustomBuffer*> _buffers;
+
+public:
+    /// <summary>
+    /// Updates the virtual texture tiles around the view (renders the missing tiles of the terrains collected in the render list). Called by the renderer before the GBuffer pass.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+    /// <summary>
+    /// Gets the virtual texture binding data for the terrain chunk draw call. Returns true if the chunk area is not fully cached in the virtual texture.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="drawCall">The terrain chunk draw call.</param>
+    /// <param name="result">The result binding data.</param>
+    /// <returns>True if cannot sample the virtual texture for the chunk, otherwise false.</returns>
+    bool Get(const RenderContext& renderContext, const DrawCall& drawCall, BindingData& result);
+
+    /// <summary>
+    /// Invalidates the cached tiles within the world-space bounds (eg. after terrain sculpting or painting).
+    /// </summary>
+    /// <param name="bounds">The world-space bounds.</param>
+    void Invalidate(const BoundingBox& bounds);
+
+private:
+    void Register(TerrainVirtualTextureCustomBuffer* buffer);
+    void Unregister(TerrainVirtualTextureCustomBuffer* buffer);
+
+    friend TerrainVirtualTextureCustomBuffer;
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,182 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "RadixSort.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// Those defines must match the HLSL
+#define RADIX_SORT_GROUP_SIZE 256
+#define RADIX_SORT_BITS 4
+#define RADIX_SORT_BINS 16
+
+// The sorting keys buffer item structure template. Matches the shader type.
+struct Item
+{
+    float Key;
+    uint32 Value;
+};
+
+PACK_STRUCT(struct Data {
+    uint32 CounterOffset;
+    uint32 Shift;
+    uint32 Descending;
+    uint32 Dummy0;
+    });
+
+String RadixSort::ToString() const
+{
+    return TEXT("RadixSort");
+}
+
+bool RadixSort::Init()
+{
+    // Draw indirect and compute shaders support is required for this implementation
+    const auto& limits = GPUDevice::Instance->Limits;
+    if (!limits.HasDrawIndirect || !limits.HasCompute)
+        return false;
+
+    // Create indirect dispatch arguments buffer
+    _dispatchArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("RadixSortDispatchArgs"));
+    if (_dispatchArgsBuffer->Init(GPUBufferDescription::Raw(sizeof(GPUDispatchIndirectArgs), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+        return true;
+    _tempBuffer = GPUDevice::Instance->CreateBuffer(TEXT("RadixSortTemp"));
+    _sumTableBuffer = GPUDevice::Instance->CreateBuffer(TEXT("RadixSortSumTable"));
+
+    // Load asset
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/RadixSort"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<RadixSort, &RadixSort::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool RadixSort::setupResources()
+{
+    // Check if shader has not been loaded
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    _cb = shader->GetCB(0);
+    if (_cb->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _indirectArgsCS = shader->GetCS("CS_IndirectArgs");
+    _countCS = shader->GetCS("CS_Count");
+    _scanCS = shader->GetCS("CS_Scan");
+    _scatterCS = shader->GetCS("CS_Scatter");
+    _copyIndicesCS = shader->GetCS("CS_CopyIndices");
+
+    return false;
+}
+
+void RadixSort::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE_GPU_RESOURCE(_dispatchArgsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_tempBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_sumTableBuffer);
+    _cb = nullptr;
+    _indirectArgsCS = nullptr;
+    _countCS = nullptr;
+    _scanCS = nullptr;
+    _scatterCS = nullptr;
+    _copyIndicesCS = nullptr;
+    _shader = nullptr;
+}
+
+bool RadixSort::Sort(GPUContext* context, GPUBuffer* sortingKeysBuffer, GPUBuffer* countBuffer, uint32 counterOffset, bool sortAscending, GPUBuffer* sortedIndicesBuffer)
+{
+    ASSERT(context && sortingKeysBuffer && countBuffer);
+
+    // Check if has missing resources
+    if (!_dispatchArgsBuffer || checkIfSkipPass())
+        return true;
+
+    PROFILE_GPU_CPU("Radix Sort");
+
+    // Ensure to have enough space for the temporary data (ping-pong items buffer and the per-block digit offsets)
+    const uint32 maxNumElements = sortingKeysBuffer->GetSize() / sizeof(Item);
+    const uint32 maxGroups = Math::DivideAndRoundUp<uint32>(maxNumElements, RADIX_SORT_GROUP_SIZE);
+    if (_tempBuffer->GetSize() < maxNumElements * sizeof(Item))
+    {
+        if (_tempBuffer->Init(GPUBufferDescription::Structured(maxNumElements, sizeof(Item), true)))
+            return true;
+    }
+    if (_sumTableBuffer->GetSize() < maxGroups * RADIX_SORT_BINS * sizeof(uint32))
+    {
+        if (_sumTableBuffer->Init(GPUBufferDescription::Structured(maxGroups * RADIX_SORT_BINS, sizeof(uint32), true)))
+            return true;
+    }
+
+    // Setup constants buffer
+    Data data;
+    data.CounterOffset = counterOffset;
+    data.Shift = 0;
+    data.Descending = sortAscending ? 0 : 1;
+    data.Dummy0 = 0;
+    context->UpdateCB(_cb, &data);
+    context->BindCB(0, _cb);
+
+    // Generate execute indirect arguments
+    context->BindSR(0, countBuffer->View());
+    context->BindUA(0, _dispatchArgsBuffer->View());
+    context->Dispatch(_indirectArgsCS, 1, 1, 1);
+    context->ResetUA();
+
+    // Sort by the 4 bits per pass (even amount of passes so the result ends in the input buffer)
+    GPUBuffer* src = sortingKeysBuffer;
+    GPUBuffer* dst = _tempBuffer;
+    for (uint32 shift = 0; shift < 32; shift += RADIX_SORT_BITS)
+    {
+        data.Shift = shift;
+        context->UpdateCB(_cb, &data);
+        context->BindCB(0, _cb);
+
+        // Count digits per block
+        context->BindSR(1, src->View());
+        context->BindUA(0, _sumTableBuffer->View());
+        context->DispatchIndirect(_countCS, _dispatchArgsBuffer, 0);
+
+        // Prefix sum of the blocks histograms
+        context->Dispatch(_scanCS, 1, 1, 1);
+        context->ResetUA();
+
+        // Scatter items into the sorted locations
+        context->BindSR(2, _sumTableBuffer->View());
+        context->BindUA(0, dst->View());
+        context->DispatchIndirect(_scatterCS, _dispatchArgsBuffer, 0);
+        context->ResetUA();
+        context->UnBindSR(1);
+        context->UnBindSR(2);
+
+        Swap(src, dst);
+    }
+
+    if (sortedIndicesBuffer)
+    {
+        // Copy indices to another buffer
+        context->BindSR(1, sortingKeysBuffer->View());
+        context->BindUA(0, sortedIndicesBuffer->View());
+        context->DispatchIndirect(_copyIndicesCS, _dispatchArgsBuffer, 0);
+    }
+
+    context->ResetUA();
+    context->ResetSR();
+    return false;
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "../RendererPass.h"
+
+/// <summary>
+/// Radix Sort implementation using GPU compute shaders.
+/// Sorts 32-bit float keys in 8 passes of 4 bits (count, scan and stable scatter of the blocks), which gives the linear complexity O(n*k) and scales better than Bitonic Sort for large lists (eg. millions of particles).
+/// </summary>
+class RadixSort : public RendererPass<RadixSort>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUBuffer* _dispatchArgsBuffer = nullptr;
+    GPUBuffer* _tempBuffer = nullptr;
+    GPUBuffer* _sumTableBuffer = nullptr;
+    GPUConstantBuffer* _cb;
+    GPUShaderProgramCS* _indirectArgsCS;
+    GPUShaderProgramCS* _countCS;
+    GPUShaderProgramCS* _scanCS;
+    GPUShaderProgramCS* _scatterCS;
+    GPUShaderProgramCS* _copyIndicesCS;
+
+public:
+    /// <summary>
+    /// The minimum amount of items (buffer capacity) to use the radix sort for. Smaller lists are better handled by the Bitonic Sort which fits into a few dispatches.
+    /// </summary>
+    static constexpr uint32 MinItemsCount = 16384;
+
+    /// <summary>
+    /// Sorts the specified buffer of index-key pairs. Matches the <see cref="BitonicSort"/> interface.
+    /// </summary>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="sortingKeysBuffer">The sorting keys buffer. Used as a structured buffer of type Item (float key and uint value).</param>
+    /// <param name="countBuffer">The buffer that contains a items counter value.</param>
+    /// <param name="counterOffset">The offset into counter buffer to find count for this list. Must be a multiple of 4 bytes.</param>
+    /// <param name="sortAscending">True to sort in ascending order (smallest to largest), otherwise false to sort in descending order.</param>
+    /// <param name="sortedIndicesBuffer">The output buffer for sorted values extracted from the sorted sortingKeysBuffer after algorithm run. Valid for uint value types - used as RWBuffer.</param>
+    /// <returns>True if failed to sort (eg. shader is not loaded yet or GPU doesn't support it), otherwise false.</returns>
+    bool Sort(GPUContext* context, GPUBuffer* sortingKeysBuffer, GPUBuffer* countBuffer, uint32 counterOffset, bool sortAscending, GPUBuffer* sortedIndicesBuffer);
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _countCS = nullptr;
+        _scanCS = nullptr;
+        _scatterCS = nullptr;
+        invalidateResources();
+    }
+#endif
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
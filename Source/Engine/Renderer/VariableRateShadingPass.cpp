@@ -0,0 +1,157 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "VariableRateShadingPass.h"
+#include "RenderList.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// Those defines must match the HLSL
+#define VRS_GROUP_SIZE 8
+
+// The average luminance difference of the neighbour pixels (in perceptual space) below which the shading rate is reduced
+#define VRS_CONTRAST_THRESHOLD 0.02f
+
+// The velocity (in pixels) above which the shading rate is reduced
+#define VRS_VELOCITY_THRESHOLD 8.0f
+
+PACK_STRUCT(struct Data {
+    Float2 ScreenSize;
+    uint32 TileSize;
+    uint32 TileLoopCount;
+    float ContrastThreshold;
+    float VelocityThreshold;
+    Float2 Dummy0;
+    });
+
+class VariableRateShadingCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    GPUTexture* ShadingRateImage = nullptr;
+
+    ~VariableRateShadingCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(ShadingRateImage);
+    }
+};
+
+String VariableRateShadingPass::ToString() const
+{
+    return TEXT("VariableRateShadingPass");
+}
+
+bool VariableRateShadingPass::setupResources()
+{
+    if (!_shader)
+        return false; // Shader is loaded on the first use so don't block the renderer readiness
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+    _cb0 = shader->GetCB(0);
+    if (!_cb0 || _cb0->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+    _csGenerate = shader->GetCS("CS_Generate");
+    return false;
+}
+
+void VariableRateShadingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _csGenerate = nullptr;
+    _cb0 = nullptr;
+    _shader = nullptr;
+}
+
+bool VariableRateShadingPass::IsEnabled(const RenderContext& renderContext) const
+{
+    return Graphics::EnableVariableRateShading && _supported && renderContext.Buffers && renderContext.View.Mode == ViewMode::Default && GPUDevice::Instance->Limits.HasVariableRateShadingImage;
+}
+
+void VariableRateShadingPass::Generate(RenderContext& renderContext, GPUContext* context, GPUTexture* frame)
+{
+    if (!IsEnabled(renderContext))
+        return;
+
+    // Load shader on the first use
+    if (!_shader)
+    {
+        const auto device = GPUDevice::Instance;
+        _shader = device->Limits.HasCompute && device->GetFeatureLevel() >= FeatureLevel::SM5 ? Content::LoadAsyncInternal<Shader>(TEXT("Shaders/VariableRateShading")) : nullptr;
+        if (!_shader)
+        {
+            _supported = false;
+            return;
+        }
+#if COMPILE_WITH_DEV_ENV
+        _shader.Get()->OnReloading.Bind<VariableRateShadingPass, &VariableRateShadingPass::OnShaderReloading>(this);
+#endif
+        invalidateResources();
+    }
+    if (checkIfSkipPass() || !_csGenerate)
+        return;
+    PROFILE_GPU_CPU("Variable Rate Shading");
+    auto& vrs = *renderContext.Buffers->GetCustomBuffer<VariableRateShadingCustomBuffer>(TEXT("VariableRateShading"));
+
+    // Ensure to have the shading rate image with a single texel per screen tile
+    const int32 tileSize = Math::Max(GPUDevice::Instance->Limits.VariableRateShadingTileSize, VRS_GROUP_SIZE);
+    const int32 width = renderContext.Buffers->GetWidth();
+    const int32 height = renderContext.Buffers->GetHeight();
+    const int32 imageWidth = Math::DivideAndRoundUp(width, tileSize);
+    const int32 imageHeight = Math::DivideAndRoundUp(height, tileSize);
+    if (!vrs.ShadingRateImage)
+        vrs.ShadingRateImage = GPUDevice::Instance->CreateTexture(TEXT("VariableRateShading.ShadingRateImage"));
+    if (vrs.ShadingRateImage->Width() != imageWidth || vrs.ShadingRateImage->Height() != imageHeight)
+    {
+        if (vrs.ShadingRateImage->Init(GPUTextureDescription::New2D(imageWidth, imageHeight, PixelFormat::R8_UInt, GPUTextureFlags::ShaderResource | GPUTextureFlags::UnorderedAccess)))
+            return;
+    }
+
+    // Setup constants
+    Data data;
+    data.ScreenSize = Float2((float)width, (float)height);
+    data.TileSize = tileSize;
+    data.TileLoopCount = tileSize / VRS_GROUP_SIZE;
+    data.ContrastThreshold = VRS_CONTRAST_THRESHOLD;
+    data.VelocityThreshold = VRS_VELOCITY_THRESHOLD;
+    data.Dummy0 = Float2::Zero;
+    context->UpdateCB(_cb0, &data);
+    context->BindCB(0, _cb0);
+
+    // Generate shading rate image (single thread group per tile)
+    GPUTexture* motionVectors = renderContext.Buffers->MotionVectors;
+    context->BindSR(0, frame);
+    context->BindSR(1, motionVectors && motionVectors->IsAllocated() && renderContext.List->Setup.UseMotionVectors ? motionVectors->View() : nullptr);
+    context->BindUA(0, vrs.ShadingRateImage->View());
+    context->Dispatch(_csGenerate, imageWidth, imageHeight, 1);
+    context->ResetUA();
+    context->ResetSR();
+
+    vrs.LastFrameUsed = Engine::FrameCount;
+}
+
+GPUTextureView* VariableRateShadingPass::GetShadingRateImage(const RenderContext& renderContext) const
+{
+    if (!IsEnabled(renderContext))
+        return nullptr;
+    auto* vrs = renderContext.Buffers->FindCustomBuffer<VariableRateShadingCustomBuffer>(TEXT("VariableRateShading"));
+    if (vrs && vrs->ShadingRateImage && vrs->ShadingRateImage->IsAllocated() && vrs->LastFrameUsed + 1 >= Engine::FrameCount)
+    {
+        // Image generated for a different resolution doesn't match the screen tiles
+        const int32 tileSize = Math::Max(GPUDevice::Instance->Limits.VariableRateShadingTileSize, VRS_GROUP_SIZE);
+        if (vrs->ShadingRateImage->Width() == Math::DivideAndRoundUp(renderContext.Buffers->GetWidth(), tileSize) && vrs->ShadingRateImage->Height() == Math::DivideAndRoundUp(renderContext.Buffers->GetHeight(), tileSize))
+            return vrs->ShadingRateImage->View();
+    }
+    return nullptr;
+}
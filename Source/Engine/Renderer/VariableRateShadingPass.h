@@ -0,0 +1,52 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+/// <summary>
+/// Variable rate shading pass. Generates the screen-space shading rate image from the scene luminance contrast and motion vectors of the rendered frame (uses compute shader). The image is used in the next frame to reduce the pixel shading rate of the GBuffer, forward and fog passes in the low-detail and fast-moving screen areas.
+/// </summary>
+class FLAXENGINE_API VariableRateShadingPass : public RendererPass<VariableRateShadingPass>
+{
+private:
+    bool _supported = true;
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csGenerate = nullptr;
+    GPUConstantBuffer* _cb0 = nullptr;
+
+public:
+    /// <summary>
+    /// Generates the shading rate image for the next frame.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="frame">The rendered frame (HDR scene color).</param>
+    void Generate(RenderContext& renderContext, GPUContext* context, GPUTexture* frame);
+
+    /// <summary>
+    /// Gets the shading rate image generated for the given rendering buffers (in the previous frame).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>The shading rate image view, or null if variable rate shading is disabled, not supported or there is no image generated.</returns>
+    GPUTextureView* GetShadingRateImage(const RenderContext& renderContext) const;
+
+private:
+    bool IsEnabled(const RenderContext& renderContext) const;
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csGenerate = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
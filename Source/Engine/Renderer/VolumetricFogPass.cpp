@@ -138,6 +138,7 @@ bool VolumetricFogPass::Init(RenderContext& renderContext, GPUContext* context,
 
     // Setup configuration
     _cache.HistoryWeight = 0.9f;
+    _cache.FroxelsUpdateRate = Graphics::VolumetricFogUpdateRate;
     _cache.InverseSquaredLightDistanceBiasScale = 1.0f;
     const auto quality = Graphics::VolumetricFogQuality;
     switch (quality)
@@ -201,6 +202,8 @@ bool VolumetricFogPass::Init(RenderContext& renderContext, GPUContext* context,
     _cache.Data.PhaseG = options.ScatteringDistribution;
     _cache.Data.VolumetricFogMaxDistance = options.Distance;
     _cache.Data.MissedHistorySamplesCount = Math::Clamp(_cache.MissedHistorySamplesCount, 1, (int32)ARRAY_COUNT(_cache.Data.FrameJitterOffsets));
+    _cache.Data.FroxelsUpdateRate = (uint32)Math::Max(_cache.FroxelsUpdateRate, 1);
+    _cache.Data.FroxelsUpdateFrame = (uint32)(renderContext.Task->LastUsedFrame % _cache.Data.FroxelsUpdateRate);
     Matrix::Transpose(view.PrevViewProjection, _cache.Data.PrevWorldToClip);
     _cache.Data.DirectionalLightShadow.NumCascades = 0;
     _cache.Data.SkyLight.VolumetricScatteringIntensity = 0;
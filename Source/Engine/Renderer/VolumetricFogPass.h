@@ -52,7 +52,8 @@ class VolumetricFogPass : public RendererPass<VolumetricFogPass>
         uint32 GridSizeIntZ;
         float PhaseG;
 
-        Float2 Dummy0;
+        uint32 FroxelsUpdateRate;
+        uint32 FroxelsUpdateFrame;
         float VolumetricFogMaxDistance;
         float InverseSquaredLightDistanceBiasScale;
 
@@ -120,6 +121,11 @@ class VolumetricFogPass : public RendererPass<VolumetricFogPass>
         /// </summary>
         int32 MissedHistorySamplesCount;
 
+        /// <summary>
+        /// The amount of frames over which the froxels lighting is updated (in an interleaved pattern). Froxels not updated in the current frame reuse the reprojected lighting history.
+        /// </summary>
+        int32 FroxelsUpdateRate;
+
         /// <summary>
         /// Scales the amount added to the inverse squared falloff denominator. This effectively removes the spike from inverse squared falloff that causes extreme aliasing.
         /// </summary>
@@ -0,0 +1,21 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+using System;
+
+namespace FlaxEngine
+{
+    /// <summary>
+    /// Declares the script update methods (OnUpdate, OnLateUpdate, OnFixedUpdate and OnLateFixedUpdate) as thread-safe so they are executed in parallel with the other scripts marked with this attribute (on the Job System threads).
+    /// </summary>
+    /// <remarks>The parallel scripts should not modify the scene or access the other objects state that is not thread-safe. Changes to the scene (eg. spawning or destroying objects) can be queued with <see cref="Script.InvokeDeferred"/> to be applied on a main thread after the update.</remarks>
+    [AttributeUsage(AttributeTargets.Class)]
+    public sealed class ParallelTickAttribute : Attribute
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="ParallelTickAttribute"/> class.
+        /// </summary>
+        public ParallelTickAttribute()
+        {
+        }
+    }
+}
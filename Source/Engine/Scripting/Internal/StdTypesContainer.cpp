@@ -40,6 +40,8 @@ void StdTypesContainer::Clear()
     Json_SerializeDiff = nullptr;
     Json_Deserialize = nullptr;
 
+    ParallelTickAttribute = nullptr;
+
 #if USE_EDITOR
     ExecuteInEditModeAttribute = nullptr;
 #endif
@@ -88,6 +90,8 @@ bool StdTypesContainer::Gather()
     GET_METHOD(Json_SerializeDiff, JSON, "SerializeDiff", 3);
     GET_METHOD(Json_Deserialize, JSON, "Deserialize", 3);
 
+    GET_CLASS(FlaxEngine, ParallelTickAttribute, "FlaxEngine.ParallelTickAttribute");
+
 #if USE_EDITOR
     GET_CLASS(FlaxEngine, ExecuteInEditModeAttribute, "FlaxEngine.ExecuteInEditModeAttribute");
 #endif
@@ -33,6 +33,9 @@ class FLAXENGINE_API MMethod
 #if !USE_MONO_AOT
     void* _cachedThunk = nullptr;
 #endif
+#if USE_NETCORE
+    void* _cachedFunctionPointer = nullptr;
+#endif
 
     mutable int32 _hasCachedAttributes : 1;
 #if USE_NETCORE
@@ -99,6 +102,17 @@ class FLAXENGINE_API MMethod
     void* GetThunk();
 #endif
 
+#if USE_NETCORE
+    /// <summary>
+    /// Gets the unmanaged function pointer for this method. Method needs to be static and marked with UnmanagedCallersOnly attribute.
+    /// </summary>
+    /// <remarks>
+    /// Calls via the returned pointer go directly to the managed method without any parameters boxing and runtime invoke. Used by the generated bindings code.
+    /// </remarks>
+    /// <returns>The method function pointer.</returns>
+    void* GetFunctionPointer();
+#endif
+
     /// <summary>
     /// Creates a method that is inflated out of generic method.
     /// </summary>
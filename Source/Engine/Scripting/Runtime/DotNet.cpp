@@ -1308,6 +1308,20 @@ void* MMethod::GetThunk()
 
 #endif
 
+void* MMethod::GetFunctionPointer()
+{
+    if (!_cachedFunctionPointer)
+    {
+        static void* GetMethodFunctionPointerPtr = GetStaticMethodPointer(TEXT("GetMethodFunctionPointer"));
+        _cachedFunctionPointer = CallStaticMethod<void*, void*>(GetMethodFunctionPointerPtr, _handle);
+#if !BUILD_RELEASE
+        if (!_cachedFunctionPointer)
+            LOG(Error, "Failed to get C# method function pointer for {0}::{1}", String(_parentClass->GetFullName()), String(_name));
+#endif
+    }
+    return _cachedFunctionPointer;
+}
+
 MMethod* MMethod::InflateGeneric() const
 {
     // This seams to be unused on .NET (Mono required inflating generic class of the script)
@@ -2,15 +2,19 @@
 
 #include "Script.h"
 #include "Engine/Core/Log.h"
-#if USE_EDITOR
+#if USE_CSHARP
 #include "Internal/StdTypesContainer.h"
 #include "ManagedCLR/MClass.h"
+#endif
+#if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
 #include "Scripting.h"
+#include "BinaryModule.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Level/Scene/Scene.h"
+#include "Engine/Engine/Time.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Threading/Threading.h"
 
@@ -29,6 +33,10 @@ Script::Script(const SpawnParams& params)
     , _tickLateFixedUpdate(false)
     , _wasStartCalled(false)
     , _wasEnableCalled(false)
+    , _tickParallel(false)
+    , _tickManaged(false)
+    , _tickAccumulatedTime(0.0f)
+    , _tickDeltaTime(-1.0f)
 {
 #if USE_EDITOR
     _executeInEditor = GetClass()->HasAttribute(StdTypesContainer::Instance()->ExecuteInEditModeAttribute);
@@ -62,6 +70,11 @@ void Script::SetEnabled(bool value)
     }
 }
 
+float Script::GetTickDeltaTime() const
+{
+    return TickInterval > 0.0f || TickRelevanceDistance > 0.0f ? Math::Max(_tickDeltaTime, 0.0f) : Time::GetDeltaTime();
+}
+
 Actor* Script::GetActor() const
 {
     return _parent;
@@ -186,6 +199,18 @@ void Script::SetupType()
         }
         typeHandle = type.GetBaseType();
     }
+
+#if USE_CSHARP
+    // Tick scripts in parallel if declared as thread-safe
+    const MClass* mclass = GetClass();
+    if (mclass && mclass->HasAttribute(StdTypesContainer::Instance()->ParallelTickAttribute))
+        _tickParallel = true;
+#endif
+#if USE_NETCORE
+    // C# scripts can be ticked in batches by a single managed call (Visual Scripts and native scripts use vtable)
+    const ScriptingType& type = GetType();
+    _tickManaged = type.Type == ScriptingTypes::Script && type.Script.Spawn == &ManagedBinaryModule::ManagedObjectSpawn;
+#endif
 }
 
 void Script::Start()
@@ -1,9 +1,19 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
+using System;
+using System.Collections.Generic;
+#if USE_NETCORE
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using FlaxEngine.Interop;
+#endif
+
 namespace FlaxEngine
 {
     partial class Script
     {
+        private static readonly List<Action> DeferredActions = new List<Action>();
+
         /// <summary>
         /// Gets the scene object which contains this script.
         /// </summary>
@@ -36,5 +46,82 @@ public Transform LocalTransform
             get => Actor.LocalTransform;
             set => Actor.LocalTransform = value;
         }
+
+        /// <summary>
+        /// Queues the action to be invoked on a main thread after the scripts ticked in parallel end their update (see <see cref="ParallelTickAttribute"/>). Used by the parallel scripts to modify the scene (eg. spawn, destroy or reparent objects). Thread-safe.
+        /// </summary>
+        /// <param name="action">The action to invoke.</param>
+        public static void InvokeDeferred(Action action)
+        {
+            lock (DeferredActions)
+            {
+                DeferredActions.Add(action);
+            }
+        }
+
+        internal static void Internal_FlushDeferred()
+        {
+            lock (DeferredActions)
+            {
+                for (int i = 0; i < DeferredActions.Count; i++)
+                {
+                    try
+                    {
+                        DeferredActions[i]();
+                    }
+                    catch (Exception ex)
+                    {
+                        Debug.LogException(ex);
+                    }
+                }
+                DeferredActions.Clear();
+            }
+        }
+
+#if USE_NETCORE
+        [UnmanagedCallersOnly]
+        internal static unsafe void Internal_TickScripts(IntPtr* scripts, int count, int tick)
+        {
+            // Ticks the batch of scripts from a single native call (see SceneTicking::BatchManagedScripts), tick values match SceneTicking::ManagedTick
+            ref IntPtr baseCallInstance = ref Internal_OnUpdate_BaseCallInstance;
+            if (tick == 1)
+                baseCallInstance = ref Internal_OnLateUpdate_BaseCallInstance;
+            else if (tick == 2)
+                baseCallInstance = ref Internal_OnFixedUpdate_BaseCallInstance;
+            else if (tick == 3)
+                baseCallInstance = ref Internal_OnLateFixedUpdate_BaseCallInstance;
+            var prevBaseCallInstance = baseCallInstance;
+            for (int i = 0; i < count; i++)
+            {
+                // Native base method call from the script override is redirected to the base implementation instead of the managed method again
+                var handle = scripts[i];
+                var script = Unsafe.As<Script>(ManagedHandle.FromIntPtr(handle).Target);
+                baseCallInstance = handle;
+                try
+                {
+                    switch (tick)
+                    {
+                    case 0:
+                        script.OnUpdate();
+                        break;
+                    case 1:
+                        script.OnLateUpdate();
+                        break;
+                    case 2:
+                        script.OnFixedUpdate();
+                        break;
+                    case 3:
+                        script.OnLateFixedUpdate();
+                        break;
+                    }
+                }
+                catch (Exception ex)
+                {
+                    Debug.LogException(ex, script);
+                }
+            }
+            baseCallInstance = prevBaseCallInstance;
+        }
+#endif
     }
 }
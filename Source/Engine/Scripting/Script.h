@@ -22,9 +22,29 @@ API_CLASS(Abstract) class FLAXENGINE_API Script : public SceneObject
     int32 _tickLateFixedUpdate : 1;
     int32 _wasStartCalled : 1;
     int32 _wasEnableCalled : 1;
+    int32 _tickParallel : 1;
+    int32 _tickManaged : 1;
 #if USE_EDITOR
     int32 _executeInEditor : 1;
 #endif
+    float _tickAccumulatedTime;
+    float _tickDeltaTime;
+
+public:
+    /// <summary>
+    /// The minimum time (in seconds) between the script updates (OnUpdate). Use 0 to update every frame. Time elapsed between the updates is accumulated (see TickDeltaTime). Can be used to reduce the cost of the scripts that don't need to update every frame (eg. ambient AI).
+    /// </summary>
+    API_FIELD(Attributes="HideInEditor, NoSerialize, NoAnimate") float TickInterval = 0.0f;
+
+    /// <summary>
+    /// The distance from the nearest viewer (active camera or network client location, see SceneTicking::ViewerLocations) above which the script update rate gets reduced (see SceneTicking::RelevanceTickInterval). Use 0 to disable the distance-based update throttling.
+    /// </summary>
+    API_FIELD(Attributes="HideInEditor, NoSerialize, NoAnimate") float TickRelevanceDistance = 0.0f;
+
+    /// <summary>
+    /// Gets the time (in seconds) elapsed since the previous script update (OnUpdate). Equal to Time::GetDeltaTime for the scripts updated every frame (see TickInterval and TickRelevanceDistance).
+    /// </summary>
+    API_PROPERTY() float GetTickDeltaTime() const;
 
 public:
     /// <summary>
@@ -4,6 +4,7 @@
 #include "Scripting.h"
 #include "ScriptingType.h"
 #include "FlaxEngine.Gen.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/ThreadLocal.h"
 #include "Engine/Threading/IRunnable.h"
@@ -24,6 +25,7 @@
 #include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
@@ -56,7 +58,6 @@ namespace
 {
     MDomain* _rootDomain = nullptr;
     MDomain* _scriptsDomain = nullptr;
-    CriticalSection _objectsLocker;
 #define USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING 0
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     struct ScriptingObjectData
@@ -92,10 +93,124 @@ namespace
         }
     };
 
-    Dictionary<Guid, ScriptingObjectData> _objectsDictionary(1024 * 16);
+    typedef ScriptingObjectData ObjectsRegistryValue;
 #else
-    Dictionary<Guid, ScriptingObject*> _objectsDictionary(1024 * 16);
+    typedef ScriptingObject* ObjectsRegistryValue;
 #endif
+
+    // Objects registry is split into shards (by the object ID) to reduce the lock contention when multiple threads create, destroy or lookup objects
+#define OBJECTS_REGISTRY_SHARDS_BITS 5
+#define OBJECTS_REGISTRY_SHARDS (1 << OBJECTS_REGISTRY_SHARDS_BITS)
+    struct alignas(PLATFORM_CACHE_LINE_SIZE) ObjectsRegistryShard
+    {
+        CriticalSection Locker;
+        FlatDictionary<Guid, ObjectsRegistryValue> Objects;
+
+        ObjectsRegistryShard()
+            : Objects(1024 * 16 / OBJECTS_REGISTRY_SHARDS)
+        {
+        }
+    };
+
+    ObjectsRegistryShard _objectsShards[OBJECTS_REGISTRY_SHARDS];
+
+    FORCE_INLINE uint32 GetObjectsShardIndex(const Guid& id)
+    {
+        // Use the high bits of the hash (low bits are used for buckets selection within the shard dictionary)
+        return GetHash(id) >> (32 - OBJECTS_REGISTRY_SHARDS_BITS);
+    }
+
+    FORCE_INLINE ObjectsRegistryShard& GetObjectsShard(const Guid& id)
+    {
+        return _objectsShards[GetObjectsShardIndex(id)];
+    }
+
+    void LockObjectsShards()
+    {
+        for (auto& shard : _objectsShards)
+            shard.Locker.Lock();
+    }
+
+    void UnlockObjectsShards()
+    {
+        for (int32 i = OBJECTS_REGISTRY_SHARDS - 1; i >= 0; i--)
+            _objectsShards[i].Locker.Unlock();
+    }
+
+    struct ObjectsShardsScopeLock
+    {
+        ObjectsShardsScopeLock()
+        {
+            LockObjectsShards();
+        }
+
+        ~ObjectsShardsScopeLock()
+        {
+            UnlockObjectsShards();
+        }
+    };
+
+    // Stable object slots (pages are never freed or moved) with generational handles for a lock-free objects lookup.
+    // Handle layout: low 32 bits is slot index + 1 (0 is invalid handle), high 32 bits is slot generation (incremented on each object unregister).
+#define OBJECTS_SLOTS_PAGE_SIZE 4096
+#define OBJECTS_SLOTS_PAGES_MAX 4096
+    struct ObjectSlot
+    {
+        int64 volatile Object;
+        int64 volatile Generation;
+    };
+
+    CriticalSection _objectsSlotsLocker;
+    ObjectSlot* _objectsSlotsPages[OBJECTS_SLOTS_PAGES_MAX] = {};
+    uint32 _objectsSlotsCount = 0;
+    Array<uint32> _objectsSlotsFree;
+
+    FORCE_INLINE ObjectSlot& GetObjectSlot(uint32 index)
+    {
+        return _objectsSlotsPages[index / OBJECTS_SLOTS_PAGE_SIZE][index % OBJECTS_SLOTS_PAGE_SIZE];
+    }
+
+    uint64 AllocObjectSlot(ScriptingObject* obj)
+    {
+        ScopeLock lock(_objectsSlotsLocker);
+        uint32 index;
+        if (_objectsSlotsFree.HasItems())
+        {
+            index = _objectsSlotsFree.Pop();
+        }
+        else
+        {
+            index = _objectsSlotsCount;
+            const uint32 pageIndex = index / OBJECTS_SLOTS_PAGE_SIZE;
+            if (pageIndex >= OBJECTS_SLOTS_PAGES_MAX)
+                return 0;
+            if (!_objectsSlotsPages[pageIndex])
+            {
+                auto page = (ObjectSlot*)Allocator::Allocate(sizeof(ObjectSlot) * OBJECTS_SLOTS_PAGE_SIZE);
+                Platform::MemoryClear(page, sizeof(ObjectSlot) * OBJECTS_SLOTS_PAGE_SIZE);
+                Platform::AtomicStore((int64 volatile*)&_objectsSlotsPages[pageIndex], (int64)(intptr)page);
+            }
+            _objectsSlotsCount++;
+        }
+        ObjectSlot& slot = GetObjectSlot(index);
+        Platform::AtomicStore(&slot.Object, (int64)(intptr)obj);
+        return ((uint64)(uint32)slot.Generation << 32) | (uint64)(index + 1);
+    }
+
+    void FreeObjectSlot(uint64 handle)
+    {
+        if (handle == 0)
+            return;
+        const uint32 index = (uint32)handle - 1;
+        ScopeLock lock(_objectsSlotsLocker);
+        ObjectSlot& slot = GetObjectSlot(index);
+
+        // Bump generation before clearing the object so concurrent lookups with the old handle detect the change
+        Platform::InterlockedIncrement(&slot.Generation);
+        Platform::AtomicStore(&slot.Object, 0);
+        _objectsSlotsFree.Add(index);
+    }
+
     bool _isEngineAssemblyLoaded = false;
     bool _hasGameModulesLoaded = false;
     MMethod* _method_Update = nullptr;
@@ -429,6 +544,7 @@ bool Scripting::LoadBinaryModules(const String& path, const String& projectFolde
 bool Scripting::Load()
 {
     PROFILE_CPU();
+    PROFILE_MEM(Scripting);
     // Note: this action can be called from main thread (due to Mono problems with assemblies actions from other threads)
     ASSERT(IsInMainThread());
 
@@ -546,9 +662,10 @@ void Scripting::Release()
     MCore::GC::WaitForPendingFinalizers();
 
     // Release managed objects instances for persistent objects (assets etc.)
-    _objectsLocker.Lock();
+    LockObjectsShards();
+    for (auto& shard : _objectsShards)
     {
-        for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
         {
             auto obj = i->Value;
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
@@ -557,7 +674,7 @@ void Scripting::Release()
             obj->OnScriptingDispose();
         }
     }
-    _objectsLocker.Unlock();
+    UnlockObjectsShards();
 
     // Unload assemblies (from back to front)
     {
@@ -641,9 +758,10 @@ void Scripting::Reload(bool canTriggerSceneReload)
 
     // Destroy objects from game assemblies (eg. not released objects that might crash if persist in memory after reload)
     const auto flaxModule = GetBinaryModuleFlaxEngine();
-    _objectsLocker.Lock();
+    LockObjectsShards();
+    for (auto& shard : _objectsShards)
     {
-        for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
         {
             auto obj = i->Value;
             if (obj->GetTypeHandle().Module == flaxModule)
@@ -655,7 +773,7 @@ void Scripting::Reload(bool canTriggerSceneReload)
             obj->OnScriptingDispose();
         }
     }
-    _objectsLocker.Unlock();
+    UnlockObjectsShards();
 
     // Release assets sourced from game assemblies
     for (auto asset : Content::GetAssets())
@@ -809,15 +927,17 @@ ScriptingObject* Scripting::FindObject(Guid id, MClass* type)
     // Try to find it
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
+    auto& shard = GetObjectsShard(id);
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, data);
+    shard.Locker.Unlock();
     auto result = data.Ptr;
 #else
     ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
+    auto& shard = GetObjectsShard(id);
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, result);
+    shard.Locker.Unlock();
 #endif
     if (result)
     {
@@ -863,15 +983,17 @@ ScriptingObject* Scripting::TryFindObject(Guid id, MClass* type)
     // Try to find it
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
+    auto& shard = GetObjectsShard(id);
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, data);
+    shard.Locker.Unlock();
     auto result = data.Ptr;
 #else
     ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
+    auto& shard = GetObjectsShard(id);
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, result);
+    shard.Locker.Unlock();
 #endif
 
     // Check type
@@ -883,16 +1005,39 @@ ScriptingObject* Scripting::TryFindObject(Guid id, MClass* type)
     return result;
 }
 
+ScriptingObject* Scripting::FindObjectByHandle(uint64 registryHandle)
+{
+    const uint32 index = (uint32)registryHandle - 1;
+    if (registryHandle == 0 || index >= Platform::AtomicRead((int32 volatile*)&_objectsSlotsCount))
+        return nullptr;
+    const auto page = (ObjectSlot*)(intptr)Platform::AtomicRead((int64 volatile*)&_objectsSlotsPages[index / OBJECTS_SLOTS_PAGE_SIZE]);
+    if (!page)
+        return nullptr;
+    ObjectSlot& slot = page[index % OBJECTS_SLOTS_PAGE_SIZE];
+
+    // Validate slot generation before and after reading the object to skip slots that got reused in the meantime
+    const uint32 generation = (uint32)(registryHandle >> 32);
+    if ((uint32)Platform::AtomicRead(&slot.Generation) != generation)
+        return nullptr;
+    const auto result = (ScriptingObject*)(intptr)Platform::AtomicRead(&slot.Object);
+    if ((uint32)Platform::AtomicRead(&slot.Generation) != generation)
+        return nullptr;
+    return result;
+}
+
 ScriptingObject* Scripting::TryFindObject(MClass* type)
 {
     if (type == nullptr)
         return nullptr;
-    ScopeLock lock(_objectsLocker);
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    ObjectsShardsScopeLock lock;
+    for (auto& shard : _objectsShards)
     {
-        const auto obj = i->Value;
-        if (obj->GetClass() == type)
-            return obj;
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            const auto obj = i->Value;
+            if (obj->GetClass() == type)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -905,13 +1050,15 @@ ScriptingObject* Scripting::FindObject(const MObject* managedInstance)
 
     // TODO: optimize it by reading the unmanagedPtr or _internalId from managed Object property
 
-    ScopeLock lock(_objectsLocker);
-
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    ObjectsShardsScopeLock lock;
+    for (auto& shard : _objectsShards)
     {
-        const auto obj = i->Value;
-        if (obj->GetManagedInstance() == managedInstance)
-            return obj;
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            const auto obj = i->Value;
+            if (obj->GetManagedInstance() == managedInstance)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -922,8 +1069,17 @@ void Scripting::OnManagedInstanceDeleted(ScriptingObject* obj)
     ASSERT(obj);
 
     // Validate if object still exists
-    _objectsLocker.Lock();
-    if (_objectsDictionary.ContainsValue(obj))
+    LockObjectsShards();
+    bool isRegistered = false;
+    for (auto& shard : _objectsShards)
+    {
+        if (shard.Objects.ContainsValue(obj))
+        {
+            isRegistered = true;
+            break;
+        }
+    }
+    if (isRegistered)
     {
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
         LOG(Info, "[OnManagedInstanceDeleted] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
@@ -934,7 +1090,7 @@ void Scripting::OnManagedInstanceDeleted(ScriptingObject* obj)
     {
         //LOG(Warning, "Object finalization called for already removed object (address={0:x})", (uint64)obj);
     }
-    _objectsLocker.Unlock();
+    UnlockObjectsShards();
 }
 
 bool Scripting::HasGameModulesLoaded()
@@ -961,56 +1117,72 @@ bool Scripting::IsTypeFromGameScripts(MClass* type)
 
 void Scripting::RegisterObject(ScriptingObject* obj)
 {
-    ScopeLock lock(_objectsLocker);
+    auto& shard = GetObjectsShard(obj->GetID());
+    ScopeLock lock(shard.Locker);
 
-    //ASSERT(!_objectsDictionary.ContainsValue(obj));
+    //ASSERT(!shard.Objects.ContainsValue(obj));
 #if ENABLE_ASSERTION
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData other;
-    if (_objectsDictionary.TryGet(obj->GetID(), other))
+    if (shard.Objects.TryGet(obj->GetID(), other))
 #else
     ScriptingObject* other;
-    if (_objectsDictionary.TryGet(obj->GetID(), other))
+    if (shard.Objects.TryGet(obj->GetID(), other))
 #endif
     {
         // Something went wrong...
         LOG(Error, "Objects registry already contains object with ID={0} (type '{3}')! Trying to register object {1} (type '{2}').", obj->GetID(), obj->ToString(), String(obj->GetClass()->GetFullName()), String(other->GetClass()->GetFullName()));
-        _objectsDictionary.Remove(obj->GetID());
+        shard.Objects.Remove(obj->GetID());
     }
 #else
-	ASSERT(!_objectsDictionary.ContainsKey(obj->_id));
+	ASSERT(!shard.Objects.ContainsKey(obj->_id));
 #endif
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[RegisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary.Add(obj->GetID(), obj);
+    shard.Objects.Add(obj->GetID(), obj);
+    obj->_registryHandle = AllocObjectSlot(obj);
 }
 
 void Scripting::UnregisterObject(ScriptingObject* obj)
 {
-    ScopeLock lock(_objectsLocker);
+    auto& shard = GetObjectsShard(obj->GetID());
+    ScopeLock lock(shard.Locker);
 
-    //ASSERT(!obj->_id.IsValid() || _objectsDictionary.ContainsValue(obj));
+    //ASSERT(!obj->_id.IsValid() || shard.Objects.ContainsValue(obj));
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[UnregisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary.Remove(obj->GetID());
+    shard.Objects.Remove(obj->GetID());
+    FreeObjectSlot(obj->_registryHandle);
+    obj->_registryHandle = 0;
 }
 
 void Scripting::OnObjectIdChanged(ScriptingObject* obj, const Guid& oldId)
 {
-    ScopeLock lock(_objectsLocker);
-
     ASSERT(obj && oldId.IsValid());
     ASSERT(obj->GetID() != oldId);
-    ASSERT(_objectsDictionary.ContainsKey(oldId));
-    //ASSERT(_objectsDictionary.ContainsValue(obj));
-    ASSERT(!_objectsDictionary.ContainsKey(obj->GetID()));
 
-    _objectsDictionary.Remove(oldId);
-    _objectsDictionary.Add(obj->GetID(), obj);
+    // Lock both shards in the index order (the same as when locking all shards) to prevent deadlocks
+    const uint32 oldShardIndex = GetObjectsShardIndex(oldId);
+    const uint32 newShardIndex = GetObjectsShardIndex(obj->GetID());
+    auto& oldShard = _objectsShards[oldShardIndex];
+    auto& newShard = _objectsShards[newShardIndex];
+    _objectsShards[Math::Min(oldShardIndex, newShardIndex)].Locker.Lock();
+    _objectsShards[Math::Max(oldShardIndex, newShardIndex)].Locker.Lock();
+
+    ASSERT(oldShard.Objects.ContainsKey(oldId));
+    //ASSERT(oldShard.Objects.ContainsValue(obj));
+    ASSERT(!newShard.Objects.ContainsKey(obj->GetID()));
+
+    // Object slot stays the same so the registry handle remains valid
+    oldShard.Objects.Remove(oldId);
+    newShard.Objects.Add(obj->GetID(), obj);
+
+    _objectsShards[Math::Max(oldShardIndex, newShardIndex)].Locker.Unlock();
+    _objectsShards[Math::Min(oldShardIndex, newShardIndex)].Locker.Unlock();
 }
 
 bool initFlaxEngine()
@@ -161,6 +161,13 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Scripting);
     /// <returns>The found object or null if missing.</returns>
     static ScriptingObject* TryFindObject(Guid id, MClass* type = nullptr);
 
+    /// <summary>
+    /// Finds the registered object by the given registry handle (see ScriptingObject::GetRegistryHandle). Lock-free and doesn't hash object ID so it can be used on hot paths to resolve cached object references.
+    /// </summary>
+    /// <param name="registryHandle">The object registry handle.</param>
+    /// <returns>The found object or null if missing (eg. object has been unregistered).</returns>
+    static ScriptingObject* FindObjectByHandle(uint64 registryHandle);
+
     /// <summary>
     /// Finds the object by the given managed instance handle. Searches only registered scene objects.
     /// </summary>
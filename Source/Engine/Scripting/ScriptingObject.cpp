@@ -28,6 +28,7 @@ ScriptingObject::ScriptingObject(const SpawnParams& params)
     : _gcHandle(0)
     , _type(params.Type)
     , _id(params.ID)
+    , _registryHandle(0)
 {
     // Managed objects must have valid and unique ID
     ASSERT(_id.IsValid());
@@ -23,6 +23,7 @@ API_CLASS(InBuild) class FLAXENGINE_API ScriptingObject : public Object
     MGCHandle _gcHandle;
     ScriptingTypeHandle _type;
     Guid _id;
+    uint64 _registryHandle;
 
 public:
     /// <summary>
@@ -91,6 +92,14 @@ API_CLASS(InBuild) class FLAXENGINE_API ScriptingObject : public Object
         return _id;
     }
 
+    /// <summary>
+    /// Gets the generational handle of this object in the scripting objects registry (valid only when object is registered, otherwise 0). Can be cached and used with Scripting::FindObject to lookup the object without the ID hashing and locking.
+    /// </summary>
+    FORCE_INLINE uint64 GetRegistryHandle() const
+    {
+        return _registryHandle;
+    }
+
     /// <summary>
     /// Gets the scripting type handle of this object.
     /// </summary>
@@ -0,0 +1,119 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "BinarySerialization.h"
+#include "MemoryReadStream.h"
+#include "Json.h"
+#include "Engine/Debug/Exceptions/JsonParseException.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+void ISerializable::SerializeBinary(WriteStream& stream, const void* otherObj)
+{
+    // Fallback to Json for types without binary serialization
+    BinarySerialization::WriteJson(stream, this, otherObj);
+}
+
+void ISerializable::DeserializeBinary(ReadStream& stream, ISerializeModifier* modifier)
+{
+    // Skip members if binary data was saved by the different type
+    if (BinarySerialization::ReadObject(stream, this, modifier))
+        BinarySerialization::SkipMembers(stream);
+}
+
+void BinarySerialization::BeginObject(WriteStream& stream)
+{
+    stream.WriteByte((byte)Format::Binary);
+    stream.WriteInt32(FLAXENGINE_VERSION_BUILD);
+}
+
+void BinarySerialization::EndObject(WriteStream& stream)
+{
+    stream.WriteUint32(0);
+}
+
+void BinarySerialization::WriteJson(WriteStream& stream, ISerializable* obj, const void* otherObj)
+{
+    stream.WriteByte((byte)Format::Json);
+    stream.WriteJson(obj, otherObj);
+}
+
+uint32 BinarySerialization::BeginMember(WriteStream& stream, uint32 id)
+{
+    stream.WriteUint32(id);
+    const uint32 start = stream.GetPosition();
+    stream.WriteUint32(0);
+    return start;
+}
+
+void BinarySerialization::EndMember(WriteStream& stream, uint32 start)
+{
+    // Patch the member data size
+    const uint32 end = stream.GetPosition();
+    stream.SetPosition(start);
+    stream.WriteUint32(end - start - sizeof(uint32));
+    stream.SetPosition(end);
+}
+
+bool BinarySerialization::ReadObject(ReadStream& stream, ISerializable* obj, ISerializeModifier* modifier)
+{
+    byte format;
+    stream.ReadByte(&format);
+    int32 engineBuild;
+    stream.ReadInt32(&engineBuild);
+    if ((Format)format == Format::Binary)
+    {
+        modifier->EngineBuild = engineBuild;
+        return true;
+    }
+
+    // Json fallback
+    int32 size;
+    stream.ReadInt32(&size);
+    if (size <= 0)
+        return false;
+    const char* data;
+    void* allocation = nullptr;
+    if (const auto memoryStream = dynamic_cast<MemoryReadStream*>(&stream))
+    {
+        data = (const char*)memoryStream->Move(size);
+    }
+    else
+    {
+        allocation = Allocator::Allocate(size);
+        stream.ReadBytes(allocation, size);
+        data = (const char*)allocation;
+    }
+    ISerializable::SerializeDocument document;
+    {
+        PROFILE_CPU_NAMED("Json.Parse");
+        document.Parse(data, size);
+    }
+    Allocator::Free(allocation);
+    if (document.HasParseError())
+    {
+        Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+        return false;
+    }
+    const uint32 prevEngineBuild = modifier->EngineBuild;
+    modifier->EngineBuild = engineBuild;
+    obj->Deserialize(document, modifier);
+    modifier->EngineBuild = prevEngineBuild;
+    return false;
+}
+
+bool BinarySerialization::ReadMember(ReadStream& stream, uint32& id, uint32& end)
+{
+    stream.ReadUint32(&id);
+    if (id == 0 || stream.HasError())
+        return false;
+    uint32 size;
+    stream.ReadUint32(&size);
+    end = stream.GetPosition() + size;
+    return true;
+}
+
+void BinarySerialization::SkipMembers(ReadStream& stream)
+{
+    uint32 id, end;
+    while (ReadMember(stream, id, end))
+        stream.SetPosition(end);
+}
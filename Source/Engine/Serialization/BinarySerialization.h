@@ -0,0 +1,221 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "ISerializeModifier.h"
+#include "ReadStream.h"
+#include "WriteStream.h"
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingObject.h"
+
+template<typename T>
+class ScriptingObjectReference;
+template<typename T>
+class SoftObjectReference;
+template<typename T>
+class AssetReference;
+template<typename T>
+class WeakAssetReference;
+template<typename T>
+class SoftAssetReference;
+
+// Binary serialization helper macro (id is a constant member name hash)
+#define BINARY_SERIALIZE_MEMBER(id, member) \
+    if (Serialization::ShouldSerialize(member, other ? &other->member : nullptr)) \
+    { \
+        const uint32 memberStart = BinarySerialization::BeginMember(stream, id); \
+        BinarySerialization::Serialize(stream, member, other ? &other->member : nullptr); \
+        BinarySerialization::EndMember(stream, memberStart); \
+    }
+
+/// <summary>
+/// Objects binary serialization utilities. Compact alternative to Json used for engine-internal data round-trips (eg. undo, copy/paste or network payloads).
+/// </summary>
+/// <remarks>
+/// Object data starts with the format byte and the engine build number. Binary format contains members stored as: name hash, data size and data (terminated with zero name hash), so the reader can skip unknown or removed members.
+/// </remarks>
+namespace BinarySerialization
+{
+    /// <summary>
+    /// The object data format.
+    /// </summary>
+    enum class Format : byte
+    {
+        // Json text (used by the objects without binary serialization).
+        Json = 0,
+        // Binary members.
+        Binary = 1,
+    };
+
+    /// <summary>
+    /// The member identifier of the base type data (serialized via the base type SerializeBinary).
+    /// </summary>
+    constexpr uint32 BaseMemberId = 1;
+
+    /// <summary>
+    /// Writes the object data header for the binary format.
+    /// </summary>
+    /// <param name="stream">The output stream.</param>
+    FLAXENGINE_API void BeginObject(WriteStream& stream);
+
+    /// <summary>
+    /// Ends the object data in binary format.
+    /// </summary>
+    /// <param name="stream">The output stream.</param>
+    FLAXENGINE_API void EndObject(WriteStream& stream);
+
+    /// <summary>
+    /// Writes the object data in Json format (for objects that don't implement binary serialization).
+    /// </summary>
+    /// <param name="stream">The output stream.</param>
+    /// <param name="obj">The object to serialize.</param>
+    /// <param name="otherObj">The instance of the object to compare with and serialize only the modified properties. If null, then serialize all properties.</param>
+    FLAXENGINE_API void WriteJson(WriteStream& stream, ISerializable* obj, const void* otherObj);
+
+    /// <summary>
+    /// Begins the member data.
+    /// </summary>
+    /// <param name="stream">The output stream.</param>
+    /// <param name="id">The member identifier.</param>
+    /// <returns>The member start position (to pass into EndMember).</returns>
+    FLAXENGINE_API uint32 BeginMember(WriteStream& stream, uint32 id);
+
+    /// <summary>
+    /// Ends the member data.
+    /// </summary>
+    /// <param name="stream">The output stream.</param>
+    /// <param name="start">The member start position returned by BeginMember.</param>
+    FLAXENGINE_API void EndMember(WriteStream& stream, uint32 start);
+
+    /// <summary>
+    /// Reads the object data header. Deserializes the object if the data is in Json format.
+    /// </summary>
+    /// <param name="stream">The input stream.</param>
+    /// <param name="obj">The object to deserialize.</param>
+    /// <param name="modifier">The deserialization modifier object. Always valid.</param>
+    /// <returns>True if object data is in binary format and members should be read, otherwise false.</returns>
+    FLAXENGINE_API bool ReadObject(ReadStream& stream, ISerializable* obj, ISerializeModifier* modifier);
+
+    /// <summary>
+    /// Reads the next object member header.
+    /// </summary>
+    /// <param name="stream">The input stream.</param>
+    /// <param name="id">The member identifier.</param>
+    /// <param name="end">The member data end position (to skip the remaining member data).</param>
+    /// <returns>True if member has been read, otherwise false if reached the object data end.</returns>
+    FLAXENGINE_API bool ReadMember(ReadStream& stream, uint32& id, uint32& end);
+
+    /// <summary>
+    /// Skips the remaining object members.
+    /// </summary>
+    /// <param name="stream">The input stream.</param>
+    FLAXENGINE_API void SkipMembers(ReadStream& stream);
+
+    // Plain data, strings and collections
+
+    template<typename T>
+    FORCE_INLINE typename TEnableIf<TNot<TIsBaseOf<ISerializable, T>>::Value>::Type Serialize(WriteStream& stream, const T& v, const void* otherObj)
+    {
+        stream.Write(v);
+    }
+    template<typename T>
+    FORCE_INLINE typename TEnableIf<TNot<TIsBaseOf<ISerializable, T>>::Value>::Type Deserialize(ReadStream& stream, T& v, ISerializeModifier* modifier)
+    {
+        stream.Read(v);
+    }
+
+    // ISerializable
+
+    template<typename T>
+    FORCE_INLINE typename TEnableIf<TIsBaseOf<ISerializable, T>::Value>::Type Serialize(WriteStream& stream, const T& v, const void* otherObj)
+    {
+        ((T&)v).SerializeBinary(stream, otherObj);
+    }
+    template<typename T>
+    FORCE_INLINE typename TEnableIf<TIsBaseOf<ISerializable, T>::Value>::Type Deserialize(ReadStream& stream, T& v, ISerializeModifier* modifier)
+    {
+        v.DeserializeBinary(stream, modifier);
+    }
+
+    // Scripting Object
+
+    template<typename T>
+    inline typename TEnableIf<TIsBaseOf<ScriptingObject, T>::Value>::Type Serialize(WriteStream& stream, T* const& v, const void* otherObj)
+    {
+        stream.Write(v ? v->GetID() : Guid::Empty);
+    }
+    template<typename T>
+    inline typename TEnableIf<TIsBaseOf<ScriptingObject, T>::Value>::Type Deserialize(ReadStream& stream, T*& v, ISerializeModifier* modifier)
+    {
+        Guid id;
+        stream.Read(id);
+        modifier->IdsMapping.TryGet(id, id);
+        v = (T*)::FindObject(id, T::GetStaticClass());
+    }
+
+    // Object and asset references (stored as object id)
+
+    template<typename T>
+    inline void Serialize(WriteStream& stream, const ScriptingObjectReference<T>& v, const void* otherObj)
+    {
+        stream.Write(v.GetID());
+    }
+    template<typename T>
+    inline void Deserialize(ReadStream& stream, ScriptingObjectReference<T>& v, ISerializeModifier* modifier)
+    {
+        Guid id;
+        stream.Read(id);
+        modifier->IdsMapping.TryGet(id, id);
+        v = id;
+    }
+    template<typename T>
+    inline void Serialize(WriteStream& stream, const SoftObjectReference<T>& v, const void* otherObj)
+    {
+        stream.Write(v.GetID());
+    }
+    template<typename T>
+    inline void Deserialize(ReadStream& stream, SoftObjectReference<T>& v, ISerializeModifier* modifier)
+    {
+        Guid id;
+        stream.Read(id);
+        modifier->IdsMapping.TryGet(id, id);
+        v = id;
+    }
+    template<typename T>
+    inline void Serialize(WriteStream& stream, const AssetReference<T>& v, const void* otherObj)
+    {
+        stream.Write(v.GetID());
+    }
+    template<typename T>
+    inline void Deserialize(ReadStream& stream, AssetReference<T>& v, ISerializeModifier* modifier)
+    {
+        Guid id;
+        stream.Read(id);
+        v = id;
+    }
+    template<typename T>
+    inline void Serialize(WriteStream& stream, const WeakAssetReference<T>& v, const void* otherObj)
+    {
+        stream.Write(v.GetID());
+    }
+    template<typename T>
+    inline void Deserialize(ReadStream& stream, WeakAssetReference<T>& v, ISerializeModifier* modifier)
+    {
+        Guid id;
+        stream.Read(id);
+        v = id;
+    }
+    template<typename T>
+    inline void Serialize(WriteStream& stream, const SoftAssetReference<T>& v, const void* otherObj)
+    {
+        stream.Write(v.GetID());
+    }
+    template<typename T>
+    inline void Deserialize(ReadStream& stream, SoftAssetReference<T>& v, ISerializeModifier* modifier)
+    {
+        Guid id;
+        stream.Read(id);
+        v = id;
+    }
+}
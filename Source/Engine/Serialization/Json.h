@@ -5,7 +5,9 @@
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
 
-// TODO: config RAPIDJSON_SSE2 for rapidjson
+#if PLATFORM_SIMD_SSE2
+#define RAPIDJSON_SSE2
+#endif
 #define RAPIDJSON_ERROR_CHARTYPE Char
 #define RAPIDJSON_ERROR_STRING(x) TEXT(x)
 #define RAPIDJSON_ASSERT(x) ASSERT(x)
@@ -61,4 +63,101 @@ namespace rapidjson_flax
     // Pretty JSON writer to the stream
     template<typename OutputStream, typename SourceEncoding = rapidjson::UTF8<>, typename TargetEncoding = rapidjson::UTF8<>, unsigned writeFlags = rapidjson::kWriteDefaultFlags>
     using PrettyWriter = rapidjson::PrettyWriter<OutputStream, SourceEncoding, TargetEncoding, FlaxAllocator, writeFlags>;
+
+    // Writes the shortest decimal text of the float value that parses back to the same float (Grisu2 on the float precision boundaries, eg. 0.1f is written as 0.1 instead of 0.10000000149011612). Value has to be finite and buffer at least 25 characters long. Returns the end of the written text.
+    inline char* FloatToString(float value, char* buffer)
+    {
+        using namespace rapidjson::internal;
+        union
+        {
+            float f;
+            uint32 u;
+        } bits;
+        bits.f = value;
+        uint32 u = bits.u;
+        if (u & 0x80000000)
+        {
+            *buffer++ = '-';
+            u &= 0x7fffffff;
+        }
+        if (u == 0)
+        {
+            buffer[0] = '0';
+            buffer[1] = '.';
+            buffer[2] = '0';
+            return buffer + 3;
+        }
+        const int32 biasedExponent = (int32)(u >> 23);
+        const uint64 significand = u & 0x7fffff;
+        const DiyFp v = biasedExponent != 0 ? DiyFp(significand + 0x800000, biasedExponent - 150) : DiyFp(significand, -149);
+
+        // Boundaries are halfway to the neighbour floats (lower one is closer for the powers of two)
+        const DiyFp plus = DiyFp((v.f << 1) + 1, v.e - 1).Normalize();
+        DiyFp minus = significand == 0 && biasedExponent > 1 ? DiyFp((v.f << 2) - 1, v.e - 2) : DiyFp((v.f << 1) - 1, v.e - 1);
+        minus.f <<= minus.e - plus.e;
+        minus.e = plus.e;
+
+        int length, k;
+        const DiyFp cachedPower = GetCachedPower(plus.e, &k);
+        const DiyFp w = v.Normalize() * cachedPower;
+        DiyFp wPlus = plus * cachedPower;
+        DiyFp wMinus = minus * cachedPower;
+        wMinus.f++;
+        wPlus.f--;
+        DigitGen(w, wPlus, wPlus.f - wMinus.f, buffer, &length, &k);
+        return Prettify(buffer, length, k, 324);
+    }
+}
+
+namespace rapidjson
+{
+    // Engine writer specializations that write directly into the output buffer (the generic versions put characters one by one)
+
+    template<>
+    inline bool rapidjson_flax::Writer<rapidjson_flax::StringBuffer>::WriteDouble(double d)
+    {
+        if (internal::Double(d).IsNanOrInf())
+            return false;
+        char* buffer = os_->Push(25);
+        const char* end = internal::dtoa(d, buffer, maxDecimalPlaces_);
+        os_->Pop(static_cast<size_t>(25 - (end - buffer)));
+        return true;
+    }
+
+#if PLATFORM_SIMD_SSE2
+    template<>
+    inline bool rapidjson_flax::Writer<rapidjson_flax::StringBuffer>::ScanWriteUnescapedString(StringStream& is, size_t length)
+    {
+        // Copy the string in 16-characters blocks until the first character that needs escaping (remaining characters are processed by the caller)
+        const char* p = is.src_;
+        const char* end = is.head_ + length;
+        const __m128i quote = _mm_set1_epi8('\"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control = _mm_set1_epi8(0x1f);
+        while (end - p >= 16)
+        {
+            const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const __m128i escaped = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(s, quote), _mm_cmpeq_epi8(s, backslash)), _mm_cmpeq_epi8(_mm_min_epu8(s, control), s)); // s < 0x20 <=> min(s, 0x1f) == s
+            const uint32 mask = (uint32)_mm_movemask_epi8(escaped);
+            if (mask != 0)
+            {
+#if defined(_MSC_VER)
+                unsigned long count;
+                _BitScanForward(&count, mask);
+#else
+                const uint32 count = __builtin_ctz(mask);
+#endif
+                char* q = os_->PushUnsafe(count);
+                for (uint32 i = 0; i < count; i++)
+                    q[i] = p[i];
+                p += count;
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(os_->PushUnsafe(16)), s);
+            p += 16;
+        }
+        is.src_ = p;
+        return RAPIDJSON_LIKELY(is.Tell() < length);
+    }
+#endif
 }
@@ -11,6 +11,17 @@
 #include "Engine/Level/SceneObject.h"
 #include "Engine/Utilities/Encryption.h"
 
+void JsonWriter::FloatsObject(const char* keys, const float* values, int32 count)
+{
+    StartObject();
+    for (int32 i = 0; i < count; i++)
+    {
+        Key(keys + i, 1);
+        Float(values[i]);
+    }
+    EndObject();
+}
+
 void JsonWriter::Blob(const void* data, int32 length)
 {
     ::Array<char> base64;
@@ -26,16 +37,21 @@ void JsonWriter::DateTime(const ::DateTime& value)
 
 void JsonWriter::Vector2(const ::Vector2& value)
 {
+#if USE_LARGE_WORLDS
     StartObject();
     JKEY("X");
     Real(value.X);
     JKEY("Y");
     Real(value.Y);
     EndObject();
+#else
+    FloatsObject("XY", &value.X, 2);
+#endif
 }
 
 void JsonWriter::Vector3(const ::Vector3& value)
 {
+#if USE_LARGE_WORLDS
     StartObject();
     JKEY("X");
     Real(value.X);
@@ -44,10 +60,14 @@ void JsonWriter::Vector3(const ::Vector3& value)
     JKEY("Z");
     Real(value.Z);
     EndObject();
+#else
+    FloatsObject("XYZ", &value.X, 3);
+#endif
 }
 
 void JsonWriter::Vector4(const ::Vector4& value)
 {
+#if USE_LARGE_WORLDS
     StartObject();
     JKEY("X");
     Real(value.X);
@@ -58,42 +78,24 @@ void JsonWriter::Vector4(const ::Vector4& value)
     JKEY("W");
     Real(value.W);
     EndObject();
+#else
+    FloatsObject("XYZW", &value.X, 4);
+#endif
 }
 
 void JsonWriter::Float2(const ::Float2& value)
 {
-    StartObject();
-    JKEY("X");
-    Real(value.X);
-    JKEY("Y");
-    Float(value.Y);
-    EndObject();
+    FloatsObject("XY", &value.X, 2);
 }
 
 void JsonWriter::Float3(const ::Float3& value)
 {
-    StartObject();
-    JKEY("X");
-    Float(value.X);
-    JKEY("Y");
-    Float(value.Y);
-    JKEY("Z");
-    Float(value.Z);
-    EndObject();
+    FloatsObject("XYZ", &value.X, 3);
 }
 
 void JsonWriter::Float4(const ::Float4& value)
 {
-    StartObject();
-    JKEY("X");
-    Float(value.X);
-    JKEY("Y");
-    Float(value.Y);
-    JKEY("Z");
-    Float(value.Z);
-    JKEY("W");
-    Float(value.W);
-    EndObject();
+    FloatsObject("XYZW", &value.X, 4);
 }
 
 void JsonWriter::Double2(const ::Double2& value)
@@ -170,30 +172,12 @@ void JsonWriter::Int4(const ::Int4& value)
 
 void JsonWriter::Color(const ::Color& value)
 {
-    StartObject();
-    JKEY("R");
-    Float(value.R);
-    JKEY("G");
-    Float(value.G);
-    JKEY("B");
-    Float(value.B);
-    JKEY("A");
-    Float(value.A);
-    EndObject();
+    FloatsObject("RGBA", &value.R, 4);
 }
 
 void JsonWriter::Quaternion(const ::Quaternion& value)
 {
-    StartObject();
-    JKEY("X");
-    Float(value.X);
-    JKEY("Y");
-    Float(value.Y);
-    JKEY("Z");
-    Float(value.Z);
-    JKEY("W");
-    Float(value.W);
-    EndObject();
+    FloatsObject("XYZW", &value.X, 4);
 }
 
 void JsonWriter::Ray(const ::Ray& value)
@@ -38,6 +38,9 @@ class FLAXENGINE_API JsonWriter
     virtual void StartArray() = 0;
     virtual void EndArray(int32 count = 0) = 0;
 
+    // Writes the object with float members (single-character keys, eg. "XYZ" for Float3). Writer implementations can output it at once to reduce the per-member overhead.
+    virtual void FloatsObject(const char* keys, const float* values, int32 count);
+
 public:
     FORCE_INLINE void Key(const StringAnsiView& str)
     {
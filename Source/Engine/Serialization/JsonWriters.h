@@ -79,6 +79,12 @@ class JsonWriterBase : public JsonWriter
         writer.Float(d);
     }
 
+    void FloatsObject(const char* keys, const float* values, int32 count) override
+    {
+        if (!writer.FloatsObject(keys, values, count))
+            JsonWriter::FloatsObject(keys, values, count);
+    }
+
     void Double(double d) override
     {
         writer.Double(d);
@@ -129,7 +135,44 @@ class FLAXENGINE_API CompactJsonWriterImpl : public rapidjson_flax::Writer<rapid
     void Float(float d)
     {
         Prefix(rapidjson::kNumberType);
-        WriteDouble(d);
+        if (isfinite(d))
+        {
+            char* buffer = os_->Push(25);
+            os_->Pop(25 - (rapidjson_flax::FloatToString(d, buffer) - buffer));
+        }
+        else
+        {
+            WriteDouble(d);
+        }
+    }
+
+    bool FloatsObject(const char* keys, const float* values, int32 count)
+    {
+        for (int32 i = 0; i < count; i++)
+        {
+            if (!isfinite(values[i]))
+                return false;
+        }
+        Prefix(rapidjson::kObjectType);
+
+        // Write the whole object at once: {"X":0.0,"Y":0.0}
+        const int32 size = 2 + count * (5 + 25);
+        char* start = os_->Push(size);
+        char* p = start;
+        *p++ = '{';
+        for (int32 i = 0; i < count; i++)
+        {
+            if (i != 0)
+                *p++ = ',';
+            *p++ = '\"';
+            *p++ = keys[i];
+            *p++ = '\"';
+            *p++ = ':';
+            p = rapidjson_flax::FloatToString(values[i], p);
+        }
+        *p++ = '}';
+        os_->Pop(size - (int32)(p - start));
+        return true;
     }
 };
 
@@ -167,7 +210,53 @@ class FLAXENGINE_API PrettyJsonWriterImpl : public rapidjson_flax::PrettyWriter<
     FORCE_INLINE void Float(float d)
     {
         PrettyPrefix(rapidjson::kNumberType);
-        WriteDouble(d);
+        if (isfinite(d))
+        {
+            char* buffer = os_->Push(25);
+            os_->Pop(25 - (rapidjson_flax::FloatToString(d, buffer) - buffer));
+        }
+        else
+        {
+            WriteDouble(d);
+        }
+    }
+
+    bool FloatsObject(const char* keys, const float* values, int32 count)
+    {
+        for (int32 i = 0; i < count; i++)
+        {
+            if (!isfinite(values[i]))
+                return false;
+        }
+        PrettyPrefix(rapidjson::kObjectType);
+
+        // Write the whole object at once (matches the layout of StartObject/Key/Float/EndObject sequence)
+        const int32 indent = (int32)(level_stack_.GetSize() / sizeof(Level) * indentCharCount_);
+        const int32 memberIndent = indent + (int32)indentCharCount_;
+        const int32 size = 3 + indent + count * (6 + memberIndent + 25);
+        char* start = os_->Push(size);
+        char* p = start;
+        *p++ = '{';
+        for (int32 i = 0; i < count; i++)
+        {
+            if (i != 0)
+                *p++ = ',';
+            *p++ = '\n';
+            for (int32 j = 0; j < memberIndent; j++)
+                *p++ = indentChar_;
+            *p++ = '\"';
+            *p++ = keys[i];
+            *p++ = '\"';
+            *p++ = ':';
+            *p++ = ' ';
+            p = rapidjson_flax::FloatToString(values[i], p);
+        }
+        *p++ = '\n';
+        for (int32 j = 0; j < indent; j++)
+            *p++ = indentChar_;
+        *p++ = '}';
+        os_->Pop(size - (int32)(p - start));
+        return true;
     }
 };
 
@@ -2,8 +2,85 @@
 
 #include "Engine/Platform/Platform.h"
 #include "Engine/Platform/File.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Array.h"
 #include "MemoryWriteStream.h"
 
+#define POOL_MIN_SIZE_LOG2 8
+#define POOL_MAX_SIZE_LOG2 22
+#define POOL_BUCKET_CAPACITY 8
+static_assert(1 << POOL_MAX_SIZE_LOG2 == MEMORY_WRITE_STREAM_POOL_MAX_SIZE, "Invalid pool size.");
+
+namespace
+{
+    // Cached write buffers for each power-of-two size
+    CriticalSection PoolLocker;
+    Array<byte*, FixedAllocation<POOL_BUCKET_CAPACITY>> PoolBuckets[POOL_MAX_SIZE_LOG2 - POOL_MIN_SIZE_LOG2 + 1];
+
+    uint32 GetPoolCapacity(uint32 capacity)
+    {
+        if (capacity <= (1 << POOL_MIN_SIZE_LOG2))
+            return 1 << POOL_MIN_SIZE_LOG2;
+        return capacity <= MEMORY_WRITE_STREAM_POOL_MAX_SIZE ? Math::RoundUpToPowerOf2(capacity) : capacity;
+    }
+
+    int32 GetPoolBucket(uint32 capacity)
+    {
+        // Only power-of-two sizes within the pool range are reused
+        if (capacity < (1 << POOL_MIN_SIZE_LOG2) || capacity > MEMORY_WRITE_STREAM_POOL_MAX_SIZE || !Math::IsPowerOfTwo(capacity))
+            return -1;
+        int32 log2 = POOL_MIN_SIZE_LOG2;
+        while ((1u << log2) < capacity)
+            log2++;
+        return log2 - POOL_MIN_SIZE_LOG2;
+    }
+
+    byte* AllocateBuffer(uint32& capacity)
+    {
+        capacity = GetPoolCapacity(capacity);
+        const int32 bucket = GetPoolBucket(capacity);
+        if (bucket != -1)
+        {
+            PoolLocker.Lock();
+            auto& buffers = PoolBuckets[bucket];
+            if (buffers.HasItems())
+            {
+                byte* buffer = buffers.Pop();
+                PoolLocker.Unlock();
+                return buffer;
+            }
+            PoolLocker.Unlock();
+        }
+        byte* buffer = (byte*)Allocator::Allocate(capacity);
+        if (buffer == nullptr)
+        {
+            OUT_OF_MEMORY;
+        }
+        return buffer;
+    }
+
+    void FreeBuffer(byte* buffer, uint32 capacity)
+    {
+        if (buffer == nullptr)
+            return;
+        const int32 bucket = GetPoolBucket(capacity);
+        if (bucket != -1)
+        {
+            PoolLocker.Lock();
+            auto& buffers = PoolBuckets[bucket];
+            if (buffers.Count() < POOL_BUCKET_CAPACITY)
+            {
+                buffers.Add(buffer);
+                PoolLocker.Unlock();
+                return;
+            }
+            PoolLocker.Unlock();
+        }
+        Allocator::Free(buffer);
+    }
+}
+
 MemoryWriteStream::MemoryWriteStream()
     : _buffer(nullptr)
     , _position(nullptr)
@@ -14,24 +91,13 @@ MemoryWriteStream::MemoryWriteStream()
 MemoryWriteStream::MemoryWriteStream(uint32 capacity)
     : _capacity(capacity)
 {
-    if (capacity > 0)
-    {
-        _buffer = (byte*)Allocator::Allocate(capacity);
-        if (_buffer == nullptr)
-        {
-            OUT_OF_MEMORY;
-        }
-    }
-    else
-    {
-        _buffer = nullptr;
-    }
+    _buffer = capacity > 0 ? AllocateBuffer(_capacity) : nullptr;
     _position = _buffer;
 }
 
 MemoryWriteStream::~MemoryWriteStream()
 {
-    Allocator::Free(_buffer);
+    FreeBuffer(_buffer, _capacity);
 }
 
 void* MemoryWriteStream::Move(uint32 bytes)
@@ -45,13 +111,9 @@ void* MemoryWriteStream::Move(uint32 bytes)
         uint32 newCapacity = _capacity != 0 ? _capacity * 2 : 256;
         while (newCapacity < position + bytes)
             newCapacity *= 2;
-        byte* newBuf = (byte*)Allocator::Allocate(newCapacity);
-        if (newBuf == nullptr)
-        {
-            OUT_OF_MEMORY;
-        }
-        Platform::MemoryCopy(newBuf, _buffer, _capacity);
-        Allocator::Free(_buffer);
+        byte* newBuf = AllocateBuffer(newCapacity);
+        Platform::MemoryCopy(newBuf, _buffer, position);
+        FreeBuffer(_buffer, _capacity);
 
         // Update state
         _buffer = newBuf;
@@ -71,19 +133,34 @@ void MemoryWriteStream::Reset(uint32 capacity)
     // Check if resize
     if (capacity > _capacity)
     {
-        Allocator::Free(_buffer);
-        _buffer = (byte*)Allocator::Allocate(capacity);
-        if (_buffer == nullptr)
-        {
-            OUT_OF_MEMORY;
-        }
+        FreeBuffer(_buffer, _capacity);
         _capacity = capacity;
+        _buffer = AllocateBuffer(_capacity);
     }
 
     // Reset pointer
     _position = _buffer;
 }
 
+void MemoryWriteStream::Release(BytesContainer& data)
+{
+    data.Own(_buffer, (int32)GetPosition());
+    _buffer = nullptr;
+    _position = nullptr;
+    _capacity = 0;
+}
+
+void MemoryWriteStream::ClearPool()
+{
+    ScopeLock lock(PoolLocker);
+    for (auto& buffers : PoolBuckets)
+    {
+        for (byte* buffer : buffers)
+            Allocator::Free(buffer);
+        buffers.Clear();
+    }
+}
+
 bool MemoryWriteStream::SaveToFile(const StringView& path) const
 {
     // Open file for writing
@@ -108,7 +185,7 @@ void MemoryWriteStream::Flush()
 
 void MemoryWriteStream::Close()
 {
-    Allocator::Free(_buffer);
+    FreeBuffer(_buffer, _capacity);
     _buffer = nullptr;
     _position = nullptr;
     _capacity = 0;
@@ -141,13 +218,9 @@ void MemoryWriteStream::WriteBytes(const void* data, uint32 bytes)
         uint32 newCapacity = _capacity != 0 ? _capacity * 2 : 256;
         while (newCapacity < position + bytes)
             newCapacity *= 2;
-        byte* newBuf = (byte*)Allocator::Allocate(newCapacity);
-        if (newBuf == nullptr)
-        {
-            OUT_OF_MEMORY;
-        }
-        Platform::MemoryCopy(newBuf, _buffer, _capacity);
-        Allocator::Free(_buffer);
+        byte* newBuf = AllocateBuffer(newCapacity);
+        Platform::MemoryCopy(newBuf, _buffer, position);
+        FreeBuffer(_buffer, _capacity);
 
         // Update state
         _buffer = newBuf;
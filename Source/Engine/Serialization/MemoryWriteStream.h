@@ -3,10 +3,17 @@
 #pragma once
 
 #include "WriteStream.h"
+#include "Engine/Core/Types/DataContainer.h"
+
+// The maximum size of the write buffer that can be reused by the memory streams pool (larger buffers are freed).
+#define MEMORY_WRITE_STREAM_POOL_MAX_SIZE (4 * 1024 * 1024)
 
 /// <summary>
 /// Implementation of of the stream that can be used for fast data writing to the memory.
 /// </summary>
+/// <remarks>
+/// Write buffers are pooled (power-of-two sizes up to MEMORY_WRITE_STREAM_POOL_MAX_SIZE) and reused by the other streams after the stream gets closed or destroyed. Use Release to hand over the written data into BytesContainer (eg. asset chunk) without a copy.
+/// </remarks>
 class FLAXENGINE_API MemoryWriteStream : public WriteStream
 {
 private:
@@ -104,6 +111,18 @@ class FLAXENGINE_API MemoryWriteStream : public WriteStream
     /// <param name="capacity">Initial write buffer capacity (in bytes).</param>
     void Reset(uint32 capacity);
 
+    /// <summary>
+    /// Transfers the ownership of the written data into the container without a copy. Resets the stream to the empty state.
+    /// </summary>
+    /// <remarks>Container gets the whole buffer memory (up to 2x the data size due to growth), so prefer copying small data that is kept for long.</remarks>
+    /// <param name="data">The output container.</param>
+    void Release(BytesContainer& data);
+
+    /// <summary>
+    /// Frees the write buffers cached by the streams pool.
+    /// </summary>
+    static void ClearPool();
+
     /// <summary>
     /// Saves current buffer contents to the file
     /// </summary>
@@ -368,6 +368,8 @@ bool ShaderCompilerDX::CompileShader(ShaderFunctionMeta& meta, WritePermutationD
         {
             D3D12_SHADER_INPUT_BIND_DESC resDesc;
             shaderReflection->GetResourceBindingDesc(i, &resDesc);
+            if (resDesc.Space != 0)
+                continue; // Skip bindless resources (bound once via global descriptors table)
             switch (resDesc.Type)
             {
                 // Sampler
@@ -428,6 +430,7 @@ bool ShaderCompilerDX::OnCompileBegin()
         return true;
 
     _globalMacros.Add({ "DIRECTX", "1" });
+    _globalMacros.Add({ "CAN_USE_BINDLESS", "1" });
 
     return false;
 }
@@ -0,0 +1,500 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_SHADER_COMPILER
+
+#include "ShaderCache.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Core/Types/Pair.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/Network.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Utilities/Crc.h"
+#include "FlaxEngine.Gen.h"
+
+// Version of the cache entry data format
+#define SHADER_CACHE_ENTRY_VERSION 2
+
+// Timeout (in seconds) for the remote cache requests
+#define SHADER_CACHE_HTTP_TIMEOUT 5.0
+
+// Amount of the remote cache failures in a row after which it gets disabled
+#define SHADER_CACHE_REMOTE_MAX_FAILURES 3
+
+namespace
+{
+    // Shared folder storage (local disk or network share)
+    class ShaderCacheBackendFolder : public ShaderCacheBackend
+    {
+    private:
+        String _root;
+
+    public:
+        explicit ShaderCacheBackendFolder(const StringView& root)
+            : _root(root)
+        {
+        }
+
+        String GetPath(const StringAnsi& key) const
+        {
+            return _root / String(key.Get(), 2) / String(key) + TEXT(".bin");
+        }
+
+        bool Get(const StringAnsi& key, Array<byte>& data) override
+        {
+            const String path = GetPath(key);
+            if (!FileSystem::FileExists(path))
+                return true;
+            return File::ReadAllBytes(path, data);
+        }
+
+        void Put(const StringAnsi& key, const Array<byte>& data) override
+        {
+            // Write to the temporary file and move it to prevent other processes from reading partial entry
+            const String path = GetPath(key);
+            const String directory = StringUtils::GetDirectoryName(path);
+            if (!FileSystem::DirectoryExists(directory) && FileSystem::CreateDirectory(directory))
+                return;
+            const String tmpPath = path + TEXT(".") + Guid::New().ToString(Guid::FormatType::N) + TEXT(".tmp");
+            if (File::WriteAllBytes(tmpPath, data))
+                return;
+            if (FileSystem::MoveFile(path, tmpPath, true))
+                FileSystem::DeleteFile(tmpPath);
+        }
+    };
+
+    // HTTP cache server storage (GET and PUT requests on '{url}/{key}')
+    class ShaderCacheBackendHttp : public ShaderCacheBackend
+    {
+    private:
+        StringAnsi _host;
+        StringAnsi _path;
+        NetworkEndPoint _endPoint;
+
+    public:
+        bool Init(const StringView& url)
+        {
+            // Parse 'http://host[:port][/path]'
+            StringView address(url.Get() + 7, url.Length() - 7);
+            String path;
+            const int32 pathStart = address.Find(TEXT('/'));
+            if (pathStart != -1)
+            {
+                path = String(address.Get() + pathStart, address.Length() - pathStart);
+                address = StringView(address.Get(), pathStart);
+            }
+            while (path.EndsWith(TEXT('/')))
+                path = path.Left(path.Length() - 1);
+            String host(address), port(TEXT("80"));
+            const int32 portStart = host.Find(TEXT(':'));
+            if (portStart != -1)
+            {
+                port = host.Substring(portStart + 1);
+                host = host.Left(portStart);
+            }
+            if (host.IsEmpty() || Network::CreateEndPoint(host, port, NetworkIPVersion::IPv4, _endPoint, false))
+            {
+                LOG(Error, "Failed to resolve shader cache server address {0}", url);
+                return true;
+            }
+            _host = StringAnsi(address);
+            _path = StringAnsi(path);
+            return false;
+        }
+
+        static bool Send(NetworkSocket& socket, const byte* data, int32 length, double timeout)
+        {
+            while (length > 0)
+            {
+                if (!Network::IsWritable(socket))
+                {
+                    if (Platform::GetTimeSeconds() > timeout)
+                        return true;
+                    Platform::Sleep(1);
+                    continue;
+                }
+                const int32 written = Network::WriteSocket(socket, (byte*)data, length);
+                if (written < 0)
+                    return true;
+                data += written;
+                length -= written;
+            }
+            return false;
+        }
+
+        static bool ParseResponse(const Array<byte>& response, int32& status, int32& contentStart, int32& contentLength)
+        {
+            // Find the end of the headers
+            const char* data = (const char*)response.Get();
+            contentStart = -1;
+            for (int32 i = 3; i < response.Count(); i++)
+            {
+                if (data[i - 3] == '\r' && data[i - 2] == '\n' && data[i - 1] == '\r' && data[i] == '\n')
+                {
+                    contentStart = i + 1;
+                    break;
+                }
+            }
+            if (contentStart == -1)
+                return true;
+            const StringAnsi headers(data, contentStart);
+
+            // Parse status line (eg. 'HTTP/1.1 200 OK')
+            const int32 statusStart = headers.Find(' ');
+            if (statusStart == -1 || StringUtils::Parse(headers.Get() + statusStart + 1, 3, &status))
+                return true;
+
+            // Parse content size (if specified, otherwise use everything until connection close)
+            contentLength = response.Count() - contentStart;
+            int32 lengthStart = headers.Find("content-length:", StringSearchCase::IgnoreCase);
+            if (lengthStart != -1)
+            {
+                lengthStart += 15;
+                while (headers[lengthStart] == ' ')
+                    lengthStart++;
+                int32 lengthEnd = lengthStart;
+                while (StringUtils::IsDigit(headers[lengthEnd]))
+                    lengthEnd++;
+                if (StringUtils::Parse(headers.Get() + lengthStart, lengthEnd - lengthStart, &contentLength))
+                    return true;
+            }
+            return false;
+        }
+
+        bool Request(const char* method, const StringAnsi& key, const Array<byte>* body, int32& status, Array<byte>* content)
+        {
+            NetworkSocket socket;
+            if (Network::CreateSocket(socket, NetworkProtocol::Tcp, NetworkIPVersion::IPv4))
+                return true;
+            const double timeout = Platform::GetTimeSeconds() + SHADER_CACHE_HTTP_TIMEOUT;
+            bool failed = Network::ConnectSocket(socket, _endPoint);
+
+            // Send request
+            if (!failed)
+            {
+                const StringAnsi header = StringAnsi::Format("{0} {1}/{2} HTTP/1.1\r\nHost: {3}\r\nConnection: close\r\nContent-Type: application/octet-stream\r\nContent-Length: {4}\r\n\r\n", method, _path, key, _host, body ? body->Count() : 0);
+                failed = Send(socket, (const byte*)header.Get(), header.Length(), timeout);
+                if (!failed && body)
+                    failed = Send(socket, body->Get(), body->Count(), timeout);
+            }
+
+            // Receive response
+            Array<byte> response;
+            int32 contentStart = -1, contentLength = 0;
+            while (!failed)
+            {
+                if (!Network::IsReadable(socket))
+                {
+                    failed = Platform::GetTimeSeconds() > timeout;
+                    Platform::Sleep(1);
+                    continue;
+                }
+                byte buffer[4096];
+                const int32 read = Network::ReadSocket(socket, buffer, sizeof(buffer));
+                if (read < 0)
+                    failed = true;
+                else if (read == 0)
+                    break;
+                response.Add(buffer, read);
+                if (!ParseResponse(response, status, contentStart, contentLength) && response.Count() >= contentStart + contentLength)
+                    break;
+            }
+            Network::DestroySocket(socket);
+            if (failed || ParseResponse(response, status, contentStart, contentLength) || response.Count() < contentStart + contentLength)
+                return true;
+            if (content)
+                content->Set(response.Get() + contentStart, contentLength);
+            return false;
+        }
+
+        bool Get(const StringAnsi& key, Array<byte>& data) override;
+        void Put(const StringAnsi& key, const Array<byte>& data) override;
+    };
+
+    CriticalSection Locker;
+    ShaderCacheBackend* LocalBackend = nullptr;
+    ShaderCacheBackend* RemoteBackend = nullptr;
+    int32 RemoteFailures = 0;
+    Dictionary<String, Pair<DateTime, uint32>> IncludesHashes;
+
+    void OnRemoteFailed(bool failed)
+    {
+        ScopeLock lock(Locker);
+        if (!failed)
+        {
+            RemoteFailures = 0;
+            return;
+        }
+        if (++RemoteFailures == SHADER_CACHE_REMOTE_MAX_FAILURES)
+            LOG(Warning, "Remote shader cache is not responding. Disabling it.");
+    }
+
+    void GetBackends(ShaderCacheBackend*& local, ShaderCacheBackend*& remote)
+    {
+        ScopeLock lock(Locker);
+        if (!LocalBackend)
+            LocalBackend = New<ShaderCacheBackendFolder>(Globals::ProjectCacheFolder / TEXT("Shaders/Shared"));
+        local = LocalBackend;
+        remote = RemoteBackend && RemoteFailures < SHADER_CACHE_REMOTE_MAX_FAILURES ? RemoteBackend : nullptr;
+    }
+
+    // Replaces the machine-specific folders with the tokens to share cache between machines
+    String TokenizePath(const String& path)
+    {
+        if (path.StartsWith(Globals::ProjectFolder))
+            return TEXT("$(ProjectFolder)") + path.Substring(Globals::ProjectFolder.Length());
+        if (path.StartsWith(Globals::StartupFolder))
+            return TEXT("$(EngineFolder)") + path.Substring(Globals::StartupFolder.Length());
+        return path;
+    }
+
+    String DetokenizePath(const String& path)
+    {
+        if (path.StartsWith(TEXT("$(ProjectFolder)")))
+            return Globals::ProjectFolder + path.Substring(16);
+        if (path.StartsWith(TEXT("$(EngineFolder)")))
+            return Globals::StartupFolder + path.Substring(15);
+        return path;
+    }
+
+    bool GetIncludeHash(const String& path, uint32& hash)
+    {
+        const DateTime lastEditTime = FileSystem::GetFileLastEditTime(path);
+        {
+            ScopeLock lock(Locker);
+            Pair<DateTime, uint32> entry;
+            if (IncludesHashes.TryGet(path, entry) && entry.First == lastEditTime)
+            {
+                hash = entry.Second;
+                return false;
+            }
+        }
+        Array<byte> data;
+        if (File::ReadAllBytes(path, data))
+            return true;
+        hash = Crc::MemCrc32C(data.Get(), data.Count());
+        ScopeLock lock(Locker);
+        IncludesHashes[path] = Pair<DateTime, uint32>(lastEditTime, hash);
+        return false;
+    }
+
+    // 64-bit hash chained over the added data with a CRC-32C checksum
+    struct KeyHasher
+    {
+        uint64 Hash = 0;
+        uint32 Crc = 0;
+
+        void Add(const void* data, int32 length)
+        {
+            Hash = Crc::MemHash64(data, length, Hash);
+            Crc = Crc::MemCrc32C(data, length, Crc);
+        }
+
+        template<typename T>
+        void Add(const T& value)
+        {
+            Add(&value, sizeof(T));
+        }
+
+        void Add(const char* str)
+        {
+            Add(str, str ? StringUtils::Length(str) + 1 : 0);
+        }
+    };
+}
+
+bool ShaderCacheBackendHttp::Get(const StringAnsi& key, Array<byte>& data)
+{
+    int32 status = 0;
+    const bool failed = Request("GET", key, nullptr, status, &data);
+    OnRemoteFailed(failed);
+    return failed || status != 200;
+}
+
+void ShaderCacheBackendHttp::Put(const StringAnsi& key, const Array<byte>& data)
+{
+    int32 status = 0;
+    const bool failed = Request("PUT", key, &data, status, nullptr);
+    OnRemoteFailed(failed);
+    if (!failed && (status < 200 || status >= 300))
+        LOG(Warning, "Failed to upload shader to the remote cache (status: {0})", status);
+}
+
+ShaderCacheBackend* ShaderCache::CreateBackend(const StringView& location)
+{
+    if (location.IsEmpty())
+        return nullptr;
+    if (location.StartsWith(StringView(TEXT("https://")), StringSearchCase::IgnoreCase))
+    {
+        LOG(Error, "HTTPS shader cache server is not supported. Use HTTP endpoint or the custom backend.");
+        return nullptr;
+    }
+    if (location.StartsWith(StringView(TEXT("http://")), StringSearchCase::IgnoreCase))
+    {
+        auto backend = New<ShaderCacheBackendHttp>();
+        if (backend->Init(location))
+        {
+            Delete(backend);
+            return nullptr;
+        }
+        return backend;
+    }
+    return New<ShaderCacheBackendFolder>(location);
+}
+
+void ShaderCache::SetRemoteBackend(ShaderCacheBackend* backend)
+{
+    ScopeLock lock(Locker);
+    if (RemoteBackend)
+        Delete(RemoteBackend);
+    RemoteBackend = backend;
+    RemoteFailures = 0;
+}
+
+bool ShaderCache::CanUse(const ShaderCompilationOptions& options)
+{
+#if GPU_USE_SHADERS_DEBUG_LAYER
+    // Debug layer exports the shaders disassembly during compilation
+    return false;
+#else
+    // Debug data contains the machine-specific paths and it's used only locally
+    return !options.GenerateDebugData && options.Output && options.Output->GetPosition() == 0;
+#endif
+}
+
+StringAnsi ShaderCache::GetKey(const ShaderCompilationOptions& options)
+{
+    KeyHasher hasher;
+    hasher.Add(GPU_SHADER_CACHE_VERSION);
+    hasher.Add(SHADER_CACHE_ENTRY_VERSION);
+    hasher.Add(FLAXENGINE_VERSION_BUILD);
+    hasher.Add(options.Profile);
+    hasher.Add(options.NoOptimize);
+    hasher.Add(options.TreatWarningsAsErrors);
+    for (const ShaderMacro& macro : options.Macros)
+    {
+        hasher.Add(macro.Name);
+        hasher.Add(macro.Definition);
+    }
+    hasher.Add(options.Source, (int32)options.SourceLength);
+    return StringAnsi::Format("{0:016x}{1:08x}", hasher.Hash, hasher.Crc);
+}
+
+bool ShaderCache::Load(const StringAnsi& key, const ShaderCompilationOptions& options)
+{
+    PROFILE_CPU();
+    ShaderCacheBackend *local, *remote;
+    GetBackends(local, remote);
+
+    // Try local cache first and fallback to the remote
+    Array<byte> entry;
+    bool fromRemote = false;
+    if (local->Get(key, entry))
+    {
+        if (!remote || remote->Get(key, entry))
+            return true;
+        fromRemote = true;
+    }
+
+    // Validate entry
+    MemoryReadStream stream(entry.Get(), entry.Count());
+    int32 version;
+    stream.ReadInt32(&version);
+    if (version != SHADER_CACHE_ENTRY_VERSION)
+        return true;
+
+    // Validate included files contents
+    int32 includesCount;
+    stream.ReadInt32(&includesCount);
+    Array<String> includes;
+    includes.Resize(includesCount);
+    for (int32 i = 0; i < includesCount; i++)
+    {
+        String& include = includes[i];
+        stream.ReadString(&include, 11);
+        include = DetokenizePath(include);
+        uint32 cachedHash, hash;
+        stream.ReadUint32(&cachedHash);
+        if (GetIncludeHash(include, hash) || hash != cachedHash)
+            return true;
+    }
+
+    // Copy the compiled shaders and constant buffers
+    int32 dataSize;
+    stream.ReadInt32(&dataSize);
+    if (dataSize <= 0 || stream.GetPosition() + dataSize > (uint32)entry.Count())
+        return true;
+    auto output = options.Output;
+    output->WriteBytes(stream.Move<byte>(dataSize), dataSize);
+
+    // [Output] Includes
+    output->WriteInt32(includesCount);
+    for (const String& include : includes)
+    {
+        output->WriteString(include, 11);
+        const auto date = FileSystem::GetFileLastEditTime(include);
+        output->Write(date);
+    }
+
+    if (fromRemote)
+        local->Put(key, entry);
+    return false;
+}
+
+void ShaderCache::Store(const StringAnsi& key, const ShaderCompilationOptions& options)
+{
+    PROFILE_CPU();
+    auto output = options.Output;
+    MemoryReadStream stream(output->GetHandle(), output->GetPosition());
+    int32 version, additionalDataStart, includesCount;
+    stream.ReadInt32(&version);
+    stream.ReadInt32(&additionalDataStart);
+    if (version != GPU_SHADER_CACHE_VERSION || additionalDataStart <= 0)
+        return;
+
+    // Serialize entry
+    MemoryWriteStream entryStream(additionalDataStart + 2048);
+    entryStream.WriteInt32(SHADER_CACHE_ENTRY_VERSION);
+    stream.SetPosition(additionalDataStart);
+    stream.ReadInt32(&includesCount);
+    entryStream.WriteInt32(includesCount);
+    for (int32 i = 0; i < includesCount; i++)
+    {
+        String include;
+        stream.ReadString(&include, 11);
+        DateTime lastEditTime;
+        stream.Read(lastEditTime);
+        uint32 hash;
+        if (GetIncludeHash(include, hash))
+            return;
+        entryStream.WriteString(TokenizePath(include), 11);
+        entryStream.WriteUint32(hash);
+    }
+    entryStream.WriteInt32(additionalDataStart);
+    entryStream.WriteBytes(output->GetHandle(), additionalDataStart);
+    Array<byte> entry;
+    entry.Set(entryStream.GetHandle(), entryStream.GetPosition());
+
+    ShaderCacheBackend *local, *remote;
+    GetBackends(local, remote);
+    local->Put(key, entry);
+    if (remote)
+        remote->Put(key, entry);
+}
+
+void ShaderCache::Dispose()
+{
+    ScopeLock lock(Locker);
+    SAFE_DELETE(LocalBackend);
+    SAFE_DELETE(RemoteBackend);
+    IncludesHashes.Clear();
+}
+
+#endif
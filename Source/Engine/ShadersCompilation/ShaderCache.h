@@ -0,0 +1,87 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if COMPILE_WITH_SHADER_COMPILER
+
+#include "Config.h"
+
+/// <summary>
+/// The storage backend of the shared shaders compilation cache. Entries are immutable blobs addressed by the hash of the compilation inputs so they can be safely shared between machines. Can be implemented to plug a custom storage (eg. cloud bucket).
+/// </summary>
+class FLAXENGINE_API ShaderCacheBackend
+{
+public:
+    virtual ~ShaderCacheBackend() = default;
+
+    /// <summary>
+    /// Gets the cached entry data.
+    /// </summary>
+    /// <param name="key">The entry key (hexadecimal hash string).</param>
+    /// <param name="data">The output entry data.</param>
+    /// <returns>True if entry is missing or failed to get it, otherwise false.</returns>
+    virtual bool Get(const StringAnsi& key, Array<byte>& data) = 0;
+
+    /// <summary>
+    /// Puts the entry data into the cache (overrides the existing entry).
+    /// </summary>
+    /// <param name="key">The entry key (hexadecimal hash string).</param>
+    /// <param name="data">The entry data.</param>
+    virtual void Put(const StringAnsi& key, const Array<byte>& data) = 0;
+};
+
+/// <summary>
+/// Content-addressed cache of the compiled shaders. Entries are keyed by the shader source, macros, profile and compiler options, and validated against the contents of the included files. Uses local cache folder and the optional remote backend (shared folder or HTTP cache server) to reuse shaders compiled on other machines.
+/// </summary>
+class FLAXENGINE_API ShaderCache
+{
+public:
+    /// <summary>
+    /// Creates the cache backend for the given location. Location that starts with 'http://' uses HTTP GET and PUT requests on '{location}/{key}' (compatible with the generic build cache servers), otherwise it's a directory path (eg. network share).
+    /// </summary>
+    /// <param name="location">The cache location.</param>
+    /// <returns>The created backend or null if location is invalid.</returns>
+    static ShaderCacheBackend* CreateBackend(const StringView& location);
+
+    /// <summary>
+    /// Sets the remote cache backend used to share the compiled shaders between machines. Takes the ownership of the object.
+    /// </summary>
+    /// <param name="backend">The backend or null to disable remote cache.</param>
+    static void SetRemoteBackend(ShaderCacheBackend* backend);
+
+    /// <summary>
+    /// Checks if the given compilation can use the cache.
+    /// </summary>
+    /// <param name="options">The compilation options.</param>
+    /// <returns>True if cache can be used, otherwise false.</returns>
+    static bool CanUse(const ShaderCompilationOptions& options);
+
+    /// <summary>
+    /// Calculates the cache key for the compilation.
+    /// </summary>
+    /// <param name="options">The compilation options.</param>
+    /// <returns>The key.</returns>
+    static StringAnsi GetKey(const ShaderCompilationOptions& options);
+
+    /// <summary>
+    /// Tries to load compiled shader from the cache into the compilation output.
+    /// </summary>
+    /// <param name="key">The cache key.</param>
+    /// <param name="options">The compilation options.</param>
+    /// <returns>True if cache entry is missing or outdated, otherwise false.</returns>
+    static bool Load(const StringAnsi& key, const ShaderCompilationOptions& options);
+
+    /// <summary>
+    /// Stores the compiled shader (from the compilation output) into the cache.
+    /// </summary>
+    /// <param name="key">The cache key.</param>
+    /// <param name="options">The compilation options.</param>
+    static void Store(const StringAnsi& key, const ShaderCompilationOptions& options);
+
+    /// <summary>
+    /// Releases the cache backends.
+    /// </summary>
+    static void Dispose();
+};
+
+#endif
@@ -5,11 +5,14 @@
 #include "ShadersCompilation.h"
 #include "ShaderCompilationContext.h"
 #include "ShaderDebugDataExporter.h"
+#include "ShaderCache.h"
 #include "Config.h"
 #include "Parser/ShaderProcessing.h"
 #include "Parser/ShaderMeta.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/CommandLine.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Types/TimeSpan.h"
@@ -18,6 +21,8 @@
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Platform/FileSystem.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Assets/Shader.h"
@@ -53,6 +58,17 @@ namespace ShadersCompilationImpl
     CriticalSection Locker;
     Array<ShaderCompiler*> Compilers;
     Array<ShaderCompiler*> ReadyCompilers;
+
+    // Minimal amount of the shader permutations compiled by a single job when compiling shader functions in parallel
+    constexpr int32 MinPermutationsPerJob = 4;
+
+    struct CompilationPart
+    {
+        ShaderMeta Meta;
+        ShaderCompilationOptions Options;
+        MemoryWriteStream Output;
+        bool Failed = false;
+    };
 }
 
 using namespace ShadersCompilationImpl;
@@ -102,6 +118,20 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
         options.SourceLength--;
 
     const DateTime startTime = DateTime::NowUTC();
+
+    // Try to reuse the shader compiled before (on this or the other machine)
+    const bool useCache = ShaderCache::CanUse(options);
+    StringAnsi cacheKey;
+    if (useCache)
+    {
+        cacheKey = ShaderCache::GetKey(options);
+        if (!ShaderCache::Load(cacheKey, options))
+        {
+            LOG(Info, "Shader compilation '{0}' loaded from cache (profile: {1})", options.TargetName, ::ToString(options.Profile));
+            return false;
+        }
+    }
+
     const FeatureLevel featureLevel = RenderTools::GetFeatureLevel(options.Profile);
 
     // Process shader source to collect metadata
@@ -119,6 +149,12 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
 
     // Perform actual compilation
     bool result;
+    const int32 jobsCount = GetCompilationJobsCount(meta);
+    if (jobsCount > 1)
+    {
+        result = CompileParallel(options, meta, jobsCount);
+    }
+    else
     {
         ShaderCompilationContext context(&options, &meta);
 
@@ -146,6 +182,8 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
     // Print info if succeed
     if (result == false)
     {
+        if (useCache)
+            ShaderCache::Store(cacheKey, options);
         const DateTime endTime = DateTime::NowUTC();
         LOG(Info, "Shader compilation '{0}' succeed in {1} ms (profile: {2})", options.TargetName, Math::CeilToInt(static_cast<float>((endTime - startTime).GetTotalMilliseconds())), ::ToString(options.Profile));
     }
@@ -153,6 +191,166 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
     return result;
 }
 
+int32 ShadersCompilation::GetCompilationJobsCount(const ShaderMeta& meta)
+{
+#if GPU_USE_SHADERS_DEBUG_LAYER
+    // Debug layer exports the shader debug data from a single compilation context
+    return 1;
+#else
+    int32 permutationsCount = 0;
+    Array<const ShaderFunctionMeta*> functions;
+    meta.GetShaders(functions);
+    for (const ShaderFunctionMeta* function : functions)
+        permutationsCount += function->Permutations.Count();
+    return Math::Clamp(Math::Min(permutationsCount / MinPermutationsPerJob, functions.Count()), 1, JobSystem::GetThreadsCount());
+#endif
+}
+
+bool ShadersCompilation::CompileParallel(ShaderCompilationOptions& options, ShaderMeta& meta, int32 jobsCount)
+{
+    PROFILE_CPU();
+
+    // Split shader functions into the parts with a similar amount of permutations (keep the order of functions)
+    Array<const ShaderFunctionMeta*> functions;
+    meta.GetShaders(functions);
+    int32 permutationsCount = 0;
+    for (const ShaderFunctionMeta* function : functions)
+        permutationsCount += function->Permutations.Count();
+    Array<int32> functionPart;
+    functionPart.Resize(functions.Count());
+    for (int32 i = 0, part = 0, permutations = 0; i < functions.Count(); i++)
+    {
+        functionPart[i] = part;
+        permutations += functions[i]->Permutations.Count();
+        if (permutations * jobsCount >= permutationsCount * (part + 1) && part + 1 < jobsCount)
+            part++;
+    }
+    Array<CompilationPart*> parts;
+    parts.Resize(functionPart.Last() + 1);
+    for (auto& part : parts)
+        part = New<CompilationPart>();
+    int32 functionIndex = 0;
+#define COPY_SHADERS(collection) for (auto& e : meta.collection) parts[functionPart[functionIndex++]]->Meta.collection.Add(e)
+    COPY_SHADERS(VS);
+    COPY_SHADERS(HS);
+    COPY_SHADERS(DS);
+    COPY_SHADERS(GS);
+    COPY_SHADERS(PS);
+    COPY_SHADERS(CS);
+#undef COPY_SHADERS
+    for (CompilationPart* part : parts)
+    {
+        part->Meta.CB = meta.CB;
+        part->Options = options;
+        part->Options.Output = &part->Output;
+    }
+
+    // Compile parts using separate compilers from the pool
+    const int64 label = JobSystem::Dispatch([&parts](int32 i)
+    {
+        CompilationPart& part = *parts[i];
+        ShaderCompilationContext context(&part.Options, &part.Meta);
+        auto compiler = RequestCompiler(part.Options.Profile);
+        if (compiler == nullptr)
+        {
+            LOG(Error, "Shader compiler request failed.");
+            part.Failed = true;
+            return;
+        }
+        part.Failed = compiler->Compile(&context);
+        FreeCompiler(compiler);
+    }, parts.Count());
+    JobSystem::Wait(label);
+    for (const CompilationPart* part : parts)
+    {
+        if (part->Failed)
+        {
+            parts.ClearDelete();
+            return true;
+        }
+    }
+
+    // [Output] Version number
+    auto output = options.Output;
+    output->WriteInt32(GPU_SHADER_CACHE_VERSION);
+
+    // [Output] Additional data start
+    const int32 additionalDataStartPos = output->GetPosition();
+    output->WriteInt32(-1);
+
+    // [Output] Amount of shaders
+    output->WriteInt32(meta.GetShadersCount());
+
+    // Merge compiled shaders from all parts
+    const int32 cbsCount = meta.CB.Count();
+    const int32 cbsDataSize = 2 + cbsCount * (sizeof(byte) + sizeof(uint32));
+    Array<uint32> cbsSizes;
+    cbsSizes.Resize(cbsCount);
+    Platform::MemoryClear(cbsSizes.Get(), cbsSizes.Count() * sizeof(uint32));
+    HashSet<String> includes;
+    for (CompilationPart* part : parts)
+    {
+        MemoryReadStream stream(part->Output.GetHandle(), part->Output.GetPosition());
+        int32 version, partAdditionalDataStart;
+        stream.ReadInt32(&version);
+        stream.ReadInt32(&partAdditionalDataStart);
+        const int32 functionsStart = sizeof(int32) * 3;
+        const int32 functionsEnd = partAdditionalDataStart - cbsDataSize;
+        output->WriteBytes(part->Output.GetHandle() + functionsStart, functionsEnd - functionsStart);
+
+        // Constant buffers size is known only by the parts that use them
+        stream.SetPosition(functionsEnd + 2);
+        for (int32 i = 0; i < cbsCount; i++)
+        {
+            byte slot;
+            uint32 size;
+            stream.ReadByte(&slot);
+            stream.ReadUint32(&size);
+            cbsSizes[i] = Math::Max(cbsSizes[i], size);
+        }
+
+        int32 includesCount;
+        stream.ReadInt32(&includesCount);
+        for (int32 i = 0; i < includesCount; i++)
+        {
+            String include;
+            stream.ReadString(&include, 11);
+            DateTime lastEditTime;
+            stream.Read(lastEditTime);
+            includes.Add(include);
+        }
+    }
+    parts.ClearDelete();
+
+    // [Output] Constant Buffers
+    {
+        byte maxCbSlot = 0;
+        for (int32 i = 0; i < cbsCount; i++)
+            maxCbSlot = Math::Max(maxCbSlot, meta.CB[i].Slot);
+        output->WriteByte(static_cast<byte>(cbsCount));
+        output->WriteByte(maxCbSlot);
+        for (int32 i = 0; i < cbsCount; i++)
+        {
+            output->WriteByte(meta.CB[i].Slot);
+            output->WriteUint32(cbsSizes[i]);
+        }
+    }
+
+    // Additional Data Start
+    *(int32*)(output->GetHandle() + additionalDataStartPos) = output->GetPosition();
+
+    // [Output] Includes
+    output->WriteInt32(includes.Count());
+    for (auto& include : includes)
+    {
+        output->WriteString(include.Item, 11);
+        const auto date = FileSystem::GetFileLastEditTime(include.Item);
+        output->Write(date);
+    }
+
+    return false;
+}
+
 ShaderCompiler* ShadersCompilation::CreateCompiler(ShaderProfile profile)
 {
     ShaderCompiler* result = nullptr;
@@ -441,6 +639,10 @@ bool ShadersCompilationService::Init()
     // Initialize automatic shaders importing and reloading for all loaded projects (game, engine, plugins)
     HashSet<const ProjectInfo*> projects;
     RegisterShaderWatchers(Editor::Project, projects);
+
+    // Setup shared shaders cache
+    if (CommandLine::Options.ShaderCache.HasValue())
+        ShaderCache::SetRemoteBackend(ShaderCache::CreateBackend(CommandLine::Options.ShaderCache.GetValue()));
 #endif
 
     return false;
@@ -468,6 +670,7 @@ void ShadersCompilationService::Dispose()
 
     // Cleanup shader includes
     ShaderCompiler::DisposeIncludedFilesCache();
+    ShaderCache::Dispose();
 
     // Clear includes scanning
     ShaderIncludesMapLocker.Lock();
@@ -7,6 +7,7 @@
 #include "ShaderCompiler.h"
 
 class Asset;
+class ShaderMeta;
 
 /// <summary>
 /// Shaders compilation service allows to compile shader source code for a desire platform. Supports multi-threading.
@@ -45,6 +46,8 @@ class FLAXENGINE_API ShadersCompilation
 
 private:
 
+    static int32 GetCompilationJobsCount(const ShaderMeta& meta);
+    static bool CompileParallel(ShaderCompilationOptions& options, ShaderMeta& meta, int32 jobsCount);
     static ShaderCompiler* CreateCompiler(ShaderProfile profile);
     static ShaderCompiler* RequestCompiler(ShaderProfile profile);
     static void FreeCompiler(ShaderCompiler* compiler);
@@ -28,6 +28,18 @@ bool ShadowsOfMordor::Builder::LightmapBuildCache::Init(const LightmapSettings*
     return false;
 }
 
+bool ShadowsOfMordor::Builder::LightmapBuildCache::IsTexelDirty(const Float2& uv) const
+{
+    if (!Incremental)
+        return true;
+    for (const Rectangle& area : DirtyAreas)
+    {
+        if (area.Contains(uv))
+            return true;
+    }
+    return false;
+}
+
 ShadowsOfMordor::Builder::SceneBuildCache::SceneBuildCache()
     : Scene(nullptr)
     , TempLightmapData(nullptr)
@@ -96,6 +108,8 @@ void ShadowsOfMordor::Builder::SceneBuildCache::UpdateLightmaps()
     {
         // Cache data
         auto& lightmapEntry = Lightmaps[lightmapIndex];
+        if (!lightmapEntry.IsDirty())
+            continue; // Skip lightmaps not changed by the incremental bake
         auto lightmap = Scene->LightmapsData.GetLightmap(lightmapIndex);
         ASSERT(lightmap);
         lightmap->GetTextures(lightmaps);
@@ -13,8 +13,12 @@
 
 bool ShadowsOfMordor::Builder::sortCharts(const LightmapUVsChart& a, const LightmapUVsChart& b)
 {
-    // Sort by area
-    return (b.Width * b.Height) < (a.Width * a.Height);
+    // Sort by area (keep the entries order for charts of the same size to get the same layout between the bakes)
+    const int32 areaA = a.Width * a.Height;
+    const int32 areaB = b.Width * b.Height;
+    if (areaA != areaB)
+        return areaB < areaA;
+    return a.EntryIndex < b.EntryIndex;
 }
 
 void ShadowsOfMordor::Builder::generateCharts()
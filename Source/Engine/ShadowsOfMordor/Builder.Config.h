@@ -49,6 +49,11 @@ namespace ShadowsOfMordor
 #define CACHE_ENTRIES_PER_JOB 10
 #define CACHE_POSITIONS_FORMAT HEMISPHERES_FORMAT_R32G32B32A32
 #define CACHE_NORMALS_FORMAT HEMISPHERES_FORMAT_R16G16B16A16
+#define PATH_TRACING_SAMPLES_PER_JOB 16
+#define PATH_TRACING_TEXELS_PER_BATCH (64 * 1024)
+#define PATH_TRACING_BATCH_CELL_SIZE 2000.0f
+#define PATH_TRACING_RAY_MAX_DISTANCE 20000.0f
+#define INCREMENTAL_BAKE_INFLUENCE_MARGIN 1000.0f
 
 // Debugging tools settings
 // Note: debug images will be exported to the temporary folder ('<project-root>\Cache\ShadowsOfMordor_Debug')
@@ -59,3 +64,4 @@ namespace ShadowsOfMordor
 // Constants
 #define HEMISPHERES_RESOLUTION 64
 #define NUM_SH_TARGETS 3
+#define PATH_TRACING_GROUP_SIZE 64
@@ -6,6 +6,7 @@
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Level/Actors/BoxBrush.h"
 #include "Engine/Level/SceneQuery.h"
+#include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/Renderer.h"
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Engine/Globals.h"
@@ -158,6 +159,9 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         _hemisphereTexelsTotalWeight = (4.0f * PI) / weightSum;
     }
 
+    _pathTracingFailed = false;
+    _pathTracingSampleIndex = 0;
+
     // Initialize the lightmaps and pack entries to the charts
     for (_workerActiveSceneIndex = 0; _workerActiveSceneIndex < _scenes.Count(); _workerActiveSceneIndex++)
     {
@@ -165,6 +169,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
         RUN_STEP(generateCharts);
         RUN_STEP(packCharts);
         RUN_STEP(updateLightmaps);
+        RUN_STEP(checkIncrementalBake);
         RUN_STEP(updateEntries);
     }
 
@@ -216,14 +221,18 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
     int32 bounceCount = 0;
     int32 lightmapsCount = 0;
     int32 entriesCount = 0;
+    bool isAnyLightmapDirty = false;
     for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
     {
         auto& scene = *_scenes[sceneIndex];
+        for (auto& lightmap : scene.Lightmaps)
+            isAnyLightmapDirty |= lightmap.IsDirty();
         hemispheresCount += scene.HemispheresCount;
         mergedHemispheresCount += scene.MergedHemispheresCount;
         lightmapsCount += scene.Lightmaps.Count();
         entriesCount += scene.Entries.Count();
-        bounceCount = Math::Max(bounceCount, scene.GetSettings().BounceCount);
+        const auto& settings = scene.GetSettings();
+        bounceCount = Math::Max(bounceCount, settings.BakeMode == LightmapSettings::BakeModes::PathTracing ? 1 : settings.BounceCount);
 
         // Cleanup unused data to reduce memory usage
         scene.Entries.Resize(0);
@@ -233,6 +242,12 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
     }
     _bounceCount = bounceCount;
     LOG(Info, "Rendering {0} hemispheres in {1} bounce(s) (merged: {2})", hemispheresCount, bounceCount, mergedHemispheresCount);
+    if (hemispheresCount <= 0 && lightmapsCount > 0 && !isAnyLightmapDirty)
+    {
+        LOG(Info, "Lightmaps are up to date with the last incremental bake");
+        reportProgress(BuildProgressStep::RenderHemispheres, 1.0f);
+        return false;
+    }
     if (bounceCount <= 0 || hemispheresCount <= 0)
     {
         LOG(Warning, "No data to render");
@@ -267,15 +282,35 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
             if (_scenes[_workerActiveSceneIndex]->Lightmaps.IsEmpty())
                 continue;
 
+            // Path tracing computes all bounces at once
+            const bool pathTracing = _scenes[_workerActiveSceneIndex]->GetSettings().BakeMode == LightmapSettings::BakeModes::PathTracing;
+            if (pathTracing && bounce != 0)
+                continue;
+
             // Clear hemispheres target
             _workerStagePosition0 = 0;
             if (runStage(ClearLightmapData))
                 return true;
 
-            // Render all registered Hemispheres rendering
+            // Render all registered Hemispheres rendering (or trace paths for all texels)
             _workerStagePosition0 = 0;
-            if (runStage(RenderHemispheres))
+            _pathTracingSampleIndex = 0;
+            if (runStage(pathTracing ? RenderPathTracing : RenderHemispheres))
+                return true;
+            if (_pathTracingFailed)
+            {
+                _wasBuildCalled = false;
+                _isActive = false;
                 return true;
+            }
+
+            // Keep the lightmaps data of the last bounce for the incremental bake
+            if (pathTracing || bounce == _bounceCount - 1)
+            {
+                if (waitForJobDataSync())
+                    return true;
+                storeBakeHistory();
+            }
 
             // Fill black holes with blurred data to prevent artifacts on the edges
             _workerStagePosition0 = 0;
@@ -293,6 +328,16 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
 
     reportProgress(BuildProgressStep::RenderHemispheres, 1.0f);
 
+    // Remember the baked scenes state for the incremental bake
+    for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
+    {
+        auto& scene = *_scenes[sceneIndex];
+        if (scene.State.LightmapsData.HasItems())
+            _history[scene.Scene->GetID()] = MoveTemp(scene.State);
+        else
+            _history.Remove(scene.Scene->GetID());
+    }
+
 #if DEBUG_EXPORT_HEMISPHERES_PREVIEW
     for (int32 sceneIndex = 0; sceneIndex < _scenes.Count(); sceneIndex++)
         downloadDebugHemisphereAtlases(_scenes[sceneIndex]);
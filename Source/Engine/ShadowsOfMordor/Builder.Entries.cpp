@@ -193,7 +193,10 @@ void ShadowsOfMordor::Builder::updateEntries()
             {
                 auto foliage = e.AsFoliage.Actor;
                 if (foliage)
+                {
                     foliage->Instances[e.AsFoliage.InstanceIndex].Lightmap = emptyEntry;
+                    foliage->InvalidateResidentInstances();
+                }
             }
             break;
             }
@@ -244,6 +247,7 @@ void ShadowsOfMordor::Builder::updateEntries()
             {
                 // Update data
                 foliage->Instances[e.AsFoliage.InstanceIndex].Lightmap = chart.Result;
+                foliage->InvalidateResidentInstances();
             }
             else
             {
@@ -66,6 +66,13 @@ void ShadowsOfMordor::Builder::generateHemispheres()
     float normalSimilarityMin = Math::Lerp(0.8f, 0.95f, normalizedQuality);
     int32 maxTexelsDistance = static_cast<int32>(Math::Lerp(2.0f, 1.0f, normalizedQuality));
     int32 atlasSize = static_cast<int32>(settings.AtlasSize);
+    float atlasSizeInv = 1.0f / (float)atlasSize;
+    const bool pathTracing = settings.BakeMode == LightmapSettings::BakeModes::PathTracing;
+    if (pathTracing)
+    {
+        // Path tracing is cheap per texel so don't merge them to keep the lightmap details
+        maxTexelsDistance = 0;
+    }
 
     // Process every lightmap
     for (_workerStagePosition0 = 0; _workerStagePosition0 < lightmapsCount; _workerStagePosition0++)
@@ -73,6 +80,8 @@ void ShadowsOfMordor::Builder::generateHemispheres()
         // Prepare
         auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
         lightmapEntry.Hemispheres.Clear();
+        if (!lightmapEntry.IsDirty())
+            continue;
         lightmapEntry.Hemispheres.EnsureCapacity(Math::Square(atlasSize / 2));
         Float3 position, normal;
 
@@ -115,9 +124,11 @@ void ShadowsOfMordor::Builder::generateHemispheres()
                 // Sample cache for current texel
                 SampleCache(cacheData, texelX, texelY, position, normal);
 
-                // Reject 'empty' texels
+                // Reject 'empty' texels and texels not changed by the incremental bake
                 if (normal.IsZero())
                     continue;
+                if (!lightmapEntry.IsTexelDirty(Float2(((float)texelX + 0.5f) * atlasSizeInv, ((float)texelY + 0.5f) * atlasSizeInv)))
+                    continue;
                 normal.Normalize();
 
                 // Try to merge similar hemispheres (threshold values are controlled by the quality slider)
@@ -177,6 +188,9 @@ void ShadowsOfMordor::Builder::generateHemispheres()
             return;
     }
 
+    if (pathTracing)
+        generatePathTracingBatches();
+
     // Update stats
     scene->HemispheresCount = hemispheresCount;
     scene->MergedHemispheresCount = mergedHemispheresCount;
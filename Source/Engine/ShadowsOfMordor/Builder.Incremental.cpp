@@ -0,0 +1,261 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Builder.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Scene/Lightmap.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Level/Actors/DirectionalLight.h"
+#include "Engine/Level/Actors/SkyLight.h"
+#include "Engine/Level/Actors/Sky.h"
+#include "Engine/Level/Actors/Skybox.h"
+#include "Engine/Terrain/Terrain.h"
+#include "Engine/Terrain/TerrainPatch.h"
+#include "Engine/Foliage/Foliage.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Utilities/Crc.h"
+
+namespace
+{
+    typedef ShadowsOfMordor::Builder::BakeHistory BakeHistory;
+    typedef ShadowsOfMordor::Builder::GeometryEntry GeometryEntry;
+    typedef ShadowsOfMordor::Builder::GeometryType GeometryType;
+
+    uint32 GetAssetHash(const Asset* asset)
+    {
+        return asset ? GetHash(asset->GetID()) : 0;
+    }
+
+    uint32 GetSettingsHash(const LightmapSettings& settings)
+    {
+        LightmapSettings copy = settings;
+        rapidjson_flax::StringBuffer buffer;
+        CompactJsonWriter writer(buffer);
+        writer.StartObject();
+        copy.Serialize(writer, nullptr);
+        writer.EndObject();
+        return Crc::MemCrc32(buffer.GetString(), (int32)buffer.GetSize());
+    }
+
+    // Gets the entry identifier that is stable between the bakes.
+    uint32 GetEntryKey(const GeometryEntry& entry)
+    {
+        uint32 key = 0;
+        switch (entry.Type)
+        {
+        case GeometryType::StaticModel:
+            key = GetHash(entry.AsStaticModel.Actor->GetID());
+            break;
+        case GeometryType::Terrain:
+            key = GetHash(entry.AsTerrain.Actor->GetID());
+            CombineHash(key, (uint32)entry.AsTerrain.PatchIndex);
+            CombineHash(key, (uint32)entry.AsTerrain.ChunkIndex);
+            break;
+        case GeometryType::Foliage:
+            key = GetHash(entry.AsFoliage.Actor->GetID());
+            CombineHash(key, (uint32)entry.AsFoliage.InstanceIndex);
+            CombineHash(key, (uint32)entry.AsFoliage.MeshIndex);
+            break;
+        }
+        return key;
+    }
+
+    // Gets the entry state hash (changes when entry geometry or appearance gets modified).
+    uint32 GetEntryHash(const GeometryEntry& entry)
+    {
+        uint32 hash = Crc::MemCrc32(&entry.Box, sizeof(entry.Box));
+        hash = Crc::MemCrc32(&entry.Scale, sizeof(entry.Scale), hash);
+        switch (entry.Type)
+        {
+        case GeometryType::StaticModel:
+        {
+            const auto staticModel = entry.AsStaticModel.Actor;
+            const Transform transform = staticModel->GetTransform();
+            hash = Crc::MemCrc32(&transform, sizeof(transform), hash);
+            CombineHash(hash, GetAssetHash(staticModel->Model.Get()));
+            for (const auto& slot : staticModel->Entries)
+            {
+                CombineHash(hash, GetAssetHash(slot.Material.Get()));
+                CombineHash(hash, slot.Visible ? 1 : 0);
+            }
+            break;
+        }
+        case GeometryType::Terrain:
+        {
+            const auto terrain = entry.AsTerrain.Actor;
+            const auto& chunk = terrain->GetPatch(entry.AsTerrain.PatchIndex)->Chunks[entry.AsTerrain.ChunkIndex];
+            CombineHash(hash, GetAssetHash(terrain->Material.Get()));
+            CombineHash(hash, GetAssetHash(chunk.OverrideMaterial.Get()));
+            break;
+        }
+        case GeometryType::Foliage:
+        {
+            const auto foliage = entry.AsFoliage.Actor;
+            const auto& instance = foliage->Instances[entry.AsFoliage.InstanceIndex];
+            const auto& type = foliage->FoliageTypes[entry.AsFoliage.TypeIndex];
+            const Transform transform = foliage->GetTransform().LocalToWorld(instance.Transform);
+            hash = Crc::MemCrc32(&transform, sizeof(transform), hash);
+            CombineHash(hash, GetAssetHash(type.Model.Get()));
+            CombineHash(hash, GetAssetHash(type.Entries[0].Material.Get()));
+            break;
+        }
+        }
+        return hash;
+    }
+
+    bool cacheLightsTree(Actor* actor, BakeHistory* state)
+    {
+        if (!actor->GetIsActive())
+            return false;
+        const bool isSky = dynamic_cast<Sky*>(actor) || dynamic_cast<Skybox*>(actor);
+        if (dynamic_cast<Light*>(actor) || isSky)
+        {
+            rapidjson_flax::StringBuffer buffer;
+            CompactJsonWriter writer(buffer);
+            writer.SceneObject(actor);
+            BakeHistory::ObjectState& light = state->Lights[actor->GetID()];
+            light.Hash = Crc::MemCrc32(buffer.GetString(), (int32)buffer.GetSize());
+
+            // Sun and sky lights affect the whole scene
+            if (isSky || dynamic_cast<DirectionalLight*>(actor) || dynamic_cast<SkyLight*>(actor))
+                light.Box = BoundingBox(Vector3::Minimum, Vector3::Maximum);
+            else
+                light.Box = actor->GetBox();
+        }
+        return true;
+    }
+
+    template<typename KeyType>
+    void CollectChanges(const Dictionary<KeyType, BakeHistory::ObjectState>& current, const Dictionary<KeyType, BakeHistory::ObjectState>& previous, Array<BoundingBox>& dirtyBoxes)
+    {
+        for (const auto& e : current)
+        {
+            const BakeHistory::ObjectState* prev = previous.TryGet(e.Key);
+            if (prev == nullptr)
+            {
+                // Added
+                dirtyBoxes.Add(e.Value.Box);
+            }
+            else if (prev->Hash != e.Value.Hash)
+            {
+                // Modified (both old and new location is affected)
+                dirtyBoxes.Add(e.Value.Box);
+                dirtyBoxes.Add(prev->Box);
+            }
+        }
+        for (const auto& e : previous)
+        {
+            // Removed
+            if (!current.ContainsKey(e.Key))
+                dirtyBoxes.Add(e.Value.Box);
+        }
+    }
+}
+
+void ShadowsOfMordor::Builder::checkIncrementalBake()
+{
+    auto scene = _scenes[_workerActiveSceneIndex];
+    auto& settings = scene->GetSettings();
+    auto& state = scene->State;
+    ScopeLock lock(scene->EntriesLocker);
+
+    // Capture the current scene state
+    state.SettingsHash = GetSettingsHash(settings);
+    state.LayoutHash = 0;
+    state.Entries.Clear();
+    state.Lights.Clear();
+    state.LightmapsData.Clear();
+    for (const GeometryEntry& entry : scene->Entries)
+    {
+        BakeHistory::ObjectState& e = state.Entries[GetEntryKey(entry)];
+        e.Hash = GetEntryHash(entry);
+        e.Box = entry.Box;
+    }
+    for (const LightmapUVsChart& chart : scene->Charts)
+    {
+        CombineHash(state.LayoutHash, GetEntryKey(scene->Entries[chart.EntryIndex]));
+        CombineHash(state.LayoutHash, Crc::MemCrc32(&chart.Result, sizeof(chart.Result)));
+    }
+    Function<bool(Actor*, BakeHistory*)> cacheLights = &cacheLightsTree;
+    scene->Scene->TreeExecute(cacheLights, &state);
+
+    // Check if the last bake can be reused
+    if (!settings.IncrementalBake)
+        return;
+    const BakeHistory* history = _history.TryGet(scene->Scene->GetID());
+    if (history == nullptr)
+        return;
+    if (history->SettingsHash != state.SettingsHash || history->LayoutHash != state.LayoutHash || history->LightmapsData.Count() != scene->Lightmaps.Count())
+    {
+        LOG(Info, "Lightmaps settings or layout has been modified since the last bake. Performing the full bake.");
+        return;
+    }
+    for (int32 lightmapIndex = 0; lightmapIndex < scene->Lightmaps.Count(); lightmapIndex++)
+    {
+        if (history->LightmapsData[lightmapIndex].Count() != (int32)scene->Lightmaps[lightmapIndex].LightmapData->GetSize())
+            return;
+    }
+
+    // Find the modified areas
+    Array<BoundingBox> dirtyBoxes;
+    CollectChanges(state.Entries, history->Entries, dirtyBoxes);
+    CollectChanges(state.Lights, history->Lights, dirtyBoxes);
+    for (BoundingBox& box : dirtyBoxes)
+    {
+        // Include the nearby objects that receive the bounced lighting or shadows
+        box.Minimum -= Vector3(INCREMENTAL_BAKE_INFLUENCE_MARGIN);
+        box.Maximum += Vector3(INCREMENTAL_BAKE_INFLUENCE_MARGIN);
+    }
+
+    // Mark the affected charts to rebake and restore the rest from the last bake
+    for (int32 lightmapIndex = 0; lightmapIndex < scene->Lightmaps.Count(); lightmapIndex++)
+    {
+        auto& lightmapEntry = scene->Lightmaps[lightmapIndex];
+        lightmapEntry.Incremental = true;
+        lightmapEntry.DirtyAreas.Clear();
+        lightmapEntry.LightmapDataHistory = history->LightmapsData[lightmapIndex];
+    }
+    const float chartPadding = (float)settings.ChartsPadding / (float)(int32)settings.AtlasSize;
+    int32 dirtyChartsCount = 0;
+    for (const LightmapUVsChart& chart : scene->Charts)
+    {
+        if (chart.Result.TextureIndex == INVALID_INDEX)
+            continue;
+        const BoundingBox& box = scene->Entries[chart.EntryIndex].Box;
+        for (const BoundingBox& dirtyBox : dirtyBoxes)
+        {
+            if (dirtyBox.Intersects(box))
+            {
+                scene->Lightmaps[chart.Result.TextureIndex].DirtyAreas.Add(chart.Result.UVsArea.MakeExpanded(chartPadding * 2.0f));
+                dirtyChartsCount++;
+                break;
+            }
+        }
+    }
+    LOG(Info, "Incremental lightmaps bake: {0} modified object(s), {1} of {2} chart(s) to rebake", dirtyBoxes.Count(), dirtyChartsCount, scene->Charts.Count());
+}
+
+void ShadowsOfMordor::Builder::storeBakeHistory()
+{
+    auto scene = _scenes[_workerActiveSceneIndex];
+    auto& state = scene->State;
+    state.LightmapsData.Clear();
+    if (!scene->GetSettings().IncrementalBake)
+        return;
+
+    // Download the lightmaps data (before post-processing) to restore it in the next incremental bake
+    state.LightmapsData.Resize(scene->Lightmaps.Count());
+    BytesContainer data;
+    for (int32 lightmapIndex = 0; lightmapIndex < scene->Lightmaps.Count(); lightmapIndex++)
+    {
+        if (scene->Lightmaps[lightmapIndex].LightmapData->DownloadData(data))
+        {
+            LOG(Warning, "Failed to download lightmap data for the incremental bake.");
+            state.LightmapsData.Clear();
+            return;
+        }
+        state.LightmapsData[lightmapIndex].Set(data.Get(), data.Length());
+    }
+}
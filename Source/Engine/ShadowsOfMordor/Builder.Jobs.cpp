@@ -64,6 +64,8 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
 
         for (; _workerStagePosition0 < scene->Lightmaps.Count(); _workerStagePosition0++)
         {
+            if (!scene->Lightmaps[_workerStagePosition0].IsDirty())
+                continue; // Keep lightmaps not changed by the incremental bake
             auto lightmap = scene->Scene->LightmapsData.GetLightmap(_workerStagePosition0);
             GPUTexture* textures[NUM_SH_TARGETS];
             lightmap->GetTextures(textures);
@@ -276,10 +278,20 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         // Later we use blur shader to interpolate empty texels (so empty texels should be pure black)
 
         ASSERT(scene->Lightmaps.Count() > _workerStagePosition0);
-        auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
-
-        // All black everything!
-        context->ClearUA(lightmapEntry.LightmapData, Float4::Zero);
+        for (; _workerStagePosition0 < scene->Lightmaps.Count(); _workerStagePosition0++)
+        {
+            auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+            if (lightmapEntry.LightmapDataHistory.HasItems())
+            {
+                // Restore the last bake data for the incremental bake (only dirty texels will be rendered)
+                context->UpdateBuffer(lightmapEntry.LightmapData, lightmapEntry.LightmapDataHistory.Get(), lightmapEntry.LightmapDataHistory.Count());
+            }
+            else
+            {
+                // All black everything!
+                context->ClearUA(lightmapEntry.LightmapData, Float4::Zero);
+            }
+        }
 
         _wasStageDone = true;
         break;
@@ -428,7 +440,7 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
 #endif
 
         // Report progress
-        float hemispheresProgress = static_cast<float>(_workerStagePosition1) / Math::Max(lightmapEntry.Hemispheres.Count(), 1);
+        float hemispheresProgress = lightmapEntry.Hemispheres.HasItems() ? static_cast<float>(_workerStagePosition1) / lightmapEntry.Hemispheres.Count() : 1.0f;
         float lightmapsProgress = static_cast<float>(_workerStagePosition0 + hemispheresProgress) / scene->Lightmaps.Count();
         float bouncesProgress = static_cast<float>(_giBounceRunningIndex) / _bounceCount;
         reportProgress(BuildProgressStep::RenderHemispheres, lightmapsProgress / _bounceCount + bouncesProgress);
@@ -448,6 +460,11 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         }
         break;
     }
+    case RenderPathTracing:
+    {
+        renderPathTracing(context);
+        break;
+    }
     case PostprocessLightmaps:
     {
         PROFILE_GPU_CPU_NAMED("PostprocessLightmaps");
@@ -456,6 +473,14 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
 
         // Prepare
         auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+        if (!lightmapEntry.IsDirty())
+        {
+            // Skip lightmaps not changed by the incremental bake
+            _workerStagePosition0++;
+            if (_workerStagePosition0 >= scene->Lightmaps.Count())
+                _wasStageDone = true;
+            break;
+        }
         ShaderData shaderData;
         shaderData.AtlasSize = atlasSize;
         auto cb = _shader->GetShader()->GetCB(0);
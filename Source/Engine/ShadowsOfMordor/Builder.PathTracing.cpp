@@ -0,0 +1,254 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Builder.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Math/Int3.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Level/Scene/Lightmap.h"
+#include "Engine/Renderer/Renderer.h"
+#include "Engine/Renderer/GBufferPass.h"
+#include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
+#include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Profiler/Profiler.h"
+
+namespace ShadowsOfMordor
+{
+    PACK_STRUCT(struct PathTracingData {
+        GlobalSignDistanceFieldPass::ConstantsData GlobalSDF;
+        GlobalSurfaceAtlasPass::ConstantsData GlobalSurfaceAtlas;
+        uint32 TexelsOffset;
+        uint32 TexelsCount;
+        uint32 SampleIndex;
+        uint32 SamplesCount;
+        uint32 BouncesCount;
+        float RayMaxDistance;
+        float SamplesWeight;
+        uint32 TexelsAtlasSize;
+        });
+}
+
+namespace
+{
+    Int3 GetBatchCell(const Float3& position)
+    {
+        return Int3(
+            Math::FloorToInt(position.X / PATH_TRACING_BATCH_CELL_SIZE),
+            Math::FloorToInt(position.Y / PATH_TRACING_BATCH_CELL_SIZE),
+            Math::FloorToInt(position.Z / PATH_TRACING_BATCH_CELL_SIZE));
+    }
+
+    bool SortTexels(const ShadowsOfMordor::Builder::HemisphereData& a, const ShadowsOfMordor::Builder::HemisphereData& b)
+    {
+        // Sort by the world grid cell to keep nearby texels in the same batch
+        const Int3 cellA = GetBatchCell(a.Position);
+        const Int3 cellB = GetBatchCell(b.Position);
+        if (cellA.X != cellB.X)
+            return cellA.X < cellB.X;
+        if (cellA.Y != cellB.Y)
+            return cellA.Y < cellB.Y;
+        return cellA.Z < cellB.Z;
+    }
+}
+
+void ShadowsOfMordor::Builder::generatePathTracingBatches()
+{
+    auto scene = _scenes[_workerActiveSceneIndex];
+    for (auto& lightmapEntry : scene->Lightmaps)
+    {
+        auto& texels = lightmapEntry.Hemispheres;
+        auto& batches = lightmapEntry.PathTracingBatches;
+        batches.Clear();
+        if (texels.IsEmpty())
+            continue;
+        Sorting::QuickSort(texels.Get(), texels.Count(), &SortTexels);
+
+        // Split texels into batches (each batch is traced with Global SDF and Global Surface Atlas placed around its center)
+        int32 batchStart = 0;
+        Float3 positionsSum = Float3::Zero;
+        Int3 batchCell = GetBatchCell(texels[0].Position);
+        for (int32 i = 0; i <= texels.Count(); i++)
+        {
+            Int3 cell;
+            if (i < texels.Count())
+            {
+                cell = GetBatchCell(texels[i].Position);
+                if (cell == batchCell && i - batchStart < PATH_TRACING_TEXELS_PER_BATCH)
+                {
+                    positionsSum += texels[i].Position;
+                    continue;
+                }
+            }
+
+            PathTracingBatch& batch = batches.AddOne();
+            batch.TexelsOffset = batchStart;
+            batch.TexelsCount = i - batchStart;
+            batch.Center = positionsSum / (float)batch.TexelsCount;
+
+            if (i < texels.Count())
+            {
+                batchStart = i;
+                batchCell = cell;
+                positionsSum = texels[i].Position;
+            }
+        }
+    }
+}
+
+void ShadowsOfMordor::Builder::renderPathTracing(GPUContext* context)
+{
+    auto scene = _scenes[_workerActiveSceneIndex];
+    auto& settings = scene->GetSettings();
+
+    // Skip lightmaps without texels to bake
+    while (_workerStagePosition0 < scene->Lightmaps.Count())
+    {
+        auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+        if (lightmapEntry.IsDirty() && lightmapEntry.PathTracingBatches.HasItems())
+            break;
+        _workerStagePosition0++;
+        _workerStagePosition1 = 0;
+        _pathTracingSampleIndex = 0;
+    }
+    if (_workerStagePosition0 >= scene->Lightmaps.Count())
+    {
+        _wasStageDone = true;
+        return;
+    }
+    auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+
+    PROFILE_GPU_CPU_NAMED("RenderPathTracing");
+
+    // Upload texels and reset the accumulation when starting a new lightmap
+    if (_workerStagePosition1 == 0 && _pathTracingSampleIndex == 0)
+    {
+        const int32 texelsCount = lightmapEntry.Hemispheres.Count();
+        if (!_pathTracingTexels)
+            _pathTracingTexels = GPUDevice::Instance->CreateBuffer(TEXT("ShadowsOfMordor.PathTracingTexels"));
+        if (!_pathTracingAccumulation)
+            _pathTracingAccumulation = GPUDevice::Instance->CreateBuffer(TEXT("ShadowsOfMordor.PathTracingAccumulation"));
+        if ((_pathTracingTexels->GetElementsCount() < (uint32)texelsCount && _pathTracingTexels->Init(GPUBufferDescription::Structured(texelsCount, sizeof(HemisphereData))))
+            || (_pathTracingAccumulation->GetElementsCount() < (uint32)texelsCount * NUM_SH_TARGETS && _pathTracingAccumulation->Init(GPUBufferDescription::Typed(texelsCount * NUM_SH_TARGETS, PixelFormat::R32G32B32A32_Float, true))))
+        {
+            LOG(Error, "Failed to create path tracing buffers for lightmaps baking.");
+            _pathTracingFailed = true;
+            _wasStageDone = true;
+            return;
+        }
+        context->UpdateBuffer(_pathTracingTexels, lightmapEntry.Hemispheres.Get(), texelsCount * sizeof(HemisphereData));
+        context->ClearUA(_pathTracingAccumulation, Float4::Zero);
+    }
+
+    // Place the view at the batch center so Global SDF and Global Surface Atlas cover the traced texels
+    auto& batch = lightmapEntry.PathTracingBatches[_workerStagePosition1];
+    Matrix view, projection;
+    Matrix::PerspectiveFov(HEMISPHERES_FOV * DegreesToRadians, 1.0f, HEMISPHERES_NEAR_PLANE, HEMISPHERES_FAR_PLANE, projection);
+    Matrix::LookAt(batch.Center, batch.Center + Float3::Forward, Float3::Up, view);
+    _task->View.SetUp(view, projection);
+    _task->View.Position = batch.Center;
+    _task->View.Direction = Float3::Forward;
+
+    // Render the scene (tracing is performed in onJobPostRender)
+    _isPathTracingJob = true;
+    IsRunningRadiancePass = true;
+    EnableLightmapsUsage = false;
+    Renderer::Render(_task);
+    context->ClearState();
+    IsRunningRadiancePass = false;
+    EnableLightmapsUsage = true;
+    _isPathTracingJob = false;
+    if (_pathTracingFailed)
+        return;
+
+    // Move to the next batch or samples pass
+    _workerStagePosition1++;
+    if (_workerStagePosition1 >= lightmapEntry.PathTracingBatches.Count())
+    {
+        _workerStagePosition1 = 0;
+        _pathTracingSampleIndex += PATH_TRACING_SAMPLES_PER_JOB;
+    }
+
+    // Report progress
+    float samplesProgress = Math::Saturate(((float)_pathTracingSampleIndex + (float)_workerStagePosition1 / lightmapEntry.PathTracingBatches.Count() * PATH_TRACING_SAMPLES_PER_JOB) / settings.SamplesPerTexel);
+    float lightmapsProgress = static_cast<float>(_workerStagePosition0 + samplesProgress) / scene->Lightmaps.Count();
+    float bouncesProgress = static_cast<float>(_giBounceRunningIndex) / _bounceCount;
+    reportProgress(BuildProgressStep::RenderHemispheres, lightmapsProgress / _bounceCount + bouncesProgress);
+
+    // Check if lightmap has been finished
+    if (_pathTracingSampleIndex >= settings.SamplesPerTexel)
+    {
+        // Move to another lightmap
+        _pathTracingSampleIndex = 0;
+        _workerStagePosition0++;
+        _workerStagePosition1 = 0;
+
+        // Check if it's stage end
+        if (_workerStagePosition0 == scene->Lightmaps.Count())
+        {
+            _wasStageDone = true;
+        }
+    }
+}
+
+void ShadowsOfMordor::Builder::onJobPostRender(GPUContext* context, RenderContext& renderContext)
+{
+    if (!_isPathTracingJob)
+        return;
+    PROFILE_GPU_CPU("Path Tracing");
+    auto scene = _scenes[_workerActiveSceneIndex];
+    auto& settings = scene->GetSettings();
+    auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
+    auto& batch = lightmapEntry.PathTracingBatches[_workerStagePosition1];
+
+    // Render Global SDF and Global Surface Atlas around the batch
+    GlobalSignDistanceFieldPass::BindingData bindingDataSDF;
+    GlobalSurfaceAtlasPass::BindingData bindingDataSurfaceAtlas;
+    if (GlobalSignDistanceFieldPass::Instance()->Render(renderContext, context, bindingDataSDF) ||
+        GlobalSurfaceAtlasPass::Instance()->Render(renderContext, context, bindingDataSurfaceAtlas))
+    {
+        LOG(Error, "Failed to render Global SDF and Global Surface Atlas for lightmaps path tracing. Ensure the Global SDF is supported and enabled.");
+        _pathTracingFailed = true;
+        _wasStageDone = true;
+        return;
+    }
+    GPUTextureView* skybox = GBufferPass::Instance()->RenderSkybox(renderContext, context);
+
+    // Setup shader data
+    PathTracingData data;
+    data.GlobalSDF = bindingDataSDF.Constants;
+    data.GlobalSurfaceAtlas = bindingDataSurfaceAtlas.Constants;
+    data.TexelsOffset = batch.TexelsOffset;
+    data.TexelsCount = batch.TexelsCount;
+    data.SampleIndex = _pathTracingSampleIndex;
+    data.SamplesCount = Math::Min(PATH_TRACING_SAMPLES_PER_JOB, settings.SamplesPerTexel - _pathTracingSampleIndex);
+    data.BouncesCount = Math::Max(settings.BounceCount, 1);
+    data.RayMaxDistance = PATH_TRACING_RAY_MAX_DISTANCE;
+    data.SamplesWeight = (2.0f * PI) / (float)(data.SampleIndex + data.SamplesCount);
+    data.TexelsAtlasSize = (uint32)settings.AtlasSize;
+    auto cb = _shader->GetShader()->GetCB(1);
+    context->UpdateCB(cb, &data);
+    context->BindCB(1, cb);
+
+    // Trace paths for the batch texels and accumulate the lighting into the lightmap data
+    context->ResetRenderTarget();
+    context->BindSR(0, _pathTracingTexels->View());
+    context->BindSR(1, bindingDataSDF.Texture ? bindingDataSDF.Texture->ViewVolume() : nullptr);
+    context->BindSR(2, bindingDataSDF.TextureMip ? bindingDataSDF.TextureMip->ViewVolume() : nullptr);
+    context->BindSR(3, bindingDataSurfaceAtlas.Chunks ? bindingDataSurfaceAtlas.Chunks->View() : nullptr);
+    context->BindSR(4, bindingDataSurfaceAtlas.CulledObjects ? bindingDataSurfaceAtlas.CulledObjects->View() : nullptr);
+    context->BindSR(5, bindingDataSurfaceAtlas.Objects ? bindingDataSurfaceAtlas.Objects->View() : nullptr);
+    context->BindSR(6, bindingDataSurfaceAtlas.AtlasDepth->View());
+    context->BindSR(7, bindingDataSurfaceAtlas.AtlasLighting->View());
+    context->BindSR(8, bindingDataSurfaceAtlas.AtlasGBuffer0->View());
+    context->BindSR(9, skybox);
+    context->BindUA(0, _pathTracingAccumulation->View());
+    context->BindUA(1, lightmapEntry.LightmapData->View());
+    context->Dispatch(_shader->GetShader()->GetCS("CS_PathTrace"), Math::DivideAndRoundUp(batch.TexelsCount, PATH_TRACING_GROUP_SIZE), 1, 1);
+    context->ResetUA();
+    context->ResetSR();
+}
@@ -510,6 +510,8 @@ void ShadowsOfMordor::Builder::releaseResources()
     _shader = nullptr;
 
     SAFE_DELETE_GPU_RESOURCE(_irradianceReduction);
+    SAFE_DELETE_GPU_RESOURCE(_pathTracingTexels);
+    SAFE_DELETE_GPU_RESOURCE(_pathTracingAccumulation);
 
     RenderTargetPool::Release(_cachePositions);
     _cachePositions = nullptr;
@@ -11,6 +11,7 @@
 
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Core/Singleton.h"
+#include "Engine/Core/Collections/Dictionary.h"
 
 // Forward declarations
 #if COMPILE_WITH_ASSETS_IMPORTER
@@ -96,6 +97,7 @@ namespace ShadowsOfMordor
             ClearLightmapData,
             RenderHemispheres,
             PostprocessLightmaps,
+            RenderPathTracing,
         };
 
         /// <summary>
@@ -110,6 +112,16 @@ namespace ShadowsOfMordor
             int16 TexelY;
         };
 
+        /// <summary>
+        /// Group of nearby lightmap texels path traced together (Global SDF and Global Surface Atlas are placed around the batch center)
+        /// </summary>
+        struct PathTracingBatch
+        {
+            Float3 Center;
+            int32 TexelsOffset;
+            int32 TexelsCount;
+        };
+
         /// <summary>
         /// Per lightmap cache data
         /// </summary>
@@ -119,15 +131,52 @@ namespace ShadowsOfMordor
 
             Array<int32> Entries;
             Array<HemisphereData> Hemispheres;
+            Array<PathTracingBatch> PathTracingBatches;
             GPUBuffer* LightmapData = nullptr;
 #if HEMISPHERES_BAKE_STATE_SAVE
             // Restored data for the lightmap from the loaded state (copied to the LightmapData on first hemispheres render job)
             Array<byte> LightmapDataInit;
 #endif
 
+            // Incremental baking: areas of the lightmap atlas (in UVs) to rebake. Other texels are restored from the last bake data.
+            bool Incremental = false;
+            Array<Rectangle> DirtyAreas;
+            Array<byte> LightmapDataHistory;
+
             ~LightmapBuildCache();
 
             bool Init(const LightmapSettings* settings);
+
+            /// <summary>
+            /// Returns true if lightmap has any texels to bake.
+            /// </summary>
+            bool IsDirty() const
+            {
+                return !Incremental || DirtyAreas.HasItems();
+            }
+
+            /// <summary>
+            /// Returns true if lightmap texel has to be baked.
+            /// </summary>
+            bool IsTexelDirty(const Float2& uv) const;
+        };
+
+        /// <summary>
+        /// State of the scene lightmaps from the last bake (used by the incremental baking to detect changes)
+        /// </summary>
+        struct BakeHistory
+        {
+            struct ObjectState
+            {
+                uint32 Hash;
+                BoundingBox Box;
+            };
+
+            uint32 SettingsHash = 0;
+            uint32 LayoutHash = 0;
+            Dictionary<uint32, ObjectState> Entries;
+            Dictionary<Guid, ObjectState> Lights;
+            Array<Array<byte>> LightmapsData;
         };
 
         /// <summary>
@@ -148,6 +197,7 @@ namespace ShadowsOfMordor
             LightmapUVsChartsCollection Charts;
             Array<LightmapBuildCache> Lightmaps;
             GPUBuffer* TempLightmapData;
+            BakeHistory State;
 
             // Stats
             int32 LightmapsCount;
@@ -213,6 +263,12 @@ namespace ShadowsOfMordor
             {
                 Builder::Instance()->onJobRender(context);
             }
+
+            void OnPostRender(GPUContext* context, RenderContext& renderContext) override
+            {
+                SceneRenderTask::OnPostRender(context, renderContext);
+                Builder::Instance()->onJobPostRender(context, renderContext);
+            }
         };
 
     private:
@@ -253,6 +309,12 @@ namespace ShadowsOfMordor
         GPUBuffer* _irradianceReduction = nullptr;
         GPUTexture* _cachePositions = nullptr;
         GPUTexture* _cacheNormals = nullptr;
+        GPUBuffer* _pathTracingTexels = nullptr;
+        GPUBuffer* _pathTracingAccumulation = nullptr;
+        int32 _pathTracingSampleIndex;
+        bool _isPathTracingJob = false;
+        bool _pathTracingFailed;
+        Dictionary<Guid, BakeHistory> _history;
 
     public:
 
@@ -311,6 +373,8 @@ namespace ShadowsOfMordor
         void reportProgress(BuildProgressStep step, float stepProgress, int32 subSteps);
         void reportProgress(BuildProgressStep step, float stepProgress, float totalProgress);
         void onJobRender(GPUContext* context);
+        void onJobPostRender(GPUContext* context, RenderContext& renderContext);
+        void renderPathTracing(GPUContext* context);
         bool checkBuildCancelled();
         bool runStage(BuildingStage stage, bool resetPosition = true);
         bool initResources();
@@ -326,7 +390,10 @@ namespace ShadowsOfMordor
         void packCharts();
         void updateLightmaps();
         void updateEntries();
+        void checkIncrementalBake();
         void generateHemispheres();
+        void generatePathTracingBatches();
+        void storeBakeHistory();
 
 #if DEBUG_EXPORT_LIGHTMAPS_PREVIEW
         static void exportLightmapPreview(SceneBuildCache* scene, int32 lightmapIndex);
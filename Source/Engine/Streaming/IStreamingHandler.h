@@ -54,4 +54,26 @@ class FLAXENGINE_API IStreamingHandler
     {
         return currentResidency != targetResidency;
     }
+
+    /// <summary>
+    /// Calculates the memory used by the given resource at the specified residency level. Used by the streaming memory budgets.
+    /// </summary>
+    /// <param name="resource">The resource.</param>
+    /// <param name="residency">The residency level.</param>
+    /// <returns>The memory usage (in bytes). Zero if not tracked by the memory budgets.</returns>
+    virtual uint64 CalculateMemoryUsage(StreamableResource* resource, int32 residency)
+    {
+        return 0;
+    }
+
+    /// <summary>
+    /// Calculates the value of the given resource residency. Resources with the lowest value are evicted first when pool memory goes over the budget.
+    /// </summary>
+    /// <param name="resource">The resource.</param>
+    /// <param name="currentTime">The current platform time (seconds).</param>
+    /// <returns>The residency value (screen size scaled by the time since last use).</returns>
+    virtual float CalculateResidencyValue(StreamableResource* resource, double currentTime)
+    {
+        return 1.0f;
+    }
 };
@@ -114,6 +114,8 @@ class FLAXENGINE_API StreamableResource
         int32 TargetResidency = 0;
         int64 TargetResidencyChange = 0;
         SamplesBuffer<float, 5> QualitySamples;
+        int32 QualityResidency = 0;
+        int32 BudgetResidency = MAX_int32;
     };
 
     StreamingCache Streaming;
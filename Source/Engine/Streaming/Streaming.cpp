@@ -6,6 +6,7 @@
 #include "StreamingSettings.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/TaskGraph.h"
@@ -21,6 +22,31 @@ namespace StreamingManagerImpl
     Array<StreamableResource*> Resources;
     Array<GPUSampler*, InlinedAllocation<32>> TextureGroupSamplers;
     GPUSampler* FallbackSampler = nullptr;
+    double LastBudgetsUpdateTime = 0;
+
+    // The GPU memory pressure state (streamed pools are scaled down when device gets over its memory budget)
+    float PressureScale = 1.0f;
+    double LastPressureTime = 0;
+    uint64 PoolsMemoryUsage = 0;
+
+    struct BudgetResource
+    {
+        StreamableResource* Resource;
+        IStreamingHandler* Handler;
+        float Value;
+        int32 Residency;
+        int32 MinResidency;
+        uint64 MemoryUsage;
+    };
+
+    Array<BudgetResource> BudgetResources;
+
+    bool SortBudgetResources(const BudgetResource& a, const BudgetResource& b)
+    {
+        return a.Value < b.Value;
+    }
+
+    void UpdateBudget(StreamingGroup::Type type, uint64 budget, double currentTime);
 }
 
 using namespace StreamingManagerImpl;
@@ -52,10 +78,18 @@ namespace
 StreamingService StreamingServiceInstance;
 
 Array<TextureGroup, InlinedAllocation<32>> Streaming::TextureGroups;
+int32 Streaming::TexturesMemoryBudget = 0;
+int32 Streaming::ModelsMemoryBudget = 0;
+float Streaming::ViewPredictionTime = 0.0f;
+float Streaming::LightmapsTimeToInvisible = 10.0f;
 
 void StreamingSettings::Apply()
 {
     Streaming::TextureGroups = TextureGroups;
+    Streaming::TexturesMemoryBudget = TexturesMemoryBudget;
+    Streaming::ModelsMemoryBudget = ModelsMemoryBudget;
+    Streaming::ViewPredictionTime = ViewPredictionTime;
+    Streaming::LightmapsTimeToInvisible = LightmapsTimeToInvisible;
     SAFE_DELETE_GPU_RESOURCES(TextureGroupSamplers);
     TextureGroupSamplers.Resize(TextureGroups.Count(), false);
 }
@@ -63,6 +97,10 @@ void StreamingSettings::Apply()
 void StreamingSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
 {
     DESERIALIZE(TextureGroups);
+    DESERIALIZE(TexturesMemoryBudget);
+    DESERIALIZE(ModelsMemoryBudget);
+    DESERIALIZE(ViewPredictionTime);
+    DESERIALIZE(LightmapsTimeToInvisible);
 }
 
 StreamableResource::StreamableResource(StreamingGroup* group)
@@ -141,6 +179,10 @@ void UpdateResource(StreamableResource* resource, DateTime now, double currentTi
     auto allocatedResidency = resource->GetAllocatedResidency();
     auto targetResidency = handler->CalculateResidency(resource, targetQuality);
     ASSERT(allocatedResidency >= currentResidency && allocatedResidency >= 0);
+
+    // Apply the memory budget limit (see UpdateBudget)
+    resource->Streaming.QualityResidency = targetResidency;
+    targetResidency = Math::Min(targetResidency, resource->Streaming.BudgetResidency);
     resource->Streaming.LastUpdate = now.Ticks;
 
     // Check if a target residency level has been changed
@@ -191,16 +233,79 @@ void UpdateResource(StreamableResource* resource, DateTime now, double currentTi
         // TODO: deallocate or decrease memory usage after timeout? (timeout should be smaller on low mem)
     }
 
-    // low memory case:
-    // if we are on budget and cannot load everything we have to:
-    // decrease global resources quality scale (per resources group)
-    // decrease asset deallocate timeout
+}
+
+void StreamingManagerImpl::UpdateBudget(StreamingGroup::Type type, uint64 budget, double currentTime)
+{
+    // Gather the memory usage of the pool at the residency requested by the resources quality
+    uint64 memoryUsage = 0;
+    const bool isLimited = budget != 0 || PressureScale < 1.0f;
+    BudgetResources.Clear();
+    for (auto resource : Resources)
+    {
+        const auto group = resource->GetGroup();
+        if (group->GetType() != type)
+            continue;
+        const int32 residency = resource->Streaming.QualityResidency;
+        if (!isLimited || residency <= 0)
+        {
+            // Not limited
+            if (resource->Streaming.BudgetResidency != MAX_int32)
+            {
+                resource->Streaming.BudgetResidency = MAX_int32;
+                resource->RequestStreamingUpdate();
+            }
+            continue;
+        }
+        const auto handler = group->GetHandler();
+        BudgetResource& e = BudgetResources.AddOne();
+        e.Resource = resource;
+        e.Handler = handler;
+        e.Value = resource->IsDynamic() ? handler->CalculateResidencyValue(resource, currentTime) : MAX_float;
+        e.Residency = residency;
+        e.MinResidency = resource->IsDynamic() ? Math::Min(handler->CalculateResidency(resource, 0.01f), residency) : residency;
+        e.MemoryUsage = handler->CalculateMemoryUsage(resource, residency);
+        memoryUsage += e.MemoryUsage;
+    }
+    if (BudgetResources.IsEmpty())
+        return;
+    PoolsMemoryUsage += memoryUsage;
+
+    // Shrink the pool when GPU is running out of the memory
+    if (PressureScale < 1.0f)
+    {
+        const uint64 pressureBudget = (uint64)((double)memoryUsage * PressureScale);
+        budget = budget == 0 ? pressureBudget : Math::Min(budget, pressureBudget);
+    }
+
+    // Evict the least valuable residency levels first until the pool fits into the budget
+    if (memoryUsage > budget)
+    {
+        Sorting::QuickSort(BudgetResources.Get(), BudgetResources.Count(), &SortBudgetResources);
+        for (BudgetResource& e : BudgetResources)
+        {
+            while (memoryUsage > budget && e.Residency > e.MinResidency)
+            {
+                e.Residency--;
+                const uint64 residencyMemoryUsage = e.Handler->CalculateMemoryUsage(e.Resource, e.Residency);
+                memoryUsage -= e.MemoryUsage - residencyMemoryUsage;
+                e.MemoryUsage = residencyMemoryUsage;
+            }
+            if (memoryUsage <= budget)
+                break;
+        }
+    }
 
-    // low mem detecting:
-    // for low mem we have to get whole memory budget for a group and then
-    // subtract immutable resources mem usage (like render targets or non dynamic resources)
-    // so we get amount of memory we can distribute and we can detect if we are out of the limit
-    // low mem should be updated once per a few frames
+    // Update the resources limits
+    for (const BudgetResource& e : BudgetResources)
+    {
+        const int32 budgetResidency = e.Residency < e.Resource->Streaming.QualityResidency ? e.Residency : MAX_int32;
+        if (e.Resource->Streaming.BudgetResidency != budgetResidency)
+        {
+            e.Resource->Streaming.BudgetResidency = budgetResidency;
+            e.Resource->RequestStreamingUpdate();
+        }
+    }
 }
 
 bool StreamingService::Init()
@@ -233,6 +338,21 @@ void StreamingSystem::Job(int32 index)
     int32 resourcesUpdates = Math::Min(MaxResourcesPerUpdate, resourcesCount);
     double currentTime = Platform::GetTimeSeconds();
 
+    // Update memory budgets of the resource pools (less frequently as it iterates over all resources)
+    if (currentTime - LastBudgetsUpdateTime >= 0.5)
+    {
+        PROFILE_CPU_NAMED("Streaming.Budgets");
+        LastBudgetsUpdateTime = currentTime;
+        if (PressureScale < 1.0f && currentTime - LastPressureTime >= 5.0)
+        {
+            // Slowly restore the pools size after the memory pressure is gone
+            PressureScale = Math::Min(PressureScale + 0.05f, 1.0f);
+        }
+        PoolsMemoryUsage = 0;
+        UpdateBudget(StreamingGroup::Type::Textures, (uint64)Math::Max(Streaming::TexturesMemoryBudget, 0) * 1024 * 1024, currentTime);
+        UpdateBudget(StreamingGroup::Type::Models, (uint64)Math::Max(Streaming::ModelsMemoryBudget, 0) * 1024 * 1024, currentTime);
+    }
+
     // Update high priority queue and then rest of the resources
     // Note: resources in the update queue are updated always, while others only between specified intervals
     int32 resourcesChecks = resourcesCount;
@@ -275,8 +395,27 @@ StreamingStats Streaming::GetStats()
     stats.ResourcesCount = Resources.Count();
     for (auto e : Resources)
     {
-        if (e->Streaming.TargetResidency > e->GetCurrentResidency())
+        const int32 currentResidency = e->GetCurrentResidency();
+        if (e->Streaming.TargetResidency > currentResidency)
             stats.StreamingResourcesCount++;
+        if (e->Streaming.BudgetResidency != MAX_int32)
+            stats.BudgetLimitedResourcesCount++;
+        const auto group = e->GetGroup();
+        const uint64 memoryUsage = group->GetHandler()->CalculateMemoryUsage(e, currentResidency);
+        switch (group->GetType())
+        {
+        case StreamingGroup::Type::Textures:
+            stats.TexturesMemoryUsage += memoryUsage;
+            break;
+        case StreamingGroup::Type::Models:
+            stats.ModelsMemoryUsage += memoryUsage;
+            break;
+        case StreamingGroup::Type::Audio:
+            stats.AudioMemoryUsage += memoryUsage;
+            break;
+        default:
+            break;
+        }
     }
     ResourcesLock.Unlock();
     return stats;
@@ -291,6 +430,16 @@ void Streaming::RequestStreamingUpdate()
     ResourcesLock.Unlock();
 }
 
+void Streaming::ReleaseMemory(uint64 size)
+{
+    ResourcesLock.Lock();
+    const float scale = PoolsMemoryUsage != 0 ? 1.0f - (float)((double)size / (double)PoolsMemoryUsage) : 0.9f;
+    PressureScale = Math::Clamp(PressureScale * scale, 0.1f, 0.9f);
+    LastPressureTime = Platform::GetTimeSeconds();
+    LastBudgetsUpdateTime = 0;
+    ResourcesLock.Unlock();
+}
+
 GPUSampler* Streaming::GetTextureGroupSampler(int32 index)
 {
     GPUSampler* sampler = nullptr;
@@ -16,6 +16,14 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingStats);
     API_FIELD() int32 ResourcesCount = 0;
     // Amount of resources that are during streaming in (target residency is higher that the current). Zero if all resources are streamed in.
     API_FIELD() int32 StreamingResourcesCount = 0;
+    // Estimated memory used by the streamable textures (in bytes).
+    API_FIELD() uint64 TexturesMemoryUsage = 0;
+    // Estimated memory used by the streamable models (in bytes).
+    API_FIELD() uint64 ModelsMemoryUsage = 0;
+    // Estimated memory used by the streamable audio clips (in bytes).
+    API_FIELD() uint64 AudioMemoryUsage = 0;
+    // Amount of resources that have lowered residency to fit into the memory budget.
+    API_FIELD() int32 BudgetLimitedResourcesCount = 0;
 };
 
 /// <summary>
@@ -30,6 +38,26 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FIELD() static Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// The memory budget for the streamable textures (in megabytes). When exceeded, the least valuable texture mips are evicted first. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static int32 TexturesMemoryBudget;
+
+    /// <summary>
+    /// The memory budget for the streamable models (in megabytes). When exceeded, the least valuable model LODs are evicted first. Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD() static int32 ModelsMemoryBudget;
+
+    /// <summary>
+    /// The time (in seconds) ahead of the view movement used to predict the view location for the content streaming. Resources that will get closer to the predicted view are streamed ahead of time. Use 0 to disable the prediction.
+    /// </summary>
+    API_FIELD() static float ViewPredictionTime;
+
+    /// <summary>
+    /// The time (in seconds) after which the lightmap textures not used by any drawn object are streamed down to the lowest mips. Lightmaps of the drawn objects are streamed to match the on-screen resolution of the objects. Use 0 to keep the lightmaps fully loaded.
+    /// </summary>
+    API_FIELD() static float LightmapsTimeToInvisible;
+
     /// <summary>
     /// Gets streaming statistics.
     /// </summary>
@@ -40,6 +68,12 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FUNCTION() static void RequestStreamingUpdate();
 
+    /// <summary>
+    /// Requests to release the given amount of the GPU memory by lowering the residency of the least valuable streamed resources (eg. when device gets over the memory budget). Streamed pools get restored over time after the memory pressure is gone.
+    /// </summary>
+    /// <param name="size">The amount of memory to release (in bytes).</param>
+    API_FUNCTION() static void ReleaseMemory(uint64 size);
+
     /// <summary>
     /// Gets the texture sampler for a given texture group. Sampler objects is managed and cached by streaming service. Returned value is always valid (uses fallback object).
     /// </summary>
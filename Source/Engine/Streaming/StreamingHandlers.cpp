@@ -3,6 +3,8 @@
 #include "StreamingHandlers.h"
 #include "Streaming.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Textures/StreamingTexture.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Content/Assets/Model.h"
@@ -11,6 +13,27 @@
 #include "Engine/Audio/Audio.h"
 #include "Engine/Audio/AudioSource.h"
 
+namespace
+{
+    uint64 CalculateModelMemoryUsage(const ModelBase& model, int32 residency)
+    {
+        // Estimate memory from the LODs data size (lowest quality LODs are loaded first)
+        uint64 result = 0;
+        const int32 lodCount = model.GetLODsCount();
+        for (int32 lodIndex = Math::Max(lodCount - residency, 0); lodIndex < lodCount; lodIndex++)
+            result += model.GetChunkSize(MODEL_LOD_TO_CHUNK_INDEX(lodIndex));
+        return result;
+    }
+
+    float CalculateModelResidencyValue(const ModelBase& model)
+    {
+        if (model.LastRenderFrame == 0)
+            return 0.0f;
+        const float timeSinceLastUse = (float)(Engine::FrameCount - model.LastRenderFrame) / (float)Math::Max(Engine::GetFramesPerSecond(), 1);
+        return model.LastRenderScreenSize / (1.0f + timeSinceLastUse);
+    }
+}
+
 float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime)
 {
     ASSERT(resource);
@@ -29,8 +52,35 @@ float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resou
         {
             result *= group.QualityIfInvisible;
         }
+        else if (group.UseSamplingFeedback && texture.FeedbackResolution > 0.0f)
+        {
+            // Skip mips that are larger than the on-screen resolution of the geometry using this texture
+            const int32 totalMipLevels = texture.TotalMipLevels();
+            const float resolution = Math::Max(texture.FeedbackResolution * group.SamplingFeedbackScale, 1.0f);
+            const float size = (float)Math::Max(header.Width, header.Height);
+            const int32 skippedMips = Math::Clamp((int32)Math::Log2(size / resolution), 0, totalMipLevels - 1);
+            result = Math::Min(result, ((float)(totalMipLevels - skippedMips) - 0.5f) / (float)totalMipLevels);
+        }
     }
-    return result;
+    else if (texture.IsLightmap && Streaming::LightmapsTimeToInvisible > 0.0f)
+    {
+        // Keep only the lowest mip if lightmap is not used by any drawn object (lightmap needs to be resident to be used in drawing)
+        const int32 totalMipLevels = texture.TotalMipLevels();
+        const double lastRenderTime = texture.GetTexture()->LastRenderTime;
+        if (lastRenderTime < 0 || Streaming::LightmapsTimeToInvisible <= (float)(currentTime - lastRenderTime) || texture.FeedbackResolution <= 0.0f)
+        {
+            result = 0.5f / (float)totalMipLevels;
+        }
+        else
+        {
+            // Skip mips that are larger than the on-screen resolution of the objects using this lightmap
+            const float resolution = Math::Max(texture.FeedbackResolution, 1.0f);
+            const float size = (float)Math::Max(header.Width, header.Height);
+            const int32 skippedMips = Math::Clamp((int32)Math::Log2(size / resolution), 0, totalMipLevels - 1);
+            result = ((float)(totalMipLevels - skippedMips) - 0.5f) / (float)totalMipLevels;
+        }
+    }
+    return Math::Min(result, texture.QualityLimit);
 }
 
 int32 TexturesStreamingHandler::CalculateResidency(StreamableResource* resource, float quality)
@@ -93,6 +143,32 @@ int32 TexturesStreamingHandler::CalculateRequestedResidency(StreamableResource*
     return residency;
 }
 
+uint64 TexturesStreamingHandler::CalculateMemoryUsage(StreamableResource* resource, int32 residency)
+{
+    ASSERT(resource);
+    auto& texture = *(StreamingTexture*)resource;
+    const TextureHeader& header = *texture.GetHeader();
+    residency = Math::Min(residency, texture.TotalMipLevels());
+    if (residency <= 0)
+        return 0;
+    const int32 mipIndex = texture.TotalMipLevels() - residency;
+    const int32 width = Math::Max(header.Width >> mipIndex, 1);
+    const int32 height = Math::Max(header.Height >> mipIndex, 1);
+    const uint64 arraySize = header.IsCubeMap ? 6 : 1;
+    return RenderTools::CalculateTextureMemoryUsage(header.Format, width, height, residency) * arraySize;
+}
+
+float TexturesStreamingHandler::CalculateResidencyValue(StreamableResource* resource, double currentTime)
+{
+    // Textures don't track the on-screen size so use only the time since last use
+    ASSERT(resource);
+    auto& texture = *(StreamingTexture*)resource;
+    const double lastRenderTime = texture.GetTexture()->LastRenderTime;
+    if (lastRenderTime < 0)
+        return 0.0f;
+    return 1.0f / (1.0f + (float)(currentTime - lastRenderTime));
+}
+
 float ModelsStreamingHandler::CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime)
 {
     // TODO: calculate a proper quality levels for models based on render time and streaming enable/disable options
@@ -132,6 +208,18 @@ int32 ModelsStreamingHandler::CalculateRequestedResidency(StreamableResource* re
     return residency;
 }
 
+uint64 ModelsStreamingHandler::CalculateMemoryUsage(StreamableResource* resource, int32 residency)
+{
+    ASSERT(resource);
+    return CalculateModelMemoryUsage(*(Model*)resource, residency);
+}
+
+float ModelsStreamingHandler::CalculateResidencyValue(StreamableResource* resource, double currentTime)
+{
+    ASSERT(resource);
+    return CalculateModelResidencyValue(*(Model*)resource);
+}
+
 float SkinnedModelsStreamingHandler::CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime)
 {
     // TODO: calculate a proper quality levels for models based on render time and streaming enable/disable options
@@ -171,6 +259,18 @@ int32 SkinnedModelsStreamingHandler::CalculateRequestedResidency(StreamableResou
     return residency;
 }
 
+uint64 SkinnedModelsStreamingHandler::CalculateMemoryUsage(StreamableResource* resource, int32 residency)
+{
+    ASSERT(resource);
+    return CalculateModelMemoryUsage(*(SkinnedModel*)resource, residency);
+}
+
+float SkinnedModelsStreamingHandler::CalculateResidencyValue(StreamableResource* resource, double currentTime)
+{
+    ASSERT(resource);
+    return CalculateModelResidencyValue(*(SkinnedModel*)resource);
+}
+
 float AudioStreamingHandler::CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime)
 {
     // Audio clips don't use quality but only residency
@@ -187,6 +287,11 @@ int32 AudioStreamingHandler::CalculateResidency(StreamableResource* resource, fl
 
     // Find audio chunks required for streaming
     clip->StreamingQueue.Clear();
+    if (clip->IsPrefetched() && chunksCount != 0)
+    {
+        // Keep the beginning of the clip decoded for the sources that will start playing it soon
+        chunksMask[0] = true;
+    }
     for (int32 sourceIndex = 0; sourceIndex < Audio::Sources.Count(); sourceIndex++)
     {
         // TODO: collect refs to audio clip from sources and use faster iteration (but do it thread-safe)
@@ -194,15 +299,29 @@ int32 AudioStreamingHandler::CalculateResidency(StreamableResource* resource, fl
         const auto src = Audio::Sources[sourceIndex];
         if (src->Clip == clip && src->GetState() != AudioSource::States::Stopped)
         {
-            // Stream the current and the next chunk if could be used in a while
+            // Stream the current chunk
             const int32 chunk = src->_streamingFirstChunk;
             ASSERT(Math::IsInRange(chunk, 0, chunksCount));
             chunksMask[chunk] = true;
-            
-            const float StreamingDstSec = 2.0f; // TODO: make it configurable via StreamingSettings
-            if (chunk + 1 < chunksCount && src->GetTime() + StreamingDstSec >= clip->GetBufferStartTime(src->_streamingFirstChunk))
+
+            // Decode ahead the next chunks that will be played in a while so the source never waits for the streaming task (the next chunk is always needed because source queues it right after the current one)
+            const float decodeEndTime = src->GetTime() + Audio::StreamingDecodeAhead;
+            for (int32 i = 1; i <= AUDIO_MAX_DECODE_AHEAD_CHUNKS; i++)
             {
-                chunksMask[chunk + 1] = true;
+                int32 nextChunk = chunk + i;
+                float nextChunkTime = 0.0f;
+                if (nextChunk >= chunksCount)
+                {
+                    // Looped source starts from the clip beginning after the end
+                    if (!src->GetIsLooping())
+                        break;
+                    nextChunk %= chunksCount;
+                    nextChunkTime = clip->GetLength();
+                }
+                nextChunkTime += clip->GetBufferStartTime(nextChunk);
+                if (nextChunk == chunk || (i > 1 && decodeEndTime < nextChunkTime))
+                    break;
+                chunksMask[nextChunk] = true;
             }
         }
     }
@@ -231,3 +350,17 @@ bool AudioStreamingHandler::RequiresStreaming(StreamableResource* resource, int3
     const auto clip = static_cast<AudioClip*>(resource);
     return clip->StreamingQueue.HasItems();
 }
+
+uint64 AudioStreamingHandler::CalculateMemoryUsage(StreamableResource* resource, int32 residency)
+{
+    // Audio clips residency is a streaming queue size so count the currently loaded buffers
+    ASSERT(resource);
+    const auto clip = static_cast<AudioClip*>(resource);
+    uint64 result = 0;
+    for (int32 i = 0; i < clip->Buffers.Count(); i++)
+    {
+        if (clip->Buffers[i] != 0)
+            result += clip->GetChunkSize(i);
+    }
+    return result;
+}
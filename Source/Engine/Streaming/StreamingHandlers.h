@@ -14,6 +14,8 @@ class FLAXENGINE_API TexturesStreamingHandler : public IStreamingHandler
     float CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime) override;
     int32 CalculateResidency(StreamableResource* resource, float quality) override;
     int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
+    uint64 CalculateMemoryUsage(StreamableResource* resource, int32 residency) override;
+    float CalculateResidencyValue(StreamableResource* resource, double currentTime) override;
 };
 
 /// <summary>
@@ -26,6 +28,8 @@ class FLAXENGINE_API ModelsStreamingHandler : public IStreamingHandler
     float CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime) override;
     int32 CalculateResidency(StreamableResource* resource, float quality) override;
     int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
+    uint64 CalculateMemoryUsage(StreamableResource* resource, int32 residency) override;
+    float CalculateResidencyValue(StreamableResource* resource, double currentTime) override;
 };
 
 /// <summary>
@@ -38,6 +42,8 @@ class FLAXENGINE_API SkinnedModelsStreamingHandler : public IStreamingHandler
     float CalculateTargetQuality(StreamableResource* resource, DateTime now, double currentTime) override;
     int32 CalculateResidency(StreamableResource* resource, float quality) override;
     int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
+    uint64 CalculateMemoryUsage(StreamableResource* resource, int32 residency) override;
+    float CalculateResidencyValue(StreamableResource* resource, double currentTime) override;
 };
 
 /// <summary>
@@ -51,4 +57,5 @@ class FLAXENGINE_API AudioStreamingHandler : public IStreamingHandler
     int32 CalculateResidency(StreamableResource* resource, float quality) override;
     int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
     bool RequiresStreaming(StreamableResource* resource, int32 currentResidency, int32 targetResidency) override;
+    uint64 CalculateMemoryUsage(StreamableResource* resource, int32 residency) override;
 };
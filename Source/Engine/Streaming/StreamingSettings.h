@@ -19,6 +19,30 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingSettings);
     API_FIELD(Attributes="EditorOrder(100), EditorDisplay(\"Textures\")")
     Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// The memory budget for the streamable textures (in megabytes). When exceeded, the streaming evicts the least valuable texture mips first (based on the time since last use). Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(200), Limit(0), EditorDisplay(\"Memory Budgets\")")
+    int32 TexturesMemoryBudget = 0;
+
+    /// <summary>
+    /// The memory budget for the streamable models (in megabytes). When exceeded, the streaming evicts the least valuable model LODs first (based on the screen size and the time since last use). Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(210), Limit(0), EditorDisplay(\"Memory Budgets\")")
+    int32 ModelsMemoryBudget = 0;
+
+    /// <summary>
+    /// The time (in seconds) ahead of the view movement used to predict the view location for the content streaming. Resources that will get closer to the predicted view (based on the view velocity) are streamed ahead of time to reduce pop-in during fast camera movement. Use 0 to disable the prediction.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(300), Limit(0, 10, 0.01f), EditorDisplay(\"Prediction\")")
+    float ViewPredictionTime = 0.0f;
+
+    /// <summary>
+    /// The time (in seconds) after which the lightmap textures not used by any drawn object are streamed down to the lowest mips. Lightmaps of the drawn objects are streamed to match the on-screen resolution of the objects, so the baked lighting memory scales with the visible part of the level. Use 0 to keep the lightmaps fully loaded.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(400), Limit(0), EditorDisplay(\"Lightmaps\")")
+    float LightmapsTimeToInvisible = 10.0f;
+
 public:
 
     /// <summary>
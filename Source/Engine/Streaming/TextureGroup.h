@@ -53,6 +53,18 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TextureGroup);
     API_FIELD(Attributes="EditorOrder(26), Limit(0)")
     float TimeToInvisible = 20.0f;
 
+    /// <summary>
+    /// Enables using the sampling feedback from the rendering to stream only the mips that are actually needed on screen (based on the on-screen size of the geometry drawn with the texture). Reduces memory usage of textures that are small on screen.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(27)")
+    bool UseSamplingFeedback = false;
+
+    /// <summary>
+    /// The scale applied to the on-screen resolution from the sampling feedback. Can be used to compensate for the UVs tiling of the textures in this group (eg. 2 for textures tiled twice over the geometry).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(28), Limit(0.01f, 100.0f), VisibleIf(nameof(UseSamplingFeedback))")
+    float SamplingFeedbackScale = 1.0f;
+
     /// <summary>
     /// The minimum amount of loaded mip levels for textures in this group. Defines the amount of the mips that should be always loaded. Higher values decrease streaming usage and keep more mips loaded.
     /// </summary>
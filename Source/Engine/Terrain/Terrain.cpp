@@ -2,9 +2,12 @@
 
 #include "Terrain.h"
 #include "TerrainPatch.h"
+#include "TerrainManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Ray.h"
+#include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Scene/SceneRendering.h"
+#include "Engine/Level/Actors/Camera.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Physics/Physics.h"
 #include "Engine/Physics/PhysicalMaterial.h"
@@ -15,6 +18,10 @@
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
 #include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
+#include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/TerrainCullingPass.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Core/Math/CollisionsHelper.h"
 
 Terrain::Terrain(const SpawnParams& params)
     : PhysicsColliderActor(params)
@@ -228,6 +235,53 @@ void Terrain::DrawChunk(const RenderContext& renderContext, const Int2& patchCoo
     }
 }
 
+void Terrain::OnUpdate()
+{
+    if (!IsDuringPlay())
+        return;
+
+    // Gather streaming sources
+    Array<Vector3, InlinedAllocation<8>> sources;
+    if (StreamingDistance > 0.0f)
+    {
+        const Camera* camera = Camera::GetMainCamera();
+        if (camera)
+            sources.Add(camera->GetPosition());
+        sources.Add(StreamingSources.Get(), StreamingSources.Count());
+    }
+    PROFILE_CPU();
+
+    // Update patches (limit the amount of the collision swaps per frame)
+    const Real loadDistance = StreamingDistance;
+    const Real unloadDistance = StreamingDistance * 1.2f;
+    int32 budget = 2;
+    for (int32 pathIndex = 0; pathIndex < _patches.Count() && budget > 0; pathIndex++)
+    {
+        const auto patch = _patches[pathIndex];
+
+        // Find the distance to the closest streaming source (on XZ plane)
+        const BoundingBox& bounds = patch->_bounds;
+        Real distanceSqr = MAX_Real;
+        for (int32 j = 0; j < sources.Count(); j++)
+        {
+            const Vector3& source = sources[j];
+            const Real dx = Math::Max(bounds.Minimum.X - source.X, (Real)0, source.X - bounds.Maximum.X);
+            const Real dz = Math::Max(bounds.Minimum.Z - source.Z, (Real)0, source.Z - bounds.Maximum.Z);
+            distanceSqr = Math::Min(distanceSqr, dx * dx + dz * dz);
+        }
+
+        // Use the larger distance for streaming out to prevent swapping the state back and forth on the streaming range edge
+        bool streamedOut = false;
+        if (sources.HasItems())
+            streamedOut = patch->_isStreamedOut ? distanceSqr > loadDistance * loadDistance : distanceSqr > unloadDistance * unloadDistance;
+        if (streamedOut != patch->_isStreamedOut)
+        {
+            patch->SetStreamedOut(streamedOut);
+            budget--;
+        }
+    }
+}
+
 void Terrain::OnPhysicalMaterialChanged()
 {
     if (_patches.IsEmpty())
@@ -555,6 +609,9 @@ void Terrain::Draw(RenderContext& renderContext)
 
     // Collect chunks to render and calculate LOD/material for them (required to be done before to gather NeighborLOD)
     _drawChunks.Clear();
+    TerrainChunksDraw gpuDraw;
+    Array<TerrainPatch*, InlinedAllocation<64>> gpuPatches;
+    const bool gpuDriven = renderContext.List->TerrainCulling;
 
     // Frustum vs Box culling for patches
     const BoundingFrustum frustum = renderContext.View.CullingFrustum;
@@ -569,6 +626,13 @@ void Terrain::Draw(RenderContext& renderContext)
             if (patch->Heightmap == nullptr || patch->Heightmap->GetTexture()->ResidentMipLevels() == 0)
                 continue;
 
+            // Draw the whole patch with the chunks LOD selection and culling done on a GPU
+            if (gpuDriven && DrawPatchGPU(renderContext, patch, gpuDraw))
+            {
+                gpuPatches.Add(patch);
+                continue;
+            }
+
             // Frustum vs Box culling for chunks
             for (int32 chunkIndex = 0; chunkIndex < TerrainPatch::CHUNKS_COUNT; chunkIndex++)
             {
@@ -601,6 +665,136 @@ void Terrain::Draw(RenderContext& renderContext)
     {
         _drawChunks.Get()[i]->Draw(renderContext);
     }
+
+    // Submit chunks of the patches drawn by the GPU
+    if (gpuPatches.HasItems())
+    {
+        // Link neighbor chunks within the draw (chunks on the edge of the patches drawn by the CPU use themselves)
+        for (int32 i = 0; i < gpuPatches.Count(); i++)
+        {
+            const TerrainPatch* patch = gpuPatches.Get()[i];
+            for (int32 chunkIndex = 0; chunkIndex < TerrainPatch::CHUNKS_COUNT; chunkIndex++)
+            {
+                const TerrainChunk* chunk = &patch->Chunks[chunkIndex];
+                TerrainChunksDraw::Chunk& e = gpuDraw.Chunks[i * TerrainPatch::CHUNKS_COUNT + chunkIndex];
+                for (int32 j = 0; j < 4; j++)
+                {
+                    const TerrainChunk* neighbor = chunk->_neighbors[j];
+                    const int32 neighborPatch = neighbor->_patch == patch ? i : gpuPatches.Find((TerrainPatch*)neighbor->_patch);
+                    e.Neighbors[j] = neighborPatch != -1 ? neighborPatch * TerrainPatch::CHUNKS_COUNT + neighbor->_z * TerrainPatch::CHUNKS_COUNT_EDGE + neighbor->_x : i * TerrainPatch::CHUNKS_COUNT + chunkIndex;
+                }
+            }
+        }
+        const auto lodView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+        gpuDraw.LODViewPosition = lodView->Position + Float3(lodView->Origin - origin);
+        gpuDraw.InvChunkEdgeSize = 1.0f / (_chunkSize * TERRAIN_UNITS_PER_VERTEX);
+        gpuDraw.LODDistribution = _lodDistribution;
+        gpuDraw.LODBias = _lodBias;
+        gpuDraw.ChunkSize = _chunkSize;
+        renderContext.List->TerrainChunksDraws.Add(MoveTemp(gpuDraw));
+    }
+
+    // Collect terrain for the virtual texture tiles rendering
+    if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer) && (_drawChunks.HasItems() || gpuPatches.HasItems()))
+        renderContext.List->Terrains.Add(this);
+}
+
+bool Terrain::DrawPatchGPU(const RenderContext& renderContext, TerrainPatch* patch, TerrainChunksDraw& draw)
+{
+    // Patch needs to use a single material and lightmap for all chunks to be drawn with the indirect draw calls
+    TerrainChunk* firstChunk = &patch->Chunks[0];
+    for (int32 chunkIndex = 1; chunkIndex < TerrainPatch::CHUNKS_COUNT; chunkIndex++)
+    {
+        const TerrainChunk* chunk = &patch->Chunks[chunkIndex];
+        if (chunk->OverrideMaterial.Get() != firstChunk->OverrideMaterial.Get() || chunk->Lightmap.TextureIndex != firstChunk->Lightmap.TextureIndex)
+            return false;
+    }
+    if (!firstChunk->PrepareDraw(renderContext))
+        return false;
+
+    // Calculate the LODs range of the patch chunks (GPU selects the LOD of each chunk within it)
+    const int32 lodCount = patch->Heightmap.Get()->StreamingTexture()->TotalMipLevels();
+    const int32 minStreamedLod = lodCount - patch->Heightmap.Get()->GetTexture()->ResidentMipLevels();
+    int32 minLod, maxLod;
+    if (_forcedLod >= 0)
+    {
+        minLod = maxLod = Math::Clamp((int32)_forcedLod, minStreamedLod, lodCount - 1);
+    }
+    else
+    {
+        const auto lodView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+        const Vector3 lodViewPosition = lodView->Position + lodView->Origin;
+        const float chunkEdgeSize = _chunkSize * TERRAIN_UNITS_PER_VERTEX;
+        const Vector3 toMin = Vector3::Abs(patch->_bounds.Minimum - lodViewPosition);
+        const Vector3 toMax = Vector3::Abs(patch->_bounds.Maximum - lodViewPosition);
+        const float minDistance = (float)CollisionsHelper::DistanceBoxPoint(patch->_bounds, lodViewPosition);
+        const float maxDistance = (float)Vector3::Max(toMin, toMax).Length();
+        minLod = (int32)Math::Pow(minDistance / chunkEdgeSize, _lodDistribution) + _lodBias;
+        maxLod = (int32)Math::Pow(maxDistance / chunkEdgeSize, _lodDistribution) + _lodBias;
+        minLod = Math::Clamp(minLod, minStreamedLod, lodCount - 1);
+        maxLod = Math::Clamp(maxLod, minLod, lodCount - 1);
+    }
+    const int32 lodsCount = maxLod - minLod + 1;
+    uint32 argsOffset, outputOffset;
+    TerrainCullingPass* terrainCullingPass = TerrainCullingPass::Instance();
+    terrainCullingPass->Reserve(lodsCount, argsOffset, outputOffset);
+
+    // Add chunks for the culling (neighbors are linked after collecting all patches of the draw)
+    const Vector3 origin = renderContext.View.Origin;
+    for (int32 chunkIndex = 0; chunkIndex < TerrainPatch::CHUNKS_COUNT; chunkIndex++)
+    {
+        const TerrainChunk* chunk = &patch->Chunks[chunkIndex];
+        TerrainChunksDraw::Chunk& e = draw.Chunks.AddOne();
+        e.BoundsMin = chunk->_bounds.Minimum - origin;
+        e.ArgsOffset = argsOffset;
+        e.BoundsMax = chunk->_bounds.Maximum - origin;
+        e.OutputOffset = outputOffset;
+        e.LightmapArea = chunk->Lightmap.UVsArea;
+        e.ChunkCoord = Float2((float)chunk->_x, (float)chunk->_z);
+        e.MinLOD = minLod;
+        e.MaxLOD = maxLod;
+    }
+
+    // Setup draw calls (one per patch LOD, chunks are instanced with the data from the culling output)
+    DrawCall drawCall;
+    drawCall.Material = firstChunk->_cachedDrawMaterial;
+    renderContext.View.GetWorldMatrix(firstChunk->_transform, drawCall.World);
+    drawCall.ObjectPosition = drawCall.World.GetTranslation();
+    drawCall.Terrain.Patch = patch;
+    drawCall.Terrain.HeightmapUVScaleBias = firstChunk->_heightmapUVScaleBias;
+    drawCall.Terrain.OffsetUV = Vector2((float)(patch->_x * TerrainPatch::CHUNKS_COUNT_EDGE), (float)(patch->_z * TerrainPatch::CHUNKS_COUNT_EDGE));
+    drawCall.Terrain.TerrainChunkSizeLOD0 = TERRAIN_UNITS_PER_VERTEX * _chunkSize;
+    const auto scene = GetScene();
+    if ((_staticFlags & StaticFlags::Lightmap) != StaticFlags::None && scene)
+    {
+        drawCall.Terrain.Lightmap = scene->LightmapsData.GetReadyLightmap(firstChunk->Lightmap.TextureIndex);
+        drawCall.Terrain.LightmapUVsArea = firstChunk->Lightmap.UVsArea;
+    }
+    else
+    {
+        drawCall.Terrain.Lightmap = nullptr;
+        drawCall.Terrain.LightmapUVsArea = Rectangle::Empty;
+    }
+    drawCall.WorldDeterminantSign = Math::FloatSelect(drawCall.World.RotDeterminant(), 1, -1);
+    drawCall.PerInstanceRandom = firstChunk->_perInstanceRandom;
+    const DrawPass drawModes = DrawModes & renderContext.View.Pass & drawCall.Material->GetDrawModes();
+    if (drawModes == DrawPass::None)
+        return true;
+    for (int32 i = 0; i < lodsCount; i++)
+    {
+        const int32 lod = minLod + i;
+        if (TerrainManager::GetChunkGeometry(drawCall, _chunkSize, lod))
+            continue;
+        drawCall.InstanceCount = 0;
+        drawCall.Draw.IndirectArgsBuffer = terrainCullingPass->GetArgsBuffer();
+        drawCall.Draw.IndirectArgsOffset = (argsOffset + i) * sizeof(GPUDrawIndexedIndirectArgs);
+        drawCall.Terrain.CurrentLOD = (float)lod;
+        drawCall.Terrain.ChunkSizeNextLOD = (float)(((_chunkSize + 1) >> (lod + 1)) - 1);
+        drawCall.Terrain.GPUChunksOffset = (int32)(outputOffset + i * TerrainCullingPass::ChunksPerLOD);
+        drawCall.Terrain.NeighborLOD = Float4((float)lod);
+        renderContext.List->AddDrawCall(renderContext, drawModes, _staticFlags, drawCall, true);
+    }
+    return true;
 }
 
 #if USE_EDITOR
@@ -670,6 +864,8 @@ void Terrain::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(Material);
     SERIALIZE(PhysicalMaterial);
     SERIALIZE(DrawModes);
+    SERIALIZE(StreamingDistance);
+    SERIALIZE(FarCollisionLOD);
 
     SERIALIZE_MEMBER(LODCount, _lodCount);
     SERIALIZE_MEMBER(ChunkSize, _chunkSize);
@@ -717,6 +913,8 @@ void Terrain::Deserialize(DeserializeStream& stream, ISerializeModifier* modifie
     DESERIALIZE(Material);
     DESERIALIZE(PhysicalMaterial);
     DESERIALIZE(DrawModes);
+    DESERIALIZE(StreamingDistance);
+    DESERIALIZE(FarCollisionLOD);
 
     member = stream.FindMember("LODCount");
     if (member != stream.MemberEnd() && member->value.IsInt())
@@ -790,6 +988,7 @@ RigidBody* Terrain::GetAttachedRigidBody() const
 
 void Terrain::OnEnable()
 {
+    GetScene()->Ticking.Update.AddTick<Terrain, &Terrain::OnUpdate>(this);
     GetSceneRendering()->AddActor(this, _sceneRenderingKey);
 #if TERRAIN_USE_PHYSICS_DEBUG
     GetSceneRendering()->AddPhysicsDebug<Terrain, &Terrain::DrawPhysicsDebug>(this);
@@ -801,6 +1000,7 @@ void Terrain::OnEnable()
 
 void Terrain::OnDisable()
 {
+    GetScene()->Ticking.Update.RemoveTick(this);
     GetSceneRendering()->RemoveActor(this, _sceneRenderingKey);
 #if TERRAIN_USE_PHYSICS_DEBUG
     GetSceneRendering()->RemovePhysicsDebug<Terrain, &Terrain::DrawPhysicsDebug>(this);
@@ -900,4 +1100,10 @@ void Terrain::EndPlay()
 
     // Base
     Actor::EndPlay();
+
+    // Restore the patches streaming state (collision is not created outside the play)
+    for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+    {
+        _patches[pathIndex]->SetStreamedOut(false);
+    }
 }
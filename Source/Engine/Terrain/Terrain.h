@@ -88,6 +88,24 @@ DECLARE_SCENE_OBJECT(Terrain);
     API_FIELD(Attributes="EditorOrder(115), DefaultValue(DrawPass.Default), EditorDisplay(\"Terrain\")")
     DrawPass DrawModes = DrawPass::Default;
 
+    /// <summary>
+    /// The distance from the streaming sources (main camera and custom locations) within which the terrain patches are fully loaded (use the full collision and the full quality of the heightmap and splatmap textures). Patches further away use the coarse collision and drop the textures mips not needed by the distant geometry. Use 0 to disable streaming.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(600), DefaultValue(0.0f), Limit(0), EditorDisplay(\"Streaming\")")
+    float StreamingDistance = 0.0f;
+
+    /// <summary>
+    /// The heightfield LOD index used by the coarse collision of the streamed out patches. Use -1 to remove collision from the streamed out patches.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(610), DefaultValue(4), Limit(-1, 100, 0.1f), EditorDisplay(\"Streaming\", \"Far Collision LOD\")")
+    int32 FarCollisionLOD = 4;
+
+    /// <summary>
+    /// The custom streaming sources locations (eg. players positions). Terrain patches are streamed around them and the main camera.
+    /// </summary>
+    API_FIELD(Attributes="HideInEditor, NoSerialize")
+    Array<Vector3> StreamingSources;
+
 public:
 
     /// <summary>
@@ -433,6 +451,8 @@ DECLARE_SCENE_OBJECT(Terrain);
 
 private:
 
+    void OnUpdate();
+    bool DrawPatchGPU(const RenderContext& renderContext, TerrainPatch* patch, struct TerrainChunksDraw& draw);
     void OnPhysicalMaterialChanged();
 #if TERRAIN_USE_PHYSICS_DEBUG
 	void DrawPhysicsDebug(RenderView& view);
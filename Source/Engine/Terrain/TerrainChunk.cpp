@@ -94,6 +94,7 @@ void TerrainChunk::Draw(const RenderContext& renderContext) const
     drawCall.Terrain.CurrentLOD = (float)lod;
     drawCall.Terrain.ChunkSizeNextLOD = (float)(((chunkSize + 1) >> (lod + 1)) - 1);
     drawCall.Terrain.TerrainChunkSizeLOD0 = TERRAIN_UNITS_PER_VERTEX * chunkSize;
+    drawCall.Terrain.GPUChunksOffset = -1;
     // TODO: try using SIMD clamping for 4 chunks at once
     drawCall.Terrain.NeighborLOD.X = (float)Math::Clamp<int32>(_neighbors[0]->_cachedDrawLOD, lod, minLod);
     drawCall.Terrain.NeighborLOD.Y = (float)Math::Clamp<int32>(_neighbors[1]->_cachedDrawLOD, lod, minLod);
@@ -151,6 +152,7 @@ void TerrainChunk::Draw(const RenderContext& renderContext, MaterialBase* materi
     drawCall.Terrain.CurrentLOD = (float)lod;
     drawCall.Terrain.ChunkSizeNextLOD = (float)(((chunkSize + 1) >> (lod + 1)) - 1);
     drawCall.Terrain.TerrainChunkSizeLOD0 = TERRAIN_UNITS_PER_VERTEX * chunkSize;
+    drawCall.Terrain.GPUChunksOffset = -1;
     drawCall.Terrain.NeighborLOD.X = (float)lod;
     drawCall.Terrain.NeighborLOD.Y = (float)lod;
     drawCall.Terrain.NeighborLOD.Z = (float)lod;
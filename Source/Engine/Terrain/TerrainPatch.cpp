@@ -14,6 +14,7 @@
 #include "Engine/Level/Level.h"
 #include "Engine/Graphics/Async/GPUTask.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Renderer/TerrainVirtualTexturePass.h"
 #if TERRAIN_EDITING
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
@@ -49,6 +50,7 @@ void TerrainPatch::Init(Terrain* terrain, int16 x, int16 z)
     _physicsShape = nullptr;
     _physicsActor = nullptr;
     _physicsHeightField = nullptr;
+    _physicsScene = nullptr;
     _x = x;
     _z = z;
     const float size = _terrain->_chunkSize * TERRAIN_UNITS_PER_VERTEX * CHUNKS_COUNT_EDGE;
@@ -1690,6 +1692,9 @@ bool TerrainPatch::ModifySplatMap(int32 index, const Color32* samples, const Int
 #endif
     }
 
+    // Refresh the cached terrain materials output
+    TerrainVirtualTexturePass::Instance()->Invalidate(_bounds);
+
     // Mark as modified (need to save texture data during scene saving)
     _wasSplatmapModified[index] = true;
 
@@ -1754,9 +1759,10 @@ bool TerrainPatch::UpdateHeightData(const TerrainDataUpdateInfo& info, const Int
     }
 
 #if 1
-    if (wasHeightRangeChanged)
+    _coarseCollisionData.Resize(0);
+    if (wasHeightRangeChanged || _isStreamedOut)
     {
-        // When min-max height range has been changed for the patch let's update it all, it's faster to cook collision and rebuild shape rather than modify all the samples
+        // When min-max height range has been changed for the patch let's update it all, it's faster to cook collision and rebuild shape rather than modify all the samples (streamed out patch uses the coarse collision so update the full collision data for the stream in)
         if (_heightfield->WaitForLoaded())
         {
             LOG(Error, "Failed to load patch heightfield data.");
@@ -1804,6 +1810,7 @@ bool TerrainPatch::UpdateHeightData(const TerrainDataUpdateInfo& info, const Int
     _collisionTriangles.Resize(0);
 #endif
     _collisionVertices.Resize(0);
+    TerrainVirtualTexturePass::Instance()->Invalidate(_bounds);
 
     // Mark as modified (need to save texture data during scene saving)
     _wasHeightModified = true;
@@ -2114,7 +2121,8 @@ void TerrainPatch::CreateCollision()
     PhysicsBackend::SetShapeLocalPose(_physicsShape, Vector3(0, _yOffset * terrainTransform.Scale.Y, 0), Quaternion::Identity);
 
     // Create static actor
-    void* scene = _terrain->GetPhysicsScene()->GetPhysicsScene();
+    _physicsScene = GetPhysicsScene();
+    void* scene = _physicsScene->GetPhysicsScene();
     _physicsActor = PhysicsBackend::CreateRigidStaticActor(nullptr, terrainTransform.LocalToWorld(_offset), terrainTransform.Orientation, scene);
     PhysicsBackend::AttachShape(_physicsShape, _physicsActor);
     PhysicsBackend::AddSceneActor(scene, _physicsActor);
@@ -2124,18 +2132,30 @@ bool TerrainPatch::CreateHeightField()
 {
     ASSERT(_physicsHeightField == nullptr);
 
-    // Skip if height field data is missing but warn on loading failed
-    if (_heightfield == nullptr)
-        return true;
-    if (_heightfield->WaitForLoaded() || _heightfield->Data.IsEmpty())
+    Array<byte>* collisionData;
+    if (_isStreamedOut)
     {
-        LOG(Warning, "Cannot create terrain collision. Failed to load heightfield data for terrain {0} patch {1}x{2}.", _terrain->ToString(), _x, _z);
-        return true;
+        // Use the coarse collision for the streamed out patch (skip if disabled)
+        if (_coarseCollisionData.IsEmpty() && CookCoarseCollision())
+            return true;
+        collisionData = &_coarseCollisionData;
+    }
+    else
+    {
+        // Skip if height field data is missing but warn on loading failed
+        if (_heightfield == nullptr)
+            return true;
+        if (_heightfield->WaitForLoaded() || _heightfield->Data.IsEmpty())
+        {
+            LOG(Warning, "Cannot create terrain collision. Failed to load heightfield data for terrain {0} patch {1}x{2}.", _terrain->ToString(), _x, _z);
+            return true;
+        }
+        collisionData = &_heightfield->Data;
     }
 
-    const auto collisionHeader = (TerrainCollisionDataHeader*)_heightfield->Data.Get();
+    const auto collisionHeader = (TerrainCollisionDataHeader*)collisionData->Get();
     _collisionScaleXZ = collisionHeader->ScaleXZ * TERRAIN_UNITS_PER_VERTEX;
-    _physicsHeightField = PhysicsBackend::CreateHeightField(_heightfield->Data.Get() + sizeof(TerrainCollisionDataHeader), _heightfield->Data.Count() - sizeof(TerrainCollisionDataHeader));
+    _physicsHeightField = PhysicsBackend::CreateHeightField(collisionData->Get() + sizeof(TerrainCollisionDataHeader), collisionData->Count() - sizeof(TerrainCollisionDataHeader));
     if (_physicsHeightField == nullptr)
     {
         LOG(Error, "Failed to create terrain collision height field.");
@@ -2167,7 +2187,7 @@ void TerrainPatch::DestroyCollision()
     ScopeLock lock(_collisionLocker);
     ASSERT(HasCollision());
 
-    void* scene = _terrain->GetPhysicsScene()->GetPhysicsScene();
+    void* scene = _physicsScene->GetPhysicsScene();
     PhysicsBackend::RemoveCollider(_terrain);
     PhysicsBackend::RemoveSceneActor(scene, _physicsActor);
     PhysicsBackend::DestroyActor(_physicsActor);
@@ -2177,6 +2197,7 @@ void TerrainPatch::DestroyCollision()
     _physicsActor = nullptr;
     _physicsShape = nullptr;
     _physicsHeightField = nullptr;
+    _physicsScene = nullptr;
 #if TERRAIN_USE_PHYSICS_DEBUG
     _debugLines.Resize(0);
 #endif
@@ -2186,6 +2207,108 @@ void TerrainPatch::DestroyCollision()
     _collisionVertices.Resize(0);
 }
 
+void TerrainPatch::SetStreamedOut(bool value)
+{
+    if (_isStreamedOut == value)
+        return;
+    _isStreamedOut = value;
+
+    // Limit the textures quality to the mips used by the chunks at the streaming distance (the same LOD selection as in chunks drawing)
+    float qualityLimit = 1.0f;
+    if (value)
+    {
+        const float chunkEdgeSize = (float)(_terrain->_chunkSize * TERRAIN_UNITS_PER_VERTEX);
+        const int32 lodCount = _terrain->_lodCount;
+        const int32 lod = (int32)Math::Pow(_terrain->StreamingDistance / chunkEdgeSize, _terrain->_lodDistribution) + (int32)_terrain->_lodBias;
+        qualityLimit = ((float)Math::Clamp(lodCount - lod, 1, lodCount) - 0.5f) / (float)lodCount;
+    }
+    if (Heightmap)
+        Heightmap->StreamingTexture()->QualityLimit = qualityLimit;
+    for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+    {
+        if (Splatmap[i])
+            Splatmap[i]->StreamingTexture()->QualityLimit = qualityLimit;
+    }
+
+#if TERRAIN_UPDATING
+    // Release the CPU-side data caches (if not modified)
+    if (value && !_wasHeightModified)
+    {
+        _cachedHeightMap.Resize(0);
+        _cachedHolesMask.Resize(0);
+    }
+    for (int32 i = 0; value && i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+    {
+        if (!_wasSplatmapModified[i])
+            _cachedSplatMap[i].Resize(0);
+    }
+#endif
+
+    // Swap the collision
+    if (_terrain->IsDuringPlay())
+    {
+        ScopeLock lock(_collisionLocker);
+        if (HasCollision())
+            DestroyCollision();
+        CreateCollision();
+    }
+}
+
+bool TerrainPatch::CookCoarseCollision()
+{
+    const int32 collisionLod = _terrain->FarCollisionLOD;
+    if (collisionLod < 0 || Heightmap == nullptr)
+        return true;
+    PROFILE_CPU();
+
+    // Setup patch data info
+    const int32 chunkSize = _terrain->_chunkSize;
+    const int32 vertexCountEdge = chunkSize + 1;
+    const int32 heightMapSize = chunkSize * CHUNKS_COUNT_EDGE + 1;
+    TerrainDataUpdateInfo info;
+    info.ChunkSize = chunkSize;
+    info.VertexCountEdge = vertexCountEdge;
+    info.HeightmapSize = heightMapSize;
+    info.HeightmapLength = heightMapSize * heightMapSize;
+    info.TextureSize = vertexCountEdge * CHUNKS_COUNT_EDGE;
+    info.PatchOffset = _yOffset;
+    info.PatchHeight = _yHeight;
+
+    // Get the heightmap mip data (only the collision LOD is used)
+    TextureBase::InitData* initData;
+    TextureBase::InitData tmpData;
+#if TERRAIN_UPDATING
+    if (_dataHeightmap)
+    {
+        // Use the modified data
+        initData = _dataHeightmap;
+    }
+    else
+#endif
+    {
+        if (Heightmap->WaitForLoaded())
+        {
+            LOG(Warning, "Cannot create terrain coarse collision. Failed to load heightmap for terrain {0} patch {1}x{2}.", _terrain->ToString(), _x, _z);
+            return true;
+        }
+        const int32 lodCount = Heightmap->StreamingTexture()->TotalMipLevels();
+        const int32 lod = Math::Clamp(collisionLod, 0, lodCount - 1);
+        tmpData.Mips.Resize(lod + 1);
+        BytesContainer mipData;
+        Heightmap->GetMipDataWithLoading(lod, mipData);
+        if (mipData.IsInvalid())
+        {
+            LOG(Warning, "Cannot create terrain coarse collision. Failed to load heightmap mip {3} for terrain {0} patch {1}x{2}.", _terrain->ToString(), _x, _z, lod);
+            return true;
+        }
+        tmpData.Mips[lod].Data.Link(mipData);
+        initData = &tmpData;
+    }
+
+    // Generate physics backend height field data
+    return CookCollision(info, initData, collisionLod, &_coarseCollisionData);
+}
+
 #if TERRAIN_USE_PHYSICS_DEBUG
 
 void TerrainPatch::CacheDebugLines()
@@ -2539,7 +2662,21 @@ void TerrainPatch::Deserialize(DeserializeStream& stream, ISerializeModifier* mo
 
 void TerrainPatch::OnPhysicsSceneChanged(PhysicsScene* previous)
 {
-    PhysicsBackend::RemoveSceneActor(previous->GetPhysicsScene(), _physicsActor);
-    void* scene = _terrain->GetPhysicsScene()->GetPhysicsScene();
-    PhysicsBackend::AddSceneActor(scene, _physicsActor);
+    if (!_physicsActor)
+        return;
+    PhysicsBackend::RemoveSceneActor(_physicsScene->GetPhysicsScene(), _physicsActor);
+    _physicsScene = GetPhysicsScene();
+    PhysicsBackend::AddSceneActor(_physicsScene->GetPhysicsScene(), _physicsActor);
+}
+
+PhysicsScene* TerrainPatch::GetPhysicsScene() const
+{
+    PhysicsScene* scene = _terrain->GetPhysicsScene();
+    if (Physics::GetRegionsEnabled() && scene == Physics::DefaultScene)
+    {
+        // Place the patch collision in the physics region at the patch center
+        const float size = _terrain->_chunkSize * TERRAIN_UNITS_PER_VERTEX * CHUNKS_COUNT_EDGE;
+        scene = Physics::GetRegionScene(_terrain->_transform.LocalToWorld(_offset + Float3(size * 0.5f, 0.0f, size * 0.5f)));
+    }
+    return scene;
 }
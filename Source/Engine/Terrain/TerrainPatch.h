@@ -40,8 +40,11 @@ class FLAXENGINE_API TerrainPatch : public ISerializable
     void* _physicsShape;
     void* _physicsActor;
     void* _physicsHeightField;
+    PhysicsScene* _physicsScene;
     CriticalSection _collisionLocker;
     float _collisionScaleXZ;
+    bool _isStreamedOut = false;
+    Array<byte> _coarseCollisionData;
 #if TERRAIN_UPDATING
     Array<float> _cachedHeightMap;
     Array<byte> _cachedHolesMask;
@@ -132,6 +135,14 @@ class FLAXENGINE_API TerrainPatch : public ISerializable
         return _terrain;
     }
 
+    /// <summary>
+    /// Determines whether this patch is streamed out (far from the terrain streaming sources). Streamed out patch uses the coarse collision and the lower quality of the heightmap and splatmap textures.
+    /// </summary>
+    FORCE_INLINE bool IsStreamedOut() const
+    {
+        return _isStreamedOut;
+    }
+
     /// <summary>
     /// Gets the chunk at the given index.
     /// </summary>
@@ -398,6 +409,18 @@ class FLAXENGINE_API TerrainPatch : public ISerializable
     /// </summary>
     void DestroyCollision();
 
+    /// <summary>
+    /// Sets the patch streaming state. Swaps the collision between the full and the coarse one and limits the textures streaming quality to the mips used by the distant chunks.
+    /// </summary>
+    /// <param name="value">True if stream out the patch, otherwise false.</param>
+    void SetStreamedOut(bool value);
+
+    /// <summary>
+    /// Cooks the coarse collision data (from the lower heightmap mip) used by the streamed out patch.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool CookCoarseCollision();
+
 #if TERRAIN_USE_PHYSICS_DEBUG
 	void CacheDebugLines();
 	void DrawPhysicsDebug(RenderView& view);
@@ -410,6 +433,7 @@ class FLAXENGINE_API TerrainPatch : public ISerializable
     bool UpdateCollision();
 
     void OnPhysicsSceneChanged(PhysicsScene* previous);
+    PhysicsScene* GetPhysicsScene() const;
 public:
 
     // [ISerializable]
@@ -0,0 +1,67 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Animations/AnimationData.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Animation")
+{
+    SECTION("Test Compression")
+    {
+        AnimationData data;
+        data.Duration = 30.0;
+        data.FramesPerSecond = 30.0;
+        data.Channels.Resize(2);
+        auto& animated = data.Channels[0];
+        auto* position = animated.Position.Resize(2);
+        position[0] = LinearCurveKeyframe<Float3>(0.0f, Float3(0.0f, 10.0f, -50.0f));
+        position[1] = LinearCurveKeyframe<Float3>(30.0f, Float3(100.0f, 10.0f, 50.0f));
+        auto* rotation = animated.Rotation.Resize(2);
+        rotation[0] = LinearCurveKeyframe<Quaternion>(0.0f, Quaternion::Identity);
+        rotation[1] = LinearCurveKeyframe<Quaternion>(30.0f, Quaternion::Euler(0.0f, 90.0f, 0.0f));
+        auto& constant = data.Channels[1];
+        auto* scale = constant.Scale.Resize(1);
+        scale[0] = LinearCurveKeyframe<Float3>(0.0f, Float3(2.0f));
+
+        CompressedAnimationData compressed;
+        compressed.Compress(data);
+        CHECK(compressed.IsValid());
+        CHECK(compressed.FramesCount == 31);
+        CHECK(compressed.FrameStride == 7);
+
+        for (float time = 0.0f; time <= 30.0f; time += 0.7f)
+        {
+            Transform expected = Transform::Identity, actual = Transform::Identity;
+            data.Channels[0].Evaluate(time, &expected, false);
+            compressed.Evaluate(0, time, &actual);
+            CHECK(Vector3::Distance(expected.Translation, actual.Translation) < 0.01f);
+            CHECK(Quaternion::AngleBetween(expected.Orientation, actual.Orientation) < 0.1f);
+            CHECK(actual.Scale == Float3::One);
+            compressed.Evaluate(1, time, &actual);
+            CHECK(actual.Scale == Float3(2.0f));
+        }
+    }
+
+    SECTION("Test Curve Key Hint")
+    {
+        LinearCurveKeyframe<float> keyframes[4] =
+        {
+            LinearCurveKeyframe<float>(0.0f, 0.0f),
+            LinearCurveKeyframe<float>(1.0f, 10.0f),
+            LinearCurveKeyframe<float>(2.0f, 10.0f),
+            LinearCurveKeyframe<float>(4.0f, -10.0f),
+        };
+        CurveBase<float, LinearCurveKeyframe<float>> curve;
+        CurveBase<float, LinearCurveKeyframe<float>>::KeyFrameData data(keyframes, ARRAY_COUNT(keyframes));
+
+        // Evaluation with the cached key matches the full search when moving forward, backward and jumping over keys
+        int32 keyHint = -1;
+        const float times[] = { 0.0f, 0.3f, 0.9f, 1.0f, 1.5f, 2.7f, 4.0f, 5.0f, 0.5f, 3.9f, 1.2f, -1.0f, 2.0f };
+        for (float time : times)
+        {
+            float expected, actual;
+            curve.Evaluate(data, expected, time, false);
+            curve.Evaluate(data, actual, time, false, keyHint);
+            CHECK(Math::NearEqual(expected, actual));
+        }
+    }
+}
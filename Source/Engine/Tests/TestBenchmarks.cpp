@@ -0,0 +1,373 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/ObjectsRemovalService.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Content/Storage/ContentStorageManager.h"
+#include "Engine/Content/Storage/FlaxStorage.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/EmptyActor.h"
+#include "Engine/Networking/NetworkStream.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Renderer/RenderList.h"
+#include "Engine/Serialization/Json.h"
+#include "Engine/Threading/JobSystem.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+// Benchmarks are tagged as hidden so they run only when requested explicitly (eg. by FlaxBenchmarks target)
+#define BENCHMARK_TAGS "[.][benchmark]"
+
+namespace
+{
+    // Deterministic random numbers generator so every run uses the same input data
+    struct BenchmarkRandom
+    {
+        uint32 State = 0x9e3779b9;
+
+        uint32 Next()
+        {
+            State ^= State << 13;
+            State ^= State >> 17;
+            State ^= State << 5;
+            return State;
+        }
+
+        float NextFloat(float min, float max)
+        {
+            return min + (float)(Next() & 0xffffff) / (float)0xffffff * (max - min);
+        }
+    };
+}
+
+TEST_CASE("Benchmark Collections", BENCHMARK_TAGS)
+{
+    constexpr int32 count = 10000;
+    Array<int32> array;
+    Dictionary<int32, int32> dictionary;
+    BenchmarkRandom random;
+    for (int32 i = 0; i < count; i++)
+    {
+        const int32 value = (int32)random.Next();
+        array.Add(value);
+        dictionary[value] = i;
+    }
+
+    BENCHMARK("Array Add")
+    {
+        Array<int32> result;
+        for (int32 i = 0; i < count; i++)
+            result.Add(i);
+        return result.Count();
+    };
+    BENCHMARK("Array Find")
+    {
+        int32 result = 0;
+        for (int32 i = 0; i < count; i += 100)
+            result += array.Find(array[i]);
+        return result;
+    };
+    BENCHMARK("Array RemoveAtKeepOrder")
+    {
+        Array<int32> result(array);
+        while (result.Count() > count / 2)
+            result.RemoveAtKeepOrder(result.Count() / 2);
+        return result.Count();
+    };
+    BENCHMARK("Dictionary Add")
+    {
+        Dictionary<int32, int32> result;
+        for (int32 i = 0; i < count; i++)
+            result.Add(array[i], i);
+        return result.Count();
+    };
+    BENCHMARK("Dictionary Find")
+    {
+        int32 result = 0;
+        for (int32 i = 0; i < count; i++)
+        {
+            int32 value;
+            if (dictionary.TryGet(array[i], value))
+                result += value;
+        }
+        return result;
+    };
+    BENCHMARK("Dictionary Remove")
+    {
+        Dictionary<int32, int32> result(dictionary);
+        for (int32 i = 0; i < count; i++)
+            result.Remove(array[i]);
+        return result.Count();
+    };
+}
+
+TEST_CASE("Benchmark Sorting", BENCHMARK_TAGS)
+{
+    constexpr int32 count = 100000;
+    Array<int32> values;
+    Array<uint64> keys;
+    BenchmarkRandom random;
+    values.Resize(count);
+    keys.Resize(count);
+    for (int32 i = 0; i < count; i++)
+    {
+        values[i] = (int32)random.Next();
+        keys[i] = ((uint64)random.Next() << 32) | random.Next();
+    }
+
+    BENCHMARK_ADVANCED("QuickSort")(Catch::Benchmark::Chronometer meter)
+    {
+        Array<Array<int32>> data;
+        data.Resize(meter.runs());
+        for (auto& e : data)
+            e = values;
+        meter.measure([&](int32 run)
+        {
+            Sorting::QuickSort(data[run].Get(), count);
+        });
+    };
+    BENCHMARK_ADVANCED("RadixSort")(Catch::Benchmark::Chronometer meter)
+    {
+        Array<Array<uint64>> data;
+        data.Resize(meter.runs());
+        for (auto& e : data)
+            e = keys;
+        Array<int32> indices, tmpIndices;
+        Array<uint64> tmpKeys;
+        indices.Resize(count);
+        tmpIndices.Resize(count);
+        tmpKeys.Resize(count);
+        meter.measure([&](int32 run)
+        {
+            uint64* inputKeys = data[run].Get();
+            int32* inputValues = indices.Get();
+            Sorting::RadixSort(inputKeys, inputValues, tmpKeys.Get(), tmpIndices.Get(), count);
+        });
+    };
+    BENCHMARK_ADVANCED("RadixSortParallel")(Catch::Benchmark::Chronometer meter)
+    {
+        Array<Array<uint64>> data;
+        data.Resize(meter.runs());
+        for (auto& e : data)
+            e = keys;
+        Array<int32> indices, tmpIndices;
+        Array<uint64> tmpKeys;
+        indices.Resize(count);
+        tmpIndices.Resize(count);
+        tmpKeys.Resize(count);
+        meter.measure([&](int32 run)
+        {
+            uint64* inputKeys = data[run].Get();
+            int32* inputValues = indices.Get();
+            Sorting::RadixSortParallel(inputKeys, inputValues, tmpKeys.Get(), tmpIndices.Get(), count);
+        });
+    };
+}
+
+TEST_CASE("Benchmark JobSystem", BENCHMARK_TAGS)
+{
+    int64 volatile counter = 0;
+    Function<void(int32)> job = [&counter](int32 index)
+    {
+        Platform::InterlockedIncrement(&counter);
+    };
+
+    BENCHMARK("Dispatch Latency")
+    {
+        JobSystem::Wait(JobSystem::Dispatch(job, 1));
+    };
+    BENCHMARK("Dispatch 64 Jobs")
+    {
+        JobSystem::Wait(JobSystem::Dispatch(job, 64));
+    };
+    BENCHMARK("Dispatch 4096 Jobs")
+    {
+        JobSystem::Wait(JobSystem::Dispatch(job, 4096));
+    };
+}
+
+TEST_CASE("Benchmark Scene Serialization", BENCHMARK_TAGS)
+{
+    // Create test scene
+    constexpr int32 count = 1000;
+    Scene* scene = New<Scene>(ScriptingObjectSpawnParams(Guid::New(), Scene::TypeInitializer));
+    BenchmarkRandom random;
+    Actor* parent = scene;
+    for (int32 i = 0; i < count; i++)
+    {
+        auto actor = New<EmptyActor>();
+        actor->SetName(String::Format(TEXT("Actor {0}"), i));
+        actor->SetLocalPosition(Vector3(random.NextFloat(-1000, 1000), random.NextFloat(-1000, 1000), random.NextFloat(-1000, 1000)));
+        actor->SetLocalOrientation(Quaternion::Euler(random.NextFloat(0, 360), random.NextFloat(0, 360), 0));
+        actor->SetParent(i % 10 == 0 ? scene : parent, false);
+        if (i % 10 == 0)
+            parent = actor;
+    }
+
+    rapidjson_flax::StringBuffer data;
+    BENCHMARK("Serialize")
+    {
+        data.Clear();
+        return Level::SaveSceneToBytes(scene, data, false);
+    };
+    REQUIRE(data.GetSize() != 0);
+    scene->DeleteObjectNow();
+
+    const BytesContainer bytes((const byte*)data.GetString(), (int32)data.GetSize());
+    BENCHMARK("Deserialize")
+    {
+        Scene* loaded = Level::LoadSceneFromBytes(bytes);
+        if (loaded)
+            Level::UnloadScene(loaded);
+        ObjectsRemovalService::ForceFlush();
+        return loaded != nullptr;
+    };
+}
+
+TEST_CASE("Benchmark FlaxStorage", BENCHMARK_TAGS)
+{
+    // Create test package with a few chunks of data
+    constexpr int32 chunksCount = 4;
+    constexpr int32 chunkSize = 1024 * 1024;
+    const String path = Globals::TemporaryFolder / TEXT("Benchmark.flax");
+    {
+        AssetInitData initData;
+        initData.Header.ID = Guid::New();
+        initData.Header.TypeName = TEXT("FlaxEngine.BinaryAsset");
+        for (int32 i = 0; i < chunksCount; i++)
+        {
+            auto chunk = New<FlaxChunk>();
+            chunk->Data.Allocate(chunkSize);
+            for (int32 j = 0; j < chunkSize; j++)
+                chunk->Data.Get()[j] = (byte)(j * 31 + i);
+            initData.Header.Chunks[i] = chunk;
+        }
+        const bool failed = FlaxStorage::Create(path, initData, true);
+        initData.Header.DeleteChunks();
+        REQUIRE(!failed);
+    }
+    {
+        FlaxStorageReference storage = ContentStorageManager::GetStorage(path);
+        REQUIRE(storage);
+        AssetInitData initData;
+        REQUIRE(!storage->LoadAssetHeader(0, initData));
+
+        BENCHMARK("Load Chunks")
+        {
+            for (int32 i = 0; i < chunksCount; i++)
+            {
+                FlaxChunk* chunk = initData.Header.Chunks[i];
+                chunk->Unload();
+                storage->LoadAssetChunk(chunk);
+            }
+            return initData.Header.Chunks[0]->Size();
+        };
+    }
+    ContentStorageManager::EnsureAccess(path);
+    FileSystem::DeleteFile(path);
+}
+
+TEST_CASE("Benchmark RenderList", BENCHMARK_TAGS)
+{
+    MaterialBase* material = GPUDevice::Instance ? GPUDevice::Instance->GetDefaultMaterial() : nullptr;
+    if (!material || !material->IsLoaded())
+    {
+        WARN("Missing default material.");
+        return;
+    }
+
+    // Generate draw calls with a limited amount of unique geometry to test batching
+    constexpr int32 count = 10000;
+    constexpr int32 geometryCount = 64;
+    Array<DrawCall> drawCalls;
+    drawCalls.Resize(count);
+    BenchmarkRandom random;
+    for (int32 i = 0; i < count; i++)
+    {
+        DrawCall& drawCall = drawCalls[i];
+        Platform::MemoryClear(&drawCall, sizeof(DrawCall));
+        drawCall.Material = material;
+        drawCall.Geometry.IndexBuffer = (GPUBuffer*)(uintptr)((random.Next() % geometryCount + 1) * 256);
+        drawCall.Geometry.VertexBuffers[0] = (GPUBuffer*)(uintptr)((uintptr)drawCall.Geometry.IndexBuffer + 64);
+        drawCall.ObjectPosition = Float3(random.NextFloat(-1000, 1000), random.NextFloat(-1000, 1000), random.NextFloat(0, 2000));
+        drawCall.InstanceCount = 1;
+        drawCall.WorldDeterminantSign = 1.0f;
+    }
+    RenderContext renderContext;
+    renderContext.List = RenderList::GetFromPool();
+    renderContext.View.Position = Float3::Zero;
+    renderContext.View.Direction = Float3::Forward;
+    const DrawPass drawModes = material->GetDrawModes() & (DrawPass::Depth | DrawPass::GBuffer);
+
+    BENCHMARK("Add Draw Calls")
+    {
+        renderContext.List->Clear();
+        for (int32 i = 0; i < count; i++)
+            renderContext.List->AddDrawCall(renderContext, drawModes, StaticFlags::None, drawCalls[i]);
+        return renderContext.List->DrawCalls.Count();
+    };
+    BENCHMARK("Sort And Batch")
+    {
+        renderContext.List->SortDrawCalls(renderContext, false, DrawCallsListType::GBuffer);
+        return renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].Batches.Count();
+    };
+
+    renderContext.List->Clear();
+    RenderList::ReturnToPool(renderContext.List);
+}
+
+TEST_CASE("Benchmark NetworkStream", BENCHMARK_TAGS)
+{
+    // Typical replication payload: transform with some properties
+    constexpr int32 count = 10000;
+    NetworkStream* stream = New<NetworkStream>();
+    stream->Initialize(count * 64);
+    const Vector3 position(100, -200, 300);
+    const Quaternion rotation = Quaternion::Euler(10, 45, -30);
+
+    BENCHMARK("Write")
+    {
+        stream->Initialize(count * 64);
+        for (int32 i = 0; i < count; i++)
+        {
+            stream->WriteInt32(i);
+            stream->WriteBytes(&position, sizeof(position));
+            stream->WriteBytes(&rotation, sizeof(rotation));
+            stream->WriteVarUInt32((uint32)i);
+            stream->WriteQuantizedVector3(position, Vector3(-1000), Vector3(1000), 16);
+            stream->WriteQuantizedQuaternion(rotation);
+        }
+        return stream->GetPosition();
+    };
+
+    Array<byte> data;
+    data.Set(stream->GetBuffer(), (int32)stream->GetPosition());
+    NetworkStream* reader = New<NetworkStream>();
+    BENCHMARK("Read")
+    {
+        reader->Initialize(data.Get(), data.Count());
+        int32 value;
+        Vector3 vector;
+        Quaternion quaternion;
+        for (int32 i = 0; i < count; i++)
+        {
+            reader->ReadInt32(&value);
+            reader->ReadBytes(&vector, sizeof(vector));
+            reader->ReadBytes(&quaternion, sizeof(quaternion));
+            value += (int32)reader->ReadVarUInt32();
+            vector += reader->ReadQuantizedVector3(Vector3(-1000), Vector3(1000), 16);
+            quaternion = reader->ReadQuantizedQuaternion();
+        }
+        return value + vector.X + quaternion.X;
+    };
+
+    Delete(reader);
+    Delete(stream);
+}
@@ -3,6 +3,10 @@
 #include "Engine/Core/RandomStream.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/BitArray.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
+#include "Engine/Core/Memory/FrameAllocation.h"
+#include "Engine/Core/Log.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("Array")
@@ -12,20 +16,42 @@ TEST_CASE("Array")
         Array<int32> a1;
         Array<int32, InlinedAllocation<8>> a2;
         Array<int32, FixedAllocation<8>> a3;
+        Array<int32, FrameAllocation> a4;
         for (int32 i = 0; i < 7; i++)
         {
             a1.Add(i);
             a2.Add(i);
             a3.Add(i);
+            a4.Add(i);
         }
         CHECK(a1.Count() == 7);
         CHECK(a2.Count() == 7);
         CHECK(a3.Count() == 7);
+        CHECK(a4.Count() == 7);
         for (int32 i = 0; i < 7; i++)
         {
             CHECK(a1[i] == i);
             CHECK(a2[i] == i);
             CHECK(a3[i] == i);
+            CHECK(a4[i] == i);
+        }
+    }
+
+    SECTION("Test Frame Allocation")
+    {
+        Array<int32, FrameAllocation> a1;
+        Array<int32, InlinedAllocation<8, FrameAllocation>> a2;
+        for (int32 i = 0; i < 100000; i++)
+        {
+            a1.Add(i);
+            a2.Add(i);
+        }
+        CHECK(a1.Count() == 100000);
+        CHECK(a2.Count() == 100000);
+        for (int32 i = 0; i < a1.Count(); i++)
+        {
+            CHECK(a1[i] == i);
+            CHECK(a2[i] == i);
         }
     }
 
@@ -108,3 +134,122 @@ TEST_CASE("BitArray")
         CHECK(a1 == testData);
     }
 }
+
+TEST_CASE("FlatDictionary")
+{
+    SECTION("Test Allocators")
+    {
+        FlatDictionary<int32, int32> a1;
+        FlatDictionary<int32, int32, InlinedAllocation<16>> a2;
+        FlatDictionary<int32, int32, FixedAllocation<32>> a3(32);
+        for (int32 i = 0; i < 7; i++)
+        {
+            a1.Add(i, i * 10);
+            a2.Add(i, i * 10);
+            a3.Add(i, i * 10);
+        }
+        CHECK(a1.Count() == 7);
+        CHECK(a2.Count() == 7);
+        CHECK(a3.Count() == 7);
+        for (int32 i = 0; i < 7; i++)
+        {
+            CHECK(a1[i] == i * 10);
+            CHECK(a2[i] == i * 10);
+            CHECK(a3[i] == i * 10);
+        }
+    }
+
+    SECTION("Test Against Dictionary")
+    {
+        // Random operations have to match the results of the Dictionary
+        Dictionary<int32, int32> expected;
+        FlatDictionary<int32, int32> actual;
+        RandomStream rand(101);
+        for (int32 i = 0; i < 20000; i++)
+        {
+            const int32 key = rand.RandRange(0, 2000);
+            switch (rand.RandRange(0, 3))
+            {
+            case 0:
+                expected[key] = i;
+                actual[key] = i;
+                break;
+            case 1:
+                CHECK(expected.Remove(key) == actual.Remove(key));
+                break;
+            default:
+            {
+                int32 a = -1, b = -1;
+                CHECK(expected.TryGet(key, a) == actual.TryGet(key, b));
+                CHECK(a == b);
+                break;
+            }
+            }
+        }
+        CHECK(expected.Count() == actual.Count());
+        int32 count = 0;
+        for (const auto& e : actual)
+        {
+            CHECK(expected.ContainsKey(e.Key));
+            CHECK(expected[e.Key] == e.Value);
+            count++;
+        }
+        CHECK(count == actual.Count());
+    }
+
+    SECTION("Test Copy And Move")
+    {
+        FlatDictionary<int32, String> a1;
+        for (int32 i = 0; i < 100; i++)
+            a1.Add(i, String::Format(TEXT("{0}"), i));
+        FlatDictionary<int32, String> a2(a1);
+        CHECK(a2.Count() == a1.Count());
+        CHECK(a2[42] == TEXT("42"));
+        FlatDictionary<int32, String> a3(MoveTemp(a2));
+        CHECK(a2.IsEmpty());
+        CHECK(a3.Count() == 100);
+        CHECK(a3[99] == TEXT("99"));
+        a3.Clear();
+        CHECK(a3.IsEmpty());
+        CHECK(a3.Begin() == a3.End());
+    }
+}
+
+// Microbenchmark of the FlatDictionary against the Dictionary (hidden by default, run with [benchmark] tag)
+TEST_CASE("FlatDictionary Benchmark", "[.][benchmark]")
+{
+    constexpr int32 count = 1 << 20;
+    Array<void*> keys;
+    keys.Resize(count);
+    RandomStream rand(101);
+    for (int32 i = 0; i < count; i++)
+        keys[i] = (void*)(((uintptr)rand.GetUnsignedInt() << 16 ^ (uintptr)rand.GetUnsignedInt()) * 16);
+
+    auto run = [&keys](auto& dictionary, const Char* name)
+    {
+        const double startTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < count; i++)
+            dictionary[keys[i]] = i;
+        const double insertTime = Platform::GetTimeSeconds();
+        int64 sum = 0;
+        for (int32 i = 0; i < count; i++)
+        {
+            if (const int32* value = dictionary.TryGet(keys[(int32)(((uint32)i * 7919u) & (count - 1))]))
+                sum += *value;
+        }
+        const double findTime = Platform::GetTimeSeconds();
+        for (int32 i = 0; i < count; i++)
+        {
+            if (const int32* value = dictionary.TryGet((byte*)keys[i] + 8))
+                sum += *value;
+        }
+        const double missTime = Platform::GetTimeSeconds();
+        LOG(Info, "{0}: insert {1}ms, find {2}ms, find missing {3}ms ({4})", name, (int32)((insertTime - startTime) * 1000.0), (int32)((findTime - insertTime) * 1000.0), (int32)((missTime - findTime) * 1000.0), sum);
+    };
+
+    Dictionary<void*, int32> dictionary;
+    run(dictionary, TEXT("Dictionary"));
+    FlatDictionary<void*, int32> flatDictionary;
+    run(flatDictionary, TEXT("FlatDictionary"));
+    CHECK(dictionary.Count() == flatDictionary.Count());
+}
@@ -5,6 +5,9 @@
 #include "Engine/Core/Types/StringView.h"
 #include "Engine/Level/LargeWorlds.h"
 #include "Engine/Level/Tags.h"
+#include "Engine/Level/Scene/SceneRenderingOctree.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/Matrix.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("LargeWorlds")
@@ -18,6 +21,67 @@ TEST_CASE("LargeWorlds")
         LargeWorlds::UpdateOrigin(origin, Vector3(LargeWorlds::ChunkSize * 0.5, LargeWorlds::ChunkSize * 1.0001, LargeWorlds::ChunkSize * 1.5));
         CHECK(origin == Vector3(0, 0, LargeWorlds::ChunkSize * 1));
     }
+
+    SECTION("RebaseOrigin")
+    {
+        LargeWorlds::Enable = true;
+        LargeWorlds::SetOrigin(Vector3::Zero);
+        LargeWorlds::RebaseOrigin(Vector3(LargeWorlds::ChunkSize * 0.9, 0, 0));
+        CHECK(LargeWorlds::GetOrigin() == Vector3::Zero);
+        LargeWorlds::RebaseOrigin(Vector3(LargeWorlds::ChunkSize * 1.2, 0, -LargeWorlds::ChunkSize * 2.6));
+        CHECK(LargeWorlds::GetOrigin() == Vector3(LargeWorlds::ChunkSize, 0, -LargeWorlds::ChunkSize * 3));
+        LargeWorlds::RebaseOrigin(Vector3(LargeWorlds::ChunkSize * 1.6, 0, -LargeWorlds::ChunkSize * 3));
+        CHECK(LargeWorlds::GetOrigin() == Vector3(LargeWorlds::ChunkSize, 0, -LargeWorlds::ChunkSize * 3));
+        LargeWorlds::SetOrigin(Vector3::Zero);
+    }
+}
+
+TEST_CASE("SceneRenderingOctree")
+{
+    SECTION("Query")
+    {
+        // Grid of objects with various sizes
+        SceneRenderingOctree octree;
+        Array<BoundingSphere> objects;
+        for (int32 x = -20; x < 20; x++)
+        {
+            for (int32 z = -20; z < 20; z++)
+            {
+                const BoundingSphere sphere(Vector3(x * 500.0f, 0, z * 500.0f), (Real)(10 + (x * 7 + z * 13) % 300));
+                octree.Add(objects.Count(), sphere, false);
+                objects.Add(sphere);
+            }
+        }
+        const BoundingSphere unculled(Vector3(1e9f), 1.0f);
+        octree.Add(objects.Count(), unculled, true);
+        objects.Add(unculled);
+
+        // Move some objects around
+        for (int32 i = 0; i < objects.Count() - 1; i += 7)
+        {
+            objects[i].Center += Vector3(3000.0f, 0, -1200.0f);
+            objects[i].Radius *= 3;
+            octree.Update(i, objects[i]);
+        }
+        octree.Remove(5);
+
+        Matrix view, projection;
+        Matrix::LookAt(Float3(0, 100, -1000), Float3(0, 100, 0), Float3::Up, view);
+        Matrix::PerspectiveFov(60.0f * DegreesToRadians, 1.0f, 10.0f, 3000.0f, projection);
+        const BoundingFrustum frustum(view * projection);
+        Array<int32> keys;
+        octree.Query(&frustum, 1, Vector3::Zero, keys);
+
+        // Query has to be conservative (contain all visible objects) but skip the most of the others
+        for (int32 i = 0; i < objects.Count() - 1; i++)
+        {
+            if (i != 5 && frustum.Intersects(objects[i]))
+                CHECK(keys.Contains(i));
+        }
+        CHECK(keys.Contains(objects.Count() - 1));
+        CHECK(!keys.Contains(5));
+        CHECK(keys.Count() < objects.Count() / 2);
+    }
 }
 
 TEST_CASE("Tags")
@@ -5,6 +5,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
 #include "Engine/Scripting/Scripting.h"
 #include "Editor/Scripting/ScriptsBuilder.h"
 
@@ -41,8 +42,21 @@ void TestsRunnerService::Update()
 
     // Runs tests
     Log::Logger::WriteFloor();
+#if FLAX_BENCHMARKS
+    // Run only benchmarks and write results to the xml file that can be compared between engine versions
+    LOG(Info, "Running Flax Benchmarks...");
+    const StringAnsi name = StringAnsi("FlaxEngine ") + Globals::EngineVersion.ToStringAnsi();
+    const StringAnsi output = (Globals::ProjectFolder / TEXT("Benchmarks.xml")).ToStringAnsi();
+    LOG(Info, "Benchmark results: {0}", String(output));
+    const char* args[] = { "FlaxBenchmarks", "[benchmark]", "--name", name.Get(), "--reporter", "xml", "--out", output.Get() };
+    Catch::Session session;
+    int result = session.applyCommandLine(ARRAY_COUNT(args), args);
+    if (result == 0)
+        result = session.run();
+#else
     LOG(Info, "Running Flax Tests...");
     const int result = Catch::Session().run();
+#endif
     if (result == 0)
         LOG(Info, "Result: {0}", result);
     else
@@ -1,6 +1,9 @@
 // Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
 
 #include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/BoundingSphere.h"
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Vector4.h"
@@ -226,3 +229,87 @@ TEST_CASE("Transform")
         }
     }
 }
+
+TEST_CASE("Math Batch")
+{
+    SECTION("Test Matrix Multiply")
+    {
+        RandomStream rand(10);
+        Matrix left[5], right[5], result[5];
+        for (int32 i = 0; i < ARRAY_COUNT(left); i++)
+        {
+            for (int32 j = 0; j < 16; j++)
+            {
+                left[i].Raw[j] = rand.GetFraction() * 10.0f;
+                right[i].Raw[j] = rand.GetFraction() * 10.0f;
+            }
+        }
+
+        Matrix::Multiply(left, right, result, ARRAY_COUNT(left));
+        for (int32 i = 0; i < ARRAY_COUNT(left); i++)
+            CHECK(Matrix::Multiply(left[i], right[i]) == result[i]);
+
+        Matrix::Multiply(left, right[0], result, ARRAY_COUNT(left));
+        for (int32 i = 0; i < ARRAY_COUNT(left); i++)
+            CHECK(Matrix::Multiply(left[i], right[0]) == result[i]);
+    }
+    SECTION("Test Local To World")
+    {
+        Transform t1(Vector3(10, 1, 10), Quaternion::Euler(45, 0, -15), Float3(1.5f, 0.5f, 0.1f));
+        RandomStream rand(10);
+        Vector3 points[7], result[7];
+        for (int32 i = 0; i < ARRAY_COUNT(points); i++)
+            points[i] = rand.GetVector3() * 100.0f;
+
+        t1.LocalToWorld(points, ARRAY_COUNT(points), result);
+        for (int32 i = 0; i < ARRAY_COUNT(points); i++)
+            CHECK(Vector3::NearEqual(t1.LocalToWorld(points[i]), result[i], 0.001f));
+    }
+    SECTION("Test Bounds Transform")
+    {
+        Matrix world;
+        Transform(Vector3(10, 1, 10), Quaternion::Euler(45, 0, -15), Float3(1.5f, 0.5f, 0.1f)).GetWorld(world);
+        RandomStream rand(10);
+        BoundingSphere spheres[7], spheresResult[7];
+        BoundingBox boxes[7], boxesResult[7];
+        for (int32 i = 0; i < ARRAY_COUNT(spheres); i++)
+        {
+            spheres[i] = BoundingSphere(rand.GetVector3() * 100.0f, rand.GetFraction() * 10.0f);
+            boxes[i] = BoundingBox(rand.GetVector3() * -10.0f, rand.GetVector3() * 10.0f);
+        }
+
+        BoundingSphere::Transform(spheres, ARRAY_COUNT(spheres), world, spheresResult);
+        BoundingBox::Transform(boxes, ARRAY_COUNT(boxes), world, boxesResult);
+        for (int32 i = 0; i < ARRAY_COUNT(spheres); i++)
+        {
+            BoundingSphere sphere;
+            BoundingSphere::Transform(spheres[i], world, sphere);
+            CHECK(Vector3::NearEqual(sphere.Center, spheresResult[i].Center, 0.001f));
+            CHECK(Math::NearEqual(sphere.Radius, spheresResult[i].Radius));
+            BoundingBox box;
+            BoundingBox::Transform(boxes[i], world, box);
+            CHECK(Vector3::NearEqual(box.Minimum, boxesResult[i].Minimum, 0.001f));
+            CHECK(Vector3::NearEqual(box.Maximum, boxesResult[i].Maximum, 0.001f));
+        }
+    }
+    SECTION("Test Frustum Intersects")
+    {
+        Matrix view, projection;
+        Matrix::LookAt(Float3(0, 0, -50), Float3::Zero, Float3::Up, view);
+        Matrix::PerspectiveFov(1.0f, 1.0f, 1.0f, 100.0f, projection);
+        BoundingFrustum frustums[2] = { BoundingFrustum(view * projection), BoundingFrustum(Matrix::Translation(Float3(30, 0, 0)) * view * projection) };
+        RandomStream rand(10);
+        BoundingSphere spheres[103];
+        bool results[103];
+        for (int32 i = 0; i < ARRAY_COUNT(spheres); i++)
+            spheres[i] = BoundingSphere(rand.GetVector3() * 160.0f - 80.0f, rand.GetFraction() * 5.0f);
+
+        BoundingFrustum::Intersects(frustums, ARRAY_COUNT(frustums), spheres, ARRAY_COUNT(spheres), results);
+        for (int32 i = 0; i < ARRAY_COUNT(spheres); i++)
+            CHECK((frustums[0].Intersects(spheres[i]) || frustums[1].Intersects(spheres[i])) == results[i]);
+
+        frustums[0].Intersects(spheres, ARRAY_COUNT(spheres), results);
+        for (int32 i = 0; i < ARRAY_COUNT(spheres); i++)
+            CHECK(frustums[0].Intersects(spheres[i]) == results[i]);
+    }
+}
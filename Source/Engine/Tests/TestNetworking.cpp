@@ -0,0 +1,42 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Networking/NetworkStream.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("Networking")
+{
+    SECTION("Test Stream Bits")
+    {
+        NetworkStream* stream = New<NetworkStream>();
+        stream->Initialize();
+        stream->WriteBit(true);
+        stream->WriteBit(false);
+        stream->WriteBits(5, 3);
+        stream->WriteBits(0xabcdef, 24);
+        stream->WriteInt32(-123);
+        stream->WriteVarUInt32(300);
+        stream->WriteVarInt32(-2);
+        stream->WriteQuantizedFloat(0.25f, 0.0f, 1.0f, 8);
+        stream->WriteQuantizedVector3(Vector3(10, -20, 30), Vector3(-100), Vector3(100), 16);
+        const Quaternion rotation = Quaternion::Euler(10, 45, -30);
+        stream->WriteQuantizedQuaternion(rotation);
+        const uint32 size = stream->GetPosition();
+        CHECK(size == 4 + 4 + 2 + 1 + 1 + 6 + 4);
+
+        stream->Initialize(stream->GetBuffer(), size);
+        CHECK(stream->ReadBit() == true);
+        CHECK(stream->ReadBit() == false);
+        CHECK(stream->ReadBits(3) == 5);
+        CHECK(stream->ReadBits(24) == 0xabcdef);
+        int32 value;
+        stream->ReadInt32(&value);
+        CHECK(value == -123);
+        CHECK(stream->ReadVarUInt32() == 300);
+        CHECK(stream->ReadVarInt32() == -2);
+        CHECK(Math::NearEqual(stream->ReadQuantizedFloat(0.0f, 1.0f, 8), 0.25f, 1.0f / 255.0f));
+        CHECK(Vector3::NearEqual(stream->ReadQuantizedVector3(Vector3(-100), Vector3(100), 16), Vector3(10, -20, 30), 0.01f));
+        CHECK(Math::Abs(Quaternion::Dot(stream->ReadQuantizedQuaternion(), rotation)) > 0.999f);
+        CHECK(stream->GetPosition() == size);
+        Delete(stream);
+    }
+}
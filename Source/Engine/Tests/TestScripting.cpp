@@ -5,6 +5,9 @@
 #include "Engine/Scripting/ManagedCLR/MClass.h"
 #include "Engine/Scripting/ManagedCLR/MMethod.h"
 #include "Engine/Scripting/ManagedCLR/MUtils.h"
+#include "Engine/Serialization/ISerializeModifier.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TestClassNative::TestClassNative(const SpawnParams& params)
@@ -151,4 +154,80 @@ TEST_CASE("Scripting")
         CHECK(interfaceObject);
         CHECK(interfaceObject == object);
     }
+
+    SECTION("Test Objects Registry")
+    {
+        ScriptingObject* object = Scripting::NewObject(TestClassNative::TypeInitializer);
+        CHECK(object);
+        if (!object->IsRegistered())
+            object->RegisterObject();
+
+        // Test lookup by ID and by registry handle
+        const uint64 handle = object->GetRegistryHandle();
+        CHECK(handle != 0);
+        CHECK(Scripting::TryFindObject(object->GetID()) == object);
+        CHECK(Scripting::FindObjectByHandle(handle) == object);
+
+        // Test ID change (handle stays the same)
+        const Guid oldId = object->GetID();
+        object->ChangeID(Guid::New());
+        CHECK(Scripting::TryFindObject(oldId) == nullptr);
+        CHECK(Scripting::TryFindObject(object->GetID()) == object);
+        CHECK(Scripting::FindObjectByHandle(handle) == object);
+
+        // Test stale handle after unregister (slot reuse must not resolve old handle)
+        object->UnregisterObject();
+        CHECK(object->GetRegistryHandle() == 0);
+        CHECK(Scripting::FindObjectByHandle(handle) == nullptr);
+        CHECK(Scripting::TryFindObject(object->GetID()) == nullptr);
+        object->RegisterObject();
+        CHECK(object->GetRegistryHandle() != handle);
+        CHECK(Scripting::FindObjectByHandle(handle) == nullptr);
+        CHECK(Scripting::FindObjectByHandle(object->GetRegistryHandle()) == object);
+        CHECK(Scripting::FindObjectByHandle(0) == nullptr);
+    }
+
+    SECTION("Test Binary Serialization")
+    {
+        ScriptingObject* object = Scripting::NewObject(TestClassNative::TypeInitializer);
+        CHECK(object);
+        TestClassNative* testClass = (TestClassNative*)object;
+        if (!testClass->IsRegistered())
+            testClass->RegisterObject();
+        testClass->SimpleField = 10;
+        testClass->SimpleStruct.Vector = Float3::UnitZ;
+        testClass->SimpleStruct.Object = testClass;
+
+        // Test full round-trip
+        MemoryWriteStream writeStream;
+        testClass->SerializeBinary(writeStream, nullptr);
+        TestClassNative* testClass2 = (TestClassNative*)Scripting::NewObject(TestClassNative::TypeInitializer);
+        CHECK(testClass2);
+        ISerializeModifier modifier;
+        {
+            MemoryReadStream readStream(writeStream.GetHandle(), writeStream.GetPosition());
+            testClass2->DeserializeBinary(readStream, &modifier);
+            CHECK(readStream.GetPosition() == writeStream.GetPosition());
+        }
+        CHECK(testClass2->SimpleField == 10);
+        CHECK(testClass2->SimpleStruct.Vector == Float3::UnitZ);
+        CHECK(testClass2->SimpleStruct.Object == testClass);
+
+        // Test diff against other object (unmodified members are not stored) and objects ids mapping
+        testClass->SimpleStruct.Object = testClass2;
+        writeStream.SetPosition(0);
+        testClass->SerializeBinary(writeStream, testClass2);
+        TestClassNative* testClass3 = (TestClassNative*)Scripting::NewObject(TestClassNative::TypeInitializer);
+        CHECK(testClass3);
+        if (!testClass3->IsRegistered())
+            testClass3->RegisterObject();
+        modifier.IdsMapping[testClass2->GetID()] = testClass3->GetID();
+        {
+            MemoryReadStream readStream(writeStream.GetHandle(), writeStream.GetPosition());
+            testClass3->DeserializeBinary(readStream, &modifier);
+        }
+        CHECK(testClass3->SimpleField == 1);
+        CHECK(testClass3->SimpleStruct.Vector == Float3::One);
+        CHECK(testClass3->SimpleStruct.Object == testClass3);
+    }
 }
@@ -0,0 +1,123 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "Engine/Visject/VisjectGraph.h"
+#include "Engine/Visject/VisjectProgram.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    void SetupNode(VisjectGraphNode<>& node, uint16 groupId, uint16 typeId, int32 boxesCount)
+    {
+        node.GroupID = groupId;
+        node.TypeID = typeId;
+        node.Boxes.Resize(boxesCount);
+        for (int32 i = 0; i < boxesCount; i++)
+        {
+            node.Boxes[i].Parent = &node;
+            node.Boxes[i].ID = (byte)i;
+        }
+    }
+
+    void Connect(VisjectGraphBox& output, VisjectGraphBox& input)
+    {
+        output.Connections.Add(&input);
+        input.Connections.Add(&output);
+    }
+}
+
+TEST_CASE("Visject")
+{
+    SECTION("Test Program")
+    {
+        // Parameter * 2 > 3
+        VisjectGraph<> graph;
+        graph.Parameters.Resize(1);
+        auto& param = graph.Parameters[0];
+        param.Type = VariantType(VariantType::Float);
+        param.Identifier = Guid(1, 2, 3, 4);
+        graph.Nodes.Resize(3);
+        auto& getParam = graph.Nodes[0];
+        SetupNode(getParam, 6, 1, 1);
+        getParam.Values.Add(Variant(param.Identifier));
+        auto& multiply = graph.Nodes[1];
+        SetupNode(multiply, 3, 3, 3);
+        multiply.Values.Add(Variant(0.0f));
+        multiply.Values.Add(Variant(2.0f));
+        auto& greater = graph.Nodes[2];
+        SetupNode(greater, 12, 3, 3);
+        greater.Values.Add(Variant(0.0f));
+        greater.Values.Add(Variant(3.0f));
+        Connect(getParam.Boxes[0], multiply.Boxes[0]);
+        Connect(multiply.Boxes[2], greater.Boxes[0]);
+
+        VisjectProgram program;
+        CHECK(!program.Compile(&greater.Boxes[2], graph));
+        CHECK(program.GetInstructionsCount() == 2);
+        param.Value = 1.0f;
+        CHECK(program.Execute(graph.Parameters) == Variant(false));
+        param.Value = 2.0f;
+        CHECK(program.Execute(graph.Parameters) == Variant(true));
+
+        VisjectProgram math;
+        CHECK(!math.Compile(&multiply.Boxes[2], graph));
+        CHECK(math.Execute(graph.Parameters) == Variant(4.0f));
+
+        // Input boxes and vector math are not compiled
+        CHECK(math.Compile(&multiply.Boxes[0], graph));
+        multiply.Values[1] = Float3::One;
+        CHECK(math.Compile(&multiply.Boxes[2], graph));
+    }
+
+    SECTION("Test Constant Program")
+    {
+        // (2 + 3) > 4
+        VisjectGraph<> graph;
+        graph.Nodes.Resize(2);
+        auto& add = graph.Nodes[0];
+        SetupNode(add, 3, 1, 3);
+        add.Values.Add(Variant(2.0f));
+        add.Values.Add(Variant(3.0f));
+        auto& greater = graph.Nodes[1];
+        SetupNode(greater, 12, 3, 3);
+        greater.Values.Add(Variant(0.0f));
+        greater.Values.Add(Variant(4.0f));
+        Connect(add.Boxes[2], greater.Boxes[0]);
+
+        VisjectProgram program;
+        CHECK(!program.Compile(&greater.Boxes[2], graph));
+        CHECK(program.IsConstant());
+        CHECK(program.GetConstant() == Variant(true));
+        CHECK(program.Execute(graph.Parameters) == Variant(true));
+    }
+
+    SECTION("Test Compile Programs")
+    {
+        // Parameter Get node type differs between the graph types
+        VisjectGraph<> graph;
+        graph.Parameters.Resize(1);
+        auto& param = graph.Parameters[0];
+        param.Type = VariantType(VariantType::Float);
+        param.Identifier = Guid(1, 2, 3, 4);
+        param.Value = 3.0f;
+        graph.Nodes.Resize(3);
+        auto& getParam = graph.Nodes[0];
+        SetupNode(getParam, 6, 2, 1);
+        getParam.Values.Add(Variant(param.Identifier));
+        auto& multiply = graph.Nodes[1];
+        SetupNode(multiply, 3, 3, 3);
+        multiply.Values.Add(Variant(0.0f));
+        multiply.Values.Add(Variant(2.0f));
+        auto& user = graph.Nodes[2];
+        SetupNode(user, 7, 1, 1);
+        Connect(getParam.Boxes[0], multiply.Boxes[0]);
+        Connect(multiply.Boxes[2], user.Boxes[0]);
+
+        graph.CompilePrograms(graph, 1);
+        CHECK(graph.Programs.Count() == 0);
+        graph.CompilePrograms(graph, 2);
+        CHECK(graph.Programs.Count() == 1);
+        CHECK(multiply.Boxes[2].Program != nullptr);
+        CHECK(!multiply.Boxes[2].Program->IsConstant());
+        CHECK(multiply.Boxes[2].Program->Execute(graph.Parameters) == Variant(6.0f));
+    }
+}
@@ -21,6 +21,9 @@ public override void Setup(BuildOptions options)
         base.Setup(options);
 
         options.PrivateDependencies.Add("ModelTool");
+
+        // Benchmarks are hidden from the regular tests run (see FlaxBenchmarks target)
+        options.PrivateDefinitions.Add("CATCH_CONFIG_ENABLE_BENCHMARKING");
     }
 
     /// <inheritdoc />
@@ -2,34 +2,35 @@
 
 #include "JobSystem.h"
 #include "IRunnable.h"
+#include "WorkerThreadCounters.h"
 #include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/CPUTopology.h"
 #include "Engine/Platform/Thread.h"
 #include "Engine/Platform/ConditionVariable.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerCounters.h"
 #if USE_CSHARP
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #endif
 
 // Jobs storage perf info:
 // (500 jobs, i7 9th gen)
-// JOB_SYSTEM_USE_MUTEX=1, enqueue=130-280 cycles, dequeue=2-6 cycles
-// JOB_SYSTEM_USE_MUTEX=0, enqueue=300-700 cycles, dequeue=10-16 cycles
-// So using RingBuffer+Mutex+Signals is better than moodycamel::ConcurrentQueue
+// RingBuffer+Mutex, enqueue=130-280 cycles, dequeue=2-6 cycles
+// moodycamel::ConcurrentQueue, enqueue=300-700 cycles, dequeue=10-16 cycles
+// So using RingBuffer+Mutex+Signals is better than moodycamel::ConcurrentQueue.
+// Each worker thread owns a local jobs queue (jobs dispatched from within the job go there and are executed in LIFO order),
+// jobs dispatched from other threads go to the shared queue, idle workers steal jobs from the front of other workers queues.
 
 #define JOB_SYSTEM_ENABLED 1
-#define JOB_SYSTEM_USE_MUTEX 1
 #define JOB_SYSTEM_USE_STATS 0
 
 #if JOB_SYSTEM_USE_STATS
 #include "Engine/Core/Log.h"
 #endif
-#if JOB_SYSTEM_USE_MUTEX
 #include "Engine/Core/Collections/RingBuffer.h"
-#else
-#include "ConcurrentQueue.h"
-#endif
 
 #if JOB_SYSTEM_ENABLED
 
@@ -59,6 +60,50 @@ struct TIsPODType<JobData>
     enum { Value = false };
 };
 
+struct JobQueue
+{
+    CriticalSection Locker;
+    RingBuffer<JobData, InlinedAllocation<256>> Jobs[(int32)JobPriority::MAX];
+
+    void Push(const JobData& data, int32 count, JobPriority priority)
+    {
+        JobData job = data;
+        auto& jobs = Jobs[(int32)priority];
+        Locker.Lock();
+        for (job.Index = 0; job.Index < count; job.Index++)
+            jobs.PushBack(job);
+        Locker.Unlock();
+    }
+
+    bool PopFront(JobData& data, int32 lane)
+    {
+        auto& jobs = Jobs[lane];
+        Locker.Lock();
+        const bool result = jobs.Count() != 0;
+        if (result)
+        {
+            data = jobs.PeekFront();
+            jobs.PopFront();
+        }
+        Locker.Unlock();
+        return result;
+    }
+
+    bool PopBack(JobData& data, int32 lane)
+    {
+        auto& jobs = Jobs[lane];
+        Locker.Lock();
+        const bool result = jobs.Count() != 0;
+        if (result)
+        {
+            data = jobs.PeekBack();
+            jobs.PopBack();
+        }
+        Locker.Unlock();
+        return result;
+    }
+};
+
 class JobSystemThread : public IRunnable
 {
 public:
@@ -95,29 +140,127 @@ namespace
     JobSystemService JobSystemInstance;
     Thread* Threads[PLATFORM_THREADS_LIMIT] = {};
     int32 ThreadsCount = 0;
+    int32 BackgroundThreadsCount = 0;
     bool JobStartingOnDispatch = true;
     volatile int64 ExitFlag = 0;
     volatile int64 JobLabel = 0;
+    volatile int64 JobsPending[(int32)JobPriority::MAX] = {};
     Dictionary<int64, JobContext> JobContexts;
     ConditionVariable JobsSignal;
     CriticalSection JobsMutex;
     ConditionVariable WaitSignal;
     CriticalSection WaitMutex;
     CriticalSection JobsLocker;
-#if JOB_SYSTEM_USE_MUTEX
-    RingBuffer<JobData, InlinedAllocation<256>> Jobs;
-#else
-    ConcurrentQueue<JobData> Jobs;
-#endif
+    JobQueue SharedJobs;
+    JobQueue ThreadJobs[PLATFORM_THREADS_LIMIT];
+    WorkerThreadCounters ThreadCounters[PLATFORM_THREADS_LIMIT];
+    THREADLOCAL int32 ThreadJobsIndex = -1;
 #if JOB_SYSTEM_USE_STATS
     int64 DequeueCount = 0;
     int64 DequeueSum = 0;
 #endif
+
+    bool CanExecuteBackground(int32 threadIndex)
+    {
+        // Background lane uses the last threads (the first ones stay free for the frame-critical work), other threads can help only when not in a main thread
+        if (threadIndex != -1)
+            return threadIndex >= ThreadsCount - BackgroundThreadsCount;
+        return !IsInMainThread();
+    }
+
+    bool HasPendingJobs(int32 threadIndex)
+    {
+        const int32 lanes = CanExecuteBackground(threadIndex) ? (int32)JobPriority::MAX : (int32)JobPriority::Background;
+        for (int32 lane = 0; lane < lanes; lane++)
+        {
+            if (Platform::AtomicRead(&JobsPending[lane]) > 0)
+                return true;
+        }
+        return false;
+    }
+
+    bool TryGetJob(int32 threadIndex, JobData& data)
+    {
+#if JOB_SYSTEM_USE_STATS
+        const auto start = Platform::GetTimeCycles();
+#endif
+        bool result = false;
+        const int32 lanes = CanExecuteBackground(threadIndex) ? (int32)JobPriority::MAX : (int32)JobPriority::Background;
+        for (int32 lane = 0; lane < lanes && !result; lane++)
+        {
+            if (Platform::AtomicRead(&JobsPending[lane]) <= 0)
+                continue;
+
+            // Local queue (most recently dispatched jobs first to keep working on hot data)
+            if (threadIndex != -1)
+                result = ThreadJobs[threadIndex].PopBack(data, lane);
+
+            // Shared queue
+            if (!result)
+                result = SharedJobs.PopFront(data, lane);
+
+            // Steal from other workers (oldest jobs first)
+            for (int32 i = 1; i <= ThreadsCount && !result; i++)
+            {
+                const int32 victimIndex = (threadIndex + i) % ThreadsCount;
+                if (victimIndex != threadIndex)
+                {
+                    result = ThreadJobs[victimIndex].PopFront(data, lane);
+#if COMPILE_WITH_PROFILER
+                    if (result && threadIndex != -1)
+                        ThreadCounters[threadIndex].Steals++;
+#endif
+                }
+            }
+
+            if (result)
+                Platform::InterlockedDecrement(&JobsPending[lane]);
+        }
+#if COMPILE_WITH_PROFILER
+        if (result && threadIndex != -1)
+        {
+            auto& counters = ThreadCounters[threadIndex];
+            counters.Executed++;
+            int64 queueDepth = 0;
+            for (int32 lane = 0; lane < (int32)JobPriority::MAX; lane++)
+                queueDepth += Platform::AtomicRead(&JobsPending[lane]);
+            if (queueDepth > counters.QueueDepthMax)
+                counters.QueueDepthMax = queueDepth;
+        }
+#endif
+#if JOB_SYSTEM_USE_STATS
+        Platform::InterlockedIncrement(&DequeueCount);
+        Platform::InterlockedAdd(&DequeueSum, Platform::GetTimeCycles() - start);
+#endif
+        return result;
+    }
+
+    void ExecuteJob(JobData& data)
+    {
+        // Run job
+        data.Job(data.Index);
+
+        // Move forward with the job queue
+        JobsLocker.Lock();
+        JobContext& context = JobContexts.At(data.JobKey);
+        if (Platform::InterlockedDecrement(&context.JobsLeft) <= 0)
+        {
+            ASSERT_LOW_LAYER(context.JobsLeft <= 0);
+            JobContexts.Remove(data.JobKey);
+        }
+        JobsLocker.Unlock();
+
+        WaitSignal.NotifyAll();
+
+        data.Job.Unbind();
+    }
 }
 
 bool JobSystemService::Init()
 {
     ThreadsCount = Math::Min<int32>(Platform::GetCPUInfo().LogicalProcessorCount, ARRAY_COUNT(Threads));
+    if (BackgroundThreadsCount <= 0)
+        BackgroundThreadsCount = Math::Max(ThreadsCount / 2, 1);
     for (int32 i = 0; i < ThreadsCount; i++)
     {
         auto runnable = New<JobSystemThread>();
@@ -155,37 +298,20 @@ void JobSystemService::Dispose()
 
 int32 JobSystemThread::Run()
 {
-    Platform::SetThreadAffinityMask(1ull << Index);
+    // Pin worker to a single processor (background lane workers go last so they land on the efficiency cores of the hybrid CPUs)
+    Platform::SetThreadPlacement(ThreadPlacement::FrameCritical, (int32)Index);
+    ThreadJobsIndex = (int32)Index;
 
     JobData data;
     bool attachCSharpThread = true;
-#if !JOB_SYSTEM_USE_MUTEX
-    moodycamel::ConsumerToken consumerToken(Jobs);
+#if COMPILE_WITH_PROFILER
+    auto& counters = ThreadCounters[Index];
+    uint64 time = Platform::GetTimeCycles();
 #endif
     while (Platform::AtomicRead(&ExitFlag) == 0)
     {
         // Try to get a job
-#if JOB_SYSTEM_USE_STATS
-        const auto start = Platform::GetTimeCycles();
-#endif
-#if JOB_SYSTEM_USE_MUTEX
-        JobsLocker.Lock();
-        if (Jobs.Count() != 0)
-        {
-            data = Jobs.PeekFront();
-            Jobs.PopFront();
-        }
-        JobsLocker.Unlock();
-#else
-        if (!Jobs.try_dequeue(consumerToken, data))
-            data.Job.Unbind();
-#endif
-#if JOB_SYSTEM_USE_STATS
-        Platform::InterlockedIncrement(&DequeueCount);
-        Platform::InterlockedAdd(&DequeueSum, Platform::GetTimeCycles() - start);
-#endif
-
-        if (data.Job.IsBinded())
+        if (TryGetJob(ThreadJobsIndex, data))
         {
 #if USE_CSHARP
             // Ensure to have C# thread attached to this thead (late init due to MCore being initialized after Job System)
@@ -196,29 +322,25 @@ int32 JobSystemThread::Run()
             }
 #endif
 
-            // Run job
-            data.Job(data.Index);
-
-            // Move forward with the job queue
-            JobsLocker.Lock();
-            JobContext& context = JobContexts.At(data.JobKey);
-            if (Platform::InterlockedDecrement(&context.JobsLeft) <= 0)
-            {
-                ASSERT_LOW_LAYER(context.JobsLeft <= 0);
-                JobContexts.Remove(data.JobKey);
-            }
-            JobsLocker.Unlock();
-
-            WaitSignal.NotifyAll();
-
-            data.Job.Unbind();
+            ExecuteJob(data);
+#if COMPILE_WITH_PROFILER
+            const uint64 now = Platform::GetTimeCycles();
+            counters.BusyCycles += (int64)(now - time);
+            time = now;
+#endif
         }
         else
         {
             // Wait for signal
             JobsMutex.Lock();
-            JobsSignal.Wait(JobsMutex);
+            if (!HasPendingJobs(ThreadJobsIndex) && Platform::AtomicRead(&ExitFlag) == 0)
+                JobsSignal.Wait(JobsMutex);
             JobsMutex.Unlock();
+#if COMPILE_WITH_PROFILER
+            const uint64 now = Platform::GetTimeCycles();
+            counters.IdleCycles += (int64)(now - time);
+            time = now;
+#endif
         }
     }
     return 0;
@@ -226,13 +348,12 @@ int32 JobSystemThread::Run()
 
 #endif
 
-void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
+void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount, JobPriority priority)
 {
-    // TODO: disable async if called on job thread? or maybe Wait should handle waiting in job thread to do the processing?
     if (jobCount > 1)
     {
-        // Async
-        const int64 jobWaitHandle = Dispatch(job, jobCount);
+        // Async (waiting thread helps with the jobs execution)
+        const int64 jobWaitHandle = Dispatch(job, jobCount, priority);
         Wait(jobWaitHandle);
     }
     else if (jobCount > 0)
@@ -243,11 +364,12 @@ void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
     }
 }
 
-int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
+int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount, JobPriority priority)
 {
     PROFILE_CPU();
     if (jobCount <= 0)
         return 0;
+    PROFILE_COUNTER_ADD("Jobs Dispatched", jobCount);
 #if JOB_SYSTEM_ENABLED
 #if JOB_SYSTEM_USE_STATS
     const auto start = Platform::GetTimeCycles();
@@ -261,19 +383,15 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
     JobContext context;
     context.JobsLeft = jobCount;
 
-#if JOB_SYSTEM_USE_MUTEX
     JobsLocker.Lock();
     JobContexts.Add(label, context);
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.PushBack(data);
     JobsLocker.Unlock();
-#else
-    JobsLocker.Lock();
-    JobContexts.Add(label, context);
-    JobsLocker.Unlock();
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.enqueue(data);
-#endif
+
+    // Nested jobs go to the local queue of the worker thread, other threads use shared queue
+    const int32 threadIndex = ThreadJobsIndex;
+    JobQueue& queue = threadIndex != -1 ? ThreadJobs[threadIndex] : SharedJobs;
+    queue.Push(data, jobCount, priority);
+    Platform::InterlockedAdd(&JobsPending[(int32)priority], (int64)jobCount);
 
 #if JOB_SYSTEM_USE_STATS
     LOG(Info, "Job enqueue time: {0} cycles", (int64)(Platform::GetTimeCycles() - start));
@@ -281,7 +399,7 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
 
     if (JobStartingOnDispatch)
     {
-        if (jobCount == 1)
+        if (jobCount == 1 && priority != JobPriority::Background)
             JobsSignal.NotifyOne();
         else
             JobsSignal.NotifyAll();
@@ -320,6 +438,7 @@ void JobSystem::Wait(int64 label)
 #if JOB_SYSTEM_ENABLED
     PROFILE_CPU();
 
+    JobData data;
     while (Platform::AtomicRead(&ExitFlag) == 0)
     {
         JobsLocker.Lock();
@@ -330,6 +449,13 @@ void JobSystem::Wait(int64 label)
         if (!context)
             break;
 
+        // Help with executing pending jobs instead of blocking the thread
+        if (JobStartingOnDispatch && TryGetJob(ThreadJobsIndex, data))
+        {
+            ExecuteJob(data);
+            continue;
+        }
+
         // Wait on signal until input label is not yet done
         WaitMutex.Lock();
         WaitSignal.Wait(WaitMutex, 1);
@@ -346,6 +472,31 @@ void JobSystem::Wait(int64 label)
 #endif
 }
 
+bool JobSystem::TryExecute()
+{
+#if JOB_SYSTEM_ENABLED
+    JobData data;
+    if (ThreadJobsIndex != -1 && JobStartingOnDispatch && TryGetJob(ThreadJobsIndex, data))
+    {
+        ExecuteJob(data);
+        return true;
+    }
+#endif
+    return false;
+}
+
+bool JobSystem::IsFinished(int64 label)
+{
+#if JOB_SYSTEM_ENABLED
+    JobsLocker.Lock();
+    const bool result = !JobContexts.ContainsKey(label);
+    JobsLocker.Unlock();
+    return result;
+#else
+    return true;
+#endif
+}
+
 void JobSystem::SetJobStartingOnDispatch(bool value)
 {
 #if JOB_SYSTEM_ENABLED
@@ -353,16 +504,12 @@ void JobSystem::SetJobStartingOnDispatch(bool value)
 
     if (value)
     {
-#if JOB_SYSTEM_USE_MUTEX
-        JobsLocker.Lock();
-        const int32 count = Jobs.Count();
-        JobsLocker.Unlock();
-#else
-        const int32 count = Jobs.Count();
-#endif
-        if (count == 1)
+        int64 count = 0;
+        for (int32 lane = 0; lane < (int32)JobPriority::MAX; lane++)
+            count += Platform::AtomicRead(&JobsPending[lane]);
+        if (count == 1 && Platform::AtomicRead(&JobsPending[(int32)JobPriority::Background]) == 0)
             JobsSignal.NotifyOne();
-        else if (count != 0)
+        else if (count > 0)
             JobsSignal.NotifyAll();
     }
 #endif
@@ -376,3 +523,31 @@ int32 JobSystem::GetThreadsCount()
     return 0;
 #endif
 }
+
+const WorkerThreadCounters& JobSystem::GetThreadCounters(int32 index)
+{
+#if JOB_SYSTEM_ENABLED
+    ASSERT(index >= 0 && index < ARRAY_COUNT(ThreadCounters));
+    return ThreadCounters[index];
+#else
+    static WorkerThreadCounters Empty;
+    return Empty;
+#endif
+}
+
+int32 JobSystem::GetBackgroundThreadsCount()
+{
+#if JOB_SYSTEM_ENABLED
+    return BackgroundThreadsCount;
+#else
+    return 0;
+#endif
+}
+
+void JobSystem::SetBackgroundThreadsCount(int32 value)
+{
+#if JOB_SYSTEM_ENABLED
+    BackgroundThreadsCount = ThreadsCount > 0 ? Math::Clamp(value, 1, ThreadsCount) : Math::Max(value, 1);
+    JobsSignal.NotifyAll();
+#endif
+}
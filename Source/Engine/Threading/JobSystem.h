@@ -4,6 +4,32 @@
 
 #include "Engine/Core/Delegate.h"
 
+struct WorkerThreadCounters;
+
+/// <summary>
+/// The priority lane of the job dispatched to the Job System. Workers always drain higher priority lanes first.
+/// </summary>
+API_ENUM() enum class JobPriority
+{
+    /// <summary>
+    /// The frame-critical jobs (eg. scene drawing) that should be executed as soon as possible.
+    /// </summary>
+    Critical = 0,
+
+    /// <summary>
+    /// The default jobs priority.
+    /// </summary>
+    Normal = 1,
+
+    /// <summary>
+    /// The long-running background jobs (eg. SDF generation or navmesh building). Executed only on a limited subset of job system threads.
+    /// </summary>
+    Background = 2,
+
+    API_ENUM(Attributes="HideInEditor")
+    MAX
+};
+
 /// <summary>
 /// Lightweight multi-threaded jobs execution scheduler. Uses a pool of threads and supports work-stealing concept.
 /// </summary>
@@ -16,15 +42,18 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// </summary>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
-    API_FUNCTION() static void Execute(const Function<void(int32)>& job, int32 jobCount = 1);
+    /// <param name="priority">The jobs priority lane.</param>
+    API_FUNCTION() static void Execute(const Function<void(int32)>& job, int32 jobCount = 1, JobPriority priority = JobPriority::Normal);
 
     /// <summary>
     /// Dispatches the job for the execution.
     /// </summary>
+    /// <remarks>Jobs dispatched from within the other job are queued on the local queue of the job system thread (other idle threads can steal them).</remarks>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
+    /// <param name="priority">The jobs priority lane.</param>
     /// <returns>The label identifying this dispatch. Can be used to wait for the execution end.</returns>
-    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount = 1);
+    API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount = 1, JobPriority priority = JobPriority::Normal);
 
     /// <summary>
     /// Waits for all dispatched jobs to finish.
@@ -34,9 +63,23 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// <summary>
     /// Waits for all dispatched jobs until a given label to finish (i.e. waits for a Dispatch that returned that label).
     /// </summary>
+    /// <remarks>Calling thread helps with executing pending jobs while waiting (instead of blocking).</remarks>
     /// <param name="label">The label.</param>
     API_FUNCTION() static void Wait(int64 label);
 
+    /// <summary>
+    /// Tries to execute a single pending job on the calling thread. Used to help with jobs execution when job system thread waits for other work to end (instead of blocking the worker).
+    /// </summary>
+    /// <returns>True if job has been executed, otherwise false (eg. no pending jobs or not called from the job system thread).</returns>
+    static bool TryExecute();
+
+    /// <summary>
+    /// Checks if all dispatched jobs with a given label has been finished (i.e. checks a Dispatch that returned that label).
+    /// </summary>
+    /// <param name="label">The label.</param>
+    /// <returns>True if all jobs has been executed, otherwise false.</returns>
+    API_FUNCTION() static bool IsFinished(int64 label);
+
     /// <summary>
     /// Sets whether automatically start jobs execution on Dispatch. If disabled jobs won't be executed until it gets re-enabled. Can be used to optimize execution of multiple dispatches that should overlap.
     /// </summary>
@@ -46,4 +89,21 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// Gets the amount of job system threads.
     /// </summary>
     API_PROPERTY() static int32 GetThreadsCount();
+
+    /// <summary>
+    /// Gets the runtime counters of the job system thread (for profiling).
+    /// </summary>
+    /// <param name="index">The thread index (in range 0 to ThreadsCount-1).</param>
+    /// <returns>The counters (valid for the whole engine lifetime).</returns>
+    static const WorkerThreadCounters& GetThreadCounters(int32 index);
+
+    /// <summary>
+    /// Gets the amount of job system threads that can execute jobs from the background priority lane.
+    /// </summary>
+    API_PROPERTY() static int32 GetBackgroundThreadsCount();
+
+    /// <summary>
+    /// Sets the amount of job system threads that can execute jobs from the background priority lane. Limits the amount of cores used by the long-running background jobs so frame-critical work has free threads.
+    /// </summary>
+    API_PROPERTY() static void SetBackgroundThreadsCount(int32 value);
 };
@@ -2,6 +2,7 @@
 
 #include "MainThreadTask.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/Platform.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
 namespace
@@ -9,6 +10,27 @@ namespace
     CriticalSection Locker;
     Array<MainThreadTask*> Waiting;
     Array<MainThreadTask*> Queue;
+    int32 QueueStart = 0;
+    MainThreadTask::Stats LastStats = {};
+
+    void AddToQueue(MainThreadTask* task)
+    {
+        // Insert task after the ones with the same or higher priority (but not before the tasks that already executed within this frame)
+        int32 index = Queue.Count();
+        while (index > QueueStart && Queue[index - 1]->Priority < task->Priority)
+            index--;
+        Queue.Insert(index, task);
+    }
+}
+
+float MainThreadTask::TimeBudget = 0.0f;
+
+MainThreadTask::Stats MainThreadTask::GetStats()
+{
+    Locker.Lock();
+    const Stats result = LastStats;
+    Locker.Unlock();
+    return result;
 }
 
 void MainThreadTask::RunAll(float dt)
@@ -22,14 +44,34 @@ void MainThreadTask::RunAll(float dt)
         if (task->InitialDelay < ZeroTolerance)
         {
             Waiting.RemoveAt(i);
-            Queue.Add(task);
+            AddToQueue(task);
         }
     }
-    for (int32 i = 0; i < Queue.Count(); i++)
+
+    // Execute tasks within the time budget (tasks enqueued during execution can run within this frame too)
+    const double startTime = Platform::GetTimeSeconds();
+    const double budget = TimeBudget * 0.001;
+    int32 executed = 0;
+    for (; executed < Queue.Count(); executed++)
     {
-        Queue[i]->Execute();
+        auto task = Queue[executed];
+        if (budget > 0.0 && executed != 0 && Platform::GetTimeSeconds() - startTime + task->Cost * 0.001 > budget)
+            break;
+        QueueStart = executed + 1;
+        task->Execute();
     }
-    Queue.Clear();
+    QueueStart = 0;
+
+    // Carry over the remaining tasks to the next frame
+    const int32 carriedOver = Queue.Count() - executed;
+    for (int32 i = 0; i < carriedOver; i++)
+        Queue[i] = Queue[executed + i];
+    Queue.Resize(carriedOver);
+
+    LastStats.ExecutedCount = executed;
+    LastStats.CarriedOverCount = carriedOver;
+    LastStats.WaitingCount = Waiting.Count();
+    LastStats.ExecutionTime = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
     Locker.Unlock();
 }
 
@@ -42,7 +84,7 @@ void MainThreadTask::Enqueue()
 {
     Locker.Lock();
     if (InitialDelay <= ZeroTolerance)
-        Queue.Add(this);
+        AddToQueue(this);
     else
         Waiting.Add(this);
     Locker.Unlock();
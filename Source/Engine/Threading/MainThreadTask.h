@@ -28,6 +28,44 @@ class FLAXENGINE_API MainThreadTask : public Task
 private:
     static void RunAll(float dt);
 
+public:
+
+    /// <summary>
+    /// The main thread tasks execution statistics.
+    /// </summary>
+    struct Stats
+    {
+        /// <summary>
+        /// The amount of tasks executed in the last frame.
+        /// </summary>
+        int32 ExecutedCount;
+
+        /// <summary>
+        /// The amount of queued tasks carried over to the next frame (due to the time budget).
+        /// </summary>
+        int32 CarriedOverCount;
+
+        /// <summary>
+        /// The amount of tasks waiting for their initial delay.
+        /// </summary>
+        int32 WaitingCount;
+
+        /// <summary>
+        /// The tasks execution time (in milliseconds) in the last frame.
+        /// </summary>
+        float ExecutionTime;
+    };
+
+    /// <summary>
+    /// The time budget (in milliseconds) for the main thread tasks executed in a single frame. Tasks are executed in order of their priority and the ones that don't fit into the budget are carried over to the next frames. Use 0 to run all queued tasks every frame.
+    /// </summary>
+    static float TimeBudget;
+
+    /// <summary>
+    /// Gets the main thread tasks execution statistics.
+    /// </summary>
+    static Stats GetStats();
+
 public:
 
     /// <summary>
@@ -35,6 +73,16 @@ class FLAXENGINE_API MainThreadTask : public Task
     /// </summary>
     float InitialDelay = 0.0f;
 
+    /// <summary>
+    /// The task execution priority. Tasks with higher priority are executed first (tasks with the same priority are executed in order of enqueueing).
+    /// </summary>
+    int32 Priority = 0;
+
+    /// <summary>
+    /// The estimated task execution cost (in milliseconds). Used to carry the task over to the next frame if it doesn't fit into the remaining time budget. Use 0 if unknown.
+    /// </summary>
+    float Cost = 0.0f;
+
 public:
 
     // [Task]
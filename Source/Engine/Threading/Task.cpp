@@ -7,6 +7,32 @@
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/ThreadPool.h"
+
+// Enables cooperative waiting: Task::Wait called on a Thread Pool or Job System worker executes other queued work instead of blocking the worker (deep dependency chains won't starve the threads pool)
+#define TASK_WAIT_HELP 1
+// Limits the nesting of the cooperative waiting (each helped task can also wait for other task)
+#define TASK_WAIT_HELP_MAX_DEPTH 8
+
+#if TASK_WAIT_HELP
+
+namespace
+{
+    THREADLOCAL int32 WaitHelpDepth = 0;
+
+    bool HelpWhileWaiting()
+    {
+        if (WaitHelpDepth >= TASK_WAIT_HELP_MAX_DEPTH)
+            return false;
+        WaitHelpDepth++;
+        const bool result = ThreadPool::TryExecute() || JobSystem::TryExecute();
+        WaitHelpDepth--;
+        return result;
+    }
+}
+
+#endif
 
 void Task::Start()
 {
@@ -62,6 +88,11 @@ bool Task::Wait(double timeoutMilliseconds) const
         if (state == TaskState::Failed || state == TaskState::Canceled)
             return true;
 
+#if TASK_WAIT_HELP
+        // Execute other work on a worker thread instead of blocking it
+        if (HelpWhileWaiting())
+            continue;
+#endif
         Platform::Sleep(1);
     } while (timeoutMilliseconds <= 0.0 || Platform::GetTimeSeconds() * 0.001 - startTime < timeoutMilliseconds);
 
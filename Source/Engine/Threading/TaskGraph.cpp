@@ -83,11 +83,35 @@ void TaskGraph::Execute()
         system->PreExecute(this);
 
     _queue.Clear();
+    _running.Clear();
+    _executed.Clear();
     _remaining.Clear();
     _remaining.Add(_systems);
+    const double startTime = Platform::GetTimeSeconds();
 
-    while (_remaining.HasItems())
+    while (_remaining.HasItems() || _running.HasItems())
     {
+        // Complete systems that finished their async work
+        for (int32 i = _running.Count() - 1; i >= 0; i--)
+        {
+            auto e = _running[i];
+            bool isFinished = true;
+            for (const int64 label : e->_labels)
+            {
+                if (!JobSystem::IsFinished(label))
+                {
+                    isFinished = false;
+                    break;
+                }
+            }
+            if (isFinished)
+            {
+                e->LastDuration = (float)((Platform::GetTimeSeconds() - e->_executeStartTime) * 1000.0);
+                e->_labels.Clear();
+                _running.RemoveAt(i);
+            }
+        }
+
         // Find systems without dependencies or with already executed dependencies
         for (int32 i = _remaining.Count() - 1; i >= 0; i--)
         {
@@ -95,7 +119,7 @@ void TaskGraph::Execute()
             bool hasReadyDependencies = true;
             for (auto d : e->_dependencies)
             {
-                if (_remaining.Contains(d))
+                if (_remaining.Contains(d) || _running.Contains(d))
                 {
                     hasReadyDependencies = false;
                     break;
@@ -108,35 +132,63 @@ void TaskGraph::Execute()
             }
         }
 
-        // End if no systems left
-        if (_queue.IsEmpty())
-            break;
-
-        // Execute in order
-        Sorting::QuickSort(_queue.Get(), _queue.Count(), &SortTaskGraphSystem);
-        JobSystem::SetJobStartingOnDispatch(false);
-        _labels.Clear();
-        for (int32 i = 0; i < _queue.Count(); i++)
+        if (_queue.HasItems())
+        {
+            // Start systems in order (jobs begin after all ready systems dispatch their work, to overlap them)
+            Sorting::QuickSort(_queue.Get(), _queue.Count(), &SortTaskGraphSystem);
+            JobSystem::SetJobStartingOnDispatch(false);
+            for (int32 i = 0; i < _queue.Count(); i++)
+            {
+                _currentSystem = _queue[i];
+                _currentSystem->_executeStartTime = Platform::GetTimeSeconds();
+                _currentSystem->LastStartTime = (float)((_currentSystem->_executeStartTime - startTime) * 1000.0);
+                _currentSystem->Execute(this);
+                _running.Add(_currentSystem);
+                _executed.Add(_currentSystem);
+            }
+            _currentSystem = nullptr;
+            _queue.Clear();
+            JobSystem::SetJobStartingOnDispatch(true);
+        }
+        else if (_running.HasItems())
         {
-            _currentSystem = _queue[i];
-            _currentSystem->Execute(this);
+            // Wait for any running system to progress (waiting thread helps with the jobs execution)
+            int64 waitLabel = 0;
+            for (int32 i = 0; i < _running.Count() && waitLabel == 0; i++)
+            {
+                for (const int64 label : _running[i]->_labels)
+                {
+                    if (!JobSystem::IsFinished(label))
+                    {
+                        waitLabel = label;
+                        break;
+                    }
+                }
+            }
+            JobSystem::Wait(waitLabel);
+        }
+        else
+        {
+            // End if no systems left (eg. cyclic dependencies)
+            break;
         }
-        _currentSystem = nullptr;
-        _queue.Clear();
-
-        // Wait for async jobs to finish
-        JobSystem::SetJobStartingOnDispatch(true);
-        for (const int64 label : _labels)
-            JobSystem::Wait(label);
     }
+    _lastDuration = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
 
+    // Post execute systems in the dependencies order
     for (auto system : _systems)
+    {
+        if (!_executed.Contains(system))
+            _executed.Add(system);
+    }
+    for (auto system : _executed)
         system->PostExecute(this);
+    _executed.Clear();
 }
 
 void TaskGraph::DispatchJob(const Function<void(int32)>& job, int32 jobCount)
 {
     ASSERT(_currentSystem);
     const int64 label = JobSystem::Dispatch(job, jobCount);
-    _labels.Add(label);
+    _currentSystem->_labels.Add(label);
 }
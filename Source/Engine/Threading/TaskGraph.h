@@ -17,6 +17,8 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
 private:
     Array<TaskGraphSystem*, InlinedAllocation<16>> _dependencies;
     Array<TaskGraphSystem*, InlinedAllocation<16>> _reverseDependencies;
+    Array<int64, InlinedAllocation<4>> _labels;
+    double _executeStartTime = 0.0;
 
 public:
     /// <summary>
@@ -24,6 +26,16 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
     /// </summary>
     API_FIELD() int32 Order = 0;
 
+    /// <summary>
+    /// The time (in milliseconds) from the graph execution start to the moment this system was started during the last graph execution. Can be used to find the graph critical path.
+    /// </summary>
+    API_FIELD(ReadOnly) float LastStartTime = 0.0f;
+
+    /// <summary>
+    /// The time (in milliseconds) spent on the system execution (including its async jobs) during the last graph execution.
+    /// </summary>
+    API_FIELD(ReadOnly) float LastDuration = 0.0f;
+
 public:
     ~TaskGraphSystem();
 
@@ -68,8 +80,10 @@ DECLARE_SCRIPTING_TYPE(TaskGraph);
     Array<TaskGraphSystem*, InlinedAllocation<64>> _systems;
     Array<TaskGraphSystem*, InlinedAllocation<64>> _remaining;
     Array<TaskGraphSystem*, InlinedAllocation<64>> _queue;
-    Array<int64, InlinedAllocation<64>> _labels;
+    Array<TaskGraphSystem*, InlinedAllocation<64>> _running;
+    Array<TaskGraphSystem*, InlinedAllocation<64>> _executed;
     TaskGraphSystem* _currentSystem = nullptr;
+    float _lastDuration = 0.0f;
 
 public:
     /// <summary>
@@ -89,9 +103,18 @@ DECLARE_SCRIPTING_TYPE(TaskGraph);
     /// <param name="system">The system to add.</param>
     API_FUNCTION() void RemoveSystem(TaskGraphSystem* system);
 
+    /// <summary>
+    /// Gets the time (in milliseconds) spent on the last graph execution (excluding systems pre and post execution).
+    /// </summary>
+    API_PROPERTY() float GetLastDuration() const
+    {
+        return _lastDuration;
+    }
+
     /// <summary>
     /// Schedules the asynchronous systems execution including ordering and dependencies handling.
     /// </summary>
+    /// <remarks>Systems are started as soon as all of their dependencies finish their async work, so independent systems overlap. Systems post execution follows dependencies order.</remarks>
     API_FUNCTION() void Execute();
 
     /// <summary>
@@ -5,6 +5,7 @@
 #include "Threading.h"
 #include "ThreadPoolTask.h"
 #include "ConcurrentTaskQueue.h"
+#include "WorkerThreadCounters.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Core/Types/String.h"
@@ -12,6 +13,7 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Platform/ConditionVariable.h"
 #include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/CPUTopology.h"
 #include "Engine/Platform/Thread.h"
 
 FLAXENGINE_API bool IsInMainThread()
@@ -26,6 +28,9 @@ namespace ThreadPoolImpl
     ConcurrentTaskQueue<ThreadPoolTask> Jobs; // Hello Steve!
     ConditionVariable JobsSignal;
     CriticalSection JobsMutex;
+    THREADLOCAL bool IsWorkerThread = false;
+    volatile int64 ThreadsStarted = 0;
+    WorkerThreadCounters ThreadCounters[PLATFORM_THREADS_LIMIT];
 }
 
 String ThreadPoolTask::ToString() const
@@ -103,9 +108,38 @@ void ThreadPoolService::Dispose()
     ThreadPoolImpl::Threads.ClearDelete();
 }
 
+bool ThreadPool::TryExecute()
+{
+    ThreadPoolTask* task;
+    if (ThreadPoolImpl::IsWorkerThread && ThreadPoolImpl::Jobs.try_dequeue(task))
+    {
+        task->Execute();
+        return true;
+    }
+    return false;
+}
+
+int32 ThreadPool::GetThreadsCount()
+{
+    return ThreadPoolImpl::Threads.Count();
+}
+
+const WorkerThreadCounters& ThreadPool::GetThreadCounters(int32 index)
+{
+    ASSERT(index >= 0 && index < ARRAY_COUNT(ThreadPoolImpl::ThreadCounters));
+    return ThreadPoolImpl::ThreadCounters[index];
+}
+
 int32 ThreadPool::ThreadProc()
 {
     ThreadPoolTask* task;
+    ThreadPoolImpl::IsWorkerThread = true;
+    Platform::SetThreadPlacement(ThreadPlacement::Background, 0);
+#if COMPILE_WITH_PROFILER
+    const int64 threadIndex = Platform::InterlockedIncrement(&ThreadPoolImpl::ThreadsStarted) - 1;
+    auto& counters = ThreadPoolImpl::ThreadCounters[Math::Min<int64>(threadIndex, ARRAY_COUNT(ThreadPoolImpl::ThreadCounters) - 1)];
+    uint64 time = Platform::GetTimeCycles();
+#endif
 
     // Work until end
     while (Platform::AtomicRead(&ThreadPoolImpl::ExitFlag) == 0)
@@ -113,13 +147,29 @@ int32 ThreadPool::ThreadProc()
         // Try to get a job
         if (ThreadPoolImpl::Jobs.try_dequeue(task))
         {
+#if COMPILE_WITH_PROFILER
+            counters.Executed++;
+            const int64 queueDepth = (int64)ThreadPoolImpl::Jobs.size_approx() + 1;
+            if (queueDepth > counters.QueueDepthMax)
+                counters.QueueDepthMax = queueDepth;
+#endif
             task->Execute();
+#if COMPILE_WITH_PROFILER
+            const uint64 now = Platform::GetTimeCycles();
+            counters.BusyCycles += (int64)(now - time);
+            time = now;
+#endif
         }
         else
         {
             ThreadPoolImpl::JobsMutex.Lock();
             ThreadPoolImpl::JobsSignal.Wait(ThreadPoolImpl::JobsMutex);
             ThreadPoolImpl::JobsMutex.Unlock();
+#if COMPILE_WITH_PROFILER
+            const uint64 now = Platform::GetTimeCycles();
+            counters.IdleCycles += (int64)(now - time);
+            time = now;
+#endif
         }
     }
 
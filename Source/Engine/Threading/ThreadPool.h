@@ -4,6 +4,8 @@
 
 #include "Engine/Core/Types/BaseTypes.h"
 
+struct WorkerThreadCounters;
+
 /// <summary>
 /// Main engine thread pool for threaded tasks system.
 /// </summary>
@@ -11,6 +13,26 @@ class ThreadPool
 {
     friend class ThreadPoolTask;
     friend class ThreadPoolService;
+public:
+
+    /// <summary>
+    /// Tries to execute a single queued task on the calling thread. Used to help with tasks execution when Thread Pool worker waits for other task to end (instead of blocking the worker).
+    /// </summary>
+    /// <returns>True if task has been executed, otherwise false (eg. no queued tasks or not called from the Thread Pool worker thread).</returns>
+    static bool TryExecute();
+
+    /// <summary>
+    /// Gets the amount of Thread Pool worker threads.
+    /// </summary>
+    static int32 GetThreadsCount();
+
+    /// <summary>
+    /// Gets the runtime counters of the Thread Pool worker thread (for profiling).
+    /// </summary>
+    /// <param name="index">The thread index (in range 0 to ThreadsCount-1).</param>
+    /// <returns>The counters (valid for the whole engine lifetime).</returns>
+    static const WorkerThreadCounters& GetThreadCounters(int32 index);
+
 private:
 
     static int32 ThreadProc();
@@ -0,0 +1,36 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+
+/// <summary>
+/// The worker thread runtime counters (accumulated since the thread start). Updated only by the owning worker thread, can be read from any thread (values are approximate).
+/// </summary>
+struct WorkerThreadCounters
+{
+    /// <summary>
+    /// The amount of executed jobs/tasks.
+    /// </summary>
+    volatile int64 Executed = 0;
+
+    /// <summary>
+    /// The amount of jobs stolen from the other workers queues.
+    /// </summary>
+    volatile int64 Steals = 0;
+
+    /// <summary>
+    /// The time spent on work (in CPU cycles, see Platform::GetClockFrequency).
+    /// </summary>
+    volatile int64 BusyCycles = 0;
+
+    /// <summary>
+    /// The time spent on waiting for work (in CPU cycles, see Platform::GetClockFrequency).
+    /// </summary>
+    volatile int64 IdleCycles = 0;
+
+    /// <summary>
+    /// The maximum amount of pending jobs in the worker queue (high-watermark). Can be reset by the reader.
+    /// </summary>
+    volatile int64 QueueDepthMax = 0;
+};
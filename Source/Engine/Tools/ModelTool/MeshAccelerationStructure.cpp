@@ -4,288 +4,260 @@
 
 #include "MeshAccelerationStructure.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Core/SIMD.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Graphics/Models/ModelData.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
-void MeshAccelerationStructure::BuildBVH(int32 node, int32 maxLeafSize, Array<byte>& scratch)
+// The amount of bins used to find the best split plane with Surface Area Heuristic (SAH)
+#define MESH_AS_SAH_BINS 12
+
+// The maximum amount of rays traversing the BVH together in the batched ray casts
+#define MESH_AS_RAYS_PACKET_SIZE 32
+
+struct MeshAccelerationStructure::BuildNode
 {
-    auto& root = _bvh[node];
-    ASSERT_LOW_LAYER(root.Leaf.IsLeaf);
-    if (root.Leaf.TriangleCount <= maxLeafSize)
-        return;
+    BoundingBox Bounds;
+    // Children nodes (-1 for leaves).
+    int32 Left, Right;
+    // Range of triangles in the indices list.
+    int32 Start, Count;
+};
 
-    // Spawn two leaves
-    const int32 childIndex = _bvh.Count();
-    _bvh.AddDefault(2);
-    auto& left = _bvh.Get()[childIndex];
-    auto& right = _bvh.Get()[childIndex + 1];
-    left.Leaf.IsLeaf = 1;
-    right.Leaf.IsLeaf = 1;
-    left.Leaf.MeshIndex = root.Leaf.MeshIndex;
-    right.Leaf.MeshIndex = root.Leaf.MeshIndex;
-
-    // Mid-point splitting based on the largest axis
-    const Float3 boundsSize = root.Bounds.GetSize();
-    int32 axisCount = 0;
-    int32 axis = 0;
-RETRY:
-    if (axisCount == 0)
-    {
-        // Pick the highest axis
-        axis = 0;
-        if (boundsSize.Y > boundsSize.X && boundsSize.Y >= boundsSize.Z)
-            axis = 1;
-        else if (boundsSize.Z > boundsSize.X)
-            axis = 2;
-    }
-    else if (axisCount == 3)
+namespace
+{
+    FORCE_INLINE Real GetSurfaceArea(const BoundingBox& box)
     {
-        // Failed to split
-        _bvh.Resize(childIndex);
-        return;
+        const Vector3 size = box.GetSize();
+        return 2.0f * (size.X * size.Y + size.Y * size.Z + size.Z * size.X);
     }
-    else
+
+    FORCE_INLINE float GetSafeInverse(Real value)
     {
-        // Go to the next axis
-        axis = (axis + 1) % 3;
+        // Avoid infinities in the slab tests for axis-aligned rays
+        return 1.0f / (float)(Math::Abs(value) > ZeroTolerance ? value : (value < 0 ? -ZeroTolerance : ZeroTolerance));
     }
-    const float midPoint = (float)(root.Bounds.Minimum.Raw[axis] + boundsSize.Raw[axis] * 0.5f);
-    const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-    const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-    int32 indexStart = root.Leaf.TriangleIndex * 3;
-    int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-    left.Leaf.TriangleCount = 0;
-    right.Leaf.TriangleCount = 0;
-    if (meshData.Use16BitIndexBuffer)
-    {
-        struct Tri
-        {
-            uint16 I0, I1, I2;
-        };
-        scratch.Resize(root.Leaf.TriangleCount * sizeof(Tri));
-        auto dst = (Tri*)scratch.Get();
-        auto ib16 = meshData.IndexBuffer.Get<uint16>();
-        for (int32 i = indexStart; i < indexEnd;)
-        {
-            const Tri tri = { ib16[i++], ib16[i++], ib16[i++] };
-            const float v0 = vb[tri.I0].Raw[axis];
-            const float v1 = vb[tri.I1].Raw[axis];
-            const float v2 = vb[tri.I2].Raw[axis];
-            const float centroid = (v0 + v1 + v2) * 0.333f;
-            if (centroid <= midPoint)
-                dst[left.Leaf.TriangleCount++] = tri; // Left
-            else
-                dst[root.Leaf.TriangleCount - ++right.Leaf.TriangleCount] = tri; // Right
-        }
-        Platform::MemoryCopy(ib16 + indexStart, dst, root.Leaf.TriangleCount * 3 * sizeof(uint16));
-        if (left.Leaf.TriangleCount == 0 || right.Leaf.TriangleCount == 0)
-        {
-            axisCount++;
-            goto RETRY;
-        }
 
-        left.Bounds = BoundingBox(vb[dst[0].I0]);
-        indexStart = 0;
-        indexEnd = left.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            left.Bounds.Merge(vb[((uint16*)scratch.Get())[i]]);
-
-        right.Bounds = BoundingBox(vb[dst[root.Leaf.TriangleCount - 1].I0]);
-        indexStart = left.Leaf.TriangleCount;
-        indexEnd = root.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            right.Bounds.Merge(vb[((uint16*)scratch.Get())[i]]);
-    }
-    else
+    // Tests the ray against the 4 children bounds of the node. Returns the bit mask of the hit children and outputs the entry distances.
+    FORCE_INLINE int32 RayIntersectsBounds4(const float* minX, const float* minY, const float* minZ, const float* maxX, const float* maxY, const float* maxZ, const SimdVector4 origin[3], const SimdVector4 invDir[3], float maxDistance, float* entryDistances)
     {
-        struct Tri
-        {
-            uint32 I0, I1, I2;
-        };
-        scratch.Resize(root.Leaf.TriangleCount * sizeof(Tri));
-        auto dst = (Tri*)scratch.Get();
-        auto ib32 = meshData.IndexBuffer.Get<uint32>();
-        for (int32 i = indexStart; i < indexEnd;)
-        {
-            const Tri tri = { ib32[i++], ib32[i++], ib32[i++] };
-            const float v0 = vb[tri.I0].Raw[axis];
-            const float v1 = vb[tri.I1].Raw[axis];
-            const float v2 = vb[tri.I2].Raw[axis];
-            const float centroid = (v0 + v1 + v2) * 0.333f;
-            if (centroid <= midPoint)
-                dst[left.Leaf.TriangleCount++] = tri; // Left
-            else
-                dst[root.Leaf.TriangleCount - ++right.Leaf.TriangleCount] = tri; // Right
-        }
-        Platform::MemoryCopy(ib32 + indexStart, dst, root.Leaf.TriangleCount * 3 * sizeof(uint32));
-        if (left.Leaf.TriangleCount == 0 || right.Leaf.TriangleCount == 0)
-        {
-            axisCount++;
-            goto RETRY;
-        }
-
-        left.Bounds = BoundingBox(vb[dst[0].I0]);
-        indexStart = 0;
-        indexEnd = left.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            left.Bounds.Merge(vb[((uint32*)scratch.Get())[i]]);
-
-        right.Bounds = BoundingBox(vb[dst[root.Leaf.TriangleCount - 1].I0]);
-        indexStart = left.Leaf.TriangleCount;
-        indexEnd = root.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            right.Bounds.Merge(vb[((uint32*)scratch.Get())[i]]);
+        const SimdVector4 t0X = SIMD::Mul(SIMD::Sub(SIMD::LoadUnaligned(minX), origin[0]), invDir[0]);
+        const SimdVector4 t1X = SIMD::Mul(SIMD::Sub(SIMD::LoadUnaligned(maxX), origin[0]), invDir[0]);
+        const SimdVector4 t0Y = SIMD::Mul(SIMD::Sub(SIMD::LoadUnaligned(minY), origin[1]), invDir[1]);
+        const SimdVector4 t1Y = SIMD::Mul(SIMD::Sub(SIMD::LoadUnaligned(maxY), origin[1]), invDir[1]);
+        const SimdVector4 t0Z = SIMD::Mul(SIMD::Sub(SIMD::LoadUnaligned(minZ), origin[2]), invDir[2]);
+        const SimdVector4 t1Z = SIMD::Mul(SIMD::Sub(SIMD::LoadUnaligned(maxZ), origin[2]), invDir[2]);
+        const SimdVector4 tMin = SIMD::Max(SIMD::Max(SIMD::Min(t0X, t1X), SIMD::Min(t0Y, t1Y)), SIMD::Max(SIMD::Min(t0Z, t1Z), SIMD::Splat(0.0f)));
+        const SimdVector4 tMax = SIMD::Min(SIMD::Min(SIMD::Max(t0X, t1X), SIMD::Max(t0Y, t1Y)), SIMD::Min(SIMD::Max(t0Z, t1Z), SIMD::Splat(maxDistance)));
+        if (entryDistances)
+            SIMD::StoreUnaligned(entryDistances, tMin);
+        return ~SIMD::MoveMask(SIMD::Less(tMax, tMin)) & 0xf;
     }
-    ASSERT_LOW_LAYER(left.Leaf.TriangleCount + right.Leaf.TriangleCount == root.Leaf.TriangleCount);
-    left.Leaf.TriangleIndex = root.Leaf.TriangleIndex;
-    right.Leaf.TriangleIndex = left.Leaf.TriangleIndex + left.Leaf.TriangleCount;
-
-    // Convert into a node
-    root.Node.IsLeaf = 0;
-    root.Node.ChildIndex = childIndex;
-    root.Node.ChildrenCount = 2;
-
-    // Split children
-    BuildBVH(childIndex, maxLeafSize, scratch);
-    BuildBVH(childIndex + 1, maxLeafSize, scratch);
 }
 
-bool MeshAccelerationStructure::PointQueryBVH(int32 node, const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle) const
+int32 MeshAccelerationStructure::CollapseNode(const Array<BuildNode>& buildNodes, int32 buildNodeIndex, const Array<Triangle>& triangles, const Array<int32>& indices)
 {
-    const auto& root = _bvh[node];
-    bool hit = false;
-    if (root.Leaf.IsLeaf)
+    // Pick up to 4 children by opening the largest inner nodes of the binary tree
+    int32 children[4];
+    int32 childrenCount = 0;
+    const BuildNode& buildNode = buildNodes[buildNodeIndex];
+    if (buildNode.Left == -1)
     {
-        // Find closest triangle
-        Vector3 p;
-        const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-        const int32 indexStart = root.Leaf.TriangleIndex * 3;
-        const int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-        if (meshData.Use16BitIndexBuffer)
+        // Root leaf
+        children[childrenCount++] = buildNodeIndex;
+    }
+    else
+    {
+        children[childrenCount++] = buildNode.Left;
+        children[childrenCount++] = buildNode.Right;
+        while (childrenCount < 4)
         {
-            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
-            for (int32 i = indexStart; i < indexEnd;)
+            int32 bestChild = -1;
+            Real bestArea = -1;
+            for (int32 i = 0; i < childrenCount; i++)
             {
-                Vector3 v0 = vb[ib16[i++]];
-                Vector3 v1 = vb[ib16[i++]];
-                Vector3 v2 = vb[ib16[i++]];
-                CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
-                const Real distance = Vector3::Distance(point, p);
-                if (distance < hitDistance)
+                const BuildNode& child = buildNodes[children[i]];
+                const Real area = GetSurfaceArea(child.Bounds);
+                if (child.Left != -1 && area > bestArea)
                 {
-                    hitDistance = distance;
-                    hitPoint = p;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
+                    bestChild = i;
+                    bestArea = area;
                 }
             }
+            if (bestChild == -1)
+                break;
+            const BuildNode& child = buildNodes[children[bestChild]];
+            children[bestChild] = child.Left;
+            children[childrenCount++] = child.Right;
         }
-        else
+    }
+
+    const int32 nodeIndex = _nodes.Count();
+    _nodes.AddOne();
+    Node node;
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i >= childrenCount)
         {
-            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
-            for (int32 i = indexStart; i < indexEnd;)
+            // Empty slot
+            node.MinX[i] = node.MinY[i] = node.MinZ[i] = MAX_float;
+            node.MaxX[i] = node.MaxY[i] = node.MaxZ[i] = -MAX_float;
+            node.Child[i] = 0;
+            node.PacketsCount[i] = -1;
+            continue;
+        }
+        const BuildNode& child = buildNodes[children[i]];
+        node.MinX[i] = (float)child.Bounds.Minimum.X;
+        node.MinY[i] = (float)child.Bounds.Minimum.Y;
+        node.MinZ[i] = (float)child.Bounds.Minimum.Z;
+        node.MaxX[i] = (float)child.Bounds.Maximum.X;
+        node.MaxY[i] = (float)child.Bounds.Maximum.Y;
+        node.MaxZ[i] = (float)child.Bounds.Maximum.Z;
+        if (child.Left == -1)
+        {
+            // Pack leaf triangles into groups of 4 (the last packet is padded with the duplicated triangle which doesn't affect the closest hit)
+            const int32 packetsCount = Math::DivideAndRoundUp(child.Count, 4);
+            node.Child[i] = _packets.Count();
+            node.PacketsCount[i] = packetsCount;
+            for (int32 packetIndex = 0; packetIndex < packetsCount; packetIndex++)
             {
-                Vector3 v0 = vb[ib32[i++]];
-                Vector3 v1 = vb[ib32[i++]];
-                Vector3 v2 = vb[ib32[i++]];
-                CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
-                const Real distance = Vector3::Distance(point, p);
-                if (distance < hitDistance)
+                auto& packet = _packets.AddOne();
+                for (int32 lane = 0; lane < 4; lane++)
                 {
-                    hitDistance = distance;
-                    hitPoint = p;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
+                    const Triangle& triangle = triangles[indices[child.Start + Math::Min(packetIndex * 4 + lane, child.Count - 1)]];
+                    const Float3 v0 = triangle.V0;
+                    const Float3 e1 = Float3(triangle.V1) - v0;
+                    const Float3 e2 = Float3(triangle.V2) - v0;
+                    packet.V0X[lane] = v0.X;
+                    packet.V0Y[lane] = v0.Y;
+                    packet.V0Z[lane] = v0.Z;
+                    packet.E1X[lane] = e1.X;
+                    packet.E1Y[lane] = e1.Y;
+                    packet.E1Z[lane] = e1.Z;
+                    packet.E2X[lane] = e2.X;
+                    packet.E2Y[lane] = e2.Y;
+                    packet.E2Z[lane] = e2.Z;
+                    _triangles.Add(triangle);
                 }
             }
         }
-    }
-    else
-    {
-        // Check all nested nodes
-        for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
+        else
         {
-            const int32 index = root.Node.ChildIndex + i;
-            if (_bvh[index].Bounds.Distance(point) >= hitDistance)
-                continue;
-            if (PointQueryBVH(index, point, hitDistance, hitPoint, hitTriangle))
-                hit = true;
+            node.Child[i] = CollapseNode(buildNodes, children[i], triangles, indices);
+            node.PacketsCount[i] = 0;
         }
     }
-    return hit;
+    _nodes[nodeIndex] = node;
+    return nodeIndex;
 }
 
-bool MeshAccelerationStructure::RayCastBVH(int32 node, const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle) const
+void MeshAccelerationStructure::PointQueryLeaf(int32 packetIndex, int32 packetsCount, const Vector3& point, Real& hitDistanceSq, Vector3& hitPoint, int32& hitIndex) const
 {
-    const auto& root = _bvh[node];
-    if (!root.Bounds.Intersects(ray))
-        return false;
-    Vector3 normal;
-    Real distance;
-    bool hit = false;
-    if (root.Leaf.IsLeaf)
+    const SimdVector4 pX = SIMD::Splat((float)point.X);
+    const SimdVector4 pY = SIMD::Splat((float)point.Y);
+    const SimdVector4 pZ = SIMD::Splat((float)point.Z);
+    Vector3 p;
+    for (int32 packetEnd = packetIndex + packetsCount; packetIndex < packetEnd; packetIndex++)
     {
-        // Ray cast along triangles in the leaf 
-        const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-        const int32 indexStart = root.Leaf.TriangleIndex * 3;
-        const int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-        if (meshData.Use16BitIndexBuffer)
-        {
-            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
-            for (int32 i = indexStart; i < indexEnd;)
-            {
-                Vector3 v0 = vb[ib16[i++]];
-                Vector3 v1 = vb[ib16[i++]];
-                Vector3 v2 = vb[ib16[i++]];
-                if (CollisionsHelper::RayIntersectsTriangle(ray, v0, v1, v2, distance, normal) && distance < hitDistance)
-                {
-                    hitDistance = distance;
-                    hitNormal = normal;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
-                }
-            }
-        }
-        else
+        const TrianglePacket& packet = _packets.Get()[packetIndex];
+
+        // Distance to the triangle plane is the lower bound of the distance to the triangle so use it to skip too far triangles
+        const SimdVector4 e1X = SIMD::LoadUnaligned(packet.E1X), e1Y = SIMD::LoadUnaligned(packet.E1Y), e1Z = SIMD::LoadUnaligned(packet.E1Z);
+        const SimdVector4 e2X = SIMD::LoadUnaligned(packet.E2X), e2Y = SIMD::LoadUnaligned(packet.E2Y), e2Z = SIMD::LoadUnaligned(packet.E2Z);
+        const SimdVector4 nX = SIMD::Sub(SIMD::Mul(e1Y, e2Z), SIMD::Mul(e1Z, e2Y));
+        const SimdVector4 nY = SIMD::Sub(SIMD::Mul(e1Z, e2X), SIMD::Mul(e1X, e2Z));
+        const SimdVector4 nZ = SIMD::Sub(SIMD::Mul(e1X, e2Y), SIMD::Mul(e1Y, e2X));
+        const SimdVector4 dX = SIMD::Sub(pX, SIMD::LoadUnaligned(packet.V0X));
+        const SimdVector4 dY = SIMD::Sub(pY, SIMD::LoadUnaligned(packet.V0Y));
+        const SimdVector4 dZ = SIMD::Sub(pZ, SIMD::LoadUnaligned(packet.V0Z));
+        const SimdVector4 nLengthSq = SIMD::MulAdd(nX, nX, SIMD::MulAdd(nY, nY, SIMD::Mul(nZ, nZ)));
+        const SimdVector4 planeDistance = SIMD::MulAdd(dX, nX, SIMD::MulAdd(dY, nY, SIMD::Mul(dZ, nZ)));
+        const SimdVector4 planeDistanceSq = SIMD::Div(SIMD::Mul(planeDistance, planeDistance), nLengthSq);
+        const SimdVector4 isDegenerate = SIMD::Less(nLengthSq, SIMD::Splat(ZeroTolerance * ZeroTolerance));
+        int32 mask = SIMD::MoveMask(SIMD::Or(SIMD::Less(planeDistanceSq, SIMD::Splat((float)Math::Min(hitDistanceSq, (Real)MAX_float))), isDegenerate));
+        for (int32 lane = 0; mask; lane++, mask >>= 1)
         {
-            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
-            for (int32 i = indexStart; i < indexEnd;)
+            if ((mask & 1) == 0)
+                continue;
+            const int32 triangleIndex = packetIndex * 4 + lane;
+            const Triangle& triangle = _triangles.Get()[triangleIndex];
+            CollisionsHelper::ClosestPointPointTriangle(point, triangle.V0, triangle.V1, triangle.V2, p);
+            const Real distanceSq = Vector3::DistanceSquared(point, p);
+            if (distanceSq < hitDistanceSq)
             {
-                Vector3 v0 = vb[ib32[i++]];
-                Vector3 v1 = vb[ib32[i++]];
-                Vector3 v2 = vb[ib32[i++]];
-                if (CollisionsHelper::RayIntersectsTriangle(ray, v0, v1, v2, distance, normal) && distance < hitDistance)
-                {
-                    hitDistance = distance;
-                    hitNormal = normal;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
-                }
+                hitDistanceSq = distanceSq;
+                hitPoint = p;
+                hitIndex = triangleIndex;
             }
         }
     }
-    else
+}
+
+void MeshAccelerationStructure::RayCastLeaf(int32 packetIndex, int32 packetsCount, const Float3& origin, const Float3& direction, float& hitDistance, int32& hitIndex) const
+{
+    // Möller-Trumbore ray-triangle intersection for 4 triangles at once
+    const SimdVector4 oX = SIMD::Splat(origin.X), oY = SIMD::Splat(origin.Y), oZ = SIMD::Splat(origin.Z);
+    const SimdVector4 dX = SIMD::Splat(direction.X), dY = SIMD::Splat(direction.Y), dZ = SIMD::Splat(direction.Z);
+    const SimdVector4 zero = SIMD::Splat(0.0f);
+    const SimdVector4 one = SIMD::Splat(1.0f);
+    const SimdVector4 epsilon = SIMD::Splat(ZeroTolerance);
+    for (int32 packetEnd = packetIndex + packetsCount; packetIndex < packetEnd; packetIndex++)
     {
-        // Ray cast all child nodes
-        Triangle triangle;
-        for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
+        const TrianglePacket& packet = _packets.Get()[packetIndex];
+        const SimdVector4 e1X = SIMD::LoadUnaligned(packet.E1X), e1Y = SIMD::LoadUnaligned(packet.E1Y), e1Z = SIMD::LoadUnaligned(packet.E1Z);
+        const SimdVector4 e2X = SIMD::LoadUnaligned(packet.E2X), e2Y = SIMD::LoadUnaligned(packet.E2Y), e2Z = SIMD::LoadUnaligned(packet.E2Z);
+
+        // Determinant (dot product of edge1 and cross product of ray direction and edge2)
+        const SimdVector4 pX = SIMD::Sub(SIMD::Mul(dY, e2Z), SIMD::Mul(dZ, e2Y));
+        const SimdVector4 pY = SIMD::Sub(SIMD::Mul(dZ, e2X), SIMD::Mul(dX, e2Z));
+        const SimdVector4 pZ = SIMD::Sub(SIMD::Mul(dX, e2Y), SIMD::Mul(dY, e2X));
+        const SimdVector4 determinant = SIMD::MulAdd(e1X, pX, SIMD::MulAdd(e1Y, pY, SIMD::Mul(e1Z, pZ)));
+        const SimdVector4 inverseDeterminant = SIMD::Div(one, determinant);
+
+        // Barycentric coordinates and the distance along the ray
+        const SimdVector4 tX = SIMD::Sub(oX, SIMD::LoadUnaligned(packet.V0X));
+        const SimdVector4 tY = SIMD::Sub(oY, SIMD::LoadUnaligned(packet.V0Y));
+        const SimdVector4 tZ = SIMD::Sub(oZ, SIMD::LoadUnaligned(packet.V0Z));
+        const SimdVector4 u = SIMD::Mul(SIMD::MulAdd(tX, pX, SIMD::MulAdd(tY, pY, SIMD::Mul(tZ, pZ))), inverseDeterminant);
+        const SimdVector4 qX = SIMD::Sub(SIMD::Mul(tY, e1Z), SIMD::Mul(tZ, e1Y));
+        const SimdVector4 qY = SIMD::Sub(SIMD::Mul(tZ, e1X), SIMD::Mul(tX, e1Z));
+        const SimdVector4 qZ = SIMD::Sub(SIMD::Mul(tX, e1Y), SIMD::Mul(tY, e1X));
+        const SimdVector4 v = SIMD::Mul(SIMD::MulAdd(dX, qX, SIMD::MulAdd(dY, qY, SIMD::Mul(dZ, qZ))), inverseDeterminant);
+        const SimdVector4 t = SIMD::Mul(SIMD::MulAdd(e2X, qX, SIMD::MulAdd(e2Y, qY, SIMD::Mul(e2Z, qZ))), inverseDeterminant);
+        const SimdVector4 outside = SIMD::Or(SIMD::Or(SIMD::Less(u, zero), SIMD::Less(v, zero)), SIMD::Or(SIMD::Less(one, SIMD::Add(u, v)), SIMD::Less(t, zero)));
+        const SimdVector4 valid = SIMD::And(SIMD::Less(epsilon, SIMD::Abs(determinant)), SIMD::Less(t, SIMD::Splat(hitDistance)));
+        int32 mask = SIMD::MoveMask(SIMD::AndNot(outside, valid));
+        if (mask == 0)
+            continue;
+        float distances[4];
+        SIMD::StoreUnaligned(distances, t);
+        for (int32 lane = 0; mask; lane++, mask >>= 1)
         {
-            const int32 index = root.Node.ChildIndex + i;
-            distance = hitDistance;
-            if (RayCastBVH(index, ray, distance, normal, triangle) && distance < hitDistance)
+            if ((mask & 1) && distances[lane] < hitDistance)
             {
-                hitDistance = distance;
-                hitNormal = normal;
-                hitTriangle = triangle;
-                hit = true;
+                hitDistance = distances[lane];
+                hitIndex = packetIndex * 4 + lane;
             }
         }
     }
-    return hit;
+}
+
+bool MeshAccelerationStructure::RayCastResolve(const Ray& ray, int32 hitIndex, float hitDistance, Real& resultDistance, Vector3& resultNormal, Triangle& resultTriangle) const
+{
+    if (hitIndex == -1)
+        return false;
+    resultTriangle = _triangles[hitIndex];
+
+    // Calculate the precise hit distance and normal for the closest triangle
+    if (!CollisionsHelper::RayIntersectsTriangle(ray, resultTriangle.V0, resultTriangle.V1, resultTriangle.V2, resultDistance, resultNormal))
+    {
+        resultDistance = hitDistance;
+        resultNormal = resultTriangle.GetNormal();
+        if (Vector3::Dot(resultNormal, ray.Direction) > 0)
+            resultNormal = -resultNormal;
+    }
+    return true;
 }
 
 void MeshAccelerationStructure::Add(Model* model, int32 lodIndex)
@@ -386,78 +358,288 @@ void MeshAccelerationStructure::Add(Float3* vb, int32 vertices, void* ib, int32
 
 void MeshAccelerationStructure::BuildBVH(int32 maxLeafSize)
 {
+    _nodes.Clear();
+    _packets.Clear();
+    _triangles.Clear();
     if (_meshes.Count() == 0)
         return;
     PROFILE_CPU();
+    maxLeafSize = Math::Max(maxLeafSize, 4);
+
+    // Gather triangles from all meshes
+    Array<Triangle> triangles;
+    GetTriangles(triangles);
+    const int32 trianglesCount = triangles.Count();
+    if (trianglesCount == 0)
+        return;
+    Array<BoundingBox> trianglesBounds;
+    Array<Vector3> trianglesCenters;
+    Array<int32> indices;
+    trianglesBounds.Resize(trianglesCount);
+    trianglesCenters.Resize(trianglesCount);
+    indices.Resize(trianglesCount);
+    for (int32 i = 0; i < trianglesCount; i++)
+    {
+        const Triangle& triangle = triangles[i];
+        BoundingBox& bounds = trianglesBounds[i];
+        bounds = BoundingBox(triangle.V0);
+        bounds.Merge(triangle.V1);
+        bounds.Merge(triangle.V2);
+        trianglesCenters[i] = bounds.GetCenter();
+        indices[i] = i;
+    }
+
+    // Build binary tree top-down with binned SAH
+    Array<BuildNode> buildNodes;
+    buildNodes.EnsureCapacity(trianglesCount * 2 / maxLeafSize + 1);
+    {
+        BuildNode& root = buildNodes.AddOne();
+        root.Bounds = trianglesBounds[0];
+        for (int32 i = 1; i < trianglesCount; i++)
+            root.Bounds.Merge(trianglesBounds[i]);
+        root.Left = root.Right = -1;
+        root.Start = 0;
+        root.Count = trianglesCount;
+    }
+    Array<int32, InlinedAllocation<64>> stack;
+    stack.Push(0);
+    while (stack.HasItems())
+    {
+        const int32 nodeIndex = stack.Pop();
+        const BuildNode node = buildNodes[nodeIndex];
+        if (node.Count <= 4)
+            continue;
+        int32* nodeIndices = indices.Get() + node.Start;
+
+        // Pick the axis with the largest extent of triangle centers
+        BoundingBox centersBounds(trianglesCenters[nodeIndices[0]]);
+        for (int32 i = 1; i < node.Count; i++)
+            centersBounds.Merge(trianglesCenters[nodeIndices[i]]);
+        const Vector3 centersSize = centersBounds.GetSize();
+        int32 axis = 0;
+        if (centersSize.Y > centersSize.X && centersSize.Y >= centersSize.Z)
+            axis = 1;
+        else if (centersSize.Z > centersSize.X)
+            axis = 2;
+        const Real axisMin = centersBounds.Minimum.Raw[axis];
+        const Real axisExtent = centersSize.Raw[axis];
+
+        int32 leftCount;
+        if (axisExtent <= ZeroTolerance)
+        {
+            // All triangles are in the same place so split them in the middle (if needed)
+            if (node.Count <= maxLeafSize)
+                continue;
+            leftCount = node.Count / 2;
+        }
+        else
+        {
+            // Put triangles into bins along the axis
+            struct Bin
+            {
+                BoundingBox Bounds;
+                int32 Count;
+            };
+            Bin bins[MESH_AS_SAH_BINS];
+            for (Bin& bin : bins)
+            {
+                bin.Bounds = BoundingBox::Empty;
+                bin.Count = 0;
+            }
+            const Real binScale = (Real)MESH_AS_SAH_BINS / axisExtent;
+#define GET_BIN(triangleIndex) Math::Min((int32)((trianglesCenters[triangleIndex].Raw[axis] - axisMin) * binScale), MESH_AS_SAH_BINS - 1)
+            for (int32 i = 0; i < node.Count; i++)
+            {
+                Bin& bin = bins[GET_BIN(nodeIndices[i])];
+                bin.Bounds.Merge(trianglesBounds[nodeIndices[i]]);
+                bin.Count++;
+            }
+
+            // Sweep the bins from both sides to find the cheapest split plane
+            Real leftCosts[MESH_AS_SAH_BINS - 1];
+            int32 leftCounts[MESH_AS_SAH_BINS - 1];
+            BoundingBox sweepBounds = BoundingBox::Empty;
+            int32 sweepCount = 0;
+            for (int32 i = 0; i < MESH_AS_SAH_BINS - 1; i++)
+            {
+                sweepBounds.Merge(bins[i].Bounds);
+                sweepCount += bins[i].Count;
+                leftCounts[i] = sweepCount;
+                leftCosts[i] = sweepCount != 0 ? GetSurfaceArea(sweepBounds) * (Real)sweepCount : 0;
+            }
+            sweepBounds = BoundingBox::Empty;
+            sweepCount = 0;
+            Real bestCost = MAX_Real;
+            int32 bestBin = -1;
+            for (int32 i = MESH_AS_SAH_BINS - 1; i > 0; i--)
+            {
+                sweepBounds.Merge(bins[i].Bounds);
+                sweepCount += bins[i].Count;
+                if (sweepCount == 0 || leftCounts[i - 1] == 0)
+                    continue;
+                const Real cost = leftCosts[i - 1] + GetSurfaceArea(sweepBounds) * (Real)sweepCount;
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestBin = i;
+                }
+            }
+
+            // Keep small leaves if splitting is not cheaper (node traversal cost is close to a single triangles packet test)
+            const Real nodeArea = GetSurfaceArea(node.Bounds);
+            if (bestBin == -1 || (node.Count <= maxLeafSize && nodeArea + bestCost >= nodeArea * (Real)node.Count))
+                continue;
+
+            // Partition triangles
+            int32 left = 0, right = node.Count - 1;
+            while (left <= right)
+            {
+                if (GET_BIN(nodeIndices[left]) < bestBin)
+                    left++;
+                else
+                    Swap(nodeIndices[left], nodeIndices[right--]);
+            }
+#undef GET_BIN
+            leftCount = left;
+        }
+        ASSERT_LOW_LAYER(leftCount > 0 && leftCount < node.Count);
+
+        // Spawn children
+        for (int32 side = 0; side < 2; side++)
+        {
+            BuildNode child;
+            child.Left = child.Right = -1;
+            child.Start = side == 0 ? node.Start : node.Start + leftCount;
+            child.Count = side == 0 ? leftCount : node.Count - leftCount;
+            child.Bounds = trianglesBounds[indices[child.Start]];
+            for (int32 i = 1; i < child.Count; i++)
+                child.Bounds.Merge(trianglesBounds[indices[child.Start + i]]);
+            const int32 childIndex = buildNodes.Count();
+            buildNodes.Add(child);
+            if (side == 0)
+                buildNodes[nodeIndex].Left = childIndex;
+            else
+                buildNodes[nodeIndex].Right = childIndex;
+            stack.Push(childIndex);
+        }
+    }
 
-    // Estimate memory usage
-    int32 trianglesCount = 0;
+    // Collapse binary tree into 4-wide nodes with triangles packed for SIMD tests
+    _nodes.EnsureCapacity(buildNodes.Count() / 2 + 1);
+    _packets.EnsureCapacity(trianglesCount / 4 + buildNodes.Count());
+    _triangles.EnsureCapacity(_packets.Capacity() * 4);
+    CollapseNode(buildNodes, 0, triangles, indices);
+}
+
+int32 MeshAccelerationStructure::GetTrianglesCount() const
+{
+    int32 result = 0;
+    for (const Mesh& meshData : _meshes)
+        result += meshData.Indices / 3;
+    return result;
+}
+
+void MeshAccelerationStructure::GetTriangles(Array<Float3>& vertices) const
+{
+    vertices.Clear();
+    vertices.EnsureCapacity(GetTrianglesCount() * 3);
     for (const Mesh& meshData : _meshes)
-        trianglesCount += meshData.Indices / 3;
-    _bvh.Clear();
-    _bvh.EnsureCapacity(trianglesCount / maxLeafSize);
-
-    // Init with the root node and all meshes as leaves
-    auto& root = _bvh.AddOne();
-    root.Node.IsLeaf = 0;
-    root.Node.ChildIndex = 1;
-    root.Node.ChildrenCount = _meshes.Count();
-    root.Bounds = _meshes[0].Bounds;
-    for (int32 i = 0; i < _meshes.Count(); i++)
     {
-        const Mesh& meshData = _meshes[i];
-        auto& child = _bvh.AddOne();
-        child.Leaf.IsLeaf = 1;
-        child.Leaf.MeshIndex = i;
-        child.Leaf.TriangleIndex = 0;
-        child.Leaf.TriangleCount = meshData.Indices / 3;
-        child.Bounds = meshData.Bounds;
-        BoundingBox::Merge(root.Bounds, meshData.Bounds, root.Bounds);
+        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
+        if (meshData.Use16BitIndexBuffer)
+        {
+            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
+            for (int32 i = 0; i < meshData.Indices; i++)
+                vertices.Add(vb[ib16[i]]);
+        }
+        else
+        {
+            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
+            for (int32 i = 0; i < meshData.Indices; i++)
+                vertices.Add(vb[ib32[i]]);
+        }
     }
+}
 
-    // Sub-divide mesh nodes into smaller leaves
-    Array<byte> scratch;
-    for (int32 i = 0; i < _meshes.Count(); i++)
-        BuildBVH(i + 1, maxLeafSize, scratch);
+void MeshAccelerationStructure::GetTriangles(Array<Triangle>& triangles) const
+{
+    triangles.Clear();
+    triangles.EnsureCapacity(GetTrianglesCount());
+    for (const Mesh& meshData : _meshes)
+    {
+        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
+        if (meshData.Use16BitIndexBuffer)
+        {
+            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
+            for (int32 i = 0; i < meshData.Indices; i += 3)
+                triangles.Add(Triangle(vb[ib16[i]], vb[ib16[i + 1]], vb[ib16[i + 2]]));
+        }
+        else
+        {
+            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
+            for (int32 i = 0; i < meshData.Indices; i += 3)
+                triangles.Add(Triangle(vb[ib32[i]], vb[ib32[i + 1]], vb[ib32[i + 2]]));
+        }
+    }
 }
 
 bool MeshAccelerationStructure::PointQuery(const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle, Real maxDistance) const
 {
-    hitDistance = maxDistance >= MAX_Real ? maxDistance : maxDistance * maxDistance;
+    Real hitDistanceSq = maxDistance >= MAX_Real ? maxDistance : maxDistance * maxDistance;
     bool hit = false;
 
     // BVH
-    if (_bvh.Count() != 0)
+    if (_nodes.Count() != 0)
     {
-        Array<int32, InlinedAllocation<32>> stack;
+        const SimdVector4 pX = SIMD::Splat((float)point.X);
+        const SimdVector4 pY = SIMD::Splat((float)point.Y);
+        const SimdVector4 pZ = SIMD::Splat((float)point.Z);
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        int32 hitIndex = -1;
+        Array<int32, InlinedAllocation<64>> stack;
         stack.Push(0);
         while (stack.HasItems())
         {
-            const int32 node = stack.Pop();
-            auto& root = _bvh[node];
+            const Node& node = _nodes.Get()[stack.Pop()];
 
-            // Skip too far nodes
-            if (root.Bounds.Distance(point) >= hitDistance)
-                continue;
+            // Calculate the squared distance from the point to the children bounds
+            const SimdVector4 dX = SIMD::Max(SIMD::Max(SIMD::Sub(SIMD::LoadUnaligned(node.MinX), pX), SIMD::Sub(pX, SIMD::LoadUnaligned(node.MaxX))), zero);
+            const SimdVector4 dY = SIMD::Max(SIMD::Max(SIMD::Sub(SIMD::LoadUnaligned(node.MinY), pY), SIMD::Sub(pY, SIMD::LoadUnaligned(node.MaxY))), zero);
+            const SimdVector4 dZ = SIMD::Max(SIMD::Max(SIMD::Sub(SIMD::LoadUnaligned(node.MinZ), pZ), SIMD::Sub(pZ, SIMD::LoadUnaligned(node.MaxZ))), zero);
+            float distancesSq[4];
+            SIMD::StoreUnaligned(distancesSq, SIMD::MulAdd(dX, dX, SIMD::MulAdd(dY, dY, SIMD::Mul(dZ, dZ))));
 
-            if (root.Leaf.IsLeaf)
+            // Sort children from the closest to the furthest
+            int32 order[4] = { 0, 1, 2, 3 };
+            for (int32 i = 1; i < 4; i++)
             {
-                // Check this leaf
-                hit |= PointQueryBVH(node, point, hitDistance, hitPoint, hitTriangle);
+                for (int32 j = i; j > 0 && distancesSq[order[j]] < distancesSq[order[j - 1]]; j--)
+                    Swap(order[j], order[j - 1]);
             }
-            else
+
+            // Check the closest leaves first to shrink the search radius, then push the nodes (the closest one ends on the top of the stack)
+            for (int32 i = 0; i < 4; i++)
             {
-                // Check this node children
-                for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
-                    stack.Push(root.Node.ChildIndex + i);
+                const int32 child = order[i];
+                if (node.PacketsCount[child] > 0 && (Real)distancesSq[child] < hitDistanceSq)
+                    PointQueryLeaf(node.Child[child], node.PacketsCount[child], point, hitDistanceSq, hitPoint, hitIndex);
+            }
+            for (int32 i = 3; i >= 0; i--)
+            {
+                const int32 child = order[i];
+                if (node.PacketsCount[child] == 0 && (Real)distancesSq[child] < hitDistanceSq)
+                    stack.Push(node.Child[child]);
             }
         }
-        //hit = PointQueryBVH(0, point, hitDistance, hitPoint, hitTriangle);
-        return hit;
+        if (hitIndex != -1)
+        {
+            hitTriangle = _triangles[hitIndex];
+            hit = true;
+        }
     }
-
-    // Brute-force
+    else
     {
+        // Brute-force
         Vector3 p;
         for (const Mesh& meshData : _meshes)
         {
@@ -472,9 +654,9 @@ bool MeshAccelerationStructure::PointQuery(const Vector3& point, Real& hitDistan
                     Vector3 v2 = vb[ib16[i++]];
                     CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
                     const Real distance = Vector3::DistanceSquared(point, p);
-                    if (distance < hitDistance)
+                    if (distance < hitDistanceSq)
                     {
-                        hitDistance = distance;
+                        hitDistanceSq = distance;
                         hitPoint = p;
                         hitTriangle = Triangle(v0, v1, v2);
                         hit = true;
@@ -491,9 +673,9 @@ bool MeshAccelerationStructure::PointQuery(const Vector3& point, Real& hitDistan
                     Vector3 v2 = vb[ib32[i++]];
                     CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
                     const Real distance = Vector3::DistanceSquared(point, p);
-                    if (distance < hitDistance)
+                    if (distance < hitDistanceSq)
                     {
-                        hitDistance = distance;
+                        hitDistanceSq = distance;
                         hitPoint = p;
                         hitTriangle = Triangle(v0, v1, v2);
                         hit = true;
@@ -501,10 +683,9 @@ bool MeshAccelerationStructure::PointQuery(const Vector3& point, Real& hitDistan
                 }
             }
         }
-        if (hit)
-            hitDistance = Math::Sqrt(hitDistance);
-        return hit;
     }
+    hitDistance = hit ? Math::Sqrt(hitDistanceSq) : maxDistance;
+    return hit;
 }
 
 bool MeshAccelerationStructure::RayCast(const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle, Real maxDistance) const
@@ -512,9 +693,52 @@ bool MeshAccelerationStructure::RayCast(const Ray& ray, Real& hitDistance, Vecto
     hitDistance = maxDistance;
 
     // BVH
-    if (_bvh.Count() != 0)
+    if (_nodes.Count() != 0)
     {
-        return RayCastBVH(0, ray, hitDistance, hitNormal, hitTriangle);
+        const Float3 origin = ray.Position;
+        const Float3 direction = ray.Direction;
+        const SimdVector4 rayOrigin[3] = { SIMD::Splat(origin.X), SIMD::Splat(origin.Y), SIMD::Splat(origin.Z) };
+        const SimdVector4 rayInvDir[3] = { SIMD::Splat(GetSafeInverse(ray.Direction.X)), SIMD::Splat(GetSafeInverse(ray.Direction.Y)), SIMD::Splat(GetSafeInverse(ray.Direction.Z)) };
+        float closestDistance = (float)Math::Min(maxDistance, (Real)MAX_float);
+        int32 hitIndex = -1;
+        Array<int32, InlinedAllocation<64>> stack;
+        stack.Push(0);
+        while (stack.HasItems())
+        {
+            const Node& node = _nodes.Get()[stack.Pop()];
+            float entryDistances[4];
+            const int32 mask = RayIntersectsBounds4(node.MinX, node.MinY, node.MinZ, node.MaxX, node.MaxY, node.MaxZ, rayOrigin, rayInvDir, closestDistance, entryDistances);
+            if (mask == 0)
+                continue;
+
+            // Sort hit children from the closest to the furthest
+            int32 order[4];
+            int32 count = 0;
+            for (int32 i = 0; i < 4; i++)
+            {
+                if ((mask & (1 << i)) == 0 || node.PacketsCount[i] < 0)
+                    continue;
+                int32 j = count++;
+                for (; j > 0 && entryDistances[i] < entryDistances[order[j - 1]]; j--)
+                    order[j] = order[j - 1];
+                order[j] = i;
+            }
+
+            // Check the closest leaves first to shrink the ray length, then push the nodes (the closest one ends on the top of the stack)
+            for (int32 i = 0; i < count; i++)
+            {
+                const int32 child = order[i];
+                if (node.PacketsCount[child] > 0 && entryDistances[child] < closestDistance)
+                    RayCastLeaf(node.Child[child], node.PacketsCount[child], origin, direction, closestDistance, hitIndex);
+            }
+            for (int32 i = count - 1; i >= 0; i--)
+            {
+                const int32 child = order[i];
+                if (node.PacketsCount[child] == 0 && entryDistances[child] < closestDistance)
+                    stack.Push(node.Child[child]);
+            }
+        }
+        return RayCastResolve(ray, hitIndex, closestDistance, hitDistance, hitNormal, hitTriangle);
     }
 
     // Brute-force
@@ -566,4 +790,104 @@ bool MeshAccelerationStructure::RayCast(const Ray& ray, Real& hitDistance, Vecto
     }
 }
 
+int32 MeshAccelerationStructure::RayCast(const Span<Ray>& rays, Real* hitDistances, Vector3* hitNormals, Triangle* hitTriangles, bool* hits, Real maxDistance) const
+{
+    int32 result = 0;
+    if (_nodes.Count() == 0)
+    {
+        for (int32 i = 0; i < rays.Length(); i++)
+        {
+            const bool hit = RayCast(rays[i], hitDistances[i], hitNormals[i], hitTriangles[i], maxDistance);
+            if (hits)
+                hits[i] = hit;
+            result += hit ? 1 : 0;
+        }
+        return result;
+    }
+    PROFILE_CPU();
+
+    // Traverse BVH with packets of rays (each node is fetched once for all rays that intersect it)
+    struct StackEntry
+    {
+        int32 Node;
+        uint32 RaysMask;
+    };
+    Array<StackEntry, InlinedAllocation<64>> stack;
+    SimdVector4 rayOrigins[MESH_AS_RAYS_PACKET_SIZE][3];
+    SimdVector4 rayInvDirs[MESH_AS_RAYS_PACKET_SIZE][3];
+    Float3 origins[MESH_AS_RAYS_PACKET_SIZE];
+    Float3 directions[MESH_AS_RAYS_PACKET_SIZE];
+    float closestDistances[MESH_AS_RAYS_PACKET_SIZE];
+    int32 hitIndices[MESH_AS_RAYS_PACKET_SIZE];
+    const float maxDistanceFloat = (float)Math::Min(maxDistance, (Real)MAX_float);
+    for (int32 rayStart = 0; rayStart < rays.Length(); rayStart += MESH_AS_RAYS_PACKET_SIZE)
+    {
+        const int32 raysCount = Math::Min(MESH_AS_RAYS_PACKET_SIZE, rays.Length() - rayStart);
+        for (int32 r = 0; r < raysCount; r++)
+        {
+            const Ray& ray = rays[rayStart + r];
+            origins[r] = ray.Position;
+            directions[r] = ray.Direction;
+            rayOrigins[r][0] = SIMD::Splat(origins[r].X);
+            rayOrigins[r][1] = SIMD::Splat(origins[r].Y);
+            rayOrigins[r][2] = SIMD::Splat(origins[r].Z);
+            rayInvDirs[r][0] = SIMD::Splat(GetSafeInverse(ray.Direction.X));
+            rayInvDirs[r][1] = SIMD::Splat(GetSafeInverse(ray.Direction.Y));
+            rayInvDirs[r][2] = SIMD::Splat(GetSafeInverse(ray.Direction.Z));
+            closestDistances[r] = maxDistanceFloat;
+            hitIndices[r] = -1;
+        }
+
+        stack.Clear();
+        stack.Push({ 0, raysCount == 32 ? MAX_uint32 : (1u << raysCount) - 1 });
+        while (stack.HasItems())
+        {
+            const StackEntry entry = stack.Pop();
+            const Node& node = _nodes.Get()[entry.Node];
+
+            // Find which rays hit each child
+            uint32 childRays[4] = {};
+            for (int32 r = 0; r < raysCount; r++)
+            {
+                if ((entry.RaysMask & (1u << r)) == 0)
+                    continue;
+                const int32 mask = RayIntersectsBounds4(node.MinX, node.MinY, node.MinZ, node.MaxX, node.MaxY, node.MaxZ, rayOrigins[r], rayInvDirs[r], closestDistances[r], nullptr);
+                for (int32 i = 0; i < 4; i++)
+                {
+                    if (mask & (1 << i))
+                        childRays[i] |= 1u << r;
+                }
+            }
+
+            for (int32 i = 0; i < 4; i++)
+            {
+                if (childRays[i] == 0 || node.PacketsCount[i] < 0)
+                    continue;
+                if (node.PacketsCount[i] == 0)
+                {
+                    stack.Push({ node.Child[i], childRays[i] });
+                    continue;
+                }
+                for (int32 r = 0; r < raysCount; r++)
+                {
+                    if (childRays[i] & (1u << r))
+                        RayCastLeaf(node.Child[i], node.PacketsCount[i], origins[r], directions[r], closestDistances[r], hitIndices[r]);
+                }
+            }
+        }
+
+        // Output results
+        for (int32 r = 0; r < raysCount; r++)
+        {
+            const int32 rayIndex = rayStart + r;
+            hitDistances[rayIndex] = maxDistance;
+            const bool hit = RayCastResolve(rays[rayIndex], hitIndices[r], closestDistances[r], hitDistances[rayIndex], hitNormals[rayIndex], hitTriangles[rayIndex]);
+            if (hits)
+                hits[rayIndex] = hit;
+            result += hit ? 1 : 0;
+        }
+    }
+    return result;
+}
+
 #endif
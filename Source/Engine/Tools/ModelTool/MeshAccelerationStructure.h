@@ -7,6 +7,7 @@
 #include "Engine/Core/Math/Triangle.h"
 #include "Engine/Core/Math/BoundingBox.h"
 #include "Engine/Core/Types/DataContainer.h"
+#include "Engine/Core/Types/Span.h"
 #include "Engine/Core/Collections/Array.h"
 
 class Model;
@@ -26,35 +27,35 @@ class FLAXENGINE_API MeshAccelerationStructure
         BoundingBox Bounds;
     };
 
-    struct BVH
+    // Node of the 4-wide BVH with the children bounds stored as structure of arrays for SIMD tests.
+    struct Node
     {
-        BoundingBox Bounds;
+        float MinX[4], MinY[4], MinZ[4];
+        float MaxX[4], MaxY[4], MaxZ[4];
+        // Child node index (for inner nodes) or the first triangles packet index (for leaves).
+        int32 Child[4];
+        // Amount of triangle packets in the child leaf, 0 for inner nodes and -1 for empty slots.
+        int32 PacketsCount[4];
+    };
 
-        union
-        {
-            struct
-            {
-                uint32 IsLeaf : 1;
-                uint16 TriangleCount : 15;
-                uint16 MeshIndex : 16;
-                uint32 TriangleIndex;
-            } Leaf;
-
-            struct
-            {
-                uint32 IsLeaf : 1;
-                uint32 ChildrenCount : 31;
-                int32 ChildIndex;
-            } Node;
-        };
+    // Four triangles stored as structure of arrays for SIMD tests (vertex and two edges).
+    struct TrianglePacket
+    {
+        float V0X[4], V0Y[4], V0Z[4];
+        float E1X[4], E1Y[4], E1Z[4];
+        float E2X[4], E2Y[4], E2Z[4];
     };
 
     Array<Mesh, InlinedAllocation<16>> _meshes;
-    Array<BVH> _bvh;
+    Array<Node> _nodes;
+    Array<TrianglePacket> _packets;
+    Array<Triangle> _triangles; // Matches the packets lanes (4 per packet, leaves are padded with the duplicated triangles).
 
-    void BuildBVH(int32 node, int32 maxLeafSize, Array<byte>& scratch);
-    bool PointQueryBVH(int32 node, const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle) const;
-    bool RayCastBVH(int32 node, const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle) const;
+    struct BuildNode;
+    int32 CollapseNode(const Array<BuildNode>& buildNodes, int32 buildNodeIndex, const Array<Triangle>& triangles, const Array<int32>& indices);
+    void PointQueryLeaf(int32 packetIndex, int32 packetsCount, const Vector3& point, Real& hitDistanceSq, Vector3& hitPoint, int32& hitIndex) const;
+    void RayCastLeaf(int32 packetIndex, int32 packetsCount, const Float3& origin, const Float3& direction, float& hitDistance, int32& hitIndex) const;
+    bool RayCastResolve(const Ray& ray, int32 hitIndex, float hitDistance, Real& resultDistance, Vector3& resultNormal, Triangle& resultTriangle) const;
 
 public:
     // Adds the model geometry for the build to the structure.
@@ -66,14 +67,26 @@ class FLAXENGINE_API MeshAccelerationStructure
     // Adds the triangles geometry for the build to the structure.
     void Add(Float3* vb, int32 vertices, void* ib, int32 indices, bool use16BitIndex, bool copy = false);
 
-    // Builds Bounding Volume Hierarchy (BVH) structure for accelerated geometry queries.
+    // Builds Bounding Volume Hierarchy (BVH) structure for accelerated geometry queries. Uses Surface Area Heuristic (SAH) and 4-wide nodes.
     void BuildBVH(int32 maxLeafSize = 16);
 
+    // Gets the amount of triangles in all meshes.
+    int32 GetTrianglesCount() const;
+
+    // Gets the triangles geometry of all meshes as a flat list of vertices (3 per triangle, eg. to upload it to the GPU).
+    void GetTriangles(Array<Float3>& vertices) const;
+
+    // Gets the triangles geometry of all meshes.
+    void GetTriangles(Array<Triangle>& triangles) const;
+
     // Queries the closest triangle.
     bool PointQuery(const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle, Real maxDistance = MAX_Real) const;
 
     // Ray traces the triangles.
     bool RayCast(const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle, Real maxDistance = MAX_Real) const;
+
+    // Ray traces the triangles with a batch of rays traversing the BVH together (eg. samples around the point). Outputs the result for each ray (hits array is optional). Returns the amount of rays that hit the geometry.
+    int32 RayCast(const Span<Ray>& rays, Real* hitDistances, Vector3* hitNormals, Triangle* hitTriangles, bool* hits = nullptr, Real maxDistance = MAX_Real) const;
 };
 
 #endif
@@ -293,11 +293,7 @@ bool ProcessMesh(ImportedModelData& result, AssimpImporterData& data, const aiMe
     }
     else if (data.Options.LightmapUVsSource == ModelLightmapUVsSource::Generate)
     {
-        // Generate lightmap UVs
-        if (mesh.GenerateLightmapUVs())
-        {
-            LOG(Error, "Failed to generate lightmap uvs");
-        }
+        // Generated for all imported meshes in parallel (see ModelTool::ImportData)
     }
     else
     {
@@ -411,12 +411,7 @@ bool ProcessMesh(ImporterData& data, FbxMesh* fbxMesh, MeshData& mesh, String& e
     }
     else if (data.Options.LightmapUVsSource == ModelLightmapUVsSource::Generate)
     {
-        // Generate lightmap UVs
-        if (mesh.GenerateLightmapUVs())
-        {
-            // TODO: we could propagate this message to Debug Console in editor? or create interface to gather some msgs from importing service
-            LOG(Warning, "Failed to generate lightmap uvs");
-        }
+        // Generated for all imported meshes in parallel (see ModelTool::ImportData)
     }
     else
     {
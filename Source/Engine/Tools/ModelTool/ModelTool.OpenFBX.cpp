@@ -11,6 +11,8 @@
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Tools/TextureTool/TextureTool.h"
 #include "Engine/Platform/File.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
 // Import OpenFBX library
 // Source: https://github.com/nem0/OpenFBX
@@ -635,11 +637,7 @@ bool ProcessMesh(ImportedModelData& result, OpenFbxImporterData& data, const ofb
     }
     else if (data.Options.LightmapUVsSource == ModelLightmapUVsSource::Generate)
     {
-        // Generate lightmap UVs
-        if (mesh.GenerateLightmapUVs())
-        {
-            LOG(Error, "Failed to generate lightmap uvs");
-        }
+        // Generated for all imported meshes in parallel (see ModelTool::ImportData)
     }
     else
     {
@@ -827,39 +825,73 @@ bool ProcessMesh(ImportedModelData& result, OpenFbxImporterData& data, const ofb
         }
     }
 
-    // Build solid index buffer (remove duplicated vertices)
-    mesh.BuildIndexBuffer();
+    // Index buffer, tangents and optimization are processed after import for all meshes in parallel (see ProcessMeshes)
 
-    if (data.ConvertRH)
+    // Apply FBX Mesh geometry transformation
+    /*const Matrix geometryTransform = ToMatrix(aMesh->getGeometricMatrix());
+    if (!geometryTransform.IsIdentity())
+    {
+        mesh.TransformBuffer(geometryTransform);
+    }*/
+
+    return false;
+}
+
+bool ProcessMeshes(ImportedModelData& result, OpenFbxImporterData& data, String& errorMsg)
+{
+    Array<MeshData*> meshes;
+    for (auto& lod : result.LODs)
+        meshes.Add(lod.Meshes);
+    if (meshes.IsEmpty())
+        return false;
+    PROFILE_CPU();
+
+    // Meshes data is independent so process them on Job System (tangents generation and optimizations are the heaviest parts of the import)
+    Array<bool> failed;
+    failed.Resize(meshes.Count());
+    Function<void(int32)> processJob = [&meshes, &failed, &data](int32 meshIndex)
     {
-        // Invert the order
-        for (int32 i = 0; i < mesh.Indices.Count(); i += 3)
+        PROFILE_CPU_NAMED("Process Mesh Job");
+        MeshData& mesh = *meshes[meshIndex];
+        failed[meshIndex] = false;
+
+        // Build solid index buffer (remove duplicated vertices)
+        mesh.BuildIndexBuffer();
+
+        if (data.ConvertRH)
         {
-            Swap(mesh.Indices[i], mesh.Indices[i + 2]);
+            // Invert the order
+            for (int32 i = 0; i < mesh.Indices.Count(); i += 3)
+            {
+                Swap(mesh.Indices[i], mesh.Indices[i + 2]);
+            }
         }
-    }
 
-    if ((data.Options.CalculateTangents || !tangents) && mesh.UVs.HasItems())
-    {
-        if (mesh.GenerateTangents(data.Options.SmoothingTangentsAngle))
+        // Tangents are missing if need to be calculated (see ProcessMesh)
+        if (mesh.Tangents.IsEmpty() && mesh.UVs.HasItems())
         {
-            errorMsg = TEXT("Failed to generate tangents.");
-            return true;
+            if (mesh.GenerateTangents(data.Options.SmoothingTangentsAngle))
+            {
+                failed[meshIndex] = true;
+                return;
+            }
         }
-    }
 
-    if (data.Options.OptimizeMeshes)
-    {
-        mesh.ImproveCacheLocality();
-    }
+        if (data.Options.OptimizeMeshes)
+        {
+            mesh.ImproveCacheLocality();
+        }
+    };
+    JobSystem::Execute(processJob, meshes.Count());
 
-    // Apply FBX Mesh geometry transformation
-    /*const Matrix geometryTransform = ToMatrix(aMesh->getGeometricMatrix());
-    if (!geometryTransform.IsIdentity())
+    for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
     {
-        mesh.TransformBuffer(geometryTransform);
-    }*/
-
+        if (failed[meshIndex])
+        {
+            errorMsg = String::Format(TEXT("Failed to generate tangents for mesh {0}."), meshes[meshIndex]->Name);
+            return true;
+        }
+    }
     return false;
 }
 
@@ -1282,6 +1314,8 @@ bool ModelTool::ImportDataOpenFBX(const char* path, ImportedModelData& data, Opt
                     return true;
             }
         }
+        if (ProcessMeshes(data, *context, errorMsg))
+            return true;
     }
 
     // Import skeleton
@@ -8,10 +8,21 @@
 #include "Engine/Core/RandomStream.h"
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Ray.h"
-#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Core/Math/Half.h"
+#include "Engine/Profiler/Profiler.h"
 #include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/Assets/Shader.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPULimits.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Async/GPUTask.h"
+#include "Engine/Graphics/Async/GPUTasksContext.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Graphics/Models/ModelData.h"
@@ -67,6 +78,178 @@ ModelSDFMip::ModelSDFMip(int32 mipIndex, const TextureMipData& mip)
 {
 }
 
+// Those defines must match the HLSL
+#define MODEL_SDF_THREAD_GROUP_SIZE 64
+#define MODEL_SDF_THREAD_GROUP_SIZE_3D 4
+
+namespace
+{
+    PACK_STRUCT(struct ModelSDFData {
+        Int3 Resolution;
+        uint32 TrianglesCount;
+        Float3 VoxelToPosMul;
+        float MaxDistance;
+        Float3 VoxelToPosAdd;
+        int32 JumpStep;
+        uint32 TrianglesOffset;
+        Float3 Dummy0;
+        });
+
+    class GPUModelSDFTask : public GPUTask
+    {
+    private:
+        AssetReference<Shader> _shader;
+        ModelSDFData _data;
+        GPUBuffer* _triangles;
+        GPUBuffer* _voxelsA;
+        GPUBuffer* _voxelsB;
+        GPUBuffer*& _output;
+
+    public:
+        GPUModelSDFTask(Shader* shader, const ModelSDFData& data, GPUBuffer* triangles, GPUBuffer* voxelsA, GPUBuffer* voxelsB, GPUBuffer*& output)
+            : GPUTask(Type::Custom)
+            , _shader(shader)
+            , _data(data)
+            , _triangles(triangles)
+            , _voxelsA(voxelsA)
+            , _voxelsB(voxelsB)
+            , _output(output)
+        {
+        }
+
+        Result run(GPUTasksContext* context) override
+        {
+            PROFILE_GPU_CPU("Model SDF");
+            GPUShader* shader = _shader->GetShader();
+            GPUConstantBuffer* cb = shader->GetCB(0);
+            if (cb->GetSize() != sizeof(ModelSDFData))
+            {
+                LOG(Error, "Shader {0} has incorrect constant buffer {1} size: {2} bytes. Expected: {3} bytes", shader->ToString(), 0, cb->GetSize(), sizeof(ModelSDFData));
+                return Result::Failed;
+            }
+            GPUContext* gpu = context->GPU;
+            ModelSDFData data = _data;
+            const uint32 maxGroups = GPU_MAX_CS_DISPATCH_THREAD_GROUPS;
+            const uint32 trianglesPerBatch = maxGroups * MODEL_SDF_THREAD_GROUP_SIZE;
+            const Int3 groups3D(Math::DivideAndRoundUp(data.Resolution.X, MODEL_SDF_THREAD_GROUP_SIZE_3D), Math::DivideAndRoundUp(data.Resolution.Y, MODEL_SDF_THREAD_GROUP_SIZE_3D), Math::DivideAndRoundUp(data.Resolution.Z, MODEL_SDF_THREAD_GROUP_SIZE_3D));
+
+            // Rasterize triangles into the nearby voxels (closest distance first, then the triangle that matches it)
+            const uint32 clearValue[4] = { MAX_uint32, MAX_uint32, MAX_uint32, MAX_uint32 };
+            gpu->ClearUA(_voxelsA, clearValue);
+            gpu->ClearUA(_voxelsB, clearValue);
+            gpu->BindSR(0, _triangles->View());
+            gpu->BindUA(0, _voxelsA->View());
+            gpu->BindUA(1, _voxelsB->View());
+            GPUShaderProgramCS* rasterizeCS[2] = { shader->GetCS("CS_RasterizeDistance"), shader->GetCS("CS_RasterizeTriangle") };
+            for (GPUShaderProgramCS* cs : rasterizeCS)
+            {
+                for (uint32 offset = 0; offset < data.TrianglesCount; offset += trianglesPerBatch)
+                {
+                    data.TrianglesOffset = offset;
+                    gpu->UpdateCB(cb, &data);
+                    gpu->BindCB(0, cb);
+                    gpu->Dispatch(cs, Math::Min(Math::DivideAndRoundUp(data.TrianglesCount - offset, (uint32)MODEL_SDF_THREAD_GROUP_SIZE), maxGroups), 1, 1);
+                }
+                gpu->ResetUA();
+                gpu->BindUA(0, _voxelsA->View());
+                gpu->BindUA(1, _voxelsB->View());
+            }
+            gpu->ResetUA();
+
+            // Propagate the closest triangles to all voxels with Jump Flooding (with an additional final pass of 1 step to fix the remaining errors)
+            GPUBuffer* input = _voxelsB;
+            GPUBuffer* output = _voxelsA;
+            GPUShaderProgramCS* jumpFloodCS = shader->GetCS("CS_JumpFlood");
+            int32 jumpStep = Math::RoundUpToPowerOf2(data.Resolution.MaxValue()) / 2;
+            Array<int32, InlinedAllocation<16>> jumpSteps;
+            for (; jumpStep >= 1; jumpStep /= 2)
+                jumpSteps.Add(jumpStep);
+            jumpSteps.Add(1);
+            for (int32 step : jumpSteps)
+            {
+                data.JumpStep = step;
+                gpu->UpdateCB(cb, &data);
+                gpu->BindCB(0, cb);
+                gpu->BindSR(1, input->View());
+                gpu->BindUA(0, output->View());
+                gpu->Dispatch(jumpFloodCS, groups3D.X, groups3D.Y, groups3D.Z);
+                gpu->UnBindSR(1);
+                gpu->ResetUA();
+                Swap(input, output);
+            }
+
+            // Resolve signed distances (float per voxel)
+            gpu->BindSR(1, input->View());
+            gpu->BindUA(0, output->View());
+            gpu->Dispatch(shader->GetCS("CS_Resolve"), groups3D.X, groups3D.Y, groups3D.Z);
+            gpu->ResetUA();
+            gpu->ResetSR();
+            _output = output;
+
+            return Result::Ok;
+        }
+    };
+
+    // Generates the signed distances (in local-space units) for all voxels of the SDF on a GPU. Returns true if failed (or GPU is unavailable).
+    bool GenerateModelSDFGPU(const MeshAccelerationStructure& scene, const Int3& resolution, const Float3& xyzToLocalMul, const Float3& xyzToLocalAdd, float maxDistance, Array<float>& distances)
+    {
+        // GPU task has to be awaited so skip it on the main thread (rendering happens there)
+        if (IsInMainThread() ||
+            !GPUDevice::Instance ||
+            GPUDevice::Instance->GetState() != GPUDevice::DeviceState::Ready ||
+            !GPUDevice::Instance->Limits.HasCompute)
+            return true;
+        Array<Float3> triangles;
+        scene.GetTriangles(triangles);
+        if (triangles.IsEmpty())
+            return true;
+        AssetReference<Shader> shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ModelSDF"));
+        if (!shader || shader->WaitForLoaded())
+            return true;
+        PROFILE_CPU();
+
+        // Setup resources
+        const int32 voxelsCount = resolution.X * resolution.Y * resolution.Z;
+        GPUBuffer* trianglesBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ModelSDF.Triangles"));
+        GPUBuffer* voxelsA = GPUDevice::Instance->CreateBuffer(TEXT("ModelSDF.VoxelsA"));
+        GPUBuffer* voxelsB = GPUDevice::Instance->CreateBuffer(TEXT("ModelSDF.VoxelsB"));
+        GPUBuffer* output = nullptr;
+        bool failed = trianglesBuffer->Init(GPUBufferDescription::Buffer(triangles.Count() * sizeof(Float3), GPUBufferFlags::Structured | GPUBufferFlags::ShaderResource, PixelFormat::Unknown, triangles.Get(), sizeof(Float3))) ||
+                voxelsA->Init(GPUBufferDescription::Structured(voxelsCount, sizeof(uint32), true)) ||
+                voxelsB->Init(GPUBufferDescription::Structured(voxelsCount, sizeof(uint32), true));
+
+        // Run on a GPU and read the results back
+        if (!failed)
+        {
+            ModelSDFData data;
+            data.Resolution = resolution;
+            data.TrianglesCount = triangles.Count() / 3;
+            data.VoxelToPosMul = xyzToLocalMul;
+            data.MaxDistance = maxDistance;
+            data.VoxelToPosAdd = xyzToLocalAdd;
+            data.JumpStep = 1;
+            data.TrianglesOffset = 0;
+            data.Dummy0 = Float3::Zero;
+            auto task = New<GPUModelSDFTask>(shader.Get(), data, trianglesBuffer, voxelsA, voxelsB, output);
+            task->Start();
+            BytesContainer result;
+            failed = task->Wait() || !output || output->DownloadData(result) || result.Length() != voxelsCount * sizeof(float);
+            if (!failed)
+            {
+                distances.Resize(voxelsCount, false);
+                Platform::MemoryCopy(distances.Get(), result.Get(), result.Length());
+            }
+        }
+
+        SAFE_DELETE_GPU_RESOURCE(trianglesBuffer);
+        SAFE_DELETE_GPU_RESOURCE(voxelsA);
+        SAFE_DELETE_GPU_RESOURCE(voxelsB);
+        if (failed)
+            LOG(Warning, "Failed to generate model SDF on a GPU. Using CPU instead.");
+        return failed;
+    }
+}
+
 bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float resolutionScale, int32 lodIndex, ModelBase::SDFData* outputSDF, MemoryWriteStream* outputStream, const StringView& assetName, float backfacesThreshold)
 {
     PROFILE_CPU();
@@ -140,15 +323,12 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
 #endif
     }
 
-    // TODO: support GPU to generate model SDF on-the-fly (if called during rendering)
-
     // Setup acceleration structure for fast ray tracing the mesh triangles
     MeshAccelerationStructure scene;
     if (inputModel)
         scene.Add(inputModel, lodIndex);
     else if (modelData)
         scene.Add(modelData, lodIndex);
-    scene.BuildBVH();
 
     // Allocate memory for the distant field
     const int32 voxelsSize = resolution.X * resolution.Y * resolution.Z * formatStride;
@@ -165,67 +345,88 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
     // http://ramakarl.com/pdfs/2016_Hoetzlein_GVDB.pdf
     // https://www.cse.chalmers.se/~uffe/HighResolutionSparseVoxelDAGs.pdf
 
-    // Brute-force for each voxel to calculate distance to the closest triangle with point query and distance sign by raycasting around the voxel
-    const int32 sampleCount = 12;
-    Array<Float3> sampleDirections;
-    sampleDirections.Resize(sampleCount);
+    // Try using GPU to generate distance field (fallbacks to the CPU if GPU is not available)
+    Array<float> gpuDistances;
+    if (!GenerateModelSDFGPU(scene, resolution, xyzToLocalMul, xyzToLocalAdd, sdf.MaxDistance, gpuDistances))
     {
-        RandomStream rand;
-        sampleDirections.Get()[0] = Float3::Up;
-        sampleDirections.Get()[1] = Float3::Down;
-        sampleDirections.Get()[2] = Float3::Left;
-        sampleDirections.Get()[3] = Float3::Right;
-        sampleDirections.Get()[4] = Float3::Forward;
-        sampleDirections.Get()[5] = Float3::Backward;
-        for (int32 i = 6; i < sampleCount; i++)
-            sampleDirections.Get()[i] = rand.GetUnitVector();
+        Function<void(int32)> encodeJob = [&resolution, &gpuDistances, &voxels, &encodeMAD, &formatStride, &formatWrite](int32 z)
+        {
+            PROFILE_CPU_NAMED("Model SDF Encode Job");
+            const int32 zAddress = resolution.Y * resolution.X * z;
+            for (int32 i = zAddress; i < zAddress + resolution.Y * resolution.X; i++)
+                formatWrite((byte*)voxels + i * formatStride, gpuDistances.Get()[i] * encodeMAD.X + encodeMAD.Y);
+        };
+        JobSystem::Execute(encodeJob, resolution.Z, JobPriority::Background);
     }
-    Function<void(int32)> sdfJob = [&sdf, &resolution, &backfacesThreshold, &sampleDirections, &scene, &voxels, &xyzToLocalMul, &xyzToLocalAdd, &encodeMAD, &formatStride, &formatWrite](int32 z)
+    else
     {
-        PROFILE_CPU_NAMED("Model SDF Job");
-        Real hitDistance;
-        Vector3 hitNormal, hitPoint;
-        Triangle hitTriangle;
-        const int32 zAddress = resolution.Y * resolution.X * z;
-        for (int32 y = 0; y < resolution.Y; y++)
-        {
-            const int32 yAddress = resolution.X * y + zAddress;
-            for (int32 x = 0; x < resolution.X; x++)
-            {
-                Real minDistance = sdf.MaxDistance;
-                Vector3 voxelPos = Float3((float)x, (float)y, (float)z) * xyzToLocalMul + xyzToLocalAdd;
-
-                // Point query to find the distance to the closest surface
-                scene.PointQuery(voxelPos, minDistance, hitPoint, hitTriangle);
+        scene.BuildBVH();
 
-                // Raycast samples around voxel to count triangle backfaces hit
-                int32 hitBackCount = 0, hitCount = 0;
-                for (int32 sample = 0; sample < sampleDirections.Count(); sample++)
+        // Brute-force for each voxel to calculate distance to the closest triangle with point query and distance sign by raycasting around the voxel
+        constexpr int32 sampleCount = 12;
+        Array<Float3> sampleDirections;
+        sampleDirections.Resize(sampleCount);
+        {
+            RandomStream rand;
+            sampleDirections.Get()[0] = Float3::Up;
+            sampleDirections.Get()[1] = Float3::Down;
+            sampleDirections.Get()[2] = Float3::Left;
+            sampleDirections.Get()[3] = Float3::Right;
+            sampleDirections.Get()[4] = Float3::Forward;
+            sampleDirections.Get()[5] = Float3::Backward;
+            for (int32 i = 6; i < sampleCount; i++)
+                sampleDirections.Get()[i] = rand.GetUnitVector();
+        }
+        Function<void(int32)> sdfJob = [&sdf, &resolution, &backfacesThreshold, &sampleDirections, &scene, &voxels, &xyzToLocalMul, &xyzToLocalAdd, &encodeMAD, &formatStride, &formatWrite](int32 z)
+        {
+            PROFILE_CPU_NAMED("Model SDF Job");
+            Vector3 hitPoint;
+            Triangle hitTriangle;
+            Ray sampleRays[sampleCount];
+            Real hitDistances[sampleCount];
+            Vector3 hitNormals[sampleCount];
+            Triangle hitTriangles[sampleCount];
+            bool hits[sampleCount];
+            const int32 zAddress = resolution.Y * resolution.X * z;
+            for (int32 y = 0; y < resolution.Y; y++)
+            {
+                const int32 yAddress = resolution.X * y + zAddress;
+                for (int32 x = 0; x < resolution.X; x++)
                 {
-                    Ray sampleRay(voxelPos, sampleDirections[sample]);
-                    if (scene.RayCast(sampleRay, hitDistance, hitNormal, hitTriangle))
+                    Real minDistance = sdf.MaxDistance;
+                    Vector3 voxelPos = Float3((float)x, (float)y, (float)z) * xyzToLocalMul + xyzToLocalAdd;
+
+                    // Point query to find the distance to the closest surface
+                    scene.PointQuery(voxelPos, minDistance, hitPoint, hitTriangle);
+
+                    // Raycast samples around voxel to count triangle backfaces hit (all rays traverse the BVH together)
+                    for (int32 sample = 0; sample < sampleCount; sample++)
+                        sampleRays[sample] = Ray(voxelPos, sampleDirections[sample]);
+                    const int32 hitCount = scene.RayCast(ToSpan(sampleRays, sampleCount), hitDistances, hitNormals, hitTriangles, hits);
+                    int32 hitBackCount = 0;
+                    for (int32 sample = 0; sample < sampleCount; sample++)
                     {
-                        hitCount++;
-                        const bool backHit = Float3::Dot(sampleRay.Direction, hitTriangle.GetNormal()) > 0;
-                        if (backHit)
+                        if (hits[sample] && Float3::Dot(sampleRays[sample].Direction, hitTriangles[sample].GetNormal()) > 0)
                             hitBackCount++;
                     }
-                }
 
-                float distance = (float)minDistance;
-                // TODO: surface thickness threshold? shift reduce distance for all voxels by something like 0.01 to enlarge thin geometry
-                // if ((float)hitBackCount > (float)hitCount * 0.3f && hitCount != 0)
-                if ((float)hitBackCount > (float)sampleDirections.Count() * backfacesThreshold && hitCount != 0)
-                {
-                    // Voxel is inside the geometry so turn it into negative distance to the surface
-                    distance *= -1;
+                    float distance = (float)minDistance;
+                    // TODO: surface thickness threshold? shift reduce distance for all voxels by something like 0.01 to enlarge thin geometry
+                    // if ((float)hitBackCount > (float)hitCount * 0.3f && hitCount != 0)
+                    if ((float)hitBackCount > (float)sampleDirections.Count() * backfacesThreshold && hitCount != 0)
+                    {
+                        // Voxel is inside the geometry so turn it into negative distance to the surface
+                        distance *= -1;
+                    }
+                    const int32 xAddress = x + yAddress;
+                    formatWrite((byte*)voxels + xAddress * formatStride, distance * encodeMAD.X + encodeMAD.Y);
                 }
-                const int32 xAddress = x + yAddress;
-                formatWrite((byte*)voxels + xAddress * formatStride, distance * encodeMAD.X + encodeMAD.Y);
             }
-        }
-    };
-    JobSystem::Execute(sdfJob, resolution.Z);
+        };
+        JobSystem::Execute(sdfJob, resolution.Z, JobPriority::Background);
+    }
+
+
 
     // Cache SDF data on a CPU
     if (outputStream)
@@ -291,7 +492,7 @@ bool ModelTool::GenerateModelSDF(Model* inputModel, ModelData* modelData, float
                 }
             }
         };
-        JobSystem::Execute(mipJob, resolutionMip.Z);
+        JobSystem::Execute(mipJob, resolutionMip.Z, JobPriority::Background);
 
         // Cache SDF data on a CPU
         if (outputStream)
@@ -360,12 +561,16 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(CalculateTangents);
     SERIALIZE(SmoothingTangentsAngle);
     SERIALIZE(OptimizeMeshes);
+    SERIALIZE(OptimizeOverdraw);
+    SERIALIZE(OptimizeVertexFetch);
     SERIALIZE(MergeMeshes);
     SERIALIZE(ImportLODs);
     SERIALIZE(ImportVertexColors);
     SERIALIZE(ImportBlendShapes);
     SERIALIZE(LightmapUVsSource);
+    SERIALIZE(LightmapUVsQuality);
     SERIALIZE(CollisionMeshesPrefix);
+    SERIALIZE(GenerateMeshlets);
     SERIALIZE(Scale);
     SERIALIZE(Rotation);
     SERIALIZE(Translation);
@@ -379,10 +584,17 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(ImportScaleTracks);
     SERIALIZE(EnableRootMotion);
     SERIALIZE(RootNodeName);
+    SERIALIZE(CompressAnimation);
+    SERIALIZE(CompressionPositionError);
+    SERIALIZE(CompressionRotationError);
+    SERIALIZE(CompressionScaleError);
     SERIALIZE(GenerateLODs);
+    SERIALIZE(KeepSourceLODs);
     SERIALIZE(BaseLOD);
     SERIALIZE(LODCount);
     SERIALIZE(TriangleReduction);
+    SERIALIZE(MaxSimplificationError);
+    SERIALIZE(SloppySimplification);
     SERIALIZE(ImportMaterials);
     SERIALIZE(ImportTextures);
     SERIALIZE(RestoreMaterialsOnReimport);
@@ -401,12 +613,16 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(CalculateTangents);
     DESERIALIZE(SmoothingTangentsAngle);
     DESERIALIZE(OptimizeMeshes);
+    DESERIALIZE(OptimizeOverdraw);
+    DESERIALIZE(OptimizeVertexFetch);
     DESERIALIZE(MergeMeshes);
     DESERIALIZE(ImportLODs);
     DESERIALIZE(ImportVertexColors);
     DESERIALIZE(ImportBlendShapes);
     DESERIALIZE(LightmapUVsSource);
+    DESERIALIZE(LightmapUVsQuality);
     DESERIALIZE(CollisionMeshesPrefix);
+    DESERIALIZE(GenerateMeshlets);
     DESERIALIZE(Scale);
     DESERIALIZE(Rotation);
     DESERIALIZE(Translation);
@@ -420,10 +636,17 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(ImportScaleTracks);
     DESERIALIZE(EnableRootMotion);
     DESERIALIZE(RootNodeName);
+    DESERIALIZE(CompressAnimation);
+    DESERIALIZE(CompressionPositionError);
+    DESERIALIZE(CompressionRotationError);
+    DESERIALIZE(CompressionScaleError);
     DESERIALIZE(GenerateLODs);
+    DESERIALIZE(KeepSourceLODs);
     DESERIALIZE(BaseLOD);
     DESERIALIZE(LODCount);
     DESERIALIZE(TriangleReduction);
+    DESERIALIZE(MaxSimplificationError);
+    DESERIALIZE(SloppySimplification);
     DESERIALIZE(ImportMaterials);
     DESERIALIZE(ImportTextures);
     DESERIALIZE(RestoreMaterialsOnReimport);
@@ -446,6 +669,52 @@ void RemoveNamespace(String& name)
         name = name.Substring(namespaceStart + 1);
 }
 
+void GetMeshes(ImportedModelData& data, Array<MeshData*>& meshes)
+{
+    for (auto& lod : data.LODs)
+        meshes.Add(lod.Meshes);
+}
+
+void GenerateLightmapUVs(ImportedModelData& data, const ModelTool::Options& options)
+{
+    Array<MeshData*> meshes;
+    GetMeshes(data, meshes);
+    if (options.CollisionMeshesPrefix.HasChars())
+    {
+        // Skip meshes that will be extracted into collision data
+        for (int32 i = meshes.Count() - 1; i >= 0; i--)
+        {
+            if (meshes[i]->Name.StartsWith(options.CollisionMeshesPrefix, StringSearchCase::IgnoreCase))
+                meshes.RemoveAtKeepOrder(i);
+        }
+    }
+    if (meshes.IsEmpty())
+        return;
+    PROFILE_CPU();
+    LOG(Info, "Generating lightmap UVs for {0} meshes...", meshes.Count());
+    const DateTime startTime = DateTime::Now();
+
+    // UVAtlas charting is the slowest part of the import so process all meshes at once on Job System
+    Function<void(int32)> generateJob = [&meshes, &options](int32 meshIndex)
+    {
+        PROFILE_CPU_NAMED("Lightmap UVs Job");
+        MeshData& mesh = *meshes[meshIndex];
+        if (mesh.GenerateLightmapUVs(options.LightmapUVsQuality))
+        {
+            LOG(Warning, "Failed to generate lightmap uvs for mesh {0}", mesh.Name);
+            return;
+        }
+
+        // Vertex buffer has been remapped so restore the vertex cache optimization
+        if (options.OptimizeMeshes)
+            mesh.ImproveCacheLocality();
+    };
+    JobSystem::Execute(generateJob, meshes.Count());
+
+    const DateTime endTime = DateTime::Now();
+    LOG(Info, "Lightmap UVs generated in {0}ms", Math::CeilToInt((float)(endTime - startTime).GetTotalMilliseconds()));
+}
+
 bool ModelTool::ImportData(const String& path, ImportedModelData& data, Options& options, String& errorMsg)
 {
     // Validate options
@@ -543,6 +812,12 @@ bool ModelTool::ImportData(const String& path, ImportedModelData& data, Options&
         }
     }
 
+    // Generate lightmap UVs (after import to process all meshes in parallel)
+    if (options.LightmapUVsSource == ModelLightmapUVsSource::Generate && EnumHasAnyFlags(data.Types, ImportDataTypes::Geometry))
+    {
+        GenerateLightmapUVs(data, options);
+    }
+
     // Validate the animation channels
     if (data.Animation.Channels.HasItems())
     {
@@ -724,6 +999,56 @@ void OptimizeCurve(LinearCurve<T>& curve)
     }
 }
 
+FORCE_INLINE float GetKeyframesError(const Float3& a, const Float3& b)
+{
+    return Float3::Distance(a, b);
+}
+
+FORCE_INLINE float GetKeyframesError(const Quaternion& a, const Quaternion& b)
+{
+    return Quaternion::AngleBetween(a, b);
+}
+
+template<typename T>
+void ReduceCurve(LinearCurve<T>& curve, float maxError)
+{
+    auto& oldKeyframes = curve.GetKeyframes();
+    const int32 keyCount = oldKeyframes.Count();
+    if (keyCount < 3)
+        return;
+    typename LinearCurve<T>::KeyFrameCollection newKeyframes(keyCount);
+    newKeyframes.Add(oldKeyframes[0]);
+
+    // Skip keys that can be interpolated from the last kept key and the next key within the error threshold (checks all the skipped keys in between)
+    int32 lastKept = 0;
+    for (int32 i = 1; i < keyCount - 1; i++)
+    {
+        const auto& startKey = oldKeyframes[lastKept];
+        const auto& endKey = oldKeyframes[i + 1];
+        const float length = endKey.Time - startKey.Time;
+        bool canSkip = length > ZeroTolerance;
+        for (int32 j = lastKept + 1; j <= i && canSkip; j++)
+        {
+            const auto& key = oldKeyframes[j];
+            T value;
+            AnimationUtils::Interpolate(startKey.Value, endKey.Value, (key.Time - startKey.Time) / length, value);
+            canSkip = GetKeyframesError(value, key.Value) <= maxError;
+        }
+        if (!canSkip)
+        {
+            newKeyframes.Add(oldKeyframes[i]);
+            lastKept = i;
+        }
+    }
+    newKeyframes.Add(oldKeyframes.Last());
+
+    // Update keyframes if size changed
+    if (keyCount != newKeyframes.Count())
+    {
+        curve.SetKeyframes(newKeyframes);
+    }
+}
+
 void* MeshOptAllocate(size_t size)
 {
     return Allocator::Allocate(size);
@@ -734,6 +1059,134 @@ void MeshOptDeallocate(void* ptr)
     Allocator::Free(ptr);
 }
 
+void BuildMeshlets(MeshData& mesh)
+{
+    // Split mesh into clusters of triangles
+    const uint32* indices = mesh.Indices.Get();
+    const int32 indexCount = mesh.Indices.Count();
+    const int32 vertexCount = mesh.Positions.Count();
+    Array<meshopt_Meshlet> meshlets;
+    meshlets.Resize((int32)meshopt_buildMeshletsBound(indexCount, MODEL_MESHLET_MAX_VERTICES, MODEL_MESHLET_MAX_TRIANGLES));
+    meshlets.Resize((int32)meshopt_buildMeshlets(meshlets.Get(), indices, indexCount, vertexCount, MODEL_MESHLET_MAX_VERTICES, MODEL_MESHLET_MAX_TRIANGLES));
+
+    // Rewrite the index buffer to have each meshlet triangles in a contiguous range
+    Array<uint32> meshletIndices;
+    meshletIndices.Resize(indexCount);
+    mesh.Meshlets.Resize(meshlets.Count());
+    int32 index = 0;
+    for (int32 i = 0; i < meshlets.Count(); i++)
+    {
+        const meshopt_Meshlet& meshlet = meshlets.Get()[i];
+        const meshopt_Bounds bounds = meshopt_computeMeshletBounds(&meshlet, (const float*)mesh.Positions.Get(), vertexCount, sizeof(Float3));
+        MeshletData& data = mesh.Meshlets.Get()[i];
+        data.Center = Float3(bounds.center);
+        data.Radius = bounds.radius;
+        data.ConeAxis = Float3(bounds.cone_axis);
+        data.ConeCutoff = bounds.cone_cutoff;
+        data.FirstIndex = index;
+        data.TrianglesCount = meshlet.triangle_count;
+        for (int32 triangle = 0; triangle < meshlet.triangle_count; triangle++)
+        {
+            meshletIndices.Get()[index++] = meshlet.vertices[meshlet.indices[triangle][0]];
+            meshletIndices.Get()[index++] = meshlet.vertices[meshlet.indices[triangle][1]];
+            meshletIndices.Get()[index++] = meshlet.vertices[meshlet.indices[triangle][2]];
+        }
+    }
+    ASSERT(index == indexCount);
+    mesh.Indices.Swap(meshletIndices);
+}
+
+void OptimizeMesh(MeshData& mesh, const ModelTool::Options& options)
+{
+    uint32* indices = mesh.Indices.Get();
+    const int32 indexCount = mesh.Indices.Count();
+    const int32 vertexCount = mesh.Positions.Count();
+    if (indexCount == 0 || vertexCount == 0)
+        return;
+
+    // Reorder triangles for the post-transform vertex cache and then for the lower overdraw (overdraw optimization keeps the cache efficiency within the threshold)
+    meshopt_optimizeVertexCache(indices, indices, indexCount, vertexCount);
+    if (options.OptimizeOverdraw)
+        meshopt_optimizeOverdraw(indices, indices, indexCount, (const float*)mesh.Positions.Get(), vertexCount, sizeof(Float3), 1.05f);
+
+    // Reorder vertices in the order of the first use by the index buffer (also removes unused vertices)
+    if (options.OptimizeVertexFetch)
+    {
+        Array<unsigned int> remap;
+        remap.Resize(vertexCount);
+        const int32 dstVertexCount = (int32)meshopt_optimizeVertexFetchRemap(remap.Get(), indices, indexCount, vertexCount);
+        meshopt_remapIndexBuffer(indices, indices, indexCount, remap.Get());
+#define REMAP_VERTEX_BUFFER(name, type) \
+    if (mesh.name.HasItems()) \
+    { \
+        ASSERT(mesh.name.Count() == vertexCount); \
+        Array<type> dst; \
+        dst.Resize(dstVertexCount); \
+        meshopt_remapVertexBuffer(dst.Get(), mesh.name.Get(), vertexCount, sizeof(type), remap.Get()); \
+        mesh.name.Swap(dst); \
+    }
+        REMAP_VERTEX_BUFFER(Positions, Float3);
+        REMAP_VERTEX_BUFFER(UVs, Float2);
+        REMAP_VERTEX_BUFFER(Normals, Float3);
+        REMAP_VERTEX_BUFFER(Tangents, Float3);
+        REMAP_VERTEX_BUFFER(LightmapUVs, Float2);
+        REMAP_VERTEX_BUFFER(Colors, Color);
+        REMAP_VERTEX_BUFFER(BlendIndices, Int4);
+        REMAP_VERTEX_BUFFER(BlendWeights, Float4);
+#undef REMAP_VERTEX_BUFFER
+        for (auto& blendShape : mesh.BlendShapes)
+        {
+            for (int32 i = blendShape.Vertices.Count() - 1; i >= 0; i--)
+            {
+                auto& v = blendShape.Vertices[i];
+                v.VertexIndex = remap[v.VertexIndex];
+                if (v.VertexIndex == ~0u)
+                    blendShape.Vertices.RemoveAtKeepOrder(i);
+            }
+        }
+    }
+}
+
+void CheckMeshQuantization(const MeshData& mesh)
+{
+    // Texture coordinates are stored in the half-precision (see VB1ElementType) so validate the precision loss of the large or tiled UVs
+    const float maxError = 1.0f / 2048.0f; // Half texel of 1k texture
+    float uvsError = 0.0f, lightmapUVsError = 0.0f;
+    for (const Float2& uv : mesh.UVs)
+        uvsError = Math::Max(uvsError, Float2::Distance(uv, Half2(uv).ToFloat2()));
+    for (const Float2& uv : mesh.LightmapUVs)
+        lightmapUVsError = Math::Max(lightmapUVsError, Float2::Distance(uv, Half2(uv).ToFloat2()));
+    if (uvsError > maxError)
+        LOG(Warning, "Mesh '{0}' texture coordinates lose precision when stored in the half-precision format (error: {1}). Reduce the UVs range to improve the accuracy.", mesh.Name, uvsError);
+    if (lightmapUVsError > maxError)
+        LOG(Warning, "Mesh '{0}' lightmap coordinates lose precision when stored in the half-precision format (error: {1}).", mesh.Name, lightmapUVsError);
+}
+
+int32 SimplifyMesh(Array<unsigned int>& indices, const MeshData& mesh, int32 targetIndexCount, float maxError, float& error)
+{
+    // Simplifier doesn't report the error of the result so search for the lowest error limit that reaches the same triangles amount (in log space)
+    const int32 srcIndexCount = mesh.Indices.Count();
+    indices.Resize(srcIndexCount);
+    const auto simplify = [&](float targetError)
+    {
+        return (int32)meshopt_simplify(indices.Get(), mesh.Indices.Get(), srcIndexCount, (const float*)mesh.Positions.Get(), mesh.Positions.Count(), sizeof(Float3), targetIndexCount, targetError);
+    };
+    const int32 indexCount = simplify(maxError);
+    float minError = maxError * 0.0001f;
+    error = maxError;
+    bool isResultValid = true;
+    for (int32 i = 0; i < 6; i++)
+    {
+        const float midError = Math::Sqrt(minError * error);
+        isResultValid = simplify(midError) <= indexCount;
+        if (isResultValid)
+            error = midError;
+        else
+            minError = midError;
+    }
+    return isResultValid ? indexCount : simplify(error);
+}
+
 bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& options, String& errorMsg, const String& autoImportOutput)
 {
     LOG(Info, "Importing model from \'{0}\'", path);
@@ -1029,25 +1482,25 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
         hierarchyUpdater.UpdateMatrices();
 
         // Move meshes in the new nodes
-        for (int32 lodIndex = 0; lodIndex < data.LODs.Count(); lodIndex++)
+        Array<MeshData*> meshes;
+        GetMeshes(data, meshes);
+        Function<void(int32)> remapJob = [&meshes, &skeletonMapping, &hierarchyUpdater](int32 meshIndex)
         {
-            for (int32 meshIndex = 0; meshIndex < data.LODs[lodIndex].Meshes.Count(); meshIndex++)
-            {
-                auto& mesh = *data.LODs[lodIndex].Meshes[meshIndex];
+            auto& mesh = *meshes[meshIndex];
 
-                // Check if there was a remap using model skeleton
-                if (skeletonMapping.SourceToSource[mesh.NodeIndex] != mesh.NodeIndex)
-                {
-                    // Transform vertices
-                    const auto transformationMatrix = hierarchyUpdater.CombineMatricesFromNodeIndices(skeletonMapping.SourceToSource[mesh.NodeIndex], mesh.NodeIndex);
-                    if (!transformationMatrix.IsIdentity())
-                        mesh.TransformBuffer(transformationMatrix);
-                }
-
-                // Update new node index using real asset skeleton
-                mesh.NodeIndex = skeletonMapping.SourceToTarget[mesh.NodeIndex];
+            // Check if there was a remap using model skeleton
+            if (skeletonMapping.SourceToSource[mesh.NodeIndex] != mesh.NodeIndex)
+            {
+                // Transform vertices
+                const auto transformationMatrix = hierarchyUpdater.CombineMatricesFromNodeIndices(skeletonMapping.SourceToSource[mesh.NodeIndex], mesh.NodeIndex);
+                if (!transformationMatrix.IsIdentity())
+                    mesh.TransformBuffer(transformationMatrix);
             }
-        }
+
+            // Update new node index using real asset skeleton
+            mesh.NodeIndex = skeletonMapping.SourceToTarget[mesh.NodeIndex];
+        };
+        JobSystem::Execute(remapJob, meshes.Count());
 
         // Collision mesh output
         if (options.CollisionMeshesPrefix.HasChars())
@@ -1443,6 +1896,33 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
             LOG(Info, "Optimized {0} animation keyframe(s). Before: {1}, after: {2}, Ratio: {3}%", before - after, before, after, Utilities::RoundTo2DecimalPlaces((float)after / before));
         }
 
+        // Compress the animation
+        if (options.CompressAnimation)
+        {
+            const int32 before = data.Animation.GetKeyframesCount();
+            for (int32 i = 0; i < data.Animation.Channels.Count(); i++)
+            {
+                auto& anim = data.Animation.Channels[i];
+                ReduceCurve(anim.Position, options.CompressionPositionError);
+                ReduceCurve(anim.Rotation, options.CompressionRotationError);
+                ReduceCurve(anim.Scale, options.CompressionScaleError);
+            }
+            const int32 after = data.Animation.GetKeyframesCount();
+            const uint64 memoryBefore = data.Animation.GetMemoryUsage();
+            data.Animation.Compressed.Compress(data.Animation);
+            if (data.Animation.Compressed.IsValid())
+            {
+                // Curves are not used anymore (channels keep only the nodes names)
+                for (auto& anim : data.Animation.Channels)
+                {
+                    anim.Position.GetKeyframes().SetCapacity(0, false);
+                    anim.Rotation.GetKeyframes().SetCapacity(0, false);
+                    anim.Scale.GetKeyframes().SetCapacity(0, false);
+                }
+                LOG(Info, "Compressed animation. Reduced keyframes: {0} -> {1}, memory: {2} -> {3}", before, after, Utilities::BytesToText(memoryBefore), Utilities::BytesToText(data.Animation.GetMemoryUsage()));
+            }
+        }
+
         data.Animation.EnableRootMotion = options.EnableRootMotion;
         data.Animation.RootNodeName = options.RootNodeName;
     }
@@ -1496,21 +1976,31 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
         auto lodStartTime = DateTime::NowUTC();
         meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
         float triangleReduction = Math::Saturate(options.TriangleReduction);
-        int32 lodCount = Math::Max(options.LODCount, data.LODs.Count());
+        float maxError = Math::Clamp(options.MaxSimplificationError, 0.0001f, 1.0f);
+        int32 sourceLodCount = data.LODs.Count();
+        int32 lodCount = Math::Max(options.LODCount, sourceLodCount);
         int32 baseLOD = Math::Clamp(options.BaseLOD, 0, lodCount - 1);
         data.LODs.Resize(lodCount);
+        if (data.LODs[baseLOD].GeometricError < 0.0f)
+            data.LODs[baseLOD].GeometricError = 0.0f;
         int32 generatedLod = 0, baseLodTriangleCount = 0, baseLodVertexCount = 0;
         for (auto& mesh : data.LODs[baseLOD].Meshes)
         {
             baseLodTriangleCount += mesh->Indices.Count() / 3;
             baseLodVertexCount += mesh->Positions.Count();
         }
-        for (int32 lodIndex = Math::Clamp(baseLOD + 1, 1, lodCount - 1); lodIndex < lodCount; lodIndex++)
+        int32 firstGeneratedLod = Math::Clamp(baseLOD + 1, 1, lodCount - 1);
+        if (options.KeepSourceLODs)
+            firstGeneratedLod = Math::Max(firstGeneratedLod, sourceLodCount);
+        for (int32 lodIndex = firstGeneratedLod; lodIndex < lodCount; lodIndex++)
         {
             auto& dstLod = data.LODs[lodIndex];
             const auto& srcLod = data.LODs[lodIndex - 1];
 
             int32 lodTriangleCount = 0, lodVertexCount = 0;
+            float lodError = 0.0f;
+            bool isLodErrorValid = !options.SloppySimplification && srcLod.GeometricError >= 0.0f;
+            dstLod.Meshes.ClearDelete();
             dstLod.Meshes.Resize(srcLod.Meshes.Count());
             for (int32 meshIndex = 0; meshIndex < dstLod.Meshes.Count(); meshIndex++)
             {
@@ -1527,8 +2017,23 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
                 int32 srcMeshVertexCount = srcMesh->Positions.Count();
                 int32 dstMeshIndexCountTarget = int32(srcMeshIndexCount * triangleReduction) / 3 * 3;
                 Array<unsigned int> indices;
-                indices.Resize(dstMeshIndexCountTarget);
-                int32 dstMeshIndexCount = (int32)meshopt_simplifySloppy(indices.Get(), srcMesh->Indices.Get(), srcMeshIndexCount, (const float*)srcMesh->Positions.Get(), srcMeshVertexCount, sizeof(Float3), dstMeshIndexCountTarget);
+                int32 dstMeshIndexCount = 0;
+                if (!options.SloppySimplification)
+                {
+                    // Topology-preserving simplification (error is relative to the mesh extents)
+                    float meshError;
+                    dstMeshIndexCount = SimplifyMesh(indices, *srcMesh, dstMeshIndexCountTarget, maxError, meshError);
+                    BoundingBox meshBox;
+                    srcMesh->CalculateBox(meshBox);
+                    lodError = Math::Max(lodError, meshError * (float)meshBox.GetSize().MaxValue());
+                }
+                if (options.SloppySimplification || dstMeshIndexCount >= srcMeshIndexCount)
+                {
+                    // Fallback to the sloppy simplification if mesh topology doesn't allow to reduce it
+                    indices.Resize(dstMeshIndexCountTarget);
+                    dstMeshIndexCount = (int32)meshopt_simplifySloppy(indices.Get(), srcMesh->Indices.Get(), srcMeshIndexCount, (const float*)srcMesh->Positions.Get(), srcMeshVertexCount, sizeof(Float3), dstMeshIndexCountTarget);
+                    isLodErrorValid = false;
+                }
                 indices.Resize(dstMeshIndexCount);
                 if (dstMeshIndexCount == 0)
                     continue;
@@ -1605,6 +2110,9 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
                     dstLod.Meshes.RemoveAt(i--);
             }
 
+            // Errors of the chained simplifications accumulate
+            dstLod.GeometricError = isLodErrorValid ? srcLod.GeometricError + lodError : -1.0f;
+
             LOG(Info, "Generated LOD{0}: triangles: {1} ({2}% of base LOD), verticies: {3} ({4}% of base LOD)",
                 lodIndex,
                 lodTriangleCount, (int32)(lodTriangleCount * 100 / baseLodTriangleCount),
@@ -1617,6 +2125,48 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
         }
     }
 
+    // Meshes optimization
+    if (EnumHasAnyFlags(importDataTypes, ImportDataTypes::Geometry))
+    {
+        auto optimizeStartTime = DateTime::NowUTC();
+        meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+        Array<MeshData*> meshes;
+        GetMeshes(data, meshes);
+        const bool optimize = options.OptimizeMeshes && (options.OptimizeOverdraw || options.OptimizeVertexFetch);
+        Function<void(int32)> optimizeJob = [&meshes, &options, optimize](int32 meshIndex)
+        {
+            PROFILE_CPU_NAMED("Optimize Mesh Job");
+            auto& mesh = *meshes[meshIndex];
+            if (optimize)
+                OptimizeMesh(mesh, options);
+            CheckMeshQuantization(mesh);
+        };
+        JobSystem::Execute(optimizeJob, meshes.Count());
+        if (optimize)
+        {
+            auto optimizeEndTime = DateTime::NowUTC();
+            LOG(Info, "Optimized {1} meshes in {0} ms", static_cast<int32>((optimizeEndTime - optimizeStartTime).GetTotalMilliseconds()), meshes.Count());
+        }
+    }
+
+    // Meshlets generation
+    if (options.GenerateMeshlets && options.Type == ModelType::Model)
+    {
+        auto meshletsStartTime = DateTime::NowUTC();
+        meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+        int32 meshletsCount = 0;
+        for (auto& lod : data.LODs)
+        {
+            for (auto& mesh : lod.Meshes)
+            {
+                BuildMeshlets(*mesh);
+                meshletsCount += mesh->Meshlets.Count();
+            }
+        }
+        auto meshletsEndTime = DateTime::NowUTC();
+        LOG(Info, "Generated {1} meshlets in {0} ms", static_cast<int32>((meshletsEndTime - meshletsStartTime).GetTotalMilliseconds()), meshletsCount);
+    }
+
     // Export imported data to the output container (we reduce vertex data copy operations to minimum)
     {
         meshData.Textures.Swap(data.Textures);
@@ -1628,6 +2178,7 @@ bool ModelTool::ImportModel(const String& path, ModelData& meshData, Options& op
             auto& src = data.LODs[i];
 
             dst.Meshes = src.Meshes;
+            dst.GeometricError = src.GeometricError;
         }
         meshData.Skeleton.Swap(data.Skeleton);
         meshData.Animation.Swap(data.Animation);
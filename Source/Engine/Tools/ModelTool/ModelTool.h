@@ -64,6 +64,11 @@ class ImportedModelData
     {
         Array<MeshData*> Meshes;
 
+        /// <summary>
+        /// The geometric error of the LOD surface (in model units). Negative if unknown.
+        /// </summary>
+        float GeometricError = -1.0f;
+
         BoundingBox GetBox() const;
     };
 
@@ -244,6 +249,12 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // Enable/disable meshes geometry optimization.
         API_FIELD(Attributes="EditorOrder(50), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
         bool OptimizeMeshes = true;
+        // If checked, the triangles order of the optimized meshes will be adjusted to reduce the pixel overdraw (at the cost of a minor vertex cache efficiency loss).
+        API_FIELD(Attributes="EditorOrder(51), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
+        bool OptimizeOverdraw = false;
+        // If checked, the vertices of the optimized meshes will be reordered to match the index buffer access order (improves vertex fetch memory locality and removes the unused vertices).
+        API_FIELD(Attributes="EditorOrder(52), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
+        bool OptimizeVertexFetch = false;
         // Enable/disable geometry merge for meshes with the same materials.
         API_FIELD(Attributes="EditorOrder(60), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
         bool MergeMeshes = true;
@@ -259,9 +270,15 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // The lightmap UVs source.
         API_FIELD(Attributes="EditorOrder(90), EditorDisplay(\"Geometry\", \"Lightmap UVs Source\"), VisibleIf(nameof(ShowModel))")
         ModelLightmapUVsSource LightmapUVsSource = ModelLightmapUVsSource::Disable;
+        // The generated lightmap UVs quality. Lower quality generates faster but the UVs charts may have more stretching.
+        API_FIELD(Attributes="EditorOrder(91), EditorDisplay(\"Geometry\", \"Lightmap UVs Quality\"), VisibleIf(nameof(ShowModel))")
+        ModelLightmapUVsQuality LightmapUVsQuality = ModelLightmapUVsQuality::Normal;
         // If specified, all meshes which name starts with this prefix will be imported as a separate collision data (excluded used for rendering).
         API_FIELD(Attributes="EditorOrder(100), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
         String CollisionMeshesPrefix = TEXT("");
+        // If checked, the meshes are split into meshlets (small clusters of triangles) that are culled on a GPU (against view frustum, backfaces and occlusion) when drawing the model. Improves rendering of the high-poly models with many hidden triangles (eg. scanned or sculpted geometry) at the cost of the additional memory.
+        API_FIELD(Attributes="EditorOrder(110), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowModel))")
+        bool GenerateMeshlets = false;
 
     public: // Transform
 
@@ -307,12 +324,27 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // The custom node name to be used as a root motion source. If not specified the actual root node will be used.
         API_FIELD(Attributes="EditorOrder(1070), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowAnimation))")
         String RootNodeName = TEXT("");
+        // If checked, the imported animation will be compressed: keyframes are reduced using the error thresholds and the animated tracks are quantized and stored in per-frame blocks. Reduces memory usage and speeds up the animation sampling at the cost of the precision.
+        API_FIELD(Attributes="EditorOrder(1080), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowAnimation))")
+        bool CompressAnimation = false;
+        // The maximum position error allowed by the keyframes reduction of the compressed animation (in units).
+        API_FIELD(Attributes="EditorOrder(1081), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowCompression)), Limit(0, 100, 0.001f)")
+        float CompressionPositionError = 0.01f;
+        // The maximum rotation error allowed by the keyframes reduction of the compressed animation (in degrees).
+        API_FIELD(Attributes="EditorOrder(1082), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowCompression)), Limit(0, 10, 0.001f)")
+        float CompressionRotationError = 0.05f;
+        // The maximum scale error allowed by the keyframes reduction of the compressed animation.
+        API_FIELD(Attributes="EditorOrder(1083), EditorDisplay(\"Animation\"), VisibleIf(nameof(ShowCompression)), Limit(0, 1, 0.0001f)")
+        float CompressionScaleError = 0.001f;
 
     public: // Level Of Detail
 
         // If checked, the importer will generate a sequence of LODs based on the base LOD index.
         API_FIELD(Attributes="EditorOrder(1100), EditorDisplay(\"Level Of Detail\", \"Generate LODs\"), VisibleIf(nameof(ShowGeometry))")
-        bool GenerateLODs = false;
+        bool GenerateLODs = true;
+        // If checked, the LODs authored in the source file will be kept and only the missing ones will be generated. Otherwise, all LODs after the base LOD are generated.
+        API_FIELD(Attributes="EditorOrder(1105), EditorDisplay(\"Level Of Detail\", \"Keep Source LODs\"), VisibleIf(nameof(ShowGeometry))")
+        bool KeepSourceLODs = true;
         // The index of the LOD from the source model data to use as a reference for following LODs generation.
         API_FIELD(Attributes="EditorOrder(1110), EditorDisplay(\"Level Of Detail\", \"Base LOD\"), VisibleIf(nameof(ShowGeometry)), Limit(0, 5)")
         int32 BaseLOD = 0;
@@ -322,6 +354,12 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // The target amount of triangles for the generated LOD (based on the higher LOD). Normalized to range 0-1. For instance 0.4 cuts the triangle count to 40%.
         API_FIELD(Attributes="EditorOrder(1130), EditorDisplay(\"Level Of Detail\"), VisibleIf(nameof(ShowGeometry)), Limit(0, 1, 0.001f)")
         float TriangleReduction = 0.5f;
+        // The max geometric error of the generated LOD (based on the higher LOD) relative to the mesh size. The simplification stops before reaching the target triangles amount if the error gets too high.
+        API_FIELD(Attributes="EditorOrder(1140), EditorDisplay(\"Level Of Detail\"), VisibleIf(nameof(ShowGeometry)), Limit(0.0001f, 1, 0.001f)")
+        float MaxSimplificationError = 0.1f;
+        // If checked, the LODs will be generated with the fast simplification that doesn't preserve the mesh topology (always reaches the target triangles amount). LOD screen sizes are not based on the geometric error then.
+        API_FIELD(Attributes="EditorOrder(1150), EditorDisplay(\"Level Of Detail\"), VisibleIf(nameof(ShowGeometry))")
+        bool SloppySimplification = false;
 
     public: // Materials
 
@@ -13,6 +13,7 @@
 #include "Engine/Graphics/Textures/TextureUtils.h"
 #include "Engine/Graphics/Textures/TextureData.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Threading/JobSystem.h"
 #if USE_EDITOR
 #include "Engine/Graphics/GPUDevice.h"
 #endif
@@ -25,6 +26,9 @@ DECLARE_HANDLE(HMONITOR);
 #endif
 #include <ThirdParty/DirectXTex/DirectXTex.h>
 
+// The amount of 4x4 block rows compressed by a single job
+#define TEXTURE_TOOL_COMPRESS_TILE_ROWS 16
+
 namespace
 {
     FORCE_INLINE PixelFormat ToPixelFormat(const DXGI_FORMAT format)
@@ -37,6 +41,78 @@ namespace
         return static_cast<DXGI_FORMAT>(format);
     }
 
+    DWORD GetCompressFlags(TextureCompressionQuality quality)
+    {
+        switch (quality)
+        {
+        case TextureCompressionQuality::Fast:
+            return DirectX::TEX_COMPRESS_BC7_QUICK;
+        case TextureCompressionQuality::High:
+            return DirectX::TEX_COMPRESS_BC7_USE_3SUBSETS;
+        default:
+            return DirectX::TEX_COMPRESS_DEFAULT;
+        }
+    }
+
+    HRESULT CompressParallel(const DirectX::Image* srcImages, size_t nimages, const DirectX::TexMetadata& metadata, DXGI_FORMAT format, DWORD compress, float threshold, DirectX::ScratchImage& cImages)
+    {
+        DirectX::TexMetadata mdata = metadata;
+        mdata.format = format;
+        HRESULT result = cImages.Initialize(mdata);
+        if (FAILED(result))
+            return result;
+        if (cImages.GetImageCount() != nimages)
+        {
+            cImages.Release();
+            return E_FAIL;
+        }
+
+        // Split all images (array slices and mip levels) into tiles of block rows
+        struct Tile
+        {
+            int32 ImageIndex;
+            int32 Y;
+            int32 Height;
+        };
+        Array<Tile> tiles;
+        constexpr int32 tileHeight = TEXTURE_TOOL_COMPRESS_TILE_ROWS * 4;
+        for (size_t i = 0; i < nimages; i++)
+        {
+            const int32 height = (int32)srcImages[i].height;
+            for (int32 y = 0; y < height; y += tileHeight)
+                tiles.Add({ (int32)i, y, Math::Min(tileHeight, height - y) });
+        }
+
+        // Compress tiles in parallel (each tile writes to a separate range of block rows in the destination image)
+        int32 failed = S_OK;
+        Function<void(int32)> job = [&](int32 tileIndex)
+        {
+            const Tile& tile = tiles[tileIndex];
+            const DirectX::Image& src = srcImages[tile.ImageIndex];
+            const DirectX::Image& dst = cImages.GetImages()[tile.ImageIndex];
+            DirectX::Image srcTile = src;
+            srcTile.height = tile.Height;
+            srcTile.slicePitch = src.rowPitch * tile.Height;
+            srcTile.pixels = src.pixels + tile.Y * src.rowPitch;
+            DirectX::ScratchImage dstTile;
+            const HRESULT tileResult = DirectX::Compress(srcTile, format, compress & ~DirectX::TEX_COMPRESS_PARALLEL, threshold, dstTile);
+            if (FAILED(tileResult))
+            {
+                Platform::AtomicStore(&failed, (int32)tileResult);
+                return;
+            }
+            const DirectX::Image* dstTileImage = dstTile.GetImage(0, 0, 0);
+            Platform::MemoryCopy(dst.pixels + (tile.Y / 4) * dst.rowPitch, dstTileImage->pixels, dstTileImage->slicePitch);
+        };
+        JobSystem::Execute(job, tiles.Count());
+        if (failed != S_OK)
+        {
+            cImages.Release();
+            return (HRESULT)failed;
+        }
+        return S_OK;
+    }
+
     HRESULT Compress(const DirectX::Image* srcImages, size_t nimages, const DirectX::TexMetadata& metadata, DXGI_FORMAT format, DWORD compress, float threshold, DirectX::ScratchImage& cImages)
     {
 #if USE_EDITOR
@@ -112,7 +188,7 @@ namespace
             return task->CompressResult;
         }
 #endif
-        return DirectX::Compress(srcImages, nimages, metadata, format, compress, threshold, cImages);
+        return CompressParallel(srcImages, nimages, metadata, format, compress, threshold, cImages);
     }
 }
 
@@ -761,7 +837,7 @@ bool TextureTool::ImportTextureDirectXTex(ImageType type, const StringView& path
         auto& tmpImg = GET_TMP_IMG();
 
         if (DirectX::IsCompressed(targetDxgiFormat))
-            result = ::Compress(currentImage->GetImages(), currentImage->GetImageCount(), currentImage->GetMetadata(), targetDxgiFormat, DirectX::TEX_COMPRESS_DEFAULT | DirectX::TEX_COMPRESS_PARALLEL, alphaThreshold, tmpImg);
+            result = ::Compress(currentImage->GetImages(), currentImage->GetImageCount(), currentImage->GetMetadata(), targetDxgiFormat, GetCompressFlags(options.CompressionQuality), alphaThreshold, tmpImg);
         else
             result = DirectX::Convert(currentImage->GetImages(), currentImage->GetImageCount(), currentImage->GetMetadata(), targetDxgiFormat, DirectX::TEX_FILTER_DEFAULT, alphaThreshold, tmpImg);
         if (FAILED(result))
@@ -807,7 +883,7 @@ bool TextureTool::ImportTextureDirectXTex(ImageType type, const StringView& path
     return false;
 }
 
-bool TextureTool::ConvertDirectXTex(TextureData& dst, const TextureData& src, const PixelFormat dstFormat)
+bool TextureTool::ConvertDirectXTex(TextureData& dst, const TextureData& src, const PixelFormat dstFormat, TextureCompressionQuality quality)
 {
     HRESULT result;
     DirectX::ScratchImage dstImage;
@@ -887,7 +963,7 @@ bool TextureTool::ConvertDirectXTex(TextureData& dst, const TextureData& src, co
     DirectX::ScratchImage* outImage = &dstImage;
     if (DirectX::IsCompressed(dstFormatDxgi))
     {
-        result = ::Compress(inImage->GetImages(), inImage->GetImageCount(), inImage->GetMetadata(), dstFormatDxgi, DirectX::TEX_COMPRESS_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, dstImage);
+        result = ::Compress(inImage->GetImages(), inImage->GetImageCount(), inImage->GetMetadata(), dstFormatDxgi, GetCompressFlags(quality), DirectX::TEX_THRESHOLD_DEFAULT, dstImage);
         if (FAILED(result))
         {
             LOG(Warning, "Cannot compress image. Error: {0:x}", static_cast<uint32>(result));
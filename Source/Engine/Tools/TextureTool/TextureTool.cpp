@@ -26,10 +26,11 @@ namespace
 
 String TextureTool::Options::ToString() const
 {
-    return String::Format(TEXT("Type: {}, IsAtlas: {}, NeverStream: {}, IndependentChannels: {}, sRGB: {}, GenerateMipMaps: {}, FlipY: {}, Scale: {}, MaxSize: {}, Resize: {}, PreserveAlphaCoverage: {}, PreserveAlphaCoverageReference: {}, SizeX: {}, SizeY: {}"),
+    return String::Format(TEXT("Type: {}, IsAtlas: {}, NeverStream: {}, CompressionQuality: {}, IndependentChannels: {}, sRGB: {}, GenerateMipMaps: {}, FlipY: {}, Scale: {}, MaxSize: {}, Resize: {}, PreserveAlphaCoverage: {}, PreserveAlphaCoverageReference: {}, SizeX: {}, SizeY: {}"),
                           ScriptingEnum::ToString(Type),
                           IsAtlas,
                           NeverStream,
+                          ScriptingEnum::ToString(CompressionQuality),
                           IndependentChannels,
                           sRGB,
                           GenerateMipMaps,
@@ -59,6 +60,9 @@ void TextureTool::Options::Serialize(SerializeStream& stream, const void* otherO
     stream.JKEY("Compress");
     stream.Bool(Compress);
 
+    stream.JKEY("CompressionQuality");
+    stream.Enum(CompressionQuality);
+
     stream.JKEY("IndependentChannels");
     stream.Bool(IndependentChannels);
 
@@ -124,6 +128,7 @@ void TextureTool::Options::Deserialize(DeserializeStream& stream, ISerializeModi
     IsAtlas = JsonTools::GetBool(stream, "IsAtlas", IsAtlas);
     NeverStream = JsonTools::GetBool(stream, "NeverStream", NeverStream);
     Compress = JsonTools::GetBool(stream, "Compress", Compress);
+    CompressionQuality = JsonTools::GetEnum(stream, "CompressionQuality", CompressionQuality);
     IndependentChannels = JsonTools::GetBool(stream, "IndependentChannels", IndependentChannels);
     sRGB = JsonTools::GetBool(stream, "sRGB", sRGB);
     GenerateMipMaps = JsonTools::GetBool(stream, "GenerateMipMaps", GenerateMipMaps);
@@ -296,7 +301,7 @@ bool TextureTool::ExportTexture(const StringView& path, const TextureData& textu
     return failed;
 }
 
-bool TextureTool::Convert(TextureData& dst, const TextureData& src, const PixelFormat dstFormat)
+bool TextureTool::Convert(TextureData& dst, const TextureData& src, const PixelFormat dstFormat, TextureCompressionQuality quality)
 {
     // Validate input
     if (src.GetMipLevels() == 0)
@@ -316,9 +321,9 @@ bool TextureTool::Convert(TextureData& dst, const TextureData& src, const PixelF
     }
 
 #if COMPILE_WITH_DIRECTXTEX
-    return ConvertDirectXTex(dst, src, dstFormat);
+    return ConvertDirectXTex(dst, src, dstFormat, quality);
 #elif COMPILE_WITH_STB
-    return ConvertStb(dst, src, dstFormat);
+    return ConvertStb(dst, src, dstFormat, quality);
 #else
     LOG(Warning, "Converting textures is not supported on this platform.");
     return true;
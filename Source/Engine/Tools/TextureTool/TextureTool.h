@@ -41,6 +41,10 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API TextureTool
         API_FIELD(Attributes="EditorOrder(30)")
         bool Compress = true;
 
+        // The block compression quality. Lower quality is faster to encode.
+        API_FIELD(Attributes="EditorOrder(35), VisibleIf(\"Compress\")")
+        TextureCompressionQuality CompressionQuality = TextureCompressionQuality::Normal;
+
         // True if texture channels have independent data (for compression methods).
         API_FIELD(Attributes="EditorOrder(40)")
         bool IndependentChannels = false;
@@ -148,8 +152,9 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API TextureTool
     /// <param name="dst">The destination data.</param>
     /// <param name="src">The source data.</param>
     /// <param name="dstFormat">The destination data format. Must be other than source data type.</param>
+    /// <param name="quality">The block compression quality (used only when converting into the compressed format).</param>
     /// <returns>True if fails, otherwise false.</returns>
-    static bool Convert(TextureData& dst, const TextureData& src, const PixelFormat dstFormat);
+    static bool Convert(TextureData& dst, const TextureData& src, const PixelFormat dstFormat, TextureCompressionQuality quality = TextureCompressionQuality::Normal);
 
     /// <summary>
     /// Resizes the specified source texture data into an another dimensions.
@@ -257,14 +262,14 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API TextureTool
     static bool ExportTextureDirectXTex(ImageType type, const StringView& path, const TextureData& textureData);
     static bool ImportTextureDirectXTex(ImageType type, const StringView& path, TextureData& textureData, bool& hasAlpha);
     static bool ImportTextureDirectXTex(ImageType type, const StringView& path, TextureData& textureData, const Options& options, String& errorMsg, bool& hasAlpha);
-    static bool ConvertDirectXTex(TextureData& dst, const TextureData& src, const PixelFormat dstFormat);
+    static bool ConvertDirectXTex(TextureData& dst, const TextureData& src, const PixelFormat dstFormat, TextureCompressionQuality quality);
     static bool ResizeDirectXTex(TextureData& dst, const TextureData& src, int32 dstWidth, int32 dstHeight);
 #endif
 #if COMPILE_WITH_STB
     static bool ExportTextureStb(ImageType type, const StringView& path, const TextureData& textureData);
     static bool ImportTextureStb(ImageType type, const StringView& path, TextureData& textureData, bool& hasAlpha);
     static bool ImportTextureStb(ImageType type, const StringView& path, TextureData& textureData, const Options& options, String& errorMsg, bool& hasAlpha);
-    static bool ConvertStb(TextureData& dst, const TextureData& src, const PixelFormat dstFormat);
+    static bool ConvertStb(TextureData& dst, const TextureData& src, const PixelFormat dstFormat, TextureCompressionQuality quality);
     static bool ResizeStb(PixelFormat format, TextureMipData& dstMip, const TextureMipData& srcMip, int32 dstMipWidth, int32 dstMipHeight);
     static bool ResizeStb(TextureData& dst, const TextureData& src, int32 dstWidth, int32 dstHeight);
 #endif
@@ -12,6 +12,7 @@
 #include "Engine/Graphics/Textures/TextureUtils.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
 #include "Engine/Platform/File.h"
+#include "Engine/Threading/JobSystem.h"
 
 #define STBI_ASSERT(x) ASSERT(x)
 #define STBI_MALLOC(sz) Allocator::Allocate(sz)
@@ -49,6 +50,9 @@
 // Compression libs for Editor
 #include <ThirdParty/detex/detex.h>
 #include <ThirdParty/bc7enc16/bc7enc16.h>
+
+// The amount of 4x4 block rows compressed by a single job
+#define TEXTURE_TOOL_COMPRESS_TILE_ROWS 16
 #endif
 
 static void stbWrite(void* context, void* data, int size)
@@ -516,7 +520,7 @@ bool TextureTool::ImportTextureStb(ImageType type, const StringView& path, Textu
     // Compress mip maps or convert image
     if (targetFormat != textureDataSrc->Format)
     {
-        if (ConvertStb(*textureDataDst, *textureDataSrc, targetFormat))
+        if (ConvertStb(*textureDataDst, *textureDataSrc, targetFormat, options.CompressionQuality))
         {
             errorMsg = String::Format(TEXT("Cannot convert/compress texture."));
             return true;
@@ -533,7 +537,7 @@ bool TextureTool::ImportTextureStb(ImageType type, const StringView& path, Textu
     return false;
 }
 
-bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const PixelFormat dstFormat)
+bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const PixelFormat dstFormat, TextureCompressionQuality quality)
 {
     TextureData const* textureData = &src;
 
@@ -572,32 +576,58 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
         case PixelFormat::BC4_UNorm:
             bytesPerBlock = 8;
             break;
-        default:
+        case PixelFormat::BC3_UNorm:
+        case PixelFormat::BC3_UNorm_sRGB:
+        case PixelFormat::BC5_UNorm:
+        case PixelFormat::BC7_UNorm:
+        case PixelFormat::BC7_UNorm_sRGB:
             bytesPerBlock = 16;
             break;
+        default:
+            LOG(Warning, "Cannot compress image. Unsupported format {0}", static_cast<int32>(dstFormat));
+            return true;
         }
         bool isDstSRGB = PixelFormatExtensions::IsSRGB(dstFormat);
 
-        // bc7enc init
+        // Setup encoders for the quality preset
+        const int stbMode = quality == TextureCompressionQuality::Fast ? STB_DXT_NORMAL : STB_DXT_HIGHQUAL;
         bc7enc16_compress_block_params params;
         if (dstFormat == PixelFormat::BC7_UNorm || dstFormat == PixelFormat::BC7_UNorm_sRGB)
         {
             bc7enc16_compress_block_params_init(&params);
+            switch (quality)
+            {
+            case TextureCompressionQuality::Fast:
+                params.m_max_partitions_mode1 = 0;
+                params.m_try_least_squares = BC7ENC16_FALSE;
+                break;
+            case TextureCompressionQuality::High:
+                params.m_mode1_partition_estimation_filterbank = BC7ENC16_FALSE;
+                params.m_uber_level = BC7ENC16_MAX_UBER_LEVEL;
+                break;
+            default:
+                break;
+            }
             bc7enc16_compress_block_init();
         }
 
-        // Compress all array slices
+        // Allocate all array slices and mip levels and split them into tiles of block rows
+        struct Tile
+        {
+            int32 ArrayIndex;
+            int32 MipIndex;
+            int32 BlockRowStart;
+            int32 BlockRowEnd;
+        };
+        Array<Tile> tiles;
         for (int32 arrayIndex = 0; arrayIndex < arraySize; arrayIndex++)
         {
             const auto& srcSlice = textureData->Items[arrayIndex];
             auto& dstSlice = dst.Items[arrayIndex];
             auto mipLevels = srcSlice.Mips.Count();
             dstSlice.Mips.Resize(mipLevels, false);
-
-            // Compress all mip levels
             for (int32 mipIndex = 0; mipIndex < mipLevels; mipIndex++)
             {
-                const auto& srcMip = srcSlice.Mips[mipIndex];
                 auto& dstMip = dstSlice.Mips[mipIndex];
                 auto mipWidth = Math::Max(textureData->Width >> mipIndex, 1);
                 auto mipHeight = Math::Max(textureData->Height >> mipIndex, 1);
@@ -610,58 +640,70 @@ bool TextureTool::ConvertStb(TextureData& dst, const TextureData& src, const Pix
                 dstMip.Lines = blocksHeight;
                 dstMip.Data.Allocate(dstMip.DepthPitch);
 
-                // Compress texture
-                for (int32 yBlock = 0; yBlock < blocksHeight; yBlock++)
+                // Small mips go as a single tile, large ones get split to balance the work across threads
+                for (int32 blockRow = 0; blockRow < blocksHeight; blockRow += TEXTURE_TOOL_COMPRESS_TILE_ROWS)
+                    tiles.Add({ arrayIndex, mipIndex, blockRow, Math::Min(blockRow + TEXTURE_TOOL_COMPRESS_TILE_ROWS, blocksHeight) });
+            }
+        }
+
+        // Compress all tiles in parallel (each tile writes to a separate range of the destination mip)
+        Function<void(int32)> job = [&](int32 tileIndex)
+        {
+            const Tile& tile = tiles[tileIndex];
+            const auto& srcMip = textureData->Items[tile.ArrayIndex].Mips[tile.MipIndex];
+            auto& dstMip = dst.Items[tile.ArrayIndex].Mips[tile.MipIndex];
+            auto mipWidth = Math::Max(textureData->Width >> tile.MipIndex, 1);
+            auto blocksWidth = Math::Max(Math::DivideAndRoundUp(mipWidth, 4), 1);
+            for (int32 yBlock = tile.BlockRowStart; yBlock < tile.BlockRowEnd; yBlock++)
+            {
+                for (int32 xBlock = 0; xBlock < blocksWidth; xBlock++)
                 {
-                    for (int32 xBlock = 0; xBlock < blocksWidth; xBlock++)
+                    // Sample source texture 4x4 block
+                    Color32 srcBlock[16];
+                    for (int32 y = 0; y < 4; y++)
                     {
-                        // Sample source texture 4x4 block
-                        Color32 srcBlock[16];
-                        for (int32 y = 0; y < 4; y++)
+                        for (int32 x = 0; x < 4; x++)
                         {
-                            for (int32 x = 0; x < 4; x++)
-                            {
-                                Color color = TextureTool::SamplePoint(sampler, xBlock * 4 + x, yBlock * 4 + y, srcMip.Data.Get(), srcMip.RowPitch);
-                                if (isDstSRGB)
-                                    color = Color::LinearToSrgb(color);
-                                srcBlock[y * 4 + x] = Color32(color);
-                            }
+                            Color color = TextureTool::SamplePoint(sampler, xBlock * 4 + x, yBlock * 4 + y, srcMip.Data.Get(), srcMip.RowPitch);
+                            if (isDstSRGB)
+                                color = Color::LinearToSrgb(color);
+                            srcBlock[y * 4 + x] = Color32(color);
                         }
+                    }
 
-                        // Compress block
-                        byte* dstBlock = dstMip.Data.Get() + (yBlock * blocksWidth + xBlock) * bytesPerBlock;
-                        switch (dstFormat)
-                        {
-                        case PixelFormat::BC1_UNorm:
-                        case PixelFormat::BC1_UNorm_sRGB:
-                            stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 0, STB_DXT_HIGHQUAL);
-                            break;
-                        case PixelFormat::BC3_UNorm:
-                        case PixelFormat::BC3_UNorm_sRGB:
-                            stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 1, STB_DXT_HIGHQUAL);
-                            break;
-                        case PixelFormat::BC4_UNorm:
-                            for (int32 i = 1; i < 16; i++)
-                                ((byte*)&srcBlock)[i] = srcBlock[i].R;
-                            stb_compress_bc4_block(dstBlock, (byte*)&srcBlock);
-                            break;
-                        case PixelFormat::BC5_UNorm:
-                            for (int32 i = 0; i < 16; i++)
-                                ((uint16*)&srcBlock)[i] = srcBlock[i].R << 8 | srcBlock[i].G;
-                            stb_compress_bc5_block(dstBlock, (byte*)&srcBlock);
-                            break;
-                        case PixelFormat::BC7_UNorm:
-                        case PixelFormat::BC7_UNorm_sRGB:
-                            bc7enc16_compress_block(dstBlock, &srcBlock, &params);
-                            break;
-                        default:
-                            LOG(Warning, "Cannot compress image. Unsupported format {0}", static_cast<int32>(dstFormat));
-                            return true;
-                        }
+                    // Compress block
+                    byte* dstBlock = dstMip.Data.Get() + (yBlock * blocksWidth + xBlock) * bytesPerBlock;
+                    switch (dstFormat)
+                    {
+                    case PixelFormat::BC1_UNorm:
+                    case PixelFormat::BC1_UNorm_sRGB:
+                        stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 0, stbMode);
+                        break;
+                    case PixelFormat::BC3_UNorm:
+                    case PixelFormat::BC3_UNorm_sRGB:
+                        stb_compress_dxt_block(dstBlock, (byte*)&srcBlock, 1, stbMode);
+                        break;
+                    case PixelFormat::BC4_UNorm:
+                        for (int32 i = 1; i < 16; i++)
+                            ((byte*)&srcBlock)[i] = srcBlock[i].R;
+                        stb_compress_bc4_block(dstBlock, (byte*)&srcBlock);
+                        break;
+                    case PixelFormat::BC5_UNorm:
+                        for (int32 i = 0; i < 16; i++)
+                            ((uint16*)&srcBlock)[i] = srcBlock[i].R << 8 | srcBlock[i].G;
+                        stb_compress_bc5_block(dstBlock, (byte*)&srcBlock);
+                        break;
+                    case PixelFormat::BC7_UNorm:
+                    case PixelFormat::BC7_UNorm_sRGB:
+                        bc7enc16_compress_block(dstBlock, &srcBlock, &params);
+                        break;
+                    default:
+                        break;
                     }
                 }
             }
-        }
+        };
+        JobSystem::Execute(job, tiles.Count());
     }
     else
 #endif
@@ -0,0 +1,29 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+namespace FlaxEngine.GUI
+{
+    /// <summary>
+    /// UI container control that caches the tessellated geometry of the children controls and draws it instead of drawing children every frame. Used to reduce the cost of drawing the static parts of UI (geometry gets recorded again after invalidation).
+    /// </summary>
+    /// <remarks>The cached geometry is valid only for the same transformation, clipping and tint of the control (it gets recorded again if they change). Animated children need to call <see cref="Control.InvalidateCache"/> when they change.</remarks>
+    /// <seealso cref="ContainerControl.CacheDraw"/>
+    public class CachedGeometryControl : ContainerControl
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CachedGeometryControl"/> class.
+        /// </summary>
+        public CachedGeometryControl()
+        {
+            CacheDraw = true;
+        }
+
+        /// <summary>
+        /// Invalidates the cached geometry of children controls so it will be recorded again on the next draw.
+        /// </summary>
+        [Tooltip("Invalidates the cached geometry of children controls so it will be recorded again on the next draw.")]
+        public void Invalidate()
+        {
+            InvalidateCache();
+        }
+    }
+}
@@ -70,6 +70,7 @@ public CheckBoxState State
                     _state = value;
 
                     StateChanged?.Invoke(this);
+                    InvalidateCache();
                 }
             }
         }
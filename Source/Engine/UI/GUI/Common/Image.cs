@@ -10,11 +10,21 @@ namespace FlaxEngine.GUI
     /// <seealso cref="FlaxEngine.GUI.ContainerControl" />
     public class Image : ContainerControl
     {
+        private IBrush _brush;
+
         /// <summary>
         /// Gets or sets the image source.
         /// </summary>
         [EditorOrder(10), Tooltip("The image to draw.")]
-        public IBrush Brush { get; set; }
+        public IBrush Brush
+        {
+            get => _brush;
+            set
+            {
+                _brush = value;
+                InvalidateCache();
+            }
+        }
 
         /// <summary>
         /// Gets or sets the margin for the image.
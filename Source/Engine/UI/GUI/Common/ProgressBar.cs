@@ -92,6 +92,7 @@ public float Value
                     {
                         _current = _value;
                     }
+                    InvalidateCache();
                 }
             }
         }
@@ -150,10 +151,12 @@ public override void Update(float deltaTime)
                     if (!isDeltaSlow && UseSmoothing)
                         value = Mathf.Lerp(_current, _value, Mathf.Saturate(deltaTime * 5.0f * SmoothingScale));
                     _current = value;
+                    InvalidateCache();
                 }
-                else
+                else if (_current != _value)
                 {
                     _current = _value;
+                    InvalidateCache();
                 }
             }
 
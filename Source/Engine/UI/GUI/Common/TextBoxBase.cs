@@ -370,6 +370,7 @@ public void SetText(string value)
                 _text = value;
 
                 OnTextChanged();
+                InvalidateCache();
             }
         }
 
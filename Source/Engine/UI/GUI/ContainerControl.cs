@@ -31,6 +31,9 @@ public class ContainerControl : Control
 
         private bool _clipChildren = true;
         private bool _cullChildren = true;
+        private bool _cacheDraw;
+        private Render2DCache _drawCache;
+        internal bool _drawCacheInvalid = true;
 
         /// <summary>
         /// Initializes a new instance of the <see cref="ContainerControl"/> class.
@@ -115,6 +118,25 @@ public bool CullChildren
             set => _cullChildren = value;
         }
 
+        /// <summary>
+        /// Gets or sets a value indicating whether cache the drawn geometry of the control and its children and reuse it until any of them changes. Use it for the static parts of UI (eg. HUD panels or inventory screens) to reduce the drawing cost.
+        /// </summary>
+        /// <remarks>Controls invalidate the cache on layout, transform or state changes. The cache is not used while the mouse is over the control or it contains focus (interactive state is drawn directly). Controls with custom animations should call <see cref="Control.InvalidateCache"/>.</remarks>
+        [EditorOrder(545), Tooltip("If checked, control will cache the drawn geometry of the children and reuse it until any of them changes. Use it for the static parts of UI to reduce the drawing cost.")]
+        public bool CacheDraw
+        {
+            get => _cacheDraw;
+            set
+            {
+                if (_cacheDraw == value)
+                    return;
+                _cacheDraw = value;
+                _drawCacheInvalid = true;
+                if (!value)
+                    Object.Destroy(ref _drawCache);
+            }
+        }
+
         /// <summary>
         /// Locks all child controls layout and itself.
         /// </summary>
@@ -412,6 +434,7 @@ public void SortChildrenRecursive()
         /// <param name="control">The resized control.</param>
         public virtual void OnChildResized(Control control)
         {
+            _drawCacheInvalid = true;
         }
 
         /// <summary>
@@ -420,6 +443,8 @@ public virtual void OnChildResized(Control control)
         [NoAnimate]
         public virtual void OnChildrenChanged()
         {
+            _drawCacheInvalid = true;
+
             // Check if control isn't during disposing state
             if (!IsDisposing)
             {
@@ -659,6 +684,7 @@ protected void UpdateContainsFocus()
             if (result != _containsFocus)
             {
                 _containsFocus = result;
+                _drawCacheInvalid = true;
                 if (result)
                 {
                     OnStartContainsFocus();
@@ -715,6 +741,8 @@ public override void OnDestroy()
                 LockChildrenRecursive();
             }
 
+            Object.Destroy(ref _drawCache);
+
             base.OnDestroy();
 
             // Pass event further
@@ -774,6 +802,25 @@ public override void ClearState()
         /// Draw the control and the children.
         /// </summary>
         public override void Draw()
+        {
+            // Draw cached geometry (interactive state is drawn directly)
+            if (_cacheDraw && !IsMouseOver && !ContainsFocus && !IsTouchOver)
+            {
+                if (!_drawCacheInvalid && _drawCache && !Render2D.DrawCache(_drawCache))
+                    return;
+                if (!_drawCache)
+                    _drawCache = new Render2DCache();
+                Render2D.BeginCache(_drawCache);
+                DrawWithChildren();
+                Render2D.EndCache(_drawCache);
+                _drawCacheInvalid = false;
+                return;
+            }
+
+            DrawWithChildren();
+        }
+
+        private void DrawWithChildren()
         {
             DrawSelf();
 
@@ -849,6 +896,7 @@ public override void PerformLayout(bool force = false)
             if (!wasLocked)
                 LockChildrenRecursive();
 
+            _drawCacheInvalid = true;
             PerformLayoutBeforeChildren();
 
             for (int i = 0; i < _children.Count; i++)
@@ -926,6 +974,7 @@ public override void OnMouseLeave()
                     child.OnMouseLeave();
                 }
             }
+            _drawCacheInvalid = true;
 
             base.OnMouseLeave();
         }
@@ -1133,6 +1182,7 @@ public override void OnTouchLeave(int pointerId)
                     child.OnTouchLeave(pointerId);
                 }
             }
+            _drawCacheInvalid = true;
 
             base.OnTouchLeave(pointerId);
         }
@@ -171,7 +171,11 @@ public int IndexInParent
         public Color BackgroundColor
         {
             get => _backgroundColor;
-            set => _backgroundColor = value;
+            set
+            {
+                _backgroundColor = value;
+                InvalidateCache();
+            }
         }
 
         /// <summary>
@@ -218,6 +222,7 @@ public bool Enabled
                     _isEnabled = value;
                     if (!_isEnabled)
                         ClearState();
+                    InvalidateCache();
                 }
             }
         }
@@ -253,6 +258,7 @@ public bool Visible
                         ClearState();
 
                     OnVisibleChanged();
+                    InvalidateCache();
                     _parent?.PerformLayout();
                 }
             }
@@ -394,6 +400,18 @@ public void Dispose()
             Parent = null;
         }
 
+        /// <summary>
+        /// Invalidates the cached drawing of the control and its parent containers (see <see cref="ContainerControl.CacheDraw"/>). Call it when control appearance changes without modifying its properties (eg. custom animation).
+        /// </summary>
+        [NoAnimate]
+        public void InvalidateCache()
+        {
+            if (this is ContainerControl container)
+                container._drawCacheInvalid = true;
+            for (var parent = _parent; parent != null; parent = parent.Parent)
+                parent._drawCacheInvalid = true;
+        }
+
         /// <summary>
         /// Perform control update and all its children
         /// </summary>
@@ -3,6 +3,13 @@
 #include "Crc.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Platform/Platform.h"
+#if PLATFORM_SIMD_SSE4_2 && PLATFORM_64BITS
+#include <nmmintrin.h>
+#define CRC32C_HW_SSE 1
+#elif defined(__ARM_FEATURE_CRC32) && PLATFORM_64BITS
+#include <arm_acle.h>
+#define CRC32C_HW_ARM 1
+#endif
 
 // Based on the Slicing-by-8 implementation found here:
 // http://slicing-by-8.sourceforge.net/
@@ -2153,3 +2160,151 @@ uint32 Crc::MemCrc32(const void* data, int32 length, uint32 crc)
 
     return ~crc;
 }
+
+namespace
+{
+    enum { Crc32CPolyReversed = 0x82f63b78 };
+
+    FORCE_INLINE uint64 ReadUInt64(const uint8* ptr)
+    {
+        uint64 result;
+        Platform::MemoryCopy(&result, ptr, sizeof(result));
+        return result;
+    }
+
+    FORCE_INLINE uint32 ReadUInt32(const uint8* ptr)
+    {
+        uint32 result;
+        Platform::MemoryCopy(&result, ptr, sizeof(result));
+        return result;
+    }
+
+#if !CRC32C_HW_SSE && !CRC32C_HW_ARM
+    struct Crc32CTable
+    {
+        uint32 Values[256];
+
+        Crc32CTable()
+        {
+            for (uint32 i = 0; i < 256; i++)
+            {
+                uint32 crc = i;
+                for (uint32 j = 0; j < 8; j++)
+                    crc = (crc & 1) ? (crc >> 1) ^ Crc32CPolyReversed : (crc >> 1);
+                Values[i] = crc;
+            }
+        }
+    };
+#endif
+
+    constexpr uint64 Prime64_1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64 Prime64_2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr uint64 Prime64_3 = 0x165667B19E3779F9ull;
+    constexpr uint64 Prime64_4 = 0x85EBCA77C2B2AE63ull;
+    constexpr uint64 Prime64_5 = 0x27D4EB2F165667C5ull;
+
+    FORCE_INLINE uint64 RotateLeft(uint64 value, int32 bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    FORCE_INLINE uint64 HashRound(uint64 acc, uint64 input)
+    {
+        acc += input * Prime64_2;
+        acc = RotateLeft(acc, 31);
+        return acc * Prime64_1;
+    }
+
+    FORCE_INLINE uint64 HashMergeRound(uint64 acc, uint64 value)
+    {
+        acc ^= HashRound(0, value);
+        return acc * Prime64_1 + Prime64_4;
+    }
+}
+
+uint32 Crc::MemCrc32C(const void* data, int64 length, uint32 crc)
+{
+    const uint8* ptr = (const uint8*)data;
+    const uint8* end = ptr + length;
+#if CRC32C_HW_SSE
+    uint64 crc64 = ~crc;
+    for (; ptr + 8 <= end; ptr += 8)
+        crc64 = _mm_crc32_u64(crc64, ReadUInt64(ptr));
+    crc = (uint32)crc64;
+    for (; ptr < end; ptr++)
+        crc = _mm_crc32_u8(crc, *ptr);
+#elif CRC32C_HW_ARM
+    crc = ~crc;
+    for (; ptr + 8 <= end; ptr += 8)
+        crc = __crc32cd(crc, ReadUInt64(ptr));
+    for (; ptr < end; ptr++)
+        crc = __crc32cb(crc, *ptr);
+#else
+    static const Crc32CTable table;
+    crc = ~crc;
+    for (; ptr < end; ptr++)
+        crc = (crc >> 8) ^ table.Values[(crc ^ *ptr) & 0xFF];
+#endif
+    return ~crc;
+}
+
+uint64 Crc::MemHash64(const void* data, int64 length, uint64 seed)
+{
+    // Based on the xxHash64 algorithm (https://github.com/Cyan4973/xxHash)
+    const uint8* ptr = (const uint8*)data;
+    const uint8* end = ptr + length;
+    uint64 hash;
+    if (length >= 32)
+    {
+        // Process 32-byte stripes with 4 independent accumulators
+        const uint8* limit = end - 32;
+        uint64 v1 = seed + Prime64_1 + Prime64_2;
+        uint64 v2 = seed + Prime64_2;
+        uint64 v3 = seed;
+        uint64 v4 = seed - Prime64_1;
+        do
+        {
+            v1 = HashRound(v1, ReadUInt64(ptr));
+            v2 = HashRound(v2, ReadUInt64(ptr + 8));
+            v3 = HashRound(v3, ReadUInt64(ptr + 16));
+            v4 = HashRound(v4, ReadUInt64(ptr + 24));
+            ptr += 32;
+        } while (ptr <= limit);
+        hash = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+        hash = HashMergeRound(hash, v1);
+        hash = HashMergeRound(hash, v2);
+        hash = HashMergeRound(hash, v3);
+        hash = HashMergeRound(hash, v4);
+    }
+    else
+    {
+        hash = seed + Prime64_5;
+    }
+    hash += (uint64)length;
+
+    // Process the remaining bytes
+    for (; ptr + 8 <= end; ptr += 8)
+    {
+        hash ^= HashRound(0, ReadUInt64(ptr));
+        hash = RotateLeft(hash, 27) * Prime64_1 + Prime64_4;
+    }
+    if (ptr + 4 <= end)
+    {
+        hash ^= (uint64)ReadUInt32(ptr) * Prime64_1;
+        hash = RotateLeft(hash, 23) * Prime64_2 + Prime64_3;
+        ptr += 4;
+    }
+    for (; ptr < end; ptr++)
+    {
+        hash ^= (uint64)*ptr * Prime64_5;
+        hash = RotateLeft(hash, 11) * Prime64_1;
+    }
+
+    // Final avalanche
+    hash ^= hash >> 33;
+    hash *= Prime64_2;
+    hash ^= hash >> 29;
+    hash *= Prime64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
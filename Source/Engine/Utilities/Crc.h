@@ -5,7 +5,7 @@
 #include "Engine/Core/Types/BaseTypes.h"
 #include "Engine/Core/Templates.h"
 
-// The utilities for CRC hash generation.
+// The utilities for CRC and fast hash generation.
 class Crc
 {
 public:
@@ -17,4 +17,10 @@ class Crc
 
     // Generates CRC hash of the memory area
     static uint32 MemCrc32(const void* data, int32 length, uint32 crc = 0);
+
+    // Generates CRC-32C (Castagnoli) hash of the memory area. Uses the hardware CRC instructions if available (SSE4.2 or ARMv8 CRC). Produces different values than MemCrc32.
+    static uint32 MemCrc32C(const void* data, int64 length, uint32 crc = 0);
+
+    // Generates 64-bit non-cryptographic hash of the memory area (xxHash64). Much faster than the byte-wise hashes for large data (eg. shader sources).
+    static uint64 MemHash64(const void* data, int64 length, uint64 seed = 0);
 };
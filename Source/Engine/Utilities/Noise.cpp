@@ -6,6 +6,8 @@
 
 #include "Noise.h"
 #include "Engine/Core/Math/Vector4.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Threading/JobSystem.h"
 
 namespace
 {
@@ -73,6 +75,269 @@ namespace
     }
 }
 
+namespace
+{
+    // Minimal amount of grid points to generate the grid in parallel
+    constexpr int32 NoiseGridJobThreshold = 64 * 64;
+
+    // The grid rows generated by a single job
+    constexpr int32 NoiseGridJobRows = 16;
+
+    FORCE_INLINE SimdVector4 Mod289(SimdVector4 x)
+    {
+        return SIMD::Sub(x, SIMD::Mul(SIMD::Floor(SIMD::Mul(x, SIMD::Splat(1.0f / 289.0f))), SIMD::Splat(289.0f)));
+    }
+
+    FORCE_INLINE SimdVector4 Permute(SimdVector4 x)
+    {
+        return Mod289(SIMD::Mul(SIMD::MulAdd(x, SIMD::Splat(34.0f), SIMD::Splat(1.0f)), x));
+    }
+
+    FORCE_INLINE SimdVector4 Frac(SimdVector4 x)
+    {
+        return SIMD::Sub(x, SIMD::Floor(x));
+    }
+
+    FORCE_INLINE SimdVector4 Saturate(SimdVector4 x)
+    {
+        return SIMD::Min(SIMD::Max(x, SIMD::Splat(0.0f)), SIMD::Splat(1.0f));
+    }
+
+    FORCE_INLINE SimdVector4 Lerp(SimdVector4 a, SimdVector4 b, SimdVector4 t)
+    {
+        return SIMD::MulAdd(SIMD::Sub(b, a), t, a);
+    }
+
+    // Perlin noise gradient at the grid corner (normalized) dot with the offset to the corner
+    FORCE_INLINE SimdVector4 PerlinCorner(SimdVector4 ix, SimdVector4 iy, SimdVector4 fx, SimdVector4 fy)
+    {
+        const SimdVector4 i = Permute(SIMD::Add(Permute(ix), iy));
+        SimdVector4 gx = SIMD::Sub(SIMD::Mul(Frac(SIMD::Mul(i, SIMD::Splat(1.0f / 41.0f))), SIMD::Splat(2.0f)), SIMD::Splat(1.0f));
+        const SimdVector4 gy = SIMD::Sub(SIMD::Abs(gx), SIMD::Splat(0.5f));
+        gx = SIMD::Sub(gx, SIMD::Floor(SIMD::Add(gx, SIMD::Splat(0.5f))));
+        const SimdVector4 lengthSq = SIMD::MulAdd(gx, gx, SIMD::Mul(gy, gy));
+        const SimdVector4 norm = SIMD::Sub(SIMD::Splat(1.79284291400159f), SIMD::Mul(SIMD::Splat(0.85373472095314f), lengthSq));
+        return SIMD::Mul(SIMD::MulAdd(gx, fx, SIMD::Mul(gy, fy)), norm);
+    }
+
+    // SIMD version of the Noise::PerlinNoise (4 points at once)
+    SimdVector4 PerlinNoise4(SimdVector4 x, SimdVector4 y)
+    {
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 floorX = SIMD::Floor(x);
+        const SimdVector4 floorY = SIMD::Floor(y);
+        const SimdVector4 i0x = Mod289(floorX);
+        const SimdVector4 i0y = Mod289(floorY);
+        const SimdVector4 i1x = Mod289(SIMD::Add(floorX, one));
+        const SimdVector4 i1y = Mod289(SIMD::Add(floorY, one));
+        const SimdVector4 f0x = SIMD::Sub(x, floorX);
+        const SimdVector4 f0y = SIMD::Sub(y, floorY);
+        const SimdVector4 f1x = SIMD::Sub(f0x, one);
+        const SimdVector4 f1y = SIMD::Sub(f0y, one);
+
+        const SimdVector4 n00 = PerlinCorner(i0x, i0y, f0x, f0y);
+        const SimdVector4 n10 = PerlinCorner(i1x, i0y, f1x, f0y);
+        const SimdVector4 n01 = PerlinCorner(i0x, i1y, f0x, f1y);
+        const SimdVector4 n11 = PerlinCorner(i1x, i1y, f1x, f1y);
+
+        // Fade: t * t * t * (t * (t * 6 - 15) + 10)
+        const SimdVector4 fadeX = SIMD::Mul(SIMD::Mul(SIMD::Mul(f0x, f0x), f0x), SIMD::MulAdd(f0x, SIMD::MulAdd(f0x, SIMD::Splat(6.0f), SIMD::Splat(-15.0f)), SIMD::Splat(10.0f)));
+        const SimdVector4 fadeY = SIMD::Mul(SIMD::Mul(SIMD::Mul(f0y, f0y), f0y), SIMD::MulAdd(f0y, SIMD::MulAdd(f0y, SIMD::Splat(6.0f), SIMD::Splat(-15.0f)), SIMD::Splat(10.0f)));
+        const SimdVector4 n = Lerp(Lerp(n00, n10, fadeX), Lerp(n01, n11, fadeX), fadeY);
+        return Saturate(SIMD::Mul(n, SIMD::Splat(2.3f)));
+    }
+
+    // Simplex noise corner contribution
+    FORCE_INLINE SimdVector4 SimplexCorner(SimdVector4 perm, SimdVector4 x, SimdVector4 y)
+    {
+        SimdVector4 m = SIMD::Max(SIMD::Sub(SIMD::Splat(0.5f), SIMD::MulAdd(x, x, SIMD::Mul(y, y))), SIMD::Splat(0.0f));
+        m = SIMD::Mul(m, m);
+        m = SIMD::Mul(m, m);
+        const SimdVector4 gx = SIMD::Sub(SIMD::Mul(Frac(SIMD::Mul(perm, SIMD::Splat(0.024390243902439f))), SIMD::Splat(2.0f)), SIMD::Splat(1.0f));
+        const SimdVector4 h = SIMD::Sub(SIMD::Abs(gx), SIMD::Splat(0.5f));
+        const SimdVector4 a0 = SIMD::Sub(gx, SIMD::Floor(SIMD::Add(gx, SIMD::Splat(0.5f))));
+        m = SIMD::Mul(m, SIMD::Sub(SIMD::Splat(1.79284291400159f), SIMD::Mul(SIMD::Splat(0.85373472095314f), SIMD::MulAdd(a0, a0, SIMD::Mul(h, h)))));
+        return SIMD::Mul(m, SIMD::MulAdd(a0, x, SIMD::Mul(h, y)));
+    }
+
+    // SIMD version of the Noise::SimplexNoise (4 points at once)
+    SimdVector4 SimplexNoise4(SimdVector4 x, SimdVector4 y)
+    {
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 cx = SIMD::Splat(0.211324865405187f);
+        const SimdVector4 cz = SIMD::Splat(-0.577350269189626f);
+
+        // First corner
+        const SimdVector4 s = SIMD::Mul(SIMD::Add(x, y), SIMD::Splat(0.366025403784439f));
+        SimdVector4 ix = SIMD::Floor(SIMD::Add(x, s));
+        SimdVector4 iy = SIMD::Floor(SIMD::Add(y, s));
+        const SimdVector4 t = SIMD::Mul(SIMD::Add(ix, iy), cx);
+        const SimdVector4 x0 = SIMD::Add(SIMD::Sub(x, ix), t);
+        const SimdVector4 y0 = SIMD::Add(SIMD::Sub(y, iy), t);
+
+        // Other corners
+        const SimdVector4 mask = SIMD::Less(y0, x0);
+        const SimdVector4 i1x = SIMD::Select(mask, one, zero);
+        const SimdVector4 i1y = SIMD::Select(mask, zero, one);
+        const SimdVector4 x1 = SIMD::Sub(SIMD::Add(x0, cx), i1x);
+        const SimdVector4 y1 = SIMD::Sub(SIMD::Add(y0, cx), i1y);
+        const SimdVector4 x2 = SIMD::Add(x0, cz);
+        const SimdVector4 y2 = SIMD::Add(y0, cz);
+
+        // Permutations
+        ix = Mod289(ix);
+        iy = Mod289(iy);
+        const SimdVector4 perm0 = Permute(SIMD::Add(Permute(iy), ix));
+        const SimdVector4 perm1 = Permute(SIMD::Add(Permute(SIMD::Add(iy, i1y)), SIMD::Add(ix, i1x)));
+        const SimdVector4 perm2 = Permute(SIMD::Add(Permute(SIMD::Add(iy, one)), SIMD::Add(ix, one)));
+
+        const SimdVector4 n = SIMD::Add(SIMD::Add(SimplexCorner(perm0, x0, y0), SimplexCorner(perm1, x1, y1)), SimplexCorner(perm2, x2, y2));
+        return Saturate(SIMD::Mul(n, SIMD::Splat(130.0f)));
+    }
+
+    // SIMD version of the Noise::CustomNoise (4 points at once)
+    SimdVector4 CustomNoise4(SimdVector4 x, SimdVector4 y, SimdVector4 z)
+    {
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 ax = SIMD::Floor(x);
+        const SimdVector4 ay = SIMD::Floor(y);
+        const SimdVector4 az = SIMD::Floor(z);
+        SimdVector4 dx = SIMD::Sub(x, ax);
+        SimdVector4 dy = SIMD::Sub(y, ay);
+        SimdVector4 dz = SIMD::Sub(z, az);
+        dx = SIMD::Mul(SIMD::Mul(dx, dx), SIMD::Sub(SIMD::Splat(3.0f), SIMD::Add(dx, dx)));
+        dy = SIMD::Mul(SIMD::Mul(dy, dy), SIMD::Sub(SIMD::Splat(3.0f), SIMD::Add(dy, dy)));
+        dz = SIMD::Mul(SIMD::Mul(dz, dz), SIMD::Sub(SIMD::Splat(3.0f), SIMD::Add(dz, dz)));
+
+        const SimdVector4 k1x = Permute(ax);
+        const SimdVector4 k1y = Permute(SIMD::Add(ax, one));
+        const SimdVector4 ay1 = SIMD::Add(ay, one);
+        SimdVector4 o3[4];
+        const SimdVector4 k2[4] =
+        {
+            Permute(SIMD::Add(k1x, ay)),
+            Permute(SIMD::Add(k1y, ay)),
+            Permute(SIMD::Add(k1x, ay1)),
+            Permute(SIMD::Add(k1y, ay1)),
+        };
+        for (int32 i = 0; i < 4; i++)
+        {
+            const SimdVector4 c = SIMD::Add(k2[i], az);
+            const SimdVector4 o1 = Frac(SIMD::Mul(Permute(c), SIMD::Splat(1.0f / 41.0f)));
+            const SimdVector4 o2 = Frac(SIMD::Mul(Permute(SIMD::Add(c, one)), SIMD::Splat(1.0f / 41.0f)));
+            o3[i] = Lerp(o1, o2, dz);
+        }
+        const SimdVector4 o4x = Lerp(o3[0], o3[1], dx);
+        const SimdVector4 o4y = Lerp(o3[2], o3[3], dx);
+        return Lerp(o4x, o4y, dy);
+    }
+
+    SimdVector4 SampleNoise4(NoiseType type, SimdVector4 x, SimdVector4 y, SimdVector4 z)
+    {
+        switch (type)
+        {
+        case NoiseType::Perlin:
+            return PerlinNoise4(x, y);
+        case NoiseType::Simplex:
+            return SimplexNoise4(x, y);
+        case NoiseType::Worley:
+        {
+            float xs[4], ys[4];
+            SIMD::StoreUnaligned(xs, x);
+            SIMD::StoreUnaligned(ys, y);
+            return SIMD::Load(
+                Noise::WorleyNoise(Float2(xs[0], ys[0])).X,
+                Noise::WorleyNoise(Float2(xs[1], ys[1])).X,
+                Noise::WorleyNoise(Float2(xs[2], ys[2])).X,
+                Noise::WorleyNoise(Float2(xs[3], ys[3])).X);
+        }
+        case NoiseType::Custom:
+            return CustomNoise4(x, y, z);
+        default:
+            return SIMD::Splat(0.0f);
+        }
+    }
+
+    // Samples the noise with the fractal octaves at 4 points (already scaled by the frequency and offset)
+    SimdVector4 SampleFractal4(const NoiseSettings& settings, SimdVector4 x, SimdVector4 y, SimdVector4 z)
+    {
+        if (settings.Fractal == NoiseFractal::None || settings.Octaves <= 1)
+            return SampleNoise4(settings.Type, x, y, z);
+        SimdVector4 sum = SIMD::Splat(0.0f);
+        float amplitude = 1.0f, frequency = 1.0f, amplitudeSum = 0.0f;
+        for (int32 octave = 0; octave < settings.Octaves; octave++)
+        {
+            const SimdVector4 f = SIMD::Splat(frequency);
+            SimdVector4 n = SampleNoise4(settings.Type, SIMD::Mul(x, f), SIMD::Mul(y, f), SIMD::Mul(z, f));
+            if (settings.Fractal == NoiseFractal::Ridged)
+            {
+                n = SIMD::Sub(SIMD::Splat(1.0f), SIMD::Abs(SIMD::Sub(SIMD::Add(n, n), SIMD::Splat(1.0f))));
+                n = SIMD::Mul(n, n);
+            }
+            sum = SIMD::MulAdd(n, SIMD::Splat(amplitude), sum);
+            amplitudeSum += amplitude;
+            amplitude *= settings.Gain;
+            frequency *= settings.Lacunarity;
+        }
+        return SIMD::Mul(sum, SIMD::Splat(1.0f / Math::Max(amplitudeSum, ZeroTolerance)));
+    }
+
+    FORCE_INLINE void StorePartial(float* dst, SimdVector4 values, int32 count)
+    {
+        if (count == 4)
+        {
+            SIMD::StoreUnaligned(dst, values);
+        }
+        else
+        {
+            float tmp[4];
+            SIMD::StoreUnaligned(tmp, values);
+            for (int32 i = 0; i < count; i++)
+                dst[i] = tmp[i];
+        }
+    }
+
+    // Samples a single row of the grid (points along X axis)
+    void SampleRow(const NoiseSettings& settings, float x, float stepX, float y, float z, int32 count, float* results)
+    {
+        const SimdVector4 frequency = SIMD::Splat(settings.Frequency);
+        const SimdVector4 lanes = SIMD::Load(0.0f, 1.0f, 2.0f, 3.0f);
+        const SimdVector4 ys = SIMD::Splat(y * settings.Frequency + settings.Offset.Y);
+        const SimdVector4 zs = SIMD::Splat(z * settings.Frequency + settings.Offset.Z);
+        for (int32 i = 0; i < count; i += 4)
+        {
+            const SimdVector4 xs = SIMD::MulAdd(SIMD::MulAdd(SIMD::Add(SIMD::Splat((float)i), lanes), SIMD::Splat(stepX), SIMD::Splat(x)), frequency, SIMD::Splat(settings.Offset.X));
+            StorePartial(results + i, SampleFractal4(settings, xs, ys, zs), Math::Min(count - i, 4));
+        }
+    }
+
+    void SampleGridRows(const NoiseSettings& settings, const Float3& origin, const Float3& step, const Int3& size, float* results)
+    {
+        const int32 rowsCount = size.Y * size.Z;
+        const auto sampleRows = [&](int32 rowStart, int32 rowEnd)
+        {
+            for (int32 row = rowStart; row < rowEnd; row++)
+            {
+                const int32 y = row % size.Y;
+                const int32 z = row / size.Y;
+                SampleRow(settings, origin.X, step.X, origin.Y + (float)y * step.Y, origin.Z + (float)z * step.Z, size.X, results + row * size.X);
+            }
+        };
+        if (size.X * rowsCount < NoiseGridJobThreshold)
+        {
+            sampleRows(0, rowsCount);
+            return;
+        }
+        const Function<void(int32)> job = [&](int32 jobIndex)
+        {
+            const int32 rowStart = jobIndex * NoiseGridJobRows;
+            sampleRows(rowStart, Math::Min(rowStart + NoiseGridJobRows, rowsCount));
+        };
+        JobSystem::Execute(job, Math::DivideAndRoundUp(rowsCount, NoiseGridJobRows));
+    }
+}
+
 float Noise::PerlinNoise(const Float2& p)
 {
     Float4 Pxy(p.X, p.Y, p.X, p.Y);
@@ -341,3 +606,70 @@ Float3 Noise::CustomNoise3D(const Float3& p, int32 octaves, float roughness)
     }
     return noise / Math::Max(weight, ZeroTolerance);
 }
+
+void Noise::Sample(const NoiseSettings& settings, const Span<Float3>& points, Span<float> results)
+{
+    ASSERT(points.Length() == results.Length());
+    const SimdVector4 frequency = SIMD::Splat(settings.Frequency);
+    const SimdVector4 offsetX = SIMD::Splat(settings.Offset.X);
+    const SimdVector4 offsetY = SIMD::Splat(settings.Offset.Y);
+    const SimdVector4 offsetZ = SIMD::Splat(settings.Offset.Z);
+    const int32 count = points.Length();
+    const Float3* p = points.Get();
+    for (int32 i = 0; i < count; i += 4)
+    {
+        // Pad the last batch with the last point
+        const int32 i1 = Math::Min(i + 1, count - 1), i2 = Math::Min(i + 2, count - 1), i3 = Math::Min(i + 3, count - 1);
+        const SimdVector4 x = SIMD::MulAdd(SIMD::Load(p[i].X, p[i1].X, p[i2].X, p[i3].X), frequency, offsetX);
+        const SimdVector4 y = SIMD::MulAdd(SIMD::Load(p[i].Y, p[i1].Y, p[i2].Y, p[i3].Y), frequency, offsetY);
+        const SimdVector4 z = SIMD::MulAdd(SIMD::Load(p[i].Z, p[i1].Z, p[i2].Z, p[i3].Z), frequency, offsetZ);
+        StorePartial(results.Get() + i, SampleFractal4(settings, x, y, z), Math::Min(count - i, 4));
+    }
+}
+
+void Noise::Sample(const NoiseSettings& settings, const Span<Float2>& points, Span<float> results)
+{
+    ASSERT(points.Length() == results.Length());
+    const SimdVector4 frequency = SIMD::Splat(settings.Frequency);
+    const SimdVector4 offsetX = SIMD::Splat(settings.Offset.X);
+    const SimdVector4 offsetY = SIMD::Splat(settings.Offset.Y);
+    const SimdVector4 z = SIMD::Splat(settings.Offset.Z);
+    const int32 count = points.Length();
+    const Float2* p = points.Get();
+    for (int32 i = 0; i < count; i += 4)
+    {
+        // Pad the last batch with the last point
+        const int32 i1 = Math::Min(i + 1, count - 1), i2 = Math::Min(i + 2, count - 1), i3 = Math::Min(i + 3, count - 1);
+        const SimdVector4 x = SIMD::MulAdd(SIMD::Load(p[i].X, p[i1].X, p[i2].X, p[i3].X), frequency, offsetX);
+        const SimdVector4 y = SIMD::MulAdd(SIMD::Load(p[i].Y, p[i1].Y, p[i2].Y, p[i3].Y), frequency, offsetY);
+        StorePartial(results.Get() + i, SampleFractal4(settings, x, y, z), Math::Min(count - i, 4));
+    }
+}
+
+void Noise::Sample(const NoiseSettings& settings, const Span<Float3>& points, Array<float>& results)
+{
+    results.Resize(points.Length(), false);
+    Sample(settings, points, ToSpan(results.Get(), results.Count()));
+}
+
+void Noise::Sample(const NoiseSettings& settings, const Span<Float2>& points, Array<float>& results)
+{
+    results.Resize(points.Length(), false);
+    Sample(settings, points, ToSpan(results.Get(), results.Count()));
+}
+
+void Noise::SampleGrid(const NoiseSettings& settings, const Float2& origin, const Float2& step, const Int2& size, Array<float>& results)
+{
+    results.Resize(Math::Max(size.X, 0) * Math::Max(size.Y, 0), false);
+    if (results.IsEmpty())
+        return;
+    SampleGridRows(settings, Float3(origin, 0.0f), Float3(step, 0.0f), Int3(size.X, size.Y, 1), results.Get());
+}
+
+void Noise::SampleGrid(const NoiseSettings& settings, const Float3& origin, const Float3& step, const Int3& size, Array<float>& results)
+{
+    results.Resize(Math::Max(size.X, 0) * Math::Max(size.Y, 0) * Math::Max(size.Z, 0), false);
+    if (results.IsEmpty())
+        return;
+    SampleGridRows(settings, origin, step, size, results.Get());
+}
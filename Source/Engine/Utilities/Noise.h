@@ -4,6 +4,98 @@
 
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Collections/Array.h"
+
+/// <summary>
+/// The noise function type used by the batched noise sampling.
+/// </summary>
+API_ENUM(Namespace="FlaxEngine.Utilities") enum class NoiseType
+{
+    /// <summary>
+    /// Classic Perlin noise (2D).
+    /// </summary>
+    Perlin,
+
+    /// <summary>
+    /// Simplex noise (2D).
+    /// </summary>
+    Simplex,
+
+    /// <summary>
+    /// Worley noise F1 value (2D).
+    /// </summary>
+    Worley,
+
+    /// <summary>
+    /// Custom noise (3D).
+    /// </summary>
+    Custom,
+};
+
+/// <summary>
+/// The fractal mode used to combine the noise octaves by the batched noise sampling.
+/// </summary>
+API_ENUM(Namespace="FlaxEngine.Utilities") enum class NoiseFractal
+{
+    /// <summary>
+    /// Single octave of the noise.
+    /// </summary>
+    None,
+
+    /// <summary>
+    /// Fractional Brownian motion (sum of the octaves with increasing frequency and decreasing amplitude).
+    /// </summary>
+    FBm,
+
+    /// <summary>
+    /// Ridged multi-fractal (sum of the inverted and squared absolute octaves values), creates sharp ridges (eg. mountains).
+    /// </summary>
+    Ridged,
+};
+
+/// <summary>
+/// The batched noise sampling settings.
+/// </summary>
+API_STRUCT(Namespace="FlaxEngine.Utilities") struct FLAXENGINE_API NoiseSettings
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(NoiseSettings);
+
+    /// <summary>
+    /// The noise function type.
+    /// </summary>
+    API_FIELD() NoiseType Type = NoiseType::Perlin;
+
+    /// <summary>
+    /// The fractal mode used to combine the octaves.
+    /// </summary>
+    API_FIELD() NoiseFractal Fractal = NoiseFractal::None;
+
+    /// <summary>
+    /// The amount of the noise octaves (used by the fractal modes).
+    /// </summary>
+    API_FIELD() int32 Octaves = 4;
+
+    /// <summary>
+    /// The frequency of the first octave (the sampling points scale).
+    /// </summary>
+    API_FIELD() float Frequency = 1.0f;
+
+    /// <summary>
+    /// The frequency multiplier applied to each next octave.
+    /// </summary>
+    API_FIELD() float Lacunarity = 2.0f;
+
+    /// <summary>
+    /// The amplitude multiplier applied to each next octave.
+    /// </summary>
+    API_FIELD() float Gain = 0.5f;
+
+    /// <summary>
+    /// The offset added to the sampling points (after scaling by the frequency).
+    /// </summary>
+    API_FIELD() Float3 Offset = Float3::Zero;
+};
 
 /// <summary>
 /// Collection of various noise functions (eg. Perlin, Worley, Voronoi).
@@ -70,4 +162,57 @@ API_CLASS(Static, Namespace="FlaxEngine.Utilities") class FLAXENGINE_API Noise
     /// <param name="roughness">Noise roughness (in range 0-1).</param>
     /// <returns>Noise result.</returns>
     API_FUNCTION() static Float3 CustomNoise3D(const Float3& p, int32 octaves, float roughness);
+
+public:
+    /// <summary>
+    /// Samples the noise at the given points (batched, evaluates four points at once with SIMD). 2D noise types use the XY components of the points.
+    /// </summary>
+    /// <param name="settings">The noise settings.</param>
+    /// <param name="points">The points to sample noise at.</param>
+    /// <param name="results">The output noise values (range 0-1), the same size as the points.</param>
+    static void Sample(const NoiseSettings& settings, const Span<Float3>& points, Span<float> results);
+
+    /// <summary>
+    /// Samples the noise at the given points (batched, evaluates four points at once with SIMD).
+    /// </summary>
+    /// <param name="settings">The noise settings.</param>
+    /// <param name="points">The points to sample noise at.</param>
+    /// <param name="results">The output noise values (range 0-1), the same size as the points.</param>
+    static void Sample(const NoiseSettings& settings, const Span<Float2>& points, Span<float> results);
+
+    /// <summary>
+    /// Samples the noise at the given points (batched, evaluates four points at once with SIMD). 2D noise types use the XY components of the points.
+    /// </summary>
+    /// <param name="settings">The noise settings.</param>
+    /// <param name="points">The points to sample noise at.</param>
+    /// <param name="results">The output noise values (range 0-1), the same size as the points.</param>
+    API_FUNCTION() static void Sample(const NoiseSettings& settings, const Span<Float3>& points, API_PARAM(Out) Array<float>& results);
+
+    /// <summary>
+    /// Samples the noise at the given points (batched, evaluates four points at once with SIMD).
+    /// </summary>
+    /// <param name="settings">The noise settings.</param>
+    /// <param name="points">The points to sample noise at.</param>
+    /// <param name="results">The output noise values (range 0-1), the same size as the points.</param>
+    API_FUNCTION() static void Sample(const NoiseSettings& settings, const Span<Float2>& points, API_PARAM(Out) Array<float>& results);
+
+    /// <summary>
+    /// Samples the noise over the regular 2D grid of points (row-major). Large grids are generated in parallel with Job System.
+    /// </summary>
+    /// <param name="settings">The noise settings.</param>
+    /// <param name="origin">The position of the first grid point.</param>
+    /// <param name="step">The distance between the grid points.</param>
+    /// <param name="size">The amount of the grid points (columns and rows).</param>
+    /// <param name="results">The output noise values (range 0-1), size.X*size.Y elements.</param>
+    API_FUNCTION() static void SampleGrid(const NoiseSettings& settings, const Float2& origin, const Float2& step, const Int2& size, API_PARAM(Out) Array<float>& results);
+
+    /// <summary>
+    /// Samples the noise over the regular 3D grid of points (X is the fastest changing, then Y and Z). Large grids are generated in parallel with Job System.
+    /// </summary>
+    /// <param name="settings">The noise settings.</param>
+    /// <param name="origin">The position of the first grid point.</param>
+    /// <param name="step">The distance between the grid points.</param>
+    /// <param name="size">The amount of the grid points (along each axis).</param>
+    /// <param name="results">The output noise values (range 0-1), size.X*size.Y*size.Z elements.</param>
+    API_FUNCTION() static void SampleGrid(const NoiseSettings& settings, const Float3& origin, const Float3& step, const Int3& size, API_PARAM(Out) Array<float>& results);
 };
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Graph.h"
+#include "VisjectProgram.h"
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Vector4.h"
@@ -18,6 +19,12 @@ class VisjectGraphNode;
 
 class VisjectGraphBox : public GraphBox
 {
+public:
+    /// <summary>
+    /// The compiled program that evaluates this output box value (optional, owned by the graph). See VisjectProgram.
+    /// </summary>
+    VisjectProgram* Program = nullptr;
+
 public:
     VisjectGraphBox()
         : GraphBox()
@@ -151,8 +158,61 @@ class VisjectGraph : public Graph<NodeType, BoxType, ParameterType>
     /// </summary>
     Array<BezierCurve<Float4>> Float4Curves;
 
+    /// <summary>
+    /// The programs compiled from the pure expressions of the graph (owned by the graph, linked to the boxes via VisjectGraphBox::Program).
+    /// </summary>
+    Array<VisjectProgram*> Programs;
+
+public:
+    ~VisjectGraph()
+    {
+        Programs.ClearDelete();
+    }
+
+    /// <summary>
+    /// Compiles the pure expressions (constants, parameters, math, boolean and comparison nodes) connected to the other nodes into the programs with the types resolved once. Executors evaluate the compiled boxes without the nodes recursion and Variant conversions of the intermediate values. Constant expressions are evaluated once during the compilation.
+    /// </summary>
+    /// <param name="parametersGraph">The graph with the parameters used by the nodes (the same order as instance parameters used for the execution).</param>
+    /// <param name="parameterGetTypeId">The type identifier of the Get Parameter node in the graph (differs between the graph types).</param>
+    template<typename ParametersGraphType>
+    void CompilePrograms(const ParametersGraphType& parametersGraph, uint16 parameterGetTypeId = 1)
+    {
+        for (NodeType& node : Base::Nodes)
+        {
+            if (VisjectProgram::IsNodeSupported(node.GroupID, node.TypeID, parameterGetTypeId))
+                continue;
+
+            // Compile the output boxes of the supported nodes connected to the node inputs
+            for (BoxType& box : node.Boxes)
+            {
+                for (GraphBox* connection : box.Connections)
+                {
+                    auto target = (VisjectGraphBox*)connection;
+                    const auto targetNode = target->GetParent<NodeType>();
+                    if (target->Program || !VisjectProgram::IsNodeSupported(targetNode->GroupID, targetNode->TypeID, parameterGetTypeId))
+                        continue;
+                    auto program = New<VisjectProgram>();
+                    if (program->Compile(target, parametersGraph, parameterGetTypeId) || program->GetInstructionsCount() == 0)
+                    {
+                        // Use the nodes graph evaluation
+                        Delete(program);
+                        continue;
+                    }
+                    target->Program = program;
+                    Programs.Add(program);
+                }
+            }
+        }
+    }
+
 public:
     // [Graph]
+    void Clear() override
+    {
+        Programs.ClearDelete();
+        Base::Clear();
+    }
+
     bool onNodeLoaded(NodeType* n) override
     {
         switch (n->GroupID)
@@ -0,0 +1,671 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "VisjectProgram.h"
+#include "VisjectGraph.h"
+#include "Engine/Core/Collections/Dictionary.h"
+
+// The maximum depth of the nodes tree to compile (prevents stack overflow on looped graphs)
+#define VISJECT_PROGRAM_MAX_DEPTH 100
+
+struct VisjectProgram::CompileContext
+{
+    typedef VisjectGraphNode<> Node;
+    typedef VisjectGraphBox Box;
+
+    struct Value
+    {
+        byte Register;
+        Kind Type;
+    };
+
+    VisjectProgram* Program;
+    ParameterResolver Resolver;
+    const void* ResolverContext;
+    uint16 ParameterGetTypeId;
+    int32 Depth = 0;
+    Dictionary<Box*, Value> Cache;
+
+    bool AddRegister(float initialValue, byte& reg)
+    {
+        auto& registers = Program->_registers;
+        if (registers.Count() >= MaxRegisters)
+            return true;
+        reg = (byte)registers.Count();
+        registers.Add(initialValue);
+        return false;
+    }
+
+    bool AddInstruction(OpCode op, const Value& a, const Value& b, const Value& c, Kind type, Value& result)
+    {
+        Instruction instruction;
+        instruction.Op = op;
+        instruction.A = a.Register;
+        instruction.B = b.Register;
+        instruction.C = c.Register;
+        if (AddRegister(0.0f, instruction.Dst))
+            return true;
+        Program->_instructions.Add(instruction);
+        result.Register = instruction.Dst;
+        result.Type = type;
+        return false;
+    }
+
+    bool AddInstruction(OpCode op, const Value& a, const Value& b, Kind type, Value& result)
+    {
+        return AddInstruction(op, a, b, a, type, result);
+    }
+
+    bool AddInstruction(OpCode op, const Value& a, Kind type, Value& result)
+    {
+        return AddInstruction(op, a, a, a, type, result);
+    }
+
+    bool Constant(const Variant& value, Value& result)
+    {
+        float v;
+        switch (value.Type.Type)
+        {
+        case VariantType::Bool:
+            v = value.AsBool ? 1.0f : 0.0f;
+            result.Type = Kind::Bool;
+            break;
+        case VariantType::Int:
+            v = (float)value.AsInt;
+            result.Type = Kind::Int;
+            break;
+        case VariantType::Uint:
+            v = (float)value.AsUint;
+            result.Type = Kind::Int;
+            break;
+        case VariantType::Float:
+            v = value.AsFloat;
+            result.Type = Kind::Float;
+            break;
+        default:
+            // Other types (vectors, doubles, objects) use the Variant math that is not compiled
+            return true;
+        }
+        return AddRegister(v, result.Register);
+    }
+
+    bool Cast(Value& value, Kind to)
+    {
+        if (value.Type == to)
+            return false;
+        switch (to)
+        {
+        case Kind::Float:
+            // Bool and integer registers hold the numeric value already
+            value.Type = Kind::Float;
+            return false;
+        case Kind::Bool:
+            return AddInstruction(OpCode::ToBool, value, Kind::Bool, value);
+        default:
+            return true;
+        }
+    }
+
+    bool Input(Node* node, int32 boxId, int32 defaultValueIndex, const Variant& defaultValue, Value& result)
+    {
+        const auto box = node->TryGetBox(boxId);
+        if (box && box->HasConnection())
+            return Compile(box->FirstConnection(), result);
+        if (defaultValueIndex >= 0 && node->Values.Count() > defaultValueIndex)
+            return Constant(node->Values[defaultValueIndex], result);
+        return Constant(defaultValue, result);
+    }
+
+    bool Input(Node* node, int32 boxId, const Variant& defaultValue, Value& result)
+    {
+        return Input(node, boxId, -1, defaultValue, result);
+    }
+
+    bool Compile(Box* box, Value& result)
+    {
+        if (Cache.TryGet(box, result))
+            return false;
+        if (Depth >= VISJECT_PROGRAM_MAX_DEPTH)
+            return true;
+        Depth++;
+        const bool failed = CompileNode(box, result);
+        Depth--;
+        if (failed)
+            return true;
+        Cache.Add(box, result);
+        return false;
+    }
+
+    bool CompileNode(Box* box, Value& result)
+    {
+        const auto node = box->GetParent<Node>();
+        switch (node->GroupID)
+        {
+        // Constants
+        case 2:
+            switch (node->TypeID)
+            {
+            // Bool, Int, Float, Uint, Double
+            case 1:
+            case 2:
+            case 3:
+            case 12:
+            case 15:
+                return node->Values.IsEmpty() || Constant(node->Values[0], result);
+            // Float2/3/4, Color
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+                if (box->ID < 1 || box->ID > 4 || node->Values.IsEmpty())
+                    return true;
+                result.Type = Kind::Float;
+                return AddRegister(((Float4)node->Values[0]).Raw[box->ID - 1], result.Register);
+            // PI
+            case 10:
+                result.Type = Kind::Float;
+                return AddRegister(PI, result.Register);
+            }
+            break;
+        // Math
+        case 3:
+            switch (node->TypeID)
+            {
+            // Add, Subtract, Multiply, Divide, Modulo, Max, Min, Pow, Fmod, Atan2
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 21:
+            case 22:
+            case 23:
+            case 40:
+            case 41:
+            {
+                Value a, b;
+                if (box->ID != 2 || Input(node, 0, 0, Variant::Zero, a) || Input(node, 1, 1, Variant::Zero, b))
+                    return true;
+                const auto boxA = node->TryGetBox(0);
+                const Kind type = boxA && boxA->HasConnection() ? a.Type : b.Type;
+                if (type != Kind::Float || Cast(a, type) || Cast(b, type))
+                    return true; // Integer and boolean math is not compiled
+                OpCode op;
+                switch (node->TypeID)
+                {
+                case 1:
+                    op = OpCode::Add;
+                    break;
+                case 2:
+                    op = OpCode::Subtract;
+                    break;
+                case 3:
+                    op = OpCode::Multiply;
+                    break;
+                case 4:
+                    op = OpCode::Modulo;
+                    break;
+                case 5:
+                    op = OpCode::Divide;
+                    break;
+                case 21:
+                    op = OpCode::Max;
+                    break;
+                case 22:
+                    op = OpCode::Min;
+                    break;
+                case 23:
+                    op = OpCode::Pow;
+                    break;
+                case 40:
+                    op = OpCode::Fmod;
+                    break;
+                default:
+                    op = OpCode::Atan2;
+                    break;
+                }
+                return AddInstruction(op, a, b, Kind::Float, result);
+            }
+            // Absolute Value, Ceil, Cosine, Floor, Round, Saturate, Sine, Sqrt, Tangent, Negate, 1 - Value, Asine, Acosine, Atan, Trunc, Frac, Degrees, Radians
+            case 7:
+            case 8:
+            case 9:
+            case 10:
+            case 13:
+            case 14:
+            case 15:
+            case 16:
+            case 17:
+            case 27:
+            case 28:
+            case 33:
+            case 34:
+            case 35:
+            case 38:
+            case 39:
+            case 43:
+            case 44:
+            {
+                Value a;
+                if (box->ID != 1 || Input(node, 0, Variant::Zero, a) || a.Type != Kind::Float)
+                    return true;
+                OpCode op;
+                switch (node->TypeID)
+                {
+                case 7:
+                    op = OpCode::Abs;
+                    break;
+                case 8:
+                    op = OpCode::Ceil;
+                    break;
+                case 9:
+                    op = OpCode::Cos;
+                    break;
+                case 10:
+                    op = OpCode::Floor;
+                    break;
+                case 13:
+                    op = OpCode::Round;
+                    break;
+                case 14:
+                    op = OpCode::Saturate;
+                    break;
+                case 15:
+                    op = OpCode::Sin;
+                    break;
+                case 16:
+                    op = OpCode::Sqrt;
+                    break;
+                case 17:
+                    op = OpCode::Tan;
+                    break;
+                case 27:
+                    op = OpCode::Negate;
+                    break;
+                case 28:
+                    op = OpCode::OneMinus;
+                    break;
+                case 33:
+                    op = OpCode::Asin;
+                    break;
+                case 34:
+                    op = OpCode::Acos;
+                    break;
+                case 35:
+                    op = OpCode::Atan;
+                    break;
+                case 38:
+                    op = OpCode::Trunc;
+                    break;
+                case 39:
+                    op = OpCode::Frac;
+                    break;
+                case 43:
+                    op = OpCode::Degrees;
+                    break;
+                default:
+                    op = OpCode::Radians;
+                    break;
+                }
+                return AddInstruction(op, a, Kind::Float, result);
+            }
+            // Clamp
+            case 24:
+            {
+                Value v, min, max;
+                if (box->ID != 3 || Input(node, 0, Variant::Zero, v) || v.Type != Kind::Float)
+                    return true;
+                if (Input(node, 1, 0, Variant::Zero, min) || Cast(min, Kind::Float) || Input(node, 2, 1, Variant::One, max) || Cast(max, Kind::Float))
+                    return true;
+                return AddInstruction(OpCode::Clamp, v, min, max, Kind::Float, result);
+            }
+            // Lerp
+            case 25:
+            {
+                Value a, b, alpha;
+                if (box->ID != 3 || Input(node, 0, 0, Variant::Zero, a) || a.Type != Kind::Float)
+                    return true;
+                if (Input(node, 1, 1, Variant::One, b) || Cast(b, Kind::Float) || Input(node, 2, 2, Variant::Zero, alpha) || Cast(alpha, Kind::Float))
+                    return true;
+                return AddInstruction(OpCode::Lerp, a, b, alpha, Kind::Float, result);
+            }
+            }
+            break;
+        // Parameters
+        case 6:
+            if (node->TypeID == ParameterGetTypeId && node->Values.HasItems())
+            {
+                int32 index;
+                const GraphParameter* param = Resolver(ResolverContext, (Guid)node->Values[0], index);
+                if (!param)
+                    return true;
+                ParameterLoad load;
+                load.Index = index;
+                load.Component = -1;
+                switch (param->Type.Type)
+                {
+                case VariantType::Bool:
+                    result.Type = Kind::Bool;
+                    break;
+                case VariantType::Int:
+                case VariantType::Uint:
+                    result.Type = Kind::Int;
+                    break;
+                case VariantType::Float:
+                    result.Type = Kind::Float;
+                    break;
+                case VariantType::Float2:
+                case VariantType::Float3:
+                case VariantType::Float4:
+                case VariantType::Color:
+                    if (box->ID < 1 || box->ID > 4)
+                        return true;
+                    load.Component = box->ID - 1;
+                    result.Type = Kind::Float;
+                    break;
+                default:
+                    return true;
+                }
+                if (load.Component == -1 && box->ID != 0)
+                    return true;
+                if (AddRegister(0.0f, load.Register))
+                    return true;
+                Program->_parameters.Add(load);
+                result.Register = load.Register;
+                return false;
+            }
+            break;
+        // Tools
+        case 7:
+            // Reroute
+            if (node->TypeID == 29)
+                return box->ID != 1 || Input(node, 0, Variant::Zero, result);
+            break;
+        // Boolean
+        case 10:
+            switch (node->TypeID)
+            {
+            // NOT
+            case 1:
+            {
+                Value a;
+                if (box->ID != 1 || Input(node, 0, Variant::False, a) || Cast(a, Kind::Bool))
+                    return true;
+                return AddInstruction(OpCode::Not, a, Kind::Bool, result);
+            }
+            // AND, OR, XOR, NOR, NAND
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            {
+                Value a, b;
+                if (box->ID != 2 || node->Values.Count() < 2)
+                    return true;
+                if (Input(node, 0, 0, node->Values[0], a) || Cast(a, Kind::Bool) || Input(node, 1, 1, node->Values[1], b) || Cast(b, Kind::Bool))
+                    return true;
+                const OpCode op = (OpCode)((int32)OpCode::And + node->TypeID - 2);
+                return AddInstruction(op, a, b, Kind::Bool, result);
+            }
+            }
+            break;
+        // Comparisons
+        case 12:
+            switch (node->TypeID)
+            {
+            // ==, !=, >, <, <=, >=
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            {
+                Value a, b;
+                if (box->ID != 2 || node->Values.Count() < 2)
+                    return true;
+                if (Input(node, 0, 0, node->Values[0], a) || a.Type == Kind::Int || Input(node, 1, 1, node->Values[1], b) || Cast(b, a.Type))
+                    return true;
+                const OpCode op = (OpCode)((int32)OpCode::Equal + node->TypeID - 1);
+                return AddInstruction(op, a, b, Kind::Bool, result);
+            }
+            // Switch On Bool
+            case 7:
+            {
+                Value condition, onFalse, onTrue;
+                if (box->ID != 3 || Input(node, 0, Variant::False, condition) || Cast(condition, Kind::Bool))
+                    return true;
+                if (Input(node, 1, 0, Variant::Zero, onFalse) || Input(node, 2, 1, Variant::Zero, onTrue) || onFalse.Type != onTrue.Type || onTrue.Type == Kind::Int)
+                    return true;
+                return AddInstruction(OpCode::Select, condition, onFalse, onTrue, onTrue.Type, result);
+            }
+            }
+            break;
+        }
+        return true;
+    }
+};
+
+bool VisjectProgram::IsNodeSupported(uint16 groupId, uint16 typeId, uint16 parameterGetTypeId)
+{
+    switch (groupId)
+    {
+    case 2:
+        return (typeId >= 1 && typeId <= 7) || typeId == 10 || typeId == 12 || typeId == 15;
+    case 3:
+        return (typeId >= 1 && typeId <= 5) || (typeId >= 7 && typeId <= 10) || (typeId >= 13 && typeId <= 17) || (typeId >= 21 && typeId <= 25) || typeId == 27 || typeId == 28 || (typeId >= 33 && typeId <= 35) || typeId == 38 || typeId == 39 || (typeId >= 40 && typeId <= 41) || typeId == 43 || typeId == 44;
+    case 6:
+        return typeId == parameterGetTypeId;
+    case 7:
+        return typeId == 29;
+    case 10:
+        return typeId >= 1 && typeId <= 6;
+    case 12:
+        return typeId >= 1 && typeId <= 7;
+    default:
+        return false;
+    }
+}
+
+bool VisjectProgram::Compile(VisjectGraphBox* box, ParameterResolver resolver, const void* context, uint16 parameterGetTypeId)
+{
+    _registers.Clear();
+    _parameters.Clear();
+    _instructions.Clear();
+    _isConstant = false;
+    _constant = Variant::Null;
+    CompileContext compileContext;
+    compileContext.Program = this;
+    compileContext.Resolver = resolver;
+    compileContext.ResolverContext = context;
+    compileContext.ParameterGetTypeId = parameterGetTypeId;
+    CompileContext::Value result;
+    if (compileContext.Compile(box, result) || result.Type == Kind::Int)
+    {
+        _registers.Clear();
+        _parameters.Clear();
+        _instructions.Clear();
+        return true;
+    }
+    _result = result.Register;
+    _resultIsBool = result.Type == Kind::Bool;
+
+    // Evaluate the constant expressions once (result doesn't depend on parameters)
+    if (_parameters.IsEmpty())
+    {
+        _constant = Execute(Array<Variant>());
+        _isConstant = true;
+    }
+    return false;
+}
+
+float VisjectProgram::ReadParameter(const Variant& value, int32 component)
+{
+    switch (value.Type.Type)
+    {
+    case VariantType::Bool:
+        return value.AsBool ? 1.0f : 0.0f;
+    case VariantType::Int:
+        return (float)value.AsInt;
+    case VariantType::Uint:
+        return (float)value.AsUint;
+    case VariantType::Float:
+        return value.AsFloat;
+    case VariantType::Float2:
+    case VariantType::Float3:
+    case VariantType::Float4:
+    case VariantType::Color:
+        return ((const float*)value.AsData)[Math::Max(component, 0)];
+    default:
+        return (float)value;
+    }
+}
+
+void VisjectProgram::Run(float* registers) const
+{
+    for (const Instruction& i : _instructions)
+    {
+        const float a = registers[i.A];
+        const float b = registers[i.B];
+        const float c = registers[i.C];
+        float& dst = registers[i.Dst];
+        switch (i.Op)
+        {
+        case OpCode::Add:
+            dst = a + b;
+            break;
+        case OpCode::Subtract:
+            dst = a - b;
+            break;
+        case OpCode::Multiply:
+            dst = a * b;
+            break;
+        case OpCode::Divide:
+            dst = a / b;
+            break;
+        case OpCode::Modulo:
+            dst = (int32)b != 0 ? (float)((int32)a % (int32)b) : 0.0f;
+            break;
+        case OpCode::Max:
+            dst = Math::Max(a, b);
+            break;
+        case OpCode::Min:
+            dst = Math::Min(a, b);
+            break;
+        case OpCode::Pow:
+            dst = Math::Pow(a, b);
+            break;
+        case OpCode::Fmod:
+            dst = Math::Mod(a, b);
+            break;
+        case OpCode::Atan2:
+            dst = Math::Atan2(a, b);
+            break;
+        case OpCode::Abs:
+            dst = Math::Abs(a);
+            break;
+        case OpCode::Ceil:
+            dst = Math::Ceil(a);
+            break;
+        case OpCode::Cos:
+            dst = Math::Cos(a);
+            break;
+        case OpCode::Floor:
+            dst = Math::Floor(a);
+            break;
+        case OpCode::Round:
+            dst = Math::Round(a);
+            break;
+        case OpCode::Saturate:
+            dst = Math::Saturate(a);
+            break;
+        case OpCode::Sin:
+            dst = Math::Sin(a);
+            break;
+        case OpCode::Sqrt:
+            dst = Math::Sqrt(a);
+            break;
+        case OpCode::Tan:
+            dst = Math::Tan(a);
+            break;
+        case OpCode::Negate:
+            dst = -a;
+            break;
+        case OpCode::OneMinus:
+            dst = 1.0f - a;
+            break;
+        case OpCode::Asin:
+            dst = Math::Asin(a);
+            break;
+        case OpCode::Acos:
+            dst = Math::Acos(a);
+            break;
+        case OpCode::Atan:
+            dst = Math::Atan(a);
+            break;
+        case OpCode::Trunc:
+            dst = Math::Trunc(a);
+            break;
+        case OpCode::Frac:
+        {
+            float tmp;
+            dst = Math::ModF(a, &tmp);
+            break;
+        }
+        case OpCode::Degrees:
+            dst = a * RadiansToDegrees;
+            break;
+        case OpCode::Radians:
+            dst = a * DegreesToRadians;
+            break;
+        case OpCode::Clamp:
+            dst = Math::Clamp(a, b, c);
+            break;
+        case OpCode::Lerp:
+            dst = Math::Lerp(a, b, c);
+            break;
+        case OpCode::ToBool:
+            dst = Math::Abs(a) > ZeroTolerance ? 1.0f : 0.0f;
+            break;
+        case OpCode::Not:
+            dst = a != 0.0f ? 0.0f : 1.0f;
+            break;
+        case OpCode::And:
+            dst = a != 0.0f && b != 0.0f ? 1.0f : 0.0f;
+            break;
+        case OpCode::Or:
+            dst = a != 0.0f || b != 0.0f ? 1.0f : 0.0f;
+            break;
+        case OpCode::Xor:
+            dst = (a != 0.0f) != (b != 0.0f) ? 1.0f : 0.0f;
+            break;
+        case OpCode::Nor:
+            dst = a != 0.0f || b != 0.0f ? 0.0f : 1.0f;
+            break;
+        case OpCode::Nand:
+            dst = a != 0.0f && b != 0.0f ? 0.0f : 1.0f;
+            break;
+        case OpCode::Equal:
+            dst = Math::NearEqual(a, b) ? 1.0f : 0.0f;
+            break;
+        case OpCode::NotEqual:
+            dst = Math::NearEqual(a, b) ? 0.0f : 1.0f;
+            break;
+        case OpCode::Greater:
+            dst = !Math::NearEqual(a, b) && !(a < b) ? 1.0f : 0.0f;
+            break;
+        case OpCode::Less:
+            dst = a < b ? 1.0f : 0.0f;
+            break;
+        case OpCode::LessEqual:
+            dst = Math::NearEqual(a, b) || a < b ? 1.0f : 0.0f;
+            break;
+        case OpCode::GreaterEqual:
+            dst = a < b ? 0.0f : 1.0f;
+            break;
+        case OpCode::Select:
+            dst = a != 0.0f ? c : b;
+            break;
+        }
+    }
+}
@@ -0,0 +1,220 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/Variant.h"
+#include "Engine/Core/Collections/Array.h"
+
+class GraphParameter;
+class VisjectGraphBox;
+struct Guid;
+
+/// <summary>
+/// Visject Surface graph expression compiled into a flat instructions stream that operates on the typed scalar registers with resolved parameter slots. Used to evaluate the pure parts of the graphs (constants, parameters, math, boolean and comparison nodes) without the nodes tree recursion and Variant boxing of the intermediate values.
+/// </summary>
+class FLAXENGINE_API VisjectProgram
+{
+public:
+    /// <summary>
+    /// The maximum amount of registers used by the program (constants, parameters and temporaries).
+    /// </summary>
+    static constexpr int32 MaxRegisters = 256;
+
+    /// <summary>
+    /// The program instruction codes.
+    /// </summary>
+    enum class OpCode : byte
+    {
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Modulo,
+        Max,
+        Min,
+        Pow,
+        Fmod,
+        Atan2,
+        Abs,
+        Ceil,
+        Cos,
+        Floor,
+        Round,
+        Saturate,
+        Sin,
+        Sqrt,
+        Tan,
+        Negate,
+        OneMinus,
+        Asin,
+        Acos,
+        Atan,
+        Trunc,
+        Frac,
+        Degrees,
+        Radians,
+        Clamp,
+        Lerp,
+        ToBool,
+        Not,
+        And,
+        Or,
+        Xor,
+        Nor,
+        Nand,
+        Equal,
+        NotEqual,
+        Greater,
+        Less,
+        LessEqual,
+        GreaterEqual,
+        Select,
+    };
+
+    /// <summary>
+    /// The program instruction that writes the result of the operation on the source registers into the destination register.
+    /// </summary>
+    struct Instruction
+    {
+        OpCode Op;
+        byte Dst;
+        byte A;
+        byte B;
+        byte C;
+    };
+
+    /// <summary>
+    /// The parameter value read into the register before the program execution.
+    /// </summary>
+    struct ParameterLoad
+    {
+        int32 Index;
+        int32 Component;
+        byte Register;
+    };
+
+    /// <summary>
+    /// The parameter lookup callback used during compilation. Returns the parameter (and its index) or null if missing.
+    /// </summary>
+    typedef const GraphParameter* (*ParameterResolver)(const void* context, const Guid& id, int32& index);
+
+private:
+    enum class Kind : byte
+    {
+        Float,
+        Bool,
+        Int,
+    };
+
+    struct CompileContext;
+
+    Array<float> _registers;
+    Array<ParameterLoad> _parameters;
+    Array<Instruction> _instructions;
+    byte _result = 0;
+    bool _resultIsBool = false;
+    bool _isConstant = false;
+    Variant _constant;
+
+public:
+    /// <summary>
+    /// Gets the amount of the program instructions.
+    /// </summary>
+    FORCE_INLINE int32 GetInstructionsCount() const
+    {
+        return _instructions.Count();
+    }
+
+    /// <summary>
+    /// Determines whether the program result doesn't depend on the parameters (constant expression that is evaluated once during the compilation).
+    /// </summary>
+    FORCE_INLINE bool IsConstant() const
+    {
+        return _isConstant;
+    }
+
+    /// <summary>
+    /// Gets the result of the constant program (see IsConstant).
+    /// </summary>
+    FORCE_INLINE const Variant& GetConstant() const
+    {
+        return _constant;
+    }
+
+    /// <summary>
+    /// Determines whether the node can be compiled into the program (pure node with the scalar values).
+    /// </summary>
+    /// <param name="groupId">The node group identifier.</param>
+    /// <param name="typeId">The node type identifier.</param>
+    /// <param name="parameterGetTypeId">The type identifier of the Get Parameter node in the graph (differs between the graph types).</param>
+    /// <returns>True if node is supported, otherwise false.</returns>
+    static bool IsNodeSupported(uint16 groupId, uint16 typeId, uint16 parameterGetTypeId = 1);
+
+    /// <summary>
+    /// Compiles the program that evaluates the value of the node output box.
+    /// </summary>
+    /// <param name="box">The output box of the node to evaluate.</param>
+    /// <param name="resolver">The graph parameters lookup callback.</param>
+    /// <param name="context">The graph parameters lookup callback context.</param>
+    /// <param name="parameterGetTypeId">The type identifier of the Get Parameter node in the graph (differs between the graph types).</param>
+    /// <returns>True if failed to compile the box (eg. graph uses unsupported nodes or non-scalar values), otherwise false.</returns>
+    bool Compile(VisjectGraphBox* box, ParameterResolver resolver, const void* context, uint16 parameterGetTypeId = 1);
+
+    /// <summary>
+    /// Compiles the program that evaluates the value of the node output box.
+    /// </summary>
+    /// <param name="box">The output box of the node to evaluate.</param>
+    /// <param name="graph">The graph with the parameters used by the nodes.</param>
+    /// <param name="parameterGetTypeId">The type identifier of the Get Parameter node in the graph (differs between the graph types).</param>
+    /// <returns>True if failed to compile the box (eg. graph uses unsupported nodes or non-scalar values), otherwise false.</returns>
+    template<typename GraphType>
+    bool Compile(VisjectGraphBox* box, const GraphType& graph, uint16 parameterGetTypeId = 1)
+    {
+        return Compile(box, [](const void* context, const Guid& id, int32& index) -> const GraphParameter*
+        {
+            const auto& parameters = ((const GraphType*)context)->Parameters;
+            for (index = 0; index < parameters.Count(); index++)
+            {
+                if (parameters[index].Identifier == id)
+                    return &parameters[index];
+            }
+            index = INVALID_INDEX;
+            return nullptr;
+        }, &graph, parameterGetTypeId);
+    }
+
+    /// <summary>
+    /// Executes the program.
+    /// </summary>
+    /// <param name="parameters">The graph instance parameters (in the same order as the graph parameters used for the compilation).</param>
+    /// <returns>The result value (bool or float).</returns>
+    template<typename ParameterType, typename AllocationType>
+    Variant Execute(const Array<ParameterType, AllocationType>& parameters) const
+    {
+        if (_isConstant)
+            return _constant;
+        float registers[MaxRegisters];
+        Platform::MemoryCopy(registers, _registers.Get(), _registers.Count() * sizeof(float));
+        for (const ParameterLoad& e : _parameters)
+            registers[e.Register] = ReadParameter(GetValue(parameters.Get()[e.Index]), e.Component);
+        Run(registers);
+        if (_resultIsBool)
+            return Variant(registers[_result] != 0.0f);
+        return Variant(registers[_result]);
+    }
+
+private:
+    FORCE_INLINE static const Variant& GetValue(const Variant& parameter)
+    {
+        return parameter;
+    }
+
+    template<typename ParameterType>
+    FORCE_INLINE static const Variant& GetValue(const ParameterType& parameter)
+    {
+        return parameter.Value;
+    }
+
+    static float ReadParameter(const Variant& value, int32 component);
+    void Run(float* registers) const;
+};
@@ -0,0 +1,24 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+using Flax.Build;
+
+/// <summary>
+/// Target that builds standalone, native performance benchmarks (tests tagged with [benchmark]). Results are saved to Benchmarks.xml file in the project folder.
+/// </summary>
+public class FlaxBenchmarksTarget : FlaxTestsTarget
+{
+    /// <inheritdoc />
+    public override void Init()
+    {
+        base.Init();
+
+        // Initialize
+        OutputName = "FlaxBenchmarks";
+        ConfigurationName = "Benchmarks";
+        Configurations = new[]
+        {
+            TargetConfiguration.Release,
+        };
+        GlobalDefinitions.Add("FLAX_BENCHMARKS");
+    }
+}
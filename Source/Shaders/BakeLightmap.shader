@@ -315,6 +315,163 @@ void CS_Reduction(uint3 GroupID : SV_GroupID, uint3 GroupThreadID : SV_GroupThre
 	}
 }
 
+#elif defined(_CS_PathTrace)
+
+#include "./Flax/MonteCarlo.hlsl"
+#include "./Flax/GlobalSignDistanceField.hlsl"
+#include "./Flax/GI/GlobalSurfaceAtlas.hlsl"
+
+// This config must match C++ code
+#define PATH_TRACING_GROUP_SIZE 64
+
+META_CB_BEGIN(1, PathTracingData)
+GlobalSDFData GlobalSDF;
+GlobalSurfaceAtlasData GlobalSurfaceAtlas;
+uint TexelsOffset;
+uint TexelsCount;
+uint SampleIndex;
+uint SamplesCount;
+uint BouncesCount;
+float RayMaxDistance;
+float SamplesWeight;
+uint TexelsAtlasSize;
+META_CB_END
+
+// Must match HemisphereData structure defined in Builder.h
+struct LightmapTexel
+{
+	float3 Position;
+	float3 Normal;
+	uint TexelXY;
+};
+
+StructuredBuffer<LightmapTexel> Texels : register(t0);
+Texture3D<float> GlobalSDFTex : register(t1);
+Texture3D<float> GlobalSDFMip : register(t2);
+ByteAddressBuffer GlobalSurfaceAtlasChunks : register(t3);
+ByteAddressBuffer GlobalSurfaceAtlasCulledObjects : register(t4);
+Buffer<float4> GlobalSurfaceAtlasObjects : register(t5);
+Texture2D GlobalSurfaceAtlasDepth : register(t6);
+Texture2D GlobalSurfaceAtlasLighting : register(t7);
+Texture2D GlobalSurfaceAtlasGBuffer0 : register(t8);
+TextureCube Skybox : register(t9);
+RWBuffer<float4> Accumulation : register(u0);
+RWBuffer<float4> OutputBuffer : register(u1);
+
+// PCG hash for random numbers generation (per texel and sample)
+uint RandomHash(uint value)
+{
+	uint state = value * 747796405u + 2891336453u;
+	uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+	return (word >> 22u) ^ word;
+}
+
+float2 RandomFloat2(inout uint seed)
+{
+	seed = RandomHash(seed);
+	float x = (float)(seed & 0xffffff) / 16777216.0f;
+	seed = RandomHash(seed);
+	float y = (float)(seed & 0xffffff) / 16777216.0f;
+	return float2(x, y);
+}
+
+// Traces the path from the lightmap texel into the scene and returns the incoming radiance (uses Global SDF for ray tracing and Global Surface Atlas for surface lighting and albedo)
+float3 TracePath(float3 position, float3 direction, inout uint seed)
+{
+	float3 radiance = 0;
+	float3 throughput = 1;
+	LOOP
+	for (uint bounce = 0; bounce < BouncesCount; bounce++)
+	{
+		GlobalSDFTrace trace;
+		trace.Init(position, direction, 0.0f, RayMaxDistance);
+		trace.NeedsHitNormal = true;
+		GlobalSDFHit hit = RayTraceGlobalSDF(GlobalSDF, GlobalSDFTex, GlobalSDFMip, trace);
+		if (!hit.IsHit())
+		{
+			// Ray escaped the scene
+			radiance += throughput * Skybox.SampleLevel(SamplerLinearClamp, direction, 0).rgb;
+			break;
+		}
+		if (hit.HitTime <= 0.0f)
+		{
+			// Ray started inside the geometry
+			break;
+		}
+
+		// Sample the surface lighting and albedo at the hit location
+		float3 hitPosition = hit.GetHitPosition(trace);
+		float surfaceThreshold = GetGlobalSurfaceAtlasThreshold(GlobalSDF, hit);
+		float4 lighting = SampleGlobalSurfaceAtlas(GlobalSurfaceAtlas, GlobalSurfaceAtlasChunks, GlobalSurfaceAtlasCulledObjects, GlobalSurfaceAtlasObjects, GlobalSurfaceAtlasDepth, GlobalSurfaceAtlasLighting, hitPosition, -direction, surfaceThreshold);
+		radiance += throughput * lighting.rgb;
+		float4 albedo = SampleGlobalSurfaceAtlas(GlobalSurfaceAtlas, GlobalSurfaceAtlasChunks, GlobalSurfaceAtlasCulledObjects, GlobalSurfaceAtlasObjects, GlobalSurfaceAtlasDepth, GlobalSurfaceAtlasGBuffer0, hitPosition, -direction, surfaceThreshold);
+		throughput *= albedo.rgb;
+		if (all(throughput < 0.001f))
+			break;
+
+		// Continue the path with the cosine-weighted direction (cosine term and pdf cancel out with the Lambertian BRDF)
+		float3 hitNormal = hit.HitNormal;
+		direction = TangentToWorld(CosineSampleHemisphere(RandomFloat2(seed)).xyz, hitNormal);
+		position = hitPosition + hitNormal * GlobalSDF.CascadeVoxelSize[hit.HitCascade];
+	}
+	return radiance;
+}
+
+// Progressively accumulates the path traced incoming radiance for the lightmap texels (projected into the H-Basis) and writes the normalized result to the lightmap data
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(PATH_TRACING_GROUP_SIZE, 1, 1)]
+void CS_PathTrace(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	if (DispatchThreadId.x >= TexelsCount)
+		return;
+	uint texelIndex = TexelsOffset + DispatchThreadId.x;
+	LightmapTexel texel = Texels[texelIndex];
+	uint2 texelXY = uint2(texel.TexelXY & 0xffff, texel.TexelXY >> 16);
+	uint texelAdress = (texelXY.y * TexelsAtlasSize + texelXY.x) * NUM_SH_TARGETS;
+
+	// Build the tangent frame (matches the hemispheres rendering)
+	float3 normal = normalize(texel.Normal);
+	float3 c1 = cross(normal, float3(0, 0, 1));
+	float3 c2 = cross(normal, float3(0, 1, 0));
+	float3 tangent = normalize(dot(c1, c1) > dot(c2, c2) ? c1 : c2);
+	float3 binormal = cross(tangent, normal);
+	float3 position = texel.Position + normal * GlobalSDF.CascadeVoxelSize[0];
+
+	float3 hBasisSum[4] = { float3(0, 0, 0), float3(0, 0, 0), float3(0, 0, 0), float3(0, 0, 0) };
+	uint seed = RandomHash(texelIndex * 9781u + SampleIndex * 6271u);
+	LOOP
+	for (uint sampleIndex = 0; sampleIndex < SamplesCount; sampleIndex++)
+	{
+		// Uniformly sample the hemisphere (projection onto SH performs the cosine weighting)
+		float3 dirTS = UniformSampleHemisphere(RandomFloat2(seed)).xyz;
+		float3 dirWS = tangent * dirTS.x + binormal * dirTS.y + normal * dirTS.z;
+		float3 radiance = TracePath(position, dirWS, seed);
+
+		// Project onto SH and convert to H-Basis
+		float3 sh[9];
+		ProjectOntoSH3(dirTS, radiance, sh);
+		float3 hBasis[4];
+		ConvertSH3ToHBasis(sh, hBasis);
+		hBasisSum[0] += hBasis[0];
+		hBasisSum[1] += hBasis[1];
+		hBasisSum[2] += hBasis[2];
+		hBasisSum[3] += hBasis[3];
+	}
+
+	// Accumulate samples and write the normalized lightmap data
+	uint accumulationAdress = texelIndex * NUM_SH_TARGETS;
+	UNROLL
+	for (uint i = 0; i < NUM_SH_TARGETS; i++)
+	{
+		float4 accumulated = Accumulation[accumulationAdress + i] + float4(hBasisSum[0][i], hBasisSum[1][i], hBasisSum[2][i], hBasisSum[3][i]);
+		Accumulation[accumulationAdress + i] = accumulated;
+
+		// Note: we add some bias to indicate that this texel has been used
+		float4 output = accumulated * SamplesWeight + USED_TEXELS_BIAS;
+		OutputBuffer[texelAdress + i] = clamp(output, 0, 10000);
+	}
+}
+
 #elif defined(_CS_BlurEmpty)
 
 Buffer<float4> InputBuffer    : register(t0);
@@ -0,0 +1,27 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#ifndef __BINDLESS_RESOURCES__
+#define __BINDLESS_RESOURCES__
+
+#include "./Flax/Common.hlsl"
+
+#if CAN_USE_BINDLESS
+
+// Bindless resources arrays (alias the same descriptors table, see GPUResourceView::GetBindlessIndex)
+// Shader that uses them has to be used only if GPULimits::HasBindlessResources is set
+Texture2D BindlessTextures2D[] : register(t0, space1);
+Texture2DArray BindlessTextures2DArray[] : register(t0, space2);
+Texture3D BindlessTextures3D[] : register(t0, space3);
+TextureCube BindlessTexturesCube[] : register(t0, space4);
+Buffer<float4> BindlessBuffers[] : register(t0, space5); // Typed buffers only
+
+// Gets the bindless resource by index (stored in the constant buffer, can be different between the pixels or threads)
+#define BINDLESS_TEXTURE2D(index) BindlessTextures2D[NonUniformResourceIndex(index)]
+#define BINDLESS_TEXTURE2D_ARRAY(index) BindlessTextures2DArray[NonUniformResourceIndex(index)]
+#define BINDLESS_TEXTURE3D(index) BindlessTextures3D[NonUniformResourceIndex(index)]
+#define BINDLESS_TEXTURE_CUBE(index) BindlessTexturesCube[NonUniformResourceIndex(index)]
+#define BINDLESS_BUFFER(index) BindlessBuffers[NonUniformResourceIndex(index)]
+
+#endif
+
+#endif
@@ -73,6 +73,9 @@
 #else
 #define CAN_USE_TESSELLATION 0
 #endif
+#if !defined(CAN_USE_BINDLESS)
+#define CAN_USE_BINDLESS 0 // Set by the shader compiler if target supports bindless resources arrays (see BindlessResources.hlsl)
+#endif
 
 // Compiler attributes
 
@@ -0,0 +1,175 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define THREAD_GROUP_SIZE 64
+
+// The size of the skinned vertex (must match VB0SkinnedElementType in C++)
+#define SKINNED_VERTEX_STRIDE 36
+
+// The size of the output vertex attributes (must match VB1ElementType in C++)
+#define ATTRIBUTES_STRIDE 16
+
+// The size of the blend shape vertex (must match BlendShapeVertex in C++)
+#define BLEND_SHAPE_VERTEX_STRIDE 28
+
+// The size of the accumulated blend shapes deltas per-vertex (int3 position delta and int3 normal delta)
+#define BLEND_SHAPES_DELTA_STRIDE 24
+
+// The scale of the blend shapes deltas stored in the fixed-point format (for atomic accumulation)
+#define BLEND_SHAPES_DELTA_SCALE 16384.0f
+
+META_CB_BEGIN(0, Data)
+uint VerticesCount;
+uint PrevPositionsOffset;
+uint GroupsX;
+uint Dummy0;
+META_CB_END
+
+#ifdef _CS_BlendShapes
+
+ByteAddressBuffer BlendShapesVertices : register(t0);
+
+// The active blend shapes (uint4 per blend shape: vertices offset, vertices count, weight, use normals)
+ByteAddressBuffer BlendShapes : register(t1);
+
+RWByteAddressBuffer BlendShapesDeltas : register(u0);
+
+// Accumulates the sparse deltas of the active blend shapes (thread per blend shape vertex, group row per blend shape)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_BlendShapes(uint3 groupId : SV_GroupID, uint groupIndex : SV_GroupIndex)
+{
+	uint4 blendShape = BlendShapes.Load4(groupId.y * 16);
+	uint index = groupId.x * THREAD_GROUP_SIZE + groupIndex;
+	if (index >= blendShape.y)
+		return;
+
+	// Load blend shape vertex
+	uint address = (blendShape.x + index) * BLEND_SHAPE_VERTEX_STRIDE;
+	float3 positionDelta = asfloat(BlendShapesVertices.Load3(address)) * asfloat(blendShape.z);
+	float3 normalDelta = asfloat(BlendShapesVertices.Load3(address + 12));
+	uint vertexIndex = BlendShapesVertices.Load(address + 24);
+
+	// Accumulate deltas (normal deltas are not weighted to match the CPU blending)
+	uint deltaAddress = vertexIndex * BLEND_SHAPES_DELTA_STRIDE;
+	int3 delta = (int3)round(positionDelta * BLEND_SHAPES_DELTA_SCALE);
+	BlendShapesDeltas.InterlockedAdd(deltaAddress, asuint(delta.x));
+	BlendShapesDeltas.InterlockedAdd(deltaAddress + 4, asuint(delta.y));
+	BlendShapesDeltas.InterlockedAdd(deltaAddress + 8, asuint(delta.z));
+	if (blendShape.w != 0)
+	{
+		delta = (int3)round(normalDelta * BLEND_SHAPES_DELTA_SCALE);
+		BlendShapesDeltas.InterlockedAdd(deltaAddress + 12, asuint(delta.x));
+		BlendShapesDeltas.InterlockedAdd(deltaAddress + 16, asuint(delta.y));
+		BlendShapesDeltas.InterlockedAdd(deltaAddress + 20, asuint(delta.z));
+	}
+}
+
+#endif
+
+#ifdef _CS_Skinning
+
+ByteAddressBuffer Vertices : register(t0);
+
+// The skeletal bones matrix buffers (stored as 4x3, 3 float4 behind each other)
+Buffer<float4> BoneMatrices : register(t1);
+Buffer<float4> PrevBoneMatrices : register(t2);
+
+#if USE_BLEND_SHAPES
+// The accumulated blend shapes deltas (see CS_BlendShapes)
+ByteAddressBuffer BlendShapesDeltas : register(t3);
+#endif
+
+RWByteAddressBuffer OutputPositions : register(u0);
+RWByteAddressBuffer OutputAttributes : register(u1);
+
+float3x4 GetBoneMatrix(uint index)
+{
+	float4 a = BoneMatrices[index * 3];
+	float4 b = BoneMatrices[index * 3 + 1];
+	float4 c = BoneMatrices[index * 3 + 2];
+	return float3x4(a, b, c);
+}
+
+float3x4 GetPrevBoneMatrix(uint index)
+{
+	float4 a = PrevBoneMatrices[index * 3];
+	float4 b = PrevBoneMatrices[index * 3 + 1];
+	float4 c = PrevBoneMatrices[index * 3 + 2];
+	return float3x4(a, b, c);
+}
+
+float3 UnpackUnitVector(uint packed)
+{
+	return float3(packed & 0x3ff, (packed >> 10) & 0x3ff, (packed >> 20) & 0x3ff) * (2.0f / 1023.0f) - 1.0f;
+}
+
+uint PackUnitVector(float3 value, uint packed)
+{
+	uint3 v = (uint3)round(saturate(normalize(value) * 0.5f + 0.5f) * 1023.0f);
+	return v.x | (v.y << 10) | (v.z << 20) | (packed & 0xc0000000);
+}
+
+// Skins the mesh vertices (thread per vertex) into the static mesh vertex layout (positions stream with the previous frame positions after it and the attributes stream)
+META_CS(true, FEATURE_LEVEL_SM5)
+META_PERMUTATION_1(USE_BLEND_SHAPES=0)
+META_PERMUTATION_1(USE_BLEND_SHAPES=1)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_Skinning(uint3 groupId : SV_GroupID, uint groupIndex : SV_GroupIndex)
+{
+	uint vertexIndex = (groupId.y * GroupsX + groupId.x) * THREAD_GROUP_SIZE + groupIndex;
+	if (vertexIndex >= VerticesCount)
+		return;
+
+	// Load vertex
+	uint address = vertexIndex * SKINNED_VERTEX_STRIDE;
+	float4 position = float4(asfloat(Vertices.Load3(address)), 1);
+	uint texCoord = Vertices.Load(address + 12);
+	uint normal = Vertices.Load(address + 16);
+	uint tangent = Vertices.Load(address + 20);
+	uint blendIndicesPacked = Vertices.Load(address + 24);
+	uint2 blendWeightsPacked = Vertices.Load2(address + 28);
+	uint4 blendIndices = uint4(blendIndicesPacked & 0xff, (blendIndicesPacked >> 8) & 0xff, (blendIndicesPacked >> 16) & 0xff, blendIndicesPacked >> 24);
+	float4 blendWeights = float4(f16tof32(blendWeightsPacked.x), f16tof32(blendWeightsPacked.x >> 16), f16tof32(blendWeightsPacked.y), f16tof32(blendWeightsPacked.y >> 16));
+
+#if USE_BLEND_SHAPES
+	// Apply blend shapes
+	uint deltaAddress = vertexIndex * BLEND_SHAPES_DELTA_STRIDE;
+	int3 positionDelta = asint(BlendShapesDeltas.Load3(deltaAddress));
+	int3 normalDelta = asint(BlendShapesDeltas.Load3(deltaAddress + 12));
+	position.xyz += (float3)positionDelta * (1.0f / BLEND_SHAPES_DELTA_SCALE);
+	if (any(normalDelta != 0))
+	{
+		// Rebuild tangent frame
+		float3 n = normalize(UnpackUnitVector(normal) + (float3)normalDelta * (1.0f / BLEND_SHAPES_DELTA_SCALE));
+		float3 t = UnpackUnitVector(tangent);
+		t = t - dot(t, n) * n;
+		normal = PackUnitVector(n, normal);
+		tangent = PackUnitVector(t, tangent);
+	}
+#endif
+
+	// Perform skinning
+	float3x4 boneMatrix = blendWeights.x * GetBoneMatrix(blendIndices.x);
+	boneMatrix += blendWeights.y * GetBoneMatrix(blendIndices.y);
+	boneMatrix += blendWeights.z * GetBoneMatrix(blendIndices.z);
+	boneMatrix += blendWeights.w * GetBoneMatrix(blendIndices.w);
+	float3x4 prevBoneMatrix = blendWeights.x * GetPrevBoneMatrix(blendIndices.x);
+	prevBoneMatrix += blendWeights.y * GetPrevBoneMatrix(blendIndices.y);
+	prevBoneMatrix += blendWeights.z * GetPrevBoneMatrix(blendIndices.z);
+	prevBoneMatrix += blendWeights.w * GetPrevBoneMatrix(blendIndices.w);
+	float3 skinnedPosition = mul(boneMatrix, position);
+	float3 skinnedPrevPosition = mul(prevBoneMatrix, position);
+	float3 skinnedNormal = mul(boneMatrix, float4(UnpackUnitVector(normal), 0));
+	float3 skinnedTangent = mul(boneMatrix, float4(UnpackUnitVector(tangent), 0));
+
+	// Write output
+	address = vertexIndex * 12;
+	OutputPositions.Store3(address, asuint(skinnedPosition));
+	OutputPositions.Store3(PrevPositionsOffset + address, asuint(skinnedPrevPosition));
+	OutputAttributes.Store4(vertexIndex * ATTRIBUTES_STRIDE, uint4(texCoord, PackUnitVector(skinnedNormal, normal), PackUnitVector(skinnedTangent, tangent), 0));
+}
+
+#endif
@@ -27,6 +27,25 @@ VS2PS VS(float3 Position : POSITION, float4 Color : COLOR)
 	return output;
 }
 
+META_VS(true, FEATURE_LEVEL_ES2)
+META_VS_IN_ELEMENT(POSITION,  0, R32G32B32_FLOAT,    0, ALIGN, PER_VERTEX,   0, true)
+META_VS_IN_ELEMENT(COLOR,     0, R8G8B8A8_UNORM,     0, ALIGN, PER_VERTEX,   0, true)
+META_VS_IN_ELEMENT(ATTRIBUTE, 0, R32G32B32A32_FLOAT, 1, 0,     PER_INSTANCE, 1, true)
+META_VS_IN_ELEMENT(ATTRIBUTE, 1, R32G32B32A32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, true)
+META_VS_IN_ELEMENT(ATTRIBUTE, 2, R32G32B32A32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, true)
+META_VS_IN_ELEMENT(ATTRIBUTE, 3, R8G8B8A8_UNORM,     1, ALIGN, PER_INSTANCE, 1, true)
+VS2PS VS_Instanced(float3 Position : POSITION, float4 Color : COLOR, float4 InstanceTransform0 : ATTRIBUTE0, float4 InstanceTransform1 : ATTRIBUTE1, float4 InstanceTransform2 : ATTRIBUTE2, float4 InstanceColor : ATTRIBUTE3)
+{
+	// Transform the unit primitive vertex by the instance world matrix (rows of the transposed 4x3 matrix)
+	float4 position = float4(Position, 1);
+	float3 worldPosition = float3(dot(position, InstanceTransform0), dot(position, InstanceTransform1), dot(position, InstanceTransform2));
+
+	VS2PS output;
+	output.Position = mul(float4(worldPosition, 1), ViewProjection);
+	output.Color = Color * InstanceColor;
+	return output;
+}
+
 META_PS(true, FEATURE_LEVEL_ES2)
 META_PERMUTATION_2(USE_DEPTH_TEST=0,USE_FAKE_LIGHTING=0)
 META_PERMUTATION_2(USE_DEPTH_TEST=0,USE_FAKE_LIGHTING=1)
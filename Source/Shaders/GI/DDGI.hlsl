@@ -16,6 +16,7 @@
 #define DDGI_PROBE_STATE_INACTIVE 0
 #define DDGI_PROBE_STATE_ACTIVATED 1
 #define DDGI_PROBE_STATE_ACTIVE 2
+#define DDGI_PROBE_STATE_SLEEPING 3
 #define DDGI_PROBE_RESOLUTION_IRRADIANCE 6 // Resolution (in texels) for probe irradiance data (excluding 1px padding on each side)
 #define DDGI_PROBE_RESOLUTION_DISTANCE 14 // Resolution (in texels) for probe distance data (excluding 1px padding on each side)
 #define DDGI_SRGB_BLENDING 1 // Enables blending in sRGB color space, otherwise irradiance blending is done in linear space
@@ -108,6 +109,12 @@ uint DecodeDDGIProbeState(float4 probeData)
     return (uint)(probeData.w * 8.0f);
 }
 
+// Checks if probe has valid lighting data (activated probes are not yet updated at their new location)
+bool IsDDGIProbeValid(uint probeState)
+{
+    return probeState == DDGI_PROBE_STATE_ACTIVE || probeState == DDGI_PROBE_STATE_SLEEPING;
+}
+
 // Decodes probe world-space position (XYZ) from the encoded state
 float3 DecodeDDGIProbePosition(DDGIData data, float4 probeData, uint cascadeIndex, uint probeIndex, uint3 probeCoords)
 {
@@ -158,7 +165,7 @@ float3 SampleDDGIIrradiance(DDGIData data, Texture2D<snorm float4> probesData, T
                 float4 probeData = LoadDDGIProbeData(data, probesData, cascadeIndex, probeIndex);
                 probesDatas[i] = probeData;
                 uint probeState = DecodeDDGIProbeState(probeData);
-                if (probeState != DDGI_PROBE_STATE_INACTIVE)
+                if (IsDDGIProbeValid(probeState))
                     activeCount++;
             }
 
@@ -195,7 +202,7 @@ float3 SampleDDGIIrradiance(DDGIData data, Texture2D<snorm float4> probesData, T
         // Load probe position and state
         float4 probeData = probesDatas[i];
         uint probeState = DecodeDDGIProbeState(probeData);
-        if (probeState == DDGI_PROBE_STATE_INACTIVE)
+        if (!IsDDGIProbeValid(probeState))
             continue;
         float3 probeBasePosition = baseProbeWorldPosition + ((probeCoords - baseProbeCoords) * probesSpacing);
         float3 probePosition = probeBasePosition + probeData.xyz * probesSpacing; // Probe offset is [-1;1] within probes spacing
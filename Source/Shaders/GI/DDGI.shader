@@ -21,6 +21,12 @@
 #define DDGI_TRACE_RAYS_LIMIT 256 // Limit of rays per-probe (runtime value can be smaller)
 #define DDGI_PROBE_UPDATE_BORDERS_GROUP_SIZE 8
 #define DDGI_PROBE_CLASSIFY_GROUP_SIZE 32
+#define DDGI_PROBE_UPDATE_PRIORITY_BUCKETS 16 // Amount of priority levels for probes updates sorting
+#define DDGI_PROBE_UPDATE_HEADER_SIZE (DDGI_PROBE_UPDATE_PRIORITY_BUCKETS + 4) // Amount of uints at the beginning of the probes update buffer (priority histogram, threshold priority, count of probes above threshold and 2 counters)
+
+#define DDGI_PROBE_SLEEP_THRESHOLD 0.002f // Max irradiance change (in sRGB space) during the update to put probe into sleep
+#define DDGI_PROBE_SLEEP_WAKE_INTERVAL 16 // Interval (in cascade updates) at which sleeping probes are woken up to check lighting changes
+#define DDGI_PROBE_UPDATE_PRIORITY_CHANGE_SCALE 20.0f // Scale of the irradiance change for probe update priority
 
 META_CB_BEGIN(0, Data0)
 DDGIData DDGI;
@@ -32,14 +38,26 @@ float ProbesDistanceLimit;
 float ResetBlend;
 float TemporalTime;
 int4 ProbeScrollClears[4];
+float3 ProbesViewDir;
+float ProbesViewFovCos;
+uint ProbesUpdateBudget;
+float3 Padding2;
 META_CB_END
 
 META_CB_BEGIN(1, Data1)
-float2 Padding1;
+uint ProbesUpdateFrame;
+float Padding1;
 uint CascadeIndex;
 uint ProbeIndexOffset;
 META_CB_END
 
+// Gets the address of the probe data in the probes update buffer (2 uints per probe: irradiance change during last update and update priority)
+uint GetProbeUpdateAddress(uint probeIndex)
+{
+    uint probesCount = DDGI.ProbesCounts.x * DDGI.ProbesCounts.y * DDGI.ProbesCounts.z;
+    return (DDGI_PROBE_UPDATE_HEADER_SIZE + (CascadeIndex * probesCount + probeIndex) * 2) * 4;
+}
+
 // Calculates the evenly distributed direction ray on a sphere (Spherical Fibonacci lattice)
 float3 GetSphericalFibonacci(float sampleIndex, float samplesCount)
 {
@@ -70,7 +88,7 @@ uint GetProbeRaysCount(DDGIData data, uint probeState)
 #define DDGI_PROBE_RELOCATE_ITERATIVE 0 // If true, probes relocation algorithm tries to move them in additive way, otherwise all nearby locations are checked to find the best position
 
 RWTexture2D<snorm float4> RWProbesData : register(u0);
-RWByteAddressBuffer RWActiveProbes : register(u1);
+RWByteAddressBuffer RWProbesUpdate : register(u1);
 
 Texture3D<float> GlobalSDFTex : register(t0);
 Texture3D<float> GlobalSDFMip : register(t1);
@@ -80,6 +98,20 @@ float3 Remap(float3 value, float3 fromMin, float3 fromMax, float3 toMin, float3
     return (value - fromMin) / (fromMax - fromMin) * (toMax - toMin) + toMin;
 }
 
+// Calculates the probe update priority level (based on the visibility, distance to the view and the lighting change during the last update)
+uint GetProbeUpdatePriority(uint probeState, float3 probePosition, float probesSpacing, float lightingChange)
+{
+    if (probeState == DDGI_PROBE_STATE_ACTIVATED)
+        return DDGI_PROBE_UPDATE_PRIORITY_BUCKETS - 1; // Probes without valid lighting data go first
+    float3 viewToProbe = probePosition - DDGI.ViewPos;
+    float viewDistance = length(viewToProbe);
+    float visibility = viewDistance < probesSpacing * 2.0f || dot(viewToProbe / viewDistance, ProbesViewDir) >= ProbesViewFovCos ? 1.0f : 0.0f;
+    float distanceFactor = saturate(1.0f - viewDistance / (probesSpacing * 0.5f * Max3(float3(DDGI.ProbesCounts))));
+    float changeFactor = saturate(lightingChange * DDGI_PROBE_UPDATE_PRIORITY_CHANGE_SCALE);
+    float priority = changeFactor * 0.4f + visibility * 0.35f + distanceFactor * 0.25f;
+    return min((uint)(priority * (DDGI_PROBE_UPDATE_PRIORITY_BUCKETS - 1)), DDGI_PROBE_UPDATE_PRIORITY_BUCKETS - 2);
+}
+
 // Compute shader for updating probes state between active and inactive and performing probes relocation.
 META_CS(true, FEATURE_LEVEL_SM5)
 [numthreads(DDGI_PROBE_CLASSIFY_GROUP_SIZE, 1, 1)]
@@ -195,23 +227,80 @@ void CS_Classify(uint3 DispatchThreadId : SV_DispatchThreadID)
                 wasScrolled = true;
         }
 
-        // If probe was in different location or was inactive last frame then mark it as activated
+        // If probe was in different location or was inactive last frame then mark it as activated (activated probes that didn't fit into the updates budget stay activated)
         bool wasInactive = probeState == DDGI_PROBE_STATE_INACTIVE;
+        bool wasActivated = probeState == DDGI_PROBE_STATE_ACTIVATED;
         bool wasRelocated = distance(probeOffset, probeOffsetOld) > 2.0f;
-        probeState = wasInactive || wasScrolled || wasRelocated ? DDGI_PROBE_STATE_ACTIVATED : DDGI_PROBE_STATE_ACTIVE;
+        if (wasInactive || wasActivated || wasScrolled || wasRelocated)
+        {
+            probeState = DDGI_PROBE_STATE_ACTIVATED;
+        }
+        else if (probeState == DDGI_PROBE_STATE_SLEEPING)
+        {
+            // Wake up sleeping probe from time to time to catch up with lighting changes
+            if ((probeIndex + ProbesUpdateFrame) % DDGI_PROBE_SLEEP_WAKE_INTERVAL == 0)
+                probeState = DDGI_PROBE_STATE_ACTIVE;
+        }
+        else
+        {
+            // Put probe to sleep if its lighting is stable
+            float lightingChange = asfloat(RWProbesUpdate.Load(GetProbeUpdateAddress(probeIndex)));
+            probeState = lightingChange < DDGI_PROBE_SLEEP_THRESHOLD ? DDGI_PROBE_STATE_SLEEPING : DDGI_PROBE_STATE_ACTIVE;
+        }
     }
 
     // Save probe state
-    probeOffset /= probesSpacing; // Move offset back to [-1;1] space
-    RWProbesData[probeDataCoords] = EncodeDDGIProbeData(probeOffset, probeState);
+    RWProbesData[probeDataCoords] = EncodeDDGIProbeData(probeOffset / probesSpacing, probeState); // Move offset back to [-1;1] space
 
-    // Collect active probes
-    if (probeState != DDGI_PROBE_STATE_INACTIVE)
+    // Calculate the update priority of the probes to update (histogram is used to select probes within the updates budget)
+    uint probeUpdateAddress = GetProbeUpdateAddress(probeIndex);
+    uint priority = DDGI_PROBE_UPDATE_PRIORITY_BUCKETS;
+    if (probeState == DDGI_PROBE_STATE_ACTIVATED || probeState == DDGI_PROBE_STATE_ACTIVE)
     {
-        uint activeProbeIndex;
-        RWActiveProbes.InterlockedAdd(0, 1, activeProbeIndex); // Counter at 0
-        RWActiveProbes.Store(activeProbeIndex * 4 + 4, DispatchThreadId.x);
+        float lightingChange = asfloat(RWProbesUpdate.Load(probeUpdateAddress));
+        priority = GetProbeUpdatePriority(probeState, probeBasePosition + probeOffset, probesSpacing, lightingChange);
+        RWProbesUpdate.InterlockedAdd(priority * 4, 1);
     }
+    RWProbesUpdate.Store(probeUpdateAddress + 4, priority);
+}
+
+#endif
+
+#ifdef _CS_CollectProbes
+
+RWByteAddressBuffer RWActiveProbes : register(u0);
+RWByteAddressBuffer RWProbesUpdate : register(u1);
+
+// Compute shader for building the list of probes to update (ordered by the update priority and limited by the updates budget).
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(DDGI_PROBE_CLASSIFY_GROUP_SIZE, 1, 1)]
+void CS_CollectProbes(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+    uint probeIndex = DispatchThreadId.x;
+    uint probesCount = DDGI.ProbesCounts.x * DDGI.ProbesCounts.y * DDGI.ProbesCounts.z;
+    if (probeIndex >= probesCount)
+        return;
+    uint3 probeCoords = GetDDGIProbeCoords(DDGI, probeIndex);
+    probeIndex = GetDDGIScrollingProbeIndex(DDGI, CascadeIndex, probeCoords);
+    uint priority = RWProbesUpdate.Load(GetProbeUpdateAddress(probeIndex) + 4);
+    uint thresholdPriority = RWProbesUpdate.Load(DDGI_PROBE_UPDATE_PRIORITY_BUCKETS * 4);
+    if (priority >= DDGI_PROBE_UPDATE_PRIORITY_BUCKETS || priority < thresholdPriority)
+        return;
+
+    // Probes above the threshold priority fit into the budget, the ones at the threshold fill the remaining space after them
+    uint activeProbeIndex;
+    if (priority > thresholdPriority)
+    {
+        RWProbesUpdate.InterlockedAdd(DDGI_PROBE_UPDATE_PRIORITY_BUCKETS * 4 + 8, 1, activeProbeIndex);
+    }
+    else
+    {
+        RWProbesUpdate.InterlockedAdd(DDGI_PROBE_UPDATE_PRIORITY_BUCKETS * 4 + 12, 1, activeProbeIndex);
+        activeProbeIndex += RWProbesUpdate.Load(DDGI_PROBE_UPDATE_PRIORITY_BUCKETS * 4 + 4);
+        if (activeProbeIndex >= RWActiveProbes.Load(0))
+            return;
+    }
+    RWActiveProbes.Store(activeProbeIndex * 4 + 4, DispatchThreadId.x);
 }
 
 #endif
@@ -219,19 +308,36 @@ void CS_Classify(uint3 DispatchThreadId : SV_DispatchThreadID)
 #ifdef _CS_UpdateProbesInitArgs
 
 RWBuffer<uint> UpdateProbesInitArgs : register(u0);
-ByteAddressBuffer ActiveProbes : register(t0);
+RWByteAddressBuffer RWActiveProbes : register(u1);
+RWByteAddressBuffer RWProbesUpdate : register(u2);
 
-// Compute shader for building indirect dispatch arguments for CS_TraceRays and CS_UpdateProbes.
+// Compute shader for selecting probes to update within the budget and building indirect dispatch arguments for CS_TraceRays and CS_UpdateProbes.
 META_CS(true, FEATURE_LEVEL_SM5)
 [numthreads(1, 1, 1)]
 void CS_UpdateProbesInitArgs()
 {
+    // Find the lowest priority of probes that fit into the updates budget
+    uint activeProbesCount = 0;
+    uint thresholdPriority = 0;
+    uint thresholdProbesOffset = 0;
+    for (int priority = DDGI_PROBE_UPDATE_PRIORITY_BUCKETS - 1; priority >= 0; priority--)
+    {
+        thresholdPriority = priority;
+        thresholdProbesOffset = activeProbesCount;
+        activeProbesCount += RWProbesUpdate.Load(priority * 4);
+        if (activeProbesCount >= ProbesUpdateBudget)
+            break;
+    }
+    activeProbesCount = min(activeProbesCount, ProbesUpdateBudget);
+    RWProbesUpdate.Store4(DDGI_PROBE_UPDATE_PRIORITY_BUCKETS * 4, uint4(thresholdPriority, thresholdProbesOffset, 0, 0));
+    RWActiveProbes.Store(0, activeProbesCount); // Counter at 0
+
+    // Write dispatch args for all batches (unused ones are empty)
     uint probesCount = DDGI.ProbesCounts.x * DDGI.ProbesCounts.y * DDGI.ProbesCounts.z;
-    uint activeProbesCount = ActiveProbes.Load(0);
     uint arg = 0;
-    for (uint probesOffset = 0; probesOffset < activeProbesCount; probesOffset += DDGI_TRACE_RAYS_PROBES_COUNT_LIMIT)
+    for (uint probesOffset = 0; probesOffset < probesCount; probesOffset += DDGI_TRACE_RAYS_PROBES_COUNT_LIMIT)
     {
-        uint probesBatchSize = min(activeProbesCount - probesOffset, DDGI_TRACE_RAYS_PROBES_COUNT_LIMIT);
+        uint probesBatchSize = probesOffset < activeProbesCount ? min(activeProbesCount - probesOffset, DDGI_TRACE_RAYS_PROBES_COUNT_LIMIT) : 0;
         UpdateProbesInitArgs[arg++] = probesBatchSize;
         UpdateProbesInitArgs[arg++] = 1;
         UpdateProbesInitArgs[arg++] = 1;
@@ -332,7 +438,13 @@ groupshared float CachedProbesTraceDistance[DDGI_TRACE_RAYS_LIMIT];
 groupshared float3 CachedProbesTraceDirection[DDGI_TRACE_RAYS_LIMIT];
 
 RWTexture2D<float4> RWOutput : register(u0);
+#if DDGI_PROBE_UPDATE_MODE == 0
+groupshared uint CachedProbeLightingChange;
+RWByteAddressBuffer RWProbesUpdate : register(u1);
 Texture2D<snorm float4> ProbesData : register(t0);
+#else
+RWTexture2D<snorm float4> RWProbesData : register(u1);
+#endif
 Texture2D<float4> ProbesTrace : register(t1);
 ByteAddressBuffer ActiveProbes : register(t2);
 
@@ -352,7 +464,14 @@ void CS_UpdateProbes(uint3 GroupThreadId : SV_GroupThreadID, uint3 GroupId : SV_
 
     // Skip disabled probes
     bool skip = false;
+#if DDGI_PROBE_UPDATE_MODE == 0
     float4 probeData = LoadDDGIProbeData(DDGI, ProbesData, CascadeIndex, probeIndex);
+    if (GroupIndex == 0)
+        CachedProbeLightingChange = 0;
+#else
+    int2 probeDataCoords = GetDDGIProbeTexelCoords(DDGI, CascadeIndex, probeIndex);
+    float4 probeData = RWProbesData[probeDataCoords];
+#endif
     uint probeState = DecodeDDGIProbeState(probeData);
     uint probeRaysCount = GetProbeRaysCount(DDGI, probeState);
     if (probeState == DDGI_PROBE_STATE_INACTIVE)
@@ -470,6 +589,18 @@ void CS_UpdateProbes(uint3 GroupThreadId : SV_GroupThreadID, uint3 GroupId : SV_
 #endif
 
     RWOutput[outputCoords] = result;
+
+#if DDGI_PROBE_UPDATE_MODE == 0
+    // Store the max irradiance change of the probe (used to put stable probes into sleep and to prioritize probes updates)
+    InterlockedMax(CachedProbeLightingChange, asuint(Max3(abs(result.rgb - previous))));
+    GroupMemoryBarrierWithGroupSync();
+    if (GroupIndex == 0)
+        RWProbesUpdate.Store(GetProbeUpdateAddress(probeIndex), CachedProbeLightingChange);
+#else
+    // Mark activated probe as updated (distance update goes after irradiance update)
+    if (wasActivated && GroupIndex == 0)
+        RWProbesData[probeDataCoords] = EncodeDDGIProbeData(probeData.xyz, DDGI_PROBE_STATE_ACTIVE);
+#endif
 }
 
 // Compute shader for updating probes irradiance or distance texture borders (fills gaps between probes to support bilinear filtering)
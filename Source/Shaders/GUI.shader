@@ -22,6 +22,47 @@ META_CB_END
 
 Texture2D Image : register(t0);
 
+// Textures batched within a single draw call (slot index is stored per-vertex, must match RENDER2D_TEXTURE_SLOTS in C++)
+Texture2D Image1 : register(t1);
+Texture2D Image2 : register(t2);
+Texture2D Image3 : register(t3);
+Texture2D Image4 : register(t4);
+Texture2D Image5 : register(t5);
+Texture2D Image6 : register(t6);
+Texture2D Image7 : register(t7);
+
+float4 SampleImage(SamplerState imageSampler, float2 uv, float slot)
+{
+	// Use explicit gradients since textures are sampled in the flow control
+	float2 uvDDX = ddx(uv);
+	float2 uvDDY = ddy(uv);
+	uint index = (uint)(slot + 0.5f);
+	BRANCH
+	if (index < 4)
+	{
+		BRANCH
+		if (index == 0)
+			return Image.SampleGrad(imageSampler, uv, uvDDX, uvDDY);
+		BRANCH
+		if (index == 1)
+			return Image1.SampleGrad(imageSampler, uv, uvDDX, uvDDY);
+		BRANCH
+		if (index == 2)
+			return Image2.SampleGrad(imageSampler, uv, uvDDX, uvDDY);
+		return Image3.SampleGrad(imageSampler, uv, uvDDX, uvDDY);
+	}
+	BRANCH
+	if (index == 4)
+		return Image4.SampleGrad(imageSampler, uv, uvDDX, uvDDY);
+	BRANCH
+	if (index == 5)
+		return Image5.SampleGrad(imageSampler, uv, uvDDX, uvDDY);
+	BRANCH
+	if (index == 6)
+		return Image6.SampleGrad(imageSampler, uv, uvDDX, uvDDY);
+	return Image7.SampleGrad(imageSampler, uv, uvDDX, uvDDY);
+}
+
 META_VS(true, FEATURE_LEVEL_ES2)
 META_VS_IN_ELEMENT(POSITION, 0, R32G32_FLOAT,       0, ALIGN, PER_VERTEX, 0, true)
 META_VS_IN_ELEMENT(TEXCOORD, 0, R16G16_FLOAT,       0, ALIGN, PER_VERTEX, 0, true)
@@ -51,7 +92,7 @@ float4 PS_Image(VS2PS input) : SV_Target0
 {
 	PerformClipping(input);
 
-	return Image.Sample(SamplerLinearClamp, input.TexCoord) * input.Color;
+	return SampleImage(SamplerLinearClamp, input.TexCoord, input.CustomData.x) * input.Color;
 }
 
 META_PS(true, FEATURE_LEVEL_ES2)
@@ -59,7 +100,7 @@ float4 PS_ImagePoint(VS2PS input) : SV_Target0
 {
 	PerformClipping(input);
 
-	return Image.Sample(SamplerPointClamp, input.TexCoord) * input.Color;
+	return SampleImage(SamplerPointClamp, input.TexCoord, input.CustomData.x) * input.Color;
 }
 
 META_PS(true, FEATURE_LEVEL_ES2)
@@ -97,7 +138,14 @@ float4 PS_Font(VS2PS input) : SV_Target0
 	PerformClipping(input);
 
 	float4 color = input.Color;
-	color.a *= Image.Sample(SamplerLinearClamp, input.TexCoord).r;
+	float coverage = SampleImage(SamplerLinearClamp, input.TexCoord, input.CustomData.x).r;
+
+	// Decode signed distance field characters (edge at 0.5, smoothed over the screen pixel footprint)
+	float edgeWidth = max(fwidth(coverage), 0.0001f);
+	if ((int)input.CustomData.y & 2)
+		coverage = saturate((coverage - 0.5f) / edgeWidth + 0.5f);
+
+	color.a *= coverage;
 	return color;
 }
 
@@ -5,6 +5,7 @@
 
 #define GLOBAL_SDF_RASTERIZE_CHUNK_SIZE 32
 #define GLOBAL_SDF_RASTERIZE_CHUNK_MARGIN 4
+#define GLOBAL_SDF_RASTERIZE_MIP_FACTOR 4
 #define GLOBAL_SDF_MIP_FLOODS 5
 #define GLOBAL_SDF_WORLD_SIZE 60000.0f
 
@@ -59,13 +60,47 @@ struct GlobalSDFHit
     }
 };
 
-void GetGlobalSDFCascadeUV(const GlobalSDFData data, uint cascade, float3 worldPosition, out float cascadeMaxDistance, out float3 cascadeUV, out float3 textureUV)
+void GetGlobalSDFCascadeUV(const GlobalSDFData data, uint cascade, float3 worldPosition, out float cascadeMaxDistance, out float3 cascadeUV)
 {
     float4 cascadePosDistance = data.CascadePosDistance[cascade];
     float3 posInCascade = worldPosition - cascadePosDistance.xyz;
     cascadeMaxDistance = cascadePosDistance.w * 2;
     cascadeUV = saturate(posInCascade / cascadeMaxDistance + 0.5f);
-    textureUV = float3(((float)cascade + cascadeUV.x) / (float)data.CascadesCount, cascadeUV.y, cascadeUV.z); // cascades are placed next to each other on X axis
+}
+
+// Gets the Global SDF texture UV for the cascade UV. Cascades use toroidal addressing (voxel location in the texture is wrapped around its world-space coordinates) so the cached chunks don't need to be redrawn when cascade moves.
+float3 GetGlobalSDFTextureUV(const GlobalSDFData data, uint cascade, float3 cascadeUV, float resolution)
+{
+    float4 cascadePosDistance = data.CascadePosDistance[cascade];
+    float texelExtent = 0.5f / resolution;
+    float3 wrappedUV = clamp(cascadeUV, texelExtent, 1.0f - texelExtent) + cascadePosDistance.xyz / (cascadePosDistance.w * 2) - 0.5f;
+    wrappedUV.x = clamp(frac(wrappedUV.x), texelExtent, 1.0f - texelExtent); // Y and Z are wrapped by sampler but cascades are placed next to each other on X axis
+    return float3(((float)cascade + wrappedUV.x) / (float)data.CascadesCount, wrappedUV.y, wrappedUV.z);
+}
+
+// Samples the Global SDF cascade texture at the given cascade UV (normalized distance).
+float SampleGlobalSDFTexture(const GlobalSDFData data, Texture3D<float> tex, uint cascade, float3 cascadeUV)
+{
+    return tex.SampleLevel(SamplerLinearWrap, GetGlobalSDFTextureUV(data, cascade, cascadeUV, data.Resolution), 0);
+}
+
+// Samples the Global SDF cascade mip texture at the given cascade UV (normalized distance).
+float SampleGlobalSDFMipTexture(const GlobalSDFData data, Texture3D<float> mip, uint cascade, float3 cascadeUV)
+{
+    return mip.SampleLevel(SamplerLinearWrap, GetGlobalSDFTextureUV(data, cascade, cascadeUV, data.Resolution / GLOBAL_SDF_RASTERIZE_MIP_FACTOR), 0);
+}
+
+// Samples the Global SDF cascade texture gradient at the given cascade UV (normalized distance).
+float3 SampleGlobalSDFTextureGradient(const GlobalSDFData data, Texture3D<float> tex, uint cascade, float3 cascadeUV)
+{
+    float texelOffset = 1.0f / data.Resolution;
+    float xp = SampleGlobalSDFTexture(data, tex, cascade, float3(cascadeUV.x + texelOffset, cascadeUV.y, cascadeUV.z));
+    float xn = SampleGlobalSDFTexture(data, tex, cascade, float3(cascadeUV.x - texelOffset, cascadeUV.y, cascadeUV.z));
+    float yp = SampleGlobalSDFTexture(data, tex, cascade, float3(cascadeUV.x, cascadeUV.y + texelOffset, cascadeUV.z));
+    float yn = SampleGlobalSDFTexture(data, tex, cascade, float3(cascadeUV.x, cascadeUV.y - texelOffset, cascadeUV.z));
+    float zp = SampleGlobalSDFTexture(data, tex, cascade, float3(cascadeUV.x, cascadeUV.y, cascadeUV.z + texelOffset));
+    float zn = SampleGlobalSDFTexture(data, tex, cascade, float3(cascadeUV.x, cascadeUV.y, cascadeUV.z - texelOffset));
+    return float3(xp - xn, yp - yn, zp - zn);
 }
 
 // Gets the Global SDF cascade index for the given world location.
@@ -74,8 +109,8 @@ uint GetGlobalSDFCascade(const GlobalSDFData data, float3 worldPosition)
     for (uint cascade = 0; cascade < data.CascadesCount; cascade++)
     {
         float cascadeMaxDistance;
-        float3 cascadeUV, textureUV;
-        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV, textureUV);
+        float3 cascadeUV;
+        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV);
         if (all(cascadeUV > 0) && all(cascadeUV < 1))
             return cascade;
     }
@@ -87,9 +122,9 @@ float SampleGlobalSDFCascade(const GlobalSDFData data, Texture3D<float> tex, flo
 {
     float distance = GLOBAL_SDF_WORLD_SIZE;
     float cascadeMaxDistance;
-    float3 cascadeUV, textureUV;
-    GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV, textureUV);
-    float cascadeDistance = tex.SampleLevel(SamplerLinearClamp, textureUV, 0);
+    float3 cascadeUV;
+    GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV);
+    float cascadeDistance = SampleGlobalSDFTexture(data, tex, cascade, cascadeUV);
     if (cascadeDistance < 1.0f && !any(cascadeUV < 0) && !any(cascadeUV > 1))
         distance = cascadeDistance * cascadeMaxDistance;
     return distance;
@@ -104,9 +139,9 @@ float SampleGlobalSDF(const GlobalSDFData data, Texture3D<float> tex, float3 wor
     for (uint cascade = 0; cascade < data.CascadesCount; cascade++)
     {
         float cascadeMaxDistance;
-        float3 cascadeUV, textureUV;
-        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV, textureUV);
-        float cascadeDistance = tex.SampleLevel(SamplerLinearClamp, textureUV, 0);
+        float3 cascadeUV;
+        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV);
+        float cascadeDistance = SampleGlobalSDFTexture(data, tex, cascade, cascadeUV);
         if (cascadeDistance < 0.9f && !any(cascadeUV < 0) && !any(cascadeUV > 1))
         {
             distance = cascadeDistance * cascadeMaxDistance;
@@ -127,12 +162,12 @@ float SampleGlobalSDF(const GlobalSDFData data, Texture3D<float> tex, Texture3D<
     for (uint cascade = 0; cascade < data.CascadesCount; cascade++)
     {
         float cascadeMaxDistance;
-        float3 cascadeUV, textureUV;
-        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV, textureUV);
-        float cascadeDistance = mip.SampleLevel(SamplerLinearClamp, textureUV, 0);
+        float3 cascadeUV;
+        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV);
+        float cascadeDistance = SampleGlobalSDFMipTexture(data, mip, cascade, cascadeUV);
         if (cascadeDistance < chunkSizeDistance && !any(cascadeUV < 0) && !any(cascadeUV > 1))
         {
-            float cascadeDistanceTex = tex.SampleLevel(SamplerLinearClamp, textureUV, 0);
+            float cascadeDistanceTex = SampleGlobalSDFTexture(data, tex, cascade, cascadeUV);
             if (cascadeDistanceTex < chunkMarginDistance * 2)
                 cascadeDistance = cascadeDistanceTex;
             distance = cascadeDistance * cascadeMaxDistance;
@@ -152,19 +187,12 @@ float3 SampleGlobalSDFGradient(const GlobalSDFData data, Texture3D<float> tex, f
     for (uint cascade = 0; cascade < data.CascadesCount; cascade++)
     {
         float cascadeMaxDistance;
-        float3 cascadeUV, textureUV;
-        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV, textureUV);
-        float cascadeDistance = tex.SampleLevel(SamplerLinearClamp, textureUV, 0);
+        float3 cascadeUV;
+        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV);
+        float cascadeDistance = SampleGlobalSDFTexture(data, tex, cascade, cascadeUV);
         if (cascadeDistance < 0.9f && !any(cascadeUV < 0) && !any(cascadeUV > 1))
         {
-            float texelOffset = 1.0f / data.Resolution;
-            float xp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x + texelOffset, textureUV.y, textureUV.z), 0).x;
-            float xn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x - texelOffset, textureUV.y, textureUV.z), 0).x;
-            float yp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y + texelOffset, textureUV.z), 0).x;
-            float yn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y - texelOffset, textureUV.z), 0).x;
-            float zp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y, textureUV.z + texelOffset), 0).x;
-            float zn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y, textureUV.z - texelOffset), 0).x;
-            gradient = float3(xp - xn, yp - yn, zp - zn) * cascadeMaxDistance;
+            gradient = SampleGlobalSDFTextureGradient(data, tex, cascade, cascadeUV) * cascadeMaxDistance;
             distance = cascadeDistance * cascadeMaxDistance;
             break;
         }
@@ -184,22 +212,15 @@ float3 SampleGlobalSDFGradient(const GlobalSDFData data, Texture3D<float> tex, T
     for (uint cascade = 0; cascade < data.CascadesCount; cascade++)
     {
         float cascadeMaxDistance;
-        float3 cascadeUV, textureUV;
-        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV, textureUV);
-        float cascadeDistance = mip.SampleLevel(SamplerLinearClamp, textureUV, 0);
+        float3 cascadeUV;
+        GetGlobalSDFCascadeUV(data, cascade, worldPosition, cascadeMaxDistance, cascadeUV);
+        float cascadeDistance = SampleGlobalSDFMipTexture(data, mip, cascade, cascadeUV);
         if (cascadeDistance < chunkSizeDistance && !any(cascadeUV < 0) && !any(cascadeUV > 1))
         {
-            float cascadeDistanceTex = tex.SampleLevel(SamplerLinearClamp, textureUV, 0);
+            float cascadeDistanceTex = SampleGlobalSDFTexture(data, tex, cascade, cascadeUV);
             if (cascadeDistanceTex < chunkMarginDistance * 2)
                 cascadeDistance = cascadeDistanceTex;
-            float texelOffset = 1.0f / data.Resolution;
-            float xp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x + texelOffset, textureUV.y, textureUV.z), 0).x;
-            float xn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x - texelOffset, textureUV.y, textureUV.z), 0).x;
-            float yp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y + texelOffset, textureUV.z), 0).x;
-            float yn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y - texelOffset, textureUV.z), 0).x;
-            float zp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y, textureUV.z + texelOffset), 0).x;
-            float zn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y, textureUV.z - texelOffset), 0).x;
-            gradient = float3(xp - xn, yp - yn, zp - zn) * cascadeMaxDistance;
+            gradient = SampleGlobalSDFTextureGradient(data, tex, cascade, cascadeUV) * cascadeMaxDistance;
             distance = cascadeDistance * cascadeMaxDistance;
             break;
         }
@@ -251,12 +272,12 @@ GlobalSDFHit RayTraceGlobalSDF(const GlobalSDFData data, Texture3D<float> tex, T
 
             // Sample SDF
             float cascadeMaxDistance;
-            float3 cascadeUV, textureUV;
-            GetGlobalSDFCascadeUV(data, cascade, stepPosition, cascadeMaxDistance, cascadeUV, textureUV);
-            float stepDistance = mip.SampleLevel(SamplerLinearClamp, textureUV, 0);
+            float3 cascadeUV;
+            GetGlobalSDFCascadeUV(data, cascade, stepPosition, cascadeMaxDistance, cascadeUV);
+            float stepDistance = SampleGlobalSDFMipTexture(data, mip, cascade, cascadeUV);
             if (stepDistance < chunkSizeDistance)
             {
-                float stepDistanceTex = tex.SampleLevel(SamplerLinearClamp, textureUV, 0);
+                float stepDistanceTex = SampleGlobalSDFTexture(data, tex, cascade, cascadeUV);
                 if (stepDistanceTex < chunkMarginDistance * 2)
                 {
                     stepDistance = stepDistanceTex;
@@ -280,14 +301,7 @@ GlobalSDFHit RayTraceGlobalSDF(const GlobalSDFData data, Texture3D<float> tex, T
                 if (trace.NeedsHitNormal)
                 {
                     // Calculate hit normal from SDF gradient
-                    float texelOffset = 1.0f / data.Resolution;
-                    float xp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x + texelOffset, textureUV.y, textureUV.z), 0).x;
-                    float xn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x - texelOffset, textureUV.y, textureUV.z), 0).x;
-                    float yp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y + texelOffset, textureUV.z), 0).x;
-                    float yn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y - texelOffset, textureUV.z), 0).x;
-                    float zp = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y, textureUV.z + texelOffset), 0).x;
-                    float zn = tex.SampleLevel(SamplerLinearClamp, float3(textureUV.x, textureUV.y, textureUV.z - texelOffset), 0).x;
-                    hit.HitNormal = normalize(float3(xp - xn, yp - yn, zp - zn));
+                    hit.HitNormal = normalize(SampleGlobalSDFTextureGradient(data, tex, cascade, cascadeUV));
                 }
                 break;
             }
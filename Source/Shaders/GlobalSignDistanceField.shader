@@ -46,8 +46,22 @@ uint GenerateMipTexResolution;
 uint GenerateMipCoordScale;
 uint GenerateMipTexOffsetX;
 uint GenerateMipMipOffsetX;
+int3 CascadeTexOffset;
+uint Padding10;
+int3 GenerateMipTexWrapOffset;
+uint Padding11;
+int3 GenerateMipMipWrapOffset;
+uint Padding12;
 META_CB_END
 
+// Gets the cascade voxel location in the Global SDF texture (toroidal addressing around cascade world-space position, cascades are placed next to each other on X axis)
+uint3 GetCascadeTexCoord(uint3 voxelCoord)
+{
+	voxelCoord = (voxelCoord + (uint3)CascadeTexOffset) % (uint)CascadeResolution;
+	voxelCoord.x += CascadeIndex * CascadeResolution;
+	return voxelCoord;
+}
+
 float CombineDistanceToSDF(float sdf, float distanceToSDF)
 {
 	// Simple sum (aprox)
@@ -117,7 +131,7 @@ void CS_RasterizeModel(uint3 DispatchThreadId : SV_DispatchThreadID)
 {
 	uint3 voxelCoord = ChunkCoord + DispatchThreadId;
 	float3 voxelWorldPos = voxelCoord * CascadeCoordToPosMul + CascadeCoordToPosAdd;
-	voxelCoord.x += CascadeIndex * CascadeResolution;
+	voxelCoord = GetCascadeTexCoord(voxelCoord);
 	float minDistance = MaxDistance;
 #if READ_SDF
 	minDistance *= GlobalSDFTex[voxelCoord];
@@ -144,7 +158,7 @@ void CS_RasterizeHeightfield(uint3 DispatchThreadId : SV_DispatchThreadID)
 {
 	uint3 voxelCoord = ChunkCoord + DispatchThreadId;
 	float3 voxelWorldPos = voxelCoord * CascadeCoordToPosMul + CascadeCoordToPosAdd;
-	voxelCoord.x += CascadeIndex * CascadeResolution;
+	voxelCoord = GetCascadeTexCoord(voxelCoord);
 	float minDistance = MaxDistance * GlobalSDFTex[voxelCoord];
 	float thickness = CascadeVoxelSize * -8;
 	for (uint i = 0; i < ObjectsCount; i++)
@@ -191,8 +205,7 @@ META_CS(true, FEATURE_LEVEL_SM5)
 [numthreads(GLOBAL_SDF_RASTERIZE_GROUP_SIZE, GLOBAL_SDF_RASTERIZE_GROUP_SIZE, GLOBAL_SDF_RASTERIZE_GROUP_SIZE)]
 void CS_ClearChunk(uint3 DispatchThreadId : SV_DispatchThreadID)
 {
-	uint3 voxelCoord = ChunkCoord + DispatchThreadId;
-	voxelCoord.x += CascadeIndex * CascadeResolution;
+	uint3 voxelCoord = GetCascadeTexCoord(ChunkCoord + DispatchThreadId);
 	GlobalSDFTex[voxelCoord] = 1.0f;
 }
 
@@ -207,6 +220,7 @@ float SampleSDF(uint3 voxelCoordMip, int3 offset)
 {
 	// Sample SDF
 	voxelCoordMip = (uint3)clamp((int3)(voxelCoordMip * GenerateMipCoordScale) + offset, int3(0, 0, 0), (int3)(GenerateMipTexResolution - 1));
+	voxelCoordMip = (voxelCoordMip + (uint3)GenerateMipTexWrapOffset) % GenerateMipTexResolution;
 	voxelCoordMip.x += GenerateMipTexOffsetX;
 	float result = GlobalSDFTex[voxelCoordMip].r;
 
@@ -234,6 +248,7 @@ void CS_GenerateMip(uint3 DispatchThreadId : SV_DispatchThreadID)
 	minDistance = min(minDistance, SampleSDF(voxelCoordMip, int3(0, -1, 0)));
 	minDistance = min(minDistance, SampleSDF(voxelCoordMip, int3(0, 0, -1)));
 
+	voxelCoordMip = (voxelCoordMip + (uint3)GenerateMipMipWrapOffset) % (uint)CascadeMipResolution;
 	voxelCoordMip.x += GenerateMipMipOffsetX;
 	GlobalSDFMip[voxelCoordMip] = minDistance;
 }
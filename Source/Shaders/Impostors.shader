@@ -0,0 +1,135 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/Octahedral.hlsl"
+
+// Instance data layout (must match InstanceData in C++)
+struct InstanceData
+{
+	float3 InstanceOrigin;
+	float PerInstanceRandom;
+	float3 InstanceTransform1;
+	float LODDitherFactor;
+	float3 InstanceTransform2;
+	float3 InstanceTransform3;
+	uint2 InstanceLightmapArea;
+};
+
+META_CB_BEGIN(0, Data)
+float4x4 ViewProjection;
+float3 ViewPosition;
+float FramesCount;
+float3 BoundsCenter;
+float BoundsRadius;
+float FrameHalfTexel;
+uint InstanceOffset;
+float2 Dummy0;
+META_CB_END
+
+StructuredBuffer<InstanceData> Instances : register(t0);
+Texture2D Atlas0 : register(t1);
+Texture2D Atlas1 : register(t2);
+Texture2D Atlas2 : register(t3);
+Texture2D Atlas3 : register(t4);
+Texture2D<float> AtlasDepth : register(t5);
+
+struct VS2PS
+{
+	float4 Position : SV_Position;
+	float3 WorldPosition : TEXCOORD0;
+	float2 FrameUV : TEXCOORD1;
+	nointerpolation float2 Frame : TEXCOORD2;
+	nointerpolation float3 DepthAxis : TEXCOORD3;
+	nointerpolation float3 Transform1 : TEXCOORD4;
+	nointerpolation float3 Transform2 : TEXCOORD5;
+	nointerpolation float3 Transform3 : TEXCOORD6;
+	nointerpolation float DitherFactor : TEXCOORD7;
+};
+
+// Calculates the baking view axes for the atlas frame (must match the C++)
+void GetFrameAxes(float2 frame, out float3 right, out float3 up, out float3 forward)
+{
+	float3 direction = GetHemiOctahedralDirection((frame + 0.5f) / FramesCount * 2.0f - 1.0f);
+	float3 worldUp = abs(direction.y) > 0.999f ? float3(0, 0, 1) : float3(0, 1, 0);
+	forward = -direction;
+	right = normalize(cross(worldUp, forward));
+	up = cross(forward, right);
+}
+
+// Vertex Shader that draws each instance as a quad (6 vertices per instance) facing the view with the closest baked frame
+META_VS(true, FEATURE_LEVEL_SM5)
+VS2PS VS(uint vertexID : SV_VertexID)
+{
+	InstanceData instance = Instances[InstanceOffset + vertexID / 6];
+	uint cornerIndex = vertexID % 6;
+	float2 corner = float2(cornerIndex == 1 || cornerIndex == 2 || cornerIndex == 4 ? 1 : -1, cornerIndex == 2 || cornerIndex == 4 || cornerIndex == 5 ? 1 : -1);
+
+	// Transform the view direction into the instance local-space (rows of the transform are scaled axes)
+	float3 t1 = instance.InstanceTransform1;
+	float3 t2 = instance.InstanceTransform2;
+	float3 t3 = instance.InstanceTransform3;
+	float3 center = instance.InstanceOrigin + BoundsCenter.x * t1 + BoundsCenter.y * t2 + BoundsCenter.z * t3;
+	float3 toView = ViewPosition - center;
+	float3 toViewLocal = normalize(float3(dot(toView, t1) / dot(t1, t1), dot(toView, t2) / dot(t2, t2), dot(toView, t3) / dot(t3, t3)));
+
+	// Pick the closest frame
+	float2 frame = clamp(floor((GetHemiOctahedralCoords(toViewLocal) * 0.5f + 0.5f) * FramesCount), 0, FramesCount - 1);
+	float3 right, up, forward;
+	GetFrameAxes(frame, right, up, forward);
+
+	// Build the quad in the local-space of the frame and transform it into the world-space
+	float3 localPosition = BoundsCenter + (corner.x * right + corner.y * up) * BoundsRadius;
+	float3 worldPosition = instance.InstanceOrigin + localPosition.x * t1 + localPosition.y * t2 + localPosition.z * t3;
+	float3 depthAxis = (forward.x * t1 + forward.y * t2 + forward.z * t3) * (BoundsRadius * 2.0f);
+
+	VS2PS output;
+	output.Position = mul(float4(worldPosition, 1), ViewProjection);
+	output.WorldPosition = worldPosition;
+	output.FrameUV = float2(corner.x * 0.5f + 0.5f, 0.5f - corner.y * 0.5f);
+	output.Frame = frame;
+	output.DepthAxis = depthAxis;
+	output.Transform1 = t1;
+	output.Transform2 = t2;
+	output.Transform3 = t3;
+	output.DitherFactor = instance.LODDitherFactor;
+	return output;
+}
+
+// Pixel Shader that writes the baked GBuffer of the frame (with the depth offset from the baked depth)
+META_PS(true, FEATURE_LEVEL_SM5)
+void PS(VS2PS input, out float4 Light : SV_Target0, out float4 RT0 : SV_Target1, out float4 RT1 : SV_Target2, out float4 RT2 : SV_Target3, out float4 RT3 : SV_Target4, out float Depth : SV_Depth)
+{
+	// Dithered transition from the model (the same pattern as materials LOD transition)
+	float ditherFactor = input.DitherFactor;
+	if (abs(ditherFactor) > 0.001)
+	{
+		float randGrid = cos(dot(floor(input.Position.xy), float2(347.83452793, 3343.28371863)));
+		float randGridFrac = frac(randGrid * 1000.0);
+		half mask = (ditherFactor < 0.0) ? (ditherFactor + 1.0 > randGridFrac) : (ditherFactor < randGridFrac);
+		clip(mask - 0.001);
+	}
+
+	// Sample the frame (texels are clamped to prevent bleeding from the neighbour frames)
+	float2 uv = (input.Frame + clamp(input.FrameUV, FrameHalfTexel, 1.0f - FrameHalfTexel)) / FramesCount;
+	float depth = AtlasDepth.SampleLevel(SamplerPointClamp, uv, 0);
+	clip(0.9999f - depth);
+	float4 gBuffer1 = Atlas1.SampleLevel(SamplerPointClamp, uv, 0);
+
+	// Move the pixel along the baking view direction to match the model surface
+	float3 worldPosition = input.WorldPosition + input.DepthAxis * (depth - 0.5f);
+	float4 clipPosition = mul(float4(worldPosition, 1), ViewProjection);
+	Depth = clipPosition.z / clipPosition.w;
+
+	// Transform the local-space normal into the world-space (inverse-transpose of the instance transform)
+	float3 normal = gBuffer1.xyz * 2.0f - 1.0f;
+	float3 t1 = input.Transform1;
+	float3 t2 = input.Transform2;
+	float3 t3 = input.Transform3;
+	normal = normalize(normal.x * t1 / dot(t1, t1) + normal.y * t2 / dot(t2, t2) + normal.z * t3 / dot(t3, t3));
+
+	Light = float4(0, 0, 0, 0);
+	RT0 = Atlas0.SampleLevel(SamplerPointClamp, uv, 0);
+	RT1 = float4(normal * 0.5f + 0.5f, gBuffer1.a);
+	RT2 = Atlas2.SampleLevel(SamplerPointClamp, uv, 0);
+	RT3 = Atlas3.SampleLevel(SamplerPointClamp, uv, 0);
+}
@@ -0,0 +1,185 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/OcclusionCulling.hlsl"
+
+// Those defines must match the C++
+#define THREAD_GROUP_SIZE 64
+
+// Instance data layout (must match InstanceData in C++)
+struct InstanceData
+{
+	float3 InstanceOrigin;
+	float PerInstanceRandom;
+	float3 InstanceTransform1;
+	float LODDitherFactor;
+	float3 InstanceTransform2;
+	float3 InstanceTransform3;
+	uint2 InstanceLightmapArea;
+};
+
+// Culled instances batch (must match InstanceCullingBatch in C++)
+struct InstanceCullingBatch
+{
+	float4 Bounds;
+	uint InstanceOffset;
+	uint InstanceCount;
+	uint ArgsOffset;
+	uint Padding;
+};
+
+// Culled range of the GPU-resident instances (must match InstanceCullingRange in C++)
+struct InstanceCullingRange
+{
+	uint InstanceOffset;
+	uint InstanceCount;
+};
+
+Texture2D<float> HiZ : register(t2);
+
+META_CB_BEGIN(0, Data)
+float4 FrustumPlanes[6];
+float4x4 HiZViewProjection;
+float2 HiZSize;
+float BoundsInflate;
+uint HasHiZ;
+float3 ViewPosition;
+float ScreenMultiple;
+float3 LODViewPosition;
+float ProjectionDistanceScale;
+float LODDistanceFactorSqrt;
+int LODBias;
+float2 Dummy0;
+META_CB_END
+
+META_CB_BEGIN(1, ResidentData)
+float4 Bounds;
+float3 OriginOffset;
+float CullDistance;
+float CullDistanceRandomRange;
+float MinScreenRadiusSq;
+uint LODsCount;
+uint MinLOD;
+float4 LODScreenRadiusSq[2];
+uint RangesOffset;
+uint OutputOffset;
+uint OutputCapacity;
+uint CountersOffset;
+META_CB_END
+
+void StoreInstance(RWByteAddressBuffer output, uint index, InstanceData instance)
+{
+	uint address = index * 64;
+	output.Store4(address, asuint(float4(instance.InstanceOrigin, instance.PerInstanceRandom)));
+	output.Store4(address + 16, asuint(float4(instance.InstanceTransform1, instance.LODDitherFactor)));
+	output.Store4(address + 32, uint4(asuint(instance.InstanceTransform2), asuint(instance.InstanceTransform3.x)));
+	output.Store4(address + 48, uint4(asuint(instance.InstanceTransform3.yz), instance.InstanceLightmapArea));
+}
+
+bool IsVisible(float3 center, float radius)
+{
+	// Frustum culling
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		if (dot(FrustumPlanes[i].xyz, center) + FrustumPlanes[i].w < -radius)
+			return false;
+	}
+
+	// Occlusion culling
+	return !(HasHiZ && IsOccluded(HiZ, HiZSize, HiZViewProjection, center, radius + BoundsInflate));
+}
+
+#ifdef _CS_CullInstances
+
+StructuredBuffer<InstanceData> Instances : register(t0);
+StructuredBuffer<InstanceCullingBatch> Batches : register(t1);
+
+RWByteAddressBuffer OutputInstances : register(u0);
+RWByteAddressBuffer OutputArgs : register(u1);
+
+// Culls instances against the view frustum and Hi-Z and compacts the visible ones into the indirect draw arguments
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_CullInstances(uint3 groupId : SV_GroupID, uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	InstanceCullingBatch batch = Batches[groupId.y];
+	uint index = dispatchThreadId.x;
+	if (index >= batch.InstanceCount)
+		return;
+	InstanceData instance = Instances[batch.InstanceOffset + index];
+
+	// Calculate instance bounds
+	float3 center = instance.InstanceOrigin + batch.Bounds.x * instance.InstanceTransform1 + batch.Bounds.y * instance.InstanceTransform2 + batch.Bounds.z * instance.InstanceTransform3;
+	float scale = sqrt(max(dot(instance.InstanceTransform1, instance.InstanceTransform1), max(dot(instance.InstanceTransform2, instance.InstanceTransform2), dot(instance.InstanceTransform3, instance.InstanceTransform3))));
+	float radius = batch.Bounds.w * scale;
+
+	// Frustum and occlusion culling
+	if (!IsVisible(center, radius))
+		return;
+
+	// Append visible instance (instance count is the second argument in the indirect draw args)
+	uint outputIndex;
+	OutputArgs.InterlockedAdd(batch.ArgsOffset + 4, 1, outputIndex);
+	StoreInstance(OutputInstances, batch.InstanceOffset + outputIndex, instance);
+}
+
+#endif
+
+#ifdef _CS_CullResidentInstances
+
+StructuredBuffer<InstanceData> Instances : register(t0);
+StructuredBuffer<InstanceCullingRange> Ranges : register(t1);
+
+RWByteAddressBuffer OutputInstances : register(u0);
+RWByteAddressBuffer OutputCounters : register(u1);
+
+// Culls the GPU-resident instances against the cull distance, view frustum and Hi-Z, selects the model LOD (matches RenderTools::ComputeModelLOD) and compacts the visible ones into the per-LOD regions
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_CullResidentInstances(uint3 groupId : SV_GroupID, uint groupIndex : SV_GroupIndex)
+{
+	InstanceCullingRange range = Ranges[RangesOffset + groupId.x];
+	if (groupIndex >= range.InstanceCount)
+		return;
+	InstanceData instance = Instances[range.InstanceOffset + groupIndex];
+	instance.InstanceOrigin += OriginOffset;
+
+	// Calculate instance bounds
+	float3 center = instance.InstanceOrigin + Bounds.x * instance.InstanceTransform1 + Bounds.y * instance.InstanceTransform2 + Bounds.z * instance.InstanceTransform3;
+	float scale = sqrt(max(dot(instance.InstanceTransform1, instance.InstanceTransform1), max(dot(instance.InstanceTransform2, instance.InstanceTransform2), dot(instance.InstanceTransform3, instance.InstanceTransform3))));
+	float radius = Bounds.w * scale;
+
+	// Distance culling
+	if (distance(ViewPosition, center) - radius >= CullDistance + CullDistanceRandomRange * instance.PerInstanceRandom)
+		return;
+
+	// Frustum and occlusion culling
+	if (!IsVisible(center, radius))
+		return;
+
+	// Select LOD (model may be culled)
+	float3 lodDelta = center - LODViewPosition;
+	float screenRadiusSq = (ScreenMultiple * radius) * (ScreenMultiple * radius) / max(1.0f, dot(lodDelta, lodDelta) * ProjectionDistanceScale) * LODDistanceFactorSqrt;
+	if (MinScreenRadiusSq > screenRadiusSq)
+		return;
+	int lod = 0;
+	for (int i = (int)LODsCount - 1; i > 0; i--)
+	{
+		if (LODScreenRadiusSq[i / 4][i % 4] >= screenRadiusSq)
+		{
+			lod = i;
+			break;
+		}
+	}
+	lod = clamp(lod + LODBias, (int)MinLOD, (int)LODsCount - 1);
+
+	// Append visible instance into the LOD region
+	uint localLOD = (uint)lod - MinLOD;
+	uint outputIndex;
+	OutputCounters.InterlockedAdd((CountersOffset + localLOD) * 4, 1, outputIndex);
+	instance.LODDitherFactor = 0;
+	StoreInstance(OutputInstances, OutputOffset + localLOD * OutputCapacity + outputIndex, instance);
+}
+
+#endif
@@ -0,0 +1,30 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#ifndef __LIGHT_CLUSTERS__
+#define __LIGHT_CLUSTERS__
+
+// Those defines must match the C++
+#define LIGHT_CLUSTERS_MAX_LIGHTS 32
+
+// Structure that contains information about the clustered lights grid
+struct LightClustersData
+{
+	uint3 GridSize;
+	uint LightsCount;
+	float2 UVToCluster;
+	float2 DepthScaleBias;
+	uint DeferredLightsCount;
+	float3 Dummy0;
+};
+
+// Gets the offset of the cluster lights list in the clusters buffer (first element is the lights count, followed by the lights indices sorted in ascending order)
+uint GetLightClusterOffset(LightClustersData data, float2 uv, float viewDepth)
+{
+	uint3 cluster;
+	cluster.xy = min((uint2)max(uv * data.UVToCluster, 0), data.GridSize.xy - 1);
+	cluster.z = (uint)clamp(log(max(viewDepth, 0.0001f)) * data.DepthScaleBias.x + data.DepthScaleBias.y, 0, data.GridSize.z - 1);
+	uint clusterIndex = cluster.x + (cluster.y + cluster.z * data.GridSize.y) * data.GridSize.x;
+	return clusterIndex * (LIGHT_CLUSTERS_MAX_LIGHTS + 1);
+}
+
+#endif
@@ -0,0 +1,69 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/LightingCommon.hlsl"
+#include "./Flax/LightClusters.hlsl"
+
+// Those defines must match the C++
+#define THREAD_GROUP_SIZE 64
+
+META_CB_BEGIN(0, Data)
+float4x4 ViewMatrix;
+float4x4 InvProjectionMatrix;
+LightClustersData LightClusters;
+META_CB_END
+
+#ifdef _CS_BuildClusters
+
+StructuredBuffer<LightData> Lights : register(t0);
+
+RWBuffer<uint> ClusterLights : register(u0);
+
+// Builds the lights list for each cluster of the view frustum grid (one thread per cluster)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_BuildClusters(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint3 gridSize = LightClusters.GridSize;
+	uint clusterIndex = dispatchThreadId.x;
+	if (clusterIndex >= gridSize.x * gridSize.y * gridSize.z)
+		return;
+	uint3 cluster = uint3(clusterIndex % gridSize.x, (clusterIndex / gridSize.x) % gridSize.y, clusterIndex / (gridSize.x * gridSize.y));
+
+	// Calculate the cluster bounds in view space (tile rays are clipped by the exponential depth slice)
+	float2 uvMin = (float2)cluster.xy / LightClusters.UVToCluster;
+	float2 uvMax = (float2)(cluster.xy + 1) / LightClusters.UVToCluster;
+	float depthMin = exp(((float)cluster.z - LightClusters.DepthScaleBias.y) / LightClusters.DepthScaleBias.x);
+	float depthMax = exp(((float)cluster.z + 1.0f - LightClusters.DepthScaleBias.y) / LightClusters.DepthScaleBias.x);
+	float3 boundsMin = 1e20f;
+	float3 boundsMax = -1e20f;
+	UNROLL
+	for (uint i = 0; i < 4; i++)
+	{
+		float2 uv = float2(i & 1 ? uvMax.x : uvMin.x, i & 2 ? uvMax.y : uvMin.y);
+		float4 position = mul(float4(uv * float2(2, -2) + float2(-1, 1), 1, 1), InvProjectionMatrix);
+		float3 ray = position.xyz / position.w;
+		ray /= ray.z;
+		boundsMin = min(boundsMin, min(ray * depthMin, ray * depthMax));
+		boundsMax = max(boundsMax, max(ray * depthMin, ray * depthMax));
+	}
+
+	// Find the lights that intersect with the cluster (lights are iterated in order so indices are sorted)
+	uint offset = clusterIndex * (LIGHT_CLUSTERS_MAX_LIGHTS + 1);
+	uint count = 0;
+	LOOP
+	for (uint lightIndex = 0; lightIndex < LightClusters.LightsCount && count < LIGHT_CLUSTERS_MAX_LIGHTS; lightIndex++)
+	{
+		LightData light = Lights[lightIndex];
+		float3 center = mul(float4(light.Position, 1), ViewMatrix).xyz;
+		float3 delta = center - clamp(center, boundsMin, boundsMax);
+		if (dot(delta, delta) <= light.Radius * light.Radius)
+		{
+			ClusterLights[offset + 1 + count] = lightIndex;
+			count++;
+		}
+	}
+	ClusterLights[offset] = count;
+}
+
+#endif
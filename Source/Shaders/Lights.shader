@@ -8,6 +8,7 @@
 #include "./Flax/IESProfile.hlsl"
 #include "./Flax/GBuffer.hlsl"
 #include "./Flax/Lighting.hlsl"
+#include "./Flax/LightClusters.hlsl"
 
 // Per light data
 META_CB_BEGIN(0, PerLight)
@@ -18,6 +19,7 @@ META_CB_END
 // Per frame data
 META_CB_BEGIN(1, PerFrame)
 GBufferData GBuffer;
+LightClustersData LightClusters;
 META_CB_END
 
 DECLARE_GBUFFERDATA_ACCESS(GBuffer)
@@ -154,6 +156,50 @@ void PS_Spot(Model_VS2PS input, out float4 output : SV_Target0)
 #endif
 }
 
+#ifdef _PS_Clustered
+
+// Clustered lights
+StructuredBuffer<LightData> ClusteredLights : register(t8);
+Buffer<uint> ClusterLights : register(t9);
+
+// Pixel shader for clustered point and spot lights rendering (lights without shadows and IES profile)
+META_PS(true, FEATURE_LEVEL_SM5)
+META_PERMUTATION_1(LIGHTING_NO_SPECULAR=0)
+META_PERMUTATION_1(LIGHTING_NO_SPECULAR=1)
+void PS_Clustered(Quad_VS2PS input, out float4 output : SV_Target0)
+{
+	output = 0;
+
+	// Sample GBuffer
+	GBufferData gBufferData = GetGBufferData();
+	GBufferSample gBuffer = SampleGBuffer(gBufferData, input.TexCoord);
+
+	// Check if cannot shadow pixel
+	BRANCH
+	if (gBuffer.ShadingModel == SHADING_MODEL_UNLIT)
+	{
+		discard;
+		return;
+	}
+
+	// Calculate lighting from the lights in the pixel cluster (indices are sorted so the shadowed lights that are rendered separately are at the end of the list)
+	uint clusterOffset = GetLightClusterOffset(LightClusters, input.TexCoord, gBuffer.ViewPos.z);
+	uint clusterLightsCount = ClusterLights[clusterOffset];
+	float4 shadowMask = 1;
+	LOOP
+	for (uint i = 0; i < clusterLightsCount; i++)
+	{
+		uint lightIndex = ClusterLights[clusterOffset + 1 + i];
+		if (lightIndex >= LightClusters.DeferredLightsCount)
+			break;
+		LightData light = ClusteredLights[lightIndex];
+		bool isSpotLight = light.SpotAngles.x > -2.0f;
+		output += GetLighting(gBufferData.ViewPos, light, gBuffer, shadowMask, true, isSpotLight);
+	}
+}
+
+#endif
+
 // Pixel shader for sky light rendering
 META_PS(true, FEATURE_LEVEL_ES2)
 float4 PS_Sky(Model_VS2PS input) : SV_Target0
@@ -158,6 +158,16 @@ struct ModelInput_Skinned
 #endif
 };
 
+struct ModelInput_PreSkinned
+{
+    float3 Position : POSITION;
+    float2 TexCoord : TEXCOORD0;
+    float4 Normal : NORMAL;
+    float4 Tangent : TANGENT;
+    float2 LightmapUV : TEXCOORD1;
+    float3 PrevPosition : POSITION1;
+};
+
 struct Model_VS2PS
 {
     float4 Position : SV_Position;
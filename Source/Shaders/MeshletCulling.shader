@@ -0,0 +1,106 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/OcclusionCulling.hlsl"
+
+// Those defines must match the C++
+#define THREAD_GROUP_SIZE 128
+
+// The output index of the culled meshlet
+#define INVALID_INDEX 0xffffffff
+
+// Meshlet data layout (must match MeshletData in C++)
+struct MeshletData
+{
+	float3 Center;
+	float Radius;
+	float3 ConeAxis;
+	float ConeCutoff;
+	uint FirstIndex;
+	uint TrianglesCount;
+};
+
+META_CB_BEGIN(0, Data)
+float4 FrustumPlanes[6];
+float4x4 HiZViewProjection;
+float4x4 World;
+float3 ViewPositionLocal;
+float WorldScale;
+float2 HiZSize;
+float BoundsInflate;
+uint HasHiZ;
+uint MeshletsCount;
+uint GroupsX;
+uint ArgsOffset;
+uint OutputOffset;
+uint CullBackfaces;
+float3 Dummy0;
+META_CB_END
+
+#ifdef _CS_CullMeshlets
+
+StructuredBuffer<MeshletData> Meshlets : register(t0);
+Buffer<uint> Indices : register(t1);
+Texture2D<float> HiZ : register(t2);
+
+RWBuffer<uint> OutputIndices : register(u0);
+RWByteAddressBuffer OutputArgs : register(u1);
+
+groupshared uint GroupOutputIndex;
+
+// Checks if the meshlet is visible (against the view frustum, backfaces and Hi-Z)
+bool IsMeshletVisible(MeshletData meshlet)
+{
+	// Backface culling (local-space normal cone test against the view position)
+	float3 toCenter = meshlet.Center - ViewPositionLocal;
+	if (CullBackfaces && dot(toCenter, meshlet.ConeAxis) >= meshlet.ConeCutoff * length(toCenter) + meshlet.Radius)
+		return false;
+
+	// Calculate meshlet bounds
+	float3 center = mul(float4(meshlet.Center, 1), World).xyz;
+	float radius = meshlet.Radius * WorldScale;
+
+	// Frustum culling
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		if (dot(FrustumPlanes[i].xyz, center) + FrustumPlanes[i].w < -radius)
+			return false;
+	}
+
+	// Occlusion culling
+	return !(HasHiZ && IsOccluded(HiZ, HiZSize, HiZViewProjection, center, radius + BoundsInflate));
+}
+
+// Culls the mesh meshlets (thread group per meshlet) and compacts the triangles of the visible ones into the output index buffer (indices count is the first argument in the indirect draw args)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_CullMeshlets(uint3 groupId : SV_GroupID, uint groupIndex : SV_GroupIndex)
+{
+	uint meshletIndex = groupId.y * GroupsX + groupId.x;
+	if (meshletIndex >= MeshletsCount)
+		return;
+	MeshletData meshlet = Meshlets[meshletIndex];
+
+	// Cull meshlet and allocate the output space
+	if (groupIndex == 0)
+	{
+		uint outputIndex = INVALID_INDEX;
+		if (IsMeshletVisible(meshlet))
+			OutputArgs.InterlockedAdd(ArgsOffset, meshlet.TrianglesCount * 3, outputIndex);
+		GroupOutputIndex = outputIndex;
+	}
+	GroupMemoryBarrierWithGroupSync();
+
+	// Copy visible triangles
+	uint outputIndex = GroupOutputIndex;
+	if (outputIndex == INVALID_INDEX || groupIndex >= meshlet.TrianglesCount)
+		return;
+	uint srcIndex = meshlet.FirstIndex + groupIndex * 3;
+	uint dstIndex = OutputOffset + outputIndex + groupIndex * 3;
+	OutputIndices[dstIndex] = Indices[srcIndex];
+	OutputIndices[dstIndex + 1] = Indices[srcIndex + 1];
+	OutputIndices[dstIndex + 2] = Indices[srcIndex + 2];
+}
+
+#endif
@@ -0,0 +1,202 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define THREAD_GROUP_SIZE 64
+#define THREAD_GROUP_SIZE_3D 4
+
+// Marks the voxel without the closest triangle found yet
+#define INVALID_TRIANGLE 0xffffffff
+
+META_CB_BEGIN(0, Data)
+int3 Resolution;
+uint TrianglesCount;
+float3 VoxelToPosMul;
+float MaxDistance;
+float3 VoxelToPosAdd;
+int JumpStep;
+uint TrianglesOffset;
+float3 Dummy0;
+META_CB_END
+
+// The mesh triangles (3 vertices per triangle, in model local-space)
+StructuredBuffer<float3> TriangleVertices : register(t0);
+
+uint GetVoxelIndex(int3 voxel)
+{
+	return voxel.x + (voxel.y + voxel.z * Resolution.y) * Resolution.x;
+}
+
+float3 GetVoxelPos(int3 voxel)
+{
+	return (float3)voxel * VoxelToPosMul + VoxelToPosAdd;
+}
+
+// Calculates the closest point on the triangle to the given point (Real-Time Collision Detection by Christer Ericson)
+float3 ClosestPointOnTriangle(float3 p, float3 a, float3 b, float3 c)
+{
+	float3 ab = b - a;
+	float3 ac = c - a;
+	float3 ap = p - a;
+	float d1 = dot(ab, ap);
+	float d2 = dot(ac, ap);
+	if (d1 <= 0.0f && d2 <= 0.0f)
+		return a;
+	float3 bp = p - b;
+	float d3 = dot(ab, bp);
+	float d4 = dot(ac, bp);
+	if (d3 >= 0.0f && d4 <= d3)
+		return b;
+	float vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+		return a + ab * (d1 / (d1 - d3));
+	float3 cp = p - c;
+	float d5 = dot(ab, cp);
+	float d6 = dot(ac, cp);
+	if (d6 >= 0.0f && d5 <= d6)
+		return c;
+	float vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+		return a + ac * (d2 / (d2 - d6));
+	float va = d3 * d6 - d5 * d4;
+	if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+		return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+	float denom = 1.0f / (va + vb + vc);
+	return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+float DistanceToTriangle(float3 p, uint triangleIndex)
+{
+	float3 a = TriangleVertices[triangleIndex * 3 + 0];
+	float3 b = TriangleVertices[triangleIndex * 3 + 1];
+	float3 c = TriangleVertices[triangleIndex * 3 + 2];
+	return length(p - ClosestPointOnTriangle(p, a, b, c));
+}
+
+#if defined(_CS_RasterizeDistance) || defined(_CS_RasterizeTriangle)
+
+RWStructuredBuffer<uint> VoxelDistance : register(u0);
+RWStructuredBuffer<uint> VoxelTriangle : register(u1);
+
+// Visits all voxels around the triangle (with 1 voxel margin) and calculates the exact distance to them
+#define LOOP_TRIANGLE_VOXELS(triangleIndex, body) \
+	float3 a = TriangleVertices[triangleIndex * 3 + 0]; \
+	float3 b = TriangleVertices[triangleIndex * 3 + 1]; \
+	float3 c = TriangleVertices[triangleIndex * 3 + 2]; \
+	float3 boundsMin = (min(a, min(b, c)) - VoxelToPosAdd) / VoxelToPosMul; \
+	float3 boundsMax = (max(a, max(b, c)) - VoxelToPosAdd) / VoxelToPosMul; \
+	int3 voxelMin = clamp((int3)floor(boundsMin) - 1, 0, Resolution - 1); \
+	int3 voxelMax = clamp((int3)ceil(boundsMax) + 1, 0, Resolution - 1); \
+	for (int z = voxelMin.z; z <= voxelMax.z; z++) \
+	for (int y = voxelMin.y; y <= voxelMax.y; y++) \
+	for (int x = voxelMin.x; x <= voxelMax.x; x++) \
+	{ \
+		int3 voxel = int3(x, y, z); \
+		float3 p = GetVoxelPos(voxel); \
+		uint distance = asuint(length(p - ClosestPointOnTriangle(p, a, b, c))); \
+		uint voxelIndex = GetVoxelIndex(voxel); \
+		body \
+	}
+
+// Rasterizes triangles (thread per triangle) into the voxels nearby to find the distance to the closest triangle (positive floats keep their order when compared as uints)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_RasterizeDistance(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint triangleIndex = TrianglesOffset + DispatchThreadId.x;
+	if (triangleIndex >= TrianglesCount)
+		return;
+	LOOP_TRIANGLE_VOXELS(triangleIndex,
+	{
+		InterlockedMin(VoxelDistance[voxelIndex], distance);
+	})
+}
+
+// Rasterizes triangles (thread per triangle) into the voxels nearby to write the index of the closest triangle (the one that matches the rasterized distance)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_RasterizeTriangle(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint triangleIndex = TrianglesOffset + DispatchThreadId.x;
+	if (triangleIndex >= TrianglesCount)
+		return;
+	LOOP_TRIANGLE_VOXELS(triangleIndex,
+	{
+		if (VoxelDistance[voxelIndex] == distance)
+			VoxelTriangle[voxelIndex] = triangleIndex;
+	})
+}
+
+#endif
+
+#ifdef _CS_JumpFlood
+
+StructuredBuffer<uint> InputTriangle : register(t1);
+RWStructuredBuffer<uint> OutputTriangle : register(u0);
+
+// Jump Flooding pass that propagates the closest triangle from the neighbor voxels (at the current jump step distance)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE_3D, THREAD_GROUP_SIZE_3D, THREAD_GROUP_SIZE_3D)]
+void CS_JumpFlood(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	int3 voxel = (int3)DispatchThreadId;
+	if (any(voxel >= Resolution))
+		return;
+	float3 p = GetVoxelPos(voxel);
+	uint bestTriangle = InputTriangle[GetVoxelIndex(voxel)];
+	float bestDistance = bestTriangle != INVALID_TRIANGLE ? DistanceToTriangle(p, bestTriangle) : 3.402823466e+38f;
+	for (int z = -1; z <= 1; z++)
+	for (int y = -1; y <= 1; y++)
+	for (int x = -1; x <= 1; x++)
+	{
+		int3 neighbor = voxel + int3(x, y, z) * JumpStep;
+		if (any(neighbor < 0) || any(neighbor >= Resolution))
+			continue;
+		uint triangleIndex = InputTriangle[GetVoxelIndex(neighbor)];
+		if (triangleIndex == INVALID_TRIANGLE || triangleIndex == bestTriangle)
+			continue;
+		float distance = DistanceToTriangle(p, triangleIndex);
+		if (distance < bestDistance)
+		{
+			bestDistance = distance;
+			bestTriangle = triangleIndex;
+		}
+	}
+	OutputTriangle[GetVoxelIndex(voxel)] = bestTriangle;
+}
+
+#endif
+
+#ifdef _CS_Resolve
+
+StructuredBuffer<uint> InputTriangle : register(t1);
+RWStructuredBuffer<float> OutputDistance : register(u0);
+
+// Resolves the signed distance to the closest triangle (voxel is inside the geometry if it's behind the closest triangle)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE_3D, THREAD_GROUP_SIZE_3D, THREAD_GROUP_SIZE_3D)]
+void CS_Resolve(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	int3 voxel = (int3)DispatchThreadId;
+	if (any(voxel >= Resolution))
+		return;
+	uint voxelIndex = GetVoxelIndex(voxel);
+	uint triangleIndex = InputTriangle[voxelIndex];
+	float distance = MaxDistance;
+	if (triangleIndex != INVALID_TRIANGLE)
+	{
+		float3 p = GetVoxelPos(voxel);
+		float3 a = TriangleVertices[triangleIndex * 3 + 0];
+		float3 b = TriangleVertices[triangleIndex * 3 + 1];
+		float3 c = TriangleVertices[triangleIndex * 3 + 2];
+		float3 closest = ClosestPointOnTriangle(p, a, b, c);
+		distance = min(length(p - closest), MaxDistance);
+		float3 normal = cross(b - a, c - a);
+		if (dot(p - closest, normal) < 0.0f)
+			distance = -distance;
+	}
+	OutputDistance[voxelIndex] = distance;
+}
+
+#endif
@@ -0,0 +1,50 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#ifndef __OCCLUSION_CULLING__
+#define __OCCLUSION_CULLING__
+
+// The maximum size (in texels) of the tested Hi-Z area (larger objects are not tested)
+#define HIZ_MAX_TEXELS 8
+
+// Checks if the bounding sphere is fully hidden behind the Hi-Z depth (each texel contains the farthest device depth of the area it covers)
+bool IsOccluded(Texture2D<float> hiZ, float2 hiZSize, float4x4 hiZViewProjection, float3 center, float radius)
+{
+	// Project the bounds box corners into the Hi-Z view
+	float2 minUV = 1;
+	float2 maxUV = 0;
+	float minDepth = 1;
+	UNROLL
+	for (uint i = 0; i < 8; i++)
+	{
+		float3 corner = center + float3(i & 1 ? radius : -radius, i & 2 ? radius : -radius, i & 4 ? radius : -radius);
+		float4 clip = mul(float4(corner, 1), hiZViewProjection);
+		if (clip.w <= 0.0001f)
+			return false; // Crosses the near plane
+		float3 ndc = clip.xyz / clip.w;
+		float2 uv = ndc.xy * float2(0.5f, -0.5f) + 0.5f;
+		minUV = min(minUV, uv);
+		maxUV = max(maxUV, uv);
+		minDepth = min(minDepth, ndc.z);
+	}
+	if (minDepth <= 0 || any(minUV < 0) || any(maxUV > 1))
+		return false; // Partially outside the Hi-Z view
+
+	// Large objects are not tested (only a few texels are sampled)
+	int2 minTexel = (int2)(minUV * hiZSize);
+	int2 maxTexel = min((int2)(maxUV * hiZSize), (int2)hiZSize - 1);
+	if (any(maxTexel - minTexel >= HIZ_MAX_TEXELS))
+		return false;
+
+	// Object is occluded if its nearest point is behind the farthest depth of the whole area
+	for (int y = minTexel.y; y <= maxTexel.y; y++)
+	{
+		for (int x = minTexel.x; x <= maxTexel.x; x++)
+		{
+			if (hiZ.Load(int3(x, y, 0)) >= minDepth)
+				return false;
+		}
+	}
+	return true;
+}
+
+#endif
@@ -44,4 +44,19 @@ float3 GetOctahedralDirection(float2 coords)
     return normalize(direction);
 }
 
+// Calculates hemi-octahedral coordinates (in range [-1; 1]) for direction vector from the upper hemisphere (around the Y axis, lower directions are clamped to the horizon)
+float2 GetHemiOctahedralCoords(float3 direction)
+{
+    direction.y = max(direction.y, 0.0f);
+    float2 uv = direction.xz * (1.0f / (abs(direction.x) + abs(direction.y) + abs(direction.z) + 0.0001f));
+    return float2(uv.x + uv.y, uv.x - uv.y);
+}
+
+// Gets the direction vector (from the upper hemisphere around the Y axis) from hemi-octahedral coordinates
+float3 GetHemiOctahedralDirection(float2 coords)
+{
+    float2 uv = float2(coords.x + coords.y, coords.x - coords.y) * 0.5f;
+    return normalize(float3(uv.x, 1.0f - abs(uv.x) - abs(uv.y), uv.y));
+}
+
 #endif
@@ -0,0 +1,237 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define THREAD_GROUP_SIZE 256
+#define SCAN_THREAD_GROUP_SIZE 1024
+#define RADIX_BITS 4
+#define RADIX_BINS 16
+
+struct Item
+{
+	float Key;
+	uint Value;
+};
+
+META_CB_BEGIN(0, Data)
+uint CounterOffset;
+uint Shift;
+uint Descending;
+uint Dummy0;
+META_CB_END
+
+// Buffer with counter of items to sort (accessed via uint load at CounterOffset address)
+ByteAddressBuffer CounterBuffer : register(t0);
+
+uint GetCount()
+{
+	return CounterBuffer.Load(CounterOffset);
+}
+
+uint GetGroupsCount(uint count)
+{
+	return (count + THREAD_GROUP_SIZE - 1) / THREAD_GROUP_SIZE;
+}
+
+// Converts the float key into the unsigned integer that preserves the sorting order (flips the sign bit for positive values and all bits for negative values)
+uint GetSortKey(float key)
+{
+	uint result = asuint(key);
+	result ^= (result & 0x80000000) ? 0xffffffff : 0x80000000;
+	return Descending ? ~result : result;
+}
+
+uint GetDigit(Item item)
+{
+	return (GetSortKey(item.Key) >> Shift) & (RADIX_BINS - 1);
+}
+
+#ifdef _CS_IndirectArgs
+
+RWByteAddressBuffer IndirectArgsBuffer : register(u0);
+
+// Generates the dispatch arguments for the sorting passes (thread group per block of items)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(1, 1, 1)]
+void CS_IndirectArgs()
+{
+	IndirectArgsBuffer.Store3(0, uint3(GetGroupsCount(GetCount()), 1, 1));
+}
+
+#endif
+
+#ifdef _CS_Count
+
+StructuredBuffer<Item> SortBuffer : register(t1);
+RWStructuredBuffer<uint> SumTable : register(u0);
+
+groupshared uint Histogram[RADIX_BINS];
+
+// Counts the digits of the items in the block (histograms are stored digit-major to be scanned into the global offsets)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_Count(uint3 groupID : SV_GroupID, uint groupIndex : SV_GroupIndex)
+{
+	if (groupIndex < RADIX_BINS)
+		Histogram[groupIndex] = 0;
+	GroupMemoryBarrierWithGroupSync();
+
+	const uint count = GetCount();
+	const uint index = groupID.x * THREAD_GROUP_SIZE + groupIndex;
+	if (index < count)
+		InterlockedAdd(Histogram[GetDigit(SortBuffer[index])], 1);
+	GroupMemoryBarrierWithGroupSync();
+
+	if (groupIndex < RADIX_BINS)
+		SumTable[groupIndex * GetGroupsCount(count) + groupID.x] = Histogram[groupIndex];
+}
+
+#endif
+
+#ifdef _CS_Scan
+
+RWStructuredBuffer<uint> SumTable : register(u0);
+
+groupshared uint ScanData[SCAN_THREAD_GROUP_SIZE];
+
+// Converts the blocks histograms into the exclusive prefix sum (global output offset of each digit in each block)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(SCAN_THREAD_GROUP_SIZE, 1, 1)]
+void CS_Scan(uint groupIndex : SV_GroupIndex)
+{
+	const uint size = GetGroupsCount(GetCount()) * RADIX_BINS;
+	uint sum = 0;
+	for (uint start = 0; start < size; start += SCAN_THREAD_GROUP_SIZE)
+	{
+		const uint index = start + groupIndex;
+		const uint value = index < size ? SumTable[index] : 0;
+		ScanData[groupIndex] = value;
+		GroupMemoryBarrierWithGroupSync();
+
+		// Inclusive scan within the chunk
+		UNROLL
+		for (uint offset = 1; offset < SCAN_THREAD_GROUP_SIZE; offset <<= 1)
+		{
+			const uint prev = groupIndex >= offset ? ScanData[groupIndex - offset] : 0;
+			GroupMemoryBarrierWithGroupSync();
+			ScanData[groupIndex] += prev;
+			GroupMemoryBarrierWithGroupSync();
+		}
+
+		if (index < size)
+			SumTable[index] = sum + ScanData[groupIndex] - value;
+		sum += ScanData[SCAN_THREAD_GROUP_SIZE - 1];
+		GroupMemoryBarrierWithGroupSync();
+	}
+}
+
+#endif
+
+#ifdef _CS_Scatter
+
+StructuredBuffer<Item> SortBuffer : register(t1);
+StructuredBuffer<uint> SumTable : register(t2);
+RWStructuredBuffer<Item> OutputBuffer : register(u0);
+
+groupshared uint ScanData[THREAD_GROUP_SIZE];
+groupshared Item LocalItems[THREAD_GROUP_SIZE];
+groupshared uint LocalDigits[THREAD_GROUP_SIZE];
+groupshared uint DigitStart[RADIX_BINS];
+
+// Returns the exclusive prefix sum of the value within the thread group (and the total sum of all values)
+uint GroupScan(uint value, uint groupIndex, out uint total)
+{
+	ScanData[groupIndex] = value;
+	GroupMemoryBarrierWithGroupSync();
+	UNROLL
+	for (uint offset = 1; offset < THREAD_GROUP_SIZE; offset <<= 1)
+	{
+		const uint prev = groupIndex >= offset ? ScanData[groupIndex - offset] : 0;
+		GroupMemoryBarrierWithGroupSync();
+		ScanData[groupIndex] += prev;
+		GroupMemoryBarrierWithGroupSync();
+	}
+	total = ScanData[THREAD_GROUP_SIZE - 1];
+	const uint result = ScanData[groupIndex] - value;
+	GroupMemoryBarrierWithGroupSync();
+	return result;
+}
+
+// Sorts the block of items by the digit (stable, with 1-bit splits in the group shared memory) and writes them into the global offsets
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_Scatter(uint3 groupID : SV_GroupID, uint groupIndex : SV_GroupIndex)
+{
+	const uint count = GetCount();
+	const uint groupsCount = GetGroupsCount(count);
+	const uint index = groupID.x * THREAD_GROUP_SIZE + groupIndex;
+
+	// Unused elements use the last digit and stay at the end of the block (the split is stable)
+	Item item;
+	uint digit = RADIX_BINS - 1;
+	bool valid = index < count;
+	if (valid)
+	{
+		item = SortBuffer[index];
+		digit = GetDigit(item);
+	}
+	else
+	{
+		item.Key = 0;
+		item.Value = 0;
+	}
+	if (groupIndex < RADIX_BINS)
+		DigitStart[groupIndex] = 0;
+
+	// Local sort
+	uint localIndex = groupIndex;
+	UNROLL
+	for (uint bit = 0; bit < RADIX_BITS; bit++)
+	{
+		const uint flag = (digit >> bit) & 1;
+		uint zerosCount;
+		const uint zerosBefore = GroupScan(1 - flag, groupIndex, zerosCount);
+		localIndex = flag ? zerosCount + groupIndex - zerosBefore : zerosBefore;
+		LocalItems[localIndex] = item;
+		LocalDigits[localIndex] = digit | (valid ? 0 : 0x80000000);
+		GroupMemoryBarrierWithGroupSync();
+		item = LocalItems[groupIndex];
+		digit = LocalDigits[groupIndex];
+		valid = (digit & 0x80000000) == 0;
+		digit &= RADIX_BINS - 1;
+		GroupMemoryBarrierWithGroupSync();
+	}
+
+	// Find the start of each digit range in the sorted block
+	LocalDigits[groupIndex] = digit;
+	GroupMemoryBarrierWithGroupSync();
+	if (groupIndex == 0 || LocalDigits[groupIndex - 1] != digit)
+		DigitStart[digit] = groupIndex;
+	GroupMemoryBarrierWithGroupSync();
+
+	if (valid)
+	{
+		const uint rank = groupIndex - DigitStart[digit];
+		OutputBuffer[SumTable[digit * groupsCount + groupID.x] + rank] = item;
+	}
+}
+
+#endif
+
+#ifdef _CS_CopyIndices
+
+StructuredBuffer<Item> SortBuffer : register(t1);
+RWBuffer<uint> SortedIndices : register(u0);
+
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_CopyIndices(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	const uint index = dispatchThreadId.x;
+	if (index >= GetCount())
+		return;
+	SortedIndices[index] = SortBuffer[index].Value;
+}
+
+#endif
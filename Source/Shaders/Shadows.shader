@@ -152,6 +152,145 @@ float4 PS_DirLight(Quad_VS2PS input) : SV_Target0
 
 #endif
 
+#ifdef _PS_DirLightVirtual
+
+// Those defines must match the C++
+#define VIRTUAL_SHADOW_MAP_PAGES 64
+
+Texture2DArray ShadowMapPages : register(t5);
+Buffer<uint> ShadowPageTable : register(t6);
+
+// Finds the resident virtual shadow map page that contains the given position (starts from the given cascade and falls back to the coarser ones)
+bool GetVirtualShadowPage(LightShadowData shadow, float3 worldPosition, inout uint cascadeIndex, out float3 pagePosition, out uint pageSlice)
+{
+	pagePosition = 0;
+	pageSlice = 0;
+	for (; cascadeIndex < shadow.NumCascades; cascadeIndex++)
+	{
+		// Project into shadow space
+		float4 shadowPosition = mul(float4(worldPosition, 1.0f), shadow.ShadowVP[cascadeIndex]);
+		shadowPosition.xy /= shadowPosition.w;
+		if (any(shadowPosition.xy < 0) || any(shadowPosition.xy >= 1))
+			continue;
+
+		// Lookup the page table (zero is used for the pages that are not resident)
+		float2 pageCoord = shadowPosition.xy * VIRTUAL_SHADOW_MAP_PAGES;
+		uint2 page = (uint2)pageCoord;
+		uint pageEntry = ShadowPageTable[(cascadeIndex * VIRTUAL_SHADOW_MAP_PAGES + page.y) * VIRTUAL_SHADOW_MAP_PAGES + page.x];
+		BRANCH
+		if (pageEntry != 0)
+		{
+			pagePosition = float3(frac(pageCoord), shadowPosition.z - shadow.Bias);
+			pageSlice = pageEntry - 1;
+			return true;
+		}
+	}
+	return false;
+}
+
+// Samples the shadow for the given directional light (virtual shadow map sampling) for the material surface (supports subsurface shadowing)
+float SampleVirtualShadow(LightData light, LightShadowData shadow, GBufferSample gBuffer, out float subsurfaceShadow)
+{
+	subsurfaceShadow = 1;
+
+	// Create a blend factor which is one before and at the fade plane
+	float viewDepth = gBuffer.ViewPos.z;
+	float fade = saturate((viewDepth - shadow.CascadeSplits[shadow.NumCascades - 1] + shadow.FadeDistance) / shadow.FadeDistance);
+	BRANCH
+	if (fade >= 1.0)
+	{
+		return 1;
+	}
+
+	// Figure out which cascade to sample from
+	uint cascadeIndex = 0;
+	for (uint i = 0; i < shadow.NumCascades - 1; i++)
+	{
+		if (viewDepth > shadow.CascadeSplits[i])
+			cascadeIndex = i + 1;
+	}
+	float3 pagePosition;
+	uint pageSlice;
+
+	// Subsurface shadowing
+	BRANCH
+	if (IsSubsurfaceMode(gBuffer.ShadingModel))
+	{
+		uint subsurfaceCascadeIndex = cascadeIndex;
+		if (GetVirtualShadowPage(shadow, gBuffer.WorldPos, subsurfaceCascadeIndex, pagePosition, pageSlice))
+		{
+			// Sample shadow map (single hardware sample with hardware filtering)
+			float opacity = gBuffer.CustomData.a;
+			float shadowMapDepth = ShadowMapPages.SampleLevel(SamplerLinearClamp, float3(pagePosition.xy, pageSlice), 0).r;
+			subsurfaceShadow = CalculateSubsurfaceOcclusion(opacity, pagePosition.z, shadowMapDepth);
+
+			// Apply shadow fade
+			subsurfaceShadow = lerp(1.0f, subsurfaceShadow, (1 - fade) * shadow.Fade);
+		}
+	}
+
+	// Skip if surface is in a full shadow
+	float NoL = dot(gBuffer.Normal, light.Direction);
+	BRANCH
+	if (NoL <= 0)
+	{
+		return 0;
+	}
+
+	// Apply normal offset bias
+	float3 samplePosWS = gBuffer.WorldPos + GetShadowPositionOffset(shadow.NormalOffsetScale, NoL, gBuffer.Normal);
+
+	// Sample shadow (pages are stored in the separate slices of the pages pool)
+	BRANCH
+	if (!GetVirtualShadowPage(shadow, samplePosWS, cascadeIndex, pagePosition, pageSlice))
+	{
+		return 1;
+	}
+	float result = SampleShadowCascade(ShadowMapPages, shadow.ShadowMapSize, pagePosition.z, pagePosition.xy, pageSlice);
+
+	// Increase the sharpness for higher cascades to match the filter radius
+	const float SharpnessScale[MaxNumCascades] = { 1.0f, 1.5f, 3.0f, 3.5f };
+	float sharpness = shadow.Sharpness * SharpnessScale[cascadeIndex];
+
+	// Apply shadow fade and sharpness
+	result = saturate((result - 0.5) * sharpness + 0.5);
+	result = lerp(1.0f, result, (1 - fade) * shadow.Fade);
+	return result;
+}
+
+// Pixel shader for directional light shadow rendering with virtual shadow map
+META_PS(true, FEATURE_LEVEL_SM5)
+META_PERMUTATION_2(SHADOWS_QUALITY=0,CONTACT_SHADOWS=0)
+META_PERMUTATION_2(SHADOWS_QUALITY=1,CONTACT_SHADOWS=0)
+META_PERMUTATION_2(SHADOWS_QUALITY=2,CONTACT_SHADOWS=0)
+META_PERMUTATION_2(SHADOWS_QUALITY=3,CONTACT_SHADOWS=0)
+META_PERMUTATION_2(SHADOWS_QUALITY=0,CONTACT_SHADOWS=1)
+META_PERMUTATION_2(SHADOWS_QUALITY=1,CONTACT_SHADOWS=1)
+META_PERMUTATION_2(SHADOWS_QUALITY=2,CONTACT_SHADOWS=1)
+META_PERMUTATION_2(SHADOWS_QUALITY=3,CONTACT_SHADOWS=1)
+float4 PS_DirLightVirtual(Quad_VS2PS input) : SV_Target0
+{
+	float shadow = 1;
+	float subsurfaceShadow = 1;
+
+	// Sample GBuffer
+	GBufferData gBufferData = GetGBufferData();
+	GBufferSample gBuffer = SampleGBuffer(gBufferData, input.TexCoord);
+
+	// Sample shadow
+	LightShadowData lightShadowData = GetLightShadowData();
+	shadow = SampleVirtualShadow(Light, lightShadowData, gBuffer, subsurfaceShadow);
+
+#if CONTACT_SHADOWS
+	// Calculate screen-space contact shadow
+	shadow *= RayCastScreenSpaceShadow(gBufferData, gBuffer, gBuffer.WorldPos, Light.Direction, ContactShadowsLength);
+#endif
+
+	return float4(shadow, subsurfaceShadow, 1, 1);
+}
+
+#endif
+
 #ifdef _PS_SpotLight
 
 Texture2D ShadowMapSpot : register(t5);
@@ -9,6 +9,10 @@ float Sharpness;
 float StationaryBlending;
 float MotionBlending;
 float Dummy0;
+float2 InputSize;
+float2 InputSizeInv;
+float2 JitterUV;
+float2 Dummy1;
 META_CB_END
 
 Texture2D Input : register(t0);
@@ -84,3 +88,72 @@ float4 PS(Quad_VS2PS input) : SV_Target0
 
 	return color;
 }
+
+// Pixel Shader for Temporal Upscaling (Temporal Anti-Aliasing that reconstructs the output resolution image from the jittered lower resolution frames)
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_Upscale(Quad_VS2PS input) : SV_Target0
+{
+	// Gather the input pixels nearby the output pixel (weighted by the distance to the jittered sample location) and find the closest pixel in 3x3 neighborhood
+	float2 inputPos = input.TexCoord * InputSize;
+	float2 inputPixel = floor(inputPos - JitterUV * InputSize) + 0.5f;
+	float bestDepth = 1;
+	float2 bestUV = float2(0, 0);
+	float4 neighborhoodMin = 100000;
+	float4 neighborhoodMax = -10000;
+	float4 current = 0;
+	float currentWeight = 0;
+	float maxWeight = 0;
+	float4 neighborhoodSum = 0;
+	for (int x = -1; x <= 1; ++x)
+	{
+		for (int y = -1; y <= 1; ++y)
+		{
+			float2 sampleUV = (inputPixel + float2(x, y)) * InputSizeInv;
+
+			float4 neighbor = SAMPLE_RT(Input, sampleUV);
+			neighborhoodMin = min(neighborhoodMin, neighbor);
+			neighborhoodMax = max(neighborhoodMax, neighbor);
+			neighborhoodSum += neighbor;
+
+			// Gaussian fit of the Blackman-Harris (distance is measured in the input pixels)
+			float2 sampleOffset = (sampleUV + JitterUV) * InputSize - inputPos;
+			float weight = exp(-2.29f * dot(sampleOffset, sampleOffset));
+			current += neighbor * weight;
+			currentWeight += weight;
+			maxWeight = max(maxWeight, weight);
+
+			float depth = SAMPLE_RT(Depth, sampleUV).r;
+			if (depth < bestDepth)
+			{
+				bestDepth = depth;
+				bestUV = sampleUV;
+			}
+		}
+	}
+	current /= max(currentWeight, 0.0001f);
+	float2 velocity = SAMPLE_RT_LINEAR(MotionVectors, bestUV).xy;
+	float velocityLength = length(velocity);
+	float2 prevUV = input.TexCoord - velocity;
+
+	// Apply sharpening
+	float4 neighborhoodAvg = neighborhoodSum / 9.0;
+	current += (current - neighborhoodAvg) * Sharpness;
+
+	// Sample history by clamp it to the nearby colors range to reduce artifacts
+	float4 history = SAMPLE_RT_LINEAR(InputHistory, prevUV);
+	float lumaOffset = abs(Luminance(neighborhoodAvg.rgb) - Luminance(current.rgb));
+	float aabbMargin = lerp(4.0, 0.25, saturate(velocityLength * 100.0)) * lumaOffset;
+	history = ClipToAABB(history, neighborhoodMin - aabbMargin, neighborhoodMax + aabbMargin);
+
+	// Calculate history blending factor (output pixels far from the current frame samples rely more on the history)
+	float motion = saturate(velocityLength * 1000.0f);
+	float blendfactor = any(abs(prevUV * 2 - 1) >= 1.0f) ? 0.0f : lerp(StationaryBlending, MotionBlending, motion);
+	if (blendfactor > 0.0f)
+		blendfactor = 1.0f - (1.0f - blendfactor) * saturate(maxWeight * 1.5f);
+
+	// Perform linear accumulation of the previous samples with a current one
+	float4 color = lerp(current, history, blendfactor);
+	color = clamp(color, 0, HDR_CLAMP_MAX);
+
+	return color;
+}
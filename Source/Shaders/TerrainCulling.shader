@@ -0,0 +1,116 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/OcclusionCulling.hlsl"
+
+// Those defines must match the C++
+#define THREAD_GROUP_SIZE 64
+#define CHUNKS_PER_LOD 16
+
+// Terrain chunk data layout (must match TerrainChunksDraw::Chunk in C++)
+struct TerrainChunk
+{
+	float3 BoundsMin;
+	uint ArgsOffset;
+	float3 BoundsMax;
+	uint OutputOffset;
+	int4 Neighbors;
+	float4 LightmapArea;
+	float2 ChunkCoord;
+	uint MinLOD;
+	uint MaxLOD;
+};
+
+// Culled terrain chunk instance (must match TerrainChunkInstance in C++ and the terrain material template)
+struct TerrainChunkInstance
+{
+	float4 NeighborLOD;
+	float4 LightmapArea;
+	float2 ChunkCoord;
+	float2 Padding;
+};
+
+META_CB_BEGIN(0, Data)
+float4 FrustumPlanes[6];
+float4x4 HiZViewProjection;
+float2 HiZSize;
+float BoundsInflate;
+uint HasHiZ;
+float3 LODViewPosition;
+float InvChunkEdgeSize;
+float LODDistribution;
+int LODBias;
+uint ChunksOffset;
+uint ChunksCount;
+META_CB_END
+
+StructuredBuffer<TerrainChunk> Chunks : register(t0);
+Texture2D<float> HiZ : register(t1);
+
+RWStructuredBuffer<TerrainChunkInstance> OutputChunks : register(u0);
+RWByteAddressBuffer OutputArgs : register(u1);
+
+// Calculates the chunk LOD (matches TerrainChunk::PrepareDraw)
+uint CalcLOD(TerrainChunk chunk)
+{
+	float distance = length((chunk.BoundsMin + chunk.BoundsMax) * 0.5f - LODViewPosition);
+	int lod = (int)pow(distance * InvChunkEdgeSize, LODDistribution) + LODBias;
+	return (uint)clamp(lod, (int)chunk.MinLOD, (int)chunk.MaxLOD);
+}
+
+bool IsVisible(float3 boundsMin, float3 boundsMax)
+{
+	// Frustum culling
+	float3 center = (boundsMin + boundsMax) * 0.5f;
+	float3 extent = (boundsMax - boundsMin) * 0.5f;
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		float4 plane = FrustumPlanes[i];
+		if (dot(plane.xyz, center) + plane.w < -dot(abs(plane.xyz), extent))
+			return false;
+	}
+
+	// Occlusion culling
+	return !(HasHiZ && IsOccluded(HiZ, HiZSize, HiZViewProjection, center, length(extent) + BoundsInflate));
+}
+
+#ifdef _CS_CullChunks
+
+// Selects the terrain chunks LOD, culls them against the view frustum and Hi-Z and compacts the visible ones into the indirect draw arguments of the patch LOD
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, 1, 1)]
+void CS_CullChunks(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= ChunksCount)
+		return;
+	TerrainChunk chunk = Chunks[ChunksOffset + index];
+
+	// Frustum and occlusion culling
+	if (!IsVisible(chunk.BoundsMin, chunk.BoundsMax))
+		return;
+
+	// Calculate LOD of the chunk and its neighbors (neighbor LOD is clamped to the next LOD for the morph transition on edges)
+	uint lod = CalcLOD(chunk);
+	float4 neighborLOD;
+	UNROLL
+	for (uint i = 0; i < 4; i++)
+	{
+		uint neighborChunkLOD = CalcLOD(Chunks[ChunksOffset + chunk.Neighbors[i]]);
+		neighborLOD[i] = (float)clamp(neighborChunkLOD, lod, lod + 1);
+	}
+
+	// Append chunk to the patch LOD draw
+	uint lodIndex = lod - chunk.MinLOD;
+	uint slot;
+	OutputArgs.InterlockedAdd((chunk.ArgsOffset + lodIndex) * 20 + 4, 1, slot);
+	TerrainChunkInstance instance;
+	instance.NeighborLOD = neighborLOD;
+	instance.LightmapArea = chunk.LightmapArea;
+	instance.ChunkCoord = chunk.ChunkCoord;
+	instance.Padding = float2(0, 0);
+	OutputChunks[chunk.OutputOffset + lodIndex * CHUNKS_PER_LOD + slot] = instance;
+}
+
+#endif
@@ -0,0 +1,99 @@
+// Copyright (c) 2012-2023 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define THREAD_GROUP_SIZE 8
+
+META_CB_BEGIN(0, Data)
+float2 ScreenSize;
+uint TileSize;
+uint TileLoopCount;
+float ContrastThreshold;
+float VelocityThreshold;
+float2 Dummy0;
+META_CB_END
+
+#ifdef _CS_Generate
+
+Texture2D Input : register(t0);
+Texture2D MotionVectors : register(t1);
+
+RWTexture2D<uint> ShadingRateImage : register(u0);
+
+groupshared uint GroupGradientX;
+groupshared uint GroupGradientY;
+groupshared uint GroupVelocity;
+
+// Gets the perceptual luminance of the HDR scene color (compressed into 0-1 range)
+float GetPerceptualLuminance(uint2 pixel)
+{
+	float luminance = Luminance(Input[min(pixel, (uint2)ScreenSize - 1)].rgb);
+	return luminance / (1.0f + luminance);
+}
+
+// Encodes the shading rate from the log2 of the pixels block size (clamped to the valid rates, 1x4 and 4x1 are not supported)
+uint EncodeShadingRate(uint2 rateLog2)
+{
+	rateLog2 = min(rateLog2, 2);
+	if (rateLog2.x == 2 && rateLog2.y == 0)
+		rateLog2.y = 1;
+	else if (rateLog2.y == 2 && rateLog2.x == 0)
+		rateLog2.x = 1;
+	return (rateLog2.x << 2) | rateLog2.y;
+}
+
+// Generates the shading rate image from the scene luminance contrast and motion vectors (one thread group per shading rate tile)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREAD_GROUP_SIZE, THREAD_GROUP_SIZE, 1)]
+void CS_Generate(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID, uint groupIndex : SV_GroupIndex)
+{
+	if (groupIndex == 0)
+	{
+		GroupGradientX = 0;
+		GroupGradientY = 0;
+		GroupVelocity = 0;
+	}
+	GroupMemoryBarrierWithGroupSync();
+
+	// Accumulate the luminance gradients and the max velocity of the pixels covered by the thread
+	uint2 tileStart = groupId.xy * TileSize + groupThreadId.xy * TileLoopCount;
+	float gradientX = 0;
+	float gradientY = 0;
+	float velocity = 0;
+	LOOP
+	for (uint y = 0; y < TileLoopCount; y++)
+	{
+		LOOP
+		for (uint x = 0; x < TileLoopCount; x++)
+		{
+			uint2 pixel = tileStart + uint2(x, y);
+			float luminance = GetPerceptualLuminance(pixel);
+			gradientX += abs(GetPerceptualLuminance(pixel + uint2(1, 0)) - luminance);
+			gradientY += abs(GetPerceptualLuminance(pixel + uint2(0, 1)) - luminance);
+			float2 motion = SAMPLE_RT(MotionVectors, ((float2)pixel + 0.5f) / ScreenSize).xy * ScreenSize;
+			velocity = max(velocity, length(motion));
+		}
+	}
+	float samplesScale = 1.0f / (float)(TileLoopCount * TileLoopCount * THREAD_GROUP_SIZE * THREAD_GROUP_SIZE);
+	InterlockedAdd(GroupGradientX, (uint)(gradientX * samplesScale * 65536.0f));
+	InterlockedAdd(GroupGradientY, (uint)(gradientY * samplesScale * 65536.0f));
+	InterlockedMax(GroupVelocity, asuint(velocity));
+	GroupMemoryBarrierWithGroupSync();
+
+	if (groupIndex == 0)
+	{
+		// Reduce the shading rate along the axis with low contrast (half and quarter of the threshold)
+		float2 gradient = float2(GroupGradientX, GroupGradientY) / 65536.0f;
+		uint2 rateLog2 = (gradient < ContrastThreshold ? 1 : 0) + (gradient < ContrastThreshold * 0.25f ? 1 : 0);
+
+		// Reduce the shading rate of the fast moving pixels (blurred by the motion blur and temporal anti-aliasing)
+		float tileVelocity = asfloat(GroupVelocity);
+		uint velocityRateLog2 = (tileVelocity > VelocityThreshold ? 1 : 0) + (tileVelocity > VelocityThreshold * 3.0f ? 1 : 0);
+		rateLog2 = max(rateLog2, velocityRateLog2);
+
+		ShadingRateImage[groupId.xy] = EncodeShadingRate(rateLog2);
+	}
+}
+
+#endif
@@ -43,7 +43,8 @@ uint MissedHistorySamplesCount;
 uint3 GridSizeInt;
 float PhaseG;
 
-float2 Dummy0;
+uint FroxelsUpdateRate;
+uint FroxelsUpdateFrame;
 float VolumetricFogMaxDistance;
 float InverseSquaredLightDistanceBiasScale;
 
@@ -86,6 +87,12 @@ float GetPhase(float g, float cosTheta)
 	return HenyeyGreensteinPhase(g, cosTheta);
 }
 
+// Checks if the froxel reuses the reprojected lighting history in the current frame (froxels are updated in an interleaved pattern over FroxelsUpdateRate frames)
+bool IsFroxelReused(uint3 gridCoordinate)
+{
+	return FroxelsUpdateRate > 1 && (gridCoordinate.x + gridCoordinate.y + gridCoordinate.z + FroxelsUpdateFrame) % FroxelsUpdateRate != 0;
+}
+
 float GetSliceDepth(float zSlice)
 {
 	return (zSlice / GridSize.z) * VolumetricFogMaxDistance;
@@ -202,6 +209,10 @@ float4 PS_InjectLight(Quad_GS2PS input) : SV_Target0
 	FLATTEN
 	if (any(historyUV < 0) || any(historyUV > 1))
 		historyAlpha = 0;
+
+	// Skip froxels that reuse the lighting history in this frame
+	if (historyAlpha > 0 && IsFroxelReused(gridCoordinate))
+		return 0;
 	uint samplesCount = historyAlpha < 0.001f ? MissedHistorySamplesCount : 1;
 
 	float NoL = 0;
@@ -305,6 +316,19 @@ void CS_LightScattering(uint3 GroupId : SV_GroupID, uint3 DispatchThreadId : SV_
 	FLATTEN
 	if (any(historyUV < 0) || any(historyUV > 1))
 		historyAlpha = 0;
+
+	// Reuse the reprojected lighting history for froxels not updated in this frame
+	BRANCH
+	if (historyAlpha > 0 && IsFroxelReused(gridCoordinate))
+	{
+		if (all(gridCoordinate < GridSizeInt))
+		{
+			float4 historyScatteringAndExtinction = LightScatteringHistory.SampleLevel(SamplerLinearClamp, historyUV, 0);
+			historyScatteringAndExtinction = isnan(historyScatteringAndExtinction) || isinf(historyScatteringAndExtinction) ? 0 : historyScatteringAndExtinction;
+			RWLightScattering[gridCoordinate] = max(historyScatteringAndExtinction, 0);
+		}
+		return;
+	}
 	samplesCount = historyAlpha < 0.001f && all(gridCoordinate < GridSizeInt) ? MissedHistorySamplesCount : 1;
 
 	for (uint sampleIndex = 0; sampleIndex < samplesCount; sampleIndex++)
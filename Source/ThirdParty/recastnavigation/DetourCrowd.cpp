@@ -340,7 +340,18 @@ dtCrowd::dtCrowd() :
 	m_maxPathResult(0),
 	m_maxAgentRadius(0),
 	m_velocitySampleCount(0),
-	m_navquery(0)
+	m_navquery(0),
+	m_parallelFor(0),
+	m_parallelForUserData(0),
+	m_maxThreads(0),
+	m_threadNavQueries(0),
+	m_threadObstacleQueries(0),
+	m_threadVelocitySampleCounts(0),
+	m_sortItems(0),
+	m_updateDt(0),
+	m_updateDebug(0),
+	m_updateAgents(0),
+	m_updateAgentsCount(0)
 {
 }
 
@@ -349,8 +360,33 @@ dtCrowd::~dtCrowd()
 	purge();
 }
 
+void dtCrowd::purgeThreads()
+{
+	// Thread 0 uses the crowd queries
+	for (int i = 1; i < m_maxThreads; ++i)
+	{
+		if (m_threadNavQueries)
+			dtFreeNavMeshQuery(m_threadNavQueries[i]);
+		if (m_threadObstacleQueries)
+			dtFreeObstacleAvoidanceQuery(m_threadObstacleQueries[i]);
+	}
+	dtFree(m_threadNavQueries);
+	m_threadNavQueries = 0;
+	dtFree(m_threadObstacleQueries);
+	m_threadObstacleQueries = 0;
+	dtFree(m_threadVelocitySampleCounts);
+	m_threadVelocitySampleCounts = 0;
+	dtFree(m_sortItems);
+	m_sortItems = 0;
+	m_maxThreads = 0;
+	m_parallelFor = 0;
+	m_parallelForUserData = 0;
+}
+
 void dtCrowd::purge()
 {
+	purgeThreads();
+
 	for (int i = 0; i < m_maxAgents; ++i)
 		m_agents[i].~dtCrowdAgent();
 	dtFree(m_agents);
@@ -462,6 +498,46 @@ bool dtCrowd::init(const int maxAgents, const float maxAgentRadius, dtNavMesh* n
 	return true;
 }
 
+bool dtCrowd::setParallelFor(dtCrowdParallelFor func, void* userData, const int maxThreads)
+{
+	purgeThreads();
+	if (!func || maxThreads <= 1 || !m_navquery)
+		return true;
+
+	m_threadNavQueries = (dtNavMeshQuery**)dtAlloc(sizeof(dtNavMeshQuery*)*maxThreads, DT_ALLOC_PERM);
+	m_threadObstacleQueries = (dtObstacleAvoidanceQuery**)dtAlloc(sizeof(dtObstacleAvoidanceQuery*)*maxThreads, DT_ALLOC_PERM);
+	m_threadVelocitySampleCounts = (int*)dtAlloc(sizeof(int)*maxThreads, DT_ALLOC_PERM);
+	m_sortItems = (SortItem*)dtAlloc(sizeof(SortItem)*m_maxAgents, DT_ALLOC_PERM);
+	if (!m_threadNavQueries || !m_threadObstacleQueries || !m_threadVelocitySampleCounts || !m_sortItems)
+	{
+		purgeThreads();
+		return false;
+	}
+	memset(m_threadNavQueries, 0, sizeof(dtNavMeshQuery*)*maxThreads);
+	memset(m_threadObstacleQueries, 0, sizeof(dtObstacleAvoidanceQuery*)*maxThreads);
+	m_maxThreads = maxThreads;
+
+	// Each thread needs own queries since they use internal state (node pools and obstacles)
+	m_threadNavQueries[0] = m_navquery;
+	m_threadObstacleQueries[0] = m_obstacleQuery;
+	for (int i = 1; i < maxThreads; ++i)
+	{
+		m_threadNavQueries[i] = dtAllocNavMeshQuery();
+		m_threadObstacleQueries[i] = dtAllocObstacleAvoidanceQuery();
+		if (!m_threadNavQueries[i] || !m_threadObstacleQueries[i] ||
+			dtStatusFailed(m_threadNavQueries[i]->init(m_navquery->getAttachedNavMesh(), MAX_COMMON_NODES)) ||
+			!m_threadObstacleQueries[i]->init(6, 8))
+		{
+			purgeThreads();
+			return false;
+		}
+	}
+
+	m_parallelFor = func;
+	m_parallelForUserData = userData;
+	return true;
+}
+
 void dtCrowd::setObstacleAvoidanceParams(const int idx, const dtObstacleAvoidanceParams* params)
 {
 	if (idx >= 0 && idx < DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS)
@@ -1044,49 +1120,91 @@ void dtCrowd::checkPathValidity(dtCrowdAgent** agents, const int nagents, const
 	}
 }
 	
-void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
+static int compareSortItems(const void* a, const void* b)
 {
-	m_velocitySampleCount = 0;
-	
-	const int debugIdx = debug ? debug->idx : -1;
-	
-	dtCrowdAgent** agents = m_activeAgents;
-	int nagents = getActiveAgents(agents, m_maxAgents);
-
-	// Check that all agents still have valid paths.
-	checkPathValidity(agents, nagents, dt);
-	
-	// Update async move request and path finder.
-	updateMoveRequest(dt);
+	const int* ca = (const int*)a;
+	const int* cb = (const int*)b;
+	if (ca[1] != cb[1])
+		return ca[1] < cb[1] ? -1 : 1;
+	if (ca[0] != cb[0])
+		return ca[0] < cb[0] ? -1 : 1;
+	return 0;
+}
 
-	// Optimize path topology.
-	updateTopologyOptimization(agents, nagents, dt);
-	
-	// Register agents to proximity grid.
-	m_grid->clear();
+void dtCrowd::sortAgents(dtCrowdAgent** agents, const int nagents)
+{
+	// Order agents by the proximity grid cells (rows), so the contiguous ranges of agents processed
+	// by the parallel jobs are spatial partitions of the crowd. Ties are resolved with agent index to keep the order stable.
+	const float invCellSize = 1.0f / m_grid->getCellSize();
 	for (int i = 0; i < nagents; ++i)
 	{
-		dtCrowdAgent* ag = agents[i];
-		const float* p = ag->npos;
-		const float r = ag->params.radius;
-		m_grid->addItem((unsigned short)i, p[0]-r, p[2]-r, p[0]+r, p[2]+r);
+		SortItem& item = m_sortItems[i];
+		item.cell[0] = (int)dtMathFloorf(agents[i]->npos[0] * invCellSize);
+		item.cell[1] = (int)dtMathFloorf(agents[i]->npos[2] * invCellSize);
+		item.agent = agents[i];
+	}
+	for (int i = 1; i < nagents; ++i)
+	{
+		// Agents move a little between the updates so the list is mostly sorted already (cheaper than qsort and stable)
+		SortItem item = m_sortItems[i];
+		int j = i - 1;
+		while (j >= 0 && compareSortItems(m_sortItems[j].cell, item.cell) > 0)
+		{
+			m_sortItems[j + 1] = m_sortItems[j];
+			--j;
+		}
+		m_sortItems[j + 1] = item;
 	}
-	
-	// Get nearby navmesh segments and agents to collide with.
 	for (int i = 0; i < nagents; ++i)
+		agents[i] = m_sortItems[i].agent;
+}
+
+void dtCrowd::runUpdatePhaseJob(void* data, int begin, int end, int threadIndex)
+{
+	const UpdatePhaseJob* job = (const UpdatePhaseJob*)data;
+	(job->crowd->*job->phase)(begin, end, threadIndex);
+}
+
+void dtCrowd::runUpdatePhase(UpdatePhase phase, const bool parallel)
+{
+	if (parallel)
+	{
+		UpdatePhaseJob job;
+		job.crowd = this;
+		job.phase = phase;
+		m_parallelFor(m_parallelForUserData, m_updateAgentsCount, m_maxThreads, runUpdatePhaseJob, &job);
+	}
+	else
+	{
+		(this->*phase)(0, m_updateAgentsCount, 0);
+	}
+}
+
+void dtCrowd::updateSteering(const int begin, const int end, const int threadIndex)
+{
+	dtCrowdAgent** agents = m_updateAgents;
+	const int nagents = m_updateAgentsCount;
+	dtCrowdAgentDebugInfo* debug = m_updateDebug;
+	const int debugIdx = debug ? debug->idx : -1;
+	dtNavMeshQuery* navquery = threadIndex == 0 ? m_navquery : m_threadNavQueries[threadIndex];
+
+	// Agents read only the positions of the other agents here (not modified until integration),
+	// so the neighbours, corners, off-mesh connections and steering can be processed per-agent in a single pass.
+	for (int i = begin; i < end; ++i)
 	{
 		dtCrowdAgent* ag = agents[i];
 		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
 			continue;
 
+		// Get nearby navmesh segments and agents to collide with.
 		// Update the collision boundary after certain distance has been passed or
 		// if it has become invalid.
 		const float updateThr = ag->params.collisionQueryRange*0.25f;
 		if (dtVdist2DSqr(ag->npos, ag->boundary.getCenter()) > dtSqr(updateThr) ||
-			!ag->boundary.isValid(m_navquery, &m_filters[ag->params.queryFilterType]))
+			!ag->boundary.isValid(navquery, &m_filters[ag->params.queryFilterType]))
 		{
 			ag->boundary.update(ag->corridor.getFirstPoly(), ag->npos, ag->params.collisionQueryRange,
-								m_navquery, &m_filters[ag->params.queryFilterType]);
+								navquery, &m_filters[ag->params.queryFilterType]);
 		}
 		// Query neighbour agents
 		ag->nneis = getNeighbours(ag->npos, ag->params.height, ag->params.collisionQueryRange,
@@ -1094,95 +1212,69 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 								  agents, nagents, m_grid);
 		for (int j = 0; j < ag->nneis; j++)
 			ag->neis[j].idx = getAgentIndex(agents[ag->neis[j].idx]);
-	}
-	
-	// Find next corner to steer to.
-	for (int i = 0; i < nagents; ++i)
-	{
-		dtCrowdAgent* ag = agents[i];
-		
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		if (ag->targetState == DT_CROWDAGENT_TARGET_NONE || ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
-			continue;
-		
-		// Find corners for steering
-		ag->ncorners = ag->corridor.findCorners(ag->cornerVerts, ag->cornerFlags, ag->cornerPolys,
-												DT_CROWDAGENT_MAX_CORNERS, m_navquery, &m_filters[ag->params.queryFilterType]);
-		
-		// Check to see if the corner after the next corner is directly visible,
-		// and short cut to there.
-		if ((ag->params.updateFlags & DT_CROWD_OPTIMIZE_VIS) && ag->ncorners > 0)
+
+		if (ag->targetState != DT_CROWDAGENT_TARGET_NONE && ag->targetState != DT_CROWDAGENT_TARGET_VELOCITY)
 		{
-			const float* target = &ag->cornerVerts[dtMin(1,ag->ncorners-1)*3];
-			ag->corridor.optimizePathVisibility(target, ag->params.pathOptimizationRange, m_navquery, &m_filters[ag->params.queryFilterType]);
+			// Find next corner to steer to.
+			ag->ncorners = ag->corridor.findCorners(ag->cornerVerts, ag->cornerFlags, ag->cornerPolys,
+													DT_CROWDAGENT_MAX_CORNERS, navquery, &m_filters[ag->params.queryFilterType]);
 			
-			// Copy data for debug purposes.
-			if (debugIdx == i)
+			// Check to see if the corner after the next corner is directly visible,
+			// and short cut to there.
+			if ((ag->params.updateFlags & DT_CROWD_OPTIMIZE_VIS) && ag->ncorners > 0)
 			{
-				dtVcopy(debug->optStart, ag->corridor.getPos());
-				dtVcopy(debug->optEnd, target);
+				const float* target = &ag->cornerVerts[dtMin(1,ag->ncorners-1)*3];
+				ag->corridor.optimizePathVisibility(target, ag->params.pathOptimizationRange, navquery, &m_filters[ag->params.queryFilterType]);
+				
+				// Copy data for debug purposes.
+				if (debugIdx == i)
+				{
+					dtVcopy(debug->optStart, ag->corridor.getPos());
+					dtVcopy(debug->optEnd, target);
+				}
 			}
-		}
-		else
-		{
-			// Copy data for debug purposes.
-			if (debugIdx == i)
+			else
 			{
-				dtVset(debug->optStart, 0,0,0);
-				dtVset(debug->optEnd, 0,0,0);
+				// Copy data for debug purposes.
+				if (debugIdx == i)
+				{
+					dtVset(debug->optStart, 0,0,0);
+					dtVset(debug->optEnd, 0,0,0);
+				}
 			}
-		}
-	}
-	
-	// Trigger off-mesh connections (depends on corners).
-	for (int i = 0; i < nagents; ++i)
-	{
-		dtCrowdAgent* ag = agents[i];
-		
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
-		if (ag->targetState == DT_CROWDAGENT_TARGET_NONE || ag->targetState == DT_CROWDAGENT_TARGET_VELOCITY)
-			continue;
-		
-		// Check 
-		const float triggerRadius = ag->params.radius*2.25f;
-		if (overOffmeshConnection(ag, triggerRadius))
-		{
-			// Prepare to off-mesh connection.
-			const int idx = (int)(ag - m_agents);
-			dtCrowdAgentAnimation* anim = &m_agentAnims[idx];
-			
-			// Adjust the path over the off-mesh connection.
-			dtPolyRef refs[2];
-			if (ag->corridor.moveOverOffmeshConnection(ag->cornerPolys[ag->ncorners-1], refs,
-													   anim->startPos, anim->endPos, m_navquery))
+
+			// Trigger off-mesh connections (depends on corners).
+			const float triggerRadius = ag->params.radius*2.25f;
+			if (overOffmeshConnection(ag, triggerRadius))
 			{
-				dtVcopy(anim->initPos, ag->npos);
-				anim->polyRef = refs[1];
-				anim->active = true;
-				anim->t = 0.0f;
-				anim->tmax = (dtVdist2D(anim->startPos, anim->endPos) / ag->params.maxSpeed) * 0.5f;
+				// Prepare to off-mesh connection.
+				const int idx = (int)(ag - m_agents);
+				dtCrowdAgentAnimation* anim = &m_agentAnims[idx];
 				
-				ag->state = DT_CROWDAGENT_STATE_OFFMESH;
-				ag->ncorners = 0;
-				ag->nneis = 0;
-				continue;
-			}
-			else
-			{
-				// Path validity check will ensure that bad/blocked connections will be replanned.
+				// Adjust the path over the off-mesh connection.
+				dtPolyRef refs[2];
+				if (ag->corridor.moveOverOffmeshConnection(ag->cornerPolys[ag->ncorners-1], refs,
+														   anim->startPos, anim->endPos, navquery))
+				{
+					dtVcopy(anim->initPos, ag->npos);
+					anim->polyRef = refs[1];
+					anim->active = true;
+					anim->t = 0.0f;
+					anim->tmax = (dtVdist2D(anim->startPos, anim->endPos) / ag->params.maxSpeed) * 0.5f;
+					
+					ag->state = DT_CROWDAGENT_STATE_OFFMESH;
+					ag->ncorners = 0;
+					ag->nneis = 0;
+					continue;
+				}
+				else
+				{
+					// Path validity check will ensure that bad/blocked connections will be replanned.
+				}
 			}
 		}
-	}
-		
-	// Calculate steering.
-	for (int i = 0; i < nagents; ++i)
-	{
-		dtCrowdAgent* ag = agents[i];
 
-		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-			continue;
+		// Calculate steering.
 		if (ag->targetState == DT_CROWDAGENT_TARGET_NONE)
 			continue;
 		
@@ -1254,9 +1346,17 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 		// Set the desired velocity.
 		dtVcopy(ag->dvel, dvel);
 	}
-	
-	// Velocity planning.	
-	for (int i = 0; i < nagents; ++i)
+}
+
+void dtCrowd::updateVelocityPlanning(const int begin, const int end, const int threadIndex)
+{
+	dtCrowdAgent** agents = m_updateAgents;
+	dtCrowdAgentDebugInfo* debug = m_updateDebug;
+	const int debugIdx = debug ? debug->idx : -1;
+	dtObstacleAvoidanceQuery* obstacleQuery = threadIndex == 0 ? m_obstacleQuery : m_threadObstacleQueries[threadIndex];
+	int velocitySampleCount = 0;
+
+	for (int i = begin; i < end; ++i)
 	{
 		dtCrowdAgent* ag = agents[i];
 		
@@ -1265,13 +1365,13 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 		
 		if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
 		{
-			m_obstacleQuery->reset();
+			obstacleQuery->reset();
 			
 			// Add neighbours as obstacles.
 			for (int j = 0; j < ag->nneis; ++j)
 			{
 				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				m_obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
+				obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
 			}
 
 			// Append neighbour segments as obstacles.
@@ -1280,7 +1380,7 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 				const float* s = ag->boundary.getSegment(j);
 				if (dtTriArea2D(ag->npos, s, s+3) < 0.0f)
 					continue;
-				m_obstacleQuery->addSegment(s, s+3);
+				obstacleQuery->addSegment(s, s+3);
 			}
 
 			dtObstacleAvoidanceDebugData* vod = 0;
@@ -1295,15 +1395,15 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 				
 			if (adaptive)
 			{
-				ns = m_obstacleQuery->sampleVelocityAdaptive(ag->npos, ag->params.radius, ag->desiredSpeed,
-															 ag->vel, ag->dvel, ag->nvel, params, vod);
+				ns = obstacleQuery->sampleVelocityAdaptive(ag->npos, ag->params.radius, ag->desiredSpeed,
+														   ag->vel, ag->dvel, ag->nvel, params, vod);
 			}
 			else
 			{
-				ns = m_obstacleQuery->sampleVelocityGrid(ag->npos, ag->params.radius, ag->desiredSpeed,
-														 ag->vel, ag->dvel, ag->nvel, params, vod);
+				ns = obstacleQuery->sampleVelocityGrid(ag->npos, ag->params.radius, ag->desiredSpeed,
+													   ag->vel, ag->dvel, ag->nvel, params, vod);
 			}
-			m_velocitySampleCount += ns;
+			velocitySampleCount += ns;
 		}
 		else
 		{
@@ -1312,90 +1412,95 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 		}
 	}
 
-	// Integrate.
-	for (int i = 0; i < nagents; ++i)
+	if (m_threadVelocitySampleCounts)
+		m_threadVelocitySampleCounts[threadIndex] += velocitySampleCount;
+	else
+		m_velocitySampleCount += velocitySampleCount;
+}
+
+void dtCrowd::updateIntegration(const int begin, const int end, const int /*threadIndex*/)
+{
+	dtCrowdAgent** agents = m_updateAgents;
+	for (int i = begin; i < end; ++i)
 	{
 		dtCrowdAgent* ag = agents[i];
 		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
 			continue;
-		integrate(ag, dt);
+		integrate(ag, m_updateDt);
 	}
-	
-	// Handle collisions.
+}
+
+void dtCrowd::updateCollisions(const int begin, const int end, const int /*threadIndex*/)
+{
 	static const float COLLISION_RESOLVE_FACTOR = 0.7f;
-	
-	for (int iter = 0; iter < 4; ++iter)
+	dtCrowdAgent** agents = m_updateAgents;
+
+	// Agents only read the positions of the neighbours (also from the other partitions), the displacement is applied after all agents are done.
+	for (int i = begin; i < end; ++i)
 	{
-		for (int i = 0; i < nagents; ++i)
+		dtCrowdAgent* ag = agents[i];
+		const int idx0 = getAgentIndex(ag);
+		
+		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+			continue;
+
+		dtVset(ag->disp, 0,0,0);
+		
+		float w = 0;
+
+		for (int j = 0; j < ag->nneis; ++j)
 		{
-			dtCrowdAgent* ag = agents[i];
-			const int idx0 = getAgentIndex(ag);
-			
-			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-				continue;
+			const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
+			const int idx1 = getAgentIndex(nei);
 
-			dtVset(ag->disp, 0,0,0);
+			float diff[3];
+			dtVsub(diff, ag->npos, nei->npos);
+			diff[1] = 0;
 			
-			float w = 0;
-
-			for (int j = 0; j < ag->nneis; ++j)
+			float dist = dtVlenSqr(diff);
+			if (dist > dtSqr(ag->params.radius + nei->params.radius))
+				continue;
+			dist = dtMathSqrtf(dist);
+			float pen = (ag->params.radius + nei->params.radius) - dist;
+			if (dist < 0.0001f)
 			{
-				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				const int idx1 = getAgentIndex(nei);
-
-				float diff[3];
-				dtVsub(diff, ag->npos, nei->npos);
-				diff[1] = 0;
-				
-				float dist = dtVlenSqr(diff);
-				if (dist > dtSqr(ag->params.radius + nei->params.radius))
-					continue;
-				dist = dtMathSqrtf(dist);
-				float pen = (ag->params.radius + nei->params.radius) - dist;
-				if (dist < 0.0001f)
-				{
-					// Agents on top of each other, try to choose diverging separation directions.
-					if (idx0 > idx1)
-						dtVset(diff, -ag->dvel[2],0,ag->dvel[0]);
-					else
-						dtVset(diff, ag->dvel[2],0,-ag->dvel[0]);
-					pen = 0.01f;
-				}
+				// Agents on top of each other, try to choose diverging separation directions.
+				if (idx0 > idx1)
+					dtVset(diff, -ag->dvel[2],0,ag->dvel[0]);
 				else
-				{
-					pen = (1.0f/dist) * (pen*0.5f) * COLLISION_RESOLVE_FACTOR;
-				}
-				
-				dtVmad(ag->disp, ag->disp, diff, pen);			
-				
-				w += 1.0f;
+					dtVset(diff, ag->dvel[2],0,-ag->dvel[0]);
+				pen = 0.01f;
 			}
-			
-			if (w > 0.0001f)
+			else
 			{
-				const float iw = 1.0f / w;
-				dtVscale(ag->disp, ag->disp, iw);
+				pen = (1.0f/dist) * (pen*0.5f) * COLLISION_RESOLVE_FACTOR;
 			}
+			
+			dtVmad(ag->disp, ag->disp, diff, pen);			
+			
+			w += 1.0f;
 		}
 		
-		for (int i = 0; i < nagents; ++i)
+		if (w > 0.0001f)
 		{
-			dtCrowdAgent* ag = agents[i];
-			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
-				continue;
-			
-			dtVadd(ag->npos, ag->npos, ag->disp);
+			const float iw = 1.0f / w;
+			dtVscale(ag->disp, ag->disp, iw);
 		}
 	}
-	
-	for (int i = 0; i < nagents; ++i)
+}
+
+void dtCrowd::updateMovement(const int begin, const int end, const int threadIndex)
+{
+	dtCrowdAgent** agents = m_updateAgents;
+	dtNavMeshQuery* navquery = threadIndex == 0 ? m_navquery : m_threadNavQueries[threadIndex];
+	for (int i = begin; i < end; ++i)
 	{
 		dtCrowdAgent* ag = agents[i];
 		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
 			continue;
 		
 		// Move along navmesh.
-		ag->corridor.movePosition(ag->npos, m_navquery, &m_filters[ag->params.queryFilterType]);
+		ag->corridor.movePosition(ag->npos, navquery, &m_filters[ag->params.queryFilterType]);
 		// Get valid constrained position back.
 		dtVcopy(ag->npos, ag->corridor.getPos());
 
@@ -1405,8 +1510,78 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 			ag->corridor.reset(ag->corridor.getFirstPoly(), ag->npos);
 			ag->partial = false;
 		}
+	}
+}
+
+void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
+{
+	m_velocitySampleCount = 0;
+	
+	dtCrowdAgent** agents = m_activeAgents;
+	int nagents = getActiveAgents(agents, m_maxAgents);
+
+	// Check that all agents still have valid paths.
+	checkPathValidity(agents, nagents, dt);
+	
+	// Update async move request and path finder.
+	updateMoveRequest(dt);
 
+	// Optimize path topology.
+	updateTopologyOptimization(agents, nagents, dt);
+
+	// Debug info refers to the agent by its index so keep the order and serial update when debugging.
+	const bool parallel = m_parallelFor && !debug && nagents > 1;
+	if (parallel)
+	{
+		sortAgents(agents, nagents);
+		memset(m_threadVelocitySampleCounts, 0, sizeof(int)*m_maxThreads);
 	}
+	m_updateDt = dt;
+	m_updateDebug = debug;
+	m_updateAgents = agents;
+	m_updateAgentsCount = nagents;
+	
+	// Register agents to proximity grid.
+	m_grid->clear();
+	for (int i = 0; i < nagents; ++i)
+	{
+		dtCrowdAgent* ag = agents[i];
+		const float* p = ag->npos;
+		const float r = ag->params.radius;
+		m_grid->addItem((unsigned short)i, p[0]-r, p[2]-r, p[0]+r, p[2]+r);
+	}
+	
+	// Get nearby navmesh segments and agents to collide with, find corners, trigger off-mesh connections and calculate steering.
+	runUpdatePhase(&dtCrowd::updateSteering, parallel);
+	
+	// Velocity planning.	
+	runUpdatePhase(&dtCrowd::updateVelocityPlanning, parallel);
+	if (parallel)
+	{
+		for (int i = 0; i < m_maxThreads; ++i)
+			m_velocitySampleCount += m_threadVelocitySampleCounts[i];
+	}
+
+	// Integrate.
+	runUpdatePhase(&dtCrowd::updateIntegration, parallel);
+	
+	// Handle collisions.
+	for (int iter = 0; iter < 4; ++iter)
+	{
+		runUpdatePhase(&dtCrowd::updateCollisions, parallel);
+		
+		for (int i = 0; i < nagents; ++i)
+		{
+			dtCrowdAgent* ag = agents[i];
+			if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+				continue;
+			
+			dtVadd(ag->npos, ag->npos, ag->disp);
+		}
+	}
+	
+	// Move along navmesh.
+	runUpdatePhase(&dtCrowd::updateMovement, parallel);
 	
 	// Update agents using off-mesh connection.
 	for (int i = 0; i < nagents; ++i)
@@ -1447,4 +1622,5 @@ void dtCrowd::update(const float dt, dtCrowdAgentDebugInfo* debug)
 		dtVset(ag->dvel, 0,0,0);
 	}
 	
+	m_updateDebug = 0;
 }
@@ -200,6 +200,24 @@ struct dtCrowdAgentDebugInfo
 
 /// Provides local steering behaviors for a group of agents. 
 /// @ingroup crowd
+/// The crowd update job that processes the range of agents.
+/// @param[in]	data		The job data (pass the value given to dtCrowdParallelFor).
+/// @param[in]	begin		The first agent index (in the active agents list).
+/// @param[in]	end			The last agent index (exclusive).
+/// @param[in]	threadIndex	The index of the per-thread crowd resources to use. [Limit: 0 <= value < maxJobs]
+///							Jobs running at the same time must use different indices.
+typedef void (*dtCrowdParallelJob)(void* data, int begin, int end, int threadIndex);
+
+/// The function used by the crowd to run the update job over the agents (eg. on a job system).
+/// It should split the agents into up to maxJobs contiguous ranges (subsequent agents are spatially close),
+/// call the job for each range with its job index as threadIndex and return once all jobs are done.
+/// @param[in]	userData	The user data passed to dtCrowd::setParallelFor.
+/// @param[in]	count		The amount of agents to process.
+/// @param[in]	maxJobs		The maximum amount of jobs to run.
+/// @param[in]	job			The job to run.
+/// @param[in]	data		The job data.
+typedef void (*dtCrowdParallelFor)(void* userData, int count, int maxJobs, dtCrowdParallelJob job, void* data);
+
 class dtCrowd
 {
 	int m_maxAgents;
@@ -227,6 +245,34 @@ class dtCrowd
 
 	dtNavMeshQuery* m_navquery;
 
+	struct SortItem
+	{
+		int cell[2];
+		dtCrowdAgent* agent;
+	};
+
+	typedef void (dtCrowd::*UpdatePhase)(const int begin, const int end, const int threadIndex);
+
+	struct UpdatePhaseJob
+	{
+		dtCrowd* crowd;
+		UpdatePhase phase;
+	};
+
+	dtCrowdParallelFor m_parallelFor;
+	void* m_parallelForUserData;
+	int m_maxThreads;
+	dtNavMeshQuery** m_threadNavQueries;
+	dtObstacleAvoidanceQuery** m_threadObstacleQueries;
+	int* m_threadVelocitySampleCounts;
+	SortItem* m_sortItems;
+
+	// The state of the update (used by the update phases).
+	float m_updateDt;
+	dtCrowdAgentDebugInfo* m_updateDebug;
+	dtCrowdAgent** m_updateAgents;
+	int m_updateAgentsCount;
+
 	void updateTopologyOptimization(dtCrowdAgent** agents, const int nagents, const float dt);
 	void updateMoveRequest(const float dt);
 	void checkPathValidity(dtCrowdAgent** agents, const int nagents, const float dt);
@@ -236,7 +282,17 @@ class dtCrowd
 	bool requestMoveTargetReplan(const int idx, dtPolyRef ref, const float* pos);
 
 	void purge();
-	
+	void purgeThreads();
+
+	void sortAgents(dtCrowdAgent** agents, const int nagents);
+	void runUpdatePhase(UpdatePhase phase, const bool parallel);
+	static void runUpdatePhaseJob(void* data, int begin, int end, int threadIndex);
+	void updateSteering(const int begin, const int end, const int threadIndex);
+	void updateVelocityPlanning(const int begin, const int end, const int threadIndex);
+	void updateIntegration(const int begin, const int end, const int threadIndex);
+	void updateCollisions(const int begin, const int end, const int threadIndex);
+	void updateMovement(const int begin, const int end, const int threadIndex);
+
 public:
 	dtCrowd();
 	~dtCrowd();
@@ -316,6 +372,15 @@ class dtCrowd
 	///  @param[in]		dt		The time, in seconds, to update the simulation. [Limit: > 0]
 	///  @param[out]	debug	A debug object to load with debug information. [Opt]
 	void update(const float dt, dtCrowdAgentDebugInfo* debug);
+
+	/// Sets the function used to run the crowd update in parallel. Must be called after init.
+	/// Allocates the navmesh and obstacle avoidance queries for each thread.
+	/// Agents are processed in parallel only when updating without debug info.
+	///  @param[in]		func		The parallel-for function. Use null to update on a calling thread.
+	///  @param[in]		userData	The user data passed to the function.
+	///  @param[in]		maxThreads	The maximum amount of jobs run at once.
+	/// @return True if the resources have been successfully allocated.
+	bool setParallelFor(dtCrowdParallelFor func, void* userData, const int maxThreads);
 	
 	/// Gets the filter used by the crowd.
 	/// @return The filter used by the crowd.
@@ -254,6 +254,42 @@ public static bool UseCustomMarshalling(BuildData buildData, StructureInfo struc
         }
 #endif
 
+        /// <summary>
+        /// Checks if pass the span parameter as a pointer to the pinned managed memory (without allocating and copying the data via array marshaller). Used for spans of blittable types.
+        /// </summary>
+        /// <param name="buildData">The build data.</param>
+        /// <param name="parameterInfo">The function parameter.</param>
+        /// <param name="caller">The calling type. It's parent module types and references are used to find the given API type.</param>
+        /// <returns>True if pass the span parameter as a pointer to the pinned managed memory, otherwise false.</returns>
+        public static bool UsePinnedSpan(BuildData buildData, FunctionInfo.ParameterInfo parameterInfo, ApiTypeInfo caller)
+        {
+#if USE_NETCORE
+            var typeInfo = parameterInfo.Type;
+            if (typeInfo.Type != "Span" || typeInfo.GenericArgs == null || typeInfo.GenericArgs.Count != 1 || typeInfo.IsPtr || (typeInfo.IsRef && !typeInfo.IsConst) || parameterInfo.IsOut || parameterInfo.IsRef)
+                return false;
+            var elementType = typeInfo.GenericArgs[0];
+            if (elementType.IsPtr || elementType.IsRef || elementType.IsArray || elementType.GenericArgs != null)
+                return false;
+
+            // Skip booleans to match the array marshalling
+            if (elementType.Type == "bool")
+                return false;
+            if (CSharpNativeToManagedBasicTypes.ContainsKey(elementType.Type))
+                return true;
+
+            // POD structures (without custom marshalling) and enums have the same memory layout in C# and C++
+            var apiType = FindApiTypeInfo(buildData, elementType, caller);
+            if (apiType == null)
+                return false;
+            apiType.EnsureInited(buildData);
+            if (apiType.IsEnum)
+                return true;
+            return apiType is StructureInfo structureInfo && structureInfo.IsPod && !UseCustomMarshalling(buildData, structureInfo, caller);
+#else
+            return false;
+#endif
+        }
+
         /// <summary>
         /// Finds the API type information.
         /// </summary>
@@ -500,6 +500,41 @@ private static void GenerateCSharpManagedTypeInternals(BuildData buildData, ApiT
             GenerateCSharpTypeInternals?.Invoke(buildData, apiTypeInfo, contents, indent);
         }
 
+#if USE_NETCORE
+        private static void GenerateCSharpUnmanagedThunk(StringBuilder contents, string indent, string thunkName, string call, string baseCallInstance = null)
+        {
+            // Static method called directly from native code via function pointer (see MMethod::GetFunctionPointer)
+            if (baseCallInstance != null)
+            {
+                // Object which method is called by the managed code directly (eg. batched scripts update), native wrapper calls the base method when it's invoked for that object again (from the managed override)
+                contents.AppendLine();
+                contents.Append(indent).AppendLine("[ThreadStatic]");
+                contents.Append(indent).AppendLine($"internal static IntPtr {baseCallInstance};");
+            }
+            contents.AppendLine();
+            contents.Append(indent).AppendLine("[UnmanagedCallersOnly]");
+            contents.Append(indent).AppendLine($"internal static {(baseCallInstance != null ? "byte" : "void")} {thunkName}(IntPtr instance, IntPtr exception)");
+            contents.Append(indent).AppendLine("{");
+            if (baseCallInstance != null)
+            {
+                contents.Append(indent).AppendLine($"    if (instance == {baseCallInstance})");
+                contents.Append(indent).AppendLine("        return 1;");
+            }
+            contents.Append(indent).AppendLine("    try");
+            contents.Append(indent).AppendLine("    {");
+            contents.Append(indent).AppendLine($"        {call}");
+            contents.Append(indent).AppendLine("    }");
+            contents.Append(indent).AppendLine("    catch (Exception e)");
+            contents.Append(indent).AppendLine("    {");
+            contents.Append(indent).AppendLine("        if (exception != IntPtr.Zero)");
+            contents.Append(indent).AppendLine("            Marshal.WriteIntPtr(exception, ManagedHandle.ToIntPtr(e, GCHandleType.Weak));");
+            contents.Append(indent).AppendLine("    }");
+            if (baseCallInstance != null)
+                contents.Append(indent).AppendLine("    return 0;");
+            contents.Append(indent).AppendLine("}");
+        }
+#endif
+
         private static void GenerateCSharpWrapperFunction(BuildData buildData, StringBuilder contents, string indent, ApiTypeInfo caller, FunctionInfo functionInfo)
         {
             string returnValueType;
@@ -571,7 +606,9 @@ private static void GenerateCSharpWrapperFunction(BuildData buildData, StringBui
                 var nativeType = GenerateCSharpManagedToNativeType(buildData, parameterInfo.Type, caller);
 #if USE_NETCORE
                 string parameterMarshalType = "";
-                if (nativeType == "System.Type")
+                if (UsePinnedSpan(buildData, parameterInfo, caller))
+                    nativeType = GenerateCSharpNativeToManaged(buildData, parameterInfo.Type.GenericArgs[0], caller) + '*';
+                else if (nativeType == "System.Type")
                     parameterMarshalType = "MarshalUsing(typeof(FlaxEngine.Interop.SystemTypeMarshaller))";
                 else if (parameterInfo.Type.Type == "CultureInfo")
                     parameterMarshalType = "MarshalUsing(typeof(FlaxEngine.Interop.CultureInfoMarshaller))";
@@ -643,8 +680,9 @@ private static void GenerateCSharpWrapperFunction(BuildData buildData, StringBui
             contents.Append(')').Append(';').AppendLine();
         }
 
-        private static void GenerateCSharpWrapperFunctionCall(BuildData buildData, StringBuilder contents, ApiTypeInfo caller, FunctionInfo functionInfo, bool isSetter = false)
+        private static void GenerateCSharpWrapperFunctionCall(BuildData buildData, StringBuilder contents, ApiTypeInfo caller, FunctionInfo functionInfo, bool isSetter = false, bool useSpans = false)
         {
+            var pinnedSpans = 0;
 #if USE_NETCORE
             for (var i = 0; i < functionInfo.Parameters.Count; i++)
             {
@@ -652,9 +690,22 @@ private static void GenerateCSharpWrapperFunctionCall(BuildData buildData, Strin
                 if (parameterInfo.Type.IsArray || parameterInfo.Type.Type == "Array" || parameterInfo.Type.Type == "Span" || parameterInfo.Type.Type == "BytesContainer" || parameterInfo.Type.Type == "DataContainer" || parameterInfo.Type.Type == "BitArray")
                 {
                     if (!parameterInfo.IsOut)
-                        contents.Append($"var __{parameterInfo.Name}Count = {(isSetter ? "value" : parameterInfo.Name)}?.Length ?? 0; ");
+                        contents.Append($"var __{parameterInfo.Name}Count = {(isSetter ? "value" : parameterInfo.Name)}{(useSpans && UsePinnedSpan(buildData, parameterInfo, caller) ? ".Length" : "?.Length ?? 0")}; ");
                 }
             }
+            for (var i = 0; i < functionInfo.Parameters.Count; i++)
+            {
+                // Pin the memory of the blittable arrays (or spans) passed directly to the native code
+                var parameterInfo = functionInfo.Parameters[i];
+                if (UsePinnedSpan(buildData, parameterInfo, caller))
+                {
+                    var elementType = GenerateCSharpNativeToManaged(buildData, parameterInfo.Type.GenericArgs[0], caller);
+                    contents.Append($"fixed ({elementType}* __{parameterInfo.Name}Ptr = {(isSetter ? "value" : parameterInfo.Name)}) ");
+                    pinnedSpans++;
+                }
+            }
+            if (pinnedSpans != 0)
+                contents.Append("{ ");
 #endif
             if (functionInfo.Glue.UseReferenceForResult)
             {
@@ -686,7 +737,12 @@ private static void GenerateCSharpWrapperFunctionCall(BuildData buildData, Strin
 
                 var convertFunc = GenerateCSharpManagedToNativeConverter(buildData, parameterInfo.Type, caller);
                 var paramName = isSetter ? "value" : parameterInfo.Name;
-                if (string.IsNullOrWhiteSpace(convertFunc) || parameterInfo.IsOut)
+                if (pinnedSpans != 0 && UsePinnedSpan(buildData, parameterInfo, caller))
+                {
+                    // Pass pointer to the pinned memory
+                    contents.Append($"__{parameterInfo.Name}Ptr");
+                }
+                else if (string.IsNullOrWhiteSpace(convertFunc) || parameterInfo.IsOut)
                 {
                     // Pass value
                     contents.Append(paramName);
@@ -735,6 +791,8 @@ private static void GenerateCSharpWrapperFunctionCall(BuildData buildData, Strin
             {
                 contents.Append(" return __resultAsRef;");
             }
+            if (pinnedSpans != 0)
+                contents.Append(" }");
         }
 
         private static void GenerateCSharpComment(StringBuilder contents, string indent, string[] comment, bool skipMeta = false)
@@ -1046,6 +1104,13 @@ private static void GenerateCSharpClass(BuildData buildData, StringBuilder conte
                 }
                 contents.Append(");").AppendLine();
                 contents.Append(indent).Append('}').AppendLine();
+#if USE_NETCORE
+                if (UseCSharpUnmanagedThunk(classInfo, eventInfo))
+                {
+                    var eventTarget = eventInfo.IsStatic ? string.Empty : $"Unsafe.As<{classInfo.Name}>(ManagedHandle.FromIntPtr(instance).Target).";
+                    GenerateCSharpUnmanagedThunk(contents, indent, $"Internal_{eventInfo.Name}_Thunk", $"{eventTarget}Internal_{eventInfo.Name}_Invoke();");
+                }
+#endif
 
                 contents.AppendLine();
 #if !USE_NETCORE
@@ -1175,8 +1240,11 @@ private static void GenerateCSharpClass(BuildData buildData, StringBuilder conte
                 if (!useUnmanaged)
                     throw new Exception($"Not supported function {functionInfo.Name} inside non-static and non-scripting class type {classInfo.Name}.");
 
-                if (!functionInfo.NoProxy)
+                // Methods with blittable arrays get the additional overload that uses spans (eg. to pass the stack memory or the caller-provided buffer without allocations)
+                var useSpansOverload = !functionInfo.NoProxy && !functionInfo.IsVirtual && functionInfo.Parameters.Any(x => UsePinnedSpan(buildData, x, classInfo));
+                for (var overload = 0; !functionInfo.NoProxy && overload < (useSpansOverload ? 2 : 1); overload++)
                 {
+                    var useSpans = overload == 1;
                     contents.AppendLine();
                     GenerateCSharpComment(contents, indent, functionInfo.Comment);
                     GenerateCSharpAttributes(buildData, contents, indent, classInfo, functionInfo, true);
@@ -1197,6 +1265,9 @@ private static void GenerateCSharpClass(BuildData buildData, StringBuilder conte
                             contents.Append('[').Append(parameterInfo.Attributes).Append(']').Append(' ');
 
                         var managedType = GenerateCSharpNativeToManaged(buildData, parameterInfo.Type, classInfo);
+                        var useSpan = useSpans && UsePinnedSpan(buildData, parameterInfo, classInfo);
+                        if (useSpan)
+                            managedType = $"{(parameterInfo.Type.IsConst ? "System.ReadOnlySpan" : "System.Span")}<{GenerateCSharpNativeToManaged(buildData, parameterInfo.Type.GenericArgs[0], classInfo)}>";
                         if (parameterInfo.IsOut)
                             contents.Append("out ");
                         else if (parameterInfo.IsRef)
@@ -1207,7 +1278,8 @@ private static void GenerateCSharpClass(BuildData buildData, StringBuilder conte
                         contents.Append(' ');
                         contents.Append(parameterInfo.Name);
 
-                        var defaultValue = GenerateCSharpDefaultValueNativeToManaged(buildData, parameterInfo.DefaultValue, classInfo, parameterInfo.Type, false, managedType);
+                        // Span parameters have no default value to prevent ambiguous overloads
+                        var defaultValue = useSpan ? null : GenerateCSharpDefaultValueNativeToManaged(buildData, parameterInfo.DefaultValue, classInfo, parameterInfo.Type, false, managedType);
                         if (!string.IsNullOrEmpty(defaultValue))
                             contents.Append(" = ").Append(defaultValue);
                     }
@@ -1216,7 +1288,7 @@ private static void GenerateCSharpClass(BuildData buildData, StringBuilder conte
                     indent += "    ";
 
                     contents.Append(indent);
-                    GenerateCSharpWrapperFunctionCall(buildData, contents, classInfo, functionInfo);
+                    GenerateCSharpWrapperFunctionCall(buildData, contents, classInfo, functionInfo, false, useSpans);
 
                     indent = indent.Substring(0, indent.Length - 4);
                     contents.AppendLine();
@@ -1224,6 +1296,10 @@ private static void GenerateCSharpClass(BuildData buildData, StringBuilder conte
                 }
 
                 GenerateCSharpWrapperFunction(buildData, contents, indent, classInfo, functionInfo);
+#if USE_NETCORE
+                if (UseCSharpUnmanagedThunk(classInfo, functionInfo))
+                    GenerateCSharpUnmanagedThunk(contents, indent, $"Internal_{functionInfo.UniqueName}_Thunk", $"Unsafe.As<{classInfo.Name}>(ManagedHandle.FromIntPtr(instance).Target).{functionInfo.Name}();", $"Internal_{functionInfo.UniqueName}_BaseCallInstance");
+#endif
             }
 
             // Interface implementation
@@ -22,6 +22,26 @@ partial class BindingsGenerator
         public static readonly HashSet<FileInfo> CppReferencesFiles = new HashSet<FileInfo>();
         private static readonly List<FieldInfo> CppAutoSerializeFields = new List<FieldInfo>();
         private static readonly List<PropertyInfo> CppAutoSerializeProperties = new List<PropertyInfo>();
+        private static readonly HashSet<uint> CppAutoSerializeBinaryIds = new HashSet<uint>();
+        private static readonly HashSet<string> CppAutoSerializeBinaryPodTypes = new HashSet<string>
+        {
+            "Real",
+            "Float2", "Float3", "Float4",
+            "Double2", "Double3", "Double4",
+            "Int2", "Int3", "Int4",
+            "Vector2", "Vector3", "Vector4",
+            "Quaternion", "Color", "Color32",
+            "BoundingBox", "BoundingSphere", "Ray", "Rectangle", "Transform", "Matrix",
+            "Guid", "DateTime", "TimeSpan",
+        };
+        private static readonly HashSet<string> CppAutoSerializeBinaryReferenceTypes = new HashSet<string>
+        {
+            "ScriptingObjectReference",
+            "SoftObjectReference",
+            "AssetReference",
+            "WeakAssetReference",
+            "SoftAssetReference",
+        };
         public static readonly HashSet<string> CppIncludeFiles = new HashSet<string>();
         private static readonly List<string> CppIncludeFilesList = new List<string>();
         private static readonly HashSet<TypeInfo> CppVariantToTypes = new HashSet<TypeInfo>();
@@ -431,6 +451,26 @@ private static string GenerateCppGetNativeType(BuildData buildData, TypeInfo typ
             return $"{GenerateCppGetMClass(buildData, typeInfo, caller, null)}->GetType()";
         }
 
+        private static bool UseCSharpUnmanagedThunk(VirtualClassInfo classInfo, FunctionInfo functionInfo)
+        {
+#if USE_NETCORE
+            // Parameterless virtual methods (eg. script events like OnUpdate) are called via function pointer of the generated C# method marked with UnmanagedCallersOnly (no parameters boxing nor runtime invoke)
+            return classInfo is ClassInfo asClass && !asClass.IsSealed && asClass.IsScriptingObject && functionInfo.IsVirtual && !functionInfo.IsHidden && functionInfo.Parameters.Count == 0 && functionInfo.ReturnType.IsVoid;
+#else
+            return false;
+#endif
+        }
+
+        private static bool UseCSharpUnmanagedThunk(ClassInfo classInfo, EventInfo eventInfo)
+        {
+#if USE_NETCORE
+            // Parameterless events are invoked via function pointer of the generated C# method marked with UnmanagedCallersOnly (no runtime invoke)
+            return (eventInfo.Type.GenericArgs?.Count ?? 0) == 0;
+#else
+            return false;
+#endif
+        }
+
         private static string GenerateCppManagedWrapperName(ApiTypeInfo type)
         {
             var result = type.NativeName + "Managed";
@@ -1040,6 +1080,17 @@ private static void GenerateCppWrapperFunction(BuildData buildData, StringBuilde
                 var isOutWithManagedConverter = parameterInfo.IsOut && !string.IsNullOrEmpty(GenerateCSharpManagedToNativeConverter(buildData, parameterInfo.Type, caller));
                 if (isOutWithManagedConverter)
                     managedType = "MObject*";
+#if USE_NETCORE
+                var usePinnedSpan = UsePinnedSpan(buildData, parameterInfo, caller);
+                if (usePinnedSpan)
+                {
+                    // Span of blittable values points directly to the pinned managed memory
+                    var elementType = parameterInfo.Type.GenericArgs[0];
+                    managedType = elementType + "*";
+                    CppParamsWrappersCache[i] = $"Span<{elementType}>({{0}}, __{parameterInfo.Name}Count)";
+                    CppParamsThatNeedLocalVariable[i] = false;
+                }
+#endif
 
                 contents.Append(managedType);
                 if (parameterInfo.IsRef || parameterInfo.IsOut || UsePassByReference(buildData, parameterInfo.Type, caller))
@@ -1091,7 +1142,7 @@ private static void GenerateCppWrapperFunction(BuildData buildData, StringBuilde
                             Type = "int"
                         },
                         IsOut = parameterInfo.IsOut,
-                        IsRef = isRefOut || parameterInfo.Type.IsRef,
+                        IsRef = !usePinnedSpan && (isRefOut || parameterInfo.Type.IsRef),
                     });
                 }
 #endif
@@ -1434,6 +1485,37 @@ private static void GenerateCppManagedWrapperFunction(BuildData buildData, Strin
             GenerateCppVirtualWrapperCallBaseMethod(buildData, contents, classInfo, functionInfo, "managedTypePtr->Script.ScriptVTableBase", scriptVTableOffset);
             contents.AppendLine("        }");
 
+            if (UseCSharpUnmanagedThunk(classInfo, functionInfo))
+            {
+                // Call the managed method via generated C# thunk (engine classes are never hot-reloaded so the pointer can be cached)
+                contents.AppendLine("        typedef byte (*UnmanagedThunk)(MObject* instance, MObject** exception);");
+                if (buildData.Target.IsEditor && classInfo.ParentModule.Module.BinaryModuleName != "FlaxEngine")
+                    contents.AppendLine("        UnmanagedThunk unmanagedThunk = nullptr;");
+                else
+                    contents.AppendLine("        static UnmanagedThunk unmanagedThunk = nullptr;");
+                contents.AppendLine("        if (!unmanagedThunk)");
+                contents.AppendLine("        {");
+                contents.AppendLine($"            MMethod* thunkMethod = {classInfo.NativeName}::TypeInitializer.GetClass()->GetMethod(\"Internal_{functionInfo.UniqueName}_Thunk\", 2);");
+                contents.AppendLine("            CHECK(thunkMethod);");
+                contents.AppendLine("            unmanagedThunk = (UnmanagedThunk)thunkMethod->GetFunctionPointer();");
+                contents.AppendLine("        }");
+                contents.AppendLine($"        PROFILE_CPU_NAMED(\"{classInfo.FullNameManaged}::{functionInfo.Name}\");");
+                contents.AppendLine("        auto prevWrapperCallInstance = WrapperCallInstance;");
+                contents.AppendLine("        WrapperCallInstance = object;");
+                contents.AppendLine("        MObject* exception = nullptr;");
+                contents.AppendLine("        const bool callBase = unmanagedThunk(object->GetOrCreateManagedInstance(), &exception) != 0;");
+                contents.AppendLine("        WrapperCallInstance = prevWrapperCallInstance;");
+                contents.AppendLine("        if (exception)");
+                contents.AppendLine("            DebugLog::LogException(exception);");
+                contents.AppendLine("        if (callBase)");
+                contents.AppendLine("        {");
+                GenerateCppVirtualWrapperCallBaseMethod(buildData, contents, classInfo, functionInfo, "managedTypePtr->Script.ScriptVTableBase", scriptVTableOffset);
+                contents.AppendLine("        }");
+                contents.AppendLine("    }");
+                contents.AppendLine();
+                return;
+            }
+
             contents.AppendLine("        auto scriptVTable = (MMethod**)managedTypePtr->Script.ScriptVTable;");
             contents.AppendLine($"        ASSERT(scriptVTable && scriptVTable[{scriptVTableOffset}]);");
             contents.AppendLine($"        auto method = scriptVTable[{scriptVTableOffset}];");
@@ -1879,6 +1961,138 @@ private static void GenerateCppAutoSerialization(BuildData buildData, StringBuil
             }
 
             contents.Append('}').AppendLine();
+
+            GenerateCppAutoSerializationBinary(buildData, contents, typeInfo, typeNameNative, baseType);
+        }
+
+        private static bool GenerateCppAutoSerializationBinarySupported(BuildData buildData, ApiTypeInfo caller, TypeInfo typeInfo, bool isElement = false)
+        {
+            if (typeInfo.IsBitField || typeInfo.IsArray || typeInfo.IsRef)
+                return false;
+            var apiType = FindApiTypeInfo(buildData, typeInfo, caller);
+            if (typeInfo.IsPtr)
+                return !isElement && typeInfo.GenericArgs == null && apiType != null && apiType.IsScriptingObject;
+            if (typeInfo.GenericArgs != null)
+            {
+                if (isElement || typeInfo.GenericArgs.Count != 1)
+                    return false;
+                if (CppAutoSerializeBinaryReferenceTypes.Contains(typeInfo.Type))
+                    return true;
+                return typeInfo.Type == "Array" && GenerateCppAutoSerializationBinarySupported(buildData, caller, typeInfo.GenericArgs[0], true);
+            }
+            if (CSharpNativeToManagedBasicTypes.ContainsKey(typeInfo.Type) || CppAutoSerializeBinaryPodTypes.Contains(typeInfo.Type) || typeInfo.Type == "String" || typeInfo.Type == "StringAnsi")
+                return true;
+            if (apiType != null)
+            {
+                apiType.EnsureInited(buildData);
+                if (apiType.IsEnum)
+                    return true;
+                if (!isElement && apiType is StructureInfo structureInfo && structureInfo.IsAutoSerialization)
+                    return true;
+            }
+            return false;
+        }
+
+        private static uint GenerateCppAutoSerializationBinaryId(string name)
+        {
+            // FNV-1a hash of the member name (first ids are reserved)
+            uint hash = 2166136261;
+            foreach (var c in name)
+            {
+                hash ^= c;
+                hash *= 16777619;
+            }
+            if (hash <= 1)
+                hash += 2;
+            return hash;
+        }
+
+        private static void GenerateCppAutoSerializationBinary(BuildData buildData, StringBuilder contents, ApiTypeInfo typeInfo, string typeNameNative, ApiTypeInfo baseType)
+        {
+            // Use binary format only if all members can be serialized that way (with unique ids), otherwise fallback to Json
+            var useBinary = true;
+            CppAutoSerializeBinaryIds.Clear();
+            foreach (var fieldInfo in CppAutoSerializeFields)
+                useBinary &= GenerateCppAutoSerializationBinarySupported(buildData, typeInfo, fieldInfo.Type) && CppAutoSerializeBinaryIds.Add(GenerateCppAutoSerializationBinaryId(fieldInfo.Name));
+            foreach (var propertyInfo in CppAutoSerializeProperties)
+                useBinary &= GenerateCppAutoSerializationBinarySupported(buildData, typeInfo, propertyInfo.Type) && CppAutoSerializeBinaryIds.Add(GenerateCppAutoSerializationBinaryId(propertyInfo.Name));
+            if (!useBinary)
+            {
+                contents.AppendLine();
+                contents.Append($"void {typeNameNative}::SerializeBinary(WriteStream& stream, const void* otherObj)").AppendLine();
+                contents.Append('{').AppendLine();
+                contents.Append("    ISerializable::SerializeBinary(stream, otherObj);").AppendLine();
+                contents.Append('}').AppendLine();
+                contents.AppendLine();
+                contents.Append($"void {typeNameNative}::DeserializeBinary(ReadStream& stream, ISerializeModifier* modifier)").AppendLine();
+                contents.Append('{').AppendLine();
+                contents.Append("    ISerializable::DeserializeBinary(stream, modifier);").AppendLine();
+                contents.Append('}').AppendLine();
+                return;
+            }
+            CppIncludeFiles.Add("Engine/Serialization/BinarySerialization.h");
+
+            contents.AppendLine();
+            contents.Append($"void {typeNameNative}::SerializeBinary(WriteStream& stream, const void* otherObj)").AppendLine();
+            contents.Append('{').AppendLine();
+            contents.Append($"    SERIALIZE_GET_OTHER_OBJ({typeNameNative});").AppendLine();
+            contents.Append("    BinarySerialization::BeginObject(stream);").AppendLine();
+            if (baseType != null)
+            {
+                contents.Append("    {");
+                contents.Append(" const uint32 memberStart = BinarySerialization::BeginMember(stream, BinarySerialization::BaseMemberId);");
+                contents.Append($" {baseType.FullNameNative}::SerializeBinary(stream, otherObj);");
+                contents.Append(" BinarySerialization::EndMember(stream, memberStart);");
+                contents.Append(" }").AppendLine();
+            }
+            foreach (var fieldInfo in CppAutoSerializeFields)
+                contents.Append($"    BINARY_SERIALIZE_MEMBER(0x{GenerateCppAutoSerializationBinaryId(fieldInfo.Name):x8}, {fieldInfo.Name});").AppendLine();
+            foreach (var propertyInfo in CppAutoSerializeProperties)
+            {
+                // Skip writing deprecated properties (read-only deserialization to allow reading old data)
+                if (propertyInfo.HasAttribute("Obsolete"))
+                    continue;
+
+                contents.Append("    {");
+                contents.Append(" const auto");
+                if (propertyInfo.Getter.ReturnType.IsConstRef)
+                    contents.Append('&');
+                contents.Append($" value = {propertyInfo.Getter.Name}();");
+                var memberId = $"0x{GenerateCppAutoSerializationBinaryId(propertyInfo.Name):x8}";
+                contents.Append(" if (other) { const auto");
+                if (propertyInfo.Getter.ReturnType.IsConstRef)
+                    contents.Append('&');
+                contents.Append($" otherValue = other->{propertyInfo.Getter.Name}();");
+                contents.Append(" if (Serialization::ShouldSerialize(value, &otherValue)) { ");
+                contents.Append($"const uint32 memberStart = BinarySerialization::BeginMember(stream, {memberId}); BinarySerialization::Serialize(stream, value, &otherValue); BinarySerialization::EndMember(stream, memberStart);");
+                contents.Append(" } } else if (Serialization::ShouldSerialize(value, nullptr)) { ");
+                contents.Append($"const uint32 memberStart = BinarySerialization::BeginMember(stream, {memberId}); BinarySerialization::Serialize(stream, value, nullptr); BinarySerialization::EndMember(stream, memberStart);");
+                contents.Append(" } }").AppendLine();
+            }
+            contents.Append("    BinarySerialization::EndObject(stream);").AppendLine();
+            contents.Append('}').AppendLine();
+
+            contents.AppendLine();
+            contents.Append($"void {typeNameNative}::DeserializeBinary(ReadStream& stream, ISerializeModifier* modifier)").AppendLine();
+            contents.Append('{').AppendLine();
+            contents.Append("    if (!BinarySerialization::ReadObject(stream, this, modifier))").AppendLine();
+            contents.Append("        return;").AppendLine();
+            contents.Append("    uint32 id, end;").AppendLine();
+            contents.Append("    while (BinarySerialization::ReadMember(stream, id, end))").AppendLine();
+            contents.Append("    {").AppendLine();
+            contents.Append("        switch (id)").AppendLine();
+            contents.Append("        {").AppendLine();
+            if (baseType != null)
+                contents.Append($"        case BinarySerialization::BaseMemberId: {baseType.FullNameNative}::DeserializeBinary(stream, modifier); break;").AppendLine();
+            foreach (var fieldInfo in CppAutoSerializeFields)
+                contents.Append($"        case 0x{GenerateCppAutoSerializationBinaryId(fieldInfo.Name):x8}: BinarySerialization::Deserialize(stream, {fieldInfo.Name}, modifier); break;").AppendLine();
+            foreach (var propertyInfo in CppAutoSerializeProperties)
+                contents.Append($"        case 0x{GenerateCppAutoSerializationBinaryId(propertyInfo.Name):x8}: {{ auto p = {propertyInfo.Getter.Name}(); BinarySerialization::Deserialize(stream, p, modifier); {propertyInfo.Setter.Name}(p); break; }}").AppendLine();
+            contents.Append("        default: break;").AppendLine();
+            contents.Append("        }").AppendLine();
+            contents.Append("        stream.SetPosition(end);").AppendLine();
+            contents.Append("    }").AppendLine();
+            contents.Append('}').AppendLine();
         }
 
         private static string GenerateCppInterfaceInheritanceTable(BuildData buildData, StringBuilder contents, ModuleInfo moduleInfo, VirtualClassInfo typeInfo, string typeNameNative)
@@ -1949,58 +2163,86 @@ private static void GenerateCppClass(BuildData buildData, StringBuilder contents
                     }
                     contents.Append(')').AppendLine();
                     contents.Append("    {").AppendLine();
-                    if (buildData.Target.IsEditor)
-                        contents.Append("        MMethod* method = nullptr;").AppendLine(); // TODO: find a better way to cache event method in editor and handle C# hot-reload
-                    else
-                        contents.Append("        static MMethod* method = nullptr;").AppendLine();
-                    contents.Append("        if (!method)").AppendLine();
-                    contents.AppendFormat("            method = {1}::TypeInitializer.GetClass()->GetMethod(\"Internal_{0}_Invoke\", {2});", eventInfo.Name, classTypeNameNative, paramsCount).AppendLine();
-                    contents.Append("        CHECK(method);").AppendLine();
-                    contents.Append("        MObject* exception = nullptr;").AppendLine();
-                    if (paramsCount == 0)
-                        contents.AppendLine("        void** params = nullptr;");
-                    else
-                        contents.AppendLine($"        void* params[{paramsCount}];");
-                    for (var i = 0; i < paramsCount; i++)
+                    if (UseCSharpUnmanagedThunk(classInfo, eventInfo))
                     {
-                        var paramType = eventInfo.Type.GenericArgs[i];
-                        var paramName = "arg" + i;
-                        var paramIsRef = paramType.IsRef && !paramType.IsConst;
-                        var paramValue = GenerateCppWrapperNativeToManagedParam(buildData, contents, paramType, paramName, classInfo, paramIsRef, out CppParamsThatNeedConversion[i]);
-                        contents.Append($"        params[{i}] = {paramValue};").AppendLine();
+                        // Invoke the managed event via generated C# thunk
+                        CppIncludeFiles.Add("Engine/Scripting/ManagedCLR/MMethod.h");
+                        contents.Append("        typedef void (*UnmanagedThunk)(MObject* instance, MObject** exception);").AppendLine();
+                        if (buildData.Target.IsEditor && classInfo.ParentModule.Module.BinaryModuleName != "FlaxEngine")
+                            contents.Append("        UnmanagedThunk unmanagedThunk = nullptr;").AppendLine();
+                        else
+                            contents.Append("        static UnmanagedThunk unmanagedThunk = nullptr;").AppendLine();
+                        contents.Append("        if (!unmanagedThunk)").AppendLine();
+                        contents.Append("        {").AppendLine();
+                        contents.AppendFormat("            MMethod* thunkMethod = {1}::TypeInitializer.GetClass()->GetMethod(\"Internal_{0}_Thunk\", 2);", eventInfo.Name, classTypeNameNative).AppendLine();
+                        contents.Append("            CHECK(thunkMethod);").AppendLine();
+                        contents.Append("            unmanagedThunk = (UnmanagedThunk)thunkMethod->GetFunctionPointer();").AppendLine();
+                        contents.Append("        }").AppendLine();
+                        contents.Append("        MObject* exception = nullptr;").AppendLine();
+                        if (eventInfo.IsStatic)
+                            contents.AppendLine("        MObject* instance = nullptr;");
+                        else
+                            contents.AppendLine($"        MObject* instance = (({classTypeNameNative}*)this)->GetManagedInstance();");
+                        contents.Append("        unmanagedThunk(instance, &exception);").AppendLine();
+                        contents.Append("        if (exception)").AppendLine();
+                        contents.Append("            DebugLog::LogException(exception);").AppendLine();
+                        contents.Append("    }").AppendLine().AppendLine();
                     }
-                    if (eventInfo.IsStatic)
-                        contents.AppendLine("        MObject* instance = nullptr;");
                     else
-                        contents.AppendLine($"        MObject* instance = (({classTypeNameNative}*)this)->GetManagedInstance();");
-                    contents.Append("        method->Invoke(instance, params, &exception);").AppendLine();
-                    contents.Append("        if (exception)").AppendLine();
-                    contents.Append("            DebugLog::LogException(exception);").AppendLine();
-                    for (var i = 0; i < paramsCount; i++)
                     {
-                        var paramType = eventInfo.Type.GenericArgs[i];
-                        var paramIsRef = paramType.IsRef && !paramType.IsConst;
-                        if (paramIsRef)
+                        if (buildData.Target.IsEditor)
+                            contents.Append("        MMethod* method = nullptr;").AppendLine(); // TODO: find a better way to cache event method in editor and handle C# hot-reload
+                        else
+                            contents.Append("        static MMethod* method = nullptr;").AppendLine();
+                        contents.Append("        if (!method)").AppendLine();
+                        contents.AppendFormat("            method = {1}::TypeInitializer.GetClass()->GetMethod(\"Internal_{0}_Invoke\", {2});", eventInfo.Name, classTypeNameNative, paramsCount).AppendLine();
+                        contents.Append("        CHECK(method);").AppendLine();
+                        contents.Append("        MObject* exception = nullptr;").AppendLine();
+                        if (paramsCount == 0)
+                            contents.AppendLine("        void** params = nullptr;");
+                        else
+                            contents.AppendLine($"        void* params[{paramsCount}];");
+                        for (var i = 0; i < paramsCount; i++)
                         {
-                            // Convert value back from managed to native (could be modified there)
-                            paramType.IsRef = false;
-                            var managedToNative = GenerateCppWrapperManagedToNative(buildData, paramType, classInfo, out var managedType, out var apiType, null, out _);
-                            var passAsParamPtr = managedType.EndsWith("*");
-                            var useLocalVarPointer = CppParamsThatNeedConversion[i] && !apiType.IsValueType;
-                            var paramValue = useLocalVarPointer ? $"*({managedType}{(passAsParamPtr ? "" : "*")}*)params[{i}]" : $"({managedType}{(passAsParamPtr ? "" : "*")})params[{i}]";
-                            if (!string.IsNullOrEmpty(managedToNative))
+                            var paramType = eventInfo.Type.GenericArgs[i];
+                            var paramName = "arg" + i;
+                            var paramIsRef = paramType.IsRef && !paramType.IsConst;
+                            var paramValue = GenerateCppWrapperNativeToManagedParam(buildData, contents, paramType, paramName, classInfo, paramIsRef, out CppParamsThatNeedConversion[i]);
+                            contents.Append($"        params[{i}] = {paramValue};").AppendLine();
+                        }
+                        if (eventInfo.IsStatic)
+                            contents.AppendLine("        MObject* instance = nullptr;");
+                        else
+                            contents.AppendLine($"        MObject* instance = (({classTypeNameNative}*)this)->GetManagedInstance();");
+                        contents.Append("        method->Invoke(instance, params, &exception);").AppendLine();
+                        contents.Append("        if (exception)").AppendLine();
+                        contents.Append("            DebugLog::LogException(exception);").AppendLine();
+                        for (var i = 0; i < paramsCount; i++)
+                        {
+                            var paramType = eventInfo.Type.GenericArgs[i];
+                            var paramIsRef = paramType.IsRef && !paramType.IsConst;
+                            if (paramIsRef)
                             {
-                                if (!passAsParamPtr)
+                                // Convert value back from managed to native (could be modified there)
+                                paramType.IsRef = false;
+                                var managedToNative = GenerateCppWrapperManagedToNative(buildData, paramType, classInfo, out var managedType, out var apiType, null, out _);
+                                var passAsParamPtr = managedType.EndsWith("*");
+                                var useLocalVarPointer = CppParamsThatNeedConversion[i] && !apiType.IsValueType;
+                                var paramValue = useLocalVarPointer ? $"*({managedType}{(passAsParamPtr ? "" : "*")}*)params[{i}]" : $"({managedType}{(passAsParamPtr ? "" : "*")})params[{i}]";
+                                if (!string.IsNullOrEmpty(managedToNative))
+                                {
+                                    if (!passAsParamPtr)
+                                        paramValue = '*' + paramValue;
+                                    paramValue = string.Format(managedToNative, paramValue);
+                                }
+                                else if (!passAsParamPtr)
                                     paramValue = '*' + paramValue;
-                                paramValue = string.Format(managedToNative, paramValue);
+                                contents.Append($"        arg{i} = {paramValue};").AppendLine();
+                                paramType.IsRef = true;
                             }
-                            else if (!passAsParamPtr)
-                                paramValue = '*' + paramValue;
-                            contents.Append($"        arg{i} = {paramValue};").AppendLine();
-                            paramType.IsRef = true;
                         }
+                        contents.Append("    }").AppendLine().AppendLine();
                     }
-                    contents.Append("    }").AppendLine().AppendLine();
 
                     // C# event wrapper binding method (binds/unbinds C# wrapper to C++ delegate)
                     CppInternalCalls.Add(new KeyValuePair<string, string>(eventInfo.Name + "_Bind", eventInfo.Name + "_ManagedBind"));